@@ -330,11 +330,20 @@ inline bool graph_has_text_index(mgp_graph *graph, const char *index_name) {
   return MgInvoke<int>(mgp_graph_has_text_index, graph, index_name);
 }
 
+inline void graph_refresh_text_index(mgp_graph *graph, const char *index_name) {
+  MgInvokeVoid(mgp_graph_refresh_text_index, graph, index_name);
+}
+
 inline mgp_map *graph_search_text_index(mgp_graph *graph, const char *index_name, const char *search_query,
                                         text_search_mode search_mode, mgp_memory *memory) {
   return MgInvoke<mgp_map *>(mgp_graph_search_text_index, graph, index_name, search_query, search_mode, memory);
 }
 
+inline mgp_map *graph_search_vector_index(mgp_graph *graph, const char *label, const char *property, mgp_list *query,
+                                          size_t k, mgp_memory *memory) {
+  return MgInvoke<mgp_map *>(mgp_graph_search_vector_index, graph, label, property, query, k, memory);
+}
+
 inline mgp_map *graph_aggregate_over_text_index(mgp_graph *graph, const char *index_name, const char *search_query,
                                                 const char *aggregation_query, mgp_memory *memory) {
   return MgInvoke<mgp_map *>(mgp_graph_aggregate_over_text_index, graph, index_name, search_query, aggregation_query,
@@ -357,6 +366,27 @@ inline mgp_vertex *vertices_iterator_next(mgp_vertices_iterator *it) {
   return MgInvoke<mgp_vertex *>(mgp_vertices_iterator_next, it);
 }
 
+// mgp_vertices_partitions
+
+inline mgp_vertices_partitions *graph_partition_vertices(mgp_graph *g, size_t count, mgp_memory *memory) {
+  return MgInvoke<mgp_vertices_partitions *>(mgp_graph_partition_vertices, g, count, memory);
+}
+
+inline void vertices_partitions_destroy(mgp_vertices_partitions *partitions) {
+  mgp_vertices_partitions_destroy(partitions);
+}
+
+inline size_t vertices_partitions_size(mgp_vertices_partitions *partitions) {
+  return MgInvoke<size_t>(mgp_vertices_partitions_size, partitions);
+}
+
+inline size_t parallel_default_threads() { return MgInvoke<size_t>(mgp_parallel_default_threads); }
+
+inline void vertices_partitions_run(mgp_vertices_partitions *partitions, size_t threads, mgp_vertices_partition_cb cb,
+                                    void *payload) {
+  MgInvokeVoid(mgp_vertices_partitions_run, partitions, threads, cb, payload);
+}
+
 // mgp_edges_iterator
 
 inline void edges_iterator_destroy(mgp_edges_iterator *it) { mgp_edges_iterator_destroy(it); }
@@ -889,4 +919,46 @@ inline const char *execution_headers_at(mgp_execution_headers *headers, size_t i
 inline mgp_map *pull_one(mgp_execution_result *result, mgp_graph *graph, mgp_memory *memory) {
   return MgInvoke<mgp_map *>(mgp_pull_one, result, graph, memory);
 }
+
+// Transformation
+
+inline void module_add_transformation(mgp_module *module, const char *name, mgp_trans_cb cb) {
+  MgInvokeVoid(mgp_module_add_transformation, module, name, cb);
+}
+
+// mgp_message
+
+inline mgp_source_type message_source_type(mgp_message *message) {
+  return MgInvoke<mgp_source_type>(mgp_message_source_type, message);
+}
+
+inline const char *message_payload(mgp_message *message) {
+  return MgInvoke<const char *>(mgp_message_payload, message);
+}
+
+inline size_t message_payload_size(mgp_message *message) {
+  return MgInvoke<size_t>(mgp_message_payload_size, message);
+}
+
+inline const char *message_topic_name(mgp_message *message) {
+  return MgInvoke<const char *>(mgp_message_topic_name, message);
+}
+
+inline const char *message_key(mgp_message *message) { return MgInvoke<const char *>(mgp_message_key, message); }
+
+inline size_t message_key_size(mgp_message *message) { return MgInvoke<size_t>(mgp_message_key_size, message); }
+
+inline int64_t message_timestamp(mgp_message *message) {
+  return MgInvoke<int64_t>(mgp_message_timestamp, message);
+}
+
+inline int64_t message_offset(mgp_message *message) { return MgInvoke<int64_t>(mgp_message_offset, message); }
+
+// mgp_messages
+
+inline size_t messages_size(mgp_messages *messages) { return MgInvoke<size_t>(mgp_messages_size, messages); }
+
+inline mgp_message *messages_at(mgp_messages *messages, size_t index) {
+  return MgInvoke<mgp_message *>(mgp_messages_at, messages, index);
+}
 }  // namespace mgp
@@ -809,6 +809,17 @@ enum mgp_error mgp_edges_iterator_get(struct mgp_edges_iterator *it, struct mgp_
 /// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate a mgp_edge.
 enum mgp_error mgp_edges_iterator_next(struct mgp_edges_iterator *it, struct mgp_edge **result);
 
+/// Write the IDs of the neighbours on the other end of the current and the
+/// following edges into `ids`, at most `capacity` of them, and advance the
+/// iterator past those edges. Neighbours of the inbound edges are their start
+/// vertices, neighbours of the outbound edges are their end vertices.
+/// Result is the number of written IDs, which is smaller than `capacity` only
+/// if the end of the iteration has been reached.
+/// The mgp_edge obtained through mgp_edges_iterator_get will be invalidated.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate a mgp_edge.
+enum mgp_error mgp_edges_iterator_next_neighbor_ids(struct mgp_edges_iterator *it, struct mgp_vertex_id *ids,
+                                                    size_t capacity, size_t *result);
+
 /// ID of an edge; valid during a single query execution.
 struct mgp_edge_id {
   int64_t as_int;
@@ -891,10 +902,120 @@ enum mgp_error mgp_edge_iter_properties(struct mgp_edge *e, struct mgp_memory *m
 enum mgp_error mgp_graph_get_vertex_by_id(struct mgp_graph *g, struct mgp_vertex_id id, struct mgp_memory *memory,
                                           struct mgp_vertex **result);
 
+/// Write the values of the property named `property_name` of the `count`
+/// vertices with the given `ids` into `values`. The name is resolved once for
+/// all of them. The value is null if the vertex doesn't exist or doesn't have
+/// the property. Each resulting value must be freed with mgp_value_destroy.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate a mgp_value.
+/// Return mgp_error::MGP_ERROR_DELETED_OBJECT if one of the vertices has been deleted.
+enum mgp_error mgp_graph_get_vertices_property(struct mgp_graph *g, const struct mgp_vertex_id *ids, size_t count,
+                                               const char *property_name, struct mgp_memory *memory,
+                                               struct mgp_value **values);
+
+/// Outbound adjacency of a graph in the compressed sparse row format.
+struct mgp_csr;
+
+/// Export the outbound adjacency of the graph, so an algorithm can traverse
+/// it without creating a mgp_vertex and a mgp_edge for each step.
+/// The vertices are numbered from 0 in the order in which
+/// mgp_graph_iter_vertices iterates them. The end vertices of the outbound
+/// edges of the vertex `i` are `targets[offsets[i]]` to
+/// `targets[offsets[i + 1] - 1]`, given as the numbers of the vertices.
+/// Resulting mgp_csr must be freed with mgp_csr_destroy.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate the mgp_csr.
+enum mgp_error mgp_graph_export_csr(struct mgp_graph *g, struct mgp_memory *memory, struct mgp_csr **result);
+
+/// Free the memory used by a mgp_csr.
+void mgp_csr_destroy(struct mgp_csr *csr);
+
+/// Get the number of vertices in the exported graph.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_csr_vertex_count(struct mgp_csr *csr, size_t *result);
+
+/// Get the number of edges in the exported graph.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_csr_edge_count(struct mgp_csr *csr, size_t *result);
+
+/// Get the array of the IDs of the vertices, indexed by their numbers.
+/// The array lives as long as the mgp_csr.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_csr_vertex_ids(struct mgp_csr *csr, const struct mgp_vertex_id **result);
+
+/// Get the array of the vertex count + 1 positions where the targets of each vertex start.
+/// The array lives as long as the mgp_csr.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_csr_offsets(struct mgp_csr *csr, const size_t **result);
+
+/// Get the array of the edge count numbers of the end vertices of the edges.
+/// The array lives as long as the mgp_csr.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_csr_targets(struct mgp_csr *csr, const size_t **result);
+
+/// Named projection of a graph kept by the storage, see mgp_graph_get_projection.
+struct mgp_projection;
+
+/// Get the outbound adjacency, in the compressed sparse row format of mgp_csr,
+/// of the vertices which have any of the `label_count` labels, over the edges
+/// of the `edge_type_count` types between them, together with the values of
+/// the `property_count` properties of the vertices. Empty lists select all
+/// labels and all edge types.
+/// The storage keeps the projection as `name` and hands it out again to the
+/// calls with the same lists which see the same data, instead of rescanning
+/// the graph. Any committed change of the data makes the next call rebuild it.
+/// Resulting mgp_projection must be freed with mgp_projection_destroy.
+/// Return mgp_error::MGP_ERROR_LOGIC_ERROR if the graph is a projected subgraph or
+/// its vertices can be hidden by fine-grained access control.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate the mgp_projection.
+enum mgp_error mgp_graph_get_projection(struct mgp_graph *g, const char *name, const char *const *labels,
+                                        size_t label_count, const char *const *edge_types, size_t edge_type_count,
+                                        const char *const *properties, size_t property_count,
+                                        struct mgp_memory *memory, struct mgp_projection **result);
+
+/// Free the memory used by a mgp_projection.
+void mgp_projection_destroy(struct mgp_projection *projection);
+
+/// Get the number of the vertices of the projection.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_projection_vertex_count(struct mgp_projection *projection, size_t *result);
+
+/// Get the number of the edges of the projection.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_projection_edge_count(struct mgp_projection *projection, size_t *result);
+
+/// Get the array of the IDs of the vertices, indexed by their numbers.
+/// The array lives as long as the mgp_projection.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_projection_vertex_ids(struct mgp_projection *projection, const struct mgp_vertex_id **result);
+
+/// Get the array of the vertex count + 1 positions where the targets of each vertex start.
+/// The array lives as long as the mgp_projection.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_projection_offsets(struct mgp_projection *projection, const size_t **result);
+
+/// Get the array of the edge count numbers of the end vertices of the edges.
+/// The array lives as long as the mgp_projection.
+/// Current implementation always returns without errors.
+enum mgp_error mgp_projection_targets(struct mgp_projection *projection, const size_t **result);
+
+/// Get the value of the property at position `property` of the projection's
+/// properties of the vertex numbered `vertex`. The value is null if the vertex
+/// doesn't have the property.
+/// Resulting value must be freed with mgp_value_destroy.
+/// Return mgp_error::MGP_ERROR_OUT_OF_RANGE if `vertex` or `property` is out of range.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate a mgp_value.
+enum mgp_error mgp_projection_vertex_property(struct mgp_projection *projection, size_t vertex, size_t property,
+                                              struct mgp_memory *memory, struct mgp_value **result);
+
 /// Result is non-zero if the index with the given name exists.
 /// The current implementation always returns without errors.
 enum mgp_error mgp_graph_has_text_index(struct mgp_graph *graph, const char *index_name, int *result);
 
+/// Apply the committed changes which the storage hasn't applied to the named text index yet, so that the following
+/// searches see all committed transactions. Changes are only delayed if the text indices are refreshed in the
+/// background, otherwise this does nothing.
+/// Return mgp_error::MGP_ERROR_UNKNOWN_ERROR if the changes couldn't be applied.
+enum mgp_error mgp_graph_refresh_text_index(struct mgp_graph *graph, const char *index_name);
+
 /// Available modes of searching text indices.
 MGP_ENUM_CLASS text_search_mode{
     SPECIFIED_PROPERTIES,
@@ -921,6 +1042,17 @@ enum mgp_error mgp_graph_aggregate_over_text_index(struct mgp_graph *graph, cons
                                                    const char *search_query, const char *aggregation_query,
                                                    struct mgp_memory *memory, struct mgp_map **result);
 
+/// Search the vector index on the given label and property for the `k` vertices whose vectors are the most similar to
+/// `query` by cosine similarity. The result is a map with the "search_results" and "error_msg" keys.
+/// The "search_results" key contains a list of maps with the "node" and "similarity" keys, the most similar first.
+/// If there is no such index or `query` isn't a list of numbers of the index dimension, the "search_results" key is
+/// absent, and "error_msg" contains the error message.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if there’s an allocation error while constructing the results map.
+/// Return mgp_error::MGP_ERROR_KEY_ALREADY_EXISTS if the same key is being created in the results map more than once.
+enum mgp_error mgp_graph_search_vector_index(struct mgp_graph *graph, const char *label, const char *property,
+                                             struct mgp_list *query, size_t k, struct mgp_memory *memory,
+                                             struct mgp_map **result);
+
 /// Creates label index for given label.
 /// mgp_error::MGP_ERROR_NO_ERROR is always returned.
 /// if label index already exists, result will be 0, otherwise 1.
@@ -1372,6 +1504,57 @@ enum mgp_error mgp_duration_sub(struct mgp_duration *first, struct mgp_duration
 /// Result is NULL if the end of the iteration has been reached.
 /// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate a mgp_vertex.
 enum mgp_error mgp_vertices_iterator_next(struct mgp_vertices_iterator *it, struct mgp_vertex **result);
+
+/// Write the IDs of the current and the following vertices into `ids`, at
+/// most `capacity` of them, and advance the iterator past those vertices.
+/// Result is the number of written IDs, which is smaller than `capacity` only
+/// if the end of the iteration has been reached.
+/// The mgp_vertex obtained through mgp_vertices_iterator_get will be invalidated.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate a mgp_vertex.
+enum mgp_error mgp_vertices_iterator_next_ids(struct mgp_vertices_iterator *it, struct mgp_vertex_id *ids,
+                                              size_t capacity, size_t *result);
+
+/// Disjoint parts of the vertices of a graph which can be iterated on
+/// separate threads under the snapshot of the graph's transaction.
+struct mgp_vertices_partitions;
+
+/// Split the vertices of the graph into at most `count` disjoint partitions.
+/// Fewer partitions are made for small graphs, and a single one if the graph
+/// can't be iterated in parallel, e.g. it is a projected subgraph.
+/// Resulting mgp_vertices_partitions must be freed with mgp_vertices_partitions_destroy
+/// and must not outlive the graph.
+/// Return mgp_error::MGP_ERROR_INVALID_ARGUMENT if `count` is 0.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to allocate the mgp_vertices_partitions.
+enum mgp_error mgp_graph_partition_vertices(struct mgp_graph *g, size_t count, struct mgp_memory *memory,
+                                            struct mgp_vertices_partitions **result);
+
+/// Free the memory used by a mgp_vertices_partitions.
+void mgp_vertices_partitions_destroy(struct mgp_vertices_partitions *partitions);
+
+/// Get the number of partitions.
+enum mgp_error mgp_vertices_partitions_size(struct mgp_vertices_partitions *partitions, size_t *result);
+
+/// Called on a worker thread for each partition with an iterator over its
+/// vertices and a thread-safe memory for the allocations of the worker.
+/// The graph of the vertices is immutable. Returning anything but
+/// mgp_error::MGP_ERROR_NO_ERROR stops the workers.
+typedef enum mgp_error (*mgp_vertices_partition_cb)(size_t partition, struct mgp_vertices_iterator *vertices,
+                                                     struct mgp_memory *memory, void *payload);
+
+/// Get the number of threads mgp_vertices_partitions_run uses when 0 threads are requested.
+enum mgp_error mgp_parallel_default_threads(size_t *result);
+
+/// Call `cb` for every partition on a pool of `threads` worker threads, or on
+/// the default number of threads if `threads` is 0, and wait for all of them.
+/// Each worker takes the next unprocessed partition until none is left, so
+/// `cb` must be safe to call concurrently with the same `payload`.
+/// Partitions must not be run from a worker thread.
+/// Return the first error returned by `cb`; the partitions nobody started yet are
+/// skipped after it.
+/// Return mgp_error::MGP_ERROR_LOGIC_ERROR if the partitions have already been run.
+/// Return mgp_error::MGP_ERROR_UNABLE_TO_ALLOCATE if unable to start the workers.
+enum mgp_error mgp_vertices_partitions_run(struct mgp_vertices_partitions *partitions, size_t threads,
+                                           mgp_vertices_partition_cb cb, void *payload);
 ///@}
 
 /// @name Type System
@@ -42,6 +42,15 @@ class TextSearchException : public std::exception {
   std::string message_;
 };
 
+class VectorSearchException : public std::exception {
+ public:
+  explicit VectorSearchException(std::string message) : message_(std::move(message)) {}
+  const char *what() const noexcept override { return message_.c_str(); }
+
+ private:
+  std::string message_;
+};
+
 class IndexException : public std::exception {
  public:
   explicit IndexException(std::string message) : message_(std::move(message)) {}
@@ -471,6 +480,8 @@ class List {
   friend class Record;
   friend class Result;
   friend class Parameter;
+  friend List SearchVectorIndex(mgp_graph *memgraph_graph, std::string_view label, std::string_view property,
+                                const List &query, size_t k);
 
  public:
   /// @brief Creates a List from the copy of the given @ref mgp_list.
@@ -1479,6 +1490,89 @@ class Result {
 
 /* #endregion */
 
+/* #region Stream messages */
+
+/// @brief Type of the stream source a @ref Message was consumed from.
+enum class SourceType : uint8_t {
+  Kafka,
+  Pulsar,
+};
+
+/// @brief Wrapper class for @ref mgp_message, a message consumed by a stream. The payload, the topic name and the key
+/// are views of the consumed message, so they aren't copied and are valid only during the transformation.
+class Message {
+ public:
+  explicit Message(mgp_message *message);
+
+  /// @brief Returns the type of the stream source the message was consumed from.
+  SourceType Source() const;
+
+  /// @brief Returns the payload of the message. It's a byte array, not a null-terminated string.
+  std::string_view Payload() const;
+
+  /// @brief Returns the name of the topic the message was consumed from.
+  std::string_view TopicName() const;
+
+  /// @brief Returns the key of the message. Only available for Kafka messages.
+  std::string_view Key() const;
+
+  /// @brief Returns the timestamp of the message. Only available for Kafka messages.
+  int64_t Timestamp() const;
+
+  /// @brief Returns the offset of the message in its partition. Only available for Kafka messages.
+  int64_t Offset() const;
+
+ private:
+  mgp_message *ptr_;
+};
+
+/// @brief Wrapper class for @ref mgp_messages, the batch of messages a transformation receives.
+class Messages {
+ public:
+  explicit Messages(mgp_messages *messages);
+
+  size_t Size() const;
+
+  Message operator[](size_t index) const;
+
+  class Iterator {
+   private:
+    friend class Messages;
+
+   public:
+    using value_type = Message;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Message *;
+    using reference = const Message &;
+    using iterator_category = std::forward_iterator_tag;
+
+    bool operator==(const Iterator &other) const;
+
+    bool operator!=(const Iterator &other) const;
+
+    Iterator &operator++();
+
+    Message operator*() const;
+
+   private:
+    Iterator(const Messages *iterable, size_t index);
+
+    const Messages *iterable_;
+    size_t index_;
+  };
+
+  Iterator begin() const;
+  Iterator end() const;
+
+  Iterator cbegin() const;
+  Iterator cend() const;
+
+ private:
+  mgp_messages *ptr_;
+};
+
+/* #endregion */
+
 /* #region Module */
 
 /// @brief Represents a procedure’s parameter. Parameters are defined by their name, type, and (if optional) default
@@ -1668,6 +1762,13 @@ inline void AddBatchProcedure(mgp_proc_cb callback, mgp_proc_initializer initial
 inline void AddFunction(mgp_func_cb callback, std::string_view name, std::vector<Parameter> parameters,
                         mgp_module *module, mgp_memory *memory);
 
+/// @brief Adds a transformation to the query module. The transformation receives the batches of messages consumed by
+/// the streams which use it as @ref Messages, and runs natively, without the Python interpreter.
+/// @param callback - transformation callback
+/// @param name - transformation name
+/// @param module - the query module that the transformation is added to
+inline void AddTransformation(mgp_trans_cb callback, std::string_view name, mgp_module *module);
+
 /* #endregion */
 
 namespace util {
@@ -4307,6 +4408,63 @@ inline void Result::SetErrorMessage(const char *error_msg) const {
 
 /* #endregion */
 
+/* #region Stream messages */
+
+inline Message::Message(mgp_message *message) : ptr_(message) {}
+
+inline SourceType Message::Source() const {
+  switch (mgp::message_source_type(ptr_)) {
+    case mgp_source_type::KAFKA:
+      return SourceType::Kafka;
+    case mgp_source_type::PULSAR:
+      return SourceType::Pulsar;
+  }
+  throw ValueException("Unknown stream source type");
+}
+
+inline std::string_view Message::Payload() const {
+  return {mgp::message_payload(ptr_), mgp::message_payload_size(ptr_)};
+}
+
+inline std::string_view Message::TopicName() const { return mgp::message_topic_name(ptr_); }
+
+inline std::string_view Message::Key() const { return {mgp::message_key(ptr_), mgp::message_key_size(ptr_)}; }
+
+inline int64_t Message::Timestamp() const { return mgp::message_timestamp(ptr_); }
+
+inline int64_t Message::Offset() const { return mgp::message_offset(ptr_); }
+
+inline Messages::Messages(mgp_messages *messages) : ptr_(messages) {}
+
+inline size_t Messages::Size() const { return mgp::messages_size(ptr_); }
+
+inline Message Messages::operator[](size_t index) const { return Message(mgp::messages_at(ptr_, index)); }
+
+inline bool Messages::Iterator::operator==(const Iterator &other) const {
+  return iterable_ == other.iterable_ && index_ == other.index_;
+}
+
+inline bool Messages::Iterator::operator!=(const Iterator &other) const { return !(*this == other); }
+
+inline Messages::Iterator &Messages::Iterator::operator++() {
+  index_++;
+  return *this;
+}
+
+inline Message Messages::Iterator::operator*() const { return (*iterable_)[index_]; }
+
+inline Messages::Iterator::Iterator(const Messages *iterable, size_t index) : iterable_(iterable), index_(index) {}
+
+inline Messages::Iterator Messages::begin() const { return Iterator(this, 0); }
+
+inline Messages::Iterator Messages::end() const { return Iterator(this, Size()); }
+
+inline Messages::Iterator Messages::cbegin() const { return Iterator(this, 0); }
+
+inline Messages::Iterator Messages::cend() const { return Iterator(this, Size()); }
+
+/* #endregion */
+
 /* #region Module */
 
 // Parameter:
@@ -4500,6 +4658,11 @@ constexpr std::string_view kSearchResultsKey = "search_results";
 constexpr std::string_view kAggregationResultsKey = "aggregation_results";
 }  // namespace
 
+/// Lets the following searches of the text index see all committed transactions.
+inline void RefreshTextIndex(mgp_graph *memgraph_graph, std::string_view index_name) {
+  graph_refresh_text_index(memgraph_graph, index_name.data());
+}
+
 inline List SearchTextIndex(mgp_graph *memgraph_graph, std::string_view index_name, std::string_view search_query,
                             text_search_mode search_mode) {
   auto results_or_error = Map(mgp::MemHandlerCallback(graph_search_text_index, memgraph_graph, index_name.data(),
@@ -4522,6 +4685,30 @@ inline List SearchTextIndex(mgp_graph *memgraph_graph, std::string_view index_na
   return results_or_error.At(kSearchResultsKey).ValueList();
 }
 
+/// Returns the `k` vertices with the vectors most similar to `query` from the vector index on `label` and `property`,
+/// as a list of maps with the "node" and "similarity" keys.
+inline List SearchVectorIndex(mgp_graph *memgraph_graph, std::string_view label, std::string_view property,
+                              const List &query, size_t k) {
+  auto results_or_error = Map(mgp::MemHandlerCallback(graph_search_vector_index, memgraph_graph, label.data(),
+                                                      property.data(), query.ptr_, k));
+  if (results_or_error.KeyExists(kErrorMsgKey)) {
+    if (!results_or_error.At(kErrorMsgKey).IsString()) {
+      throw VectorSearchException{"The error message is not a string!"};
+    }
+    throw VectorSearchException(results_or_error.At(kErrorMsgKey).ValueString().data());
+  }
+
+  if (!results_or_error.KeyExists(kSearchResultsKey)) {
+    throw VectorSearchException{"Incomplete vector index search results!"};
+  }
+
+  if (!results_or_error.At(kSearchResultsKey).IsList()) {
+    throw VectorSearchException{"Vector index search results have wrong type!"};
+  }
+
+  return results_or_error.At(kSearchResultsKey).ValueList();
+}
+
 inline std::string_view AggregateOverTextIndex(mgp_graph *memgraph_graph, std::string_view index_name,
                                                std::string_view search_query, std::string_view aggregation_query) {
   auto results_or_error =
@@ -4612,6 +4799,10 @@ void AddFunction(mgp_func_cb callback, std::string_view name, std::vector<Parame
   }
 }
 
+void AddTransformation(mgp_trans_cb callback, std::string_view name, mgp_module *module) {
+  mgp::module_add_transformation(module, name.data(), callback);
+}
+
 /* #endregion */
 
 }  // namespace mgp
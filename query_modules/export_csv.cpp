@@ -0,0 +1,439 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+/// @file
+/// Exports the graph into CSV files which `mg_import_csv` (and LOAD CSV) can
+/// read back. Vertices are written per combination of labels and edges per
+/// edge type, each group with its own typed header. The export runs in the
+/// transaction of the calling query, so all files show the same snapshot, and
+/// the vertices are split into partitions which are written concurrently,
+/// each into its own files.
+///
+/// The files are re-imported with:
+///   mg_import_csv --id-type=INTEGER --ignore-empty-strings \
+///     --nodes <directory>/nodes_*.csv --relationships <directory>/relationships_*.csv
+///
+/// Properties of the types which mg_import_csv doesn't parse (maps, temporal
+/// values, ...) are exported as strings.
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <mgp.hpp>
+
+namespace ExportCsv {
+constexpr std::string_view kProcedureGraph = "graph";
+constexpr std::string_view kParameterDirectory = "directory";
+constexpr std::string_view kParameterThreads = "threads";
+constexpr std::string_view kReturnFile = "file";
+constexpr std::string_view kReturnKind = "kind";
+constexpr std::string_view kReturnName = "name";
+constexpr std::string_view kReturnRows = "rows";
+constexpr std::string_view kKindNodes = "nodes";
+constexpr std::string_view kKindRelationships = "relationships";
+// Same as the default array delimiter of mg_import_csv.
+constexpr char kArrayDelimiter = ';';
+
+void Graph(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result, mgp_memory *memory);
+}  // namespace ExportCsv
+
+namespace {
+
+// Column types as mg_import_csv names them, an empty type isn't known yet.
+std::string ColumnType(const mgp::Value &value) {
+  switch (value.Type()) {
+    case mgp::Type::Bool:
+      return "boolean";
+    case mgp::Type::Int:
+      return "int";
+    case mgp::Type::Double:
+      return "float";
+    case mgp::Type::List: {
+      // Only lists of numbers and booleans can be split back into elements
+      const auto list = value.ValueList();
+      std::string element_type;
+      for (size_t i = 0; i < list.Size(); ++i) {
+        const auto type = list[i].Type();
+        if (type != mgp::Type::Bool && type != mgp::Type::Int && type != mgp::Type::Double) return "string";
+        auto current = ColumnType(list[i]);
+        if (!element_type.empty() && element_type != current) return "string";
+        element_type = std::move(current);
+      }
+      return element_type.empty() ? "" : element_type + "[]";
+    }
+    default:
+      return "string";
+  }
+}
+
+void MergeColumnType(std::string &type, const std::string &other) {
+  if (other.empty() || type == other) return;
+  type = type.empty() ? other : "string";
+}
+
+// Property name -> column type of a group of vertices or edges.
+using Columns = std::map<std::string, std::string>;
+
+struct Schema {
+  // Groups of vertices are keyed by their sorted labels, joined with the array delimiter.
+  std::map<std::string, Columns> nodes;
+  std::map<std::string, Columns> relationships;
+
+  void Merge(const Schema &other) {
+    auto merge_groups = [](auto &into, const auto &from) {
+      for (const auto &[group, columns] : from) {
+        auto &into_columns = into[group];
+        for (const auto &[name, type] : columns) {
+          MergeColumnType(into_columns[name], type);
+        }
+      }
+    };
+    merge_groups(nodes, other.nodes);
+    merge_groups(relationships, other.relationships);
+  }
+};
+
+std::string LabelsKey(const mgp::Node &node) {
+  std::vector<std::string_view> labels;
+  for (const auto label : node.Labels()) labels.push_back(label);
+  std::ranges::sort(labels);
+  std::string key;
+  for (const auto label : labels) {
+    if (!key.empty()) key.push_back(ExportCsv::kArrayDelimiter);
+    key.append(label);
+  }
+  return key;
+}
+
+void AddColumns(Columns &columns, const std::unordered_map<std::string, mgp::Value> &properties) {
+  for (const auto &[name, value] : properties) {
+    MergeColumnType(columns[name], ColumnType(value));
+  }
+}
+
+void WriteQuoted(std::string &out, std::string_view value) {
+  out.push_back('"');
+  for (const auto c : value) {
+    if (c == '"') out.push_back('"');
+    out.push_back(c);
+  }
+  out.push_back('"');
+}
+
+void AppendScalar(std::string &out, const mgp::Value &value) {
+  switch (value.Type()) {
+    case mgp::Type::Bool:
+      out.append(value.ValueBool() ? "true" : "false");
+      return;
+    case mgp::Type::Int:
+      out.append(std::to_string(value.ValueInt()));
+      return;
+    case mgp::Type::Double: {
+      // The shortest representation which parses back into the same value
+      char buffer[32];
+      const auto [end, ec] = std::to_chars(std::begin(buffer), std::end(buffer), value.ValueDouble());
+      out.append(buffer, end);
+      return;
+    }
+    case mgp::Type::String:
+      out.append(value.ValueString());
+      return;
+    default:
+      out.append(value.ToString());
+      return;
+  }
+}
+
+void AppendValue(std::string &out, const mgp::Value &value, const std::string &type) {
+  std::string text;
+  if (type.empty()) {
+    // Only empty lists were seen
+  } else if (type.ends_with("[]")) {
+    const auto list = value.ValueList();
+    for (size_t i = 0; i < list.Size(); ++i) {
+      if (i > 0) text.push_back(ExportCsv::kArrayDelimiter);
+      AppendScalar(text, list[i]);
+    }
+  } else {
+    AppendScalar(text, value);
+  }
+  WriteQuoted(out, text);
+}
+
+void AppendProperties(std::string &out, const Columns &columns,
+                      const std::unordered_map<std::string, mgp::Value> &properties) {
+  for (const auto &[name, type] : columns) {
+    out.push_back(',');
+    // Missing properties are empty fields, which --ignore-empty-strings imports as null
+    if (auto it = properties.find(name); it != properties.end()) AppendValue(out, it->second, type);
+  }
+}
+
+std::string Header(std::initializer_list<std::string_view> fixed, const Columns &columns) {
+  std::string header;
+  for (const auto field : fixed) {
+    if (!header.empty()) header.push_back(',');
+    WriteQuoted(header, field);
+  }
+  for (const auto &[name, type] : columns) {
+    header.push_back(',');
+    // An undetermined type means only empty lists were seen, which are empty fields either way
+    WriteQuoted(header, name + ":" + (type.empty() ? "string" : type));
+  }
+  header.push_back('\n');
+  return header;
+}
+
+// File names only keep the characters which are safe in any file system, the
+// group index keeps them unique.
+std::string FileName(std::string_view kind, size_t group_index, std::string_view group, size_t partition) {
+  std::string name{kind};
+  name.append("_").append(std::to_string(group_index)).append("_");
+  for (const auto c : group.substr(0, 64)) {
+    name.push_back(std::isalnum(static_cast<unsigned char>(c)) ? c : '_');
+  }
+  name.append("_").append(std::to_string(partition)).append(".csv");
+  return name;
+}
+
+struct ExportedFile {
+  std::string path;
+  std::string_view kind;
+  std::string name;
+  int64_t rows{0};
+};
+
+struct ExportState {
+  std::filesystem::path directory;
+  Schema schema;
+  // Index of each group, used in the file names.
+  std::map<std::string, size_t> node_group_indices;
+  std::map<std::string, size_t> relationship_group_indices;
+
+  std::mutex lock;
+  std::vector<ExportedFile> files;
+  std::string error;
+
+  void SetError(std::string message) {
+    auto guard = std::lock_guard{lock};
+    if (error.empty()) error = std::move(message);
+  }
+};
+
+template <typename TFunc>
+mgp_error RunWorker(mgp_memory *memory, void *payload, const TFunc &func) {
+  auto &state = *static_cast<ExportState *>(payload);
+  try {
+    mgp::MemoryDispatcherGuard guard{memory};
+    func(state);
+    return mgp_error::MGP_ERROR_NO_ERROR;
+  } catch (const std::exception &e) {
+    state.SetError(e.what());
+    return mgp_error::MGP_ERROR_UNKNOWN_ERROR;
+  }
+}
+
+mgp_error CollectSchema(size_t /*partition*/, mgp_vertices_iterator *vertices, mgp_memory *memory, void *payload) {
+  return RunWorker(memory, payload, [vertices](ExportState &state) {
+    Schema local;
+    for (auto *vertex = mgp::vertices_iterator_get(vertices); vertex != nullptr;
+         vertex = mgp::vertices_iterator_next(vertices)) {
+      const auto node = mgp::Node(vertex);
+      AddColumns(local.nodes[LabelsKey(node)], node.Properties());
+      for (const auto relationship : node.OutRelationships()) {
+        AddColumns(local.relationships[std::string{relationship.Type()}], relationship.Properties());
+      }
+    }
+    auto guard = std::lock_guard{state.lock};
+    state.schema.Merge(local);
+  });
+}
+
+// The file of one group written by one partition, created with the first row.
+struct GroupFile {
+  ExportedFile file;
+  std::ofstream stream;
+  std::string buffer;
+
+  void Flush(bool force) {
+    // Rows are written in larger chunks
+    static constexpr size_t kFlushSize = 1U << 20U;
+    if (buffer.empty() || (!force && buffer.size() < kFlushSize)) return;
+    stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    if (!stream) throw std::runtime_error("Unable to write the export file " + file.path);
+    buffer.clear();
+  }
+};
+
+GroupFile OpenGroupFile(const ExportState &state, std::string_view kind, size_t group_index, const std::string &group,
+                        size_t partition, std::string header) {
+  GroupFile group_file;
+  group_file.file = ExportedFile{
+      .path = (state.directory / FileName(kind, group_index, group, partition)).string(), .kind = kind, .name = group};
+  group_file.stream.open(group_file.file.path, std::ios::out | std::ios::trunc | std::ios::binary);
+  if (!group_file.stream) throw std::runtime_error("Unable to open the export file " + group_file.file.path);
+  group_file.buffer = std::move(header);
+  return group_file;
+}
+
+mgp_error WriteGroups(size_t partition, mgp_vertices_iterator *vertices, mgp_memory *memory, void *payload) {
+  return RunWorker(memory, payload, [partition, vertices](ExportState &state) {
+    std::map<std::string, GroupFile> node_files;
+    std::map<std::string, GroupFile> relationship_files;
+
+    for (auto *vertex = mgp::vertices_iterator_get(vertices); vertex != nullptr;
+         vertex = mgp::vertices_iterator_next(vertices)) {
+      const auto node = mgp::Node(vertex);
+      auto labels = LabelsKey(node);
+      const auto &columns = state.schema.nodes.at(labels);
+      auto it = node_files.find(labels);
+      if (it == node_files.end()) {
+        auto header = Header({":ID", ":LABEL"}, columns);
+        auto group_file = OpenGroupFile(state, ExportCsv::kKindNodes, state.node_group_indices.at(labels), labels,
+                                        partition, std::move(header));
+        it = node_files.emplace(labels, std::move(group_file)).first;
+      }
+      auto &group_file = it->second;
+      auto &out = group_file.buffer;
+      WriteQuoted(out, std::to_string(node.Id().AsInt()));
+      out.push_back(',');
+      WriteQuoted(out, labels);
+      AppendProperties(out, columns, node.Properties());
+      out.push_back('\n');
+      ++group_file.file.rows;
+      group_file.Flush(false);
+
+      for (const auto relationship : node.OutRelationships()) {
+        auto type = std::string{relationship.Type()};
+        const auto &relationship_columns = state.schema.relationships.at(type);
+        auto rel_it = relationship_files.find(type);
+        if (rel_it == relationship_files.end()) {
+          auto header = Header({":START_ID", ":END_ID", ":TYPE"}, relationship_columns);
+          auto rel_file = OpenGroupFile(state, ExportCsv::kKindRelationships, state.relationship_group_indices.at(type),
+                                        type, partition, std::move(header));
+          rel_it = relationship_files.emplace(type, std::move(rel_file)).first;
+        }
+        auto &rel_file = rel_it->second;
+        auto &rel_out = rel_file.buffer;
+        WriteQuoted(rel_out, std::to_string(relationship.From().Id().AsInt()));
+        rel_out.push_back(',');
+        WriteQuoted(rel_out, std::to_string(relationship.To().Id().AsInt()));
+        rel_out.push_back(',');
+        WriteQuoted(rel_out, type);
+        AppendProperties(rel_out, relationship_columns, relationship.Properties());
+        rel_out.push_back('\n');
+        ++rel_file.file.rows;
+        rel_file.Flush(false);
+      }
+    }
+
+    std::vector<ExportedFile> written;
+    for (auto *files : {&node_files, &relationship_files}) {
+      for (auto &[_, group_file] : *files) {
+        group_file.Flush(true);
+        group_file.stream.close();
+        if (!group_file.stream) throw std::runtime_error("Unable to write the export file " + group_file.file.path);
+        written.push_back(std::move(group_file.file));
+      }
+    }
+    auto guard = std::lock_guard{state.lock};
+    std::ranges::move(written, std::back_inserter(state.files));
+  });
+}
+
+// Partitions can only be run once, so each pass makes its own.
+void RunPartitions(mgp_graph *graph, size_t threads, mgp_memory *memory, mgp_vertices_partition_cb callback,
+                   ExportState &state) {
+  auto *partitions = mgp::graph_partition_vertices(graph, threads, memory);
+  const auto destroy = std::unique_ptr<mgp_vertices_partitions, void (*)(mgp_vertices_partitions *)>(
+      partitions, mgp::vertices_partitions_destroy);
+  try {
+    mgp::vertices_partitions_run(partitions, threads, callback, &state);
+  } catch (const std::exception &e) {
+    if (!state.error.empty()) throw std::runtime_error(state.error);
+    throw;
+  }
+}
+
+}  // namespace
+
+void ExportCsv::Graph(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result, mgp_memory *memory) {
+  mgp::MemoryDispatcherGuard guard{memory};
+  const auto record_factory = mgp::RecordFactory(result);
+  auto arguments = mgp::List(args);
+
+  try {
+    ExportState state;
+    state.directory = std::filesystem::path{arguments[0].ValueString()};
+    const auto requested_threads = arguments[1].ValueInt();
+    if (requested_threads < 0) {
+      throw mgp::ValueException("The number of export threads can't be negative.");
+    }
+    const auto threads =
+        requested_threads == 0 ? mgp::parallel_default_threads() : static_cast<size_t>(requested_threads);
+    std::filesystem::create_directories(state.directory);
+
+    RunPartitions(memgraph_graph, threads, memory, CollectSchema, state);
+    for (const auto &[group, _] : state.schema.nodes) {
+      state.node_group_indices.emplace(group, state.node_group_indices.size());
+    }
+    for (const auto &[group, _] : state.schema.relationships) {
+      state.relationship_group_indices.emplace(group, state.relationship_group_indices.size());
+    }
+    RunPartitions(memgraph_graph, threads, memory, WriteGroups, state);
+
+    std::ranges::sort(state.files, {}, &ExportedFile::path);
+    for (const auto &file : state.files) {
+      auto record = record_factory.NewRecord();
+      record.Insert(kReturnFile.data(), file.path);
+      record.Insert(kReturnKind.data(), file.kind);
+      record.Insert(kReturnName.data(), file.name);
+      record.Insert(kReturnRows.data(), file.rows);
+    }
+  } catch (const std::exception &e) {
+    record_factory.SetErrorMessage(e.what());
+  }
+}
+
+extern "C" int mgp_init_module(struct mgp_module *query_module, struct mgp_memory *memory) {
+  try {
+    mgp::MemoryDispatcherGuard guard{memory};
+
+    AddProcedure(ExportCsv::Graph, ExportCsv::kProcedureGraph, mgp::ProcedureType::Read,
+                 {
+                     mgp::Parameter(ExportCsv::kParameterDirectory, mgp::Type::String),
+                     mgp::Parameter(ExportCsv::kParameterThreads, mgp::Type::Int, static_cast<int64_t>(0)),
+                 },
+                 {mgp::Return(ExportCsv::kReturnFile, mgp::Type::String),
+                  mgp::Return(ExportCsv::kReturnKind, mgp::Type::String),
+                  mgp::Return(ExportCsv::kReturnName, mgp::Type::String),
+                  mgp::Return(ExportCsv::kReturnRows, mgp::Type::Int)},
+                 query_module, memory);
+  } catch (const std::exception &e) {
+    std::cerr << "Error while initializing query module: " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
+
+extern "C" int mgp_shutdown_module() { return 0; }
@@ -25,6 +25,7 @@ constexpr std::string_view kProcedureAggregate = "aggregate";
 constexpr std::string_view kParameterIndexName = "index_name";
 constexpr std::string_view kParameterSearchQuery = "search_query";
 constexpr std::string_view kParameterAggregationQuery = "aggregation_query";
+constexpr std::string_view kParameterReadYourWrites = "read_your_writes";
 constexpr std::string_view kReturnNode = "node";
 constexpr std::string_view kReturnAggregation = "aggregation";
 const std::string kSearchAllPrefix = "all";
@@ -43,6 +44,7 @@ void TextSearch::Search(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *r
   try {
     const auto *index_name = arguments[0].ValueString().data();
     const auto *search_query = arguments[1].ValueString().data();
+    if (arguments[2].ValueBool()) mgp::RefreshTextIndex(memgraph_graph, index_name);
     for (const auto &node :
          mgp::SearchTextIndex(memgraph_graph, index_name, search_query, text_search_mode::SPECIFIED_PROPERTIES)) {
       auto record = record_factory.NewRecord();
@@ -61,6 +63,7 @@ void TextSearch::RegexSearch(mgp_list *args, mgp_graph *memgraph_graph, mgp_resu
   try {
     const auto *index_name = arguments[0].ValueString().data();
     const auto *search_query = arguments[1].ValueString().data();
+    if (arguments[2].ValueBool()) mgp::RefreshTextIndex(memgraph_graph, index_name);
     for (const auto &node : mgp::SearchTextIndex(memgraph_graph, index_name, search_query, text_search_mode::REGEX)) {
       auto record = record_factory.NewRecord();
       record.Insert(TextSearch::kReturnNode.data(), node.ValueNode());
@@ -79,6 +82,7 @@ void TextSearch::SearchAllProperties(mgp_list *args, mgp_graph *memgraph_graph,
   try {
     const auto *index_name = arguments[0].ValueString().data();
     std::string search_query = fmt::format("{}:{}", kSearchAllPrefix, arguments[1].ValueString());
+    if (arguments[2].ValueBool()) mgp::RefreshTextIndex(memgraph_graph, index_name);
     for (const auto &node :
          mgp::SearchTextIndex(memgraph_graph, index_name, search_query, text_search_mode::ALL_PROPERTIES)) {
       auto record = record_factory.NewRecord();
@@ -98,6 +102,7 @@ void TextSearch::Aggregate(mgp_list *args, mgp_graph *memgraph_graph, mgp_result
     const auto *index_name = arguments[0].ValueString().data();
     const auto *search_query = arguments[1].ValueString().data();
     const auto *aggregation_query = arguments[2].ValueString().data();
+    if (arguments[3].ValueBool()) mgp::RefreshTextIndex(memgraph_graph, index_name);
     const auto aggregation_result =
         mgp::AggregateOverTextIndex(memgraph_graph, index_name, search_query, aggregation_query);
     auto record = record_factory.NewRecord();
@@ -115,6 +120,7 @@ extern "C" int mgp_init_module(struct mgp_module *query_module, struct mgp_memor
                  {
                      mgp::Parameter(TextSearch::kParameterIndexName, mgp::Type::String),
                      mgp::Parameter(TextSearch::kParameterSearchQuery, mgp::Type::String),
+                     mgp::Parameter(TextSearch::kParameterReadYourWrites, mgp::Type::Bool, true),
                  },
                  {mgp::Return(TextSearch::kReturnNode, mgp::Type::Node)}, query_module, memory);
 
@@ -122,6 +128,7 @@ extern "C" int mgp_init_module(struct mgp_module *query_module, struct mgp_memor
                  {
                      mgp::Parameter(TextSearch::kParameterIndexName, mgp::Type::String),
                      mgp::Parameter(TextSearch::kParameterSearchQuery, mgp::Type::String),
+                     mgp::Parameter(TextSearch::kParameterReadYourWrites, mgp::Type::Bool, true),
                  },
                  {mgp::Return(TextSearch::kReturnNode, mgp::Type::Node)}, query_module, memory);
 
@@ -129,6 +136,7 @@ extern "C" int mgp_init_module(struct mgp_module *query_module, struct mgp_memor
                  {
                      mgp::Parameter(TextSearch::kParameterIndexName, mgp::Type::String),
                      mgp::Parameter(TextSearch::kParameterSearchQuery, mgp::Type::String),
+                     mgp::Parameter(TextSearch::kParameterReadYourWrites, mgp::Type::Bool, true),
                  },
                  {mgp::Return(TextSearch::kReturnNode, mgp::Type::Node)}, query_module, memory);
 
@@ -137,6 +145,7 @@ extern "C" int mgp_init_module(struct mgp_module *query_module, struct mgp_memor
                      mgp::Parameter(TextSearch::kParameterIndexName, mgp::Type::String),
                      mgp::Parameter(TextSearch::kParameterSearchQuery, mgp::Type::String),
                      mgp::Parameter(TextSearch::kParameterAggregationQuery, mgp::Type::String),
+                     mgp::Parameter(TextSearch::kParameterReadYourWrites, mgp::Type::Bool, true),
                  },
                  {mgp::Return(TextSearch::kReturnAggregation, mgp::Type::String)}, query_module, memory);
   } catch (const std::exception &e) {
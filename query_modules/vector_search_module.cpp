@@ -0,0 +1,75 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <string_view>
+
+#include <iostream>
+#include <mgp.hpp>
+
+namespace VectorSearch {
+constexpr std::string_view kProcedureSearch = "search";
+constexpr std::string_view kParameterLabel = "label";
+constexpr std::string_view kParameterProperty = "property";
+constexpr std::string_view kParameterQueryVector = "query_vector";
+constexpr std::string_view kParameterLimit = "limit";
+constexpr std::string_view kReturnNode = "node";
+constexpr std::string_view kReturnSimilarity = "similarity";
+
+void Search(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result, mgp_memory *memory);
+}  // namespace VectorSearch
+
+void VectorSearch::Search(mgp_list *args, mgp_graph *memgraph_graph, mgp_result *result, mgp_memory *memory) {
+  mgp::MemoryDispatcherGuard guard{memory};
+  const auto record_factory = mgp::RecordFactory(result);
+  auto arguments = mgp::List(args);
+
+  try {
+    const auto label = arguments[0].ValueString();
+    const auto property = arguments[1].ValueString();
+    const auto query_vector = arguments[2].ValueList();
+    const auto limit = arguments[3].ValueInt();
+    if (limit < 0) {
+      throw mgp::ValueException("The limit of the vector search can't be negative.");
+    }
+    for (const auto &found : mgp::SearchVectorIndex(memgraph_graph, label, property, query_vector, limit)) {
+      const auto entry = found.ValueMap();
+      auto record = record_factory.NewRecord();
+      record.Insert(VectorSearch::kReturnNode.data(), entry.At(VectorSearch::kReturnNode).ValueNode());
+      record.Insert(VectorSearch::kReturnSimilarity.data(), entry.At(VectorSearch::kReturnSimilarity).ValueDouble());
+    }
+  } catch (const std::exception &e) {
+    record_factory.SetErrorMessage(e.what());
+  }
+}
+
+extern "C" int mgp_init_module(struct mgp_module *query_module, struct mgp_memory *memory) {
+  try {
+    mgp::MemoryDispatcherGuard guard{memory};
+
+    AddProcedure(VectorSearch::Search, VectorSearch::kProcedureSearch, mgp::ProcedureType::Read,
+                 {
+                     mgp::Parameter(VectorSearch::kParameterLabel, mgp::Type::String),
+                     mgp::Parameter(VectorSearch::kParameterProperty, mgp::Type::String),
+                     mgp::Parameter(VectorSearch::kParameterQueryVector, {mgp::Type::List, mgp::Type::Any}),
+                     mgp::Parameter(VectorSearch::kParameterLimit, mgp::Type::Int),
+                 },
+                 {mgp::Return(VectorSearch::kReturnNode, mgp::Type::Node),
+                  mgp::Return(VectorSearch::kReturnSimilarity, mgp::Type::Double)},
+                 query_module, memory);
+  } catch (const std::exception &e) {
+    std::cerr << "Error while initializing query module: " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
+
+extern "C" int mgp_shutdown_module() { return 0; }
@@ -100,6 +100,7 @@ print_help () {
   echo -e "  --asan                        Build with ASAN"
   echo -e "  --cmake-only                  Only run cmake configure command"
   echo -e "  --community                   Build community version"
+  echo -e "  --compact-edges               Build with MG_COMPACT_EDGES (edges guarded by striped locks)"
   echo -e "  --coverage                    Build with code coverage"
   echo -e "  --for-docker                  Add flag -DMG_TELEMETRY_ID_OVERRIDE=DOCKER to cmake"
   echo -e "  --for-platform                Add flag -DMG_TELEMETRY_ID_OVERRIDE=DOCKER-PLATFORM to cmake"
@@ -249,6 +250,7 @@ build_memgraph () {
   local build_type_flag="-DCMAKE_BUILD_TYPE=$build_type"
   local telemetry_id_override_flag=""
   local community_flag=""
+  local compact_edges_flag=""
   local coverage_flag=""
   local asan_flag=""
   local ubsan_flag=""
@@ -263,6 +265,10 @@ build_memgraph () {
         community_flag="-DMG_ENTERPRISE=OFF"
         shift 1
       ;;
+      --compact-edges)
+        compact_edges_flag="-DMG_COMPACT_EDGES=ON"
+        shift 1
+      ;;
       --init-only)
         init_only=true
         shift 1
@@ -358,7 +364,7 @@ build_memgraph () {
   docker exec -u mg "$build_container" bash -c "cd $MGBUILD_ROOT_DIR && git remote set-url origin https://github.com/memgraph/memgraph.git"
 
   # Define cmake command
-  local cmake_cmd="cmake $build_type_flag $arm_flag $community_flag $telemetry_id_override_flag $coverage_flag $asan_flag $ubsan_flag .."
+  local cmake_cmd="cmake $build_type_flag $arm_flag $community_flag $compact_edges_flag $telemetry_id_override_flag $coverage_flag $asan_flag $ubsan_flag .."
   docker exec -u mg "$build_container" bash -c "cd $container_build_dir && $ACTIVATE_TOOLCHAIN && $ACTIVATE_CARGO && $cmake_cmd"
   if [[ "$cmake_only" == "true" ]]; then
     build_target(){
@@ -12,6 +12,10 @@
 
 #include <fmt/format.h>
 #include <json/json.hpp>
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <thread>
 #include <utility>
 
 #include "communication/bolt/v1/mg_types.hpp"
@@ -24,11 +28,22 @@
 
 namespace memgraph::audit {
 
-// Helper function that converts a `communication::bolt::Value` to `nlohmann::json`.
-inline nlohmann::json BoltValueToJson(const communication::bolt::Value &value) {
+namespace {
+// Spreads the recording threads evenly over the buffers.
+size_t BufferIndex(size_t buffer_count) {
+  static std::atomic<size_t> next_index{0};
+  thread_local const size_t index = next_index.fetch_add(1, std::memory_order_relaxed);
+  return index % buffer_count;
+}
+
+constexpr unsigned kMaxBufferShards = 16;
+}  // namespace
+
+// Helper function that converts a `storage::PropertyValue` to `nlohmann::json`.
+inline nlohmann::json PropertyValueToJson(const storage::PropertyValue &value) {
   nlohmann::json ret;
   switch (value.type()) {
-    using enum memgraph::communication::bolt::Value::Type;
+    using enum storage::PropertyValueType;
     case Null:
       break;
     case Bool:
@@ -46,13 +61,13 @@ inline nlohmann::json BoltValueToJson(const communication::bolt::Value &value) {
     case List: {
       ret = nlohmann::json::array();
       for (const auto &item : value.ValueList()) {
-        ret.push_back(BoltValueToJson(item));
+        ret.push_back(PropertyValueToJson(item));
       }
       break;
     }
     case Map: {
-      auto const &bolt_value_map = value.ValueMap();
-      auto const info = memgraph::communication::bolt::BoltMapToMgTypeInfo(bolt_value_map);
+      auto const &value_map = value.ValueMap();
+      auto const info = memgraph::communication::bolt::PropertyMapToMgTypeInfo(value_map);
       if (info) {
         switch (info->type) {
           case communication::bolt::MgType::Enum: {
@@ -62,40 +77,36 @@ inline nlohmann::json BoltValueToJson(const communication::bolt::Value &value) {
         }
       } else {
         ret = nlohmann::json::object();
-        for (const auto &[map_k, map_v] : bolt_value_map) {
-          ret.push_back(nlohmann::json::object_t::value_type(map_k, BoltValueToJson(map_v)));
+        for (const auto &[map_k, map_v] : value_map) {
+          ret.push_back(nlohmann::json::object_t::value_type(map_k, PropertyValueToJson(map_v)));
         }
       }
       break;
     }
-    case Date: {
-      std::stringstream ss;
-      ss << utils::Date(value.ValueDate().MicrosecondsSinceEpoch());
-      ret = ss.str();
-      break;
-    }
-    case Duration: {
-      std::stringstream ss;
-      ss << utils::Duration(value.ValueDuration().microseconds);
-      ret = ss.str();
-      break;
-    }
-    case LocalTime: {
+    case TemporalData: {
+      const auto temporal = value.ValueTemporalData();
       std::stringstream ss;
-      ss << utils::LocalTime(value.ValueLocalTime().MicrosecondsSinceEpoch());
-      ret = ss.str();
-      break;
-    }
-    case LocalDateTime: {
-      std::stringstream ss;
-      ss << value.ValueLocalDateTime();
+      switch (temporal.type) {
+        case storage::TemporalType::Date:
+          ss << utils::Date(temporal.microseconds);
+          break;
+        case storage::TemporalType::LocalTime:
+          ss << utils::LocalTime(temporal.microseconds);
+          break;
+        case storage::TemporalType::LocalDateTime:
+          ss << utils::LocalDateTime(temporal.microseconds);
+          break;
+        case storage::TemporalType::Duration:
+          ss << utils::Duration(temporal.microseconds);
+          break;
+      }
       ret = ss.str();
       break;
     }
-    case ZonedDateTime: {
-      const auto &temp_value = value.ValueZonedDateTime();
+    case ZonedTemporalData: {
+      const auto zoned_temporal = value.ValueZonedTemporalData();
       std::stringstream ss;
-      ss << utils::ZonedDateTime(temp_value.SysTimeSinceEpoch(), temp_value.GetTimezone());
+      ss << utils::ZonedDateTime(zoned_temporal.microseconds, zoned_temporal.timezone);
       ret = ss.str();
       break;
     }
@@ -111,11 +122,8 @@ inline nlohmann::json BoltValueToJson(const communication::bolt::Value &value) {
       ret = ss.str();
       break;
     }
-    case Vertex:
-    case Edge:
-    case UnboundedEdge:
-    case Path: {
-      // Should not be sent for audit
+    case Enum: {
+      // The parameters are recorded before their enums are resolved
       break;
     }
   }
@@ -133,7 +141,14 @@ void Log::Start() {
 
   utils::EnsureDirOrDie(storage_directory_);
 
-  buffer_.emplace(buffer_size_);
+  const auto threads = std::max(std::thread::hardware_concurrency(), 1U);
+  const auto shards =
+      static_cast<int32_t>(std::min({threads, kMaxBufferShards, static_cast<unsigned>(buffer_size_)}));
+  buffer_shard_size_ = buffer_size_ / shards;
+  buffers_.clear();
+  for (int32_t i = 0; i < shards; ++i) {
+    buffers_.emplace_back(std::make_unique<RingBuffer<Item>>(buffer_shard_size_));
+  }
   started_ = true;
 
   ReopenLog();
@@ -151,12 +166,12 @@ Log::~Log() {
 }
 
 void Log::Record(const std::string &address, const std::string &username, const std::string &query,
-                 const memgraph::communication::bolt::map_t &params, const std::string &db) {
+                 const storage::PropertyValue::map_t &params, const std::string &db) {
   if (!started_.load(std::memory_order_relaxed)) return;
   auto timestamp =
       std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch())
           .count();
-  buffer_->emplace(Item{timestamp, address, username, query, params, db});
+  buffers_[BufferIndex(buffers_.size())]->emplace(Item{timestamp, address, username, query, params, db});
 }
 
 void Log::ReopenLog() {
@@ -168,19 +183,27 @@ void Log::ReopenLog() {
 
 void Log::Flush() {
   auto guard = std::lock_guard{lock_};
-  for (uint64_t i = 0; i < buffer_size_; ++i) {
-    auto item = buffer_->pop();
-    if (!item) break;
+  pending_.clear();
+  for (auto &buffer : buffers_) {
+    buffer->pop_many(pending_, buffer_shard_size_);
+  }
+  if (pending_.empty()) return;
+  // Each buffer is in the recorded order, the merged entries have to be ordered again.
+  std::ranges::stable_sort(pending_, {}, &Item::timestamp);
 
+  write_buffer_.clear();
+  for (const auto &item : pending_) {
     auto params_json = nlohmann::json::object();
-    for (const auto &[k, v] : item->params) {
-      params_json.push_back(nlohmann::json::object_t::value_type(k, BoltValueToJson(v)));
+    for (const auto &[k, v] : item.params) {
+      params_json.push_back(nlohmann::json::object_t::value_type(k, PropertyValueToJson(v)));
     }
 
-    log_.Write(fmt::format("{}.{:06d},{},{},{},{},{}\n", item->timestamp / 1000000, item->timestamp % 1000000,
-                           item->address, item->username, item->db, utils::Escape(item->query),
-                           utils::Escape(params_json.dump())));
+    fmt::format_to(std::back_inserter(write_buffer_), "{}.{:06d},{},{},{},{},{}\n", item.timestamp / 1000000,
+                   item.timestamp % 1000000, item.address, item.username, item.db, utils::Escape(item.query),
+                   utils::Escape(params_json.dump()));
   }
+  pending_.clear();
+  log_.Write(write_buffer_);
   log_.Sync();
 }
 
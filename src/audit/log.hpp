@@ -10,10 +10,12 @@
 
 #include <atomic>
 #include <filesystem>
-#include <optional>
+#include <memory>
+#include <string>
+#include <vector>
 
-#include "communication/bolt/v1/value.hpp"
 #include "data_structures/ring_buffer.hpp"
+#include "storage/v2/property_value.hpp"
 #include "utils/file.hpp"
 #include "utils/scheduler.hpp"
 
@@ -28,7 +30,7 @@ class Log {
     std::string address;
     std::string username;
     std::string query;
-    memgraph::communication::bolt::map_t params;
+    storage::PropertyValue::map_t params;
     std::string db;
   };
 
@@ -49,7 +51,7 @@ class Log {
 
   /// Adds an entry to the audit log. Thread-safe.
   void Record(const std::string &address, const std::string &username, const std::string &query,
-              const memgraph::communication::bolt::map_t &params, const std::string &db);
+              const storage::PropertyValue::map_t &params, const std::string &db);
 
   /// Reopens the log file. Used for log file rotation. Thread-safe.
   void ReopenLog();
@@ -62,11 +64,17 @@ class Log {
   int32_t buffer_flush_interval_millis_;
   std::atomic<bool> started_;
 
-  std::optional<RingBuffer<Item>> buffer_;
+  // Records are spread over a buffer per group of threads so concurrent
+  // sessions don't contend on a single buffer.
+  std::vector<std::unique_ptr<RingBuffer<Item>>> buffers_;
+  int32_t buffer_shard_size_{0};
   utils::Scheduler scheduler_;
 
   utils::OutputFile log_;
   std::mutex lock_;
+  // Reused by each flush, guarded by `lock_`.
+  std::vector<Item> pending_;
+  std::string write_buffer_;
 };
 
 }  // namespace memgraph::audit
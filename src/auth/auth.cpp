@@ -22,8 +22,15 @@
 #include "utils/flag_validation.hpp"
 #include "utils/message.hpp"
 #include "utils/settings.hpp"
+#include "utils/event_counter.hpp"
 #include "utils/string.hpp"
 
+namespace memgraph::metrics {
+extern const Event AuthenticationAttempts;
+extern const Event AuthenticationCacheHits;
+extern const Event AuthenticationCacheMisses;
+}  // namespace memgraph::metrics
+
 namespace memgraph {
 std::unordered_map<std::string, std::string> ModuleMappingsToMap(std::string_view module_mappings) {
   std::unordered_map<std::string, std::string> module_per_scheme;
@@ -252,7 +259,9 @@ auto ParseJson(std::string_view str) {
 };  // namespace
 
 Auth::Auth(std::string storage_directory, Config config)
-    : storage_(std::move(storage_directory)), config_{std::move(config)} {
+    : storage_(std::move(storage_directory)),
+      config_{std::move(config)},
+      credential_cache_{FLAGS_auth_cache_size, std::chrono::seconds{FLAGS_auth_cache_ttl_sec}} {
   modules_ = PopulateModules(FLAGS_auth_module_mappings);
   MigrateVersions(storage_);
 }
@@ -342,6 +351,7 @@ std::optional<UserOrRole> Auth::CallExternalModule(const std::string &scheme, co
 }
 
 std::optional<UserOrRole> Auth::Authenticate(const std::string &username, const std::string &password) {
+  memgraph::metrics::IncrementCounter(memgraph::metrics::AuthenticationAttempts);
   if (!modules_.contains("basic")) {
     /*
      * LOCAL AUTH STORAGE
@@ -352,6 +362,15 @@ std::optional<UserOrRole> Auth::Authenticate(const std::string &username, const
                                           "https://memgr.ph/auth"));
       return std::nullopt;
     }
+    // The user and its role are always read from the storage, only the password verification is cached. The stored
+    // hash is a part of the cache key, so changing the password invalidates the cached credentials.
+    const auto &password_hash = user->password_hash();
+    const auto use_cache = password_hash && credential_cache_.Enabled();
+    if (use_cache && credential_cache_.Contains(user->username(), password, password_hash->Hash())) {
+      memgraph::metrics::IncrementCounter(memgraph::metrics::AuthenticationCacheHits);
+      return user;
+    }
+    if (use_cache) memgraph::metrics::IncrementCounter(memgraph::metrics::AuthenticationCacheMisses);
     if (!user->CheckPassword(password)) {
       spdlog::warn(utils::MessageWithLink("Couldn't authenticate user '{}' because the password is not correct.",
                                           username, "https://memgr.ph/auth"));
@@ -360,6 +379,7 @@ std::optional<UserOrRole> Auth::Authenticate(const std::string &username, const
     if (user->UpgradeHash(password)) {
       SaveUser(*user);
     }
+    if (use_cache) credential_cache_.Insert(user->username(), password, user->password_hash()->Hash());
 
     return user;
   }
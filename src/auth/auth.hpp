@@ -13,6 +13,7 @@
 #include <regex>
 #include <vector>
 
+#include "auth/credential_cache.hpp"
 #include "auth/exceptions.hpp"
 #include "auth/models.hpp"
 #include "auth/module.hpp"
@@ -21,12 +22,13 @@
 #include "license/license.hpp"
 #include "system/action.hpp"
 #include "utils/settings.hpp"
+#include "utils/sharded_rw_lock.hpp"
 #include "utils/synchronized.hpp"
 
 namespace memgraph::auth {
 
 class Auth;
-using SynchedAuth = memgraph::utils::Synchronized<memgraph::auth::Auth, memgraph::utils::WritePrioritizedRWLock>;
+using SynchedAuth = memgraph::utils::Synchronized<memgraph::auth::Auth, memgraph::utils::ShardedRWLock>;
 
 static const constexpr char *const kAllDatabases = "*";
 
@@ -439,5 +441,6 @@ class Auth final {
   std::unordered_map<std::string, auth::Module> modules_;
   Config config_;
   Epoch epoch_{kStartEpoch};
+  CredentialCache credential_cache_;
 };
 }  // namespace memgraph::auth
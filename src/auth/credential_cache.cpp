@@ -0,0 +1,78 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Licensed as a Memgraph Enterprise file under the Memgraph Enterprise
+// License (the "License"); by using this file, you agree to be bound by the terms of the License, and you may not use
+// this file except in compliance with the License. You may obtain a copy of the License at https://memgraph.com/legal.
+//
+//
+
+#include "auth/credential_cache.hpp"
+
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <openssl/rand.h>
+
+#include "auth/exceptions.hpp"
+
+namespace memgraph::auth {
+
+CredentialCache::CredentialCache(uint64_t capacity, std::chrono::seconds ttl) : capacity_{capacity}, ttl_{ttl} {
+  if (Enabled() && RAND_bytes(key_.data(), static_cast<int>(key_.size())) != 1) {
+    throw AuthException("Couldn't generate the credential cache key!");
+  }
+}
+
+std::string CredentialCache::Digest(std::string_view username, std::string_view password,
+                                    std::string_view stored_hash) const {
+  // Separators keep the boundaries of the parts unambiguous
+  std::string message;
+  message.reserve(username.size() + password.size() + stored_hash.size() + 2);
+  message.append(username).push_back('\0');
+  message.append(password).push_back('\0');
+  message.append(stored_hash);
+
+  std::string digest(EVP_MAX_MD_SIZE, '\0');
+  unsigned int digest_size = 0;
+  if (HMAC(EVP_sha256(), key_.data(), static_cast<int>(key_.size()),
+           reinterpret_cast<const unsigned char *>(message.data()), message.size(),
+           reinterpret_cast<unsigned char *>(digest.data()), &digest_size) == nullptr) {
+    throw AuthException("Couldn't compute the credential digest!");
+  }
+  digest.resize(digest_size);
+  return digest;
+}
+
+void CredentialCache::EvictUntil(Clock::time_point now, uint64_t max_size) {
+  while (!expiration_queue_.empty() && (expiration_queue_.front().second <= now || entries_.size() > max_size)) {
+    auto &[digest, expires] = expiration_queue_.front();
+    // The entry could have been inserted again since, in which case it has a later expiration time
+    if (auto it = entries_.find(digest); it != entries_.end() && it->second == expires) {
+      entries_.erase(it);
+    }
+    expiration_queue_.pop_front();
+  }
+}
+
+bool CredentialCache::Contains(std::string_view username, std::string_view password, std::string_view stored_hash,
+                               Clock::time_point now) {
+  if (!Enabled()) return false;
+  EvictUntil(now, capacity_);
+  return entries_.contains(Digest(username, password, stored_hash));
+}
+
+void CredentialCache::Insert(std::string_view username, std::string_view password, std::string_view stored_hash,
+                             Clock::time_point now) {
+  if (!Enabled()) return;
+  EvictUntil(now, capacity_ - 1);
+  auto digest = Digest(username, password, stored_hash);
+  const auto expires = now + ttl_;
+  entries_.insert_or_assign(digest, expires);
+  expiration_queue_.emplace_back(std::move(digest), expires);
+}
+
+void CredentialCache::Clear() {
+  entries_.clear();
+  expiration_queue_.clear();
+}
+
+}  // namespace memgraph::auth
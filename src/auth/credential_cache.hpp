@@ -0,0 +1,66 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Licensed as a Memgraph Enterprise file under the Memgraph Enterprise
+// License (the "License"); by using this file, you agree to be bound by the terms of the License, and you may not use
+// this file except in compliance with the License. You may obtain a copy of the License at https://memgraph.com/legal.
+//
+//
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace memgraph::auth {
+
+/**
+ * Remembers the credentials which were recently verified against a stored password hash, so repeated logins of a
+ * user skip the (intentionally slow) password hashing.
+ *
+ * Entries are keyed by an HMAC-SHA256 of the username, the password and the stored hash under a key generated for
+ * each process. Plain passwords are never kept and a changed password hash never matches an older entry. Entries
+ * expire `ttl` after they were inserted and the oldest ones are evicted once `capacity` is reached.
+ *
+ * The cache is not thread-safe, it is synchronized together with the `Auth` which owns it.
+ */
+class CredentialCache {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  /// A cache with zero `capacity` or `ttl` never remembers anything.
+  CredentialCache(uint64_t capacity, std::chrono::seconds ttl);
+
+  bool Enabled() const { return capacity_ > 0 && ttl_.count() > 0; }
+
+  /// Returns true if the credentials were verified against `stored_hash` less than `ttl` ago.
+  bool Contains(std::string_view username, std::string_view password, std::string_view stored_hash,
+                Clock::time_point now = Clock::now());
+
+  /// Remembers credentials which were just verified against `stored_hash`.
+  void Insert(std::string_view username, std::string_view password, std::string_view stored_hash,
+              Clock::time_point now = Clock::now());
+
+  void Clear();
+
+  uint64_t Size() const { return entries_.size(); }
+
+ private:
+  std::string Digest(std::string_view username, std::string_view password, std::string_view stored_hash) const;
+
+  void EvictUntil(Clock::time_point now, uint64_t max_size);
+
+  uint64_t capacity_;
+  std::chrono::seconds ttl_;
+  std::array<unsigned char, 32> key_{};
+  // Expiration time by digest, the queue holds the same entries in the insertion (and therefore expiration) order.
+  std::unordered_map<std::string, Clock::time_point> entries_;
+  std::deque<std::pair<std::string, Clock::time_point>> expiration_queue_;
+};
+
+}  // namespace memgraph::auth
@@ -60,6 +60,8 @@ struct HashedPassword {
 
   auto HashAlgo() const -> PasswordHashAlgorithm { return hash_algo; }
 
+  auto Hash() const -> std::string const & { return password_hash; }
+
   friend void to_json(nlohmann::json &j, const HashedPassword &p);
   friend void from_json(const nlohmann::json &j, HashedPassword &p);
 
@@ -402,6 +402,8 @@ class User final {
 #endif
   const std::string &username() const;
 
+  const std::optional<HashedPassword> &password_hash() const { return password_hash_; }
+
   const Permissions &permissions() const;
   Permissions &permissions();
 
@@ -14,10 +14,13 @@
 #include <array>
 #include <chrono>
 #include <string>
+#include <utility>
 
 #include "communication/bolt/v1/codes.hpp"
 #include "communication/bolt/v1/value.hpp"
 #include "storage/v2/point.hpp"
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/temporal.hpp"
 #include "utils/cast.hpp"
 #include "utils/endian.hpp"
 #include "utils/logging.hpp"
@@ -91,93 +94,12 @@ class Decoder {
       case Marker::Map16:
       case Marker::Map32:
         return ReadMap(marker, data);
-      case Marker::TinyStruct1: {
-        uint8_t signature = 0;
-        if (!buffer_.Read(&signature, 1)) {
-          return false;
-        }
-        switch (static_cast<Signature>(signature)) {
-          case Signature::Date:
-            return ReadDate(data);
-          case Signature::LocalTime:
-            return ReadLocalTime(data);
-          default:
-            return false;
-        }
-      }
-      case Marker::TinyStruct2: {
-        uint8_t signature = 0;
-        if (!buffer_.Read(&signature, 1)) {
-          return false;
-        }
-        switch (static_cast<Signature>(signature)) {
-          case Signature::LocalDateTime:
-            return ReadLocalDateTime(data);
-          default:
-            return false;
-        }
-      }
-      case Marker::TinyStruct3: {
-        // For tiny struct 3 we will also read the Signature to switch between
-        // vertex, unbounded_edge and path. Note that in those functions we
-        // won't perform an additional signature read.
-        uint8_t signature = 0;
-        if (!buffer_.Read(&signature, 1)) {
-          return false;
-        }
-        switch (static_cast<Signature>(signature)) {
-          case Signature::Node:
-            return ReadVertex(data);
-          case Signature::UnboundRelationship:
-            return ReadUnboundedEdge(data);
-          case Signature::Path:
-            return ReadPath(data);
-          case Signature::DateTime:
-            return ReadDateTime(data);
-          case Signature::DateTimeZoneId:
-            return ReadDateTimeZoneId(data);
-          case Signature::LegacyDateTime: {
-            if (major_v_ > 4) return false;
-            return ReadLegacyDateTime(data);
-          }
-          case Signature::LegacyDateTimeZoneId: {
-            if (major_v_ > 4) return false;
-            return ReadLegacyDateTimeZoneId(data);
-          }
-          case Signature::Point2d: {
-            return ReadPoint2d(data);
-          }
-          default:
-            return false;
-        }
-      }
-      case Marker::TinyStruct4: {
-        uint8_t signature = 0;
-        if (!buffer_.Read(&signature, 1)) {
-          return false;
-        }
-        switch (static_cast<Signature>(signature)) {
-          case Signature::Duration:
-            return ReadDuration(data);
-          case Signature::Point3d: {
-            return ReadPoint3d(data);
-          }
-          default:
-            return false;
-        }
-      }
-      case Marker::TinyStruct5: {
-        uint8_t signature = 0;
-        if (!buffer_.Read(&signature, 1)) {
-          return false;
-        }
-        switch (static_cast<Signature>(signature)) {
-          case Signature::Relationship:
-            return ReadEdge(data);
-          default:
-            return false;
-        }
-      }
+      case Marker::TinyStruct1:
+      case Marker::TinyStruct2:
+      case Marker::TinyStruct3:
+      case Marker::TinyStruct4:
+      case Marker::TinyStruct5:
+        return ReadStruct(marker, data);
       default:
         if ((value & 0xF0) == utils::UnderlyingCast(Marker::TinyString)) {
           return ReadString(marker, data);
@@ -211,6 +133,40 @@ class Decoder {
     return true;
   }
 
+  /**
+   * Reads a value from the available data in the buffer straight into a
+   * PropertyValue, without building a Value first. Vertices, edges and paths
+   * can't be stored in a PropertyValue, so reading them fails. The maps which
+   * encode Memgraph types (see mg_types.hpp) are read as ordinary maps.
+   *
+   * @param data pointer to a PropertyValue where the read data should be stored
+   * @returns true if data has been written to the data pointer,
+   *          false otherwise
+   */
+  bool ReadPropertyValue(storage::PropertyValue *data) {
+    uint8_t value;
+    if (!buffer_.Read(&value, 1)) {
+      return false;
+    }
+    return ReadPropertyValue(static_cast<Marker>(value), data);
+  }
+
+  /**
+   * Reads a map from the available data in the buffer straight into a
+   * PropertyValue map, e.g. the parameters of a query.
+   *
+   * @param data pointer to a map where the read data should be stored
+   * @returns true if data has been written to the data pointer and a map
+   *          was read, false otherwise
+   */
+  bool ReadPropertyMap(storage::PropertyValue::map_t *data) {
+    uint8_t value;
+    if (!buffer_.Read(&value, 1)) {
+      return false;
+    }
+    return ReadPropertyMapData(static_cast<Marker>(value), data);
+  }
+
   /**
    * Reads a Message header from the available data in the buffer.
    *
@@ -257,6 +213,15 @@ class Decoder {
   }
 
   bool ReadInt(const Marker &marker, Value *data) {
+    int64_t ret;
+    if (!ReadIntData(marker, &ret)) {
+      return false;
+    }
+    *data = Value(ret);
+    return true;
+  }
+
+  bool ReadIntData(const Marker &marker, int64_t *data) {
     uint8_t value = utils::UnderlyingCast(marker);
     int64_t ret;
     if (value >= 240 || value <= 127) {
@@ -288,20 +253,27 @@ class Decoder {
     } else {
       return false;
     }
-    *data = Value(ret);
+    *data = ret;
     return true;
   }
 
   bool ReadDouble(const Marker marker, Value *data) {
-    uint64_t value;
     double ret;
+    if (!ReadDoubleData(marker, &ret)) {
+      return false;
+    }
+    *data = Value(ret);
+    return true;
+  }
+
+  bool ReadDoubleData(const Marker marker, double *data) {
+    uint64_t value;
     DMG_ASSERT(marker == Marker::Float64, "Received invalid marker!");
     if (!buffer_.Read(reinterpret_cast<uint8_t *>(&value), sizeof(value))) {
       return false;
     }
     value = utils::BigEndianToHost(value);
-    ret = utils::MemcpyCast<double>(value);
-    *data = Value(ret);
+    *data = utils::MemcpyCast<double>(value);
     return true;
   }
 
@@ -335,33 +307,25 @@ class Decoder {
   }
 
   bool ReadString(const Marker &marker, Value *data) {
-    const int kMaxStackBuffer = 8192;
-    uint8_t buffer[kMaxStackBuffer];
+    std::string ret;
+    if (!ReadStringData(marker, &ret)) {
+      return false;
+    }
+    *data = Value(std::move(ret));
+    return true;
+  }
+
+  // The string is read straight into its destination, so there is no
+  // temporary buffer to copy it from.
+  bool ReadStringData(const Marker &marker, std::string *data) {
     auto size = ReadTypeSize(marker, MarkerString);
     if (size == -1) {
       return false;
     }
-    // Here we use a temporary buffer on the stack to prevent temporary
-    // allocations. Most of strings that are decoded are small so it makes no
-    // sense to allocate a temporary buffer every time we decode a string. This
-    // way we allocate a temporary buffer only when the string is large. This
-    // wouldn't be necessary if we had full C++17 support. In C++17 we could
-    // preallocate the `buffer[size]` in the destination string `*data =
-    // Value(std::string('\0', size))` and just call
-    // `buffer_.Read(data->ValueString().data())`.
-    if (size < kMaxStackBuffer) {
-      if (!buffer_.Read(buffer, size)) {
-        SPDLOG_WARN("[ReadString] Missing data!");
-        return false;
-      }
-      *data = Value(std::string(reinterpret_cast<char *>(buffer), size));
-    } else {
-      std::unique_ptr<uint8_t[]> ret(new uint8_t[size]);
-      if (!buffer_.Read(ret.get(), size)) {
-        SPDLOG_WARN("[ReadString] Missing data!");
-        return false;
-      }
-      *data = Value(std::string(reinterpret_cast<char *>(ret.get()), size));
+    data->resize(size);
+    if (!buffer_.Read(reinterpret_cast<uint8_t *>(data->data()), size)) {
+      SPDLOG_WARN("[ReadString] Missing data!");
+      return false;
     }
     return true;
   }
@@ -403,6 +367,272 @@ class Decoder {
     return ret.size() == size;
   }
 
+  bool ReadStruct(const Marker &marker, Value *data) {
+    switch (marker) {
+      case Marker::TinyStruct1: {
+        uint8_t signature = 0;
+        if (!buffer_.Read(&signature, 1)) {
+          return false;
+        }
+        switch (static_cast<Signature>(signature)) {
+          case Signature::Date:
+            return ReadDate(data);
+          case Signature::LocalTime:
+            return ReadLocalTime(data);
+          default:
+            return false;
+        }
+      }
+      case Marker::TinyStruct2: {
+        uint8_t signature = 0;
+        if (!buffer_.Read(&signature, 1)) {
+          return false;
+        }
+        switch (static_cast<Signature>(signature)) {
+          case Signature::LocalDateTime:
+            return ReadLocalDateTime(data);
+          default:
+            return false;
+        }
+      }
+      case Marker::TinyStruct3: {
+        // For tiny struct 3 we will also read the Signature to switch between
+        // vertex, unbounded_edge and path. Note that in those functions we
+        // won't perform an additional signature read.
+        uint8_t signature = 0;
+        if (!buffer_.Read(&signature, 1)) {
+          return false;
+        }
+        switch (static_cast<Signature>(signature)) {
+          case Signature::Node:
+            return ReadVertex(data);
+          case Signature::UnboundRelationship:
+            return ReadUnboundedEdge(data);
+          case Signature::Path:
+            return ReadPath(data);
+          case Signature::DateTime:
+            return ReadDateTime(data);
+          case Signature::DateTimeZoneId:
+            return ReadDateTimeZoneId(data);
+          case Signature::LegacyDateTime: {
+            if (major_v_ > 4) return false;
+            return ReadLegacyDateTime(data);
+          }
+          case Signature::LegacyDateTimeZoneId: {
+            if (major_v_ > 4) return false;
+            return ReadLegacyDateTimeZoneId(data);
+          }
+          case Signature::Point2d: {
+            return ReadPoint2d(data);
+          }
+          default:
+            return false;
+        }
+      }
+      case Marker::TinyStruct4: {
+        uint8_t signature = 0;
+        if (!buffer_.Read(&signature, 1)) {
+          return false;
+        }
+        switch (static_cast<Signature>(signature)) {
+          case Signature::Duration:
+            return ReadDuration(data);
+          case Signature::Point3d: {
+            return ReadPoint3d(data);
+          }
+          default:
+            return false;
+        }
+      }
+      case Marker::TinyStruct5: {
+        uint8_t signature = 0;
+        if (!buffer_.Read(&signature, 1)) {
+          return false;
+        }
+        switch (static_cast<Signature>(signature)) {
+          case Signature::Relationship:
+            return ReadEdge(data);
+          default:
+            return false;
+        }
+      }
+      default:
+        return false;
+    }
+  }
+
+  bool ReadPropertyValue(const Marker marker, storage::PropertyValue *data) {
+    const auto value = utils::UnderlyingCast(marker);
+    switch (marker) {
+      case Marker::Null:
+        *data = storage::PropertyValue();
+        return true;
+
+      case Marker::True:
+      case Marker::False:
+        *data = storage::PropertyValue(marker == Marker::True);
+        return true;
+
+      case Marker::Int8:
+      case Marker::Int16:
+      case Marker::Int32:
+      case Marker::Int64:
+        return ReadPropertyInt(marker, data);
+
+      case Marker::Float64: {
+        double ret;
+        if (!ReadDoubleData(marker, &ret)) {
+          return false;
+        }
+        *data = storage::PropertyValue(ret);
+        return true;
+      }
+
+      case Marker::String8:
+      case Marker::String16:
+      case Marker::String32:
+        return ReadPropertyString(marker, data);
+
+      case Marker::List8:
+      case Marker::List16:
+      case Marker::List32:
+        return ReadPropertyList(marker, data);
+
+      case Marker::Map8:
+      case Marker::Map16:
+      case Marker::Map32:
+        return ReadPropertyMap(marker, data);
+      case Marker::TinyStruct1:
+      case Marker::TinyStruct2:
+      case Marker::TinyStruct3:
+      case Marker::TinyStruct4:
+      case Marker::TinyStruct5:
+        return ReadPropertyStruct(marker, data);
+      default:
+        if ((value & 0xF0) == utils::UnderlyingCast(Marker::TinyString)) {
+          return ReadPropertyString(marker, data);
+        } else if ((value & 0xF0) == utils::UnderlyingCast(Marker::TinyList)) {
+          return ReadPropertyList(marker, data);
+        } else if ((value & 0xF0) == utils::UnderlyingCast(Marker::TinyMap)) {
+          return ReadPropertyMap(marker, data);
+        } else {
+          return ReadPropertyInt(marker, data);
+        }
+    }
+  }
+
+  bool ReadPropertyInt(const Marker &marker, storage::PropertyValue *data) {
+    int64_t ret;
+    if (!ReadIntData(marker, &ret)) {
+      return false;
+    }
+    *data = storage::PropertyValue(ret);
+    return true;
+  }
+
+  bool ReadPropertyString(const Marker &marker, storage::PropertyValue *data) {
+    std::string ret;
+    if (!ReadStringData(marker, &ret)) {
+      return false;
+    }
+    *data = storage::PropertyValue(std::move(ret));
+    return true;
+  }
+
+  bool ReadPropertyList(const Marker &marker, storage::PropertyValue *data) {
+    auto size = ReadTypeSize(marker, MarkerList);
+    if (size == -1) {
+      return false;
+    }
+    storage::PropertyValue::list_t ret(size);
+    for (auto &element : ret) {
+      if (!ReadPropertyValue(&element)) {
+        return false;
+      }
+    }
+    *data = storage::PropertyValue(std::move(ret));
+    return true;
+  }
+
+  bool ReadPropertyMap(const Marker &marker, storage::PropertyValue *data) {
+    storage::PropertyValue::map_t ret;
+    if (!ReadPropertyMapData(marker, &ret)) {
+      return false;
+    }
+    *data = storage::PropertyValue(std::move(ret));
+    return true;
+  }
+
+  bool ReadPropertyMapData(const Marker &marker, storage::PropertyValue::map_t *data) {
+    auto size = ReadTypeSize(marker, MarkerMap);
+    if (size == -1) {
+      return false;
+    }
+    // The entries are sorted once they are all read, instead of keeping the
+    // flat map sorted on each insertion.
+    storage::PropertyValue::map_t::sequence_type entries;
+    entries.reserve(size);
+    for (int64_t i = 0; i < size; ++i) {
+      uint8_t value;
+      std::string key;
+      if (!buffer_.Read(&value, 1) || !ReadStringData(static_cast<Marker>(value), &key)) {
+        return false;
+      }
+      storage::PropertyValue element;
+      if (!ReadPropertyValue(&element)) {
+        return false;
+      }
+      entries.emplace_back(std::move(key), std::move(element));
+    }
+    // Adopting the entries drops the duplicate keys, which aren't allowed.
+    data->adopt_sequence(std::move(entries));
+    return data->size() == size;
+  }
+
+  // Temporal values and points are small, so they are read as a Value and
+  // converted.
+  bool ReadPropertyStruct(const Marker &marker, storage::PropertyValue *data) {
+    Value dv;
+    if (!ReadStruct(marker, &dv)) {
+      return false;
+    }
+    switch (dv.type()) {
+      case Value::Type::Date:
+        *data = storage::PropertyValue(
+            storage::TemporalData(storage::TemporalType::Date, dv.ValueDate().MicrosecondsSinceEpoch()));
+        return true;
+      case Value::Type::LocalTime:
+        *data = storage::PropertyValue(
+            storage::TemporalData(storage::TemporalType::LocalTime, dv.ValueLocalTime().MicrosecondsSinceEpoch()));
+        return true;
+      case Value::Type::LocalDateTime:
+        // Bolt uses time since epoch without timezone (as if in UTC)
+        *data = storage::PropertyValue(storage::TemporalData(storage::TemporalType::LocalDateTime,
+                                                             dv.ValueLocalDateTime().SysMicrosecondsSinceEpoch()));
+        return true;
+      case Value::Type::Duration:
+        *data = storage::PropertyValue(
+            storage::TemporalData(storage::TemporalType::Duration, dv.ValueDuration().microseconds));
+        return true;
+      case Value::Type::ZonedDateTime: {
+        const auto &zoned_date_time = dv.ValueZonedDateTime();
+        *data = storage::PropertyValue(storage::ZonedTemporalData(storage::ZonedTemporalType::ZonedDateTime,
+                                                                  zoned_date_time.SysTimeSinceEpoch(),
+                                                                  zoned_date_time.GetTimezone()));
+        return true;
+      }
+      case Value::Type::Point2d:
+        *data = storage::PropertyValue(dv.ValuePoint2d());
+        return true;
+      case Value::Type::Point3d:
+        *data = storage::PropertyValue(dv.ValuePoint3d());
+        return true;
+      default:
+        // Vertices, edges and paths
+        return false;
+    }
+  }
+
   bool ReadVertex(Value *data) {
     Value dv;
     *data = Value(Vertex());
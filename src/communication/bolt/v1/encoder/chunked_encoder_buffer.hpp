@@ -40,8 +40,12 @@ namespace memgraph::communication::bolt {
  * can control when the message is over and the whole message isn't
  * unnecessarily buffered in memory.
  *
- * The current implementation stores only a single chunk into memory and sends
- * it immediately to the output stream when new data arrives.
+ * Finished chunks are coalesced and sent to the output stream in a single
+ * write once they reach the flush threshold, or right away if the caller says
+ * no more data follows. The threshold doubles every time it is reached while
+ * more data follows, and falls back to the minimum once it doesn't, so a long
+ * stream of messages goes out in ever fewer and larger writes while the first
+ * messages of it aren't held back.
  *
  * @tparam TOutputStream the output stream that should be used
  */
@@ -58,69 +62,132 @@ class ChunkedEncoderBuffer {
    * @param n is the number of bytes
    */
   void Write(const uint8_t *values, size_t n) {
-    size_t written = 0;
-
     while (n > 0) {
+      if (!chunk_open_) OpenChunk();
+
       // Define the number of bytes which will be copied into the chunk because
-      // the internal storage is a fixed length array.
+      // a chunk holds at most kChunkMaxDataSize bytes.
       size_t size = n < kChunkMaxDataSize - have_ ? n : kChunkMaxDataSize - have_;
-
-      // Copy `size` values to the chunk array.
-      std::memcpy(chunk_.data() + kChunkHeaderSize + have_, values + written, size);
-
-      // Update positions. The position pointer and incoming size have to be
-      // updated because all incoming values have to be processed.
-      written += size;
+      buffer_.insert(buffer_.end(), values, values + size);
+      values += size;
       have_ += size;
       n -= size;
 
-      // If the chunk is full, send it to the output stream and clear the
-      // internal storage to make space for other incoming values that are left
-      // in the values array.
-      if (have_ == kChunkMaxDataSize) Flush(true);
+      // If the chunk is full, finish it and start a new one for the values
+      // which are left.
+      if (have_ == kChunkMaxDataSize) {
+        CloseChunk();
+        if (buffer_.size() >= flush_threshold_) Send(true);
+      }
     }
   }
 
   /**
-   * Wrap the data from the chunk array (append the size header) and send
-   * the whole chunk into the output stream.
+   * Finishes the current chunk (append the size header), an empty one if
+   * there was no data, and sends the coalesced chunks into the output stream
+   * unless more data follows and they are below the flush threshold.
    *
    * @param have_more this parameter is passed to the underlying output stream
    *                  `Write` method to indicate wether we have more data
    *                  waiting to be sent (in order to optimize network packets)
    */
   bool Flush(bool have_more = false) {
-    // Write the size of the chunk.
-    chunk_[0] = have_ >> 8;
-    chunk_[1] = have_ & 0xFF;
-
-    // Write the data to the stream.
-    auto ret = output_stream_.Write(chunk_.data(), kChunkHeaderSize + have_, have_more);
+    if (!chunk_open_) OpenChunk();
+    const bool end_marker = have_ == 0;
+    CloseChunk();
+    if (end_marker) message_start_ = buffer_.size();
+
+    if (corked_) {
+      if (buffer_.size() < flush_threshold_) return true;
+      return Send(true);
+    }
+    if (!have_more) {
+      flush_threshold_ = kMinFlushThreshold;
+    } else if (buffer_.size() < flush_threshold_) {
+      return true;
+    }
+    return Send(have_more);
+  }
 
-    // Cleanup.
-    Clear();
+  /**
+   * Holds back the chunks below the flush threshold even when no more data
+   * follows, until `Uncork` is called. Used to send the responses to the
+   * messages which were received together in a single write.
+   */
+  void Cork() { corked_ = true; }
 
-    return ret;
+  /**
+   * Sends the chunks held back since `Cork`.
+   *
+   * @returns true if the data was successfully sent to the output stream or
+   *          there was nothing to send, false otherwise
+   */
+  bool Uncork() {
+    corked_ = false;
+    flush_threshold_ = kMinFlushThreshold;
+    if (buffer_.empty()) return true;
+    return Send(false);
   }
 
-  /** Clears the internal buffers. */
-  void Clear() { have_ = 0; }
+  /** Clears the data of the unfinished message. */
+  void Clear() {
+    buffer_.resize(message_start_);
+    chunk_open_ = false;
+    have_ = 0;
+  }
 
   /**
-   * Returns a boolean indicating whether there is data in the buffer.
+   * Returns a boolean indicating whether there is data of an unfinished
+   * message in the buffer.
    * @returns true if there is data in the buffer,
    *          false otherwise
    */
-  bool HasData() { return have_ > 0; }
+  bool HasData() { return buffer_.size() > message_start_; }
 
  private:
+  // Bounds of the size of the coalesced chunks which triggers a write.
+  static constexpr size_t kMinFlushThreshold = 8 * 1024;
+  static constexpr size_t kMaxFlushThreshold = 256 * 1024;
+
+  void OpenChunk() {
+    // The size header is written once the chunk is finished.
+    buffer_.resize(buffer_.size() + kChunkHeaderSize);
+    chunk_open_ = true;
+  }
+
+  void CloseChunk() {
+    auto *header = buffer_.data() + buffer_.size() - have_ - kChunkHeaderSize;
+    header[0] = have_ >> 8;
+    header[1] = have_ & 0xFF;
+    chunk_open_ = false;
+    have_ = 0;
+  }
+
+  bool Send(bool have_more) {
+    if (have_more) flush_threshold_ = std::min(flush_threshold_ * 2, kMaxFlushThreshold);
+    auto ret = output_stream_.Write(buffer_.data(), buffer_.size(), have_more);
+    buffer_.clear();
+    message_start_ = 0;
+    return ret;
+  }
+
   // The output stream used.
   TOutputStream &output_stream_;
 
-  // Buffer for a single chunk.
-  std::array<uint8_t, kChunkWholeSize> chunk_;
+  // Finished chunks which weren't sent yet, followed by the current chunk.
+  std::vector<uint8_t> buffer_;
+
+  // Offset of the first chunk of the unfinished message in the buffer.
+  size_t message_start_{0};
 
-  // Amount of data in chunk array.
+  // Whether the size header of the current chunk is in the buffer.
+  bool chunk_open_{false};
+
+  // Amount of data in the current chunk.
   size_t have_{0};
+
+  size_t flush_threshold_{kMinFlushThreshold};
+
+  bool corked_{false};
 };
 }  // namespace memgraph::communication::bolt
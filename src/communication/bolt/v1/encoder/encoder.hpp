@@ -60,6 +60,22 @@ class Encoder : private BaseEncoder<Buffer> {
     return buffer_.Flush(true);
   }
 
+  /**
+   * Sends a Record message of fields which are already encoded.
+   *
+   * @param size the number of fields
+   * @param encoded_fields the fields encoded one after another
+   */
+  bool MessageRecord(size_t size, const std::vector<uint8_t> &encoded_fields) {
+    WriteRAW(utils::UnderlyingCast(Marker::TinyStruct1));
+    WriteRAW(utils::UnderlyingCast(Signature::Record));
+    this->WriteTypeSize(size, MarkerList);
+    WriteRAW(encoded_fields.data(), encoded_fields.size());
+    if (!buffer_.Flush(true)) return false;
+    // A Record message is followed by either a Record, Success or Failure.
+    return buffer_.Flush(true);
+  }
+
   /**
    * Sends a Success message.
    *
@@ -28,4 +28,20 @@ auto BoltMapToMgTypeInfo(map_t const &value) -> std::optional<mg_type_info> {
   return std::nullopt;
 }
 
+auto PropertyMapToMgTypeInfo(storage::PropertyValue::map_t const &value) -> std::optional<mg_type_info> {
+  auto type_selector = value.find(kMgTypeType);
+  if (type_selector == value.cend()) return std::nullopt;
+  auto value_selector = value.find(kMgTypeValue);
+  if (value_selector == value.cend()) return std::nullopt;
+  if (!type_selector->second.IsString()) return std::nullopt;
+  auto mg_type = std::string_view{type_selector->second.ValueString()};
+  auto const &value_val = value_selector->second;
+  if (!value_val.IsString()) return std::nullopt;
+  auto mg_value = std::string_view{value_val.ValueString()};
+  if (mg_type == kMgTypeEnum) {
+    return mg_type_info{MgType::Enum, kMgTypeEnum, mg_value};
+  }
+  return std::nullopt;
+}
+
 }  // namespace memgraph::communication::bolt
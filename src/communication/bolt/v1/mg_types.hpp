@@ -13,6 +13,7 @@
 
 #include <string_view>
 #include "communication/bolt/v1/value.hpp"
+#include "storage/v2/property_value.hpp"
 
 namespace memgraph::communication::bolt {
 
@@ -31,4 +32,8 @@ constexpr std::string_view kMgTypeType = "__type";
 constexpr std::string_view kMgTypeValue = "__value";
 
 auto BoltMapToMgTypeInfo(map_t const &value) -> std::optional<mg_type_info>;
+
+/// The same as BoltMapToMgTypeInfo, for the maps which are decoded straight
+/// into property values.
+auto PropertyMapToMgTypeInfo(storage::PropertyValue::map_t const &value) -> std::optional<mg_type_info>;
 }  // namespace memgraph::communication::bolt
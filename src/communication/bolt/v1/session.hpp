@@ -30,9 +30,11 @@
 #include "communication/metrics.hpp"
 #include "dbms/constants.hpp"
 #include "dbms/global.hpp"
+#include "storage/v2/property_value.hpp"
 #include "utils/exceptions.hpp"
 #include "utils/logging.hpp"
 #include "utils/timestamp.hpp"
+#include "utils/tracing.hpp"
 #include "utils/uuid.hpp"
 
 namespace memgraph::communication::bolt {
@@ -82,12 +84,13 @@ class Session {
   Session &operator=(Session &&) noexcept = delete;
 
   /**
-   * Process the given `query` with `params`.
+   * Process the given `query` with `params`. The parameters are decoded
+   * straight into property values, so they don't have to be converted.
    * @return A pair which contains list of headers and qid which is set only
    * if an explicit transaction was started.
    */
   virtual std::pair<std::vector<std::string>, std::optional<int>> Interpret(const std::string &query,
-                                                                            const map_t &params,
+                                                                            storage::PropertyValue::map_t params,
                                                                             const map_t &extra) = 0;
 
   virtual void Configure(const map_t &run_time_info) = 0;
@@ -117,7 +120,8 @@ class Session {
   virtual map_t Discard(std::optional<int> n, std::optional<int> qid) = 0;
 
   virtual void BeginTransaction(const map_t &params) = 0;
-  virtual void CommitTransaction() = 0;
+  /** Commits the explicit transaction, returns the metadata of the success message. */
+  virtual map_t CommitTransaction() = 0;
   virtual void RollbackTransaction() = 0;
 
   /** Aborts currently running query. */
@@ -156,6 +160,13 @@ class Session {
       encoder_.UpdateVersion(version_.major);
     }
 
+    // The messages which were read together, e.g. the pipelined RUN and PULL
+    // of a query, are traced together.
+    utils::tracing::Trace const trace("bolt.execute");
+
+    // Drivers pipeline messages, e.g. RUN and PULL, so the responses to all
+    // the messages which were read together are sent in a single write.
+    encoder_buffer_.Cork();
     ChunkState chunk_state;
     while ((chunk_state = decoder_buffer_.GetChunk()) != ChunkState::Partial) {
       if (chunk_state == ChunkState::Whole) {
@@ -190,6 +201,10 @@ class Session {
         return;
       }
     }
+    if (UNLIKELY(!encoder_buffer_.Uncork())) {
+      spdlog::trace("Couldn't send the responses!");
+      ClientFailureInvalidData();
+    }
   }
 
   void HandleError() {
@@ -236,6 +251,7 @@ class Session {
                              {"message",
                               "Something went wrong while executing the query! "
                               "Check the server logs for more details."}});
+    encoder_buffer_.Uncork();
     // Throw an exception to indicate that something went wrong with execution
     // of the session to trigger session cleanup and socket close.
     throw SessionException("Something went wrong during session execution!");
@@ -16,6 +16,7 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include "communication/bolt/metrics.hpp"
@@ -30,6 +31,7 @@
 #include "utils/logging.hpp"
 #include "utils/memory_tracker.hpp"
 #include "utils/message.hpp"
+#include "utils/tracing.hpp"
 
 namespace memgraph::communication::bolt {
 // TODO: Revise these error messages
@@ -205,13 +207,13 @@ State HandleRunV1(TSession &session, const State state, const Marker marker) {
     return State::Close;
   }
   Value query;
-  Value params;
+  storage::PropertyValue::map_t params;
   if (!session.decoder_.ReadValue(&query, Value::Type::String)) {
     spdlog::trace("Couldn't read query string!");
     return State::Close;
   }
 
-  if (!session.decoder_.ReadValue(&params, Value::Type::Map)) {
+  if (!session.decoder_.ReadPropertyMap(&params)) {
     spdlog::trace("Couldn't read parameters!");
     return State::Close;
   }
@@ -237,7 +239,7 @@ State HandleRunV1(TSession &session, const State state, const Marker marker) {
 
   try {
     // Interpret can throw.
-    const auto [header, qid] = session.Interpret(query.ValueString(), params.ValueMap(), {});
+    const auto [header, qid] = session.Interpret(query.ValueString(), std::move(params), {});
     // Convert std::string to Value
     std::vector<Value> vec;
     map_t data;
@@ -263,22 +265,25 @@ State HandleRunV4(TSession &session, const State state, const Marker marker) {
     return State::Close;
   }
   Value query;
-  Value params;
+  storage::PropertyValue::map_t params;
   Value extra;
-  if (!session.decoder_.ReadValue(&query, Value::Type::String)) {
-    spdlog::trace("Couldn't read query string!");
-    return State::Close;
-  }
+  {
+    utils::tracing::ScopedSpan const span("bolt.decode");
+    if (!session.decoder_.ReadValue(&query, Value::Type::String)) {
+      spdlog::trace("Couldn't read query string!");
+      return State::Close;
+    }
 
-  if (!session.decoder_.ReadValue(&params, Value::Type::Map)) {
-    spdlog::trace("Couldn't read parameters!");
-    return State::Close;
-  }
+    if (!session.decoder_.ReadPropertyMap(&params)) {
+      spdlog::trace("Couldn't read parameters!");
+      return State::Close;
+    }
 
-  // Even though this part seems unnecessary it is needed to move the buffer
-  if (!session.decoder_.ReadValue(&extra, Value::Type::Map)) {
-    spdlog::trace("Couldn't read extra field!");
-    return State::Close;
+    // Even though this part seems unnecessary it is needed to move the buffer
+    if (!session.decoder_.ReadValue(&extra, Value::Type::Map)) {
+      spdlog::trace("Couldn't read extra field!");
+      return State::Close;
+    }
   }
 
   if (state != State::Idle) {
@@ -313,7 +318,7 @@ State HandleRunV4(TSession &session, const State state, const Marker marker) {
 
   try {
     // Interpret can throw.
-    const auto [header, qid] = session.Interpret(query.ValueString(), params.ValueMap(), extra.ValueMap());
+    const auto [header, qid] = session.Interpret(query.ValueString(), std::move(params), extra.ValueMap());
     // Convert std::string to Value
     std::vector<Value> vec;
     map_t data;
@@ -455,8 +460,7 @@ State HandleCommit(TSession &session, const State state, const Marker marker) {
   DMG_ASSERT(!session.encoder_buffer_.HasData(), "There should be no data to write in this state");
 
   try {
-    session.CommitTransaction();
-    if (!session.encoder_.MessageSuccess({})) {
+    if (!session.encoder_.MessageSuccess(session.CommitTransaction())) {
       spdlog::trace("Couldn't send success message!");
       return State::Close;
     }
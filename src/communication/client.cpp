@@ -67,6 +67,10 @@ bool Client::Connect(const io::network::Endpoint &endpoint) {
     // the read and write end. This function cannot fail.
     SSL_set_bio(ssl_, bio_, bio_);
 
+    // Resume the session of the previous connection if there was one, so the
+    // handshake is abbreviated.
+    context_->ResumeSession(ssl_);
+
     // Clear all leftover errors.
     ERR_clear_error();
 
@@ -1,4 +1,4 @@
-// Copyright 2023 Memgraph Ltd.
+// Copyright 2024 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -14,10 +14,56 @@
 #include <boost/asio/ssl/verify_mode.hpp>
 #include <boost/system/detail/error_code.hpp>
 
+#include <mutex>
+
 #include "utils/logging.hpp"
 
 namespace memgraph::communication {
 
+namespace {
+
+// Lets the kernel encrypt and decrypt the records of the connections which
+// use a socket BIO, once the handshake is done. OpenSSL falls back to doing
+// it in user space when the kernel or the negotiated cipher doesn't support
+// it.
+void EnableKtls(SSL_CTX *ctx) {
+#ifdef SSL_OP_ENABLE_KTLS
+  SSL_CTX_set_options(ctx, SSL_OP_ENABLE_KTLS);
+#endif
+}
+
+int SessionCacheIndex() {
+  static const int index = SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+  return index;
+}
+
+// The servers need a session id context to resume the sessions of clients
+// whose certificates they verify.
+constexpr unsigned char kSessionIdContext[] = "memgraph";
+
+}  // namespace
+
+// The session of the latest connection, the TLS 1.3 tickets are received
+// after the handshake so they are stored by the new session callback.
+struct ClientContext::SessionCache {
+  ~SessionCache() {
+    if (session != nullptr) SSL_SESSION_free(session);
+  }
+
+  static int Store(SSL *ssl, SSL_SESSION *new_session) {
+    auto *cache = static_cast<SessionCache *>(SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), SessionCacheIndex()));
+    if (cache == nullptr) return 0;
+    auto guard = std::lock_guard{cache->lock};
+    if (cache->session != nullptr) SSL_SESSION_free(cache->session);
+    cache->session = new_session;
+    // The cache keeps the reference to the session.
+    return 1;
+  }
+
+  std::mutex lock;
+  SSL_SESSION *session{nullptr};
+};
+
 ClientContext::ClientContext(bool use_ssl) : use_ssl_(use_ssl), ctx_(nullptr) {
   if (use_ssl_) {
 #if OPENSSL_VERSION_NUMBER < 0x10100000L
@@ -30,6 +76,12 @@ ClientContext::ClientContext(bool use_ssl) : use_ssl_(use_ssl), ctx_(nullptr) {
     // Disable legacy SSL support. Other options can be seen here:
     // https://www.openssl.org/docs/man1.0.2/ssl/SSL_CTX_set_options.html
     SSL_CTX_set_options(ctx_, SSL_OP_NO_SSLv3);
+    EnableKtls(ctx_);
+
+    session_cache_ = std::make_unique<SessionCache>();
+    SSL_CTX_set_ex_data(ctx_, SessionCacheIndex(), session_cache_.get());
+    SSL_CTX_set_session_cache_mode(ctx_, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+    SSL_CTX_sess_set_new_cb(ctx_, &SessionCache::Store);
   }
 }
 
@@ -42,7 +94,8 @@ ClientContext::ClientContext(const std::string &key_file, const std::string &cer
   }
 }
 
-ClientContext::ClientContext(ClientContext &&other) noexcept : use_ssl_(other.use_ssl_), ctx_(other.ctx_) {
+ClientContext::ClientContext(ClientContext &&other) noexcept
+    : use_ssl_(other.use_ssl_), ctx_(other.ctx_), session_cache_(std::move(other.session_cache_)) {
   other.use_ssl_ = false;
   other.ctx_ = nullptr;
 }
@@ -58,6 +111,7 @@ ClientContext &ClientContext::operator=(ClientContext &&other) noexcept {
   // move other objects to self
   use_ssl_ = other.use_ssl_;
   ctx_ = other.ctx_;
+  session_cache_ = std::move(other.session_cache_);
 
   // reset other objects
   other.use_ssl_ = false;
@@ -76,6 +130,12 @@ SSL_CTX *ClientContext::context() { return ctx_; }
 
 bool ClientContext::use_ssl() { return use_ssl_; }
 
+void ClientContext::ResumeSession(SSL *ssl) {
+  if (!session_cache_) return;
+  auto guard = std::lock_guard{session_cache_->lock};
+  if (session_cache_->session != nullptr) SSL_set_session(ssl, session_cache_->session);
+}
+
 ServerContext::ServerContext(const std::string &key_file, const std::string &cert_file, const std::string &ca_file,
                              bool verify_peer) {
   namespace ssl = boost::asio::ssl;
@@ -94,6 +154,12 @@ ServerContext::ServerContext(const std::string &key_file, const std::string &cer
 
   ctx_->set_options(SSL_OP_NO_SSLv3, ec);
   MG_ASSERT(!ec, "Setting options to SSL context failed!");
+  EnableKtls(ctx_->native_handle());
+  // The session tickets are issued by default, so reconnecting clients can
+  // resume their sessions instead of doing a full handshake.
+  const auto id_context_set =
+      SSL_CTX_set_session_id_context(ctx_->native_handle(), kSessionIdContext, sizeof(kSessionIdContext) - 1);
+  MG_ASSERT(id_context_set == 1, "Setting the SSL session id context failed!");
 
   if (!ca_file.empty()) {
     // Load the certificate authority file.
@@ -1,4 +1,4 @@
-// Copyright 2023 Memgraph Ltd.
+// Copyright 2024 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <memory>
 #include <optional>
 #include <string>
 
@@ -62,9 +63,20 @@ class ClientContext final {
 
   bool use_ssl();
 
+  /**
+   * Makes the connection of `ssl` resume the TLS session of the latest
+   * connection made with this context, so a reconnect doesn't need a full
+   * handshake. Must be called before the handshake.
+   */
+  void ResumeSession(SSL *ssl);
+
  private:
+  struct SessionCache;
+
   bool use_ssl_;
   SSL_CTX *ctx_;
+  // Outlives moves of the context, OpenSSL references it from `ctx_`.
+  std::unique_ptr<SessionCache> session_cache_;
 };
 
 /**
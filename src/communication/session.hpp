@@ -157,6 +157,9 @@ class Session final {
     // Allocate the buffer to fill the data.
     auto buf = input_buffer_.write_end()->Allocate();
 
+    // Whether the socket had no more data than the read returned.
+    bool drained = false;
+
     if (ssl_) {
       // We clear errors here to prevent errors piling up in the internal
       // OpenSSL error queue. To see when could that be an issue read this:
@@ -234,13 +237,17 @@ class Session final {
       } else {
         // Notify the input buffer that it has new data.
         input_buffer_.write_end()->Written(len);
+        // A read shorter than the buffer emptied the socket, so the next read
+        // would only fail with `EAGAIN`. We skip it and let the listener rearm
+        // epoll, which reports the data that arrives in the meantime.
+        drained = static_cast<size_t>(len) < buf.len;
       }
     }
 
     // Execute the session.
     session_.Execute();
 
-    return false;
+    return drained;
   }
 
   /**
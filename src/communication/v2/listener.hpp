@@ -68,27 +68,30 @@ class Listener final : public std::enable_shared_from_this<Listener<TSession, TS
 
  private:
   Listener(boost::asio::io_context &io_context, TSessionContext *session_context, ServerContext *server_context,
-           tcp::endpoint &endpoint, const std::string_view service_name, const uint64_t inactivity_timeout_sec)
+           tcp::endpoint &endpoint, const std::string_view service_name, const uint64_t inactivity_timeout_sec,
+           ExecutionThreadPool *execution_pool = nullptr)
       : io_context_(io_context),
         session_context_(session_context),
         server_context_(server_context),
         acceptor_(io_context_),
         endpoint_{endpoint},
         service_name_{service_name},
-        inactivity_timeout_{inactivity_timeout_sec} {
+        inactivity_timeout_{inactivity_timeout_sec},
+        execution_pool_{execution_pool} {
     TryCreate<false>();
   }
 
   Listener(assert_create /*obj*/, boost::asio::io_context &io_context, TSessionContext *session_context,
            ServerContext *server_context, tcp::endpoint &endpoint, const std::string_view service_name,
-           const uint64_t inactivity_timeout_sec)
+           const uint64_t inactivity_timeout_sec, ExecutionThreadPool *execution_pool = nullptr)
       : io_context_(io_context),
         session_context_(session_context),
         server_context_(server_context),
         acceptor_(io_context_),
         endpoint_{endpoint},
         service_name_{service_name},
-        inactivity_timeout_{inactivity_timeout_sec} {
+        inactivity_timeout_{inactivity_timeout_sec},
+        execution_pool_{execution_pool} {
     TryCreate<true>();
   }
 
@@ -151,7 +154,7 @@ class Listener final : public std::enable_shared_from_this<Listener<TSession, TS
 
     auto remote_endpoint = socket.lowest_layer().remote_endpoint();
     auto session = SessionHandler::Create(std::move(socket), session_context_, *server_context_, remote_endpoint,
-                                          inactivity_timeout_, service_name_);
+                                          inactivity_timeout_, service_name_, execution_pool_);
     session->Start();
     DoAccept();
   }
@@ -169,6 +172,7 @@ class Listener final : public std::enable_shared_from_this<Listener<TSession, TS
   tcp::endpoint endpoint_;
   std::string_view service_name_;
   std::chrono::seconds inactivity_timeout_;
+  ExecutionThreadPool *execution_pool_;
 
   std::atomic<bool> alive_;
 };
@@ -1,4 +1,4 @@
-// Copyright 2022 Memgraph Ltd.
+// Copyright 2024 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -11,14 +11,30 @@
 
 #pragma once
 
+#include <array>
+#include <chrono>
+#include <condition_variable>
 #include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
 #include <thread>
 #include <vector>
 
+#include <fmt/format.h>
 #include <boost/asio/executor_work_guard.hpp>
 #include <boost/asio/io_context.hpp>
 
+#include "utils/blocking_section.hpp"
+#include "utils/event_counter.hpp"
+#include "utils/event_histogram.hpp"
 #include "utils/logging.hpp"
+#include "utils/thread.hpp"
+
+namespace memgraph::metrics {
+extern const Event QueuedBoltExecutions;
+extern const Event BoltExecutionWaitLatency_us;
+}  // namespace memgraph::metrics
 
 namespace memgraph::communication::v2 {
 
@@ -65,4 +81,145 @@ class IOContextThreadPool final {
   std::vector<std::jthread> background_threads_;
   bool running_{false};
 };
+
+/**
+ * Threads which execute the received messages of sessions, so that the I/O
+ * threads only read from and write to the sockets. Long queries then occupy
+ * the execution threads, while the I/O threads keep serving the other
+ * sessions. Messages of sessions whose previous execution took longer than
+ * the given threshold wait until no messages of other sessions are queued.
+ *
+ * While an execution waits on I/O in a `utils::BlockingSection` another
+ * message is executed in its place, on an additional thread if no thread is
+ * free. At most `pool_size` executions which aren't waiting run at a time and
+ * the pool grows up to twice its size.
+ */
+class ExecutionThreadPool final : public utils::BlockingObserver {
+ public:
+  ExecutionThreadPool(size_t pool_size, std::chrono::milliseconds long_execution_threshold)
+      : pool_size_{pool_size}, long_execution_threshold_{long_execution_threshold} {
+    MG_ASSERT(pool_size != 0, "Pool size must be greater then 0!");
+  }
+
+  ExecutionThreadPool(const ExecutionThreadPool &) = delete;
+  ExecutionThreadPool &operator=(const ExecutionThreadPool &) = delete;
+  ExecutionThreadPool(ExecutionThreadPool &&) = delete;
+  ExecutionThreadPool &operator=(ExecutionThreadPool &&) = delete;
+
+  ~ExecutionThreadPool() {
+    Shutdown();
+    AwaitShutdown();
+  }
+
+  void Run() {
+    auto guard = std::lock_guard{mutex_};
+    threads_.reserve(2 * pool_size_);
+    for (size_t i = 0; i < pool_size_; ++i) {
+      StartThread();
+    }
+  }
+
+  /// Stops the threads after their current task, the queued tasks are dropped.
+  void Shutdown() {
+    {
+      auto guard = std::lock_guard{mutex_};
+      if (stopping_) return;
+      stopping_ = true;
+      for (auto &queue : queues_) {
+        memgraph::metrics::DecrementCounter(memgraph::metrics::QueuedBoltExecutions, queue.size());
+        queue.clear();
+      }
+    }
+    cv_.notify_all();
+  }
+
+  void AwaitShutdown() { threads_.clear(); }
+
+  /// Queues `task` behind the tasks of the same priority. The tasks of long
+  /// executions run only when no other tasks are queued.
+  void Submit(std::function<void()> task, bool long_execution) {
+    {
+      auto guard = std::lock_guard{mutex_};
+      if (stopping_) return;
+      queues_[long_execution ? 1 : 0].push_back({std::move(task), std::chrono::steady_clock::now()});
+    }
+    memgraph::metrics::IncrementCounter(memgraph::metrics::QueuedBoltExecutions);
+    cv_.notify_one();
+  }
+
+  std::chrono::milliseconds LongExecutionThreshold() const noexcept { return long_execution_threshold_; }
+
+  void OnBlock() override {
+    {
+      auto guard = std::lock_guard{mutex_};
+      ++blocked_;
+      // The threads which don't run an execution would take the next message.
+      if (!stopping_ && running_ == threads_.size() && threads_.size() < 2 * pool_size_) StartThread();
+    }
+    cv_.notify_one();
+  }
+
+  void OnUnblock() override {
+    auto guard = std::lock_guard{mutex_};
+    --blocked_;
+  }
+
+ private:
+  struct Task {
+    std::function<void()> function;
+    std::chrono::steady_clock::time_point submitted;
+  };
+
+  // Must be called while `mutex_` is held.
+  void StartThread() {
+    threads_.emplace_back([this, i = threads_.size()] {
+      utils::ThreadSetName(fmt::format("Bolt exec {}", i + 1));
+      utils::SetBlockingObserver(this);
+      Work();
+    });
+  }
+
+  void Work() {
+    while (true) {
+      Task task;
+      {
+        auto guard = std::unique_lock{mutex_};
+        cv_.wait(guard, [this] {
+          return stopping_ || ((!queues_[0].empty() || !queues_[1].empty()) && running_ < pool_size_ + blocked_);
+        });
+        if (stopping_) return;
+        auto &queue = queues_[0].empty() ? queues_[1] : queues_[0];
+        task = std::move(queue.front());
+        queue.pop_front();
+        ++running_;
+      }
+      memgraph::metrics::DecrementCounter(memgraph::metrics::QueuedBoltExecutions);
+      memgraph::metrics::Measure(memgraph::metrics::BoltExecutionWaitLatency_us,
+                                 std::chrono::duration_cast<std::chrono::microseconds>(
+                                     std::chrono::steady_clock::now() - task.submitted)
+                                     .count());
+      task.function();
+      {
+        auto guard = std::lock_guard{mutex_};
+        --running_;
+      }
+      // A thread may wait only because the executions which were running
+      // reached the limit.
+      cv_.notify_one();
+    }
+  }
+
+  size_t pool_size_;
+  std::chrono::milliseconds long_execution_threshold_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  // Tasks of short and of long executions.
+  std::array<std::deque<Task>, 2> queues_;
+  bool stopping_{false};
+  // Executions which are running and the ones of them waiting on I/O.
+  size_t running_{0};
+  size_t blocked_{0};
+  std::vector<std::jthread> threads_;
+};
 }  // namespace memgraph::communication::v2
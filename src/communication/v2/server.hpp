@@ -12,6 +12,7 @@
 #pragma once
 
 #include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <iosfwd>
 #include <memory>
@@ -56,6 +57,10 @@ using ServerEndpoint = boost::asio::ip::tcp::endpoint;
  *
  * Current Server architecture:
  * incoming connection -> server -> listener -> session
+ *
+ * If execution workers are given, the sessions execute the received messages
+ * on a separate `ExecutionThreadPool` instead, and the io_context threads only
+ * handle the sockets.
 
  *
  * @tparam TSession the server can handle different Sessions, each session
@@ -79,11 +84,13 @@ class Server final {
    */
   Server(ServerEndpoint &endpoint, TSessionContext *session_context, ServerContext *server_context,
          int inactivity_timeout_sec, std::string_view service_name,
-         size_t workers_count = std::thread::hardware_concurrency());
+         size_t workers_count = std::thread::hardware_concurrency(), size_t execution_workers_count = 0,
+         std::chrono::milliseconds long_execution_threshold = std::chrono::milliseconds{0});
 
   Server(handle_errors /*_*/, ServerEndpoint &endpoint, TSessionContext *session_context, ServerContext *server_context,
          int inactivity_timeout_sec, std::string_view service_name,
-         size_t workers_count = std::thread::hardware_concurrency());
+         size_t workers_count = std::thread::hardware_concurrency(), size_t execution_workers_count = 0,
+         std::chrono::milliseconds long_execution_threshold = std::chrono::milliseconds{0});
 
   ~Server();
 
@@ -98,10 +105,14 @@ class Server final {
 
   void Shutdown() {
     context_thread_pool_.Shutdown();
+    if (execution_pool_) execution_pool_->Shutdown();
     spdlog::info("{} shutting down...", service_name_);
   }
 
-  void AwaitShutdown() { context_thread_pool_.AwaitShutdown(); }
+  void AwaitShutdown() {
+    context_thread_pool_.AwaitShutdown();
+    if (execution_pool_) execution_pool_->AwaitShutdown();
+  }
 
   bool IsRunning() const noexcept;
 
@@ -110,9 +121,17 @@ class Server final {
   std::string service_name_;
 
   IOContextThreadPool context_thread_pool_;
+  // Executes the messages of the sessions, if there are execution workers.
+  std::unique_ptr<ExecutionThreadPool> execution_pool_;
   std::shared_ptr<Listener<TSession, TSessionContext>> listener_;
 };
 
+inline std::unique_ptr<ExecutionThreadPool> MakeExecutionPool(size_t execution_workers_count,
+                                                              std::chrono::milliseconds long_execution_threshold) {
+  if (execution_workers_count == 0) return nullptr;
+  return std::make_unique<ExecutionThreadPool>(execution_workers_count, long_execution_threshold);
+}
+
 template <typename TSession, typename TSessionContext>
 Server<TSession, TSessionContext>::~Server() {
   MG_ASSERT(!IsRunning(), "Server wasn't shutdown properly");
@@ -121,25 +140,30 @@ Server<TSession, TSessionContext>::~Server() {
 template <typename TSession, typename TSessionContext>
 Server<TSession, TSessionContext>::Server(ServerEndpoint &endpoint, TSessionContext *session_context,
                                           ServerContext *server_context, const int inactivity_timeout_sec,
-                                          const std::string_view service_name, size_t workers_count)
+                                          const std::string_view service_name, size_t workers_count,
+                                          size_t execution_workers_count,
+                                          std::chrono::milliseconds long_execution_threshold)
     : endpoint_{endpoint},
       service_name_{service_name},
       context_thread_pool_{workers_count},
+      execution_pool_{MakeExecutionPool(execution_workers_count, long_execution_threshold)},
       listener_{Listener<TSession, TSessionContext>::Create(context_thread_pool_.GetIOContext(), session_context,
                                                             server_context, endpoint_, service_name_,
-                                                            inactivity_timeout_sec)} {}
+                                                            inactivity_timeout_sec, execution_pool_.get())} {}
 
 template <typename TSession, typename TSessionContext>
 Server<TSession, TSessionContext>::Server(handle_errors /*_*/, ServerEndpoint &endpoint,
                                           TSessionContext *session_context, ServerContext *server_context,
                                           const int inactivity_timeout_sec, const std::string_view service_name,
-                                          size_t workers_count)
+                                          size_t workers_count, size_t execution_workers_count,
+                                          std::chrono::milliseconds long_execution_threshold)
     : endpoint_{endpoint},
       service_name_{service_name},
       context_thread_pool_{workers_count},
+      execution_pool_{MakeExecutionPool(execution_workers_count, long_execution_threshold)},
       listener_{Listener<TSession, TSessionContext>::Create(assert_create_t, context_thread_pool_.GetIOContext(),
                                                             session_context, server_context, endpoint_, service_name_,
-                                                            inactivity_timeout_sec)} {}
+                                                            inactivity_timeout_sec, execution_pool_.get())} {}
 
 template <typename TSession, typename TSessionContext>
 bool Server<TSession, TSessionContext>::Start() {
@@ -152,6 +176,7 @@ bool Server<TSession, TSessionContext>::Start() {
   spdlog::info("{} server is fully armed and operational", service_name_);
   spdlog::info("{} listening on {}", service_name_, endpoint_);
   context_thread_pool_.Run();
+  if (execution_pool_) execution_pool_->Run();
 
   return true;
 }
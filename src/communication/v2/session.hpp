@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -28,6 +29,7 @@
 #include <boost/asio/bind_executor.hpp>
 #include <boost/asio/buffer.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/post.hpp>
 #include <boost/asio/read.hpp>
 #include <boost/asio/socket_base.hpp>
 #include <boost/asio/ssl/stream.hpp>
@@ -47,8 +49,10 @@
 #include "communication/context.hpp"
 #include "communication/exceptions.hpp"
 #include "communication/fmt.hpp"
+#include "communication/v2/pool.hpp"
 #include "dbms/global.hpp"
 #include "utils/event_counter.hpp"
+#include "utils/event_histogram.hpp"
 #include "utils/logging.hpp"
 #include "utils/on_scope_exit.hpp"
 #include "utils/variant_helpers.hpp"
@@ -58,6 +62,7 @@ extern const Event ActiveSessions;
 extern const Event ActiveTCPSessions;
 extern const Event ActiveSSLSessions;
 extern const Event ActiveWebSocketSessions;
+extern const Event BoltBytesPerWrite;
 }  // namespace memgraph::metrics
 
 namespace memgraph::communication::v2 {
@@ -323,6 +328,7 @@ class Session final : public std::enable_shared_from_this<Session<TSession, TSes
                                 shared_this->OnError(ec);
                                 return false;
                               }
+                              memgraph::metrics::Measure(memgraph::metrics::BoltBytesPerWrite, sent);
                               data += sent;
                               len -= sent;
                             }
@@ -336,6 +342,7 @@ class Session final : public std::enable_shared_from_this<Session<TSession, TSes
                                 shared_this->OnError(ec);
                                 return false;
                               }
+                              memgraph::metrics::Measure(memgraph::metrics::BoltBytesPerWrite, sent);
                               data += sent;
                               len -= sent;
                             }
@@ -352,7 +359,7 @@ class Session final : public std::enable_shared_from_this<Session<TSession, TSes
  private:
   explicit Session(tcp::socket &&socket, TSessionContext *session_context, ServerContext &server_context,
                    tcp::endpoint endpoint, const std::chrono::seconds inactivity_timeout_sec,
-                   std::string_view service_name)
+                   std::string_view service_name, ExecutionThreadPool *execution_pool = nullptr)
       : socket_(CreateSocket(std::move(socket), server_context)),
         strand_{boost::asio::make_strand(GetExecutor())},
         output_stream_([this](const uint8_t *data, size_t len, bool have_more) { return Write(data, len, have_more); }),
@@ -366,7 +373,8 @@ class Session final : public std::enable_shared_from_this<Session<TSession, TSes
         remote_endpoint_{GetRemoteEndpoint()},
         service_name_{service_name},
         timeout_seconds_(inactivity_timeout_sec),
-        timeout_timer_(GetExecutor()) {
+        timeout_timer_(GetExecutor()),
+        execution_pool_{execution_pool} {
     ExecuteForSocket([](auto &&socket) {
       socket.lowest_layer().set_option(tcp::no_delay(true));                         // enable PSH
       socket.lowest_layer().set_option(boost::asio::socket_base::keep_alive(true));  // enable SO_KEEPALIVE
@@ -429,16 +437,46 @@ class Session final : public std::enable_shared_from_this<Session<TSession, TSes
       }
     }
 
+    if (!execution_pool_) {
+      return OnExecuted(Execute());
+    }
+    // The session doesn't time out while its message is executed. The result
+    // is handled back on the strand, which also issues the next read.
+    timeout_timer_.expires_at(boost::asio::steady_timer::time_point::max());
+    execution_pool_->Submit(
+        [shared_this = shared_from_this()] {
+          const auto executed = shared_this->Execute();
+          boost::asio::post(shared_this->strand_, [shared_this, executed] { shared_this->OnExecuted(executed); });
+        },
+        long_execution_);
+  }
+
+  // Executes the received data, returns false if the session has to be shut
+  // down.
+  bool Execute() {
+    const auto start = std::chrono::steady_clock::now();
+    utils::OnScopeExit measure_execution([this, start] {
+      if (execution_pool_) {
+        long_execution_ = std::chrono::steady_clock::now() - start > execution_pool_->LongExecutionThreshold();
+      }
+    });
     try {
       session_.Execute();
-      DoRead();
+      return true;
     } catch (const SessionClosedException &e) {
       spdlog::info("{} client {} closed the connection.", service_name_, remote_endpoint_);
-      DoShutdown();
     } catch (const std::exception &e) {
       spdlog::error("Exception was thrown while processing event in {} session associated with {}", service_name_,
                     remote_endpoint_);
       spdlog::debug("Exception message: {}", e.what());
+    }
+    return false;
+  }
+
+  void OnExecuted(const bool executed) {
+    if (executed) {
+      DoRead();
+    } else {
       DoShutdown();
     }
   }
@@ -561,7 +599,13 @@ class Session final : public std::enable_shared_from_this<Session<TSession, TSes
   std::string_view service_name_;
   std::chrono::seconds timeout_seconds_;
   boost::asio::steady_timer timeout_timer_;
-  bool execution_active_{false};
+  // Executes the received messages if set, otherwise they are executed on the
+  // strand.
+  ExecutionThreadPool *execution_pool_;
+  // Whether the previous execution took longer than the threshold of the
+  // execution pool.
+  bool long_execution_{false};
+  std::atomic<bool> execution_active_{false};
   bool has_received_msg_{false};
 };
 }  // namespace memgraph::communication::v2
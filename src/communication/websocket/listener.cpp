@@ -21,10 +21,10 @@ void LogError(boost::beast::error_code ec, const std::string_view what) {
 
 void Listener::Run() { DoAccept(); }
 
-void Listener::WriteToAll(std::shared_ptr<std::string> message) {
+void Listener::WriteToAll(const Session::MessageBatch &messages, const size_t dropped) {
   auto sessions_ptr = sessions_.Lock();
   for (auto &session : *sessions_ptr) {
-    session->Write(message);
+    session->Write(messages, dropped);
   }
 }
 
@@ -13,10 +13,12 @@
 
 #include <list>
 #include <memory>
+#include <utility>
 
 #include <spdlog/spdlog.h>
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/post.hpp>
 #include <boost/asio/strand.hpp>
 #include <boost/beast/core.hpp>
 
@@ -37,9 +39,16 @@ class Listener : public std::enable_shared_from_this<Listener> {
 
   // Start accepting incoming connections
   void Run();
-  void WriteToAll(std::shared_ptr<std::string> message);
+  // Must be called on the thread of the server, see Session::Write.
+  void WriteToAll(const Session::MessageBatch &messages, size_t dropped);
   tcp::endpoint GetEndpoint() const;
 
+  // Runs the handler on the thread of the server.
+  template <typename F>
+  void Post(F &&handler) {
+    boost::asio::post(ioc_, std::forward<F>(handler));
+  }
+
   bool HasErrorHappened() const { return error_happened_; }
 
  private:
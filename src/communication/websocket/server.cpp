@@ -82,7 +82,26 @@ void Server::LoggingSink::sink_it_(const spdlog::details::log_msg &msg) {
   using memory_buf_t = fmt::basic_memory_buffer<char, 250>;
   memory_buf_t formatted;
   base_sink<std::mutex>::formatter_->format(msg, formatted);
-  listener->WriteToAll(std::make_shared<std::string>(formatted.data(), formatted.size()));
+  if (!messages_.try_emplace(std::make_shared<std::string>(formatted.data(), formatted.size()))) {
+    dropped_.fetch_add(1, std::memory_order_relaxed);
+  }
+  // The messages logged while a send is scheduled go out with it.
+  if (!send_scheduled_.exchange(true, std::memory_order_acq_rel)) {
+    listener->Post([weak_this = weak_from_this()] {
+      if (const auto sink = weak_this.lock()) sink->SendBuffered();
+    });
+  }
+}
+
+void Server::LoggingSink::SendBuffered() {
+  // Cleared before taking the messages, so a message logged meanwhile either
+  // gets taken now or schedules another send.
+  send_scheduled_.store(false, std::memory_order_release);
+  auto messages = std::make_shared<std::vector<std::shared_ptr<std::string>>>();
+  messages_.pop_many(*messages, kBufferSize);
+  const auto dropped = dropped_.exchange(0, std::memory_order_relaxed);
+  if (messages->empty() && dropped == 0) return;
+  if (const auto listener = listener_.lock()) listener->WriteToAll(messages, dropped);
 }
 
 std::shared_ptr<Server::LoggingSink> Server::GetLoggingSink() {
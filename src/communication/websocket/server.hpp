@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
 #include <thread>
 
 #include <spdlog/sinks/base_sink.h>
@@ -19,6 +21,7 @@
 #include <utility>
 
 #include "communication/websocket/listener.hpp"
+#include "data_structures/ring_buffer.hpp"
 #include "io/network/endpoint.hpp"
 
 namespace memgraph::communication::websocket {
@@ -47,16 +50,28 @@ class Server final {
 
   bool HasErrorHappened() const;
 
-  class LoggingSink : public spdlog::sinks::base_sink<std::mutex> {
+  // Buffers the log messages for the thread of the server, which sends them
+  // to the sessions in batches. The logging threads never wait for the
+  // sessions, the messages which don't fit in the buffer are dropped.
+  class LoggingSink : public spdlog::sinks::base_sink<std::mutex>, public std::enable_shared_from_this<LoggingSink> {
    public:
-    explicit LoggingSink(std::weak_ptr<Listener> listener) : listener_(std::move(listener)) {}
+    explicit LoggingSink(std::weak_ptr<Listener> listener) : listener_(std::move(listener)), messages_(kBufferSize) {}
 
    private:
+    static constexpr int kBufferSize = 4096;
+
     void sink_it_(const spdlog::details::log_msg &msg) override;
 
     void flush_() override {}
 
+    // Sends the buffered messages to the sessions, runs on the thread of the
+    // server.
+    void SendBuffered();
+
     std::weak_ptr<Listener> listener_;
+    RingBuffer<std::shared_ptr<std::string>> messages_;
+    std::atomic<size_t> dropped_{0};
+    std::atomic<bool> send_scheduled_{false};
   };
 
   std::shared_ptr<LoggingSink> GetLoggingSink();
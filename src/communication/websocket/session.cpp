@@ -11,6 +11,7 @@
 
 #include "communication/websocket/session.hpp"
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <string>
@@ -31,6 +32,12 @@ namespace {
 void LogError(const boost::beast::error_code ec, const std::string_view what) {
   spdlog::warn("Websocket session failed on {}: {}", what, ec.message());
 }
+
+// Formatted the same as the log messages of the logging sink.
+std::string DroppedMessagesNotice(const size_t dropped) {
+  return fmt::format("{{\"event\": \"log\", \"level\": \"warning\", \"message\": \"{} log messages were dropped\"}}\n",
+                     dropped);
+}
 }  // namespace
 
 std::variant<Session::PlainWebSocket, Session::SSLWebSocket> Session::CreateWebSocket(tcp::socket &&socket,
@@ -88,22 +95,33 @@ bool Session::Run() {
   return true;
 }
 
-void Session::Write(std::shared_ptr<std::string> message) {
-  boost::asio::dispatch(strand_, [message = std::move(message), shared_this = shared_from_this()]() mutable {
+void Session::Write(MessageBatch messages, const size_t dropped) {
+  boost::asio::dispatch(strand_, [messages = std::move(messages), dropped, shared_this = shared_from_this()] {
     if (!shared_this->connected_.load(std::memory_order_relaxed)) {
       return;
     }
     if (!shared_this->IsAuthenticated()) {
       return;
     }
-    shared_this->messages_.push_back(std::move(message));
-    if (shared_this->messages_.size() > 1) {
-      return;
-    }
-    shared_this->DoWrite();
+    shared_this->Enqueue(*messages, dropped);
   });
 }
 
+void Session::Enqueue(const std::vector<std::shared_ptr<std::string>> &messages, const size_t dropped) {
+  const auto writing = !messages_.empty();
+  dropped_ += dropped;
+  if (dropped_ > 0 && messages_.size() < kMaxQueuedMessages) {
+    messages_.push_back(std::make_shared<std::string>(DroppedMessagesNotice(dropped_)));
+    dropped_ = 0;
+  }
+  const auto queued = std::min(messages.size(), kMaxQueuedMessages - std::min(messages_.size(), kMaxQueuedMessages));
+  messages_.insert(messages_.end(), messages.begin(), messages.begin() + static_cast<std::ptrdiff_t>(queued));
+  dropped_ += messages.size() - queued;
+  if (!writing && !messages_.empty()) {
+    DoWrite();
+  }
+}
+
 bool Session::IsConnected() const { return connected_.load(std::memory_order_relaxed); }
 
 void Session::DoWrite() {
@@ -15,6 +15,7 @@
 #include <memory>
 #include <optional>
 #include <variant>
+#include <vector>
 
 #include <boost/asio/dispatch.hpp>
 #include <boost/asio/ip/tcp.hpp>
@@ -40,8 +41,14 @@ class Session : public std::enable_shared_from_this<Session> {
     return std::shared_ptr<Session>{new Session{std::forward<Args>(args)...}};
   }
 
+  using MessageBatch = std::shared_ptr<const std::vector<std::shared_ptr<std::string>>>;
+
   bool Run();
-  void Write(std::shared_ptr<std::string> message);
+  // Queues the messages for the client. A client which doesn't keep up loses
+  // the messages which don't fit in its queue and is told how many it lost
+  // once there is room again. The `dropped` messages were lost before they
+  // got to the session.
+  void Write(MessageBatch messages, size_t dropped);
   bool IsConnected() const;
 
  private:
@@ -50,6 +57,7 @@ class Session : public std::enable_shared_from_this<Session> {
 
   explicit Session(tcp::socket &&socket, ServerContext &context, AuthenticationInterface &auth);
 
+  void Enqueue(const std::vector<std::shared_ptr<std::string>> &messages, size_t dropped);
   void DoWrite();
   void OnWrite(boost::beast::error_code ec, size_t bytes_transferred);
 
@@ -79,7 +87,11 @@ class Session : public std::enable_shared_from_this<Session> {
   std::optional<std::reference_wrapper<boost::asio::ssl::context>> ssl_context_;
   std::variant<PlainWebSocket, SSLWebSocket> ws_;
   boost::beast::flat_buffer buffer_;
+  static constexpr size_t kMaxQueuedMessages = 1024;
+
   std::deque<std::shared_ptr<std::string>> messages_;
+  // Messages lost since the last notice about them.
+  size_t dropped_{0};
   boost::asio::strand<PlainWebSocket::executor_type> strand_;
   std::atomic<bool> connected_{false};
   bool authenticated_{false};
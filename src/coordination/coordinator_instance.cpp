@@ -747,15 +747,20 @@ auto CoordinatorInstance::TryFailover() -> void {
 
   auto const new_main_uuid = utils::UUID{};
 
-  auto const failed_to_swap = [this, &new_main_uuid](ReplicationInstanceConnector &instance) {
-    spdlog::trace("Sending swap uuid to instance {} and updating raft log", instance.InstanceName());
-    return !instance.SendSwapAndUpdateUUID(new_main_uuid) ||
-           !raft_state_->AppendUpdateUUIDForInstanceLog(instance.InstanceName(), new_main_uuid);
+  auto swapped_instances = std::vector<std::string>{};
+  auto const failed_to_swap = [&new_main_uuid, &swapped_instances](ReplicationInstanceConnector &instance) {
+    spdlog::trace("Sending swap uuid to instance {}", instance.InstanceName());
+    if (!instance.SendSwapAndUpdateUUID(new_main_uuid)) return true;
+    swapped_instances.emplace_back(instance.InstanceName());
+    return false;
   };
 
   // If for some replicas swap fails, for others on successful ping we will revert back on next change
   // or we will do failover first again and then it will be consistent again
-  if (std::ranges::any_of(alive_replicas | ranges::views::filter(is_not_new_main), failed_to_swap)) {
+  auto const swap_failed = std::ranges::any_of(alive_replicas | ranges::views::filter(is_not_new_main), failed_to_swap);
+  // The UUIDs of all swapped instances are updated in one raft request, so the failover time doesn't grow with a
+  // round of the raft log per instance.
+  if (!raft_state_->AppendUpdateUUIDForInstancesLog(swapped_instances, new_main_uuid) || swap_failed) {
     spdlog::error("Aborting failover. Failed to swap uuid for all alive instances.");
     return;
   }
@@ -770,18 +775,8 @@ auto CoordinatorInstance::TryFailover() -> void {
     return;
   }
 
-  if (!raft_state_->AppendUpdateUUIDForNewMainLog(new_main_uuid)) {
-    return;
-  }
-
-  auto const new_main_instance_name = new_main.InstanceName();
-
-  if (!raft_state_->AppendSetInstanceAsMainLog(new_main_instance_name, new_main_uuid)) {
-    return;
-  }
-
-  if (!raft_state_->AppendCloseLock()) {
-    spdlog::error("Aborting failover as we failed to close lock on action.");
+  if (!raft_state_->AppendNewMainAndCloseLockLog(new_main.InstanceName(), new_main_uuid)) {
+    spdlog::error("Aborting failover as we failed to promote the new main and close lock on action.");
     return;
   }
 
@@ -849,12 +844,16 @@ auto CoordinatorInstance::SetReplicationInstanceToMain(std::string_view instance
 
   auto const new_main_uuid = utils::UUID{};
 
-  auto const failed_to_swap = [this, &new_main_uuid](ReplicationInstanceConnector &instance) {
-    return !instance.SendSwapAndUpdateUUID(new_main_uuid) ||
-           !raft_state_->AppendUpdateUUIDForInstanceLog(instance.InstanceName(), new_main_uuid);
+  auto swapped_instances = std::vector<std::string>{};
+  auto const failed_to_swap = [&new_main_uuid, &swapped_instances](ReplicationInstanceConnector &instance) {
+    if (!instance.SendSwapAndUpdateUUID(new_main_uuid)) return true;
+    swapped_instances.emplace_back(instance.InstanceName());
+    return false;
   };
 
-  if (std::ranges::any_of(repl_instances_ | ranges::views::filter(is_not_new_main), failed_to_swap)) {
+  auto const swap_failed =
+      std::ranges::any_of(repl_instances_ | ranges::views::filter(is_not_new_main), failed_to_swap);
+  if (!raft_state_->AppendUpdateUUIDForInstancesLog(swapped_instances, new_main_uuid) || swap_failed) {
     spdlog::error("Failed to swap uuid for all currently alive instances.");
     return SetInstanceToMainCoordinatorStatus::SWAP_UUID_FAILED;
   }
@@ -875,22 +874,12 @@ auto CoordinatorInstance::SetReplicationInstanceToMain(std::string_view instance
 
   spdlog::trace("Instance {} promoted to main.", new_main->InstanceName());
 
-  if (!raft_state_->AppendUpdateUUIDForNewMainLog(new_main_uuid)) {
-    return SetInstanceToMainCoordinatorStatus::RAFT_LOG_ERROR;
-  }
-
-  spdlog::trace("Updated UUID for new main");
-
-  if (!raft_state_->AppendSetInstanceAsMainLog(instance_name, new_main_uuid)) {
+  if (!raft_state_->AppendNewMainAndCloseLockLog(instance_name, new_main_uuid)) {
+    spdlog::error("Aborting failover as we failed to promote the new main and close lock on action.");
     return SetInstanceToMainCoordinatorStatus::RAFT_LOG_ERROR;
   }
 
   spdlog::trace("Instance {} promoted to main on leader", instance_name);
-
-  if (!raft_state_->AppendCloseLock()) {
-    spdlog::error("Aborting failover as we failed to close lock on action.");
-    return SetInstanceToMainCoordinatorStatus::FAILED_TO_CLOSE_LOCK;
-  }
   MG_ASSERT(!raft_state_->IsLockOpened(), "After setting replication instance we need to be in healthy state.");
   if (!new_main->EnableWritingOnMain()) {
     return SetInstanceToMainCoordinatorStatus::ENABLE_WRITING_FAILED;
@@ -109,6 +109,7 @@ void CoordinatorStateMachine::UpdateStateMachineFromSnapshotDurability() {
     return;
   }
   cluster_state_ = snapshots_[last_committed_idx_]->cluster_state_;
+  cluster_state_version_.fetch_add(1, std::memory_order_acq_rel);
   logger_.Log(nuraft_log_level::TRACE,
               fmt::format("Restored cluster state from snapshot with id: {}", last_committed_idx_));
 }
@@ -239,6 +240,7 @@ auto CoordinatorStateMachine::commit(ulong const log_idx, buffer &data) -> ptr<b
   logger_.Log(nuraft_log_level::TRACE, fmt::format("Commit: log_idx={}, data.size()={}", log_idx, data.size()));
   auto const &[parsed_data, log_action] = DecodeLog(data);
   cluster_state_.DoAction(parsed_data, log_action);
+  cluster_state_version_.fetch_add(1, std::memory_order_acq_rel);
   if (durability_) {
     durability_->Put(kLastCommitedIdx, std::to_string(log_idx));
   }
@@ -339,6 +341,7 @@ auto CoordinatorStateMachine::apply_snapshot(snapshot &s) -> bool {
   }
 
   cluster_state_ = entry->second->cluster_state_;
+  cluster_state_version_.fetch_add(1, std::memory_order_acq_rel);
   return true;
 }
 
@@ -378,25 +381,28 @@ auto CoordinatorStateMachine::CreateSnapshotInternal(ptr<snapshot> const &snapsh
   logger_.Log(nuraft_log_level::TRACE,
               fmt::format("Create snapshot internal, last_log_idx={}", snapshot->get_last_log_idx()));
 
+  auto const snapshot_idx = snapshot->get_last_log_idx();
   auto ctx = cs_new<SnapshotCtx>(snapshot, cluster_state_);
   if (durability_) {
+    // The new snapshot is stored and the snapshots it makes outdated are deleted in one write batch.
+    auto outdated_snapshot_keys = std::vector<std::string>{};
+    auto const snapshots_after_store = snapshots_.size() + (snapshots_.contains(snapshot_idx) ? 0 : 1);
+    auto outdated_it = snapshots_.begin();
+    for (auto count = snapshots_after_store; count > MAX_SNAPSHOTS; --count, ++outdated_it) {
+      outdated_snapshot_keys.emplace_back(fmt::format("{}{}", kSnapshotIdPrefix, outdated_it->first));
+    }
+
     nlohmann::json json;
     to_json(json, *ctx);
-    auto const ok = durability_->Put(fmt::format("{}{}", kSnapshotIdPrefix, snapshot->get_last_log_idx()), json.dump());
+    auto const ok = durability_->PutAndDeleteMultiple(
+        {{fmt::format("{}{}", kSnapshotIdPrefix, snapshot_idx), json.dump()}}, outdated_snapshot_keys);
     if (!ok) {
       throw StoreSnapshotToDiskException("Failed to store snapshot to disk.");
     }
   }
-  snapshots_[snapshot->get_last_log_idx()] = ctx;
+  snapshots_[snapshot_idx] = ctx;
 
   while (snapshots_.size() > MAX_SNAPSHOTS) {
-    auto snapshot_current = snapshots_.begin()->first;
-    if (durability_) {
-      auto const ok = durability_->Delete("snapshot_id_" + std::to_string(snapshot_current));
-      if (!ok) {
-        throw DeleteSnapshotFromDiskException("Failed to delete snapshot with id {} from disk.", snapshot_current);
-      }
-    }
     snapshots_.erase(snapshots_.begin());
   }
 }
@@ -0,0 +1,67 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#ifdef MG_ENTERPRISE
+
+#include "coordination/failure_detector.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace memgraph::coordination {
+
+PhiAccrualFailureDetector::PhiAccrualFailureDetector(double threshold, std::chrono::milliseconds acceptable_pause,
+                                                     std::chrono::milliseconds min_std_deviation,
+                                                     std::size_t max_samples)
+    : threshold_{threshold},
+      acceptable_pause_ms_{static_cast<double>(acceptable_pause.count())},
+      min_std_deviation_ms_{static_cast<double>(min_std_deviation.count())},
+      max_samples_{std::max<std::size_t>(max_samples, 1)} {}
+
+void PhiAccrualFailureDetector::Heartbeat(Clock::time_point now) {
+  if (last_heartbeat_) {
+    auto const interval_ms = std::chrono::duration<double, std::milli>(now - *last_heartbeat_).count();
+    if (intervals_ms_.size() == max_samples_) {
+      auto const oldest = intervals_ms_.front();
+      intervals_sum_ -= oldest;
+      intervals_squared_sum_ -= oldest * oldest;
+      intervals_ms_.pop_front();
+    }
+    intervals_ms_.push_back(interval_ms);
+    intervals_sum_ += interval_ms;
+    intervals_squared_sum_ += interval_ms * interval_ms;
+  }
+  last_heartbeat_ = now;
+}
+
+auto PhiAccrualFailureDetector::Phi(Clock::time_point now) const -> double {
+  if (!last_heartbeat_ || intervals_ms_.empty()) return 0.0;
+
+  auto const samples = static_cast<double>(intervals_ms_.size());
+  auto const mean = intervals_sum_ / samples;
+  auto const variance = std::max(intervals_squared_sum_ / samples - mean * mean, 0.0);
+  auto const std_deviation = std::max(std::sqrt(variance), min_std_deviation_ms_);
+
+  auto const elapsed_ms = std::chrono::duration<double, std::milli>(now - *last_heartbeat_).count();
+  // Logistic approximation of the cumulative normal distribution, which stays accurate in the far tail.
+  auto const y = (elapsed_ms - (mean + acceptable_pause_ms_)) / std_deviation;
+  auto const e = std::exp(-y * (1.5976 + 0.070566 * y * y));
+  if (y > 0) {
+    return -std::log10(e / (1.0 + e));
+  }
+  return -std::log10(1.0 - 1.0 / (1.0 + e));
+}
+
+auto PhiAccrualFailureDetector::IsAvailable(Clock::time_point now) const -> bool { return Phi(now) < threshold_; }
+
+}  // namespace memgraph::coordination
+#endif
@@ -16,6 +16,7 @@
 #include "coordination/coordinator_communication_config.hpp"
 #include "coordination/coordinator_rpc.hpp"
 #include "coordination/data_instance_management_server.hpp"
+#include "flags/replication.hpp"
 #include "replication_handler/replication_handler.hpp"
 #include "slk/streams.hpp"
 
@@ -55,7 +56,8 @@ class DataInstanceManagementServerHandlers {
     auto const converter = [&config](const auto &repl_info_config) {
       return replication::ReplicationClientConfig{.name = repl_info_config.instance_name,
                                                   .mode = repl_info_config.replication_mode,
-                                                  .repl_server_endpoint = config.replication_server};
+                                                  .repl_server_endpoint = config.replication_server,
+                                                  .compression = FLAGS_replication_compression};
     };
 
     auto instance_client = replication_handler.RegisterReplica(converter(config));
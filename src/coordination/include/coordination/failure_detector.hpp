@@ -0,0 +1,59 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#pragma once
+
+#ifdef MG_ENTERPRISE
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <optional>
+
+namespace memgraph::coordination {
+
+// Phi accrual failure detector. It keeps the intervals between the last successful heartbeats of an instance and
+// estimates how likely it is that the next heartbeat is still coming, given the time since the last one. The
+// suspicion level phi is -log10 of that probability: with a threshold of 8, an instance is considered down when the
+// chance that it is only slow drops below 1e-8. Instances with a steady heartbeat are therefore detected as down
+// sooner than with a fixed timeout, while a jittery network widens the estimate instead of causing false positives.
+class PhiAccrualFailureDetector {
+ public:
+  using Clock = std::chrono::system_clock;
+
+  // `acceptable_pause` is added to the mean of the intervals, so a single missed heartbeat doesn't raise the
+  // suspicion. `min_std_deviation` keeps a very steady heartbeat from making the detector too sensitive.
+  explicit PhiAccrualFailureDetector(double threshold, std::chrono::milliseconds acceptable_pause,
+                                     std::chrono::milliseconds min_std_deviation = std::chrono::milliseconds{100},
+                                     std::size_t max_samples = 1000);
+
+  void Heartbeat(Clock::time_point now);
+
+  // Zero until at least one interval between heartbeats is known.
+  auto Phi(Clock::time_point now) const -> double;
+
+  auto IsAvailable(Clock::time_point now) const -> bool;
+
+ private:
+  double threshold_;
+  double acceptable_pause_ms_;
+  double min_std_deviation_ms_;
+  std::size_t max_samples_;
+
+  std::deque<double> intervals_ms_;
+  double intervals_sum_{0};
+  double intervals_squared_sum_{0};
+  std::optional<Clock::time_point> last_heartbeat_;
+};
+
+}  // namespace memgraph::coordination
+#endif
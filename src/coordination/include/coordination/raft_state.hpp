@@ -12,6 +12,8 @@
 #pragma once
 
 #ifdef MG_ENTERPRISE
+#include <atomic>
+#include <memory>
 #include <optional>
 
 #include <flags/replication.hpp>
@@ -78,6 +80,11 @@ class RaftState {
 
   auto AppendUpdateUUIDForNewMainLog(utils::UUID const &uuid) -> bool;
   auto AppendUpdateUUIDForInstanceLog(std::string_view instance_name, utils::UUID const &uuid) -> bool;
+  // Appends the logs of all instances in one request, so they are replicated and committed together.
+  auto AppendUpdateUUIDForInstancesLog(std::vector<std::string> const &instance_names, utils::UUID const &uuid)
+      -> bool;
+  // Appends the logs which finish a promotion of `instance_name` to main, and the closing of the lock, in one request.
+  auto AppendNewMainAndCloseLockLog(std::string_view instance_name, utils::UUID const &uuid) -> bool;
   auto AppendOpenLock() -> bool;
   auto AppendCloseLock() -> bool;
   auto AppendInstanceNeedsDemote(std::string_view) -> bool;
@@ -107,6 +114,17 @@ class RaftState {
   [[nodiscard]] auto GetCoordinatorToCoordinatorConfigs() const -> std::vector<CoordinatorToCoordinatorConfig>;
 
  private:
+  auto AppendLogs(std::vector<ptr<buffer>> const &logs, std::string_view request) -> bool;
+  auto ComputeRoutingTable() const -> RoutingTable;
+
+  // Routing table of the cluster state and coordinator configuration it was computed from. The versions are read
+  // before the table is computed, so a change racing with the computation only causes one more computation.
+  struct CachedRoutingTable {
+    uint64_t cluster_state_version;
+    uint64_t cluster_config_idx;
+    RoutingTable routing_table;
+  };
+
   int coordinator_port_;
   uint32_t coordinator_id_;
 
@@ -119,6 +137,8 @@ class RaftState {
   ptr<CoordinatorStateManager> state_manager_;
   BecomeLeaderCb become_leader_cb_;
   BecomeFollowerCb become_follower_cb_;
+
+  mutable std::atomic<std::shared_ptr<CachedRoutingTable const>> routing_table_cache_;
 };
 
 }  // namespace memgraph::coordination
@@ -75,6 +75,8 @@ class ReplicationInstanceClient {
 
   virtual auto InstanceGetUUIDFrequencySec() const -> std::chrono::seconds;
 
+  auto InstanceHealthCheckFrequencySec() const -> std::chrono::seconds;
+
   auto GetReplicationClientInfo() const -> ReplicationClientInfo;
 
   auto RpcClient() -> rpc::Client & { return rpc_client_; }
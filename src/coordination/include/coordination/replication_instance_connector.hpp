@@ -14,6 +14,7 @@
 #ifdef MG_ENTERPRISE
 
 #include "coordination/coordinator_exceptions.hpp"
+#include "coordination/failure_detector.hpp"
 #include "coordination/replication_instance_client.hpp"
 #include "replication_coordination_glue/role.hpp"
 
@@ -96,6 +97,9 @@ class ReplicationInstanceConnector {
   std::chrono::system_clock::time_point last_response_time_{};
   bool is_alive_{false};
   std::chrono::system_clock::time_point last_check_of_uuid_{};
+  // Considers the instance down sooner than the down timeout if its heartbeats stop, set when
+  // --instance-down-phi-threshold is.
+  std::optional<PhiAccrualFailureDetector> failure_detector_;
 
   HealthCheckInstanceCallback succ_cb_;
   HealthCheckInstanceCallback fail_cb_;
@@ -113,6 +113,9 @@ class CoordinatorStateMachine : public state_machine {
 
   auto TryGetCurrentMainName() const -> std::optional<std::string>;
 
+  // Changes whenever the cluster state changes, lets the readers cache what they derive from it.
+  auto ClusterStateVersion() const -> uint64_t { return cluster_state_version_.load(std::memory_order_acquire); }
+
  private:
   bool HandleMigration(LogStoreVersion stored_version);
 
@@ -120,6 +123,7 @@ class CoordinatorStateMachine : public state_machine {
 
   CoordinatorClusterState cluster_state_;
   std::atomic<uint64_t> last_committed_idx_{0};
+  std::atomic<uint64_t> cluster_state_version_{0};
 
   std::map<uint64_t, ptr<SnapshotCtx>> snapshots_;
   std::mutex snapshots_lock_;
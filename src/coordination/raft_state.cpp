@@ -516,6 +516,44 @@ auto RaftState::AppendUpdateUUIDForInstanceLog(std::string_view instance_name, c
   return true;
 }
 
+auto RaftState::AppendUpdateUUIDForInstancesLog(std::vector<std::string> const &instance_names,
+                                                utils::UUID const &uuid) -> bool {
+  if (instance_names.empty()) return true;
+  auto new_logs = std::vector<ptr<buffer>>{};
+  new_logs.reserve(instance_names.size());
+  for (auto const &instance_name : instance_names) {
+    new_logs.emplace_back(
+        CoordinatorStateMachine::SerializeUpdateUUIDForInstance({.instance_name = instance_name, .uuid = uuid}));
+  }
+  return AppendLogs(new_logs, fmt::format("updating UUID of {} instances", instance_names.size()));
+}
+
+auto RaftState::AppendNewMainAndCloseLockLog(std::string_view instance_name, utils::UUID const &uuid) -> bool {
+  auto const new_logs = std::vector<ptr<buffer>>{
+      CoordinatorStateMachine::SerializeUpdateUUIDForNewMain(uuid),
+      CoordinatorStateMachine::SerializeSetInstanceAsMain(
+          InstanceUUIDUpdate{.instance_name = std::string{instance_name}, .uuid = uuid}),
+      CoordinatorStateMachine::SerializeCloseLock()};
+  return AppendLogs(new_logs, fmt::format("promoting instance {} and closing lock", instance_name));
+}
+
+auto RaftState::AppendLogs(std::vector<ptr<buffer>> const &logs, std::string_view request) -> bool {
+  auto const res = raft_server_->append_entries(logs);
+  if (!res->get_accepted()) {
+    spdlog::error("Failed to accept request for {}. Most likely the reason is that the instance is not the leader.",
+                  request);
+    return false;
+  }
+  spdlog::trace("Request for {} accepted", request);
+
+  if (res->get_result_code() != nuraft::cmd_result_code::OK) {
+    spdlog::error("Failed request for {} with error code {}", request, static_cast<int>(res->get_result_code()));
+    return false;
+  }
+
+  return true;
+}
+
 auto RaftState::MainExists() const -> bool { return state_machine_->MainExists(); }
 
 auto RaftState::HasMainState(std::string_view instance_name) const -> bool {
@@ -547,6 +585,23 @@ auto RaftState::TryGetCurrentMainName() const -> std::optional<std::string> {
 }
 
 auto RaftState::GetRoutingTable() const -> RoutingTable {
+  auto const cluster_state_version = state_machine_->ClusterStateVersion();
+  auto const cluster_config_idx = raft_server_->get_config()->get_log_idx();
+  if (auto const cached = routing_table_cache_.load(std::memory_order_acquire);
+      cached && cached->cluster_state_version == cluster_state_version &&
+      cached->cluster_config_idx == cluster_config_idx) {
+    return cached->routing_table;
+  }
+
+  auto routing_table = ComputeRoutingTable();
+  routing_table_cache_.store(
+      std::make_shared<CachedRoutingTable const>(CachedRoutingTable{cluster_state_version, cluster_config_idx,
+                                                                    routing_table}),
+      std::memory_order_release);
+  return routing_table;
+}
+
+auto RaftState::ComputeRoutingTable() const -> RoutingTable {
   auto res = RoutingTable{};
 
   auto const repl_instance_to_bolt = [](ReplicationInstanceState const &instance) {
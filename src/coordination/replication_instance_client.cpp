@@ -17,11 +17,17 @@
 #include "coordination/coordinator_rpc.hpp"
 #include "replication_coordination_glue/common.hpp"
 #include "replication_coordination_glue/messages.hpp"
+#include "utils/event_histogram.hpp"
 #include "utils/result.hpp"
 #include "utils/uuid.hpp"
 
+#include <chrono>
 #include <string>
 
+namespace memgraph::metrics {
+extern const Event InstanceHeartbeatLatency_us;
+}  // namespace memgraph::metrics
+
 namespace memgraph::coordination {
 
 namespace {
@@ -62,6 +68,10 @@ auto ReplicationInstanceClient::InstanceGetUUIDFrequencySec() const -> std::chro
   return config_.instance_get_uuid_frequency_sec;
 }
 
+auto ReplicationInstanceClient::InstanceHealthCheckFrequencySec() const -> std::chrono::seconds {
+  return config_.instance_health_check_frequency_sec;
+}
+
 void ReplicationInstanceClient::StartFrequentCheck() {
   if (instance_checker_.IsRunning()) {
     return;
@@ -144,8 +154,12 @@ auto ReplicationInstanceClient::RegisterReplica(utils::UUID const &uuid,
 
 auto ReplicationInstanceClient::SendFrequentHeartbeat() const -> bool {
   try {
+    auto const start = std::chrono::steady_clock::now();
     auto stream{rpc_client_.Stream<memgraph::replication_coordination_glue::FrequentHeartbeatRpc>()};
     stream.AwaitResponse();
+    metrics::Measure(metrics::InstanceHeartbeatLatency_us,
+                     std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start)
+                         .count());
     return true;
   } catch (rpc::RpcFailedException const &) {
     return false;
@@ -13,28 +13,49 @@
 
 #include "coordination/replication_instance_connector.hpp"
 
+#include "flags/coordination.hpp"
 #include "replication_coordination_glue/handler.hpp"
+#include "utils/event_histogram.hpp"
 #include "utils/result.hpp"
 
 #include <chrono>
 #include <string>
 #include <utility>
 
+namespace memgraph::metrics {
+extern const Event InstanceDownDetectionLatency_us;
+}  // namespace memgraph::metrics
+
 namespace memgraph::coordination {
 
 ReplicationInstanceConnector::ReplicationInstanceConnector(std::unique_ptr<ReplicationInstanceClient> client,
                                                            HealthCheckInstanceCallback succ_instance_cb,
                                                            HealthCheckInstanceCallback fail_instance_cb)
-    : client_(std::move(client)), succ_cb_(succ_instance_cb), fail_cb_(fail_instance_cb) {}
+    : client_(std::move(client)), succ_cb_(succ_instance_cb), fail_cb_(fail_instance_cb) {
+  if (FLAGS_instance_down_phi_threshold > 0) {
+    // A single missed heartbeat doesn't raise the suspicion.
+    failure_detector_.emplace(FLAGS_instance_down_phi_threshold, client_->InstanceHealthCheckFrequencySec());
+  }
+}
 
 void ReplicationInstanceConnector::OnSuccessPing() {
   last_response_time_ = std::chrono::system_clock::now();
   is_alive_ = true;
+  if (failure_detector_) {
+    failure_detector_->Heartbeat(last_response_time_);
+  }
 }
 
 auto ReplicationInstanceConnector::OnFailPing() -> bool {
-  auto elapsed_time = std::chrono::system_clock::now() - last_response_time_;
-  is_alive_ = elapsed_time < client_->InstanceDownTimeoutSec();
+  auto const now = std::chrono::system_clock::now();
+  auto const elapsed_time = now - last_response_time_;
+  auto const was_alive = is_alive_;
+  is_alive_ = elapsed_time < client_->InstanceDownTimeoutSec() &&
+              (!failure_detector_ || failure_detector_->IsAvailable(now));
+  if (was_alive && !is_alive_) {
+    metrics::Measure(metrics::InstanceDownDetectionLatency_us,
+                     std::chrono::duration_cast<std::chrono::microseconds>(elapsed_time).count());
+  }
   return is_alive_;
 }
 
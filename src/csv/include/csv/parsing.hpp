@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <filesystem>
 #include <fstream>
+#include <memory>
 #include <optional>
 #include <string>
 #include <variant>
@@ -57,9 +58,21 @@ class StreamCsvSource {
   std::stringstream stream_;
 };
 
-class UrlCsvSource : public StreamCsvSource {
+/// Reads the file while it's being downloaded from a URL, so the start of the
+/// file is parsed while the rest of it is still being received.
+class UrlCsvSource {
  public:
+  /// @throw CsvReadException if the download fails before the file starts
   UrlCsvSource(char const *url);
+  std::istream &GetStream();
+
+  /// Must be called once the stream is read to its end.
+  /// @throw CsvReadException if the download failed before the end of the file
+  void CheckComplete() const;
+
+ private:
+  struct Download;
+  std::unique_ptr<Download, void (*)(Download *)> download_;
 };
 
 class CsvSource {
@@ -70,6 +83,10 @@ class CsvSource {
   CsvSource(UrlCsvSource source) : source_{std::move(source)} {}
   std::istream &GetStream();
 
+  /// Must be called once the stream is read to its end.
+  /// @throw CsvReadException if the stream ended because its source failed
+  void CheckComplete() const;
+
  private:
   std::variant<FileCsvSource, UrlCsvSource, StreamCsvSource> source_;
 };
@@ -90,6 +107,11 @@ class Reader {
     bool ignore_bad{false};
     std::optional<utils::pmr::string> delimiter{};
     std::optional<utils::pmr::string> quote{};
+    /// Threads which parse chunks of the file concurrently, the file is parsed
+    /// by the caller if there are less than 2. The rows are returned in the
+    /// order of the file either way, but the parallel ones are allocated
+    /// with `utils::NewDeleteResource()` instead of the given memory.
+    size_t parallel_workers{0};
   };
 
   using Row = utils::pmr::vector<utils::pmr::string>;
@@ -11,7 +11,15 @@
 
 #include "csv/parsing.hpp"
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <map>
+#include <mutex>
 #include <string_view>
+#include <thread>
+#include <utility>
 
 #include <boost/iostreams/filter/bzip2.hpp>
 #include <boost/iostreams/filter/gzip.hpp>
@@ -19,6 +27,7 @@
 #include <ctre/ctre.hpp>
 
 #include "requests/requests.hpp"
+#include "utils/blocking_section.hpp"
 #include "utils/file.hpp"
 #include "utils/on_scope_exit.hpp"
 #include "utils/string.hpp"
@@ -28,6 +37,434 @@ using PlainStream = boost::iostreams::filtering_istream;
 namespace memgraph::csv {
 
 using ParseError = Reader::ParseError;
+using ParsingResult = Reader::ParsingResult;
+
+namespace {
+enum class CsvParserState : uint8_t { INITIAL_FIELD, NEXT_FIELD, QUOTING, EXPECT_DELIMITER, DONE };
+
+/// Parses the record which starts at the next line returned by @p next_line.
+/// A record spans several lines if a quoted field contains line feeds. Without
+/// @p kBuildRow the fields aren't stored, which is used to find where the
+/// records end. @p line_count is increased by the number of read lines.
+template <bool kBuildRow, class TNextLine>
+ParsingResult ParseRecord(TNextLine &next_line, const Reader::Config &config, uint64_t &line_count,
+                          uint16_t number_of_columns, uint64_t &estimated_number_of_columns,
+                          utils::MemoryResource *mem) {
+  const auto &delimiter = *config.delimiter;
+  const auto &quote = *config.quote;
+
+  utils::pmr::vector<utils::pmr::string> row(mem);
+  if constexpr (kBuildRow) {
+    if (number_of_columns != 0) {
+      row.reserve(number_of_columns);
+    } else if (estimated_number_of_columns != 0) {
+      row.reserve(estimated_number_of_columns);
+    }
+  }
+
+  utils::pmr::string column(mem);
+
+  auto state = CsvParserState::INITIAL_FIELD;
+
+  do {
+    std::optional<std::string_view> line = next_line();
+    if (!line) {
+      // The whole file was processed.
+      break;
+    }
+    ++line_count;
+
+    std::string_view line_string_view = *line;
+
+    // remove '\r' from the end in case we have dos file format
+    if (!line_string_view.empty() && line_string_view.back() == '\r') {
+      line_string_view.remove_suffix(1);
+    }
+
+    while (state != CsvParserState::DONE && !line_string_view.empty()) {
+      const auto c = line_string_view[0];
+
+      // Line feeds and carriage returns are ignored in CSVs.
+      if (c == '\n' || c == '\r') {
+        line_string_view.remove_prefix(1);
+        continue;
+      }
+      // Null bytes aren't allowed in CSVs.
+      if (c == '\0') {
+        return ParseError(ParseError::ErrorCode::NULL_BYTE,
+                          fmt::format("CSV: Line {:d} contains NULL byte", line_count - 1));
+      }
+
+      switch (state) {
+        case CsvParserState::INITIAL_FIELD:
+        case CsvParserState::NEXT_FIELD: {
+          if (utils::StartsWith(line_string_view, quote)) {
+            // The current field is a quoted field.
+            state = CsvParserState::QUOTING;
+            line_string_view.remove_prefix(quote.size());
+          } else if (utils::StartsWith(line_string_view, delimiter)) {
+            // The current field has an empty value.
+            if constexpr (kBuildRow) row.emplace_back("");
+            state = CsvParserState::NEXT_FIELD;
+            line_string_view.remove_prefix(delimiter.size());
+          } else {
+            // The current field is a regular field.
+            const auto delimiter_idx = line_string_view.find(delimiter);
+            if constexpr (kBuildRow) row.emplace_back(line_string_view.substr(0, delimiter_idx));
+            if (delimiter_idx == std::string_view::npos) {
+              state = CsvParserState::DONE;
+            } else {
+              line_string_view.remove_prefix(delimiter_idx + delimiter.size());
+              state = CsvParserState::NEXT_FIELD;
+            }
+          }
+          break;
+        }
+        case CsvParserState::QUOTING: {
+          const auto quote_size = quote.size();
+          const auto quote_now = utils::StartsWith(line_string_view, quote);
+          const auto quote_next =
+              quote_size <= line_string_view.size() && utils::StartsWith(line_string_view.substr(quote_size), quote);
+          if (quote_now && quote_next) {
+            // This is an escaped quote character.
+            if constexpr (kBuildRow) column += quote;
+            line_string_view.remove_prefix(quote_size * 2);
+          } else if (quote_now) {
+            // This is the end of the quoted field.
+            if constexpr (kBuildRow) {
+              row.emplace_back(std::move(column));
+              column.clear();
+            }
+            state = CsvParserState::EXPECT_DELIMITER;
+            line_string_view.remove_prefix(quote_size);
+          } else {
+            // Copy the quoted text up to the next character which has to be
+            // looked at on its own.
+            auto const span = std::min(line_string_view.find_first_of(std::string_view{"\n\r\0", 3}),
+                                       line_string_view.find(quote[0]));
+            auto const length = std::max<size_t>(std::min(span, line_string_view.size()), 1);
+            if constexpr (kBuildRow) column.append(line_string_view.substr(0, length));
+            line_string_view.remove_prefix(length);
+          }
+          break;
+        }
+        case CsvParserState::EXPECT_DELIMITER: {
+          if (utils::StartsWith(line_string_view, delimiter)) {
+            state = CsvParserState::NEXT_FIELD;
+            line_string_view.remove_prefix(delimiter.size());
+          } else {
+            return ParseError(ParseError::ErrorCode::UNEXPECTED_TOKEN,
+                              fmt::format("CSV Reader: Expected '{}' after '{}', but got '{}' at line {:d}", delimiter,
+                                          quote, c, line_count - 1));
+          }
+          break;
+        }
+        case CsvParserState::DONE: {
+          LOG_FATAL("Invalid state of the CSV parser!");
+        }
+      }
+    }
+  } while (state == CsvParserState::QUOTING);
+
+  switch (state) {
+    case CsvParserState::INITIAL_FIELD:
+    case CsvParserState::DONE:
+    case CsvParserState::EXPECT_DELIMITER:
+      break;
+    case CsvParserState::NEXT_FIELD:
+      if constexpr (kBuildRow) row.emplace_back("");
+      break;
+    case CsvParserState::QUOTING: {
+      return ParseError(ParseError::ErrorCode::NO_CLOSING_QUOTE,
+                        "There is no more data left to load while inside a quoted string. "
+                        "Did you forget to close the quote?");
+      break;
+    }
+  }
+
+  // reached the end of file - return empty row
+  if (row.empty()) {
+    return row;
+  }
+
+  // Has header, but the header has already been read and the number_of_columns
+  // is already set. Otherwise, we would get an error every time we'd try to
+  // parse the header.
+  // Also, if we don't have a header, the 'number_of_columns' will be 0, so no
+  // need to check the number of columns.
+  if (number_of_columns != 0 && row.size() != number_of_columns) [[unlikely]] {
+    return ParseError(ParseError::ErrorCode::BAD_NUM_OF_COLUMNS,
+                      // ToDo(the-joksim):
+                      //    - 'line_count - 1' is the last line of a row (as a
+                      //      row may span several lines) ==> should have a row
+                      //      counter
+                      fmt::format("Expected {:d} columns in row {:d}, but got {:d}", number_of_columns,
+                                  line_count - 1, row.size()));
+  }
+  // To avoid unessisary dynamic growth of the row, remember the number of
+  // columns for future calls
+  if (number_of_columns == 0 && estimated_number_of_columns == 0) {
+    estimated_number_of_columns = row.size();
+  }
+
+  return std::move(row);
+}
+
+/// Returns the lines of text which was read from the file, like `getline`.
+/// Unless the text is the end of the file, the characters after its last line
+/// feed aren't returned, as the rest of their line wasn't read yet.
+class TextLines {
+ public:
+  TextLines(std::string_view text, bool end_of_file) : text_(text), end_of_file_(end_of_file) {}
+
+  std::optional<std::string_view> operator()() {
+    if (pos_ == text_.size()) {
+      ran_out_ = !end_of_file_;
+      return std::nullopt;
+    }
+    auto line_end = text_.find('\n', pos_);
+    if (line_end == std::string_view::npos) {
+      if (!end_of_file_) {
+        ran_out_ = true;
+        return std::nullopt;
+      }
+      line_end = text_.size();
+    }
+    auto line = text_.substr(pos_, line_end - pos_);
+    pos_ = std::min(line_end + 1, text_.size());
+    return line;
+  }
+
+  size_t Position() const { return pos_; }
+
+  /// True if a line was requested past the read text.
+  bool RanOut() const { return ran_out_; }
+
+ private:
+  std::string_view text_;
+  bool end_of_file_;
+  size_t pos_{0};
+  bool ran_out_{false};
+};
+
+/// Parses a file with several threads. The file is read in chunks which end
+/// at a record boundary, which are then parsed concurrently. The records are
+/// returned in the order of the file.
+///
+/// The boundaries are found by running the parser over the lines without
+/// storing the fields, so the records are split exactly like the sequential
+/// parser splits them, even if the file has errors.
+class ChunkedParser {
+ public:
+  struct ParsedRecord {
+    ParsingResult row;
+    // Lines read until the end of the record, used in the error messages.
+    uint64_t line_count;
+  };
+
+  ChunkedParser(PlainStream *stream, const CsvSource *source, const Reader::Config &config, uint64_t line_count,
+                uint16_t number_of_columns, size_t num_workers)
+      : stream_(stream),
+        source_(source),
+        config_(config),
+        line_count_(line_count),
+        number_of_columns_(number_of_columns),
+        max_chunks_in_flight_(num_workers * kChunksInFlightPerWorker) {
+    workers_.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+      workers_.emplace_back([this] { Work(); });
+    }
+  }
+
+  ChunkedParser(const ChunkedParser &) = delete;
+  ChunkedParser &operator=(const ChunkedParser &) = delete;
+  ChunkedParser(ChunkedParser &&) = delete;
+  ChunkedParser &operator=(ChunkedParser &&) = delete;
+
+  ~ChunkedParser() {
+    {
+      std::lock_guard guard{mutex_};
+      stop_ = true;
+    }
+    cv_.notify_all();
+    workers_.clear();
+  }
+
+  /// Returns the next record of the file, nullptr at its end.
+  /// @throw the exception which stopped reading or parsing the file
+  ParsedRecord *Next() {
+    while (record_pos_ == records_.size()) {
+      std::unique_lock lock{mutex_};
+      cv_.wait(lock, [this] {
+        return parsed_.contains(next_sequence_) || (error_ && next_sequence_ == error_sequence_) ||
+               (end_of_input_ && next_sequence_ == sequence_count_);
+      });
+      auto node = parsed_.extract(next_sequence_);
+      if (node.empty()) {
+        if (error_) std::rethrow_exception(error_);
+        return nullptr;
+      }
+      records_ = std::move(node.mapped());
+      record_pos_ = 0;
+      ++next_sequence_;
+      lock.unlock();
+      cv_.notify_all();
+    }
+    return &records_[record_pos_++];
+  }
+
+ private:
+  struct Chunk {
+    std::string text;
+    // Lines read before the chunk.
+    uint64_t line_count;
+  };
+
+  static constexpr size_t kBlockBytes = 1U << 20U;
+  static constexpr size_t kChunkBytes = 4U << 20U;
+  static constexpr size_t kChunksInFlightPerWorker = 2;
+
+  void Work() {
+    while (true) {
+      Chunk chunk;
+      uint64_t sequence = 0;
+      {
+        std::unique_lock lock{mutex_};
+        cv_.wait(lock, [this] {
+          return stop_ || end_of_input_ || sequence_count_ - next_sequence_ < max_chunks_in_flight_;
+        });
+        if (stop_ || end_of_input_) return;
+        try {
+          chunk = Split();
+        } catch (...) {
+          SetError(std::current_exception(), sequence_count_);
+        }
+        if (end_of_input_ || chunk.text.empty()) {
+          end_of_input_ = true;
+          lock.unlock();
+          cv_.notify_all();
+          return;
+        }
+        sequence = sequence_count_++;
+      }
+
+      std::vector<ParsedRecord> records;
+      std::exception_ptr error;
+      try {
+        records = Parse(chunk);
+      } catch (...) {
+        error = std::current_exception();
+      }
+      {
+        std::lock_guard guard{mutex_};
+        if (error) {
+          SetError(error, sequence);
+        } else {
+          parsed_.emplace(sequence, std::move(records));
+        }
+      }
+      cv_.notify_all();
+    }
+  }
+
+  /// Keeps the error of the earliest chunk, which the consumer reaches first,
+  /// and stops splitting the file. Must be called under the lock.
+  void SetError(std::exception_ptr error, uint64_t sequence) {
+    if (!error_ || sequence < error_sequence_) {
+      error_ = std::move(error);
+      error_sequence_ = sequence;
+    }
+    end_of_input_ = true;
+  }
+
+  /// Returns the next chunk of whole records, an empty one at the end of the
+  /// file. Must be called under the lock.
+  Chunk Split() {
+    while (true) {
+      ScanRecords();
+      if (scanned_bytes_ >= kChunkBytes || end_of_file_) break;
+      ReadBlock();
+    }
+    Chunk chunk{.text = pending_.substr(0, scanned_bytes_), .line_count = line_count_};
+    pending_.erase(0, scanned_bytes_);
+    line_count_ += scanned_lines_;
+    scanned_bytes_ = 0;
+    scanned_lines_ = 0;
+    return chunk;
+  }
+
+  void ReadBlock() {
+    auto const size = pending_.size();
+    pending_.resize(size + kBlockBytes);
+    stream_->read(pending_.data() + size, kBlockBytes);
+    pending_.resize(size + stream_->gcount());
+    if (!*stream_) {
+      end_of_file_ = true;
+      source_->CheckComplete();
+    }
+  }
+
+  /// Advances over the records of the read text which are complete.
+  void ScanRecords() {
+    TextLines lines(std::string_view{pending_}.substr(scanned_bytes_), end_of_file_);
+    uint64_t estimated_number_of_columns = 0;
+    while (true) {
+      auto const start = lines.Position();
+      uint64_t line_count = 0;
+      static_cast<void>(ParseRecord<false>(lines, config_, line_count, 0, estimated_number_of_columns,
+                                           utils::NewDeleteResource()));
+      if (lines.RanOut() || line_count == 0) break;
+      scanned_bytes_ += lines.Position() - start;
+      scanned_lines_ += line_count;
+    }
+  }
+
+  std::vector<ParsedRecord> Parse(const Chunk &chunk) const {
+    TextLines lines(chunk.text, true);
+    auto line_count = chunk.line_count;
+    uint64_t estimated_number_of_columns = 0;
+    std::vector<ParsedRecord> records;
+    while (true) {
+      auto const start = line_count;
+      auto row = ParseRecord<true>(lines, config_, line_count, number_of_columns_, estimated_number_of_columns,
+                                   utils::NewDeleteResource());
+      if (line_count == start) break;
+      records.push_back({std::move(row), line_count});
+    }
+    return records;
+  }
+
+  PlainStream *stream_;
+  const CsvSource *source_;
+  const Reader::Config &config_;
+
+  // Guarded by the mutex.
+  std::string pending_;
+  uint64_t line_count_;
+  size_t scanned_bytes_{0};
+  uint64_t scanned_lines_{0};
+  bool end_of_file_{false};
+  bool end_of_input_{false};
+  bool stop_{false};
+  uint64_t sequence_count_{0};
+  uint64_t next_sequence_{0};
+  std::map<uint64_t, std::vector<ParsedRecord>> parsed_;
+  std::exception_ptr error_;
+  uint64_t error_sequence_{0};
+
+  uint16_t number_of_columns_;
+  size_t max_chunks_in_flight_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+
+  // Read only by the consumer.
+  std::vector<ParsedRecord> records_;
+  size_t record_pos_{0};
+
+  std::vector<std::jthread> workers_;
+};
+
+}  // namespace
 
 struct Reader::impl {
   impl(CsvSource source, Reader::Config cfg, utils::MemoryResource *mem);
@@ -46,12 +483,14 @@ struct Reader::impl {
 
   void TryInitializeHeader();
 
-  bool GetNextLine();
+  std::optional<std::string_view> GetNextLine();
 
   ParsingResult ParseHeader();
 
   ParsingResult ParseRow(utils::MemoryResource *mem);
 
+  auto GetNextChunkedRow() -> std::optional<Reader::Row>;
+
   utils::MemoryResource *memory_;
   std::filesystem::path path_;
   CsvSource source_;
@@ -62,6 +501,8 @@ struct Reader::impl {
   uint64_t estimated_number_of_columns_{0};
   utils::pmr::string line_buffer_{memory_};
   Reader::Header header_{memory_};
+  // Declared after the stream, which it reads until it's destroyed.
+  std::unique_ptr<ChunkedParser> chunked_parser_;
 };
 
 Reader::impl::impl(CsvSource source, Reader::Config cfg, utils::MemoryResource *mem)
@@ -70,6 +511,7 @@ Reader::impl::impl(CsvSource source, Reader::Config cfg, utils::MemoryResource *
   read_config_.ignore_bad = cfg.ignore_bad;
   read_config_.delimiter = cfg.delimiter ? std::move(*cfg.delimiter) : utils::pmr::string{",", memory_};
   read_config_.quote = cfg.quote ? std::move(*cfg.quote) : utils::pmr::string{"\"", memory_};
+  read_config_.parallel_workers = cfg.parallel_workers;
   InitializeStream();
   TryInitializeHeader();
 }
@@ -135,16 +577,16 @@ void Reader::impl::InitializeStream() {
   MG_ASSERT(csv_stream_.is_complete(), "Should be 'complete' for correct operation");
 }
 
-bool Reader::impl::GetNextLine() {
+std::optional<std::string_view> Reader::impl::GetNextLine() {
   if (!std::getline(csv_stream_, line_buffer_)) {
+    source_.CheckComplete();
     // reached end of file or an I/0 error occurred
     if (!csv_stream_.good()) {
       csv_stream_.reset();  // this will close the file_stream_ and clear the chain
     }
-    return false;
+    return std::nullopt;
   }
-  ++line_count_;
-  return true;
+  return line_buffer_;
 }
 
 Reader::ParsingResult Reader::impl::ParseHeader() {
@@ -177,159 +619,38 @@ const Reader::Header &Reader::GetHeader() const { return pimpl->Header(); }
 
 void Reader::Reset() { pimpl->Reset(); }
 
-namespace {
-enum class CsvParserState : uint8_t { INITIAL_FIELD, NEXT_FIELD, QUOTING, EXPECT_DELIMITER, DONE };
-
-}  // namespace
-
 Reader::ParsingResult Reader::impl::ParseRow(utils::MemoryResource *mem) {
-  utils::pmr::vector<utils::pmr::string> row(mem);
-  if (number_of_columns_ != 0) {
-    row.reserve(number_of_columns_);
-  } else if (estimated_number_of_columns_ != 0) {
-    row.reserve(estimated_number_of_columns_);
-  }
-
-  utils::pmr::string column(memory_);
-
-  auto state = CsvParserState::INITIAL_FIELD;
-
-  do {
-    if (!GetNextLine()) {
-      // The whole file was processed.
-      break;
-    }
-
-    std::string_view line_string_view = line_buffer_;
-
-    // remove '\r' from the end in case we have dos file format
-    if (line_string_view.back() == '\r') {
-      line_string_view.remove_suffix(1);
-    }
-
-    while (state != CsvParserState::DONE && !line_string_view.empty()) {
-      const auto c = line_string_view[0];
-
-      // Line feeds and carriage returns are ignored in CSVs.
-      if (c == '\n' || c == '\r') {
-        line_string_view.remove_prefix(1);
-        continue;
-      }
-      // Null bytes aren't allowed in CSVs.
-      if (c == '\0') {
-        return ParseError(ParseError::ErrorCode::NULL_BYTE,
-                          fmt::format("CSV: Line {:d} contains NULL byte", line_count_ - 1));
-      }
+  auto next_line = [this] { return GetNextLine(); };
+  return ParseRecord<true>(next_line, read_config_, line_count_, number_of_columns_, estimated_number_of_columns_,
+                           mem);
+}
 
-      switch (state) {
-        case CsvParserState::INITIAL_FIELD:
-        case CsvParserState::NEXT_FIELD: {
-          if (utils::StartsWith(line_string_view, *read_config_.quote)) {
-            // The current field is a quoted field.
-            state = CsvParserState::QUOTING;
-            line_string_view.remove_prefix(read_config_.quote->size());
-          } else if (utils::StartsWith(line_string_view, *read_config_.delimiter)) {
-            // The current field has an empty value.
-            row.emplace_back("");
-            state = CsvParserState::NEXT_FIELD;
-            line_string_view.remove_prefix(read_config_.delimiter->size());
-          } else {
-            // The current field is a regular field.
-            const auto delimiter_idx = line_string_view.find(*read_config_.delimiter);
-            row.emplace_back(line_string_view.substr(0, delimiter_idx));
-            if (delimiter_idx == std::string_view::npos) {
-              state = CsvParserState::DONE;
-            } else {
-              line_string_view.remove_prefix(delimiter_idx + read_config_.delimiter->size());
-              state = CsvParserState::NEXT_FIELD;
-            }
-          }
-          break;
-        }
-        case CsvParserState::QUOTING: {
-          const auto quote_size = read_config_.quote->size();
-          const auto quote_now = utils::StartsWith(line_string_view, *read_config_.quote);
-          const auto quote_next = quote_size <= line_string_view.size() &&
-                                  utils::StartsWith(line_string_view.substr(quote_size), *read_config_.quote);
-          if (quote_now && quote_next) {
-            // This is an escaped quote character.
-            column += *read_config_.quote;
-            line_string_view.remove_prefix(read_config_.quote->size() * 2);
-          } else if (quote_now) {
-            // This is the end of the quoted field.
-            row.emplace_back(std::move(column));
-            column.clear();
-            state = CsvParserState::EXPECT_DELIMITER;
-            line_string_view.remove_prefix(read_config_.quote->size());
-          } else {
-            column.push_back(c);
-            line_string_view.remove_prefix(1);
-          }
-          break;
-        }
-        case CsvParserState::EXPECT_DELIMITER: {
-          if (utils::StartsWith(line_string_view, *read_config_.delimiter)) {
-            state = CsvParserState::NEXT_FIELD;
-            line_string_view.remove_prefix(read_config_.delimiter->size());
-          } else {
-            return ParseError(ParseError::ErrorCode::UNEXPECTED_TOKEN,
-                              fmt::format("CSV Reader: Expected '{}' after '{}', but got '{}' at line {:d}",
-                                          *read_config_.delimiter, *read_config_.quote, c, line_count_ - 1));
-          }
-          break;
-        }
-        case CsvParserState::DONE: {
-          LOG_FATAL("Invalid state of the CSV parser!");
-        }
+std::optional<Reader::Row> Reader::impl::GetNextChunkedRow() {
+  if (!chunked_parser_) {
+    // The header may have been the whole file.
+    if (!csv_stream_.good()) return std::nullopt;
+    chunked_parser_ = std::make_unique<ChunkedParser>(&csv_stream_, &source_, read_config_, line_count_,
+                                                      number_of_columns_, read_config_.parallel_workers);
+  }
+  while (auto *record = chunked_parser_->Next()) {
+    line_count_ = record->line_count;
+    if (record->row.HasError()) [[unlikely]] {
+      if (!read_config_.ignore_bad) {
+        throw CsvReadException("CSV Reader: Bad row at line {:d}: {}", line_count_ - 1, record->row.GetError().message);
       }
+      spdlog::debug("CSV Reader: Bad row at line {:d}: {}", line_count_ - 1, record->row.GetError().message);
+      continue;
     }
-  } while (state == CsvParserState::QUOTING);
-
-  switch (state) {
-    case CsvParserState::INITIAL_FIELD:
-    case CsvParserState::DONE:
-    case CsvParserState::EXPECT_DELIMITER:
-      break;
-    case CsvParserState::NEXT_FIELD:
-      row.emplace_back("");
-      break;
-    case CsvParserState::QUOTING: {
-      return ParseError(ParseError::ErrorCode::NO_CLOSING_QUOTE,
-                        "There is no more data left to load while inside a quoted string. "
-                        "Did you forget to close the quote?");
-      break;
-    }
-  }
-
-  // reached the end of file - return empty row
-  if (row.empty()) {
-    return row;
-  }
-
-  // Has header, but the header has already been read and the number_of_columns_
-  // is already set. Otherwise, we would get an error every time we'd try to
-  // parse the header.
-  // Also, if we don't have a header, the 'number_of_columns_' will be 0, so no
-  // need to check the number of columns.
-  if (number_of_columns_ != 0 && row.size() != number_of_columns_) [[unlikely]] {
-    return ParseError(ParseError::ErrorCode::BAD_NUM_OF_COLUMNS,
-                      // ToDo(the-joksim):
-                      //    - 'line_count_ - 1' is the last line of a row (as a
-                      //      row may span several lines) ==> should have a row
-                      //      counter
-                      fmt::format("Expected {:d} columns in row {:d}, but got {:d}", number_of_columns_,
-                                  line_count_ - 1, row.size()));
-  }
-  // To avoid unessisary dynamic growth of the row, remember the number of
-  // columns for future calls
-  if (number_of_columns_ == 0 && estimated_number_of_columns_ == 0) {
-    estimated_number_of_columns_ = row.size();
+    // An empty row ends the file, as it does for the sequential parser.
+    if (record->row->empty()) [[unlikely]] break;
+    return std::move(*record->row);
   }
-
-  return std::move(row);
+  return std::nullopt;
 }
 
 std::optional<Reader::Row> Reader::impl::GetNextRow(utils::MemoryResource *mem) {
+  if (read_config_.parallel_workers > 1) return GetNextChunkedRow();
+
   auto row = ParseRow(mem);
 
   if (row.HasError()) [[unlikely]] {
@@ -383,14 +704,140 @@ auto CsvSource::Create(const utils::pmr::string &csv_location) -> CsvSource {
   return csv::FileCsvSource{csv_location};
 }
 
-// Helper for UrlCsvSource
-auto urlToStringStream(const char *url) -> std::stringstream {
-  auto ss = std::stringstream{};
-  if (!requests::DownloadToStream(url, ss)) {
-    throw CsvReadException("CSV was unable to be fetched from {}", url);
+void CsvSource::CheckComplete() const {
+  if (const auto *url_source = std::get_if<UrlCsvSource>(&source_)) url_source->CheckComplete();
+}
+
+namespace {
+
+/// Passes the parts of the response from the thread which downloads the file
+/// to the stream which reads it. The downloading thread waits while too many
+/// blocks haven't been read yet.
+class DownloadStreamBuf : public std::streambuf {
+ public:
+  /// Returns false if the stream is no longer read.
+  bool Push(std::string_view data) {
+    std::unique_lock lock{mutex_};
+    filling_.append(data);
+    if (filling_.size() < kBlockBytes) return !cancelled_;
+    cv_.wait(lock, [this] { return cancelled_ || blocks_.size() < kMaxQueuedBlocks; });
+    if (cancelled_) return false;
+    blocks_.push_back(std::exchange(filling_, {}));
+    lock.unlock();
+    cv_.notify_all();
+    return true;
+  }
+
+  void Finish(bool succeeded) {
+    {
+      std::lock_guard guard{mutex_};
+      if (!filling_.empty()) blocks_.push_back(std::exchange(filling_, {}));
+      finished_ = true;
+      succeeded_ = succeeded;
+    }
+    cv_.notify_all();
+  }
+
+  void Cancel() {
+    {
+      std::lock_guard guard{mutex_};
+      cancelled_ = true;
+    }
+    cv_.notify_all();
+  }
+
+  bool Failed() {
+    std::lock_guard guard{mutex_};
+    return finished_ && !succeeded_;
+  }
+
+ protected:
+  int_type underflow() override {
+    if (gptr() < egptr()) return traits_type::to_int_type(*gptr());
+    {
+      std::unique_lock lock{mutex_};
+      auto const downloaded = [this] { return !blocks_.empty() || finished_; };
+      if (!downloaded()) {
+        utils::BlockingSection const waiting_on_download;
+        cv_.wait(lock, downloaded);
+      }
+      if (blocks_.empty()) return traits_type::eof();
+      current_ = std::move(blocks_.front());
+      blocks_.pop_front();
+      ++blocks_read_;
+    }
+    cv_.notify_all();
+    setg(current_.data(), current_.data(), current_.data() + current_.size());
+    return traits_type::to_int_type(*gptr());
+  }
+
+  // Only seeking back to the start of the file is supported while its first
+  // block is read, which is enough to detect the compression of the file.
+  pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+    const auto to_start = (dir == std::ios_base::beg && off == 0) ||
+                          (dir == std::ios_base::cur && gptr() - eback() + off == 0);
+    if (blocks_read_ > 1 || !(which & std::ios_base::in) || !to_start) return pos_type(off_type(-1));
+    setg(eback(), eback(), egptr());
+    return pos_type(off_type(0));
   }
-  return ss;
+
+  pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+  }
+
+ private:
+  // The blocks are large enough to hold the header of a compressed file.
+  static constexpr size_t kBlockBytes = 1U << 20U;
+  static constexpr size_t kMaxQueuedBlocks = 16;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<std::string> blocks_;
+  std::string filling_;
+  bool finished_{false};
+  bool succeeded_{false};
+  bool cancelled_{false};
+
+  // Used only by the reading thread.
+  std::string current_;
+  size_t blocks_read_{0};
 };
 
-UrlCsvSource::UrlCsvSource(const char *url) : StreamCsvSource{urlToStringStream(url)} {}
+}  // namespace
+
+struct UrlCsvSource::Download {
+  explicit Download(std::string url) : url(std::move(url)) {
+    thread = std::jthread([this] {
+      buffer.Finish(requests::DownloadInParts(this->url.c_str(), [this](auto data) { return buffer.Push(data); }));
+    });
+  }
+
+  Download(const Download &) = delete;
+  Download &operator=(const Download &) = delete;
+  Download(Download &&) = delete;
+  Download &operator=(Download &&) = delete;
+
+  ~Download() { buffer.Cancel(); }
+
+  std::string url;
+  DownloadStreamBuf buffer;
+  std::istream stream{&buffer};
+  // Declared last, so it's joined before the buffer is destroyed.
+  std::jthread thread;
+};
+
+UrlCsvSource::UrlCsvSource(const char *url)
+    : download_{new Download{url}, [](Download *p) { delete p; }} {
+  // Wait for the start of the file, so a failed request is reported here.
+  download_->stream.peek();
+  CheckComplete();
+}
+
+std::istream &UrlCsvSource::GetStream() { return download_->stream; }
+
+void UrlCsvSource::CheckComplete() const {
+  if (download_->buffer.Failed()) {
+    throw CsvReadException("CSV was unable to be fetched from {}", download_->url);
+  }
+}
 }  // namespace memgraph::csv
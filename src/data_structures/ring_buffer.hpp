@@ -11,12 +11,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <mutex>
 #include <optional>
 #include <thread>
 #include <utility>
+#include <vector>
 
 #include "utils/logging.hpp"
 #include "utils/spin_lock.hpp"
@@ -65,6 +67,20 @@ class RingBuffer {
     }
   }
 
+  /**
+   * Emplaces a new element into the buffer if there is space for it. Never
+   * blocks, returns whether the element was emplaced.
+   */
+  template <typename... TArgs>
+  bool try_emplace(TArgs &&...args) {
+    auto guard = std::lock_guard{lock_};
+    if (size_ == capacity_) return false;
+    buffer_[write_pos_++] = TElement(std::forward<TArgs>(args)...);
+    write_pos_ %= capacity_;
+    size_++;
+    return true;
+  }
+
   /**
    * Removes and returns the oldest element from the buffer. If the buffer is
    * empty, nullopt is returned.
@@ -78,6 +94,21 @@ class RingBuffer {
     return result;
   }
 
+  /**
+   * Moves up to `max` of the oldest elements to the back of `out` under a
+   * single lock acquisition. Returns the number of moved elements.
+   */
+  size_t pop_many(std::vector<TElement> &out, size_t max) {
+    auto guard = std::lock_guard{lock_};
+    const auto count = std::min(max, static_cast<size_t>(size_));
+    for (size_t i = 0; i < count; ++i) {
+      out.emplace_back(std::move(buffer_[read_pos_++]));
+      read_pos_ %= capacity_;
+    }
+    size_ -= static_cast<int>(count);
+    return count;
+  }
+
   /** Removes all elements from the buffer. */
   void clear() {
     auto guard = std::lock_guard{lock_};
@@ -10,31 +10,130 @@
 // licenses/APL.txt.
 
 #include "dbms/database.hpp"
+
+#include <algorithm>
+#include <set>
+#include <string>
+#include <vector>
+
 #include "dbms/inmemory/storage_helper.hpp"
+#include "query/db_accessor.hpp"
+#include "query/interpreter.hpp"
 #include "storage/v2/disk/storage.hpp"
+#include "storage/v2/inmemory/label_index.hpp"
+#include "storage/v2/inmemory/label_property_index.hpp"
 #include "storage/v2/storage_mode.hpp"
+#include "utils/logging.hpp"
 
 template struct memgraph::utils::Gatekeeper<memgraph::dbms::Database>;
 
 namespace memgraph::dbms {
 
 Database::Database(storage::Config config, replication::ReplicationState &repl_state)
-    : trigger_store_(config.durability.storage_directory / "triggers"),
+    : arena_{memory::TenantMemoryLimit()},
+      trigger_store_(config.durability.storage_directory / "triggers"),
       streams_{config.durability.storage_directory / "streams"},
       time_to_live_{config.durability.storage_directory / "ttl"},
-      plan_cache_{FLAGS_query_plan_cache_max_size},
+      plan_cache_{static_cast<size_t>(FLAGS_query_plan_cache_max_size)},
       repl_state_(&repl_state) {
+  // The recovered data belongs to the database as well
+  [[maybe_unused]] auto arena_binding = arena_.Bind();
   if (config.salient.storage_mode == memgraph::storage::StorageMode::ON_DISK_TRANSACTIONAL || config.force_on_disk ||
       utils::DirExists(config.disk.main_storage_directory)) {
     config.salient.storage_mode = memgraph::storage::StorageMode::ON_DISK_TRANSACTIONAL;
     storage_ = std::make_unique<storage::DiskStorage>(std::move(config));
   } else {
     storage_ = dbms::CreateInMemoryStorage(std::move(config), repl_state);
+    auto const interval = storage_->config_.indices.stats_refresh_interval;
+    if (interval.count() > 0) {
+      stats_refresher_.Run("Index stats", interval, [this] { RefreshIndexStats(); });
+    }
   }
 }
 
 void Database::SwitchToOnDisk() {
+  stats_refresher_.Stop();
   storage_ = std::make_unique<memgraph::storage::DiskStorage>(std::move(storage_->config_));
 }
 
+void Database::RefreshIndexStats() {
+  // Statistics are replicated from MAIN
+  if (!repl_state_->IsMain()) return;
+
+  try {
+    // Holding an accessor keeps the indices from being created or dropped
+    auto storage_acc = storage_->Access();
+    auto *label_index = static_cast<storage::InMemoryLabelIndex *>(storage_->indices_.label_index_.get());
+    auto *label_property_index =
+        static_cast<storage::InMemoryLabelPropertyIndex *>(storage_->indices_.label_property_index_.get());
+    auto const threshold = storage_->config_.indices.stats_refresh_threshold;
+
+    // Changes are the modifications since the last refresh together with the drift of the vertex count, which also
+    // covers the changes made before the index was first seen here.
+    auto is_stale = [threshold](uint64_t modifications, uint64_t last_modifications, uint64_t analyzed_count,
+                                uint64_t current_count) {
+      // Counters start from zero when an index is recreated
+      auto const changes = (modifications >= last_modifications ? modifications - last_modifications : modifications) +
+                           (std::max(analyzed_count, current_count) - std::min(analyzed_count, current_count));
+      return static_cast<double>(changes) > threshold * static_cast<double>(std::max<uint64_t>(analyzed_count, 1));
+    };
+
+    std::set<storage::LabelId> stale_labels;
+    std::map<storage::LabelId, uint64_t> label_modifications;
+    for (auto label : label_index->ListIndices()) {
+      auto stats = label_index->GetIndexStats(label);
+      if (!stats) continue;
+      auto const modifications = label_index->ModificationCount(label);
+      auto last = label_stats_modifications_.find(label);
+      auto const last_modifications = last == label_stats_modifications_.end() ? modifications : last->second;
+      label_modifications.emplace(label, last_modifications);
+      if (is_stale(modifications, last_modifications, stats->count, label_index->ApproximateVertexCount(label))) {
+        stale_labels.insert(label);
+      }
+    }
+    std::map<std::pair<storage::LabelId, storage::PropertyId>, uint64_t> label_property_modifications;
+    for (const auto &key : label_property_index->ListIndices()) {
+      auto stats = label_property_index->GetIndexStats(key);
+      if (!stats) continue;
+      auto const modifications = label_property_index->ModificationCount(key.first, key.second);
+      auto last = label_property_stats_modifications_.find(key);
+      auto const last_modifications = last == label_property_stats_modifications_.end() ? modifications : last->second;
+      label_property_modifications.emplace(key, last_modifications);
+      if (is_stale(modifications, last_modifications, stats->count,
+                   label_property_index->ApproximateVertexCount(key.first, key.second))) {
+        stale_labels.insert(key.first);
+      }
+    }
+
+    if (!stale_labels.empty()) {
+      std::vector<std::string> labels;
+      labels.reserve(stale_labels.size());
+      for (auto label : stale_labels) labels.push_back(storage_acc->LabelToName(label));
+
+      // Analyzing recomputes all the indices of a label
+      query::DbAccessor dba(storage_acc.get());
+      query::AnalyzeGraphQueryHandler::AnalyzeGraphCreateStatistics(labels, &dba);
+      if (storage_acc->Commit().HasError()) {
+        spdlog::warn("Failed to commit the refreshed index statistics.");
+        return;
+      }
+      for (auto &[label, last_modifications] : label_modifications) {
+        if (stale_labels.contains(label)) last_modifications = label_index->ModificationCount(label);
+      }
+      for (auto &[key, last_modifications] : label_property_modifications) {
+        if (stale_labels.contains(key.first)) {
+          last_modifications = label_property_index->ModificationCount(key.first, key.second);
+        }
+      }
+      // The cached plans were costed with the old statistics
+      plan_cache_.reset();
+      spdlog::trace("Refreshed the index statistics of {} labels.", labels.size());
+    }
+    label_stats_modifications_ = std::move(label_modifications);
+    label_property_stats_modifications_ = std::move(label_property_modifications);
+  } catch (const std::exception &e) {
+    spdlog::warn("Failed to refresh the index statistics: {}", e.what());
+  }
+}
+
 }  // namespace memgraph::dbms
@@ -11,14 +11,18 @@
 
 #pragma once
 
+#include <map>
 #include <memory>
 #include <optional>
+#include <utility>
 
+#include "memory/global_memory_control.hpp"
 #include "query/stream/streams.hpp"
 #include "query/time_to_live/time_to_live.hpp"
 #include "query/trigger.hpp"
 #include "storage/v2/storage.hpp"
 #include "utils/gatekeeper.hpp"
+#include "utils/scheduler.hpp"
 
 namespace memgraph::dbms {
 
@@ -106,8 +110,8 @@ class Database {
   DatabaseInfo GetInfo() const {
     DatabaseInfo info;
     info.storage_info = storage_->GetInfo();
-    info.triggers = trigger_store_.GetTriggerInfo().size();
-    info.streams = streams_.GetStreamInfo().size();
+    info.triggers = trigger_store_.Count();
+    info.streams = streams_.Count();
     return info;
   }
 
@@ -145,15 +149,29 @@ class Database {
    */
   void AddTask(std::function<void()> new_task) { after_commit_trigger_pool_.AddTask(std::move(new_task)); }
 
+  /**
+   * @brief Returns the committed transactions whose after commit triggers haven't run yet
+   *
+   * @return query::AfterCommitTriggerQueue*
+   */
+  query::AfterCommitTriggerQueue *after_commit_trigger_queue() { return &after_commit_trigger_queue_; }
+
   /**
    * @brief Returns the PlanCache vector raw pointer
    *
-   * @return utils::Synchronized<utils::LRUCache<uint64_t, std::shared_ptr<PlanWrapper>>, utils::RWSpinLock>
+   * @return query::PlanCache
    */
-  query::PlanCacheLRU *plan_cache() { return &plan_cache_; }
+  query::PlanCache *plan_cache() { return &plan_cache_; }
 
   query::ttl::TTL &ttl() { return time_to_live_; }
 
+  /**
+   * @brief Returns the dedicated memory arena, the queries of the database bind their threads to it
+   *
+   * @return const memory::TenantArena&
+   */
+  const memory::TenantArena &arena() const { return arena_; }
+
   /**
    * @brief Useful when trying to gracefully destroy Database.
    *
@@ -163,22 +181,37 @@ class Database {
    *
    */
   void StopAllBackgroundTasks() {
+    stats_refresher_.Stop();
     streams()->Shutdown();
     thread_pool()->ShutDown();
     ttl().Shutdown();
   }
 
  private:
-  std::unique_ptr<storage::Storage> storage_;       //!< Underlying storage
-  query::TriggerStore trigger_store_;               //!< Triggers associated with the storage
-  utils::ThreadPool after_commit_trigger_pool_{1};  //!< Thread pool for executing after commit triggers
-  query::stream::Streams streams_;                  //!< Streams associated with the storage
-  query::ttl::TTL time_to_live_;                    //!< TTL associated with the storage
+  /**
+   * @brief Recomputes the statistics of the analyzed indices which changed by more than the configured fraction since
+   * they were computed.
+   *
+   */
+  void RefreshIndexStats();
+
+  memory::TenantArena arena_;                                  //!< Memory of the database, destroyed last to purge it
+  std::unique_ptr<storage::Storage> storage_;                  //!< Underlying storage
+  query::TriggerStore trigger_store_;                          //!< Triggers associated with the storage
+  query::AfterCommitTriggerQueue after_commit_trigger_queue_;  //!< Transactions waiting for after commit triggers
+  utils::ThreadPool after_commit_trigger_pool_{1};             //!< Thread pool for executing after commit triggers
+  query::stream::Streams streams_;                             //!< Streams associated with the storage
+  query::ttl::TTL time_to_live_;                               //!< TTL associated with the storage
 
   // TODO: Move to a better place
-  query::PlanCacheLRU plan_cache_;  //!< Plan cache associated with the storage
+  query::PlanCache plan_cache_;  //!< Plan cache associated with the storage
 
   const replication::ReplicationState *repl_state_;
+
+  // Index modification counts at the last statistics refresh
+  std::map<storage::LabelId, uint64_t> label_stats_modifications_;
+  std::map<std::pair<storage::LabelId, storage::PropertyId>, uint64_t> label_property_stats_modifications_;
+  utils::Scheduler stats_refresher_;  //!< Background refresh of the index statistics, stopped first
 };
 
 }  // namespace memgraph::dbms
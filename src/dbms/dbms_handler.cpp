@@ -11,16 +11,24 @@
 
 #include "dbms/dbms_handler.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <exception>
 #include <filesystem>
+#include <thread>
+#include <variant>
+#include <vector>
 
 #include "dbms/constants.hpp"
 #include "dbms/global.hpp"
 #include "flags/experimental.hpp"
 #include "spdlog/spdlog.h"
+#include "storage/v2/inmemory/storage.hpp"
 #include "system/include/system/system.hpp"
 #include "utils/exceptions.hpp"
 #include "utils/logging.hpp"
+#include "utils/thread.hpp"
 #include "utils/uuid.hpp"
 
 #include <mutex>
@@ -61,7 +69,7 @@ void RestoreReplication(replication::RoleMainData &mainData, DatabaseAccess db_a
     spdlog::info("Replica {} restoration started for {}.", instance_client.name_, db_acc->name());
     const auto &ret = db_acc->storage()->repl_storage_state_.replication_clients_.WithLock(
         [&, db_acc](auto &storage_clients) mutable -> utils::BasicResult<query::RegisterReplicaError> {
-          auto client = std::make_unique<storage::ReplicationStorageClient>(instance_client, mainData.uuid_);
+          auto client = std::make_shared<storage::ReplicationStorageClient>(instance_client, mainData.uuid_);
           auto *storage = db_acc->storage();
           client->Start(storage, std::move(db_acc));
           // After start the storage <-> replica state should be READY or RECOVERING (if correctly started)
@@ -194,20 +202,19 @@ DbmsHandler::DbmsHandler(storage::Config config, replication::ReplicationState &
   // but if storage-recover-on-startup is true storage will be recovered which is an issue
   spdlog::info("Data recovery on startup set to {}", recovery_on_startup);
   if (recovery_on_startup) {
+    std::vector<DatabaseToRestore> databases;
     auto it = durability_->begin(std::string(kDBPrefix));
     auto end = durability_->end(std::string(kDBPrefix));
     for (; it != end; ++it) {
       const auto &[key, config_json] = *it;
-      const auto name = key.substr(kDBPrefix.size());
       auto json = nlohmann::json::parse(config_json);
-      const auto uuid = json.at("uuid").get<utils::UUID>();
-      const auto rel_dir = json.at("rel_dir").get<std::filesystem::path>();
-      spdlog::info("Restoring database {} at {}.", name, rel_dir);
-      auto new_db = New_(name, uuid, nullptr, rel_dir);
-      MG_ASSERT(!new_db.HasError(), "Failed while creating database {}.", name);
+      auto rel_dir = json.at("rel_dir").get<std::filesystem::path>();
       directories.emplace(rel_dir.filename());
-      spdlog::info("Database {} restored.", name);
+      databases.push_back(DatabaseToRestore{.name = key.substr(kDBPrefix.size()),
+                                            .uuid = json.at("uuid").get<utils::UUID>(),
+                                            .rel_dir = std::move(rel_dir)});
     }
+    RestoreDatabases_(databases);
   } else {  // Clear databases from the durability list and auth
     auto locked_auth = auth_.Lock();
     auto it = durability_->begin(std::string{kDBPrefix});
@@ -245,6 +252,182 @@ DbmsHandler::DbmsHandler(storage::Config config, replication::ReplicationState &
    */
   // Setup the default DB
   SetupDefault_();
+
+  /*
+   * IDLE DATABASES
+   */
+  const auto unload_after = default_config_.durability.unload_idle_after;
+  if (unload_after.count() > 0) {
+    // Unloaded databases are recovered from their snapshots and WALs, which have to cover all of their data
+    if (!default_config_.durability.recover_on_startup ||
+        default_config_.durability.snapshot_wal_mode !=
+            storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL) {
+      spdlog::warn(
+          "Idle databases are not unloaded, because it requires recovery on startup and periodic snapshots with WAL.");
+    } else {
+      const auto check_interval = std::clamp<std::chrono::seconds>(unload_after / 4, std::chrono::seconds(1),
+                                                                   std::chrono::seconds(60));
+      idle_unloader_.Run("Idle db unload", check_interval, [this] { UnloadIdleDatabases_(); });
+    }
+  }
+}
+
+void DbmsHandler::RestoreDatabases_(const std::vector<DatabaseToRestore> &databases) {
+  if (databases.empty()) return;
+  const auto thread_budget = std::max<uint64_t>(default_config_.durability.recovery_thread_count, 1);
+  const auto workers = std::min<uint64_t>(thread_budget, databases.size());
+
+  std::atomic<size_t> next{0};
+  std::mutex register_lock;  // Registration of the recovered databases
+  std::exception_ptr error;
+  auto restore = [&] {
+    for (auto i = next.fetch_add(1, std::memory_order_relaxed); i < databases.size();
+         i = next.fetch_add(1, std::memory_order_relaxed)) {
+      const auto &[name, uuid, rel_dir] = databases[i];
+      try {
+        spdlog::info("Restoring database {} at {}.", name, rel_dir);
+        auto config = DatabaseConfig_(name, uuid, rel_dir);
+        // Each concurrent recovery gets its share of the threads
+        config.durability.recovery_thread_count = std::max<uint64_t>(thread_budget / workers, 1);
+        // Recovery happens while constructing the database
+        auto database = utils::Gatekeeper<Database>{config, repl_state_};
+
+        auto guard = std::lock_guard{register_lock};
+        if (error) return;
+        auto new_db = db_handler_.Add(name, std::move(database));
+        MG_ASSERT(!new_db.HasError(), "Failed while creating database {}.", name);
+        // The share only matters during startup, later recoveries (e.g. on a replica) use all of the threads
+        new_db.GetValue()->storage()->config_.durability.recovery_thread_count = thread_budget;
+        UpdateDurability(config);
+        spdlog::info("Database {} restored.", name);
+      } catch (...) {
+        auto guard = std::lock_guard{register_lock};
+        if (!error) error = std::current_exception();
+        return;
+      }
+    }
+  };
+
+  if (workers == 1) {
+    restore();
+  } else {
+    std::vector<std::jthread> threads;
+    threads.reserve(workers);
+    for (uint64_t i = 0; i < workers; ++i) {
+      threads.emplace_back([&restore] {
+        utils::ThreadSetName("DbRecovery");
+        restore();
+      });
+    }
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+void DbmsHandler::UnloadIdleDatabases_() {
+  const auto now = std::chrono::steady_clock::now();
+  // Unloaded databases aren't replicated
+  auto *main_data = std::get_if<replication::RoleMainData>(&repl_state_.ReplicationData());
+  if (main_data == nullptr || !main_data->registered_replicas_.empty()) {
+    idle_since_.clear();
+    return;
+  }
+
+  auto can_unload = [](Database &database) {
+    return database.storage()->GetStorageMode() == storage::StorageMode::IN_MEMORY_TRANSACTIONAL &&
+           database.trigger_store()->GetTriggerInfo().empty() && database.streams()->GetStreamInfo().empty() &&
+           !database.ttl().Enabled();
+  };
+
+  std::vector<std::string> to_unload;
+  {
+    auto rd = std::shared_lock{lock_};
+    std::erase_if(idle_since_, [this](const auto &elem) { return !db_handler_.Has(elem.first); });
+    for (auto &[name, db_gk] : db_handler_) {
+      if (name == kDefaultDB) continue;
+      auto db_acc = db_gk.access();
+      if (!db_acc) continue;
+      // Nobody else holds the database, i.e. no session is using it
+      auto idle = db_acc->try_exclusively([&](Database &database) { return can_unload(database); });
+      if (!idle || !idle.value()) {
+        idle_since_.erase(name);
+        continue;
+      }
+      auto [itr, _] = idle_since_.try_emplace(name, now);
+      if (now - itr->second >= default_config_.durability.unload_idle_after) to_unload.push_back(name);
+    }
+  }
+
+  for (const auto &name : to_unload) {
+    idle_since_.erase(name);
+    {
+      // Shorten the recovery, the snapshot is taken outside of the lock since it can take a while
+      auto rd = std::shared_lock{lock_};
+      auto db_acc = db_handler_.Get(name);
+      if (!db_acc) continue;
+      auto *storage = static_cast<storage::InMemoryStorage *>((*db_acc)->storage());
+      if (auto res = storage->CreateSnapshot(replication_coordination_glue::ReplicationRole::MAIN); res.HasError()) {
+        spdlog::warn("Failed to create a snapshot of the idle database {}.", name);
+      }
+    }
+
+    auto load_guard = std::lock_guard{load_lock_};
+    auto wr = std::lock_guard{lock_};
+    const auto conf = db_handler_.GetConfig(name);
+    if (!conf) continue;
+    const auto storage_dir = conf->durability.storage_directory;
+    // Fails if somebody started using the database in the meantime
+    try {
+      if (!db_handler_.TryDelete(name)) continue;
+    } catch (const utils::BasicException &) {
+      continue;
+    }
+    unloaded_.emplace(name, DatabaseToRestore{.name = name,
+                                              .uuid = conf->salient.uuid,
+                                              .rel_dir = std::filesystem::relative(
+                                                  storage_dir, default_config_.durability.storage_directory)});
+    spdlog::info("Idle database {} unloaded.", name);
+  }
+}
+
+DatabaseAccess DbmsHandler::Load_(std::string_view name) {
+  // Loads are serialized; whoever waited for the same database finds it loaded
+  auto load_guard = std::lock_guard{load_lock_};
+  DatabaseToRestore database;
+  {
+    auto rd = std::shared_lock{lock_};
+    auto itr = unloaded_.find(name);
+    if (itr == unloaded_.end()) return Get_(name);
+    database = itr->second;
+  }
+
+  // Only the sessions accessing this database wait for it
+  spdlog::info("Loading idle database {} at {}.", database.name, database.rel_dir);
+  auto loaded = utils::Gatekeeper<Database>{DatabaseConfig_(database.name, database.uuid, database.rel_dir),
+                                            repl_state_};
+
+  auto wr = std::lock_guard{lock_};
+  unloaded_.erase(unloaded_.find(name));
+  auto new_db = db_handler_.Add(name, std::move(loaded));
+  MG_ASSERT(!new_db.HasError(), "Failed while loading database {}.", name);
+  spdlog::info("Database {} loaded.", name);
+  return new_db.GetValue();
+}
+
+void DbmsHandler::LoadIfUnloaded_(std::string_view name) {
+  {
+    auto rd = std::shared_lock{lock_};
+    if (!unloaded_.contains(name)) return;
+  }
+  (void)Load_(name);
+}
+
+void DbmsHandler::LoadAll_() {
+  std::vector<std::string> names;
+  {
+    auto rd = std::shared_lock{lock_};
+    for (const auto &[name, _] : unloaded_) names.push_back(name);
+  }
+  for (const auto &name : names) LoadIfUnloaded_(name);
 }
 
 struct DropDatabase : memgraph::system::ISystemAction {
@@ -270,6 +453,8 @@ struct DropDatabase : memgraph::system::ISystemAction {
 };
 
 DbmsHandler::DeleteResult DbmsHandler::TryDelete(std::string_view db_name, system::Transaction *transaction) {
+  // Unloaded databases are dropped the same way as the loaded ones
+  LoadIfUnloaded_(db_name);
   auto wr = std::lock_guard{lock_};
   if (db_name == kDefaultDB) {
     // MSG cannot delete the default db
@@ -314,11 +499,17 @@ DbmsHandler::DeleteResult DbmsHandler::TryDelete(std::string_view db_name, syste
 }
 
 DbmsHandler::DeleteResult DbmsHandler::Delete(std::string_view db_name) {
+  LoadIfUnloaded_(db_name);
   auto wr = std::lock_guard(lock_);
   return Delete_(db_name);
 }
 
 DbmsHandler::DeleteResult DbmsHandler::Delete(utils::UUID uuid) {
+  try {
+    (void)Get(uuid);  // Loads the database if it was unloaded
+  } catch (const UnknownDatabaseException &) {
+    return DeleteError::NON_EXISTENT;
+  }
   auto wr = std::lock_guard(lock_);
   std::string db_name;
   try {
@@ -13,8 +13,10 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <filesystem>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -34,6 +36,7 @@
 #include "storage/v2/config.hpp"
 #include "storage/v2/transaction.hpp"
 #include "system/system.hpp"
+#include "utils/scheduler.hpp"
 #include "utils/thread_pool.hpp"
 #ifdef MG_ENTERPRISE
 #include "coordination/coordinator_state.hpp"
@@ -141,6 +144,7 @@ class DbmsHandler {
    */
   NewResultT New(const std::string &name, system::Transaction *txn = nullptr) {
     auto wr = std::lock_guard{lock_};
+    if (unloaded_.contains(name)) return NewError::EXISTS;
     const auto uuid = utils::UUID{};
     return New_(name, uuid, txn);
   }
@@ -153,6 +157,7 @@ class DbmsHandler {
    * @return NewResultT context on success, error on failure
    */
   NewResultT Update(const storage::SalientConfig &config) {
+    LoadIfUnloaded_(config.name);
     auto wr = std::lock_guard{lock_};
     auto new_db = New_(config);
     if (new_db.HasValue() || new_db.GetError() != NewError::EXISTS) {
@@ -205,8 +210,12 @@ class DbmsHandler {
    * @throw UnknownDatabaseException if database not found
    */
   DatabaseAccess Get(std::string_view name = kDefaultDB) {
-    auto rd = std::shared_lock{lock_};
-    return Get_(name);
+    {
+      auto rd = std::shared_lock{lock_};
+      if (!unloaded_.contains(name)) return Get_(name);
+    }
+    // Waits for the idle database to be loaded back
+    return Load_(name);
   }
 
   /**
@@ -217,8 +226,14 @@ class DbmsHandler {
    * @throw UnknownDatabaseException if database not found
    */
   DatabaseAccess Get(const utils::UUID &uuid) {
-    auto rd = std::shared_lock{lock_};
-    return Get_(uuid);
+    std::string unloaded_name;
+    {
+      auto rd = std::shared_lock{lock_};
+      auto itr = std::ranges::find_if(unloaded_, [&uuid](const auto &elem) { return elem.second.uuid == uuid; });
+      if (itr == unloaded_.end()) return Get_(uuid);
+      unloaded_name = itr->first;
+    }
+    return Load_(unloaded_name);
   }
 
 #else
@@ -268,12 +283,27 @@ class DbmsHandler {
   std::vector<std::string> All() const {
 #ifdef MG_ENTERPRISE
     auto rd = std::shared_lock{lock_};
-    return db_handler_.All();
+    auto all = db_handler_.All();
+    for (const auto &[name, _] : unloaded_) all.push_back(name);
+    return all;
 #else
     return {db_gatekeeper_.access()->get()->name()};
 #endif
   }
 
+#ifdef MG_ENTERPRISE
+  /**
+   * @brief Check if the database was unloaded for being idle, it is loaded back on its next access.
+   *
+   * @param name database name
+   * @return true if the database is not in memory
+   */
+  bool IsUnloaded(std::string_view name) const {
+    auto rd = std::shared_lock{lock_};
+    return unloaded_.contains(name);
+  }
+#endif
+
   replication::ReplicationState &ReplicationState() { return repl_state_; }
   replication::ReplicationState const &ReplicationState() const { return repl_state_; }
 
@@ -288,7 +318,7 @@ class DbmsHandler {
   auto Count() const -> std::size_t {
 #ifdef MG_ENTERPRISE
     auto rd = std::shared_lock{lock_};
-    return db_handler_.size();
+    return db_handler_.size() + unloaded_.size();
 #else
     return 1;
 #endif
@@ -302,35 +332,25 @@ class DbmsHandler {
   Statistics Stats() {
     Statistics stats{};
     // TODO: Handle overflow?
-#ifdef MG_ENTERPRISE
-    auto rd = std::shared_lock{lock_};
-    for (auto &[_, db_gk] : db_handler_) {
-#else
-    {
-      auto &db_gk = db_gatekeeper_;
-#endif
-      auto db_acc_opt = db_gk.access();
-      if (db_acc_opt) {
-        auto &db_acc = *db_acc_opt;
-        const auto &info = db_acc->GetInfo();
-        const auto &storage_info = info.storage_info;
-        stats.num_vertex += storage_info.vertex_count;
-        stats.num_edges += storage_info.edge_count;
-        stats.triggers += info.triggers;
-        stats.streams += info.streams;
-        ++stats.num_databases;
-        stats.indices += storage_info.label_indices + storage_info.label_property_indices + storage_info.text_indices;
-        stats.constraints += storage_info.existence_constraints + storage_info.unique_constraints;
-        ++stats.storage_modes[(int)storage_info.storage_mode];
-        ++stats.isolation_levels[(int)storage_info.isolation_level];
-        stats.snapshot_enabled += storage_info.durability_snapshot_enabled;
-        stats.wal_enabled += storage_info.durability_wal_enabled;
-        stats.property_store_compression_enabled += storage_info.property_store_compression_enabled;
-
-        using underlying_type = std::underlying_type_t<utils::CompressionLevel>;
-        ++stats.property_store_compression_level[static_cast<underlying_type>(
-            storage_info.property_store_compression_level)];
-      }
+    for (auto &db_acc : LoadedDatabases_()) {
+      const auto &info = db_acc->GetInfo();
+      const auto &storage_info = info.storage_info;
+      stats.num_vertex += storage_info.vertex_count;
+      stats.num_edges += storage_info.edge_count;
+      stats.triggers += info.triggers;
+      stats.streams += info.streams;
+      ++stats.num_databases;
+      stats.indices += storage_info.label_indices + storage_info.label_property_indices + storage_info.text_indices;
+      stats.constraints += storage_info.existence_constraints + storage_info.unique_constraints;
+      ++stats.storage_modes[(int)storage_info.storage_mode];
+      ++stats.isolation_levels[(int)storage_info.isolation_level];
+      stats.snapshot_enabled += storage_info.durability_snapshot_enabled;
+      stats.wal_enabled += storage_info.durability_wal_enabled;
+      stats.property_store_compression_enabled += storage_info.property_store_compression_enabled;
+
+      using underlying_type = std::underlying_type_t<utils::CompressionLevel>;
+      ++stats.property_store_compression_level[static_cast<underlying_type>(
+          storage_info.property_store_compression_level)];
     }
     return stats;
   }
@@ -342,19 +362,10 @@ class DbmsHandler {
    */
   std::vector<DatabaseInfo> Info() {
     std::vector<DatabaseInfo> res;
-#ifdef MG_ENTERPRISE
-    auto rd = std::shared_lock{lock_};
-    res.reserve(std::distance(db_handler_.cbegin(), db_handler_.cend()));
-    for (auto &[_, db_gk] : db_handler_) {
-#else
-    {
-      auto &db_gk = db_gatekeeper_;
-#endif
-      auto db_acc_opt = db_gk.access();
-      if (db_acc_opt) {
-        auto &db_acc = *db_acc_opt;
-        res.push_back(db_acc->GetInfo());
-      }
+    auto db_accs = LoadedDatabases_();
+    res.reserve(db_accs.size());
+    for (auto &db_acc : db_accs) {
+      res.push_back(db_acc->GetInfo());
     }
     return res;
   }
@@ -427,11 +438,23 @@ class DbmsHandler {
 #endif
 
   /**
-   * @brief todo
+   * @brief Call f for every database, the idle databases which were unloaded are loaded back first.
    *
    * @param f
    */
   void ForEach(std::invocable<DatabaseAccess> auto f) {
+#ifdef MG_ENTERPRISE
+    LoadAll_();
+#endif
+    ForEachLoaded(std::move(f));
+  }
+
+  /**
+   * @brief Call f for every database currently in memory.
+   *
+   * @param f
+   */
+  void ForEachLoaded(std::invocable<DatabaseAccess> auto f) {
 #ifdef MG_ENTERPRISE
     auto rd = std::shared_lock{lock_};
     for (auto &[_, db_gk] : db_handler_) {
@@ -484,17 +507,100 @@ class DbmsHandler {
    */
   NewResultT New_(std::string_view name, utils::UUID uuid, system::Transaction *txn = nullptr,
                   std::optional<std::filesystem::path> rel_dir = {}) {
+    spdlog::debug("Creating database '{}' - '{}'", name, std::string{uuid});
+    return New_(DatabaseConfig_(name, uuid, rel_dir), txn);
+  }
+
+  /**
+   * @brief Storage configuration of the "name" database
+   *
+   * @param name name of the database
+   * @param uuid undelying RocksDB directory
+   * @param rel_dir directory relative to the root storage directory, defaults to the multi-tenant directory
+   * @return storage::Config
+   */
+  storage::Config DatabaseConfig_(std::string_view name, utils::UUID uuid,
+                                  const std::optional<std::filesystem::path> &rel_dir) const {
     auto config_copy = default_config_;
     config_copy.salient.name = name;
     config_copy.salient.uuid = uuid;
-    spdlog::debug("Creating database '{}' - '{}'", name, std::string{uuid});
     if (rel_dir) {
       storage::UpdatePaths(config_copy, default_config_.durability.storage_directory / *rel_dir);
     } else {
       storage::UpdatePaths(config_copy,
                            default_config_.durability.storage_directory / kMultiTenantDir / std::string{uuid});
     }
-    return New_(std::move(config_copy), txn);
+    return config_copy;
+  }
+
+#ifdef MG_ENTERPRISE
+  struct DatabaseToRestore {
+    std::string name;
+    utils::UUID uuid;
+    std::filesystem::path rel_dir;
+  };
+
+  /**
+   * @brief Recover the databases from their durability files, concurrently.
+   *
+   * The recovery threads (storage_recovery_thread_count) are shared: as many databases as there are threads are
+   * recovered at the same time, each with its share of the threads. Databases are registered as they finish.
+   *
+   * @param databases databases found in the durability list
+   */
+  void RestoreDatabases_(const std::vector<DatabaseToRestore> &databases);
+
+  /**
+   * @brief Unload the databases nobody accessed for storage_unload_idle_databases_sec to their durability files.
+   *
+   * Only databases fully covered by their snapshots and WALs, without triggers, streams or TTL, are unloaded, and
+   * only while the instance is MAIN without replicas.
+   */
+  void UnloadIdleDatabases_();
+
+  /**
+   * @brief Recover an unloaded database and make it available again.
+   *
+   * @param name database name
+   * @return DatabaseAccess
+   * @throw UnknownDatabaseException if database not found
+   */
+  DatabaseAccess Load_(std::string_view name);
+
+  /**
+   * @brief Load the database if it was unloaded.
+   *
+   * @param name database name
+   */
+  void LoadIfUnloaded_(std::string_view name);
+
+  /**
+   * @brief Load all unloaded databases.
+   */
+  void LoadAll_();
+#endif
+
+  /**
+   * @brief Access all databases currently in memory.
+   *
+   * The lock is released before the accessors are returned, so reading the databases doesn't hold up creating and
+   * deleting the others.
+   *
+   * @return std::vector<DatabaseAccess>
+   */
+  std::vector<DatabaseAccess> LoadedDatabases_() {
+    std::vector<DatabaseAccess> res;
+#ifdef MG_ENTERPRISE
+    auto rd = std::shared_lock{lock_};
+    for (auto &[_, db_gk] : db_handler_) {
+#else
+    {
+      auto &db_gk = db_gatekeeper_;
+#endif
+      auto db_acc_opt = db_gk.access();
+      if (db_acc_opt) res.push_back(std::move(*db_acc_opt));
+    }
+    return res;
   }
 
   /**
@@ -626,6 +732,11 @@ class DbmsHandler {
   // TODO: move to be common
   std::unique_ptr<kvstore::KVStore> durability_;  //!< list of active dbs (pointer so we can postpone its creation)
   auth::SynchedAuth &auth_;                       //!< Synchronized auth::Auth
+  std::map<std::string, DatabaseToRestore, std::less<>> unloaded_;  //!< Idle databases to load on first access
+  std::mutex load_lock_;  //!< Serializes loading; taken before lock_
+  std::map<std::string, std::chrono::steady_clock::time_point, std::less<>>
+      idle_since_;                  //!< Only used by the unloader
+  utils::Scheduler idle_unloader_;  //!< Periodically unloads idle databases; has to be destroyed first
 #endif
  private:
   // NOTE: atm the only reason this exists here, is because we pass it into the construction of New Database's
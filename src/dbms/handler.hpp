@@ -65,6 +65,24 @@ class Handler {
     return NewError::EXISTS;
   }
 
+  /**
+   * @brief Add a context constructed beforehand, e.g. on another thread.
+   *
+   * @param name Name associated with the new T
+   * @param item The constructed context
+   * @return NewResult
+   */
+  NewResult Add(std::string_view name, utils::Gatekeeper<T> item) {
+    if (!Has(name)) {
+      auto [itr, _] = items_.emplace(std::string{name}, std::move(item));
+      auto db_acc = itr->second.access();
+      if (db_acc) return std::move(*db_acc);
+      return NewError::DEFUNCT;
+    }
+    spdlog::info("Item with name \"{}\" already exists.", name);
+    return NewError::EXISTS;
+  }
+
   /**
    * @brief Get pointer to context.
    *
@@ -125,7 +143,7 @@ class Handler {
         gk.~Gatekeeper<T>();
         post_delete_func();
       };
-      defer_pool_.AddTask(utils::CopyMovableFunctionWrapper{std::move(task)});
+      defer_pool_.AddTask(std::move(task));
     }
     // In any case remove from handled map
     items_.erase(itr);
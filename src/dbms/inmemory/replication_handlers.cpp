@@ -21,10 +21,18 @@
 #include "storage/v2/indices/label_index_stats.hpp"
 #include "storage/v2/inmemory/storage.hpp"
 #include "storage/v2/inmemory/unique_constraints.hpp"
+#include "utils/string.hpp"
 
 #include <spdlog/spdlog.h>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
+#include <exception>
+#include <mutex>
 #include <optional>
+#include <stop_token>
+#include <thread>
+#include <vector>
 
 using memgraph::replication_coordination_glue::ReplicationRole;
 using memgraph::storage::Delta;
@@ -53,6 +61,97 @@ std::pair<uint64_t, WalDeltaData> ReadDelta(storage::durability::BaseDecoder *de
   }
 };
 
+/// Reads the deltas of one transaction. The first batch of deltas is read on
+/// the caller's thread; if the transaction doesn't end within it, the rest are
+/// decoded on a separate thread while the caller applies the ones already
+/// read, so the property values of large transactions are decoded in parallel
+/// with their application. The deltas are returned in the order they were
+/// sent and no delta after the end of the transaction is read from the
+/// decoder.
+class TransactionDeltaReader {
+ public:
+  using TimestampedDelta = std::pair<uint64_t, WalDeltaData>;
+
+  TransactionDeltaReader(storage::durability::BaseDecoder *decoder, uint64_t version)
+      : decoder_(decoder), version_(version) {}
+
+  TransactionDeltaReader(const TransactionDeltaReader &) = delete;
+  TransactionDeltaReader &operator=(const TransactionDeltaReader &) = delete;
+  TransactionDeltaReader(TransactionDeltaReader &&) = delete;
+  TransactionDeltaReader &operator=(TransactionDeltaReader &&) = delete;
+  ~TransactionDeltaReader() = default;
+
+  /// Must not be called after the delta ending the transaction was returned.
+  /// @throw utils::BasicException if the delta couldn't be decoded
+  TimestampedDelta Next() {
+    if (next_ == batch_.size()) Refill();
+    return std::move(batch_[next_++]);
+  }
+
+ private:
+  static constexpr size_t kBatchSize = 1024;
+  static constexpr size_t kMaxQueuedBatches = 4;
+
+  // Returns true if the batch ends the transaction.
+  bool ReadBatch(std::vector<TimestampedDelta> *batch) {
+    batch->reserve(kBatchSize);
+    while (batch->size() < kBatchSize) {
+      const auto &delta = batch->emplace_back(ReadDelta(decoder_)).second;
+      if (storage::durability::IsWalDeltaDataTypeTransactionEnd(delta.type, version_)) return true;
+    }
+    return false;
+  }
+
+  void Refill() {
+    batch_.clear();
+    next_ = 0;
+    if (!read_first_batch_) {
+      read_first_batch_ = true;
+      if (!ReadBatch(&batch_)) {
+        decoder_thread_ = std::jthread([this](std::stop_token token) { Decode(token); });
+      }
+      return;
+    }
+    MG_ASSERT(decoder_thread_.joinable(), "Read past the end of the transaction");
+    std::unique_lock lock(mutex_);
+    cv_.wait(lock, [this] { return !batches_.empty() || error_; });
+    if (batches_.empty()) std::rethrow_exception(error_);
+    batch_ = std::move(batches_.front());
+    batches_.pop_front();
+    cv_.notify_all();
+  }
+
+  void Decode(std::stop_token token) {
+    try {
+      for (bool transaction_complete = false; !transaction_complete;) {
+        std::vector<TimestampedDelta> batch;
+        transaction_complete = ReadBatch(&batch);
+        std::unique_lock lock(mutex_);
+        if (!cv_.wait(lock, token, [this] { return batches_.size() < kMaxQueuedBatches; })) return;
+        batches_.push_back(std::move(batch));
+        cv_.notify_all();
+      }
+    } catch (...) {
+      auto guard = std::lock_guard{mutex_};
+      error_ = std::current_exception();
+      cv_.notify_all();
+    }
+  }
+
+  storage::durability::BaseDecoder *decoder_;
+  uint64_t version_;
+  std::vector<TimestampedDelta> batch_;
+  size_t next_{0};
+  bool read_first_batch_{false};
+
+  std::mutex mutex_;
+  std::condition_variable_any cv_;
+  std::deque<std::vector<TimestampedDelta>> batches_;
+  std::exception_ptr error_;
+  // Declared last so it is stopped and joined before the queue is destroyed.
+  std::jthread decoder_thread_;
+};
+
 std::optional<DatabaseAccess> GetDatabaseAccessor(dbms::DbmsHandler *dbms_handler, const utils::UUID &uuid) {
   try {
 #ifdef MG_ENTERPRISE
@@ -104,6 +203,11 @@ void InMemoryReplicationHandlers::Register(dbms::DbmsHandler *dbms_handler, repl
         spdlog::debug("Received SnapshotRpc");
         InMemoryReplicationHandlers::SnapshotHandler(dbms_handler, data.uuid_, req_reader, res_builder);
       });
+  server.rpc_server_.Register<storage::replication::SnapshotBlockHashesRpc>(
+      [&data, dbms_handler](auto *req_reader, auto *res_builder) {
+        spdlog::debug("Received SnapshotBlockHashesRpc");
+        InMemoryReplicationHandlers::SnapshotBlockHashesHandler(dbms_handler, data.uuid_, req_reader, res_builder);
+      });
   server.rpc_server_.Register<storage::replication::WalFilesRpc>(
       [&data, dbms_handler](auto *req_reader, auto *res_builder) {
         spdlog::debug("Received WalFilesRpc");
@@ -268,20 +372,33 @@ void InMemoryReplicationHandlers::SnapshotHandler(dbms::DbmsHandler *dbms_handle
   auto *storage = static_cast<storage::InMemoryStorage *>(db_acc->get()->storage());
   utils::EnsureDirOrDie(storage->recovery_.snapshot_directory_);
 
-  const auto maybe_snapshot_path = decoder.ReadFile(storage->recovery_.snapshot_directory_);
-  MG_ASSERT(maybe_snapshot_path, "Failed to load snapshot!");
+  const auto maybe_snapshot_path =
+      req.base_snapshot.empty()
+          ? decoder.ReadFile(storage->recovery_.snapshot_directory_)
+          : decoder.ReadFileDiff(storage->recovery_.snapshot_directory_,
+                                 storage->recovery_.snapshot_directory_ / req.base_snapshot);
+  if (!maybe_snapshot_path) {
+    // The base snapshot was deleted since its blocks were hashed, main sends the whole snapshot next time.
+    spdlog::error("Failed to receive snapshot based on {}", req.base_snapshot);
+    const storage::replication::SnapshotRes res{false, 0};
+    slk::Save(res, res_builder);
+    return;
+  }
   spdlog::info("Received snapshot saved to {}", *maybe_snapshot_path);
 
   auto storage_guard = std::unique_lock{storage->main_lock_};
   spdlog::trace("Clearing database since recovering from snapshot.");
   // Clear the database
+  if (storage->vertex_gid_table_) storage->vertex_gid_table_->Clear();
   storage->vertices_.clear();
   storage->edges_.clear();
 
   storage->constraints_.existence_constraints_ = std::make_unique<storage::ExistenceConstraints>();
-  storage->constraints_.unique_constraints_ = std::make_unique<storage::InMemoryUniqueConstraints>();
+  storage->constraints_.unique_constraints_ = std::make_unique<storage::InMemoryUniqueConstraints>(
+      storage->config_.indices.hash_unique_constraints);
   storage->indices_.label_index_ = std::make_unique<storage::InMemoryLabelIndex>();
   storage->indices_.label_property_index_ = std::make_unique<storage::InMemoryLabelPropertyIndex>();
+  storage->indices_.label_property_composite_index_.DropGraphClearIndices();
   try {
     spdlog::debug("Loading snapshot");
     auto recovered_snapshot = storage::durability::LoadSnapshot(
@@ -298,6 +415,7 @@ void InMemoryReplicationHandlers::SnapshotHandler(dbms::DbmsHandler *dbms_handle
     storage->edge_id_ = recovery_info.next_edge_id;
     storage->timestamp_ = std::max(storage->timestamp_, recovery_info.next_timestamp);
     storage->repl_storage_state_.last_durable_timestamp_ = recovery_info.next_timestamp - 1;
+    storage->repl_storage_state_.PublishEpoch();
 
     // Reset WAL chain
     storage->wal_seq_num_ = 0;
@@ -342,6 +460,40 @@ void InMemoryReplicationHandlers::SnapshotHandler(dbms::DbmsHandler *dbms_handle
   spdlog::debug("Replication recovery from snapshot finished!");
 }
 
+void InMemoryReplicationHandlers::SnapshotBlockHashesHandler(dbms::DbmsHandler *dbms_handler,
+                                                             const std::optional<utils::UUID> &current_main_uuid,
+                                                             slk::Reader *req_reader, slk::Builder *res_builder) {
+  storage::replication::SnapshotBlockHashesReq req;
+  slk::Load(&req, req_reader);
+  auto db_acc = GetDatabaseAccessor(dbms_handler, req.uuid);
+  if (!db_acc) {
+    const storage::replication::SnapshotBlockHashesRes res{false, {}, {}};
+    slk::Save(res, res_builder);
+    return;
+  }
+  if (!current_main_uuid.has_value() || req.main_uuid != current_main_uuid) [[unlikely]] {
+    LogWrongMain(current_main_uuid, req.main_uuid, storage::replication::SnapshotBlockHashesReq::kType.name);
+    const storage::replication::SnapshotBlockHashesRes res{false, {}, {}};
+    slk::Save(res, res_builder);
+    return;
+  }
+
+  auto *storage = static_cast<storage::InMemoryStorage *>(db_acc->get()->storage());
+  // Snapshots of any database can be the base, the hashes show which blocks are equal.
+  auto snapshot_files = storage::durability::GetSnapshotFiles(storage->recovery_.snapshot_directory_);
+  if (snapshot_files.empty()) {
+    const storage::replication::SnapshotBlockHashesRes res{true, {}, {}};
+    slk::Save(res, res_builder);
+    return;
+  }
+  const auto &path = snapshot_files.back().path;
+  auto hashes = storage::replication::HashFileBlocks(path);
+  spdlog::debug("Hashed {} blocks of snapshot {}", hashes.size(), path);
+  const storage::replication::SnapshotBlockHashesRes res{true, hashes.empty() ? "" : path.filename().string(),
+                                                         std::move(hashes)};
+  slk::Save(res, res_builder);
+}
+
 void InMemoryReplicationHandlers::ForceResetStorageHandler(dbms::DbmsHandler *dbms_handler,
                                                            const std::optional<utils::UUID> &current_main_uuid,
                                                            slk::Reader *req_reader, slk::Builder *res_builder) {
@@ -367,13 +519,15 @@ void InMemoryReplicationHandlers::ForceResetStorageHandler(dbms::DbmsHandler *db
   auto storage_guard = std::unique_lock{storage->main_lock_};
 
   // Clear the database
+  if (storage->vertex_gid_table_) storage->vertex_gid_table_->Clear();
   storage->vertices_.clear();
   storage->edges_.clear();
   storage->commit_log_.reset();
   storage->commit_log_.emplace();
 
   storage->constraints_.existence_constraints_ = std::make_unique<storage::ExistenceConstraints>();
-  storage->constraints_.unique_constraints_ = std::make_unique<storage::InMemoryUniqueConstraints>();
+  storage->constraints_.unique_constraints_ = std::make_unique<storage::InMemoryUniqueConstraints>(
+      storage->config_.indices.hash_unique_constraints);
   storage->indices_.label_index_ = std::make_unique<storage::InMemoryLabelIndex>();
   storage->indices_.label_property_index_ = std::make_unique<storage::InMemoryLabelPropertyIndex>();
 
@@ -383,6 +537,7 @@ void InMemoryReplicationHandlers::ForceResetStorageHandler(dbms::DbmsHandler *db
   storage->repl_storage_state_.last_durable_timestamp_ = 0;
 
   storage->repl_storage_state_.history.clear();
+  storage->repl_storage_state_.PublishEpoch();
   storage->vertex_id_ = 0;
   storage->edge_id_ = 0;
   storage->timestamp_ = storage::kTimestampInitialId;
@@ -593,8 +748,9 @@ uint64_t InMemoryReplicationHandlers::ReadAndApplyDeltas(storage::InMemoryStorag
   uint64_t applied_deltas = 0;     // Non-skipped deltas
   auto max_delta_timestamp = storage->repl_storage_state_.last_durable_timestamp_.load();
   auto current_durable_commit_timestamp = max_delta_timestamp;
+  TransactionDeltaReader delta_reader(decoder, version);
   for (bool transaction_complete = false; !transaction_complete; ++current_delta_idx) {
-    const auto [delta_timestamp, delta] = ReadDelta(decoder);
+    const auto [delta_timestamp, delta] = delta_reader.Next();
     if (delta_timestamp > max_delta_timestamp) {
       max_delta_timestamp = delta_timestamp;
     }
@@ -724,7 +880,7 @@ uint64_t InMemoryReplicationHandlers::ReadAndApplyDeltas(storage::InMemoryStorag
           bool is_visible = true;
           Delta *delta = nullptr;
           {
-            auto guard = std::shared_lock{edge->lock};
+            auto guard = std::shared_lock{storage::EdgeLock(edge)};
             is_visible = !edge->deleted;
             delta = edge->delta;
           }
@@ -1041,6 +1197,56 @@ uint64_t InMemoryReplicationHandlers::ReadAndApplyDeltas(storage::InMemoryStorag
         }
         break;
       }
+      case WalDeltaData::Type::VECTOR_INDEX_CREATE: {
+        auto const &[label, property, dimension] = delta.operation_vector_index;
+        spdlog::trace("       Create vector index on :{}({}) with dimension {}", label, property, dimension);
+        auto *transaction = get_transaction_accessor(delta_timestamp, kUniqueAccess);
+        auto labelId = storage->NameToLabel(label);
+        auto propId = storage->NameToProperty(property);
+        auto res = transaction->CreateVectorIndex({labelId, propId, dimension});
+        if (res.HasError()) {
+          throw utils::BasicException("Invalid transaction! Please raise an issue, {}:{}", __FILE__, __LINE__);
+        }
+        break;
+      }
+      case WalDeltaData::Type::VECTOR_INDEX_DROP: {
+        auto const &[label, property] = delta.operation_label_property;
+        spdlog::trace("       Drop vector index on :{}({})", label, property);
+        auto *transaction = get_transaction_accessor(delta_timestamp, kUniqueAccess);
+        auto labelId = storage->NameToLabel(label);
+        auto propId = storage->NameToProperty(property);
+        auto res = transaction->DropVectorIndex(labelId, propId);
+        if (res.HasError()) {
+          throw utils::BasicException("Invalid transaction! Please raise an issue, {}:{}", __FILE__, __LINE__);
+        }
+        break;
+      }
+      case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE: {
+        const auto &[label, property_names] = delta.operation_label_property_list;
+        spdlog::trace("       Create composite index on :{}({})", label, utils::Join(property_names, ", "));
+        std::vector<PropertyId> properties;
+        properties.reserve(property_names.size());
+        for (const auto &prop : property_names) {
+          properties.push_back(storage->NameToProperty(prop));
+        }
+        auto *transaction = get_transaction_accessor(delta_timestamp, kUniqueAccess);
+        if (transaction->CreateIndex(storage->NameToLabel(label), properties).HasError())
+          throw utils::BasicException("Invalid transaction! Please raise an issue, {}:{}", __FILE__, __LINE__);
+        break;
+      }
+      case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP: {
+        const auto &[label, property_names] = delta.operation_label_property_list;
+        spdlog::trace("       Drop composite index on :{}({})", label, utils::Join(property_names, ", "));
+        std::vector<PropertyId> properties;
+        properties.reserve(property_names.size());
+        for (const auto &prop : property_names) {
+          properties.push_back(storage->NameToProperty(prop));
+        }
+        auto *transaction = get_transaction_accessor(delta_timestamp, kUniqueAccess);
+        if (transaction->DropIndex(storage->NameToLabel(label), properties).HasError())
+          throw utils::BasicException("Invalid transaction! Please raise an issue, {}:{}", __FILE__, __LINE__);
+        break;
+      }
     }
     applied_deltas++;
   }
@@ -1048,6 +1254,7 @@ uint64_t InMemoryReplicationHandlers::ReadAndApplyDeltas(storage::InMemoryStorag
   if (commit_timestamp_and_accessor) throw utils::BasicException("Did not finish the transaction!");
 
   storage->repl_storage_state_.last_durable_timestamp_ = max_delta_timestamp;
+  storage->repl_storage_state_.NotifyApplied();
 
   spdlog::debug("Applied {} deltas", applied_deltas);
   return current_delta_idx;
@@ -37,6 +37,10 @@ class InMemoryReplicationHandlers {
   static void SnapshotHandler(dbms::DbmsHandler *dbms_handler, const std::optional<utils::UUID> &current_main_uuid,
                               slk::Reader *req_reader, slk::Builder *res_builder);
 
+  static void SnapshotBlockHashesHandler(dbms::DbmsHandler *dbms_handler,
+                                         const std::optional<utils::UUID> &current_main_uuid, slk::Reader *req_reader,
+                                         slk::Builder *res_builder);
+
   static void WalFilesHandler(dbms::DbmsHandler *dbms_handler, const std::optional<utils::UUID> &current_main_uuid,
                               slk::Reader *req_reader, slk::Builder *res_builder);
 
@@ -65,4 +65,10 @@ DEFINE_bool(auth_password_permit_null, true, "Set to false to disable null passw
 DEFINE_string(
     auth_password_strength_regex, memgraph::glue::kDefaultPasswordRegex.data(),
     "The regular expression that should be used to match the entire entered password to ensure its strength.");
+
+DEFINE_uint64(auth_cache_size, 1024,
+              "Number of recently verified credentials remembered so the password hash isn't verified on every "
+              "connection. Set to 0 to disable the cache.");
+
+DEFINE_uint64(auth_cache_ttl_sec, 60, "Time in seconds after which remembered credentials have to be verified again.");
 // NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables,misc-unused-parameters)
@@ -28,4 +28,6 @@ DECLARE_int32(auth_module_timeout_ms);
 DECLARE_string(auth_user_or_role_name_regex);
 DECLARE_bool(auth_password_permit_null);
 DECLARE_string(auth_password_strength_regex);
+DECLARE_uint64(auth_cache_size);
+DECLARE_uint64(auth_cache_ttl_sec);
 // NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
@@ -27,6 +27,17 @@ DEFINE_VALIDATED_int32(bolt_num_workers, std::max(std::thread::hardware_concurre
                        "number of processing units available on the machine.",
                        FLAG_IN_RANGE(1, INT32_MAX));
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_int32(bolt_num_execution_workers, 0,
+                       "Number of workers which execute the queries of the Bolt sessions, so that the Bolt workers "
+                       "only handle the connections. If 0, the queries are executed by the Bolt workers.",
+                       FLAG_IN_RANGE(0, INT32_MAX));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_int32(bolt_long_execution_threshold_ms, 1000,
+                       "Time in milliseconds after which an execution of a Bolt session is considered long. The next "
+                       "message of such a session waits until the messages of the other sessions are executed. Used "
+                       "only with Bolt execution workers.",
+                       FLAG_IN_RANGE(0, INT32_MAX));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_int32(bolt_session_inactivity_timeout, 1800,
                        "Time in seconds after which inactive Bolt sessions will be "
                        "closed.",
@@ -29,6 +29,11 @@ DEFINE_uint32(instance_down_timeout_sec, 5, "Time duration after which an instan
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_uint32(instance_health_check_frequency_sec, 1, "The time duration between two health checks/pings.");
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_double(instance_down_phi_threshold, 0,
+              "Suspicion level at which the phi accrual failure detector considers an instance down before the "
+              "instance down timeout passes. Learned from the intervals between the instance's heartbeats, 8 means a "
+              "chance of 1e-8 that the instance is only slow. If 0, only the timeout is used.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_uint32(instance_get_uuid_frequency_sec, 10, "The time duration between two instance uuid checks.");
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_string(nuraft_log_file, "", "Path to the file where NuRaft logs are saved.");
@@ -67,6 +67,19 @@ DEFINE_bool(allow_load_csv, true, "Controls whether LOAD CSV clause is allowed i
 DEFINE_VALIDATED_uint64(storage_gc_cycle_sec, 30, "Storage garbage collector interval (in seconds).",
                         FLAG_IN_RANGE(1, 24UL * 3600));
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_gc_slice_ms, 0,
+              "Maximum time (in milliseconds) a storage garbage collector slice spends unlinking deltas. The "
+              "collection is split into slices until it catches up. Set to 0 to collect everything in one pass.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_gc_release_threads, 0,
+              "Number of background threads which free the deltas collected by the storage garbage collector. Set "
+              "to 0 to free them on the garbage collector thread.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_analytical_compaction_interval_sec, 0,
+              "Interval (in seconds) of compacting the adjacency lists of the vertices while the storage is in the "
+              "IN_MEMORY_ANALYTICAL mode. The edges are sorted by edge type and neighbour and their unused capacity "
+              "is released. Set to 0 to disable the compaction.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_uint64(storage_python_gc_cycle_sec, 180,
                         "Storage python full garbage collection interval (in seconds).", FLAG_IN_RANGE(1, 24UL * 3600));
 // NOTE: The `storage_properties_on_edges` flag must be the same here and in
@@ -87,6 +100,11 @@ DEFINE_bool(storage_wal_enabled, false,
 DEFINE_VALIDATED_uint64(storage_snapshot_retention_count, 3, "The number of snapshots that should always be kept.",
                         FLAG_IN_RANGE(1, 1000000));
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(storage_snapshot_min_wal_percent, 0,
+                        "Periodic snapshots are skipped while the WAL files written since the latest snapshot are "
+                        "smaller than this percentage of its size. Set to 0 to always create periodic snapshots.",
+                        FLAG_IN_RANGE(0, 1000));
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_uint64(storage_wal_file_size_kib, memgraph::storage::Config::Durability().wal_file_size_kibibytes,
                         "Minimum file size of each WAL file.",
                         FLAG_IN_RANGE(1, static_cast<unsigned long>(1000) * 1024));
@@ -97,12 +115,21 @@ DEFINE_VALIDATED_uint64(storage_wal_file_flush_every_n_tx,
                         "WAL file. Set to 1 for fully synchronous operation.",
                         FLAG_IN_RANGE(1, 1000000));
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_wal_group_commit, false,
+            "Controls whether each commit waits until its WAL records are synced to disk. Concurrent commits share "
+            "a single 'fsync' and storage_wal_file_flush_every_n_tx is ignored.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(storage_snapshot_on_exit, false, "Controls whether the storage creates another snapshot on exit.");
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_uint64(storage_items_per_batch, memgraph::storage::Config::Durability().items_per_batch,
               "The number of edges and vertices stored in a batch in a snapshot file.");
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_snapshot_batch_compression, false,
+            "Controls whether each batch of edges and vertices in a snapshot file is compressed and checksummed. "
+            "The compression level is set by storage_property_store_compression_level.");
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables,misc-unused-parameters)
 DEFINE_VALIDATED_bool(
     storage_parallel_index_recovery, false,
@@ -117,12 +144,78 @@ DEFINE_VALIDATED_bool(
 DEFINE_bool(storage_parallel_schema_recovery, false,
             "Controls whether the indices and constraints creation can be done in a multithreaded fashion.");
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_parallel_snapshot_creation, false,
+            "Controls whether the vertices and edges are written to the snapshot in a multithreaded fashion. The "
+            "number of threads is set by storage_recovery_thread_count.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_parallel_wal_recovery, false,
+            "Controls whether the label and property updates from WAL files are applied in a multithreaded fashion. "
+            "Deltas are replayed in windows of storage_items_per_batch deltas on storage_recovery_thread_count "
+            "threads.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_numa_aware_allocation, false,
+            "Controls whether vertices and edges are allocated from a jemalloc arena per NUMA node, on the node of the "
+            "thread creating them. Pin the workers to nodes to keep the objects they create local.");
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_uint64(storage_recovery_thread_count,
               std::max(static_cast<uint64_t>(std::thread::hardware_concurrency()),
                        memgraph::storage::Config::Durability().recovery_thread_count),
               "The number of threads used to recover persisted data from disk.");
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_unload_idle_databases_sec, 0,
+              "Databases other than the default one which no session used for this many seconds are unloaded from "
+              "memory and recovered on their next use. Requires data recovery on startup and periodic snapshots with "
+              "WAL. 0 keeps all databases loaded.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_index_creation_thread_count, memgraph::storage::Config::Indices().creation_thread_count,
+              "The number of threads used to populate a label or label-property index when it is created.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_index_stats_refresh_interval_sec, 0,
+              "Interval (in seconds) of checking whether the statistics computed by ANALYZE GRAPH are stale and "
+              "recomputing them. Set to 0 to disable the background refresh.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_double(storage_index_stats_refresh_threshold, memgraph::storage::Config::Indices().stats_refresh_threshold,
+              "Fraction of an analyzed index which has to change for its statistics to be recomputed in the "
+              "background.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_unique_constraints_hash_index, memgraph::storage::Config::Indices().hash_unique_constraints,
+            "Controls whether in-memory unique constraints keep their entries in a hash table instead of a skip list, "
+            "which makes validating a commit cheaper.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(storage_vertex_gid_table, memgraph::storage::Config::Indices().vertex_gid_table,
+            "Controls whether in-memory vertices are also kept in an array indexed by their id, so looking a vertex "
+            "up by its id doesn't search the skip list of the vertices.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_disk_block_cache_mib, 0,
+              "Size (in MiB) of the RocksDB block cache shared by the column families of the on-disk storage. Set "
+              "to 0 to keep the default cache of each column family.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_disk_bloom_filter_bits_per_key, 0,
+              "Bits per key of the bloom filters of the on-disk storage column families which are read by key. Set "
+              "to 0 to disable the filters.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_disk_vertex_cache_size, 0,
+              "Number of vertices read by on-disk storage transactions which are kept for the following "
+              "transactions. Set to 0 to disable the cache.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_text_index_refresh_interval_ms, 0,
+              "Interval (in milliseconds) at which the changes of committed transactions are applied to the text "
+              "indices in the background. Set to 0 to apply them at each commit.");
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(storage_enable_schema_metadata, false,
             "Controls whether metadata should be collected about the resident labels and edge types.");
@@ -152,6 +245,20 @@ DEFINE_bool(telemetry_enabled, false,
             "the database runtime (vertex and edge counts and resource usage) "
             "to allow for easier improvement of the product.");
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_string(tracing_otlp_endpoint, "",
+              "Base URL of the OpenTelemetry collector, e.g. http://localhost:4318, which the spans of the sampled "
+              "requests are sent to over OTLP/HTTP. Leave empty to disable the tracing.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(tracing_sample_rate, 100,
+              "Trace 1 in this many of the Bolt requests which each worker thread executes, from decoding the "
+              "messages to the WAL and the replication of the commit. Set to 0 to disable the tracing.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(tracing_export_interval_ms, 1000, "Interval at which the spans are sent to the collector.",
+                        FLAG_IN_RANGE(1, 3600UL * 1000));
+
 // Streams flags
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_uint32(
@@ -162,14 +269,33 @@ DEFINE_uint32(
     stream_transaction_retry_interval, 500,
     "Retry interval in milliseconds when a stream transformation fails to commit because of conflicting transactions");
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(stream_batched_queries, true,
+            "Set to true to run consecutive identical CREATE and MERGE queries of a stream transformation as a single "
+            "query which unwinds their parameters.");
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_string(kafka_bootstrap_servers, "",
               "List of default Kafka brokers as a comma separated list of broker host or host:port.");
 
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_string(pulsar_service_url, "", "Default URL used while connecting to Pulsar brokers.");
 
+// Triggers flags
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(trigger_batch_size, 1,
+              "Number of committed transactions whose AFTER COMMIT triggers run once for their combined changes. Set "
+              "to 1 to run the triggers for each transaction.");
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(trigger_parallel_workers, 1,
+              "Number of threads which run the AFTER COMMIT triggers of a batch of committed transactions "
+              "concurrently, each trigger in its own transaction.");
+
 // Query flags.
 
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(dump_parallel_workers, 1,
+              "Number of threads which generate the vertex and edge statements of DUMP DATABASE. Set to 1 to "
+              "generate them on the thread which runs the query.");
+
 DEFINE_VALIDATED_string(query_modules_directory, "",
                         "Directory where modules with custom query procedures are stored. "
                         "NOTE: Multiple comma-separated directories can be defined.",
@@ -196,6 +322,87 @@ auto memgraph::flags::ParseQueryModulesDirectory() -> std::vector<std::filesyste
   return query_modules_directories;
 }
 
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_string(query_admission_lanes, "",
+              "Lanes which limit the number of concurrently executed queries, separated by ';'. A lane is written "
+              "as <selector>=<max running>[:<queue timeout ms>], where the selector is read, write, read_write, "
+              "db:<name>, user:<name> or role:<name>. A query is admitted through the first lane it matches and "
+              "waits while the lane is full. Queries which match no lane aren't limited.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_execution_batch_size, 0,
+              "Number of rows the operators of read-only queries exchange at a time. Set to 0 to pull the rows one "
+              "at a time.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_fingerprint_metrics_size, 100,
+              "Number of query fingerprints, the hashes of the stripped queries, whose latency, rows, memory peak and "
+              "plan cache hits the metrics endpoint exports. The fingerprints with the fewest executions are "
+              "replaced first. Set to 0 to disable the fingerprint metrics.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_profile_sample_rate, 0,
+              "Profile 1 in this many executions of each query plan and aggregate the time and rows of its "
+              "operators, shown by SHOW PROFILE INFO and the metrics endpoint. The sampled executions pull their "
+              "rows one at a time. Set to 0 to disable the sampling.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_analyze_graph_sample_rate, 0,
+              "Make ANALYZE GRAPH examine 1 in this many vertices of each index and approximate the index "
+              "statistics from them. The vertex counts of the label indices stay exact. Set to 0 or 1 to examine "
+              "all of the vertices.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_string(query_slow_log_file, "",
+              "Path of the file which the Cypher queries running longer than --query_slow_log_threshold_ms are "
+              "logged to as JSON lines, with their plan, parameter sizes and resource usage. The executions sampled "
+              "by --query_profile_sample_rate are logged with their profile. Leave empty to disable the log.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_slow_log_threshold_ms, 1000, "Execution time from which a query is logged to the slow query log.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_slow_log_max_file_size, 100, "Size (in MiB) at which the slow query log file is rotated.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_slow_log_max_files, 5, "Number of rotated slow query log files which are kept.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_max_prepared_statements, 100,
+              "Number of prepared statements a session holds. A query run with the Bolt extra \"prepared\" set to "
+              "true is kept with its plan, and running it again skips parsing and the cache lookups. One statement "
+              "is dropped to make room for a new one when the session holds this many. Set to 0 to disable "
+              "prepared statements.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_spill_rows, 0,
+              "Number of rows ORDER BY keeps in memory before it writes them as a sorted run to a temporary file "
+              "under the data directory. The runs are merged back when the rows are returned. Set to 0 to sort all "
+              "rows in memory.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_load_csv_parallel_workers, 0,
+              "Number of threads which parse the file of LOAD CSV in concurrent chunks. The rows are still created "
+              "in the order of the file. Set to 0 or 1 to parse the file on the query thread.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_analytical_write_workers, 0,
+              "Number of threads which run UNWIND write queries in IN_MEMORY_ANALYTICAL storage mode. The unwound "
+              "list is split into parts which the threads write in transactions of their own. Set to 0 or 1 to "
+              "write on the query thread.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_periodic_commit_delta_budget, 0,
+              "Deltas a batch of USING PERIODIC COMMIT may write before it's committed. With a budget the number of "
+              "the query only sizes the first batch, the next ones are sized by the deltas and the time the "
+              "previous batch took. Set to 0 to disable the budget.");
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_periodic_commit_time_budget_ms, 0,
+              "Time in milliseconds a batch of USING PERIODIC COMMIT may take, including its commit. With a budget "
+              "the number of the query only sizes the first batch, the next ones are sized by the deltas and the "
+              "time the previous batch took. Set to 0 to disable the budget.");
+
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_string(query_callable_mappings_path, "",
               "The path to mappings that describes aliases to callables in cypher queries in the form of key-value "
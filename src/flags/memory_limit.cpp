@@ -21,6 +21,17 @@ DEFINE_uint64(
     "Total memory limit in MiB. Set to 0 to use the default values which are 100\% of the phyisical memory if the swap "
     "is enabled and 90\% of the physical memory otherwise.");
 
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(memory_tracking_batch_kib, 0,
+              "Memory in KiB a thread allocates or frees before it is added to the total and the query memory "
+              "trackers. The memory limits are checked at the same cadence, so each thread can exceed them by this "
+              "amount. Set to 0 to track every allocation directly.");
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(database_memory_limit, 0,
+              "Memory limit of each database in MiB. The queries of a database allocate from a dedicated arena whose "
+              "memory is purged when the database is dropped. Set to 0 to keep the databases on the shared arenas.");
+
 int64_t memgraph::flags::GetMemoryLimit() {
   if (FLAGS_memory_limit == 0) {
     auto maybe_total_memory = memgraph::utils::sysinfo::TotalMemory();
@@ -39,3 +50,11 @@ int64_t memgraph::flags::GetMemoryLimit() {
   // We parse the memory as MiB every time
   return FLAGS_memory_limit * 1024 * 1024;
 }
+
+int64_t memgraph::flags::GetMemoryTrackingBatchSize() {
+  return static_cast<int64_t>(FLAGS_memory_tracking_batch_kib * 1024);
+}
+
+int64_t memgraph::flags::GetDatabaseMemoryLimit() {
+  return static_cast<int64_t>(FLAGS_database_memory_limit * 1024 * 1024);
+}
@@ -14,4 +14,6 @@
 
 namespace memgraph::flags {
 int64_t GetMemoryLimit();
+int64_t GetMemoryTrackingBatchSize();
+int64_t GetDatabaseMemoryLimit();
 }  // namespace memgraph::flags
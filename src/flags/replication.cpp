@@ -19,3 +19,20 @@ DEFINE_uint64(replication_replica_check_frequency_sec, 1,
               "The MAIN instance allocates a new thread for each REPLICA.");
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(replication_restore_state_on_startup, true, "Restore replication state on startup, e.g. recover replica");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(replication_sync_quorum, 0,
+              "Number of SYNC replicas which have to confirm a transaction before its commit is acknowledged. The "
+              "other SYNC replicas confirm it in the background, like ASYNC replicas. If 0, or larger than the number "
+              "of SYNC replicas, all SYNC replicas have to confirm it.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(replication_compression, false,
+            "Compress the deltas, WAL files and snapshots sent to the replicas which are registered while it is set. "
+            "Helps when the network between the instances is slower than the compression.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(replication_bookmark_wait_ms, 10000,
+              "Time a transaction which was started with bookmarks waits for the database to apply the commits the "
+              "bookmarks refer to, before it fails. Lets clients read their own writes from the replicas.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(replication_hot_queries, 32,
+              "Number of the most executed queries the MAIN sends to its replicas, which parse and plan them ahead, "
+              "so a replica promoted to MAIN serves them from warm AST and plan caches. If 0, no queries are sent.");
@@ -28,7 +28,7 @@ namespace memgraph::auth {
 class Auth;
 }
 namespace memgraph::utils {
-class WritePrioritizedRWLock;
+class ShardedRWLock;
 }
 
 struct Context {
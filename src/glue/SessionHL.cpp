@@ -9,6 +9,7 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <memory>
 #include <optional>
 #include <utility>
 #include "auth/auth.hpp"
@@ -30,6 +31,7 @@
 #include "query/query_user.hpp"
 #include "utils/event_map.hpp"
 #include "utils/spin_lock.hpp"
+#include "utils/tracing.hpp"
 #include "utils/variant_helpers.hpp"
 
 namespace memgraph::metrics {
@@ -53,47 +55,35 @@ auto ToQueryExtras(const memgraph::glue::bolt_value_t &extra) -> memgraph::query
     tx_timeout = it->second.ValueInt();
   }
 
-  return memgraph::query::QueryExtras{std::move(metadata_pv), tx_timeout};
-}
-
-class TypedValueResultStreamBase {
- public:
-  explicit TypedValueResultStreamBase(memgraph::storage::Storage *storage);
-
-  void DecodeValues(const std::vector<memgraph::query::TypedValue> &values);
+  auto prepared = false;
+  if (auto const it = as_map.find("prepared"); it != as_map.cend() && it->second.IsBool()) {
+    prepared = it->second.ValueBool();
+  }
 
-  auto AccessValues() const -> std::vector<memgraph::glue::bolt_value_t> const & { return decoded_values_; }
+  auto bookmarks = std::vector<std::string>{};
+  if (auto const it = as_map.find("bookmarks"); it != as_map.cend() && it->second.IsList()) {
+    for (const auto &bookmark : it->second.ValueList()) {
+      if (bookmark.IsString()) bookmarks.push_back(bookmark.ValueString());
+    }
+  }
 
- protected:
-  // NOTE: Needed only for ToBoltValue conversions
-  memgraph::storage::Storage *storage_;
-  std::vector<memgraph::glue::bolt_value_t> decoded_values_;
-};
+  return memgraph::query::QueryExtras{std::move(metadata_pv), tx_timeout, prepared, std::move(bookmarks)};
+}
 
-/// Wrapper around TEncoder which converts TypedValue to Value
-/// before forwarding the calls to original TEncoder.
+/// Wrapper around TEncoder which encodes the TypedValue fields of a record
+/// directly, without converting them to Value first.
 template <typename TEncoder>
-class TypedValueResultStream : public TypedValueResultStreamBase {
+class TypedValueResultStream {
  public:
-  TypedValueResultStream(TEncoder *encoder, memgraph::storage::Storage *storage)
-      : TypedValueResultStreamBase{storage}, encoder_(encoder) {}
-
-  void Result(const std::vector<memgraph::query::TypedValue> &values) {
-    DecodeValues(values);
-    encoder_->MessageRecord(AccessValues());
+  TypedValueResultStream(TEncoder *encoder, memgraph::storage::Storage *storage, int bolt_major_version)
+      : encoder_(encoder), record_encoder_(storage, memgraph::storage::View::NEW) {
+    record_encoder_.UpdateVersion(bolt_major_version);
   }
 
- private:
-  TEncoder *encoder_;
-};
-
-void TypedValueResultStreamBase::DecodeValues(const std::vector<memgraph::query::TypedValue> &values) {
-  decoded_values_.reserve(values.size());
-  decoded_values_.clear();
-  for (const auto &v : values) {
-    auto maybe_value = memgraph::glue::ToBoltValue(v, storage_, memgraph::storage::View::NEW);
-    if (maybe_value.HasError()) {
-      switch (maybe_value.GetError()) {
+  void Result(const std::vector<memgraph::query::TypedValue> &values) {
+    auto result = record_encoder_.Encode(values);
+    if (result.HasError()) {
+      switch (result.GetError()) {
         case memgraph::storage::Error::DELETED_OBJECT:
           throw memgraph::communication::bolt::ClientError("Returning a deleted object as a result.");
         case memgraph::storage::Error::NONEXISTENT_OBJECT:
@@ -104,11 +94,13 @@ void TypedValueResultStreamBase::DecodeValues(const std::vector<memgraph::query:
           throw memgraph::communication::bolt::ClientError("Unexpected storage error when streaming results.");
       }
     }
-    decoded_values_.emplace_back(std::move(*maybe_value));
+    encoder_->MessageRecord(values.size(), record_encoder_.Bytes());
   }
-}
 
-TypedValueResultStreamBase::TypedValueResultStreamBase(memgraph::storage::Storage *storage) : storage_(storage) {}
+ private:
+  TEncoder *encoder_;
+  memgraph::glue::TypedValueRecordEncoder record_encoder_;
+};
 
 #ifdef MG_ENTERPRISE
 void MultiDatabaseAuth(memgraph::query::QueryUserOrRole *user, std::string_view db) {
@@ -229,10 +221,11 @@ bolt_map_t SessionHL::Discard(std::optional<int> n, std::optional<int> qid) {
   }
 }
 bolt_map_t SessionHL::Pull(SessionHL::TEncoder *encoder, std::optional<int> n, std::optional<int> qid) {
+  utils::tracing::ScopedSpan const span("session.pull");
   try {
     auto &db = interpreter_.current_db_.db_acc_;
     auto *storage = db ? db->get()->storage() : nullptr;
-    TypedValueResultStream<TEncoder> stream(encoder, storage);
+    TypedValueResultStream<TEncoder> stream(encoder, storage, version_.major);
     return DecodeSummary(interpreter_.Pull(&stream, n, qid));
   } catch (const memgraph::query::QueryException &e) {
     // Count the number of specific exceptions thrown
@@ -249,14 +242,15 @@ bolt_map_t SessionHL::Pull(SessionHL::TEncoder *encoder, std::optional<int> n, s
 }
 
 std::pair<std::vector<std::string>, std::optional<int>> SessionHL::Interpret(const std::string &query,
-                                                                             const bolt_map_t &params,
+                                                                             storage::PropertyValue::map_t params,
                                                                              const bolt_map_t &extra) {
-  auto get_params_pv = [params](storage::Storage const *storage) -> memgraph::storage::PropertyValue::map_t {
-    auto params_pv = memgraph::storage::PropertyValue::map_t{};
-    params_pv.reserve(params.size());
-    for (const auto &[key, bolt_param] : params) {
-      params_pv.try_emplace(key, ToPropertyValue(bolt_param, storage));
-    }
+  utils::tracing::ScopedSpan const span("session.interpret");
+  // The getter can outlive this call (the fan-out workers call it), so it
+  // shares the decoded parameters instead of referencing them.
+  auto const shared_params = std::make_shared<const storage::PropertyValue::map_t>(std::move(params));
+  auto get_params_pv = [shared_params](storage::Storage const *storage) -> memgraph::storage::PropertyValue::map_t {
+    auto params_pv = *shared_params;
+    if (storage) ResolveMgTypes(&params_pv, storage);
     return params_pv;
   };
 
@@ -265,7 +259,7 @@ std::pair<std::vector<std::string>, std::optional<int>> SessionHL::Interpret(con
     auto &db = interpreter_.current_db_.db_acc_;
     const auto username = user_or_role_ ? (user_or_role_->username() ? *user_or_role_->username() : "") : "";
     audit_log_->Record(fmt::format("{}:{}", endpoint_.address().to_string(), std::to_string(endpoint_.port())),
-                       username, query, params, db ? db->get()->name() : "");
+                       username, query, *shared_params, db ? db->get()->name() : "");
   }
 #endif
   try {
@@ -345,9 +339,12 @@ void SessionHL::RollbackTransaction() {
   }
 }
 
-void SessionHL::CommitTransaction() {
+bolt_map_t SessionHL::CommitTransaction() {
+  utils::tracing::ScopedSpan const span("session.commit");
   try {
-    interpreter_.CommitTransaction();
+    auto bookmark = interpreter_.CommitTransaction();
+    if (!bookmark) return {};
+    return {{"bookmark", memgraph::communication::bolt::Value(std::move(*bookmark))}};
   } catch (const memgraph::query::QueryException &e) {
     // Count the number of specific exceptions thrown
     metrics::IncrementCounter(GetExceptionName(e));
@@ -50,11 +50,12 @@ class SessionHL final : public memgraph::communication::bolt::Session<memgraph::
 
   void BeginTransaction(const bolt_map_t &extra) override;
 
-  void CommitTransaction() override;
+  bolt_map_t CommitTransaction() override;
 
   void RollbackTransaction() override;
 
-  std::pair<std::vector<std::string>, std::optional<int>> Interpret(const std::string &query, const bolt_map_t &params,
+  std::pair<std::vector<std::string>, std::optional<int>> Interpret(const std::string &query,
+                                                                    storage::PropertyValue::map_t params,
                                                                     const bolt_map_t &extra) override;
 
 #ifdef MG_ENTERPRISE
@@ -27,66 +27,36 @@
 #include "utils/variant_helpers.hpp"
 
 #include <algorithm>
-#include <span>
+#include <string>
+#include <vector>
 
 #ifdef MG_ENTERPRISE
 namespace {
-bool IsAuthorizedLabels(const memgraph::auth::UserOrRole &user_or_role, const memgraph::query::DbAccessor *dba,
-                        std::span<memgraph::storage::LabelId const> labels,
-                        const memgraph::query::AuthQuery::FineGrainedPrivilege fine_grained_privilege) {
-  if (!memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
-    return true;
+// Permission bits only use the lowest three bits, so no id can be mapped to this mask.
+constexpr uint8_t kUnresolvedMask = 0xFF;
+
+uint8_t PermissionMask(const memgraph::auth::FineGrainedAccessPermissions &permissions, const std::string &name) {
+  // Same resolution as FineGrainedAccessPermissions::Has
+  const auto &named_permissions = permissions.GetPermissions();
+  if (const auto it = named_permissions.find(name); it != named_permissions.end()) {
+    return static_cast<uint8_t>(it->second & memgraph::auth::kLabelPermissionAll);
   }
-  return std::ranges::all_of(labels, [dba, &user_or_role, fine_grained_privilege](const auto &label) {
-    return std::visit(memgraph::utils::Overloaded{[&](auto &user_or_role) {
-                        return user_or_role.GetFineGrainedAccessLabelPermissions().Has(
-                                   dba->LabelToName(label), memgraph::glue::FineGrainedPrivilegeToFineGrainedPermission(
-                                                                fine_grained_privilege)) ==
-                               memgraph::auth::PermissionLevel::GRANT;
-                      }},
-                      user_or_role);
-  });
+  return static_cast<uint8_t>(permissions.GetGlobalPermission().value_or(0) & memgraph::auth::kLabelPermissionAll);
 }
 
-bool IsAuthorizedGloballyLabels(const memgraph::auth::UserOrRole &user_or_role,
-                                const memgraph::auth::FineGrainedPermission fine_grained_permission) {
-  if (!memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
-    return true;
-  }
-  return std::visit(memgraph::utils::Overloaded{[&](auto &user_or_role) {
-                      return user_or_role.GetFineGrainedAccessLabelPermissions().Has(memgraph::query::kAsterisk,
-                                                                                     fine_grained_permission) ==
-                             memgraph::auth::PermissionLevel::GRANT;
-                    }},
-                    user_or_role);
+template <typename TResolveName>
+bool HasPermission(std::vector<uint8_t> &masks, uint64_t id,
+                   const memgraph::auth::FineGrainedAccessPermissions &permissions, TResolveName &&resolve_name,
+                   const memgraph::auth::FineGrainedPermission fine_grained_permission) {
+  if (id >= masks.size()) masks.resize(id + 1, kUnresolvedMask);
+  auto &mask = masks[id];
+  if (mask == kUnresolvedMask) mask = PermissionMask(permissions, resolve_name());
+  return (mask & static_cast<uint8_t>(fine_grained_permission)) != 0;
 }
 
-bool IsAuthorizedGloballyEdges(const memgraph::auth::UserOrRole &user_or_role,
-                               const memgraph::auth::FineGrainedPermission fine_grained_permission) {
-  if (!memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
-    return true;
-  }
-  return std::visit(memgraph::utils::Overloaded{[&](auto &user_or_role) {
-                      return user_or_role.GetFineGrainedAccessEdgeTypePermissions().Has(memgraph::query::kAsterisk,
-                                                                                        fine_grained_permission) ==
-                             memgraph::auth::PermissionLevel::GRANT;
-                    }},
-                    user_or_role);
-}
-
-bool IsAuthorizedEdgeType(const memgraph::auth::UserOrRole &user_or_role, const memgraph::query::DbAccessor *dba,
-                          const memgraph::storage::EdgeTypeId &edgeType,
-                          const memgraph::query::AuthQuery::FineGrainedPrivilege fine_grained_privilege) {
-  if (!memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
-    return true;
-  }
-  return std::visit(memgraph::utils::Overloaded{[&](auto &user_or_role) {
-                      return user_or_role.GetFineGrainedAccessEdgeTypePermissions().Has(
-                                 dba->EdgeTypeToName(edgeType),
-                                 memgraph::glue::FineGrainedPrivilegeToFineGrainedPermission(fine_grained_privilege)) ==
-                             memgraph::auth::PermissionLevel::GRANT;
-                    }},
-                    user_or_role);
+bool HasGlobalPermission(const memgraph::auth::FineGrainedAccessPermissions &permissions,
+                         const memgraph::auth::FineGrainedPermission fine_grained_permission) {
+  return permissions.Has(memgraph::query::kAsterisk, fine_grained_permission) == memgraph::auth::PermissionLevel::GRANT;
 }
 }  // namespace
 #endif
@@ -187,7 +157,31 @@ bool AuthChecker::IsUserOrRoleAuthorized(const memgraph::auth::UserOrRole &user_
 
 #ifdef MG_ENTERPRISE
 FineGrainedAuthChecker::FineGrainedAuthChecker(auth::UserOrRole user_or_role, const memgraph::query::DbAccessor *dba)
-    : user_or_role_{std::move(user_or_role)}, dba_(dba){};
+    : dba_(dba),
+      label_permissions_{std::visit(
+          [](const auto &user_or_role) -> auth::FineGrainedAccessPermissions {
+            return user_or_role.GetFineGrainedAccessLabelPermissions();
+          },
+          user_or_role)},
+      edge_type_permissions_{std::visit(
+          [](const auto &user_or_role) -> auth::FineGrainedAccessPermissions {
+            return user_or_role.GetFineGrainedAccessEdgeTypePermissions();
+          },
+          user_or_role)} {}
+
+bool FineGrainedAuthChecker::HasLabel(const memgraph::storage::LabelId label,
+                                      const auth::FineGrainedPermission fine_grained_permission) const {
+  return HasPermission(
+      label_masks_, label.AsUint(), label_permissions_,
+      [&]() -> const std::string & { return dba_->LabelToName(label); }, fine_grained_permission);
+}
+
+bool FineGrainedAuthChecker::HasEdgeType(const memgraph::storage::EdgeTypeId edge_type,
+                                         const auth::FineGrainedPermission fine_grained_permission) const {
+  return HasPermission(
+      edge_type_masks_, edge_type.AsUint(), edge_type_permissions_,
+      [&]() -> const std::string & { return dba_->EdgeTypeToName(edge_type); }, fine_grained_permission);
+}
 
 bool FineGrainedAuthChecker::Has(const memgraph::query::VertexAccessor &vertex, const memgraph::storage::View view,
                                  const memgraph::query::AuthQuery::FineGrainedPrivilege fine_grained_privilege) const {
@@ -205,22 +199,29 @@ bool FineGrainedAuthChecker::Has(const memgraph::query::VertexAccessor &vertex,
     }
   }
 
-  return IsAuthorizedLabels(user_or_role_, dba_, *maybe_labels, fine_grained_privilege);
+  return Has(*maybe_labels, fine_grained_privilege);
 }
 
 bool FineGrainedAuthChecker::Has(const memgraph::query::EdgeAccessor &edge,
                                  const memgraph::query::AuthQuery::FineGrainedPrivilege fine_grained_privilege) const {
-  return IsAuthorizedEdgeType(user_or_role_, dba_, edge.EdgeType(), fine_grained_privilege);
+  return Has(edge.EdgeType(), fine_grained_privilege);
 }
 
 bool FineGrainedAuthChecker::Has(const std::vector<memgraph::storage::LabelId> &labels,
                                  const memgraph::query::AuthQuery::FineGrainedPrivilege fine_grained_privilege) const {
-  return IsAuthorizedLabels(user_or_role_, dba_, labels, fine_grained_privilege);
+  if (!memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
+    return true;
+  }
+  const auto fine_grained_permission = FineGrainedPrivilegeToFineGrainedPermission(fine_grained_privilege);
+  return std::ranges::all_of(labels, [&](const auto &label) { return HasLabel(label, fine_grained_permission); });
 }
 
 bool FineGrainedAuthChecker::Has(const memgraph::storage::EdgeTypeId &edge_type,
                                  const memgraph::query::AuthQuery::FineGrainedPrivilege fine_grained_privilege) const {
-  return IsAuthorizedEdgeType(user_or_role_, dba_, edge_type, fine_grained_privilege);
+  if (!memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
+    return true;
+  }
+  return HasEdgeType(edge_type, FineGrainedPrivilegeToFineGrainedPermission(fine_grained_privilege));
 }
 
 bool FineGrainedAuthChecker::HasGlobalPrivilegeOnVertices(
@@ -228,7 +229,7 @@ bool FineGrainedAuthChecker::HasGlobalPrivilegeOnVertices(
   if (!memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
     return true;
   }
-  return IsAuthorizedGloballyLabels(user_or_role_, FineGrainedPrivilegeToFineGrainedPermission(fine_grained_privilege));
+  return HasGlobalPermission(label_permissions_, FineGrainedPrivilegeToFineGrainedPermission(fine_grained_privilege));
 }
 
 bool FineGrainedAuthChecker::HasGlobalPrivilegeOnEdges(
@@ -236,7 +237,8 @@ bool FineGrainedAuthChecker::HasGlobalPrivilegeOnEdges(
   if (!memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
     return true;
   }
-  return IsAuthorizedGloballyEdges(user_or_role_, FineGrainedPrivilegeToFineGrainedPermission(fine_grained_privilege));
+  return HasGlobalPermission(edge_type_permissions_,
+                             FineGrainedPrivilegeToFineGrainedPermission(fine_grained_privilege));
 };
 #endif
 }  // namespace memgraph::glue
@@ -72,8 +72,20 @@ class FineGrainedAuthChecker : public query::FineGrainedAuthChecker {
   bool HasGlobalPrivilegeOnEdges(query::AuthQuery::FineGrainedPrivilege fine_grained_privilege) const override;
 
  private:
-  auth::UserOrRole user_or_role_;
+  bool HasLabel(storage::LabelId label, auth::FineGrainedPermission fine_grained_permission) const;
+
+  bool HasEdgeType(storage::EdgeTypeId edge_type, auth::FineGrainedPermission fine_grained_permission) const;
+
   const query::DbAccessor *dba_;
+  // Permissions of the user merged with the ones of its role, the checker is
+  // created for each query so changes of the role are seen by the next one.
+  auth::FineGrainedAccessPermissions label_permissions_;
+  auth::FineGrainedAccessPermissions edge_type_permissions_;
+  // Permission bits indexed by the label or edge type id, resolved from the
+  // permissions above the first time the id is checked. The checker is only
+  // used by the thread which executes the query.
+  mutable std::vector<uint8_t> label_masks_;
+  mutable std::vector<uint8_t> edge_type_masks_;
 };
 #endif
 }  // namespace memgraph::glue
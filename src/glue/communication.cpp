@@ -11,10 +11,12 @@
 
 #include "glue/communication.hpp"
 
+#include <algorithm>
 #include <map>
 #include <string>
 #include <vector>
 
+#include "communication/bolt/v1/codes.hpp"
 #include "communication/bolt/v1/mg_types.hpp"
 #include "communication/bolt/v1/value.hpp"
 #include "query/graph.hpp"
@@ -26,9 +28,15 @@
 #include "storage/v2/storage.hpp"
 #include "storage/v2/temporal.hpp"
 #include "storage/v2/vertex_accessor.hpp"
+#include "utils/cast.hpp"
 #include "utils/temporal.hpp"
 
 using memgraph::communication::bolt::kMgTypeEnum;
+using memgraph::communication::bolt::Marker;
+using memgraph::communication::bolt::MarkerList;
+using memgraph::communication::bolt::MarkerMap;
+using memgraph::communication::bolt::MarkerString;
+using memgraph::communication::bolt::Signature;
 using memgraph::communication::bolt::kMgTypeType;
 using memgraph::communication::bolt::kMgTypeValue;
 using memgraph::communication::bolt::MgType;
@@ -55,6 +63,36 @@ auto BoltMapToMgType(bolt_map_t const &value, storage::Storage const *storage)
   return std::nullopt;
 }
 
+auto PropertyMapToMgType(storage::PropertyValue::map_t const &value, storage::Storage const *storage)
+    -> std::optional<storage::PropertyValue> {
+  auto info = communication::bolt::PropertyMapToMgTypeInfo(value);
+  if (!info) return std::nullopt;
+
+  auto const &[type, _, mg_value] = *info;
+  switch (type) {
+    case MgType::Enum: {
+      if (!storage) return std::nullopt;
+      auto enum_val = storage->enum_store_.ToEnum(mg_value);
+      if (enum_val.HasError()) return std::nullopt;
+      return storage::PropertyValue(*enum_val);
+    }
+  }
+  return std::nullopt;
+}
+
+void ResolveMgTypes(storage::PropertyValue *value, storage::Storage const *storage) {
+  if (value->IsList()) {
+    for (auto &element : value->ValueList()) ResolveMgTypes(&element, storage);
+  } else if (value->IsMap()) {
+    auto mg_type = PropertyMapToMgType(value->ValueMap(), storage);
+    if (mg_type) {
+      *value = std::move(*mg_type);
+      return;
+    }
+    ResolveMgTypes(&value->ValueMap(), storage);
+  }
+}
+
 query::TypedValue ToTypedValue(const Value &value, storage::Storage const *storage) {
   switch (value.type()) {
     case Value::Type::Null:
@@ -300,6 +338,10 @@ storage::Result<bolt_map_t> ToBoltGraph(const query::Graph &graph, const storage
   return std::move(map);
 }
 
+void ResolveMgTypes(storage::PropertyValue::map_t *params, storage::Storage const *storage) {
+  for (auto &[_, value] : *params) ResolveMgTypes(&value, storage);
+}
+
 storage::PropertyValue ToPropertyValue(communication::bolt::Value const &value, storage::Storage const *storage) {
   switch (value.type()) {
     case Value::Type::Null:
@@ -432,4 +474,301 @@ Value ToBoltValue(const storage::PropertyValue &value, const storage::Storage &s
   }
 }
 
+TypedValueRecordEncoder::TypedValueRecordEncoder(const storage::Storage *db, storage::View view)
+    : db_(db), view_(view) {}
+
+void TypedValueRecordEncoder::UpdateVersion(int major_v) {
+  major_v_ = major_v;
+  encoder_.UpdateVersion(major_v);
+}
+
+storage::Result<void> TypedValueRecordEncoder::Encode(const std::vector<query::TypedValue> &values) {
+  buffer_.bytes.clear();
+  for (const auto &value : values) {
+    if (auto result = WriteValue(value); result.HasError()) return result.GetError();
+  }
+  return {};
+}
+
+storage::Result<void> TypedValueRecordEncoder::WriteValue(const query::TypedValue &value) {
+  auto check_db = [this]() {
+    if (db_ == nullptr) [[unlikely]]
+      throw communication::bolt::ValueException("Database needed for TypeValue conversion.");
+  };
+
+  switch (value.type()) {
+    case query::TypedValue::Type::Null:
+      encoder_.WriteNull();
+      return {};
+    case query::TypedValue::Type::Bool:
+      encoder_.WriteBool(value.ValueBool());
+      return {};
+    case query::TypedValue::Type::Int:
+      encoder_.WriteInt(value.ValueInt());
+      return {};
+    case query::TypedValue::Type::Double:
+      encoder_.WriteDouble(value.ValueDouble());
+      return {};
+    case query::TypedValue::Type::String:
+      WriteString(value.ValueString());
+      return {};
+    case query::TypedValue::Type::Date:
+      encoder_.WriteDate(value.ValueDate());
+      return {};
+    case query::TypedValue::Type::LocalTime:
+      encoder_.WriteLocalTime(value.ValueLocalTime());
+      return {};
+    case query::TypedValue::Type::LocalDateTime:
+      encoder_.WriteLocalDateTime(value.ValueLocalDateTime());
+      return {};
+    case query::TypedValue::Type::Duration:
+      encoder_.WriteDuration(value.ValueDuration());
+      return {};
+    case query::TypedValue::Type::ZonedDateTime:
+      encoder_.WriteZonedDateTime(value.ValueZonedDateTime());
+      return {};
+    case query::TypedValue::Type::Point2d:
+      encoder_.WritePoint2d(communication::bolt::Point2d{value.ValuePoint2d()});
+      return {};
+    case query::TypedValue::Type::Point3d:
+      encoder_.WritePoint3d(communication::bolt::Point3d{value.ValuePoint3d()});
+      return {};
+    case query::TypedValue::Type::Map: {
+      const auto &map = value.ValueMap();
+      encoder_.WriteTypeSize(map.size(), MarkerMap);
+      for (const auto &[key, map_value] : map) {
+        WriteString(key);
+        if (auto result = WriteValue(map_value); result.HasError()) return result.GetError();
+      }
+      return {};
+    }
+    case query::TypedValue::Type::List: {
+      const auto &list = value.ValueList();
+      encoder_.WriteTypeSize(list.size(), MarkerList);
+      for (const auto &element : list) {
+        if (auto result = WriteValue(element); result.HasError()) return result.GetError();
+      }
+      return {};
+    }
+    case query::TypedValue::Type::Vertex:
+      check_db();
+      return WriteVertex(value.ValueVertex().impl_);
+    case query::TypedValue::Type::Edge:
+      check_db();
+      return WriteEdge(value.ValueEdge().impl_, false);
+    case query::TypedValue::Type::Path:
+      check_db();
+      return WritePath(value.ValuePath());
+    case query::TypedValue::Type::Graph:
+      check_db();
+      return WriteGraph(value.ValueGraph());
+    case query::TypedValue::Type::Enum:
+      check_db();
+      WriteEnum(value.ValueEnum());
+      return {};
+    case query::TypedValue::Type::Function:
+      throw communication::bolt::ValueException("Unsupported conversion from TypedValue::Function to Value");
+  }
+  return {};
+}
+
+storage::Result<void> TypedValueRecordEncoder::WriteVertex(const storage::VertexAccessor &vertex) {
+  // Labels and properties are read before anything is written, so the error
+  // of a deleted vertex leaves no partial structure behind.
+  auto maybe_labels = vertex.Labels(view_);
+  if (maybe_labels.HasError()) return maybe_labels.GetError();
+  auto maybe_properties = vertex.Properties(view_);
+  if (maybe_properties.HasError()) return maybe_properties.GetError();
+
+  const auto id = communication::bolt::Id::FromUint(vertex.Gid().AsUint()).AsInt();
+  const int struct_n = 3 + 1 * int(major_v_ > 4);  // element_id introduced from v5
+  encoder_.WriteRAW(utils::UnderlyingCast(Marker::TinyStruct) + struct_n);
+  encoder_.WriteRAW(utils::UnderlyingCast(Signature::Node));
+  encoder_.WriteInt(id);
+  encoder_.WriteTypeSize(maybe_labels->size(), MarkerList);
+  for (const auto &label : *maybe_labels) {
+    WriteString(db_->LabelToName(label));
+  }
+  WriteProperties(*maybe_properties);
+  if (major_v_ > 4) {
+    // Introduced in Bolt v5 (for now just send the ID)
+    WriteString(std::to_string(id));
+  }
+  return {};
+}
+
+storage::Result<void> TypedValueRecordEncoder::WriteEdge(const storage::EdgeAccessor &edge, bool unbound) {
+  auto maybe_properties = edge.Properties(view_);
+  if (maybe_properties.HasError()) return maybe_properties.GetError();
+
+  const auto id = communication::bolt::Id::FromUint(edge.Gid().AsUint()).AsInt();
+  const auto from = communication::bolt::Id::FromUint(edge.FromVertex().Gid().AsUint()).AsInt();
+  const auto to = communication::bolt::Id::FromUint(edge.ToVertex().Gid().AsUint()).AsInt();
+  const int struct_n = unbound ? 3 + 1 * int(major_v_ > 4) : 5 + 3 * int(major_v_ > 4);
+  encoder_.WriteRAW(utils::UnderlyingCast(Marker::TinyStruct) + struct_n);
+  encoder_.WriteRAW(utils::UnderlyingCast(unbound ? Signature::UnboundRelationship : Signature::Relationship));
+  encoder_.WriteInt(id);
+  if (!unbound) {
+    encoder_.WriteInt(from);
+    encoder_.WriteInt(to);
+  }
+  WriteString(db_->EdgeTypeToName(edge.EdgeType()));
+  WriteProperties(*maybe_properties);
+  if (major_v_ > 4) {
+    // Introduced in Bolt v5 (for now just send the IDs)
+    WriteString(std::to_string(id));
+    if (!unbound) {
+      WriteString(std::to_string(from));
+      WriteString(std::to_string(to));
+    }
+  }
+  return {};
+}
+
+storage::Result<void> TypedValueRecordEncoder::WritePath(const query::Path &path) {
+  // Same layout as communication::bolt::Path: the unique vertices and edges of
+  // the path, followed by the indices which walk through them.
+  const auto &vertices = path.vertices();
+  const auto &edges = path.edges();
+  std::vector<const storage::VertexAccessor *> unique_vertices{&vertices[0].impl_};
+  std::vector<const storage::EdgeAccessor *> unique_edges;
+  std::vector<int64_t> indices;
+  indices.reserve(edges.size() * 2);
+  auto add_element = [&indices](auto &collection, const auto *element, int multiplier, int offset) {
+    auto found = std::find_if(collection.begin(), collection.end(),
+                              [&](const auto *e) { return e->Gid() == element->Gid(); });
+    indices.emplace_back(multiplier * (std::distance(collection.begin(), found) + offset));
+    if (found == collection.end()) collection.push_back(element);
+  };
+  for (size_t i = 0; i < edges.size(); ++i) {
+    const auto &edge = edges[i].impl_;
+    const auto &vertex = vertices[i + 1].impl_;
+    add_element(unique_edges, &edge, edge.ToVertex().Gid() == vertex.Gid() ? 1 : -1, 1);
+    add_element(unique_vertices, &vertex, 1, 0);
+  }
+
+  encoder_.WriteRAW(utils::UnderlyingCast(Marker::TinyStruct) + 3);
+  encoder_.WriteRAW(utils::UnderlyingCast(Signature::Path));
+  encoder_.WriteTypeSize(unique_vertices.size(), MarkerList);
+  for (const auto *vertex : unique_vertices) {
+    if (auto result = WriteVertex(*vertex); result.HasError()) return result.GetError();
+  }
+  encoder_.WriteTypeSize(unique_edges.size(), MarkerList);
+  for (const auto *edge : unique_edges) {
+    if (auto result = WriteEdge(*edge, true); result.HasError()) return result.GetError();
+  }
+  encoder_.WriteTypeSize(indices.size(), MarkerList);
+  for (const auto index : indices) encoder_.WriteInt(index);
+  return {};
+}
+
+storage::Result<void> TypedValueRecordEncoder::WriteGraph(const query::Graph &graph) {
+  // The keys in the order of the map ToBoltGraph makes.
+  encoder_.WriteTypeSize(2, MarkerMap);
+  WriteString("edges");
+  encoder_.WriteTypeSize(graph.edges().size(), MarkerList);
+  for (const auto &edge : graph.edges()) {
+    if (auto result = WriteEdge(edge.impl_, false); result.HasError()) return result.GetError();
+  }
+  WriteString("nodes");
+  encoder_.WriteTypeSize(graph.vertices().size(), MarkerList);
+  for (const auto &vertex : graph.vertices()) {
+    if (auto result = WriteVertex(vertex.impl_); result.HasError()) return result.GetError();
+  }
+  return {};
+}
+
+void TypedValueRecordEncoder::WriteProperties(const std::map<storage::PropertyId, storage::PropertyValue> &properties) {
+  encoder_.WriteTypeSize(properties.size(), MarkerMap);
+  for (const auto &[property, value] : properties) {
+    WriteString(db_->PropertyToName(property));
+    WritePropertyValue(value);
+  }
+}
+
+void TypedValueRecordEncoder::WritePropertyValue(const storage::PropertyValue &value) {
+  switch (value.type()) {
+    case storage::PropertyValue::Type::Null:
+      encoder_.WriteNull();
+      return;
+    case storage::PropertyValue::Type::Bool:
+      encoder_.WriteBool(value.ValueBool());
+      return;
+    case storage::PropertyValue::Type::Int:
+      encoder_.WriteInt(value.ValueInt());
+      return;
+    case storage::PropertyValue::Type::Double:
+      encoder_.WriteDouble(value.ValueDouble());
+      return;
+    case storage::PropertyValue::Type::String:
+      WriteString(value.ValueString());
+      return;
+    case storage::PropertyValue::Type::List: {
+      const auto &list = value.ValueList();
+      encoder_.WriteTypeSize(list.size(), MarkerList);
+      for (const auto &element : list) WritePropertyValue(element);
+      return;
+    }
+    case storage::PropertyValue::Type::Map: {
+      const auto &map = value.ValueMap();
+      encoder_.WriteTypeSize(map.size(), MarkerMap);
+      for (const auto &[key, map_value] : map) {
+        WriteString(key);
+        WritePropertyValue(map_value);
+      }
+      return;
+    }
+    case storage::PropertyValue::Type::TemporalData: {
+      const auto &temporal = value.ValueTemporalData();
+      switch (temporal.type) {
+        case storage::TemporalType::Date:
+          encoder_.WriteDate(utils::Date(temporal.microseconds));
+          return;
+        case storage::TemporalType::LocalTime:
+          encoder_.WriteLocalTime(utils::LocalTime(temporal.microseconds));
+          return;
+        case storage::TemporalType::LocalDateTime:
+          encoder_.WriteLocalDateTime(utils::LocalDateTime(temporal.microseconds));
+          return;
+        case storage::TemporalType::Duration:
+          encoder_.WriteDuration(utils::Duration(temporal.microseconds));
+          return;
+      }
+      return;
+    }
+    case storage::PropertyValue::Type::ZonedTemporalData: {
+      const auto &temporal = value.ValueZonedTemporalData();
+      encoder_.WriteZonedDateTime(utils::ZonedDateTime(temporal.microseconds, temporal.timezone));
+      return;
+    }
+    case storage::PropertyValue::Type::Enum:
+      WriteEnum(value.ValueEnum());
+      return;
+    case storage::PropertyValue::Type::Point2d:
+      encoder_.WritePoint2d(communication::bolt::Point2d{value.ValuePoint2d()});
+      return;
+    case storage::PropertyValue::Type::Point3d:
+      encoder_.WritePoint3d(communication::bolt::Point3d{value.ValuePoint3d()});
+      return;
+  }
+}
+
+void TypedValueRecordEncoder::WriteEnum(storage::Enum value) {
+  auto maybe_enum_value_str = db_->enum_store_.ToString(value);
+  if (maybe_enum_value_str.HasError()) [[unlikely]] {
+    throw communication::bolt::ValueException("Enum not registered in the database");
+  }
+  // Bolt does not know about enums, encode as map type instead
+  encoder_.WriteTypeSize(2, MarkerMap);
+  WriteString(kMgTypeType);
+  WriteString(kMgTypeEnum);
+  WriteString(kMgTypeValue);
+  WriteString(*maybe_enum_value_str);
+}
+
+void TypedValueRecordEncoder::WriteString(std::string_view value) {
+  encoder_.WriteTypeSize(value.size(), MarkerString);
+  encoder_.WriteRAW(value.data(), value.size());
+}
+
 }  // namespace memgraph::glue
@@ -12,6 +12,12 @@
 /// @file Conversion functions between Value and other memgraph types.
 #pragma once
 
+#include <cstdint>
+#include <map>
+#include <string_view>
+#include <vector>
+
+#include "communication/bolt/v1/encoder/base_encoder.hpp"
 #include "communication/bolt/v1/value.hpp"
 #include "query/typed_value.hpp"
 #include "storage/v2/property_value.hpp"
@@ -73,4 +79,57 @@ communication::bolt::Value ToBoltValue(const storage::PropertyValue &value, cons
 
 storage::PropertyValue ToPropertyValue(communication::bolt::Value const &value, storage::Storage const *storage);
 
+/// Replaces the maps in `params` which encode Memgraph types (see
+/// communication/bolt/v1/mg_types.hpp) with the values they encode. Enums are
+/// looked up in the `storage`, their maps stay as they are if there is none.
+void ResolveMgTypes(storage::PropertyValue::map_t *params, storage::Storage const *storage);
+
+/// Encodes the fields of result records straight from query::TypedValue and
+/// the storage accessors, without building a communication::bolt::Value for
+/// each field first. The bytes of a record are kept until the next one is
+/// encoded, so a record which fails to encode is never partially sent.
+class TypedValueRecordEncoder {
+ public:
+  /// @param storage::Storage for getting label, edge type and property names.
+  /// @param storage::View for deciding which graph element attributes are
+  ///        visible.
+  TypedValueRecordEncoder(const storage::Storage *db, storage::View view);
+
+  /// @param major_v the major version of the Bolt protocol used.
+  void UpdateVersion(int major_v);
+
+  /// Encodes the fields of a record, replacing the previous record. Returns
+  /// the error of a graph element which can't be read in the view.
+  ///
+  /// @throw communication::bolt::ValueException
+  /// @throw std::bad_alloc
+  storage::Result<void> Encode(const std::vector<query::TypedValue> &values);
+
+  /// Encoded fields of the last record.
+  const std::vector<uint8_t> &Bytes() const { return buffer_.bytes; }
+
+ private:
+  struct Buffer {
+    void Write(const uint8_t *data, size_t len) { bytes.insert(bytes.end(), data, data + len); }
+
+    std::vector<uint8_t> bytes;
+  };
+
+  storage::Result<void> WriteValue(const query::TypedValue &value);
+  storage::Result<void> WriteVertex(const storage::VertexAccessor &vertex);
+  storage::Result<void> WriteEdge(const storage::EdgeAccessor &edge, bool unbound);
+  storage::Result<void> WritePath(const query::Path &path);
+  storage::Result<void> WriteGraph(const query::Graph &graph);
+  void WriteProperties(const std::map<storage::PropertyId, storage::PropertyValue> &properties);
+  void WritePropertyValue(const storage::PropertyValue &value);
+  void WriteEnum(storage::Enum value);
+  void WriteString(std::string_view value);
+
+  const storage::Storage *db_;
+  storage::View view_;
+  int major_v_{0};
+  Buffer buffer_;
+  communication::bolt::BaseEncoder<Buffer> encoder_{buffer_};
+};
+
 }  // namespace memgraph::glue
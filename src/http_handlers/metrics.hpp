@@ -11,7 +11,9 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <string>
 #include <tuple>
 #include <vector>
 
@@ -23,8 +25,12 @@
 #include <utils/event_counter.hpp>
 #include <utils/event_gauge.hpp>
 #include "license/license_sender.hpp"
+#include "memory/global_memory_control.hpp"
+#include "query/fingerprint_metrics.hpp"
+#include "query/plan/profile.hpp"
 #include "storage/v2/storage.hpp"
 #include "utils/event_histogram.hpp"
+#include "utils/lock_contention.hpp"
 
 namespace memgraph::http {
 
@@ -47,6 +53,21 @@ struct MetricsResponse {
   // Storage of all the percentile values across the histograms in the system
   // e.g. query latency percentiles, snapshot recovery duration percentiles, etc.
   std::vector<std::tuple<std::string, std::string, uint64_t>> event_histograms{};
+
+  // Operator-level profiles of the sampled query executions by the plan hash
+  nlohmann::json sampled_profiles{};
+
+  // Execution statistics of the most frequent query fingerprints
+  std::vector<query::QueryFingerprintStats> query_fingerprints{};
+
+  // Objects waiting for the garbage collection of the storage
+  storage::GarbageInfo garbage{};
+
+  // Memory of the allocator, by arena
+  memory::AllocatorStats allocator{};
+
+  // Contention of each lock site, if the build tracks it
+  std::array<utils::LockContentionStats, utils::kLockSiteCount> lock_contention{};
 };
 
 class MetricsService {
@@ -58,6 +79,11 @@ class MetricsService {
     return AsJson(response);
   }
 
+  /// Metrics of the query fingerprints in the Prometheus text format.
+  static std::string GetQueryFingerprintsPrometheus() {
+    return query::QueryFingerprintsToPrometheus(query::GlobalQueryFingerprintMetrics().Fingerprints());
+  }
+
  private:
   storage::Storage *const db_;
 
@@ -73,7 +99,13 @@ class MetricsService {
                            .disk_usage = info.disk_usage,
                            .event_counters = GetEventCounters(),
                            .event_gauges = GetEventGauges(),
-                           .event_histograms = GetEventHistograms()};
+                           .event_histograms = GetEventHistograms(),
+                           .sampled_profiles = query::plan::SampledProfilesToJson(
+                               query::plan::GlobalProfileSampler().Profiles()),
+                           .query_fingerprints = query::GlobalQueryFingerprintMetrics().Fingerprints(),
+                           .garbage = db_->GetGarbageInfo(),
+                           .allocator = memory::GetAllocatorStats(),
+                           .lock_contention = utils::GetLockContentionStats()};
   }
 
   nlohmann::json AsJson(MetricsResponse response) {
@@ -100,6 +132,50 @@ class MetricsService {
       metrics_response[type][name] = value;
     }
 
+    if (!response.sampled_profiles.empty()) {
+      metrics_response["QueryProfile"] = std::move(response.sampled_profiles);
+    }
+
+    if (!response.query_fingerprints.empty()) {
+      metrics_response["QueryFingerprint"] = query::QueryFingerprintsToJson(response.query_fingerprints);
+    }
+
+    const auto *garbage_type = "GarbageCollection";
+    metrics_response[garbage_type]["committed_transactions"] = response.garbage.committed_transactions;
+    metrics_response[garbage_type]["committed_deltas"] = response.garbage.committed_deltas;
+    metrics_response[garbage_type]["unlinked_transactions"] = response.garbage.unlinked_transactions;
+    metrics_response[garbage_type]["unlinked_deltas"] = response.garbage.unlinked_deltas;
+    metrics_response[garbage_type]["delta_bytes"] = response.garbage.delta_bytes;
+    metrics_response[garbage_type]["deleted_vertices"] = response.garbage.deleted_vertices;
+    metrics_response[garbage_type]["deleted_edges"] = response.garbage.deleted_edges;
+    auto skip_list_garbage = nlohmann::json::object();
+    for (const auto &[structure, size] : response.garbage.skip_list_garbage) {
+      skip_list_garbage[structure] = size;
+    }
+    metrics_response[garbage_type]["skip_list_garbage"] = std::move(skip_list_garbage);
+
+    const auto *allocator_type = "Allocator";
+    metrics_response[allocator_type]["allocated"] = response.allocator.allocated;
+    metrics_response[allocator_type]["active"] = response.allocator.active;
+    metrics_response[allocator_type]["metadata"] = response.allocator.metadata;
+    metrics_response[allocator_type]["resident"] = response.allocator.resident;
+    metrics_response[allocator_type]["mapped"] = response.allocator.mapped;
+    metrics_response[allocator_type]["retained"] = response.allocator.retained;
+    auto arenas = nlohmann::json::array();
+    for (const auto &arena : response.allocator.arenas) {
+      arenas.push_back(
+          {{"index", arena.index}, {"active", arena.active}, {"dirty", arena.dirty}, {"muzzy", arena.muzzy}});
+    }
+    metrics_response[allocator_type]["arenas"] = std::move(arenas);
+
+    if constexpr (utils::kLockContentionTracking) {
+      for (size_t i = 0; i < utils::kLockSiteCount; ++i) {
+        const auto site = std::string{utils::LockSiteName(static_cast<utils::LockSite>(i))};
+        metrics_response["LockContention"][site]["contended"] = response.lock_contention[i].contended;
+        metrics_response["LockContention"][site]["wait_us"] = response.lock_contention[i].wait_ns / 1000;
+      }
+    }
+
     return metrics_response;
   }
 
@@ -201,8 +277,14 @@ class MetricsRequestHandler final {
     // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
     boost::beast::http::string_body::value_type body;
 
-    auto service_response = service_.GetMetricsJSON();
-    body.append(service_response.dump());
+    // Prometheus scrapes the per-fingerprint query metrics in its text format
+    const bool is_prometheus = req.target() == kPrometheusTarget;
+    if (is_prometheus) {
+      body.append(MetricsService::GetQueryFingerprintsPrometheus());
+    } else {
+      auto service_response = service_.GetMetricsJSON();
+      body.append(service_response.dump());
+    }
 
     // Cache the size since we need it after the move
     const auto size = body.size();
@@ -213,13 +295,16 @@ class MetricsRequestHandler final {
         std::piecewise_construct, std::make_tuple(std::move(body)),
         std::make_tuple(boost::beast::http::status::ok, req.version())};
     res.set(boost::beast::http::field::server, BOOST_BEAST_VERSION_STRING);
-    res.set(boost::beast::http::field::content_type, "application/json");
+    res.set(boost::beast::http::field::content_type,
+            is_prometheus ? "text/plain; version=0.0.4" : "application/json");
     res.content_length(size);
     res.keep_alive(req.keep_alive());
     return send(std::move(res));
   }
 
  private:
+  static constexpr const char *kPrometheusTarget = "/metrics/prometheus";
+
   MetricsService service_;
 };
 }  // namespace memgraph::http
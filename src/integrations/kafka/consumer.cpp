@@ -13,8 +13,12 @@
 
 #include <algorithm>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <iterator>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <unordered_set>
 
 #include <librdkafka/rdkafkacpp.h>
@@ -105,6 +109,101 @@ void TryToConsumeBatch(RdKafka::KafkaConsumer &consumer, const ConsumerInfo &inf
     throw ConsumerCommitFailedException(info.consumer_name, RdKafka::err2str(err));
   }
 }
+
+// The offsets of the messages by their topic and partition
+using PartitionOffsets = std::map<std::pair<std::string, int32_t>, int64_t>;
+
+// Commits the offsets which follow the messages of `batch`. Unlike the position of the consumer, they don't include
+// the batches polled after it.
+void CommitBatchOffsets(RdKafka::KafkaConsumer &consumer, const ConsumerInfo &info, const std::vector<Message> &batch) {
+  PartitionOffsets next_offsets;
+  for (const auto &message : batch) {
+    auto &next_offset = next_offsets[{std::string{message.TopicName()}, message.Partition()}];
+    next_offset = std::max(next_offset, message.Offset() + 1);
+  }
+
+  std::vector<RdKafka::TopicPartition *> partitions;
+  utils::OnScopeExit clear_partitions([&]() { RdKafka::TopicPartition::destroy(partitions); });
+  partitions.reserve(next_offsets.size());
+  for (const auto &[topic_partition, offset] : next_offsets) {
+    partitions.push_back(RdKafka::TopicPartition::create(topic_partition.first, topic_partition.second, offset));
+  }
+  if (const auto err = consumer.commitSync(partitions); err != RdKafka::ERR_NO_ERROR) {
+    throw ConsumerCommitFailedException(info.consumer_name, RdKafka::err2str(err));
+  }
+}
+
+// Moves the consumer back to the first messages of the batches which were polled but not processed, so they are
+// consumed again once the consumer is started
+void RewindToBatches(RdKafka::KafkaConsumer &consumer, const ConsumerInfo &info,
+                     const std::deque<std::vector<Message>> &batches) {
+  static constexpr int kSeekTimeoutMs = 1000;
+  PartitionOffsets first_offsets;
+  for (const auto &batch : batches) {
+    for (const auto &message : batch) {
+      auto [it, inserted] =
+          first_offsets.try_emplace({std::string{message.TopicName()}, message.Partition()}, message.Offset());
+      if (!inserted) it->second = std::min(it->second, message.Offset());
+    }
+  }
+
+  for (const auto &[topic_partition, offset] : first_offsets) {
+    std::unique_ptr<RdKafka::TopicPartition> partition(
+        RdKafka::TopicPartition::create(topic_partition.first, topic_partition.second, offset));
+    if (const auto err = consumer.seek(*partition, kSeekTimeoutMs); err != RdKafka::ERR_NO_ERROR) {
+      spdlog::warn("Couldn't rewind consumer {} to the unprocessed messages of {}[{}]: {}", info.consumer_name,
+                   topic_partition.first, topic_partition.second, RdKafka::err2str(err));
+    }
+  }
+}
+
+std::unique_ptr<RdKafka::Conf> CreateConfiguration(const ConsumerInfo &info, RdKafka::EventCb *event_cb,
+                                                  RdKafka::RebalanceCb *rebalance_cb) {
+  std::unique_ptr<RdKafka::Conf> conf(RdKafka::Conf::create(RdKafka::Conf::CONF_GLOBAL));
+  if (conf == nullptr) {
+    throw ConsumerFailedToInitializeException(info.consumer_name, "Couldn't create Kafka configuration!");
+  }
+
+  std::string error;
+
+  for (const auto &[key, value] : info.public_configs) {
+    if (conf->set(key, value, error) != RdKafka::Conf::CONF_OK) {
+      throw SettingCustomConfigFailed(info.consumer_name, error, key, value);
+    }
+  }
+
+  for (const auto &[key, value] : info.private_configs) {
+    if (conf->set(key, value, error) != RdKafka::Conf::CONF_OK) {
+      throw SettingCustomConfigFailed(info.consumer_name, error, key, kReducted);
+    }
+  }
+
+  if (conf->set("event_cb", event_cb, error) != RdKafka::Conf::CONF_OK) {
+    throw ConsumerFailedToInitializeException(info.consumer_name, error);
+  }
+
+  if (conf->set("rebalance_cb", rebalance_cb, error) != RdKafka::Conf::CONF_OK) {
+    throw ConsumerFailedToInitializeException(info.consumer_name, error);
+  }
+
+  if (conf->set("enable.partition.eof", "false", error) != RdKafka::Conf::CONF_OK) {
+    throw ConsumerFailedToInitializeException(info.consumer_name, error);
+  }
+
+  if (conf->set("enable.auto.commit", "false", error) != RdKafka::Conf::CONF_OK) {
+    throw ConsumerFailedToInitializeException(info.consumer_name, error);
+  }
+
+  if (conf->set("bootstrap.servers", info.bootstrap_servers, error) != RdKafka::Conf::CONF_OK) {
+    throw ConsumerFailedToInitializeException(info.consumer_name, error);
+  }
+
+  if (conf->set("group.id", info.consumer_group, error) != RdKafka::Conf::CONF_OK) {
+    throw ConsumerFailedToInitializeException(info.consumer_name, error);
+  }
+
+  return conf;
+}
 }  // namespace
 
 Message::Message(std::unique_ptr<RdKafka::Message> &&message) : message_{std::move(message)} {
@@ -139,6 +238,11 @@ int64_t Message::Offset() const {
   return c_message->offset;
 }
 
+int32_t Message::Partition() const {
+  const auto *c_message = message_->c_ptr();
+  return c_message->partition;
+}
+
 Consumer::Consumer(ConsumerInfo info, ConsumerFunction consumer_function)
     : info_{std::move(info)}, consumer_function_(std::move(consumer_function)), cb_(info_.consumer_name) {
   MG_ASSERT(consumer_function_, "Empty consumer function for Kafka consumer");
@@ -149,50 +253,15 @@ Consumer::Consumer(ConsumerInfo info, ConsumerFunction consumer_function)
   if (info_.batch_size < kMinimumSize) {
     throw ConsumerFailedToInitializeException(info_.consumer_name, "Batch size has to be positive!");
   }
-
-  std::unique_ptr<RdKafka::Conf> conf(RdKafka::Conf::create(RdKafka::Conf::CONF_GLOBAL));
-  if (conf == nullptr) {
-    throw ConsumerFailedToInitializeException(info_.consumer_name, "Couldn't create Kafka configuration!");
+  if (info_.workers < kMinimumSize) {
+    throw ConsumerFailedToInitializeException(info_.consumer_name, "Number of workers has to be positive!");
   }
-
-  std::string error;
-
-  for (const auto &[key, value] : info_.public_configs) {
-    if (conf->set(key, value, error) != RdKafka::Conf::CONF_OK) {
-      throw SettingCustomConfigFailed(info_.consumer_name, error, key, value);
-    }
-  }
-
-  for (const auto &[key, value] : info_.private_configs) {
-    if (conf->set(key, value, error) != RdKafka::Conf::CONF_OK) {
-      throw SettingCustomConfigFailed(info_.consumer_name, error, key, kReducted);
-    }
-  }
-
-  if (conf->set("event_cb", this, error) != RdKafka::Conf::CONF_OK) {
-    throw ConsumerFailedToInitializeException(info_.consumer_name, error);
-  }
-
-  if (conf->set("rebalance_cb", &cb_, error) != RdKafka::Conf::CONF_OK) {
-    throw ConsumerFailedToInitializeException(info_.consumer_name, error);
-  }
-
-  if (conf->set("enable.partition.eof", "false", error) != RdKafka::Conf::CONF_OK) {
-    throw ConsumerFailedToInitializeException(info_.consumer_name, error);
-  }
-
-  if (conf->set("enable.auto.commit", "false", error) != RdKafka::Conf::CONF_OK) {
-    throw ConsumerFailedToInitializeException(info_.consumer_name, error);
-  }
-
-  if (conf->set("bootstrap.servers", info_.bootstrap_servers, error) != RdKafka::Conf::CONF_OK) {
-    throw ConsumerFailedToInitializeException(info_.consumer_name, error);
-  }
-
-  if (conf->set("group.id", info_.consumer_group, error) != RdKafka::Conf::CONF_OK) {
-    throw ConsumerFailedToInitializeException(info_.consumer_name, error);
+  if (info_.pipeline_depth < 0) {
+    throw ConsumerFailedToInitializeException(info_.consumer_name, "Pipeline depth cannot be negative!");
   }
 
+  auto conf = CreateConfiguration(info_, this, &cb_);
+  std::string error;
   consumer_ = std::unique_ptr<RdKafka::KafkaConsumer, std::function<void(RdKafka::KafkaConsumer *)>>(
       RdKafka::KafkaConsumer::create(conf.get(), error), [this](auto *consumer) {
         this->StopConsuming();
@@ -284,6 +353,7 @@ void Consumer::StopIfRunning() {
   if (thread_.joinable()) {
     thread_.join();
   }
+  workers_.clear();
 }
 
 void Consumer::Check(std::optional<std::chrono::milliseconds> timeout, std::optional<uint64_t> limit_batches,
@@ -384,39 +454,150 @@ void Consumer::StartConsuming() {
     thread_.join();
   };
 
+  // The workers of a run which stopped because of an error
+  workers_.clear();
+
   is_running_.store(true);
 
   CheckAndDestroyLastAssignmentIfNeeded(*consumer_, info_, last_assignment_);
 
+  // The workers join the group of consumer_, so the group splits the partitions between them
+  try {
+    for (int64_t i = 1; i < info_.workers; ++i) {
+      auto &worker = workers_.emplace_back(std::make_unique<Worker>(info_.consumer_name));
+      auto conf = CreateConfiguration(info_, this, &worker->cb);
+      std::string error;
+      worker->consumer.reset(RdKafka::KafkaConsumer::create(conf.get(), error));
+      if (worker->consumer == nullptr) {
+        throw ConsumerStartFailedException(info_.consumer_name, fmt::format("Couldn't create worker: {}", error));
+      }
+      if (const auto err = worker->consumer->subscribe(info_.topics); err != RdKafka::ERR_NO_ERROR) {
+        throw ConsumerStartFailedException(info_.consumer_name,
+                                           fmt::format("Couldn't subscribe worker: {}", RdKafka::err2str(err)));
+      }
+    }
+  } catch (const utils::BasicException &) {
+    is_running_.store(false);
+    workers_.clear();
+    throw;
+  }
+
+  static constexpr auto kMaxThreadNameSize = utils::GetMaxThreadNameSize();
   thread_ = std::thread([this] {
-    static constexpr auto kMaxThreadNameSize = utils::GetMaxThreadNameSize();
     const auto full_thread_name = "Cons#" + info_.consumer_name;
-
     utils::ThreadSetName(full_thread_name.substr(0, kMaxThreadNameSize));
+    ConsumeWhileRunning(*consumer_);
+  });
+  for (size_t i = 0; i < workers_.size(); ++i) {
+    workers_[i]->thread = std::thread([this, i, consumer = workers_[i]->consumer.get()] {
+      const auto full_thread_name = fmt::format("Cons{}#{}", i + 1, info_.consumer_name);
+      utils::ThreadSetName(full_thread_name.substr(0, kMaxThreadNameSize));
+      ConsumeWhileRunning(*consumer);
+    });
+  }
+}
 
-    while (is_running_) {
-      auto maybe_batch = GetBatch(*consumer_, info_, is_running_);
-      if (maybe_batch.HasError()) {
-        throw ConsumerReadMessagesFailedException(info_.consumer_name, maybe_batch.GetError());
-      }
-      const auto &batch = maybe_batch.GetValue();
+void Consumer::ConsumeWhileRunning(RdKafka::KafkaConsumer &consumer) {
+  if (info_.pipeline_depth > 0) {
+    ConsumePipelinedWhileRunning(consumer);
+    return;
+  }
+  while (is_running_) {
+    auto maybe_batch = GetBatch(consumer, info_, is_running_);
+    if (maybe_batch.HasError()) {
+      throw ConsumerReadMessagesFailedException(info_.consumer_name, maybe_batch.GetError());
+    }
+    const auto &batch = maybe_batch.GetValue();
+
+    if (batch.empty()) {
+      continue;
+    }
+
+    spdlog::info("Kafka consumer {} is processing a batch", info_.consumer_name);
+
+    try {
+      TryToConsumeBatch(consumer, info_, consumer_function_, batch);
+    } catch (const std::exception &e) {
+      spdlog::warn("Error happened in consumer {} while processing a batch: {}!", info_.consumer_name, e.what());
+      break;
+    }
+    spdlog::info("Kafka consumer {} finished processing", info_.consumer_name);
+  }
+  // A failed worker stops the others as well
+  is_running_.store(false);
+}
+
+void Consumer::ConsumePipelinedWhileRunning(RdKafka::KafkaConsumer &consumer) {
+  // Stopping the consumer doesn't notify the condition variable, so the waits check is_running_ periodically
+  static constexpr auto kStopCheckInterval = std::chrono::milliseconds{100};
+  const auto pipeline_depth = static_cast<size_t>(info_.pipeline_depth);
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::deque<std::vector<Message>> polled_batches;  // Protected by mutex
 
-      if (batch.empty()) {
-        continue;
+  std::thread processor([&] {
+    static constexpr auto kMaxThreadNameSize = utils::GetMaxThreadNameSize();
+    const auto full_thread_name = "Proc#" + info_.consumer_name;
+    utils::ThreadSetName(full_thread_name.substr(0, kMaxThreadNameSize));
+
+    while (true) {
+      std::vector<Message> batch;
+      {
+        auto lock = std::unique_lock{mutex};
+        while (polled_batches.empty() && is_running_) cv.wait_for(lock, kStopCheckInterval);
+        // The batches which weren't processed are consumed again
+        if (!is_running_) return;
+        batch = std::move(polled_batches.front());
+        polled_batches.pop_front();
       }
+      cv.notify_all();
 
       spdlog::info("Kafka consumer {} is processing a batch", info_.consumer_name);
-
       try {
-        TryToConsumeBatch(*consumer_, info_, consumer_function_, batch);
+        consumer_function_(batch);
+        CommitBatchOffsets(consumer, info_, batch);
       } catch (const std::exception &e) {
         spdlog::warn("Error happened in consumer {} while processing a batch: {}!", info_.consumer_name, e.what());
-        break;
+        is_running_.store(false);
+        cv.notify_all();
+        return;
       }
       spdlog::info("Kafka consumer {} finished processing", info_.consumer_name);
     }
-    is_running_.store(false);
   });
+
+  std::optional<std::string> poll_error;
+  while (is_running_) {
+    {
+      auto lock = std::unique_lock{mutex};
+      while (polled_batches.size() >= pipeline_depth && is_running_) cv.wait_for(lock, kStopCheckInterval);
+    }
+    if (!is_running_) break;
+
+    auto maybe_batch = GetBatch(consumer, info_, is_running_);
+    if (maybe_batch.HasError()) {
+      poll_error = std::move(maybe_batch.GetError());
+      break;
+    }
+    if (maybe_batch.GetValue().empty()) {
+      continue;
+    }
+    {
+      auto lock = std::lock_guard{mutex};
+      polled_batches.push_back(std::move(maybe_batch.GetValue()));
+    }
+    cv.notify_all();
+  }
+
+  // A failed worker stops the others as well
+  is_running_.store(false);
+  cv.notify_all();
+  processor.join();
+  RewindToBatches(consumer, info_, polled_batches);
+  if (poll_error) {
+    throw ConsumerReadMessagesFailedException(info_.consumer_name, *poll_error);
+  }
 }
 
 void Consumer::StartConsumingWithLimit(uint64_t limit_batches, std::optional<std::chrono::milliseconds> timeout) const {
@@ -460,6 +641,12 @@ void Consumer::StartConsumingWithLimit(uint64_t limit_batches, std::optional<std
 void Consumer::StopConsuming() {
   is_running_.store(false);
   if (thread_.joinable()) thread_.join();
+  workers_.clear();
+}
+
+Consumer::Worker::~Worker() {
+  if (thread.joinable()) thread.join();
+  if (consumer) consumer->close();
 }
 
 utils::BasicResult<std::string> Consumer::SetConsumerOffsets(int64_t offset) {
@@ -72,6 +72,9 @@ class Message final {
   /// Returns the offset of the message
   int64_t Offset() const;
 
+  /// Returns the partition of the topic the message was read from.
+  int32_t Partition() const;
+
  private:
   std::unique_ptr<RdKafka::Message> message_;
 };
@@ -88,6 +91,14 @@ struct ConsumerInfo {
   int64_t batch_size;
   std::unordered_map<std::string, std::string> public_configs{};
   std::unordered_map<std::string, std::string> private_configs{};
+  /// Consumers of the group which split the partitions of the topics while the consumer is started. Each of them
+  /// calls the consumer function with its own batches from its own thread and commits the offsets of its own
+  /// partitions. Checks and starts with a batch limit use a single consumer.
+  int64_t workers{1};
+  /// Batches each worker polls ahead of the one the consumer function processes, so polling overlaps with the
+  /// processing. The offsets of a batch are committed once the consumer function returned for it. Zero polls the next
+  /// batch only after the previous one is committed.
+  int64_t pipeline_depth{0};
 };
 
 /// Memgraphs Kafka consumer wrapper.
@@ -110,10 +121,11 @@ class Consumer final : public RdKafka::EventCb {
 
   /// Starts consuming messages.
   ///
-  /// This method will start a new thread which will poll all the topics for messages.
+  /// This method will start a new thread for each worker which will poll the topics for messages. The partitions of
+  /// the topics are split between the workers, so the consumer function might be called concurrently.
   ///
   /// @throws ConsumerRunningException if the consumer is already running
-  /// @throws ConsumerStartFailedException if the commited offsets cannot be restored
+  /// @throws ConsumerStartFailedException if the commited offsets cannot be restored or a worker cannot be created
   void Start();
 
   /// Starts consuming messages.
@@ -167,6 +179,12 @@ class Consumer final : public RdKafka::EventCb {
   void StartConsuming();
   void StartConsumingWithLimit(uint64_t limit_batches, std::optional<std::chrono::milliseconds> timeout) const;
 
+  // Consumes batches with `consumer` until the consumer is stopped or a batch fails
+  void ConsumeWhileRunning(RdKafka::KafkaConsumer &consumer);
+
+  // Like ConsumeWhileRunning, but polls up to `pipeline_depth` batches ahead of the processed one
+  void ConsumePipelinedWhileRunning(RdKafka::KafkaConsumer &consumer);
+
   void StopConsuming();
 
   class ConsumerRebalanceCb : public RdKafka::RebalanceCb {
@@ -183,10 +201,27 @@ class Consumer final : public RdKafka::EventCb {
     std::string consumer_name_;
   };
 
+  // A consumer in the same group as `consumer_` which exists while the consumer is started
+  struct Worker {
+    explicit Worker(std::string consumer_name) : cb(std::move(consumer_name)) {}
+    Worker(const Worker &) = delete;
+    Worker &operator=(const Worker &) = delete;
+    Worker(Worker &&) = delete;
+    Worker &operator=(Worker &&) = delete;
+    ~Worker();
+
+    ConsumerRebalanceCb cb;
+    std::unique_ptr<RdKafka::KafkaConsumer> consumer;
+    std::thread thread;
+  };
+
   ConsumerInfo info_;
   ConsumerFunction consumer_function_;
   mutable std::atomic<bool> is_running_{false};
   mutable std::vector<RdKafka::TopicPartition *> last_assignment_;  // Protected by is_running_
+  // The workers besides `consumer_`, only accessed by Start and Stop. Declared before `consumer_`, because its deleter
+  // stops the workers.
+  std::vector<std::unique_ptr<Worker>> workers_;
   std::unique_ptr<RdKafka::KafkaConsumer, std::function<void(RdKafka::KafkaConsumer *)>> consumer_;
   std::thread thread_;
   ConsumerRebalanceCb cb_;
@@ -41,15 +41,18 @@
 #include "helpers.hpp"
 #include "license/license_sender.hpp"
 #include "memory/global_memory_control.hpp"
+#include "memory/numa.hpp"
 #include "query/auth_checker.hpp"
 #include "query/auth_query_handler.hpp"
 #include "query/config.hpp"
 #include "query/discard_value_stream.hpp"
+#include "query/hot_queries.hpp"
 #include "query/interpreter.hpp"
 #include "query/interpreter_context.hpp"
 #include "query/procedure/callable_alias_mapper.hpp"
 #include "query/procedure/module.hpp"
 #include "query/procedure/py_module.hpp"
+#include "query/slow_query_log.hpp"
 #include "replication/state.hpp"
 #include "replication_handler/replication_handler.hpp"
 #include "replication_handler/system_replication.hpp"
@@ -58,6 +61,7 @@
 #include "storage/v2/durability/durability.hpp"
 #include "storage/v2/storage_mode.hpp"
 #include "system/system.hpp"
+#include "telemetry/otlp_exporter.hpp"
 #include "telemetry/telemetry.hpp"
 #include "utils/event_gauge.hpp"
 #include "utils/file.hpp"
@@ -305,6 +309,17 @@ int main(int argc, char **argv) {
   spdlog::info("Memory limit in config is set to {}", memgraph::utils::GetReadableSize(memory_limit));
   memgraph::utils::total_memory_tracker.SetMaximumHardLimit(memory_limit);
   memgraph::utils::total_memory_tracker.SetHardLimit(memory_limit);
+  memgraph::memory::SetTrackingBatchSize(memgraph::flags::GetMemoryTrackingBatchSize());
+  memgraph::memory::SetTenantMemoryLimit(memgraph::flags::GetDatabaseMemoryLimit());
+
+  if (FLAGS_storage_numa_aware_allocation) {
+    if (auto *numa_resource = memgraph::memory::NumaLocalMemoryResource(); numa_resource) {
+      memgraph::utils::SetStorageObjectsResource(numa_resource);
+    } else {
+      spdlog::warn("NUMA-aware allocation isn't available (found {} NUMA nodes), using the default allocator.",
+                   memgraph::memory::NumaNodeCount());
+    }
+  }
 
   memgraph::utils::global_settings.Initialize(data_directory / "settings");
   memgraph::utils::OnScopeExit settings_finalizer([&] { memgraph::utils::global_settings.Finalize(); });
@@ -355,19 +370,35 @@ int main(int argc, char **argv) {
   // Main storage and execution engines initialization
   memgraph::storage::Config db_config{
       .gc = {.type = memgraph::storage::Config::Gc::Type::PERIODIC,
-             .interval = std::chrono::seconds(FLAGS_storage_gc_cycle_sec)},
+             .interval = std::chrono::seconds(FLAGS_storage_gc_cycle_sec),
+             .slice = std::chrono::milliseconds(FLAGS_storage_gc_slice_ms),
+             .release_threads = FLAGS_storage_gc_release_threads,
+             .analytical_compaction_interval = std::chrono::seconds(FLAGS_storage_analytical_compaction_interval_sec)},
 
       .durability = {.storage_directory = FLAGS_data_directory,
                      .recover_on_startup = FLAGS_data_recovery_on_startup,
                      .snapshot_retention_count = FLAGS_storage_snapshot_retention_count,
+                     .snapshot_min_wal_percent = FLAGS_storage_snapshot_min_wal_percent,
                      .wal_file_size_kibibytes = FLAGS_storage_wal_file_size_kib,
                      .wal_file_flush_every_n_tx = FLAGS_storage_wal_file_flush_every_n_tx,
+                     .wal_group_commit = FLAGS_storage_wal_group_commit,
                      .snapshot_on_exit = FLAGS_storage_snapshot_on_exit,
                      .restore_replication_state_on_startup = FLAGS_replication_restore_state_on_startup,
                      .items_per_batch = FLAGS_storage_items_per_batch,
                      .recovery_thread_count = FLAGS_storage_recovery_thread_count,
-                     .allow_parallel_schema_creation = FLAGS_storage_parallel_schema_recovery},
+                     .unload_idle_after = std::chrono::seconds(FLAGS_storage_unload_idle_databases_sec),
+                     .allow_parallel_schema_creation = FLAGS_storage_parallel_schema_recovery,
+                     .allow_parallel_snapshot_creation = FLAGS_storage_parallel_snapshot_creation,
+                     .snapshot_batch_compression = FLAGS_storage_snapshot_batch_compression,
+                     .allow_parallel_wal_recovery = FLAGS_storage_parallel_wal_recovery},
       .transaction = {.isolation_level = memgraph::flags::ParseIsolationLevel()},
+      .indices = {.creation_thread_count = FLAGS_storage_index_creation_thread_count,
+                  .stats_refresh_interval = std::chrono::seconds(FLAGS_storage_index_stats_refresh_interval_sec),
+                  .stats_refresh_threshold = FLAGS_storage_index_stats_refresh_threshold,
+                  .hash_unique_constraints = FLAGS_storage_unique_constraints_hash_index,
+                  .vertex_gid_table = FLAGS_storage_vertex_gid_table,
+                  .text_index_refresh_interval =
+                      std::chrono::milliseconds(FLAGS_storage_text_index_refresh_interval_ms)},
       .disk = {.main_storage_directory = FLAGS_data_directory + "/rocksdb_main_storage",
                .label_index_directory = FLAGS_data_directory + "/rocksdb_label_index",
                .label_property_index_directory = FLAGS_data_directory + "/rocksdb_label_property_index",
@@ -375,7 +406,10 @@ int main(int argc, char **argv) {
                .name_id_mapper_directory = FLAGS_data_directory + "/rocksdb_name_id_mapper",
                .id_name_mapper_directory = FLAGS_data_directory + "/rocksdb_id_name_mapper",
                .durability_directory = FLAGS_data_directory + "/rocksdb_durability",
-               .wal_directory = FLAGS_data_directory + "/rocksdb_wal"},
+               .wal_directory = FLAGS_data_directory + "/rocksdb_wal",
+               .block_cache_size = FLAGS_storage_disk_block_cache_mib * 1024 * 1024,
+               .bloom_filter_bits_per_key = FLAGS_storage_disk_bloom_filter_bits_per_key,
+               .vertex_cache_size = FLAGS_storage_disk_vertex_cache_size},
       .salient.items = {.properties_on_edges = FLAGS_storage_properties_on_edges,
                         .enable_edges_metadata =
                             FLAGS_storage_properties_on_edges ? FLAGS_storage_enable_edges_metadata : false,
@@ -441,9 +475,36 @@ int main(int argc, char **argv) {
 
 #endif
 
+  if (!FLAGS_query_slow_log_file.empty()) {
+    memgraph::query::GlobalSlowQueryLog().Open(FLAGS_query_slow_log_file,
+                                               std::chrono::milliseconds(FLAGS_query_slow_log_threshold_ms),
+                                               FLAGS_query_slow_log_max_file_size * 1024 * 1024,
+                                               FLAGS_query_slow_log_max_files);
+  }
+
+  // Spill files are only read by the query which wrote them, the ones left behind by a crash are removed
+  const auto query_spill_directory = std::filesystem::path(FLAGS_data_directory) / "query_spill";
+  {
+    std::error_code error;
+    std::filesystem::remove_all(query_spill_directory, error);
+    if (error) spdlog::warn("Couldn't remove the spill files in {}: {}", query_spill_directory, error.message());
+  }
+
   // Default interpreter configuration
   memgraph::query::InterpreterConfig interp_config{
-      .query = {.allow_load_csv = FLAGS_allow_load_csv},
+      .query = {.allow_load_csv = FLAGS_allow_load_csv,
+                .execution_batch_size = FLAGS_query_execution_batch_size,
+                .spill_rows = FLAGS_query_spill_rows,
+                .spill_directory = query_spill_directory.string(),
+                .load_csv_parallel_workers = FLAGS_query_load_csv_parallel_workers,
+                .analytical_write_workers = FLAGS_query_analytical_write_workers,
+                .periodic_commit_delta_budget = FLAGS_query_periodic_commit_delta_budget,
+                .periodic_commit_time_budget = std::chrono::milliseconds(FLAGS_query_periodic_commit_time_budget_ms),
+                .admission_lanes = FLAGS_query_admission_lanes,
+                .max_prepared_statements = FLAGS_query_max_prepared_statements,
+                .profile_sample_rate = FLAGS_query_profile_sample_rate,
+                .fingerprint_metrics_size = FLAGS_query_fingerprint_metrics_size,
+                .analyze_graph_sample_rate = FLAGS_query_analyze_graph_sample_rate},
       .replication_replica_check_frequency = std::chrono::seconds(FLAGS_replication_replica_check_frequency_sec),
 #ifdef MG_ENTERPRISE
       .instance_down_timeout_sec = std::chrono::seconds(FLAGS_instance_down_timeout_sec),
@@ -453,7 +514,11 @@ int main(int argc, char **argv) {
       .default_kafka_bootstrap_servers = FLAGS_kafka_bootstrap_servers,
       .default_pulsar_service_url = FLAGS_pulsar_service_url,
       .stream_transaction_conflict_retries = FLAGS_stream_transaction_conflict_retries,
-      .stream_transaction_retry_interval = std::chrono::milliseconds(FLAGS_stream_transaction_retry_interval)};
+      .stream_transaction_retry_interval = std::chrono::milliseconds(FLAGS_stream_transaction_retry_interval),
+      .stream_batched_queries = FLAGS_stream_batched_queries,
+      .trigger_batch_size = FLAGS_trigger_batch_size,
+      .trigger_parallel_workers = FLAGS_trigger_parallel_workers,
+      .dump_parallel_workers = FLAGS_dump_parallel_workers};
 
   auto auth_glue = [](memgraph::auth::SynchedAuth *auth, std::unique_ptr<memgraph::query::AuthQueryHandler> &ah,
                       std::unique_ptr<memgraph::query::AuthChecker> &ac) {
@@ -635,6 +700,15 @@ int main(int argc, char **argv) {
     }
   }
 
+  // Plan the hot queries of the MAIN a replica received ahead, so it starts warm once it is promoted
+  memgraph::utils::Scheduler hot_queries_scheduler;
+  hot_queries_scheduler.Run("Hot queries", std::chrono::seconds(1), [&interpreter_context_] {
+    if (auto queries = memgraph::query::GlobalHotQueries().Take()) {
+      const auto planned = memgraph::query::PrewarmPlanCaches(&interpreter_context_, *queries);
+      spdlog::debug("Made {} plans of the hot queries received from the MAIN.", planned);
+    }
+  });
+
   ServerContext context;
   std::string service_name = "Bolt";
   if (!FLAGS_bolt_key_file.empty() && !FLAGS_bolt_cert_file.empty()) {
@@ -653,7 +727,9 @@ int main(int argc, char **argv) {
   Context session_context{&interpreter_context_, auth_.get()};
 #endif
   memgraph::glue::ServerT server(memgraph::communication::v2::handle_errors_t, server_endpoint, &session_context,
-                                 &context, FLAGS_bolt_session_inactivity_timeout, service_name, FLAGS_bolt_num_workers);
+                                 &context, FLAGS_bolt_session_inactivity_timeout, service_name, FLAGS_bolt_num_workers,
+                                 FLAGS_bolt_num_execution_workers,
+                                 std::chrono::milliseconds{FLAGS_bolt_long_execution_threshold_ms});
 
   const auto machine_id = memgraph::utils::GetMachineId();
 
@@ -675,6 +751,13 @@ int main(int argc, char **argv) {
     telemetry->AddExceptionCollector();
     telemetry->AddReplicationCollector();
   }
+
+  std::optional<memgraph::telemetry::OtlpExporter> otlp_exporter;
+  if (!FLAGS_tracing_otlp_endpoint.empty() && FLAGS_tracing_sample_rate > 0) {
+    otlp_exporter.emplace(FLAGS_tracing_otlp_endpoint, "memgraph",
+                          std::chrono::milliseconds(FLAGS_tracing_export_interval_ms));
+    memgraph::utils::tracing::SetSampleRate(FLAGS_tracing_sample_rate);
+  }
   memgraph::license::LicenseInfoSender license_info_sender(telemetry_server, memgraph::glue::run_id_, machine_id,
                                                            memory_limit,
                                                            memgraph::license::global_license_checker.GetLicenseInfo());
@@ -711,7 +794,7 @@ int main(int argc, char **argv) {
     // Shutdown communication server
     server.Shutdown();
     // Stop all triggers, streams and ttl
-    dbms_handler.ForEach([](memgraph::dbms::DatabaseAccess acc) { acc->StopAllBackgroundTasks(); });
+    dbms_handler.ForEachLoaded([](memgraph::dbms::DatabaseAccess acc) { acc->StopAllBackgroundTasks(); });
     // After the server is notified to stop accepting and processing
     // connections we tell the execution engine to stop processing all pending
     // queries.
@@ -9,8 +9,12 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <array>
 #include <atomic>
 #include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include "global_memory_control.hpp"
 #include "query_memory_control.hpp"
@@ -30,8 +34,111 @@ namespace memgraph::memory {
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define STRINGIFY(x) STRINGIFY_HELPER(x)
 
+namespace {
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<int64_t> tracking_batch_size{0};
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<int64_t> tenant_memory_limit{0};
+
+}  // namespace
+
+void SetTrackingBatchSize(int64_t bytes) { tracking_batch_size.store(bytes, std::memory_order_relaxed); }
+
+int64_t TrackingBatchSize() { return tracking_batch_size.load(std::memory_order_relaxed); }
+
+void SetTenantMemoryLimit(int64_t bytes) { tenant_memory_limit.store(bytes, std::memory_order_relaxed); }
+
+int64_t TenantMemoryLimit() { return tenant_memory_limit.load(std::memory_order_relaxed); }
+
 #if USE_JEMALLOC
 
+namespace {
+
+// The allocations of a thread are batched on its shard before they are added to
+// `total_memory_tracker`, so the threads don't all contend on the atomics of the
+// tracker. Unlike thread-local counters the shards outlive the threads, so the
+// batched bytes of a thread which exits aren't lost.
+struct alignas(64) PendingAllocations {
+  std::atomic<int64_t> bytes{0};
+};
+
+constexpr size_t kPendingAllocationShards = 64;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::array<PendingAllocations, kPendingAllocationShards> pending_allocations;
+
+PendingAllocations &CurrentThreadPendingAllocations() {
+  static std::atomic<size_t> next_shard{0};
+  // Trivially destructible, so the first use doesn't register a destructor from within the allocator.
+  thread_local size_t const shard = next_shard.fetch_add(1, std::memory_order_relaxed) % kPendingAllocationShards;
+  return pending_allocations[shard];
+}
+
+void AddPendingAllocations(int64_t bytes) {
+  if (bytes < 0) {
+    memgraph::utils::total_memory_tracker.Free(-bytes);
+  } else if (bytes > 0) {
+    [[maybe_unused]] auto blocker = memgraph::utils::MemoryTracker::OutOfMemoryExceptionBlocker{};
+    memgraph::utils::total_memory_tracker.Alloc(bytes);
+  }
+}
+
+bool TrackAlloc(int64_t size) {
+  auto const batch_size = tracking_batch_size.load(std::memory_order_relaxed);
+  if (batch_size == 0) return memgraph::utils::total_memory_tracker.Alloc(size);
+
+  auto &pending = CurrentThreadPendingAllocations();
+  if (pending.bytes.fetch_add(size, std::memory_order_relaxed) + size < batch_size) return true;
+  auto const batch = pending.bytes.exchange(0, std::memory_order_relaxed);
+  if (batch <= 0) {
+    AddPendingAllocations(batch);
+    return true;
+  }
+  if (memgraph::utils::total_memory_tracker.Alloc(batch)) return true;
+  // Only this allocation fails, the rest of the batch was already allocated.
+  pending.bytes.fetch_add(batch - size, std::memory_order_relaxed);
+  return false;
+}
+
+void TrackFree(int64_t size) {
+  auto const batch_size = tracking_batch_size.load(std::memory_order_relaxed);
+  if (batch_size == 0) {
+    memgraph::utils::total_memory_tracker.Free(size);
+    return;
+  }
+
+  auto &pending = CurrentThreadPendingAllocations();
+  if (pending.bytes.fetch_sub(size, std::memory_order_relaxed) - size > -batch_size) return;
+  AddPendingAllocations(pending.bytes.exchange(0, std::memory_order_relaxed));
+}
+
+// Trackers of the dedicated arenas by the arena index. The trackers are kept
+// with the arenas when the tenants release them, so the memory which outlived
+// a tenant stays accounted to the arena. Arenas at or above the bound are
+// never dedicated, which keeps the lookup of the hooks a single load.
+constexpr unsigned kMaxTenantArenas = 4096;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::array<std::atomic<memgraph::utils::MemoryTracker *>, kMaxTenantArenas> tenant_trackers{};
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::mutex released_arenas_mutex;
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::vector<unsigned> released_arenas;
+
+memgraph::utils::MemoryTracker *TenantTracker(unsigned arena_ind) {
+  if (arena_ind >= kMaxTenantArenas) return nullptr;
+  return tenant_trackers[arena_ind].load(std::memory_order_acquire);
+}
+
+void TrackTenantFree(unsigned arena_ind, int64_t size) {
+  if (auto *tenant = TenantTracker(arena_ind); tenant != nullptr) [[unlikely]] {
+    tenant->Free(size);
+  }
+}
+
+}  // namespace
+
 static void *my_alloc(extent_hooks_t *extent_hooks, void *new_addr, size_t size, size_t alignment, bool *zero,
                       bool *commit, unsigned arena_ind);
 static bool my_dalloc(extent_hooks_t *extent_hooks, void *addr, size_t size, bool committed, unsigned arena_ind);
@@ -66,15 +173,26 @@ void *my_alloc(extent_hooks_t *extent_hooks, void *new_addr, size_t size, size_t
       bool ok = GetQueriesMemoryControl().TrackAllocOnCurrentThread(size);
       if (!ok) return nullptr;
     }
+    auto *tenant = TenantTracker(arena_ind);
+    if (tenant != nullptr && !tenant->Alloc(static_cast<int64_t>(size))) [[unlikely]] {
+      if (GetQueriesMemoryControl().IsThreadTracked()) [[unlikely]] {
+        GetQueriesMemoryControl().TrackFreeOnCurrentThread(size);
+      }
+      return nullptr;
+    }
     // This needs to be here so it doesn't get incremented in case the first TrackAlloc throws an exception
-    bool ok = memgraph::utils::total_memory_tracker.Alloc(static_cast<int64_t>(size));
-    if (!ok) return nullptr;
+    bool ok = TrackAlloc(static_cast<int64_t>(size));
+    if (!ok) {
+      TrackTenantFree(arena_ind, static_cast<int64_t>(size));
+      return nullptr;
+    }
   }
 
   auto *ptr = old_hooks->alloc(extent_hooks, new_addr, size, alignment, zero, commit, arena_ind);
   if (ptr == nullptr) [[unlikely]] {
     if (*commit) {
-      memgraph::utils::total_memory_tracker.Free(static_cast<int64_t>(size));
+      TrackFree(static_cast<int64_t>(size));
+      TrackTenantFree(arena_ind, static_cast<int64_t>(size));
       if (GetQueriesMemoryControl().IsThreadTracked()) [[unlikely]] {
         GetQueriesMemoryControl().TrackFreeOnCurrentThread(size);
       }
@@ -93,7 +211,8 @@ static bool my_dalloc(extent_hooks_t *extent_hooks, void *addr, size_t size, boo
   }
 
   if (committed) [[likely]] {
-    memgraph::utils::total_memory_tracker.Free(static_cast<int64_t>(size));
+    TrackFree(static_cast<int64_t>(size));
+    TrackTenantFree(arena_ind, static_cast<int64_t>(size));
 
     if (GetQueriesMemoryControl().IsThreadTracked()) [[unlikely]] {
       GetQueriesMemoryControl().TrackFreeOnCurrentThread(size);
@@ -105,7 +224,8 @@ static bool my_dalloc(extent_hooks_t *extent_hooks, void *addr, size_t size, boo
 
 static void my_destroy(extent_hooks_t *extent_hooks, void *addr, size_t size, bool committed, unsigned arena_ind) {
   if (committed) [[likely]] {
-    memgraph::utils::total_memory_tracker.Free(static_cast<int64_t>(size));
+    TrackFree(static_cast<int64_t>(size));
+    TrackTenantFree(arena_ind, static_cast<int64_t>(size));
     if (GetQueriesMemoryControl().IsThreadTracked()) [[unlikely]] {
       GetQueriesMemoryControl().TrackFreeOnCurrentThread(size);
     }
@@ -128,8 +248,11 @@ static bool my_commit(extent_hooks_t *extent_hooks, void *addr, size_t size, siz
     DMG_ASSERT(ok);
   }
 
-  [[maybe_unused]] auto ok = memgraph::utils::total_memory_tracker.Alloc(static_cast<int64_t>(length));
+  [[maybe_unused]] auto ok = TrackAlloc(static_cast<int64_t>(length));
   DMG_ASSERT(ok);
+  if (auto *tenant = TenantTracker(arena_ind); tenant != nullptr) [[unlikely]] {
+    tenant->Alloc(static_cast<int64_t>(length));
+  }
 
   return false;
 }
@@ -143,7 +266,8 @@ static bool my_decommit(extent_hooks_t *extent_hooks, void *addr, size_t size, s
     return err;
   }
 
-  memgraph::utils::total_memory_tracker.Free(static_cast<int64_t>(length));
+  TrackFree(static_cast<int64_t>(length));
+  TrackTenantFree(arena_ind, static_cast<int64_t>(length));
   if (GetQueriesMemoryControl().IsThreadTracked()) [[unlikely]] {
     GetQueriesMemoryControl().TrackFreeOnCurrentThread(size);
   }
@@ -159,7 +283,8 @@ static bool my_purge_forced(extent_hooks_t *extent_hooks, void *addr, size_t siz
   if (err) [[unlikely]] {
     return err;
   }
-  memgraph::utils::total_memory_tracker.Free(static_cast<int64_t>(length));
+  TrackFree(static_cast<int64_t>(length));
+  TrackTenantFree(arena_ind, static_cast<int64_t>(length));
 
   if (GetQueriesMemoryControl().IsThreadTracked()) [[unlikely]] {
     GetQueriesMemoryControl().TrackFreeOnCurrentThread(size);
@@ -275,6 +400,88 @@ void UnsetHooks() {
 #endif
 }
 
+TenantArena::Binding::Binding(const TenantArena &arena) {
+#if USE_JEMALLOC
+  if (!arena.arena_) return;
+  unsigned next{*arena.arena_};
+  unsigned previous{0};
+  size_t sz{sizeof(previous)};
+  if (mallctl("thread.arena", &previous, &sz, &next, sizeof(next)) == 0) {
+    previous_ = previous;
+  }
+#endif
+}
+
+TenantArena::Binding::~Binding() {
+#if USE_JEMALLOC
+  if (previous_) {
+    mallctl("thread.arena", nullptr, nullptr, &*previous_, sizeof(unsigned));
+  }
+#endif
+}
+
+TenantArena::TenantArena(int64_t limit) {
+#if USE_JEMALLOC
+  // Without the hooks the memory of the arena couldn't be tracked
+  if (limit == 0 || old_hooks == nullptr) return;
+
+  {
+    auto guard = std::lock_guard{released_arenas_mutex};
+    if (!released_arenas.empty()) {
+      arena_ = released_arenas.back();
+      released_arenas.pop_back();
+    }
+  }
+
+  if (!arena_) {
+    unsigned arena{0};
+    size_t sz{sizeof(arena)};
+    auto *hooks = &custom_hooks;
+    if (mallctl("arenas.create", &arena, &sz, &hooks, sizeof(hooks)) != 0) {
+      spdlog::warn("Failed to create a jemalloc arena, the tenant will use the shared arenas.");
+      return;
+    }
+    if (arena >= kMaxTenantArenas) {
+      spdlog::warn("Too many jemalloc arenas, the tenant will use the shared arenas.");
+      return;
+    }
+    if (tenant_trackers[arena].load(std::memory_order_acquire) == nullptr) {
+      tenant_trackers[arena].store(new utils::MemoryTracker{}, std::memory_order_release);
+    }
+    arena_ = arena;
+  }
+
+  tenant_trackers[*arena_].load(std::memory_order_acquire)->SetHardLimit(limit);
+#endif
+}
+
+TenantArena::~TenantArena() {
+#if USE_JEMALLOC
+  if (!arena_) return;
+  // The objects cached by the current thread would keep their extents from being purged
+  mallctl("thread.tcache.flush", nullptr, nullptr, nullptr, 0);
+  auto const purge = "arena." + std::to_string(*arena_) + ".purge";
+  mallctl(purge.c_str(), nullptr, nullptr, nullptr, 0);
+
+  auto guard = std::lock_guard{released_arenas_mutex};
+  released_arenas.push_back(*arena_);
+#endif
+}
+
+int64_t TenantArena::Amount() const {
+#if USE_JEMALLOC
+  if (arena_) return TenantTracker(*arena_)->Amount();
+#endif
+  return 0;
+}
+
+int64_t TenantArena::HardLimit() const {
+#if USE_JEMALLOC
+  if (arena_) return TenantTracker(*arena_)->HardLimit();
+#endif
+  return 0;
+}
+
 void PurgeUnusedMemory() {
 #if USE_JEMALLOC
   mallctl("arena." STRINGIFY(MALLCTL_ARENAS_ALL) ".purge", nullptr, nullptr, nullptr, 0);
@@ -283,6 +490,47 @@ void PurgeUnusedMemory() {
 #endif
 }
 
+AllocatorStats GetAllocatorStats() {
+  AllocatorStats stats{};
+#if USE_JEMALLOC
+  // The statistics are cached by jemalloc until the epoch is advanced
+  uint64_t epoch = 1;
+  size_t sz = sizeof(epoch);
+  mallctl("epoch", &epoch, &sz, &epoch, sz);
+
+  auto const read_size = [](const char *name) -> uint64_t {
+    size_t value = 0;
+    size_t value_sz = sizeof(value);
+    if (mallctl(name, &value, &value_sz, nullptr, 0) != 0) return 0;
+    return value;
+  };
+  stats.allocated = read_size("stats.allocated");
+  stats.active = read_size("stats.active");
+  stats.metadata = read_size("stats.metadata");
+  stats.resident = read_size("stats.resident");
+  stats.mapped = read_size("stats.mapped");
+  stats.retained = read_size("stats.retained");
+
+  auto const page = read_size("arenas.page");
+  unsigned n_arenas = 0;
+  sz = sizeof(n_arenas);
+  if (mallctl("arenas.narenas", &n_arenas, &sz, nullptr, 0) != 0) return stats;
+  for (unsigned i = 0; i < n_arenas; ++i) {
+    bool initialized = false;
+    sz = sizeof(initialized);
+    auto const prefix = std::to_string(i);
+    if (mallctl(("arena." + prefix + ".initialized").c_str(), &initialized, &sz, nullptr, 0) != 0 || !initialized) {
+      continue;
+    }
+    stats.arenas.push_back(ArenaStats{.index = i,
+                                      .active = page * read_size(("stats.arenas." + prefix + ".pactive").c_str()),
+                                      .dirty = page * read_size(("stats.arenas." + prefix + ".pdirty").c_str()),
+                                      .muzzy = page * read_size(("stats.arenas." + prefix + ".pmuzzy").c_str())});
+  }
+#endif
+  return stats;
+}
+
 #undef STRINGIFY
 #undef STRINGIFY_HELPER
 
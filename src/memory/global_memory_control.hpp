@@ -12,11 +12,95 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
 #include "utils/logging.hpp"
 namespace memgraph::memory {
 
 void PurgeUnusedMemory();
+
+// Pages of a jemalloc arena, in bytes.
+struct ArenaStats {
+  unsigned index;
+  uint64_t active;
+  uint64_t dirty;
+  uint64_t muzzy;
+};
+
+// Statistics of jemalloc in bytes, refreshed on each call. All of them are 0
+// when Memgraph isn't built with jemalloc or its statistics are disabled.
+struct AllocatorStats {
+  uint64_t allocated;
+  uint64_t active;
+  uint64_t metadata;
+  uint64_t resident;
+  uint64_t mapped;
+  uint64_t retained;
+  // The initialized arenas.
+  std::vector<ArenaStats> arenas;
+};
+
+AllocatorStats GetAllocatorStats();
 void SetHooks();
 void UnsetHooks();
 
+// Sets how many bytes the threads allocate or free before they are added to
+// the memory trackers, 0 tracks every allocation directly. The limits are
+// checked when the allocations are added, so a thread can exceed them by
+// the batch size.
+void SetTrackingBatchSize(int64_t bytes);
+int64_t TrackingBatchSize();
+
+// Sets the quota of the tenants, e.g. the databases, in bytes. Each tenant
+// created afterwards gets a dedicated arena with this limit, 0 keeps the
+// tenants on the shared arenas.
+void SetTenantMemoryLimit(int64_t bytes);
+int64_t TenantMemoryLimit();
+
+// Dedicated jemalloc arena of a tenant. The memory the arena maps is tracked
+// by a tracker of its own, whose hard limit is the quota of the tenant, on top
+// of the total memory tracker. Only the threads bound to the arena allocate
+// from it, frees are tracked against the arena which served the allocation
+// whichever thread makes them.
+class TenantArena {
+ public:
+  // Binds the current thread to the arena for the lifetime of the binding.
+  class Binding {
+   public:
+    explicit Binding(const TenantArena &arena);
+    ~Binding();
+
+    Binding(const Binding &) = delete;
+    Binding &operator=(const Binding &) = delete;
+    Binding(Binding &&) = delete;
+    Binding &operator=(Binding &&) = delete;
+
+   private:
+    std::optional<unsigned> previous_;
+  };
+
+  // Takes a released arena or creates a new one if @p limit isn't 0 and the
+  // allocations are tracked, otherwise the tenant stays on the shared arenas.
+  explicit TenantArena(int64_t limit);
+  // Purges the unused memory of the arena and releases it for the next tenant.
+  ~TenantArena();
+
+  TenantArena(const TenantArena &) = delete;
+  TenantArena &operator=(const TenantArena &) = delete;
+  TenantArena(TenantArena &&) = delete;
+  TenantArena &operator=(TenantArena &&) = delete;
+
+  [[nodiscard]] Binding Bind() const { return Binding{*this}; }
+
+  bool IsDedicated() const { return arena_.has_value(); }
+
+  // Committed memory of the arena, 0 if the tenant has no dedicated arena.
+  int64_t Amount() const;
+  int64_t HardLimit() const;
+
+ private:
+  std::optional<unsigned> arena_;
+};
+
 }  // namespace memgraph::memory
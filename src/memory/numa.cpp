@@ -0,0 +1,218 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "memory/numa.hpp"
+
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "utils/event_counter.hpp"
+#include "utils/logging.hpp"
+#include "utils/memory_tracker.hpp"
+
+#if USE_JEMALLOC
+#include "jemalloc/jemalloc.h"
+#endif
+
+namespace memgraph::metrics {
+extern const Event NumaLocalAllocations;
+extern const Event NumaUnknownNodeAllocations;
+}  // namespace memgraph::metrics
+
+namespace memgraph::memory {
+
+namespace {
+
+constexpr unsigned kMaxNumaNodes = 64;
+// From linux/mempolicy.h
+constexpr int kMpolPreferred = 1;
+
+// Parses the Linux cpulist format, e.g. "0-3,8-11".
+std::vector<unsigned> ParseCpuList(const std::string &list) {
+  std::vector<unsigned> cpus;
+  size_t pos = 0;
+  while (pos < list.size()) {
+    auto end = list.find(',', pos);
+    if (end == std::string::npos) end = list.size();
+    auto range = list.substr(pos, end - pos);
+    pos = end + 1;
+    if (range.empty()) continue;
+    auto dash = range.find('-');
+    auto first = std::stoul(range.substr(0, dash));
+    auto last = dash == std::string::npos ? first : std::stoul(range.substr(dash + 1));
+    for (auto cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+  }
+  return cpus;
+}
+
+struct NumaTopology {
+  // Node of every CPU, -1 for CPUs without a node.
+  std::vector<int> cpu_node;
+  unsigned node_count{0};
+};
+
+NumaTopology ReadNumaTopology() {
+  NumaTopology topology;
+  std::error_code ec;
+  for (const auto &entry : std::filesystem::directory_iterator("/sys/devices/system/node", ec)) {
+    auto name = entry.path().filename().string();
+    if (!name.starts_with("node") || name.size() == 4 ||
+        !std::all_of(name.begin() + 4, name.end(), [](char c) { return c >= '0' && c <= '9'; })) {
+      continue;
+    }
+    auto node = std::stoul(name.substr(4));
+    if (node >= kMaxNumaNodes) continue;
+    std::ifstream cpulist(entry.path() / "cpulist");
+    std::string list;
+    if (!std::getline(cpulist, list)) continue;
+    auto cpus = ParseCpuList(list);
+    if (cpus.empty()) continue;
+    for (auto cpu : cpus) {
+      if (cpu >= topology.cpu_node.size()) topology.cpu_node.resize(cpu + 1, -1);
+      topology.cpu_node[cpu] = static_cast<int>(node);
+    }
+    topology.node_count = std::max(topology.node_count, static_cast<unsigned>(node + 1));
+  }
+  return topology;
+}
+
+const NumaTopology &GetNumaTopology() {
+  static const NumaTopology topology = ReadNumaTopology();
+  return topology;
+}
+
+#if USE_JEMALLOC
+
+// The hooks of the default arenas (with memory tracking) which the hooks of
+// the NUMA arenas delegate to.
+extent_hooks_t *tracked_hooks = nullptr;
+extent_hooks_t numa_hooks;
+
+// Node of every NUMA arena. Filled before any allocation goes through the
+// arena, except for the ones done while the arena is being created.
+std::array<std::atomic<unsigned>, kMaxNumaNodes> numa_arenas{};
+std::atomic<unsigned> numa_arena_count{0};
+std::atomic<unsigned> creating_node{0};
+
+unsigned ArenaNode(unsigned arena_ind) {
+  auto const count = numa_arena_count.load(std::memory_order_acquire);
+  for (unsigned node = 0; node < count; ++node) {
+    if (numa_arenas[node].load(std::memory_order_relaxed) == arena_ind) return node;
+  }
+  return creating_node.load(std::memory_order_relaxed);
+}
+
+void *NumaAlloc(extent_hooks_t *extent_hooks, void *new_addr, size_t size, size_t alignment, bool *zero, bool *commit,
+                unsigned arena_ind) {
+  auto *ptr = tracked_hooks->alloc(extent_hooks, new_addr, size, alignment, zero, commit, arena_ind);
+  if (ptr == nullptr) [[unlikely]] {
+    return nullptr;
+  }
+  // The pages aren't touched yet if they are fresh, so they get placed on the
+  // node on first touch. Failing to bind only costs locality.
+  uint64_t const node_mask = uint64_t{1} << ArenaNode(arena_ind);
+  syscall(SYS_mbind, ptr, size, kMpolPreferred, &node_mask, kMaxNumaNodes + 1, 0);
+  return ptr;
+}
+
+class NumaLocalMemoryResourceImpl final : public utils::MemoryResource {
+ public:
+  explicit NumaLocalMemoryResourceImpl(std::vector<int> cpu_node) : cpu_node_(std::move(cpu_node)) {}
+
+ private:
+  void *DoAllocate(size_t bytes, size_t alignment) override {
+    int flags = MALLOCX_ALIGN(alignment);
+    auto const cpu = sched_getcpu();
+    if (cpu >= 0 && static_cast<size_t>(cpu) < cpu_node_.size() && cpu_node_[cpu] >= 0) {
+      // The thread cache doesn't keep regions of different arenas apart
+      flags |= MALLOCX_ARENA(numa_arenas[cpu_node_[cpu]].load(std::memory_order_relaxed)) | MALLOCX_TCACHE_NONE;
+      metrics::IncrementCounter(metrics::NumaLocalAllocations);
+    } else {
+      metrics::IncrementCounter(metrics::NumaUnknownNodeAllocations);
+    }
+    auto *ptr = mallocx(bytes, flags);
+    if (ptr != nullptr) [[likely]] {
+      return ptr;
+    }
+
+    [[maybe_unused]] auto blocker = utils::MemoryTracker::OutOfMemoryExceptionBlocker{};
+    auto maybe_msg = utils::MemoryErrorStatus().msg();
+    if (maybe_msg) {
+      throw utils::OutOfMemoryException{std::move(*maybe_msg)};
+    }
+    throw std::bad_alloc{};
+  }
+
+  void DoDeallocate(void *p, size_t bytes, size_t alignment) override {
+    sdallocx(p, bytes, MALLOCX_ALIGN(alignment) | MALLOCX_TCACHE_NONE);
+  }
+
+  bool DoIsEqual(const utils::MemoryResource &other) const noexcept override { return this == &other; }
+
+  std::vector<int> cpu_node_;
+};
+
+utils::MemoryResource *CreateNumaLocalMemoryResource() {
+  const auto &topology = GetNumaTopology();
+  if (topology.node_count < 2) return nullptr;
+
+  size_t hooks_len = sizeof(tracked_hooks);
+  if (mallctl("arena.0.extent_hooks", &tracked_hooks, &hooks_len, nullptr, 0) != 0 || tracked_hooks == nullptr) {
+    spdlog::warn("Couldn't read the jemalloc extent hooks, NUMA-aware allocation is disabled.");
+    return nullptr;
+  }
+  numa_hooks = *tracked_hooks;
+  numa_hooks.alloc = &NumaAlloc;
+
+  for (unsigned node = 0; node < topology.node_count; ++node) {
+    creating_node.store(node, std::memory_order_relaxed);
+    unsigned arena_ind{0};
+    size_t arena_ind_len = sizeof(arena_ind);
+    extent_hooks_t *hooks = &numa_hooks;
+    if (mallctl("arenas.create", &arena_ind, &arena_ind_len, &hooks, sizeof(hooks)) != 0) {
+      LOG_FATAL("Error creating the jemalloc arena for NUMA node {}", node);
+    }
+    numa_arenas[node].store(arena_ind, std::memory_order_relaxed);
+    numa_arena_count.store(node + 1, std::memory_order_release);
+  }
+  spdlog::info("Created jemalloc arenas for {} NUMA nodes.", topology.node_count);
+
+  static NumaLocalMemoryResourceImpl resource(topology.cpu_node);
+  return &resource;
+}
+
+#endif
+
+}  // namespace
+
+unsigned NumaNodeCount() { return GetNumaTopology().node_count; }
+
+utils::MemoryResource *NumaLocalMemoryResource() {
+#if USE_JEMALLOC
+  static utils::MemoryResource *const resource = CreateNumaLocalMemoryResource();
+  return resource;
+#else
+  return nullptr;
+#endif
+}
+
+}  // namespace memgraph::memory
@@ -0,0 +1,31 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include "utils/memory.hpp"
+
+namespace memgraph::memory {
+
+/// Returns the number of NUMA nodes that have CPUs, 0 if the topology can't be
+/// read.
+unsigned NumaNodeCount();
+
+/// Returns a MemoryResource which allocates from a jemalloc arena per NUMA
+/// node. Memory of an arena is bound (preferred) to its node and every
+/// allocation is served by the arena of the node the calling thread currently
+/// runs on, so pinning a worker to a node keeps the objects it creates local.
+/// The arenas are created on the first call, which must happen after
+/// `SetHooks`. Returns nullptr if there is only one node or if memgraph isn't
+/// built with jemalloc.
+utils::MemoryResource *NumaLocalMemoryResource();
+
+}  // namespace memgraph::memory
@@ -18,6 +18,7 @@
 #include <tuple>
 #include <utility>
 
+#include "global_memory_control.hpp"
 #include "query_memory_control.hpp"
 #include "utils/exceptions.hpp"
 #include "utils/logging.hpp"
@@ -33,34 +34,36 @@ namespace memgraph::memory {
 
 #if USE_JEMALLOC
 
-void QueriesMemoryControl::UpdateThreadToTransactionId(const std::thread::id &thread_id, uint64_t transaction_id) {
-  auto accessor = thread_id_to_transaction_id.access();
-  auto elem = accessor.find(thread_id);
-  if (elem == accessor.end()) {
-    accessor.insert({thread_id, {transaction_id, 1}});
-  } else {
-    elem->transaction_id.cnt++;
-  }
+namespace {
+
+// Bytes the current thread allocated (or freed, if negative) for its transaction which weren't added to the
+// tracker of the transaction yet, see `TrackingBatchSize`. Trivially destructible, so the first use doesn't
+// register a destructor from within the allocator.
+int64_t &PendingQueryAllocations() {
+  thread_local int64_t pending_bytes{0};
+  return pending_bytes;
 }
 
-void QueriesMemoryControl::EraseThreadToTransactionId(const std::thread::id &thread_id, uint64_t transaction_id) {
-  auto accessor = thread_id_to_transaction_id.access();
-  auto elem = accessor.find(thread_id);
-  MG_ASSERT(elem != accessor.end() && elem->transaction_id == transaction_id);
-  elem->transaction_id.cnt--;
-  if (elem->transaction_id.cnt == 0) {
-    accessor.remove(thread_id);
+void AddPendingQueryAllocations(utils::QueryMemoryTracker &query_tracker, int64_t bytes) {
+  if (bytes < 0) {
+    query_tracker.TrackFree(static_cast<size_t>(-bytes));
+  } else if (bytes > 0) {
+    [[maybe_unused]] auto blocker = utils::MemoryTracker::OutOfMemoryExceptionBlocker{};
+    query_tracker.TrackAlloc(static_cast<size_t>(bytes));
   }
 }
 
-bool QueriesMemoryControl::TrackAllocOnCurrentThread(size_t size) {
+}  // namespace
+
+template <typename Func>
+void QueriesMemoryControl::WithCurrentThreadTracker(Func &&func) {
   auto thread_id_to_transaction_id_accessor = thread_id_to_transaction_id.access();
 
   // we might be just constructing mapping between thread id and transaction id
   // so we miss this allocation
   auto thread_id_to_transaction_id_elem = thread_id_to_transaction_id_accessor.find(std::this_thread::get_id());
   if (thread_id_to_transaction_id_elem == thread_id_to_transaction_id_accessor.end()) {
-    return true;
+    return;
   }
 
   auto transaction_id_to_tracker_accessor = transaction_id_to_tracker.access();
@@ -70,33 +73,63 @@ bool QueriesMemoryControl::TrackAllocOnCurrentThread(size_t size) {
   // It can happen that some allocation happens between mapping thread to
   // transaction id, so we miss this allocation
   if (transaction_id_to_tracker == transaction_id_to_tracker_accessor.end()) [[unlikely]] {
-    return true;
+    return;
   }
-  auto &query_tracker = transaction_id_to_tracker->tracker;
-  return query_tracker.TrackAlloc(size);
+  std::forward<Func>(func)(transaction_id_to_tracker->tracker);
 }
 
-void QueriesMemoryControl::TrackFreeOnCurrentThread(size_t size) {
-  auto thread_id_to_transaction_id_accessor = thread_id_to_transaction_id.access();
-
-  // we might be just constructing mapping between thread id and transaction id
-  // so we miss this allocation
-  auto thread_id_to_transaction_id_elem = thread_id_to_transaction_id_accessor.find(std::this_thread::get_id());
-  if (thread_id_to_transaction_id_elem == thread_id_to_transaction_id_accessor.end()) {
-    return;
+void QueriesMemoryControl::UpdateThreadToTransactionId(const std::thread::id &thread_id, uint64_t transaction_id) {
+  auto accessor = thread_id_to_transaction_id.access();
+  auto elem = accessor.find(thread_id);
+  if (elem == accessor.end()) {
+    accessor.insert({thread_id, {transaction_id, 1}});
+  } else {
+    elem->transaction_id.cnt++;
   }
+}
 
-  auto transaction_id_to_tracker_accessor = transaction_id_to_tracker.access();
-  auto transaction_id_to_tracker =
-      transaction_id_to_tracker_accessor.find(thread_id_to_transaction_id_elem->transaction_id);
+void QueriesMemoryControl::EraseThreadToTransactionId(const std::thread::id &thread_id, uint64_t transaction_id) {
+  auto accessor = thread_id_to_transaction_id.access();
+  auto elem = accessor.find(thread_id);
+  MG_ASSERT(elem != accessor.end() && elem->transaction_id == transaction_id);
+  elem->transaction_id.cnt--;
+  if (elem->transaction_id.cnt == 0) {
+    accessor.remove(thread_id);
+  }
+}
 
-  // It can happen that some allocation happens between mapping thread to
-  // transaction id, so we miss this allocation
-  if (transaction_id_to_tracker == transaction_id_to_tracker_accessor.end()) [[unlikely]] {
-    return;
+bool QueriesMemoryControl::TrackAllocOnCurrentThread(size_t size) {
+  auto &pending_bytes = PendingQueryAllocations();
+  auto const batch_size = TrackingBatchSize();
+  if (batch_size != 0 && pending_bytes + static_cast<int64_t>(size) < batch_size) {
+    pending_bytes += static_cast<int64_t>(size);
+    return true;
   }
-  auto &query_tracker = transaction_id_to_tracker->tracker;
-  query_tracker.TrackFree(size);
+  auto const batch = std::exchange(pending_bytes, 0);
+
+  // Allocations of threads which aren't mapped to a tracked transaction (yet) are missed.
+  bool ok = true;
+  WithCurrentThreadTracker([batch, size, &ok](utils::QueryMemoryTracker &query_tracker) {
+    AddPendingQueryAllocations(query_tracker, batch);
+    ok = query_tracker.TrackAlloc(size);
+  });
+  return ok;
+}
+
+void QueriesMemoryControl::TrackFreeOnCurrentThread(size_t size) {
+  auto &pending_bytes = PendingQueryAllocations();
+  pending_bytes -= static_cast<int64_t>(size);
+  if (pending_bytes > -TrackingBatchSize()) return;
+  auto const batch = std::exchange(pending_bytes, 0);
+  WithCurrentThreadTracker(
+      [batch](utils::QueryMemoryTracker &query_tracker) { AddPendingQueryAllocations(query_tracker, batch); });
+}
+
+void QueriesMemoryControl::FlushCurrentThread() {
+  auto const batch = std::exchange(PendingQueryAllocations(), 0);
+  if (batch == 0) return;
+  WithCurrentThreadTracker(
+      [batch](utils::QueryMemoryTracker &query_tracker) { AddPendingQueryAllocations(query_tracker, batch); });
 }
 
 void QueriesMemoryControl::CreateTransactionIdTracker(uint64_t transaction_id, size_t inital_limit) {
@@ -118,6 +151,15 @@ bool QueriesMemoryControl::CheckTransactionIdTrackerExists(uint64_t transaction_
   return transaction_id_to_tracker_accessor.contains(transaction_id);
 }
 
+int64_t QueriesMemoryControl::TransactionIdPeak(uint64_t transaction_id) {
+  auto transaction_id_to_tracker_accessor = transaction_id_to_tracker.access();
+  auto query_tracker = transaction_id_to_tracker_accessor.find(transaction_id);
+  if (query_tracker == transaction_id_to_tracker_accessor.end()) {
+    return 0;
+  }
+  return query_tracker->tracker.QueryPeak();
+}
+
 void QueriesMemoryControl::TryCreateTransactionProcTracker(uint64_t transaction_id, int64_t procedure_id,
                                                            size_t limit) {
   auto transaction_id_to_tracker_accessor = transaction_id_to_tracker.access();
@@ -173,6 +215,7 @@ void StartTrackingCurrentThreadTransaction(uint64_t transaction_id) {
 
 void StopTrackingCurrentThreadTransaction(uint64_t transaction_id) {
 #if USE_JEMALLOC
+  GetQueriesMemoryControl().FlushCurrentThread();
   Get_Thread_Tracker() = 0;
   GetQueriesMemoryControl().EraseThreadToTransactionId(std::this_thread::get_id(), transaction_id);
 #endif
@@ -205,6 +248,14 @@ bool IsTransactionTracked(uint64_t transaction_id) {
 bool IsTransactionTracked(uint64_t /*transaction_id*/) { return false; }
 #endif
 
+#if USE_JEMALLOC
+int64_t TransactionPeakMemory(uint64_t transaction_id) {
+  return GetQueriesMemoryControl().TransactionIdPeak(transaction_id);
+}
+#else
+int64_t TransactionPeakMemory(uint64_t /*transaction_id*/) { return 0; }
+#endif
+
 void CreateOrContinueProcedureTracking(uint64_t transaction_id, int64_t procedure_id, size_t limit) {
 #if USE_JEMALLOC
   if (!GetQueriesMemoryControl().CheckTransactionIdTrackerExists(transaction_id)) {
@@ -69,6 +69,10 @@ class QueriesMemoryControl {
   // necessary
   void TrackFreeOnCurrentThread(size_t size);
 
+  // Add the allocations the current thread batched to the tracker of its
+  // transaction, must be called before the thread stops tracking it
+  void FlushCurrentThread();
+
   void TryCreateTransactionProcTracker(uint64_t, int64_t, size_t);
 
   void SetActiveProcIdTracker(uint64_t, int64_t);
@@ -77,7 +81,15 @@ class QueriesMemoryControl {
 
   bool IsThreadTracked();
 
+  // Peak memory tracked for transaction_id, zero if it isn't tracked
+  int64_t TransactionIdPeak(uint64_t);
+
  private:
+  // Calls `func` with the tracker of the transaction of the current thread,
+  // if the thread is tracked
+  template <typename Func>
+  void WithCurrentThreadTracker(Func &&func);
+
   struct TransactionId {
     uint64_t id;
     uint64_t cnt;
@@ -144,6 +156,9 @@ void TryStopTrackingOnTransaction(uint64_t transaction_id);
 // Is transaction with given id tracked in memory tracker
 bool IsTransactionTracked(uint64_t transaction_id);
 
+// Peak memory of the transaction, zero if it isn't tracked
+int64_t TransactionPeakMemory(uint64_t transaction_id);
+
 // Creates tracker on procedure if doesn't exist. Sets query tracker
 // to track procedure with id.
 void CreateOrContinueProcedureTracking(uint64_t transaction_id, int64_t procedure_id, size_t limit);
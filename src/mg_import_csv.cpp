@@ -12,11 +12,16 @@
 #include <gflags/gflags.h>
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstdio>
+#include <deque>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <mutex>
 #include <optional>
 #include <regex>
+#include <thread>
 #include <unordered_map>
 
 #include "dbms/inmemory/storage_helper.hpp"
@@ -62,6 +67,15 @@ bool ValidateIdTypeOptions(const char *flagname, const std::string &value) {
 // CSV file on a correctly set-up Memgraph installation.
 DEFINE_string(data_directory, "mg_data", "Path to directory in which to save all permanent data.");
 DEFINE_bool(storage_properties_on_edges, false, "Controls whether relationships have properties.");
+DEFINE_uint64(storage_items_per_batch, memgraph::storage::Config::Durability().items_per_batch,
+              "The number of edges and vertices stored in a batch in a snapshot file.");
+DEFINE_bool(storage_parallel_snapshot_creation, false,
+            "Controls whether the vertices and edges are written to the snapshot in a multithreaded fashion. The "
+            "number of threads is set by storage_recovery_thread_count.");
+DEFINE_uint64(storage_recovery_thread_count,
+              std::max(static_cast<uint64_t>(std::thread::hardware_concurrency()),
+                       memgraph::storage::Config::Durability().recovery_thread_count),
+              "The number of threads used to recover persisted data from disk.");
 
 // CSV import flags.
 DEFINE_string(array_delimiter, ";", "Delimiter between elements of array values.");
@@ -83,6 +97,9 @@ DEFINE_string(id_type, "STRING",
               "Which data type should be used to store the supplied node IDs. "
               "Possible options are: STRING/INTEGER");
 DEFINE_validator(id_type, &ValidateIdTypeOptions);
+DEFINE_uint64(parser_threads, std::max(1U, std::thread::hardware_concurrency()),
+              "Number of files supplied in a single flag which are parsed concurrently. The nodes and relationships "
+              "are still created in the order of the files.");
 // Arguments `--nodes` and `--relationships` can be input multiple times and are
 // handled with custom parsing.
 DEFINE_string(nodes, "",
@@ -427,109 +444,379 @@ std::string GetIdSpace(const std::string &type) {
   return res[3];
 }
 
+// A row of a CSV file, with the values of its property fields converted.
+struct ParsedRow {
+  std::vector<std::string> columns;
+  // Converted values of the property fields, null for the other fields.
+  std::vector<memgraph::storage::PropertyValue> values;
+  // Line on which the row starts.
+  uint64_t row_number{0};
+  // Set if the row couldn't be read, or if the value of `error_field` couldn't
+  // be converted.
+  std::optional<std::string> error;
+  std::optional<size_t> error_field;
+};
+
+/// Reads the rows of a file and converts their property values on a thread of
+/// its own, while the previous rows are being stored. The rows are returned in
+/// batches in the order of the file, until the first row with an error.
+class FileParser {
+ public:
+  using Batch = std::vector<ParsedRow>;
+
+  FileParser(std::ifstream file, uint64_t row_number, const std::vector<Field> &fields,
+             std::function<bool(const Field &)> is_property)
+      : file_(std::move(file)), row_number_(row_number), fields_(fields), is_property_(std::move(is_property)) {
+    thread_ = std::jthread([this] { Parse(); });
+  }
+
+  FileParser(const FileParser &) = delete;
+  FileParser &operator=(const FileParser &) = delete;
+  FileParser(FileParser &&) = delete;
+  FileParser &operator=(FileParser &&) = delete;
+
+  ~FileParser() {
+    {
+      std::lock_guard guard{mutex_};
+      stop_ = true;
+    }
+    cv_.notify_all();
+  }
+
+  /// Returns the next batch of rows, an empty one at the end of the file.
+  Batch Next() {
+    std::unique_lock lock{mutex_};
+    cv_.wait(lock, [this] { return !batches_.empty() || done_; });
+    if (batches_.empty()) return {};
+    auto batch = std::move(batches_.front());
+    batches_.pop_front();
+    lock.unlock();
+    cv_.notify_all();
+    return batch;
+  }
+
+ private:
+  static constexpr size_t kBatchRows = 1024;
+  static constexpr size_t kMaxQueuedBatches = 16;
+
+  void Parse() {
+    Batch batch;
+    bool end = false;
+    while (!end) {
+      auto &parsed = batch.emplace_back();
+      parsed.row_number = row_number_;
+      try {
+        auto [row, lines_count] = ReadRow(file_);
+        if (lines_count == 0) {
+          batch.pop_back();
+          end = true;
+        } else {
+          row_number_ += lines_count;
+          Convert(std::move(row), &parsed);
+          end = parsed.error.has_value();
+        }
+      } catch (const LoadException &e) {
+        parsed.error = e.what();
+        end = true;
+      }
+      if ((batch.size() == kBatchRows || end) && !Push(std::exchange(batch, {}))) return;
+    }
+    {
+      std::lock_guard guard{mutex_};
+      done_ = true;
+    }
+    cv_.notify_all();
+  }
+
+  void Convert(std::vector<std::string> row, ParsedRow *parsed) const {
+    if ((!FLAGS_ignore_extra_columns && row.size() != fields_.size()) ||
+        (FLAGS_ignore_extra_columns && row.size() < fields_.size()))
+      throw LoadException(
+          "Expected as many values as there are header fields (found {}, "
+          "expected {})",
+          row.size(), fields_.size());
+    if (row.size() > fields_.size()) {
+      row.resize(fields_.size());
+    }
+    parsed->values.resize(row.size());
+    for (size_t i = 0; i < row.size(); ++i) {
+      if (!is_property_(fields_[i])) continue;
+      try {
+        parsed->values[i] = StringToValue(row[i], fields_[i].type);
+      } catch (const LoadException &e) {
+        parsed->error = e.what();
+        parsed->error_field = i;
+        break;
+      }
+    }
+    parsed->columns = std::move(row);
+  }
+
+  /// Returns false if the rows are no longer read.
+  bool Push(Batch batch) {
+    if (batch.empty()) return true;
+    {
+      std::unique_lock lock{mutex_};
+      cv_.wait(lock, [this] { return stop_ || batches_.size() < kMaxQueuedBatches; });
+      if (stop_) return false;
+      batches_.push_back(std::move(batch));
+    }
+    cv_.notify_all();
+    return true;
+  }
+
+  std::ifstream file_;
+  uint64_t row_number_;
+  const std::vector<Field> &fields_;
+  std::function<bool(const Field &)> is_property_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<Batch> batches_;
+  bool done_{false};
+  bool stop_{false};
+
+  // Declared last, so it's joined before the other members are destroyed.
+  std::jthread thread_;
+};
+
+/// Creates the objects of many rows in a single transaction, instead of
+/// committing each row on its own.
+class BatchedTransactions {
+ public:
+  BatchedTransactions(memgraph::storage::Storage *store, std::string objects)
+      : store_(store), objects_(std::move(objects)) {}
+
+  memgraph::storage::Storage::Accessor *Accessor() {
+    if (!accessor_) accessor_ = store_->Access();
+    return accessor_.get();
+  }
+
+  /// @throw LoadException
+  void RowStored() {
+    if (++rows_ == kRowsPerTransaction) Commit();
+  }
+
+  /// @throw LoadException
+  void Commit() {
+    if (!accessor_) return;
+    rows_ = 0;
+    auto accessor = std::move(accessor_);
+    if (accessor->Commit().HasError()) throw LoadException("Couldn't store the {}", objects_);
+  }
+
+ private:
+  static constexpr uint64_t kRowsPerTransaction = 100'000;
+
+  memgraph::storage::Storage *store_;
+  std::string objects_;
+  std::unique_ptr<memgraph::storage::Storage::Accessor> accessor_;
+  uint64_t rows_{0};
+};
+
+/// Ids of the label and edge type names found in the files, so each of the
+/// names is looked up only once.
+struct NameIds {
+  memgraph::storage::LabelId Label(memgraph::storage::Storage::Accessor *acc, const std::string &name) {
+    auto it = labels.find(name);
+    if (it == labels.end()) it = labels.emplace(name, acc->NameToLabel(name)).first;
+    return it->second;
+  }
+
+  memgraph::storage::EdgeTypeId EdgeType(memgraph::storage::Storage::Accessor *acc, const std::string &name) {
+    auto it = edge_types.find(name);
+    if (it == edge_types.end()) it = edge_types.emplace(name, acc->NameToEdgeType(name)).first;
+    return it->second;
+  }
+
+  std::unordered_map<std::string, memgraph::storage::LabelId> labels;
+  std::unordered_map<std::string, memgraph::storage::EdgeTypeId> edge_types;
+};
+
+/// Parses the files supplied in a single flag, up to `--parser-threads` of
+/// them at a time, and calls `process_row` for each of their rows in the
+/// order of the files. The header is read from the first file, and passed to
+/// `on_header` before any of the rows are processed.
+template <class TOnHeader, class TProcessRow>
+void ProcessFiles(const std::vector<std::string> &files, const std::function<bool(const Field &)> &is_property,
+                  TOnHeader &&on_header, TProcessRow &&process_row) {
+  std::optional<std::vector<Field>> header;
+  std::deque<std::pair<std::string, std::unique_ptr<FileParser>>> parsers;
+  size_t next_file = 0;
+  auto start_parsers = [&] {
+    while (next_file < files.size() && parsers.size() < std::max<uint64_t>(FLAGS_parser_threads, 1)) {
+      const auto &path = files[next_file++];
+      std::ifstream file(path);
+      MG_ASSERT(file, "Unable to open '{}'", path);
+      uint64_t row_number = 1;
+      if (!header) {
+        try {
+          auto [fields, header_lines] = ReadHeader(file);
+          row_number += header_lines;
+          header.emplace(std::move(fields));
+        } catch (const LoadException &e) {
+          LOG_FATAL("Couldn't process row {} of '{}' because of: {}", row_number, path, e.what());
+        }
+        on_header(*header);
+      }
+      parsers.emplace_back(path, std::make_unique<FileParser>(std::move(file), row_number, *header, is_property));
+    }
+  };
+
+  start_parsers();
+  while (!parsers.empty()) {
+    const auto &[path, parser] = parsers.front();
+    spdlog::info("Loading {}", path);
+    uint64_t row_number = 0;
+    try {
+      for (auto batch = parser->Next(); !batch.empty(); batch = parser->Next()) {
+        for (auto &row : batch) {
+          row_number = row.row_number;
+          if (row.error && !row.error_field) throw LoadException("{}", *row.error);
+          process_row(row, *header);
+        }
+      }
+    } catch (const LoadException &e) {
+      LOG_FATAL("Couldn't process row {} of '{}' because of: {}", row_number, path, e.what());
+    }
+    parsers.pop_front();
+    start_parsers();
+  }
+}
+
 /// @throw LoadException
-void ProcessNodeRow(memgraph::storage::Storage *store, const std::vector<std::string> &row,
-                    const std::vector<Field> &fields, const std::vector<std::string> &additional_labels,
+void ProcessNodeRow(BatchedTransactions *transactions, ParsedRow &row, const std::vector<Field> &fields,
+                    const std::vector<memgraph::storage::PropertyId> &properties,
+                    const std::vector<memgraph::storage::LabelId> &additional_labels, NameIds *name_ids,
                     std::unordered_map<NodeId, memgraph::storage::Gid> *node_id_map) {
+  // The ID is checked first, so a skipped duplicate node isn't created.
   std::optional<NodeId> id;
-  auto acc = store->Access();
+  for (size_t i = 0; i < row.columns.size(); ++i) {
+    const auto &field = fields[i];
+    if (!memgraph::utils::StartsWith(field.type, "ID")) continue;
+    if (id) throw LoadException("Only one node ID must be specified");
+    if (FLAGS_id_type == "INTEGER") {
+      // Call `StringToInt` to verify that the ID is a valid integer.
+      StringToInt(row.columns[i]);
+    }
+    NodeId node_id{row.columns[i], GetIdSpace(field.type)};
+    if (node_id_map->contains(node_id)) {
+      if (FLAGS_skip_duplicate_nodes) {
+        spdlog::warn(memgraph::utils::MessageWithLink("Skipping duplicate node with ID '{}'.", node_id,
+                                                      "https://memgr.ph/csv-import-tool"));
+        return;
+      } else {
+        throw LoadException("Node with ID '{}' already exists", node_id);
+      }
+    }
+    id = std::move(node_id);
+  }
+
+  auto *acc = transactions->Accessor();
   auto node = acc->CreateVertex();
-  for (size_t i = 0; i < row.size(); ++i) {
+  if (id) node_id_map->emplace(*id, node.Gid());
+  for (size_t i = 0; i < row.columns.size(); ++i) {
     const auto &field = fields[i];
-    const auto &value = row[i];
+    const auto &value = row.columns[i];
+    if (row.error_field == i) throw LoadException("{}", *row.error);
     if (memgraph::utils::StartsWith(field.type, "ID")) {
-      if (id) throw LoadException("Only one node ID must be specified");
-      if (FLAGS_id_type == "INTEGER") {
-        // Call `StringToInt` to verify that the ID is a valid integer.
-        StringToInt(value);
-      }
-      NodeId node_id{value, GetIdSpace(field.type)};
-      auto it = node_id_map->find(node_id);
-      if (it != node_id_map->end()) {
-        if (FLAGS_skip_duplicate_nodes) {
-          spdlog::warn(memgraph::utils::MessageWithLink("Skipping duplicate node with ID '{}'.", node_id,
-                                                        "https://memgr.ph/csv-import-tool"));
-          return;
-        } else {
-          throw LoadException("Node with ID '{}' already exists", node_id);
-        }
-      }
-      node_id_map->emplace(node_id, node.Gid());
       if (!field.name.empty()) {
         memgraph::storage::PropertyValue pv_id;
         if (FLAGS_id_type == "INTEGER") {
-          pv_id = memgraph::storage::PropertyValue(StringToInt(node_id.id));
+          pv_id = memgraph::storage::PropertyValue(StringToInt(id->id));
         } else {
-          pv_id = memgraph::storage::PropertyValue(node_id.id);
+          pv_id = memgraph::storage::PropertyValue(id->id);
         }
-        auto old_node_property = node.SetProperty(acc->NameToProperty(field.name), pv_id);
+        auto old_node_property = node.SetProperty(properties[i], pv_id);
         if (!old_node_property.HasValue()) throw LoadException("Couldn't add property '{}' to the node", field.name);
         if (!old_node_property->IsNull()) throw LoadException("The property '{}' already exists", field.name);
       }
-      id = node_id;
     } else if (field.type == "LABEL") {
       for (const auto &label : memgraph::utils::Split(value, FLAGS_array_delimiter)) {
-        auto node_label = node.AddLabel(acc->NameToLabel(label));
+        auto node_label = node.AddLabel(name_ids->Label(acc, label));
         if (!node_label.HasValue()) throw LoadException("Couldn't add label '{}' to the node", label);
         if (!*node_label) throw LoadException("The label '{}' already exists", label);
       }
     } else if (field.type != "IGNORE") {
-      auto old_node_property = node.SetProperty(acc->NameToProperty(field.name), StringToValue(value, field.type));
+      auto old_node_property = node.SetProperty(properties[i], std::move(row.values[i]));
       if (!old_node_property.HasValue()) throw LoadException("Couldn't add property '{}' to the node", field.name);
       if (!old_node_property->IsNull()) throw LoadException("The property '{}' already exists", field.name);
     }
   }
   for (const auto &label : additional_labels) {
-    auto node_label = node.AddLabel(acc->NameToLabel(label));
-    if (!node_label.HasValue()) throw LoadException("Couldn't add label '{}' to the node", label);
-    if (!*node_label) throw LoadException("The label '{}' already exists", label);
+    auto node_label = node.AddLabel(label);
+    if (!node_label.HasValue()) {
+      throw LoadException("Couldn't add label '{}' to the node", acc->LabelToName(label));
+    }
+    if (!*node_label) throw LoadException("The label '{}' already exists", acc->LabelToName(label));
   }
-  if (acc->Commit().HasError()) throw LoadException("Couldn't store the node");
+  transactions->RowStored();
 }
 
-void ProcessNodes(memgraph::storage::Storage *store, const std::string &nodes_path,
-                  std::optional<std::vector<Field>> *header,
+bool IsNodeProperty(const Field &field) {
+  return !memgraph::utils::StartsWith(field.type, "ID") && field.type != "LABEL" && field.type != "IGNORE";
+}
+
+bool IsNodeIdProperty(const Field &field) {
+  return memgraph::utils::StartsWith(field.type, "ID") && !field.name.empty();
+}
+
+bool IsRelationshipProperty(const Field &field) {
+  return !memgraph::utils::StartsWith(field.type, "START_ID") && !memgraph::utils::StartsWith(field.type, "END_ID") &&
+         field.type != "TYPE" && field.type != "IGNORE";
+}
+
+/// Returns the ids of the properties the fields are stored as, so they're
+/// looked up once for all rows. The ids of the other fields aren't set.
+std::vector<memgraph::storage::PropertyId> FieldProperties(memgraph::storage::Storage *store,
+                                                           const std::vector<Field> &fields,
+                                                           bool (*is_stored_as_property)(const Field &)) {
+  auto acc = store->Access();
+  std::vector<memgraph::storage::PropertyId> properties(fields.size());
+  for (size_t i = 0; i < fields.size(); ++i) {
+    if (is_stored_as_property(fields[i])) properties[i] = acc->NameToProperty(fields[i].name);
+  }
+  return properties;
+}
+
+void ProcessNodes(memgraph::storage::Storage *store, const std::vector<std::string> &files,
                   std::unordered_map<NodeId, memgraph::storage::Gid> *node_id_map,
-                  const std::vector<std::string> &additional_labels) {
-  std::ifstream nodes_file(nodes_path);
-  MG_ASSERT(nodes_file, "Unable to open '{}'", nodes_path);
-  uint64_t row_number = 1;
+                  const std::vector<std::string> &additional_labels, NameIds *name_ids) {
+  BatchedTransactions transactions(store, "nodes");
+  std::vector<memgraph::storage::LabelId> additional_label_ids;
+  additional_label_ids.reserve(additional_labels.size());
+  for (const auto &label : additional_labels) {
+    additional_label_ids.push_back(name_ids->Label(transactions.Accessor(), label));
+  }
+  std::vector<memgraph::storage::PropertyId> properties;
+  ProcessFiles(
+      files, IsNodeProperty,
+      [&](const auto &fields) {
+        properties = FieldProperties(store, fields, [](const Field &field) {
+          return IsNodeProperty(field) || IsNodeIdProperty(field);
+        });
+      },
+      [&](auto &row, const auto &fields) {
+        ProcessNodeRow(&transactions, row, fields, properties, additional_label_ids, name_ids, node_id_map);
+      });
   try {
-    if (!*header) {
-      auto [fields, header_lines] = ReadHeader(nodes_file);
-      row_number += header_lines;
-      header->emplace(std::move(fields));
-    }
-    while (true) {
-      auto [row, lines_count] = ReadRow(nodes_file);
-      if (lines_count == 0) break;
-      if ((!FLAGS_ignore_extra_columns && row.size() != (*header)->size()) ||
-          (FLAGS_ignore_extra_columns && row.size() < (*header)->size()))
-        throw LoadException(
-            "Expected as many values as there are header fields (found {}, "
-            "expected {})",
-            row.size(), (*header)->size());
-      if (row.size() > (*header)->size()) {
-        row.resize((*header)->size());
-      }
-      ProcessNodeRow(store, row, **header, additional_labels, node_id_map);
-      row_number += lines_count;
-    }
+    transactions.Commit();
   } catch (const LoadException &e) {
-    LOG_FATAL("Couldn't process row {} of '{}' because of: {}", row_number, nodes_path, e.what());
+    LOG_FATAL("Couldn't process the nodes of '{}' because of: {}", files.back(), e.what());
   }
 }
 
 /// @throw LoadException
-void ProcessRelationshipsRow(memgraph::storage::Storage *store, const std::vector<Field> &fields,
-                             const std::vector<std::string> &row, std::optional<std::string> relationship_type,
+void ProcessRelationshipsRow(BatchedTransactions *transactions, const std::vector<Field> &fields,
+                             const std::vector<memgraph::storage::PropertyId> &properties, ParsedRow &row,
+                             std::optional<std::string> relationship_type, NameIds *name_ids,
                              const std::unordered_map<NodeId, memgraph::storage::Gid> &node_id_map) {
   std::optional<memgraph::storage::Gid> start_id;
   std::optional<memgraph::storage::Gid> end_id;
-  auto properties = memgraph::storage::PropertyValue::map_t{};
-  for (size_t i = 0; i < row.size(); ++i) {
+  for (size_t i = 0; i < row.columns.size(); ++i) {
     const auto &field = fields[i];
-    const auto &value = row[i];
+    const auto &value = row.columns[i];
+    if (row.error_field == i) throw LoadException("{}", *row.error);
     if (memgraph::utils::StartsWith(field.type, "START_ID")) {
       if (start_id) throw LoadException("Only one node ID must be specified");
       if (FLAGS_id_type == "INTEGER") {
@@ -569,71 +856,57 @@ void ProcessRelationshipsRow(memgraph::storage::Storage *store, const std::vecto
     } else if (field.type == "TYPE") {
       if (relationship_type) throw LoadException("Only one relationship TYPE must be specified");
       relationship_type = value;
-    } else if (field.type != "IGNORE") {
-      auto [it, inserted] = properties.emplace(field.name, StringToValue(value, field.type));
-      if (!inserted) throw LoadException("The property '{}' already exists", field.name);
     }
   }
   if (!start_id) throw LoadException("START_ID must be set");
   if (!end_id) throw LoadException("END_ID must be set");
   if (!relationship_type) throw LoadException("Relationship TYPE must be set");
 
-  auto acc = store->Access();
+  auto *acc = transactions->Accessor();
   auto from_node = acc->FindVertex(*start_id, memgraph::storage::View::NEW);
   if (!from_node) throw LoadException("From node must be in the storage");
   auto to_node = acc->FindVertex(*end_id, memgraph::storage::View::NEW);
   if (!to_node) throw LoadException("To node must be in the storage");
 
-  auto relationship = acc->CreateEdge(&from_node.value(), &to_node.value(), acc->NameToEdgeType(*relationship_type));
+  auto relationship =
+      acc->CreateEdge(&from_node.value(), &to_node.value(), name_ids->EdgeType(acc, *relationship_type));
   if (!relationship.HasValue()) throw LoadException("Couldn't create the relationship");
 
-  for (const auto &property : properties) {
-    auto ret = relationship.GetValue().SetProperty(acc->NameToProperty(property.first), property.second);
+  for (size_t i = 0; i < row.columns.size(); ++i) {
+    const auto &field = fields[i];
+    if (!IsRelationshipProperty(field)) continue;
+    auto ret = relationship.GetValue().SetProperty(properties[i], std::move(row.values[i]));
     if (!ret.HasValue()) {
       if (ret.GetError() != memgraph::storage::Error::PROPERTIES_DISABLED) {
-        throw LoadException("Couldn't add property '{}' to the relationship", property.first);
+        throw LoadException("Couldn't add property '{}' to the relationship", field.name);
       } else {
         throw LoadException(
             "Couldn't add property '{}' to the relationship because properties "
             "on edges are disabled",
-            property.first);
+            field.name);
       }
     }
+    if (!ret->IsNull()) throw LoadException("The property '{}' already exists", field.name);
   }
 
-  if (acc->Commit().HasError()) throw LoadException("Couldn't store the relationship");
+  transactions->RowStored();
 }
 
-void ProcessRelationships(memgraph::storage::Storage *store, const std::string &relationships_path,
-                          const std::optional<std::string> &relationship_type,
-                          std::optional<std::vector<Field>> *header,
+void ProcessRelationships(memgraph::storage::Storage *store, const std::vector<std::string> &files,
+                          const std::optional<std::string> &relationship_type, NameIds *name_ids,
                           const std::unordered_map<NodeId, memgraph::storage::Gid> &node_id_map) {
-  std::ifstream relationships_file(relationships_path);
-  MG_ASSERT(relationships_file, "Unable to open '{}'", relationships_path);
-  uint64_t row_number = 1;
+  BatchedTransactions transactions(store, "relationships");
+  std::vector<memgraph::storage::PropertyId> properties;
+  ProcessFiles(
+      files, IsRelationshipProperty,
+      [&](const auto &fields) { properties = FieldProperties(store, fields, IsRelationshipProperty); },
+      [&](auto &row, const auto &fields) {
+        ProcessRelationshipsRow(&transactions, fields, properties, row, relationship_type, name_ids, node_id_map);
+      });
   try {
-    if (!*header) {
-      auto [fields, header_lines] = ReadHeader(relationships_file);
-      row_number += header_lines;
-      header->emplace(std::move(fields));
-    }
-    while (true) {
-      auto [row, lines_count] = ReadRow(relationships_file);
-      if (lines_count == 0) break;
-      if ((!FLAGS_ignore_extra_columns && row.size() != (*header)->size()) ||
-          (FLAGS_ignore_extra_columns && row.size() < (*header)->size()))
-        throw LoadException(
-            "Expected as many values as there are header fields (found {}, "
-            "expected {})",
-            row.size(), (*header)->size());
-      if (row.size() > (*header)->size()) {
-        row.resize((*header)->size());
-      }
-      ProcessRelationshipsRow(store, **header, row, relationship_type, node_id_map);
-      row_number += lines_count;
-    }
+    transactions.Commit();
   } catch (const LoadException &e) {
-    LOG_FATAL("Couldn't process row {} of '{}' because of: {}", row_number, relationships_path, e.what());
+    LOG_FATAL("Couldn't process the relationships of '{}' because of: {}", files.back(), e.what());
   }
 }
 
@@ -715,31 +988,27 @@ int main(int argc, char *argv[]) {
       .durability = {.storage_directory = FLAGS_data_directory,
                      .recover_on_startup = false,
                      .snapshot_wal_mode = memgraph::storage::Config::Durability::SnapshotWalMode::DISABLED,
-                     .snapshot_on_exit = true},
+                     .snapshot_on_exit = true,
+                     .items_per_batch = FLAGS_storage_items_per_batch,
+                     .recovery_thread_count = FLAGS_storage_recovery_thread_count,
+                     .allow_parallel_snapshot_creation = FLAGS_storage_parallel_snapshot_creation},
       .salient = {.items = {.properties_on_edges = FLAGS_storage_properties_on_edges}}};
   memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
   auto store = memgraph::dbms::CreateInMemoryStorage(config, repl_state);
 
   memgraph::utils::Timer load_timer;
+  NameIds name_ids;
 
   // Process all nodes files.
   for (const auto &value : nodes) {
     auto [files, additional_labels] = ParseNodesArgument(value);
-    std::optional<std::vector<Field>> header;
-    for (const auto &nodes_file : files) {
-      spdlog::info("Loading {}", nodes_file);
-      ProcessNodes(store.get(), nodes_file, &header, &node_id_map, additional_labels);
-    }
+    ProcessNodes(store.get(), files, &node_id_map, additional_labels, &name_ids);
   }
 
   // Process all relationships files.
   for (const auto &value : relationships) {
     auto [files, type] = ParseRelationshipsArgument(value);
-    std::optional<std::vector<Field>> header;
-    for (const auto &relationships_file : files) {
-      spdlog::info("Loading {}", relationships_file);
-      ProcessRelationships(store.get(), relationships_file, type, &header, node_id_map);
-    }
+    ProcessRelationships(store.get(), files, type, &name_ids, node_id_map);
   }
 
   double load_sec = load_timer.Elapsed().count();
@@ -17,6 +17,38 @@ namespace memgraph::query {
 struct InterpreterConfig {
   struct Query {
     bool allow_load_csv{true};
+    // Rows the operators of read-only queries exchange at a time, zero pulls
+    // them one by one.
+    uint64_t execution_batch_size{0};
+    // Rows an operator keeps in memory before it spills them to a file under
+    // `spill_directory`, zero never spills.
+    uint64_t spill_rows{0};
+    std::string spill_directory;
+    // Threads which parse the file of LOAD CSV, less than 2 parse it on the
+    // query thread.
+    uint64_t load_csv_parallel_workers{0};
+    // Threads which write the rows of UNWIND in IN_MEMORY_ANALYTICAL mode,
+    // less than 2 write them on the query thread.
+    uint64_t analytical_write_workers{0};
+    // Deltas and time a batch of USING PERIODIC COMMIT may take before it's
+    // committed, zero for no budget. With a budget the batches are sized by
+    // it rather than by the query.
+    uint64_t periodic_commit_delta_budget{0};
+    std::chrono::milliseconds periodic_commit_time_budget{0};
+    // Lanes which limit the concurrent queries, see
+    // `QueryAdmission::ParseLanes`. Queries aren't limited if empty.
+    std::string admission_lanes;
+    // Prepared statements a session holds, zero disables them.
+    uint64_t max_prepared_statements{0};
+    // 1 in this many executions of each plan are profiled, zero disables the
+    // sampling.
+    uint64_t profile_sample_rate{0};
+    // Query fingerprints whose execution statistics are kept for the metrics
+    // endpoint, zero disables them.
+    uint64_t fingerprint_metrics_size{0};
+    // ANALYZE GRAPH examines 1 in this many vertices of each index, less than
+    // 2 examine all of them.
+    uint64_t analyze_graph_sample_rate{0};
   } query;
 
   // The same as \ref memgraph::replication::ReplicationClientConfig
@@ -30,5 +62,15 @@ struct InterpreterConfig {
   std::string default_pulsar_service_url;
   uint32_t stream_transaction_conflict_retries;
   std::chrono::milliseconds stream_transaction_retry_interval;
+  bool stream_batched_queries{true};
+
+  // Committed transactions whose AFTER COMMIT triggers run once for their
+  // combined changes.
+  uint64_t trigger_batch_size{1};
+  // Threads which run the AFTER COMMIT triggers of a batch concurrently.
+  uint64_t trigger_parallel_workers{1};
+
+  // Threads which generate the vertex and edge statements of a dump.
+  uint64_t dump_parallel_workers{1};
 };
 }  // namespace memgraph::query
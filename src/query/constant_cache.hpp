@@ -0,0 +1,45 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <unordered_map>
+
+#include "query/typed_value.hpp"
+#include "utils/memory.hpp"
+
+namespace memgraph::query {
+
+class Expression;
+
+/// Results of the expressions which the planner found constant, cached for
+/// the whole execution so each of them is evaluated once instead of for
+/// every row. Not thread-safe, each execution context has its own.
+class ConstantCache {
+ public:
+  /// Returns the cached result of @p expression, nullptr if it isn't
+  /// evaluated yet.
+  const TypedValue *Find(const Expression *expression) const {
+    auto it = values_.find(expression);
+    return it != values_.end() ? &it->second : nullptr;
+  }
+
+  /// Caches @p value as the result of @p expression. The value is copied out
+  /// of the memory of the pull, which is released between the pulls.
+  void Insert(const Expression *expression, const TypedValue &value) {
+    values_.emplace(expression, TypedValue(value, utils::NewDeleteResource()));
+  }
+
+ private:
+  std::unordered_map<const Expression *, TypedValue> values_;
+};
+
+}  // namespace memgraph::query
@@ -16,4 +16,5 @@
 namespace memgraph::query {
 inline const std::string kAsterisk = "*";
 inline constexpr uint16_t kComputeStatisticsNumResults = 7;
+inline constexpr uint16_t kIndexStatsHistogramBuckets = 32;
 }  // namespace memgraph::query
@@ -11,22 +11,29 @@
 
 #pragma once
 
+#include <chrono>
+#include <filesystem>
 #include <memory>
 #include <type_traits>
 
 #include "query/common.hpp"
+#include "query/constant_cache.hpp"
 #include "query/frontend/semantic/symbol_table.hpp"
 #include "query/metadata.hpp"
 #include "query/parameters.hpp"
 #include "query/plan/profile.hpp"
+#include "query/regex_cache.hpp"
 #include "query/trigger.hpp"
 #include "utils/async_timer.hpp"
+#include "utils/perf_counters.hpp"
 
 #include "query/frame_change.hpp"
 #include "query/hops_limit.hpp"
 
 namespace memgraph::query {
 
+class CompiledExpressions;
+
 enum class TransactionStatus {
   IDLE,
   ACTIVE,
@@ -45,7 +52,10 @@ struct EvaluationContext {
   ///
   /// Although the assigned memory may live longer than the duration of a Pull
   /// (e.g. memory is the same as the whole execution memory), you have to treat
-  /// it as if the lifetime is only valid during the Pull.
+  /// it as if the lifetime is only valid during the Pull. The interpreter
+  /// releases it between the pulls of the plan root, so the values a cursor
+  /// keeps for its next Pull must be copied into the memory the cursor was
+  /// made with.
   utils::MemoryResource *memory{utils::NewDeleteResource()};
   int64_t timestamp{-1};
   Parameters parameters{};
@@ -56,6 +66,12 @@ struct EvaluationContext {
   /// All counters generated by `counter` function, mutable because the function
   /// modifies the values
   mutable std::unordered_map<std::string, int64_t> counters{};
+  /// Patterns compiled by the `=~` operator, mutable because the evaluation
+  /// fills it
+  mutable RegexCache regexes{};
+  /// Results of the constant function calls, mutable because the evaluation
+  /// fills it
+  mutable ConstantCache constants{};
   Scope scope{};
 };
 
@@ -73,7 +89,13 @@ struct ExecutionContext {
   std::chrono::duration<double> profile_execution_time;
   plan::ProfilingStats stats;
   plan::ProfilingStats *stats_root{nullptr};
+  /// Counters of the query thread whose events each profiled operator adds to
+  /// its stats, if the query is profiled with the perf counters.
+  const utils::PerfCounters *perf_counters{nullptr};
   ExecutionStats execution_stats;
+  /// Vertices the scan operators produced, collected into the resource usage
+  /// of the transaction after each pull.
+  uint64_t scanned_vertices{0};
   TriggerContextCollector *trigger_context_collector{nullptr};
   FrameChangeCollector *frame_change_collector{nullptr};
   std::shared_ptr<utils::AsyncTimer> timer;
@@ -81,6 +103,37 @@ struct ExecutionContext {
   int64_t number_of_hops{0};
   HopsLimit hops_limit;
   std::optional<uint64_t> periodic_commit_frequency;
+  /// Deltas and time a batch of a periodic commit may take before it's
+  /// committed, the batches are sized by the budgets if either isn't zero.
+  uint64_t periodic_commit_delta_budget{0};
+  std::chrono::milliseconds periodic_commit_time_budget{0};
+  /// Rows the cursors which support batched pulls exchange at a time, zero
+  /// if the rows are pulled one by one.
+  size_t batch_size{0};
+  /// Rows OrderBy keeps in memory before it writes them as a sorted run to a
+  /// file under `spill_directory`, zero if the rows are never spilled.
+  uint64_t spill_rows{0};
+  std::filesystem::path spill_directory;
+  /// Threads which parse the file of LOAD CSV in concurrent chunks, the file
+  /// is parsed by the LoadCsv cursor if there are less than 2.
+  size_t load_csv_parallel_workers{0};
+  /// Threads which write the rows of an UNWIND in their own transactions if
+  /// the storage is IN_MEMORY_ANALYTICAL, the rows are written by the query
+  /// thread if there are less than 2.
+  size_t analytical_write_workers{0};
+  /// Records a read procedure yields at a time before it waits for them to be
+  /// pulled, zero if procedures run to completion before their records are
+  /// pulled. Only set for read-only queries.
+  size_t procedure_stream_rows{0};
+  /// Filter and projection expressions of the plan which the cursors evaluate
+  /// without the `ExpressionEvaluator`, if any were compiled.
+  const CompiledExpressions *compiled_expressions{nullptr};
+  /// Vertices a parallel worker scans instead of the whole graph. Consumed by
+  /// the next ScanAll/ScanAllByLabel cursor which starts pulling.
+  VerticesIterable *scan_morsel{nullptr};
+  /// Values a write worker unwinds instead of the list of the query. Consumed
+  /// by the next Unwind cursor which pulls its input.
+  TypedValue::TVector *unwind_morsel{nullptr};
 #ifdef MG_ENTERPRISE
   std::unique_ptr<FineGrainedAuthChecker> auth_checker{nullptr};
 #endif
@@ -105,7 +158,9 @@ inline auto MustAbort(const ExecutionContext &context) noexcept -> AbortReason {
 }
 
 inline plan::ProfilingStatsWithTotalTime GetStatsWithTotalTime(const ExecutionContext &context) {
-  return plan::ProfilingStatsWithTotalTime{context.stats, context.profile_execution_time};
+  std::optional<std::bitset<utils::kPerfEventCount>> counted_perf_events;
+  if (context.perf_counters) counted_perf_events = context.perf_counters->Counted();
+  return plan::ProfilingStatsWithTotalTime{context.stats, context.profile_execution_time, counted_perf_events};
 }
 
 }  // namespace memgraph::query
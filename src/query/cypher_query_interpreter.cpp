@@ -10,23 +10,143 @@
 // licenses/APL.txt.
 
 #include "query/cypher_query_interpreter.hpp"
+
+#include <algorithm>
+#include <bit>
+
 #include "frontend/semantic/required_privileges.hpp"
 #include "frontend/semantic/symbol_generator.hpp"
+#include "query/context.hpp"
 #include "query/frontend/ast/cypher_main_visitor.hpp"
 #include "query/frontend/opencypher/parser.hpp"
 #include "query/plan/planner.hpp"
 #include "query/plan/rule_based_planner.hpp"
 #include "query/plan/vertex_count_cache.hpp"
+#include "utils/event_counter.hpp"
 #include "utils/flag_validation.hpp"
+#include "utils/fnv.hpp"
+#include "utils/tracing.hpp"
 
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_bool(query_cost_planner, true, "Use the cost-estimating query planner.");
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_int32(query_ast_cache_max_size, 1000, "Maximum number of parsed queries to cache.",
+                       FLAG_IN_RANGE(0, std::numeric_limits<int32_t>::max()));
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_int32(query_plan_cache_max_size, 1000, "Maximum number of query plans to cache.",
                        FLAG_IN_RANGE(0, std::numeric_limits<int32_t>::max()));
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(query_plan_cache_parameter_sensitive, false,
+            "Cache separate plans of a query for parameters of different types and for list parameters of different "
+            "magnitudes of sizes.");
+
+namespace memgraph::metrics {
+extern const Event QueryAstCacheHits;
+extern const Event QueryAstCacheMisses;
+extern const Event QueryPlanCacheHits;
+extern const Event QueryPlanCacheMisses;
+extern const Event QueryPlanCacheStalePlans;
+}  // namespace memgraph::metrics
 
 namespace memgraph::query {
-PlanWrapper::PlanWrapper(std::unique_ptr<LogicalPlan> plan) : plan_(std::move(plan)) {}
+namespace {
+
+class ExpressionCompiler final : public plan::HierarchicalLogicalOperatorVisitor {
+ public:
+  ExpressionCompiler(const SymbolTable &symbol_table, CompiledExpressions *compiled_expressions)
+      : symbol_table_(&symbol_table), compiled_expressions_(compiled_expressions) {}
+
+  using HierarchicalLogicalOperatorVisitor::PostVisit;
+  using HierarchicalLogicalOperatorVisitor::PreVisit;
+  using HierarchicalLogicalOperatorVisitor::Visit;
+
+  bool Visit(plan::Once & /*unused*/) override { return true; }
+
+  bool PreVisit(plan::Filter &op) override {
+    compiled_expressions_->Add(op.expression_, *symbol_table_);
+    return true;
+  }
+
+  bool PreVisit(plan::Produce &op) override {
+    for (auto *named_expression : op.named_expressions_) {
+      compiled_expressions_->Add(named_expression->expression_, *symbol_table_);
+    }
+    return true;
+  }
+
+  bool PreVisit(plan::ComputeExpressions &op) override {
+    for (auto *expression : op.expressions_) {
+      compiled_expressions_->Add(expression, *symbol_table_);
+    }
+    return true;
+  }
+
+ private:
+  const SymbolTable *symbol_table_;
+  CompiledExpressions *compiled_expressions_;
+};
+
+// A cached plan is made again once the number of vertices grows or shrinks by
+// more than this factor since the plan was made. The slack keeps the plans of
+// small graphs from being made again every few created vertices.
+constexpr int64_t kStalePlanVertexCountFactor = 2;
+constexpr int64_t kStalePlanVertexCountSlack = 1000;
+
+// Parameters of different types lead to different plans, e.g. a Null can't
+// be looked up in an index, and the rows `IN $list` matches grow with the
+// size of the list.
+uint64_t ParameterShape(const storage::PropertyValue &value) {
+  auto shape = static_cast<uint64_t>(value.type());
+  if (value.IsList()) shape |= static_cast<uint64_t>(std::bit_width(value.ValueList().size())) << 8U;
+  return shape;
+}
+
+// Clones `query` of `from` into `to` together with the names its indices refer to.
+Query *CopyQuery(const AstStorage &from, Query *query, AstStorage *to) {
+  to->properties_ = from.properties_;
+  to->labels_ = from.labels_;
+  to->edge_types_ = from.edge_types_;
+  return query->Clone(to);
+}
+
+}  // namespace
+
+PlanWrapper::PlanWrapper(std::unique_ptr<LogicalPlan> plan, int64_t vertex_count)
+    : plan_(std::move(plan)), vertex_count_(vertex_count) {
+  ExpressionCompiler compiler(plan_->GetSymbolTable(), &compiled_expressions_);
+  const_cast<plan::LogicalOperator &>(plan_->GetRoot()).Accept(compiler);
+}
+
+bool PlanWrapper::IsStale(int64_t current_vertex_count) const {
+  const auto [smaller, larger] = std::minmax(vertex_count_, current_vertex_count);
+  return larger + kStalePlanVertexCountSlack > kStalePlanVertexCountFactor * (smaller + kStalePlanVertexCountSlack);
+}
+
+void PlanWrapper::ResolveNames(DbAccessor *dba) const {
+  std::call_once(names_resolved_, [&] {
+    properties_ = NamesToProperties(ast_storage().properties_, dba);
+    labels_ = NamesToLabels(ast_storage().labels_, dba);
+  });
+}
+
+const std::vector<storage::PropertyId> &PlanWrapper::properties(DbAccessor *dba) const {
+  ResolveNames(dba);
+  return properties_;
+}
+
+const std::vector<storage::LabelId> &PlanWrapper::labels(DbAccessor *dba) const {
+  ResolveNames(dba);
+  return labels_;
+}
+
+uint64_t PlanCacheKey(uint64_t hash, const Parameters &parameters) {
+  if (!FLAGS_query_plan_cache_parameter_sensitive) return hash;
+  utils::HashCombine<uint64_t, uint64_t> combine;
+  for (const auto &parameter : parameters) {
+    hash = combine(hash, ParameterShape(parameter.second));
+  }
+  return hash;
+}
 
 auto PrepareQueryParameters(frontend::StrippedQuery const &stripped_query, UserParameters const &user_parameters)
     -> Parameters {
@@ -46,7 +166,8 @@ auto PrepareQueryParameters(frontend::StrippedQuery const &stripped_query, UserP
 }
 
 ParsedQuery ParseQuery(const std::string &query_string, UserParameters const &user_parameters,
-                       utils::SkipList<QueryCacheEntry> *cache, const InterpreterConfig::Query &query_config) {
+                       AstCache *cache, const InterpreterConfig::Query &query_config) {
+  utils::tracing::ScopedSpan const span("query.parse");
   // Strip the query for caching purposes. The process of stripping a query
   // "normalizes" it by replacing any literals with new parameters. This
   // results in just the *structure* of the query being taken into account for
@@ -60,8 +181,7 @@ ParsedQuery ParseQuery(const std::string &query_string, UserParameters const &us
 
   // Cache the query's AST if it isn't already.
   auto hash = stripped_query.hash();
-  auto accessor = cache->access();
-  auto it = accessor.find(hash);
+  auto cached = cache->get(hash);
   std::unique_ptr<frontend::opencypher::Parser> parser;
 
   // Return a copy of both the AST storage and the query.
@@ -77,7 +197,8 @@ ParsedQuery ParseQuery(const std::string &query_string, UserParameters const &us
     result.required_privileges = cached_query.required_privileges;
   };
 
-  if (it == accessor.end()) {
+  if (!cached) {
+    memgraph::metrics::IncrementCounter(memgraph::metrics::QueryAstCacheMisses);
     try {
       parser = std::make_unique<frontend::opencypher::Parser>(stripped_query.query());
     } catch (const SyntaxException &e) {
@@ -102,10 +223,12 @@ ParsedQuery ParseQuery(const std::string &query_string, UserParameters const &us
     }
 
     if (visitor.GetQueryInfo().is_cacheable) {
-      CachedQuery cached_query{std::move(ast_storage), visitor.query(), query::GetRequiredPrivileges(visitor.query())};
-      it = accessor.insert({hash, std::move(cached_query)}).first;
+      auto *query = visitor.query();
+      auto cached_query = std::make_shared<const CachedQuery>(
+          CachedQuery{std::move(ast_storage), query, query::GetRequiredPrivileges(query)});
+      cache->put(hash, cached_query);
 
-      get_information_from_cache(it->second);
+      get_information_from_cache(*cached_query);
     } else {
       // Carefully use the query we just built, preserving the ast_storage we used to build it
       result.required_privileges = query::GetRequiredPrivileges(visitor.query());
@@ -115,7 +238,8 @@ ParsedQuery ParseQuery(const std::string &query_string, UserParameters const &us
       is_cacheable = false;
     }
   } else {
-    get_information_from_cache(it->second);
+    memgraph::metrics::IncrementCounter(memgraph::metrics::QueryAstCacheHits);
+    get_information_from_cache(**cached);
   }
 
   return ParsedQuery{
@@ -130,9 +254,44 @@ ParsedQuery ParseQuery(const std::string &query_string, UserParameters const &us
   };
 }
 
+const frontend::StrippedQuery &ParsedQuery::Stripped() const {
+  return prepared_statement ? prepared_statement->stripped_query : stripped_query;
+}
+
+PreparedStatement::PreparedStatement(const std::string &query_string, const ParsedQuery &parsed_query)
+    : stripped_query(query_string),
+      query(CopyQuery(parsed_query.ast_storage, parsed_query.query, &ast_storage)),
+      required_privileges(parsed_query.required_privileges) {}
+
+Query *PreparedStatement::CloneQuery(AstStorage *storage) const {
+  return CopyQuery(ast_storage, query, storage);
+}
+
+bool PreparedStatement::HasPlanFor(const utils::UUID &storage_uuid, uint64_t plan_key, uint64_t plan_cache_generation,
+                                   int64_t vertex_count) const {
+  return plan && plan_storage_uuid == storage_uuid && this->plan_key == plan_key &&
+         this->plan_cache_generation == plan_cache_generation && !plan->IsStale(vertex_count);
+}
+
+ParsedQuery ParsePreparedStatement(PreparedStatement *statement, const std::string &query_string,
+                                   UserParameters const &user_parameters) {
+  return ParsedQuery{
+      query_string,
+      frontend::StrippedQuery{""},
+      AstStorage{},
+      statement->query,
+      statement->required_privileges,
+      true,
+      user_parameters,
+      PrepareQueryParameters(statement->stripped_query, user_parameters),
+      statement,
+  };
+}
+
 std::unique_ptr<LogicalPlan> MakeLogicalPlan(AstStorage ast_storage, CypherQuery *query, const Parameters &parameters,
                                              DbAccessor *db_accessor,
                                              const std::vector<Identifier *> &predefined_identifiers) {
+  utils::tracing::ScopedSpan const span("query.plan");
   auto vertex_counts = plan::VertexCountCache(db_accessor);
   auto symbol_table = MakeSymbolTable(query, predefined_identifiers);
   auto planning_context = plan::MakePlanningContext(&ast_storage, &symbol_table, query, &vertex_counts);
@@ -142,21 +301,30 @@ std::unique_ptr<LogicalPlan> MakeLogicalPlan(AstStorage ast_storage, CypherQuery
 }
 
 std::shared_ptr<PlanWrapper> CypherQueryToPlan(uint64_t hash, AstStorage ast_storage, CypherQuery *query,
-                                               const Parameters &parameters, PlanCacheLRU *plan_cache,
+                                               const Parameters &parameters, PlanCache *plan_cache,
                                                DbAccessor *db_accessor,
                                                const std::vector<Identifier *> &predefined_identifiers) {
+  utils::tracing::ScopedSpan const span("query.plan_cache");
+  const auto key = PlanCacheKey(hash, parameters);
+  const auto vertex_count = db_accessor->VerticesCount();
   if (plan_cache) {
-    auto existing_plan = plan_cache->WithLock([&](auto &cache) { return cache.get(hash); });
+    auto existing_plan = plan_cache->get(key);
     if (existing_plan.has_value()) {
-      return existing_plan.value();
+      if (!(*existing_plan)->IsStale(vertex_count)) {
+        (*existing_plan)->RecordCacheHit();
+        memgraph::metrics::IncrementCounter(memgraph::metrics::QueryPlanCacheHits);
+        return existing_plan.value();
+      }
+      memgraph::metrics::IncrementCounter(memgraph::metrics::QueryPlanCacheStalePlans);
     }
+    memgraph::metrics::IncrementCounter(memgraph::metrics::QueryPlanCacheMisses);
   }
 
   auto plan = std::make_shared<PlanWrapper>(
-      MakeLogicalPlan(std::move(ast_storage), query, parameters, db_accessor, predefined_identifiers));
+      MakeLogicalPlan(std::move(ast_storage), query, parameters, db_accessor, predefined_identifiers), vertex_count);
 
   if (plan_cache) {
-    plan_cache->WithLock([&](auto &cache) { cache.put(hash, plan); });
+    plan_cache->put(key, plan);
   }
 
   return plan;
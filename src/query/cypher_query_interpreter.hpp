@@ -11,21 +11,32 @@
 
 #pragma once
 
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <vector>
+
 #include "query/config.hpp"
 #include "query/frontend/ast/ast.hpp"
 #include "query/frontend/semantic/symbol_table.hpp"
 #include "query/frontend/stripped.hpp"
+#include "query/interpret/compiled_expression.hpp"
 #include "query/parameters.hpp"
+#include "storage/v2/id_types.hpp"
 #include "storage/v2/property_value.hpp"
-#include "utils/lru_cache.hpp"
-#include "utils/synchronized.hpp"
+#include "utils/clock_cache.hpp"
+#include "utils/uuid.hpp"
 
 #include "gflags/gflags.h"
 
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DECLARE_bool(query_cost_planner);
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_int32(query_ast_cache_max_size);
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DECLARE_int32(query_plan_cache_max_size);
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_bool(query_plan_cache_parameter_sensitive);
 
 namespace memgraph::query {
 
@@ -35,6 +46,7 @@ class LogicalOperator;
 
 class SymbolTable;
 class Query;
+class DbAccessor;
 
 // TODO: Maybe this should move to query/plan/planner.
 /// Interface for accessing the root operator of a logical plan.
@@ -62,15 +74,46 @@ auto PrepareQueryParameters(frontend::StrippedQuery const &stripped_query, UserP
 
 class PlanWrapper {
  public:
-  explicit PlanWrapper(std::unique_ptr<LogicalPlan> plan);
+  /// @param vertex_count approximate number of vertices in the graph the plan
+  /// was made for, used to tell when a cached plan has become stale.
+  explicit PlanWrapper(std::unique_ptr<LogicalPlan> plan, int64_t vertex_count = 0);
 
   const auto &plan() const { return plan_->GetRoot(); }
   double cost() const { return plan_->GetCost(); }
   const auto &symbol_table() const { return plan_->GetSymbolTable(); }
   const auto &ast_storage() const { return plan_->GetAstStorage(); }
+  const auto &compiled_expressions() const { return compiled_expressions_; }
+
+  int64_t vertex_count() const { return vertex_count_; }
+
+  /// Number of times the plan was served from the plan cache.
+  uint64_t cache_hits() const { return cache_hits_.load(std::memory_order_relaxed); }
+  void RecordCacheHit() { cache_hits_.fetch_add(1, std::memory_order_relaxed); }
+
+  /// Returns true if the graph grew or shrank too much since the plan was
+  /// made for its cost estimates to still hold.
+  bool IsStale(int64_t current_vertex_count) const;
+
+  /// Storage ids of the `PropertyIx` and `LabelIx` names of the AST storage,
+  /// resolved through @p dba by the first execution only. A plan is only
+  /// executed against the database it was made for (plan caches belong to
+  /// their database and prepared statements check the storage), and the name
+  /// to id mapping of a storage never changes.
+  const std::vector<storage::PropertyId> &properties(DbAccessor *dba) const;
+  const std::vector<storage::LabelId> &labels(DbAccessor *dba) const;
 
  private:
+  void ResolveNames(DbAccessor *dba) const;
+
   std::unique_ptr<LogicalPlan> plan_;
+  int64_t vertex_count_;
+  std::atomic<uint64_t> cache_hits_{0};
+  // Filter and projection expressions of the plan, compiled once for all its
+  // executions.
+  CompiledExpressions compiled_expressions_;
+  mutable std::once_flag names_resolved_;
+  mutable std::vector<storage::PropertyId> properties_;
+  mutable std::vector<storage::LabelId> labels_;
 };
 
 struct CachedQuery {
@@ -79,17 +122,12 @@ struct CachedQuery {
   std::vector<AuthQuery::Privilege> required_privileges;
 };
 
-struct QueryCacheEntry {
-  bool operator==(const QueryCacheEntry &other) const { return first == other.first; }
-  bool operator<(const QueryCacheEntry &other) const { return first < other.first; }
-  bool operator==(const uint64_t &other) const { return first == other; }
-  bool operator<(const uint64_t &other) const { return first < other; }
+/// Cache of the parsed queries, keyed by the hash of the stripped query.
+/// TODO: Maybe store the query string with the entry and compare it on a hit
+/// so that we eliminate the risk of hash collisions.
+using AstCache = utils::ClockCache<uint64_t, std::shared_ptr<const CachedQuery>>;
 
-  uint64_t first;
-  // TODO: Maybe store the query string here and use it as a key with the hash
-  // so that we eliminate the risk of hash collisions.
-  CachedQuery second;
-};
+struct PreparedStatement;
 
 /**
  * A container for data related to the parsing of a query.
@@ -103,10 +141,48 @@ struct ParsedQuery {
   bool is_cacheable{true};
   UserParameters user_parameters;
   Parameters parameters;
+  /// Prepared statement of the query. If set, the statement owns `query` and
+  /// holds the stripped query, `stripped_query` is empty.
+  PreparedStatement *prepared_statement{nullptr};
+
+  /// Stripped query the literals and the output names of the query are in.
+  const frontend::StrippedQuery &Stripped() const;
 };
 
 ParsedQuery ParseQuery(const std::string &query_string, UserParameters const &user_parameters,
-                       utils::SkipList<QueryCacheEntry> *cache, const InterpreterConfig::Query &query_config);
+                       AstCache *cache, const InterpreterConfig::Query &query_config);
+
+/// A Cypher query a session parsed once and keeps for running it again
+/// without stripping and parsing it or looking it up in the AST and the plan
+/// caches. The plan is shared with the plan cache of the database.
+struct PreparedStatement {
+  /// Copies the query of @p parsed_query, which must be a Cypher query
+  /// parsed from @p query_string.
+  PreparedStatement(const std::string &query_string, const ParsedQuery &parsed_query);
+
+  /// Clones the query into @p storage, which the plan made from it owns.
+  Query *CloneQuery(AstStorage *storage) const;
+
+  /// Returns true if the plan was made for the storage with @p storage_uuid,
+  /// under the same `PlanCacheKey` and its plan cache wasn't reset since, so
+  /// the indices and constraints the plan relies on still exist.
+  bool HasPlanFor(const utils::UUID &storage_uuid, uint64_t plan_key, uint64_t plan_cache_generation,
+                  int64_t vertex_count) const;
+
+  frontend::StrippedQuery stripped_query;
+  AstStorage ast_storage;
+  Query *query;
+  std::vector<AuthQuery::Privilege> required_privileges;
+  /// Unset until the statement is planned.
+  std::shared_ptr<PlanWrapper> plan;
+  std::optional<utils::UUID> plan_storage_uuid;
+  uint64_t plan_key{0};
+  uint64_t plan_cache_generation{0};
+};
+
+/// Returns the parsed query of @p statement with the parameters of this run.
+ParsedQuery ParsePreparedStatement(PreparedStatement *statement, const std::string &query_string,
+                                   UserParameters const &user_parameters);
 
 class SingleNodeLogicalPlan final : public LogicalPlan {
  public:
@@ -125,23 +201,33 @@ class SingleNodeLogicalPlan final : public LogicalPlan {
   SymbolTable symbol_table_;
 };
 
-using PlanCacheLRU =
-    utils::Synchronized<utils::LRUCache<uint64_t, std::shared_ptr<query::PlanWrapper>>, utils::RWSpinLock>;
+/// Cache of the logical plans of a database, keyed by `PlanCacheKey`.
+using PlanCache = utils::ClockCache<uint64_t, std::shared_ptr<PlanWrapper>>;
 
 std::unique_ptr<LogicalPlan> MakeLogicalPlan(AstStorage ast_storage, CypherQuery *query, const Parameters &parameters,
                                              DbAccessor *db_accessor,
                                              const std::vector<Identifier *> &predefined_identifiers);
 
+/**
+ * Return the key under which the plan of the query with the given stripped
+ * query hash and parameters is cached. With
+ * `--query-plan-cache-parameter-sensitive` the types of the parameters and the
+ * magnitudes of the sizes of list parameters are part of the key, so queries
+ * whose parameters would be planned differently get plans of their own.
+ */
+uint64_t PlanCacheKey(uint64_t hash, const Parameters &parameters);
+
 /**
  * Return the parsed *Cypher* query's AST cached logical plan, or create and
- * cache a fresh one if it doesn't yet exist.
+ * cache a fresh one if it doesn't yet exist. A cached plan is made again if
+ * the graph size changed too much since it was made.
  * @param predefined_identifiers optional identifiers you want to inject into a query.
  * If an identifier is not defined in a scope, we check the predefined identifiers.
  * If an identifier is contained there, we inject it at that place and remove it,
  * because a predefined identifier can be used only in one scope.
  */
 std::shared_ptr<PlanWrapper> CypherQueryToPlan(uint64_t hash, AstStorage ast_storage, CypherQuery *query,
-                                               const Parameters &parameters, PlanCacheLRU *plan_cache,
+                                               const Parameters &parameters, PlanCache *plan_cache,
                                                DbAccessor *db_accessor,
                                                const std::vector<Identifier *> &predefined_identifiers = {});
 
@@ -31,8 +31,10 @@
 #include "utils/result.hpp"
 #include "utils/variant_helpers.hpp"
 
+#include <functional>
 #include <optional>
 #include <ranges>
+#include <span>
 
 #include <cppitertools/filter.hpp>
 #include <cppitertools/imap.hpp>
@@ -73,6 +75,11 @@ class SubgraphVertexAccessor final {
     return impl_.GetProperty(view, key);
   }
 
+  storage::Result<std::vector<storage::PropertyValue>> GetProperties(
+      storage::View view, std::span<storage::PropertyId const> keys) const {
+    return impl_.GetProperties(keys, view);
+  }
+
   storage::Result<uint64_t> GetPropertySize(storage::PropertyId key, storage::View view) const {
     return impl_.GetPropertySize(key, view);
   }
@@ -83,6 +90,14 @@ class SubgraphVertexAccessor final {
 
   storage::Result<size_t> OutDegree(storage::View view) const { return impl_.OutDegree(view); }
 
+  storage::Result<size_t> InDegree(storage::View view, storage::EdgeTypeId edge_type) const {
+    return impl_.InDegree(view, edge_type);
+  }
+
+  storage::Result<size_t> OutDegree(storage::View view, storage::EdgeTypeId edge_type) const {
+    return impl_.OutDegree(view, edge_type);
+  }
+
   storage::Result<storage::PropertyValue> SetProperty(storage::PropertyId key, const storage::PropertyValue &value) {
     return impl_.SetProperty(key, value);
   }
@@ -120,6 +135,14 @@ class VerticesIterable final {
       return std::visit([](auto &it_) { return VertexAccessor(*it_); }, it_);
     }
 
+    /// @see storage::VerticesIterable::Iterator::IndexedValues
+    const std::vector<storage::PropertyValue> *IndexedValues() const {
+      if (const auto *storage_it = std::get_if<storage::VerticesIterable::Iterator>(&it_)) {
+        return storage_it->IndexedValues();
+      }
+      return nullptr;
+    }
+
     Iterator &operator++() {
       std::visit([](auto &it_) { ++it_; }, it_);
       return *this;
@@ -214,6 +237,15 @@ class EdgesIterable final {
 class DbAccessor final {
   storage::Storage::Accessor *accessor_;
 
+  static std::vector<VerticesIterable> ToQueryIterables(std::vector<storage::VerticesIterable> chunks) {
+    std::vector<VerticesIterable> iterables;
+    iterables.reserve(chunks.size());
+    for (auto &chunk : chunks) {
+      iterables.emplace_back(std::move(chunk));
+    }
+    return iterables;
+  }
+
  public:
   explicit DbAccessor(storage::Storage::Accessor *accessor) : accessor_(accessor) {}
 
@@ -241,12 +273,42 @@ class DbAccessor final {
 
   std::optional<uint64_t> GetTransactionId() { return accessor_->GetTransactionId(); }
 
+  void SetParallelReadersActive(bool active) { accessor_->GetTransaction()->parallel_readers_active = active; }
+
+  /// Deltas the transaction created so far.
+  size_t DeltaCount() { return accessor_->GetTransaction()->deltas.size(); }
+
   VerticesIterable Vertices(storage::View view) { return VerticesIterable(accessor_->Vertices(view)); }
 
   VerticesIterable Vertices(storage::View view, storage::LabelId label) {
     return VerticesIterable(accessor_->Vertices(label, view));
   }
 
+  std::vector<VerticesIterable> ChunkedVertices(storage::View view, size_t num_chunks) {
+    return ToQueryIterables(accessor_->ChunkedVertices(view, num_chunks));
+  }
+
+  std::vector<VerticesIterable> ChunkedVertices(storage::View view, storage::LabelId label, size_t num_chunks) {
+    return ToQueryIterables(accessor_->ChunkedVertices(label, view, num_chunks));
+  }
+
+  bool ScanColumnarProperty(storage::View view, storage::LabelId label, storage::PropertyId property,
+                            const std::function<void(const VertexAccessor &, const storage::PropertyValue &)> &func) {
+    return accessor_->ScanColumnarProperty(
+        label, property, view,
+        [&func](const storage::VertexAccessor &vertex, const storage::PropertyValue &value) {
+          func(VertexAccessor{vertex}, value);
+        });
+  }
+
+  uint64_t VertexGidUpperBound() const { return accessor_->VertexGidUpperBound(); }
+
+  std::shared_ptr<const storage::GraphProjection> GetGraphProjection(std::string_view name,
+                                                                     const storage::GraphProjectionFilter &filter,
+                                                                     storage::View view) {
+    return accessor_->GetGraphProjection(name, filter, view);
+  }
+
   VerticesIterable Vertices(storage::View view, storage::LabelId label, storage::PropertyId property) {
     return VerticesIterable(accessor_->Vertices(label, property, view));
   }
@@ -262,10 +324,44 @@ class DbAccessor final {
     return VerticesIterable(accessor_->Vertices(label, property, lower, upper, view));
   }
 
+  int64_t CountVertices(storage::View view, storage::LabelId label) {
+    return static_cast<int64_t>(accessor_->CountVertices(label, view));
+  }
+
+  int64_t CountVertices(storage::View view, storage::LabelId label, storage::PropertyId property) {
+    return static_cast<int64_t>(accessor_->CountVertices(label, property, view));
+  }
+
+  int64_t CountVertices(storage::View view, storage::LabelId label, storage::PropertyId property,
+                        const std::optional<utils::Bound<storage::PropertyValue>> &lower,
+                        const std::optional<utils::Bound<storage::PropertyValue>> &upper) {
+    return static_cast<int64_t>(accessor_->CountVertices(label, property, lower, upper, view));
+  }
+
+  VerticesIterable Vertices(storage::View view, storage::LabelId label,
+                            const std::vector<storage::PropertyId> &properties,
+                            std::vector<storage::PropertyValue> prefix,
+                            const std::optional<utils::Bound<storage::PropertyValue>> &lower,
+                            const std::optional<utils::Bound<storage::PropertyValue>> &upper) {
+    return VerticesIterable(accessor_->Vertices(label, properties, std::move(prefix), lower, upper, view));
+  }
+
+  std::vector<VertexAccessor> NearestPointVertices(storage::View view, storage::LabelId label,
+                                                   storage::PropertyId property, const storage::PropertyValue &point,
+                                                   std::size_t k) {
+    auto vertices = accessor_->NearestPointVertices(label, property, point, k, view);
+    return {vertices.begin(), vertices.end()};
+  }
+
   EdgesIterable Edges(storage::View view, storage::EdgeTypeId edge_type) {
     return EdgesIterable(accessor_->Edges(edge_type, view));
   }
 
+  EdgesIterable Edges(storage::View view, storage::EdgeTypeId edge_type, const VertexAccessor &from,
+                      const VertexAccessor &to) {
+    return EdgesIterable(accessor_->Edges(edge_type, from.impl_, to.impl_, view));
+  }
+
   EdgesIterable Edges(storage::View view, storage::EdgeTypeId edge_type, storage::PropertyId property) {
     return EdgesIterable(accessor_->Edges(edge_type, property, view));
   }
@@ -414,6 +510,10 @@ class DbAccessor final {
 
   storage::EdgeTypeId NameToEdgeType(const std::string_view name) { return accessor_->NameToEdgeType(name); }
 
+  std::optional<storage::EdgeTypeId> NameToEdgeTypeIfExists(std::string_view name) const {
+    return accessor_->NameToEdgeTypeIfExists(name);
+  }
+
   const std::string &PropertyToName(storage::PropertyId prop) const { return accessor_->PropertyToName(prop); }
 
   const std::string &LabelToName(storage::LabelId label) const { return accessor_->LabelToName(label); }
@@ -444,8 +544,21 @@ class DbAccessor final {
     return accessor_->LabelPropertyIndexExists(label, prop);
   }
 
+  bool LabelPropertyCompositeIndexExists(storage::LabelId label,
+                                         const std::vector<storage::PropertyId> &properties) const {
+    return accessor_->LabelPropertyCompositeIndexExists(label, properties);
+  }
+
+  std::vector<std::vector<storage::PropertyId>> LabelPropertyCompositeIndices(storage::LabelId label) const {
+    return accessor_->ListLabelPropertyCompositeIndices(label);
+  }
+
   bool EdgeTypeIndexExists(storage::EdgeTypeId edge_type) const { return accessor_->EdgeTypeIndexExists(edge_type); }
 
+  bool PointIndexExists(storage::LabelId label, storage::PropertyId property) const {
+    return accessor_->PointIndexExists(label, property);
+  }
+
   bool EdgeTypePropertyIndexExists(storage::EdgeTypeId edge_type, storage::PropertyId property) const {
     return accessor_->EdgeTypePropertyIndexExists(edge_type, property);
   }
@@ -458,6 +571,8 @@ class DbAccessor final {
     accessor_->TextIndexUpdateVertex(vertex.impl_, removed_labels);
   }
 
+  void TextIndexRefresh(const std::string &index_name) const { accessor_->TextIndexRefresh(index_name); }
+
   std::vector<storage::Gid> TextIndexSearch(const std::string &index_name, const std::string &search_query,
                                             text_search_mode search_mode) const {
     return accessor_->TextIndexSearch(index_name, search_query, search_mode);
@@ -468,6 +583,22 @@ class DbAccessor final {
     return accessor_->TextIndexAggregate(index_name, search_query, aggregation_query);
   }
 
+  std::optional<uint64_t> VectorIndexDimension(storage::LabelId label, storage::PropertyId property) const {
+    return accessor_->VectorIndexDimension(label, property);
+  }
+
+  std::vector<std::pair<VertexAccessor, double>> VectorIndexSearch(storage::LabelId label, storage::PropertyId property,
+                                                                   const storage::PropertyValue &query, size_t k,
+                                                                   storage::View view) {
+    auto found = accessor_->VectorIndexSearch(label, property, query, k, view);
+    std::vector<std::pair<VertexAccessor, double>> result;
+    result.reserve(found.size());
+    for (auto &[vertex, similarity] : found) {
+      result.emplace_back(VertexAccessor(vertex), similarity);
+    }
+    return result;
+  }
+
   std::optional<storage::LabelIndexStats> GetIndexStats(const storage::LabelId &label) const {
     return accessor_->GetIndexStats(label);
   }
@@ -512,6 +643,15 @@ class DbAccessor final {
     return accessor_->ApproximateVertexCount(label, property, lower, upper);
   }
 
+  int64_t VerticesCount(storage::LabelId label, const std::vector<storage::PropertyId> &properties) const {
+    return accessor_->ApproximateVertexCount(label, properties);
+  }
+
+  int64_t VerticesCount(storage::LabelId label, const std::vector<storage::PropertyId> &properties,
+                        const std::vector<storage::PropertyValue> &prefix) const {
+    return accessor_->ApproximateVertexCount(label, properties, prefix);
+  }
+
   int64_t EdgesCount(storage::EdgeTypeId edge_type) const { return accessor_->ApproximateEdgeCount(edge_type); }
 
   int64_t EdgesCount(storage::EdgeTypeId edge_type, storage::PropertyId property) const {
@@ -551,6 +691,11 @@ class DbAccessor final {
     return accessor_->CreateIndex(label, property);
   }
 
+  utils::BasicResult<storage::StorageIndexDefinitionError, void> CreateIndex(
+      storage::LabelId label, const std::vector<storage::PropertyId> &properties) {
+    return accessor_->CreateIndex(label, properties);
+  }
+
   utils::BasicResult<storage::StorageIndexDefinitionError, void> CreateIndex(storage::EdgeTypeId edge_type) {
     return accessor_->CreateIndex(edge_type);
   }
@@ -569,6 +714,11 @@ class DbAccessor final {
     return accessor_->DropIndex(label, property);
   }
 
+  utils::BasicResult<storage::StorageIndexDefinitionError, void> DropIndex(
+      storage::LabelId label, const std::vector<storage::PropertyId> &properties) {
+    return accessor_->DropIndex(label, properties);
+  }
+
   utils::BasicResult<storage::StorageIndexDefinitionError, void> DropIndex(storage::EdgeTypeId edge_type) {
     return accessor_->DropIndex(edge_type);
   }
@@ -588,6 +738,16 @@ class DbAccessor final {
     return accessor_->DropPointIndex(label, property);
   }
 
+  utils::BasicResult<storage::StorageIndexDefinitionError, void> CreateVectorIndex(
+      const storage::VectorIndexSpec &spec) {
+    return accessor_->CreateVectorIndex(spec);
+  }
+
+  utils::BasicResult<storage::StorageIndexDefinitionError, void> DropVectorIndex(storage::LabelId label,
+                                                                                 storage::PropertyId property) {
+    return accessor_->DropVectorIndex(label, property);
+  }
+
   void CreateTextIndex(const std::string &index_name, storage::LabelId label) {
     accessor_->CreateTextIndex(index_name, label);
   }
@@ -12,11 +12,14 @@
 #include "query/dump.hpp"
 
 #include <algorithm>
+#include <exception>
 #include <iomanip>
+#include <iterator>
 #include <limits>
 #include <map>
 #include <optional>
 #include <ostream>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -34,8 +37,10 @@
 #include "storage/v2/temporal.hpp"
 #include "utils/algorithm.hpp"
 #include "utils/logging.hpp"
+#include "utils/on_scope_exit.hpp"
 #include "utils/string.hpp"
 #include "utils/temporal.hpp"
+#include "utils/thread.hpp"
 
 #include "range/v3/all.hpp"
 
@@ -306,6 +311,15 @@ void DumpLabelPropertyIndex(std::ostream *os, query::DbAccessor *dba, storage::L
       << ");";
 }
 
+void DumpLabelPropertyCompositeIndex(std::ostream *os, query::DbAccessor *dba, storage::LabelId label,
+                                     const std::vector<storage::PropertyId> &properties) {
+  *os << "CREATE INDEX ON :" << EscapeName(dba->LabelToName(label)) << "(";
+  utils::PrintIterable(*os, properties, ", ", [&dba](auto &stream, const auto &property) {
+    stream << EscapeName(dba->PropertyToName(property));
+  });
+  *os << ");";
+}
+
 void DumpTextIndex(std::ostream *os, query::DbAccessor *dba, const std::string &index_name, storage::LabelId label) {
   *os << "CREATE TEXT INDEX " << EscapeName(index_name) << " ON :" << EscapeName(dba->LabelToName(label)) << ";";
 }
@@ -315,6 +329,11 @@ void DumpPointIndex(std::ostream *os, query::DbAccessor *dba, storage::LabelId l
       << EscapeName(dba->PropertyToName(property)) << ");";
 }
 
+void DumpVectorIndex(std::ostream *os, query::DbAccessor *dba, const storage::VectorIndexSpec &spec) {
+  *os << "CREATE VECTOR INDEX ON :" << EscapeName(dba->LabelToName(spec.label)) << "("
+      << EscapeName(dba->PropertyToName(spec.property)) << ") WITH DIMENSION " << spec.dimension << ";";
+}
+
 void DumpExistenceConstraint(std::ostream *os, query::DbAccessor *dba, storage::LabelId label,
                              storage::PropertyId property) {
   *os << "CREATE CONSTRAINT ON (u:" << EscapeName(dba->LabelToName(label)) << ") ASSERT EXISTS (u."
@@ -336,6 +355,62 @@ void DumpTypeConstraint(std::ostream *os, query::DbAccessor *dba, storage::Label
       << EscapeName(dba->PropertyToName(property)) << " IS TYPED " << storage::TypeConstraintKindToString(type) << ";";
 }
 
+// Vertices or edges whose statements are generated together, per worker.
+constexpr size_t kDumpWindowPerWorker = 4096;
+// Workers are only started if each of them gets at least this many items.
+constexpr size_t kMinDumpItemsPerWorker = 256;
+
+/// Dumps each of `items` into its own statement. With more than one worker
+/// the items are split into contiguous slices, one per thread, so the
+/// statements keep the order of the items.
+template <typename TItem, typename TDump>
+std::vector<std::string> DumpStatements(query::DbAccessor *dba, const std::vector<TItem> &items, size_t num_workers,
+                                        const TDump &dump) {
+  std::vector<std::string> statements(items.size());
+  auto dump_slice = [&](size_t begin, size_t end) {
+    for (auto i = begin; i < end; ++i) {
+      std::ostringstream os;
+      dump(&os, items[i]);
+      statements[i] = os.str();
+    }
+  };
+
+  // The other storage modes don't support concurrent readers of a transaction
+  if (dba->GetStorageMode() == storage::StorageMode::ON_DISK_TRANSACTIONAL || !dba->GetTransactionId()) {
+    num_workers = 1;
+  }
+  num_workers = std::min(num_workers, items.size() / kMinDumpItemsPerWorker);
+  if (num_workers <= 1) {
+    dump_slice(0, items.size());
+    return statements;
+  }
+
+  std::vector<std::exception_ptr> errors(num_workers);
+  dba->SetParallelReadersActive(true);
+  utils::OnScopeExit readers_done{[dba] { dba->SetParallelReadersActive(false); }};
+  {
+    const auto slice_size = (items.size() + num_workers - 1) / num_workers;
+    std::vector<std::jthread> workers;
+    workers.reserve(num_workers);
+    for (size_t worker = 0; worker < num_workers; ++worker) {
+      workers.emplace_back([&, worker] {
+        utils::ThreadSetName("DumpWorker");
+        dba->TrackCurrentThreadAllocations();
+        utils::OnScopeExit untrack{[dba] { dba->UntrackCurrentThreadAllocations(); }};
+        try {
+          dump_slice(worker * slice_size, std::min(items.size(), (worker + 1) * slice_size));
+        } catch (...) {
+          errors[worker] = std::current_exception();
+        }
+      });
+    }
+  }
+  for (auto &error : errors) {
+    if (error) std::rethrow_exception(error);
+  }
+  return statements;
+}
+
 const char *triggerPhaseToString(TriggerPhase phase) {
   switch (phase) {
     case TriggerPhase::BEFORE_COMMIT:
@@ -347,20 +422,25 @@ const char *triggerPhaseToString(TriggerPhase phase) {
 
 }  // namespace
 
-PullPlanDump::PullPlanDump(DbAccessor *dba, dbms::DatabaseAccess db_acc)
+PullPlanDump::PullPlanDump(DbAccessor *dba, dbms::DatabaseAccess db_acc, size_t num_workers)
     : dba_(dba),
       db_acc_(db_acc),
       vertices_iterable_(dba->Vertices(storage::View::OLD)),
+      num_workers_(std::max<size_t>(num_workers, 1)),
       pull_chunks_{// Dump all enums
                    CreateEnumsPullChunk(),
                    // Dump all label indices
                    CreateLabelIndicesPullChunk(),
                    // Dump all label property indices
                    CreateLabelPropertyIndicesPullChunk(),
+                   // Dump all composite label property indices
+                   CreateLabelPropertyCompositeIndicesPullChunk(),
                    // Dump all text indices
                    CreateTextIndicesPullChunk(),
                    // Dump all point indices
                    CreatePointIndicesPullChunk(),
+                   // Dump all vector indices
+                   CreateVectorIndicesPullChunk(),
                    // Dump all existence constraints
                    CreateExistenceConstraintsPullChunk(),
                    // Dump all unique constraints
@@ -547,6 +627,33 @@ PullPlanDump::PullChunk PullPlanDump::CreateLabelPropertyIndicesPullChunk() {
   };
 }
 
+PullPlanDump::PullChunk PullPlanDump::CreateLabelPropertyCompositeIndicesPullChunk() {
+  return [this, global_index = 0U](AnyStream *stream, std::optional<int> n) mutable -> std::optional<size_t> {
+    // Delay the construction of indices vectors
+    if (!indices_info_) {
+      indices_info_.emplace(dba_->ListAllIndices());
+    }
+    const auto &label_property_composite = indices_info_->label_property_composite;
+
+    size_t local_counter = 0;
+    while (global_index < label_property_composite.size() && (!n || local_counter < *n)) {
+      std::ostringstream os;
+      const auto &[label, properties] = label_property_composite[global_index];
+      DumpLabelPropertyCompositeIndex(&os, dba_, label, properties);
+      stream->Result({TypedValue(os.str())});
+
+      ++global_index;
+      ++local_counter;
+    }
+
+    if (global_index == label_property_composite.size()) {
+      return local_counter;
+    }
+
+    return std::nullopt;
+  };
+}
+
 PullPlanDump::PullChunk PullPlanDump::CreateTextIndicesPullChunk() {
   // Dump all text indices
   return [this, global_index = 0U](AnyStream *stream, std::optional<int> n) mutable -> std::optional<size_t> {
@@ -602,6 +709,32 @@ PullPlanDump::PullChunk PullPlanDump::CreatePointIndicesPullChunk() {
   };
 }
 
+PullPlanDump::PullChunk PullPlanDump::CreateVectorIndicesPullChunk() {
+  return [this, global_index = 0U](AnyStream *stream, std::optional<int> n) mutable -> std::optional<size_t> {
+    // Delay the construction of indices vectors
+    if (!indices_info_) {
+      indices_info_.emplace(dba_->ListAllIndices());
+    }
+    const auto &vector_label_properties = indices_info_->vector_label_property;
+
+    size_t local_counter = 0;
+    while (global_index < vector_label_properties.size() && (!n || local_counter < *n)) {
+      std::ostringstream os;
+      DumpVectorIndex(&os, dba_, vector_label_properties[global_index]);
+      stream->Result({TypedValue(os.str())});
+
+      ++global_index;
+      ++local_counter;
+    }
+
+    if (global_index == vector_label_properties.size()) {
+      return local_counter;
+    }
+
+    return std::nullopt;
+  };
+}
+
 PullPlanDump::PullChunk PullPlanDump::CreateExistenceConstraintsPullChunk() {
   return [this, global_index = 0U](AnyStream *stream, std::optional<int> n) mutable -> std::optional<size_t> {
     // Delay the construction of constraint vectors
@@ -696,6 +829,20 @@ PullPlanDump::PullChunk PullPlanDump::CreateInternalIndexPullChunk() {
   };
 }
 
+size_t PullPlanDump::StreamPendingStatements(AnyStream *stream, std::optional<size_t> max) {
+  size_t streamed = 0;
+  while (HasPendingStatements() && (!max || streamed < *max)) {
+    stream->Result({TypedValue(pending_statements_[next_pending_statement_])});
+    ++next_pending_statement_;
+    ++streamed;
+  }
+  if (!HasPendingStatements()) {
+    pending_statements_.clear();
+    next_pending_statement_ = 0;
+  }
+  return streamed;
+}
+
 PullPlanDump::PullChunk PullPlanDump::CreateVertexPullChunk() {
   return [this, maybe_current_iter = std::optional<VertexAccessorIterableIterator>{}](
              AnyStream *stream, std::optional<int> n) mutable -> std::optional<size_t> {
@@ -708,29 +855,29 @@ PullPlanDump::PullChunk PullPlanDump::CreateVertexPullChunk() {
     }
 
     auto &current_iter{*maybe_current_iter};
+    const auto window_size = kDumpWindowPerWorker * num_workers_;
 
     size_t local_counter = 0;
-    while (current_iter != vertices_iterable_.end() && (!n || local_counter < *n)) {
-      std::ostringstream os;
-      DumpVertex(&os, dba_, *current_iter);
-      stream->Result({TypedValue(os.str())});
-      ++local_counter;
-      ++current_iter;
-    }
-    if (current_iter == vertices_iterable_.end()) {
-      return local_counter;
+    while (true) {
+      local_counter += StreamPendingStatements(stream, n ? std::optional<size_t>(*n - local_counter) : std::nullopt);
+      if (HasPendingStatements()) return std::nullopt;
+      if (current_iter == vertices_iterable_.end()) return local_counter;
+      if (n && local_counter >= *n) return std::nullopt;
+
+      std::vector<VertexAccessor> window;
+      window.reserve(window_size);
+      for (; current_iter != vertices_iterable_.end() && window.size() < window_size; ++current_iter) {
+        window.push_back(*current_iter);
+      }
+      pending_statements_ = DumpStatements(dba_, window, num_workers_, [this](std::ostream *os, const auto &vertex) {
+        DumpVertex(os, dba_, vertex);
+      });
     }
-
-    return std::nullopt;
   };
 }
 
 PullPlanDump::PullChunk PullPlanDump::CreateEdgePullChunk() {
-  return [this, maybe_current_vertex_iter = std::optional<VertexAccessorIterableIterator>{},
-          // we need to save the iterable which contains list of accessor so
-          // our saved iterator is valid in the next run
-          maybe_edge_iterable = std::shared_ptr<EdgeAccessorIterable>{nullptr},
-          maybe_current_edge_iter = std::optional<EdgeAccessorIterableIterator>{}](
+  return [this, maybe_current_vertex_iter = std::optional<VertexAccessorIterableIterator>{}](
              AnyStream *stream, std::optional<int> n) mutable -> std::optional<size_t> {
     // Delay the call of begin() function
     // If multiple begins are called before an iteration,
@@ -741,39 +888,28 @@ PullPlanDump::PullChunk PullPlanDump::CreateEdgePullChunk() {
     }
 
     auto &current_vertex_iter{*maybe_current_vertex_iter};
-    size_t local_counter = 0U;
-    for (; current_vertex_iter != vertices_iterable_.end() && (!n || local_counter < *n); ++current_vertex_iter) {
-      const auto &vertex = *current_vertex_iter;
-      // If we have a saved iterable from a previous pull
-      // we need to use the same iterable
-      if (!maybe_edge_iterable) {
-        maybe_edge_iterable = std::make_shared<EdgeAccessorIterable>(vertex.OutEdges(storage::View::OLD));
-      }
-      auto &maybe_edges = *maybe_edge_iterable;
-      MG_ASSERT(maybe_edges.HasValue(), "Invalid database state!");
-      auto current_edge_iter = maybe_current_edge_iter ? *maybe_current_edge_iter : maybe_edges->edges.begin();
-      for (; current_edge_iter != maybe_edges->edges.end() && (!n || local_counter < *n); ++current_edge_iter) {
-        std::ostringstream os;
-        DumpEdge(&os, dba_, *current_edge_iter);
-        stream->Result({TypedValue(os.str())});
-
-        ++local_counter;
-      }
+    const auto window_size = kDumpWindowPerWorker * num_workers_;
 
-      if (current_edge_iter != maybe_edges->edges.end()) {
-        maybe_current_edge_iter.emplace(current_edge_iter);
-        return std::nullopt;
+    size_t local_counter = 0U;
+    while (true) {
+      local_counter += StreamPendingStatements(stream, n ? std::optional<size_t>(*n - local_counter) : std::nullopt);
+      if (HasPendingStatements()) return std::nullopt;
+      if (current_vertex_iter == vertices_iterable_.end()) return local_counter;
+      if (n && local_counter >= *n) return std::nullopt;
+
+      // The out edges of a vertex are always dumped in the same window, which
+      // can make it larger than `window_size` for vertices of a high degree.
+      std::vector<EdgeAccessor> window;
+      window.reserve(window_size);
+      for (; current_vertex_iter != vertices_iterable_.end() && window.size() < window_size; ++current_vertex_iter) {
+        auto maybe_edges = (*current_vertex_iter).OutEdges(storage::View::OLD);
+        MG_ASSERT(maybe_edges.HasValue(), "Invalid database state!");
+        std::ranges::move(maybe_edges->edges, std::back_inserter(window));
       }
-
-      maybe_current_edge_iter = std::nullopt;
-      maybe_edge_iterable = nullptr;
-    }
-
-    if (current_vertex_iter == vertices_iterable_.end()) {
-      return local_counter;
+      pending_statements_ = DumpStatements(dba_, window, num_workers_, [this](std::ostream *os, const auto &edge) {
+        DumpEdge(os, dba_, edge);
+      });
     }
-
-    return std::nullopt;
   };
 }
 
@@ -816,8 +952,9 @@ PullPlanDump::PullChunk PullPlanDump::CreateTriggersPullChunk() {
   };
 }
 
-void DumpDatabaseToCypherQueries(query::DbAccessor *dba, AnyStream *stream, dbms::DatabaseAccess db_acc) {
-  PullPlanDump(dba, db_acc).Pull(stream, {});
+void DumpDatabaseToCypherQueries(query::DbAccessor *dba, AnyStream *stream, dbms::DatabaseAccess db_acc,
+                                 size_t num_workers) {
+  PullPlanDump(dba, db_acc, num_workers).Pull(stream, {});
 }
 
 }  // namespace memgraph::query
@@ -17,10 +17,13 @@
 
 namespace memgraph::query {
 
-void DumpDatabaseToCypherQueries(query::DbAccessor *dba, AnyStream *stream, dbms::DatabaseAccess db_acc);
+void DumpDatabaseToCypherQueries(query::DbAccessor *dba, AnyStream *stream, dbms::DatabaseAccess db_acc,
+                                 size_t num_workers = 1);
 
 struct PullPlanDump {
-  explicit PullPlanDump(query::DbAccessor *dba, dbms::DatabaseAccess db_acc);
+  /// The vertex and edge statements are generated on `num_workers` threads,
+  /// a window of them at a time, if `num_workers` is larger than 1.
+  explicit PullPlanDump(query::DbAccessor *dba, dbms::DatabaseAccess db_acc, size_t num_workers = 1);
 
   /// Pull the dump results lazily
   /// @return true if all results were returned, false otherwise
@@ -36,12 +39,19 @@ struct PullPlanDump {
   using VertexAccessorIterable = decltype(std::declval<query::DbAccessor>().Vertices(storage::View::OLD));
   using VertexAccessorIterableIterator = decltype(std::declval<VertexAccessorIterable>().begin());
 
-  using EdgeAccessorIterable = decltype(std::declval<VertexAccessor>().OutEdges(storage::View::OLD));
-  using EdgeAccessorIterableIterator = decltype(std::declval<EdgeAccessorIterable>().GetValue().edges.begin());
-
   VertexAccessorIterable vertices_iterable_;
   bool internal_index_created_ = false;
 
+  size_t num_workers_ = 1;
+  // Statements generated for the current window of vertices or edges which
+  // weren't streamed yet.
+  std::vector<std::string> pending_statements_;
+  size_t next_pending_statement_ = 0;
+
+  /// Streams at most `max` pending statements, returns how many were streamed.
+  size_t StreamPendingStatements(AnyStream *stream, std::optional<size_t> max);
+  bool HasPendingStatements() const { return next_pending_statement_ < pending_statements_.size(); }
+
   size_t current_chunk_index_ = 0;
 
   using PullChunk = std::function<std::optional<size_t>(AnyStream *stream, std::optional<int> n)>;
@@ -55,8 +65,10 @@ struct PullPlanDump {
   PullChunk CreateEnumsPullChunk();
   PullChunk CreateLabelIndicesPullChunk();
   PullChunk CreateLabelPropertyIndicesPullChunk();
+  PullChunk CreateLabelPropertyCompositeIndicesPullChunk();
   PullChunk CreateTextIndicesPullChunk();
   PullChunk CreatePointIndicesPullChunk();
+  PullChunk CreateVectorIndicesPullChunk();
   PullChunk CreateExistenceConstraintsPullChunk();
   PullChunk CreateUniqueConstraintsPullChunk();
   PullChunk CreateTypeConstraintsPullChunk();
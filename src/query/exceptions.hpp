@@ -124,6 +124,13 @@ class SchemaAssertInMulticommandTxException : public QueryException {
   SPECIALIZE_GET_EXCEPTION_NAME(SchemaAssertInMulticommandTxException)
 };
 
+class FanOutInMulticommandTxException : public QueryException {
+ public:
+  using QueryException::QueryException;
+  FanOutInMulticommandTxException() : QueryException("USING DATABASES not allowed in multicommand transactions.") {}
+  SPECIALIZE_GET_EXCEPTION_NAME(FanOutInMulticommandTxException)
+};
+
 class ConstraintInMulticommandTxException : public QueryException {
  public:
   using QueryException::QueryException;
@@ -443,6 +450,16 @@ class TransactionQueueInMulticommandTxException : public QueryException {
   SPECIALIZE_GET_EXCEPTION_NAME(TransactionQueueInMulticommandTxException)
 };
 
+class QueryAdmissionTimeoutException : public RetryBasicException {
+ public:
+  explicit QueryAdmissionTimeoutException(std::string_view lane)
+      : RetryBasicException(fmt::format(
+            "The query waited too long for a free slot in the admission lane '{}'. You can retry it when the load "
+            "is lower.",
+            lane)) {}
+  SPECIALIZE_GET_EXCEPTION_NAME(QueryAdmissionTimeoutException)
+};
+
 class IndexPersistenceException : public QueryException {
  public:
   IndexPersistenceException() : QueryException("Persisting index on disk failed.") {}
@@ -0,0 +1,178 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#include "query/fan_out.hpp"
+
+#include <algorithm>
+
+#include "query/exceptions.hpp"
+#include "query/frontend/ast/ast.hpp"
+#include "utils/logging.hpp"
+
+namespace memgraph::query {
+
+namespace {
+
+// Finds aggregations nested in an expression, which can't be merged.
+class AggregationFinder : public HierarchicalTreeVisitor {
+ public:
+  using HierarchicalTreeVisitor::PostVisit;
+  using HierarchicalTreeVisitor::PreVisit;
+  using HierarchicalTreeVisitor::Visit;
+
+  bool PreVisit(Aggregation & /*aggregation*/) override {
+    found_ = true;
+    return false;
+  }
+
+  bool Visit(Identifier & /*identifier*/) override { return true; }
+  bool Visit(PrimitiveLiteral & /*literal*/) override { return true; }
+  bool Visit(ParameterLookup & /*parameter*/) override { return true; }
+  bool Visit(EnumValueAccess & /*enum_value*/) override { return true; }
+
+  bool found_{false};
+};
+
+bool HasGraphElement(const TypedValue &value) {
+  switch (value.type()) {
+    case TypedValue::Type::Vertex:
+    case TypedValue::Type::Edge:
+    case TypedValue::Type::Path:
+    case TypedValue::Type::Graph:
+      return true;
+    case TypedValue::Type::List:
+      return std::ranges::any_of(value.ValueList(), HasGraphElement);
+    case TypedValue::Type::Map:
+      return std::ranges::any_of(value.ValueMap(), [](const auto &entry) { return HasGraphElement(entry.second); });
+    default:
+      return false;
+  }
+}
+
+TypedValue MergeValues(FanOutMerger::Column column, const TypedValue &merged, const TypedValue &value) {
+  switch (column) {
+    case FanOutMerger::Column::KEY:
+      return merged;
+    case FanOutMerger::Column::COUNT:
+    case FanOutMerger::Column::SUM:
+      return merged + value;
+    case FanOutMerger::Column::MIN:
+    case FanOutMerger::Column::MAX: {
+      // Null is the result of an aggregation over no values.
+      if (merged.IsNull()) return value;
+      if (value.IsNull()) return merged;
+      const auto less = column == FanOutMerger::Column::MIN ? value < merged : merged < value;
+      return less.ValueBool() ? value : merged;
+    }
+  }
+  LOG_FATAL("Unknown fan out column");
+}
+
+}  // namespace
+
+std::optional<std::vector<FanOutMerger::Column>> FanOutMerger::Columns(CypherQuery &query) {
+  if (!query.cypher_unions_.empty()) {
+    throw SemanticException("USING DATABASES can't be used with UNION.");
+  }
+  auto &clauses = query.single_query_->clauses_;
+  auto *ret = clauses.empty() ? nullptr : utils::Downcast<Return>(clauses.back());
+  if (!ret) {
+    throw SemanticException("USING DATABASES can be used only with queries which end with RETURN.");
+  }
+
+  const auto &body = ret->body_;
+  if (body.all_identifiers) {
+    throw SemanticException("USING DATABASES can't be used with RETURN *.");
+  }
+  if (!body.order_by.empty() || body.skip || body.limit) {
+    throw SemanticException("USING DATABASES can't be used with ORDER BY, SKIP or LIMIT in RETURN.");
+  }
+
+  std::vector<Column> columns;
+  columns.reserve(body.named_expressions.size());
+  bool aggregates = false;
+  for (auto *named_expression : body.named_expressions) {
+    auto *aggregation = utils::Downcast<Aggregation>(named_expression->expression_);
+    if (!aggregation) {
+      AggregationFinder finder;
+      named_expression->expression_->Accept(finder);
+      if (finder.found_) {
+        throw SemanticException("USING DATABASES can merge only aggregations which are returned as they are.");
+      }
+      columns.push_back(Column::KEY);
+      continue;
+    }
+    if (aggregation->distinct_) {
+      throw SemanticException("USING DATABASES can't merge DISTINCT aggregations.");
+    }
+    switch (aggregation->op_) {
+      case Aggregation::Op::COUNT:
+        columns.push_back(Column::COUNT);
+        break;
+      case Aggregation::Op::SUM:
+        columns.push_back(Column::SUM);
+        break;
+      case Aggregation::Op::MIN:
+        columns.push_back(Column::MIN);
+        break;
+      case Aggregation::Op::MAX:
+        columns.push_back(Column::MAX);
+        break;
+      default:
+        throw SemanticException("USING DATABASES can merge only count, sum, min and max aggregations.");
+    }
+    aggregates = true;
+  }
+
+  if (!aggregates) {
+    if (body.distinct) {
+      throw SemanticException("USING DATABASES can't be used with RETURN DISTINCT.");
+    }
+    return std::nullopt;
+  }
+  return columns;
+}
+
+bool FanOutMerger::KeyEqual::operator()(const std::vector<TypedValue> &left,
+                                        const std::vector<TypedValue> &right) const {
+  return std::ranges::equal(left, right, TypedValue::BoolEqual{});
+}
+
+void FanOutMerger::Add(std::vector<TypedValue> row) {
+  if (std::ranges::any_of(row, HasGraphElement)) {
+    throw QueryRuntimeException("Queries run with USING DATABASES can't return nodes, relationships or paths.");
+  }
+  if (!columns_) {
+    rows_.emplace_back(std::move(row));
+    return;
+  }
+
+  const auto &columns = *columns_;
+  MG_ASSERT(row.size() == columns.size(), "Fanned out row doesn't have a value for each column");
+  std::vector<TypedValue> key;
+  for (size_t i = 0; i < columns.size(); ++i) {
+    if (columns[i] == Column::KEY) key.push_back(row[i]);
+  }
+  auto [it, inserted] = groups_.try_emplace(std::move(key), rows_.size());
+  if (inserted) {
+    rows_.emplace_back(std::move(row));
+    return;
+  }
+  auto &merged = rows_[it->second];
+  for (size_t i = 0; i < columns.size(); ++i) {
+    merged[i] = MergeValues(columns[i], merged[i], row[i]);
+  }
+}
+
+std::vector<std::vector<TypedValue>> FanOutMerger::Rows() && { return std::move(rows_); }
+
+}  // namespace memgraph::query
@@ -0,0 +1,66 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+/// @file
+/// Merging of the results of a read-only query which is fanned out to several
+/// databases with `USING DATABASES a, b, ...`. Each database runs the whole
+/// query, the rows they return are merged into the rows of the query.
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "query/typed_value.hpp"
+#include "utils/fnv.hpp"
+
+namespace memgraph::query {
+
+class CypherQuery;
+
+class FanOutMerger {
+ public:
+  /// How the values of a column coming from different databases are merged.
+  enum class Column : uint8_t { KEY, COUNT, SUM, MIN, MAX };
+
+  /// Returns how the columns of @p query are merged, or std::nullopt if the
+  /// query doesn't aggregate and its rows are only concatenated.
+  /// @throw QueryException if the results of the query can't be merged.
+  static std::optional<std::vector<Column>> Columns(CypherQuery &query);
+
+  /// Concatenates the rows if @p columns aren't set, otherwise merges the
+  /// rows with equal key columns.
+  explicit FanOutMerger(std::optional<std::vector<Column>> columns) : columns_(std::move(columns)) {}
+
+  /// @throw QueryException if the row holds a graph element, which belongs
+  /// to the storage of one database.
+  void Add(std::vector<TypedValue> row);
+
+  /// Merged rows, the groups are in the order their keys were first added.
+  std::vector<std::vector<TypedValue>> Rows() &&;
+
+ private:
+  struct KeyEqual {
+    bool operator()(const std::vector<TypedValue> &left, const std::vector<TypedValue> &right) const;
+  };
+
+  std::optional<std::vector<Column>> columns_;
+  std::vector<std::vector<TypedValue>> rows_;
+  std::unordered_map<std::vector<TypedValue>, size_t,
+                     utils::FnvCollection<std::vector<TypedValue>, TypedValue, TypedValue::Hash>, KeyEqual>
+      groups_;
+};
+
+}  // namespace memgraph::query
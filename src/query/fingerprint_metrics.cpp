@@ -0,0 +1,182 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/fingerprint_metrics.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+#include <fmt/format.h>
+
+namespace memgraph::query {
+
+namespace {
+
+std::string EscapePrometheusLabel(std::string_view value) {
+  std::string escaped;
+  escaped.reserve(value.size());
+  for (const auto c : value) {
+    switch (c) {
+      case '\\':
+        escaped += "\\\\";
+        break;
+      case '"':
+        escaped += "\\\"";
+        break;
+      case '\n':
+        escaped += "\\n";
+        break;
+      default:
+        escaped += c;
+    }
+  }
+  return escaped;
+}
+
+void AppendMetricHeader(std::string *out, std::string_view name, std::string_view type, std::string_view help) {
+  fmt::format_to(std::back_inserter(*out), "# HELP {} {}\n# TYPE {} {}\n", name, help, name, type);
+}
+
+}  // namespace
+
+void QueryFingerprintMetrics::Record(uint64_t fingerprint, std::string_view query, const Execution &execution,
+                                     size_t max_fingerprints) {
+  if (max_fingerprints == 0) return;
+  std::shared_ptr<Entry> entry;
+  {
+    auto guard = std::lock_guard{mutex_};
+    auto it = entries_.find(fingerprint);
+    if (it == entries_.end()) {
+      while (entries_.size() >= max_fingerprints) {
+        auto fewest = std::ranges::min_element(entries_, std::less{}, [](const auto &fingerprint_entry) {
+          return fingerprint_entry.second->executions.load(std::memory_order_relaxed);
+        });
+        entries_.erase(fewest);
+      }
+      it = entries_.emplace(fingerprint, std::make_shared<Entry>(std::string(query))).first;
+    }
+    entry = it->second;
+  }
+
+  entry->latency_us.Measure(execution.latency_us);
+  entry->executions.fetch_add(1, std::memory_order_relaxed);
+  entry->rows.fetch_add(execution.rows, std::memory_order_relaxed);
+  if (execution.plan_cache_hit) entry->plan_cache_hits.fetch_add(1, std::memory_order_relaxed);
+  auto peak = entry->peak_memory.load(std::memory_order_relaxed);
+  while (peak < execution.peak_memory &&
+         !entry->peak_memory.compare_exchange_weak(peak, execution.peak_memory, std::memory_order_relaxed)) {
+  }
+}
+
+std::vector<QueryFingerprintStats> QueryFingerprintMetrics::Fingerprints() const {
+  std::vector<std::pair<uint64_t, std::shared_ptr<Entry>>> entries;
+  {
+    auto guard = std::lock_guard{mutex_};
+    entries.assign(entries_.begin(), entries_.end());
+  }
+
+  std::vector<QueryFingerprintStats> fingerprints;
+  fingerprints.reserve(entries.size());
+  for (const auto &[fingerprint, entry] : entries) {
+    const auto executions = entry->executions.load(std::memory_order_relaxed);
+    const auto plan_cache_hits = entry->plan_cache_hits.load(std::memory_order_relaxed);
+    fingerprints.push_back(QueryFingerprintStats{
+        .fingerprint = fingerprint,
+        .query = entry->query,
+        .executions = executions,
+        .rows = entry->rows.load(std::memory_order_relaxed),
+        .peak_memory = entry->peak_memory.load(std::memory_order_relaxed),
+        .plan_cache_hits = plan_cache_hits,
+        .plan_cache_misses = executions - std::min(executions, plan_cache_hits),
+        .latency_sum_us = entry->latency_us.Sum(),
+        .latency_percentiles_us = entry->latency_us.YieldPercentiles()});
+  }
+  std::ranges::sort(fingerprints, std::greater{}, &QueryFingerprintStats::executions);
+  return fingerprints;
+}
+
+void QueryFingerprintMetrics::Clear() {
+  auto guard = std::lock_guard{mutex_};
+  entries_.clear();
+}
+
+QueryFingerprintMetrics &GlobalQueryFingerprintMetrics() {
+  static QueryFingerprintMetrics metrics;
+  return metrics;
+}
+
+nlohmann::json QueryFingerprintsToJson(const std::vector<QueryFingerprintStats> &fingerprints) {
+  auto json = nlohmann::json::object();
+  for (const auto &stats : fingerprints) {
+    auto latency = nlohmann::json::object();
+    for (const auto &[percentile, value] : stats.latency_percentiles_us) {
+      latency[std::to_string(percentile) + "p"] = value;
+    }
+    json[std::to_string(stats.fingerprint)] = {{"query", stats.query},
+                                               {"executions", stats.executions},
+                                               {"rows", stats.rows},
+                                               {"peak_memory", stats.peak_memory},
+                                               {"plan_cache_hits", stats.plan_cache_hits},
+                                               {"plan_cache_misses", stats.plan_cache_misses},
+                                               {"latency_sum_us", stats.latency_sum_us},
+                                               {"latency_us", std::move(latency)}};
+  }
+  return json;
+}
+
+std::string QueryFingerprintsToPrometheus(const std::vector<QueryFingerprintStats> &fingerprints) {
+  std::string out;
+  if (fingerprints.empty()) return out;
+
+  AppendMetricHeader(&out, "memgraph_query_fingerprint_info", "gauge", "Stripped query of the fingerprint.");
+  for (const auto &stats : fingerprints) {
+    fmt::format_to(std::back_inserter(out), "memgraph_query_fingerprint_info{{fingerprint=\"{}\",query=\"{}\"}} 1\n",
+                   stats.fingerprint, EscapePrometheusLabel(stats.query));
+  }
+
+  AppendMetricHeader(&out, "memgraph_query_fingerprint_latency_us", "summary",
+                     "Execution latency of the queries with the fingerprint in microseconds.");
+  for (const auto &stats : fingerprints) {
+    for (const auto &[percentile, value] : stats.latency_percentiles_us) {
+      fmt::format_to(std::back_inserter(out),
+                     "memgraph_query_fingerprint_latency_us{{fingerprint=\"{}\",quantile=\"{}\"}} {}\n",
+                     stats.fingerprint, static_cast<double>(percentile) / 100.0, value);
+    }
+    fmt::format_to(std::back_inserter(out), "memgraph_query_fingerprint_latency_us_sum{{fingerprint=\"{}\"}} {}\n",
+                   stats.fingerprint, stats.latency_sum_us);
+    fmt::format_to(std::back_inserter(out), "memgraph_query_fingerprint_latency_us_count{{fingerprint=\"{}\"}} {}\n",
+                   stats.fingerprint, stats.executions);
+  }
+
+  const auto append_values = [&](std::string_view name, std::string_view type, std::string_view help,
+                                 uint64_t QueryFingerprintStats::*value) {
+    AppendMetricHeader(&out, name, type, help);
+    for (const auto &stats : fingerprints) {
+      fmt::format_to(std::back_inserter(out), "{}{{fingerprint=\"{}\"}} {}\n", name, stats.fingerprint,
+                     stats.*value);
+    }
+  };
+  append_values("memgraph_query_fingerprint_rows_total", "counter",
+                "Rows returned by the queries with the fingerprint.", &QueryFingerprintStats::rows);
+  append_values("memgraph_query_fingerprint_peak_memory_bytes", "gauge",
+                "Highest memory peak of the queries with the fingerprint run with a memory limit.",
+                &QueryFingerprintStats::peak_memory);
+  append_values("memgraph_query_fingerprint_plan_cache_hits_total", "counter",
+                "Executions of the fingerprint whose plan was served from the plan cache.",
+                &QueryFingerprintStats::plan_cache_hits);
+  append_values("memgraph_query_fingerprint_plan_cache_misses_total", "counter",
+                "Executions of the fingerprint whose plan was made for them.",
+                &QueryFingerprintStats::plan_cache_misses);
+  return out;
+}
+
+}  // namespace memgraph::query
@@ -0,0 +1,98 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <json/json.hpp>
+
+#include "utils/event_histogram.hpp"
+
+namespace memgraph::query {
+
+/// Statistics of the executions of the queries with the same fingerprint, the
+/// hash of their stripped query, so queries which only differ in their
+/// literals are counted together.
+struct QueryFingerprintStats {
+  uint64_t fingerprint{0};
+  std::string query;
+  uint64_t executions{0};
+  uint64_t rows{0};
+  /// Highest peak memory of the executions in bytes. Only the queries run
+  /// with a memory limit track their memory.
+  uint64_t peak_memory{0};
+  uint64_t plan_cache_hits{0};
+  uint64_t plan_cache_misses{0};
+  uint64_t latency_sum_us{0};
+  /// Latency percentiles in microseconds.
+  std::vector<std::pair<uint64_t, uint64_t>> latency_percentiles_us;
+};
+
+/**
+ * Bounded table of the query fingerprints with the latency histogram, the
+ * rows, the memory peak and the plan cache hits of their executions. Once
+ * the table is full, a new fingerprint takes the place of the one with the
+ * fewest executions, so the frequent queries stay in the table.
+ */
+class QueryFingerprintMetrics {
+ public:
+  struct Execution {
+    uint64_t latency_us{0};
+    uint64_t rows{0};
+    uint64_t peak_memory{0};
+    bool plan_cache_hit{false};
+  };
+
+  /// Adds an execution of the query with @p fingerprint. Nothing is recorded
+  /// if @p max_fingerprints is 0.
+  void Record(uint64_t fingerprint, std::string_view query, const Execution &execution, size_t max_fingerprints);
+
+  /// Returns the fingerprints ordered by the number of executions.
+  std::vector<QueryFingerprintStats> Fingerprints() const;
+
+  void Clear();
+
+ private:
+  struct Entry {
+    explicit Entry(std::string query) : query(std::move(query)) {}
+
+    const std::string query;
+    metrics::Histogram latency_us;
+    std::atomic<uint64_t> executions{0};
+    std::atomic<uint64_t> rows{0};
+    std::atomic<uint64_t> peak_memory{0};
+    std::atomic<uint64_t> plan_cache_hits{0};
+  };
+
+  // Entries are shared so an execution is measured outside of the lock, an
+  // evicted entry lives until its last measurement is done
+  mutable std::mutex mutex_;
+  std::unordered_map<uint64_t, std::shared_ptr<Entry>> entries_;
+};
+
+QueryFingerprintMetrics &GlobalQueryFingerprintMetrics();
+
+nlohmann::json QueryFingerprintsToJson(const std::vector<QueryFingerprintStats> &fingerprints);
+
+/// Prometheus text exposition of the fingerprints, the latency is exported
+/// as a summary with a quantile for each percentile.
+std::string QueryFingerprintsToPrometheus(const std::vector<QueryFingerprintStats> &fingerprints);
+
+}  // namespace memgraph::query
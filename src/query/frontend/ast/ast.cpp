@@ -200,6 +200,9 @@ constexpr utils::TypeInfo query::EdgeIndexQuery::kType{utils::TypeId::AST_EDGE_I
 constexpr utils::TypeInfo query::PointIndexQuery::kType{utils::TypeId::AST_POINT_INDEX_QUERY, "PointIndexQuery",
                                                         &query::Query::kType};
 
+constexpr utils::TypeInfo query::VectorIndexQuery::kType{utils::TypeId::AST_VECTOR_INDEX_QUERY, "VectorIndexQuery",
+                                                         &query::Query::kType};
+
 constexpr utils::TypeInfo query::TextIndexQuery::kType{utils::TypeId::AST_TEXT_INDEX_QUERY, "TextIndexQuery",
                                                        &query::Query::kType};
 
@@ -1239,12 +1239,16 @@ class PropertyLookup : public memgraph::query::Expression {
   memgraph::query::Expression *expression_{nullptr};
   memgraph::query::PropertyIx property_;
   memgraph::query::PropertyLookup::EvaluationMode evaluation_mode_{EvaluationMode::GET_OWN_PROPERTY};
+  /// Frame slot holding the looked up value, set by the planner when a
+  /// LoadProperties operator below reads the property for every row.
+  memgraph::query::Identifier *loaded_value_{nullptr};
 
   PropertyLookup *Clone(AstStorage *storage) const override {
     PropertyLookup *object = storage->Create<PropertyLookup>();
     object->expression_ = expression_ ? expression_->Clone(storage) : nullptr;
     object->property_ = storage->GetPropertyIx(property_.name);
     object->evaluation_mode_ = evaluation_mode_;
+    object->loaded_value_ = loaded_value_ ? loaded_value_->Clone(storage) : nullptr;
     return object;
   }
 
@@ -1361,6 +1365,10 @@ class Function : public memgraph::query::Expression {
   std::function<TypedValue(const TypedValue *, int64_t, const FunctionContext &)> function_;
   // This is needed to acquire the shared lock on the module so it doesn't get reloaded while the query is running
   std::shared_ptr<procedure::Module> module_;
+  /// Set by the planner if the function is pure and its arguments are made of
+  /// literals and parameters only, so its result is the same on every row of
+  /// an execution and is evaluated once.
+  bool constant_{false};
 
   Function *Clone(AstStorage *storage) const override {
     Function *object = storage->Create<Function>();
@@ -1371,6 +1379,7 @@ class Function : public memgraph::query::Expression {
     object->function_name_ = function_name_;
     object->function_ = function_;
     object->module_ = module_;
+    object->constant_ = constant_;
     return object;
   }
 
@@ -1879,7 +1888,14 @@ class EdgeAtom : public memgraph::query::PatternAtom {
   static const utils::TypeInfo kType;
   const utils::TypeInfo &GetTypeInfo() const override { return kType; }
 
-  enum class Type : uint8_t { SINGLE, DEPTH_FIRST, BREADTH_FIRST, WEIGHTED_SHORTEST_PATH, ALL_SHORTEST_PATHS };
+  enum class Type : uint8_t {
+    SINGLE,
+    DEPTH_FIRST,
+    BREADTH_FIRST,
+    WEIGHTED_SHORTEST_PATH,
+    ALL_SHORTEST_PATHS,
+    K_SHORTEST_PATHS
+  };
 
   enum class Direction : uint8_t { IN, OUT, BOTH };
 
@@ -1941,6 +1957,7 @@ class EdgeAtom : public memgraph::query::PatternAtom {
       case Type::BREADTH_FIRST:
       case Type::WEIGHTED_SHORTEST_PATH:
       case Type::ALL_SHORTEST_PATHS:
+      case Type::K_SHORTEST_PATHS:
         return true;
       case Type::SINGLE:
         return false;
@@ -1965,6 +1982,9 @@ class EdgeAtom : public memgraph::query::PatternAtom {
   memgraph::query::EdgeAtom::Lambda weight_lambda_;
   /// Variable where the total weight for weighted shortest path will be stored.
   memgraph::query::Identifier *total_weight_{nullptr};
+  /// Optional estimate of the weight from the inner node to the destination of a weighted shortest path. Empty
+  /// unless given.
+  memgraph::query::EdgeAtom::Lambda heuristic_lambda_;
 
   EdgeAtom *Clone(AstStorage *storage) const override {
     EdgeAtom *object = storage->Create<EdgeAtom>();
@@ -1989,6 +2009,7 @@ class EdgeAtom : public memgraph::query::PatternAtom {
     object->filter_lambda_ = filter_lambda_.Clone(storage);
     object->weight_lambda_ = weight_lambda_.Clone(storage);
     object->total_weight_ = total_weight_ ? total_weight_->Clone(storage) : nullptr;
+    object->heuristic_lambda_ = heuristic_lambda_.Clone(storage);
     return object;
   }
 
@@ -2178,6 +2199,13 @@ struct PreQueryDirectives {
   memgraph::query::Expression *hops_limit_{nullptr};
   /// Commit frequency
   memgraph::query::Expression *commit_frequency_{nullptr};
+  /// Whether the batches of CALL IN TRANSACTIONS run in concurrent transactions
+  bool concurrent_commit_{false};
+  /// Transactions which run the batches at a time, the number of CPUs if null
+  memgraph::query::Expression *commit_concurrency_{nullptr};
+  /// Databases the query is fanned out to, empty if it runs only on the
+  /// current database
+  std::vector<std::string> fan_out_databases_;
 
   PreQueryDirectives Clone(AstStorage *storage) const {
     PreQueryDirectives object;
@@ -2187,6 +2215,9 @@ struct PreQueryDirectives {
     }
     object.hops_limit_ = hops_limit_ ? hops_limit_->Clone(storage) : nullptr;
     object.commit_frequency_ = commit_frequency_ ? commit_frequency_->Clone(storage) : nullptr;
+    object.concurrent_commit_ = concurrent_commit_;
+    object.commit_concurrency_ = commit_concurrency_ ? commit_concurrency_->Clone(storage) : nullptr;
+    object.fan_out_databases_ = fan_out_databases_;
     return object;
   }
 };
@@ -2271,10 +2302,14 @@ class ProfileQuery : public memgraph::query::Query {
 
   /// The CypherQuery to profile.
   memgraph::query::CypherQuery *cypher_query_{nullptr};
+  /// Whether the hardware performance counters of each operator are reported,
+  /// set by `PROFILE WITH COUNTERS`.
+  bool with_counters_{false};
 
   ProfileQuery *Clone(AstStorage *storage) const override {
     ProfileQuery *object = storage->Create<ProfileQuery>();
     object->cypher_query_ = cypher_query_ ? cypher_query_->Clone(storage) : nullptr;
+    object->with_counters_ = with_counters_;
     return object;
   }
 
@@ -2381,6 +2416,40 @@ class PointIndexQuery : public memgraph::query::Query {
   friend class AstStorage;
 };
 
+class VectorIndexQuery : public memgraph::query::Query {
+ public:
+  static const utils::TypeInfo kType;
+  const utils::TypeInfo &GetTypeInfo() const override { return kType; }
+
+  enum class Action { CREATE, DROP };
+
+  VectorIndexQuery() = default;
+
+  DEFVISITABLE(QueryVisitor<void>);
+
+  memgraph::query::VectorIndexQuery::Action action_;
+  memgraph::query::LabelIx label_;
+  memgraph::query::PropertyIx property_;
+  /// Length of the indexed vectors, only set when creating the index.
+  uint64_t dimension_{0};
+
+  VectorIndexQuery *Clone(AstStorage *storage) const override {
+    VectorIndexQuery *object = storage->Create<VectorIndexQuery>();
+    object->action_ = action_;
+    object->label_ = storage->GetLabelIx(label_.name);
+    object->property_ = storage->GetPropertyIx(property_.name);
+    object->dimension_ = dimension_;
+    return object;
+  }
+
+ protected:
+  VectorIndexQuery(Action action, LabelIx label, PropertyIx property, uint64_t dimension)
+      : action_(action), label_(std::move(label)), property_(std::move(property)), dimension_(dimension) {}
+
+ private:
+  friend class AstStorage;
+};
+
 class TextIndexQuery : public memgraph::query::Query {
  public:
   static const utils::TypeInfo kType;
@@ -3164,7 +3233,7 @@ class SystemInfoQuery : public memgraph::query::Query {
   static const utils::TypeInfo kType;
   const utils::TypeInfo &GetTypeInfo() const override { return kType; }
 
-  enum class InfoType { STORAGE, BUILD, ACTIVE_USERS };
+  enum class InfoType { STORAGE, BUILD, ACTIVE_USERS, PROFILE };
 
   DEFVISITABLE(QueryVisitor<void>);
 
@@ -3591,6 +3660,8 @@ class StreamQuery : public memgraph::query::Query {
   memgraph::query::Expression *service_url_{nullptr};
   std::unordered_map<memgraph::query::Expression *, memgraph::query::Expression *> configs_;
   std::unordered_map<memgraph::query::Expression *, memgraph::query::Expression *> credentials_;
+  memgraph::query::Expression *workers_{nullptr};
+  memgraph::query::Expression *pipeline_depth_{nullptr};
 
   StreamQuery *Clone(AstStorage *storage) const override {
     StreamQuery *object = storage->Create<StreamQuery>();
@@ -3620,6 +3691,8 @@ class StreamQuery : public memgraph::query::Query {
     for (const auto &[key, value] : credentials_) {
       object->credentials_[key->Clone(storage)] = value->Clone(storage);
     }
+    object->workers_ = workers_ ? workers_->Clone(storage) : nullptr;
+    object->pipeline_depth_ = pipeline_depth_ ? pipeline_depth_->Clone(storage) : nullptr;
     return object;
   }
 
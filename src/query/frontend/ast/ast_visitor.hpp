@@ -85,6 +85,7 @@ class ProfileQuery;
 class IndexQuery;
 class EdgeIndexQuery;
 class PointIndexQuery;
+class VectorIndexQuery;
 class TextIndexQuery;
 class DatabaseInfoQuery;
 class SystemInfoQuery;
@@ -159,9 +160,10 @@ class ExpressionVisitor
 template <class TResult>
 class QueryVisitor
     : public utils::Visitor<TResult, CypherQuery, ExplainQuery, ProfileQuery, IndexQuery, EdgeIndexQuery,
-                            PointIndexQuery, TextIndexQuery, AuthQuery, DatabaseInfoQuery, SystemInfoQuery,
-                            ConstraintQuery, DumpQuery, ReplicationQuery, LockPathQuery, FreeMemoryQuery, TriggerQuery,
-                            IsolationLevelQuery, CreateSnapshotQuery, StreamQuery, SettingQuery, VersionQuery,
+                            PointIndexQuery, VectorIndexQuery, TextIndexQuery, AuthQuery, DatabaseInfoQuery,
+                            SystemInfoQuery, ConstraintQuery, DumpQuery, ReplicationQuery, LockPathQuery, FreeMemoryQuery,
+                            TriggerQuery, IsolationLevelQuery, CreateSnapshotQuery, StreamQuery, SettingQuery,
+                            VersionQuery,
                             ShowConfigQuery, TransactionQueueQuery, StorageModeQuery, AnalyzeGraphQuery,
                             MultiDatabaseQuery, ShowDatabasesQuery, EdgeImportModeQuery, CoordinatorQuery,
                             DropGraphQuery, CreateEnumQuery, ShowEnumsQuery, AlterEnumAddValueQuery,
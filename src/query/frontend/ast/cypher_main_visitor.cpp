@@ -101,10 +101,10 @@ antlrcpp::Any CypherMainVisitor::visitExplainQuery(MemgraphCypher::ExplainQueryC
 }
 
 antlrcpp::Any CypherMainVisitor::visitProfileQuery(MemgraphCypher::ProfileQueryContext *ctx) {
-  MG_ASSERT(ctx->children.size() == 2, "ProfileQuery should have exactly two children!");
-  auto *cypher_query = std::any_cast<CypherQuery *>(ctx->children[1]->accept(this));
+  auto *cypher_query = std::any_cast<CypherQuery *>(ctx->cypherQuery()->accept(this));
   auto *profile_query = storage_->Create<ProfileQuery>();
   profile_query->cypher_query_ = cypher_query;
+  profile_query->with_counters_ = ctx->COUNTERS() != nullptr;
   query_ = profile_query;
   return profile_query;
 }
@@ -153,6 +153,10 @@ antlrcpp::Any CypherMainVisitor::visitSystemInfoQuery(MemgraphCypher::SystemInfo
     info_query->info_type_ = SystemInfoQuery::InfoType::ACTIVE_USERS;
     return info_query;
   }
+  if (ctx->profileInfo()) {
+    info_query->info_type_ = SystemInfoQuery::InfoType::PROFILE;
+    return info_query;
+  }
   // Should never get here
   throw utils::NotYetImplemented("System info query: '{}'", ctx->getText());
 }
@@ -323,6 +327,13 @@ antlrcpp::Any CypherMainVisitor::visitPreQueryDirectives(MemgraphCypher::PreQuer
         throw SyntaxException("Hops limit can be set only once in the USING statement.");
       }
       pre_query_directives.hops_limit_ = std::any_cast<Expression *>(pre_query_directive->hopsLimit()->accept(this));
+    } else if (auto *fan_out_databases = pre_query_directive->fanOutDatabases()) {
+      if (!pre_query_directives.fan_out_databases_.empty()) {
+        throw SyntaxException("Databases can be set only once in the USING statement.");
+      }
+      for (auto *database_name : fan_out_databases->databaseName()) {
+        pre_query_directives.fan_out_databases_.emplace_back(std::any_cast<std::string>(database_name->accept(this)));
+      }
     } else {
       throw SyntaxException("Unknown pre query directive!");
     }
@@ -345,6 +356,13 @@ antlrcpp::Any CypherMainVisitor::visitPointIndexQuery(MemgraphCypher::PointIndex
   return point_index_query;
 }
 
+antlrcpp::Any CypherMainVisitor::visitVectorIndexQuery(MemgraphCypher::VectorIndexQueryContext *ctx) {
+  MG_ASSERT(ctx->children.size() == 1, "VectorIndexQuery should have exactly one child!");
+  auto *vector_index_query = std::any_cast<VectorIndexQuery *>(ctx->children[0]->accept(this));
+  query_ = vector_index_query;
+  return vector_index_query;
+}
+
 antlrcpp::Any CypherMainVisitor::visitTextIndexQuery(MemgraphCypher::TextIndexQueryContext *ctx) {
   MG_ASSERT(ctx->children.size() == 1, "TextIndexQuery should have exactly one child!");
   auto *text_index_query = std::any_cast<TextIndexQuery *>(ctx->children[0]->accept(this));
@@ -356,9 +374,8 @@ antlrcpp::Any CypherMainVisitor::visitCreateIndex(MemgraphCypher::CreateIndexCon
   auto *index_query = storage_->Create<IndexQuery>();
   index_query->action_ = IndexQuery::Action::CREATE;
   index_query->label_ = AddLabel(std::any_cast<std::string>(ctx->labelName()->accept(this)));
-  if (ctx->propertyKeyName()) {
-    auto name_key = std::any_cast<PropertyIx>(ctx->propertyKeyName()->accept(this));
-    index_query->properties_ = {name_key};
+  for (auto *property_key_name : ctx->propertyKeyName()) {
+    index_query->properties_.push_back(std::any_cast<PropertyIx>(property_key_name->accept(this)));
   }
   return index_query;
 }
@@ -366,9 +383,8 @@ antlrcpp::Any CypherMainVisitor::visitCreateIndex(MemgraphCypher::CreateIndexCon
 antlrcpp::Any CypherMainVisitor::visitDropIndex(MemgraphCypher::DropIndexContext *ctx) {
   auto *index_query = storage_->Create<IndexQuery>();
   index_query->action_ = IndexQuery::Action::DROP;
-  if (ctx->propertyKeyName()) {
-    auto key = std::any_cast<PropertyIx>(ctx->propertyKeyName()->accept(this));
-    index_query->properties_ = {key};
+  for (auto *property_key_name : ctx->propertyKeyName()) {
+    index_query->properties_.push_back(std::any_cast<PropertyIx>(property_key_name->accept(this)));
   }
   index_query->label_ = AddLabel(std::any_cast<std::string>(ctx->labelName()->accept(this)));
   return index_query;
@@ -419,6 +435,27 @@ antlrcpp::Any CypherMainVisitor::visitDropPointIndex(MemgraphCypher::DropPointIn
   return index_query;
 }
 
+antlrcpp::Any CypherMainVisitor::visitCreateVectorIndex(MemgraphCypher::CreateVectorIndexContext *ctx) {
+  auto *index_query = storage_->Create<VectorIndexQuery>();
+  index_query->action_ = VectorIndexQuery::Action::CREATE;
+  index_query->label_ = AddLabel(std::any_cast<std::string>(ctx->labelName()->accept(this)));
+  index_query->property_ = std::any_cast<PropertyIx>(ctx->propertyKeyName()->accept(this));
+  auto dimension = std::any_cast<int64_t>(ctx->dimension->accept(this));
+  if (dimension <= 0) {
+    throw SemanticException("Vector index dimension must be a positive integer.");
+  }
+  index_query->dimension_ = static_cast<uint64_t>(dimension);
+  return index_query;
+}
+
+antlrcpp::Any CypherMainVisitor::visitDropVectorIndex(MemgraphCypher::DropVectorIndexContext *ctx) {
+  auto *index_query = storage_->Create<VectorIndexQuery>();
+  index_query->action_ = VectorIndexQuery::Action::DROP;
+  index_query->label_ = AddLabel(std::any_cast<std::string>(ctx->labelName()->accept(this)));
+  index_query->property_ = std::any_cast<PropertyIx>(ctx->propertyKeyName()->accept(this));
+  return index_query;
+}
+
 antlrcpp::Any CypherMainVisitor::visitCreateTextIndex(MemgraphCypher::CreateTextIndexContext *ctx) {
   auto *index_query = storage_->Create<TextIndexQuery>();
   index_query->index_name_ = std::any_cast<std::string>(ctx->indexName()->accept(this));
@@ -900,7 +937,8 @@ std::string_view ToString(const CommonStreamConfigKey key) {
     __VA_ARGS__                                                      \
   };
 
-GENERATE_STREAM_CONFIG_KEY_ENUM(Kafka, TOPICS, CONSUMER_GROUP, BOOTSTRAP_SERVERS, CONFIGS, CREDENTIALS);
+GENERATE_STREAM_CONFIG_KEY_ENUM(Kafka, TOPICS, CONSUMER_GROUP, BOOTSTRAP_SERVERS, CONFIGS, CREDENTIALS, WORKERS,
+                                PIPELINE_DEPTH);
 
 std::string_view ToString(const KafkaConfigKey key) {
   switch (key) {
@@ -914,6 +952,10 @@ std::string_view ToString(const KafkaConfigKey key) {
       return "CONFIGS";
     case KafkaConfigKey::CREDENTIALS:
       return "CREDENTIALS";
+    case KafkaConfigKey::WORKERS:
+      return "WORKERS";
+    case KafkaConfigKey::PIPELINE_DEPTH:
+      return "PIPELINE_DEPTH";
   }
 }
 
@@ -957,6 +999,8 @@ antlrcpp::Any CypherMainVisitor::visitKafkaCreateStream(MemgraphCypher::KafkaCre
                                                                    stream_query->configs_);
   MapConfig<false, std::unordered_map<Expression *, Expression *>>(memory_, KafkaConfigKey::CREDENTIALS,
                                                                    stream_query->credentials_);
+  MapConfig<false, Expression *>(memory_, KafkaConfigKey::WORKERS, stream_query->workers_);
+  MapConfig<false, Expression *>(memory_, KafkaConfigKey::PIPELINE_DEPTH, stream_query->pipeline_depth_);
 
   MapCommonStreamConfigs(memory_, *stream_query);
 
@@ -1021,6 +1065,26 @@ antlrcpp::Any CypherMainVisitor::visitKafkaCreateStreamConfig(MemgraphCypher::Ka
     return {};
   }
 
+  if (ctx->WORKERS()) {
+    ThrowIfExists(memory_, KafkaConfigKey::WORKERS);
+    if (!ctx->workers->numberLiteral() || !ctx->workers->numberLiteral()->integerLiteral()) {
+      throw SemanticException("Workers must be an integer literal!");
+    }
+    static constexpr auto workers_key = static_cast<uint8_t>(KafkaConfigKey::WORKERS);
+    memory_[workers_key] = std::any_cast<Expression *>(ctx->workers->accept(this));
+    return {};
+  }
+
+  if (ctx->PIPELINE_DEPTH()) {
+    ThrowIfExists(memory_, KafkaConfigKey::PIPELINE_DEPTH);
+    if (!ctx->pipelineDepth->numberLiteral() || !ctx->pipelineDepth->numberLiteral()->integerLiteral()) {
+      throw SemanticException("Pipeline depth must be an integer literal!");
+    }
+    static constexpr auto pipeline_depth_key = static_cast<uint8_t>(KafkaConfigKey::PIPELINE_DEPTH);
+    memory_[pipeline_depth_key] = std::any_cast<Expression *>(ctx->pipelineDepth->accept(this));
+    return {};
+  }
+
   MG_ASSERT(ctx->BOOTSTRAP_SERVERS());
   ThrowIfExists(memory_, KafkaConfigKey::BOOTSTRAP_SERVERS);
   if (!ctx->bootstrapServers->StringLiteral()) {
@@ -2368,10 +2432,10 @@ antlrcpp::Any CypherMainVisitor::visitRelationshipPattern(MemgraphCypher::Relati
   auto relationshipLambdas = relationshipDetail->relationshipLambda();
   if (variableExpansion) {
     if (relationshipDetail->total_weight && edge->type_ != EdgeAtom::Type::WEIGHTED_SHORTEST_PATH &&
-        edge->type_ != EdgeAtom::Type::ALL_SHORTEST_PATHS)
+        edge->type_ != EdgeAtom::Type::ALL_SHORTEST_PATHS && edge->type_ != EdgeAtom::Type::K_SHORTEST_PATHS)
       throw SemanticException(
-          "Variable for total weight is allowed only with weighted and all shortest "
-          "path expansion.");
+          "Variable for total weight is allowed only with weighted, all and k shortest "
+          "paths expansion.");
     auto visit_lambda = [this](auto *lambda) {
       EdgeAtom::Lambda edge_lambda;
       auto traversed_edge_variable = std::any_cast<std::string>(lambda->traversed_edge->accept(this));
@@ -2408,6 +2472,8 @@ antlrcpp::Any CypherMainVisitor::visitRelationshipPattern(MemgraphCypher::Relati
           throw SemanticException(
               "Lambda for calculating weights is mandatory with all "
               "shortest paths expansion.");
+        else if (edge->type_ == EdgeAtom::Type::K_SHORTEST_PATHS)
+          throw SemanticException("Lambda for calculating weights is mandatory with k shortest paths expansion.");
         // In variable expansion inner variables are mandatory.
         anonymous_identifiers.push_back(&edge->filter_lambda_.inner_edge);
         anonymous_identifiers.push_back(&edge->filter_lambda_.inner_node);
@@ -2423,9 +2489,9 @@ antlrcpp::Any CypherMainVisitor::visitRelationshipPattern(MemgraphCypher::Relati
         break;
       case 1:
         if (edge->type_ == EdgeAtom::Type::WEIGHTED_SHORTEST_PATH ||
-            edge->type_ == EdgeAtom::Type::ALL_SHORTEST_PATHS) {
-          // For wShortest and allShortest, the first (and required) lambda is
-          // used for weight calculation.
+            edge->type_ == EdgeAtom::Type::ALL_SHORTEST_PATHS || edge->type_ == EdgeAtom::Type::K_SHORTEST_PATHS) {
+          // For wShortest, allShortest and kShortest, the first (and required)
+          // lambda is used for weight calculation.
           edge->weight_lambda_ = visit_lambda(relationshipLambdas[0]);
           visit_total_weight();
           // Add mandatory inner variables for filter lambda.
@@ -2449,11 +2515,29 @@ antlrcpp::Any CypherMainVisitor::visitRelationshipPattern(MemgraphCypher::Relati
         }
         break;
       case 2:
-        if (edge->type_ != EdgeAtom::Type::WEIGHTED_SHORTEST_PATH && edge->type_ != EdgeAtom::Type::ALL_SHORTEST_PATHS)
+        if (edge->type_ != EdgeAtom::Type::WEIGHTED_SHORTEST_PATH &&
+            edge->type_ != EdgeAtom::Type::ALL_SHORTEST_PATHS && edge->type_ != EdgeAtom::Type::K_SHORTEST_PATHS)
           throw SemanticException("Only one filter lambda can be supplied.");
         edge->weight_lambda_ = visit_lambda(relationshipLambdas[0]);
         visit_total_weight();
         edge->filter_lambda_ = visit_lambda(relationshipLambdas[1]);
+        // The paths are searched from each node on the previous path, so
+        // there is no single accumulated path.
+        if (edge->type_ == EdgeAtom::Type::K_SHORTEST_PATHS && edge->filter_lambda_.accumulated_path) {
+          throw SemanticException("Accumulated path can't be used with k shortest paths expansion.");
+        }
+        break;
+      case 3:
+        // The third lambda estimates the weight of the rest of the path.
+        if (edge->type_ != EdgeAtom::Type::WEIGHTED_SHORTEST_PATH)
+          throw SemanticException("Heuristic lambda can be used only with weighted shortest path expansion.");
+        edge->weight_lambda_ = visit_lambda(relationshipLambdas[0]);
+        visit_total_weight();
+        edge->filter_lambda_ = visit_lambda(relationshipLambdas[1]);
+        edge->heuristic_lambda_ = visit_lambda(relationshipLambdas[2]);
+        if (edge->heuristic_lambda_.accumulated_path) {
+          throw SemanticException("Heuristic lambda can't use the accumulated path.");
+        }
         break;
       default:
         throw SemanticException("Only one filter lambda can be supplied.");
@@ -2510,6 +2594,8 @@ antlrcpp::Any CypherMainVisitor::visitVariableExpansion(MemgraphCypher::Variable
     edge_type = EdgeAtom::Type::WEIGHTED_SHORTEST_PATH;
   else if (!ctx->getTokens(MemgraphCypher::ALLSHORTEST).empty())
     edge_type = EdgeAtom::Type::ALL_SHORTEST_PATHS;
+  else if (!ctx->getTokens(MemgraphCypher::KSHORTEST).empty())
+    edge_type = EdgeAtom::Type::K_SHORTEST_PATHS;
   Expression *lower = nullptr;
   Expression *upper = nullptr;
 
@@ -2520,7 +2606,8 @@ antlrcpp::Any CypherMainVisitor::visitVariableExpansion(MemgraphCypher::Variable
     auto *bound = std::any_cast<Expression *>(ctx->expression()[0]->accept(this));
     if (!dots_tokens.size()) {
       // Case -[*bound]-
-      if (edge_type != EdgeAtom::Type::WEIGHTED_SHORTEST_PATH && edge_type != EdgeAtom::Type::ALL_SHORTEST_PATHS)
+      if (edge_type != EdgeAtom::Type::WEIGHTED_SHORTEST_PATH && edge_type != EdgeAtom::Type::ALL_SHORTEST_PATHS &&
+          edge_type != EdgeAtom::Type::K_SHORTEST_PATHS)
         lower = bound;
       upper = bound;
     } else if (dots_tokens[0]->getSourceInterval().startsAfter(ctx->expression()[0]->getSourceInterval())) {
@@ -2535,8 +2622,9 @@ antlrcpp::Any CypherMainVisitor::visitVariableExpansion(MemgraphCypher::Variable
     lower = std::any_cast<Expression *>(ctx->expression()[0]->accept(this));
     upper = std::any_cast<Expression *>(ctx->expression()[1]->accept(this));
   }
-  if (lower && (edge_type == EdgeAtom::Type::WEIGHTED_SHORTEST_PATH || edge_type == EdgeAtom::Type::ALL_SHORTEST_PATHS))
-    throw SemanticException("Lower bound is not allowed in weighted or all shortest path expansion.");
+  if (lower && (edge_type == EdgeAtom::Type::WEIGHTED_SHORTEST_PATH ||
+                edge_type == EdgeAtom::Type::ALL_SHORTEST_PATHS || edge_type == EdgeAtom::Type::K_SHORTEST_PATHS))
+    throw SemanticException("Lower bound is not allowed in weighted, all or k shortest paths expansion.");
 
   return std::make_tuple(edge_type, lower, upper);
 }
@@ -3215,6 +3303,16 @@ antlrcpp::Any CypherMainVisitor::visitCallSubquery(MemgraphCypher::CallSubqueryC
     }
     pre_query_directives.commit_frequency_ = std::any_cast<Expression *>(periodic_commit_number->accept(this));
 
+    if (periodic_commit->CONCURRENT()) {
+      pre_query_directives.concurrent_commit_ = true;
+      if (auto *concurrency = periodic_commit->concurrency) {
+        if (!concurrency->numberLiteral() || !concurrency->numberLiteral()->integerLiteral()) {
+          throw SyntaxException("Number of concurrent transactions should be an integer.");
+        }
+        pre_query_directives.commit_concurrency_ = std::any_cast<Expression *>(concurrency->accept(this));
+      }
+    }
+
     call_subquery->cypher_query_->pre_query_directives_ = pre_query_directives;
   }
 
@@ -47,6 +47,8 @@ memgraphCypherKeyword : cypherKeyword
                       | CONFIGS
                       | CONSUMER_GROUP
                       | COORDINATOR
+                      | CONCURRENT
+                      | COUNTERS
                       | CREATE_DELETE
                       | CREDENTIALS
                       | CSV
@@ -58,6 +60,7 @@ memgraphCypherKeyword : cypherKeyword
                       | DELIMITER
                       | DEMOTE
                       | DENY
+                      | DIMENSION
                       | DIRECTORY
                       | DISABLE
                       | DO
@@ -123,6 +126,7 @@ memgraphCypherKeyword : cypherKeyword
                       | ON_DISK_TRANSACTIONAL
                       | PASSWORD
                       | PERIODIC
+                      | PIPELINE_DEPTH
                       | POINT
                       | PORT
                       | PRIVILEGES
@@ -183,8 +187,10 @@ memgraphCypherKeyword : cypherKeyword
                       | USING
                       | VALUE
                       | VALUES
+                      | VECTOR
                       | VERSION
                       | WEBSOCKET
+                      | WORKERS
                       | ZONEDDATETIME
                       ;
 
@@ -197,6 +203,7 @@ query : cypherQuery
       | indexQuery
       | edgeIndexQuery
       | pointIndexQuery
+      | vectorIndexQuery
       | textIndexQuery
       | explainQuery
       | profileQuery
@@ -236,6 +243,8 @@ query : cypherQuery
 
 cypherQuery : ( preQueryDirectives )? singleQuery ( cypherUnion )* ( queryMemoryLimit )? ;
 
+profileQuery : PROFILE ( WITH COUNTERS )? cypherQuery ;
+
 authQuery : createRole
           | dropRole
           | showRoles
@@ -308,7 +317,7 @@ foreach :  FOREACH '(' variable IN expression '|' updateClause+  ')' ;
 
 preQueryDirectives: USING preQueryDirective ( ',' preQueryDirective )* ;
 
-preQueryDirective: hopsLimit | indexHints  | periodicCommit ;
+preQueryDirective: hopsLimit | indexHints  | periodicCommit | fanOutDatabases ;
 
 hopsLimit: HOPS LIMIT literal ;
 
@@ -318,7 +327,9 @@ indexHint: ':' labelName ( '(' propertyKeyName ')' )? ;
 
 periodicCommit : PERIODIC COMMIT periodicCommitNumber=literal ;
 
-periodicSubquery : IN TRANSACTIONS OF_TOKEN periodicCommitNumber=literal ROWS ;
+fanOutDatabases : DATABASES databaseName ( ',' databaseName )* ;
+
+periodicSubquery : IN ( concurrency=literal? CONCURRENT )? TRANSACTIONS OF_TOKEN periodicCommitNumber=literal ROWS ;
 
 callSubquery : CALL '{' cypherQuery '}' ( periodicSubquery )? ;
 
@@ -562,6 +573,8 @@ kafkaCreateStreamConfig : TOPICS topicNames
                         | BOOTSTRAP_SERVERS bootstrapServers=literal
                         | CONFIGS configsMap=configMap
                         | CREDENTIALS credentialsMap=configMap
+                        | WORKERS workers=literal
+                        | PIPELINE_DEPTH pipelineDepth=literal
                         | commonCreateStreamConfig
                         ;
 
@@ -645,6 +658,12 @@ dropPointIndex : DROP POINT INDEX ON ':' labelName '(' propertyKeyName ')' ;
 
 pointIndexQuery : createPointIndex | dropPointIndex ;
 
+createVectorIndex : CREATE VECTOR INDEX ON ':' labelName '(' propertyKeyName ')' WITH DIMENSION dimension=integerLiteral ;
+
+dropVectorIndex : DROP VECTOR INDEX ON ':' labelName '(' propertyKeyName ')' ;
+
+vectorIndexQuery : createVectorIndex | dropVectorIndex ;
+
 dropGraphQuery : DROP GRAPH ;
 
 enumName : symbolicName ;
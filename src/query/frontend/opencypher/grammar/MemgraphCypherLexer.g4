@@ -45,10 +45,12 @@ CLEAR                   : C L E A R ;
 CLUSTER                 : C L U S T E R;
 COMMIT                  : C O M M I T ;
 COMMITTED               : C O M M I T T E D ;
+CONCURRENT              : C O N C U R R E N T ;
 CONFIG                  : C O N F I G ;
 CONFIGS                 : C O N F I G S;
 CONSUMER_GROUP          : C O N S U M E R UNDERSCORE G R O U P ;
 COORDINATOR             : C O O R D I N A T O R ;
+COUNTERS                : C O U N T E R S ;
 CREATE_DELETE           : C R E A T E UNDERSCORE D E L E T E ;
 CREDENTIALS             : C R E D E N T I A L S ;
 CSV                     : C S V ;
@@ -60,6 +62,7 @@ DATE                    : D A T E ;
 DELIMITER               : D E L I M I T E R ;
 DEMOTE                  : D E M O T E;
 DENY                    : D E N Y ;
+DIMENSION               : D I M E N S I O N ;
 DIRECTORY               : D I R E C T O R Y ;
 DISABLE                 : D I S A B L E ;
 DO                      : D O ;
@@ -125,6 +128,7 @@ OFF                     : O F F ;
 ON_DISK_TRANSACTIONAL   : O N UNDERSCORE D I S K UNDERSCORE T R A N S A C T I O N A L ;
 PASSWORD                : P A S S W O R D ;
 PERIODIC                : P E R I O D I C ;
+PIPELINE_DEPTH          : P I P E L I N E UNDERSCORE D E P T H ;
 POINT                   : P O I N T ;
 PORT                    : P O R T ;
 PRIVILEGES              : P R I V I L E G E S ;
@@ -184,6 +188,8 @@ USERS                   : U S E R S ;
 USING                   : U S I N G ;
 VALUE                   : V A L U E ;
 VALUES                  : V A L U E S ;
+VECTOR                  : V E C T O R ;
 VERSION                 : V E R S I O N ;
 WEBSOCKET               : W E B S O C K E T ;
+WORKERS                 : W O R K E R S ;
 ZONEDDATETIME           : Z O N E D D A T E T I M E ;
@@ -11,6 +11,7 @@
 
 #include "query/frontend/stripped.hpp"
 
+#include <bit>
 #include <cctype>
 #include <cstdint>
 #include <span>
@@ -28,46 +29,108 @@
 #include "utils/logging.hpp"
 #include "utils/string.hpp"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 namespace memgraph::query::frontend {
 
 using namespace lexer_constants;
 
-StrippedQuery::StrippedQuery(std::string query) : original_(std::move(query)) {
-  enum class Token {
-    UNMATCHED,
-    KEYWORD,  // Including true, false and null.
-    SPECIAL,  // +, .., +=, (, { and so on.
-    STRING,
-    INT,  // Decimal, octal and hexadecimal.
-    REAL,
-    PARAMETER,
-    ESCAPED_NAME,
-    UNESCAPED_NAME,
-    SPACE
-  };
+namespace {
+
+// Classes of ASCII characters whose runs `Skip` passes over. Each class has
+// the same ASCII members as the corresponding lexer constant.
+struct NameParts {
+  static bool Contains(unsigned char c) {
+    return ('0' <= c && c <= '9') || ('a' <= (c | 0x20) && (c | 0x20) <= 'z') || c == '_';
+  }
+#if defined(__SSE2__)
+  static __m128i Contains(__m128i chunk);
+#endif
+};
+
+struct Spaces {
+  static bool Contains(unsigned char c) { return ('\t' <= c && c <= '\r') || (0x1c <= c && c <= ' '); }
+#if defined(__SSE2__)
+  static __m128i Contains(__m128i chunk);
+#endif
+};
+
+struct Digits {
+  static bool Contains(unsigned char c) { return '0' <= c && c <= '9'; }
+#if defined(__SSE2__)
+  static __m128i Contains(__m128i chunk);
+#endif
+};
+
+bool IsNameStart(unsigned char c) { return ('a' <= (c | 0x20) && (c | 0x20) <= 'z') || c == '_'; }
+
+#if defined(__SSE2__)
+// Byte mask of the lanes of `chunk` within [lo, hi]. Bytes of multibyte UTF-8
+// symbols are negative, so they never are within an ASCII range.
+__m128i InRange(__m128i chunk, char lo, char hi) {
+  return _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8(static_cast<char>(lo - 1))),
+                       _mm_cmplt_epi8(chunk, _mm_set1_epi8(static_cast<char>(hi + 1))));
+}
+
+__m128i NameParts::Contains(__m128i chunk) {
+  const auto lowercase = _mm_or_si128(chunk, _mm_set1_epi8(0x20));
+  return _mm_or_si128(_mm_or_si128(InRange(chunk, '0', '9'), InRange(lowercase, 'a', 'z')),
+                      _mm_cmpeq_epi8(chunk, _mm_set1_epi8('_')));
+}
+
+__m128i Spaces::Contains(__m128i chunk) { return _mm_or_si128(InRange(chunk, '\t', '\r'), InRange(chunk, 0x1c, ' ')); }
+
+__m128i Digits::Contains(__m128i chunk) { return InRange(chunk, '0', '9'); }
+#endif
+
+// Returns the position of the first character from `pos` on which isn't in `TClass`.
+template <class TClass>
+int Skip(const std::string &s, int pos) {
+  const int size = s.size();
+#if defined(__SSE2__)
+  for (; pos + 16 <= size; pos += 16) {
+    const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s.data() + pos));
+    const auto others = ~static_cast<unsigned>(_mm_movemask_epi8(TClass::Contains(chunk))) & 0xffffU;
+    if (others != 0) return pos + std::countr_zero(others);
+  }
+#endif
+  while (pos < size && TClass::Contains(static_cast<unsigned char>(s[pos]))) ++pos;
+  return pos;
+}
+
+// Returns the first `quote`, backslash or NUL character in [p, end]. `*end`
+// must be NUL.
+const char *FindStringSpecial(const char *p, const char *end, char quote) {
+#if defined(__SSE2__)
+  const auto quotes = _mm_set1_epi8(quote);
+  const auto backslashes = _mm_set1_epi8('\\');
+  const auto zeros = _mm_setzero_si128();
+  for (; p + 16 <= end; p += 16) {
+    const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    const auto specials = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, quotes), _mm_cmpeq_epi8(chunk, backslashes)),
+                                       _mm_cmpeq_epi8(chunk, zeros));
+    const auto mask = static_cast<unsigned>(_mm_movemask_epi8(specials));
+    if (mask != 0) return p + std::countr_zero(mask);
+  }
+#endif
+  while (*p && *p != quote && *p != '\\') ++p;
+  return p;
+}
+
+bool IsEscapedCharacter(char c) {
+  return c == '\\' || c == '\'' || c == '"' || c == 'B' || c == 'b' || c == 'F' || c == 'f' || c == 'N' || c == 'n' ||
+         c == 'R' || c == 'r' || c == 'T' || c == 't';
+}
+
+}  // namespace
 
+StrippedQuery::StrippedQuery(std::string query, Lexer lexer) : original_(std::move(query)) {
   std::vector<std::pair<Token, std::string>> tokens;
   std::string unstripped_chunk;
   for (int i = 0; i < static_cast<int>(original_.size());) {
-    Token token = Token::UNMATCHED;
-    int len = 0;
-    auto update = [&](int new_len, Token new_token) {
-      if (new_len > len) {
-        len = new_len;
-        token = new_token;
-      }
-    };
-    update(MatchKeyword(i), Token::KEYWORD);
-    update(MatchSpecial(i), Token::SPECIAL);
-    update(MatchString(i), Token::STRING);
-    update(MatchDecimalInt(i), Token::INT);
-    update(MatchOctalInt(i), Token::INT);
-    update(MatchHexadecimalInt(i), Token::INT);
-    update(MatchReal(i), Token::REAL);
-    update(MatchParameter(i), Token::PARAMETER);
-    update(MatchEscapedName(i), Token::ESCAPED_NAME);
-    update(MatchUnescapedName(i), Token::UNESCAPED_NAME);
-    update(MatchWhitespaceAndComments(i), Token::SPACE);
+    auto [token, len] = lexer == Lexer::SIMD ? ScanToken(i) : MatchToken(i);
     if (token == Token::UNMATCHED) throw LexingException("Invalid query.");
     tokens.emplace_back(token, original_.substr(i, len));
     i += len;
@@ -315,6 +378,63 @@ std::pair<int, int> GetFirstUtf8SymbolCodepoint(const char *_s) {
   throw LexingException("Invalid character.");
 }
 
+std::pair<StrippedQuery::Token, int> StrippedQuery::MatchToken(int start) const {
+  Token token = Token::UNMATCHED;
+  int len = 0;
+  auto update = [&](int new_len, Token new_token) {
+    if (new_len > len) {
+      len = new_len;
+      token = new_token;
+    }
+  };
+  update(MatchKeyword(start), Token::KEYWORD);
+  update(MatchSpecial(start), Token::SPECIAL);
+  update(MatchString(start), Token::STRING);
+  update(MatchDecimalInt(start), Token::INT);
+  update(MatchOctalInt(start), Token::INT);
+  update(MatchHexadecimalInt(start), Token::INT);
+  update(MatchReal(start), Token::REAL);
+  update(MatchParameter(start), Token::PARAMETER);
+  update(MatchEscapedName(start), Token::ESCAPED_NAME);
+  update(MatchUnescapedName(start), Token::UNESCAPED_NAME);
+  update(MatchWhitespaceAndComments(start), Token::SPACE);
+  return {token, len};
+}
+
+std::pair<StrippedQuery::Token, int> StrippedQuery::ScanToken(int start) const {
+  const auto c = static_cast<unsigned char>(original_[start]);
+  if (IsNameStart(c)) {
+    // Only a keyword or a name start with a letter. Keywords consist of name
+    // characters, so the name is at least as long as the keyword and a
+    // keyword wins a tie.
+    const auto len = ScanUnescapedName(start);
+    return {MatchKeyword(start) == len ? Token::KEYWORD : Token::UNESCAPED_NAME, len};
+  }
+  if (Digits::Contains(c)) {
+    Token token = Token::INT;
+    int len = ScanDecimalInt(start);
+    auto update = [&](int new_len, Token new_token) {
+      if (new_len > len) {
+        len = new_len;
+        token = new_token;
+      }
+    };
+    update(MatchOctalInt(start), Token::INT);
+    update(MatchHexadecimalInt(start), Token::INT);
+    update(MatchReal(start), Token::REAL);
+    return {token, len};
+  }
+  if (c == '"' || c == '\'') {
+    if (auto len = ScanString(start)) return {Token::STRING, len};
+  } else if (Spaces::Contains(c)) {
+    // Comments and non-ASCII whitespace are left to the table lexer.
+    const auto end = Skip<Spaces>(original_, start + 1);
+    const auto next = static_cast<unsigned char>(original_[end]);
+    if (end == static_cast<int>(original_.size()) || (next < 0x80 && next != '/')) return {Token::SPACE, end - start};
+  }
+  return MatchToken(start);
+}
+
 // From here until end of file there are functions that calculate matches for
 // every possible token. Functions are more or less compatible with Cypher.g4
 // grammar. Unfortunately, they contain a lof of special cases and shouldn't
@@ -340,8 +460,7 @@ int StrippedQuery::MatchString(int start) const {
     if (*p == start_char) return p - (original_.data() + start) + 1;
     if (*p == '\\') {
       ++p;
-      if (*p == '\\' || *p == '\'' || *p == '"' || *p == 'B' || *p == 'b' || *p == 'F' || *p == 'f' || *p == 'N' ||
-          *p == 'n' || *p == 'R' || *p == 'r' || *p == 'T' || *p == 't') {
+      if (IsEscapedCharacter(*p)) {
         // Allowed escaped characters.
         continue;
       } else if (*p == 'U' || *p == 'u') {
@@ -532,4 +651,45 @@ int StrippedQuery::MatchWhitespaceAndComments(int start) const {
   return i - start;
 }
 
+int StrippedQuery::ScanString(int start) const {
+  const char quote = original_[start];
+  const auto *begin = original_.data() + start;
+  const auto *end = original_.data() + original_.size();
+  for (const auto *p = FindStringSpecial(begin + 1, end, quote); *p; p = FindStringSpecial(p + 1, end, quote)) {
+    if (*p == quote) return p - begin + 1;
+    // A backslash, the escape is checked the same way as in `MatchString`.
+    ++p;
+    if (IsEscapedCharacter(*p)) continue;
+    if (*p != 'U' && *p != 'u') return 0;
+    int cnt = 0;
+    const auto *r = p + 1;
+    while (isxdigit(*r) && cnt < 8) {
+      ++cnt;
+      ++r;
+    }
+    if (!*r) return 0;
+    if (cnt < 4) return 0;
+    p += cnt < 8 ? 4 : 8;
+  }
+  return 0;
+}
+
+int StrippedQuery::ScanDecimalInt(int start) const {
+  if (original_[start] == '0') return 1;
+  return Skip<Digits>(original_, start) - start;
+}
+
+int StrippedQuery::ScanUnescapedName(int start) const {
+  // The first character is an ASCII name start, checked by `ScanToken`.
+  auto i = Skip<NameParts>(original_, start + 1);
+  while (i < static_cast<int>(original_.size())) {
+    auto got = GetFirstUtf8SymbolCodepoint(original_.data() + i);
+    if (got.first >= lexer_constants::kBitsetSize || !kUnescapedNameAllowedParts[got.first]) {
+      break;
+    }
+    i = Skip<NameParts>(original_, i + got.second);
+  }
+  return i - start;
+}
+
 }  // namespace memgraph::query::frontend
@@ -11,8 +11,10 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 #include "query/parameters.hpp"
 #include "utils/fnv.hpp"
@@ -34,13 +36,23 @@ const std::string kStrippedBooleanToken = "true";
  */
 class StrippedQuery {
  public:
+  /**
+   * Ways of splitting the query into tokens, both give the same tokens.
+   * TABLE tries every token matcher at each position and takes the longest
+   * match. SIMD picks the matchers by the first character of the token and
+   * skips over runs of name, whitespace, digit and string characters 16 bytes
+   * at a time, falling back to TABLE for the rest.
+   */
+  enum class Lexer : uint8_t { TABLE, SIMD };
+
   /**
    * Strips the input query and stores stripped query, stripped arguments and
    * stripped query hash.
    *
    * @param query Input query.
+   * @param lexer Lexer used to split the query into tokens.
    */
-  explicit StrippedQuery(std::string query);
+  explicit StrippedQuery(std::string query, Lexer lexer = Lexer::SIMD);
 
   /**
    * Copy constructor is deleted because we don't want to make unnecessary
@@ -64,6 +76,25 @@ class StrippedQuery {
   uint64_t hash() const { return hash_; }
 
  private:
+  enum class Token {
+    UNMATCHED,
+    KEYWORD,  // Including true, false and null.
+    SPECIAL,  // +, .., +=, (, { and so on.
+    STRING,
+    INT,  // Decimal, octal and hexadecimal.
+    REAL,
+    PARAMETER,
+    ESCAPED_NAME,
+    UNESCAPED_NAME,
+    SPACE
+  };
+
+  // Return the longest token starting at `start` and its length.
+  std::pair<Token, int> MatchToken(int start) const;
+  // Same as `MatchToken`, but tries only the matchers which can match the
+  // first character.
+  std::pair<Token, int> ScanToken(int start) const;
+
   // Return len of matched keyword if something is matched, otherwise 0.
   int MatchKeyword(int start) const;
   int MatchString(int start) const;
@@ -77,6 +108,11 @@ class StrippedQuery {
   int MatchUnescapedName(int start) const;
   int MatchWhitespaceAndComments(int start) const;
 
+  // Vectorized versions of the matchers above, used by `ScanToken`.
+  int ScanString(int start) const;
+  int ScanDecimalInt(int start) const;
+  int ScanUnescapedName(int start) const;
+
   // Original query.
   std::string original_;
 
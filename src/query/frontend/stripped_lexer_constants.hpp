@@ -122,11 +122,13 @@ const trie::Trie kKeywords = {"active",
                               "comitted",
                               "config",
                               "configs",
+                              "concurrent",
                               "constraint",
                               "consumer_group",
                               "contains",
                               "coordinator",
                               "count",
+                              "counters",
                               "create_delete",
                               "create",
                               "credentials",
@@ -141,6 +143,7 @@ const trie::Trie kKeywords = {"active",
                               "demote",
                               "demote",
                               "deny",
+                              "dimension",
                               "desc",
                               "descending",
                               "detach",
@@ -233,6 +236,7 @@ const trie::Trie kKeywords = {"active",
                               "or",
                               "order",
                               "password",
+                              "pipeline_depth",
                               "point",
                               "port",
                               "privileges",
@@ -307,11 +311,13 @@ const trie::Trie kKeywords = {"active",
                               "using",
                               "value",
                               "values",
+                              "vector",
                               "version",
                               "websocket",
                               "when",
                               "where",
                               "with",
+                              "workers",
                               "xor",
                               "yield",
                               "zoneddatetime"};
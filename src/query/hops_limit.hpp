@@ -11,30 +11,112 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <memory>
 #include <optional>
 
 namespace memgraph::query {
 
+/// Hops left to a query once its expansions run on several threads. Each
+/// thread reserves the hops in blocks and counts its expansions against its
+/// block, so the threads only touch the pool once per block. A thread runs
+/// out of hops while the others may still hold some in their blocks, so the
+/// limit is reached up to a block per thread early.
+class SharedHopsLimit {
+ public:
+  explicit SharedHopsLimit(int64_t hops) : left_(hops) {}
+
+  /// Reserves up to @p hops, returns how many of them were left. Nothing is
+  /// left once a thread reached the limit.
+  int64_t Reserve(int64_t hops) {
+    if (IsLimitReached()) return 0;
+    auto left = left_.load(std::memory_order_acquire);
+    while (left > 0) {
+      auto const reserved = std::min(left, hops);
+      if (left_.compare_exchange_weak(left, left - reserved, std::memory_order_acq_rel)) return reserved;
+    }
+    return 0;
+  }
+
+  /// Returns the reserved hops which weren't expanded to the pool.
+  void Release(int64_t hops) { left_.fetch_add(hops, std::memory_order_acq_rel); }
+
+  void SetLimitReached() { limit_reached_.store(true, std::memory_order_release); }
+
+  bool IsLimitReached() const { return limit_reached_.load(std::memory_order_acquire); }
+
+ private:
+  std::atomic<int64_t> left_;
+  std::atomic<bool> limit_reached_{false};
+};
+
 struct HopsLimit {
+  /// Hops a thread reserves from the shared pool at once.
+  static constexpr int64_t kSharedReservation = 1024;
+
   std::optional<int64_t> limit;
   int64_t hops_counter{0};
   bool limit_reached{false};
+  /// Pool the hops are reserved from once the expansions run on several
+  /// threads, `limit` is then the end of the hops reserved so far.
+  std::shared_ptr<SharedHopsLimit> shared;
 
   bool IsUsed() const { return limit.has_value(); }
 
   int64_t GetLimit() const { return *limit; }
 
-  bool IsLimitReached() const { return limit_reached; }
+  bool IsLimitReached() const { return limit_reached || (shared && shared->IsLimitReached()); }
 
   int64_t LeftHops() const { return *limit - hops_counter; }
 
   void IncrementHopsCount(int64_t increment) {
     if (limit.has_value()) {
       hops_counter += increment;
+      if (hops_counter > *limit && shared) Reserve(hops_counter - *limit);
       limit_reached = hops_counter > *limit;
+      if (limit_reached && shared) shared->SetLimitReached();
     }
   }
+
+  /// Counts up to @p hops more hops and returns how many of them fit into the
+  /// limit. The limit is reached if none of them do.
+  int64_t TakeHops(int64_t hops) {
+    if (hops > LeftHops() && shared) Reserve(hops - LeftHops());
+    auto const taken = std::clamp<int64_t>(LeftHops(), 0, hops);
+    if (taken == 0 && hops > 0) {
+      limit_reached = true;
+      if (shared) shared->SetLimitReached();
+    }
+    hops_counter += taken;
+    return taken;
+  }
+
+  /// Returns the limit of a worker thread, which takes its hops from the same
+  /// pool as this limit. The first call moves the hops left to this limit
+  /// into the pool, so it has to be made before the workers start.
+  HopsLimit ForWorker() {
+    if (!limit) return {};
+    if (!shared) {
+      shared = std::make_shared<SharedHopsLimit>(std::max<int64_t>(LeftHops(), 0));
+      if (limit_reached) shared->SetLimitReached();
+      limit = std::min(*limit, hops_counter);
+    }
+    return HopsLimit{.limit = 0, .shared = shared};
+  }
+
+  /// Returns the reserved hops which weren't expanded to the pool, once the
+  /// thread is done expanding.
+  void ReleaseReservation() {
+    if (shared && LeftHops() > 0) {
+      shared->Release(LeftHops());
+      limit = hops_counter;
+    }
+  }
+
+ private:
+  void Reserve(int64_t hops) { *limit += shared->Reserve(std::max(hops, kSharedReservation)); }
 };
 
 }  // namespace memgraph::query
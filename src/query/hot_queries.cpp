@@ -0,0 +1,70 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/hot_queries.hpp"
+
+#include <exception>
+
+#include <spdlog/spdlog.h>
+
+#include "dbms/dbms_handler.hpp"
+#include "query/cypher_query_interpreter.hpp"
+#include "query/db_accessor.hpp"
+#include "query/fingerprint_metrics.hpp"
+#include "query/frontend/stripped.hpp"
+#include "query/interpreter_context.hpp"
+#include "utils/typeinfo.hpp"
+
+namespace memgraph::query {
+
+std::vector<std::string> MostExecutedQueries(size_t count) {
+  std::vector<std::string> queries;
+  if (count == 0) return queries;
+  for (auto &fingerprint : GlobalQueryFingerprintMetrics().Fingerprints()) {
+    if (queries.size() == count) break;
+    queries.push_back(std::move(fingerprint.query));
+  }
+  return queries;
+}
+
+HotQueries &GlobalHotQueries() {
+  static HotQueries hot_queries;
+  return hot_queries;
+}
+
+size_t PrewarmPlanCaches(InterpreterContext *interpreter_context, const std::vector<std::string> &queries) {
+  size_t planned = 0;
+  interpreter_context->dbms_handler->ForEachLoaded([&](dbms::DatabaseAccess db_acc) {
+    auto storage_accessor = db_acc->Access();
+    DbAccessor dba(storage_accessor.get());
+    for (const auto &query_string : queries) {
+      try {
+        // The texts are stripped already, only the parameters of the user are left to fill in
+        UserParameters user_parameters;
+        for (const auto &[_, name] : frontend::StrippedQuery(query_string).parameters()) {
+          user_parameters.emplace(name, storage::PropertyValue());
+        }
+        auto parsed_query = ParseQuery(query_string, user_parameters, &interpreter_context->ast_cache,
+                                       interpreter_context->config.query);
+        auto *cypher_query = utils::Downcast<CypherQuery>(parsed_query.query);
+        if (!cypher_query || !parsed_query.is_cacheable) continue;
+        CypherQueryToPlan(parsed_query.stripped_query.hash(), std::move(parsed_query.ast_storage), cypher_query,
+                          parsed_query.parameters, db_acc->plan_cache(), &dba);
+        ++planned;
+      } catch (const std::exception &e) {
+        spdlog::trace("Hot query wasn't planned ahead in database {}: {}", db_acc->name(), e.what());
+      }
+    }
+  });
+  return planned;
+}
+
+}  // namespace memgraph::query
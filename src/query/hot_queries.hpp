@@ -0,0 +1,61 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "utils/spin_lock.hpp"
+#include "utils/synchronized.hpp"
+
+namespace memgraph::query {
+
+struct InterpreterContext;
+
+/// Returns the stripped texts of the @p count most executed queries, see
+/// `QueryFingerprintMetrics`. The MAIN sends them to its replicas, so a
+/// promoted replica starts with their ASTs and plans cached.
+std::vector<std::string> MostExecutedQueries(size_t count);
+
+/**
+ * The hot queries of the MAIN a replica received and hasn't planned yet. The
+ * replication server receives them before the interpreter may exist, so they
+ * wait here until the interpreter's scheduler takes them.
+ */
+class HotQueries {
+ public:
+  /// Replaces the queries which weren't planned yet.
+  void Set(std::vector<std::string> queries) {
+    pending_.WithLock([&](auto &pending) { pending = std::move(queries); });
+  }
+
+  /// Returns the queries received since the last call, if any.
+  std::optional<std::vector<std::string>> Take() {
+    return pending_.WithLock([](auto &pending) { return std::exchange(pending, std::nullopt); });
+  }
+
+ private:
+  utils::Synchronized<std::optional<std::vector<std::string>>, utils::SpinLock> pending_;
+};
+
+HotQueries &GlobalHotQueries();
+
+/// Parses @p queries into the AST cache and plans them into the plan cache of
+/// every loaded database. The parameters the queries take are planned as
+/// null. The queries which fail to parse or to plan are skipped.
+/// @return The number of the plans made.
+size_t PrewarmPlanCaches(InterpreterContext *interpreter_context, const std::vector<std::string> &queries);
+
+}  // namespace memgraph::query
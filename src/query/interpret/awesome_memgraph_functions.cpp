@@ -522,27 +522,51 @@ size_t UnwrapDegreeResult(storage::Result<size_t> maybe_degree) {
 }  // namespace
 
 TypedValue Degree(const TypedValue *args, int64_t nargs, const FunctionContext &ctx) {
-  FType<Or<Null, Vertex>>("degree", args, nargs);
+  FType<Or<Null, Vertex>, Optional<String>>("degree", args, nargs);
   if (args[0].IsNull()) return TypedValue(ctx.memory);
   const auto &vertex = args[0].ValueVertex();
-  size_t out_degree = UnwrapDegreeResult(vertex.OutDegree(ctx.view));
-  size_t in_degree = UnwrapDegreeResult(vertex.InDegree(ctx.view));
+  size_t out_degree = 0;
+  size_t in_degree = 0;
+  if (nargs > 1) {
+    // A read mustn't create the edge type, a vertex has no edges of a type which doesn't exist.
+    const auto edge_type = ctx.db_accessor->NameToEdgeTypeIfExists(args[1].ValueString());
+    if (!edge_type) return TypedValue(static_cast<int64_t>(0), ctx.memory);
+    out_degree = UnwrapDegreeResult(vertex.OutDegree(ctx.view, *edge_type));
+    in_degree = UnwrapDegreeResult(vertex.InDegree(ctx.view, *edge_type));
+  } else {
+    out_degree = UnwrapDegreeResult(vertex.OutDegree(ctx.view));
+    in_degree = UnwrapDegreeResult(vertex.InDegree(ctx.view));
+  }
   return TypedValue(static_cast<int64_t>(out_degree + in_degree), ctx.memory);
 }
 
 TypedValue InDegree(const TypedValue *args, int64_t nargs, const FunctionContext &ctx) {
-  FType<Or<Null, Vertex>>("inDegree", args, nargs);
+  FType<Or<Null, Vertex>, Optional<String>>("inDegree", args, nargs);
   if (args[0].IsNull()) return TypedValue(ctx.memory);
   const auto &vertex = args[0].ValueVertex();
-  size_t in_degree = UnwrapDegreeResult(vertex.InDegree(ctx.view));
+  size_t in_degree = 0;
+  if (nargs > 1) {
+    const auto edge_type = ctx.db_accessor->NameToEdgeTypeIfExists(args[1].ValueString());
+    if (!edge_type) return TypedValue(static_cast<int64_t>(0), ctx.memory);
+    in_degree = UnwrapDegreeResult(vertex.InDegree(ctx.view, *edge_type));
+  } else {
+    in_degree = UnwrapDegreeResult(vertex.InDegree(ctx.view));
+  }
   return TypedValue(static_cast<int64_t>(in_degree), ctx.memory);
 }
 
 TypedValue OutDegree(const TypedValue *args, int64_t nargs, const FunctionContext &ctx) {
-  FType<Or<Null, Vertex>>("outDegree", args, nargs);
+  FType<Or<Null, Vertex>, Optional<String>>("outDegree", args, nargs);
   if (args[0].IsNull()) return TypedValue(ctx.memory);
   const auto &vertex = args[0].ValueVertex();
-  size_t out_degree = UnwrapDegreeResult(vertex.OutDegree(ctx.view));
+  size_t out_degree = 0;
+  if (nargs > 1) {
+    const auto edge_type = ctx.db_accessor->NameToEdgeTypeIfExists(args[1].ValueString());
+    if (!edge_type) return TypedValue(static_cast<int64_t>(0), ctx.memory);
+    out_degree = UnwrapDegreeResult(vertex.OutDegree(ctx.view, *edge_type));
+  } else {
+    out_degree = UnwrapDegreeResult(vertex.OutDegree(ctx.view));
+  }
   return TypedValue(static_cast<int64_t>(out_degree), ctx.memory);
 }
 
@@ -1739,4 +1763,11 @@ auto NameToFunction(const std::string &function_name) -> std::variant<std::monos
   return std::monostate{};
 }
 
+bool IsPureFunction(const std::string &function_name) {
+  // Return a different value on each call, are called for their effect or read the enums of the storage.
+  static auto const impure_functions =
+      utils::CaseInsensitiveSet{"RAND", "RANDOMUUID", "UNIFORMSAMPLE", "COUNTER", "ASSERT", "TOENUM"};
+  return builtin_functions.contains(utils::ToUpperCase(function_name)) && !impure_functions.contains(function_name);
+}
+
 }  // namespace memgraph::query
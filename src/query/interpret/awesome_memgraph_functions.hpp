@@ -53,4 +53,10 @@ using user_func = std::pair<func_impl, std::shared_ptr<procedure::Module>>;
 /// Error, will return std::monostate if function can not be found
 auto NameToFunction(const std::string &function_name) -> std::variant<std::monostate, func_impl, user_func>;
 
+/// Returns true if the built-in function with the given name has no effect
+/// and returns the same value whenever it's called with the same arguments
+/// during an execution. Temporal functions called without arguments are pure
+/// too, they read the timestamp of the execution.
+bool IsPureFunction(const std::string &function_name);
+
 }  // namespace memgraph::query
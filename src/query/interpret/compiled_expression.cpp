@@ -0,0 +1,420 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#include "query/interpret/compiled_expression.hpp"
+
+#include <cmath>
+#include <utility>
+
+#include "query/context.hpp"
+#include "storage/v2/result.hpp"
+#include "utils/typeinfo.hpp"
+
+namespace memgraph::query {
+
+namespace {
+
+using Type = CompiledValue::Type;
+
+CompiledValue MakeNull() { return CompiledValue{.type = Type::Null}; }
+
+CompiledValue MakeBool(bool value) { return CompiledValue{.type = Type::Bool, .bool_v = value}; }
+
+CompiledValue MakeInt(int64_t value) { return CompiledValue{.type = Type::Int, .int_v = value}; }
+
+CompiledValue MakeDouble(double value) { return CompiledValue{.type = Type::Double, .double_v = value}; }
+
+bool IsUnsupported(const CompiledValue &value) { return value.type == Type::Unsupported; }
+
+bool IsNumeric(const CompiledValue &value) { return value.type == Type::Int || value.type == Type::Double; }
+
+bool IsLogical(const CompiledValue &value) { return value.type == Type::Bool || value.type == Type::Null; }
+
+double ToDouble(const CompiledValue &value) {
+  return value.type == Type::Int ? static_cast<double>(value.int_v) : value.double_v;
+}
+
+/// The string of @p value is referred to, so it must outlive the result.
+CompiledValue FromTypedValue(const TypedValue &value) {
+  switch (value.type()) {
+    case TypedValue::Type::Null:
+      return MakeNull();
+    case TypedValue::Type::Bool:
+      return MakeBool(value.ValueBool());
+    case TypedValue::Type::Int:
+      return MakeInt(value.ValueInt());
+    case TypedValue::Type::Double:
+      return MakeDouble(value.ValueDouble());
+    case TypedValue::Type::String:
+      return CompiledValue{.type = Type::String, .string_v = value.ValueString()};
+    default:
+      return {};
+  }
+}
+
+/// The string of @p value is referred to, so it must outlive the result.
+CompiledValue FromPropertyValue(const storage::PropertyValue &value) {
+  switch (value.type()) {
+    case storage::PropertyValue::Type::Null:
+      return MakeNull();
+    case storage::PropertyValue::Type::Bool:
+      return MakeBool(value.ValueBool());
+    case storage::PropertyValue::Type::Int:
+      return MakeInt(value.ValueInt());
+    case storage::PropertyValue::Type::Double:
+      return MakeDouble(value.ValueDouble());
+    case storage::PropertyValue::Type::String:
+      return CompiledValue{.type = Type::String, .string_v = value.ValueString()};
+    default:
+      return {};
+  }
+}
+
+CompiledValue FromPropertyValue(storage::PropertyValue &&value) {
+  if (!value.IsString()) return FromPropertyValue(value);
+  return CompiledValue{.type = Type::String, .property = std::move(value)};
+}
+
+// The operators below mirror the `TypedValue` operators, returning
+// `Unsupported` wherever those would throw.
+
+CompiledValue LogicalNot(const CompiledValue &value) {
+  if (value.type == Type::Bool) return MakeBool(!value.bool_v);
+  if (value.type == Type::Null) return MakeNull();
+  return {};
+}
+
+CompiledValue LogicalOr(const CompiledValue &a, const CompiledValue &b) {
+  if (!IsLogical(a) || !IsLogical(b)) return {};
+  if ((a.type == Type::Bool && a.bool_v) || (b.type == Type::Bool && b.bool_v)) return MakeBool(true);
+  if (a.type == Type::Null || b.type == Type::Null) return MakeNull();
+  return MakeBool(false);
+}
+
+CompiledValue LogicalAnd(const CompiledValue &a, const CompiledValue &b) {
+  if (!IsLogical(a) || !IsLogical(b)) return {};
+  if ((a.type == Type::Bool && !a.bool_v) || (b.type == Type::Bool && !b.bool_v)) return MakeBool(false);
+  if (a.type == Type::Null || b.type == Type::Null) return MakeNull();
+  return MakeBool(true);
+}
+
+CompiledValue LogicalXor(const CompiledValue &a, const CompiledValue &b) {
+  if (!IsLogical(a) || !IsLogical(b)) return {};
+  if (a.type == Type::Null || b.type == Type::Null) return MakeNull();
+  return MakeBool(a.bool_v != b.bool_v);
+}
+
+CompiledValue CompareLess(const CompiledValue &a, const CompiledValue &b) {
+  if (IsUnsupported(a) || IsUnsupported(b) || a.type == Type::Bool || b.type == Type::Bool) return {};
+  if (a.type == Type::Null || b.type == Type::Null) return MakeNull();
+  if (a.type == Type::String || b.type == Type::String) {
+    if (a.type != b.type) return {};
+    return MakeBool(a.ValueString() < b.ValueString());
+  }
+  if (a.type == Type::Double || b.type == Type::Double) return MakeBool(ToDouble(a) < ToDouble(b));
+  return MakeBool(a.int_v < b.int_v);
+}
+
+CompiledValue CompareEqual(const CompiledValue &a, const CompiledValue &b) {
+  if (IsUnsupported(a) || IsUnsupported(b)) return {};
+  if (a.type == Type::Null || b.type == Type::Null) return MakeNull();
+  if (a.type != b.type && !(IsNumeric(a) && IsNumeric(b))) return MakeBool(false);
+  switch (a.type) {
+    case Type::Bool:
+      return MakeBool(a.bool_v == b.bool_v);
+    case Type::Int:
+      if (b.type == Type::Double) return MakeBool(ToDouble(a) == ToDouble(b));
+      return MakeBool(a.int_v == b.int_v);
+    case Type::Double:
+      return MakeBool(ToDouble(a) == ToDouble(b));
+    case Type::String:
+      return MakeBool(a.ValueString() == b.ValueString());
+    default:
+      return {};
+  }
+}
+
+enum class Arithmetic : uint8_t { ADD, SUBTRACT, MULTIPLY, DIVIDE, MOD };
+
+CompiledValue Calculate(Arithmetic op, const CompiledValue &a, const CompiledValue &b) {
+  if (IsUnsupported(a) || IsUnsupported(b)) return {};
+  if (a.type == Type::Null || b.type == Type::Null) return MakeNull();
+  // String concatenation allocates anyway, it is left to the evaluator.
+  if (!IsNumeric(a) || !IsNumeric(b)) return {};
+  if (a.type == Type::Double || b.type == Type::Double) {
+    const auto x = ToDouble(a);
+    const auto y = ToDouble(b);
+    switch (op) {
+      case Arithmetic::ADD:
+        return MakeDouble(x + y);
+      case Arithmetic::SUBTRACT:
+        return MakeDouble(x - y);
+      case Arithmetic::MULTIPLY:
+        return MakeDouble(x * y);
+      case Arithmetic::DIVIDE:
+        return MakeDouble(x / y);
+      case Arithmetic::MOD:
+        return MakeDouble(std::fmod(x, y));
+    }
+  }
+  switch (op) {
+    case Arithmetic::ADD:
+      return MakeInt(a.int_v + b.int_v);
+    case Arithmetic::SUBTRACT:
+      return MakeInt(a.int_v - b.int_v);
+    case Arithmetic::MULTIPLY:
+      return MakeInt(a.int_v * b.int_v);
+    case Arithmetic::DIVIDE:
+      if (b.int_v == 0) return {};
+      return MakeInt(a.int_v / b.int_v);
+    case Arithmetic::MOD:
+      if (b.int_v == 0) return {};
+      return MakeInt(a.int_v % b.int_v);
+  }
+  return {};
+}
+
+template <class TRecordAccessor>
+CompiledValue ReadProperty(const TRecordAccessor &record, storage::PropertyId property, storage::View view) {
+  auto maybe_prop = record.GetProperty(view, property);
+  if (maybe_prop.HasError() && maybe_prop.GetError() == storage::Error::NONEXISTENT_OBJECT) {
+    // Same fallback to the NEW view as in `ExpressionEvaluator::GetProperty`.
+    maybe_prop = record.GetProperty(storage::View::NEW, property);
+  }
+  // The evaluator raises the appropriate error.
+  if (maybe_prop.HasError()) return {};
+  return FromPropertyValue(*std::move(maybe_prop));
+}
+
+template <class TFunc>
+CompiledNode MakeBinary(CompiledNode lhs, CompiledNode rhs, TFunc func) {
+  return [lhs = std::move(lhs), rhs = std::move(rhs), func](const Frame &frame, const EvaluationContext &ctx,
+                                                            storage::View view) {
+    return func(lhs(frame, ctx, view), rhs(frame, ctx, view));
+  };
+}
+
+template <class TFunc>
+CompiledNode MakeUnary(CompiledNode operand, TFunc func) {
+  return [operand = std::move(operand), func](const Frame &frame, const EvaluationContext &ctx, storage::View view) {
+    return func(operand(frame, ctx, view));
+  };
+}
+
+class Compiler {
+ public:
+  explicit Compiler(const SymbolTable &symbol_table) : symbol_table_(&symbol_table) {}
+
+  std::optional<CompiledNode> Compile(Expression *expression) {
+    if (auto *literal = utils::Downcast<PrimitiveLiteral>(expression)) {
+      // The literal lives in the AST storage of the plan.
+      const auto *value = &literal->value_;
+      return [value](const Frame &, const EvaluationContext &, storage::View) { return FromPropertyValue(*value); };
+    }
+    if (auto *parameter = utils::Downcast<ParameterLookup>(expression)) {
+      auto position = parameter->token_position_;
+      return [position](const Frame &, const EvaluationContext &ctx, storage::View) {
+        return FromPropertyValue(ctx.parameters.AtTokenPosition(position));
+      };
+    }
+    if (auto *identifier = utils::Downcast<Identifier>(expression)) {
+      auto symbol = symbol_table_->at(*identifier);
+      return [symbol](const Frame &frame, const EvaluationContext &, storage::View) {
+        return FromTypedValue(frame.at(symbol));
+      };
+    }
+    if (auto *lookup = utils::Downcast<PropertyLookup>(expression)) {
+      return CompilePropertyLookup(*lookup);
+    }
+    if (auto *op = utils::Downcast<AndOperator>(expression)) {
+      return CompileShortCircuit(*op, false);
+    }
+    if (auto *op = utils::Downcast<OrOperator>(expression)) {
+      return CompileShortCircuit(*op, true);
+    }
+    if (auto *op = utils::Downcast<XorOperator>(expression)) {
+      return CompileBinary(*op, LogicalXor);
+    }
+    if (auto *op = utils::Downcast<EqualOperator>(expression)) {
+      return CompileBinary(*op, CompareEqual);
+    }
+    if (auto *op = utils::Downcast<NotEqualOperator>(expression)) {
+      return CompileBinary(*op, [](const auto &a, const auto &b) { return LogicalNot(CompareEqual(a, b)); });
+    }
+    if (auto *op = utils::Downcast<LessOperator>(expression)) {
+      return CompileBinary(*op, CompareLess);
+    }
+    if (auto *op = utils::Downcast<GreaterOperator>(expression)) {
+      return CompileBinary(*op, [](const auto &a, const auto &b) {
+        return LogicalNot(LogicalOr(CompareLess(a, b), CompareEqual(a, b)));
+      });
+    }
+    if (auto *op = utils::Downcast<LessEqualOperator>(expression)) {
+      return CompileBinary(*op, [](const auto &a, const auto &b) {
+        return LogicalOr(CompareLess(a, b), CompareEqual(a, b));
+      });
+    }
+    if (auto *op = utils::Downcast<GreaterEqualOperator>(expression)) {
+      return CompileBinary(*op, [](const auto &a, const auto &b) { return LogicalNot(CompareLess(a, b)); });
+    }
+    if (auto *op = utils::Downcast<AdditionOperator>(expression)) {
+      return CompileArithmetic(*op, Arithmetic::ADD);
+    }
+    if (auto *op = utils::Downcast<SubtractionOperator>(expression)) {
+      return CompileArithmetic(*op, Arithmetic::SUBTRACT);
+    }
+    if (auto *op = utils::Downcast<MultiplicationOperator>(expression)) {
+      return CompileArithmetic(*op, Arithmetic::MULTIPLY);
+    }
+    if (auto *op = utils::Downcast<DivisionOperator>(expression)) {
+      return CompileArithmetic(*op, Arithmetic::DIVIDE);
+    }
+    if (auto *op = utils::Downcast<ModOperator>(expression)) {
+      return CompileArithmetic(*op, Arithmetic::MOD);
+    }
+    if (auto *op = utils::Downcast<NotOperator>(expression)) {
+      return CompileUnary(*op, LogicalNot);
+    }
+    if (auto *op = utils::Downcast<IsNullOperator>(expression)) {
+      return CompileUnary(*op, [](const CompiledValue &value) {
+        return IsUnsupported(value) ? CompiledValue{} : MakeBool(value.type == Type::Null);
+      });
+    }
+    if (auto *op = utils::Downcast<UnaryMinusOperator>(expression)) {
+      return CompileUnary(*op, [](const CompiledValue &value) {
+        if (value.type == Type::Int) return MakeInt(-value.int_v);
+        if (value.type == Type::Double) return MakeDouble(-value.double_v);
+        if (value.type == Type::Null) return MakeNull();
+        return CompiledValue{};
+      });
+    }
+    if (auto *op = utils::Downcast<UnaryPlusOperator>(expression)) {
+      return CompileUnary(*op, [](const CompiledValue &value) {
+        return IsNumeric(value) || value.type == Type::Null ? value : CompiledValue{};
+      });
+    }
+    return std::nullopt;
+  }
+
+ private:
+  std::optional<CompiledNode> CompilePropertyLookup(const PropertyLookup &lookup) {
+    if (lookup.loaded_value_) return Compile(lookup.loaded_value_);
+    // The cache of all properties is kept by the evaluator.
+    if (lookup.evaluation_mode_ != PropertyLookup::EvaluationMode::GET_OWN_PROPERTY) return std::nullopt;
+    auto *identifier = utils::Downcast<Identifier>(lookup.expression_);
+    if (!identifier) return std::nullopt;
+    auto symbol = symbol_table_->at(*identifier);
+    auto property_ix = lookup.property_.ix;
+    return [symbol, property_ix](const Frame &frame, const EvaluationContext &ctx, storage::View view) {
+      const auto &object = frame.at(symbol);
+      switch (object.type()) {
+        case TypedValue::Type::Null:
+          return MakeNull();
+        case TypedValue::Type::Vertex:
+          return ReadProperty(object.ValueVertex(), ctx.properties[property_ix], view);
+        case TypedValue::Type::Edge:
+          return ReadProperty(object.ValueEdge(), ctx.properties[property_ix], view);
+        default:
+          // Maps and the fields of temporal values are looked up by name.
+          return CompiledValue{};
+      }
+    };
+  }
+
+  template <class TOperator>
+  std::optional<CompiledNode> CompileShortCircuit(const TOperator &op, bool short_circuit_value) {
+    auto lhs = Compile(op.expression1_);
+    auto rhs = lhs ? Compile(op.expression2_) : std::nullopt;
+    if (!rhs) return std::nullopt;
+    return [lhs = *std::move(lhs), rhs = *std::move(rhs), short_circuit_value](
+               const Frame &frame, const EvaluationContext &ctx, storage::View view) {
+      auto value1 = lhs(frame, ctx, view);
+      if (value1.type == Type::Bool && value1.bool_v == short_circuit_value) return value1;
+      if (IsUnsupported(value1)) return value1;
+      auto value2 = rhs(frame, ctx, view);
+      return short_circuit_value ? LogicalOr(value1, value2) : LogicalAnd(value1, value2);
+    };
+  }
+
+  template <class TOperator, class TFunc>
+  std::optional<CompiledNode> CompileBinary(const TOperator &op, TFunc func) {
+    auto lhs = Compile(op.expression1_);
+    auto rhs = lhs ? Compile(op.expression2_) : std::nullopt;
+    if (!rhs) return std::nullopt;
+    return MakeBinary(*std::move(lhs), *std::move(rhs), func);
+  }
+
+  template <class TOperator>
+  std::optional<CompiledNode> CompileArithmetic(const TOperator &op, Arithmetic arithmetic) {
+    return CompileBinary(op, [arithmetic](const auto &a, const auto &b) { return Calculate(arithmetic, a, b); });
+  }
+
+  template <class TOperator, class TFunc>
+  std::optional<CompiledNode> CompileUnary(const TOperator &op, TFunc func) {
+    auto operand = Compile(op.expression_);
+    if (!operand) return std::nullopt;
+    return MakeUnary(*std::move(operand), func);
+  }
+
+  const SymbolTable *symbol_table_;
+};
+
+}  // namespace
+
+std::optional<CompiledExpression> CompiledExpression::Compile(Expression *expression,
+                                                              const SymbolTable &symbol_table) {
+  if (utils::IsSubtype(*expression, PrimitiveLiteral::kType) || utils::IsSubtype(*expression, ParameterLookup::kType) ||
+      utils::IsSubtype(*expression, Identifier::kType) || utils::IsSubtype(*expression, PropertyLookup::kType)) {
+    return std::nullopt;
+  }
+  auto root = Compiler(symbol_table).Compile(expression);
+  if (!root) return std::nullopt;
+  return CompiledExpression(*std::move(root));
+}
+
+std::optional<TypedValue> CompiledExpression::Evaluate(const Frame &frame, const EvaluationContext &ctx,
+                                                       storage::View view) const {
+  auto value = root_(frame, ctx, view);
+  switch (value.type) {
+    case Type::Unsupported:
+      return std::nullopt;
+    case Type::Null:
+      return TypedValue(ctx.memory);
+    case Type::Bool:
+      return TypedValue(value.bool_v, ctx.memory);
+    case Type::Int:
+      return TypedValue(value.int_v, ctx.memory);
+    case Type::Double:
+      return TypedValue(value.double_v, ctx.memory);
+    case Type::String:
+      return TypedValue(value.ValueString(), ctx.memory);
+  }
+  return std::nullopt;
+}
+
+std::optional<bool> CompiledExpression::EvaluateFilter(const Frame &frame, const EvaluationContext &ctx,
+                                                       storage::View view) const {
+  auto value = root_(frame, ctx, view);
+  if (value.type == Type::Null) return false;
+  // Other types are reported by the evaluator.
+  if (value.type != Type::Bool) return std::nullopt;
+  return value.bool_v;
+}
+
+void CompiledExpressions::Add(Expression *expression, const SymbolTable &symbol_table) {
+  if (!expression || expressions_.contains(expression)) return;
+  if (auto compiled = CompiledExpression::Compile(expression, symbol_table)) {
+    expressions_.emplace(expression, *std::move(compiled));
+  }
+}
+
+}  // namespace memgraph::query
@@ -0,0 +1,100 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+/// @file
+/// Filter and projection expressions compiled into trees of closures, which
+/// evaluate comparisons, arithmetic, boolean logic and property lookups on
+/// nulls, booleans, numbers and strings without going through the
+/// `ExpressionEvaluator` and without allocating intermediate `TypedValue`s.
+/// Anything else is left to the evaluator.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+
+#include "query/frontend/ast/ast.hpp"
+#include "query/frontend/semantic/symbol_table.hpp"
+#include "query/interpret/frame.hpp"
+#include "query/typed_value.hpp"
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/view.hpp"
+
+namespace memgraph::query {
+
+struct EvaluationContext;
+
+/// Result of a compiled subexpression. `Unsupported` tells the caller to
+/// evaluate the whole expression with the `ExpressionEvaluator` instead,
+/// either because a value has a type the compiled code doesn't handle or
+/// because the evaluator would raise an error.
+struct CompiledValue {
+  enum class Type : uint8_t { Unsupported, Null, Bool, Int, Double, String };
+
+  std::string_view ValueString() const { return property.IsString() ? property.ValueString() : string_v; }
+
+  Type type{Type::Unsupported};
+  bool bool_v{false};
+  int64_t int_v{0};
+  double double_v{0.0};
+  /// Strings of literals, parameters and frame values are referred to.
+  std::string_view string_v;
+  /// Holds a string read from a vertex or an edge.
+  storage::PropertyValue property;
+};
+
+using CompiledNode = std::function<CompiledValue(const Frame &, const EvaluationContext &, storage::View)>;
+
+class CompiledExpression {
+ public:
+  /// Returns std::nullopt if @p expression contains an expression type which
+  /// can't be compiled, or if it is a single identifier, literal or property
+  /// lookup, since the evaluator doesn't do more work for those.
+  static std::optional<CompiledExpression> Compile(Expression *expression, const SymbolTable &symbol_table);
+
+  /// Returns std::nullopt if the expression has to be evaluated with the
+  /// `ExpressionEvaluator`.
+  std::optional<TypedValue> Evaluate(const Frame &frame, const EvaluationContext &ctx, storage::View view) const;
+
+  /// Evaluates the expression as a filter, Null is treated as false. Returns
+  /// std::nullopt if the expression has to be evaluated with the
+  /// `ExpressionEvaluator`.
+  std::optional<bool> EvaluateFilter(const Frame &frame, const EvaluationContext &ctx, storage::View view) const;
+
+ private:
+  explicit CompiledExpression(CompiledNode root) : root_(std::move(root)) {}
+
+  CompiledNode root_;
+};
+
+/// Compiled expressions of a plan, keyed by the expression they were
+/// compiled from.
+class CompiledExpressions {
+ public:
+  /// Compiles @p expression if it isn't compiled yet and can be compiled.
+  void Add(Expression *expression, const SymbolTable &symbol_table);
+
+  const CompiledExpression *Find(const Expression *expression) const {
+    auto found = expressions_.find(expression);
+    return found == expressions_.end() ? nullptr : &found->second;
+  }
+
+  bool Empty() const { return expressions_.empty(); }
+
+ private:
+  std::unordered_map<const Expression *, CompiledExpression> expressions_;
+};
+
+}  // namespace memgraph::query
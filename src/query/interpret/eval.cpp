@@ -51,6 +51,10 @@ std::optional<int64_t> EvaluateCommitFrequency(ExpressionVisitor<TypedValue> &ev
   return EvaluateUint(eval, expr, "Commit frequency");
 }
 
+std::optional<int64_t> EvaluateCommitConcurrency(ExpressionVisitor<TypedValue> &eval, Expression *expr) {
+  return EvaluateUint(eval, expr, "Number of concurrent transactions");
+}
+
 std::optional<int64_t> EvaluateDeleteBufferSize(ExpressionVisitor<TypedValue> &eval, Expression *expr) {
   return EvaluateUint(eval, expr, "Delete buffer size");
 }
@@ -83,7 +87,7 @@ TypedValue ExpressionEvaluator::Visit(RegexMatch &regex_match) {
   }
   const auto &target_string = target_string_value.ValueString();
   try {
-    std::regex const regex(regex_value.ValueString());
+    const auto &regex = ctx_->regexes.Get(regex_value.ValueString());
     return TypedValue(std::regex_match(target_string, regex), ctx_->memory);
   } catch (const std::regex_error &e) {
     throw QueryRuntimeException("Regex error in '{}': {}", regex_value.ValueString(), e.what());
@@ -200,6 +204,8 @@ TypedValue ExpressionEvaluator::Visit(AllPropertiesLookup &all_properties_lookup
   }
 }
 TypedValue ExpressionEvaluator::Visit(PropertyLookup &property_lookup) {
+  if (property_lookup.loaded_value_) return property_lookup.loaded_value_->Accept(*this);
+
   ReferenceExpressionEvaluator referenceExpressionEvaluator(frame_, symbol_table_, ctx_);
 
   TypedValue *expression_result_ptr = property_lookup.expression_->Accept(referenceExpressionEvaluator);
@@ -355,7 +361,7 @@ TypedValue ExpressionEvaluator::Visit(PropertyLookup &property_lookup) {
       for (const auto &v : graph.vertices()) {
         vertices.emplace_back(TypedValue(v, ctx_->memory));
       }
-      return TypedValue(vertices, ctx_->memory);
+      return TypedValue(std::move(vertices), ctx_->memory);
     }
     if (prop_name == "edges") {
       utils::pmr::vector<TypedValue> edges(ctx_->memory);
@@ -363,7 +369,7 @@ TypedValue ExpressionEvaluator::Visit(PropertyLookup &property_lookup) {
       for (const auto &e : graph.edges()) {
         edges.emplace_back(TypedValue(e, ctx_->memory));
       }
-      return TypedValue(edges, ctx_->memory);
+      return TypedValue(std::move(edges), ctx_->memory);
     }
     return std::nullopt;
   };
@@ -537,7 +537,7 @@ class ExpressionEvaluator : public ExpressionVisitor<TypedValue> {
     TypedValue::TVector result(ctx_->memory);
     result.reserve(literal.elements_.size());
     for (const auto &expression : literal.elements_) result.emplace_back(expression->Accept(*this));
-    return TypedValue(result, ctx_->memory);
+    return TypedValue(std::move(result), ctx_->memory);
   }
 
   TypedValue Visit(MapLiteral &literal) override {
@@ -546,7 +546,7 @@ class ExpressionEvaluator : public ExpressionVisitor<TypedValue> {
       result.emplace(pair.first.name, pair.second->Accept(*this));
     }
 
-    return TypedValue(result, ctx_->memory);
+    return TypedValue(std::move(result), ctx_->memory);
   }
 
   TypedValue Visit(MapProjectionLiteral &literal) override {
@@ -577,7 +577,7 @@ class ExpressionEvaluator : public ExpressionVisitor<TypedValue> {
 
     if (!all_properties_lookup.empty()) result.merge(all_properties_lookup);
 
-    return TypedValue(result, ctx_->memory);
+    return TypedValue(std::move(result), ctx_->memory);
   }
 
   TypedValue Visit(Aggregation &aggregation) override {
@@ -602,6 +602,9 @@ class ExpressionEvaluator : public ExpressionVisitor<TypedValue> {
   }
 
   TypedValue Visit(Function &function) override {
+    if (function.constant_) {
+      if (const auto *value = ctx_->constants.Find(&function)) return TypedValue(*value, ctx_->memory);
+    }
     FunctionContext function_ctx{dba_, ctx_->memory, ctx_->timestamp, &ctx_->counters, view_};
     bool is_transactional = storage::IsTransactional(dba_->GetStorageMode());
     TypedValue res(ctx_->memory);
@@ -626,6 +629,7 @@ class ExpressionEvaluator : public ExpressionVisitor<TypedValue> {
     if (!is_transactional && res.ContainsDeleted()) [[unlikely]] {
       return TypedValue(ctx_->memory);
     }
+    if (function.constant_) ctx_->constants.Insert(&function, res);
     return res;
   }
 
@@ -960,6 +964,7 @@ std::optional<int64_t> EvaluateUint(ExpressionVisitor<TypedValue> &eval, Express
 
 std::optional<int64_t> EvaluateHopsLimit(ExpressionVisitor<TypedValue> &eval, Expression *expr);
 std::optional<int64_t> EvaluateCommitFrequency(ExpressionVisitor<TypedValue> &eval, Expression *expr);
+std::optional<int64_t> EvaluateCommitConcurrency(ExpressionVisitor<TypedValue> &eval, Expression *expr);
 std::optional<int64_t> EvaluateDeleteBufferSize(ExpressionVisitor<TypedValue> &eval, Expression *expr);
 
 std::optional<size_t> EvaluateMemoryLimit(ExpressionVisitor<TypedValue> &eval, Expression *memory_limit,
@@ -1,4 +1,4 @@
-// Copyright 2022 Memgraph Ltd.
+// Copyright 2024 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <utility>
 #include <vector>
 
 #include "query/frontend/semantic/symbol_table.hpp"
@@ -42,4 +44,61 @@ class Frame {
   utils::pmr::vector<TypedValue> elems_;
 };
 
+/// Rows which cursors exchange in a batched pull, each held in a frame of its
+/// own. Frames are kept when the batch is cleared, so refilling the batch
+/// reuses them together with the buffers of the values they hold.
+class FrameBatch {
+ public:
+  FrameBatch(int64_t frame_size, size_t capacity, utils::MemoryResource *memory)
+      : frame_size_(frame_size), capacity_(capacity), memory_(memory) {
+    MG_ASSERT(capacity > 0);
+    rows_.reserve(capacity);
+  }
+
+  size_t size() const { return size_; }
+  size_t capacity() const { return capacity_; }
+  bool empty() const { return size_ == 0; }
+  bool full() const { return size_ >= capacity_; }
+
+  Frame &operator[](size_t row) { return rows_[row]; }
+  const Frame &operator[](size_t row) const { return rows_[row]; }
+
+  /// Appends a row and returns its frame, which still holds the values of the
+  /// row previously in its place.
+  Frame &Add() {
+    DMG_ASSERT(!full(), "Adding a row to a full batch.");
+    if (size_ == rows_.size()) rows_.emplace_back(frame_size_, memory_);
+    return rows_[size_++];
+  }
+
+  /// Keeps the rows for which @p keep returns true, in their order.
+  template <typename TPredicate>
+  void Retain(TPredicate &&keep) {
+    size_t kept = 0;
+    for (size_t row = 0; row < size_; ++row) {
+      if (!keep(rows_[row])) continue;
+      if (kept != row) std::swap(rows_[kept], rows_[row]);
+      ++kept;
+    }
+    size_ = kept;
+  }
+
+  /// Changes the number of rows the batch is filled up to, e.g. while the
+  /// consumer needs fewer rows than a full batch.
+  void SetCapacity(size_t capacity) {
+    MG_ASSERT(capacity > 0);
+    capacity_ = capacity;
+    size_ = std::min(size_, capacity_);
+  }
+
+  void Clear() { size_ = 0; }
+
+ private:
+  int64_t frame_size_;
+  size_t capacity_;
+  utils::MemoryResource *memory_;
+  std::vector<Frame> rows_;
+  size_t size_{0};
+};
+
 }  // namespace memgraph::query
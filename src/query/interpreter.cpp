@@ -15,13 +15,16 @@
 
 #include <algorithm>
 #include <atomic>
+#include <charconv>
 #include <chrono>
+#include <cmath>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <iterator>
 #include <limits>
+#include <map>
 #include <memory>
 #include <optional>
 #include <stdexcept>
@@ -29,6 +32,7 @@
 #include <thread>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -58,6 +62,8 @@
 #include "query/cypher_query_interpreter.hpp"
 #include "query/dump.hpp"
 #include "query/exceptions.hpp"
+#include "query/fan_out.hpp"
+#include "query/fingerprint_metrics.hpp"
 #include "query/frontend/ast/ast.hpp"
 #include "query/frontend/ast/ast_visitor.hpp"
 #include "query/frontend/ast/cypher_main_visitor.hpp"
@@ -77,6 +83,7 @@
 #include "query/procedure/module.hpp"
 #include "query/query_user.hpp"
 #include "query/replication_query_handler.hpp"
+#include "query/slow_query_log.hpp"
 #include "query/stream.hpp"
 #include "query/stream/common.hpp"
 #include "query/stream/sources.hpp"
@@ -111,10 +118,14 @@
 #include "utils/memory_tracker.hpp"
 #include "utils/message.hpp"
 #include "utils/on_scope_exit.hpp"
+#include "utils/perf_counters.hpp"
 #include "utils/readable_size.hpp"
 #include "utils/settings.hpp"
 #include "utils/stat.hpp"
 #include "utils/string.hpp"
+#include "utils/thread.hpp"
+#include "utils/thread_pool.hpp"
+#include "utils/tracing.hpp"
 #include "utils/tsc.hpp"
 #include "utils/typeinfo.hpp"
 #include "utils/variant_helpers.hpp"
@@ -171,6 +182,10 @@ namespace memgraph::query {
 
 constexpr std::string_view kSchemaAssert = "SCHEMA.ASSERT";
 constexpr int kSystemTxTryMS = 100;  //!< Duration of the unique try_lock_for
+//! Records a procedure yields at a time when the whole result is pulled at once.
+constexpr size_t kDefaultProcedureStreamRows = 1000;
+//! Rows pulled from a plan between two releases of the memory they are evaluated in.
+constexpr size_t kPullMemoryReleaseRows = 1024;
 
 template <typename>
 constexpr auto kAlwaysFalse = false;
@@ -351,7 +366,8 @@ class ReplQueryHandler {
           .mode = repl_mode,
           .repl_server_endpoint = std::move(*maybe_endpoint),  // don't resolve early
           .replica_check_frequency = replica_check_frequency,
-          .ssl = std::nullopt};
+          .ssl = std::nullopt,
+          .compression = FLAGS_replication_compression};
 
       const auto error = handler_->TryRegisterReplica(replication_config).HasError();
 
@@ -1579,6 +1595,9 @@ Callback::CallbackFunction GetKafkaCreateCallback(StreamQuery *stream_query, Exp
     throw SemanticException("Bootstrap servers must not be an empty string!");
   }
   auto common_stream_info = GetCommonStreamInfo(stream_query, evaluator);
+  const auto workers = GetOptionalValue<int64_t>(stream_query->workers_, evaluator).value_or(stream::kDefaultWorkers);
+  const auto pipeline_depth =
+      GetOptionalValue<int64_t>(stream_query->pipeline_depth_, evaluator).value_or(stream::kDefaultPipelineDepth);
 
   const auto get_config_map = [&evaluator](std::unordered_map<Expression *, Expression *> map,
                                            std::string_view map_name) -> std::unordered_map<std::string, std::string> {
@@ -1604,7 +1623,7 @@ Callback::CallbackFunction GetKafkaCreateCallback(StreamQuery *stream_query, Exp
           consumer_group = std::move(consumer_group), common_stream_info = std::move(common_stream_info),
           bootstrap_servers = std::move(bootstrap), owner = std::move(owner),
           configs = get_config_map(stream_query->configs_, "Configs"),
-          credentials = get_config_map(stream_query->credentials_, "Credentials"),
+          credentials = get_config_map(stream_query->credentials_, "Credentials"), workers, pipeline_depth,
           default_server = interpreter_context->config.default_kafka_bootstrap_servers]() mutable {
     std::string bootstrap = bootstrap_servers ? std::move(*bootstrap_servers) : std::move(default_server);
 
@@ -1614,7 +1633,9 @@ Callback::CallbackFunction GetKafkaCreateCallback(StreamQuery *stream_query, Exp
                                                            .consumer_group = std::move(consumer_group),
                                                            .bootstrap_servers = std::move(bootstrap),
                                                            .configs = std::move(configs),
-                                                           .credentials = std::move(credentials)},
+                                                           .credentials = std::move(credentials),
+                                                           .workers = workers,
+                                                           .pipeline_depth = pipeline_depth},
                                                           std::move(owner), db_acc, interpreter_context);
 
     return std::vector<std::vector<TypedValue>>{};
@@ -1948,17 +1969,56 @@ struct PullPlan {
                     std::optional<QueryLogger> &query_logger,
                     TriggerContextCollector *trigger_context_collector = nullptr,
                     std::optional<size_t> memory_limit = {}, FrameChangeCollector *frame_change_collector_ = nullptr,
-                    std::optional<int64_t> hops_limit = {});
+                    std::optional<int64_t> hops_limit = {}, size_t batch_size = 0,
+                    bool stream_procedure_records = false);
 
   std::optional<plan::ProfilingStatsWithTotalTime> Pull(AnyStream *stream, std::optional<int> n,
                                                         const std::vector<Symbol> &output_symbols,
                                                         std::map<std::string, TypedValue> *summary);
 
+  /// Rows streamed by all the pulls so far.
+  uint64_t pulled_rows() const { return pulled_rows_; }
+
+  /// Adds the perf events of the calling thread to the stats of each
+  /// profiled operator, so the plan must be pulled on this thread.
+  void CountPerfEvents() {
+    perf_counters_ = std::make_unique<utils::PerfCounters>();
+    ctx_.perf_counters = perf_counters_.get();
+  }
+
+  /// Adds the resources each pull used to @p usage.
+  void TrackResourceUsage(TransactionResourceUsage *usage) { resource_usage_ = usage; }
+
+  /// The plan as printed by EXPLAIN, the transaction of the query must still be open.
+  std::string PrintPlan() const {
+    std::stringstream printed_plan;
+    plan::PrettyPrint(*ctx_.db_accessor, &plan_->plan(), &printed_plan);
+    return printed_plan.str();
+  }
+
+  /// Peak memory of the transaction, zero if the query runs without a memory limit.
+  uint64_t PeakMemory() const {
+    const auto transaction_id = ctx_.db_accessor->GetTransactionId();
+    return transaction_id ? static_cast<uint64_t>(memgraph::memory::TransactionPeakMemory(*transaction_id)) : 0;
+  }
+
  private:
   std::shared_ptr<PlanWrapper> plan_ = nullptr;
   plan::UniqueCursorPtr cursor_ = nullptr;
   Frame frame_;
+  // Memory of the values evaluated during a single pull of cursor_, released
+  // once every kPullMemoryReleaseRows rows or pulled batch
+  PullMemory pull_memory_;
+  size_t rows_since_release_{0};
+  // Rows of the last batched pull, if the plan is pulled in batches
+  std::optional<FrameBatch> batch_;
+  // The row of batch_ which is streamed next
+  size_t batch_row_{0};
   ExecutionContext ctx_;
+  std::unique_ptr<utils::PerfCounters> perf_counters_;
+  TransactionResourceUsage *resource_usage_{nullptr};
+  // Whether the procedures can yield their records while they are pulled
+  bool stream_procedure_records_{false};
   std::optional<size_t> memory_limit_;
   // NOLINTNEXTLINE(cppcoreguidelines-avoid-const-or-ref-data-members)
   std::optional<QueryLogger> &query_logger_;
@@ -1967,6 +2027,7 @@ struct PullPlan {
   // we need the keep track of the total execution time across
   // those pulls by accumulating the execution time.
   std::chrono::duration<double> execution_time_{0};
+  uint64_t pulled_rows_{0};
 
   // To pull the results from a query we call the `Pull` method on
   // the cursor which saves the results in a Frame.
@@ -1983,19 +2044,22 @@ PullPlan::PullPlan(const std::shared_ptr<PlanWrapper> plan, const Parameters &pa
                    std::shared_ptr<utils::AsyncTimer> tx_timer, DatabaseAccessProtector db_acc,
                    std::optional<QueryLogger> &query_logger, TriggerContextCollector *trigger_context_collector,
                    const std::optional<size_t> memory_limit, FrameChangeCollector *frame_change_collector,
-                   const std::optional<int64_t> hops_limit)
+                   const std::optional<int64_t> hops_limit, const size_t batch_size,
+                   const bool stream_procedure_records)
     : plan_(plan),
       cursor_(plan->plan().MakeCursor(execution_memory)),
       frame_(plan->symbol_table().max_position(), execution_memory),
+      stream_procedure_records_(stream_procedure_records),
       memory_limit_(memory_limit),
       query_logger_(query_logger) {
   ctx_.hops_limit = query::HopsLimit{hops_limit};
   ctx_.db_accessor = dba;
   ctx_.symbol_table = plan->symbol_table();
+  ctx_.compiled_expressions = &plan->compiled_expressions();
   ctx_.evaluation_context.timestamp = QueryTimestamp();
   ctx_.evaluation_context.parameters = parameters;
-  ctx_.evaluation_context.properties = NamesToProperties(plan->ast_storage().properties_, dba);
-  ctx_.evaluation_context.labels = NamesToLabels(plan->ast_storage().labels_, dba);
+  ctx_.evaluation_context.properties = plan->properties(dba);
+  ctx_.evaluation_context.labels = plan->labels(dba);
   ctx_.user_or_role = user_or_role;
 #ifdef MG_ENTERPRISE
   if (license::global_license_checker.IsEnterpriseValidFast() && user_or_role && *user_or_role && dba) {
@@ -2016,8 +2080,18 @@ PullPlan::PullPlan(const std::shared_ptr<PlanWrapper> plan, const Parameters &pa
   ctx_.is_profile_query = is_profile_query;
   ctx_.trigger_context_collector = trigger_context_collector;
   ctx_.frame_change_collector = frame_change_collector;
-  ctx_.evaluation_context.memory = execution_memory;
+  ctx_.evaluation_context.memory = pull_memory_.resource();
   ctx_.db_acc = std::move(db_acc);
+  ctx_.spill_rows = interpreter_context->config.query.spill_rows;
+  ctx_.spill_directory = interpreter_context->config.query.spill_directory;
+  ctx_.load_csv_parallel_workers = interpreter_context->config.query.load_csv_parallel_workers;
+  ctx_.analytical_write_workers = interpreter_context->config.query.analytical_write_workers;
+  ctx_.periodic_commit_delta_budget = interpreter_context->config.query.periodic_commit_delta_budget;
+  ctx_.periodic_commit_time_budget = interpreter_context->config.query.periodic_commit_time_budget;
+  if (batch_size > 0) {
+    batch_.emplace(plan->symbol_table().max_position(), batch_size, execution_memory);
+    ctx_.batch_size = batch_size;
+  }
 }
 
 std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *stream, std::optional<int> n,
@@ -2041,15 +2115,39 @@ std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *strea
         }
       }};
 
-  // Returns true if a result was pulled.
-  const auto pull_result = [&]() -> bool { return cursor_->Pull(frame_, ctx_); };
+  if (stream_procedure_records_) {
+    // Procedures yield as many records as the client asked for before they are suspended.
+    ctx_.procedure_stream_rows = n && *n > 0 ? static_cast<size_t>(*n) : kDefaultProcedureStreamRows;
+  }
+
+  // Returns true if a result was pulled. The values of the previous pulls
+  // are on the frame or in the batch by now, so the pull memory may go.
+  const auto pull_result = [&]() -> bool {
+    if (!batch_) {
+      if (++rows_since_release_ == kPullMemoryReleaseRows) {
+        pull_memory_.Release();
+        rows_since_release_ = 0;
+      }
+      return cursor_->Pull(frame_, ctx_);
+    }
+    if (batch_row_ + 1 < batch_->size()) {
+      ++batch_row_;
+      return true;
+    }
+    batch_row_ = 0;
+    pull_memory_.Release();
+    return cursor_->PullBatch(frame_, *batch_, ctx_);
+  };
 
   auto values = std::vector<TypedValue>(output_symbols.size());
   const auto stream_values = [&] {
+    // The frame of the cursor is only a scratch frame when the results are pulled in batches
+    const auto &row = batch_ ? (*batch_)[batch_row_] : frame_;
     for (auto const i : ranges::views::iota(0UL, output_symbols.size())) {
-      values[i] = frame_[output_symbols[i]];
+      values[i] = row[output_symbols[i]];
     }
     stream->Result(values);
+    ++pulled_rows_;
   };
 
   // Get the execution time of all possible result pulls and streams.
@@ -2080,6 +2178,12 @@ std::optional<plan::ProfilingStatsWithTotalTime> PullPlan::Pull(AnyStream *strea
 
   execution_time_ += timer.Elapsed();
 
+  if (resource_usage_) {
+    resource_usage_->deltas.store(ctx_.db_accessor->DeltaCount(), std::memory_order_relaxed);
+    resource_usage_->scanned_vertices.fetch_add(std::exchange(ctx_.scanned_vertices, 0), std::memory_order_relaxed);
+    resource_usage_->peak_memory.store(PeakMemory(), std::memory_order_relaxed);
+  }
+
   if (has_unsent_results_) {
     return std::nullopt;
   }
@@ -2250,6 +2354,126 @@ inline static void TryCaching(const AstStorage &ast_storage, FrameChangeCollecto
   }
 }
 
+#ifdef MG_ENTERPRISE
+namespace {
+
+struct FanOutStream {
+  void Result(const std::vector<TypedValue> &values) {
+    auto &row = rows.emplace_back();
+    row.reserve(values.size());
+    for (const auto &value : values) {
+      row.emplace_back(value, utils::NewDeleteResource());
+    }
+  }
+
+  std::vector<std::vector<TypedValue>> rows;
+};
+
+// Runs the fanned out query on one database, as its own read transaction.
+std::vector<std::vector<TypedValue>> RunFanOutWorker(InterpreterContext *interpreter_context,
+                                                     memgraph::dbms::DatabaseAccess db_acc,
+                                                     const std::string &query_string,
+                                                     const UserParameters_fn &params_getter,
+                                                     std::shared_ptr<QueryUserOrRole> user_or_role) {
+  Interpreter interpreter(interpreter_context, std::move(db_acc));
+  interpreter.fan_out_worker_ = true;
+  interpreter.SetUser(std::move(user_or_role));
+  interpreter_context->interpreters->insert(&interpreter);
+  utils::OnScopeExit unregister{[&] {
+    interpreter.Abort();
+    interpreter_context->interpreters->erase(&interpreter);
+  }};
+
+  FanOutStream stream;
+  interpreter.Prepare(query_string, params_getter, {});
+  interpreter.PullAll(&stream);
+  return std::move(stream.rows);
+}
+
+}  // namespace
+#endif
+
+// Runs a read query on each of the databases in its USING DATABASES directive
+// in parallel and merges the rows they return.
+PreparedQuery PrepareFanOutQuery(ParsedQuery parsed_query, const std::string &query_string,
+                                 UserParameters_fn params_getter, bool in_explicit_transaction,
+                                 InterpreterContext *interpreter_context,
+                                 std::shared_ptr<QueryUserOrRole> user_or_role) {
+#ifdef MG_ENTERPRISE
+  if (!license::global_license_checker.IsEnterpriseValidFast()) {
+    throw QueryException("Trying to use enterprise feature without a valid license.");
+  }
+  if (in_explicit_transaction) {
+    throw FanOutInMulticommandTxException();
+  }
+
+  auto *cypher_query = utils::Downcast<CypherQuery>(parsed_query.query);
+  auto columns = FanOutMerger::Columns(*cypher_query);
+  std::vector<memgraph::dbms::DatabaseAccess> db_accs;
+  for (const auto &db_name : cypher_query->pre_query_directives_.fan_out_databases_) {
+    if (user_or_role && !user_or_role->IsAuthorized(parsed_query.required_privileges, db_name, &session_long_policy)) {
+      throw QueryRuntimeException("You are not authorized to run the query on the database \"{}\".", db_name);
+    }
+    db_accs.emplace_back(interpreter_context->dbms_handler->Get(db_name));
+  }
+
+  auto handler = [db_accs = std::move(db_accs), columns = std::move(columns), query_string,
+                  params_getter = std::move(params_getter), interpreter_context,
+                  user_or_role = std::move(user_or_role)]() mutable {
+    std::vector<std::vector<std::vector<TypedValue>>> results(db_accs.size());
+    std::vector<std::exception_ptr> errors(db_accs.size());
+    {
+      std::vector<std::jthread> workers;
+      workers.reserve(db_accs.size());
+      for (size_t i = 0; i < db_accs.size(); ++i) {
+        workers.emplace_back([&, i] {
+          try {
+            results[i] = RunFanOutWorker(interpreter_context, std::move(db_accs[i]), query_string, params_getter,
+                                         user_or_role);
+          } catch (...) {
+            errors[i] = std::current_exception();
+          }
+        });
+      }
+    }
+    for (const auto &error : errors) {
+      if (error) std::rethrow_exception(error);
+    }
+
+    FanOutMerger merger(std::move(columns));
+    for (auto &rows : results) {
+      for (auto &row : rows) {
+        merger.Add(std::move(row));
+      }
+    }
+    return std::move(merger).Rows();
+  };
+
+  std::vector<std::string> header;
+  for (auto *named_expression :
+       utils::Downcast<Return>(cypher_query->single_query_->clauses_.back())->body_.named_expressions) {
+    header.push_back(named_expression->name_);
+  }
+
+  return PreparedQuery{std::move(header), std::move(parsed_query.required_privileges),
+                       [handler = std::move(handler), pull_plan = std::shared_ptr<PullPlanVector>(nullptr)](
+                           AnyStream *stream, std::optional<int> n) mutable -> std::optional<QueryHandlerResult> {
+                         if (!pull_plan) {
+                           pull_plan = std::make_shared<PullPlanVector>(handler());
+                         }
+                         if (pull_plan->Pull(stream, n)) {
+                           return QueryHandlerResult::COMMIT;
+                         }
+                         return std::nullopt;
+                       },
+                       RWType::R};
+#else
+  throw QueryException("USING DATABASES is only available in the enterprise edition.");
+#endif
+}
+
+std::map<std::string, TypedValue> ResourceUsageToMap(const TransactionResourceUsage &usage);
+
 PreparedQuery PrepareCypherQuery(ParsedQuery parsed_query, std::map<std::string, TypedValue> *summary,
                                  InterpreterContext *interpreter_context, CurrentDB &current_db,
                                  utils::MemoryResource *execution_memory, std::vector<Notification> *notifications,
@@ -2292,8 +2516,33 @@ PreparedQuery PrepareCypherQuery(ParsedQuery parsed_query, std::map<std::string,
   const auto is_cacheable = parsed_query.is_cacheable;
   auto *plan_cache = is_cacheable ? current_db.db_acc_->get()->plan_cache() : nullptr;
 
-  auto plan = CypherQueryToPlan(parsed_query.stripped_query.hash(), std::move(parsed_query.ast_storage), cypher_query,
-                                parsed_query.parameters, plan_cache, dba);
+  std::shared_ptr<PlanWrapper> plan;
+  if (auto *statement = parsed_query.prepared_statement) {
+    // A prepared statement keeps its plan for as long as the plan cache would, so it isn't looked up in the cache
+    // again. The generation is read before planning, so a plan made across a reset of the cache is made again.
+    const auto &storage_uuid = current_db.db_acc_->get()->uuid();
+    const auto plan_key = PlanCacheKey(statement->stripped_query.hash(), parsed_query.parameters);
+    const auto generation = plan_cache->generation();
+    if (statement->HasPlanFor(storage_uuid, plan_key, generation, dba->VerticesCount())) {
+      plan = statement->plan;
+      plan->RecordCacheHit();
+    } else {
+      AstStorage ast_storage;
+      auto *query = utils::Downcast<CypherQuery>(statement->CloneQuery(&ast_storage));
+      plan = CypherQueryToPlan(statement->stripped_query.hash(), std::move(ast_storage), query,
+                               parsed_query.parameters, plan_cache, dba);
+      statement->plan = plan;
+      statement->plan_storage_uuid = storage_uuid;
+      statement->plan_key = plan_key;
+      statement->plan_cache_generation = generation;
+    }
+  } else {
+    plan = CypherQueryToPlan(parsed_query.stripped_query.hash(), std::move(parsed_query.ast_storage), cypher_query,
+                             parsed_query.parameters, plan_cache, dba);
+  }
+
+  // A plan made for this execution hasn't been served from the cache yet
+  const bool plan_cache_hit = plan->cache_hits() > 0;
 
   auto hints = plan::ProvidePlanHints(&plan->plan(), plan->symbol_table());
   for (const auto &hint : hints) {
@@ -2305,6 +2554,8 @@ PreparedQuery PrepareCypherQuery(ParsedQuery parsed_query, std::map<std::string,
     std::stringstream printed_plan;
     plan::PrettyPrint(*dba, &plan->plan(), &printed_plan);
     interpreter.LogQueryMessage(fmt::format("Explain plan:\n{}", printed_plan.str()));
+    interpreter.LogQueryMessage(
+        fmt::format("Plan cost: {}, served from the plan cache {} times.", plan->cost(), plan->cache_hits()));
   }
 
   TryCaching(plan->ast_storage(), frame_change_collector);
@@ -2314,6 +2565,16 @@ PreparedQuery PrepareCypherQuery(ParsedQuery parsed_query, std::map<std::string,
   if (interpreter.IsQueryLoggingActive()) {
     is_profile_query = true;
   }
+  const auto &stripped_query =
+      parsed_query.prepared_statement ? parsed_query.prepared_statement->stripped_query : parsed_query.stripped_query;
+  const auto plan_hash = stripped_query.hash();
+  // A sampled execution is profiled like PROFILE, its statistics are added to the samples of the plan
+  const bool is_sampled_query =
+      !is_profile_query &&
+      plan::GlobalProfileSampler().ShouldSample(plan_hash, interpreter_context->config.query.profile_sample_rate);
+  if (is_sampled_query) {
+    is_profile_query = true;
+  }
 
   auto rw_type_checker = plan::ReadWriteTypeChecker();
   rw_type_checker.InferRWType(const_cast<plan::LogicalOperator &>(plan->plan()));
@@ -2328,25 +2589,73 @@ PreparedQuery PrepareCypherQuery(ParsedQuery parsed_query, std::map<std::string,
     // WITH), then there is no token position, so use symbol name.
     // Otherwise, find the name from stripped query.
     header.push_back(
-        utils::FindOr(parsed_query.stripped_query.named_expressions(), symbol.token_position(), symbol.name()).first);
+        utils::FindOr(parsed_query.Stripped().named_expressions(), symbol.token_position(), symbol.name()).first);
   }
   // TODO: pass current DB into plan, in future current can change during pull
   auto *trigger_context_collector =
       current_db.trigger_context_collector_ ? &*current_db.trigger_context_collector_ : nullptr;
+  // Batches pull rows ahead of the client, so only the queries without side effects are pulled in batches. Profiling
+  // and the cached evaluations of the frame change collector rely on the rows being pulled one by one.
+  auto const batch_size =
+      rw_type_checker.type == RWType::R && !is_profile_query && !frame_change_collector->IsTrackingValues()
+          ? interpreter_context->config.query.execution_batch_size
+          : 0;
+  // Read procedures may only run interleaved with the rest of the plan if the plan doesn't write.
+  auto const stream_procedure_records = rw_type_checker.type == RWType::R && !is_profile_query;
   auto pull_plan = std::make_shared<PullPlan>(
       plan, parsed_query.parameters, is_profile_query, dba, interpreter_context, execution_memory,
       std::move(user_or_role), transaction_status, std::move(tx_timer), current_db.db_acc_, interpreter.query_logger_,
       trigger_context_collector, memory_limit,
-      frame_change_collector->IsTrackingValues() ? frame_change_collector : nullptr, hops_limit);
-  return PreparedQuery{std::move(header), std::move(parsed_query.required_privileges),
-                       [pull_plan = std::move(pull_plan), output_symbols = std::move(output_symbols), summary](
-                           AnyStream *stream, std::optional<int> n) -> std::optional<QueryHandlerResult> {
-                         if (pull_plan->Pull(stream, n, output_symbols, summary)) {
-                           return QueryHandlerResult::COMMIT;
-                         }
-                         return std::nullopt;
-                       },
-                       rw_type_checker.type};
+      frame_change_collector->IsTrackingValues() ? frame_change_collector : nullptr, hops_limit, batch_size,
+      stream_procedure_records);
+  pull_plan->TrackResourceUsage(&interpreter.resource_usage_);
+  std::optional<std::string> sampled_query;
+  if (is_sampled_query) sampled_query = stripped_query.query();
+  const auto fingerprint_metrics_size = interpreter_context->config.query.fingerprint_metrics_size;
+  std::optional<std::string> fingerprint_query;
+  if (fingerprint_metrics_size > 0) fingerprint_query = stripped_query.query();
+  // The slow executions are logged with the plan, the profile of the sampled executions and the resources used
+  std::optional<SlowQuery> slow_query;
+  if (GlobalSlowQueryLog().IsOpen()) {
+    slow_query.emplace(SlowQuery{.query = stripped_query.query()});
+    for (const auto &[name, value] : parsed_query.user_parameters) {
+      slow_query->parameter_sizes.emplace_back(name, ParameterSize(value));
+    }
+  }
+  return PreparedQuery{
+      std::move(header), std::move(parsed_query.required_privileges),
+      [pull_plan = std::move(pull_plan), output_symbols = std::move(output_symbols), summary, plan_hash,
+       sampled_query = std::move(sampled_query), fingerprint_query = std::move(fingerprint_query),
+       fingerprint_metrics_size, plan_cache_hit, slow_query = std::move(slow_query),
+       resource_usage = &interpreter.resource_usage_](AnyStream *stream,
+                                                      std::optional<int> n) -> std::optional<QueryHandlerResult> {
+        if (auto stats = pull_plan->Pull(stream, n, output_symbols, summary)) {
+          if (sampled_query) plan::GlobalProfileSampler().Record(plan_hash, *sampled_query, *stats);
+          if (slow_query && GlobalSlowQueryLog().IsSlow(stats->total_time)) {
+            slow_query->duration_ms = std::chrono::duration<double, std::milli>(stats->total_time).count();
+            slow_query->rows = pull_plan->pulled_rows();
+            slow_query->plan = pull_plan->PrintPlan();
+            if (sampled_query) slow_query->profile = ProfilingStatsToJson(*stats);
+            for (const auto &[name, value] : ResourceUsageToMap(*resource_usage)) {
+              slow_query->resource_usage.emplace(name, value.ValueInt());
+            }
+            GlobalSlowQueryLog().Log(*slow_query);
+          }
+          if (fingerprint_query) {
+            GlobalQueryFingerprintMetrics().Record(
+                plan_hash, *fingerprint_query,
+                {.latency_us = static_cast<uint64_t>(
+                     std::chrono::duration_cast<std::chrono::microseconds>(stats->total_time).count()),
+                 .rows = pull_plan->pulled_rows(),
+                 .peak_memory = pull_plan->PeakMemory(),
+                 .plan_cache_hit = plan_cache_hit},
+                fingerprint_metrics_size);
+          }
+          return QueryHandlerResult::COMMIT;
+        }
+        return std::nullopt;
+      },
+      rw_type_checker.type};
 }
 
 PreparedQuery PrepareExplainQuery(ParsedQuery parsed_query, std::map<std::string, TypedValue> *summary,
@@ -2438,6 +2747,19 @@ PreparedQuery PrepareProfileQuery(ParsedQuery parsed_query, bool in_explicit_tra
     throw QueryException("TSC support is missing for PROFILE");
   }
 
+  // `PROFILE WITH COUNTERS` is followed by the inner query, the first
+  // occurrence of the keyword is the one right after `PROFILE WITH`.
+  auto *profile_query = utils::Downcast<ProfileQuery>(parsed_query.query);
+  MG_ASSERT(profile_query, "Expected a PROFILE query");
+  const bool with_counters = profile_query->with_counters_;
+  auto inner_query_start = kProfileQueryStart.size();
+  if (with_counters) {
+    const std::string_view kCounters = "counters";
+    const auto counters_position = utils::ToLowerCase(parsed_query.query_string).find(kCounters, inner_query_start);
+    MG_ASSERT(counters_position != std::string::npos, "Expected the PROFILE query to have the COUNTERS keyword");
+    inner_query_start = counters_position + kCounters.size();
+  }
+
   // Parse and cache the inner query separately (as if it was a standalone
   // query), producing a fresh AST. Note that currently we cannot just reuse
   // part of the already produced AST because the parameters within ASTs are
@@ -2445,7 +2767,7 @@ PreparedQuery PrepareProfileQuery(ParsedQuery parsed_query, bool in_explicit_tra
   // wouldn't match up if if we were to reuse the AST (produced by parsing the
   // full query string) when given just the inner query to execute.
   ParsedQuery parsed_inner_query =
-      ParseQuery(parsed_query.query_string.substr(kProfileQueryStart.size()), parsed_query.user_parameters,
+      ParseQuery(parsed_query.query_string.substr(inner_query_start), parsed_query.user_parameters,
                  &interpreter_context->ast_cache, interpreter_context->config.query);
 
   auto *cypher_query = utils::Downcast<CypherQuery>(parsed_inner_query.query);
@@ -2479,10 +2801,11 @@ PreparedQuery PrepareProfileQuery(ParsedQuery parsed_query, bool in_explicit_tra
   rw_type_checker.InferRWType(const_cast<plan::LogicalOperator &>(cypher_query_plan->plan()));
 
   return PreparedQuery{
-      {"OPERATOR", "ACTUAL HITS", "RELATIVE TIME", "ABSOLUTE TIME"},
+      plan::ProfilingStatsColumns(with_counters),
       std::move(parsed_query.required_privileges),
       [plan = std::move(cypher_query_plan), parameters = std::move(parsed_inner_query.parameters), summary, dba,
-       interpreter_context, execution_memory, memory_limit, user_or_role = std::move(user_or_role),
+       interpreter_context, execution_memory, memory_limit, user_or_role = std::move(user_or_role), with_counters,
+       resource_usage = &interpreter.resource_usage_,
        // We want to execute the query we are profiling lazily, so we delay
        // the construction of the corresponding context.
        stats_and_total_time = std::optional<plan::ProfilingStatsWithTotalTime>{},
@@ -2492,11 +2815,14 @@ PreparedQuery PrepareProfileQuery(ParsedQuery parsed_query, bool in_explicit_tra
                                                   std::optional<int> n) mutable -> std::optional<QueryHandlerResult> {
         // No output symbols are given so that nothing is streamed.
         if (!stats_and_total_time) {
-          stats_and_total_time =
-              PullPlan(plan, parameters, true, dba, interpreter_context, execution_memory, std::move(user_or_role),
-                       transaction_status, std::move(tx_timer), db_acc, query_logger, nullptr, memory_limit,
-                       frame_change_collector->IsTrackingValues() ? frame_change_collector : nullptr, hops_limit)
-                  .Pull(stream, {}, {}, summary);
+          PullPlan profiled_plan(plan, parameters, true, dba, interpreter_context, execution_memory,
+                                 std::move(user_or_role), transaction_status, std::move(tx_timer), db_acc, query_logger,
+                                 nullptr, memory_limit,
+                                 frame_change_collector->IsTrackingValues() ? frame_change_collector : nullptr,
+                                 hops_limit);
+          if (with_counters) profiled_plan.CountPerfEvents();
+          profiled_plan.TrackResourceUsage(resource_usage);
+          stats_and_total_time = profiled_plan.Pull(stream, {}, {}, summary);
           pull_plan = std::make_shared<PullPlanVector>(ProfilingStatsToTable(*stats_and_total_time));
         }
 
@@ -2512,10 +2838,10 @@ PreparedQuery PrepareProfileQuery(ParsedQuery parsed_query, bool in_explicit_tra
       rw_type_checker.type};
 }
 
-PreparedQuery PrepareDumpQuery(ParsedQuery parsed_query, CurrentDB &current_db) {
+PreparedQuery PrepareDumpQuery(ParsedQuery parsed_query, CurrentDB &current_db, size_t num_workers) {
   MG_ASSERT(current_db.execution_db_accessor_, "Dump query expects a current DB transaction");
   auto *dba = &*current_db.execution_db_accessor_;
-  auto plan = std::make_shared<PullPlanDump>(dba, *current_db.db_acc_);
+  auto plan = std::make_shared<PullPlanDump>(dba, *current_db.db_acc_, num_workers);
   return PreparedQuery{
       {"QUERY"},
       std::move(parsed_query.required_privileges),
@@ -2528,8 +2854,152 @@ PreparedQuery PrepareDumpQuery(ParsedQuery parsed_query, CurrentDB &current_db)
       RWType::R};
 }
 
+namespace {
+
+// Builds the bucket bounds of an equi-depth histogram over the counted values,
+// which are sorted. Every bound is the value at the position where a bucket
+// ends, so frequent values appear as several equal bounds. Returns an empty
+// histogram if there is a value which isn't a finite number.
+std::vector<double> EquiDepthHistogram(const std::map<storage::PropertyValue, int64_t> &values_map, uint64_t count) {
+  std::vector<double> histogram;
+  if (values_map.empty()) return histogram;
+  histogram.reserve(kIndexStatsHistogramBuckets + 1);
+
+  uint64_t seen = 0;
+  uint64_t bucket = 0;
+  for (const auto &[value, value_count] : values_map) {
+    if (!value.IsInt() && !value.IsDouble()) return {};
+    const auto number = value.IsInt() ? static_cast<double>(value.ValueInt()) : value.ValueDouble();
+    if (!std::isfinite(number)) return {};
+    if (histogram.empty()) histogram.push_back(number);
+    seen += value_count;
+    // Bucket `bucket` ends at the value covering its last position
+    while (bucket < kIndexStatsHistogramBuckets && seen * kIndexStatsHistogramBuckets >= (bucket + 1) * count) {
+      histogram.push_back(number);
+      ++bucket;
+    }
+  }
+  return histogram;
+}
+
+
+// Chunks each label index is split into per thread, so the threads which
+// finish early take over the chunks of the larger labels.
+constexpr size_t kAnalyzeGraphChunksPerThread = 4;
+
+// Vertices of a label which ANALYZE GRAPH reads in parallel chunks. The
+// statistics of the label and of its label property indices are all collected
+// in the same pass. A label property index whose label isn't indexed is read
+// on its own, from the columnar store if the property is a columnar property
+// of the label, otherwise as a single chunk of the vertices with the property.
+struct AnalyzeGraphScan {
+  storage::LabelId label;
+  std::vector<storage::PropertyId> properties;
+  std::vector<VerticesIterable> chunks;
+  bool columnar{false};
+};
+
+// What a chunk of a scan found. Only the sampled vertices are examined, so
+// the degrees and the property values are only counted for them.
+struct AnalyzeGraphPropertyCounts {
+  uint64_t vertices{0};
+  uint64_t total_degree{0};
+  std::map<storage::PropertyValue, int64_t> values;
+};
+
+struct AnalyzeGraphChunkCounts {
+  uint64_t vertices{0};
+  uint64_t sampled{0};
+  uint64_t total_degree{0};
+  std::vector<AnalyzeGraphPropertyCounts> properties;
+
+  void Merge(AnalyzeGraphChunkCounts &&other) {
+    vertices += other.vertices;
+    sampled += other.sampled;
+    total_degree += other.total_degree;
+    for (size_t i = 0; i < properties.size(); ++i) {
+      auto &counts = properties[i];
+      auto &other_counts = other.properties[i];
+      counts.vertices += other_counts.vertices;
+      counts.total_degree += other_counts.total_degree;
+      if (counts.values.size() < other_counts.values.size()) std::swap(counts.values, other_counts.values);
+      for (const auto &[value, value_count] : other_counts.values) counts.values[value] += value_count;
+    }
+  }
+};
+
+AnalyzeGraphChunkCounts CountAnalyzeGraphChunk(const AnalyzeGraphScan &scan, VerticesIterable &chunk,
+                                               uint64_t sample_rate, storage::View view) {
+  AnalyzeGraphChunkCounts counts{.properties = std::vector<AnalyzeGraphPropertyCounts>(scan.properties.size())};
+  for (const auto &vertex : chunk) {
+    if (counts.vertices++ % sample_rate != 0) continue;
+    ++counts.sampled;
+    const auto degree = *vertex.OutDegree(view) + *vertex.InDegree(view);
+    counts.total_degree += degree;
+    for (size_t i = 0; i < scan.properties.size(); ++i) {
+      auto value = *vertex.GetProperty(view, scan.properties[i]);
+      if (value.IsNull()) continue;
+      auto &property_counts = counts.properties[i];
+      ++property_counts.vertices;
+      property_counts.total_degree += degree;
+      ++property_counts.values[std::move(value)];
+    }
+  }
+  return counts;
+}
+
+// Counts the vertices of a single property scan from the columnar store, the
+// same way `CountAnalyzeGraphChunk` counts the vertices with the property.
+std::optional<AnalyzeGraphChunkCounts> CountAnalyzeGraphColumn(const AnalyzeGraphScan &scan, DbAccessor *dba,
+                                                               uint64_t sample_rate, storage::View view) {
+  AnalyzeGraphChunkCounts counts{.properties = std::vector<AnalyzeGraphPropertyCounts>(1)};
+  auto &property_counts = counts.properties[0];
+  const auto exists = dba->ScanColumnarProperty(
+      view, scan.label, scan.properties[0], [&](const VertexAccessor &vertex, const storage::PropertyValue &value) {
+        if (value.IsNull()) return;
+        if (counts.vertices++ % sample_rate != 0) return;
+        ++counts.sampled;
+        const auto degree = *vertex.OutDegree(view) + *vertex.InDegree(view);
+        counts.total_degree += degree;
+        ++property_counts.vertices;
+        property_counts.total_degree += degree;
+        ++property_counts.values[value];
+      });
+  if (!exists) return std::nullopt;
+  return counts;
+}
+
+// Scales the counts of the sampled vertices up to all of the vertices of the
+// index. Values which were sampled once are assumed to be mostly unique, so
+// the number of distinct values is scaled by them alone.
+storage::LabelPropertyIndexStats LabelPropertyIndexStatsFromSample(const AnalyzeGraphPropertyCounts &counts,
+                                                                   double scale) {
+  const auto count = static_cast<uint64_t>(std::llround(static_cast<double>(counts.vertices) * scale));
+  const auto sampled_once = static_cast<size_t>(std::count_if(
+      counts.values.begin(), counts.values.end(), [](const auto &value_entry) { return value_entry.second == 1; }));
+  const auto distinct_values_count = std::min(
+      count, static_cast<uint64_t>(std::llround(static_cast<double>(counts.values.size() - sampled_once) +
+                                                static_cast<double>(sampled_once) * scale)));
+  const auto avg_group_size =
+      distinct_values_count > 0 ? static_cast<double>(count) / static_cast<double>(distinct_values_count) : 0;
+  const auto chi_squared_stat = std::accumulate(
+      counts.values.begin(), counts.values.end(), 0.0, [avg_group_size, scale](double prev_result, const auto &entry) {
+        return prev_result + utils::ChiSquaredValue(static_cast<double>(entry.second) * scale, avg_group_size);
+      });
+  const auto average_degree =
+      counts.vertices > 0 ? static_cast<double>(counts.total_degree) / static_cast<double>(counts.vertices) : 0;
+  return storage::LabelPropertyIndexStats{.count = count,
+                                          .distinct_values_count = distinct_values_count,
+                                          .statistic = chi_squared_stat,
+                                          .avg_group_size = avg_group_size,
+                                          .avg_degree = average_degree,
+                                          .histogram = EquiDepthHistogram(counts.values, counts.vertices)};
+}
+
+}  // namespace
+
 std::vector<std::vector<TypedValue>> AnalyzeGraphQueryHandler::AnalyzeGraphCreateStatistics(
-    const std::span<std::string> labels, DbAccessor *execution_db_accessor) {
+    const std::span<std::string> labels, DbAccessor *execution_db_accessor, uint64_t sample_rate) {
   using LPIndex = std::pair<storage::LabelId, storage::PropertyId>;
   auto view = storage::View::OLD;
 
@@ -2561,91 +3031,105 @@ std::vector<std::vector<TypedValue>> AnalyzeGraphQueryHandler::AnalyzeGraphCreat
     }
   };
 
-  auto populate_label_stats = [execution_db_accessor, view](auto index_info) {
-    std::vector<std::pair<storage::LabelId, storage::LabelIndexStats>> label_stats;
-    label_stats.reserve(index_info.size());
-    std::for_each(index_info.begin(), index_info.end(),
-                  [execution_db_accessor, view, &label_stats](const storage::LabelId &label_id) {
-                    auto vertices = execution_db_accessor->Vertices(view, label_id);
-                    uint64_t no_vertices{0};
-                    uint64_t total_degree{0};
-                    std::for_each(vertices.begin(), vertices.end(),
-                                  [&total_degree, &no_vertices, &view](const auto &vertex) {
-                                    no_vertices++;
-                                    total_degree += *vertex.OutDegree(view) + *vertex.InDegree(view);
-                                  });
-
-                    auto average_degree =
-                        no_vertices > 0 ? static_cast<double>(total_degree) / static_cast<double>(no_vertices) : 0;
-                    auto index_stats = storage::LabelIndexStats{.count = no_vertices, .avg_degree = average_degree};
-                    execution_db_accessor->SetIndexStats(label_id, index_stats);
-                    label_stats.emplace_back(label_id, index_stats);
-                  });
-
-    return label_stats;
-  };
-
-  auto populate_label_property_stats = [execution_db_accessor, view](auto &index_info) {
-    std::map<LPIndex, std::map<storage::PropertyValue, int64_t>> label_property_counter;
-    std::map<LPIndex, uint64_t> vertex_degree_counter;
-    // Iterate over all label property indexed vertices
-    std::for_each(
-        index_info.begin(), index_info.end(),
-        [execution_db_accessor, &label_property_counter, &vertex_degree_counter, view](const LPIndex &index_element) {
-          auto &lp_counter = label_property_counter[index_element];
-          auto &vd_counter = vertex_degree_counter[index_element];
-          auto vertices = execution_db_accessor->Vertices(view, index_element.first, index_element.second);
-          std::for_each(vertices.begin(), vertices.end(),
-                        [&index_element, &lp_counter, &vd_counter, &view](const auto &vertex) {
-                          lp_counter[*vertex.GetProperty(view, index_element.second)]++;
-                          vd_counter += *vertex.OutDegree(view) + *vertex.InDegree(view);
-                        });
-        });
-
-    std::vector<std::pair<LPIndex, storage::LabelPropertyIndexStats>> label_property_stats;
-    label_property_stats.reserve(label_property_counter.size());
-    std::for_each(
-        label_property_counter.begin(), label_property_counter.end(),
-        [execution_db_accessor, &vertex_degree_counter, &label_property_stats](const auto &counter_entry) {
-          const auto &[label_property, values_map] = counter_entry;
-          // Extract info
-          uint64_t count_property_value = std::accumulate(
-              values_map.begin(), values_map.end(), 0,
-              [](uint64_t prev_value, const auto &prop_value_count) { return prev_value + prop_value_count.second; });
-          // num_distinc_values will never be 0
-          double avg_group_size = static_cast<double>(count_property_value) / static_cast<double>(values_map.size());
-          double chi_squared_stat = std::accumulate(
-              values_map.begin(), values_map.end(), 0.0, [avg_group_size](double prev_result, const auto &value_entry) {
-                return prev_result + utils::ChiSquaredValue(value_entry.second, avg_group_size);
-              });
-
-          double average_degree = count_property_value > 0
-                                      ? static_cast<double>(vertex_degree_counter[label_property]) /
-                                            static_cast<double>(count_property_value)
-                                      : 0;
-
-          auto index_stats =
-              storage::LabelPropertyIndexStats{.count = count_property_value,
-                                               .distinct_values_count = static_cast<uint64_t>(values_map.size()),
-                                               .statistic = chi_squared_stat,
-                                               .avg_group_size = avg_group_size,
-                                               .avg_degree = average_degree};
-          execution_db_accessor->SetIndexStats(label_property.first, label_property.second, index_stats);
-          label_property_stats.push_back(std::make_pair(label_property, index_stats));
-        });
-
-    return label_property_stats;
-  };
-
   auto index_info = execution_db_accessor->ListAllIndices();
 
   std::vector<storage::LabelId> label_indices_info = index_info.label;
   erase_not_specified_label_indices(label_indices_info);
-  auto label_stats = populate_label_stats(label_indices_info);
 
   std::vector<LPIndex> label_property_indices_info = index_info.label_property;
   erase_not_specified_label_property_indices(label_property_indices_info);
-  auto label_property_stats = populate_label_property_stats(label_property_indices_info);
+  std::sort(label_property_indices_info.begin(), label_property_indices_info.end());
+
+  // The other storage modes don't support concurrent readers of a transaction
+  const auto parallel = execution_db_accessor->GetStorageMode() != storage::StorageMode::ON_DISK_TRANSACTIONAL &&
+                        execution_db_accessor->GetTransactionId().has_value();
+  const auto num_chunks = parallel ? (utils::CpuThreadPool().Size() + 1) * kAnalyzeGraphChunksPerThread : 1;
+  sample_rate = std::max<uint64_t>(sample_rate, 1);
+
+  std::vector<AnalyzeGraphScan> scans;
+  std::vector<std::pair<size_t, AnalyzeGraphChunkCounts>> columnar_counts;
+  std::map<storage::LabelId, size_t> label_scans;
+  for (const auto label : label_indices_info) {
+    label_scans.emplace(label, scans.size());
+    scans.push_back({.label = label});
+  }
+  std::vector<std::pair<size_t, size_t>> label_property_scans;
+  label_property_scans.reserve(label_property_indices_info.size());
+  for (const auto &[label, property] : label_property_indices_info) {
+    auto it = label_scans.find(label);
+    if (it == label_scans.end()) {
+      label_property_scans.emplace_back(scans.size(), 0);
+      auto &scan = scans.emplace_back(AnalyzeGraphScan{.label = label, .properties = {property}});
+      if (auto counts = CountAnalyzeGraphColumn(scan, execution_db_accessor, sample_rate, view)) {
+        scan.columnar = true;
+        columnar_counts.emplace_back(scans.size() - 1, std::move(*counts));
+        continue;
+      }
+      scan.chunks.push_back(execution_db_accessor->Vertices(view, label, property));
+      continue;
+    }
+    auto &scan = scans[it->second];
+    label_property_scans.emplace_back(it->second, scan.properties.size());
+    scan.properties.push_back(property);
+  }
+  for (auto &scan : scans) {
+    if (scan.chunks.empty() && !scan.columnar) {
+      scan.chunks = execution_db_accessor->ChunkedVertices(view, scan.label, num_chunks);
+    }
+  }
+
+  // The chunks of all scans are counted in parallel and merged per scan
+  std::vector<std::pair<size_t, size_t>> tasks;
+  for (size_t i = 0; i < scans.size(); ++i) {
+    for (size_t j = 0; j < scans[i].chunks.size(); ++j) tasks.emplace_back(i, j);
+  }
+  std::vector<AnalyzeGraphChunkCounts> task_counts(tasks.size());
+  auto count_task = [&](size_t task) {
+    auto &scan = scans[tasks[task].first];
+    task_counts[task] = CountAnalyzeGraphChunk(scan, scan.chunks[tasks[task].second], sample_rate, view);
+  };
+  if (parallel && tasks.size() > 1) {
+    execution_db_accessor->SetParallelReadersActive(true);
+    utils::OnScopeExit readers_done{
+        [execution_db_accessor] { execution_db_accessor->SetParallelReadersActive(false); }};
+    utils::CpuThreadPool().RunParallel(tasks.size(), count_task);
+  } else {
+    for (size_t task = 0; task < tasks.size(); ++task) count_task(task);
+  }
+
+  std::vector<AnalyzeGraphChunkCounts> scan_counts;
+  scan_counts.reserve(scans.size());
+  for (const auto &scan : scans) {
+    scan_counts.push_back({.properties = std::vector<AnalyzeGraphPropertyCounts>(scan.properties.size())});
+  }
+  for (size_t task = 0; task < tasks.size(); ++task) scan_counts[tasks[task].first].Merge(std::move(task_counts[task]));
+  for (auto &[scan, counts] : columnar_counts) scan_counts[scan].Merge(std::move(counts));
+  task_counts.clear();
+  auto scale = [&scan_counts](size_t scan) {
+    const auto &counts = scan_counts[scan];
+    return counts.sampled > 0 ? static_cast<double>(counts.vertices) / static_cast<double>(counts.sampled) : 1.0;
+  };
+
+  std::vector<std::pair<storage::LabelId, storage::LabelIndexStats>> label_stats;
+  label_stats.reserve(label_indices_info.size());
+  for (const auto label : label_indices_info) {
+    const auto &counts = scan_counts[label_scans.at(label)];
+    auto average_degree =
+        counts.sampled > 0 ? static_cast<double>(counts.total_degree) / static_cast<double>(counts.sampled) : 0;
+    auto index_stats = storage::LabelIndexStats{.count = counts.vertices, .avg_degree = average_degree};
+    execution_db_accessor->SetIndexStats(label, index_stats);
+    label_stats.emplace_back(label, index_stats);
+  }
+
+  std::vector<std::pair<LPIndex, storage::LabelPropertyIndexStats>> label_property_stats;
+  label_property_stats.reserve(label_property_indices_info.size());
+  for (size_t i = 0; i < label_property_indices_info.size(); ++i) {
+    const auto &[label, property] = label_property_indices_info[i];
+    const auto [scan, position] = label_property_scans[i];
+    auto index_stats = LabelPropertyIndexStatsFromSample(scan_counts[scan].properties[position], scale(scan));
+    execution_db_accessor->SetIndexStats(label, property, index_stats);
+    label_property_stats.emplace_back(label_property_indices_info[i], std::move(index_stats));
+  }
 
   std::vector<std::vector<TypedValue>> results;
   results.reserve(label_stats.size() + label_property_stats.size());
@@ -2766,7 +3250,8 @@ std::vector<std::vector<TypedValue>> AnalyzeGraphQueryHandler::AnalyzeGraphDelet
   return results;
 }
 
-Callback HandleAnalyzeGraphQuery(AnalyzeGraphQuery *analyze_graph_query, DbAccessor *execution_db_accessor) {
+Callback HandleAnalyzeGraphQuery(AnalyzeGraphQuery *analyze_graph_query, DbAccessor *execution_db_accessor,
+                                 uint64_t sample_rate) {
   Callback callback;
   switch (analyze_graph_query->action_) {
     case AnalyzeGraphQuery::Action::ANALYZE: {
@@ -2774,8 +3259,8 @@ Callback HandleAnalyzeGraphQuery(AnalyzeGraphQuery *analyze_graph_query, DbAcces
                          "num groups", "avg group size", "chi-squared value",
                          "avg degree"};
       callback.fn = [handler = AnalyzeGraphQueryHandler(), labels = analyze_graph_query->labels_,
-                     execution_db_accessor]() mutable {
-        return handler.AnalyzeGraphCreateStatistics(labels, execution_db_accessor);
+                     execution_db_accessor, sample_rate]() mutable {
+        return handler.AnalyzeGraphCreateStatistics(labels, execution_db_accessor, sample_rate);
       };
       break;
     }
@@ -2792,16 +3277,15 @@ Callback HandleAnalyzeGraphQuery(AnalyzeGraphQuery *analyze_graph_query, DbAcces
   return callback;
 }
 
-PreparedQuery PrepareAnalyzeGraphQuery(ParsedQuery parsed_query, bool in_explicit_transaction, CurrentDB &current_db) {
+PreparedQuery PrepareAnalyzeGraphQuery(ParsedQuery parsed_query, bool in_explicit_transaction, CurrentDB &current_db,
+                                       uint64_t sample_rate) {
   if (in_explicit_transaction) {
     throw AnalyzeGraphInMulticommandTxException();
   }
   MG_ASSERT(current_db.db_acc_, "Analyze Graph query expects a current DB");
 
   // Creating an index influences computed plan costs.
-  auto invalidate_plan_cache = [plan_cache = current_db.db_acc_->get()->plan_cache()] {
-    plan_cache->WithLock([&](auto &cache) { cache.reset(); });
-  };
+  auto invalidate_plan_cache = [plan_cache = current_db.db_acc_->get()->plan_cache()] { plan_cache->reset(); };
   utils::OnScopeExit cache_invalidator(invalidate_plan_cache);
 
   auto *analyze_graph_query = utils::Downcast<AnalyzeGraphQuery>(parsed_query.query);
@@ -2810,7 +3294,7 @@ PreparedQuery PrepareAnalyzeGraphQuery(ParsedQuery parsed_query, bool in_explici
   MG_ASSERT(current_db.execution_db_accessor_, "Analyze Graph query expects a current DB transaction");
   auto *dba = &*current_db.execution_db_accessor_;
 
-  auto callback = HandleAnalyzeGraphQuery(analyze_graph_query, dba);
+  auto callback = HandleAnalyzeGraphQuery(analyze_graph_query, dba, sample_rate);
 
   return PreparedQuery{std::move(callback.header), std::move(parsed_query.required_privileges),
                        [callback_fn = std::move(callback.fn), pull_plan = std::shared_ptr<PullPlanVector>{nullptr}](
@@ -2844,9 +3328,7 @@ PreparedQuery PrepareIndexQuery(ParsedQuery parsed_query, bool in_explicit_trans
   auto *dba = &*current_db.execution_db_accessor_;
 
   // Creating an index influences computed plan costs.
-  auto invalidate_plan_cache = [plan_cache = db_acc->plan_cache()] {
-    plan_cache->WithLock([&](auto &cache) { cache.reset(); });
-  };
+  auto invalidate_plan_cache = [plan_cache = db_acc->plan_cache()] { plan_cache->reset(); };
 
   auto *storage = db_acc->storage();
   auto label = storage->NameToLabel(index_query->label_.name);
@@ -2860,8 +3342,8 @@ PreparedQuery PrepareIndexQuery(ParsedQuery parsed_query, bool in_explicit_trans
     properties_string.push_back(prop.name);
   }
 
-  if (properties.size() > 1) {
-    throw utils::NotYetImplemented("index on multiple properties");
+  if (std::unordered_set<storage::PropertyId>(properties.begin(), properties.end()).size() != properties.size()) {
+    throw SemanticException("The properties of an index must be distinct.");
   }
 
   auto properties_stringified = utils::Join(properties_string, ", ");
@@ -2877,8 +3359,11 @@ PreparedQuery PrepareIndexQuery(ParsedQuery parsed_query, bool in_explicit_trans
       handler = [dba, label, properties_stringified = std::move(properties_stringified),
                  label_name = index_query->label_.name, properties = std::move(properties),
                  invalidate_plan_cache = std::move(invalidate_plan_cache)](Notification &index_notification) {
-        MG_ASSERT(properties.size() <= 1U);
-        auto maybe_index_error = properties.empty() ? dba->CreateIndex(label) : dba->CreateIndex(label, properties[0]);
+        auto maybe_index_error = [&] {
+          if (properties.empty()) return dba->CreateIndex(label);
+          if (properties.size() == 1) return dba->CreateIndex(label, properties[0]);
+          return dba->CreateIndex(label, properties);
+        }();
         utils::OnScopeExit invalidator(invalidate_plan_cache);
 
         if (maybe_index_error.HasError()) {
@@ -2898,8 +3383,11 @@ PreparedQuery PrepareIndexQuery(ParsedQuery parsed_query, bool in_explicit_trans
       handler = [dba, label, properties_stringified = std::move(properties_stringified),
                  label_name = index_query->label_.name, properties = std::move(properties),
                  invalidate_plan_cache = std::move(invalidate_plan_cache)](Notification &index_notification) {
-        MG_ASSERT(properties.size() <= 1U);
-        auto maybe_index_error = properties.empty() ? dba->DropIndex(label) : dba->DropIndex(label, properties[0]);
+        auto maybe_index_error = [&] {
+          if (properties.empty()) return dba->DropIndex(label);
+          if (properties.size() == 1) return dba->DropIndex(label, properties[0]);
+          return dba->DropIndex(label, properties);
+        }();
         utils::OnScopeExit invalidator(invalidate_plan_cache);
 
         if (maybe_index_error.HasError()) {
@@ -2943,9 +3431,7 @@ PreparedQuery PrepareEdgeIndexQuery(ParsedQuery parsed_query, bool in_explicit_t
   MG_ASSERT(current_db.db_transactional_accessor_, "Index query expects a current DB transaction");
   auto *dba = &*current_db.execution_db_accessor_;
 
-  auto invalidate_plan_cache = [plan_cache = db_acc->plan_cache()] {
-    plan_cache->WithLock([&](auto &cache) { cache.reset(); });
-  };
+  auto invalidate_plan_cache = [plan_cache = db_acc->plan_cache()] { plan_cache->reset(); };
 
   auto *storage = db_acc->storage();
   auto edge_type = storage->NameToEdgeType(index_query->edge_type_.name);
@@ -3041,9 +3527,7 @@ PreparedQuery PreparePointIndexQuery(ParsedQuery parsed_query, bool in_explicit_
   MG_ASSERT(current_db.db_transactional_accessor_, "Index query expects a current DB transaction");
   auto *dba = &*current_db.execution_db_accessor_;
 
-  auto const invalidate_plan_cache = [plan_cache = db_acc->plan_cache()] {
-    plan_cache->WithLock([&](auto &cache) { cache.reset(); });
-  };
+  auto const invalidate_plan_cache = [plan_cache = db_acc->plan_cache()] { plan_cache->reset(); };
 
   auto label_name = index_query->label_.name;
   auto prop_name = index_query->property_.name;
@@ -3106,6 +3590,86 @@ PreparedQuery PreparePointIndexQuery(ParsedQuery parsed_query, bool in_explicit_
       RWType::W};
 }
 
+PreparedQuery PrepareVectorIndexQuery(ParsedQuery parsed_query, bool in_explicit_transaction,
+                                      std::vector<Notification> *notifications, CurrentDB &current_db) {
+  if (in_explicit_transaction) {
+    throw IndexInMulticommandTxException();
+  }
+
+  auto *index_query = utils::Downcast<VectorIndexQuery>(parsed_query.query);
+  std::function<Notification(void)> handler;
+
+  MG_ASSERT(current_db.db_acc_, "Index query expects a current DB");
+  auto &db_acc = *current_db.db_acc_;
+
+  MG_ASSERT(current_db.db_transactional_accessor_, "Index query expects a current DB transaction");
+  auto *dba = &*current_db.execution_db_accessor_;
+
+  auto const invalidate_plan_cache = [plan_cache = db_acc->plan_cache()] { plan_cache->reset(); };
+
+  auto label_name = index_query->label_.name;
+  auto prop_name = index_query->property_.name;
+  auto dimension = index_query->dimension_;
+  auto *storage = db_acc->storage();
+
+  switch (index_query->action_) {
+    case VectorIndexQuery::Action::CREATE: {
+      handler = [label_name = std::move(label_name), prop_name = std::move(prop_name), dimension, dba, storage,
+                 invalidate_plan_cache = std::move(invalidate_plan_cache)]() {
+        Notification index_notification(SeverityLevel::INFO);
+        index_notification.code = NotificationCode::CREATE_INDEX;
+        index_notification.title = fmt::format("Created vector index on label {}, property {} with dimension {}.",
+                                               label_name, prop_name, dimension);
+
+        auto label_id = storage->NameToLabel(label_name);
+        auto prop_id = storage->NameToProperty(prop_name);
+
+        auto maybe_index_error = dba->CreateVectorIndex({label_id, prop_id, dimension});
+        utils::OnScopeExit const invalidator(invalidate_plan_cache);
+
+        if (maybe_index_error.HasError()) {
+          index_notification.code = NotificationCode::EXISTENT_INDEX;
+          index_notification.title =
+              fmt::format("Vector index on label {} and property {} already exists.", label_name, prop_name);
+        }
+        return index_notification;
+      };
+      break;
+    }
+    case VectorIndexQuery::Action::DROP: {
+      handler = [label_name = std::move(label_name), prop_name = std::move(prop_name), dba, storage,
+                 invalidate_plan_cache = std::move(invalidate_plan_cache)]() {
+        Notification index_notification(SeverityLevel::INFO);
+        index_notification.code = NotificationCode::DROP_INDEX;
+        index_notification.title = fmt::format("Dropped vector index on label {}, property {}.", label_name, prop_name);
+
+        auto label_id = storage->NameToLabel(label_name);
+        auto prop_id = storage->NameToProperty(prop_name);
+
+        auto maybe_index_error = dba->DropVectorIndex(label_id, prop_id);
+        utils::OnScopeExit const invalidator(invalidate_plan_cache);
+
+        if (maybe_index_error.HasError()) {
+          index_notification.code = NotificationCode::NONEXISTENT_INDEX;
+          index_notification.title =
+              fmt::format("Vector index on label {} and property {} doesn't exist.", label_name, prop_name);
+        }
+        return index_notification;
+      };
+      break;
+    }
+  }
+
+  return PreparedQuery{
+      {},
+      std::move(parsed_query.required_privileges),
+      [handler = std::move(handler), notifications](AnyStream * /*stream*/, std::optional<int> /*unused*/) mutable {
+        notifications->push_back(handler());
+        return QueryHandlerResult::COMMIT;
+      },
+      RWType::W};
+}
+
 PreparedQuery PrepareTextIndexQuery(ParsedQuery parsed_query, bool in_explicit_transaction,
                                     std::vector<Notification> *notifications, CurrentDB &current_db) {
   if (in_explicit_transaction) {
@@ -3123,9 +3687,7 @@ PreparedQuery PrepareTextIndexQuery(ParsedQuery parsed_query, bool in_explicit_t
   auto *dba = &*current_db.execution_db_accessor_;
 
   // Creating an index influences computed plan costs.
-  auto invalidate_plan_cache = [plan_cache = db_acc->plan_cache()] {
-    plan_cache->WithLock([&](auto &cache) { cache.reset(); });
-  };
+  auto invalidate_plan_cache = [plan_cache = db_acc->plan_cache()] { plan_cache->reset(); };
 
   auto *storage = db_acc->storage();
   auto label = storage->NameToLabel(text_index_query->label_.name);
@@ -3200,9 +3762,7 @@ PreparedQuery PrepareTtlQuery(ParsedQuery parsed_query, bool in_explicit_transac
   auto label = storage->NameToLabel("TTL");
   auto prop = storage->NameToProperty("ttl");
 
-  auto invalidate_plan_cache = [plan_cache = db_acc->plan_cache()] {
-    plan_cache->WithLock([&](auto &cache) { cache.reset(); });
-  };
+  auto invalidate_plan_cache = [plan_cache = db_acc->plan_cache()] { plan_cache->reset(); };
 
   Notification notification(SeverityLevel::INFO);
   switch (ttl_query->type_) {
@@ -4010,6 +4570,25 @@ PreparedQuery PrepareSettingQuery(ParsedQuery parsed_query, bool in_explicit_tra
   // NOLINTNEXTLINE(clang-analyzer-cplusplus.NewDeleteLeaks)
 }
 
+std::map<std::string, TypedValue> ResourceUsageToMap(const TransactionResourceUsage &usage) {
+  auto value = [](const std::atomic<uint64_t> &counter) {
+    return TypedValue(static_cast<int64_t>(counter.load(std::memory_order_relaxed)));
+  };
+  return {{"deltas", value(usage.deltas)},
+          {"peak_memory", value(usage.peak_memory)},
+          {"scanned_vertices", value(usage.scanned_vertices)},
+          {"lock_wait_us", value(usage.lock_wait_us)},
+          {"wal_bytes", value(usage.wal_bytes)}};
+}
+
+std::string ResourceUsageToString(const TransactionResourceUsage &usage) {
+  return fmt::format(
+      "Transaction resource usage: deltas: {}, peak memory: {}, scanned vertices: {}, lock wait: {} us, WAL bytes: {}",
+      usage.deltas.load(std::memory_order_relaxed), usage.peak_memory.load(std::memory_order_relaxed),
+      usage.scanned_vertices.load(std::memory_order_relaxed), usage.lock_wait_us.load(std::memory_order_relaxed),
+      usage.wal_bytes.load(std::memory_order_relaxed));
+}
+
 template <typename Func>
 auto ShowTransactions(const std::unordered_set<Interpreter *> &interpreters, QueryUserOrRole *user_or_role,
                       Func &&privilege_checker) -> std::vector<std::vector<TypedValue>> {
@@ -4054,6 +4633,7 @@ auto ShowTransactions(const std::unordered_set<Interpreter *> &interpreters, Que
         }
       }
       results.back().emplace_back(metadata_tv);
+      results.back().emplace_back(ResourceUsageToMap(interpreter->resource_usage_));
     }
   }
   return results;
@@ -4074,7 +4654,7 @@ Callback HandleTransactionQueueQuery(TransactionQueueQuery *transaction_query,
                                 privilege_checker = std::move(privilege_checker)](const auto &interpreters) {
         return ShowTransactions(interpreters, user_or_role.get(), privilege_checker);
       };
-      callback.header = {"username", "transaction_id", "query", "metadata"};
+      callback.header = {"username", "transaction_id", "query", "metadata", "resource_usage"};
       callback.fn = [interpreter_context, show_transactions = std::move(show_transactions)] {
         // Multiple simultaneous SHOW TRANSACTIONS aren't allowed
         return interpreter_context->interpreters.WithLock(show_transactions);
@@ -4167,6 +4747,8 @@ PreparedQuery PrepareDatabaseInfoQuery(ParsedQuery parsed_query, bool in_explici
         const std::string_view edge_type_property_index_mark{"edge-type+property"};
         const std::string_view text_index_mark{"text"};
         const std::string_view point_label_property_index_mark{"point"};
+        const std::string_view vector_label_property_index_mark{"vector"};
+        const std::string_view label_property_composite_index_mark{"label+properties"};
         auto info = dba->ListAllIndices();
         auto storage_acc = database->Access();
         std::vector<std::vector<TypedValue>> results;
@@ -4199,6 +4781,20 @@ PreparedQuery PrepareDatabaseInfoQuery(ParsedQuery parsed_query, bool in_explici
                              TypedValue(storage->PropertyToName(prop_id)),
                              TypedValue(static_cast<int>(storage_acc->ApproximatePointCount(label_id, prop_id)))});
         }
+        for (const auto &[label_id, prop_id, dimension] : info.vector_label_property) {
+          results.push_back({TypedValue(vector_label_property_index_mark), TypedValue(storage->LabelToName(label_id)),
+                             TypedValue(storage->PropertyToName(prop_id)),
+                             TypedValue(static_cast<int>(storage_acc->ApproximateVectorCount(label_id, prop_id)))});
+        }
+        for (const auto &[label_id, prop_ids] : info.label_property_composite) {
+          std::vector<std::string> property_names;
+          property_names.reserve(prop_ids.size());
+          for (auto prop_id : prop_ids) property_names.push_back(storage->PropertyToName(prop_id));
+          results.push_back(
+              {TypedValue(label_property_composite_index_mark), TypedValue(storage->LabelToName(label_id)),
+               TypedValue(utils::Join(property_names, ", ")),
+               TypedValue(static_cast<int>(storage_acc->ApproximateVertexCount(label_id, prop_ids)))});
+        }
 
         std::sort(results.begin(), results.end(), [&label_index_mark](const auto &record_1, const auto &record_2) {
           const auto type_1 = record_1[0].ValueString();
@@ -4362,8 +4958,8 @@ PreparedQuery PrepareSystemInfoQuery(ParsedQuery parsed_query, bool in_explicit_
     case SystemInfoQuery::InfoType::STORAGE: {
       MG_ASSERT(current_db.db_acc_, "System storage info query expects a current DB");
       header = {"storage info", "value"};
-      handler = [storage = current_db.db_acc_->get()->storage(), interpreter_isolation_level,
-                 next_transaction_isolation_level] {
+      handler = [db = current_db.db_acc_->get(), storage = current_db.db_acc_->get()->storage(),
+                 interpreter_isolation_level, next_transaction_isolation_level] {
         auto info = storage->GetBaseInfo();
         const auto vm_max_map_count = utils::GetVmMaxMapCount();
         const int64_t vm_max_map_count_storage_info =
@@ -4383,6 +4979,10 @@ PreparedQuery PrepareSystemInfoQuery(ParsedQuery parsed_query, bool in_explicit_
              TypedValue(utils::GetReadableSize(static_cast<double>(utils::total_memory_tracker.Amount())))},
             {TypedValue("allocation_limit"),
              TypedValue(utils::GetReadableSize(static_cast<double>(utils::total_memory_tracker.HardLimit())))},
+            {TypedValue("database_memory_tracked"),
+             TypedValue(utils::GetReadableSize(static_cast<double>(db->arena().Amount())))},
+            {TypedValue("database_allocation_limit"),
+             TypedValue(utils::GetReadableSize(static_cast<double>(db->arena().HardLimit())))},
             {TypedValue("global_isolation_level"), TypedValue(IsolationLevelToString(storage->GetIsolationLevel()))},
             {TypedValue("session_isolation_level"), TypedValue(IsolationLevelToString(interpreter_isolation_level))},
             {TypedValue("next_session_isolation_level"),
@@ -4399,6 +4999,13 @@ PreparedQuery PrepareSystemInfoQuery(ParsedQuery parsed_query, bool in_explicit_
         return std::pair{results, QueryHandlerResult::NOTHING};
       };
     } break;
+    case SystemInfoQuery::InfoType::PROFILE: {
+      header = {"plan hash", "query", "samples", "operator", "actual hits", "absolute time"};
+      handler = [] {
+        return std::pair{plan::SampledProfilesToTable(plan::GlobalProfileSampler().Profiles()),
+                         QueryHandlerResult::NOTHING};
+      };
+    } break;
     case SystemInfoQuery::InfoType::ACTIVE_USERS: {
       header = {"username", "session uuid", "login timestamp"};
       handler = [interpreter_context] {
@@ -4702,7 +5309,10 @@ PreparedQuery PrepareConstraintQuery(ParsedQuery parsed_query, bool in_explicit_
   return PreparedQuery{{},
                        std::move(parsed_query.required_privileges),
                        [handler = std::move(handler), constraint_notification = std::move(constraint_notification),
-                        notifications](AnyStream * /*stream*/, std::optional<int> /*n*/) mutable {
+                        notifications, plan_cache = current_db.db_acc_->get()->plan_cache()](
+                           AnyStream * /*stream*/, std::optional<int> /*n*/) mutable {
+                         // Cached plans must not outlive the schema they were made for.
+                         utils::OnScopeExit invalidator([plan_cache] { plan_cache->reset(); });
                          handler(constraint_notification);
                          notifications->push_back(constraint_notification);
                          return QueryHandlerResult::COMMIT;
@@ -5165,6 +5775,14 @@ PreparedQuery PrepareShowSchemaInfoQuery(const ParsedQuery &parsed_query, Curren
                                     {"count", storage_acc->ApproximatePointCount(label_id, property)},
                                     {"type", "label+property_point"}}));
       }
+      // Vertex label property_vector
+      for (const auto &[label_id, property, dimension] : index_info.vector_label_property) {
+        node_indexes.push_back(
+            nlohmann::json::object({{"labels", {storage->LabelToName(label_id)}},
+                                    {"properties", {storage->PropertyToName(property)}},
+                                    {"count", storage_acc->ApproximateVectorCount(label_id, property)},
+                                    {"type", "label+property_vector"}}));
+      }
       // Edge type indices
       for (const auto type : index_info.edge_type) {
         edge_indexes.push_back(nlohmann::json::object({{"edge_type", {storage->EdgeTypeToName(type)}},
@@ -5250,10 +5868,11 @@ void Interpreter::BeginTransaction(QueryExtras const &extras) {
   prepared_query.query_handler(nullptr, {});
 }
 
-void Interpreter::CommitTransaction() {
+std::optional<std::string> Interpreter::CommitTransaction() {
   const auto prepared_query = PrepareTransactionQuery("COMMIT");
   prepared_query.query_handler(nullptr, {});
   ResetInterpreter();
+  return last_bookmark_;
 }
 
 void Interpreter::RollbackTransaction() {
@@ -5302,6 +5921,7 @@ void Interpreter::SetCurrentDB() { current_db_.SetCurrentDB(interpreter_context_
 
 Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string, UserParameters_fn params_getter,
                                                 QueryExtras const &extras) {
+  utils::tracing::ScopedSpan const span("interpreter.prepare");
   LogQueryMessage(fmt::format("Accepted query: {}", query_string));
   MG_ASSERT(user_or_role_, "Trying to prepare a query without a query user.");
   // Handle transaction control queries.
@@ -5347,8 +5967,7 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
   try {
     utils::Timer parsing_timer;
     LogQueryMessage("Query parsing started.");
-    ParsedQuery parsed_query = ParseQuery(query_string, params_getter(nullptr), &interpreter_context_->ast_cache,
-                                          interpreter_context_->config.query);
+    ParsedQuery parsed_query = ParseOrLookUpPreparedStatement(query_string, params_getter(nullptr), extras);
     auto parsing_time = parsing_timer.Elapsed().count();
     LogQueryMessage("Query parsing ended.");
 
@@ -5399,9 +6018,9 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
     // TODO: make a better analysis visitor over the `parsed_query.query`
     bool const unique_db_transaction =
         utils::Downcast<IndexQuery>(parsed_query.query) || utils::Downcast<EdgeIndexQuery>(parsed_query.query) ||
-        utils::Downcast<PointIndexQuery>(parsed_query.query) || utils::Downcast<TextIndexQuery>(parsed_query.query) ||
-        utils::Downcast<ConstraintQuery>(parsed_query.query) || utils::Downcast<DropGraphQuery>(parsed_query.query) ||
-        utils::Downcast<CreateEnumQuery>(parsed_query.query) ||
+        utils::Downcast<PointIndexQuery>(parsed_query.query) || utils::Downcast<VectorIndexQuery>(parsed_query.query) ||
+        utils::Downcast<TextIndexQuery>(parsed_query.query) || utils::Downcast<ConstraintQuery>(parsed_query.query) ||
+        utils::Downcast<DropGraphQuery>(parsed_query.query) || utils::Downcast<CreateEnumQuery>(parsed_query.query) ||
         utils::Downcast<AlterEnumAddValueQuery>(parsed_query.query) ||
         utils::Downcast<AlterEnumUpdateValueQuery>(parsed_query.query) || utils::Downcast<TtlQuery>(parsed_query.query);
 
@@ -5423,7 +6042,7 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
     if (current_db_.db_acc_) {
       // fix parameters, enums requires storage to map to correct enum value
       parsed_query.user_parameters = params_getter(current_db_.db_acc_->get()->storage());
-      parsed_query.parameters = PrepareQueryParameters(parsed_query.stripped_query, parsed_query.user_parameters);
+      parsed_query.parameters = PrepareQueryParameters(parsed_query.Stripped(), parsed_query.user_parameters);
     }
 
 #ifdef MG_ENTERPRISE
@@ -5441,11 +6060,18 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
     frame_change_collector_.reset();
     frame_change_collector_.emplace();
 
-    if (utils::Downcast<CypherQuery>(parsed_query.query)) {
+    if (auto *cypher_query = utils::Downcast<CypherQuery>(parsed_query.query);
+        cypher_query && !fan_out_worker_ && !cypher_query->pre_query_directives_.fan_out_databases_.empty()) {
+      prepared_query = PrepareFanOutQuery(std::move(parsed_query), query_string, params_getter,
+                                          in_explicit_transaction_, interpreter_context_, user_or_role_);
+    } else if (utils::Downcast<CypherQuery>(parsed_query.query)) {
       prepared_query =
           PrepareCypherQuery(std::move(parsed_query), &query_execution->summary, interpreter_context_, current_db_,
                              memory_resource, &query_execution->notifications, user_or_role_, &transaction_status_,
                              current_timeout_timer_, *this, &*frame_change_collector_);
+      if (fan_out_worker_ && prepared_query.rw_type != RWType::R) {
+        throw QueryRuntimeException("USING DATABASES can be used only with read queries.");
+      }
     } else if (utils::Downcast<ExplainQuery>(parsed_query.query)) {
       prepared_query = PrepareExplainQuery(std::move(parsed_query), &query_execution->summary,
                                            &query_execution->notifications, interpreter_context_, *this, current_db_);
@@ -5455,7 +6081,8 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
                                            memory_resource, user_or_role_, &transaction_status_, current_timeout_timer_,
                                            &*frame_change_collector_);
     } else if (utils::Downcast<DumpQuery>(parsed_query.query)) {
-      prepared_query = PrepareDumpQuery(std::move(parsed_query), current_db_);
+      prepared_query =
+          PrepareDumpQuery(std::move(parsed_query), current_db_, interpreter_context_->config.dump_parallel_workers);
     } else if (utils::Downcast<IndexQuery>(parsed_query.query)) {
       prepared_query = PrepareIndexQuery(std::move(parsed_query), in_explicit_transaction_,
                                          &query_execution->notifications, current_db_);
@@ -5465,6 +6092,9 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
     } else if (utils::Downcast<PointIndexQuery>(parsed_query.query)) {
       prepared_query = PreparePointIndexQuery(std::move(parsed_query), in_explicit_transaction_,
                                               &query_execution->notifications, current_db_);
+    } else if (utils::Downcast<VectorIndexQuery>(parsed_query.query)) {
+      prepared_query = PrepareVectorIndexQuery(std::move(parsed_query), in_explicit_transaction_,
+                                               &query_execution->notifications, current_db_);
     } else if (utils::Downcast<TextIndexQuery>(parsed_query.query)) {
       prepared_query = PrepareTextIndexQuery(std::move(parsed_query), in_explicit_transaction_,
                                              &query_execution->notifications, current_db_);
@@ -5476,7 +6106,8 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
       throw QueryException("Query not supported.");
 #endif  // MG_ENTERPRISE
     } else if (utils::Downcast<AnalyzeGraphQuery>(parsed_query.query)) {
-      prepared_query = PrepareAnalyzeGraphQuery(std::move(parsed_query), in_explicit_transaction_, current_db_);
+      prepared_query = PrepareAnalyzeGraphQuery(std::move(parsed_query), in_explicit_transaction_, current_db_,
+                                                interpreter_context_->config.query.analyze_graph_sample_rate);
     } else if (utils::Downcast<AuthQuery>(parsed_query.query)) {
       /// SYSTEM (Replication) PURE
       prepared_query = PrepareAuthQuery(std::move(parsed_query), in_explicit_transaction_, interpreter_context_, *this);
@@ -5638,6 +6269,22 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
     }
     query_execution->summary["db"] = *query_execution->prepared_query->db;
 
+    if (!interpreter_context_->admission.Empty() && rw_type != RWType::NONE) {
+      const auto admission_type = rw_type == RWType::R   ? QueryAdmission::QueryType::READ
+                                  : rw_type == RWType::W ? QueryAdmission::QueryType::WRITE
+                                                         : QueryAdmission::QueryType::READ_WRITE;
+      query_execution->admission_slot = interpreter_context_->admission.Admit(
+          admission_type, *query_execution->prepared_query->db, user_or_role_.get(), [this] {
+            if (transaction_status_.load(std::memory_order_acquire) == TransactionStatus::TERMINATED) {
+              return AbortReason::TERMINATED;
+            }
+            if (interpreter_context_->is_shutting_down.load(std::memory_order_acquire)) {
+              return AbortReason::SHUTDOWN;
+            }
+            return AbortReason::NO_ABORT;
+          });
+    }
+
     // prepare is done, move system txn guard to be owned by interpreter
     system_transaction_ = std::move(system_transaction);
     return {query_execution->prepared_query->header, query_execution->prepared_query->privileges, qid,
@@ -5654,13 +6301,129 @@ Interpreter::PrepareResult Interpreter::Prepare(const std::string &query_string,
 }
 
 void Interpreter::SetupDatabaseTransaction(bool couldCommit, bool unique) {
+  // Getting the accessor waits for the storage locks the transaction needs
+  utils::Timer timer;
   current_db_.SetupDatabaseTransaction(GetIsolationLevelOverride(), couldCommit, unique);
+  resource_usage_.lock_wait_us.fetch_add(
+      std::chrono::duration_cast<std::chrono::microseconds>(timer.Elapsed()).count(), std::memory_order_relaxed);
+}
+
+ParsedQuery Interpreter::ParseOrLookUpPreparedStatement(const std::string &query_string,
+                                                        UserParameters const &user_parameters,
+                                                        QueryExtras const &extras) {
+  const auto max_statements = interpreter_context_->config.query.max_prepared_statements;
+  const auto prepare = extras.prepared && max_statements > 0;
+  if (prepare) {
+    if (auto it = prepared_statements_.find(query_string); it != prepared_statements_.end()) {
+      return ParsePreparedStatement(&it->second, query_string, user_parameters);
+    }
+  }
+  auto parsed_query =
+      ParseQuery(query_string, user_parameters, &interpreter_context_->ast_cache, interpreter_context_->config.query);
+  if (!prepare || !parsed_query.is_cacheable || !utils::Downcast<CypherQuery>(parsed_query.query)) {
+    return parsed_query;
+  }
+  if (prepared_statements_.size() >= max_statements) {
+    prepared_statements_.erase(prepared_statements_.begin());
+  }
+  auto [it, _] = prepared_statements_.try_emplace(query_string, query_string, parsed_query);
+  parsed_query.prepared_statement = &it->second;
+  return parsed_query;
+}
+
+namespace {
+constexpr std::string_view kBookmarkPrefix = "memgraph:";
+
+// Bookmarks have the form `memgraph:<database>:<epoch>:<last durable timestamp after the commit>`. The timestamps
+// only order the commits of a single epoch, a failover starts a new one and the commits of the old MAIN it didn't
+// replicate are lost.
+std::string MakeBookmark(std::string_view db_name, std::string_view epoch, uint64_t timestamp) {
+  return fmt::format("{}{}:{}:{}", kBookmarkPrefix, db_name, epoch, timestamp);
+}
+
+struct Bookmark {
+  std::string_view epoch;
+  uint64_t timestamp;
+};
+
+// Returns the epoch and the timestamp of the bookmark if it was made for `db_name`; bookmarks of other databases and
+// of other servers are ignored.
+std::optional<Bookmark> ParseBookmark(std::string_view bookmark, std::string_view db_name) {
+  if (!bookmark.starts_with(kBookmarkPrefix)) return std::nullopt;
+  bookmark.remove_prefix(kBookmarkPrefix.size());
+  const auto timestamp_separator = bookmark.rfind(':');
+  if (timestamp_separator == std::string_view::npos || timestamp_separator == 0) return std::nullopt;
+  const auto epoch_separator = bookmark.rfind(':', timestamp_separator - 1);
+  if (epoch_separator == std::string_view::npos || bookmark.substr(0, epoch_separator) != db_name) return std::nullopt;
+  const auto timestamp_str = bookmark.substr(timestamp_separator + 1);
+  uint64_t timestamp{0};
+  const auto [ptr, ec] = std::from_chars(timestamp_str.data(), timestamp_str.data() + timestamp_str.size(), timestamp);
+  if (ec != std::errc{} || ptr != timestamp_str.data() + timestamp_str.size()) return std::nullopt;
+  return Bookmark{.epoch = bookmark.substr(epoch_separator + 1, timestamp_separator - epoch_separator - 1),
+                  .timestamp = timestamp};
+}
+
+enum class BookmarkState : uint8_t { APPLIED, PENDING, LOST };
+
+BookmarkState GetBookmarkState(const storage::ReplicationStorageState &repl_storage_state, const Bookmark &bookmark) {
+  const auto epoch = repl_storage_state.PublishedEpoch();
+  if (epoch->epoch == bookmark.epoch) {
+    return repl_storage_state.last_durable_timestamp_.load() >= bookmark.timestamp ? BookmarkState::APPLIED
+                                                                                     : BookmarkState::PENDING;
+  }
+  // An earlier epoch ended with its last commit on this instance, the later commits of it were never replicated.
+  const auto it = std::ranges::find(epoch->history, bookmark.epoch, [](const auto &entry) -> std::string_view {
+    return entry.first;
+  });
+  if (it != epoch->history.end()) {
+    return bookmark.timestamp <= it->second ? BookmarkState::APPLIED : BookmarkState::LOST;
+  }
+  // The instance didn't receive any commit of the epoch yet.
+  return BookmarkState::PENDING;
+}
+}  // namespace
+
+void Interpreter::WaitForBookmarks(const std::vector<std::string> &bookmarks) {
+  if (bookmarks.empty() || !current_db_.db_acc_) return;
+  auto *db = current_db_.db_acc_->get();
+  std::vector<Bookmark> pending;
+  for (const auto &bookmark : bookmarks) {
+    if (auto parsed = ParseBookmark(bookmark, db->name())) pending.push_back(*parsed);
+  }
+  // Only replicas and a new MAIN after a failover can be behind the bookmarks, they apply the commits of the MAIN
+  // as they arrive.
+  const auto &repl_storage_state = db->storage()->repl_storage_state_;
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(FLAGS_replication_bookmark_wait_ms);
+  while (true) {
+    const auto progress = repl_storage_state.AppliedProgress();
+    for (auto it = pending.begin(); it != pending.end();) {
+      switch (GetBookmarkState(repl_storage_state, *it)) {
+        case BookmarkState::APPLIED:
+          it = pending.erase(it);
+          break;
+        case BookmarkState::PENDING:
+          ++it;
+          break;
+        case BookmarkState::LOST:
+          throw QueryException(
+              "Database {} can't serve the bookmark with timestamp {}, its commit was lost when the epoch {} ended.",
+              db->name(), it->timestamp, it->epoch);
+      }
+    }
+    if (pending.empty()) return;
+    if (!repl_storage_state.WaitForApplied(progress, deadline)) {
+      throw QueryException("Database {} hasn't applied the commit of the bookmark with timestamp {} in {} ms.",
+                           db->name(), pending.front().timestamp, FLAGS_replication_bookmark_wait_ms);
+    }
+  }
 }
 
 void Interpreter::SetupInterpreterTransaction(const QueryExtras &extras) {
+  WaitForBookmarks(extras.bookmarks);
   metrics::IncrementCounter(metrics::ActiveTransactions);
   transaction_status_.store(TransactionStatus::ACTIVE, std::memory_order_release);
   current_transaction_ = interpreter_context_->id_handler.next();
+  resource_usage_.Reset();
   if (query_logger_) {
     query_logger_->SetTransactionId(std::to_string(*current_transaction_));
   }
@@ -5680,6 +6443,7 @@ std::vector<TypedValue> Interpreter::GetQueries() {
 void Interpreter::Abort() {
   LogQueryMessage("Query abort started.");
   utils::OnScopeExit const abort_end([this]() {
+    if (IsQueryLoggingActive()) this->LogQueryMessage(ResourceUsageToString(resource_usage_));
     this->LogQueryMessage("Query abort ended.");
     if (query_logger_) {
       query_logger_->ResetTransactionId();
@@ -5718,100 +6482,136 @@ void Interpreter::Abort() {
     memgraph::metrics::DecrementCounter(memgraph::metrics::ActiveTransactions);
   }
 
-  // if (!current_db_.db_transactional_accessor_) return;
-  current_db_.CleanupDBTransaction(true);
+  // The queries are cleaned first, like on commit, so the procedures whose records were still pulled return before
+  // the transaction they run in is gone.
   for (auto &qe : query_executions_) {
     if (qe) qe->CleanRuntimeData();
   }
+  // if (!current_db_.db_transactional_accessor_) return;
+  current_db_.CleanupDBTransaction(true);
   frame_change_collector_.reset();
 }
 
 namespace {
-void RunTriggersAfterCommit(dbms::DatabaseAccess db_acc, InterpreterContext *interpreter_context,
-                            TriggerContext original_trigger_context,
-                            std::atomic<TransactionStatus> *transaction_status) {
-  // Run the triggers
-  for (const auto &trigger : db_acc->trigger_store()->AfterCommitTriggers().access()) {
-    QueryAllocator execution_memory{};
-
-    // create a new transaction for each trigger
-    auto tx_acc = db_acc->Access();
-    DbAccessor db_accessor{tx_acc.get()};
-
-    // On-disk storage removes all Vertex/Edge Accessors because previous trigger tx finished.
-    // So we need to adapt TriggerContext based on user transaction which is still alive.
-    auto trigger_context = original_trigger_context;
-    trigger_context.AdaptForAccessor(&db_accessor);
-    try {
-      trigger.Execute(&db_accessor, db_acc, execution_memory.resource(), flags::run_time::GetExecutionTimeout(),
-                      &interpreter_context->is_shutting_down, transaction_status, trigger_context);
-    } catch (const utils::BasicException &exception) {
-      spdlog::warn("Trigger '{}' failed with exception:\n{}", trigger.Name(), exception.what());
-      db_accessor.Abort();
-      continue;
-    }
+void RunTriggerAfterCommit(const Trigger &trigger, dbms::DatabaseAccess &db_acc,
+                           InterpreterContext *interpreter_context, const TriggerContext &original_trigger_context,
+                           std::atomic<TransactionStatus> *transaction_status) {
+  QueryAllocator execution_memory{};
+
+  // create a new transaction for each trigger
+  auto tx_acc = db_acc->Access();
+  DbAccessor db_accessor{tx_acc.get()};
+
+  // On-disk storage removes all Vertex/Edge Accessors because previous trigger tx finished.
+  // So we need to adapt TriggerContext based on user transaction which is still alive.
+  auto trigger_context = original_trigger_context;
+  trigger_context.AdaptForAccessor(&db_accessor);
+  try {
+    trigger.Execute(&db_accessor, db_acc, execution_memory.resource(), flags::run_time::GetExecutionTimeout(),
+                    &interpreter_context->is_shutting_down, transaction_status, trigger_context);
+  } catch (const utils::BasicException &exception) {
+    spdlog::warn("Trigger '{}' failed with exception:\n{}", trigger.Name(), exception.what());
+    db_accessor.Abort();
+    return;
+  }
 
-    bool is_main = interpreter_context->repl_state->IsMain();
-    auto maybe_commit_error = db_accessor.Commit({.is_main = is_main}, db_acc);
-
-    if (maybe_commit_error.HasError()) {
-      const auto &error = maybe_commit_error.GetError();
-
-      std::visit(
-          [&trigger, &db_accessor]<typename T>(T &&arg) {
-            using ErrorType = std::remove_cvref_t<T>;
-            if constexpr (std::is_same_v<ErrorType, storage::ReplicationError>) {
-              spdlog::warn("At least one SYNC replica has not confirmed execution of the trigger '{}'.",
-                           trigger.Name());
-            } else if constexpr (std::is_same_v<ErrorType, storage::ConstraintViolation>) {
-              const auto &constraint_violation = arg;
-              switch (constraint_violation.type) {
-                case storage::ConstraintViolation::Type::EXISTENCE: {
-                  const auto &label_name = db_accessor.LabelToName(constraint_violation.label);
-                  MG_ASSERT(constraint_violation.properties.size() == 1U);
-                  const auto &property_name = db_accessor.PropertyToName(*constraint_violation.properties.begin());
-                  spdlog::warn("Trigger '{}' failed to commit due to existence constraint violation on: {}({}) ",
-                               trigger.Name(), label_name, property_name);
-                  break;
-                }
-                case storage::ConstraintViolation::Type::UNIQUE: {
-                  const auto &label_name = db_accessor.LabelToName(constraint_violation.label);
-                  std::stringstream property_names_stream;
-                  utils::PrintIterable(
-                      property_names_stream, constraint_violation.properties, ", ",
-                      [&](auto &stream, const auto &prop) { stream << db_accessor.PropertyToName(prop); });
-                  spdlog::warn("Trigger '{}' failed to commit due to unique constraint violation on :{}({})",
-                               trigger.Name(), label_name, property_names_stream.str());
-                  break;
-                }
-                case storage::ConstraintViolation::Type::TYPE: {
-                  MG_ASSERT(constraint_violation.properties.size() == 1U);
-                  const auto &property_name = db_accessor.PropertyToName(*constraint_violation.properties.begin());
-                  const auto &label_name = db_accessor.LabelToName(constraint_violation.label);
-                  spdlog::warn("Trigger '{}' failed to commit due to type constraint violation on: {}({}) IS TYPED {}",
-                               trigger.Name(), label_name, property_name,
-                               storage::TypeConstraintKindToString(*constraint_violation.constraint_kind));
+  bool is_main = interpreter_context->repl_state->IsMain();
+  auto maybe_commit_error = db_accessor.Commit({.is_main = is_main}, db_acc);
 
-                  break;
-                }
+  if (maybe_commit_error.HasError()) {
+    const auto &error = maybe_commit_error.GetError();
+
+    std::visit(
+        [&trigger, &db_accessor]<typename T>(T &&arg) {
+          using ErrorType = std::remove_cvref_t<T>;
+          if constexpr (std::is_same_v<ErrorType, storage::ReplicationError>) {
+            spdlog::warn("At least one SYNC replica has not confirmed execution of the trigger '{}'.",
+                         trigger.Name());
+          } else if constexpr (std::is_same_v<ErrorType, storage::ConstraintViolation>) {
+            const auto &constraint_violation = arg;
+            switch (constraint_violation.type) {
+              case storage::ConstraintViolation::Type::EXISTENCE: {
+                const auto &label_name = db_accessor.LabelToName(constraint_violation.label);
+                MG_ASSERT(constraint_violation.properties.size() == 1U);
+                const auto &property_name = db_accessor.PropertyToName(*constraint_violation.properties.begin());
+                spdlog::warn("Trigger '{}' failed to commit due to existence constraint violation on: {}({}) ",
+                             trigger.Name(), label_name, property_name);
+                break;
+              }
+              case storage::ConstraintViolation::Type::UNIQUE: {
+                const auto &label_name = db_accessor.LabelToName(constraint_violation.label);
+                std::stringstream property_names_stream;
+                utils::PrintIterable(
+                    property_names_stream, constraint_violation.properties, ", ",
+                    [&](auto &stream, const auto &prop) { stream << db_accessor.PropertyToName(prop); });
+                spdlog::warn("Trigger '{}' failed to commit due to unique constraint violation on :{}({})",
+                             trigger.Name(), label_name, property_names_stream.str());
+                break;
+              }
+              case storage::ConstraintViolation::Type::TYPE: {
+                MG_ASSERT(constraint_violation.properties.size() == 1U);
+                const auto &property_name = db_accessor.PropertyToName(*constraint_violation.properties.begin());
+                const auto &label_name = db_accessor.LabelToName(constraint_violation.label);
+                spdlog::warn("Trigger '{}' failed to commit due to type constraint violation on: {}({}) IS TYPED {}",
+                             trigger.Name(), label_name, property_name,
+                             storage::TypeConstraintKindToString(*constraint_violation.constraint_kind));
+
+                break;
               }
-            } else if constexpr (std::is_same_v<ErrorType, storage::SerializationError>) {
-              throw QueryException("Unable to commit due to serialization error.");
-            } else if constexpr (std::is_same_v<ErrorType, storage::PersistenceError>) {
-              throw QueryException("Unable to commit due to persistance error.");
-            } else {
-              static_assert(kAlwaysFalse<T>, "Missing type from variant visitor");
             }
-          },
-          error);
+          } else if constexpr (std::is_same_v<ErrorType, storage::SerializationError>) {
+            throw QueryException("Unable to commit due to serialization error.");
+          } else if constexpr (std::is_same_v<ErrorType, storage::PersistenceError>) {
+            throw QueryException("Unable to commit due to persistance error.");
+          } else {
+            static_assert(kAlwaysFalse<T>, "Missing type from variant visitor");
+          }
+        },
+        error);
+  }
+}
+
+void RunTriggersAfterCommit(dbms::DatabaseAccess db_acc, InterpreterContext *interpreter_context,
+                            TriggerContext original_trigger_context,
+                            std::atomic<TransactionStatus> *transaction_status) {
+  auto triggers_acc = db_acc->trigger_store()->AfterCommitTriggers().access();
+  std::vector<const Trigger *> triggers;
+  for (const auto &trigger : triggers_acc) triggers.push_back(&trigger);
+
+  const auto num_workers = std::min<size_t>(interpreter_context->config.trigger_parallel_workers, triggers.size());
+  if (num_workers <= 1) {
+    for (const auto *trigger : triggers) {
+      RunTriggerAfterCommit(*trigger, db_acc, interpreter_context, original_trigger_context, transaction_status);
     }
+    return;
+  }
+
+  // Each trigger runs in its own transaction, so they only depend on each other through conflicting changes
+  std::atomic<size_t> next_trigger{0};
+  std::vector<std::jthread> workers;
+  workers.reserve(num_workers);
+  for (size_t i = 0; i < num_workers; ++i) {
+    workers.emplace_back([&] {
+      utils::ThreadSetName("TriggerWorker");
+      for (auto idx = next_trigger.fetch_add(1, std::memory_order_acq_rel); idx < triggers.size();
+           idx = next_trigger.fetch_add(1, std::memory_order_acq_rel)) {
+        try {
+          RunTriggerAfterCommit(*triggers[idx], db_acc, interpreter_context, original_trigger_context,
+                                transaction_status);
+        } catch (const std::exception &exception) {
+          spdlog::warn("Trigger '{}' failed with exception:\n{}", triggers[idx]->Name(), exception.what());
+        }
+      }
+    });
   }
 }
 }  // namespace
 
 void Interpreter::Commit() {
+  utils::tracing::ScopedSpan const span("interpreter.commit");
   LogQueryMessage("Query commit started.");
   utils::OnScopeExit const commit_end([this]() {
+    if (IsQueryLoggingActive()) this->LogQueryMessage(ResourceUsageToString(resource_usage_));
     this->LogQueryMessage("Query commit ended.");
     if (query_logger_) {
       query_logger_->ResetTransactionId();
@@ -5824,6 +6624,7 @@ void Interpreter::Commit() {
   // We should document clearly that all results should be pulled to complete
   // a query.
   current_transaction_.reset();
+  last_bookmark_.reset();
   if (!current_db_.db_transactional_accessor_ || !current_db_.db_acc_) {
     // No database nor db transaction; check for system transaction
     if (!system_transaction_) return;
@@ -5941,7 +6742,11 @@ void Interpreter::Commit() {
   auto commit_confirmed_by_all_sync_replicas = true;
 
   bool is_main = interpreter_context_->repl_state->IsMain();
+  // The deltas are handed over to the garbage collector by the commit
+  auto *transaction = current_db_.db_transactional_accessor_->GetTransaction();
+  resource_usage_.deltas.store(transaction->deltas.size(), std::memory_order_relaxed);
   auto maybe_commit_error = current_db_.db_transactional_accessor_->Commit({.is_main = is_main}, current_db_.db_acc_);
+  resource_usage_.wal_bytes.store(transaction->wal_bytes, std::memory_order_relaxed);
   if (maybe_commit_error.HasError()) {
     const auto &error = maybe_commit_error.GetError();
 
@@ -5987,19 +6792,36 @@ void Interpreter::Commit() {
         error);
   }
 
+  // The commit is durable on main even if a SYNC replica didn't confirm it.
+  const auto &repl_storage_state = db->storage()->repl_storage_state_;
+  last_bookmark_ = MakeBookmark(db->name(), repl_storage_state.PublishedEpoch()->epoch,
+                                repl_storage_state.last_durable_timestamp_.load());
+
   // The ordered execution of after commit triggers is heavily depending on the exclusiveness of
   // db_accessor_->Commit(): only one of the transactions can be commiting at the same time, so when the commit is
   // finished, that transaction probably will schedule its after commit triggers, because the other transactions that
   // want to commit are still waiting for commiting or one of them just started commiting its changes. This means the
   // ordered execution of after commit triggers are not guaranteed.
+  // The queued transactions are taken in queue order by a single task, which runs the triggers once for the combined
+  // changes of each batch of them.
   if (trigger_context && db->trigger_store()->AfterCommitTriggers().size() > 0) {
-    db->AddTask([this, trigger_context = std::move(*trigger_context),
-                 user_transaction = std::shared_ptr(std::move(current_db_.db_transactional_accessor_))]() mutable {
-      RunTriggersAfterCommit(*current_db_.db_acc_, interpreter_context_, std::move(trigger_context),
-                             &this->transaction_status_);
-      user_transaction->FinalizeTransaction();
-      SPDLOG_DEBUG("Finished executing after commit triggers");  // NOLINT(bugprone-lambda-function-name)
-    });
+    auto *queue = db->after_commit_trigger_queue();
+    const bool schedule =
+        queue->Push({.context = std::move(*trigger_context),
+                     .user_transaction = std::shared_ptr(std::move(current_db_.db_transactional_accessor_))});
+    if (schedule) {
+      db->AddTask([queue, db_acc = *current_db_.db_acc_, interpreter_context = interpreter_context_]() mutable {
+        const auto batch_size = interpreter_context->config.trigger_batch_size;
+        for (auto batch = queue->PopBatch(batch_size); !batch.empty(); batch = queue->PopBatch(batch_size)) {
+          auto batch_context = std::move(batch.front().context);
+          for (auto it = std::next(batch.begin()); it != batch.end(); ++it) batch_context.Append(std::move(it->context));
+          // The batch isn't tied to the status of a single user transaction
+          RunTriggersAfterCommit(db_acc, interpreter_context, std::move(batch_context), nullptr);
+          for (auto &entry : batch) entry.user_transaction->FinalizeTransaction();
+          SPDLOG_DEBUG("Finished executing after commit triggers");  // NOLINT(bugprone-lambda-function-name)
+        }
+      });
+    }
   }
 
   SPDLOG_DEBUG("Finished committing the transaction");
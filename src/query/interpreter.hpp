@@ -11,7 +11,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <string_view>
+#include <unordered_map>
 #include <unordered_set>
 
 #include <gflags/gflags.h>
@@ -24,6 +26,7 @@
 #include "query/auth_query_handler.hpp"
 #include "query/config.hpp"
 #include "query/context.hpp"
+#include "query/cypher_query_interpreter.hpp"
 #include "query/exceptions.hpp"
 #include "query/frontend/ast/ast.hpp"
 #include "query/frontend/ast/cypher_main_visitor.hpp"
@@ -32,6 +35,7 @@
 #include "query/metadata.hpp"
 #include "query/plan/operator.hpp"
 #include "query/plan/read_write_type_checker.hpp"
+#include "query/query_admission.hpp"
 #include "query/query_logger.hpp"
 #include "query/stream.hpp"
 #include "query/stream/streams.hpp"
@@ -51,6 +55,7 @@
 #include "utils/synchronized.hpp"
 #include "utils/thread_pool.hpp"
 #include "utils/timer.hpp"
+#include "utils/tracing.hpp"
 #include "utils/tsc.hpp"
 
 #ifdef MG_ENTERPRISE
@@ -114,6 +119,51 @@ struct QueryAllocator {
 #endif
 };
 
+/// Memory of the values evaluated while rows are pulled from a plan, the
+/// `EvaluationContext::memory` of its execution. The values only live during
+/// a single `Pull` of the plan root, so the memory can be released between
+/// two pulls and stays flat however many rows a streaming query yields.
+///
+/// The operators copy the values they keep for later pulls, e.g. the rows of
+/// `Accumulate` or the groups of `Aggregate`, into the memory their cursor is
+/// made with, which outlives the pulls. Assigning to a frame slot or inserting
+/// into a container with its own allocator makes such a copy.
+class PullMemory {
+ public:
+  PullMemory() { pool_.emplace(kPoolBlockPerChunk, &monotonic_, &upstream_); }
+  PullMemory(PullMemory const &) = delete;
+  PullMemory &operator=(PullMemory const &) = delete;
+
+  // No move, the pool refers to the monotonic field
+  PullMemory(PullMemory &&) = delete;
+  PullMemory &operator=(PullMemory &&) = delete;
+
+  auto resource() -> utils::MemoryResource * {
+#ifndef MG_MEMORY_PROFILE
+    return &*pool_;
+#else
+    return &upstream_;
+#endif
+  }
+
+  /// Frees all values allocated since the last release. The initial buffer
+  /// is kept for the following pulls.
+  void Release() {
+    pool_.reset();
+    monotonic_.Release();
+    pool_.emplace(kPoolBlockPerChunk, &monotonic_, &upstream_);
+  }
+
+ private:
+  static constexpr auto kInitialSize = 64UL * 1024UL;
+  static constexpr uint8_t kPoolBlockPerChunk = 64;
+
+  utils::ResourceWithOutOfMemoryException upstream_{utils::NewDeleteResource()};
+  std::unique_ptr<std::byte[]> initial_buffer_{std::make_unique<std::byte[]>(kInitialSize)};
+  utils::MonotonicBufferResource monotonic_{initial_buffer_.get(), kInitialSize, &upstream_};
+  std::optional<utils::PoolResource> pool_;
+};
+
 struct InterpreterContext;
 
 inline constexpr size_t kExecutionMemoryBlockSize = 1UL * 1024UL * 1024UL;
@@ -182,8 +232,14 @@ class AnalyzeGraphQueryHandler {
   AnalyzeGraphQueryHandler(AnalyzeGraphQueryHandler &&) = default;
   AnalyzeGraphQueryHandler &operator=(AnalyzeGraphQueryHandler &&) = default;
 
+  /// Computes the statistics of the label and label property indices of the
+  /// labels, reading the indices in parallel chunks. With a @p sample_rate
+  /// above 1 only 1 in this many vertices of each index is examined and the
+  /// statistics are approximated from them. The vertex counts of the label
+  /// indices stay exact.
   static std::vector<std::vector<TypedValue>> AnalyzeGraphCreateStatistics(const std::span<std::string> labels,
-                                                                           DbAccessor *execution_db_accessor);
+                                                                           DbAccessor *execution_db_accessor,
+                                                                           uint64_t sample_rate = 1);
 
   static std::vector<std::vector<TypedValue>> AnalyzeGraphDeleteStatistics(const std::span<std::string> labels,
                                                                            DbAccessor *execution_db_accessor);
@@ -207,6 +263,35 @@ struct PreparedQuery {
 struct QueryExtras {
   storage::PropertyValue::map_t metadata_pv;
   std::optional<int64_t> tx_timeout;
+  // Keep the query as a prepared statement of the session, or run the one kept for it.
+  bool prepared{false};
+  // Bookmarks of earlier commits, the transaction waits until the database has applied them.
+  std::vector<std::string> bookmarks{};
+};
+
+/**
+ * Resources the current transaction of an interpreter used so far. Written by
+ * the thread running the transaction after each pull and read by SHOW
+ * TRANSACTIONS while the transaction runs.
+ */
+struct TransactionResourceUsage {
+  void Reset() {
+    deltas.store(0, std::memory_order_relaxed);
+    peak_memory.store(0, std::memory_order_relaxed);
+    scanned_vertices.store(0, std::memory_order_relaxed);
+    lock_wait_us.store(0, std::memory_order_relaxed);
+    wal_bytes.store(0, std::memory_order_relaxed);
+  }
+
+  // Deltas the transaction created, each of them is garbage once it ends
+  std::atomic<uint64_t> deltas{0};
+  // Zero if the transaction runs without a memory limit
+  std::atomic<uint64_t> peak_memory{0};
+  std::atomic<uint64_t> scanned_vertices{0};
+  // Time spent waiting for the storage accessor of the transaction
+  std::atomic<uint64_t> lock_wait_us{0};
+  // Only set once the transaction committed
+  std::atomic<uint64_t> wal_bytes{0};
 };
 
 struct CurrentDB {
@@ -281,11 +366,13 @@ class Interpreter final {
   std::shared_ptr<QueryUserOrRole> user_or_role_{};
   SessionInfo session_info_;
   bool in_explicit_transaction_{false};
+  bool fan_out_worker_{false};  //!< Runs a query fanned out with USING DATABASES on one of its databases
   CurrentDB current_db_;
 
   bool expect_rollback_{false};
   std::shared_ptr<utils::AsyncTimer> current_timeout_timer_{};
   std::optional<storage::PropertyValue::map_t> metadata_{};  //!< User defined transaction metadata
+  std::optional<std::string> last_bookmark_{};               //!< Bookmark of the last data commit
 
 #ifdef MG_ENTERPRISE
   void SetCurrentDB(std::string_view db_name, bool explicit_db);
@@ -356,7 +443,8 @@ class Interpreter final {
 
   std::optional<uint64_t> GetTransactionId() const;
 
-  void CommitTransaction();
+  /// Returns the bookmark of the commit, if the transaction had a database.
+  std::optional<std::string> CommitTransaction();
 
   void RollbackTransaction();
 
@@ -372,6 +460,7 @@ class Interpreter final {
 
   std::atomic<TransactionStatus> transaction_status_{TransactionStatus::IDLE};  // Tie to current_transaction_
   std::optional<uint64_t> current_transaction_;
+  TransactionResourceUsage resource_usage_;
 
   void ResetUser();
 
@@ -402,6 +491,8 @@ class Interpreter final {
     std::optional<PreparedQuery> prepared_query;
     std::map<std::string, TypedValue> summary;
     std::vector<Notification> notifications;
+    /// Slot of the admission lane the query runs in, if it matched one.
+    std::optional<QueryAdmission::Slot> admission_slot;
 
     static auto Create() -> std::unique_ptr<QueryExecution> { return std::make_unique<QueryExecution>(); }
 
@@ -417,6 +508,7 @@ class Interpreter final {
     void CleanRuntimeData() {
       prepared_query.reset();
       notifications.clear();
+      admission_slot.reset();
     }
   };
 
@@ -456,14 +548,24 @@ class Interpreter final {
                          [](const auto &execution) { return execution && execution->prepared_query; });
   }
 
+  /// Parses @p query_string, or returns the prepared statement of the
+  /// session for it if the query should run as one.
+  ParsedQuery ParseOrLookUpPreparedStatement(const std::string &query_string, UserParameters const &user_parameters,
+                                             QueryExtras const &extras);
+
+  // Prepared statements of the session, keyed by their query string.
+  std::unordered_map<std::string, PreparedStatement> prepared_statements_;
+
   std::optional<std::function<void(std::string_view)>> on_change_{};
   void SetupInterpreterTransaction(const QueryExtras &extras);
+  void WaitForBookmarks(const std::vector<std::string> &bookmarks);
   void SetupDatabaseTransaction(bool couldCommit, bool unique = false);
 };
 
 template <typename TStream>
 std::map<std::string, TypedValue> Interpreter::Pull(TStream *result_stream, std::optional<int> n,
                                                     std::optional<int> qid) {
+  utils::tracing::ScopedSpan const span("interpreter.pull");
   MG_ASSERT(in_explicit_transaction_ || !qid, "qid can be only used in explicit transaction!");
 
   const int qid_value = qid ? *qid : static_cast<int>(query_executions_.size() - 1);
@@ -483,6 +585,9 @@ std::map<std::string, TypedValue> Interpreter::Pull(TStream *result_stream, std:
   // it after it finishes executing because it gets destroyed alongside
   // the prepared query and its execution memory.
   std::optional<std::map<std::string, TypedValue>> maybe_summary;
+  // The query allocates from the arena of its database, which limits it to the quota of the database
+  std::optional<memory::TenantArena::Binding> arena_binding;
+  if (current_db_.db_acc_) arena_binding.emplace(current_db_.db_acc_->get()->arena());
   try {
     // Wrap the (statically polymorphic) stream type into a common type which
     // the handler knows.
@@ -513,6 +618,7 @@ std::map<std::string, TypedValue> Interpreter::Pull(TStream *result_stream, std:
         switch (*maybe_res) {
           case QueryHandlerResult::COMMIT:
             Commit();
+            if (last_bookmark_) maybe_summary->insert_or_assign("bookmark", *last_bookmark_);
             break;
           case QueryHandlerResult::ABORT:
             Abort();
@@ -15,11 +15,25 @@
 
 #include "query/interpreter.hpp"
 #include "system/include/system/system.hpp"
+#include "utils/logging.hpp"
+
 namespace memgraph::query {
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 std::optional<InterpreterContext> InterpreterContextHolder::instance{};
 
+namespace {
+std::vector<QueryAdmission::LaneConfig> ParseAdmissionLanes(std::string_view spec) {
+  auto lanes = QueryAdmission::ParseLanes(spec);
+  if (!lanes) {
+    LOG_FATAL("Invalid query admission lanes '{}', expected lanes written as <selector>=<max running>[:<queue timeout "
+              "ms>] and separated by ';'.",
+              spec);
+  }
+  return std::move(*lanes);
+}
+}  // namespace
+
 InterpreterContext::InterpreterContext(
     InterpreterConfig interpreter_config, dbms::DbmsHandler *dbms_handler, replication::ReplicationState *rs,
     memgraph::system::System &system,
@@ -29,6 +43,7 @@ InterpreterContext::InterpreterContext(
     AuthQueryHandler *ah, AuthChecker *ac, ReplicationQueryHandler *replication_handler)
     : dbms_handler(dbms_handler),
       config(interpreter_config),
+      admission(ParseAdmissionLanes(config.query.admission_lanes)),
       repl_state(rs),
 #ifdef MG_ENTERPRISE
       coordinator_state_(coordinator_state),
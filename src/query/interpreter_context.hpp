@@ -20,6 +20,8 @@
 #include <vector>
 
 #include "query/config.hpp"
+#include "query/cypher_query_interpreter.hpp"
+#include "query/query_admission.hpp"
 #include "query/replication_query_handler.hpp"
 #include "query/typed_value.hpp"
 #include "replication/state.hpp"
@@ -42,8 +44,6 @@ class DbmsHandler;
 
 namespace memgraph::query {
 
-struct QueryCacheEntry;
-
 constexpr uint64_t kInterpreterTransactionInitialId = 1ULL << 63U;
 
 class AuthQueryHandler;
@@ -62,7 +62,8 @@ struct InterpreterContext {
   // Internal
   const InterpreterConfig config;
   std::atomic<bool> is_shutting_down{false};  // TODO: Do we even need this, since there is a global one also
-  memgraph::utils::SkipList<QueryCacheEntry> ast_cache;
+  AstCache ast_cache{static_cast<size_t>(FLAGS_query_ast_cache_max_size)};
+  QueryAdmission admission;
 
   // GLOBAL
   memgraph::replication::ReplicationState *repl_state;
@@ -11,6 +11,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <optional>
+#include <vector>
+
 #include "query/frontend/ast/ast.hpp"
 #include "query/parameters.hpp"
 #include "query/plan/operator.hpp"
@@ -96,6 +102,7 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     static constexpr double MakeScanAllByEdgeTypeProperty{1.1};
     static constexpr double kExpand{2.0};
     static constexpr double kExpandVariable{3.0};
+    static constexpr double kExpandIntersection{2.0};
     static constexpr double kFilter{1.5};
     static constexpr double kEdgeUniquenessFilter{1.5};
     static constexpr double kUnwind{1.3};
@@ -107,6 +114,7 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
   struct CardParam {
     static constexpr double kExpand{3.0};
     static constexpr double kExpandVariable{9.0};
+    static constexpr double kExpandIntersection{0.25};
     static constexpr double kFilter{0.25};
     static constexpr double kEdgeUniquenessFilter{0.95};
   };
@@ -150,6 +158,16 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
   }
 
   bool PostVisit(ScanAllByLabelPropertyValue &logical_op) override {
+    if (!logical_op.composite_properties_.empty()) {
+      // estimate the influence as ScanAll(label, properties) * filtering for
+      // every property of the prefix
+      auto const prefix_size = logical_op.composite_expressions_.size() + 1;
+      cardinality_ *= db_accessor_->VerticesCount(logical_op.label_, logical_op.composite_properties_) *
+                      std::pow(CardParam::kFilter, prefix_size);
+      IncrementCost(CostParam::MakeScanAllByLabelPropertyValue);
+      return true;
+    }
+
     // This cardinality estimation depends on the property value (expression).
     // If it's a constant, we can evaluate cardinality exactly, otherwise
     // we estimate
@@ -160,12 +178,22 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
 
     auto property_value = ConstPropertyValue(logical_op.expression_);
     double factor = 1.0;
-    if (property_value)
-      // get the exact influence based on ScanAll(label, property, value)
-      factor = db_accessor_->VerticesCount(logical_op.label_, logical_op.property_, property_value.value());
-    else
+    if (property_value) {
+      if (auto fraction = HistogramEqualFraction(index_stats, *property_value)) {
+        // the histogram accounts for frequent values
+        factor = db_accessor_->VerticesCount(logical_op.label_, logical_op.property_) * *fraction;
+      } else {
+        // get the exact influence based on ScanAll(label, property, value)
+        factor = db_accessor_->VerticesCount(logical_op.label_, logical_op.property_, property_value.value());
+      }
+    } else if (index_stats && index_stats->distinct_values_count > 0) {
+      // an unknown value matches an average group of equal values
+      factor = static_cast<double>(db_accessor_->VerticesCount(logical_op.label_, logical_op.property_)) /
+               static_cast<double>(index_stats->distinct_values_count);
+    } else {
       // estimate the influence as ScanAll(label, property) * filtering
       factor = db_accessor_->VerticesCount(logical_op.label_, logical_op.property_) * CardParam::kFilter;
+    }
 
     cardinality_ *= factor;
 
@@ -189,19 +217,24 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     auto lower = BoundToPropertyValue(logical_op.lower_bound_);
     auto upper = BoundToPropertyValue(logical_op.upper_bound_);
 
-    int64_t factor = 1;
-    if (upper || lower)
-      // if we have either Bound<PropertyValue>, use the value index
-      factor = db_accessor_->VerticesCount(logical_op.label_, logical_op.property_, lower, upper);
-    else
-      // no values, but we still have the label
-      factor = db_accessor_->VerticesCount(logical_op.label_, logical_op.property_);
-
-    // if we failed to take either bound from the op into account, then apply
-    // the filtering constant to the factor
-    if ((logical_op.upper_bound_ && !upper) || (logical_op.lower_bound_ && !lower)) factor *= CardParam::kFilter;
-
-    cardinality_ *= factor;
+    if (auto fraction = HistogramRangeFraction(index_stats, logical_op.lower_bound_, lower, logical_op.upper_bound_,
+                                               upper)) {
+      cardinality_ *= db_accessor_->VerticesCount(logical_op.label_, logical_op.property_) * *fraction;
+    } else {
+      int64_t factor = 1;
+      if (upper || lower)
+        // if we have either Bound<PropertyValue>, use the value index
+        factor = db_accessor_->VerticesCount(logical_op.label_, logical_op.property_, lower, upper);
+      else
+        // no values, but we still have the label
+        factor = db_accessor_->VerticesCount(logical_op.label_, logical_op.property_);
+
+      // if we failed to take either bound from the op into account, then apply
+      // the filtering constant to the factor
+      if ((logical_op.upper_bound_ && !upper) || (logical_op.lower_bound_ && !lower)) factor *= CardParam::kFilter;
+
+      cardinality_ *= factor;
+    }
 
     if (index_hints_.HasLabelPropertyIndex(db_accessor_, logical_op.label_, logical_op.property_)) {
       use_index_hints_ = true;
@@ -291,6 +324,14 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
 
   // TODO: Cost estimate ScanAllById?
 
+  bool PostVisit(ScanAllByPointNearest &logical_op) override {
+    // The number of produced rows depends on LIMIT, which may be a parameter,
+    // so the estimate is the same as for the label scan it replaces.
+    cardinality_ *= db_accessor_->VerticesCount(logical_op.label_);
+    IncrementCost(CostParam::kScanAllByLabel);
+    return true;
+  }
+
   bool PostVisit(Expand &expand) override {
     auto card_param = CardParam::kExpand;
     auto stats = GetStatsFor(expand.input_symbol_);
@@ -305,6 +346,21 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     return true;
   }
 
+  bool PostVisit(ExpandIntersection &expand) override {
+    // All adjacency lists are read for each input row, and the expansion of
+    // the first leg is cut down by each of the others.
+    IncrementCost(CostParam::kExpandIntersection * static_cast<double>(expand.legs_.size()));
+
+    auto card_param = CardParam::kExpand;
+    auto stats = GetStatsFor(expand.legs_.front().input_symbol);
+    if (stats.has_value()) {
+      card_param = stats.value().degree;
+    }
+    cardinality_ *= card_param * std::pow(CardParam::kExpandIntersection, expand.legs_.size() - 1);
+
+    return true;
+  }
+
 // For the given op first increments the cardinality and then cost.
 #define POST_VISIT_CARD_FIRST(NAME)     \
   bool PostVisit(NAME &) override {     \
@@ -508,6 +564,69 @@ class CostEstimator : public HierarchicalLogicalOperatorVisitor {
     return std::nullopt;
   }
 
+  static std::optional<double> NumericValue(const storage::PropertyValue &value) {
+    if (value.IsInt()) return static_cast<double>(value.ValueInt());
+    if (value.IsDouble()) return value.ValueDouble();
+    return std::nullopt;
+  }
+
+  // Fraction of the values in the histogram which are less than `value`, or
+  // less than or equal if `inclusive`. The values inside of a bucket are
+  // assumed to be spread uniformly.
+  static double HistogramCumulativeFraction(const std::vector<double> &histogram, double value, bool inclusive) {
+    auto it = inclusive ? std::upper_bound(histogram.begin(), histogram.end(), value)
+                        : std::lower_bound(histogram.begin(), histogram.end(), value);
+    if (it == histogram.begin()) return 0.0;
+    if (it == histogram.end()) return 1.0;
+    // `value` is between the bounds of the bucket, which differ
+    const auto low = *std::prev(it);
+    const auto high = *it;
+    const auto full_buckets = static_cast<double>(std::distance(histogram.begin(), it) - 1);
+    return (full_buckets + (value - low) / (high - low)) / static_cast<double>(histogram.size() - 1);
+  }
+
+  // Estimates the fraction of the indexed vertices with the given value from
+  // the histogram built by ANALYZE GRAPH, nullopt if there is no histogram for
+  // the value.
+  static std::optional<double> HistogramEqualFraction(const std::optional<storage::LabelPropertyIndexStats> &stats,
+                                                      const storage::PropertyValue &value) {
+    if (!stats || stats->histogram.size() < 2 || stats->distinct_values_count == 0) return std::nullopt;
+    auto number = NumericValue(value);
+    if (!number) return std::nullopt;
+    const auto &histogram = stats->histogram;
+    const auto fraction = HistogramCumulativeFraction(histogram, *number, true) -
+                          HistogramCumulativeFraction(histogram, *number, false);
+    // values which don't span a bucket are expected to match an average group
+    return std::max(fraction, 1.0 / static_cast<double>(stats->distinct_values_count));
+  }
+
+  // Same as `HistogramEqualFraction` for a range, only used if every bound of
+  // the range is a constant number.
+  static std::optional<double> HistogramRangeFraction(
+      const std::optional<storage::LabelPropertyIndexStats> &stats,
+      const std::optional<ScanAllByLabelPropertyRange::Bound> &lower_bound,
+      const std::optional<utils::Bound<storage::PropertyValue>> &lower,
+      const std::optional<ScanAllByLabelPropertyRange::Bound> &upper_bound,
+      const std::optional<utils::Bound<storage::PropertyValue>> &upper) {
+    if (!stats || stats->histogram.size() < 2) return std::nullopt;
+    if ((lower_bound && !lower) || (upper_bound && !upper)) return std::nullopt;
+    if (!lower && !upper) return std::nullopt;
+
+    double below_lower = 0.0;
+    double below_upper = 1.0;
+    if (lower) {
+      auto number = NumericValue(lower->value());
+      if (!number) return std::nullopt;
+      below_lower = HistogramCumulativeFraction(stats->histogram, *number, lower->IsExclusive());
+    }
+    if (upper) {
+      auto number = NumericValue(upper->value());
+      if (!number) return std::nullopt;
+      below_upper = HistogramCumulativeFraction(stats->histogram, *number, upper->IsInclusive());
+    }
+    return std::max(below_upper - below_lower, 0.0);
+  }
+
   // If the expression is a constant property value, it is returned. Otherwise,
   // return nullopt.
   std::optional<storage::PropertyValue> ConstPropertyValue(const Expression *expression) {
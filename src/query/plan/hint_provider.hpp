@@ -61,6 +61,10 @@ class PlanHintsProvider final : public HierarchicalLogicalOperatorVisitor {
 
   bool PostVisit(ExpandVariable & /*unused*/) override { return true; }
 
+  bool PreVisit(ExpandIntersection & /*unused*/) override { return true; }
+
+  bool PostVisit(ExpandIntersection & /*unused*/) override { return true; }
+
   bool PreVisit(Merge &op) override {
     op.input()->Accept(*this);
     op.merge_match_->Accept(*this);
@@ -114,6 +118,9 @@ class PlanHintsProvider final : public HierarchicalLogicalOperatorVisitor {
   bool PreVisit(ScanAllById & /*unused*/) override { return true; }
   bool PostVisit(ScanAllById & /*unused*/) override { return true; }
 
+  bool PreVisit(ScanAllByPointNearest & /*unused*/) override { return true; }
+  bool PostVisit(ScanAllByPointNearest & /*unused*/) override { return true; }
+
   bool PreVisit(ScanAllByEdge & /*unused*/) override { return true; }
   bool PostVisit(ScanAllByEdge & /*unused*/) override { return true; }
 
@@ -235,6 +242,18 @@ class PlanHintsProvider final : public HierarchicalLogicalOperatorVisitor {
   bool PreVisit(PeriodicCommit & /*unused*/) override { return true; }
   bool PostVisit(PeriodicCommit & /*unused*/) override { return true; }
 
+  bool PreVisit(Gather & /*unused*/) override { return true; }
+  bool PostVisit(Gather & /*unused*/) override { return true; }
+
+  bool PreVisit(LoadProperties & /*unused*/) override { return true; }
+  bool PostVisit(LoadProperties & /*unused*/) override { return true; }
+
+  bool PreVisit(ComputeExpressions & /*unused*/) override { return true; }
+  bool PostVisit(ComputeExpressions & /*unused*/) override { return true; }
+
+  bool PreVisit(CountVertices & /*unused*/) override { return true; }
+  bool PostVisit(CountVertices & /*unused*/) override { return true; }
+
   bool PreVisit(PeriodicSubquery &op) override {
     op.input()->Accept(*this);
     op.subquery_->Accept(*this);
@@ -12,13 +12,23 @@
 #include "query/plan/operator.hpp"
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
 #include <cstdint>
+#include <deque>
+#include <functional>
 #include <limits>
+#include <mutex>
+#include <numeric>
 #include <optional>
 #include <queue>
 #include <random>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
@@ -42,9 +52,11 @@
 #include "query/frontend/ast/ast.hpp"
 #include "query/frontend/semantic/symbol_table.hpp"
 #include "query/graph.hpp"
+#include "query/interpret/compiled_expression.hpp"
 #include "query/interpret/eval.hpp"
 #include "query/path.hpp"
 #include "query/plan/scoped_profile.hpp"
+#include "query/plan/spill.hpp"
 #include "query/procedure/cypher_types.hpp"
 #include "query/procedure/mg_procedure_impl.hpp"
 #include "query/procedure/module.hpp"
@@ -70,7 +82,9 @@
 #include "utils/pmr/unordered_set.hpp"
 #include "utils/pmr/vector.hpp"
 #include "utils/readable_size.hpp"
+#include "utils/spin_lock.hpp"
 #include "utils/string.hpp"
+#include "utils/synchronized.hpp"
 #include "utils/tag.hpp"
 #include "utils/temporal.hpp"
 #include "utils/typeinfo.hpp"
@@ -110,6 +124,7 @@ extern const Event ScanAllByLabelPropertyRangeOperator;
 extern const Event ScanAllByLabelPropertyValueOperator;
 extern const Event ScanAllByLabelPropertyOperator;
 extern const Event ScanAllByIdOperator;
+extern const Event ScanAllByPointNearestOperator;
 extern const Event ScanAllByEdgeOperator;
 extern const Event ScanAllByEdgeTypeOperator;
 extern const Event ScanAllByEdgeTypePropertyOperator;
@@ -118,6 +133,7 @@ extern const Event ScanAllByEdgeTypePropertyRangeOperator;
 extern const Event ScanAllByEdgeIdOperator;
 extern const Event ExpandOperator;
 extern const Event ExpandVariableOperator;
+extern const Event ExpandIntersectionOperator;
 extern const Event ConstructNamedPathOperator;
 extern const Event FilterOperator;
 extern const Event ProduceOperator;
@@ -149,6 +165,10 @@ extern const Event HashJoinOperator;
 extern const Event RollUpApplyOperator;
 extern const Event PeriodicCommitOperator;
 extern const Event PeriodicSubqueryOperator;
+extern const Event GatherOperator;
+extern const Event LoadPropertiesOperator;
+extern const Event ComputeExpressionsOperator;
+extern const Event CountVerticesOperator;
 }  // namespace memgraph::metrics
 
 namespace memgraph::query::plan {
@@ -157,19 +177,6 @@ using OOMExceptionEnabler = utils::MemoryTracker::OutOfMemoryExceptionEnabler;
 
 namespace {
 
-// Custom equality function for a vector of typed values.
-// Used in unordered_maps in Aggregate and Distinct operators.
-struct TypedValueVectorEqual {
-  template <class TAllocator>
-  bool operator()(const std::vector<TypedValue, TAllocator> &left,
-                  const std::vector<TypedValue, TAllocator> &right) const {
-    MG_ASSERT(left.size() == right.size(),
-              "TypedValueVector comparison should only be done over vectors "
-              "of the same size");
-    return std::equal(left.begin(), left.end(), right.begin(), TypedValue::BoolEqual{});
-  }
-};
-
 // Returns boolean result of evaluating filter expression. Null is treated as
 // false. Other non boolean values raise a QueryRuntimeException.
 bool EvaluateFilter(ExpressionEvaluator &evaluator, Expression *filter) {
@@ -181,6 +188,35 @@ bool EvaluateFilter(ExpressionEvaluator &evaluator, Expression *filter) {
   return result.ValueBool();
 }
 
+// Returns the compiled form of the expression, if the plan has one.
+const CompiledExpression *FindCompiledExpression(const ExecutionContext &context, const Expression *expression) {
+  if (!context.compiled_expressions) return nullptr;
+  return context.compiled_expressions->Find(expression);
+}
+
+// Same as above, but tries the compiled form of the filter first. The
+// evaluator is used if there is none or it can't handle the current row.
+bool EvaluateFilter(ExpressionEvaluator &evaluator, Expression *filter, const CompiledExpression *compiled,
+                    const Frame &frame, const ExecutionContext &context, storage::View view) {
+  if (compiled) {
+    if (auto result = compiled->EvaluateFilter(frame, context.evaluation_context, view)) return *result;
+  }
+  return EvaluateFilter(evaluator, filter);
+}
+
+// Evaluates the named expression into its symbol in the frame, trying the
+// compiled form of its expression first.
+void EvaluateNamedExpression(ExpressionEvaluator &evaluator, NamedExpression *named_expression, Frame &frame,
+                             const ExecutionContext &context, storage::View view) {
+  if (const auto *compiled = FindCompiledExpression(context, named_expression->expression_)) {
+    if (auto value = compiled->Evaluate(frame, context.evaluation_context, view)) {
+      frame[context.symbol_table.at(*named_expression)] = *std::move(value);
+      return;
+    }
+  }
+  named_expression->Accept(evaluator);
+}
+
 template <typename T>
 uint64_t ComputeProfilingKey(const T *obj) {
   static_assert(sizeof(T *) == sizeof(uint64_t));
@@ -212,6 +248,14 @@ std::vector<storage::LabelId> EvaluateLabels(const std::vector<StorageLabelType>
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define SCOPED_PROFILE_OP_BY_REF(ref) ScopedProfile profile{ComputeProfilingKey(this), ref, &context};
 
+bool Cursor::PullBatch(Frame &frame, FrameBatch &batch, ExecutionContext &context) {
+  batch.Clear();
+  while (!batch.full() && Pull(frame, context)) {
+    batch.Add().elems() = frame.elems();
+  }
+  return !batch.empty();
+}
+
 bool Once::OnceCursor::Pull(Frame &, ExecutionContext &context) {
   OOMExceptionEnabler oom_exception;
   SCOPED_PROFILE_OP("Once");
@@ -502,13 +546,15 @@ template <class TVerticesFun>
 class ScanAllCursor : public Cursor {
  public:
   explicit ScanAllCursor(const ScanAll &self, Symbol output_symbol, UniqueCursorPtr input_cursor, storage::View view,
-                         TVerticesFun get_vertices, const char *op_name)
+                         TVerticesFun get_vertices, const char *op_name,
+                         const std::vector<storage::PropertyId> *covered_properties = nullptr)
       : self_(self),
         output_symbol_(std::move(output_symbol)),
         input_cursor_(std::move(input_cursor)),
         view_(view),
         get_vertices_(std::move(get_vertices)),
-        op_name_(op_name) {}
+        op_name_(op_name),
+        covered_properties_(covered_properties) {}
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
     OOMExceptionEnabler oom_exception;
@@ -535,11 +581,81 @@ class ScanAllCursor : public Cursor {
     }
 #endif
 
+    ++context.scanned_vertices;
+    if constexpr (requires { vertices_it_.value().IndexedValues(); }) {
+      if (covered_properties_) {
+        frame[output_symbol_] = IndexedValuesMap(context);
+        ++vertices_it_.value();
+        return true;
+      }
+    }
     frame[output_symbol_] = *vertices_it_.value();
     ++vertices_it_.value();
     return true;
   }
 
+  bool PullBatch(Frame &frame, FrameBatch &batch, ExecutionContext &context) override {
+    OOMExceptionEnabler oom_exception;
+    SCOPED_PROFILE_OP_BY_REF(self_);
+
+    if (!input_batch_) input_batch_.emplace(frame.elems().size(), batch.capacity(), frame.GetMemoryResource());
+    batch.Clear();
+    while (!batch.full()) {
+      AbortCheck(context);
+      if (!vertices_ || vertices_it_.value() == vertices_end_it_.value()) {
+        if (next_input_row_ == input_batch_->size()) {
+          if (!input_cursor_->PullBatch(frame, *input_batch_, context)) break;
+          next_input_row_ = 0;
+        }
+        auto next_vertices = get_vertices_((*input_batch_)[next_input_row_++], context);
+        if (!next_vertices) continue;
+        vertices_.emplace(std::move(next_vertices.value()));
+        vertices_it_.emplace(vertices_.value().begin());
+        vertices_end_it_.emplace(vertices_.value().end());
+        continue;
+      }
+#ifdef MG_ENTERPRISE
+      if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker && !FindNextVertex(context)) {
+        continue;
+      }
+#endif
+      // Each output row extends the input row its vertex was found for
+      auto &row = batch.Add();
+      row.elems() = (*input_batch_)[next_input_row_ - 1].elems();
+      ++context.scanned_vertices;
+      bool covered = false;
+      if constexpr (requires { vertices_it_.value().IndexedValues(); }) {
+        if (covered_properties_) {
+          row[output_symbol_] = IndexedValuesMap(context);
+          covered = true;
+        }
+      }
+      if (!covered) row[output_symbol_] = *vertices_it_.value();
+      ++vertices_it_.value();
+    }
+    return !batch.empty();
+  }
+
+  // Map of the covered properties of the current vertex, taken from its index
+  // entry instead of the vertex.
+  TypedValue IndexedValuesMap(const ExecutionContext &context) {
+    const auto *values = vertices_it_.value().IndexedValues();
+    MG_ASSERT(values && values->size() == covered_properties_->size(),
+              "A covering scan requires an index which stores the covered property values!");
+    if (covered_property_names_.empty()) {
+      covered_property_names_.reserve(covered_properties_->size());
+      for (auto property : *covered_properties_) {
+        covered_property_names_.push_back(context.db_accessor->PropertyToName(property));
+      }
+    }
+    auto *memory = context.evaluation_context.memory;
+    TypedValue::TMap map(memory);
+    for (size_t i = 0; i < values->size(); ++i) {
+      map.emplace(covered_property_names_[i], TypedValue((*values)[i], memory));
+    }
+    return TypedValue(std::move(map), memory);
+  }
+
 #ifdef MG_ENTERPRISE
   bool FindNextVertex(const ExecutionContext &context) {
     while (vertices_it_.value() != vertices_end_it_.value()) {
@@ -560,6 +676,8 @@ class ScanAllCursor : public Cursor {
     vertices_ = std::nullopt;
     vertices_it_ = std::nullopt;
     vertices_end_it_ = std::nullopt;
+    if (input_batch_) input_batch_->Clear();
+    next_input_row_ = 0;
   }
 
  private:
@@ -572,6 +690,11 @@ class ScanAllCursor : public Cursor {
   std::optional<decltype(vertices_.value().begin())> vertices_it_;
   std::optional<decltype(vertices_.value().end())> vertices_end_it_;
   const char *op_name_;
+  const std::vector<storage::PropertyId> *covered_properties_;
+  std::vector<std::string> covered_property_names_;
+  // Input rows of a batched pull, the vertices are scanned for the row before next_input_row_
+  std::optional<FrameBatch> input_batch_;
+  size_t next_input_row_{0};
 };
 template <typename TEdgesFun>
 class ScanAllByEdgeCursor : public Cursor {
@@ -665,6 +788,7 @@ UniqueCursorPtr ScanAll::MakeCursor(utils::MemoryResource *mem) const {
   memgraph::metrics::IncrementCounter(memgraph::metrics::ScanAllOperator);
 
   auto vertices = [this](Frame &, ExecutionContext &context) {
+    if (auto *morsel = std::exchange(context.scan_morsel, nullptr)) return std::make_optional(std::move(*morsel));
     auto *db = context.db_accessor;
     return std::make_optional(db->Vertices(view_));
   };
@@ -690,6 +814,7 @@ UniqueCursorPtr ScanAllByLabel::MakeCursor(utils::MemoryResource *mem) const {
   memgraph::metrics::IncrementCounter(memgraph::metrics::ScanAllByLabelOperator);
 
   auto vertices = [this](Frame &, ExecutionContext &context) {
+    if (auto *morsel = std::exchange(context.scan_morsel, nullptr)) return std::make_optional(std::move(*morsel));
     auto *db = context.db_accessor;
     return std::make_optional(db->Vertices(view_, label_));
   };
@@ -975,13 +1100,37 @@ UniqueCursorPtr ScanAllByLabelPropertyValue::MakeCursor(utils::MemoryResource *m
     if (!value.IsPropertyValue()) {
       throw QueryRuntimeException("'{}' cannot be used as a property value.", value.type());
     }
-    return std::make_optional(db->Vertices(view_, label_, property_, storage::PropertyValue(value)));
+    if (composite_properties_.empty()) {
+      return std::make_optional(db->Vertices(view_, label_, property_, storage::PropertyValue(value)));
+    }
+    std::vector<storage::PropertyValue> prefix;
+    prefix.reserve(composite_expressions_.size() + 1);
+    prefix.emplace_back(value);
+    for (auto *expression : composite_expressions_) {
+      auto next_value = expression->Accept(evaluator);
+      if (next_value.IsNull()) return std::nullopt;
+      if (!next_value.IsPropertyValue()) {
+        throw QueryRuntimeException("'{}' cannot be used as a property value.", next_value.type());
+      }
+      prefix.emplace_back(next_value);
+    }
+    return std::make_optional(
+        db->Vertices(view_, label_, composite_properties_, std::move(prefix), std::nullopt, std::nullopt));
   };
   return MakeUniqueCursorPtr<ScanAllCursor<decltype(vertices)>>(
-      mem, *this, output_symbol_, input_->MakeCursor(mem), view_, std::move(vertices), "ScanAllByLabelPropertyValue");
+      mem, *this, output_symbol_, input_->MakeCursor(mem), view_, std::move(vertices), "ScanAllByLabelPropertyValue",
+      covering_ ? &composite_properties_ : nullptr);
 }
 
 std::string ScanAllByLabelPropertyValue::ToString() const {
+  if (!composite_properties_.empty()) {
+    std::vector<std::string> property_names;
+    for (auto property : composite_properties_ | ranges::views::take(composite_expressions_.size() + 1)) {
+      property_names.push_back(dba_->PropertyToName(property));
+    }
+    return fmt::format("ScanAllByLabelPropertyValue ({0} :{1} {{{2}}})", output_symbol_.name(),
+                       dba_->LabelToName(label_), utils::Join(property_names, ", "));
+  }
   return fmt::format("ScanAllByLabelPropertyValue ({0} :{1} {{{2}}})", output_symbol_.name(), dba_->LabelToName(label_),
                      dba_->PropertyToName(property_));
 }
@@ -1036,6 +1185,69 @@ UniqueCursorPtr ScanAllById::MakeCursor(utils::MemoryResource *mem) const {
 
 std::string ScanAllById::ToString() const { return fmt::format("ScanAllById ({})", output_symbol_.name()); }
 
+ScanAllByPointNearest::ScanAllByPointNearest(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol,
+                                             storage::LabelId label, storage::PropertyId property,
+                                             Expression *point_expression, Expression *limit_expression,
+                                             Expression *skip_expression, storage::View view)
+    : ScanAll(input, output_symbol, view),
+      label_(label),
+      property_(property),
+      point_expression_(point_expression),
+      limit_expression_(limit_expression),
+      skip_expression_(skip_expression) {
+  MG_ASSERT(point_expression_);
+  MG_ASSERT(limit_expression_);
+}
+
+ACCEPT_WITH_INPUT(ScanAllByPointNearest)
+
+UniqueCursorPtr ScanAllByPointNearest::MakeCursor(utils::MemoryResource *mem) const {
+  memgraph::metrics::IncrementCounter(memgraph::metrics::ScanAllByPointNearestOperator);
+
+  auto vertices = [this](Frame &frame, ExecutionContext &context) -> std::optional<std::vector<VertexAccessor>> {
+    auto *db = context.db_accessor;
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor, view_);
+    // Invalid values are reported by the Limit and Skip above this operator.
+    auto row_count = [&](Expression *expression) -> std::optional<std::size_t> {
+      if (!expression) return 0;
+      auto value = expression->Accept(evaluator);
+      if (!value.IsInt() || value.ValueInt() < 0) return std::nullopt;
+      return static_cast<std::size_t>(value.ValueInt());
+    };
+    auto limit = row_count(limit_expression_);
+    auto skip = row_count(skip_expression_);
+    if (!limit || !skip || *limit == 0) return std::nullopt;
+    auto const count = *limit + *skip;
+
+    auto point = point_expression_->Accept(evaluator);
+    auto result = std::vector<VertexAccessor>{};
+    if (point.IsPoint2d()) {
+      result = db->NearestPointVertices(view_, label_, property_, storage::PropertyValue(point.ValuePoint2d()), count);
+    } else if (point.IsPoint3d()) {
+      result = db->NearestPointVertices(view_, label_, property_, storage::PropertyValue(point.ValuePoint3d()), count);
+    }
+    if (result.size() == count) return result;
+
+    // The remaining vertices don't have a point comparable to `point`, so any
+    // of them can fill the rows after the indexed ones.
+    auto seen = std::unordered_set<storage::Gid>{};
+    for (const auto &vertex : result) seen.insert(vertex.Gid());
+    for (auto vertex : db->Vertices(view_, label_)) {
+      if (seen.contains(vertex.Gid())) continue;
+      result.push_back(vertex);
+      if (result.size() == count) break;
+    }
+    return result;
+  };
+  return MakeUniqueCursorPtr<ScanAllCursor<decltype(vertices)>>(mem, *this, output_symbol_, input_->MakeCursor(mem),
+                                                                view_, std::move(vertices), "ScanAllByPointNearest");
+}
+
+std::string ScanAllByPointNearest::ToString() const {
+  return fmt::format("ScanAllByPointNearest ({0} :{1} {{{2}}})", output_symbol_.name(), dba_->LabelToName(label_),
+                     dba_->PropertyToName(property_));
+}
+
 ScanAllByEdgeId::ScanAllByEdgeId(const std::shared_ptr<LogicalOperator> &input, Symbol edge_symbol, Symbol node1_symbol,
                                  Symbol node2_symbol, EdgeAtom::Direction direction, Expression *expression,
                                  storage::View view)
@@ -1092,6 +1304,71 @@ auto UnwrapEdgesResult(storage::Result<TEdgesResult> &&result) {
   return std::move(*result);
 }
 
+// Expansions start loading the vertices of the edge this far ahead of the
+// processed one, so the cache misses of the neighbours overlap.
+constexpr std::ptrdiff_t kEdgePrefetchDistance = 8;
+
+template <typename TIterator>
+void PrefetchEdgeAhead(TIterator it, TIterator end) {
+  if (end - it > kEdgePrefetchDistance) it[kEdgePrefetchDistance].impl_.Prefetch();
+}
+
+template <typename TIterator>
+void PrefetchFirstEdges(TIterator begin, TIterator end) {
+  for (auto it = begin; it != end && it - begin <= kEdgePrefetchDistance; ++it) it->impl_.Prefetch();
+}
+
+// Iterates the edges of an expanded vertex, prefetching the edges ahead of the
+// current one.
+template <typename TEdges>
+class PrefetchedEdges {
+ public:
+  using underlying_iterator = decltype(std::declval<const TEdges &>().begin());
+
+  class Iterator {
+   public:
+    Iterator(underlying_iterator it, underlying_iterator end) : it_(it), end_(end) {}
+
+    decltype(auto) operator*() const { return *it_; }
+
+    Iterator &operator++() {
+      ++it_;
+      PrefetchEdgeAhead(it_, end_);
+      return *this;
+    }
+
+    bool operator==(const Iterator &other) const { return it_ == other.it_; }
+
+   private:
+    underlying_iterator it_;
+    underlying_iterator end_;
+  };
+
+  explicit PrefetchedEdges(const TEdges &edges) : edges_(edges) { PrefetchFirstEdges(edges_.begin(), edges_.end()); }
+
+  Iterator begin() const { return Iterator{edges_.begin(), edges_.end()}; }
+  Iterator end() const { return Iterator{edges_.end(), edges_.end()}; }
+
+ private:
+  const TEdges &edges_;
+};
+
+// Looks up the edges of `edge_type` going from `from` to `to` in the edge-type
+// index, counting them towards the hops limit the same way the adjacency list
+// expansion does.
+std::vector<EdgeAccessor> EdgesBetween(DbAccessor *dba, storage::EdgeTypeId edge_type, const VertexAccessor &from,
+                                       const VertexAccessor &to, storage::View view, HopsLimit *hops_limit) {
+  std::vector<EdgeAccessor> edges;
+  for (auto edge : dba->Edges(view, edge_type, from, to)) {
+    if (hops_limit->IsUsed()) {
+      hops_limit->IncrementHopsCount(1);
+      if (hops_limit->IsLimitReached()) break;
+    }
+    edges.push_back(edge);
+  }
+  return edges;
+}
+
 }  // namespace
 
 Expand::Expand(const std::shared_ptr<LogicalOperator> &input, Symbol input_symbol, Symbol node_symbol,
@@ -1158,6 +1435,7 @@ bool Expand::ExpandCursor::Pull(Frame &frame, ExecutionContext &context) {
     // attempt to get a value from the incoming edges
     if (in_edges_ && *in_edges_it_ != in_edges_->end()) {
       auto edge = *(*in_edges_it_)++;
+      PrefetchEdgeAhead(*in_edges_it_, in_edges_->end());
 #ifdef MG_ENTERPRISE
       if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
           !(context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
@@ -1175,6 +1453,7 @@ bool Expand::ExpandCursor::Pull(Frame &frame, ExecutionContext &context) {
     // attempt to get a value from the outgoing edges
     if (out_edges_ && *out_edges_it_ != out_edges_->end()) {
       auto edge = *(*out_edges_it_)++;
+      PrefetchEdgeAhead(*out_edges_it_, out_edges_->end());
       // when expanding in EdgeAtom::Direction::BOTH directions
       // we should do only one expansion for cycles, and it was
       // already done in the block above
@@ -1283,11 +1562,19 @@ bool Expand::ExpandCursor::InitEdges(Frame &frame, ExecutionContext &context) {
         if (expansion_info_.existing_node) {
           auto existing_node = *expansion_info_.existing_node;
 
-          auto edges_result = UnwrapEdgesResult(
-              vertex.InEdges(self_.view_, self_.common_.edge_types, existing_node, &context.hops_limit));
-          context.number_of_hops += edges_result.expanded_count;
-          in_edges_.emplace(std::move(edges_result.edges));
-          num_expanded_first = edges_result.expanded_count;
+          if (self_.edge_type_index_lookup_) {
+            auto edges = EdgesBetween(context.db_accessor, self_.common_.edge_types[0], existing_node, vertex,
+                                      self_.view_, &context.hops_limit);
+            num_expanded_first = static_cast<int64_t>(edges.size());
+            context.number_of_hops += num_expanded_first;
+            in_edges_.emplace(std::move(edges));
+          } else {
+            auto edges_result = UnwrapEdgesResult(
+                vertex.InEdges(self_.view_, self_.common_.edge_types, existing_node, &context.hops_limit));
+            context.number_of_hops += edges_result.expanded_count;
+            in_edges_.emplace(std::move(edges_result.edges));
+            num_expanded_first = edges_result.expanded_count;
+          }
         }
       } else {
         auto edges_result =
@@ -1298,6 +1585,7 @@ bool Expand::ExpandCursor::InitEdges(Frame &frame, ExecutionContext &context) {
       }
       if (in_edges_) {
         in_edges_it_.emplace(in_edges_->begin());
+        PrefetchFirstEdges(in_edges_->begin(), in_edges_->end());
       }
     }
 
@@ -1306,11 +1594,19 @@ bool Expand::ExpandCursor::InitEdges(Frame &frame, ExecutionContext &context) {
       if (self_.common_.existing_node) {
         if (expansion_info_.existing_node) {
           auto existing_node = *expansion_info_.existing_node;
-          auto edges_result = UnwrapEdgesResult(
-              vertex.OutEdges(self_.view_, self_.common_.edge_types, existing_node, &context.hops_limit));
-          context.number_of_hops += edges_result.expanded_count;
-          out_edges_.emplace(std::move(edges_result.edges));
-          num_expanded_second = edges_result.expanded_count;
+          if (self_.edge_type_index_lookup_) {
+            auto edges = EdgesBetween(context.db_accessor, self_.common_.edge_types[0], vertex, existing_node,
+                                      self_.view_, &context.hops_limit);
+            num_expanded_second = static_cast<int64_t>(edges.size());
+            context.number_of_hops += num_expanded_second;
+            out_edges_.emplace(std::move(edges));
+          } else {
+            auto edges_result = UnwrapEdgesResult(
+                vertex.OutEdges(self_.view_, self_.common_.edge_types, existing_node, &context.hops_limit));
+            context.number_of_hops += edges_result.expanded_count;
+            out_edges_.emplace(std::move(edges_result.edges));
+            num_expanded_second = edges_result.expanded_count;
+          }
         }
       } else {
         auto edges_result =
@@ -1321,6 +1617,7 @@ bool Expand::ExpandCursor::InitEdges(Frame &frame, ExecutionContext &context) {
       }
       if (out_edges_) {
         out_edges_it_.emplace(out_edges_->begin());
+        PrefetchFirstEdges(out_edges_->begin(), out_edges_->end());
       }
     }
 
@@ -1342,12 +1639,227 @@ bool Expand::ExpandCursor::InitEdges(Frame &frame, ExecutionContext &context) {
   }
 }
 
+ExpandIntersection::ExpandIntersection(const std::shared_ptr<LogicalOperator> &input, Symbol node_symbol,
+                                       std::vector<Leg> legs, storage::View view)
+    : input_(input ? input : std::make_shared<Once>()),
+      node_symbol_(std::move(node_symbol)),
+      legs_(std::move(legs)),
+      view_(view) {
+  DMG_ASSERT(legs_.size() >= 2, "ExpandIntersection needs at least two legs");
+}
+
+ACCEPT_WITH_INPUT(ExpandIntersection)
+
+std::vector<Symbol> ExpandIntersection::ModifiedSymbols(const SymbolTable &table) const {
+  auto symbols = input_->ModifiedSymbols(table);
+  symbols.emplace_back(node_symbol_);
+  for (const auto &leg : legs_) {
+    symbols.emplace_back(leg.edge_symbol);
+  }
+  return symbols;
+}
+
+std::string ExpandIntersection::ToString() const {
+  return fmt::format("ExpandIntersection {}", utils::IterableToString(legs_, ", ", [this](const auto &leg) {
+                       return fmt::format(
+                           "({}){}[{}{}]{}({})", leg.input_symbol.name(),
+                           leg.direction == query::EdgeAtom::Direction::IN ? "<-" : "-", leg.edge_symbol.name(),
+                           utils::IterableToString(
+                               leg.edge_types, "|",
+                               [this](const auto &edge_type) { return ":" + dba_->EdgeTypeToName(edge_type); }),
+                           leg.direction == query::EdgeAtom::Direction::OUT ? "->" : "-", node_symbol_.name());
+                     }));
+}
+
+namespace {
+
+class ExpandIntersectionCursor : public Cursor {
+ public:
+  ExpandIntersectionCursor(const ExpandIntersection &self, utils::MemoryResource *mem)
+      : self_(self), input_cursor_(self.input_->MakeCursor(mem)), adjacencies_(self.legs_.size()) {}
+
+  bool Pull(Frame &frame, ExecutionContext &context) override {
+    OOMExceptionEnabler oom_exception;
+    SCOPED_PROFILE_OP_BY_REF(self_);
+
+    while (true) {
+      AbortCheck(context);
+      if (has_match_) {
+        frame[self_.node_symbol_] = adjacencies_[0].neighbours[combination_[0]].node;
+        for (size_t i = 0; i < self_.legs_.size(); ++i) {
+          frame[self_.legs_[i].edge_symbol] = adjacencies_[i].neighbours[combination_[i]].edge;
+        }
+        has_match_ = NextCombination() || SeekMatch();
+        return true;
+      }
+      if (!InitAdjacencies(frame, context)) return false;
+      has_match_ = SeekMatch();
+    }
+  }
+
+  void Shutdown() override { input_cursor_->Shutdown(); }
+
+  void Reset() override {
+    input_cursor_->Reset();
+    for (auto &adjacency : adjacencies_) {
+      adjacency.vertex.reset();
+      adjacency.neighbours.clear();
+    }
+    has_match_ = false;
+  }
+
+ private:
+  struct Neighbour {
+    VertexAccessor node;
+    EdgeAccessor edge;
+  };
+
+  struct Adjacency {
+    /// The bound node `neighbours` were collected for.
+    std::optional<VertexAccessor> vertex;
+    /// Sorted by the gid of the node.
+    std::vector<Neighbour> neighbours;
+  };
+
+  // Pulls from the input until all the bound nodes are there and each of them
+  // has a neighbour.
+  bool InitAdjacencies(Frame &frame, ExecutionContext &context) {
+    while (true) {
+      if (!input_cursor_->Pull(frame, context)) return false;
+      if (context.hops_limit.IsLimitReached()) return false;
+
+      bool has_neighbours = true;
+      for (size_t i = 0; i < self_.legs_.size(); ++i) {
+        const auto &leg = self_.legs_[i];
+        TypedValue &vertex_value = frame[leg.input_symbol];
+        // Bound nodes could be null if they are created by a failed optional
+        // match, there are no expansions from them.
+        if (vertex_value.IsNull()) {
+          has_neighbours = false;
+          break;
+        }
+        ExpectType(leg.input_symbol, vertex_value, TypedValue::Type::Vertex);
+        auto &adjacency = adjacencies_[i];
+        const auto &vertex = vertex_value.ValueVertex();
+        // Under View::OLD the adjacency lists can't change during the query.
+        if (self_.view_ != storage::View::OLD || adjacency.vertex != vertex) {
+          CollectNeighbours(vertex, leg, context, &adjacency.neighbours);
+          adjacency.vertex = vertex;
+        }
+        if (adjacency.neighbours.empty()) {
+          has_neighbours = false;
+          break;
+        }
+      }
+      if (!has_neighbours) continue;
+
+      positions_.assign(self_.legs_.size(), 0);
+      return true;
+    }
+  }
+
+  void CollectNeighbours(const VertexAccessor &vertex, const ExpandIntersection::Leg &leg, ExecutionContext &context,
+                         std::vector<Neighbour> *neighbours) {
+    neighbours->clear();
+    auto add_edges = [&](auto &&edges_result, bool is_in) {
+      context.number_of_hops += edges_result.expanded_count;
+      for (auto &edge : edges_result.edges) {
+        // When expanding in both directions, the cycles were already added as
+        // the in edges.
+        if (!is_in && leg.direction == EdgeAtom::Direction::BOTH && edge.IsCycle()) continue;
+        auto node = is_in ? edge.From() : edge.To();
+#ifdef MG_ENTERPRISE
+        if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
+            !(context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
+              context.auth_checker->Has(node, self_.view_, memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
+          continue;
+        }
+#endif
+        neighbours->push_back(Neighbour{.node = node, .edge = edge});
+      }
+    };
+    if (leg.direction == EdgeAtom::Direction::IN || leg.direction == EdgeAtom::Direction::BOTH) {
+      add_edges(UnwrapEdgesResult(vertex.InEdges(self_.view_, leg.edge_types, &context.hops_limit)), true);
+    }
+    if (leg.direction == EdgeAtom::Direction::OUT || leg.direction == EdgeAtom::Direction::BOTH) {
+      add_edges(UnwrapEdgesResult(vertex.OutEdges(self_.view_, leg.edge_types, &context.hops_limit)), false);
+    }
+    std::stable_sort(neighbours->begin(), neighbours->end(),
+                     [](const auto &lhs, const auto &rhs) { return lhs.node.Gid() < rhs.node.Gid(); });
+  }
+
+  // Advances the positions until all of them are at the same node and marks
+  // the end of the run of its edges in each leg. Returns false once one of
+  // the lists is exhausted.
+  bool SeekMatch() {
+    auto by_gid = [](const Neighbour &neighbour, storage::Gid gid) { return neighbour.node.Gid() < gid; };
+    while (true) {
+      std::optional<storage::Gid> target;
+      for (size_t i = 0; i < adjacencies_.size(); ++i) {
+        const auto &neighbours = adjacencies_[i].neighbours;
+        if (positions_[i] == neighbours.size()) return false;
+        auto gid = neighbours[positions_[i]].node.Gid();
+        if (!target || *target < gid) target = gid;
+      }
+      bool all_equal = true;
+      for (size_t i = 0; i < adjacencies_.size(); ++i) {
+        const auto &neighbours = adjacencies_[i].neighbours;
+        auto it = std::lower_bound(neighbours.begin() + positions_[i], neighbours.end(), *target, by_gid);
+        positions_[i] = it - neighbours.begin();
+        if (it == neighbours.end()) return false;
+        all_equal &= it->node.Gid() == *target;
+      }
+      if (!all_equal) continue;
+
+      run_ends_.resize(adjacencies_.size());
+      for (size_t i = 0; i < adjacencies_.size(); ++i) {
+        const auto &neighbours = adjacencies_[i].neighbours;
+        auto it = std::find_if(neighbours.begin() + positions_[i], neighbours.end(),
+                               [&target](const auto &neighbour) { return neighbour.node.Gid() != *target; });
+        run_ends_[i] = it - neighbours.begin();
+      }
+      combination_ = positions_;
+      return true;
+    }
+  }
+
+  // Moves to the next combination of the edges to the matched node, moving
+  // the positions past the node once all are produced.
+  bool NextCombination() {
+    for (auto i = combination_.size(); i-- > 0;) {
+      if (++combination_[i] < run_ends_[i]) return true;
+      combination_[i] = positions_[i];
+    }
+    positions_ = run_ends_;
+    return false;
+  }
+
+  const ExpandIntersection &self_;
+  const UniqueCursorPtr input_cursor_;
+  std::vector<Adjacency> adjacencies_;
+  // Start of the current node's edges in each leg.
+  std::vector<size_t> positions_;
+  // End of the current node's edges in each leg.
+  std::vector<size_t> run_ends_;
+  // Edges of the next row to produce.
+  std::vector<size_t> combination_;
+  bool has_match_{false};
+};
+
+}  // namespace
+
+UniqueCursorPtr ExpandIntersection::MakeCursor(utils::MemoryResource *mem) const {
+  memgraph::metrics::IncrementCounter(memgraph::metrics::ExpandIntersectionOperator);
+
+  return MakeUniqueCursorPtr<ExpandIntersectionCursor>(mem, *this, mem);
+}
+
 ExpandVariable::ExpandVariable(const std::shared_ptr<LogicalOperator> &input, Symbol input_symbol, Symbol node_symbol,
                                Symbol edge_symbol, EdgeAtom::Type type, EdgeAtom::Direction direction,
                                const std::vector<storage::EdgeTypeId> &edge_types, bool is_reverse,
                                Expression *lower_bound, Expression *upper_bound, bool existing_node,
                                ExpansionLambda filter_lambda, std::optional<ExpansionLambda> weight_lambda,
-                               std::optional<Symbol> total_weight)
+                               std::optional<Symbol> total_weight, std::optional<ExpansionLambda> heuristic_lambda)
     : input_(input ? input : std::make_shared<Once>()),
       input_symbol_(std::move(input_symbol)),
       common_{node_symbol, edge_symbol, direction, edge_types, existing_node},
@@ -1357,11 +1869,13 @@ ExpandVariable::ExpandVariable(const std::shared_ptr<LogicalOperator> &input, Sy
       upper_bound_(upper_bound),
       filter_lambda_(std::move(filter_lambda)),
       weight_lambda_(std::move(weight_lambda)),
-      total_weight_(std::move(total_weight)) {
+      total_weight_(std::move(total_weight)),
+      heuristic_lambda_(std::move(heuristic_lambda)) {
   DMG_ASSERT(type_ == EdgeAtom::Type::DEPTH_FIRST || type_ == EdgeAtom::Type::BREADTH_FIRST ||
-                 type_ == EdgeAtom::Type::WEIGHTED_SHORTEST_PATH || type_ == EdgeAtom::Type::ALL_SHORTEST_PATHS,
+                 type_ == EdgeAtom::Type::WEIGHTED_SHORTEST_PATH || type_ == EdgeAtom::Type::ALL_SHORTEST_PATHS ||
+                 type_ == EdgeAtom::Type::K_SHORTEST_PATHS,
              "ExpandVariable can only be used with breadth first, depth first, "
-             "weighted shortest path or all shortest paths type");
+             "weighted shortest path, all shortest paths or k shortest paths type");
   DMG_ASSERT(!(type_ == EdgeAtom::Type::BREADTH_FIRST && is_reverse), "Breadth first expansion can't be reversed");
 }
 
@@ -1387,37 +1901,35 @@ namespace {
  * @param memory - Used to allocate the result.
  * @return See above.
  */
-auto ExpandFromVertex(const VertexAccessor &vertex, EdgeAtom::Direction direction,
-                      const std::vector<storage::EdgeTypeId> &edge_types, utils::MemoryResource *memory,
-                      ExecutionContext *context) {
-  // wraps an EdgeAccessor into a pair <accessor, direction>
-  auto wrapper = [](EdgeAtom::Direction direction, auto &&edges) {
-    return iter::imap([direction](const auto &edge) { return std::make_pair(edge, direction); },
-                      std::forward<decltype(edges)>(edges));
-  };
+// Edges of a vertex paired with the direction they are expanded in.
+using ExpandedEdges = utils::pmr::vector<std::pair<EdgeAccessor, EdgeAtom::Direction>>;
 
+/**
+ * Replaces @p edges with the edges of @p vertex in the given direction. The
+ * buffer keeps its capacity, so the expansions on the same depth reuse it.
+ * If @p destination is given only the edges between the vertex and it are
+ * collected, the storage filters them while it reads the adjacency lists.
+ */
+void ExpandFromVertex(const VertexAccessor &vertex, EdgeAtom::Direction direction,
+                      const std::vector<storage::EdgeTypeId> &edge_types, const VertexAccessor *destination,
+                      ExecutionContext *context, ExpandedEdges *edges) {
+  edges->clear();
   storage::View view = storage::View::OLD;
-  utils::pmr::vector<decltype(wrapper(direction, vertex.InEdges(view, edge_types).GetValue().edges))> chain_elements(
-      memory);
+  auto append = [&](EdgeAtom::Direction edges_direction, auto &&edges_result) {
+    context->number_of_hops += edges_result.expanded_count;
+    for (auto &edge : edges_result.edges) edges->emplace_back(std::move(edge), edges_direction);
+  };
 
   if (direction != EdgeAtom::Direction::OUT) {
-    auto edges_result = UnwrapEdgesResult(vertex.InEdges(view, edge_types, &context->hops_limit));
-    context->number_of_hops += edges_result.expanded_count;
-    if (!edges_result.edges.empty()) {
-      chain_elements.emplace_back(wrapper(EdgeAtom::Direction::IN, std::move(edges_result.edges)));
-    }
+    append(EdgeAtom::Direction::IN,
+           UnwrapEdgesResult(destination ? vertex.InEdges(view, edge_types, *destination, &context->hops_limit)
+                                         : vertex.InEdges(view, edge_types, &context->hops_limit)));
   }
-
   if (direction != EdgeAtom::Direction::IN) {
-    auto edges_result = UnwrapEdgesResult(vertex.OutEdges(view, edge_types, &context->hops_limit));
-    context->number_of_hops += edges_result.expanded_count;
-    if (!edges_result.edges.empty()) {
-      chain_elements.emplace_back(wrapper(EdgeAtom::Direction::OUT, std::move(edges_result.edges)));
-    }
+    append(EdgeAtom::Direction::OUT,
+           UnwrapEdgesResult(destination ? vertex.OutEdges(view, edge_types, *destination, &context->hops_limit)
+                                         : vertex.OutEdges(view, edge_types, &context->hops_limit)));
   }
-
-  // TODO: Investigate whether itertools perform heap allocation?
-  return iter::chain.from_iterable(std::move(chain_elements));
 }
 
 }  // namespace
@@ -1425,7 +1937,7 @@ auto ExpandFromVertex(const VertexAccessor &vertex, EdgeAtom::Direction directio
 class ExpandVariableCursor : public Cursor {
  public:
   ExpandVariableCursor(const ExpandVariable &self, utils::MemoryResource *mem)
-      : self_(self), input_cursor_(self.input_->MakeCursor(mem)), edges_(mem), edges_it_(mem) {}
+      : self_(self), input_cursor_(self.input_->MakeCursor(mem)), levels_(mem) {}
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
     OOMExceptionEnabler oom_exception;
@@ -1461,8 +1973,7 @@ class ExpandVariableCursor : public Cursor {
 
   void Reset() override {
     input_cursor_->Reset();
-    edges_.clear();
-    edges_it_.clear();
+    depth_ = 0;
   }
 
  private:
@@ -1475,15 +1986,42 @@ class ExpandVariableCursor : public Cursor {
   int64_t upper_bound_{-1};
   int64_t lower_bound_{-1};
 
-  // a stack of edge iterables corresponding to the level/depth of
-  // the expansion currently being Pulled
-  using ExpandEdges =
-      decltype(ExpandFromVertex(std::declval<VertexAccessor>(), EdgeAtom::Direction::IN, self_.common_.edge_types,
-                                utils::NewDeleteResource(), std::declval<ExecutionContext *>()));
+  // The edges of a level/depth of the expansion currently being Pulled and
+  // the position of the next one to expand.
+  struct Level {
+    explicit Level(utils::MemoryResource *memory) : edges(memory) {}
 
-  utils::pmr::vector<ExpandEdges> edges_;
-  // an iterator indicating the position in the corresponding edges_ element
-  utils::pmr::vector<decltype(edges_.begin()->begin())> edges_it_;
+    ExpandedEdges edges;
+    size_t position{0};
+  };
+
+  // A stack of the levels, only the first depth_ of them are in use. The
+  // levels below the depth keep their buffers, so the search doesn't allocate
+  // once it has reached its deepest level and the widest vertices.
+  utils::pmr::vector<Level> levels_;
+  size_t depth_{0};
+
+  // Pushes the edges of the vertex as the next level of the search.
+  void PushLevel(const VertexAccessor &vertex, Frame &frame, ExecutionContext &context) {
+    if (levels_.size() == depth_) levels_.emplace_back(levels_.get_allocator().GetMemoryResource());
+    auto &level = levels_[depth_];
+    level.position = 0;
+    // The edges on the last level only yield if they end in the existing
+    // node, so only those are read from the storage.
+    const VertexAccessor *destination = nullptr;
+    if (self_.common_.existing_node && upper_bound_ == static_cast<int64_t>(depth_) + 1) {
+      const auto &existing_node = frame[self_.common_.node_symbol];
+      if (existing_node.IsNull()) {
+        level.edges.clear();
+        ++depth_;
+        return;
+      }
+      ExpectType(self_.common_.node_symbol, existing_node, TypedValue::Type::Vertex);
+      destination = &existing_node.ValueVertex();
+    }
+    ExpandFromVertex(vertex, self_.common_.direction, self_.common_.edge_types, destination, &context, &level.edges);
+    ++depth_;
+  }
 
   /**
    * Helper function that Pulls from the input vertex and
@@ -1521,12 +2059,8 @@ class ExpandVariableCursor : public Cursor {
       lower_bound_ = self_.lower_bound_ ? calc_bound(self_.lower_bound_) : 1;
       upper_bound_ = self_.upper_bound_ ? calc_bound(self_.upper_bound_) : std::numeric_limits<int64_t>::max();
 
-      if (upper_bound_ > 0) {
-        auto *memory = edges_.get_allocator().GetMemoryResource();
-        edges_.emplace_back(
-            ExpandFromVertex(vertex, self_.common_.direction, self_.common_.edge_types, memory, &context));
-        edges_it_.emplace_back(edges_.back().begin());
-      }
+      depth_ = 0;
+      if (upper_bound_ > 0) PushLevel(vertex, frame, context);
 
       if (self_.filter_lambda_.accumulated_path_symbol) {
         // Add initial vertex of path to the accumulated path
@@ -1550,15 +2084,15 @@ class ExpandVariableCursor : public Cursor {
   void AppendEdge(const EdgeAccessor &new_edge, utils::pmr::vector<TypedValue> *edges_on_frame) {
     // We are placing an edge on the frame. It is possible that there already
     // exists an edge on the frame for this level. If so first remove it.
-    DMG_ASSERT(edges_.size() > 0, "Edges are empty");
+    DMG_ASSERT(depth_ > 0, "Edges are empty");
     if (self_.is_reverse_) {
       // TODO: This is innefficient, we should look into replacing
       // vector with something else for TypedValue::List.
-      size_t diff = edges_on_frame->size() - std::min(edges_on_frame->size(), edges_.size() - 1U);
+      size_t diff = edges_on_frame->size() - std::min(edges_on_frame->size(), depth_ - 1U);
       if (diff > 0U) edges_on_frame->erase(edges_on_frame->begin(), edges_on_frame->begin() + diff);
       edges_on_frame->emplace(edges_on_frame->begin(), new_edge);
     } else {
-      edges_on_frame->resize(std::min(edges_on_frame->size(), edges_.size() - 1U));
+      edges_on_frame->resize(std::min(edges_on_frame->size(), depth_ - 1U));
       edges_on_frame->emplace_back(new_edge);
     }
   }
@@ -1582,33 +2116,34 @@ class ExpandVariableCursor : public Cursor {
       AbortCheck(context);
       // pop from the stack while there is stuff to pop and the current
       // level is exhausted
-      while (!edges_.empty() && edges_it_.back() == edges_.back().end()) {
-        edges_.pop_back();
-        edges_it_.pop_back();
+      while (depth_ > 0 && levels_[depth_ - 1].position == levels_[depth_ - 1].edges.size()) {
+        --depth_;
       }
 
       // check if we exhausted everything, if so return false
-      if (edges_.empty()) return false;
+      if (depth_ == 0) return false;
 
       // we use this a lot
       auto &edges_on_frame = frame[self_.common_.edge_symbol].ValueList();
 
       // it is possible that edges_on_frame does not contain as many
-      // elements as edges_ due to edge-uniqueness (when a whole layer
+      // elements as the levels due to edge-uniqueness (when a whole layer
       // gets exhausted but no edges are valid). for that reason only
       // pop from edges_on_frame if they contain enough elements
       if (self_.is_reverse_) {
-        auto diff = edges_on_frame.size() - std::min(edges_on_frame.size(), edges_.size());
+        auto diff = edges_on_frame.size() - std::min(edges_on_frame.size(), depth_);
         if (diff > 0) {
           edges_on_frame.erase(edges_on_frame.begin(), edges_on_frame.begin() + diff);
         }
       } else {
-        edges_on_frame.resize(std::min(edges_on_frame.size(), edges_.size()));
+        edges_on_frame.resize(std::min(edges_on_frame.size(), depth_));
       }
 
       // if we are here, we have a valid stack,
-      // get the edge, increase the relevant iterator
-      auto current_edge = *edges_it_.back()++;
+      // get the edge, increase the position on its level. The edge is copied
+      // because pushing the next level may move the levels.
+      auto &level = levels_[depth_ - 1];
+      auto current_edge = level.edges[level.position++];
       // Check edge-uniqueness.
       bool found_existing =
           std::any_of(edges_on_frame.begin(), edges_on_frame.end(),
@@ -1649,11 +2184,8 @@ class ExpandVariableCursor : public Cursor {
 
       // we are doing depth-first search, so place the current
       // edge's expansions onto the stack, if we should continue to expand
-      if (upper_bound_ > static_cast<int64_t>(edges_.size()) && !context.hops_limit.IsLimitReached()) {
-        auto *memory = edges_.get_allocator().GetMemoryResource();
-        edges_.emplace_back(
-            ExpandFromVertex(current_vertex, self_.common_.direction, self_.common_.edge_types, memory, &context));
-        edges_it_.emplace_back(edges_.back().begin());
+      if (upper_bound_ > static_cast<int64_t>(depth_) && !context.hops_limit.IsLimitReached()) {
+        PushLevel(current_vertex, frame, context);
       }
 
       if (self_.common_.existing_node && !CheckExistingNode(current_vertex, self_.common_.node_symbol, frame)) continue;
@@ -1801,7 +2333,7 @@ class STShortestPathCursor : public query::plan::Cursor {
           auto out_edges_result =
               UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
           context.number_of_hops += out_edges_result.expanded_count;
-          for (const auto &edge : out_edges_result.edges) {
+          for (const auto &edge : PrefetchedEdges(out_edges_result.edges)) {
 #ifdef MG_ENTERPRISE
             if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
                 !(context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
@@ -1828,7 +2360,7 @@ class STShortestPathCursor : public query::plan::Cursor {
           auto in_edges_result =
               UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
           context.number_of_hops += in_edges_result.expanded_count;
-          for (const auto &edge : in_edges_result.edges) {
+          for (const auto &edge : PrefetchedEdges(in_edges_result.edges)) {
 #ifdef MG_ENTERPRISE
             if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
                 !(context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
@@ -1870,7 +2402,7 @@ class STShortestPathCursor : public query::plan::Cursor {
           auto out_edges_result =
               UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
           context.number_of_hops += out_edges_result.expanded_count;
-          for (const auto &edge : out_edges_result.edges) {
+          for (const auto &edge : PrefetchedEdges(out_edges_result.edges)) {
 #ifdef MG_ENTERPRISE
             if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
                 !(context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
@@ -1897,7 +2429,7 @@ class STShortestPathCursor : public query::plan::Cursor {
           auto in_edges_result =
               UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
           context.number_of_hops += in_edges_result.expanded_count;
-          for (const auto &edge : in_edges_result.edges) {
+          for (const auto &edge : PrefetchedEdges(in_edges_result.edges)) {
 #ifdef MG_ENTERPRISE
             if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
                 !(context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
@@ -1929,6 +2461,90 @@ class STShortestPathCursor : public query::plan::Cursor {
   }
 };
 
+namespace {
+/// Splitting the work into more morsels than workers lets fast workers pick
+/// up the slack of the ones stuck on dense parts of the graph.
+constexpr uint64_t kMorselsPerWorker = 8;
+
+/// Context of a worker thread, which shares the accessor and the read-only
+/// state of the query with @p context.
+ExecutionContext MakeWorkerContext(const ExecutionContext &context) {
+  ExecutionContext worker_context;
+  worker_context.db_accessor = context.db_accessor;
+  worker_context.symbol_table = context.symbol_table;
+  worker_context.evaluation_context.timestamp = context.evaluation_context.timestamp;
+  worker_context.evaluation_context.parameters = context.evaluation_context.parameters;
+  worker_context.evaluation_context.properties = context.evaluation_context.properties;
+  worker_context.evaluation_context.labels = context.evaluation_context.labels;
+  worker_context.is_shutting_down = context.is_shutting_down;
+  worker_context.transaction_status = context.transaction_status;
+  worker_context.timer = context.timer;
+  worker_context.user_or_role = context.user_or_role;
+  return worker_context;
+}
+
+/// Set of vertices with a bit for each gid below the bound it is created
+/// with, into which several threads can insert without locking. Gids are
+/// handed out densely, so the bits are indexed by the gid directly. The
+/// vertices created after the set have larger gids and go into a locked
+/// overflow set.
+class ConcurrentVertexSet {
+ public:
+  explicit ConcurrentVertexSet(uint64_t gid_upper_bound) : words_((gid_upper_bound + kBitsPerWord - 1) / kBitsPerWord) {}
+
+  /// Returns true if @p vertex wasn't in the set yet.
+  bool Insert(const VertexAccessor &vertex) {
+    auto const gid = vertex.Gid().AsUint();
+    if (gid / kBitsPerWord >= words_.size()) return overflow_.Lock()->insert(gid).second;
+    auto const bit = uint64_t{1} << (gid % kBitsPerWord);
+    return (words_[gid / kBitsPerWord].fetch_or(bit, std::memory_order_relaxed) & bit) == 0;
+  }
+
+  bool Contains(const VertexAccessor &vertex) const {
+    auto const gid = vertex.Gid().AsUint();
+    if (gid / kBitsPerWord >= words_.size()) return overflow_.Lock()->contains(gid);
+    auto const bit = uint64_t{1} << (gid % kBitsPerWord);
+    return (words_[gid / kBitsPerWord].load(std::memory_order_relaxed) & bit) != 0;
+  }
+
+ private:
+  static constexpr uint64_t kBitsPerWord = 64;
+
+  std::vector<std::atomic<uint64_t>> words_;
+  mutable utils::Synchronized<std::unordered_set<uint64_t>, utils::SpinLock> overflow_;
+};
+
+/// Runs @p work with each index in [0, num_threads) on a thread of its own
+/// and waits for all of them. The threads track their allocations as part of
+/// the transaction. The first exception thrown on a thread sets @p stop, so
+/// the others can finish early, and is rethrown once all threads are done.
+template <typename TWork>
+void RunOnWorkerThreads(DbAccessor *db, size_t num_threads, std::atomic<bool> &stop, const TWork &work) {
+  utils::Synchronized<std::exception_ptr, utils::SpinLock> error;
+  {
+    std::vector<std::jthread> threads;
+    threads.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+      threads.emplace_back([db, i, &stop, &work, &error] {
+        db->TrackCurrentThreadAllocations();
+        utils::OnScopeExit untrack{[db] { db->UntrackCurrentThreadAllocations(); }};
+        try {
+          work(i);
+        } catch (...) {
+          {
+            auto locked_error = error.Lock();
+            if (!*locked_error) *locked_error = std::current_exception();
+          }
+          stop.store(true, std::memory_order_release);
+        }
+      });
+    }
+    // jthreads join on destruction.
+  }
+  if (auto exception = std::exchange(*error.Lock(), nullptr)) std::rethrow_exception(exception);
+}
+}  // namespace
+
 class SingleSourceShortestPathCursor : public query::plan::Cursor {
  public:
   SingleSourceShortestPathCursor(const ExpandVariable &self, utils::MemoryResource *mem)
@@ -1990,6 +2606,7 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
       }
       to_visit_next_.emplace_back(edge, vertex, std::move(curr_acc_path));
       processed_.emplace(vertex, edge);
+      if (visited_) visited_->Insert(vertex);
       return true;
     };
 
@@ -2007,7 +2624,7 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
         auto out_edges_result =
             UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
         context.number_of_hops += out_edges_result.expanded_count;
-        for (const auto &edge : out_edges_result.edges) {
+        for (const auto &edge : PrefetchedEdges(out_edges_result.edges)) {
           bool was_expanded = expand_pair(edge, edge.To());
           restore_frame_state_after_expansion(was_expanded);
         }
@@ -2016,7 +2633,7 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
         auto in_edges_result =
             UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types, &context.hops_limit));
         context.number_of_hops += in_edges_result.expanded_count;
-        for (const auto &edge : in_edges_result.edges) {
+        for (const auto &edge : PrefetchedEdges(in_edges_result.edges)) {
           bool was_expanded = expand_pair(edge, edge.From());
           restore_frame_state_after_expansion(was_expanded);
         }
@@ -2027,7 +2644,15 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
     while (true) {
       AbortCheck(context);
       // if we have nothing to visit on the current depth, switch to next
-      if (to_visit_current_.empty()) to_visit_current_.swap(to_visit_next_);
+      if (to_visit_current_.empty() && !to_visit_next_.empty()) {
+        to_visit_current_.swap(to_visit_next_);
+        current_depth_ = next_depth_++;
+        current_level_expanded_ = false;
+        if (ShouldExpandLevelInParallel(context)) {
+          ExpandLevelInParallel(frame, context);
+          current_level_expanded_ = true;
+        }
+      }
 
       // if current is still empty, it means both are empty, so pull from
       // input
@@ -2039,6 +2664,7 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
         to_visit_current_.clear();
         to_visit_next_.clear();
         processed_.clear();
+        visited_.reset();
 
         const auto &vertex_value = frame[self_.input_symbol_];
         // it is possible that the vertex is Null due to optional matching
@@ -2060,6 +2686,7 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
         }
 
         expand_from_vertex(vertex);
+        next_depth_ = 1;
 
         // go back to loop start and see if we expanded anything
         continue;
@@ -2084,8 +2711,9 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
         edge_list.emplace_back(previous_edge.value());
       }
 
-      // expand only if what we've just expanded is less then max depth
-      if (static_cast<int64_t>(edge_list.size()) < upper_bound_) {
+      // expand only if what we've just expanded is less then max depth, and
+      // the whole level wasn't expanded already
+      if (static_cast<int64_t>(edge_list.size()) < upper_bound_ && !current_level_expanded_) {
         if (self_.filter_lambda_.accumulated_path_symbol) {
           MG_ASSERT(curr_acc_path.has_value(), "Expected non-null accumulated path");
           frame[self_.filter_lambda_.accumulated_path_symbol.value()] = std::move(curr_acc_path.value());
@@ -2114,39 +2742,223 @@ class SingleSourceShortestPathCursor : public query::plan::Cursor {
     processed_.clear();
     to_visit_next_.clear();
     to_visit_current_.clear();
+    visited_.reset();
   }
 
  private:
-  const ExpandVariable &self_;
-  const UniqueCursorPtr input_cursor_;
-
-  // Depth bounds. Calculated on each pull from the input, the initial value
-  // is irrelevant.
-  int64_t lower_bound_{-1};
-  int64_t upper_bound_{-1};
+  /// Levels with fewer vertices are expanded on the pulling thread, vertex by
+  /// vertex, as their rows are emitted.
+  static constexpr size_t kMinParallelLevelSize = 1024;
+  /// Vertices of a level which a worker expands before it takes the next ones.
+  static constexpr size_t kLevelChunkSize = 64;
+  /// A level is expanded bottom-up once checking the neighbours of the
+  /// vertices which weren't visited yet is cheaper than expanding the level,
+  /// i.e. once the level has more vertices than this fraction of them.
+  static constexpr int64_t kBottomUpLevelFactor = 14;
+
+  struct LevelWorker {
+    ExecutionContext context;
+    Frame frame;
+    std::vector<std::pair<EdgeAccessor, VertexAccessor>> expanded;
+  };
 
-  // maps vertices to the edge they got expanded from. it is an optional
-  // edge because the root does not get expanded from anything.
-  // contains visited vertices as well as those scheduled to be visited.
-  utils::pmr::unordered_map<VertexAccessor, std::optional<EdgeAccessor>> processed_;
-  // edge, vertex we have yet to visit, for current and next depth and their accumulated paths
-  utils::pmr::vector<std::tuple<EdgeAccessor, VertexAccessor, std::optional<Path>>> to_visit_next_;
-  utils::pmr::vector<std::tuple<EdgeAccessor, VertexAccessor, std::optional<Path>>> to_visit_current_;
-};
+  bool ShouldExpandLevelInParallel(const ExecutionContext &context) const {
+    // The accumulated path is carried from a vertex to its expansions, which
+    // ties each expansion to the order in which the level is visited.
+    if (self_.num_workers_ <= 1 || self_.filter_lambda_.accumulated_path_symbol) return false;
+    if (to_visit_current_.size() < kMinParallelLevelSize || current_depth_ >= upper_bound_) return false;
+    if (context.is_profile_query) return false;
+#ifdef MG_ENTERPRISE
+    if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker) return false;
+#endif
+    return context.db_accessor->GetTransactionId().has_value();
+  }
 
-namespace {
+  /// Expands all vertices of the current level on worker threads, which
+  /// fills the next level with the vertices they reach and their parents in
+  /// `processed_`. The level is expanded top-down, from its vertices, unless
+  /// it is large compared to the vertices not visited yet. Then each of those
+  /// looks for a neighbour in the level instead, bottom-up.
+  void ExpandLevelInParallel(Frame &frame, ExecutionContext &context) {
+    auto *db = context.db_accessor;
+    if (!visited_) {
+      visited_.emplace(db->VertexGidUpperBound());
+      for (const auto &[vertex, _] : processed_) visited_->Insert(vertex);
+    }
+
+    auto const num_unvisited = db->VerticesCount() - static_cast<int64_t>(processed_.size());
+    auto const bottom_up = static_cast<int64_t>(to_visit_current_.size()) * kBottomUpLevelFactor > num_unvisited;
+    std::vector<VerticesIterable> morsels;
+    std::optional<ConcurrentVertexSet> level;
+    if (bottom_up) {
+      morsels = db->ChunkedVertices(storage::View::OLD, self_.num_workers_ * kMorselsPerWorker);
+      level.emplace(db->VertexGidUpperBound());
+      for (const auto &entry : to_visit_current_) level->Insert(std::get<1>(entry));
+    }
+    auto const num_tasks =
+        bottom_up ? morsels.size() : (to_visit_current_.size() + kLevelChunkSize - 1) / kLevelChunkSize;
+
+    auto const num_workers = std::min<size_t>(self_.num_workers_, num_tasks);
+    std::vector<LevelWorker> workers;
+    workers.reserve(num_workers);
+    while (workers.size() < num_workers) {
+      auto &worker = workers.emplace_back(
+          LevelWorker{.context = MakeWorkerContext(context), .frame = Frame(static_cast<int64_t>(frame.elems().size()))});
+      worker.context.hops_limit = context.hops_limit.ForWorker();
+      // The filter can refer to the symbols bound before the expansion.
+      std::copy(frame.elems().begin(), frame.elems().end(), worker.frame.elems().begin());
+    }
+
+    std::atomic<size_t> next_task{0};
+    std::atomic<bool> stop{false};
+    db->SetParallelReadersActive(true);
+    utils::OnScopeExit readers_done{[db] { db->SetParallelReadersActive(false); }};
+    RunOnWorkerThreads(db, workers.size(), stop, [&](size_t index) {
+      auto &worker = workers[index];
+      ExpressionEvaluator evaluator(&worker.frame, worker.context.symbol_table, worker.context.evaluation_context, db,
+                                    storage::View::OLD);
+      for (auto task = next_task.fetch_add(1, std::memory_order_acq_rel);
+           task < num_tasks && !stop.load(std::memory_order_acquire) && !worker.context.hops_limit.IsLimitReached();
+           task = next_task.fetch_add(1, std::memory_order_acq_rel)) {
+        if (MustAbort(worker.context) != AbortReason::NO_ABORT) {
+          stop.store(true, std::memory_order_release);
+          break;
+        }
+        if (bottom_up) {
+          ExpandBottomUp(morsels[task], *level, worker, evaluator);
+        } else {
+          ExpandTopDown(task * kLevelChunkSize, std::min((task + 1) * kLevelChunkSize, to_visit_current_.size()),
+                        worker, evaluator);
+        }
+      }
+      worker.context.hops_limit.ReleaseReservation();
+    });
+    AbortCheck(context);
 
-void CheckWeightType(TypedValue current_weight, utils::MemoryResource *memory) {
-  if (current_weight.IsNull()) {
-    return;
+    for (auto &worker : workers) {
+      context.number_of_hops += worker.context.number_of_hops;
+      for (const auto &[edge, vertex] : worker.expanded) {
+        to_visit_next_.emplace_back(edge, vertex, std::nullopt);
+        processed_.emplace(vertex, edge);
+      }
+    }
   }
 
-  if (!current_weight.IsNumeric() && !current_weight.IsDuration()) {
-    throw QueryRuntimeException("Calculated weight must be numeric or a Duration, got {}.", current_weight.type());
+  /// Whether the filter lambda allows expanding @p edge to @p vertex.
+  bool MayExpand(const EdgeAccessor &edge, const VertexAccessor &vertex, LevelWorker &worker,
+                 ExpressionEvaluator &evaluator) const {
+    if (!self_.filter_lambda_.expression) return true;
+    worker.frame[self_.filter_lambda_.inner_edge_symbol] = edge;
+    worker.frame[self_.filter_lambda_.inner_node_symbol] = vertex;
+    TypedValue result = self_.filter_lambda_.expression->Accept(evaluator);
+    switch (result.type()) {
+      case TypedValue::Type::Null:
+        return false;
+      case TypedValue::Type::Bool:
+        return result.ValueBool();
+      default:
+        throw QueryRuntimeException("Expansion condition must evaluate to boolean or null.");
+    }
   }
 
-  const auto is_valid_numeric = [&] {
-    return current_weight.IsNumeric() && (current_weight >= TypedValue(0, memory)).ValueBool();
+  /// Expands the vertices of the current level in [begin, end).
+  void ExpandTopDown(size_t begin, size_t end, LevelWorker &worker, ExpressionEvaluator &evaluator) {
+    auto expand = [this, &worker, &evaluator](const EdgeAccessor &edge, const VertexAccessor &vertex) {
+      if (visited_->Contains(vertex) || !MayExpand(edge, vertex, worker, evaluator)) return;
+      // Another worker could have reached the vertex in the meantime.
+      if (visited_->Insert(vertex)) worker.expanded.emplace_back(edge, vertex);
+    };
+    auto *hops_limit = &worker.context.hops_limit;
+    for (auto i = begin; i < end && !hops_limit->IsLimitReached(); ++i) {
+      const auto &vertex = std::get<1>(to_visit_current_[i]);
+      if (self_.common_.direction != EdgeAtom::Direction::IN) {
+        auto out_edges_result =
+            UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types, hops_limit));
+        worker.context.number_of_hops += out_edges_result.expanded_count;
+        for (const auto &edge : PrefetchedEdges(out_edges_result.edges)) expand(edge, edge.To());
+      }
+      if (self_.common_.direction != EdgeAtom::Direction::OUT) {
+        auto in_edges_result =
+            UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types, hops_limit));
+        worker.context.number_of_hops += in_edges_result.expanded_count;
+        for (const auto &edge : PrefetchedEdges(in_edges_result.edges)) expand(edge, edge.From());
+      }
+    }
+  }
+
+  /// Finds a parent in @p level for each vertex of @p morsel which wasn't
+  /// visited yet. The morsels don't overlap, so each vertex is claimed by a
+  /// single worker.
+  void ExpandBottomUp(VerticesIterable &morsel, const ConcurrentVertexSet &level, LevelWorker &worker,
+                      ExpressionEvaluator &evaluator) {
+    auto *hops_limit = &worker.context.hops_limit;
+    for (const auto &vertex : morsel) {
+      if (hops_limit->IsLimitReached()) return;
+      if (visited_->Contains(vertex)) continue;
+      std::optional<EdgeAccessor> parent_edge;
+      // The edges an expansion going out of the level takes come in to the vertex.
+      if (self_.common_.direction != EdgeAtom::Direction::IN) {
+        auto in_edges_result =
+            UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types, hops_limit));
+        worker.context.number_of_hops += in_edges_result.expanded_count;
+        for (const auto &edge : in_edges_result.edges) {
+          if (!level.Contains(edge.From()) || !MayExpand(edge, vertex, worker, evaluator)) continue;
+          parent_edge = edge;
+          break;
+        }
+      }
+      if (!parent_edge && self_.common_.direction != EdgeAtom::Direction::OUT) {
+        auto out_edges_result =
+            UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types, hops_limit));
+        worker.context.number_of_hops += out_edges_result.expanded_count;
+        for (const auto &edge : out_edges_result.edges) {
+          if (!level.Contains(edge.To()) || !MayExpand(edge, vertex, worker, evaluator)) continue;
+          parent_edge = edge;
+          break;
+        }
+      }
+      if (parent_edge && visited_->Insert(vertex)) worker.expanded.emplace_back(*parent_edge, vertex);
+    }
+  }
+
+  const ExpandVariable &self_;
+  const UniqueCursorPtr input_cursor_;
+
+  // Depth bounds. Calculated on each pull from the input, the initial value
+  // is irrelevant.
+  int64_t lower_bound_{-1};
+  int64_t upper_bound_{-1};
+
+  // maps vertices to the edge they got expanded from. it is an optional
+  // edge because the root does not get expanded from anything.
+  // contains visited vertices as well as those scheduled to be visited.
+  utils::pmr::unordered_map<VertexAccessor, std::optional<EdgeAccessor>> processed_;
+  // edge, vertex we have yet to visit, for current and next depth and their accumulated paths
+  utils::pmr::vector<std::tuple<EdgeAccessor, VertexAccessor, std::optional<Path>>> to_visit_next_;
+  utils::pmr::vector<std::tuple<EdgeAccessor, VertexAccessor, std::optional<Path>>> to_visit_current_;
+  // Depths of the vertices in to_visit_current_ and to_visit_next_.
+  int64_t current_depth_{0};
+  int64_t next_depth_{0};
+  // Set if the vertices of to_visit_current_ were expanded together, as a level.
+  bool current_level_expanded_{false};
+  // Vertices in processed_, kept once the first level is expanded on worker
+  // threads, which check and claim the vertices concurrently.
+  std::optional<ConcurrentVertexSet> visited_;
+};
+
+namespace {
+
+void CheckWeightType(TypedValue current_weight, utils::MemoryResource *memory) {
+  if (current_weight.IsNull()) {
+    return;
+  }
+
+  if (!current_weight.IsNumeric() && !current_weight.IsDuration()) {
+    throw QueryRuntimeException("Calculated weight must be numeric or a Duration, got {}.", current_weight.type());
+  }
+
+  const auto is_valid_numeric = [&] {
+    return current_weight.IsNumeric() && (current_weight >= TypedValue(0, memory)).ValueBool();
   };
 
   const auto is_valid_duration = [&] {
@@ -2186,6 +2998,22 @@ TypedValue CalculateNextWeight(const std::optional<memgraph::query::plan::Expans
   return TypedValue(current_weight, memory) + total_weight;
 }
 
+/// Null is the smallest weight, like in the queue of the weighted shortest path.
+bool WeightLess(const TypedValue &lhs, const TypedValue &rhs) {
+  if (rhs.IsNull()) return false;
+  if (lhs.IsNull()) return true;
+  ValidateWeightTypes(lhs, rhs);
+  return (lhs < rhs).ValueBool();
+}
+
+/// Null weights add up like zero.
+TypedValue AddWeights(const TypedValue &lhs, const TypedValue &rhs) {
+  if (lhs.IsNull()) return rhs;
+  if (rhs.IsNull()) return lhs;
+  ValidateWeightTypes(lhs, rhs);
+  return lhs + rhs;
+}
+
 }  // namespace
 
 class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
@@ -2260,7 +3088,7 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
                                   const VertexAccessor &vertex, const TypedValue &weight, int64_t depth) {
       if (self_.common_.direction != EdgeAtom::Direction::IN) {
         auto out_edges = UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types)).edges;
-        for (const auto &edge : out_edges) {
+        for (const auto &edge : PrefetchedEdges(out_edges)) {
 #ifdef MG_ENTERPRISE
           if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
               !(context.auth_checker->Has(edge.To(), storage::View::OLD,
@@ -2275,7 +3103,7 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
       }
       if (self_.common_.direction != EdgeAtom::Direction::OUT) {
         auto in_edges = UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types)).edges;
-        for (const auto &edge : in_edges) {
+        for (const auto &edge : PrefetchedEdges(in_edges)) {
 #ifdef MG_ENTERPRISE
           if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
               !(context.auth_checker->Has(edge.From(), storage::View::OLD,
@@ -2470,6 +3298,270 @@ class ExpandWeightedShortestPathCursor : public query::plan::Cursor {
   }
 };
 
+/// Weighted shortest path between two bound nodes, used when the depth isn't
+/// bounded and the filter doesn't use the accumulated path.
+///
+/// Without a heuristic lambda, the search runs from both nodes at once, the
+/// one from the destination over the reversed edges, and it always continues
+/// on the side with the smaller weight on top of its queue. Each edge between
+/// the two searched regions gives a path, and the shortest of them is the
+/// shortest path once the weights on top of both queues add up to it. The
+/// searches then typically settle two balls of half the radius instead of a
+/// ball of the full radius around the source.
+///
+/// With a heuristic lambda, it is an A* search from the source, which
+/// prefers the nodes estimated to be closer to the destination. The path is
+/// the shortest if the estimates don't exceed the actual weights and don't
+/// drop by more than the weight of the edges along them.
+class ExpandWeightedShortestPathBetweenCursor : public query::plan::Cursor {
+ public:
+  ExpandWeightedShortestPathBetweenCursor(const ExpandVariable &self, utils::MemoryResource *mem)
+      : self_(self), input_cursor_(self_.input_->MakeCursor(mem)), forward_(mem), backward_(mem) {}
+
+  bool Pull(Frame &frame, ExecutionContext &context) override {
+    OOMExceptionEnabler oom_exception;
+    SCOPED_PROFILE_OP("ExpandWeightedShortestPath");
+
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                  storage::View::OLD);
+
+    while (input_cursor_->Pull(frame, context)) {
+      const auto &source_value = frame[self_.input_symbol_];
+      const auto &sink_value = frame[self_.common_.node_symbol];
+      // Due to optional matching the nodes could be null.
+      if (source_value.IsNull() || sink_value.IsNull()) continue;
+      source_ = source_value.ValueVertex();
+      sink_ = sink_value.ValueVertex();
+      // Paths ending at the starting node are never yielded.
+      if (*source_ == *sink_) continue;
+
+      forward_.Clear();
+      backward_.Clear();
+      best_.reset();
+      if (self_.heuristic_lambda_) {
+        SearchWithHeuristic(frame, evaluator, context);
+      } else {
+        SearchBidirectionally(frame, evaluator, context);
+      }
+      if (!best_) continue;
+
+      auto *pull_memory = context.evaluation_context.memory;
+      utils::pmr::vector<TypedValue> edge_list(pull_memory);
+      for (auto vertex = best_->forward_end; vertex != *source_;) {
+        const auto &edge = *forward_.labels.at(vertex).edge;
+        edge_list.emplace_back(edge);
+        vertex = edge.From() == vertex ? edge.To() : edge.From();
+      }
+      std::reverse(edge_list.begin(), edge_list.end());
+      if (best_->edge) edge_list.emplace_back(*best_->edge);
+      for (auto vertex = best_->backward_end; vertex != *sink_;) {
+        const auto &edge = *backward_.labels.at(vertex).edge;
+        edge_list.emplace_back(edge);
+        vertex = edge.From() == vertex ? edge.To() : edge.From();
+      }
+
+      if (self_.is_reverse_) {
+        std::reverse(edge_list.begin(), edge_list.end());
+      }
+      frame[self_.common_.edge_symbol] = std::move(edge_list);
+      frame[self_.total_weight_.value()] = std::move(best_->weight);
+      return true;
+    }
+    return false;
+  }
+
+  void Shutdown() override { input_cursor_->Shutdown(); }
+
+  void Reset() override {
+    input_cursor_->Reset();
+    forward_.Clear();
+    backward_.Clear();
+    best_.reset();
+  }
+
+ private:
+  struct Label {
+    TypedValue weight;
+    /// Edge to the previous node on the way to the node the search started at.
+    std::optional<EdgeAccessor> edge;
+    bool settled{false};
+  };
+
+  /// Queue entries are the priority, the weight and the node the weight is for.
+  using QueueEntry = std::tuple<TypedValue, TypedValue, VertexAccessor>;
+
+  struct QueueComparator {
+    bool operator()(const QueueEntry &lhs, const QueueEntry &rhs) const {
+      return WeightLess(std::get<0>(rhs), std::get<0>(lhs));
+    }
+  };
+
+  struct Search {
+    explicit Search(utils::MemoryResource *mem) : labels(mem), queue(mem) {}
+
+    /// Drops the entries of the settled nodes and of the nodes reached with a
+    /// smaller weight in the meantime from the top of the queue.
+    void DropStale() {
+      while (!queue.empty()) {
+        const auto &[priority, weight, vertex] = queue.top();
+        const auto &label = labels.at(vertex);
+        if (!label.settled && !WeightLess(label.weight, weight)) return;
+        queue.pop();
+      }
+    }
+
+    void Clear() {
+      labels.clear();
+      while (!queue.empty()) queue.pop();
+    }
+
+    utils::pmr::unordered_map<VertexAccessor, Label> labels;
+    std::priority_queue<QueueEntry, utils::pmr::vector<QueueEntry>, QueueComparator> queue;
+  };
+
+  /// Shortest path found so far, going through `edge` if the ends differ.
+  struct Meeting {
+    VertexAccessor forward_end;
+    std::optional<EdgeAccessor> edge;
+    VertexAccessor backward_end;
+    TypedValue weight;
+  };
+
+  void SearchBidirectionally(Frame &frame, ExpressionEvaluator &evaluator, ExecutionContext &context) {
+    forward_.labels.emplace(*source_, Label{.weight = StartingWeight(frame, evaluator), .settled = true});
+    backward_.labels.emplace(*sink_, Label{.settled = true});
+    ExpandFrom(forward_, false, *source_, frame, evaluator, context);
+    ExpandFrom(backward_, true, *sink_, frame, evaluator, context);
+
+    while (true) {
+      AbortCheck(context);
+      forward_.DropStale();
+      backward_.DropStale();
+      // Once either side ran out of nodes, all paths through it are known.
+      if (forward_.queue.empty() || backward_.queue.empty()) return;
+      const auto &forward_top = std::get<0>(forward_.queue.top());
+      const auto &backward_top = std::get<0>(backward_.queue.top());
+      if (best_ && !WeightLess(AddWeights(forward_top, backward_top), best_->weight)) return;
+
+      auto const backward = WeightLess(backward_top, forward_top);
+      auto &search = backward ? backward_ : forward_;
+      auto vertex = std::get<2>(search.queue.top());
+      search.queue.pop();
+      search.labels.at(vertex).settled = true;
+      ExpandFrom(search, backward, vertex, frame, evaluator, context);
+    }
+  }
+
+  void SearchWithHeuristic(Frame &frame, ExpressionEvaluator &evaluator, ExecutionContext &context) {
+    auto weight = StartingWeight(frame, evaluator);
+    auto priority = AddWeights(weight, Estimate(TypedValue(), *source_, frame, evaluator));
+    forward_.labels.emplace(*source_, Label{.weight = weight});
+    forward_.queue.emplace(std::move(priority), std::move(weight), *source_);
+
+    while (true) {
+      AbortCheck(context);
+      forward_.DropStale();
+      if (forward_.queue.empty()) return;
+      auto vertex = std::get<2>(forward_.queue.top());
+      forward_.queue.pop();
+      auto &label = forward_.labels.at(vertex);
+      label.settled = true;
+      if (vertex == *sink_) {
+        best_.emplace(Meeting{.forward_end = vertex, .backward_end = vertex, .weight = label.weight});
+        return;
+      }
+      ExpandFrom(forward_, false, vertex, frame, evaluator, context);
+    }
+  }
+
+  TypedValue StartingWeight(Frame &frame, ExpressionEvaluator &evaluator) const {
+    frame[self_.weight_lambda_->inner_edge_symbol] = TypedValue();
+    frame[self_.weight_lambda_->inner_node_symbol] = *source_;
+    return CalculateNextWeight(self_.weight_lambda_, /* total_weight */ TypedValue(), evaluator);
+  }
+
+  TypedValue Estimate(const TypedValue &edge, const VertexAccessor &vertex, Frame &frame,
+                      ExpressionEvaluator &evaluator) const {
+    frame[self_.heuristic_lambda_->inner_edge_symbol] = edge;
+    frame[self_.heuristic_lambda_->inner_node_symbol] = vertex;
+    auto estimate = self_.heuristic_lambda_->expression->Accept(evaluator);
+    CheckWeightType(estimate, evaluator.GetMemoryResource());
+    return estimate;
+  }
+
+  /// Relaxes the edges of the settled @p vertex. The backward search follows
+  /// the edges against the direction of the expansion, but the lambdas still
+  /// get the edges with the nodes they expand to in that direction.
+  void ExpandFrom(Search &search, bool backward, const VertexAccessor &vertex, Frame &frame,
+                  ExpressionEvaluator &evaluator, ExecutionContext &context) {
+    const auto &weight = search.labels.at(vertex).weight;
+    auto &other = backward ? forward_ : backward_;
+
+    auto relax = [&](const EdgeAccessor &edge, const VertexAccessor &next) {
+      const auto &expanded_to = backward ? vertex : next;
+#ifdef MG_ENTERPRISE
+      if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
+          !(context.auth_checker->Has(expanded_to, storage::View::OLD,
+                                      memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
+            context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
+        return;
+      }
+#endif
+      frame[self_.weight_lambda_->inner_edge_symbol] = edge;
+      frame[self_.weight_lambda_->inner_node_symbol] = expanded_to;
+      TypedValue next_weight = CalculateNextWeight(self_.weight_lambda_, weight, evaluator);
+      if (self_.filter_lambda_.expression) {
+        frame[self_.filter_lambda_.inner_edge_symbol] = edge;
+        frame[self_.filter_lambda_.inner_node_symbol] = expanded_to;
+        if (!EvaluateFilter(evaluator, self_.filter_lambda_.expression)) return;
+      }
+
+      if (auto found_it = other.labels.find(next); found_it != other.labels.end() && found_it->second.settled) {
+        auto path_weight = AddWeights(next_weight, found_it->second.weight);
+        if (!best_ || WeightLess(path_weight, best_->weight)) {
+          best_.emplace(Meeting{.forward_end = backward ? next : vertex,
+                                .edge = edge,
+                                .backward_end = backward ? vertex : next,
+                                .weight = std::move(path_weight)});
+        }
+      }
+
+      auto [label_it, inserted] = search.labels.try_emplace(next);
+      auto &label = label_it->second;
+      if (!inserted && (label.settled || !WeightLess(next_weight, label.weight))) return;
+      label.weight = next_weight;
+      label.edge = edge;
+      auto priority = self_.heuristic_lambda_
+                          ? AddWeights(next_weight, Estimate(TypedValue(edge), next, frame, evaluator))
+                          : next_weight;
+      search.queue.emplace(std::move(priority), std::move(next_weight), next);
+    };
+
+    // Going backward, the edges which come in to a node are the ones an
+    // expansion going out of their other end takes, and vice versa.
+    auto const follow_out_edges = backward ? self_.common_.direction != EdgeAtom::Direction::OUT
+                                           : self_.common_.direction != EdgeAtom::Direction::IN;
+    auto const follow_in_edges = backward ? self_.common_.direction != EdgeAtom::Direction::IN
+                                          : self_.common_.direction != EdgeAtom::Direction::OUT;
+    if (follow_out_edges) {
+      auto out_edges = UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types)).edges;
+      for (const auto &edge : PrefetchedEdges(out_edges)) relax(edge, edge.To());
+    }
+    if (follow_in_edges) {
+      auto in_edges = UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types)).edges;
+      for (const auto &edge : PrefetchedEdges(in_edges)) relax(edge, edge.From());
+    }
+  }
+
+  const ExpandVariable &self_;
+  const UniqueCursorPtr input_cursor_;
+  std::optional<VertexAccessor> source_;
+  std::optional<VertexAccessor> sink_;
+  Search forward_;
+  Search backward_;
+  std::optional<Meeting> best_;
+};
+
 class ExpandAllShortestPathsCursor : public query::plan::Cursor {
  public:
   ExpandAllShortestPathsCursor(const ExpandVariable &self, utils::MemoryResource *mem)
@@ -2560,7 +3652,7 @@ class ExpandAllShortestPathsCursor : public query::plan::Cursor {
                                   const VertexAccessor &vertex, const TypedValue &weight, int64_t depth) {
       if (self_.common_.direction != EdgeAtom::Direction::IN) {
         auto out_edges = UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types)).edges;
-        for (const auto &edge : out_edges) {
+        for (const auto &edge : PrefetchedEdges(out_edges)) {
 #ifdef MG_ENTERPRISE
           if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
               !(context.auth_checker->Has(edge.To(), storage::View::OLD,
@@ -2575,7 +3667,7 @@ class ExpandAllShortestPathsCursor : public query::plan::Cursor {
       }
       if (self_.common_.direction != EdgeAtom::Direction::OUT) {
         auto in_edges = UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types)).edges;
-        for (const auto &edge : in_edges) {
+        for (const auto &edge : PrefetchedEdges(in_edges)) {
 #ifdef MG_ENTERPRISE
           if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
               !(context.auth_checker->Has(edge.From(), storage::View::OLD,
@@ -2592,15 +3684,15 @@ class ExpandAllShortestPathsCursor : public query::plan::Cursor {
 
     std::optional<VertexAccessor> start_vertex;
 
-    auto create_path = [this, &frame, &memory]() {
+    auto create_path = [this, &frame]() {
       auto &current_level = traversal_stack_.back();
       auto &edges_on_frame = frame[self_.common_.edge_symbol].ValueList();
 
       // Clean out the current stack
-      if (current_level.empty()) {
+      if (current_level.first == current_level.second) {
         if (!edges_on_frame.empty()) {
           if (!self_.is_reverse_)
-            edges_on_frame.erase(edges_on_frame.end());
+            edges_on_frame.pop_back();
           else
             edges_on_frame.erase(edges_on_frame.begin());
         }
@@ -2608,8 +3700,7 @@ class ExpandAllShortestPathsCursor : public query::plan::Cursor {
         return false;
       }
 
-      auto [current_edge, current_edge_direction, current_weight] = current_level.back();
-      current_level.pop_back();
+      const auto &[current_edge, current_edge_direction, current_weight] = *--current_level.second;
 
       // Edges order depends on direction of expansion
       if (!self_.is_reverse_)
@@ -2620,13 +3711,11 @@ class ExpandAllShortestPathsCursor : public query::plan::Cursor {
       auto next_vertex = current_edge_direction == EdgeAtom::Direction::IN ? current_edge.From() : current_edge.To();
       frame[self_.total_weight_.value()] = current_weight;
 
-      if (next_edges_.find({next_vertex, traversal_stack_.size()}) != next_edges_.end()) {
-        auto next_vertex_edges = next_edges_[{next_vertex, traversal_stack_.size()}];
-        traversal_stack_.emplace_back(std::move(next_vertex_edges));
+      if (auto next_it = next_edges_.find({next_vertex, traversal_stack_.size()}); next_it != next_edges_.end()) {
+        traversal_stack_.emplace_back(next_it->second.begin(), next_it->second.end());
       } else {
         // Signal the end of iteration
-        utils::pmr::list<DirectedEdge> empty(memory);
-        traversal_stack_.emplace_back(std::move(empty));
+        traversal_stack_.emplace_back();
       }
 
       if ((current_weight > visited_cost_.at(next_vertex)).ValueBool()) return false;
@@ -2748,9 +3837,9 @@ class ExpandAllShortestPathsCursor : public query::plan::Cursor {
       create_DFS_traversal_tree();
 
       // DFS traversal tree is create,
-      if (start_vertex && next_edges_.find({*start_vertex, 0}) != next_edges_.end()) {
-        auto start_vertex_edges = next_edges_[{*start_vertex, 0}];
-        traversal_stack_.emplace_back(std::move(start_vertex_edges));
+      if (auto start_it = start_vertex ? next_edges_.find({*start_vertex, 0}) : next_edges_.end();
+          start_it != next_edges_.end()) {
+        traversal_stack_.emplace_back(start_it->second.begin(), start_it->second.end());
       }
     }
   }
@@ -2788,8 +3877,12 @@ class ExpandAllShortestPathsCursor : public query::plan::Cursor {
   utils::pmr::unordered_map<NextEdgesState, TypedValue, AspStateHash> total_cost_;
   // Maps the vertex with the potential expansion edge.
   utils::pmr::unordered_map<NextEdgesState, utils::pmr::list<DirectedEdge>, AspStateHash> next_edges_;
-  // Stack indicating the traversal level.
-  utils::pmr::list<utils::pmr::list<DirectedEdge>> traversal_stack_;
+  // Stack indicating the traversal level. Each level is the range of the
+  // edges in `next_edges_` which are yet to be traversed, so the traversal
+  // doesn't copy the edges of the tree. It is emptied from the back.
+  using TraversalLevel =
+      std::pair<utils::pmr::list<DirectedEdge>::const_iterator, utils::pmr::list<DirectedEdge>::const_iterator>;
+  utils::pmr::vector<TraversalLevel> traversal_stack_;
 
   // Priority queue comparator. Keep lowest weight on top of the queue.
   class PriorityQueueComparator {
@@ -2825,74 +3918,396 @@ class ExpandAllShortestPathsCursor : public query::plan::Cursor {
   }
 };
 
-UniqueCursorPtr ExpandVariable::MakeCursor(utils::MemoryResource *mem) const {
-  memgraph::metrics::IncrementCounter(memgraph::metrics::ExpandVariableOperator);
+/// The k shortest loopless paths between two bound nodes, searched for by
+/// Yen's algorithm. The paths are yielded in the order of their weight and
+/// each one is only searched for once it is pulled, so `LIMIT k` bounds the
+/// work.
+///
+/// The next path deviates from one of the yielded paths at some node of it,
+/// so it is the shortest path from that node, which avoids the nodes before
+/// it and the edges the yielded paths continue with from there, appended to
+/// the part of the yielded path before it. The yielded paths and the
+/// candidates for the next ones are kept in a tree in which the paths share
+/// the nodes of their common beginning, so a candidate only costs the part
+/// after its deviation.
+class ExpandKShortestPathsCursor : public query::plan::Cursor {
+ public:
+  ExpandKShortestPathsCursor(const ExpandVariable &self, utils::MemoryResource *mem)
+      : self_(self),
+        input_cursor_(self_.input_->MakeCursor(mem)),
+        tree_(mem),
+        candidates_(mem),
+        path_(mem),
+        spur_path_(mem),
+        blocked_vertices_(mem),
+        blocked_edges_(mem),
+        spur_vertices_(mem),
+        labels_(mem),
+        queue_(mem) {}
 
-  switch (type_) {
-    case EdgeAtom::Type::BREADTH_FIRST:
-      if (common_.existing_node) {
-        return MakeUniqueCursorPtr<STShortestPathCursor>(mem, *this, mem);
+  bool Pull(Frame &frame, ExecutionContext &context) override {
+    OOMExceptionEnabler oom_exception;
+    SCOPED_PROFILE_OP("ExpandKShortestPaths");
+
+    if (!self_.common_.existing_node) {
+      throw QueryRuntimeException("K shortest paths expansion needs both of its nodes to be matched before it.");
+    }
+
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                  storage::View::OLD);
+
+    while (true) {
+      AbortCheck(context);
+      if (last_ == kNoNode) {
+        if (!input_cursor_->Pull(frame, context)) return false;
+        const auto &source_value = frame[self_.input_symbol_];
+        const auto &sink_value = frame[self_.common_.node_symbol];
+        // Due to optional matching the nodes could be null.
+        if (source_value.IsNull() || sink_value.IsNull()) continue;
+        const auto &source = source_value.ValueVertex();
+        // Paths ending at the starting node are never yielded.
+        if (source == sink_value.ValueVertex()) continue;
+
+        if (self_.upper_bound_) {
+          upper_bound_ = EvaluateInt(evaluator, self_.upper_bound_, "Max depth in k shortest paths expansion");
+          upper_bound_set_ = true;
+        } else {
+          upper_bound_ = std::numeric_limits<int64_t>::max();
+          upper_bound_set_ = false;
+        }
+        if (upper_bound_ < 1) {
+          throw QueryRuntimeException("Maximum depth in k shortest paths expansion must be at least 1.");
+        }
+
+        Clear();
+        sink_ = sink_value.ValueVertex();
+        frame[self_.weight_lambda_->inner_edge_symbol] = TypedValue();
+        frame[self_.weight_lambda_->inner_node_symbol] = source;
+        auto weight = CalculateNextWeight(self_.weight_lambda_, /* total_weight */ TypedValue(), evaluator);
+        tree_.push_back(TreeNode{.vertex = source, .weight = std::move(weight)});
+        blocked_vertices_.insert(source);
+        SearchSpur(0, frame, evaluator, context);
       } else {
-        return MakeUniqueCursorPtr<SingleSourceShortestPathCursor>(mem, *this, mem);
+        Deviate(frame, evaluator, context);
       }
-    case EdgeAtom::Type::DEPTH_FIRST:
-      return MakeUniqueCursorPtr<ExpandVariableCursor>(mem, *this, mem);
-    case EdgeAtom::Type::WEIGHTED_SHORTEST_PATH:
-      return MakeUniqueCursorPtr<ExpandWeightedShortestPathCursor>(mem, *this, mem);
-    case EdgeAtom::Type::ALL_SHORTEST_PATHS:
-      return MakeUniqueCursorPtr<ExpandAllShortestPathsCursor>(mem, *this, mem);
-    case EdgeAtom::Type::SINGLE:
-      LOG_FATAL("ExpandVariable should not be planned for a single expansion!");
+
+      if (candidates_.empty()) {
+        last_ = kNoNode;
+        continue;
+      }
+      last_ = candidates_.top().second;
+      candidates_.pop();
+      for (auto node = last_; node != kNoNode; node = tree_[node].parent) tree_[node].yielded = true;
+
+      auto *pull_memory = context.evaluation_context.memory;
+      utils::pmr::vector<TypedValue> edge_list(pull_memory);
+      for (auto node = last_; tree_[node].edge; node = tree_[node].parent) {
+        edge_list.emplace_back(*tree_[node].edge);
+      }
+      if (!self_.is_reverse_) {
+        std::reverse(edge_list.begin(), edge_list.end());
+      }
+      frame[self_.common_.edge_symbol] = std::move(edge_list);
+      frame[self_.total_weight_.value()] = tree_[last_].weight;
+      return true;
+    }
   }
-}
 
-std::string ExpandVariable::ToString() const {
-  return fmt::format(
-      "{} ({}){}[{}{}]{}({})", OperatorName(), input_symbol_.name(),
-      common_.direction == query::EdgeAtom::Direction::IN ? "<-" : "-", common_.edge_symbol.name(),
-      utils::IterableToString(common_.edge_types, "|",
-                              [this](const auto &edge_type) { return ":" + dba_->EdgeTypeToName(edge_type); }),
-      common_.direction == query::EdgeAtom::Direction::OUT ? "->" : "-", common_.node_symbol.name());
-}
+  void Shutdown() override { input_cursor_->Shutdown(); }
 
-class ConstructNamedPathCursor : public Cursor {
- public:
-  ConstructNamedPathCursor(ConstructNamedPath self, utils::MemoryResource *mem)
-      : self_(std::move(self)), input_cursor_(self_.input()->MakeCursor(mem)) {}
+  void Reset() override {
+    input_cursor_->Reset();
+    Clear();
+  }
 
-  bool Pull(Frame &frame, ExecutionContext &context) override {
-    OOMExceptionEnabler oom_exception;
-    SCOPED_PROFILE_OP("ConstructNamedPath");
+ private:
+  static constexpr size_t kNoNode = std::numeric_limits<size_t>::max();
+
+  /// Node of the tree of the paths, which is rooted in the source.
+  struct TreeNode {
+    size_t parent{kNoNode};
+    size_t first_child{kNoNode};
+    size_t next_sibling{kNoNode};
+    /// Edge from the parent, none in the root.
+    std::optional<EdgeAccessor> edge;
+    VertexAccessor vertex;
+    /// Weight of the path from the source to the node.
+    TypedValue weight;
+    int64_t depth{0};
+    /// Set if one of the paths found so far ends in the node.
+    bool path_end{false};
+    /// Set if the node is on one of the yielded paths.
+    bool yielded{false};
+  };
 
-    if (!input_cursor_->Pull(frame, context)) return false;
+  struct Label {
+    TypedValue weight;
+    /// Edge to the previous node on the way to the node the search started at.
+    std::optional<EdgeAccessor> edge;
+    bool settled{false};
+  };
 
-    auto symbol_it = self_.path_elements_.begin();
-    DMG_ASSERT(symbol_it != self_.path_elements_.end(), "Named path must contain at least one node");
+  using State = std::pair<VertexAccessor, int64_t>;
 
-    const auto &start_vertex = frame[*symbol_it++];
-    auto *pull_memory = context.evaluation_context.memory;
-    // In an OPTIONAL MATCH everything could be Null.
-    if (start_vertex.IsNull()) {
-      frame[self_.path_symbol_] = TypedValue(pull_memory);
-      return true;
+  struct StateHash {
+    size_t operator()(const State &key) const {
+      return utils::HashCombine<VertexAccessor, int64_t>{}(key.first, key.second);
     }
+  };
 
-    DMG_ASSERT(start_vertex.IsVertex(), "First named path element must be a vertex");
-    query::Path path(start_vertex.ValueVertex(), pull_memory);
+  /// Candidates are the weight of the path and the tree node it ends in.
+  using Candidate = std::pair<TypedValue, size_t>;
 
-    // If the last path element symbol was for an edge list, then
-    // the next symbol is a vertex and it should not append to the path
-    // because
-    // expansion already did it.
-    bool last_was_edge_list = false;
+  struct CandidateComparator {
+    bool operator()(const Candidate &lhs, const Candidate &rhs) const { return WeightLess(rhs.first, lhs.first); }
+  };
 
-    for (; symbol_it != self_.path_elements_.end(); symbol_it++) {
-      const auto &expansion = frame[*symbol_it];
-      //  We can have Null (OPTIONAL MATCH), a vertex, an edge, or an edge
-      //  list (variable expand or BFS).
-      switch (expansion.type()) {
-        case TypedValue::Type::Null:
-          frame[self_.path_symbol_] = TypedValue(pull_memory);
+  /// Queue entries are the weight, the depth and the node the weight is for.
+  using QueueEntry = std::tuple<TypedValue, int64_t, VertexAccessor>;
+
+  struct QueueComparator {
+    bool operator()(const QueueEntry &lhs, const QueueEntry &rhs) const {
+      return WeightLess(std::get<0>(rhs), std::get<0>(lhs));
+    }
+  };
+
+  /// With an upper bound, a node reached with fewer edges can still lead to
+  /// a path which is shorter in weight, so the depth is a part of the state.
+  State MakeState(const VertexAccessor &vertex, int64_t depth) const {
+    return {vertex, upper_bound_set_ ? depth : 0};
+  }
+
+  void Clear() {
+    tree_.clear();
+    while (!candidates_.empty()) candidates_.pop();
+    blocked_vertices_.clear();
+    last_ = kNoNode;
+  }
+
+  /// Adds the candidates deviating from the last yielded path.
+  void Deviate(Frame &frame, ExpressionEvaluator &evaluator, ExecutionContext &context) {
+    path_.clear();
+    for (auto node = last_; node != kNoNode; node = tree_[node].parent) path_.push_back(node);
+    std::reverse(path_.begin(), path_.end());
+
+    blocked_vertices_.clear();
+    for (size_t i = 0; i + 1 < path_.size() && tree_[path_[i]].depth < upper_bound_; ++i) {
+      blocked_vertices_.insert(tree_[path_[i]].vertex);
+      SearchSpur(path_[i], frame, evaluator, context);
+    }
+  }
+
+  /// Dijkstra's search for the shortest path from the tree node @p spur to
+  /// the sink, which doesn't enter the blocked nodes and doesn't start with
+  /// the edges the yielded paths continue with from @p spur. The path found
+  /// is added to the candidates, unless it was found before.
+  void SearchSpur(size_t spur, Frame &frame, ExpressionEvaluator &evaluator, ExecutionContext &context) {
+    blocked_edges_.clear();
+    for (auto child = tree_[spur].first_child; child != kNoNode; child = tree_[child].next_sibling) {
+      if (tree_[child].yielded) blocked_edges_.insert(*tree_[child].edge);
+    }
+    labels_.clear();
+    while (!queue_.empty()) queue_.pop();
+
+    labels_.emplace(MakeState(tree_[spur].vertex, tree_[spur].depth), Label{.weight = tree_[spur].weight});
+    queue_.emplace(tree_[spur].weight, tree_[spur].depth, tree_[spur].vertex);
+    while (!queue_.empty()) {
+      AbortCheck(context);
+      auto [weight, depth, vertex] = queue_.top();
+      queue_.pop();
+      auto &label = labels_.at(MakeState(vertex, depth));
+      if (label.settled || WeightLess(label.weight, weight)) continue;
+      label.settled = true;
+      if (vertex == *sink_) {
+        if (AddCandidate(spur, depth)) return;
+        continue;
+      }
+      if (depth < upper_bound_) {
+        ExpandFrom(vertex, weight, depth, depth == tree_[spur].depth, frame, evaluator, context);
+      }
+    }
+  }
+
+  void ExpandFrom(const VertexAccessor &vertex, const TypedValue &weight, int64_t depth, bool first, Frame &frame,
+                  ExpressionEvaluator &evaluator, ExecutionContext &context) {
+    auto relax = [&](const EdgeAccessor &edge, const VertexAccessor &next) {
+      if (blocked_vertices_.contains(next)) return;
+      if (first && blocked_edges_.contains(edge)) return;
+#ifdef MG_ENTERPRISE
+      if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker &&
+          !(context.auth_checker->Has(next, storage::View::OLD,
+                                      memgraph::query::AuthQuery::FineGrainedPrivilege::READ) &&
+            context.auth_checker->Has(edge, memgraph::query::AuthQuery::FineGrainedPrivilege::READ))) {
+        return;
+      }
+#endif
+      frame[self_.weight_lambda_->inner_edge_symbol] = edge;
+      frame[self_.weight_lambda_->inner_node_symbol] = next;
+      TypedValue next_weight = CalculateNextWeight(self_.weight_lambda_, weight, evaluator);
+      if (self_.filter_lambda_.expression) {
+        frame[self_.filter_lambda_.inner_edge_symbol] = edge;
+        frame[self_.filter_lambda_.inner_node_symbol] = next;
+        if (!EvaluateFilter(evaluator, self_.filter_lambda_.expression)) return;
+      }
+
+      auto [label_it, inserted] = labels_.try_emplace(MakeState(next, depth + 1));
+      auto &label = label_it->second;
+      if (!inserted && (label.settled || !WeightLess(next_weight, label.weight))) return;
+      label.weight = next_weight;
+      label.edge = edge;
+      queue_.emplace(std::move(next_weight), depth + 1, next);
+    };
+
+    if (self_.common_.direction != EdgeAtom::Direction::IN) {
+      auto out_edges = UnwrapEdgesResult(vertex.OutEdges(storage::View::OLD, self_.common_.edge_types)).edges;
+      for (const auto &edge : PrefetchedEdges(out_edges)) relax(edge, edge.To());
+    }
+    if (self_.common_.direction != EdgeAtom::Direction::OUT) {
+      auto in_edges = UnwrapEdgesResult(vertex.InEdges(storage::View::OLD, self_.common_.edge_types)).edges;
+      for (const auto &edge : PrefetchedEdges(in_edges)) relax(edge, edge.From());
+    }
+  }
+
+  /// Adds the path from the tree node @p spur to the sink reached with
+  /// @p depth edges to the tree. Returns false if the path isn't loopless,
+  /// which can only be the case with an upper bound.
+  bool AddCandidate(size_t spur, int64_t depth) {
+    spur_path_.clear();
+    auto vertex = *sink_;
+    for (const auto *label = &labels_.at(MakeState(vertex, depth)); label->edge;) {
+      spur_path_.emplace_back(*label->edge, vertex, label->weight);
+      vertex = label->edge->From() == vertex ? label->edge->To() : label->edge->From();
+      label = &labels_.at(MakeState(vertex, --depth));
+    }
+    if (upper_bound_set_) {
+      spur_vertices_.clear();
+      for (const auto &[edge, next, weight] : spur_path_) {
+        if (!spur_vertices_.insert(next).second) return false;
+      }
+    }
+
+    auto node = spur;
+    for (auto it = spur_path_.rbegin(); it != spur_path_.rend(); ++it) {
+      auto &[edge, next, weight] = *it;
+      node = AddChild(node, edge, next, std::move(weight));
+    }
+    if (!tree_[node].path_end) {
+      tree_[node].path_end = true;
+      candidates_.emplace(tree_[node].weight, node);
+    }
+    return true;
+  }
+
+  size_t AddChild(size_t parent, const EdgeAccessor &edge, const VertexAccessor &vertex, TypedValue weight) {
+    for (auto child = tree_[parent].first_child; child != kNoNode; child = tree_[child].next_sibling) {
+      if (*tree_[child].edge == edge) return child;
+    }
+    tree_.push_back(TreeNode{.parent = parent,
+                             .next_sibling = tree_[parent].first_child,
+                             .edge = edge,
+                             .vertex = vertex,
+                             .weight = std::move(weight),
+                             .depth = tree_[parent].depth + 1});
+    tree_[parent].first_child = tree_.size() - 1;
+    return tree_.size() - 1;
+  }
+
+  const ExpandVariable &self_;
+  const UniqueCursorPtr input_cursor_;
+  std::optional<VertexAccessor> sink_;
+
+  // Upper bound on the path length.
+  int64_t upper_bound_{-1};
+  bool upper_bound_set_{false};
+
+  utils::pmr::vector<TreeNode> tree_;
+  std::priority_queue<Candidate, utils::pmr::vector<Candidate>, CandidateComparator> candidates_;
+  /// Tree node the last yielded path ends in.
+  size_t last_{kNoNode};
+
+  // State of the deviations from the last yielded path.
+  utils::pmr::vector<size_t> path_;
+  utils::pmr::vector<std::tuple<EdgeAccessor, VertexAccessor, TypedValue>> spur_path_;
+  utils::pmr::unordered_set<VertexAccessor> blocked_vertices_;
+  utils::pmr::unordered_set<EdgeAccessor> blocked_edges_;
+  utils::pmr::unordered_set<VertexAccessor> spur_vertices_;
+  utils::pmr::unordered_map<State, Label, StateHash> labels_;
+  std::priority_queue<QueueEntry, utils::pmr::vector<QueueEntry>, QueueComparator> queue_;
+};
+
+UniqueCursorPtr ExpandVariable::MakeCursor(utils::MemoryResource *mem) const {
+  memgraph::metrics::IncrementCounter(memgraph::metrics::ExpandVariableOperator);
+
+  switch (type_) {
+    case EdgeAtom::Type::BREADTH_FIRST:
+      if (common_.existing_node) {
+        return MakeUniqueCursorPtr<STShortestPathCursor>(mem, *this, mem);
+      } else {
+        return MakeUniqueCursorPtr<SingleSourceShortestPathCursor>(mem, *this, mem);
+      }
+    case EdgeAtom::Type::DEPTH_FIRST:
+      return MakeUniqueCursorPtr<ExpandVariableCursor>(mem, *this, mem);
+    case EdgeAtom::Type::WEIGHTED_SHORTEST_PATH:
+      if (common_.existing_node && !upper_bound_ && !filter_lambda_.accumulated_path_symbol) {
+        return MakeUniqueCursorPtr<ExpandWeightedShortestPathBetweenCursor>(mem, *this, mem);
+      }
+      return MakeUniqueCursorPtr<ExpandWeightedShortestPathCursor>(mem, *this, mem);
+    case EdgeAtom::Type::ALL_SHORTEST_PATHS:
+      return MakeUniqueCursorPtr<ExpandAllShortestPathsCursor>(mem, *this, mem);
+    case EdgeAtom::Type::K_SHORTEST_PATHS:
+      return MakeUniqueCursorPtr<ExpandKShortestPathsCursor>(mem, *this, mem);
+    case EdgeAtom::Type::SINGLE:
+      LOG_FATAL("ExpandVariable should not be planned for a single expansion!");
+  }
+}
+
+std::string ExpandVariable::ToString() const {
+  return fmt::format(
+      "{} ({}){}[{}{}]{}({})", OperatorName(), input_symbol_.name(),
+      common_.direction == query::EdgeAtom::Direction::IN ? "<-" : "-", common_.edge_symbol.name(),
+      utils::IterableToString(common_.edge_types, "|",
+                              [this](const auto &edge_type) { return ":" + dba_->EdgeTypeToName(edge_type); }),
+      common_.direction == query::EdgeAtom::Direction::OUT ? "->" : "-", common_.node_symbol.name());
+}
+
+class ConstructNamedPathCursor : public Cursor {
+ public:
+  ConstructNamedPathCursor(ConstructNamedPath self, utils::MemoryResource *mem)
+      : self_(std::move(self)), input_cursor_(self_.input()->MakeCursor(mem)) {}
+
+  bool Pull(Frame &frame, ExecutionContext &context) override {
+    OOMExceptionEnabler oom_exception;
+    SCOPED_PROFILE_OP("ConstructNamedPath");
+
+    if (!input_cursor_->Pull(frame, context)) return false;
+
+    auto symbol_it = self_.path_elements_.begin();
+    DMG_ASSERT(symbol_it != self_.path_elements_.end(), "Named path must contain at least one node");
+
+    const auto &start_vertex = frame[*symbol_it++];
+    auto *pull_memory = context.evaluation_context.memory;
+    // In an OPTIONAL MATCH everything could be Null.
+    if (start_vertex.IsNull()) {
+      frame[self_.path_symbol_] = TypedValue(pull_memory);
+      return true;
+    }
+
+    DMG_ASSERT(start_vertex.IsVertex(), "First named path element must be a vertex");
+    query::Path path(start_vertex.ValueVertex(), pull_memory);
+
+    // If the last path element symbol was for an edge list, then
+    // the next symbol is a vertex and it should not append to the path
+    // because
+    // expansion already did it.
+    bool last_was_edge_list = false;
+
+    for (; symbol_it != self_.path_elements_.end(); symbol_it++) {
+      const auto &expansion = frame[*symbol_it];
+      //  We can have Null (OPTIONAL MATCH), a vertex, an edge, or an edge
+      //  list (variable expand or BFS).
+      switch (expansion.type()) {
+        case TypedValue::Type::Null:
+          frame[self_.path_symbol_] = TypedValue(pull_memory);
           return true;
         case TypedValue::Type::Vertex:
           if (!last_was_edge_list) path.Expand(expansion.ValueVertex());
@@ -3007,11 +4422,32 @@ bool Filter::FilterCursor::Pull(Frame &frame, ExecutionContext &context) {
   // nodes and edges.
   ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
                                 storage::View::OLD, context.frame_change_collector);
+  const auto *compiled = FindCompiledExpression(context, self_.expression_);
   while (input_cursor_->Pull(frame, context)) {
     for (const auto &pattern_filter_cursor : pattern_filter_cursors_) {
       pattern_filter_cursor->Pull(frame, context);
     }
-    if (EvaluateFilter(evaluator, self_.expression_)) return true;
+    if (EvaluateFilter(evaluator, self_.expression_, compiled, frame, context, storage::View::OLD)) return true;
+  }
+  return false;
+}
+
+bool Filter::FilterCursor::PullBatch(Frame &frame, FrameBatch &batch, ExecutionContext &context) {
+  OOMExceptionEnabler oom_exception;
+  SCOPED_PROFILE_OP_BY_REF(self_);
+
+  const auto *compiled = FindCompiledExpression(context, self_.expression_);
+  // The rows are filtered in place, so the batch reuses the buffers of the input
+  while (input_cursor_->PullBatch(frame, batch, context)) {
+    batch.Retain([&](Frame &row) {
+      ExpressionEvaluator evaluator(&row, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                    storage::View::OLD, context.frame_change_collector);
+      for (const auto &pattern_filter_cursor : pattern_filter_cursors_) {
+        pattern_filter_cursor->Pull(row, context);
+      }
+      return EvaluateFilter(evaluator, self_.expression_, compiled, row, context, storage::View::OLD);
+    });
+    if (!batch.empty()) return true;
   }
   return false;
 }
@@ -3020,8 +4456,148 @@ void Filter::FilterCursor::Shutdown() { input_cursor_->Shutdown(); }
 
 void Filter::FilterCursor::Reset() { input_cursor_->Reset(); }
 
-EvaluatePatternFilter::EvaluatePatternFilter(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol)
-    : input_(input), output_symbol_(std::move(output_symbol)) {}
+LoadProperties::LoadProperties(const std::shared_ptr<LogicalOperator> &input, std::vector<Entry> entries)
+    : input_(input), entries_(std::move(entries)) {}
+
+ACCEPT_WITH_INPUT(LoadProperties)
+
+std::vector<Symbol> LoadProperties::ModifiedSymbols(const SymbolTable &table) const {
+  auto symbols = input_->ModifiedSymbols(table);
+  for (const auto &entry : entries_) {
+    symbols.insert(symbols.end(), entry.output_symbols.begin(), entry.output_symbols.end());
+  }
+  return symbols;
+}
+
+std::string LoadProperties::ToString() const {
+  return fmt::format("LoadProperties {{{}}}", utils::IterableToString(entries_, ", ", [](const auto &entry) {
+                       return utils::IterableToString(entry.lookups, ", ", [&entry](const auto *lookup) {
+                         return fmt::format("{}.{}", entry.symbol.name(), lookup->property_.name);
+                       });
+                     }));
+}
+
+namespace {
+
+class LoadPropertiesCursor : public Cursor {
+ public:
+  LoadPropertiesCursor(const LoadProperties &self, utils::MemoryResource *mem)
+      : self_(self), input_cursor_(self.input_->MakeCursor(mem)) {}
+
+  bool Pull(Frame &frame, ExecutionContext &context) override {
+    OOMExceptionEnabler oom_exception;
+    SCOPED_PROFILE_OP_BY_REF(self_);
+
+    if (!input_cursor_->Pull(frame, context)) return false;
+    // The operators above are read-only, so the OLD view is the one they see.
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                  storage::View::OLD);
+    for (const auto &entry : self_.entries_) {
+      Load(entry, frame, context, evaluator);
+    }
+    return true;
+  }
+
+  void Shutdown() override { input_cursor_->Shutdown(); }
+
+  void Reset() override { input_cursor_->Reset(); }
+
+ private:
+  void Load(const LoadProperties::Entry &entry, Frame &frame, const ExecutionContext &context,
+            ExpressionEvaluator &evaluator) {
+    const auto &object = frame[entry.symbol];
+    if (object.IsVertex()) {
+      properties_.clear();
+      for (const auto *lookup : entry.lookups) {
+        properties_.push_back(context.evaluation_context.properties[lookup->property_.ix]);
+      }
+      auto values = object.ValueVertex().GetProperties(storage::View::OLD, properties_);
+      if (values.HasValue()) {
+        for (size_t i = 0; i < values->size(); ++i) {
+          frame[entry.output_symbols[i]] = TypedValue(std::move((*values)[i]), context.evaluation_context.memory);
+        }
+        return;
+      }
+      // The lookups report the error, as if the properties were read one by one.
+    }
+    for (size_t i = 0; i < entry.lookups.size(); ++i) {
+      frame[entry.output_symbols[i]] = entry.lookups[i]->Accept(evaluator);
+    }
+  }
+
+  const LoadProperties &self_;
+  const UniqueCursorPtr input_cursor_;
+  std::vector<storage::PropertyId> properties_;
+};
+
+}  // namespace
+
+UniqueCursorPtr LoadProperties::MakeCursor(utils::MemoryResource *mem) const {
+  memgraph::metrics::IncrementCounter(memgraph::metrics::LoadPropertiesOperator);
+
+  return MakeUniqueCursorPtr<LoadPropertiesCursor>(mem, *this, mem);
+}
+
+ComputeExpressions::ComputeExpressions(const std::shared_ptr<LogicalOperator> &input,
+                                       std::vector<Expression *> expressions, std::vector<Symbol> output_symbols)
+    : input_(input), expressions_(std::move(expressions)), output_symbols_(std::move(output_symbols)) {}
+
+ACCEPT_WITH_INPUT(ComputeExpressions)
+
+std::vector<Symbol> ComputeExpressions::ModifiedSymbols(const SymbolTable &table) const {
+  auto symbols = input_->ModifiedSymbols(table);
+  symbols.insert(symbols.end(), output_symbols_.begin(), output_symbols_.end());
+  return symbols;
+}
+
+namespace {
+
+class ComputeExpressionsCursor : public Cursor {
+ public:
+  ComputeExpressionsCursor(const ComputeExpressions &self, utils::MemoryResource *mem)
+      : self_(self), input_cursor_(self.input_->MakeCursor(mem)) {}
+
+  bool Pull(Frame &frame, ExecutionContext &context) override {
+    OOMExceptionEnabler oom_exception;
+    SCOPED_PROFILE_OP_BY_REF(self_);
+
+    if (!input_cursor_->Pull(frame, context)) return false;
+    // The operators above are read-only, so the OLD view is the one they see.
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                  storage::View::OLD);
+    for (size_t i = 0; i < self_.expressions_.size(); ++i) {
+      auto *expression = self_.expressions_[i];
+      if (const auto *compiled = FindCompiledExpression(context, expression)) {
+        if (auto value = compiled->Evaluate(frame, context.evaluation_context, storage::View::OLD)) {
+          frame[self_.output_symbols_[i]] = *std::move(value);
+          continue;
+        }
+      }
+      frame[self_.output_symbols_[i]] = expression->Accept(evaluator);
+    }
+    return true;
+  }
+
+  void Shutdown() override { input_cursor_->Shutdown(); }
+
+  void Reset() override { input_cursor_->Reset(); }
+
+ private:
+  const ComputeExpressions &self_;
+  const UniqueCursorPtr input_cursor_;
+};
+
+}  // namespace
+
+UniqueCursorPtr ComputeExpressions::MakeCursor(utils::MemoryResource *mem) const {
+  memgraph::metrics::IncrementCounter(memgraph::metrics::ComputeExpressionsOperator);
+
+  return MakeUniqueCursorPtr<ComputeExpressionsCursor>(mem, *this, mem);
+}
+
+EvaluatePatternFilter::EvaluatePatternFilter(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol,
+                                             std::optional<std::vector<Symbol>> correlated_symbols)
+    : input_(input), output_symbol_(std::move(output_symbol)), correlated_symbols_(std::move(correlated_symbols)) {}
 
 ACCEPT_WITH_INPUT(EvaluatePatternFilter);
 
@@ -3033,7 +4609,7 @@ UniqueCursorPtr EvaluatePatternFilter::MakeCursor(utils::MemoryResource *mem) co
 
 EvaluatePatternFilter::EvaluatePatternFilterCursor::EvaluatePatternFilterCursor(const EvaluatePatternFilter &self,
                                                                                 utils::MemoryResource *mem)
-    : self_(self), input_cursor_(self_.input_->MakeCursor(mem)) {}
+    : self_(self), input_cursor_(self_.input_->MakeCursor(mem)), results_(mem) {}
 
 std::vector<Symbol> EvaluatePatternFilter::ModifiedSymbols(const SymbolTable &table) const {
   return input_->ModifiedSymbols(table);
@@ -3041,18 +4617,44 @@ std::vector<Symbol> EvaluatePatternFilter::ModifiedSymbols(const SymbolTable &ta
 
 bool EvaluatePatternFilter::EvaluatePatternFilterCursor::Pull(Frame &frame, ExecutionContext &context) {
   SCOPED_PROFILE_OP("EvaluatePatternFilter");
-  std::function<void(TypedValue *)> function = [&frame, self = this->self_, input_cursor = this->input_cursor_.get(),
-                                                &context](TypedValue *return_value) {
+  std::function<void(TypedValue *)> function = [&frame, this, &context](TypedValue *return_value) {
     OOMExceptionEnabler oom_exception;
-    input_cursor->Reset();
-
-    *return_value = TypedValue(input_cursor->Pull(frame, context), context.evaluation_context.memory);
+    *return_value = TypedValue(Evaluate(frame, context), context.evaluation_context.memory);
   };
 
   frame[self_.output_symbol_] = TypedValue(std::move(function));
   return true;
 }
 
+bool EvaluatePatternFilter::EvaluatePatternFilterCursor::Evaluate(Frame &frame, ExecutionContext &context) {
+  // The pattern stops at its first match, so a row costs at most one search
+  // and the rows which agree on the correlated symbols share it
+  const auto pull = [&] {
+    input_cursor_->Reset();
+    return input_cursor_->Pull(frame, context);
+  };
+  if (!self_.correlated_symbols_) return pull();
+
+  // Committed changes become visible to the pattern in the next transaction
+  // of a periodic commit
+  const auto transaction_id = context.db_accessor->GetTransactionId();
+  if (results_transaction_id_ != transaction_id) {
+    results_.clear();
+    results_transaction_id_ = transaction_id;
+  }
+
+  utils::pmr::vector<TypedValue> key(results_.get_allocator().resource());
+  key.reserve(self_.correlated_symbols_->size());
+  for (const auto &symbol : *self_.correlated_symbols_) {
+    key.emplace_back(frame[symbol]);
+  }
+  if (auto it = results_.find(key); it != results_.end()) return it->second;
+
+  const auto result = pull();
+  results_.emplace(std::move(key), result);
+  return result;
+}
+
 void EvaluatePatternFilter::EvaluatePatternFilterCursor::Shutdown() { input_cursor_->Shutdown(); }
 
 void EvaluatePatternFilter::EvaluatePatternFilterCursor::Reset() { input_cursor_->Reset(); }
@@ -3093,13 +4695,31 @@ bool Produce::ProduceCursor::Pull(Frame &frame, ExecutionContext &context) {
       if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(named_expr->name_)) {
         context.frame_change_collector->ResetTrackingValue(named_expr->name_);
       }
-      named_expr->Accept(evaluator);
+      EvaluateNamedExpression(evaluator, named_expr, frame, context, storage::View::NEW);
     }
     return true;
   }
   return false;
 }
 
+bool Produce::ProduceCursor::PullBatch(Frame &frame, FrameBatch &batch, ExecutionContext &context) {
+  OOMExceptionEnabler oom_exception;
+  SCOPED_PROFILE_OP_BY_REF(self_);
+
+  if (!input_cursor_->PullBatch(frame, batch, context)) return false;
+  for (size_t row = 0; row < batch.size(); ++row) {
+    ExpressionEvaluator evaluator(&batch[row], context.symbol_table, context.evaluation_context, context.db_accessor,
+                                  storage::View::NEW, context.frame_change_collector);
+    for (auto *named_expr : self_.named_expressions_) {
+      if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(named_expr->name_)) {
+        context.frame_change_collector->ResetTrackingValue(named_expr->name_);
+      }
+      EvaluateNamedExpression(evaluator, named_expr, batch[row], context, storage::View::NEW);
+    }
+  }
+  return true;
+}
+
 void Produce::ProduceCursor::Shutdown() { input_cursor_->Shutdown(); }
 
 void Produce::ProduceCursor::Reset() { input_cursor_->Reset(); }
@@ -3887,17 +5507,39 @@ std::vector<Symbol> EmptyResult::ModifiedSymbols(const SymbolTable &) const {  /
   return {};
 }
 
+namespace {
+/// Returns the Unwind at the bottom of @p op if the operators above it only
+/// read or write the graph for the row they are given, so that parts of the
+/// unwound list can be written independently of each other.
+const Unwind *FindRowLocalUnwind(const LogicalOperator &op) {
+  const auto &type = op.GetTypeInfo();
+  if (type == Unwind::kType) {
+    const auto &unwind = static_cast<const Unwind &>(op);
+    return unwind.input_->GetTypeInfo() == Once::kType ? &unwind : nullptr;
+  }
+  static const std::array kRowLocalTypes{
+      &CreateNode::kType,   &CreateExpand::kType,   &SetProperty::kType,         &SetProperties::kType,
+      &SetLabels::kType,    &RemoveProperty::kType, &RemoveLabels::kType,        &Filter::kType,
+      &Produce::kType,      &ScanAll::kType,        &ScanAllByLabel::kType,      &ScanAllByLabelPropertyValue::kType,
+      &ScanAllById::kType,  &Expand::kType,         &EdgeUniquenessFilter::kType, &ConstructNamedPath::kType};
+  if (std::ranges::find(kRowLocalTypes, &type) == kRowLocalTypes.end()) return nullptr;
+  return FindRowLocalUnwind(*op.input());
+}
+}  // namespace
+
 class EmptyResultCursor : public Cursor {
  public:
   EmptyResultCursor(const EmptyResult &self, utils::MemoryResource *mem)
-      : input_cursor_(self.input_->MakeCursor(mem)) {}
+      : self_(self), input_cursor_(self.input_->MakeCursor(mem)), unwind_(FindRowLocalUnwind(*self.input_)) {}
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
     SCOPED_PROFILE_OP("EmptyResult");
 
     if (!pulled_all_input_) {
-      while (input_cursor_->Pull(frame, context)) {
-        AbortCheck(context);
+      if (CanWriteInParallel(context)) {
+        WriteInParallel(frame, context);
+      } else {
+        PullAll(frame, context);
       }
       pulled_all_input_ = true;
     }
@@ -3912,9 +5554,122 @@ class EmptyResultCursor : public Cursor {
   }
 
  private:
-  const UniqueCursorPtr input_cursor_;
-  bool pulled_all_input_{false};
-};
+  struct WriteWorker {
+    std::unique_ptr<storage::Storage::Accessor> storage_accessor;
+    std::unique_ptr<DbAccessor> db_accessor;
+    ExecutionContext context;
+    Frame frame;
+    UniqueCursorPtr cursor;
+  };
+
+  /// Analytical mode has no deltas to isolate the transactions, so the parts
+  /// of the list can be written in transactions of their own. The collected
+  /// changes of triggers and the per-row bookkeeping of profiling and
+  /// fine-grained access control need the rows on the query thread.
+  bool CanWriteInParallel(const ExecutionContext &context) const {
+    if (!unwind_ || context.analytical_write_workers <= 1) return false;
+    if (context.db_accessor->GetStorageMode() != storage::StorageMode::IN_MEMORY_ANALYTICAL) return false;
+    if (context.is_profile_query || context.trigger_context_collector || context.frame_change_collector) return false;
+#ifdef MG_ENTERPRISE
+    if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker) return false;
+#endif
+    return !flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH);
+  }
+
+  void PullAll(Frame &frame, ExecutionContext &context) {
+    while (input_cursor_->Pull(frame, context)) {
+      AbortCheck(context);
+    }
+  }
+
+  /// Splits the unwound list into morsels which the workers claim until none
+  /// are left. A list too short to split is written on the query thread
+  /// without evaluating it again.
+  void WriteInParallel(Frame &frame, ExecutionContext &context) {
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                  storage::View::OLD);
+    auto list = unwind_->input_expression_->Accept(evaluator);
+    if (list.type() != TypedValue::Type::List) {
+      throw QueryRuntimeException("Argument of UNWIND must be a list, but '{}' was provided.", list.type());
+    }
+    auto &values = list.ValueList();
+    auto const num_morsels = std::min<uint64_t>(values.size(), context.analytical_write_workers * kMorselsPerWorker);
+    if (num_morsels <= 1) {
+      context.unwind_morsel = &values;
+      PullAll(frame, context);
+      return;
+    }
+
+    std::vector<TypedValue::TVector> morsels;
+    morsels.reserve(num_morsels);
+    for (uint64_t i = 0; i < num_morsels; ++i) {
+      auto begin = values.begin() + static_cast<int64_t>(i * values.size() / num_morsels);
+      auto end = values.begin() + static_cast<int64_t>((i + 1) * values.size() / num_morsels);
+      morsels.emplace_back(std::make_move_iterator(begin), std::make_move_iterator(end), utils::NewDeleteResource());
+    }
+
+    auto const num_workers = std::min<uint64_t>(context.analytical_write_workers, num_morsels);
+    std::vector<WriteWorker> workers;
+    workers.reserve(num_workers);
+    for (uint64_t i = 0; i < num_workers; ++i) {
+      auto &worker = workers.emplace_back(WriteWorker{
+          .storage_accessor = context.db_accessor->GetStorageAccessor()->AccessStorage(),
+          .context = MakeWorkerContext(context),
+          .frame = Frame(static_cast<int64_t>(frame.elems().size())),
+          .cursor = self_.input_->MakeCursor(utils::NewDeleteResource())});
+      worker.db_accessor = std::make_unique<DbAccessor>(worker.storage_accessor.get());
+      worker.context.db_accessor = worker.db_accessor.get();
+      worker.context.hops_limit = context.hops_limit.ForWorker();
+    }
+
+    std::atomic<size_t> next_morsel{0};
+    std::atomic<bool> stop{false};
+    utils::Synchronized<std::exception_ptr, utils::SpinLock> error;
+    {
+      std::vector<std::jthread> threads;
+      threads.reserve(workers.size());
+      for (auto &worker : workers) {
+        threads.emplace_back([&context, &morsels, &next_morsel, &stop, &error, &worker] {
+          // The memory of the workers counts towards the query
+          context.db_accessor->TrackCurrentThreadAllocations();
+          utils::OnScopeExit untrack{[&] { context.db_accessor->UntrackCurrentThreadAllocations(); }};
+          try {
+            for (auto idx = next_morsel.fetch_add(1, std::memory_order_acq_rel);
+                 idx < morsels.size() && !stop.load(std::memory_order_acquire) &&
+                 !worker.context.hops_limit.IsLimitReached();
+                 idx = next_morsel.fetch_add(1, std::memory_order_acq_rel)) {
+              worker.context.unwind_morsel = &morsels[idx];
+              worker.cursor->Reset();
+              while (!stop.load(std::memory_order_acquire) && worker.cursor->Pull(worker.frame, worker.context)) {
+                AbortCheck(worker.context);
+              }
+            }
+            worker.context.hops_limit.ReleaseReservation();
+          } catch (...) {
+            auto locked_error = error.Lock();
+            if (!*locked_error) *locked_error = std::current_exception();
+            stop.store(true, std::memory_order_release);
+          }
+        });
+      }
+    }
+    if (auto failure = std::exchange(*error.Lock(), nullptr)) std::rethrow_exception(failure);
+
+    for (auto &worker : workers) {
+      if (worker.db_accessor->Commit({}, context.db_acc).HasError()) {
+        throw QueryRuntimeException("Couldn't commit the rows written by a parallel UNWIND worker.");
+      }
+      for (size_t i = 0; i < context.execution_stats.counters.size(); ++i) {
+        context.execution_stats.counters[i] += worker.context.execution_stats.counters[i];
+      }
+    }
+  }
+
+  const EmptyResult &self_;
+  const UniqueCursorPtr input_cursor_;
+  const Unwind *unwind_;
+  bool pulled_all_input_{false};
+};
 
 UniqueCursorPtr EmptyResult::MakeCursor(utils::MemoryResource *mem) const {
   memgraph::metrics::IncrementCounter(memgraph::metrics::EmptyResultOperator);
@@ -3989,6 +5744,144 @@ UniqueCursorPtr Accumulate::MakeCursor(utils::MemoryResource *mem) const {
   return MakeUniqueCursorPtr<AccumulateCursor>(mem, *this, mem);
 }
 
+namespace {
+/// Threads which run copies of a Gather's input. Each worker claims morsels of
+/// the scan at the bottom of the input until none are left and hands every
+/// row it pulls to a callback. The first exception thrown on a worker stops
+/// all of them and is kept until the owner rethrows it.
+class MorselWorkers {
+ public:
+  struct Worker {
+    size_t index;
+    ExecutionContext context;
+    Frame frame;
+    UniqueCursorPtr cursor;
+  };
+
+  /// Called on the worker thread for every pulled row, returning false stops the worker.
+  using RowCallback = std::function<bool(Worker &)>;
+  /// Called on the worker thread once it ran out of morsels, was stopped or failed.
+  using DoneCallback = std::function<void(Worker &)>;
+
+  MorselWorkers() = default;
+  MorselWorkers(const MorselWorkers &) = delete;
+  MorselWorkers &operator=(const MorselWorkers &) = delete;
+  MorselWorkers(MorselWorkers &&) = delete;
+  MorselWorkers &operator=(MorselWorkers &&) = delete;
+  ~MorselWorkers() {
+    RequestStop();
+    Join();
+  }
+
+  /// Splits the scan and creates the per-worker state. Returns false when the
+  /// input can't run in parallel (e.g. profiling, fine-grained access control
+  /// or a storage which can't split the scan), in which case the caller has
+  /// to pull the input on its own thread. The workers take their hops from
+  /// the hops limit of @p context.
+  bool Prepare(const Gather &gather, const Frame &frame, ExecutionContext &context) {
+    if (gather.num_workers_ <= 1 || context.is_profile_query) return false;
+#ifdef MG_ENTERPRISE
+    if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker) return false;
+#endif
+    auto *db = context.db_accessor;
+    if (!db->GetTransactionId()) return false;
+
+    auto const num_morsels = gather.num_workers_ * kMorselsPerWorker;
+    morsels_ = gather.label_ ? db->ChunkedVertices(gather.view_, *gather.label_, num_morsels)
+                             : db->ChunkedVertices(gather.view_, num_morsels);
+    if (morsels_.size() <= 1) {
+      morsels_.clear();
+      return false;
+    }
+
+    auto const num_workers = std::min<uint64_t>(gather.num_workers_, morsels_.size());
+    workers_.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+      workers_.push_back(Worker{.index = i,
+                                .context = MakeWorkerContext(context),
+                                .frame = Frame(static_cast<int64_t>(frame.elems().size())),
+                                .cursor = gather.input_->MakeCursor(utils::NewDeleteResource())});
+      workers_.back().context.hops_limit = context.hops_limit.ForWorker();
+    }
+    db_ = db;
+    return true;
+  }
+
+  size_t NumWorkers() const { return workers_.size(); }
+  Worker &GetWorker(size_t index) { return workers_[index]; }
+
+  void Start(RowCallback on_row, DoneCallback on_done) {
+    on_row_ = std::move(on_row);
+    on_done_ = std::move(on_done);
+    next_morsel_.store(0, std::memory_order_release);
+    stop_.store(false, std::memory_order_release);
+    failed_.store(false, std::memory_order_release);
+    db_->SetParallelReadersActive(true);
+    threads_.reserve(workers_.size());
+    for (auto &worker : workers_) {
+      threads_.emplace_back([this, &worker] { Run(worker); });
+    }
+  }
+
+  bool Running() const { return !threads_.empty(); }
+  void RequestStop() { stop_.store(true, std::memory_order_release); }
+  bool StopRequested() const { return stop_.load(std::memory_order_acquire); }
+  bool Failed() const { return failed_.load(std::memory_order_acquire); }
+
+  /// Waits for all workers and releases the morsels and the per-worker state.
+  void Join() {
+    if (threads_.empty()) return;
+    // jthreads join on destruction.
+    threads_.clear();
+    db_->SetParallelReadersActive(false);
+    workers_.clear();
+    morsels_.clear();
+  }
+
+  void RethrowError() {
+    if (auto error = std::exchange(*error_.Lock(), nullptr)) std::rethrow_exception(error);
+  }
+
+ private:
+  void Run(Worker &worker) {
+    worker.context.db_accessor->TrackCurrentThreadAllocations();
+    utils::OnScopeExit untrack{[&worker] { worker.context.db_accessor->UntrackCurrentThreadAllocations(); }};
+
+    try {
+      for (auto idx = next_morsel_.fetch_add(1, std::memory_order_acq_rel);
+           idx < morsels_.size() && !StopRequested() && !worker.context.hops_limit.IsLimitReached();
+           idx = next_morsel_.fetch_add(1, std::memory_order_acq_rel)) {
+        worker.context.scan_morsel = &morsels_[idx];
+        worker.cursor->Reset();
+        while (!StopRequested() && worker.cursor->Pull(worker.frame, worker.context)) {
+          if (!on_row_(worker)) break;
+        }
+      }
+      worker.context.hops_limit.ReleaseReservation();
+    } catch (...) {
+      {
+        auto error = error_.Lock();
+        if (!*error) *error = std::current_exception();
+      }
+      failed_.store(true, std::memory_order_release);
+      RequestStop();
+    }
+    on_done_(worker);
+  }
+
+  DbAccessor *db_{nullptr};
+  std::vector<VerticesIterable> morsels_;
+  std::vector<Worker> workers_;
+  std::vector<std::jthread> threads_;
+  RowCallback on_row_;
+  DoneCallback on_done_;
+  std::atomic<size_t> next_morsel_{0};
+  std::atomic<bool> stop_{false};
+  std::atomic<bool> failed_{false};
+  utils::Synchronized<std::exception_ptr, utils::SpinLock> error_;
+};
+}  // namespace
+
 Aggregate::Aggregate(const std::shared_ptr<LogicalOperator> &input, const std::vector<Aggregate::Element> &aggregations,
                      const std::vector<Expression *> &group_by, const std::vector<Symbol> &remember)
     : input_(input ? input : std::make_shared<Once>()),
@@ -4034,7 +5927,11 @@ class AggregateCursor : public Cursor {
       : self_(self),
         input_cursor_(self_.input_->MakeCursor(mem)),
         aggregation_(mem),
-        reused_group_by_(self.group_by_.size(), mem) {}
+        reused_group_by_(self.group_by_.size(), mem) {
+    if (self_.input_->GetTypeInfo() == Gather::kType && CanAggregateInParallel()) {
+      parallel_input_ = static_cast<const Gather *>(self_.input_.get());
+    }
+  }
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
     OOMExceptionEnabler oom_exception;
@@ -4115,20 +6012,40 @@ class AggregateCursor : public Cursor {
     utils::pmr::vector<TSet> unique_values_;
   };
 
+  // map key is the vector of group-by values
+  // map value is an AggregationValue struct
+  using AggregationMap =
+      utils::pmr::unordered_map<utils::pmr::vector<TypedValue>, AggregationValue,
+                                // use FNV collection hashing specialized for a
+                                // vector of TypedValues
+                                utils::FnvCollection<utils::pmr::vector<TypedValue>, TypedValue, TypedValue::Hash>,
+                                // custom equality
+                                TypedValueVectorEqual>;
+
+  // Aggregation state of a single worker when the input runs in parallel.
+  struct PartialAggregation {
+    PartialAggregation(MorselWorkers::Worker *worker, size_t group_by_size)
+        : evaluator(&worker->frame, worker->context.symbol_table, worker->context.evaluation_context,
+                    worker->context.db_accessor, storage::View::NEW),
+          aggregation(utils::NewDeleteResource()),
+          group_by(group_by_size, utils::NewDeleteResource()) {}
+
+    ExpressionEvaluator evaluator;
+    AggregationMap aggregation;
+    utils::pmr::vector<TypedValue> group_by;
+  };
+
   const Aggregate &self_;
   const UniqueCursorPtr input_cursor_;
+  // Set when the input is a Gather whose pipeline can be aggregated on the
+  // worker threads directly, without sending every row to this thread.
+  const Gather *parallel_input_{nullptr};
   // storage for aggregated data
-  // map key is the vector of group-by values
-  // map value is an AggregationValue struct
-  utils::pmr::unordered_map<utils::pmr::vector<TypedValue>, AggregationValue,
-                            // use FNV collection hashing specialized for a
-                            // vector of TypedValues
-                            utils::FnvCollection<utils::pmr::vector<TypedValue>, TypedValue, TypedValue::Hash>,
-                            // custom equality
-                            TypedValueVectorEqual>
-      aggregation_;
+  AggregationMap aggregation_;
   // this is a for object reuse, to avoid re-allocating this buffer
   utils::pmr::vector<TypedValue> reused_group_by_;
+  // input rows when the input is pulled in batches, kept to reuse the frames
+  std::optional<FrameBatch> input_batch_;
   // iterator over the accumulated cache
   decltype(aggregation_.begin()) aggregation_it_ = aggregation_.begin();
   // this LogicalOp pulls all from the input on it's first pull
@@ -4145,13 +6062,12 @@ class AggregateCursor : public Cursor {
    * aggregation results, and not on the number of inputs.
    */
   bool ProcessAll(Frame *frame, ExecutionContext *context) {
-    ExpressionEvaluator evaluator(frame, context->symbol_table, context->evaluation_context, context->db_accessor,
-                                  storage::View::NEW);
-
+    MorselWorkers workers;
     bool pulled = false;
-    while (input_cursor_->Pull(*frame, *context)) {
-      ProcessOne(*frame, &evaluator);
-      pulled = true;
+    if (parallel_input_ && workers.Prepare(*parallel_input_, *frame, *context)) {
+      pulled = ProcessAllInParallel(&workers);
+    } else {
+      pulled = context->batch_size > 0 ? ProcessAllInBatches(frame, context) : ProcessAllRows(frame, context);
     }
     if (!pulled) return false;
 
@@ -4190,24 +6106,158 @@ class AggregateCursor : public Cursor {
     return true;
   }
 
+  bool ProcessAllRows(Frame *frame, ExecutionContext *context) {
+    bool pulled = false;
+    ExpressionEvaluator evaluator(frame, context->symbol_table, context->evaluation_context, context->db_accessor,
+                                  storage::View::NEW);
+    while (input_cursor_->Pull(*frame, *context)) {
+      ProcessOne(*frame, &evaluator, &aggregation_, &reused_group_by_);
+      pulled = true;
+    }
+    return pulled;
+  }
+
+  /// Aggregates the input pulled a batch at a time, without a virtual call
+  /// per input row.
+  bool ProcessAllInBatches(Frame *frame, ExecutionContext *context) {
+    bool pulled = false;
+    if (!input_batch_) input_batch_.emplace(frame->elems().size(), context->batch_size, frame->GetMemoryResource());
+    while (input_cursor_->PullBatch(*frame, *input_batch_, *context)) {
+      for (size_t row = 0; row < input_batch_->size(); ++row) {
+        auto &row_frame = (*input_batch_)[row];
+        ExpressionEvaluator evaluator(&row_frame, context->symbol_table, context->evaluation_context,
+                                      context->db_accessor, storage::View::NEW);
+        ProcessOne(row_frame, &evaluator, &aggregation_, &reused_group_by_);
+      }
+      pulled = true;
+    }
+    return pulled;
+  }
+
+  /**
+   * Two-phase aggregation of a Gather's input. Every worker aggregates the
+   * rows it pulls into its own partial table, and the tables are merged on
+   * this thread once all workers are done.
+   */
+  bool ProcessAllInParallel(MorselWorkers *workers) {
+    // A deque constructs the partials in place, so the evaluators never move.
+    std::deque<PartialAggregation> partials;
+    for (size_t i = 0; i < workers->NumWorkers(); ++i) {
+      partials.emplace_back(&workers->GetWorker(i), self_.group_by_.size());
+    }
+    std::atomic<bool> pulled{false};
+
+    workers->Start(
+        [this, &partials, &pulled](MorselWorkers::Worker &worker) {
+          auto &partial = partials[worker.index];
+          ProcessOne(worker.frame, &partial.evaluator, &partial.aggregation, &partial.group_by);
+          pulled.store(true, std::memory_order_relaxed);
+          return true;
+        },
+        [](MorselWorkers::Worker & /*worker*/) {});
+    workers->Join();
+    workers->RethrowError();
+
+    for (auto &partial : partials) {
+      MergePartial(&partial.aggregation);
+    }
+    return pulled.load(std::memory_order_relaxed);
+  }
+
   /**
    * Performs a single accumulation.
    */
-  void ProcessOne(const Frame &frame, ExpressionEvaluator *evaluator) {
+  void ProcessOne(const Frame &frame, ExpressionEvaluator *evaluator, AggregationMap *aggregation,
+                  utils::pmr::vector<TypedValue> *group_by) const {
     // Preallocated group_by, since most of the time the aggregation key won't be unique
-    reused_group_by_.clear();
+    group_by->clear();
     evaluator->ResetPropertyLookupCache();
 
     for (Expression *expression : self_.group_by_) {
-      reused_group_by_.emplace_back(expression->Accept(*evaluator));
+      group_by->emplace_back(expression->Accept(*evaluator));
     }
-    auto *mem = aggregation_.get_allocator().GetMemoryResource();
-    auto res = aggregation_.try_emplace(reused_group_by_, mem);
+    auto *mem = aggregation->get_allocator().GetMemoryResource();
+    auto res = aggregation->try_emplace(*group_by, mem);
     auto &agg_value = res.first->second;
     if (res.second /*was newly inserted*/) EnsureInitialized(frame, &agg_value);
     Update(evaluator, &agg_value);
   }
 
+  /** Whether each aggregation can be computed from partial results of
+   * disjoint inputs. DISTINCT aggregations would need the unique values of
+   * all partials and PROJECT graphs can't be merged cheaply. */
+  bool CanAggregateInParallel() const {
+    return std::ranges::none_of(self_.aggregations_, [](const auto &elem) {
+      return elem.distinct || elem.op == Aggregation::Op::PROJECT;
+    });
+  }
+
+  /** Merges a partial aggregation table into `aggregation_`. The partial
+   * values must not be post processed yet. */
+  void MergePartial(AggregationMap *partial) {
+    auto *mem = aggregation_.get_allocator().GetMemoryResource();
+    for (auto &[group_by, partial_value] : *partial) {
+      auto res = aggregation_.try_emplace(group_by, mem);
+      auto &agg_value = res.first->second;
+      if (res.second /*was newly inserted*/) {
+        agg_value.counts_.assign(partial_value.counts_.begin(), partial_value.counts_.end());
+        agg_value.values_.assign(partial_value.values_.begin(), partial_value.values_.end());
+        agg_value.remember_.assign(partial_value.remember_.begin(), partial_value.remember_.end());
+        continue;
+      }
+      for (size_t pos = 0; pos < self_.aggregations_.size(); ++pos) {
+        MergeValue(self_.aggregations_[pos], partial_value.counts_[pos], &partial_value.values_[pos],
+                   &agg_value.counts_[pos], &agg_value.values_[pos]);
+      }
+    }
+  }
+
+  static void MergeValue(const Aggregate::Element &agg_elem, int64_t partial_count, TypedValue *partial_value,
+                         int64_t *count, TypedValue *value) {
+    if (partial_count == 0) return;
+    const bool first = *count == 0;
+    *count += partial_count;
+    if (first) {
+      *value = std::move(*partial_value);
+      return;
+    }
+    switch (agg_elem.op) {
+      case Aggregation::Op::COUNT:
+        // value is deferred to post-processing
+        break;
+      case Aggregation::Op::MIN:
+        try {
+          if ((*partial_value < *value).ValueBool()) *value = std::move(*partial_value);
+        } catch (const TypedValueException &) {
+          throw QueryRuntimeException("Unable to get MIN of '{}' and '{}'.", partial_value->type(), value->type());
+        }
+        break;
+      case Aggregation::Op::MAX:
+        try {
+          if ((*partial_value > *value).ValueBool()) *value = std::move(*partial_value);
+        } catch (const TypedValueException &) {
+          throw QueryRuntimeException("Unable to get MAX of '{}' and '{}'.", partial_value->type(), value->type());
+        }
+        break;
+      case Aggregation::Op::AVG:
+      case Aggregation::Op::SUM:
+        *value = *value + *partial_value;
+        break;
+      case Aggregation::Op::COLLECT_LIST: {
+        auto &list = value->ValueList();
+        for (auto &elem : partial_value->ValueList()) list.push_back(std::move(elem));
+        break;
+      }
+      case Aggregation::Op::COLLECT_MAP: {
+        auto &map = value->ValueMap();
+        for (auto &[key, elem] : partial_value->ValueMap()) map.emplace(key, std::move(elem));
+        break;
+      }
+      case Aggregation::Op::PROJECT:
+        LOG_FATAL("PROJECT aggregation can't be merged.");
+    }
+  }
+
   /** Ensures the new AggregationValue has been initialized. This means
    * that the value vectors are filled with an appropriate number of Nulls,
    * counts are set to 0 and remember values are remembered.
@@ -4234,7 +6284,7 @@ class AggregateCursor : public Cursor {
 
   /** Updates the given AggregationValue with new data. Assumes that
    * the AggregationValue has been initialized */
-  void Update(ExpressionEvaluator *evaluator, AggregateCursor::AggregationValue *agg_value) {
+  void Update(ExpressionEvaluator *evaluator, AggregateCursor::AggregationValue *agg_value) const {
     DMG_ASSERT(self_.aggregations_.size() == agg_value->values_.size(),
                "Expected as much AggregationValue.values_ as there are "
                "aggregations.");
@@ -4405,6 +6455,97 @@ UniqueCursorPtr Aggregate::MakeCursor(utils::MemoryResource *mem) const {
   return MakeUniqueCursorPtr<AggregateCursor>(mem, *this, mem);
 }
 
+CountVertices::CountVertices(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol)
+    : input_(input), output_symbol_(std::move(output_symbol)) {}
+
+ACCEPT_WITH_INPUT(CountVertices)
+
+std::vector<Symbol> CountVertices::ModifiedSymbols(const SymbolTable &) const { return {output_symbol_}; }
+
+namespace {
+
+class CountVerticesCursor : public Cursor {
+ public:
+  CountVerticesCursor(const CountVertices &self, utils::MemoryResource *mem)
+      : self_(self),
+        scan_(static_cast<const ScanAll &>(*self.input_)),
+        input_cursor_(self.input_->MakeCursor(mem)),
+        scan_input_cursor_(scan_.input_->MakeCursor(mem)) {}
+
+  bool Pull(Frame &frame, ExecutionContext &context) override {
+    OOMExceptionEnabler oom_exception;
+    SCOPED_PROFILE_OP_BY_REF(self_);
+
+    if (pulled_) return false;
+    pulled_ = true;
+    AbortCheck(context);
+
+    int64_t count = 0;
+#ifdef MG_ENTERPRISE
+    if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker) {
+      // The scan skips the vertices the user may not read.
+      while (input_cursor_->Pull(frame, context)) ++count;
+      frame[self_.output_symbol_] = TypedValue(count, context.evaluation_context.memory);
+      return true;
+    }
+#endif
+    // The input of the scan is Once, so it's pulled a single time.
+    if (scan_input_cursor_->Pull(frame, context)) {
+      count = Count(frame, context);
+      context.scanned_vertices += static_cast<uint64_t>(count);
+    }
+    frame[self_.output_symbol_] = TypedValue(count, context.evaluation_context.memory);
+    return true;
+  }
+
+  void Shutdown() override {
+    input_cursor_->Shutdown();
+    scan_input_cursor_->Shutdown();
+  }
+
+  void Reset() override {
+    input_cursor_->Reset();
+    scan_input_cursor_->Reset();
+    pulled_ = false;
+  }
+
+ private:
+  int64_t Count(Frame &frame, ExecutionContext &context) const {
+    auto *db = context.db_accessor;
+    const auto &type = scan_.GetTypeInfo();
+    if (type == ScanAllByLabel::kType) {
+      return db->CountVertices(scan_.view_, static_cast<const ScanAllByLabel &>(scan_).label_);
+    }
+    if (type == ScanAllByLabelProperty::kType) {
+      const auto &by_property = static_cast<const ScanAllByLabelProperty &>(scan_);
+      return db->CountVertices(scan_.view_, by_property.label_, by_property.property_);
+    }
+    DMG_ASSERT(type == ScanAllByLabelPropertyRange::kType, "Unexpected scan below CountVertices");
+    const auto &by_range = static_cast<const ScanAllByLabelPropertyRange &>(scan_);
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, db, scan_.view_);
+    auto maybe_lower = TryConvertToBound(by_range.lower_bound_, evaluator);
+    auto maybe_upper = TryConvertToBound(by_range.upper_bound_, evaluator);
+    // A null bound doesn't satisfy the filter, as in the scan.
+    if (maybe_lower && maybe_lower->value().IsNull()) return 0;
+    if (maybe_upper && maybe_upper->value().IsNull()) return 0;
+    return db->CountVertices(scan_.view_, by_range.label_, by_range.property_, maybe_lower, maybe_upper);
+  }
+
+  const CountVertices &self_;
+  const ScanAll &scan_;
+  const UniqueCursorPtr input_cursor_;
+  const UniqueCursorPtr scan_input_cursor_;
+  bool pulled_{false};
+};
+
+}  // namespace
+
+UniqueCursorPtr CountVertices::MakeCursor(utils::MemoryResource *mem) const {
+  memgraph::metrics::IncrementCounter(memgraph::metrics::CountVerticesOperator);
+
+  return MakeUniqueCursorPtr<CountVerticesCursor>(mem, *this, mem);
+}
+
 Skip::Skip(const std::shared_ptr<LogicalOperator> &input, Expression *expression)
     : input_(input), expression_(expression) {}
 
@@ -4488,18 +6629,7 @@ bool Limit::LimitCursor::Pull(Frame &frame, ExecutionContext &context) {
   // because it might be 0 and thereby we shouldn't Pull from input at all.
   // We can do this before Pulling from the input because the limit expression
   // is not allowed to contain any identifiers.
-  if (limit_ == -1) {
-    // Limit expression doesn't contain identifiers so graph view is not
-    // important.
-    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
-                                  storage::View::OLD);
-    TypedValue limit = self_.expression_->Accept(evaluator);
-    if (limit.type() != TypedValue::Type::Int)
-      throw QueryRuntimeException("Limit on number of returned elements must be an integer.");
-
-    limit_ = limit.ValueInt();
-    if (limit_ < 0) throw QueryRuntimeException("Limit on number of returned elements must be non-negative.");
-  }
+  if (limit_ == -1) EvaluateLimit(frame, context);
 
   // check we have not exceeded the limit before pulling
   if (pulled_++ >= limit_) return false;
@@ -4507,6 +6637,39 @@ bool Limit::LimitCursor::Pull(Frame &frame, ExecutionContext &context) {
   return input_cursor_->Pull(frame, context);
 }
 
+bool Limit::LimitCursor::PullBatch(Frame &frame, FrameBatch &batch, ExecutionContext &context) {
+  OOMExceptionEnabler oom_exception;
+  SCOPED_PROFILE_OP("Limit");
+
+  if (limit_ == -1) EvaluateLimit(frame, context);
+  if (pulled_ >= limit_) {
+    batch.Clear();
+    return false;
+  }
+
+  // Ask the input only for the remaining rows, so it doesn't produce rows which would be thrown away
+  const auto capacity = batch.capacity();
+  const auto remaining = static_cast<uint64_t>(limit_ - pulled_);
+  if (remaining < capacity) batch.SetCapacity(remaining);
+  const bool pulled = input_cursor_->PullBatch(frame, batch, context);
+  batch.SetCapacity(capacity);
+  pulled_ += static_cast<int64_t>(batch.size());
+  return pulled;
+}
+
+void Limit::LimitCursor::EvaluateLimit(Frame &frame, ExecutionContext &context) {
+  // Limit expression doesn't contain identifiers so graph view is not
+  // important.
+  ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                storage::View::OLD);
+  TypedValue limit = self_.expression_->Accept(evaluator);
+  if (limit.type() != TypedValue::Type::Int)
+    throw QueryRuntimeException("Limit on number of returned elements must be an integer.");
+
+  limit_ = limit.ValueInt();
+  if (limit_ < 0) throw QueryRuntimeException("Limit on number of returned elements must be non-negative.");
+}
+
 void Limit::LimitCursor::Shutdown() { input_cursor_->Shutdown(); }
 
 void Limit::LimitCursor::Reset() {
@@ -4538,72 +6701,107 @@ std::vector<Symbol> OrderBy::OutputSymbols(const SymbolTable &symbol_table) cons
 
 std::vector<Symbol> OrderBy::ModifiedSymbols(const SymbolTable &table) const { return input_->ModifiedSymbols(table); }
 
+namespace {
+/// The first `k` rows of an ordering among the rows added so far. The rows
+/// are kept in a max-heap by their order-by values, so the row which is
+/// dropped when a smaller one comes is on the top.
+class TopKRows {
+ public:
+  TopKRows(const TypedValueVectorCompare &compare, size_t k, utils::MemoryResource *order_by_mem,
+           utils::MemoryResource *output_mem)
+      : compare_(&compare), k_(k), order_by_(order_by_mem), output_(output_mem), heap_(order_by_mem) {}
+
+  /// Returns true if a row with @p order_by values would be kept.
+  bool Accepts(const utils::pmr::vector<TypedValue> &order_by) const {
+    if (heap_.size() < k_) return true;
+    return k_ > 0 && compare_->lex_cmp()(order_by, order_by_[heap_.front()]);
+  }
+
+  /// Adds a row which Accepts, dropping the largest one if there are already
+  /// `k` rows. The values are moved out of the given vectors.
+  void Add(utils::pmr::vector<TypedValue> *order_by, utils::pmr::vector<TypedValue> *output) {
+    auto const cmp = HeapCompare();
+    size_t slot = 0;
+    if (heap_.size() < k_) {
+      slot = order_by_.size();
+      order_by_.emplace_back();
+      output_.emplace_back();
+      heap_.push_back(slot);
+    } else {
+      std::ranges::pop_heap(heap_, cmp);
+      slot = heap_.back();
+    }
+    order_by_[slot].assign(std::make_move_iterator(order_by->begin()), std::make_move_iterator(order_by->end()));
+    output_[slot].assign(std::make_move_iterator(output->begin()), std::make_move_iterator(output->end()));
+    std::ranges::push_heap(heap_, cmp);
+  }
+
+  /// Moves the rows of @p other in.
+  void Merge(TopKRows *other) {
+    for (auto slot : other->heap_) {
+      if (Accepts(other->order_by_[slot])) Add(&other->order_by_[slot], &other->output_[slot]);
+    }
+  }
+
+  /// Moves the kept output rows to @p sorted, in the order.
+  void MoveSorted(utils::pmr::vector<utils::pmr::vector<TypedValue>> *sorted) {
+    std::ranges::sort_heap(heap_, HeapCompare());
+    sorted->clear();
+    sorted->reserve(heap_.size());
+    for (auto slot : heap_) sorted->emplace_back(std::move(output_[slot]));
+    heap_.clear();
+    order_by_.clear();
+    output_.clear();
+  }
+
+ private:
+  auto HeapCompare() const {
+    return [this](size_t lhs, size_t rhs) { return compare_->lex_cmp()(order_by_[lhs], order_by_[rhs]); };
+  }
+
+  const TypedValueVectorCompare *compare_;
+  size_t k_;
+  utils::pmr::vector<utils::pmr::vector<TypedValue>> order_by_;
+  utils::pmr::vector<utils::pmr::vector<TypedValue>> output_;
+  // Indices of the rows in `order_by_` and `output_`.
+  utils::pmr::vector<size_t> heap_;
+};
+}  // namespace
+
 class OrderByCursor : public Cursor {
  public:
   OrderByCursor(const OrderBy &self, utils::MemoryResource *mem)
-      : self_(self), input_cursor_(self_.input_->MakeCursor(mem)), cache_(mem) {}
+      : self_(self), input_cursor_(self_.input_->MakeCursor(mem)), cache_(mem) {
+    if (self_.limit_ && self_.input_->GetTypeInfo() == Produce::kType) {
+      const auto &produce = static_cast<const Produce &>(*self_.input_);
+      if (produce.input_->GetTypeInfo() == Gather::kType) {
+        parallel_produce_ = &produce;
+        parallel_input_ = static_cast<const Gather *>(produce.input_.get());
+      }
+    }
+  }
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
     OOMExceptionEnabler oom_exception;
     SCOPED_PROFILE_OP_BY_REF(self_);
 
     if (!did_pull_all_) [[unlikely]] {
-      ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
-                                    storage::View::OLD);
-      auto *pull_mem = context.evaluation_context.memory;
-      auto *query_mem = cache_.get_allocator().GetMemoryResource();
-
-      utils::pmr::vector<utils::pmr::vector<TypedValue>> order_by(pull_mem);  // Not cached, pull memory
-      utils::pmr::vector<utils::pmr::vector<TypedValue>> output(query_mem);   // Cached, query memory
-
-      while (input_cursor_->Pull(frame, context)) {
-        // collect the order_by elements
-        utils::pmr::vector<TypedValue> order_by_elem(pull_mem);
-        order_by_elem.reserve(self_.order_by_.size());
-        for (auto const &expression_ptr : self_.order_by_) {
-          order_by_elem.emplace_back(expression_ptr->Accept(evaluator));
-        }
-        order_by.emplace_back(std::move(order_by_elem));
-
-        // collect the output elements
-        utils::pmr::vector<TypedValue> output_elem(query_mem);
-        output_elem.reserve(self_.output_symbols_.size());
-        for (const Symbol &output_sym : self_.output_symbols_) {
-          output_elem.emplace_back(frame[output_sym]);
-        }
-        output.emplace_back(std::move(output_elem));
+      if (auto const k = EvaluateTopK(frame, context)) {
+        PullTopK(*k, frame, context);
+      } else {
+        PullAllSorted(frame, context);
       }
-
-      // sorting with range zip
-      // we compare on just the projection of the 1st range (order_by)
-      // this will also permute the 2nd range (output)
-      ranges::sort(
-          ranges::views::zip(order_by, output), self_.compare_.lex_cmp(),
-          [](auto const &value) -> auto const & { return std::get<0>(value); });
-
-      // no longer need the order_by terms
-      order_by.clear();
-      cache_ = std::move(output);
-
       did_pull_all_ = true;
       cache_it_ = cache_.begin();
     }
 
+    if (!runs_.empty()) return PullMerged(frame, context);
+
     if (cache_it_ == cache_.end()) return false;
 
     AbortCheck(context);
 
-    // place the output values on the frame
-    DMG_ASSERT(self_.output_symbols_.size() == cache_it_->size(),
-               "Number of values does not match the number of output symbols "
-               "in OrderBy");
-    auto output_sym_it = self_.output_symbols_.begin();
-    for (TypedValue &output : *cache_it_) {
-      if (context.frame_change_collector) {
-        context.frame_change_collector->ResetTrackingValue(output_sym_it->name());
-      }
-      frame[*output_sym_it++] = std::move(output);
-    }
+    PlaceOnFrame(&*cache_it_, frame, context);
     cache_it_++;
     return true;
   }
@@ -4614,17 +6812,320 @@ class OrderByCursor : public Cursor {
     did_pull_all_ = false;
     cache_.clear();
     cache_it_ = cache_.begin();
+    runs_.clear();
+    merge_heap_.clear();
   }
 
  private:
+  // Spilled runs merged into one at a time, which bounds the number of open
+  // files to this many per level of merging.
+  static constexpr size_t kSpillMergeFanIn = 16;
+
+  // A sorted part of the input. All runs except the last one are spilled to
+  // files, the last one is kept in memory.
+  struct SortedRun {
+    explicit SortedRun(utils::MemoryResource *mem) : order_by(mem), output(mem), head_order_by(mem), head_output(mem) {}
+
+    std::unique_ptr<SpillFile> file;
+    // how many times the rows of the run were merged
+    size_t level{0};
+    utils::pmr::vector<utils::pmr::vector<TypedValue>> order_by;
+    utils::pmr::vector<utils::pmr::vector<TypedValue>> output;
+    size_t next{0};
+    // the row of the run which is returned next
+    utils::pmr::vector<TypedValue> head_order_by;
+    utils::pmr::vector<TypedValue> head_output;
+  };
+
+  void PlaceOnFrame(utils::pmr::vector<TypedValue> *row, Frame &frame, ExecutionContext &context) const {
+    DMG_ASSERT(self_.output_symbols_.size() == row->size(),
+               "Number of values does not match the number of output symbols "
+               "in OrderBy");
+    auto output_sym_it = self_.output_symbols_.begin();
+    for (TypedValue &output : *row) {
+      if (context.frame_change_collector) {
+        context.frame_change_collector->ResetTrackingValue(output_sym_it->name());
+      }
+      frame[*output_sym_it++] = std::move(output);
+    }
+  }
+
+  /// Sorts all input rows. With `spill_rows` set, every time that many rows
+  /// are collected they are sorted and written to a spill file, and the runs
+  /// are merged by `PullMerged`. Rows which can't be spilled make the cursor
+  /// keep all following rows in memory.
+  void PullAllSorted(Frame &frame, ExecutionContext &context) {
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                  storage::View::OLD);
+    auto *pull_mem = context.evaluation_context.memory;
+    auto *query_mem = cache_.get_allocator().GetMemoryResource();
+
+    utils::pmr::vector<utils::pmr::vector<TypedValue>> order_by(pull_mem);  // Not cached, pull memory
+    utils::pmr::vector<utils::pmr::vector<TypedValue>> output(query_mem);   // Cached, query memory
+    bool can_spill = context.spill_rows > 0;
+
+    while (input_cursor_->Pull(frame, context)) {
+      // collect the order_by elements
+      order_by.emplace_back(EvaluateOrderBy(&evaluator, pull_mem));
+
+      // collect the output elements
+      utils::pmr::vector<TypedValue> output_elem(query_mem);
+      output_elem.reserve(self_.output_symbols_.size());
+      for (const Symbol &output_sym : self_.output_symbols_) {
+        output_elem.emplace_back(frame[output_sym]);
+      }
+      output.emplace_back(std::move(output_elem));
+
+      if (!can_spill) continue;
+      can_spill = std::ranges::all_of(order_by.back(), SpillFile::CanSpill) &&
+                  std::ranges::all_of(output.back(), SpillFile::CanSpill);
+      if (can_spill && output.size() >= context.spill_rows) {
+        SortRows(&order_by, &output);
+        SpillRun(&order_by, &output, context);
+      }
+    }
+
+    SortRows(&order_by, &output);
+    if (runs_.empty()) {
+      // no longer need the order_by terms
+      order_by.clear();
+      cache_ = std::move(output);
+      return;
+    }
+
+    auto &last_run = runs_.emplace_back(query_mem);
+    last_run.order_by.assign(std::make_move_iterator(order_by.begin()), std::make_move_iterator(order_by.end()));
+    last_run.output = std::move(output);
+    order_by.clear();
+    merge_heap_.reserve(runs_.size());
+    for (size_t i = 0; i < runs_.size(); ++i) {
+      if (!AdvanceRun(&runs_[i], context.db_accessor)) continue;
+      merge_heap_.push_back(i);
+      std::ranges::push_heap(merge_heap_, MergeCompare());
+    }
+  }
+
+  void SortRows(utils::pmr::vector<utils::pmr::vector<TypedValue>> *order_by,
+                utils::pmr::vector<utils::pmr::vector<TypedValue>> *output) const {
+    // sorting with range zip
+    // we compare on just the projection of the 1st range (order_by)
+    // this will also permute the 2nd range (output)
+    ranges::sort(
+        ranges::views::zip(*order_by, *output), self_.compare_.lex_cmp(),
+        [](auto const &value) -> auto const & { return std::get<0>(value); });
+  }
+
+  void SpillRun(utils::pmr::vector<utils::pmr::vector<TypedValue>> *order_by,
+                utils::pmr::vector<utils::pmr::vector<TypedValue>> *output, const ExecutionContext &context) {
+    auto &run = runs_.emplace_back(cache_.get_allocator().GetMemoryResource());
+    run.file = std::make_unique<SpillFile>(context.spill_directory);
+    for (size_t i = 0; i < output->size(); ++i) {
+      run.file->Write((*order_by)[i]);
+      run.file->Write((*output)[i]);
+    }
+    run.file->FinishWriting();
+    order_by->clear();
+    output->clear();
+    MergeSpilledRuns(context);
+  }
+
+  /// Merges the last `kSpillMergeFanIn` spilled runs into one spilled run of
+  /// the next level as long as they are on the same level. The levels of the
+  /// runs never increase towards the end, so every row is merged
+  /// logarithmically many times.
+  void MergeSpilledRuns(const ExecutionContext &context) {
+    while (runs_.size() >= kSpillMergeFanIn) {
+      const auto first = runs_.size() - kSpillMergeFanIn;
+      const auto level = runs_.back().level;
+      if (runs_[first].level != level) return;
+
+      auto merged = std::make_unique<SpillFile>(context.spill_directory);
+      std::vector<size_t> heap;
+      heap.reserve(kSpillMergeFanIn);
+      for (auto i = first; i < runs_.size(); ++i) {
+        if (!AdvanceRun(&runs_[i], context.db_accessor)) continue;
+        heap.push_back(i);
+        std::ranges::push_heap(heap, MergeCompare());
+      }
+      while (!heap.empty()) {
+        std::ranges::pop_heap(heap, MergeCompare());
+        auto &run = runs_[heap.back()];
+        merged->Write(run.head_order_by);
+        merged->Write(run.head_output);
+        if (AdvanceRun(&run, context.db_accessor)) {
+          std::ranges::push_heap(heap, MergeCompare());
+        } else {
+          heap.pop_back();
+        }
+      }
+      merged->FinishWriting();
+
+      // The merged files are removed with their runs
+      runs_.erase(runs_.begin() + static_cast<std::ptrdiff_t>(first), runs_.end());
+      auto &run = runs_.emplace_back(cache_.get_allocator().GetMemoryResource());
+      run.file = std::move(merged);
+      run.level = level + 1;
+    }
+  }
+
+  /// Loads the next row of @p run, returns false if it has no more rows.
+  static bool AdvanceRun(SortedRun *run, DbAccessor *db) {
+    if (run->file) return run->file->Read(db, &run->head_order_by) && run->file->Read(db, &run->head_output);
+    if (run->next == run->output.size()) return false;
+    run->head_order_by = std::move(run->order_by[run->next]);
+    run->head_output = std::move(run->output[run->next]);
+    ++run->next;
+    return true;
+  }
+
+  /// Returns the smallest row among the heads of the sorted runs.
+  bool PullMerged(Frame &frame, ExecutionContext &context) {
+    if (merge_heap_.empty()) return false;
+
+    AbortCheck(context);
+
+    auto const cmp = MergeCompare();
+    std::ranges::pop_heap(merge_heap_, cmp);
+    auto &run = runs_[merge_heap_.back()];
+    PlaceOnFrame(&run.head_output, frame, context);
+    if (AdvanceRun(&run, context.db_accessor)) {
+      std::ranges::push_heap(merge_heap_, cmp);
+    } else {
+      merge_heap_.pop_back();
+    }
+    return true;
+  }
+
+  // Orders the heap of the runs so the run with the smallest head is on top.
+  auto MergeCompare() const {
+    return [this](size_t lhs, size_t rhs) {
+      return self_.compare_.lex_cmp()(runs_[rhs].head_order_by, runs_[lhs].head_order_by);
+    };
+  }
+
+  /// Keeps only the first @p k rows of the ordering. The order-by values of
+  /// a row are evaluated first, and its output values are copied only if the
+  /// row is among the first `k` rows so far.
+  void PullTopK(size_t k, Frame &frame, ExecutionContext &context) {
+    auto *pull_mem = context.evaluation_context.memory;
+    TopKRows top_k(self_.compare_, k, pull_mem, cache_.get_allocator().GetMemoryResource());
+    // Nothing would be returned, and like Limit we don't pull the input at all.
+    if (k > 0) {
+      MorselWorkers workers;
+      if (parallel_input_ && workers.Prepare(*parallel_input_, frame, context)) {
+        PullTopKInParallel(&workers, k, &top_k);
+      } else {
+        ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                      storage::View::OLD);
+        while (input_cursor_->Pull(frame, context)) {
+          AddRow(frame, &evaluator, pull_mem, &top_k);
+        }
+      }
+    }
+    top_k.MoveSorted(&cache_);
+  }
+
+  /**
+   * Two-phase top-k of a Produce over a Gather. Every worker evaluates the
+   * Produce for the rows it pulls and keeps its own first `k` rows, which are
+   * merged on this thread once all workers are done.
+   */
+  void PullTopKInParallel(MorselWorkers *workers, size_t k, TopKRows *top_k) {
+    struct PartialTopK {
+      PartialTopK(MorselWorkers::Worker *worker, const TypedValueVectorCompare &compare, size_t k)
+          : produce_evaluator(&worker->frame, worker->context.symbol_table, worker->context.evaluation_context,
+                              worker->context.db_accessor, storage::View::NEW),
+            evaluator(&worker->frame, worker->context.symbol_table, worker->context.evaluation_context,
+                      worker->context.db_accessor, storage::View::OLD),
+            rows(compare, k, utils::NewDeleteResource(), utils::NewDeleteResource()) {}
+
+      ExpressionEvaluator produce_evaluator;
+      ExpressionEvaluator evaluator;
+      TopKRows rows;
+    };
+    // A deque constructs the partials in place, so the evaluators never move.
+    std::deque<PartialTopK> partials;
+    for (size_t i = 0; i < workers->NumWorkers(); ++i) {
+      partials.emplace_back(&workers->GetWorker(i), self_.compare_, k);
+    }
+
+    workers->Start(
+        [this, &partials](MorselWorkers::Worker &worker) {
+          auto &partial = partials[worker.index];
+          // Produce always yields the latest results.
+          partial.produce_evaluator.ResetPropertyLookupCache();
+          for (auto *named_expr : parallel_produce_->named_expressions_) {
+            EvaluateNamedExpression(partial.produce_evaluator, named_expr, worker.frame, worker.context,
+                                    storage::View::NEW);
+          }
+          partial.evaluator.ResetPropertyLookupCache();
+          AddRow(worker.frame, &partial.evaluator, utils::NewDeleteResource(), &partial.rows);
+          return true;
+        },
+        [](MorselWorkers::Worker & /*worker*/) {});
+    workers->Join();
+    workers->RethrowError();
+
+    for (auto &partial : partials) {
+      top_k->Merge(&partial.rows);
+    }
+  }
+
+  void AddRow(const Frame &frame, ExpressionEvaluator *evaluator, utils::MemoryResource *mem, TopKRows *top_k) const {
+    auto order_by = EvaluateOrderBy(evaluator, mem);
+    if (!top_k->Accepts(order_by)) return;
+    utils::pmr::vector<TypedValue> output(mem);
+    output.reserve(self_.output_symbols_.size());
+    for (const Symbol &output_sym : self_.output_symbols_) {
+      output.emplace_back(frame[output_sym]);
+    }
+    top_k->Add(&order_by, &output);
+  }
+
+  utils::pmr::vector<TypedValue> EvaluateOrderBy(ExpressionEvaluator *evaluator, utils::MemoryResource *mem) const {
+    utils::pmr::vector<TypedValue> order_by_elem(mem);
+    order_by_elem.reserve(self_.order_by_.size());
+    for (auto const &expression_ptr : self_.order_by_) {
+      order_by_elem.emplace_back(expression_ptr->Accept(*evaluator));
+    }
+    return order_by_elem;
+  }
+
+  /// Returns `skip + limit` if the operator is followed by a Limit. Invalid
+  /// values are left to Skip and Limit to report, all rows are sorted then.
+  std::optional<size_t> EvaluateTopK(Frame &frame, ExecutionContext &context) const {
+    if (!self_.limit_) return std::nullopt;
+    // The expressions don't contain identifiers, so the view doesn't matter.
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                  storage::View::OLD);
+    auto const limit = self_.limit_->Accept(evaluator);
+    if (limit.type() != TypedValue::Type::Int || limit.ValueInt() < 0) return std::nullopt;
+    int64_t skip = 0;
+    if (self_.skip_) {
+      auto const value = self_.skip_->Accept(evaluator);
+      if (value.type() != TypedValue::Type::Int || value.ValueInt() < 0) return std::nullopt;
+      skip = value.ValueInt();
+    }
+    if (skip > std::numeric_limits<int64_t>::max() - limit.ValueInt()) return std::nullopt;
+    return static_cast<size_t>(skip + limit.ValueInt());
+  }
+
   const OrderBy &self_;
   const UniqueCursorPtr input_cursor_;
+  // Set when the top-k rows of a Produce over a Gather can be collected on
+  // the worker threads, without sending every row to this thread.
+  const Produce *parallel_produce_{nullptr};
+  const Gather *parallel_input_{nullptr};
   bool did_pull_all_{false};
   // a cache of elements pulled from the input
   // the cache is filled and sorted on first Pull
   utils::pmr::vector<utils::pmr::vector<TypedValue>> cache_;
   // iterator over the cache_, maintains state between Pulls
   decltype(cache_.begin()) cache_it_ = cache_.begin();
+  // sorted runs of the input if it was spilled, merged while pulling
+  std::vector<SortedRun> runs_;
+  // indices of the runs which have rows left
+  std::vector<size_t> merge_heap_;
 };
 
 UniqueCursorPtr OrderBy::MakeCursor(utils::MemoryResource *mem) const {
@@ -4650,19 +7151,162 @@ UniqueCursorPtr Merge::MakeCursor(utils::MemoryResource *mem) const {
   return MakeUniqueCursorPtr<MergeCursor>(mem, *this, mem);
 }
 
-std::vector<Symbol> Merge::ModifiedSymbols(const SymbolTable &table) const {
-  auto symbols = input_->ModifiedSymbols(table);
-  // Match and create branches should have the same symbols, so just take one
-  // of them.
-  auto my_symbols = merge_match_->OutputSymbols(table);
-  symbols.insert(symbols.end(), my_symbols.begin(), my_symbols.end());
-  return symbols;
-}
+std::vector<Symbol> Merge::ModifiedSymbols(const SymbolTable &table) const {
+  auto symbols = input_->ModifiedSymbols(table);
+  // Match and create branches should have the same symbols, so just take one
+  // of them.
+  auto my_symbols = merge_match_->OutputSymbols(table);
+  symbols.insert(symbols.end(), my_symbols.begin(), my_symbols.end());
+  return symbols;
+}
+
+/// Answers the match branch of a MERGE of a single labeled node whose
+/// properties are only compared for equality, e.g. `MERGE (n:Label {id:
+/// row.id})`, from a hash table of the labeled vertices instead of scanning
+/// them for every input row. The table is built by the first lookup and
+/// extended with the vertices the MERGE creates. Any other change the query
+/// makes to the graph, as counted by its execution stats, rebuilds the table
+/// on the next lookup, so a lookup never costs more than the scan.
+class Merge::MergeCursor::HashLookup {
+ public:
+  /// Returns null if @p merge_match isn't `Filter -> ScanAllByLabel -> Once`
+  /// with property equalities of the scanned vertex only, or if @p
+  /// merge_create does more than `CreateNode -> Once` of that vertex, e.g.
+  /// sets properties ON CREATE.
+  static std::unique_ptr<HashLookup> Make(const LogicalOperator &merge_match, const LogicalOperator &merge_create,
+                                          utils::MemoryResource *mem) {
+    if (merge_match.GetTypeInfo() != Filter::kType || merge_create.GetTypeInfo() != CreateNode::kType) return nullptr;
+    const auto &filter = static_cast<const Filter &>(merge_match);
+    if (!filter.pattern_filters_.empty() || filter.all_filters_.empty()) return nullptr;
+    if (filter.input_->GetTypeInfo() != ScanAllByLabel::kType) return nullptr;
+    const auto &scan = static_cast<const ScanAllByLabel &>(*filter.input_);
+    if (scan.input_->GetTypeInfo() != Once::kType) return nullptr;
+    const auto &create = static_cast<const CreateNode &>(merge_create);
+    if (create.input_->GetTypeInfo() != Once::kType || create.node_info_.symbol != scan.output_symbol_) return nullptr;
+
+    std::vector<std::pair<PropertyIx, Expression *>> properties;
+    for (const auto &filter_info : filter.all_filters_) {
+      if (filter_info.type != FilterInfo::Type::Property) return nullptr;
+      const auto &property_filter = *filter_info.property_filter;
+      if (property_filter.type_ != PropertyFilter::Type::EQUAL || property_filter.is_symbol_in_value_ ||
+          property_filter.symbol_ != scan.output_symbol_) {
+        return nullptr;
+      }
+      properties.emplace_back(property_filter.property_, property_filter.value_);
+    }
+    return std::make_unique<HashLookup>(scan, std::move(properties), mem);
+  }
+
+  HashLookup(const ScanAllByLabel &scan, std::vector<std::pair<PropertyIx, Expression *>> properties,
+             utils::MemoryResource *mem)
+      : scan_(scan), properties_(std::move(properties)), table_(mem), key_(mem) {}
+
+  /// Finds the vertices the input row on @p frame matches. Returns false if
+  /// the table can't answer the lookup, in which case the match branch has to
+  /// run; a concurrent transaction could create the vertex unseen under
+  /// weaker isolation, and profiles and fine-grained access control need the
+  /// scan.
+  bool Lookup(Frame &frame, ExecutionContext &context) {
+    auto *storage_accessor = context.db_accessor->GetStorageAccessor();
+    if (context.is_profile_query ||
+        context.db_accessor->GetStorageMode() != storage::StorageMode::IN_MEMORY_TRANSACTIONAL ||
+        storage_accessor->GetTransaction()->isolation_level != storage::IsolationLevel::SNAPSHOT_ISOLATION) {
+      return false;
+    }
+#ifdef MG_ENTERPRISE
+    if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker) return false;
+#endif
+
+    if (!built_ || modifications_ != Modifications(context) ||
+        transaction_id_ != context.db_accessor->GetTransactionId()) {
+      Build(context);
+    }
+
+    ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
+                                  scan_.view_);
+    key_.clear();
+    for (const auto &[_, expression] : properties_) key_.emplace_back(expression->Accept(evaluator));
+    matches_ = nullptr;
+    next_match_ = 0;
+    // Nothing equals null, the created vertex is rejected by MERGE.
+    if (std::ranges::none_of(key_, [](const auto &value) { return value.IsNull(); })) {
+      if (auto it = table_.find(key_); it != table_.end()) matches_ = &it->second;
+    }
+    return true;
+  }
+
+  /// Places the next vertex the row matches on @p frame.
+  bool PullMatch(Frame &frame) {
+    if (!matches_ || next_match_ == matches_->size()) return false;
+    frame[scan_.output_symbol_] = (*matches_)[next_match_++];
+    return true;
+  }
+
+  /// Adds the vertex the create branch placed on @p frame for the key of the
+  /// last lookup and accounts for the changes it made.
+  void AddCreated(const Frame &frame, const ExecutionContext &context) {
+    const auto &created = frame[scan_.output_symbol_];
+    if (!created.IsVertex()) {
+      built_ = false;
+      return;
+    }
+    table_[key_].emplace_back(created.ValueVertex());
+    modifications_ = Modifications(context);
+  }
+
+ private:
+  using Table = utils::pmr::unordered_map<
+      utils::pmr::vector<TypedValue>, utils::pmr::vector<VertexAccessor>,
+      utils::FnvCollection<utils::pmr::vector<TypedValue>, TypedValue, TypedValue::Hash>, TypedValueVectorEqual>;
+
+  static int64_t Modifications(const ExecutionContext &context) {
+    return std::accumulate(context.execution_stats.counters.begin(), context.execution_stats.counters.end(),
+                           int64_t{0});
+  }
+
+  void Build(ExecutionContext &context) {
+    table_.clear();
+    matches_ = nullptr;
+    std::vector<storage::PropertyId> property_ids;
+    property_ids.reserve(properties_.size());
+    for (const auto &[property, _] : properties_) {
+      property_ids.push_back(context.evaluation_context.properties[property.ix]);
+    }
+    for (auto vertex : context.db_accessor->Vertices(scan_.view_, scan_.label_)) {
+      AbortCheck(context);
+      utils::pmr::vector<TypedValue> key(table_.get_allocator().resource());
+      key.reserve(property_ids.size());
+      for (const auto property : property_ids) {
+        auto value = vertex.GetProperty(scan_.view_, property);
+        if (value.HasError() || value->IsNull()) break;
+        key.emplace_back(*value);
+      }
+      if (key.size() != property_ids.size()) continue;
+      table_[std::move(key)].emplace_back(vertex);
+    }
+    built_ = true;
+    modifications_ = Modifications(context);
+    transaction_id_ = context.db_accessor->GetTransactionId();
+  }
+
+  const ScanAllByLabel &scan_;
+  std::vector<std::pair<PropertyIx, Expression *>> properties_;
+  Table table_;
+  bool built_{false};
+  int64_t modifications_{0};
+  std::optional<uint64_t> transaction_id_;
+  utils::pmr::vector<TypedValue> key_;
+  const utils::pmr::vector<VertexAccessor> *matches_{nullptr};
+  size_t next_match_{0};
+};
 
 Merge::MergeCursor::MergeCursor(const Merge &self, utils::MemoryResource *mem)
     : input_cursor_(self.input_->MakeCursor(mem)),
       merge_match_cursor_(self.merge_match_->MakeCursor(mem)),
-      merge_create_cursor_(self.merge_create_->MakeCursor(mem)) {}
+      merge_create_cursor_(self.merge_create_->MakeCursor(mem)),
+      hash_lookup_(HashLookup::Make(*self.merge_match_, *self.merge_create_, mem)) {}
+
+Merge::MergeCursor::~MergeCursor() = default;
 
 bool Merge::MergeCursor::Pull(Frame &frame, ExecutionContext &context) {
   OOMExceptionEnabler oom_exception;
@@ -4679,6 +7323,7 @@ bool Merge::MergeCursor::Pull(Frame &frame, ExecutionContext &context) {
         // and merge_create (could have a Once at the beginning)
         merge_match_cursor_->Reset();
         merge_create_cursor_->Reset();
+        use_hash_lookup_ = hash_lookup_ && hash_lookup_->Lookup(frame, context);
       } else {
         // input is exhausted, we're done
         return false;
@@ -4686,7 +7331,7 @@ bool Merge::MergeCursor::Pull(Frame &frame, ExecutionContext &context) {
     }
 
     // pull from the merge_match cursor
-    if (merge_match_cursor_->Pull(frame, context)) {
+    if (use_hash_lookup_ ? hash_lookup_->PullMatch(frame) : merge_match_cursor_->Pull(frame, context)) {
       // if successful, next Pull from this should not pull_input_
       pull_input_ = false;
       return true;
@@ -4695,7 +7340,9 @@ bool Merge::MergeCursor::Pull(Frame &frame, ExecutionContext &context) {
       if (pull_input_) {
         // if we have just now pulled from the input
         // and failed to pull from merge_match, we should create
-        return merge_create_cursor_->Pull(frame, context);
+        const bool created = merge_create_cursor_->Pull(frame, context);
+        if (created && use_hash_lookup_) hash_lookup_->AddCreated(frame, context);
+        return created;
       }
       // We have exhausted merge_match_cursor_ after 1 or more successful
       // Pulls. Attempt next input_cursor_ pull
@@ -4823,6 +7470,12 @@ class UnwindCursor : public Cursor {
       if (input_value_it_ == input_value_.end()) {
         if (!input_cursor_->Pull(frame, context)) return false;
 
+        if (auto *morsel = std::exchange(context.unwind_morsel, nullptr)) {
+          input_value_ = std::move(*morsel);
+          input_value_it_ = input_value_.begin();
+          continue;
+        }
+
         // successful pull from input, initialize value and iterator
         ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
                                       storage::View::OLD);
@@ -4871,7 +7524,7 @@ UniqueCursorPtr Unwind::MakeCursor(utils::MemoryResource *mem) const {
 class DistinctCursor : public Cursor {
  public:
   DistinctCursor(const Distinct &self, utils::MemoryResource *mem)
-      : self_(self), input_cursor_(self.input_->MakeCursor(mem)), seen_rows_(mem) {}
+      : self_(self), input_cursor_(self.input_->MakeCursor(mem)), seen_rows_(mem), seen_vertices_(mem) {}
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
     OOMExceptionEnabler oom_exception;
@@ -4881,19 +7534,31 @@ class DistinctCursor : public Cursor {
       if (!input_cursor_->Pull(frame, context)) {
         // Nothing left to pull, we can dispose of seen_rows now
         seen_rows_.clear();
+        seen_vertices_.clear();
         return false;
       }
 
-      utils::pmr::vector<TypedValue> row(seen_rows_.get_allocator().GetMemoryResource());
-      row.reserve(self_.value_symbols_.size());
-
-      for (const auto &symbol : self_.value_symbols_) {
-        row.emplace_back(frame.at(symbol));
+      if (self_.value_symbols_.size() == 1) {
+        const auto &value = frame.at(self_.value_symbols_.front());
+        if (value.IsVertex()) {
+          if (seen_vertices_.insert(value.ValueVertex().Gid()).second) return true;
+          continue;
+        }
       }
 
-      if (seen_rows_.insert(std::move(row)).second) {
-        return true;
+      // The row is only copied if it wasn't seen, and its hash is kept with it
+      // so neither rehashing nor lookups hash the stored rows again.
+      const FrameRow frame_row{.frame = &frame, .symbols = &self_.value_symbols_, .hash = Hash(frame)};
+      if (seen_rows_.contains(frame_row)) continue;
+
+      SeenRow row{.row = utils::pmr::vector<TypedValue>(seen_rows_.get_allocator().GetMemoryResource()),
+                  .hash = frame_row.hash};
+      row.row.reserve(self_.value_symbols_.size());
+      for (const auto &symbol : self_.value_symbols_) {
+        row.row.emplace_back(frame.at(symbol));
       }
+      seen_rows_.insert(std::move(row));
+      return true;
     }
   }
 
@@ -4902,18 +7567,59 @@ class DistinctCursor : public Cursor {
   void Reset() override {
     input_cursor_->Reset();
     seen_rows_.clear();
+    seen_vertices_.clear();
   }
 
  private:
+  struct SeenRow {
+    utils::pmr::vector<TypedValue> row;
+    size_t hash;
+  };
+
+  // The values of the row on the frame, looked up without copying them
+  struct FrameRow {
+    const Frame *frame;
+    const std::vector<Symbol> *symbols;
+    size_t hash;
+  };
+
+  struct RowHash {
+    using is_transparent = void;
+    size_t operator()(const SeenRow &row) const { return row.hash; }
+    size_t operator()(const FrameRow &row) const { return row.hash; }
+  };
+
+  struct RowEqual {
+    using is_transparent = void;
+    bool operator()(const SeenRow &left, const SeenRow &right) const {
+      return left.hash == right.hash && TypedValueVectorEqual{}(left.row, right.row);
+    }
+    bool operator()(const SeenRow &left, const FrameRow &right) const {
+      if (left.hash != right.hash) return false;
+      for (size_t i = 0; i < left.row.size(); ++i) {
+        if (!TypedValue::BoolEqual{}(left.row[i], right.frame->at((*right.symbols)[i]))) return false;
+      }
+      return true;
+    }
+    bool operator()(const FrameRow &left, const SeenRow &right) const { return (*this)(right, left); }
+  };
+
+  // Same as hashing the copied row with `utils::FnvCollection`
+  size_t Hash(const Frame &frame) const {
+    uint64_t hash = 14695981039346656037U;
+    for (const auto &symbol : self_.value_symbols_) {
+      hash *= 1099511628211U;
+      hash ^= TypedValue::Hash{}(frame.at(symbol));
+    }
+    return hash;
+  }
+
   const Distinct &self_;
   const UniqueCursorPtr input_cursor_;
   // a set of already seen rows
-  utils::pmr::unordered_set<utils::pmr::vector<TypedValue>,
-                            // use FNV collection hashing specialized for a
-                            // vector of TypedValue
-                            utils::FnvCollection<utils::pmr::vector<TypedValue>, TypedValue, TypedValue::Hash>,
-                            TypedValueVectorEqual>
-      seen_rows_;
+  utils::pmr::unordered_set<SeenRow, RowHash, RowEqual> seen_rows_;
+  // the seen vertices of a single column, which are told apart by their gid
+  utils::pmr::unordered_set<storage::Gid> seen_vertices_;
 };
 
 Distinct::Distinct(const std::shared_ptr<LogicalOperator> &input, const std::vector<Symbol> &value_symbols)
@@ -5046,31 +7752,49 @@ class CartesianCursor : public Cursor {
     OOMExceptionEnabler oom_exception;
     SCOPED_PROFILE_OP_BY_REF(self_);
 
-    if (!cartesian_pull_initialized_) {
-      // Pull all left_op frames.
-      while (left_op_cursor_->Pull(frame, context)) {
-        left_op_frames_.emplace_back(frame.elems().begin(), frame.elems().end());
+    auto restore_frame = [&frame, &context](const auto &symbols, const auto &restore_from) {
+      for (const auto &symbol : symbols) {
+        frame[symbol] = restore_from[symbol.position()];
+        if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(symbol.name())) {
+          context.frame_change_collector->ResetTrackingValue(symbol.name());
+        }
       }
+    };
 
-      // We're setting the iterator to 'end' here so it pulls the right
-      // cursor.
-      left_op_frames_it_ = left_op_frames_.end();
+    // The left frames are pulled while they are joined with the first right
+    // frame, so the first rows don't wait for the whole left side and a
+    // parent which stops early doesn't pull it at all.
+    if (!cartesian_pull_initialized_) {
       cartesian_pull_initialized_ = true;
+      // If left operator yielded zero results there is no cartesian product.
+      if (!left_op_cursor_->Pull(frame, context)) return false;
+      left_op_frames_.emplace_back(frame.elems().begin(), frame.elems().end());
+      if (!right_op_cursor_->Pull(frame, context)) {
+        left_op_frames_.clear();
+        return false;
+      }
+      right_op_frame_.assign(frame.elems().begin(), frame.elems().end());
+      restore_frame(self_.left_symbols_, left_op_frames_.back());
+      pulling_left_op_ = true;
+      return true;
     }
 
-    // If left operator yielded zero results there is no cartesian product.
     if (left_op_frames_.empty()) {
       return false;
     }
 
-    auto restore_frame = [&frame, &context](const auto &symbols, const auto &restore_from) {
-      for (const auto &symbol : symbols) {
-        frame[symbol] = restore_from[symbol.position()];
-        if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(symbol.name())) {
-          context.frame_change_collector->ResetTrackingValue(symbol.name());
-        }
+    if (pulling_left_op_) {
+      AbortCheck(context);
+      if (left_op_cursor_->Pull(frame, context)) {
+        left_op_frames_.emplace_back(frame.elems().begin(), frame.elems().end());
+        restore_frame(self_.right_symbols_, right_op_frame_);
+        return true;
       }
-    };
+      // All left frames were joined with the first right frame, pull the
+      // next right frame.
+      pulling_left_op_ = false;
+      left_op_frames_it_ = left_op_frames_.end();
+    }
 
     if (left_op_frames_it_ == left_op_frames_.end()) {
       // Advance right_op_cursor_.
@@ -5102,6 +7826,7 @@ class CartesianCursor : public Cursor {
     left_op_frames_.clear();
     left_op_frames_it_ = left_op_frames_.end();
     cartesian_pull_initialized_ = false;
+    pulling_left_op_ = false;
   }
 
  private:
@@ -5112,6 +7837,8 @@ class CartesianCursor : public Cursor {
   const UniqueCursorPtr right_op_cursor_;
   utils::pmr::vector<utils::pmr::vector<TypedValue>>::iterator left_op_frames_it_;
   bool cartesian_pull_initialized_{false};
+  // true while the left frames are pulled and joined with the first right frame
+  bool pulling_left_op_{false};
 };
 
 }  // namespace
@@ -5346,6 +8073,97 @@ void CallCustomProcedure(const std::string_view fully_qualified_procedure_name,
   }
 }
 
+/// Runs a procedure on its own thread while the records it yields are
+/// pulled. The procedure and the pulling thread take turns: the procedure is
+/// suspended when it starts a record after `capacity` complete ones, and is
+/// resumed once they were all pulled. Only one of the threads runs at a time,
+/// so the procedure sees the same state as on the pulling thread.
+class ProcedureStream {
+ public:
+  ProcedureStream() = default;
+  ProcedureStream(const ProcedureStream &) = delete;
+  ProcedureStream &operator=(const ProcedureStream &) = delete;
+  ProcedureStream(ProcedureStream &&) = delete;
+  ProcedureStream &operator=(ProcedureStream &&) = delete;
+  ~ProcedureStream() { Stop(); }
+
+  /// Runs @p call on a new thread and waits until it's suspended or finished.
+  void Start(std::function<void()> call, DbAccessor *db, size_t capacity) {
+    capacity_ = capacity;
+    turn_ = Turn::PROCEDURE;
+    thread_ = std::jthread([this, call = std::move(call), db] {
+      db->TrackCurrentThreadAllocations();
+      try {
+        call();
+      } catch (...) {
+        error_ = std::current_exception();
+      }
+      db->UntrackCurrentThreadAllocations();
+      {
+        std::lock_guard guard{mutex_};
+        finished_ = true;
+        turn_ = Turn::PULLER;
+      }
+      cv_.notify_all();
+    });
+    std::unique_lock lock{mutex_};
+    cv_.wait(lock, [this] { return turn_ == Turn::PULLER; });
+  }
+
+  /// Called on the procedure thread before it starts a record of @p result.
+  /// @throw QueryRuntimeException if the stream was stopped.
+  void OnNewRecord(const mgp_result &result) {
+    if (!stopped_ && result.rows.size() >= capacity_) PassTurn(Turn::PULLER);
+    if (stopped_) throw QueryRuntimeException("The records of the procedure are no longer pulled.");
+  }
+
+  /// Resumes the procedure once all of its records were pulled and removed,
+  /// and waits until it's suspended again or finished.
+  void Resume(size_t capacity) {
+    DMG_ASSERT(!finished_, "Resuming a finished procedure");
+    capacity_ = capacity;
+    PassTurn(Turn::PROCEDURE);
+  }
+
+  bool Finished() const { return finished_; }
+
+  void RethrowError() {
+    if (auto error = std::exchange(error_, nullptr)) std::rethrow_exception(error);
+  }
+
+  /// Makes the next record of a suspended procedure fail and waits until the
+  /// procedure returns.
+  void Stop() {
+    if (!thread_.joinable()) return;
+    if (!finished_) {
+      stopped_ = true;
+      PassTurn(Turn::PROCEDURE);
+    }
+    thread_.join();
+  }
+
+ private:
+  enum class Turn : uint8_t { PROCEDURE, PULLER };
+
+  void PassTurn(Turn to) {
+    std::unique_lock lock{mutex_};
+    turn_ = to;
+    cv_.notify_all();
+    cv_.wait(lock, [this, to] { return turn_ != to; });
+  }
+
+  // Only accessed by the thread whose turn it is, the mutex orders the turns.
+  Turn turn_{Turn::PULLER};
+  size_t capacity_{0};
+  bool finished_{false};
+  bool stopped_{false};
+  std::exception_ptr error_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::jthread thread_;
+};
+
 }  // namespace
 
 class CallProcedureCursor : public Cursor {
@@ -5360,6 +8178,72 @@ class CallProcedureCursor : public Cursor {
   bool call_initializer{false};
   std::optional<std::function<void()>> cleanup_{std::nullopt};
 
+  // A procedure whose records are pulled while it runs. The result is
+  // allocated with new and delete, so the pulled records are freed.
+  struct StreamedCall {
+    std::shared_ptr<procedure::Module> module;
+    mgp_graph graph;
+    std::unique_ptr<mgp_result> result;
+    ProcedureStream stream;
+  };
+  // Declared last, so the procedure stops before the other members are gone.
+  std::unique_ptr<StreamedCall> streamed_call_;
+
+  void SkipRowsWithDeletedValues() {
+    if (result_->is_transactional) return;
+    while (result_row_it_ != result_->rows.end() && result_row_it_->has_deleted_values) {
+      ++result_row_it_;
+    }
+  }
+
+  void StartStreamedCall(const mgp_proc &proc, std::shared_ptr<procedure::Module> module,
+                         ExpressionEvaluator *evaluator, std::optional<size_t> memory_limit, uint64_t transaction_id,
+                         ExecutionContext &context) {
+    // Constructed in place, the stream can't be moved.
+    streamed_call_.reset(new StreamedCall{
+        .module = std::move(module),
+        .graph = mgp_graph::WritableGraph(*context.db_accessor, storage::View::OLD, context),
+        .result = std::make_unique<mgp_result>(&proc.results, utils::NewDeleteResource()),
+    });
+    auto &call = *streamed_call_;
+    call.result->is_transactional = storage::IsTransactional(context.db_accessor->GetStorageMode());
+    call.result->on_new_record = [&call] { call.stream.OnNewRecord(*call.result); };
+    result_ = call.result.get();
+    result_signature_size_ = proc.results.size();
+    // The arguments are evaluated before the procedure yields its first
+    // record, so the evaluator is only used until `Start` returns. Their values
+    // live as long as the procedure runs, longer than the pull memory.
+    auto *pull_memory = std::exchange(context.evaluation_context.memory, utils::NewDeleteResource());
+    utils::OnScopeExit restore_pull_memory{[&context, pull_memory] { context.evaluation_context.memory = pull_memory; }};
+    call.stream.Start(
+        [this, &proc, &call, evaluator, memory_limit, transaction_id] {
+          CallCustomProcedure(self_->procedure_name_, proc, self_->arguments_, call.graph, evaluator,
+                              utils::NewDeleteResource(), memory_limit, call.result.get(), self_->procedure_id_,
+                              transaction_id);
+        },
+        context.db_accessor, context.procedure_stream_rows);
+  }
+
+  void FinishStreamedBatch() {
+    auto &call = *streamed_call_;
+    if (call.stream.Finished()) {
+      call.stream.RethrowError();
+      if (result_->error_msg) {
+        memgraph::utils::MemoryTracker::OutOfMemoryExceptionBlocker blocker;
+        throw QueryRuntimeException("{}: {}", self_->procedure_name_, *result_->error_msg);
+      }
+    }
+    result_row_it_ = result_->rows.begin();
+    SkipRowsWithDeletedValues();
+  }
+
+  void ResetStreamedCall() {
+    streamed_call_.reset();
+    monotonic_memory_.Release();
+    result_ = utils::Allocator<mgp_result>(memory_resource_).new_object<mgp_result>(nullptr, memory_resource_);
+    result_row_it_ = result_->rows.end();
+  }
+
  public:
   CallProcedureCursor(const CallProcedure *self, utils::MemoryResource *mem)
       : self_(self),
@@ -5377,12 +8261,6 @@ class CallProcedureCursor : public Cursor {
 
     AbortCheck(context);
 
-    auto skip_rows_with_deleted_values = [this]() {
-      while (result_row_it_ != result_->rows.end() && result_row_it_->has_deleted_values) {
-        ++result_row_it_;
-      }
-    };
-
     // We need to fetch new procedure results after pulling from input.
     // TODO: Look into openCypher's distinction between procedures returning an
     // empty result set vs procedures which return `void`. We currently don't
@@ -5392,6 +8270,15 @@ class CallProcedureCursor : public Cursor {
     mgp_proc const *proc = nullptr;
 
     while (result_row_it_ == result_->rows.end()) {
+      if (streamed_call_) {
+        if (!streamed_call_->stream.Finished()) {
+          result_->rows.clear();
+          streamed_call_->stream.Resume(context.procedure_stream_rows);
+          FinishStreamedBatch();
+          continue;
+        }
+        ResetStreamedCall();
+      }
       if (!module) {
         auto maybe_found = procedure::FindProcedure(procedure::gModuleRegistry, self_->procedure_name_);
         if (!maybe_found) {
@@ -5449,6 +8336,14 @@ class CallProcedureCursor : public Cursor {
       auto graph = mgp_graph::WritableGraph(*context.db_accessor, graph_view, context);
       const auto transaction_id = context.db_accessor->GetTransactionId();
       MG_ASSERT(transaction_id.has_value());
+      if (!proc->info.is_batched && !proc->info.is_write && context.procedure_stream_rows > 0 &&
+          module->CanRunOnAnyThread()) {
+        // The module stays locked while the procedure runs, so `proc` remains
+        // valid until the call is reset.
+        StartStreamedCall(*proc, std::move(module), &evaluator, memory_limit, transaction_id.value(), context);
+        FinishStreamedBatch();
+        continue;
+      }
       CallCustomProcedure(self_->procedure_name_, *proc, self_->arguments_, graph, &evaluator, memory, memory_limit,
                           result_, self_->procedure_id_, transaction_id.value(), call_initializer);
 
@@ -5464,9 +8359,7 @@ class CallProcedureCursor : public Cursor {
         throw QueryRuntimeException("{}: {}", self_->procedure_name_, *result_->error_msg);
       }
       result_row_it_ = result_->rows.begin();
-      if (!result_->is_transactional) {
-        skip_rows_with_deleted_values();
-      }
+      SkipRowsWithDeletedValues();
 
       stream_exhausted = result_row_it_ == result_->rows.end();
     }
@@ -5496,14 +8389,13 @@ class CallProcedureCursor : public Cursor {
       }
     }
     ++result_row_it_;
-    if (!result_->is_transactional) {
-      skip_rows_with_deleted_values();
-    }
+    SkipRowsWithDeletedValues();
 
     return true;
   }
 
   void Reset() override {
+    streamed_call_.reset();
     monotonic_memory_.Release();
     result_ = utils::Allocator<mgp_result>(memory_resource_).new_object<mgp_result>(nullptr, memory_resource_);
     if (cleanup_) {
@@ -5512,6 +8404,7 @@ class CallProcedureCursor : public Cursor {
   }
 
   void Shutdown() override {
+    streamed_call_.reset();
     monotonic_memory_.Release();
     if (cleanup_) {
       cleanup_.value()();
@@ -5586,7 +8479,8 @@ UniqueCursorPtr CallProcedure::MakeCursor(utils::MemoryResource *mem) const {
 }
 
 LoadCsv::LoadCsv(std::shared_ptr<LogicalOperator> input, Expression *file, bool with_header, bool ignore_bad,
-                 Expression *delimiter, Expression *quote, Expression *nullif, Symbol row_var)
+                 Expression *delimiter, Expression *quote, Expression *nullif, Symbol row_var,
+                 std::optional<std::vector<std::string>> columns)
     : input_(input ? input : (std::make_shared<Once>())),
       file_(file),
       with_header_(with_header),
@@ -5594,7 +8488,8 @@ LoadCsv::LoadCsv(std::shared_ptr<LogicalOperator> input, Expression *file, bool
       delimiter_(delimiter),
       quote_(quote),
       nullif_(nullif),
-      row_var_(std::move(row_var)) {
+      row_var_(std::move(row_var)),
+      columns_(std::move(columns)) {
   MG_ASSERT(file_, "Something went wrong - '{}' member file_ shouldn't be a nullptr", __func__);
 }
 
@@ -5639,11 +8534,12 @@ TypedValue CsvRowToTypedList(csv::Reader::Row &row, std::optional<utils::pmr::st
 }
 
 TypedValue CsvRowToTypedMap(csv::Reader::Row &row, csv::Reader::Header header,
-                            std::optional<utils::pmr::string> &nullif) {
+                            std::optional<utils::pmr::string> &nullif, const std::vector<bool> &kept_columns) {
   // a valid row has the same number of elements as the header
   auto *mem = row.get_allocator().GetMemoryResource();
   utils::pmr::map<utils::pmr::string, TypedValue> m(mem);
   for (auto i = 0; i < row.size(); ++i) {
+    if (!kept_columns.empty() && !kept_columns[i]) continue;
     if (!nullif.has_value() || row[i] != nullif.value()) {
       m.emplace(std::move(header[i]), std::move(row[i]));
     } else {
@@ -5661,6 +8557,8 @@ class LoadCsvCursor : public Cursor {
   bool did_pull_;
   std::optional<csv::Reader> reader_{};
   std::optional<utils::pmr::string> nullif_;
+  // Whether each header column is in the rows, empty if all of them are.
+  std::vector<bool> kept_columns_;
 
  public:
   LoadCsvCursor(const LoadCsv *self, utils::MemoryResource *mem)
@@ -5678,8 +8576,15 @@ class LoadCsvCursor : public Cursor {
     //  self_->delimiter_, and self_->quote_ earlier (say, in the interpreter.cpp)
     //  without massacring the code even worse than I did here
     if (UNLIKELY(!reader_)) {
-      reader_ = MakeReader(&context.evaluation_context);
+      reader_ = MakeReader(&context.evaluation_context, context.load_csv_parallel_workers);
       nullif_ = ParseNullif(&context.evaluation_context);
+      if (self_->columns_ && reader_->HasHeader()) {
+        const auto &header = reader_->GetHeader();
+        kept_columns_.reserve(header.size());
+        for (const auto &column : header) {
+          kept_columns_.push_back(utils::Contains(*self_->columns_, std::string_view(column)));
+        }
+      }
     }
 
     if (input_cursor_->Pull(frame, context)) {
@@ -5701,7 +8606,8 @@ class LoadCsvCursor : public Cursor {
       frame[self_->row_var_] = CsvRowToTypedList(*row, nullif_);
     } else {
       frame[self_->row_var_] =
-          CsvRowToTypedMap(*row, csv::Reader::Header(reader_->GetHeader(), context.evaluation_context.memory), nullif_);
+          CsvRowToTypedMap(*row, csv::Reader::Header(reader_->GetHeader(), context.evaluation_context.memory), nullif_,
+                           kept_columns_);
     }
     if (context.frame_change_collector && context.frame_change_collector->IsKeyTracked(self_->row_var_.name())) {
       context.frame_change_collector->ResetTrackingValue(self_->row_var_.name());
@@ -5713,7 +8619,7 @@ class LoadCsvCursor : public Cursor {
   void Shutdown() override { input_cursor_->Shutdown(); }
 
  private:
-  csv::Reader MakeReader(EvaluationContext *eval_context) {
+  csv::Reader MakeReader(EvaluationContext *eval_context, size_t parallel_workers) {
     Frame frame(0);
     SymbolTable symbol_table;
     DbAccessor *dba = nullptr;
@@ -5728,10 +8634,10 @@ class LoadCsvCursor : public Cursor {
     // Note that the reader has to be given its own memory resource, as it
     // persists between pulls, so it can't use the evalutation context memory
     // resource.
-    return csv::Reader(
-        csv::CsvSource::Create(*maybe_file),
-        csv::Reader::Config(self_->with_header_, self_->ignore_bad_, std::move(maybe_delim), std::move(maybe_quote)),
-        utils::NewDeleteResource());
+    auto config =
+        csv::Reader::Config(self_->with_header_, self_->ignore_bad_, std::move(maybe_delim), std::move(maybe_quote));
+    config.parallel_workers = parallel_workers;
+    return csv::Reader(csv::CsvSource::Create(*maybe_file), std::move(config), utils::NewDeleteResource());
   }
 
   std::optional<utils::pmr::string> ParseNullif(EvaluationContext *eval_context) {
@@ -5986,10 +8892,13 @@ class HashJoinCursor : public Cursor {
       : self_(self),
         left_op_cursor_(self.left_op_->MakeCursor(mem)),
         right_op_cursor_(self_.right_op_->MakeCursor(mem)),
-        hashtable_(mem),
-        right_op_frame_(mem) {
+        right_op_frame_(mem),
+        mem_(mem) {
     MG_ASSERT(left_op_cursor_ != nullptr, "HashJoinCursor: Missing left operator cursor.");
     MG_ASSERT(right_op_cursor_ != nullptr, "HashJoinCursor: Missing right operator cursor.");
+    if (self_.left_op_->GetTypeInfo() == Gather::kType) {
+      parallel_left_op_ = static_cast<const Gather *>(self_.left_op_.get());
+    }
   }
 
   bool Pull(Frame &frame, ExecutionContext &context) override {
@@ -6001,7 +8910,7 @@ class HashJoinCursor : public Cursor {
     }
 
     // If left_op yielded zero results, there is no cartesian product.
-    if (hashtable_.empty()) {
+    if (!has_left_frames_) {
       return false;
     }
 
@@ -6024,12 +8933,13 @@ class HashJoinCursor : public Cursor {
         ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
                                       storage::View::OLD);
         auto right_value = self_.hash_join_condition_->expression2_->Accept(evaluator);
-        if (hashtable_.contains(right_value)) {
+        auto &partition = Partition(right_value);
+        if (auto it = partition.find(right_value); it != partition.end()) {
           // If so, finish pulling for now and proceed to joining the pulled frame
           right_op_frame_.assign(frame.elems().begin(), frame.elems().end());
           common_value_found_ = true;
-          common_value = right_value;
-          left_op_frame_it_ = hashtable_[common_value].begin();
+          left_op_frames_ = &it->second;
+          left_op_frame_it_ = left_op_frames_->begin();
           break;
         }
       }
@@ -6043,7 +8953,7 @@ class HashJoinCursor : public Cursor {
     left_op_frame_it_++;
     // When all left frames with the common value have been joined, move on to pulling and joining the next right
     // frame
-    if (common_value_found_ && left_op_frame_it_ == hashtable_[common_value].end()) {
+    if (common_value_found_ && left_op_frame_it_ == left_op_frames_->end()) {
       common_value_found_ = false;
     }
 
@@ -6058,22 +8968,101 @@ class HashJoinCursor : public Cursor {
   void Reset() override {
     left_op_cursor_->Reset();
     right_op_cursor_->Reset();
-    hashtable_.clear();
+    partitions_.clear();
     right_op_frame_.clear();
+    left_op_frames_ = nullptr;
     left_op_frame_it_ = {};
     hash_join_initialized_ = false;
+    has_left_frames_ = false;
     common_value_found_ = false;
   }
 
  private:
+  using HashTable = utils::pmr::unordered_map<TypedValue, utils::pmr::vector<utils::pmr::vector<TypedValue>>,
+                                              TypedValue::Hash, TypedValue::BoolEqual>;
+
+  // The partition of the join value, the high bits of the hash pick it so
+  // the low bits the tables pick their buckets by stay spread out.
+  static size_t PartitionIndex(const TypedValue &value, size_t num_partitions) {
+    return (TypedValue::Hash{}(value) >> 32U) % num_partitions;
+  }
+
+  HashTable &Partition(const TypedValue &value) {
+    return partitions_.size() == 1 ? partitions_.front() : partitions_[PartitionIndex(value, partitions_.size())];
+  }
+
   void InitializeHashJoin(Frame &frame, ExecutionContext &context) {
+    MorselWorkers workers;
+    if (parallel_left_op_ && workers.Prepare(*parallel_left_op_, frame, context)) {
+      BuildInParallel(&workers);
+      has_left_frames_ = std::ranges::any_of(partitions_, [](const auto &partition) { return !partition.empty(); });
+      return;
+    }
+
+    partitions_.emplace_back(mem_);
     // Pull all left_op_ frames
     while (left_op_cursor_->Pull(frame, context)) {
       ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
                                     storage::View::OLD);
       auto left_value = self_.hash_join_condition_->expression1_->Accept(evaluator);
       if (left_value.type() != TypedValue::Type::Null) {
-        hashtable_[left_value].emplace_back(frame.elems().begin(), frame.elems().end());
+        partitions_.front()[left_value].emplace_back(frame.elems().begin(), frame.elems().end());
+      }
+    }
+    has_left_frames_ = !partitions_.front().empty();
+  }
+
+  /**
+   * Radix-partitioned build of a Gather's input. Every worker sorts the rows
+   * it pulls into one table per partition, and once all workers are done each
+   * partition's tables are merged on a thread of its own. The partitions are
+   * allocated with the new-delete resource as the execution memory isn't
+   * thread-safe.
+   */
+  void BuildInParallel(MorselWorkers *workers) {
+    auto const num_partitions = workers->NumWorkers();
+    // worker_tables[worker][partition]
+    std::vector<std::vector<HashTable>> worker_tables(num_partitions);
+    for (auto &tables : worker_tables) {
+      tables.reserve(num_partitions);
+      for (size_t i = 0; i < num_partitions; ++i) tables.emplace_back(utils::NewDeleteResource());
+    }
+
+    workers->Start(
+        [this, &worker_tables, num_partitions](MorselWorkers::Worker &worker) {
+          ExpressionEvaluator evaluator(&worker.frame, worker.context.symbol_table, worker.context.evaluation_context,
+                                        worker.context.db_accessor, storage::View::OLD);
+          auto left_value = self_.hash_join_condition_->expression1_->Accept(evaluator);
+          if (left_value.type() == TypedValue::Type::Null) return true;
+          auto &table = worker_tables[worker.index][PartitionIndex(left_value, num_partitions)];
+          table[left_value].emplace_back(worker.frame.elems().begin(), worker.frame.elems().end());
+          return true;
+        },
+        [](MorselWorkers::Worker & /*worker*/) {});
+    workers->Join();
+    workers->RethrowError();
+
+    partitions_.reserve(num_partitions);
+    for (size_t i = 0; i < num_partitions; ++i) partitions_.emplace_back(utils::NewDeleteResource());
+    {
+      std::vector<std::jthread> mergers;
+      mergers.reserve(num_partitions);
+      for (size_t partition = 0; partition < num_partitions; ++partition) {
+        mergers.emplace_back([this, &worker_tables, partition] {
+          auto &merged = partitions_[partition];
+          for (auto &tables : worker_tables) {
+            for (auto &[value, rows] : tables[partition]) {
+              auto &merged_rows = merged[value];
+              if (merged_rows.empty()) {
+                // Both use the new-delete resource, so the rows are moved
+                merged_rows = std::move(rows);
+              } else {
+                std::move(rows.begin(), rows.end(), std::back_inserter(merged_rows));
+              }
+            }
+            tables[partition].clear();
+          }
+        });
       }
     }
   }
@@ -6081,14 +9070,19 @@ class HashJoinCursor : public Cursor {
   const HashJoin &self_;
   const UniqueCursorPtr left_op_cursor_;
   const UniqueCursorPtr right_op_cursor_;
-  utils::pmr::unordered_map<TypedValue, utils::pmr::vector<utils::pmr::vector<TypedValue>>, TypedValue::Hash,
-                            TypedValue::BoolEqual>
-      hashtable_;
+  // Set when the left input is a Gather whose rows can be hashed on the
+  // worker threads.
+  const Gather *parallel_left_op_{nullptr};
+  // The left frames by join value, split by `PartitionIndex` when the left
+  // input was pulled in parallel and a single table otherwise
+  std::vector<HashTable> partitions_;
   utils::pmr::vector<TypedValue> right_op_frame_;
+  utils::MemoryResource *mem_;
+  utils::pmr::vector<utils::pmr::vector<TypedValue>> *left_op_frames_{nullptr};
   utils::pmr::vector<utils::pmr::vector<TypedValue>>::iterator left_op_frame_it_;
   bool hash_join_initialized_{false};
+  bool has_left_frames_{false};
   bool common_value_found_{false};
-  TypedValue common_value;
 };
 }  // namespace
 
@@ -6203,6 +9197,62 @@ ACCEPT_WITH_INPUT(PeriodicCommit)
 
 namespace {
 
+// Sizes the batches of a periodic commit by the delta and time budgets of
+// the context. A batch which reaches a budget is committed early, and the
+// size of the next one is scaled by how much of the budgets the last one
+// used, at most halving or doubling it. The size of the query is the size
+// of the first batch.
+class AdaptiveCommitBatch {
+ public:
+  AdaptiveCommitBatch(uint64_t rows, uint64_t delta_budget, std::chrono::milliseconds time_budget)
+      : rows_(std::max<uint64_t>(rows, 1)),
+        delta_budget_(delta_budget),
+        time_budget_(time_budget),
+        batch_start_(std::chrono::steady_clock::now()) {}
+
+  bool Full(uint64_t pulled, DbAccessor *dba) const {
+    if (pulled >= rows_) return true;
+    if (delta_budget_ > 0 && dba->DeltaCount() >= delta_budget_) return true;
+    return time_budget_.count() > 0 && std::chrono::steady_clock::now() - batch_start_ >= time_budget_;
+  }
+
+  // Called once the batch of @p pulled rows which wrote @p deltas deltas was
+  // committed, so its time includes the commit.
+  void Committed(uint64_t pulled, size_t deltas) {
+    const auto now = std::chrono::steady_clock::now();
+    const std::chrono::duration<double> elapsed = now - batch_start_;
+    batch_start_ = now;
+    const auto committed = std::max<uint64_t>(pulled, 1);
+    smallest_batch_ = batches_ == 0 ? committed : std::min(smallest_batch_, committed);
+    largest_batch_ = std::max(largest_batch_, committed);
+    ++batches_;
+
+    double scale = 2.0;
+    if (delta_budget_ > 0 && deltas > 0) {
+      scale = std::min(scale, static_cast<double>(delta_budget_) / static_cast<double>(deltas));
+    }
+    if (time_budget_.count() > 0 && elapsed.count() > 0) {
+      scale = std::min(scale, std::chrono::duration<double>(time_budget_) / elapsed);
+    }
+    scale = std::max(scale, 0.5);
+    rows_ = std::max<uint64_t>(std::llround(static_cast<double>(committed) * scale), 1);
+  }
+
+  std::string Describe(const std::string &name) const {
+    return fmt::format("{} (adaptive, {} batches of {}..{} rows, next {})", name, batches_, smallest_batch_,
+                       largest_batch_, rows_);
+  }
+
+ private:
+  uint64_t rows_;
+  uint64_t delta_budget_;
+  std::chrono::milliseconds time_budget_;
+  std::chrono::steady_clock::time_point batch_start_;
+  uint64_t batches_{0};
+  uint64_t smallest_batch_{0};
+  uint64_t largest_batch_{0};
+};
+
 class PeriodicCommitCursor : public Cursor {
  public:
   PeriodicCommitCursor(const PeriodicCommit &self, utils::MemoryResource *mem)
@@ -6221,18 +9271,22 @@ class PeriodicCommitCursor : public Cursor {
       ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
                                     storage::View::OLD);
       commit_frequency_ = *EvaluateCommitFrequency(evaluator, self_.commit_frequency_);
+      if (context.periodic_commit_delta_budget > 0 || context.periodic_commit_time_budget.count() > 0) {
+        adaptive_batch_.emplace(*commit_frequency_, context.periodic_commit_delta_budget,
+                                context.periodic_commit_time_budget);
+      }
     }
 
     bool const pull_value = input_cursor_->Pull(frame, context);
 
     pulled_++;
-    if (pulled_ >= commit_frequency_) {
+    if (adaptive_batch_ ? adaptive_batch_->Full(pulled_, context.db_accessor) : pulled_ >= commit_frequency_) {
       // do periodic commit since we pulled that many times
-      [[maybe_unused]] auto commit_result = context.db_accessor->PeriodicCommit({}, context.db_acc);
+      Commit(context);
       pulled_ = 0;
     } else if (!pull_value && pulled_ > 0) {
       // do periodic commit for the rest of pulled items
-      [[maybe_unused]] auto commit_result = context.db_accessor->PeriodicCommit({}, context.db_acc);
+      Commit(context);
     }
 
     return pull_value;
@@ -6243,14 +9297,25 @@ class PeriodicCommitCursor : public Cursor {
   void Reset() override {
     input_cursor_->Reset();
     commit_frequency_.reset();
+    adaptive_batch_.reset();
     pulled_ = 0;
   }
 
  private:
+  void Commit(ExecutionContext &context) {
+    const auto deltas = adaptive_batch_ ? context.db_accessor->DeltaCount() : 0;
+    [[maybe_unused]] auto commit_result = context.db_accessor->PeriodicCommit({}, context.db_acc);
+    if (!adaptive_batch_) return;
+    adaptive_batch_->Committed(pulled_, deltas);
+    // The stats of this operator are the profiling root while it's pulled
+    if (context.is_profile_query) context.stats_root->name = adaptive_batch_->Describe(self_.ToString());
+  }
+
   // NOLINTNEXTLINE(cppcoreguidelines-avoid-const-or-ref-data-members)
   const PeriodicCommit &self_;
   const UniqueCursorPtr input_cursor_;
   std::optional<uint64_t> commit_frequency_;
+  std::optional<AdaptiveCommitBatch> adaptive_batch_;
   uint64_t pulled_ = 0;
 };
 }  // namespace
@@ -6262,11 +9327,13 @@ UniqueCursorPtr PeriodicCommit::MakeCursor(utils::MemoryResource *mem) const {
 
 PeriodicSubquery::PeriodicSubquery(const std::shared_ptr<LogicalOperator> input,
                                    const std::shared_ptr<LogicalOperator> subquery, Expression *commit_frequency,
-                                   bool subquery_has_return)
+                                   bool subquery_has_return, bool concurrent, Expression *concurrency)
     : input_(input ? input : std::make_shared<Once>()),
       subquery_(subquery),
       commit_frequency_(commit_frequency),
-      subquery_has_return_(subquery_has_return) {}
+      subquery_has_return_(subquery_has_return),
+      concurrent_(concurrent),
+      concurrency_(concurrency) {}
 
 bool PeriodicSubquery::Accept(HierarchicalLogicalOperatorVisitor &visitor) {
   if (visitor.PreVisit(*this)) {
@@ -6284,6 +9351,62 @@ std::vector<Symbol> PeriodicSubquery::ModifiedSymbols(const SymbolTable &table)
 }
 
 namespace {
+// Attempts of a batch of CALL IN CONCURRENT TRANSACTIONS which conflicts
+// with the other batches, the wait before a retry grows with each attempt.
+constexpr uint64_t kConcurrentTransactionAttempts = 10;
+constexpr auto kConcurrentTransactionRetryBackoff = std::chrono::milliseconds(10);
+
+VertexAccessor RebindVertex(const VertexAccessor &vertex, DbAccessor *dba) {
+  auto rebound = dba->FindVertex(vertex.Gid(), storage::View::OLD);
+  if (!rebound) {
+    throw QueryRuntimeException("CALL IN CONCURRENT TRANSACTIONS can't use a node which isn't committed.");
+  }
+  return *rebound;
+}
+
+EdgeAccessor RebindEdge(const EdgeAccessor &edge, DbAccessor *dba) {
+  auto rebound = dba->FindEdge(edge.Gid(), storage::View::OLD);
+  if (!rebound) {
+    throw QueryRuntimeException("CALL IN CONCURRENT TRANSACTIONS can't use a relationship which isn't committed.");
+  }
+  return *rebound;
+}
+
+/// Returns @p value with its nodes and relationships found again through
+/// @p dba, so a value of a row of one transaction can be used in another.
+TypedValue RebindToAccessor(const TypedValue &value, DbAccessor *dba) {
+  switch (value.type()) {
+    case TypedValue::Type::Vertex:
+      return TypedValue(RebindVertex(value.ValueVertex(), dba));
+    case TypedValue::Type::Edge:
+      return TypedValue(RebindEdge(value.ValueEdge(), dba));
+    case TypedValue::Type::Path: {
+      const auto &path = value.ValuePath();
+      Path rebound(RebindVertex(path.vertices()[0], dba));
+      for (size_t i = 0; i < path.edges().size(); ++i) {
+        rebound.Expand(RebindEdge(path.edges()[i], dba));
+        rebound.Expand(RebindVertex(path.vertices()[i + 1], dba));
+      }
+      return TypedValue(std::move(rebound));
+    }
+    case TypedValue::Type::List: {
+      TypedValue::TVector list(utils::NewDeleteResource());
+      list.reserve(value.ValueList().size());
+      for (const auto &element : value.ValueList()) list.emplace_back(RebindToAccessor(element, dba));
+      return TypedValue(std::move(list));
+    }
+    case TypedValue::Type::Map: {
+      TypedValue::TMap map(utils::NewDeleteResource());
+      for (const auto &[key, element] : value.ValueMap()) map.emplace(key, RebindToAccessor(element, dba));
+      return TypedValue(std::move(map));
+    }
+    case TypedValue::Type::Graph:
+      throw QueryRuntimeException("CALL IN CONCURRENT TRANSACTIONS can't use a graph value.");
+    default:
+      return value;
+  }
+}
+
 class PeriodicSubqueryCursor : public Cursor {
  public:
   PeriodicSubqueryCursor(const PeriodicSubquery &self, utils::MemoryResource *mem)
@@ -6304,8 +9427,15 @@ class PeriodicSubqueryCursor : public Cursor {
       ExpressionEvaluator evaluator(&frame, context.symbol_table, context.evaluation_context, context.db_accessor,
                                     storage::View::OLD);
       commit_frequency_ = *EvaluateCommitFrequency(evaluator, self_.commit_frequency_);
+      if (self_.concurrent_ && CanRunConcurrently(context)) {
+        StartWorkers(evaluator, context);
+        concurrent_ = true;
+      }
     }
 
+    // The workers are gone once the input is exhausted
+    if (concurrent_) return batches_ && PullConcurrently(frame, context);
+
     while (true) {
       if (pull_input_) {
         if (input_->Pull(frame, context)) {
@@ -6342,11 +9472,14 @@ class PeriodicSubqueryCursor : public Cursor {
   }
 
   void Shutdown() override {
+    StopWorkers();
     input_->Shutdown();
     subquery_->Shutdown();
   }
 
   void Reset() override {
+    StopWorkers();
+    concurrent_ = false;
     input_->Reset();
     subquery_->Reset();
     pull_input_ = true;
@@ -6354,7 +9487,168 @@ class PeriodicSubqueryCursor : public Cursor {
     pulled_ = 0;
   }
 
+  ~PeriodicSubqueryCursor() override { StopWorkers(); }
+
  private:
+  using Row = std::vector<TypedValue>;
+
+  /// Batches handed to the workers, at most one waiting per worker. The
+  /// workers only use this state, as the cursor can outlive its context.
+  struct ConcurrentBatches {
+    ExecutionContext context;
+    std::mutex lock;
+    std::condition_variable cv;
+    std::deque<std::vector<Row>> queue;
+    bool closed{false};
+    std::exception_ptr error;
+    ExecutionStats stats;
+    std::vector<std::jthread> workers;
+  };
+
+  /// The workers' transactions don't report their changes to triggers and
+  /// can't take part in profiling, so such queries run the batches one after
+  /// the other.
+  static bool CanRunConcurrently(const ExecutionContext &context) {
+    if (context.db_accessor->GetStorageMode() == storage::StorageMode::ON_DISK_TRANSACTIONAL) return false;
+    if (context.is_profile_query || context.trigger_context_collector || context.frame_change_collector) return false;
+#ifdef MG_ENTERPRISE
+    if (license::global_license_checker.IsEnterpriseValidFast() && context.auth_checker) return false;
+#endif
+    return !flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH);
+  }
+
+  void StartWorkers(ExpressionEvaluator &evaluator, ExecutionContext &context) {
+    auto const concurrency =
+        self_.concurrency_ ? static_cast<uint64_t>(*EvaluateCommitConcurrency(evaluator, self_.concurrency_))
+                           : std::max<uint64_t>(std::thread::hardware_concurrency(), 1);
+    symbols_ = self_.input_->ModifiedSymbols(context.symbol_table);
+    batches_ = std::make_unique<ConcurrentBatches>();
+    batches_->context = MakeWorkerContext(context);
+    batches_->context.db_acc = context.db_acc;
+    // Each batch reserves its hops from the pool of the query's limit.
+    batches_->context.hops_limit = context.hops_limit.ForWorker();
+    batches_->workers.reserve(concurrency);
+    for (uint64_t i = 0; i < concurrency; ++i) {
+      batches_->workers.emplace_back([this, batches = batches_.get()] {
+        auto *db = batches->context.db_accessor;
+        // The memory of the workers counts towards the query
+        db->TrackCurrentThreadAllocations();
+        utils::OnScopeExit untrack{[db] { db->UntrackCurrentThreadAllocations(); }};
+        Frame frame(batches->context.symbol_table.max_position());
+        try {
+          while (auto batch = NextBatch(*batches)) RunBatch(*batch, frame, *batches);
+        } catch (...) {
+          {
+            auto guard = std::lock_guard{batches->lock};
+            if (!batches->error) batches->error = std::current_exception();
+          }
+          batches->cv.notify_all();
+        }
+      });
+    }
+  }
+
+  /// Passes the input rows on as they're pulled and hands them to the
+  /// workers in batches. The first error of a worker is rethrown once all of
+  /// the workers stopped.
+  bool PullConcurrently(Frame &frame, ExecutionContext &context) {
+    if (input_->Pull(frame, context)) {
+      auto &row = batch_.emplace_back();
+      row.reserve(symbols_.size());
+      for (const auto &symbol : symbols_) row.emplace_back(frame[symbol]);
+      if (batch_.size() >= *commit_frequency_) SubmitBatch(context);
+      return true;
+    }
+    if (!batch_.empty()) SubmitBatch(context);
+    FinishWorkers(context);
+    return false;
+  }
+
+  void SubmitBatch(ExecutionContext &context) {
+    {
+      auto guard = std::unique_lock{batches_->lock};
+      batches_->cv.wait(guard, [this] { return batches_->queue.size() < batches_->workers.size() || batches_->error; });
+      if (!batches_->error) batches_->queue.push_back(std::exchange(batch_, {}));
+    }
+    batches_->cv.notify_all();
+    if (batches_->error) FinishWorkers(context);
+  }
+
+  static std::optional<std::vector<Row>> NextBatch(ConcurrentBatches &batches) {
+    std::optional<std::vector<Row>> batch;
+    {
+      auto guard = std::unique_lock{batches.lock};
+      batches.cv.wait(guard, [&batches] { return !batches.queue.empty() || batches.closed || batches.error; });
+      if (batches.error || batches.queue.empty()) return std::nullopt;
+      batch.emplace(std::move(batches.queue.front()));
+      batches.queue.pop_front();
+    }
+    batches.cv.notify_all();
+    return batch;
+  }
+
+  /// Runs the subquery for the rows of @p batch in a transaction of its own,
+  /// which is retried if it conflicts with another transaction.
+  void RunBatch(const std::vector<Row> &batch, Frame &frame, ConcurrentBatches &batches) const {
+    const auto &context = batches.context;
+    for (uint64_t attempt = 1;; ++attempt) {
+      auto storage_accessor = context.db_accessor->GetStorageAccessor()->AccessStorage();
+      DbAccessor dba(storage_accessor.get());
+      auto worker_context = MakeWorkerContext(context);
+      worker_context.db_accessor = &dba;
+      worker_context.hops_limit = context.hops_limit;
+      utils::OnScopeExit release_hops{[&worker_context] { worker_context.hops_limit.ReleaseReservation(); }};
+      auto cursor = self_.subquery_->MakeCursor(utils::NewDeleteResource());
+      try {
+        for (const auto &row : batch) {
+          for (size_t i = 0; i < symbols_.size(); ++i) frame[symbols_[i]] = RebindToAccessor(row[i], &dba);
+          cursor->Reset();
+          while (cursor->Pull(frame, worker_context)) AbortCheck(worker_context);
+        }
+      } catch (const TransactionSerializationException &) {
+        if (attempt >= kConcurrentTransactionAttempts) throw;
+        dba.Abort();
+        std::this_thread::sleep_for(kConcurrentTransactionRetryBackoff * attempt);
+        continue;
+      }
+      if (dba.Commit({}, context.db_acc).HasError()) {
+        throw QueryRuntimeException("Couldn't commit a batch of CALL IN CONCURRENT TRANSACTIONS.");
+      }
+      auto guard = std::lock_guard{batches.lock};
+      for (size_t i = 0; i < batches.stats.counters.size(); ++i) {
+        batches.stats.counters[i] += worker_context.execution_stats.counters[i];
+      }
+      return;
+    }
+  }
+
+  void FinishWorkers(ExecutionContext &context) {
+    {
+      auto guard = std::lock_guard{batches_->lock};
+      batches_->closed = true;
+    }
+    batches_->cv.notify_all();
+    batches_->workers.clear();
+    auto batches = std::move(batches_);
+    if (batches->error) std::rethrow_exception(batches->error);
+    for (size_t i = 0; i < batches->stats.counters.size(); ++i) {
+      context.execution_stats.counters[i] += batches->stats.counters[i];
+    }
+  }
+
+  // Stops the workers without waiting for the batches which weren't started.
+  void StopWorkers() {
+    if (!batches_) return;
+    {
+      auto guard = std::lock_guard{batches_->lock};
+      batches_->queue.clear();
+      batches_->closed = true;
+    }
+    batches_->cv.notify_all();
+    batches_.reset();
+    batch_.clear();
+  }
+
   // NOLINTNEXTLINE(cppcoreguidelines-avoid-const-or-ref-data-members)
   const PeriodicSubquery &self_;
   UniqueCursorPtr input_;
@@ -6363,6 +9657,11 @@ class PeriodicSubqueryCursor : public Cursor {
   bool pull_input_{true};
   uint64_t pulled_{0};
   std::optional<uint64_t> commit_frequency_;
+  bool concurrent_{false};
+  // The symbols of the input rows which are passed to the workers
+  std::vector<Symbol> symbols_;
+  std::vector<Row> batch_;
+  std::unique_ptr<ConcurrentBatches> batches_;
 };
 }  // namespace
 
@@ -6371,4 +9670,174 @@ UniqueCursorPtr PeriodicSubquery::MakeCursor(utils::MemoryResource *mem) const {
 
   return MakeUniqueCursorPtr<PeriodicSubqueryCursor>(mem, *this, mem);
 }
+
+Gather::Gather(const std::shared_ptr<LogicalOperator> &input, std::optional<storage::LabelId> label,
+               storage::View view, uint64_t num_workers)
+    : input_(input), label_(label), view_(view), num_workers_(num_workers) {}
+
+ACCEPT_WITH_INPUT(Gather)
+
+std::vector<Symbol> Gather::ModifiedSymbols(const SymbolTable &table) const { return input_->ModifiedSymbols(table); }
+
+namespace {
+constexpr size_t kGatherBatchSize = 1024;
+/// Bounds how far the workers can run ahead of the pulling thread.
+constexpr size_t kGatherQueuedBatchesPerWorker = 4;
+
+class GatherCursor : public Cursor {
+  using Row = std::vector<TypedValue>;
+  using Batch = std::vector<Row>;
+
+ public:
+  GatherCursor(const Gather &self, utils::MemoryResource *mem)
+      : self_(self), input_cursor_(self.input_->MakeCursor(mem)) {}
+
+  GatherCursor(const GatherCursor &) = delete;
+  GatherCursor &operator=(const GatherCursor &) = delete;
+  GatherCursor(GatherCursor &&) = delete;
+  GatherCursor &operator=(GatherCursor &&) = delete;
+
+  ~GatherCursor() override { StopWorkers(); }
+
+  bool Pull(Frame &frame, ExecutionContext &context) override {
+    OOMExceptionEnabler oom_exception;
+    SCOPED_PROFILE_OP_BY_REF(self_);
+
+    AbortCheck(context);
+
+    if (!started_) {
+      started_ = true;
+      parallel_ = workers_.Prepare(self_, frame, context);
+      if (parallel_) StartWorkers(context);
+    }
+    if (!parallel_) return input_cursor_->Pull(frame, context);
+
+    while (batch_pos_ == batch_.size()) {
+      if (!PopBatch()) return false;
+    }
+    auto &row = batch_[batch_pos_++];
+    for (size_t i = 0; i < output_symbols_.size(); ++i) {
+      frame[output_symbols_[i]] = std::move(row[i]);
+    }
+    return true;
+  }
+
+  void Shutdown() override {
+    StopWorkers();
+    input_cursor_->Shutdown();
+  }
+
+  void Reset() override {
+    StopWorkers();
+    input_cursor_->Reset();
+    started_ = false;
+    parallel_ = false;
+    active_workers_ = 0;
+  }
+
+ private:
+  void StartWorkers(const ExecutionContext &context) {
+    output_symbols_ = self_.input_->ModifiedSymbols(context.symbol_table);
+    max_queued_batches_ = workers_.NumWorkers() * kGatherQueuedBatchesPerWorker;
+    active_workers_ = workers_.NumWorkers();
+    pending_.assign(workers_.NumWorkers(), Batch{});
+
+    workers_.Start(
+        [this](MorselWorkers::Worker &worker) {
+          auto &batch = pending_[worker.index];
+          auto &row = batch.emplace_back();
+          row.reserve(output_symbols_.size());
+          for (const auto &symbol : output_symbols_) {
+            row.emplace_back(worker.frame[symbol], utils::NewDeleteResource());
+          }
+          if (batch.size() < kGatherBatchSize) return true;
+          return PushBatch(std::exchange(batch, Batch{}));
+        },
+        [this](MorselWorkers::Worker &worker) {
+          auto &batch = pending_[worker.index];
+          if (!batch.empty() && !workers_.Failed()) PushBatch(std::exchange(batch, Batch{}));
+          {
+            std::lock_guard guard{mutex_};
+            --active_workers_;
+          }
+          consumer_cv_.notify_one();
+          producer_cv_.notify_all();
+        });
+  }
+
+  bool PushBatch(Batch batch) {
+    {
+      std::unique_lock lock{mutex_};
+      producer_cv_.wait(lock,
+                        [this] { return queue_.size() < max_queued_batches_ || workers_.StopRequested(); });
+      if (workers_.StopRequested()) return false;
+      queue_.push_back(std::move(batch));
+    }
+    consumer_cv_.notify_one();
+    return true;
+  }
+
+  bool PopBatch() {
+    std::unique_lock lock{mutex_};
+    consumer_cv_.wait(lock, [this] { return !queue_.empty() || active_workers_ == 0 || workers_.Failed(); });
+    if (workers_.Failed()) {
+      lock.unlock();
+      StopWorkers();
+      workers_.RethrowError();
+    }
+    if (queue_.empty()) {
+      // All workers are done, join them right away to release the morsels.
+      lock.unlock();
+      StopWorkers();
+      return false;
+    }
+    batch_ = std::move(queue_.front());
+    queue_.pop_front();
+    batch_pos_ = 0;
+    lock.unlock();
+    producer_cv_.notify_one();
+    return true;
+  }
+
+  void StopWorkers() {
+    if (!workers_.Running()) return;
+    {
+      std::lock_guard guard{mutex_};
+      workers_.RequestStop();
+    }
+    producer_cv_.notify_all();
+    workers_.Join();
+
+    pending_.clear();
+    queue_.clear();
+    batch_.clear();
+    batch_pos_ = 0;
+  }
+
+  const Gather &self_;
+  const UniqueCursorPtr input_cursor_;
+  bool started_{false};
+  bool parallel_{false};
+  std::vector<Symbol> output_symbols_;
+  MorselWorkers workers_;
+  // Rows a worker collected but didn't push yet, indexed by MorselWorkers::Worker::index.
+  std::vector<Batch> pending_;
+
+  std::mutex mutex_;
+  std::condition_variable consumer_cv_;
+  std::condition_variable producer_cv_;
+  std::deque<Batch> queue_;
+  size_t max_queued_batches_{0};
+  uint64_t active_workers_{0};
+
+  Batch batch_;
+  size_t batch_pos_{0};
+};
+}  // namespace
+
+UniqueCursorPtr Gather::MakeCursor(utils::MemoryResource *mem) const {
+  memgraph::metrics::IncrementCounter(memgraph::metrics::GatherOperator);
+
+  return MakeUniqueCursorPtr<GatherCursor>(mem, *this, mem);
+}
 }  // namespace memgraph::query::plan
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <optional>
 #include <unordered_map>
@@ -29,6 +30,7 @@
 #include "utils/fnv.hpp"
 #include "utils/logging.hpp"
 #include "utils/memory.hpp"
+#include "utils/pmr/unordered_map.hpp"
 #include "utils/synchronized.hpp"
 #include "utils/visitor.hpp"
 
@@ -37,10 +39,25 @@ namespace memgraph::query {
 struct ExecutionContext;
 class ExpressionEvaluator;
 class Frame;
+class FrameBatch;
 class SymbolTable;
 
 namespace plan {
 
+// Custom equality function for a vector of typed values.
+// Used in unordered_maps in Aggregate, Distinct and EvaluatePatternFilter
+// operators.
+struct TypedValueVectorEqual {
+  template <class TAllocator>
+  bool operator()(const std::vector<TypedValue, TAllocator> &left,
+                  const std::vector<TypedValue, TAllocator> &right) const {
+    MG_ASSERT(left.size() == right.size(),
+              "TypedValueVector comparison should only be done over vectors "
+              "of the same size");
+    return std::equal(left.begin(), left.end(), right.begin(), TypedValue::BoolEqual{});
+  }
+};
+
 /// Base class for iteration cursors of @c LogicalOperator classes.
 ///
 /// Each @c LogicalOperator must produce a concrete @c Cursor, which provides
@@ -60,6 +77,17 @@ class Cursor {
   /// @throws QueryRuntimeException if something went wrong with execution
   virtual bool Pull(Frame &, ExecutionContext &) = 0;
 
+  /// Pull up to `batch.capacity()` rows into `batch`, replacing the rows it
+  /// held.
+  ///
+  /// The default implementation pulls the rows one at a time into `frame` and
+  /// copies them to the batch, so batched cursors can consume any input.
+  /// Cursors which override it must keep `Pull` working, since the cursor
+  /// above them may pull row by row.
+  ///
+  /// @return false if no rows were pulled, i.e. the cursor is exhausted.
+  virtual bool PullBatch(Frame &frame, FrameBatch &batch, ExecutionContext &context);
+
   /// Resets the Cursor to its initial state.
   virtual void Reset() = 0;
 
@@ -94,6 +122,7 @@ class ScanAllByLabelPropertyRange;
 class ScanAllByLabelPropertyValue;
 class ScanAllByLabelProperty;
 class ScanAllById;
+class ScanAllByPointNearest;
 class ScanAllByEdge;
 class ScanAllByEdgeType;
 class ScanAllByEdgeTypeProperty;
@@ -102,6 +131,7 @@ class ScanAllByEdgeTypePropertyRange;
 class ScanAllByEdgeId;
 class Expand;
 class ExpandVariable;
+class ExpandIntersection;
 class ConstructNamedPath;
 class Filter;
 class Produce;
@@ -134,15 +164,20 @@ class HashJoin;
 class RollUpApply;
 class PeriodicCommit;
 class PeriodicSubquery;
+class Gather;
+class LoadProperties;
+class ComputeExpressions;
+class CountVertices;
 
 using LogicalOperatorCompositeVisitor = utils::CompositeVisitor<
     Once, CreateNode, CreateExpand, ScanAll, ScanAllByLabel, ScanAllByLabelPropertyRange, ScanAllByLabelPropertyValue,
-    ScanAllByLabelProperty, ScanAllById, ScanAllByEdge, ScanAllByEdgeType, ScanAllByEdgeTypeProperty,
+    ScanAllByLabelProperty, ScanAllById, ScanAllByPointNearest, ScanAllByEdge, ScanAllByEdgeType, ScanAllByEdgeTypeProperty,
     ScanAllByEdgeTypePropertyValue, ScanAllByEdgeTypePropertyRange, ScanAllByEdgeId, Expand, ExpandVariable,
-    ConstructNamedPath, Filter, Produce, Delete, SetProperty, SetProperties, SetLabels, RemoveProperty, RemoveLabels,
-    EdgeUniquenessFilter, Accumulate, Aggregate, Skip, Limit, OrderBy, Merge, Optional, Unwind, Distinct, Union,
-    Cartesian, CallProcedure, LoadCsv, Foreach, EmptyResult, EvaluatePatternFilter, Apply, IndexedJoin, HashJoin,
-    RollUpApply, PeriodicCommit, PeriodicSubquery>;
+    ExpandIntersection, ConstructNamedPath, Filter, Produce, Delete, SetProperty, SetProperties, SetLabels,
+    RemoveProperty, RemoveLabels, EdgeUniquenessFilter, Accumulate, Aggregate, Skip, Limit, OrderBy, Merge, Optional,
+    Unwind, Distinct, Union, Cartesian, CallProcedure, LoadCsv, Foreach, EmptyResult, EvaluatePatternFilter, Apply,
+    IndexedJoin, HashJoin, RollUpApply, PeriodicCommit, PeriodicSubquery, Gather, LoadProperties,
+    ComputeExpressions, CountVertices>;
 
 using LogicalOperatorLeafVisitor = utils::LeafVisitor<Once>;
 
@@ -862,6 +897,16 @@ class ScanAllByLabelPropertyValue : public memgraph::query::plan::ScanAll {
   storage::LabelId label_;
   storage::PropertyId property_;
   Expression *expression_;
+  /// Set when the lookup goes through the composite index over these
+  /// properties, starting with `property_`. The vertices must then have the
+  /// values of `expression_` followed by `composite_expressions_` as the
+  /// prefix of the indexed properties.
+  std::vector<storage::PropertyId> composite_properties_;
+  std::vector<Expression *> composite_expressions_;
+  /// Set when the vertices are only used for looking up the properties of
+  /// the composite index. Instead of the vertex, the output symbol then holds
+  /// a map of the property values stored in the index entry.
+  bool covering_{false};
 
   std::string ToString() const override;
 
@@ -873,6 +918,12 @@ class ScanAllByLabelPropertyValue : public memgraph::query::plan::ScanAll {
     object->label_ = label_;
     object->property_ = property_;
     object->expression_ = expression_ ? expression_->Clone(storage) : nullptr;
+    object->composite_properties_ = composite_properties_;
+    object->composite_expressions_.reserve(composite_expressions_.size());
+    for (auto *expression : composite_expressions_) {
+      object->composite_expressions_.push_back(expression->Clone(storage));
+    }
+    object->covering_ = covering_;
     return object;
   }
 };
@@ -938,6 +989,50 @@ class ScanAllById : public memgraph::query::plan::ScanAll {
     return object;
   }
 };
+
+/// Behaves like @c ScanAllByLabel, but produces only the `limit + skip`
+/// vertices whose `property_` is the nearest to the point
+/// `point_expression_` evaluates to, found through the point index. It is
+/// planned below `ORDER BY point.distance(n.property, point) [SKIP s] LIMIT
+/// k`, which still sorts and limits the rows. If the index doesn't hold
+/// enough vertices, the rest are taken from the label index, they all have a
+/// null distance and are sorted after the indexed ones.
+///
+/// @sa ScanAllByLabel
+class ScanAllByPointNearest : public memgraph::query::plan::ScanAll {
+ public:
+  static const utils::TypeInfo kType;
+  const utils::TypeInfo &GetTypeInfo() const override { return kType; }
+
+  ScanAllByPointNearest() = default;
+  ScanAllByPointNearest(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol, storage::LabelId label,
+                        storage::PropertyId property, Expression *point_expression, Expression *limit_expression,
+                        Expression *skip_expression, storage::View view = storage::View::OLD);
+  bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
+  UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
+
+  storage::LabelId label_;
+  storage::PropertyId property_;
+  Expression *point_expression_;
+  Expression *limit_expression_;
+  // nullptr if the query has no SKIP
+  Expression *skip_expression_{nullptr};
+
+  std::string ToString() const override;
+
+  std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override {
+    auto object = std::make_unique<ScanAllByPointNearest>();
+    object->input_ = input_ ? input_->Clone(storage) : nullptr;
+    object->output_symbol_ = output_symbol_;
+    object->view_ = view_;
+    object->label_ = label_;
+    object->property_ = property_;
+    object->point_expression_ = point_expression_ ? point_expression_->Clone(storage) : nullptr;
+    object->limit_expression_ = limit_expression_ ? limit_expression_->Clone(storage) : nullptr;
+    object->skip_expression_ = skip_expression_ ? skip_expression_->Clone(storage) : nullptr;
+    return object;
+  }
+};
 class ScanAllByEdgeId : public memgraph::query::plan::ScanAllByEdge {
  public:
   static const utils::TypeInfo kType;
@@ -1073,6 +1168,10 @@ class Expand : public memgraph::query::plan::LogicalOperator {
   memgraph::query::plan::ExpandCommon common_;
   /// State from which the input node should get expanded.
   storage::View view_;
+  /// Set when both nodes are bound and there is a single edge type with an
+  /// edge-type index, the edges between the nodes are then looked up in the
+  /// index instead of scanning the adjacency list of the input node.
+  bool edge_type_index_lookup_{false};
 
   std::string ToString() const override;
 
@@ -1082,6 +1181,7 @@ class Expand : public memgraph::query::plan::LogicalOperator {
     object->input_symbol_ = input_symbol_;
     object->common_ = common_;
     object->view_ = view_;
+    object->edge_type_index_lookup_ = edge_type_index_lookup_;
     return object;
   }
 };
@@ -1160,12 +1260,15 @@ class ExpandVariable : public memgraph::query::plan::LogicalOperator {
    * expression.
    * @param filter_ The filter that must be satisfied for an expansion to
    * succeed. Can use inner(node/edge) symbols. If nullptr, it is ignored.
+   * @param heuristic_lambda Optional estimate of the weight of the rest of a
+   *    weighted shortest path to a bound node, see `heuristic_lambda_`.
    */
   ExpandVariable(const std::shared_ptr<LogicalOperator> &input, Symbol input_symbol, Symbol node_symbol,
                  Symbol edge_symbol, EdgeAtom::Type type, EdgeAtom::Direction direction,
                  const std::vector<storage::EdgeTypeId> &edge_types, bool is_reverse, Expression *lower_bound,
                  Expression *upper_bound, bool existing_node, ExpansionLambda filter_lambda,
-                 std::optional<ExpansionLambda> weight_lambda, std::optional<Symbol> total_weight);
+                 std::optional<ExpansionLambda> weight_lambda, std::optional<Symbol> total_weight,
+                 std::optional<ExpansionLambda> heuristic_lambda = std::nullopt);
 
   bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
   UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
@@ -1188,6 +1291,15 @@ class ExpandVariable : public memgraph::query::plan::LogicalOperator {
   memgraph::query::plan::ExpansionLambda filter_lambda_;
   std::optional<memgraph::query::plan::ExpansionLambda> weight_lambda_;
   std::optional<Symbol> total_weight_;
+  /// Estimate of the weight of the rest of a weighted shortest path, from the
+  /// inner node to the bound destination, which turns the search into A*. The
+  /// estimate mustn't be larger than the actual weight. It is only used when
+  /// both ends of the path are bound, otherwise it is ignored.
+  std::optional<memgraph::query::plan::ExpansionLambda> heuristic_lambda_;
+  /// Number of threads expanding the levels of a single source breadth-first
+  /// expansion, set for read-only plans. Values 0 and 1 keep the expansion on
+  /// the pulling thread.
+  uint64_t num_workers_{0};
 
   std::string OperatorName() const {
     using Type = query::EdgeAtom::Type;
@@ -1204,6 +1316,9 @@ class ExpandVariable : public memgraph::query::plan::LogicalOperator {
       case Type::ALL_SHORTEST_PATHS:
         return "AllShortestPaths";
         break;
+      case Type::K_SHORTEST_PATHS:
+        return "KShortestPaths";
+        break;
       case Type::SINGLE:
         LOG_FATAL("Unexpected ExpandVariable::type_");
       default:
@@ -1231,6 +1346,12 @@ class ExpandVariable : public memgraph::query::plan::LogicalOperator {
       object->weight_lambda_ = std::nullopt;
     }
     object->total_weight_ = total_weight_;
+    if (heuristic_lambda_) {
+      object->heuristic_lambda_.emplace(heuristic_lambda_->Clone(storage));
+    } else {
+      object->heuristic_lambda_ = std::nullopt;
+    }
+    object->num_workers_ = num_workers_;
     return object;
   }
 
@@ -1240,7 +1361,76 @@ class ExpandVariable : public memgraph::query::plan::LogicalOperator {
   // that should be inaccessible (private class function won't compile)
   friend class ExpandVariableCursor;
   friend class ExpandWeightedShortestPathCursor;
+  friend class ExpandWeightedShortestPathBetweenCursor;
   friend class ExpandAllShortestPathCursor;
+  friend class ExpandKShortestPathsCursor;
+};
+
+/// Expansion of a new node which is adjacent to several bound nodes, used for
+/// the cycles in patterns, e.g. the node closing the triangle in
+/// MATCH (a)-->(b)-->(c)-->(a).
+///
+/// Each leg expands one edge from a bound node to the new node. Instead of
+/// expanding the first leg and then checking the others for every expanded
+/// edge, the adjacency lists of all legs are sorted by the node on the other
+/// end and intersected in a leapfrog manner, seeking each list to the largest
+/// node the others are at. The work per input row is then bounded by the
+/// degrees of the bound nodes instead of their product. With View::OLD the
+/// sorted list of a leg is reused while its bound node doesn't change, which
+/// is the case for the nodes bound by the outer loops of the plan.
+///
+/// Like @c Expand, this doesn't filter the nodes and edges on their
+/// properties, and it doesn't ensure the uniqueness of the expanded edges.
+class ExpandIntersection : public memgraph::query::plan::LogicalOperator {
+ public:
+  static const utils::TypeInfo kType;
+  const utils::TypeInfo &GetTypeInfo() const override { return kType; }
+
+  struct Leg {
+    /// Symbol pointing to the bound node the edge is expanded from.
+    Symbol input_symbol;
+    /// Symbol where the expanded edge is stored.
+    Symbol edge_symbol;
+    /// Direction of the edge, relative to the bound node.
+    EdgeAtom::Direction direction;
+    /// Types of the edges to expand, all edges are valid if empty.
+    std::vector<storage::EdgeTypeId> edge_types;
+  };
+
+  ExpandIntersection() = default;
+
+  /**
+   * @param input Optional logical operator that preceeds this one.
+   * @param node_symbol Symbol where the node adjacent to all legs is stored.
+   * @param legs At least two expansions, one from each of the bound nodes.
+   */
+  ExpandIntersection(const std::shared_ptr<LogicalOperator> &input, Symbol node_symbol, std::vector<Leg> legs,
+                     storage::View view);
+
+  bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
+  UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
+  std::vector<Symbol> ModifiedSymbols(const SymbolTable &) const override;
+
+  bool HasSingleInput() const override { return true; }
+  std::shared_ptr<LogicalOperator> input() const override { return input_; }
+  void set_input(std::shared_ptr<LogicalOperator> input) override { input_ = input; }
+
+  std::shared_ptr<memgraph::query::plan::LogicalOperator> input_;
+  Symbol node_symbol_;
+  std::vector<Leg> legs_;
+  /// State from which the bound nodes should get expanded.
+  storage::View view_;
+
+  std::string ToString() const override;
+
+  std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override {
+    auto object = std::make_unique<ExpandIntersection>();
+    object->input_ = input_ ? input_->Clone(storage) : nullptr;
+    object->node_symbol_ = node_symbol_;
+    object->legs_ = legs_;
+    object->view_ = view_;
+    return object;
+  }
 };
 
 /// Constructs a named path from its elements and places it on the frame.
@@ -1366,6 +1556,7 @@ class Filter : public memgraph::query::plan::LogicalOperator {
    public:
     FilterCursor(const Filter &, utils::MemoryResource *);
     bool Pull(Frame &, ExecutionContext &) override;
+    bool PullBatch(Frame &, FrameBatch &, ExecutionContext &) override;
     void Shutdown() override;
     void Reset() override;
 
@@ -1376,6 +1567,105 @@ class Filter : public memgraph::query::plan::LogicalOperator {
   };
 };
 
+/// Reads properties of the vertices and edges on the frame into frame slots,
+/// once for every row, so the lookups of the operators above it read the
+/// slots instead of the property store. All properties of a vertex are read in
+/// a single pass over its property store.
+///
+/// The planner inserts it below the first operator which looks up a property
+/// that's looked up more than once in the pipeline, or several properties of
+/// the same object.
+class LoadProperties : public memgraph::query::plan::LogicalOperator {
+ public:
+  static const utils::TypeInfo kType;
+  const utils::TypeInfo &GetTypeInfo() const override { return kType; }
+
+  /// Properties of the vertex or edge on the frame as `symbol`.
+  struct Entry {
+    Symbol symbol;
+    /// Lookups of the properties on `symbol`, evaluated when the object isn't
+    /// a vertex.
+    std::vector<PropertyLookup *> lookups;
+    /// Slots receiving the value of each lookup.
+    std::vector<Symbol> output_symbols;
+  };
+
+  LoadProperties() = default;
+
+  LoadProperties(const std::shared_ptr<LogicalOperator> &input, std::vector<Entry> entries);
+  bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
+  UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
+  std::vector<Symbol> ModifiedSymbols(const SymbolTable &) const override;
+
+  bool HasSingleInput() const override { return true; }
+  std::shared_ptr<LogicalOperator> input() const override { return input_; }
+  void set_input(std::shared_ptr<LogicalOperator> input) override { input_ = input; }
+
+  std::string ToString() const override;
+
+  std::shared_ptr<memgraph::query::plan::LogicalOperator> input_;
+  std::vector<Entry> entries_;
+
+  std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override {
+    auto object = std::make_unique<LoadProperties>();
+    object->input_ = input_ ? input_->Clone(storage) : nullptr;
+    object->entries_.reserve(entries_.size());
+    for (const auto &entry : entries_) {
+      auto &cloned = object->entries_.emplace_back(Entry{.symbol = entry.symbol, .output_symbols = entry.output_symbols});
+      cloned.lookups.reserve(entry.lookups.size());
+      for (const auto *lookup : entry.lookups) {
+        cloned.lookups.push_back(lookup->Clone(storage));
+      }
+    }
+    return object;
+  }
+};
+
+/// Evaluates expressions which the operators above it share into frame slots,
+/// once for every row, so each of those operators reads the slot instead of
+/// evaluating the expression again.
+///
+/// The planner inserts it below the first operator which evaluates a
+/// deterministic expression that occurs more than once in the pipeline.
+class ComputeExpressions : public memgraph::query::plan::LogicalOperator {
+ public:
+  static const utils::TypeInfo kType;
+  const utils::TypeInfo &GetTypeInfo() const override { return kType; }
+
+  ComputeExpressions() = default;
+
+  ComputeExpressions(const std::shared_ptr<LogicalOperator> &input, std::vector<Expression *> expressions,
+                     std::vector<Symbol> output_symbols);
+  bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
+  UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
+  std::vector<Symbol> ModifiedSymbols(const SymbolTable &) const override;
+
+  bool HasSingleInput() const override { return true; }
+  std::shared_ptr<LogicalOperator> input() const override { return input_; }
+  void set_input(std::shared_ptr<LogicalOperator> input) override { input_ = input; }
+
+  std::string ToString() const override {
+    return fmt::format("ComputeExpressions {{{}}}",
+                       utils::IterableToString(output_symbols_, ", ", [](const auto &sym) { return sym.name(); }));
+  }
+
+  std::shared_ptr<memgraph::query::plan::LogicalOperator> input_;
+  std::vector<Expression *> expressions_;
+  /// Slots receiving the value of each expression.
+  std::vector<Symbol> output_symbols_;
+
+  std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override {
+    auto object = std::make_unique<ComputeExpressions>();
+    object->input_ = input_ ? input_->Clone(storage) : nullptr;
+    object->expressions_.reserve(expressions_.size());
+    for (const auto *expression : expressions_) {
+      object->expressions_.push_back(expression->Clone(storage));
+    }
+    object->output_symbols_ = output_symbols_;
+    return object;
+  }
+};
+
 /// A logical operator that places an arbitrary number
 /// of named expressions on the frame (the logical operator
 /// for the RETURN clause).
@@ -1425,6 +1715,7 @@ class Produce : public memgraph::query::plan::LogicalOperator {
    public:
     ProduceCursor(const Produce &, utils::MemoryResource *);
     bool Pull(Frame &, ExecutionContext &) override;
+    bool PullBatch(Frame &, FrameBatch &, ExecutionContext &) override;
     void Shutdown() override;
     void Reset() override;
 
@@ -1975,6 +2266,44 @@ class Aggregate : public memgraph::query::plan::LogicalOperator {
   }
 };
 
+/// Produces a single row with the number of vertices its input scan reads,
+/// which is a @c ScanAllByLabel, @c ScanAllByLabelProperty or
+/// @c ScanAllByLabelPropertyRange over @c Once. The vertices are counted by
+/// the storage while it walks the index the scan reads, without a row for
+/// each of them. With fine-grained access control the rows of the scan are
+/// counted instead, so only the vertices the user may read are counted.
+///
+/// The planner uses it instead of an @c Aggregate with a single `count` of
+/// the scanned vertices and no grouping.
+class CountVertices : public memgraph::query::plan::LogicalOperator {
+ public:
+  static const utils::TypeInfo kType;
+  const utils::TypeInfo &GetTypeInfo() const override { return kType; }
+
+  CountVertices() = default;
+
+  CountVertices(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol);
+  bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
+  UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
+  std::vector<Symbol> ModifiedSymbols(const SymbolTable &) const override;
+
+  bool HasSingleInput() const override { return true; }
+  std::shared_ptr<LogicalOperator> input() const override { return input_; }
+  void set_input(std::shared_ptr<LogicalOperator> input) override { input_ = input; }
+
+  std::string ToString() const override { return fmt::format("CountVertices {{{}}}", output_symbol_.name()); }
+
+  std::shared_ptr<memgraph::query::plan::LogicalOperator> input_;
+  Symbol output_symbol_;
+
+  std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override {
+    auto object = std::make_unique<CountVertices>();
+    object->input_ = input_ ? input_->Clone(storage) : nullptr;
+    object->output_symbol_ = output_symbol_;
+    return object;
+  }
+};
+
 /// Skips a number of Pulls from the input op.
 ///
 /// The given expression determines how many Pulls from the input
@@ -2039,7 +2368,8 @@ class EvaluatePatternFilter : public memgraph::query::plan::LogicalOperator {
 
   EvaluatePatternFilter() = default;
 
-  EvaluatePatternFilter(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol);
+  EvaluatePatternFilter(const std::shared_ptr<LogicalOperator> &input, Symbol output_symbol,
+                        std::optional<std::vector<Symbol>> correlated_symbols = std::nullopt);
   bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
   UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
   std::vector<Symbol> ModifiedSymbols(const SymbolTable &) const override;
@@ -2050,11 +2380,16 @@ class EvaluatePatternFilter : public memgraph::query::plan::LogicalOperator {
 
   std::shared_ptr<memgraph::query::plan::LogicalOperator> input_;
   Symbol output_symbol_;
+  /// Symbols of the outer row the pattern depends on. The pattern is
+  /// evaluated once for all the rows which agree on them; if not known, it is
+  /// evaluated for every row.
+  std::optional<std::vector<Symbol>> correlated_symbols_;
 
   std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override {
     auto object = std::make_unique<EvaluatePatternFilter>();
     object->input_ = input_ ? input_->Clone(storage) : nullptr;
     object->output_symbol_ = output_symbol_;
+    object->correlated_symbols_ = correlated_symbols_;
     return object;
   }
 
@@ -2067,8 +2402,19 @@ class EvaluatePatternFilter : public memgraph::query::plan::LogicalOperator {
     void Reset() override;
 
    private:
+    bool Evaluate(Frame &frame, ExecutionContext &context);
+
+    using ResultMap = utils::pmr::unordered_map<utils::pmr::vector<TypedValue>, bool,
+                                                utils::FnvCollection<utils::pmr::vector<TypedValue>, TypedValue,
+                                                                     TypedValue::Hash>,
+                                                TypedValueVectorEqual>;
+
     const EvaluatePatternFilter &self_;
     UniqueCursorPtr input_cursor_;
+    /// Results for the values of the correlated symbols, valid for the
+    /// transaction they were evaluated in.
+    ResultMap results_;
+    std::optional<uint64_t> results_transaction_id_;
   };
 };
 
@@ -2118,10 +2464,13 @@ class Limit : public memgraph::query::plan::LogicalOperator {
    public:
     LimitCursor(const Limit &, utils::MemoryResource *);
     bool Pull(Frame &, ExecutionContext &) override;
+    bool PullBatch(Frame &, FrameBatch &, ExecutionContext &) override;
     void Shutdown() override;
     void Reset() override;
 
    private:
+    void EvaluateLimit(Frame &, ExecutionContext &);
+
     const Limit &self_;
     UniqueCursorPtr input_cursor_;
     // init limit_ to -1, indicating
@@ -2141,6 +2490,9 @@ class Limit : public memgraph::query::plan::LogicalOperator {
 /// For each row an arbitrary number of Frame elements can be
 /// remembered. Only these elements (defined by their Symbols)
 /// are valid for usage after the OrderBy operator.
+///
+/// When followed by Skip and Limit, only the first `skip + limit`
+/// rows of the ordering are kept (top-k), in a bounded heap.
 class OrderBy : public memgraph::query::plan::LogicalOperator {
  public:
   static const utils::TypeInfo kType;
@@ -2163,6 +2515,11 @@ class OrderBy : public memgraph::query::plan::LogicalOperator {
   TypedValueVectorCompare compare_;
   std::vector<Expression *> order_by_;
   std::vector<Symbol> output_symbols_;
+  /// Constant expressions of the Skip and Limit following this operator, set
+  /// by the planner. If `limit_` is set, only the first `skip_ + limit_` rows
+  /// are kept, `skip_` is optional. The following Skip and Limit still apply.
+  Expression *skip_{nullptr};
+  Expression *limit_{nullptr};
 
   std::string ToString() const override {
     return fmt::format("OrderBy {{{}}}",
@@ -2178,6 +2535,8 @@ class OrderBy : public memgraph::query::plan::LogicalOperator {
       object->order_by_[i6] = order_by_[i6] ? order_by_[i6]->Clone(storage) : nullptr;
     }
     object->output_symbols_ = output_symbols_;
+    object->skip_ = skip_ ? skip_->Clone(storage) : nullptr;
+    object->limit_ = limit_ ? limit_->Clone(storage) : nullptr;
     return object;
   }
 };
@@ -2229,14 +2588,26 @@ class Merge : public memgraph::query::plan::LogicalOperator {
   class MergeCursor : public Cursor {
    public:
     MergeCursor(const Merge &, utils::MemoryResource *);
+    MergeCursor(const MergeCursor &) = delete;
+    MergeCursor &operator=(const MergeCursor &) = delete;
+    MergeCursor(MergeCursor &&) = delete;
+    MergeCursor &operator=(MergeCursor &&) = delete;
+    ~MergeCursor() override;
     bool Pull(Frame &, ExecutionContext &) override;
     void Shutdown() override;
     void Reset() override;
 
    private:
+    class HashLookup;
+
     const UniqueCursorPtr input_cursor_;
     const UniqueCursorPtr merge_match_cursor_;
     const UniqueCursorPtr merge_create_cursor_;
+    // Answers the match branch instead of `merge_match_cursor_` if it only
+    // looks up a labeled node by property values, null otherwise
+    std::unique_ptr<HashLookup> hash_lookup_;
+    // true if the matches of the current input row come from `hash_lookup_`
+    bool use_hash_lookup_{false};
 
     // indicates if the next Pull from this cursor
     // should perform a pull from input_cursor_
@@ -2601,7 +2972,8 @@ class LoadCsv : public memgraph::query::plan::LogicalOperator {
 
   LoadCsv() = default;
   LoadCsv(std::shared_ptr<LogicalOperator> input, Expression *file, bool with_header, bool ignore_bad,
-          Expression *delimiter, Expression *quote, Expression *nullif, Symbol row_var);
+          Expression *delimiter, Expression *quote, Expression *nullif, Symbol row_var,
+          std::optional<std::vector<std::string>> columns = std::nullopt);
   bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
   UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
   std::vector<Symbol> OutputSymbols(const SymbolTable &) const override;
@@ -2619,6 +2991,9 @@ class LoadCsv : public memgraph::query::plan::LogicalOperator {
   Expression *quote_{nullptr};
   Expression *nullif_{nullptr};
   Symbol row_var_;
+  /// Header columns the query looks up, the rows are built only from them.
+  /// All the columns are kept if not set.
+  std::optional<std::vector<std::string>> columns_;
 
   std::string ToString() const override { return fmt::format("LoadCsv {{{}}}", row_var_.name()); }
 
@@ -2632,6 +3007,7 @@ class LoadCsv : public memgraph::query::plan::LogicalOperator {
     object->quote_ = quote_ ? quote_->Clone(storage) : nullptr;
     object->nullif_ = nullif_;
     object->row_var_ = row_var_;
+    object->columns_ = columns_;
     return object;
   }
 };
@@ -2880,7 +3256,8 @@ class PeriodicSubquery : public memgraph::query::plan::LogicalOperator {
   PeriodicSubquery() = default;
 
   PeriodicSubquery(const std::shared_ptr<LogicalOperator> input, const std::shared_ptr<LogicalOperator> subquery,
-                   Expression *commit_frequency, bool subquery_has_return);
+                   Expression *commit_frequency, bool subquery_has_return, bool concurrent = false,
+                   Expression *concurrency = nullptr);
   bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
   UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
   std::vector<Symbol> ModifiedSymbols(const SymbolTable &) const override;
@@ -2893,6 +3270,11 @@ class PeriodicSubquery : public memgraph::query::plan::LogicalOperator {
   std::shared_ptr<memgraph::query::plan::LogicalOperator> subquery_;
   Expression *commit_frequency_{nullptr};
   bool subquery_has_return_;
+  /// The batches of IN CONCURRENT TRANSACTIONS run in transactions of their
+  /// own on worker threads, `concurrency_` of them at a time. The subquery
+  /// can't return rows, so the input rows are passed on as they're pulled.
+  bool concurrent_{false};
+  Expression *concurrency_{nullptr};
 
   std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override {
     auto object = std::make_unique<PeriodicSubquery>();
@@ -2900,6 +3282,55 @@ class PeriodicSubquery : public memgraph::query::plan::LogicalOperator {
     object->subquery_ = subquery_ ? subquery_->Clone(storage) : nullptr;
     object->subquery_has_return_ = subquery_has_return_;
     object->commit_frequency_ = commit_frequency_;
+    object->concurrent_ = concurrent_;
+    object->concurrency_ = concurrency_;
+    return object;
+  }
+};
+
+/// Runs its read-only input on several worker threads and merges the rows.
+///
+/// The input must be a chain of operators ending in a @c ScanAll or
+/// @c ScanAllByLabel over @c Once. The scanned vertices are split into
+/// morsels which workers claim one at a time, so uneven morsels balance out.
+/// Each worker has its own frame and cursor tree; produced rows are handed to
+/// the pulling thread in batches through a bounded queue. An @c Aggregate
+/// directly above a Gather skips the queue: workers aggregate their rows into
+/// partial tables which are merged once the scan is done. Row order is not
+/// preserved. When parallel execution isn't possible (e.g. profiling, hops
+/// limit, fine-grained access control or a storage which can't split the
+/// scan) the input is pulled directly on the calling thread.
+class Gather : public memgraph::query::plan::LogicalOperator {
+ public:
+  static const utils::TypeInfo kType;
+  const utils::TypeInfo &GetTypeInfo() const override { return kType; }
+
+  Gather() = default;
+
+  Gather(const std::shared_ptr<LogicalOperator> &input, std::optional<storage::LabelId> label, storage::View view,
+         uint64_t num_workers);
+  bool Accept(HierarchicalLogicalOperatorVisitor &visitor) override;
+  UniqueCursorPtr MakeCursor(utils::MemoryResource *) const override;
+  std::vector<Symbol> ModifiedSymbols(const SymbolTable &) const override;
+
+  bool HasSingleInput() const override { return true; }
+  std::shared_ptr<LogicalOperator> input() const override { return input_; }
+  void set_input(std::shared_ptr<LogicalOperator> input) override { input_ = input; }
+
+  std::string ToString() const override { return fmt::format("Gather ({} workers)", num_workers_); }
+
+  std::shared_ptr<memgraph::query::plan::LogicalOperator> input_;
+  /// Label of the scan at the bottom of the input, if it is a label scan.
+  std::optional<storage::LabelId> label_;
+  storage::View view_;
+  uint64_t num_workers_{1};
+
+  std::unique_ptr<LogicalOperator> Clone(AstStorage *storage) const override {
+    auto object = std::make_unique<Gather>();
+    object->input_ = input_ ? input_->Clone(storage) : nullptr;
+    object->label_ = label_;
+    object->view_ = view_;
+    object->num_workers_ = num_workers_;
     return object;
   }
 };
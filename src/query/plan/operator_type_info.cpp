@@ -50,6 +50,9 @@ constexpr utils::TypeInfo query::plan::ScanAllByLabelProperty::kType{
 constexpr utils::TypeInfo query::plan::ScanAllById::kType{utils::TypeId::SCAN_ALL_BY_ID, "ScanAllById",
                                                           &query::plan::ScanAll::kType};
 
+constexpr utils::TypeInfo query::plan::ScanAllByPointNearest::kType{
+    utils::TypeId::SCAN_ALL_BY_POINT_NEAREST, "ScanAllByPointNearest", &query::plan::ScanAll::kType};
+
 constexpr utils::TypeInfo query::plan::ScanAllByEdge::kType{utils::TypeId::SCAN_ALL_BY_EDGE, "ScanAllByEdge",
                                                             &query::plan::ScanAll::kType};
 
@@ -83,6 +86,9 @@ constexpr utils::TypeInfo query::plan::ExpansionLambda::kType{utils::TypeId::EXP
 constexpr utils::TypeInfo query::plan::ExpandVariable::kType{utils::TypeId::EXPAND_VARIABLE, "ExpandVariable",
                                                              &query::plan::LogicalOperator::kType};
 
+constexpr utils::TypeInfo query::plan::ExpandIntersection::kType{
+    utils::TypeId::EXPAND_INTERSECTION, "ExpandIntersection", &query::plan::LogicalOperator::kType};
+
 constexpr utils::TypeInfo query::plan::ConstructNamedPath::kType{
     utils::TypeId::CONSTRUCT_NAMED_PATH, "ConstructNamedPath", &query::plan::LogicalOperator::kType};
 
@@ -184,4 +190,15 @@ constexpr utils::TypeInfo query::plan::PeriodicCommit::kType{utils::TypeId::PERI
                                                              &query::plan::LogicalOperator::kType};
 constexpr utils::TypeInfo query::plan::PeriodicSubquery::kType{utils::TypeId::PERIODIC_SUBQUERY, "PeriodicSubquery",
                                                                &query::plan::LogicalOperator::kType};
+constexpr utils::TypeInfo query::plan::Gather::kType{utils::TypeId::GATHER, "Gather",
+                                                     &query::plan::LogicalOperator::kType};
+
+constexpr utils::TypeInfo query::plan::LoadProperties::kType{utils::TypeId::LOAD_PROPERTIES, "LoadProperties",
+                                                             &query::plan::LogicalOperator::kType};
+
+constexpr utils::TypeInfo query::plan::ComputeExpressions::kType{utils::TypeId::COMPUTE_EXPRESSIONS, "ComputeExpressions",
+                                                                 &query::plan::LogicalOperator::kType};
+
+constexpr utils::TypeInfo query::plan::CountVertices::kType{utils::TypeId::COUNT_VERTICES, "CountVertices",
+                                                            &query::plan::LogicalOperator::kType};
 }  // namespace memgraph
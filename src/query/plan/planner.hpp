@@ -23,15 +23,23 @@
 #include "query/plan/operator.hpp"
 #include "query/plan/preprocess.hpp"
 #include "query/plan/pretty_print.hpp"
+#include "query/plan/rewrite/common_subexpressions.hpp"
+#include "query/plan/rewrite/constant_folding.hpp"
+#include "query/plan/rewrite/count_vertices.hpp"
 #include "query/plan/rewrite/edge_index_lookup.hpp"
 #include "query/plan/rewrite/enum.hpp"
+#include "query/plan/rewrite/expand_intersection.hpp"
 #include "query/plan/rewrite/index_lookup.hpp"
 #include "query/plan/rewrite/join.hpp"
+#include "query/plan/rewrite/load_properties.hpp"
+#include "query/plan/rewrite/parallel_scan.hpp"
 #include "query/plan/rewrite/periodic_delete.hpp"
+#include "query/plan/rewrite/point_index_lookup.hpp"
 #include "query/plan/rewrite/plan_validator.hpp"
 #include "query/plan/rule_based_planner.hpp"
 #include "query/plan/variable_start_planner.hpp"
 #include "query/plan/vertex_count_cache.hpp"
+#include "utils/timer.hpp"
 
 namespace memgraph::query {
 
@@ -70,7 +78,13 @@ class PostProcessor final {
            [&](auto p) { return RewriteWithIndexLookup(std::move(p), symbol_table, ast, db, index_hints_); } |
            [&](auto p) { return RewriteWithJoinRewriter(std::move(p), symbol_table, ast, db); } |
            [&](auto p) { return RewriteWithEdgeIndexRewriter(std::move(p), symbol_table, ast, db); } |
-           [&](auto p) { return RewritePeriodicDelete(std::move(p), symbol_table, ast, db); };
+           [&](auto p) { return RewritePeriodicDelete(std::move(p), symbol_table, ast, db); } |
+           [&](auto p) { return RewriteWithPointIndexLookup(std::move(p), symbol_table, db); } |
+           [&](auto p) { return RewriteWithExpandIntersection(std::move(p)); } |
+           [&](auto p) { return RewriteWithLoadProperties(std::move(p), symbol_table, ast); } |
+           [&](auto p) { return RewriteWithCommonSubexpressions(std::move(p), symbol_table, ast); } |
+           [&](auto p) { return RewriteWithCountVertices(std::move(p), *symbol_table); } |
+           [&](auto p) { return RewriteWithParallelScan(std::move(p)); };
   }
 
   bool IsValidPlan(const std::unique_ptr<LogicalOperator> &plan) { return query::plan::ValidatePlan(*plan); }
@@ -113,6 +127,7 @@ auto MakeLogicalPlanForSingleQuery(QueryParts query_parts, PlanningContext<TDbAc
 /// the estimated cost of that plan as a `double`.
 template <class TPlanningContext, class TPlanPostProcess>
 auto MakeLogicalPlan(TPlanningContext *context, TPlanPostProcess *post_process, bool use_variable_planner) {
+  FoldConstantFunctions(context->query);
   auto query_parts = CollectQueryParts(*context->symbol_table, *context->ast_storage, context->query, false);
   auto &vertex_counts = *context->db;
   double total_cost = std::numeric_limits<double>::max();
@@ -125,7 +140,13 @@ auto MakeLogicalPlan(TPlanningContext *context, TPlanPostProcess *post_process,
   if (use_variable_planner) {
     auto plans = MakeLogicalPlanForSingleQuery<VariableStartPlanner>(query_parts, context);
     bool valid_plan_found = false;
+    const std::chrono::milliseconds planning_budget(FLAGS_query_max_planning_time_ms);
+    utils::Timer planning_timer;
     for (auto plan : plans) {
+      if (valid_plan_found && planning_budget.count() != 0 &&
+          planning_timer.Elapsed<std::chrono::milliseconds>() >= planning_budget) {
+        break;
+      }
       // Plans are generated lazily and the current plan will disappear, so
       // it's ok to move it.
       auto rewritten_plan = post_process->Rewrite(std::move(plan), context);
@@ -84,7 +84,7 @@ std::vector<Expansion> NormalizePatterns(const SymbolTable &symbol_table, const
             }
           }
           if (edge->type_ == EdgeAtom::Type::WEIGHTED_SHORTEST_PATH ||
-              edge->type_ == EdgeAtom::Type::ALL_SHORTEST_PATHS) {
+              edge->type_ == EdgeAtom::Type::ALL_SHORTEST_PATHS || edge->type_ == EdgeAtom::Type::K_SHORTEST_PATHS) {
             collector.symbols_.erase(symbol_table.at(*edge->weight_lambda_.inner_edge));
             collector.symbols_.erase(symbol_table.at(*edge->weight_lambda_.inner_node));
           }
@@ -77,6 +77,13 @@ bool PlanPrinter::PreVisit(ScanAllById &op) {
   return true;
 }
 
+bool PlanPrinter::PreVisit(query::plan::ScanAllByPointNearest &op) {
+  op.dba_ = dba_;
+  WithPrintLn([&op](auto &out) { out << "* " << op.ToString(); });
+  op.dba_ = nullptr;
+  return true;
+}
+
 bool PlanPrinter::PreVisit(query::plan::ScanAllByEdge &op) {
   op.dba_ = dba_;
   WithPrintLn([&op](auto &out) { out << "* " << op.ToString(); });
@@ -131,6 +138,13 @@ bool PlanPrinter::PreVisit(query::plan::ExpandVariable &op) {
   return true;
 }
 
+bool PlanPrinter::PreVisit(query::plan::ExpandIntersection &op) {
+  op.dba_ = dba_;
+  WithPrintLn([&op](auto &out) { out << "* " << op.ToString(); });
+  op.dba_ = nullptr;
+  return true;
+}
+
 bool PlanPrinter::PreVisit(query::plan::Produce &op) {
   WithPrintLn([&op](auto &out) { out << "* " << op.ToString(); });
   return true;
@@ -196,6 +210,26 @@ bool PlanPrinter::PreVisit(query::plan::PeriodicCommit &op) {
   return true;
 }
 
+bool PlanPrinter::PreVisit(query::plan::Gather &op) {
+  WithPrintLn([&op](auto &out) { out << "* " << op.ToString(); });
+  return true;
+}
+
+bool PlanPrinter::PreVisit(query::plan::LoadProperties &op) {
+  WithPrintLn([&op](auto &out) { out << "* " << op.ToString(); });
+  return true;
+}
+
+bool PlanPrinter::PreVisit(query::plan::ComputeExpressions &op) {
+  WithPrintLn([&op](auto &out) { out << "* " << op.ToString(); });
+  return true;
+}
+
+bool PlanPrinter::PreVisit(query::plan::CountVertices &op) {
+  WithPrintLn([&op](auto &out) { out << "* " << op.ToString(); });
+  return true;
+}
+
 bool PlanPrinter::PreVisit(query::plan::CallProcedure &op) {
   WithPrintLn([&op](auto &out) { out << "* " << op.ToString(); });
   return true;
@@ -260,7 +294,10 @@ bool PlanPrinter::PreVisit(query::plan::Apply &op) {
 }
 
 bool PlanPrinter::PreVisit(query::plan::PeriodicSubquery &op) {
-  WithPrintLn([](auto &out) { out << "* PeriodicSubquery"; });
+  WithPrintLn([&op](auto &out) {
+    out << "* PeriodicSubquery";
+    if (op.concurrent_) out << " (concurrent)";
+  });
   Branch(*op.subquery_);
   op.input_->Accept(*this);
   return false;
@@ -335,6 +372,8 @@ std::string ToString(EdgeAtom::Type type) {
       return "wsp";
     case EdgeAtom::Type::ALL_SHORTEST_PATHS:
       return "asp";
+    case EdgeAtom::Type::K_SHORTEST_PATHS:
+      return "ksp";
     case EdgeAtom::Type::SINGLE:
       return "single";
   }
@@ -496,6 +535,11 @@ bool PlanToJsonVisitor::PreVisit(ScanAllByLabelPropertyValue &op) {
   self["label"] = ToJson(op.label_, *dba_);
   self["property"] = ToJson(op.property_, *dba_);
   self["expression"] = ToJson(op.expression_, *dba_);
+  if (!op.composite_properties_.empty()) {
+    self["composite_properties"] = ToJson(op.composite_properties_, *dba_);
+    self["composite_expressions"] = ToJson(op.composite_expressions_, *dba_);
+    self["covering"] = op.covering_;
+  }
   self["output_symbol"] = ToJson(op.output_symbol_);
 
   op.input_->Accept(*this);
@@ -529,6 +573,23 @@ bool PlanToJsonVisitor::PreVisit(ScanAllById &op) {
   return false;
 }
 
+bool PlanToJsonVisitor::PreVisit(ScanAllByPointNearest &op) {
+  json self;
+  self["name"] = "ScanAllByPointNearest";
+  self["label"] = ToJson(op.label_, *dba_);
+  self["property"] = ToJson(op.property_, *dba_);
+  self["point_expression"] = ToJson(op.point_expression_, *dba_);
+  self["limit_expression"] = ToJson(op.limit_expression_, *dba_);
+  self["skip_expression"] = op.skip_expression_ ? ToJson(op.skip_expression_, *dba_) : json();
+  self["output_symbol"] = ToJson(op.output_symbol_);
+
+  op.input_->Accept(*this);
+  self["input"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
 bool PlanToJsonVisitor::PreVisit(ScanAllByEdge &op) {
   json self;
   self["name"] = "ScanAllByEdge";
@@ -645,6 +706,9 @@ bool PlanToJsonVisitor::PreVisit(Expand &op) {
   self["edge_types"] = ToJson(op.common_.edge_types, *dba_);
   self["direction"] = ToString(op.common_.direction);
   self["existing_node"] = op.common_.existing_node;
+  if (op.edge_type_index_lookup_) {
+    self["edge_type_index_lookup"] = true;
+  }
 
   op.input_->Accept(*this);
   self["input"] = PopOutput();
@@ -669,10 +733,34 @@ bool PlanToJsonVisitor::PreVisit(ExpandVariable &op) {
 
   self["filter_lambda"] = op.filter_lambda_.expression ? ToJson(op.filter_lambda_.expression, *dba_) : json();
 
-  if (op.type_ == EdgeAtom::Type::WEIGHTED_SHORTEST_PATH || op.type_ == EdgeAtom::Type::ALL_SHORTEST_PATHS) {
+  if (op.type_ == EdgeAtom::Type::WEIGHTED_SHORTEST_PATH || op.type_ == EdgeAtom::Type::ALL_SHORTEST_PATHS ||
+      op.type_ == EdgeAtom::Type::K_SHORTEST_PATHS) {
     self["weight_lambda"] = ToJson(op.weight_lambda_->expression, *dba_);
     self["total_weight_symbol"] = ToJson(*op.total_weight_);
   }
+  if (op.heuristic_lambda_) {
+    self["heuristic_lambda"] = ToJson(op.heuristic_lambda_->expression, *dba_);
+  }
+
+  op.input_->Accept(*this);
+  self["input"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
+bool PlanToJsonVisitor::PreVisit(ExpandIntersection &op) {
+  json self;
+  self["name"] = "ExpandIntersection";
+  self["node_symbol"] = ToJson(op.node_symbol_);
+  for (const auto &leg : op.legs_) {
+    json json;
+    json["input_symbol"] = ToJson(leg.input_symbol);
+    json["edge_symbol"] = ToJson(leg.edge_symbol);
+    json["edge_types"] = ToJson(leg.edge_types, *dba_);
+    json["direction"] = ToString(leg.direction);
+    self["legs"].push_back(json);
+  }
 
   op.input_->Accept(*this);
   self["input"] = PopOutput();
@@ -898,6 +986,10 @@ bool PlanToJsonVisitor::PreVisit(OrderBy &op) {
     self["order_by"].push_back(json);
   }
   self["output_symbols"] = ToJson(op.output_symbols_);
+  if (op.limit_) {
+    self["skip"] = op.skip_ ? ToJson(op.skip_, *dba_) : json();
+    self["limit"] = ToJson(op.limit_, *dba_);
+  }
 
   op.input_->Accept(*this);
   self["input"] = PopOutput();
@@ -996,6 +1088,10 @@ bool PlanToJsonVisitor::PreVisit(query::plan::LoadCsv &op) {
 
   self["row_variable"] = ToJson(op.row_var_);
 
+  if (op.columns_) {
+    self["columns"] = *op.columns_;
+  }
+
   op.input_->Accept(*this);
   self["input"] = PopOutput();
 
@@ -1144,9 +1240,71 @@ bool PlanToJsonVisitor::PreVisit(PeriodicCommit &op) {
   return false;
 }
 
+bool PlanToJsonVisitor::PreVisit(Gather &op) {
+  json self;
+  self["name"] = "Gather";
+  self["num_workers"] = op.num_workers_;
+
+  op.input_->Accept(*this);
+  self["input"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
+bool PlanToJsonVisitor::PreVisit(LoadProperties &op) {
+  json self;
+  self["name"] = "LoadProperties";
+  json entries = json::array();
+  for (const auto &entry : op.entries_) {
+    json properties = json::array();
+    for (const auto *lookup : entry.lookups) {
+      properties.push_back(lookup->property_.name);
+    }
+    entries.push_back({{"symbol", ToJson(entry.symbol)}, {"properties", std::move(properties)}});
+  }
+  self["entries"] = std::move(entries);
+
+  op.input_->Accept(*this);
+  self["input"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
+bool PlanToJsonVisitor::PreVisit(ComputeExpressions &op) {
+  json self;
+  self["name"] = "ComputeExpressions";
+  json expressions = json::array();
+  for (size_t i = 0; i < op.expressions_.size(); ++i) {
+    expressions.push_back(
+        {{"symbol", ToJson(op.output_symbols_[i])}, {"expression", ToJson(op.expressions_[i], *dba_)}});
+  }
+  self["expressions"] = std::move(expressions);
+
+  op.input_->Accept(*this);
+  self["input"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
+bool PlanToJsonVisitor::PreVisit(CountVertices &op) {
+  json self;
+  self["name"] = "CountVertices";
+  self["output_symbol"] = ToJson(op.output_symbol_);
+
+  op.input_->Accept(*this);
+  self["input"] = PopOutput();
+
+  output_ = std::move(self);
+  return false;
+}
+
 bool PlanToJsonVisitor::PreVisit(PeriodicSubquery &op) {
   json self;
   self["name"] = "PeriodicSubquery";
+  self["concurrent"] = op.concurrent_;
 
   op.input_->Accept(*this);
   self["input"] = PopOutput();
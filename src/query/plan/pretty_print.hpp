@@ -67,6 +67,7 @@ class PlanPrinter : public virtual HierarchicalLogicalOperatorVisitor {
   bool PreVisit(ScanAllByLabelPropertyRange &) override;
   bool PreVisit(ScanAllByLabelProperty &) override;
   bool PreVisit(ScanAllById &) override;
+  bool PreVisit(ScanAllByPointNearest &) override;
   bool PreVisit(ScanAllByEdge &) override;
   bool PreVisit(ScanAllByEdgeType &) override;
   bool PreVisit(ScanAllByEdgeTypeProperty &) override;
@@ -76,6 +77,7 @@ class PlanPrinter : public virtual HierarchicalLogicalOperatorVisitor {
 
   bool PreVisit(Expand &) override;
   bool PreVisit(ExpandVariable &) override;
+  bool PreVisit(ExpandIntersection &) override;
 
   bool PreVisit(ConstructNamedPath &) override;
 
@@ -100,6 +102,10 @@ class PlanPrinter : public virtual HierarchicalLogicalOperatorVisitor {
   bool PreVisit(RollUpApply &) override;
   bool PreVisit(PeriodicCommit &) override;
   bool PreVisit(PeriodicSubquery &) override;
+  bool PreVisit(Gather &) override;
+  bool PreVisit(LoadProperties &) override;
+  bool PreVisit(ComputeExpressions &) override;
+  bool PreVisit(CountVertices &) override;
 
   bool PreVisit(Unwind &) override;
   bool PreVisit(CallProcedure &) override;
@@ -192,6 +198,7 @@ class PlanToJsonVisitor : public virtual HierarchicalLogicalOperatorVisitor {
 
   bool PreVisit(Expand &) override;
   bool PreVisit(ExpandVariable &) override;
+  bool PreVisit(ExpandIntersection &) override;
 
   bool PreVisit(ConstructNamedPath &) override;
 
@@ -212,6 +219,7 @@ class PlanToJsonVisitor : public virtual HierarchicalLogicalOperatorVisitor {
   bool PreVisit(ScanAllByLabelPropertyValue &) override;
   bool PreVisit(ScanAllByLabelPropertyRange &) override;
   bool PreVisit(ScanAllById &) override;
+  bool PreVisit(ScanAllByPointNearest &) override;
 
   bool PreVisit(ScanAllByEdge &) override;
   bool PreVisit(ScanAllByEdgeType &) override;
@@ -237,6 +245,10 @@ class PlanToJsonVisitor : public virtual HierarchicalLogicalOperatorVisitor {
   bool PreVisit(RollUpApply &) override;
   bool PreVisit(PeriodicCommit &) override;
   bool PreVisit(PeriodicSubquery &) override;
+  bool PreVisit(Gather &) override;
+  bool PreVisit(LoadProperties &) override;
+  bool PreVisit(ComputeExpressions &) override;
+  bool PreVisit(CountVertices &) override;
 
   bool Visit(Once &) override;
 
@@ -13,12 +13,16 @@
 
 #include <algorithm>
 #include <chrono>
+#include <functional>
+#include <iterator>
+#include <numeric>
 
 #include <fmt/format.h>
 #include <json/json.hpp>
 
 #include "query/context.hpp"
 #include "utils/likely.hpp"
+#include "utils/string.hpp"
 
 namespace memgraph::query::plan {
 
@@ -30,6 +34,14 @@ unsigned long long IndividualCycles(const ProfilingStats &cumulative_stats) {
                                                        [](auto acc, auto &stats) { return acc + stats.num_cycles; });
 }
 
+utils::PerfCounterValues IndividualPerfCounters(const ProfilingStats &cumulative_stats) {
+  auto counters = cumulative_stats.perf_counters;
+  for (const auto &child : cumulative_stats.children) {
+    counters = counters - child.perf_counters;
+  }
+  return counters;
+}
+
 double RelativeTime(unsigned long long num_cycles, unsigned long long total_cycles) {
   return static_cast<double>(num_cycles) / total_cycles;
 }
@@ -50,15 +62,23 @@ namespace {
 
 class ProfilingStatsToTableHelper {
  public:
-  ProfilingStatsToTableHelper(unsigned long long total_cycles, std::chrono::duration<double> total_time)
-      : total_cycles_(total_cycles), total_time_(total_time) {}
+  ProfilingStatsToTableHelper(unsigned long long total_cycles, std::chrono::duration<double> total_time,
+                              std::optional<std::bitset<utils::kPerfEventCount>> counted_perf_events)
+      : total_cycles_(total_cycles), total_time_(total_time), counted_perf_events_(counted_perf_events) {}
 
   void Output(const ProfilingStats &cumulative_stats) {
     auto cycles = IndividualCycles(cumulative_stats);
 
-    rows_.emplace_back(std::vector<TypedValue>{
+    auto &row = rows_.emplace_back(std::vector<TypedValue>{
         TypedValue(FormatOperator(cumulative_stats.name.c_str())), TypedValue(cumulative_stats.actual_hits),
         TypedValue(FormatRelativeTime(cycles)), TypedValue(FormatAbsoluteTime(cycles))});
+    if (counted_perf_events_) {
+      const auto counters = IndividualPerfCounters(cumulative_stats);
+      for (size_t i = 0; i < utils::kPerfEventCount; ++i) {
+        row.emplace_back(counted_perf_events_->test(i) ? TypedValue(static_cast<int64_t>(counters.counts[i]))
+                                                       : TypedValue());
+      }
+    }
 
     for (size_t i = 1; i < cumulative_stats.children.size(); ++i) {
       Branch(cumulative_stats.children[i]);
@@ -73,7 +93,9 @@ class ProfilingStatsToTableHelper {
 
  private:
   void Branch(const ProfilingStats &cumulative_stats) {
-    rows_.emplace_back(std::vector<TypedValue>{TypedValue("|\\"), TypedValue(""), TypedValue(""), TypedValue("")});
+    auto &row = rows_.emplace_back(
+        std::vector<TypedValue>{TypedValue("|\\"), TypedValue(""), TypedValue(""), TypedValue("")});
+    if (counted_perf_events_) row.resize(row.size() + utils::kPerfEventCount, TypedValue(""));
 
     ++depth_;
     Output(cumulative_stats);
@@ -105,12 +127,25 @@ class ProfilingStatsToTableHelper {
   std::vector<std::vector<TypedValue>> rows_;
   unsigned long long total_cycles_;
   std::chrono::duration<double> total_time_;
+  std::optional<std::bitset<utils::kPerfEventCount>> counted_perf_events_;
 };
 
 }  // namespace
 
+std::vector<std::string> ProfilingStatsColumns(bool with_perf_counters) {
+  std::vector<std::string> columns{"OPERATOR", "ACTUAL HITS", "RELATIVE TIME", "ABSOLUTE TIME"};
+  if (with_perf_counters) {
+    for (size_t i = 0; i < utils::kPerfEventCount; ++i) {
+      auto column = utils::ToUpperCase(utils::PerfEventName(static_cast<utils::PerfEvent>(i)));
+      std::replace(column.begin(), column.end(), '_', ' ');
+      columns.emplace_back(std::move(column));
+    }
+  }
+  return columns;
+}
+
 std::vector<std::vector<TypedValue>> ProfilingStatsToTable(const ProfilingStatsWithTotalTime &stats) {
-  ProfilingStatsToTableHelper helper{stats.cumulative_stats.num_cycles, stats.total_time};
+  ProfilingStatsToTableHelper helper{stats.cumulative_stats.num_cycles, stats.total_time, stats.counted_perf_events};
   helper.Output(stats.cumulative_stats);
   return helper.rows();
 }
@@ -126,8 +161,9 @@ class ProfilingStatsToJsonHelper {
   using json = nlohmann::json;
 
  public:
-  ProfilingStatsToJsonHelper(unsigned long long total_cycles, std::chrono::duration<double> total_time)
-      : total_cycles_(total_cycles), total_time_(total_time) {}
+  ProfilingStatsToJsonHelper(unsigned long long total_cycles, std::chrono::duration<double> total_time,
+                             std::optional<std::bitset<utils::kPerfEventCount>> counted_perf_events)
+      : total_cycles_(total_cycles), total_time_(total_time), counted_perf_events_(counted_perf_events) {}
 
   void Output(const ProfilingStats &cumulative_stats) { return Output(cumulative_stats, &json_); }
 
@@ -141,6 +177,17 @@ class ProfilingStatsToJsonHelper {
     obj->emplace("actual_hits", cumulative_stats.actual_hits);
     obj->emplace("relative_time", RelativeTime(cycles, total_cycles_));
     obj->emplace("absolute_time", AbsoluteTime(cycles, total_cycles_, total_time_));
+    if (counted_perf_events_) {
+      const auto counters = IndividualPerfCounters(cumulative_stats);
+      auto perf_counters = json::object();
+      for (size_t i = 0; i < utils::kPerfEventCount; ++i) {
+        if (counted_perf_events_->test(i)) {
+          const auto name = utils::PerfEventName(static_cast<utils::PerfEvent>(i));
+          perf_counters.emplace(std::string(name), counters.counts[i]);
+        }
+      }
+      obj->emplace("perf_counters", std::move(perf_counters));
+    }
     obj->emplace("children", json::array());
 
     for (size_t i = 0; i < cumulative_stats.children.size(); ++i) {
@@ -153,14 +200,122 @@ class ProfilingStatsToJsonHelper {
   json json_;
   unsigned long long total_cycles_;
   std::chrono::duration<double> total_time_;
+  std::optional<std::bitset<utils::kPerfEventCount>> counted_perf_events_;
 };
 
 }  // namespace
 
 nlohmann::json ProfilingStatsToJson(const ProfilingStatsWithTotalTime &stats) {
-  ProfilingStatsToJsonHelper helper{stats.cumulative_stats.num_cycles, stats.total_time};
+  ProfilingStatsToJsonHelper helper{stats.cumulative_stats.num_cycles, stats.total_time, stats.counted_perf_events};
   helper.Output(stats.cumulative_stats);
   return helper.ToJson();
 }
 
+//////////////////////////////////////////////////////////////////////////////
+//
+// ProfileSampler
+
+namespace {
+
+void MergeSampledStats(SampledProfilingStats *into, const ProfilingStats &stats, unsigned long long total_cycles,
+                       std::chrono::duration<double> total_time) {
+  into->key = stats.key;
+  if (into->name.empty()) into->name = stats.name;
+  into->actual_hits += stats.actual_hits;
+  if (total_cycles != 0) into->absolute_time_ms += AbsoluteTime(IndividualCycles(stats), total_cycles, total_time);
+
+  for (const auto &child : stats.children) {
+    auto it = std::find_if(into->children.begin(), into->children.end(),
+                           [key = child.key](const auto &sampled) { return sampled.key == key; });
+    if (it == into->children.end()) {
+      into->children.emplace_back();
+      it = std::prev(into->children.end());
+    }
+    MergeSampledStats(&*it, child, total_cycles, total_time);
+  }
+}
+
+void SampledStatsToRows(const SampledPlanProfile &profile, const SampledProfilingStats &stats, int64_t depth,
+                        std::vector<std::vector<TypedValue>> *rows) {
+  std::string name;
+  for (int64_t i = 0; i < depth; ++i) name += "| ";
+  name += "* " + stats.name;
+  rows->emplace_back(std::vector<TypedValue>{
+      TypedValue(std::to_string(profile.plan_hash)), TypedValue(profile.query),
+      TypedValue(static_cast<int64_t>(profile.samples)), TypedValue(std::move(name)), TypedValue(stats.actual_hits),
+      TypedValue(fmt::format("{: 10.6f} ms", stats.absolute_time_ms))});
+  // The first child is the input of the operator, the others are its branches
+  for (size_t i = 1; i < stats.children.size(); ++i) {
+    SampledStatsToRows(profile, stats.children[i], depth + 1, rows);
+  }
+  if (!stats.children.empty()) SampledStatsToRows(profile, stats.children[0], depth, rows);
+}
+
+nlohmann::json SampledStatsToJson(const SampledProfilingStats &stats) {
+  auto obj = nlohmann::json::object();
+  obj.emplace("name", stats.name);
+  obj.emplace("actual_hits", stats.actual_hits);
+  obj.emplace("absolute_time", stats.absolute_time_ms);
+  auto children = nlohmann::json::array();
+  for (const auto &child : stats.children) children.emplace_back(SampledStatsToJson(child));
+  obj.emplace("children", std::move(children));
+  return obj;
+}
+
+}  // namespace
+
+void ProfileSampler::Record(uint64_t plan_hash, std::string_view query, const ProfilingStatsWithTotalTime &stats) {
+  auto guard = std::lock_guard{mutex_};
+  auto it = profiles_.find(plan_hash);
+  if (it == profiles_.end()) {
+    if (profiles_.size() >= kMaxPlans) return;
+    it = profiles_.emplace(plan_hash, SampledPlanProfile{.plan_hash = plan_hash, .query = std::string(query)}).first;
+  }
+  auto &profile = it->second;
+  ++profile.samples;
+  profile.total_time_ms += std::chrono::duration<double, std::milli>(stats.total_time).count();
+  MergeSampledStats(&profile.cumulative_stats, stats.cumulative_stats, stats.cumulative_stats.num_cycles,
+                    stats.total_time);
+}
+
+std::vector<SampledPlanProfile> ProfileSampler::Profiles() const {
+  std::vector<SampledPlanProfile> profiles;
+  {
+    auto guard = std::lock_guard{mutex_};
+    profiles.reserve(profiles_.size());
+    for (const auto &[_, profile] : profiles_) profiles.push_back(profile);
+  }
+  std::ranges::sort(profiles, std::greater{}, &SampledPlanProfile::total_time_ms);
+  return profiles;
+}
+
+void ProfileSampler::Clear() {
+  auto guard = std::lock_guard{mutex_};
+  profiles_.clear();
+}
+
+ProfileSampler &GlobalProfileSampler() {
+  static ProfileSampler sampler;
+  return sampler;
+}
+
+std::vector<std::vector<TypedValue>> SampledProfilesToTable(const std::vector<SampledPlanProfile> &profiles) {
+  std::vector<std::vector<TypedValue>> rows;
+  for (const auto &profile : profiles) {
+    SampledStatsToRows(profile, profile.cumulative_stats, 0, &rows);
+  }
+  return rows;
+}
+
+nlohmann::json SampledProfilesToJson(const std::vector<SampledPlanProfile> &profiles) {
+  auto json = nlohmann::json::object();
+  for (const auto &profile : profiles) {
+    json[std::to_string(profile.plan_hash)] = {{"query", profile.query},
+                                               {"samples", profile.samples},
+                                               {"total_time", profile.total_time_ms},
+                                               {"operators", SampledStatsToJson(profile.cumulative_stats)}};
+  }
+  return json;
+}
+
 }  // namespace memgraph::query::plan
@@ -11,12 +11,21 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <bitset>
 #include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include <json/json.hpp>
 
 #include "query/typed_value.hpp"
+#include "utils/perf_counters.hpp"
 
 namespace memgraph::query::plan {
 
@@ -30,15 +39,84 @@ struct ProfilingStats {
   std::string name;
   // TODO: This should use the allocator for query execution
   std::vector<ProfilingStats> children;
+  // Including the events of the children, like num_cycles
+  utils::PerfCounterValues perf_counters{};
 };
 
 struct ProfilingStatsWithTotalTime {
   ProfilingStats cumulative_stats{};
   std::chrono::duration<double> total_time{};
+  // The events which were counted if the perf counters were requested
+  std::optional<std::bitset<utils::kPerfEventCount>> counted_perf_events{};
 };
 
+/// Columns of the table made by `ProfilingStatsToTable`, with a column for
+/// each perf event if @p with_perf_counters.
+std::vector<std::string> ProfilingStatsColumns(bool with_perf_counters);
+
+/// The perf events which weren't counted are null.
 std::vector<std::vector<TypedValue>> ProfilingStatsToTable(const ProfilingStatsWithTotalTime &stats);
 
 nlohmann::json ProfilingStatsToJson(const ProfilingStatsWithTotalTime &stats);
 
+/**
+ * Profiling statistics of a single logical operator summed over the sampled
+ * executions of a plan. The time excludes the time of the children.
+ */
+struct SampledProfilingStats {
+  int64_t actual_hits{0};
+  double absolute_time_ms{0};
+  uint64_t key{0};
+  std::string name;
+  std::vector<SampledProfilingStats> children;
+};
+
+struct SampledPlanProfile {
+  uint64_t plan_hash{0};
+  std::string query;
+  uint64_t samples{0};
+  double total_time_ms{0};
+  SampledProfilingStats cumulative_stats;
+};
+
+/**
+ * Profiles 1 in N executions of each plan and sums their statistics, so the
+ * hot operators can be seen without running `PROFILE`. The plans are
+ * identified by the hash of their stripped query.
+ */
+class ProfileSampler {
+ public:
+  static constexpr size_t kMaxPlans = 1000;
+
+  /// Returns true for 1 in @p sample_rate executions of the plan, never if
+  /// the rate is 0.
+  bool ShouldSample(uint64_t plan_hash, uint64_t sample_rate) {
+    if (sample_rate == 0) return false;
+    auto &executions = executions_[plan_hash % executions_.size()];
+    return executions.fetch_add(1, std::memory_order_relaxed) % sample_rate == 0;
+  }
+
+  /// Adds the statistics of a sampled execution. Plans beyond `kMaxPlans`
+  /// aren't recorded.
+  void Record(uint64_t plan_hash, std::string_view query, const ProfilingStatsWithTotalTime &stats);
+
+  std::vector<SampledPlanProfile> Profiles() const;
+
+  void Clear();
+
+ private:
+  // Executions by the plan hash, plans whose hashes collide share the counter
+  std::array<std::atomic<uint64_t>, 4096> executions_{};
+  mutable std::mutex mutex_;
+  std::unordered_map<uint64_t, SampledPlanProfile> profiles_;
+};
+
+ProfileSampler &GlobalProfileSampler();
+
+/// Rows of `SHOW PROFILE INFO`, the operators of each plan in the order of
+/// `PROFILE`.
+std::vector<std::vector<TypedValue>> SampledProfilesToTable(const std::vector<SampledPlanProfile> &profiles);
+
+nlohmann::json SampledProfilesToJson(const std::vector<SampledPlanProfile> &profiles);
+
 }  // namespace memgraph::query::plan
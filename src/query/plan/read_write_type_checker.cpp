@@ -37,6 +37,7 @@ PRE_VISIT(ScanAllByLabelProperty, RWType::R, true)
 PRE_VISIT(ScanAllByLabelPropertyValue, RWType::R, true)
 PRE_VISIT(ScanAllByLabelPropertyRange, RWType::R, true)
 PRE_VISIT(ScanAllById, RWType::R, true)
+PRE_VISIT(ScanAllByPointNearest, RWType::R, true)
 
 PRE_VISIT(ScanAllByEdge, RWType::R, true)
 PRE_VISIT(ScanAllByEdgeType, RWType::R, true)
@@ -47,6 +48,7 @@ PRE_VISIT(ScanAllByEdgeId, RWType::R, true)
 
 PRE_VISIT(Expand, RWType::R, true)
 PRE_VISIT(ExpandVariable, RWType::R, true)
+PRE_VISIT(ExpandIntersection, RWType::R, true)
 
 PRE_VISIT(ConstructNamedPath, RWType::R, true)
 
@@ -71,6 +73,10 @@ PRE_VISIT(Limit, RWType::NONE, true)
 PRE_VISIT(OrderBy, RWType::NONE, true)
 PRE_VISIT(Distinct, RWType::NONE, true)
 PRE_VISIT(PeriodicCommit, RWType::NONE, true)
+PRE_VISIT(Gather, RWType::NONE, true)
+PRE_VISIT(LoadProperties, RWType::R, true)
+PRE_VISIT(ComputeExpressions, RWType::R, true)
+PRE_VISIT(CountVertices, RWType::NONE, true)
 
 bool ReadWriteTypeChecker::PreVisit(Union &op) {
   op.left_op_->Accept(*this);
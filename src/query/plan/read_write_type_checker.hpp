@@ -60,6 +60,7 @@ struct ReadWriteTypeChecker : public virtual HierarchicalLogicalOperatorVisitor
   bool PreVisit(ScanAllByLabelPropertyValue &) override;
   bool PreVisit(ScanAllByLabelPropertyRange &) override;
   bool PreVisit(ScanAllById &) override;
+  bool PreVisit(ScanAllByPointNearest &) override;
 
   bool PreVisit(ScanAllByEdge &) override;
   bool PreVisit(ScanAllByEdgeType &) override;
@@ -70,6 +71,7 @@ struct ReadWriteTypeChecker : public virtual HierarchicalLogicalOperatorVisitor
 
   bool PreVisit(Expand &) override;
   bool PreVisit(ExpandVariable &) override;
+  bool PreVisit(ExpandIntersection &) override;
 
   bool PreVisit(ConstructNamedPath &) override;
 
@@ -100,6 +102,10 @@ struct ReadWriteTypeChecker : public virtual HierarchicalLogicalOperatorVisitor
   bool PreVisit(RollUpApply &) override;
   bool PreVisit(PeriodicSubquery &) override;
   bool PreVisit(PeriodicCommit &) override;
+  bool PreVisit(Gather &) override;
+  bool PreVisit(LoadProperties &) override;
+  bool PreVisit(ComputeExpressions &) override;
+  bool PreVisit(CountVertices &) override;
 
   bool Visit(Once &) override;
 
@@ -0,0 +1,297 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#include "query/plan/rewrite/common_subexpressions.hpp"
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <optional>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "query/plan/read_write_type_checker.hpp"
+#include "utils/string.hpp"
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(query_common_subexpressions, false,
+            "Compute the deterministic expressions which occur more than once in the filters, the projection and the "
+            "ordering of a read-only query once for every row.");
+
+namespace memgraph::query::plan {
+
+namespace {
+
+/// Built-in functions whose result may differ between two calls with the
+/// same arguments, or which are called for their effect.
+constexpr std::array<std::string_view, 10> kNonDeterministicFunctions{
+    "RAND",   "RANDOMUUID", "TIMESTAMP", "UNIFORMSAMPLE", "COUNTER",
+    "ASSERT", "DATE",       "LOCALTIME", "LOCALDATETIME", "DATETIME"};
+
+/// Operators above the pipeline which feeds the projection.
+bool IsPassThroughOperator(const LogicalOperator &op) {
+  const auto &type = op.GetTypeInfo();
+  return type == Produce::kType || type == Aggregate::kType || type == OrderBy::kType || type == Skip::kType ||
+         type == Limit::kType || type == Distinct::kType || type == EmptyResult::kType;
+}
+
+/// Operators of the pipeline which feeds the projection, up to its scan.
+bool IsPipelineOperator(const LogicalOperator &op) {
+  const auto &type = op.GetTypeInfo();
+  if (type == Filter::kType) return static_cast<const Filter &>(op).pattern_filters_.empty();
+  return type == EdgeUniquenessFilter::kType || type == Expand::kType || type == ExpandIntersection::kType ||
+         type == LoadProperties::kType || type == ComputeExpressions::kType;
+}
+
+bool IsLeaf(const Expression &expression) {
+  const auto &type = expression.GetTypeInfo();
+  return type == Identifier::kType || type == PrimitiveLiteral::kType || type == ParameterLookup::kType;
+}
+
+/// Operators which always evaluate all of their operands.
+bool IsStrictOperator(const utils::TypeInfo &type) {
+  return type == XorOperator::kType || type == AdditionOperator::kType || type == SubtractionOperator::kType ||
+         type == MultiplicationOperator::kType || type == DivisionOperator::kType || type == ModOperator::kType ||
+         type == NotEqualOperator::kType || type == EqualOperator::kType || type == LessOperator::kType ||
+         type == GreaterOperator::kType || type == LessEqualOperator::kType || type == GreaterEqualOperator::kType;
+}
+
+bool IsStrictUnaryOperator(const utils::TypeInfo &type) {
+  return type == NotOperator::kType || type == UnaryPlusOperator::kType || type == UnaryMinusOperator::kType ||
+         type == IsNullOperator::kType;
+}
+
+bool IsDeterministicFunction(const Function &function) {
+  return function.IsBuiltin() &&
+         std::ranges::find(kNonDeterministicFunctions, utils::ToUpperCase(function.function_name_)) ==
+             kNonDeterministicFunctions.end();
+}
+
+struct Operand {
+  Expression **expression;
+  /// Whether the operand is evaluated whenever its parent is.
+  bool always_evaluated;
+};
+
+/// Appends the operands of @p expression to @p operands. Returns false if
+/// the rewriter doesn't look into expressions of its type.
+bool CollectOperands(Expression &expression, std::vector<Operand> *operands) {
+  const auto &type = expression.GetTypeInfo();
+  if (type == AndOperator::kType || type == OrOperator::kType) {
+    auto &binary = static_cast<BinaryOperator &>(expression);
+    operands->push_back({&binary.expression1_, true});
+    operands->push_back({&binary.expression2_, false});
+    return true;
+  }
+  if (IsStrictOperator(type)) {
+    auto &binary = static_cast<BinaryOperator &>(expression);
+    operands->push_back({&binary.expression1_, true});
+    operands->push_back({&binary.expression2_, true});
+    return true;
+  }
+  if (IsStrictUnaryOperator(type)) {
+    operands->push_back({&static_cast<UnaryOperator &>(expression).expression_, true});
+    return true;
+  }
+  if (type == PropertyLookup::kType) {
+    operands->push_back({&static_cast<PropertyLookup &>(expression).expression_, true});
+    return true;
+  }
+  if (type == Function::kType) {
+    auto &function = static_cast<Function &>(expression);
+    if (!IsDeterministicFunction(function)) return false;
+    for (auto *&argument : function.arguments_) {
+      operands->push_back({&argument, true});
+    }
+    return true;
+  }
+  return false;
+}
+
+/// Returns true if @p lhs and @p rhs evaluate to the same value on every row.
+bool Equal(Expression &lhs, Expression &rhs) {
+  const auto &type = lhs.GetTypeInfo();
+  if (type != rhs.GetTypeInfo()) return false;
+  if (type == Identifier::kType) {
+    return static_cast<Identifier &>(lhs).symbol_pos_ == static_cast<Identifier &>(rhs).symbol_pos_;
+  }
+  if (type == PrimitiveLiteral::kType) {
+    const auto &lhs_value = static_cast<PrimitiveLiteral &>(lhs).value_;
+    const auto &rhs_value = static_cast<PrimitiveLiteral &>(rhs).value_;
+    // Integers compare equal to doubles, but don't evaluate the same.
+    return lhs_value.type() == rhs_value.type() && lhs_value == rhs_value;
+  }
+  if (type == ParameterLookup::kType) {
+    return static_cast<ParameterLookup &>(lhs).token_position_ == static_cast<ParameterLookup &>(rhs).token_position_;
+  }
+  if (type == PropertyLookup::kType &&
+      static_cast<PropertyLookup &>(lhs).property_.name != static_cast<PropertyLookup &>(rhs).property_.name) {
+    return false;
+  }
+  if (type == Function::kType && utils::ToUpperCase(static_cast<Function &>(lhs).function_name_) !=
+                                     utils::ToUpperCase(static_cast<Function &>(rhs).function_name_)) {
+    return false;
+  }
+  std::vector<Operand> lhs_operands;
+  std::vector<Operand> rhs_operands;
+  if (!CollectOperands(lhs, &lhs_operands) || !CollectOperands(rhs, &rhs_operands)) return false;
+  if (lhs_operands.size() != rhs_operands.size()) return false;
+  for (size_t i = 0; i < lhs_operands.size(); ++i) {
+    if (!Equal(**lhs_operands[i].expression, **rhs_operands[i].expression)) return false;
+  }
+  return true;
+}
+
+/// An expression in an operator of the pipeline which can be computed in
+/// advance.
+struct Occurrence {
+  /// Where the operator refers to the expression.
+  Expression **reference;
+  Expression *expression;
+  /// Index of the consumer evaluating it.
+  size_t consumer;
+  /// Whether the consumer evaluates it on every row.
+  bool always_evaluated;
+  /// Number of the nodes in the tree of the expression.
+  size_t size;
+};
+
+/// Appends the occurrences of the computable expressions in the tree which
+/// @p reference refers to. Returns the number of the nodes in the tree if all
+/// of it is computable, 0 otherwise.
+size_t CollectOccurrences(Expression **reference, size_t consumer, bool always_evaluated,
+                          std::vector<Occurrence> *occurrences) {
+  auto *expression = *reference;
+  if (IsLeaf(*expression)) return 1;
+  std::vector<Operand> operands;
+  if (!CollectOperands(*expression, &operands)) return 0;
+  size_t size = 1;
+  bool computable = true;
+  for (const auto &operand : operands) {
+    const auto operand_size = CollectOccurrences(operand.expression, consumer,
+                                                 always_evaluated && operand.always_evaluated, occurrences);
+    computable = computable && operand_size > 0;
+    size += operand_size;
+  }
+  if (!computable) return 0;
+  // Repeated property lookups are left to LoadProperties.
+  if (expression->GetTypeInfo() != PropertyLookup::kType) {
+    occurrences->push_back(Occurrence{.reference = reference,
+                                      .expression = expression,
+                                      .consumer = consumer,
+                                      .always_evaluated = always_evaluated,
+                                      .size = size});
+  }
+  return size;
+}
+
+void CollectNodes(Expression *expression, std::unordered_set<const Expression *> *nodes) {
+  nodes->insert(expression);
+  std::vector<Operand> operands;
+  CollectOperands(*expression, &operands);
+  for (const auto &operand : operands) {
+    CollectNodes(*operand.expression, nodes);
+  }
+}
+
+struct ComputedExpressions {
+  std::vector<Expression *> expressions;
+  std::vector<Symbol> output_symbols;
+};
+
+}  // namespace
+
+std::unique_ptr<LogicalOperator> RewriteWithCommonSubexpressions(std::unique_ptr<LogicalOperator> root_op,
+                                                                 SymbolTable *symbol_table, AstStorage *ast_storage) {
+  if (!FLAGS_query_common_subexpressions) return root_op;
+
+  ReadWriteTypeChecker read_write_type_checker;
+  read_write_type_checker.InferRWType(*root_op);
+  if (read_write_type_checker.type != ReadWriteTypeChecker::RWType::R) return root_op;
+
+  OrderBy *order_by = nullptr;
+  Produce *produce = nullptr;
+  LogicalOperator *above = nullptr;
+  for (auto *op = root_op.get(); IsPassThroughOperator(*op); above = op, op = op->input().get()) {
+    if (op->GetTypeInfo() != Produce::kType) {
+      produce = nullptr;
+      continue;
+    }
+    produce = static_cast<Produce *>(op);
+    order_by = above && above->GetTypeInfo() == OrderBy::kType ? static_cast<OrderBy *>(above) : nullptr;
+  }
+  if (!produce) return root_op;
+
+  // The consumers are ordered from the top: the ordering, which can't compute
+  // expressions as it's above the projection, the projection and the filters
+  // of the pipeline.
+  std::vector<LogicalOperator *> consumers{order_by, produce};
+  for (auto *op = produce->input().get(); IsPipelineOperator(*op); op = op->input().get()) {
+    if (op->GetTypeInfo() == Filter::kType) consumers.push_back(op);
+  }
+
+  std::vector<Occurrence> occurrences;
+  if (order_by) {
+    for (auto *&expression : order_by->order_by_) {
+      CollectOccurrences(&expression, 0, true, &occurrences);
+    }
+  }
+  for (auto *named_expression : produce->named_expressions_) {
+    CollectOccurrences(&named_expression->expression_, 1, true, &occurrences);
+  }
+  for (size_t i = 2; i < consumers.size(); ++i) {
+    CollectOccurrences(&static_cast<Filter *>(consumers[i])->expression_, i, true, &occurrences);
+  }
+
+  // The largest expressions are computed first, the expressions inside them
+  // are then computed with them.
+  std::ranges::stable_sort(occurrences, std::ranges::greater{}, &Occurrence::size);
+  std::unordered_set<const Expression *> computed_nodes;
+  std::map<size_t, ComputedExpressions> computed;
+  for (auto &occurrence : occurrences) {
+    if (computed_nodes.contains(occurrence.expression)) continue;
+    std::vector<Occurrence *> equal;
+    for (auto &other : occurrences) {
+      if (other.size == occurrence.size && !computed_nodes.contains(other.expression) &&
+          Equal(*occurrence.expression, *other.expression)) {
+        equal.push_back(&other);
+      }
+    }
+    // Computing the expression below a consumer which doesn't evaluate it on
+    // some row could fail where the query wouldn't.
+    std::optional<size_t> placement;
+    for (const auto *other : equal) {
+      if (other->consumer > 0 && other->always_evaluated) placement = std::max(placement.value_or(0), other->consumer);
+    }
+    if (!placement) continue;
+    std::erase_if(equal, [&](const auto *other) { return other->consumer > *placement; });
+    if (equal.size() < 2) continue;
+
+    auto &placed = computed[*placement];
+    placed.expressions.push_back(occurrence.expression);
+    const auto &slot = placed.output_symbols.emplace_back(symbol_table->CreateAnonymousSymbol());
+    for (auto *other : equal) {
+      CollectNodes(other->expression, &computed_nodes);
+      *other->reference = ast_storage->Create<Identifier>(slot.name(), false)->MapTo(slot);
+    }
+  }
+
+  for (auto &[consumer, placed] : computed) {
+    auto *consumer_op = consumers[consumer];
+    consumer_op->set_input(std::make_shared<ComputeExpressions>(consumer_op->input(), std::move(placed.expressions),
+                                                                std::move(placed.output_symbols)));
+  }
+  return root_op;
+}
+
+}  // namespace memgraph::query::plan
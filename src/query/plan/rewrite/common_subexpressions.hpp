@@ -0,0 +1,44 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+/// @file
+/// This file provides a plan rewriter which computes the deterministic
+/// expressions that occur more than once in the filters, the projection and
+/// the ordering of a read-only pipeline into frame slots with a
+/// @c ComputeExpressions operator, so each of them is evaluated once per row.
+
+#pragma once
+
+#include <memory>
+
+#include <gflags/gflags.h>
+
+#include "query/frontend/ast/ast.hpp"
+#include "query/frontend/semantic/symbol_table.hpp"
+#include "query/plan/operator.hpp"
+
+DECLARE_bool(query_common_subexpressions);
+
+namespace memgraph::query::plan {
+
+/// Inserts @c ComputeExpressions operators into the pipeline of @c Filter,
+/// @c Expand and scan operators which feeds the @c Produce of @p root_op, and
+/// replaces the repeated expressions of the filters, the produce and the
+/// @c OrderBy above it with the computed slots. An expression is computed
+/// below the deepest operator which evaluates it on every row it sees, so no
+/// row is evaluated that the query wouldn't evaluate otherwise. Only
+/// read-only plans are rewritten, and only when
+/// `--query-common-subexpressions` is set.
+std::unique_ptr<LogicalOperator> RewriteWithCommonSubexpressions(std::unique_ptr<LogicalOperator> root_op,
+                                                                 SymbolTable *symbol_table, AstStorage *ast_storage);
+
+}  // namespace memgraph::query::plan
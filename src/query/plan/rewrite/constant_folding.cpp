@@ -0,0 +1,76 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/plan/rewrite/constant_folding.hpp"
+
+#include <algorithm>
+
+#include "query/interpret/awesome_memgraph_functions.hpp"
+#include "utils/typeinfo.hpp"
+
+namespace memgraph::query::plan {
+
+namespace {
+
+/// Returns true if @p expression evaluates to the same value on every row of
+/// an execution. The function calls in it must already be marked.
+bool IsConstant(const Expression &expression) {
+  const auto &type = expression.GetTypeInfo();
+  if (type == PrimitiveLiteral::kType || type == ParameterLookup::kType) return true;
+  if (type == Function::kType) return static_cast<const Function &>(expression).constant_;
+  if (type == ListLiteral::kType) {
+    const auto &elements = static_cast<const ListLiteral &>(expression).elements_;
+    return std::ranges::all_of(elements, [](const auto *element) { return IsConstant(*element); });
+  }
+  if (type == MapLiteral::kType) {
+    const auto &elements = static_cast<const MapLiteral &>(expression).elements_;
+    return std::ranges::all_of(elements, [](const auto &element) { return IsConstant(*element.second); });
+  }
+  // An aggregation is a binary operator too, but its value depends on the rows.
+  if (type != Aggregation::kType && utils::IsSubtype(type, BinaryOperator::kType)) {
+    const auto &binary = static_cast<const BinaryOperator &>(expression);
+    return IsConstant(*binary.expression1_) && IsConstant(*binary.expression2_);
+  }
+  if (utils::IsSubtype(type, UnaryOperator::kType)) {
+    return IsConstant(*static_cast<const UnaryOperator &>(expression).expression_);
+  }
+  return false;
+}
+
+class ConstantFunctionMarker : public HierarchicalTreeVisitor {
+ public:
+  using HierarchicalTreeVisitor::PostVisit;
+  using HierarchicalTreeVisitor::PreVisit;
+  using HierarchicalTreeVisitor::Visit;
+
+  // The arguments are visited first, so the calls nested in them are marked
+  // before the call which takes them.
+  bool PostVisit(Function &function) override {
+    function.constant_ =
+        function.IsBuiltin() && IsPureFunction(function.function_name_) &&
+        std::ranges::all_of(function.arguments_, [](const auto *argument) { return IsConstant(*argument); });
+    return true;
+  }
+
+  bool Visit(Identifier & /*identifier*/) override { return true; }
+  bool Visit(PrimitiveLiteral & /*literal*/) override { return true; }
+  bool Visit(ParameterLookup & /*parameter*/) override { return true; }
+  bool Visit(EnumValueAccess & /*enum_value*/) override { return true; }
+};
+
+}  // namespace
+
+void FoldConstantFunctions(CypherQuery *query) {
+  ConstantFunctionMarker marker;
+  query->Accept(marker);
+}
+
+}  // namespace memgraph::query::plan
@@ -0,0 +1,30 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+/// @file
+/// This file provides the folding of the constant function calls of a query,
+/// e.g. `date($d)` or `toLower('X')`, into a single evaluation per execution.
+
+#pragma once
+
+#include "query/frontend/ast/ast.hpp"
+
+namespace memgraph::query::plan {
+
+/// Marks the calls of pure built-in functions in @p query whose arguments are
+/// made of literals, parameters and other such calls as constant, see
+/// @c Function::constant_. The literals of a cached query are stripped into
+/// parameters, and a cached plan is shared by the executions with different
+/// values of them, so the calls are evaluated once per execution instead of
+/// being replaced with their values in the plan.
+void FoldConstantFunctions(CypherQuery *query);
+
+}  // namespace memgraph::query::plan
@@ -0,0 +1,68 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/plan/rewrite/count_vertices.hpp"
+
+#include "query/frontend/ast/ast.hpp"
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(query_count_vertices_from_index, true,
+            "Count the vertices of a label or label property index scan in the storage when a query only counts "
+            "them, e.g. MATCH (n:Label) RETURN count(n).");
+
+namespace memgraph::query::plan {
+
+namespace {
+
+bool IsCountableScan(const LogicalOperator &op) {
+  const auto &type = op.GetTypeInfo();
+  if (type != ScanAllByLabel::kType && type != ScanAllByLabelProperty::kType &&
+      type != ScanAllByLabelPropertyRange::kType) {
+    return false;
+  }
+  return op.input()->GetTypeInfo() == Once::kType;
+}
+
+/// The CountVertices giving the same row as @p aggregate, or nullptr if it
+/// aggregates anything else than the number of the scanned vertices.
+std::shared_ptr<LogicalOperator> MakeCountVertices(const Aggregate &aggregate, const SymbolTable &symbol_table) {
+  if (!aggregate.group_by_.empty() || !aggregate.remember_.empty() || aggregate.aggregations_.size() != 1) {
+    return nullptr;
+  }
+  const auto &element = aggregate.aggregations_.front();
+  if (element.op != Aggregation::Op::COUNT || !IsCountableScan(*aggregate.input_)) return nullptr;
+  const auto &scan = static_cast<const ScanAll &>(*aggregate.input_);
+  // The scanned vertex is never null and is found once, so `count(n)` and
+  // `count(DISTINCT n)` are the number of rows, as `count(*)` is.
+  if (element.value) {
+    auto *identifier = utils::Downcast<Identifier>(element.value);
+    if (!identifier || symbol_table.at(*identifier) != scan.output_symbol_) return nullptr;
+  }
+  return std::make_shared<CountVertices>(aggregate.input_, element.output_sym);
+}
+
+}  // namespace
+
+std::unique_ptr<LogicalOperator> RewriteWithCountVertices(std::unique_ptr<LogicalOperator> root_op,
+                                                          const SymbolTable &symbol_table) {
+  if (!FLAGS_query_count_vertices_from_index) return root_op;
+
+  for (auto *op = root_op.get(); op && op->HasSingleInput(); op = op->input().get()) {
+    auto input = op->input();
+    if (!input || input->GetTypeInfo() != Aggregate::kType) continue;
+    if (auto count = MakeCountVertices(static_cast<const Aggregate &>(*input), symbol_table)) {
+      op->set_input(std::move(count));
+    }
+  }
+  return root_op;
+}
+
+}  // namespace memgraph::query::plan
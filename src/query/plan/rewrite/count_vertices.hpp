@@ -0,0 +1,40 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+/// @file
+/// This file provides a plan rewriter which answers a `count` of the vertices
+/// of a label or label property index scan with a @c CountVertices operator,
+/// so the storage counts the vertices instead of the scan and the aggregation
+/// making a row for each of them.
+
+#pragma once
+
+#include <memory>
+
+#include <gflags/gflags.h>
+
+#include "query/frontend/semantic/symbol_table.hpp"
+#include "query/plan/operator.hpp"
+
+DECLARE_bool(query_count_vertices_from_index);
+
+namespace memgraph::query::plan {
+
+/// Replaces each @c Aggregate on the chain of single input operators from
+/// @p root_op which has a single `count(*)` or `count(n)` and no grouping,
+/// and whose input is a @c ScanAllByLabel, @c ScanAllByLabelProperty or
+/// @c ScanAllByLabelPropertyRange of `n` over @c Once, with a
+/// @c CountVertices of the scan. Nothing is rewritten when
+/// `--query-count-vertices-from-index` is off.
+std::unique_ptr<LogicalOperator> RewriteWithCountVertices(std::unique_ptr<LogicalOperator> root_op,
+                                                          const SymbolTable &symbol_table);
+
+}  // namespace memgraph::query::plan
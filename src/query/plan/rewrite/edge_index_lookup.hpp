@@ -11,7 +11,8 @@
 
 /// @file
 /// This file provides a plan rewriter which replaces `ScanAll` and `Expand`
-/// operations with `ScanAllByEdgeType` if possible. The public entrypoint is
+/// operations with `ScanAllByEdgeType` if possible and makes `Expand`s between
+/// two bound nodes use the edge-type index. The public entrypoint is
 /// `RewriteWithEdgeIndexRewriter`.
 
 #pragma once
@@ -125,6 +126,12 @@ class EdgeIndexRewriter final : public HierarchicalLogicalOperatorVisitor {
 
   bool PostVisit(Expand &op) override {
     prev_ops_.pop_back();
+    // Both nodes are bound, so the edges between them can be looked up in the
+    // index by their endpoints instead of scanning the adjacency list.
+    if (op.common_.existing_node && op.common_.edge_types.size() == 1 &&
+        db_->EdgeTypeIndexExists(op.common_.edge_types[0])) {
+      op.edge_type_index_lookup_ = true;
+    }
     const bool is_child_sequential_scan = op.input()->GetTypeInfo() == ScanAll::kType;
     if (!is_child_sequential_scan) {
       return true;
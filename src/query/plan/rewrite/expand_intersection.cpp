@@ -0,0 +1,241 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#include "query/plan/rewrite/expand_intersection.hpp"
+
+#include <utility>
+#include <vector>
+
+namespace memgraph::query::plan {
+
+namespace {
+
+EdgeAtom::Direction Reversed(EdgeAtom::Direction direction) {
+  switch (direction) {
+    case EdgeAtom::Direction::IN:
+      return EdgeAtom::Direction::OUT;
+    case EdgeAtom::Direction::OUT:
+      return EdgeAtom::Direction::IN;
+    default:
+      return EdgeAtom::Direction::BOTH;
+  }
+}
+
+bool IsFilter(const LogicalOperator &op) {
+  return op.GetTypeInfo() == Filter::kType || op.GetTypeInfo() == EdgeUniquenessFilter::kType;
+}
+
+/// Returns the operator which should replace @p op if it is an expansion to
+/// a bound node from a node created by the expansion below it, possibly with
+/// filters in between. Returns nullptr if @p op can't be merged.
+std::shared_ptr<LogicalOperator> MergeIntoIntersection(const std::shared_ptr<LogicalOperator> &op) {
+  if (op->GetTypeInfo() != Expand::kType) return nullptr;
+  const auto &closing = static_cast<const Expand &>(*op);
+  // The edge-type index already finds the edges between two bound nodes
+  // without reading their adjacency lists.
+  if (!closing.common_.existing_node || closing.edge_type_index_lookup_ ||
+      closing.common_.node_symbol == closing.input_symbol_) {
+    return nullptr;
+  }
+
+  LogicalOperator *last_filter = nullptr;
+  auto bottom = closing.input();
+  while (IsFilter(*bottom)) {
+    last_filter = bottom.get();
+    bottom = bottom->input();
+  }
+
+  // Expanded from the bound node to the node the closing expansion starts at.
+  ExpandIntersection::Leg leg{.input_symbol = closing.common_.node_symbol,
+                              .edge_symbol = closing.common_.edge_symbol,
+                              .direction = Reversed(closing.common_.direction),
+                              .edge_types = closing.common_.edge_types};
+
+  if (bottom->GetTypeInfo() == ExpandIntersection::kType) {
+    auto &intersection = static_cast<ExpandIntersection &>(*bottom);
+    if (intersection.node_symbol_ != closing.input_symbol_ || intersection.view_ != closing.view_) return nullptr;
+    intersection.legs_.emplace_back(std::move(leg));
+    return closing.input();
+  }
+
+  if (bottom->GetTypeInfo() != Expand::kType) return nullptr;
+  const auto &expand = static_cast<const Expand &>(*bottom);
+  if (expand.common_.existing_node || expand.common_.node_symbol != closing.input_symbol_ ||
+      expand.view_ != closing.view_) {
+    return nullptr;
+  }
+  std::vector<ExpandIntersection::Leg> legs;
+  legs.emplace_back(ExpandIntersection::Leg{.input_symbol = expand.input_symbol_,
+                                            .edge_symbol = expand.common_.edge_symbol,
+                                            .direction = expand.common_.direction,
+                                            .edge_types = expand.common_.edge_types});
+  legs.emplace_back(std::move(leg));
+  auto intersection =
+      std::make_shared<ExpandIntersection>(expand.input(), expand.common_.node_symbol, std::move(legs), expand.view_);
+  if (!last_filter) return intersection;
+  last_filter->set_input(std::move(intersection));
+  return closing.input();
+}
+
+/// Merges the expansions bottom-up, each operator looks at its inputs once
+/// they are rewritten, so chains of closing expansions (cliques) end up in a
+/// single intersection.
+class ExpandIntersectionRewriter final : public HierarchicalLogicalOperatorVisitor {
+ public:
+  using HierarchicalLogicalOperatorVisitor::PostVisit;
+  using HierarchicalLogicalOperatorVisitor::PreVisit;
+  using HierarchicalLogicalOperatorVisitor::Visit;
+
+  bool Visit(Once & /*unused*/) override { return true; }
+
+#define REWRITE_INPUT(NAME)           \
+  bool PostVisit(NAME &op) override { \
+    RewriteInput(op);                 \
+    return true;                      \
+  }
+
+  REWRITE_INPUT(CreateNode)
+  REWRITE_INPUT(CreateExpand)
+  REWRITE_INPUT(ScanAll)
+  REWRITE_INPUT(ScanAllByLabel)
+  REWRITE_INPUT(ScanAllByLabelPropertyRange)
+  REWRITE_INPUT(ScanAllByLabelPropertyValue)
+  REWRITE_INPUT(ScanAllByLabelProperty)
+  REWRITE_INPUT(ScanAllById)
+  REWRITE_INPUT(ScanAllByPointNearest)
+  REWRITE_INPUT(ScanAllByEdge)
+  REWRITE_INPUT(ScanAllByEdgeType)
+  REWRITE_INPUT(ScanAllByEdgeTypeProperty)
+  REWRITE_INPUT(ScanAllByEdgeTypePropertyValue)
+  REWRITE_INPUT(ScanAllByEdgeTypePropertyRange)
+  REWRITE_INPUT(ScanAllByEdgeId)
+  REWRITE_INPUT(Expand)
+  REWRITE_INPUT(ExpandVariable)
+  REWRITE_INPUT(ExpandIntersection)
+  REWRITE_INPUT(ConstructNamedPath)
+  REWRITE_INPUT(Produce)
+  REWRITE_INPUT(Delete)
+  REWRITE_INPUT(SetProperty)
+  REWRITE_INPUT(SetProperties)
+  REWRITE_INPUT(SetLabels)
+  REWRITE_INPUT(RemoveProperty)
+  REWRITE_INPUT(RemoveLabels)
+  REWRITE_INPUT(EdgeUniquenessFilter)
+  REWRITE_INPUT(Accumulate)
+  REWRITE_INPUT(Aggregate)
+  REWRITE_INPUT(Skip)
+  REWRITE_INPUT(Limit)
+  REWRITE_INPUT(OrderBy)
+  REWRITE_INPUT(Unwind)
+  REWRITE_INPUT(Distinct)
+  REWRITE_INPUT(CallProcedure)
+  REWRITE_INPUT(LoadCsv)
+  REWRITE_INPUT(EmptyResult)
+  REWRITE_INPUT(EvaluatePatternFilter)
+  REWRITE_INPUT(PeriodicCommit)
+  REWRITE_INPUT(Gather)
+
+#undef REWRITE_INPUT
+
+  bool PostVisit(Filter &op) override {
+    RewriteInput(op);
+    for (auto &pattern_filter : op.pattern_filters_) {
+      RewriteBranch(&pattern_filter);
+    }
+    return true;
+  }
+
+  bool PostVisit(Merge &op) override {
+    RewriteInput(op);
+    RewriteBranch(&op.merge_match_);
+    return true;
+  }
+
+  bool PostVisit(Optional &op) override {
+    RewriteInput(op);
+    RewriteBranch(&op.optional_);
+    return true;
+  }
+
+  bool PostVisit(Foreach &op) override {
+    RewriteInput(op);
+    RewriteBranch(&op.update_clauses_);
+    return true;
+  }
+
+  bool PostVisit(Apply &op) override {
+    RewriteInput(op);
+    RewriteBranch(&op.subquery_);
+    return true;
+  }
+
+  bool PostVisit(RollUpApply &op) override {
+    RewriteBranch(&op.input_);
+    RewriteBranch(&op.list_collection_branch_);
+    return true;
+  }
+
+  bool PostVisit(PeriodicSubquery &op) override {
+    RewriteInput(op);
+    RewriteBranch(&op.subquery_);
+    return true;
+  }
+
+  bool PostVisit(Union &op) override {
+    RewriteBranch(&op.left_op_);
+    RewriteBranch(&op.right_op_);
+    return true;
+  }
+
+  bool PostVisit(Cartesian &op) override {
+    RewriteBranch(&op.left_op_);
+    RewriteBranch(&op.right_op_);
+    return true;
+  }
+
+  bool PostVisit(HashJoin &op) override {
+    RewriteBranch(&op.left_op_);
+    RewriteBranch(&op.right_op_);
+    return true;
+  }
+
+  bool PostVisit(IndexedJoin &op) override {
+    RewriteBranch(&op.main_branch_);
+    RewriteBranch(&op.sub_branch_);
+    return true;
+  }
+
+ private:
+  static void RewriteInput(LogicalOperator &op) {
+    if (auto merged = MergeIntoIntersection(op.input())) {
+      op.set_input(std::move(merged));
+    }
+  }
+
+  static void RewriteBranch(std::shared_ptr<LogicalOperator> *branch) {
+    if (auto merged = MergeIntoIntersection(*branch)) {
+      *branch = std::move(merged);
+    }
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<LogicalOperator> RewriteWithExpandIntersection(std::unique_ptr<LogicalOperator> root_op) {
+  // The root itself is never an expansion, the plans end in Produce,
+  // EmptyResult or the update operators.
+  ExpandIntersectionRewriter rewriter;
+  root_op->Accept(rewriter);
+  return root_op;
+}
+
+}  // namespace memgraph::query::plan
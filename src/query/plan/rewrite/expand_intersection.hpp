@@ -0,0 +1,32 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+/// @file
+/// This file provides a plan rewriter which replaces the expansions closing a
+/// cycle in a pattern, e.g. the last edge of MATCH (a)-->(b)-->(c)-->(a), with
+/// an @c ExpandIntersection of the adjacency lists of the bound nodes.
+
+#pragma once
+
+#include <memory>
+
+#include "query/plan/operator.hpp"
+
+namespace memgraph::query::plan {
+
+/// Merges an @c Expand to a new node with the following expansions from that
+/// node to already bound nodes into a single @c ExpandIntersection. The
+/// @c Filter and @c EdgeUniquenessFilter operators between them are kept on
+/// top of the intersection.
+std::unique_ptr<LogicalOperator> RewriteWithExpandIntersection(std::unique_ptr<LogicalOperator> root_op);
+
+}  // namespace memgraph::query::plan
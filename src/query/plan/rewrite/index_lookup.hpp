@@ -91,6 +91,43 @@ struct IndexHints {
 
 namespace impl {
 
+/// Collects the properties which an expression looks up on the value of a
+/// symbol, and whether the value is used in any other way.
+class PropertyLookupCollector : public HierarchicalTreeVisitor {
+ public:
+  PropertyLookupCollector(const SymbolTable &symbol_table, const Symbol &symbol)
+      : symbol_table_(symbol_table), symbol_(symbol) {}
+
+  using HierarchicalTreeVisitor::PostVisit;
+  using HierarchicalTreeVisitor::PreVisit;
+  using HierarchicalTreeVisitor::Visit;
+
+  bool PreVisit(PropertyLookup &property_lookup) override {
+    auto *identifier = utils::Downcast<Identifier>(property_lookup.expression_);
+    if (identifier && symbol_table_.at(*identifier) == symbol_) {
+      properties_.push_back(property_lookup.property_);
+      return false;
+    }
+    return true;
+  }
+
+  bool Visit(Identifier &identifier) override {
+    if (symbol_table_.at(identifier) == symbol_) other_use_ = true;
+    return true;
+  }
+
+  bool Visit(PrimitiveLiteral &) override { return true; }
+  bool Visit(ParameterLookup &) override { return true; }
+  bool Visit(EnumValueAccess &) override { return true; }
+
+  std::vector<PropertyIx> properties_;
+  bool other_use_{false};
+
+ private:
+  const SymbolTable &symbol_table_;
+  const Symbol &symbol_;
+};
+
 struct HashPair {
   template <class T1, class T2>
   std::size_t operator()(const std::pair<T1, T2> &pair) const {
@@ -280,8 +317,9 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     std::unique_ptr<ScanAll> indexed_scan;
     ScanAll dst_scan(expand.input(), expand.common_.node_symbol, storage::View::OLD);
     // With expand to existing we only get real gains with BFS, because we use a
-    // different algorithm then, so prefer expand to existing.
-    if (expand.type_ == EdgeAtom::Type::BREADTH_FIRST) {
+    // different algorithm then, so prefer expand to existing. The k shortest
+    // paths need the destination to be bound.
+    if (expand.type_ == EdgeAtom::Type::BREADTH_FIRST || expand.type_ == EdgeAtom::Type::K_SHORTEST_PATHS) {
       // TODO: Perhaps take average node degree into consideration, instead of
       // unconditionally creating an indexed scan.
       indexed_scan = GenScanByIndex(dst_scan);
@@ -726,6 +764,16 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     std::optional<storage::LabelPropertyIndexStats> index_stats;
   };
 
+  struct LabelPropertyCompositeIndex {
+    LabelIx label;
+    std::vector<storage::PropertyId> properties;
+    // Equality filters on the prefix of `properties`, in the index order.
+    std::vector<FilterInfo> filters;
+    int64_t vertex_count;
+    // The vertices are only used for looking up `properties`.
+    bool covering;
+  };
+
   bool DefaultPreVisit() override { throw utils::NotYetImplemented("optimizing index lookup"); }
 
   void SetOnParent(const std::shared_ptr<LogicalOperator> &input) {
@@ -917,6 +965,108 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
     return found;
   }
 
+  // Finds the composite index whose longest prefix of properties is covered by
+  // equality filters on `symbol`. Prefixes of a single property are left to
+  // the label-property indices. Among indices with the same prefix length the
+  // one with less vertices is chosen. Index hints only name label-property
+  // indices, so no composite index is used when there are any.
+  std::optional<LabelPropertyCompositeIndex> FindBestLabelPropertyCompositeIndex(
+      const Symbol &symbol, const std::unordered_set<Symbol> &bound_symbols) {
+    if (!index_hints_.label_property_index_hints_.empty()) return std::nullopt;
+
+    auto are_bound = [&bound_symbols](const auto &used_symbols) {
+      for (const auto &used_symbol : used_symbols) {
+        if (!utils::Contains(bound_symbols, used_symbol)) {
+          return false;
+        }
+      }
+      return true;
+    };
+
+    const auto property_filters = filters_.PropertyFilters(symbol);
+    auto find_equal_filter = [&](storage::PropertyId property) -> const FilterInfo * {
+      for (const auto &filter : property_filters) {
+        const auto &property_filter = *filter.property_filter;
+        if (property_filter.type_ != PropertyFilter::Type::EQUAL || property_filter.is_symbol_in_value_ ||
+            !are_bound(filter.used_symbols)) {
+          continue;
+        }
+        if (GetProperty(property_filter.property_) == property) return &filter;
+      }
+      return nullptr;
+    };
+
+    std::optional<LabelPropertyCompositeIndex> found;
+    for (const auto &label : filters_.FilteredLabels(symbol)) {
+      for (auto &properties : db_->LabelPropertyCompositeIndices(GetLabel(label))) {
+        std::vector<FilterInfo> prefix_filters;
+        for (auto property : properties) {
+          const auto *filter = find_equal_filter(property);
+          if (!filter) break;
+          prefix_filters.push_back(*filter);
+        }
+        if (prefix_filters.empty()) continue;
+        // A lookup by a single property is better served by the label-property
+        // index, unless the index entries make reading the vertices unnecessary.
+        const bool covering = IsCoveredByIndex(symbol, label, properties);
+        if (prefix_filters.size() < 2 && !covering) continue;
+        if (found && prefix_filters.size() < found->filters.size()) continue;
+
+        int64_t vertex_count = db_->VerticesCount(GetLabel(label), properties);
+        if (!found || prefix_filters.size() > found->filters.size() || vertex_count < found->vertex_count) {
+          found = LabelPropertyCompositeIndex{.label = label,
+                                              .properties = std::move(properties),
+                                              .filters = std::move(prefix_filters),
+                                              .vertex_count = vertex_count,
+                                              .covering = covering};
+        }
+      }
+    }
+    return found;
+  }
+
+  // Returns true if the vertices of `symbol` are used only for looking up
+  // `properties` by the filters and the operators above the scan, so they can
+  // be answered from the entries of the composite index of `label` on
+  // `properties`. Only read-only chains of filtering and projecting operators
+  // are considered, any other operator may use the vertex itself.
+  bool IsCoveredByIndex(const Symbol &symbol, LabelIx label, const std::vector<storage::PropertyId> &properties) {
+    PropertyLookupCollector collector(*symbol_table_, symbol);
+    for (auto *op : prev_ops_) {
+      const auto &type = op->GetTypeInfo();
+      if (type == Filter::kType) {
+        if (!static_cast<Filter *>(op)->pattern_filters_.empty()) return false;
+      } else if (type == Produce::kType) {
+        for (auto *named_expression : static_cast<Produce *>(op)->named_expressions_) {
+          named_expression->expression_->Accept(collector);
+        }
+      } else if (type == OrderBy::kType) {
+        for (auto *expression : static_cast<OrderBy *>(op)->order_by_) {
+          expression->Accept(collector);
+        }
+      } else if (type == Distinct::kType) {
+        if (utils::Contains(static_cast<Distinct *>(op)->value_symbols_, symbol)) return false;
+      } else if (type != Skip::kType && type != Limit::kType) {
+        return false;
+      }
+    }
+    // The Filter operators are ones collected in `filters_`. The label filter
+    // of the index is removed from them once the index is used.
+    for (const auto &filter : filters_) {
+      if (!utils::Contains(filter.used_symbols, symbol)) continue;
+      if (filter.type == FilterInfo::Type::Pattern) return false;
+      if (filter.type == FilterInfo::Type::Label &&
+          std::ranges::all_of(filter.labels, [&label](const auto &filter_label) { return filter_label == label; })) {
+        continue;
+      }
+      filter.expression->Accept(collector);
+    }
+    if (collector.other_use_) return false;
+    return std::ranges::all_of(collector.properties_, [this, &properties](const auto &property) {
+      return utils::Contains(properties, GetProperty(property));
+    });
+  }
+
   // Creates a ScanAll by the best possible index for the `node_symbol`. If the node
   // does not have at least a label, no indexed lookup can be created and
   // `nullptr` is returned. The operator is chained after `input`. Optional
@@ -959,6 +1109,26 @@ class IndexLookupRewriter final : public HierarchicalLogicalOperatorVisitor {
       // Without labels, we cannot generate any indexed ScanAll.
       return nullptr;
     }
+    auto found_composite_index = FindBestLabelPropertyCompositeIndex(node_symbol, bound_symbols);
+    if (found_composite_index &&
+        (!max_vertex_count || *max_vertex_count >= found_composite_index->vertex_count)) {
+      std::vector<Expression *> prefix_expressions;
+      for (const auto &filter : found_composite_index->filters) {
+        prefix_expressions.push_back(filter.property_filter->value_);
+        filter_exprs_for_removal_.insert(filter.expression);
+        filters_.EraseFilter(filter);
+      }
+      std::vector<Expression *> removed_expressions;
+      filters_.EraseLabelFilter(node_symbol, found_composite_index->label, &removed_expressions);
+      filter_exprs_for_removal_.insert(removed_expressions.begin(), removed_expressions.end());
+      auto scan = std::make_unique<ScanAllByLabelPropertyValue>(
+          input, node_symbol, GetLabel(found_composite_index->label), found_composite_index->properties.front(),
+          prefix_expressions.front(), view);
+      scan->composite_properties_ = std::move(found_composite_index->properties);
+      scan->composite_expressions_.assign(prefix_expressions.begin() + 1, prefix_expressions.end());
+      scan->covering_ = found_composite_index->covering;
+      return scan;
+    }
     auto found_index = FindBestLabelPropertyIndex(node_symbol, bound_symbols);
     if (found_index &&
         // Use label+property index if we satisfy max_vertex_count.
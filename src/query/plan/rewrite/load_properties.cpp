@@ -0,0 +1,200 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/plan/rewrite/load_properties.hpp"
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "query/plan/read_write_type_checker.hpp"
+#include "utils/cast.hpp"
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_bool(query_load_properties, false,
+            "Read the properties which the filters and the projection of a read-only query look up more than once "
+            "into frame slots, once for every row.");
+
+namespace memgraph::query::plan {
+
+namespace {
+
+/// Operators above the pipeline which feeds the projection.
+bool IsPassThroughOperator(const LogicalOperator &op) {
+  const auto &type = op.GetTypeInfo();
+  return type == Produce::kType || type == Aggregate::kType || type == OrderBy::kType || type == Skip::kType ||
+         type == Limit::kType || type == Distinct::kType || type == EmptyResult::kType;
+}
+
+/// Appends the symbols of the vertices and edges which @p op puts on the
+/// frame to @p objects. Returns false if @p op ends the pipeline.
+bool CollectBoundObjects(const LogicalOperator &op, std::vector<Symbol> *objects) {
+  const auto &type = op.GetTypeInfo();
+  if (type == Filter::kType) return static_cast<const Filter &>(op).pattern_filters_.empty();
+  if (type == EdgeUniquenessFilter::kType) return true;
+  if (type == Expand::kType) {
+    const auto &expand = static_cast<const Expand &>(op);
+    objects->push_back(expand.common_.node_symbol);
+    objects->push_back(expand.common_.edge_symbol);
+    return true;
+  }
+  if (type == ExpandIntersection::kType) {
+    const auto &intersection = static_cast<const ExpandIntersection &>(op);
+    objects->push_back(intersection.node_symbol_);
+    for (const auto &leg : intersection.legs_) {
+      objects->push_back(leg.edge_symbol);
+    }
+    return true;
+  }
+  if (type == ScanAllByLabelPropertyValue::kType) {
+    // A covering scan puts a map of the indexed values on the frame.
+    if (static_cast<const ScanAllByLabelPropertyValue &>(op).covering_) return false;
+  } else if (type != ScanAll::kType && type != ScanAllByLabel::kType && type != ScanAllByLabelPropertyRange::kType &&
+             type != ScanAllByLabelProperty::kType && type != ScanAllById::kType) {
+    return false;
+  }
+  objects->push_back(static_cast<const ScanAll &>(op).output_symbol_);
+  return true;
+}
+
+/// Collects the lookups of properties on the given vertices and edges.
+class ObjectPropertyCollector : public HierarchicalTreeVisitor {
+ public:
+  ObjectPropertyCollector(const SymbolTable &symbol_table, const std::vector<Symbol> &objects)
+      : symbol_table_(symbol_table), objects_(objects) {}
+
+  using HierarchicalTreeVisitor::PostVisit;
+  using HierarchicalTreeVisitor::PreVisit;
+  using HierarchicalTreeVisitor::Visit;
+
+  bool PreVisit(PropertyLookup &property_lookup) override {
+    auto *identifier = utils::Downcast<Identifier>(property_lookup.expression_);
+    if (identifier && std::ranges::find(objects_, symbol_table_.at(*identifier)) != objects_.end()) {
+      lookups_.push_back(&property_lookup);
+      return false;
+    }
+    return true;
+  }
+
+  bool Visit(Identifier &) override { return true; }
+  bool Visit(PrimitiveLiteral &) override { return true; }
+  bool Visit(ParameterLookup &) override { return true; }
+  bool Visit(EnumValueAccess &) override { return true; }
+
+  std::vector<PropertyLookup *> lookups_;
+
+ private:
+  const SymbolTable &symbol_table_;
+  const std::vector<Symbol> &objects_;
+};
+
+/// An operator whose expressions look up properties in the pipeline.
+struct Consumer {
+  LogicalOperator *op;
+  std::vector<Expression *> expressions;
+  /// Vertices and edges put on the frame below the operator.
+  std::vector<Symbol> objects;
+};
+
+/// The lookups of a property of a vertex or an edge in the pipeline.
+struct PropertyUses {
+  Symbol object;
+  std::vector<PropertyLookup *> lookups;
+  /// Index of the first consumer to look up the property, the deepest one.
+  size_t consumer{0};
+};
+
+}  // namespace
+
+std::unique_ptr<LogicalOperator> RewriteWithLoadProperties(std::unique_ptr<LogicalOperator> root_op,
+                                                           SymbolTable *symbol_table, AstStorage *ast_storage) {
+  if (!FLAGS_query_load_properties) return root_op;
+
+  ReadWriteTypeChecker read_write_type_checker;
+  read_write_type_checker.InferRWType(*root_op);
+  if (read_write_type_checker.type != ReadWriteTypeChecker::RWType::R) return root_op;
+
+  LogicalOperator *produce = nullptr;
+  LogicalOperator *op = root_op.get();
+  while (IsPassThroughOperator(*op)) {
+    produce = op->GetTypeInfo() == Produce::kType ? op : nullptr;
+    op = op->input().get();
+  }
+
+  // The consumers are ordered from the top of the pipeline, the objects they
+  // see are known once the whole pipeline is walked.
+  std::vector<Consumer> consumers;
+  if (produce) {
+    auto &consumer = consumers.emplace_back(Consumer{.op = produce});
+    for (auto *named_expression : static_cast<Produce *>(produce)->named_expressions_) {
+      consumer.expressions.push_back(named_expression->expression_);
+    }
+  }
+  for (; op; op = op->input().get()) {
+    std::vector<Symbol> objects;
+    if (!CollectBoundObjects(*op, &objects)) break;
+    for (auto &consumer : consumers) {
+      consumer.objects.insert(consumer.objects.end(), objects.begin(), objects.end());
+    }
+    if (op->GetTypeInfo() == Filter::kType) {
+      consumers.push_back(Consumer{.op = op, .expressions = {static_cast<Filter *>(op)->expression_}});
+    }
+  }
+
+  std::map<std::pair<int32_t, std::string>, PropertyUses> uses;
+  for (size_t i = 0; i < consumers.size(); ++i) {
+    ObjectPropertyCollector collector(*symbol_table, consumers[i].objects);
+    for (auto *expression : consumers[i].expressions) {
+      expression->Accept(collector);
+    }
+    for (auto *lookup : collector.lookups_) {
+      const auto &object = symbol_table->at(*static_cast<Identifier *>(lookup->expression_));
+      auto &property_uses =
+          uses.try_emplace({object.position(), lookup->property_.name}, PropertyUses{.object = object}).first->second;
+      property_uses.lookups.push_back(lookup);
+      property_uses.consumer = i;
+    }
+  }
+
+  // The properties of an object which are first looked up by the same
+  // consumer, loaded together if any of them is looked up more than once.
+  std::map<std::pair<size_t, int32_t>, std::vector<PropertyUses *>> groups;
+  for (auto &[key, property_uses] : uses) {
+    groups[{property_uses.consumer, key.first}].push_back(&property_uses);
+  }
+  std::map<size_t, std::vector<LoadProperties::Entry>> entries;
+  for (auto &[key, group] : groups) {
+    const bool looked_up_more_than_once = group.size() > 1 || std::ranges::any_of(group, [](const auto *property_uses) {
+                                            return property_uses->lookups.size() > 1;
+                                          });
+    if (!looked_up_more_than_once) continue;
+    auto &entry = entries[key.first].emplace_back(LoadProperties::Entry{.symbol = group.front()->object});
+    for (auto *property_uses : group) {
+      auto *object = ast_storage->Create<Identifier>(entry.symbol.name())->MapTo(entry.symbol);
+      const auto &property = property_uses->lookups.front()->property_;
+      entry.lookups.push_back(ast_storage->Create<PropertyLookup>(object, ast_storage->GetPropertyIx(property.name)));
+      const auto &slot = entry.output_symbols.emplace_back(symbol_table->CreateAnonymousSymbol());
+      for (auto *lookup : property_uses->lookups) {
+        lookup->loaded_value_ = ast_storage->Create<Identifier>(slot.name(), false)->MapTo(slot);
+      }
+    }
+  }
+
+  for (auto &[consumer, consumer_entries] : entries) {
+    auto *consumer_op = consumers[consumer].op;
+    consumer_op->set_input(std::make_shared<LoadProperties>(consumer_op->input(), std::move(consumer_entries)));
+  }
+  return root_op;
+}
+
+}  // namespace memgraph::query::plan
@@ -0,0 +1,42 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+/// @file
+/// This file provides a plan rewriter which reads the properties looked up by
+/// the filters and the projection of a read-only pipeline into frame slots
+/// with a @c LoadProperties operator, so each property of a row is read from
+/// the property store once.
+
+#pragma once
+
+#include <memory>
+
+#include <gflags/gflags.h>
+
+#include "query/frontend/ast/ast.hpp"
+#include "query/frontend/semantic/symbol_table.hpp"
+#include "query/plan/operator.hpp"
+
+DECLARE_bool(query_load_properties);
+
+namespace memgraph::query::plan {
+
+/// Inserts @c LoadProperties operators into the pipeline of @c Filter,
+/// @c Expand and scan operators which feeds the @c Produce of @p root_op, and
+/// maps the property lookups of the filters and the produce to the loaded
+/// values. A property is loaded below the first operator which looks it up,
+/// if it's looked up more than once or together with other properties of the
+/// same vertex or edge. Only read-only plans are rewritten, and only when
+/// `--query-load-properties` is set.
+std::unique_ptr<LogicalOperator> RewriteWithLoadProperties(std::unique_ptr<LogicalOperator> root_op,
+                                                           SymbolTable *symbol_table, AstStorage *ast_storage);
+
+}  // namespace memgraph::query::plan
@@ -0,0 +1,107 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/plan/rewrite/parallel_scan.hpp"
+
+#include "query/plan/read_write_type_checker.hpp"
+#include "utils/flag_validation.hpp"
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_VALIDATED_uint64(query_parallel_scan_workers, 0,
+                        "Number of threads used to scan vertices in read-only queries. "
+                        "Default is 0, values 0 and 1 turn parallel scans off.",
+                        FLAG_IN_RANGE(0, 256));
+
+namespace memgraph::query::plan {
+
+namespace {
+
+/// Operators through which the rows are pulled by a single chain of cursors,
+/// so everything below them can be moved under a Gather.
+bool IsPassThroughOperator(const LogicalOperator &op) {
+  const auto &type = op.GetTypeInfo();
+  return type == Produce::kType || type == Aggregate::kType || type == OrderBy::kType || type == Skip::kType ||
+         type == Limit::kType || type == Distinct::kType || type == EmptyResult::kType;
+}
+
+/// Operators which can run on a worker thread without sharing state with the
+/// rest of the plan.
+bool IsParallelizableOperator(const LogicalOperator &op) {
+  const auto &type = op.GetTypeInfo();
+  if (type == Filter::kType) return static_cast<const Filter &>(op).pattern_filters_.empty();
+  return type == Expand::kType || type == ExpandIntersection::kType || type == EdgeUniquenessFilter::kType ||
+         type == LoadProperties::kType || type == ComputeExpressions::kType;
+}
+
+/// The scan whose vertices can be split between workers, or nullptr when the
+/// pipeline starting at @p op doesn't end in one. A bare scan is only
+/// accepted if @p allow_bare_scan, when the rows are worked on where they
+/// are gathered.
+const ScanAll *FindParallelScan(const LogicalOperator &op, bool allow_bare_scan = false) {
+  const auto *current = &op;
+  while (IsParallelizableOperator(*current)) {
+    current = current->input().get();
+  }
+  const auto &type = current->GetTypeInfo();
+  if (type != ScanAll::kType && type != ScanAllByLabel::kType) return nullptr;
+  if (current->input()->GetTypeInfo() != Once::kType) return nullptr;
+  // A bare scan only moves rows between threads, there is no work to split.
+  if (current == &op && !allow_bare_scan) return nullptr;
+  return static_cast<const ScanAll *>(current);
+}
+
+std::shared_ptr<Gather> MakeGather(const std::shared_ptr<LogicalOperator> &input, const ScanAll &scan) {
+  std::optional<storage::LabelId> label;
+  if (scan.GetTypeInfo() == ScanAllByLabel::kType) label = static_cast<const ScanAllByLabel &>(scan).label_;
+  return std::make_shared<Gather>(input, label, scan.view_, FLAGS_query_parallel_scan_workers);
+}
+
+}  // namespace
+
+std::unique_ptr<LogicalOperator> RewriteWithParallelScan(std::unique_ptr<LogicalOperator> root_op) {
+  if (FLAGS_query_parallel_scan_workers <= 1) return root_op;
+
+  ReadWriteTypeChecker read_write_type_checker;
+  read_write_type_checker.InferRWType(*root_op);
+  if (read_write_type_checker.type != ReadWriteTypeChecker::RWType::R) return root_op;
+
+  for (auto *op = root_op.get(); op && op->HasSingleInput(); op = op->input().get()) {
+    if (op->GetTypeInfo() != ExpandVariable::kType) continue;
+    auto &expand = static_cast<ExpandVariable &>(*op);
+    if (expand.type_ == EdgeAtom::Type::BREADTH_FIRST && !expand.common_.existing_node) {
+      expand.num_workers_ = FLAGS_query_parallel_scan_workers;
+    }
+  }
+
+  // The build side of the first hash join is hashed on the workers, which
+  // pays off for a bare scan too.
+  for (auto *op = root_op.get(); op; op = op->HasSingleInput() ? op->input().get() : nullptr) {
+    if (op->GetTypeInfo() != HashJoin::kType) continue;
+    auto &join = static_cast<HashJoin &>(*op);
+    if (const auto *scan = FindParallelScan(*join.left_op_, /*allow_bare_scan=*/true)) {
+      join.left_op_ = MakeGather(join.left_op_, *scan);
+    }
+    break;
+  }
+
+  LogicalOperator *parent = root_op.get();
+  while (IsPassThroughOperator(*parent)) {
+    auto input = parent->input();
+    if (const auto *scan = FindParallelScan(*input)) {
+      parent->set_input(MakeGather(input, *scan));
+      break;
+    }
+    parent = input.get();
+  }
+  return root_op;
+}
+
+}  // namespace memgraph::query::plan
@@ -0,0 +1,38 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+/// @file
+/// This file provides a plan rewriter which runs the scanning part of
+/// read-only plans on multiple threads by inserting a @c Gather operator, and
+/// lets their breadth-first expansions expand levels on multiple threads.
+
+#pragma once
+
+#include <memory>
+
+#include <gflags/gflags.h>
+
+#include "query/plan/operator.hpp"
+
+DECLARE_uint64(query_parallel_scan_workers);
+
+namespace memgraph::query::plan {
+
+/// Inserts a @c Gather above the deepest pipeline of @c Filter, @c Expand,
+/// @c ExpandIntersection and @c EdgeUniquenessFilter operators which starts with a @c ScanAll or
+/// @c ScanAllByLabel. The single source breadth-first expansions on the
+/// chain of single input operators from @p root_op get the same number of
+/// workers for expanding their large levels, and the build side of the first
+/// @c HashJoin on the chain gets a @c Gather of its own. Only read-only plans are
+/// rewritten, and only when `--query-parallel-scan-workers` is larger than 1.
+std::unique_ptr<LogicalOperator> RewriteWithParallelScan(std::unique_ptr<LogicalOperator> root_op);
+
+}  // namespace memgraph::query::plan
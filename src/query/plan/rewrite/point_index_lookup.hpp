@@ -0,0 +1,114 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+/// @file
+/// This file provides a plan rewriter which answers nearest-point queries,
+/// `ORDER BY point.distance(n.prop, point) LIMIT k`, from the point index by
+/// replacing the `ScanAllByLabel` below them with `ScanAllByPointNearest`.
+/// The public entrypoint is `RewriteWithPointIndexLookup`.
+
+#pragma once
+
+#include <memory>
+
+#include "query/frontend/ast/ast.hpp"
+#include "query/frontend/semantic/symbol_table.hpp"
+#include "query/plan/operator.hpp"
+#include "query/plan/preprocess.hpp"
+#include "utils/string.hpp"
+
+namespace memgraph::query::plan {
+
+namespace impl {
+
+/// Returns the property lookup of @p expression on the vertex the scan
+/// outputs as @p scan_symbol, either directly or through a named expression
+/// of @p produce which only renames it.
+inline PropertyLookup *ScannedPropertyLookup(Expression *expression, const Symbol &scan_symbol, const Produce &produce,
+                                             const SymbolTable &symbol_table) {
+  auto *lookup = utils::Downcast<PropertyLookup>(expression);
+  if (!lookup) return nullptr;
+  auto *identifier = utils::Downcast<Identifier>(lookup->expression_);
+  if (!identifier) return nullptr;
+  const auto &symbol = symbol_table.at(*identifier);
+  if (symbol == scan_symbol) return lookup;
+  for (auto *named_expression : produce.named_expressions_) {
+    if (symbol_table.at(*named_expression) != symbol) continue;
+    auto *renamed = utils::Downcast<Identifier>(named_expression->expression_);
+    if (renamed && symbol_table.at(*renamed) == scan_symbol) return lookup;
+    return nullptr;
+  }
+  return nullptr;
+}
+
+inline bool UsesNoSymbols(Expression *expression, const SymbolTable &symbol_table) {
+  UsedSymbolsCollector collector(symbol_table);
+  expression->Accept(collector);
+  return collector.symbols_.empty();
+}
+
+/// Rewrites `Limit -> [Skip] -> OrderBy -> Produce -> ScanAllByLabel -> Once`
+/// if the only sort item is an ascending `point.distance` between a property
+/// of the scanned vertex and a constant point, and the property is covered by
+/// a point index. Returns false if @p limit doesn't start such a chain.
+template <class TDbAccessor>
+bool RewriteNearestPointScan(Limit &limit, const SymbolTable &symbol_table, TDbAccessor *db) {
+  auto *next = limit.input().get();
+  Skip *skip = nullptr;
+  if (next->GetTypeInfo() == Skip::kType) {
+    skip = static_cast<Skip *>(next);
+    next = skip->input().get();
+  }
+  if (next->GetTypeInfo() != OrderBy::kType) return false;
+  auto &order_by = static_cast<OrderBy &>(*next);
+  if (order_by.order_by_.size() != 1 || order_by.compare_.orderings()[0].ordering() != Ordering::ASC) return false;
+
+  if (order_by.input()->GetTypeInfo() != Produce::kType) return false;
+  auto &produce = static_cast<Produce &>(*order_by.input());
+  if (produce.input()->GetTypeInfo() != ScanAllByLabel::kType) return false;
+  const auto &scan = static_cast<const ScanAllByLabel &>(*produce.input());
+  if (scan.input()->GetTypeInfo() != Once::kType) return false;
+
+  auto *distance = utils::Downcast<Function>(order_by.order_by_[0]);
+  if (!distance || utils::ToUpperCase(distance->function_name_) != "POINT.DISTANCE" ||
+      distance->arguments_.size() != 2) {
+    return false;
+  }
+  for (auto i = 0; i < 2; ++i) {
+    auto *lookup = ScannedPropertyLookup(distance->arguments_[i], scan.output_symbol_, produce, symbol_table);
+    auto *point = distance->arguments_[1 - i];
+    if (!lookup || !UsesNoSymbols(point, symbol_table)) continue;
+    auto property = db->NameToProperty(lookup->property_.name);
+    if (!db->PointIndexExists(scan.label_, property)) continue;
+    produce.set_input(std::make_shared<ScanAllByPointNearest>(scan.input(), scan.output_symbol_, scan.label_, property,
+                                                              point, limit.expression_,
+                                                              skip ? skip->expression_ : nullptr, scan.view_));
+    return true;
+  }
+  return false;
+}
+
+}  // namespace impl
+
+/// Replaces the label scan of nearest-point queries with
+/// @c ScanAllByPointNearest when a point index covers the compared property.
+/// Only the operators with a single input are followed from @p root_op.
+template <class TDbAccessor>
+std::unique_ptr<LogicalOperator> RewriteWithPointIndexLookup(std::unique_ptr<LogicalOperator> root_op,
+                                                             const SymbolTable &symbol_table, TDbAccessor *db) {
+  for (auto *op = root_op.get(); op && op->HasSingleInput(); op = op->input().get()) {
+    if (op->GetTypeInfo() != Limit::kType) continue;
+    if (impl::RewriteNearestPointScan(static_cast<Limit &>(*op), symbol_table, db)) break;
+  }
+  return root_op;
+}
+
+}  // namespace memgraph::query::plan
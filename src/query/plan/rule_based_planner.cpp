@@ -568,7 +568,15 @@ std::unique_ptr<LogicalOperator> GenReturnBody(std::unique_ptr<LogicalOperator>
   // Like Where, OrderBy can read from symbols established by named expressions
   // in Produce, so it must come after it.
   if (!body.order_by().empty()) {
-    last_op = std::make_unique<OrderBy>(std::move(last_op), body.order_by(), body.output_symbols());
+    auto order_by = std::make_unique<OrderBy>(std::move(last_op), body.order_by(), body.output_symbols());
+    // Only the first SKIP + LIMIT rows of the ordering are returned, so there
+    // is no need to keep the rest. The expressions are evaluated again by Skip
+    // and Limit, which is why they have to be constant.
+    if (body.limit() && IsConstantLiteral(body.limit()) && (!body.skip() || IsConstantLiteral(body.skip()))) {
+      order_by->skip_ = body.skip();
+      order_by->limit_ = body.limit();
+    }
+    last_op = std::move(order_by);
   }
   // Finally, Skip and Limit must come after OrderBy.
   if (body.skip()) {
@@ -588,6 +596,43 @@ std::unique_ptr<LogicalOperator> GenReturnBody(std::unique_ptr<LogicalOperator>
   return last_op;
 }
 
+// Ast tree visitor which collects the columns of a LOAD CSV row the query
+// looks up as `row.column`. Any other use of the row, e.g. returning it or
+// indexing it with an expression, needs all of its columns.
+class LoadCsvColumnsCollector : public HierarchicalTreeVisitor {
+ public:
+  LoadCsvColumnsCollector(const Identifier *row_var, const SymbolTable &symbol_table)
+      : row_var_(row_var), row_symbol_(symbol_table.at(*row_var)), symbol_table_(symbol_table) {}
+
+  using HierarchicalTreeVisitor::PostVisit;
+  using HierarchicalTreeVisitor::PreVisit;
+  using HierarchicalTreeVisitor::Visit;
+
+  bool PreVisit(PropertyLookup &lookup) override {
+    auto *identifier = utils::Downcast<Identifier>(lookup.expression_);
+    if (!identifier || symbol_table_.at(*identifier) != row_symbol_) return true;
+    if (!utils::Contains(columns_, lookup.property_.name)) columns_.push_back(lookup.property_.name);
+    return false;
+  }
+
+  bool Visit(Identifier &identifier) override {
+    if (&identifier != row_var_ && symbol_table_.at(identifier) == row_symbol_) uses_whole_row_ = true;
+    return true;
+  }
+
+  bool Visit(PrimitiveLiteral &) override { return true; }
+  bool Visit(ParameterLookup &) override { return true; }
+  bool Visit(EnumValueAccess &) override { return true; }
+
+  std::vector<std::string> columns_;
+  bool uses_whole_row_{false};
+
+ private:
+  const Identifier *row_var_;
+  Symbol row_symbol_;
+  const SymbolTable &symbol_table_;
+};
+
 }  // namespace
 
 namespace impl {
@@ -706,6 +751,15 @@ std::unique_ptr<LogicalOperator> GenUnion(const CypherUnion &cypher_union, std::
                                  right_op->OutputSymbols(symbol_table));
 }
 
+std::optional<std::vector<std::string>> LoadCsvColumns(CypherQuery *query, const query::LoadCsv &load_csv,
+                                                      const SymbolTable &symbol_table) {
+  if (!query || !load_csv.with_header_) return std::nullopt;
+  LoadCsvColumnsCollector collector(load_csv.row_var_, symbol_table);
+  query->Accept(collector);
+  if (collector.uses_whole_row_) return std::nullopt;
+  return std::move(collector.columns_);
+}
+
 Symbol GetSymbol(NodeAtom *atom, const SymbolTable &symbol_table) { return symbol_table.at(*atom->identifier_); }
 Symbol GetSymbol(EdgeAtom *atom, const SymbolTable &symbol_table) { return symbol_table.at(*atom->identifier_); }
 
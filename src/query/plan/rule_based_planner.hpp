@@ -18,6 +18,7 @@
 
 #include "flags/run_time_configurable.hpp"
 #include "query/database_access.hpp"
+#include "query/exceptions.hpp"
 #include "query/frontend/ast/ast.hpp"
 #include "query/frontend/ast/ast_visitor.hpp"
 #include "query/plan/operator.hpp"
@@ -110,6 +111,11 @@ std::unordered_set<Symbol> GetSubqueryBoundSymbols(const std::vector<SingleQuery
                                                    SymbolTable &symbol_table, AstStorage &storage,
                                                    PatternComprehensionDataMap &pc_ops);
 
+/// Returns the columns of the LOAD CSV WITH HEADER row which `query` looks
+/// up, or std::nullopt if it needs all of them or isn't given.
+std::optional<std::vector<std::string>> LoadCsvColumns(CypherQuery *query, const query::LoadCsv &load_csv,
+                                                      const SymbolTable &symbol_table);
+
 Symbol GetSymbol(NodeAtom *atom, const SymbolTable &symbol_table);
 Symbol GetSymbol(EdgeAtom *atom, const SymbolTable &symbol_table);
 
@@ -270,7 +276,9 @@ class RuleBasedPlanner {
             context.bound_symbols.insert(row_sym);
             input_op = std::make_unique<plan::LoadCsv>(std::move(input_op), load_csv->file_, load_csv->with_header_,
                                                        load_csv->ignore_bad_, load_csv->delimiter_, load_csv->quote_,
-                                                       load_csv->nullif_, row_sym);
+                                                       load_csv->nullif_, row_sym,
+                                                       impl::LoadCsvColumns(context_->query, *load_csv,
+                                                                            *context.symbol_table));
           } else if (auto *foreach = utils::Downcast<query::Foreach>(clause)) {
             context.is_write_query = true;
             input_op = HandleForeachClause(foreach, std::move(input_op), *context.symbol_table, context.bound_symbols,
@@ -278,7 +286,7 @@ class RuleBasedPlanner {
           } else if (auto *call_sub = utils::Downcast<query::CallSubquery>(clause)) {
             input_op = HandleSubquery(std::move(input_op), single_query_part.subqueries[subquery_id++],
                                       *context.symbol_table, *context_->ast_storage, pattern_comprehension_ops,
-                                      call_sub->cypher_query_->pre_query_directives_.commit_frequency_);
+                                      call_sub->cypher_query_->pre_query_directives_);
             if (context.is_write_query && !has_periodic_commit) {
               input_op = std::make_unique<Accumulate>(std::move(input_op),
                                                       input_op->ModifiedSymbols(*context.symbol_table), true);
@@ -784,7 +792,8 @@ class RuleBasedPlanner {
       std::optional<ExpansionLambda> weight_lambda;
       std::optional<Symbol> total_weight;
 
-      if (edge->type_ == EdgeAtom::Type::WEIGHTED_SHORTEST_PATH || edge->type_ == EdgeAtom::Type::ALL_SHORTEST_PATHS) {
+      if (edge->type_ == EdgeAtom::Type::WEIGHTED_SHORTEST_PATH || edge->type_ == EdgeAtom::Type::ALL_SHORTEST_PATHS ||
+          edge->type_ == EdgeAtom::Type::K_SHORTEST_PATHS) {
         weight_lambda.emplace(ExpansionLambda{.inner_edge_symbol = symbol_table.at(*edge->weight_lambda_.inner_edge),
                                               .inner_node_symbol = symbol_table.at(*edge->weight_lambda_.inner_node),
                                               .expression = edge->weight_lambda_.expression});
@@ -792,6 +801,14 @@ class RuleBasedPlanner {
         total_weight.emplace(symbol_table.at(*edge->total_weight_));
       }
 
+      std::optional<ExpansionLambda> heuristic_lambda;
+      if (edge->heuristic_lambda_.expression) {
+        heuristic_lambda.emplace(
+            ExpansionLambda{.inner_edge_symbol = symbol_table.at(*edge->heuristic_lambda_.inner_edge),
+                            .inner_node_symbol = symbol_table.at(*edge->heuristic_lambda_.inner_node),
+                            .expression = edge->heuristic_lambda_.expression});
+      }
+
       ExpansionLambda filter_lambda;
       filter_lambda.inner_edge_symbol = symbol_table.at(*edge->filter_lambda_.inner_edge);
       filter_lambda.inner_node_symbol = symbol_table.at(*edge->filter_lambda_.inner_node);
@@ -865,7 +882,7 @@ class RuleBasedPlanner {
       last_op = std::make_unique<ExpandVariable>(std::move(last_op), node1_symbol, node_symbol, edge_symbol,
                                                  edge->type_, expansion.direction, edge_types, expansion.is_flipped,
                                                  edge->lower_bound_, edge->upper_bound_, existing_node, filter_lambda,
-                                                 weight_lambda, total_weight);
+                                                 weight_lambda, total_weight, heuristic_lambda);
     } else {
       last_op = std::make_unique<Expand>(std::move(last_op), node1_symbol, node_symbol, edge_symbol,
                                          expansion.direction, edge_types, existing_node, view);
@@ -939,7 +956,7 @@ class RuleBasedPlanner {
   std::unique_ptr<LogicalOperator> HandleSubquery(std::unique_ptr<LogicalOperator> last_op,
                                                   std::shared_ptr<QueryParts> subquery, SymbolTable &symbol_table,
                                                   AstStorage &storage, PatternComprehensionDataMap &pc_ops,
-                                                  Expression *commit_frequency) {
+                                                  const PreQueryDirectives &directives) {
     std::unordered_set<Symbol> outer_scope_bound_symbols;
     outer_scope_bound_symbols.insert(std::make_move_iterator(context_->bound_symbols.begin()),
                                      std::make_move_iterator(context_->bound_symbols.end()));
@@ -958,13 +975,17 @@ class RuleBasedPlanner {
       subquery_has_return = false;
     }
 
-    bool has_periodic_commit = commit_frequency != nullptr;
+    bool has_periodic_commit = directives.commit_frequency_ != nullptr;
     if (!has_periodic_commit) {
       last_op = std::make_unique<Apply>(std::move(last_op), std::move(subquery_op), subquery_has_return);
     } else {
+      if (directives.concurrent_commit_ && subquery_has_return) {
+        throw SemanticException("CALL IN CONCURRENT TRANSACTIONS can't be used with a subquery which returns rows.");
+      }
       // this periodic commit is from CALL IN TRANSACTIONS OF x ROWS
-      last_op = std::make_unique<PeriodicSubquery>(std::move(last_op), std::move(subquery_op), commit_frequency,
-                                                   subquery_has_return);
+      last_op = std::make_unique<PeriodicSubquery>(std::move(last_op), std::move(subquery_op),
+                                                   directives.commit_frequency_, subquery_has_return,
+                                                   directives.concurrent_commit_, directives.commit_concurrency_);
     }
 
     return last_op;
@@ -1013,11 +1034,36 @@ class RuleBasedPlanner {
 
     last_op = std::make_unique<Limit>(std::move(last_op), storage.Create<PrimitiveLiteral>(1));
 
-    last_op = std::make_unique<EvaluatePatternFilter>(std::move(last_op), matching.symbol.value());
+    last_op = std::make_unique<EvaluatePatternFilter>(std::move(last_op), matching.symbol.value(),
+                                                      CorrelatedSymbols(matching, bound_symbols));
 
     return last_op;
   }
 
+  /// Returns the bound symbols the pattern of @p matching depends on, so its
+  /// result can be reused for the rows which agree on them. Variable length
+  /// edges and nested patterns may refer to symbols which aren't collected in
+  /// the matching, so they depend on all the bound symbols.
+  static std::vector<Symbol> CorrelatedSymbols(const FilterMatching &matching,
+                                               const std::unordered_set<Symbol> &bound_symbols) {
+    std::unordered_set<Symbol> used_symbols;
+    for (const auto &expansion : matching.expansions) {
+      if (expansion.edge && expansion.edge->IsVariable()) {
+        return {bound_symbols.begin(), bound_symbols.end()};
+      }
+    }
+    for (const auto &filter : matching.filters) {
+      if (filter.type == FilterInfo::Type::Pattern) return {bound_symbols.begin(), bound_symbols.end()};
+      used_symbols.insert(filter.used_symbols.begin(), filter.used_symbols.end());
+    }
+    used_symbols.insert(matching.expansion_symbols.begin(), matching.expansion_symbols.end());
+    std::vector<Symbol> correlated_symbols;
+    for (const auto &symbol : used_symbols) {
+      if (bound_symbols.contains(symbol)) correlated_symbols.push_back(symbol);
+    }
+    return correlated_symbols;
+  }
+
   std::vector<std::shared_ptr<LogicalOperator>> ExtractPatternFilters(Filters &filters, const SymbolTable &symbol_table,
                                                                       AstStorage &storage,
                                                                       const std::unordered_set<Symbol> &bound_symbols) {
@@ -16,6 +16,7 @@
 #include "query/context.hpp"
 #include "query/plan/profile.hpp"
 #include "utils/likely.hpp"
+#include "utils/perf_counters.hpp"
 #include "utils/tsc.hpp"
 
 namespace memgraph::query::plan {
@@ -61,6 +62,7 @@ class ScopedProfile {
 
       context_->stats_root = stats_;
       stats_->actual_hits++;
+      if (context_->perf_counters) start_counters_ = context_->perf_counters->Read();
       start_time_ = utils::ReadTSC();
     }
   }
@@ -93,6 +95,7 @@ class ScopedProfile {
 
       context_->stats_root = stats_;
       stats_->actual_hits++;
+      if (context_->perf_counters) start_counters_ = context_->perf_counters->Read();
       start_time_ = utils::ReadTSC();
     }
   }
@@ -100,6 +103,7 @@ class ScopedProfile {
   ~ScopedProfile() noexcept {
     if (UNLIKELY(context_->is_profile_query)) {
       stats_->num_cycles += utils::ReadTSC() - start_time_;
+      if (context_->perf_counters) stats_->perf_counters += context_->perf_counters->Read() - start_counters_;
 
       // Restore the old root ("pop")
       context_->stats_root = root_;
@@ -111,6 +115,7 @@ class ScopedProfile {
   ProfilingStats *root_{nullptr};
   ProfilingStats *stats_{nullptr};
   unsigned long long start_time_{0};
+  utils::PerfCounterValues start_counters_;
 };
 
 }  // namespace memgraph::query::plan
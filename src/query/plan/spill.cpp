@@ -0,0 +1,162 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#include "query/plan/spill.hpp"
+
+#include <algorithm>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "query/exceptions.hpp"
+#include "storage/v2/property_store.hpp"
+#include "utils/uuid.hpp"
+
+namespace memgraph::query::plan {
+
+namespace {
+
+// Every row is written as its size, a tag per value, the gids of the graph
+// elements and the property store buffer holding the remaining non-null
+// values under the property ids equal to their positions.
+enum class SpilledValue : uint8_t { PROPERTY, VERTEX, EDGE };
+
+template <class T>
+void WriteRaw(std::fstream *file, const T &value) {
+  file->write(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+template <class T>
+bool ReadRaw(std::fstream *file, T *value) {
+  return static_cast<bool>(file->read(reinterpret_cast<char *>(value), sizeof(*value)));
+}
+
+}  // namespace
+
+SpillFile::SpillFile(const std::filesystem::path &directory) : path_(directory / utils::GenerateUUID()) {
+  std::error_code error;
+  std::filesystem::create_directories(directory, error);
+  if (error) {
+    throw QueryRuntimeException("Couldn't create the directory {} for spilling rows: {}", directory.string(),
+                                error.message());
+  }
+  file_.open(path_, std::ios::in | std::ios::out | std::ios::trunc | std::ios::binary);
+  if (!file_) throw QueryRuntimeException("Couldn't create the file {} for spilling rows.", path_.string());
+}
+
+SpillFile::~SpillFile() {
+  file_.close();
+  std::error_code error;
+  std::filesystem::remove(path_, error);
+}
+
+bool SpillFile::CanSpill(const TypedValue &value) {
+  switch (value.type()) {
+    case TypedValue::Type::Path:
+    case TypedValue::Type::Graph:
+    case TypedValue::Type::Function:
+      return false;
+    case TypedValue::Type::List:
+      return std::ranges::all_of(value.ValueList(), [](const auto &elem) {
+        return elem.type() != TypedValue::Type::Vertex && elem.type() != TypedValue::Type::Edge && CanSpill(elem);
+      });
+    case TypedValue::Type::Map:
+      return std::ranges::all_of(value.ValueMap(), [](const auto &kv) {
+        return kv.second.type() != TypedValue::Type::Vertex && kv.second.type() != TypedValue::Type::Edge &&
+               CanSpill(kv.second);
+      });
+    default:
+      return true;
+  }
+}
+
+void SpillFile::Write(const utils::pmr::vector<TypedValue> &row) {
+  WriteRaw(&file_, static_cast<uint32_t>(row.size()));
+  std::vector<std::pair<storage::PropertyId, storage::PropertyValue>> properties;
+  for (uint32_t i = 0; i < row.size(); ++i) {
+    const auto &value = row[i];
+    auto tag = SpilledValue::PROPERTY;
+    if (value.IsVertex()) {
+      tag = SpilledValue::VERTEX;
+    } else if (value.IsEdge()) {
+      tag = SpilledValue::EDGE;
+    } else if (!value.IsNull()) {
+      properties.emplace_back(storage::PropertyId::FromUint(i), storage::PropertyValue(value));
+    }
+    WriteRaw(&file_, tag);
+  }
+  for (const auto &value : row) {
+    if (value.IsVertex()) WriteRaw(&file_, value.ValueVertex().Gid().AsUint());
+    if (value.IsEdge()) WriteRaw(&file_, value.ValueEdge().Gid().AsUint());
+  }
+  storage::PropertyStore store;
+  store.InitProperties(std::move(properties));
+  auto const buffer = store.StringBuffer();
+  WriteRaw(&file_, static_cast<uint64_t>(buffer.size()));
+  file_.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+  if (!file_) throw QueryRuntimeException("Couldn't write the spilled rows to {}.", path_.string());
+}
+
+void SpillFile::FinishWriting() {
+  file_.flush();
+  file_.seekg(0);
+  if (!file_) throw QueryRuntimeException("Couldn't read the spilled rows from {}.", path_.string());
+}
+
+bool SpillFile::Read(DbAccessor *db, utils::pmr::vector<TypedValue> *row) {
+  uint32_t size = 0;
+  if (!ReadRaw(&file_, &size)) return false;
+  auto const error = [this] {
+    return QueryRuntimeException("Couldn't read the spilled rows from {}.", path_.string());
+  };
+
+  std::vector<SpilledValue> tags(size);
+  for (auto &tag : tags) {
+    if (!ReadRaw(&file_, &tag)) throw error();
+  }
+  row->clear();
+  row->reserve(size);
+  for (auto tag : tags) {
+    if (tag == SpilledValue::PROPERTY) {
+      row->emplace_back();
+      continue;
+    }
+    uint64_t gid = 0;
+    if (!ReadRaw(&file_, &gid)) throw error();
+    // Elements created by the query are only visible in the new view, the
+    // ones it deleted in the old one.
+    if (tag == SpilledValue::VERTEX) {
+      auto vertex = db->FindVertex(storage::Gid::FromUint(gid), storage::View::NEW);
+      if (!vertex) vertex = db->FindVertex(storage::Gid::FromUint(gid), storage::View::OLD);
+      if (!vertex) throw QueryRuntimeException("Couldn't find a spilled vertex.");
+      row->emplace_back(std::move(*vertex));
+    } else {
+      auto edge = db->FindEdge(storage::Gid::FromUint(gid), storage::View::NEW);
+      if (!edge) edge = db->FindEdge(storage::Gid::FromUint(gid), storage::View::OLD);
+      if (!edge) throw QueryRuntimeException("Couldn't find a spilled edge.");
+      row->emplace_back(std::move(*edge));
+    }
+  }
+
+  uint64_t buffer_size = 0;
+  if (!ReadRaw(&file_, &buffer_size)) throw error();
+  std::string buffer(buffer_size, '\0');
+  if (!file_.read(buffer.data(), static_cast<std::streamsize>(buffer_size))) throw error();
+  auto const store = storage::PropertyStore::CreateFromBuffer(buffer);
+  for (auto &[property, value] : store.Properties()) {
+    (*row)[property.AsUint()] = TypedValue(std::move(value), row->get_allocator().GetMemoryResource());
+  }
+  return true;
+}
+
+}  // namespace memgraph::query::plan
@@ -0,0 +1,67 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+/// @file
+/// Temporary files to which operators move the rows which don't fit into
+/// their memory budget.
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+
+#include "query/db_accessor.hpp"
+#include "query/typed_value.hpp"
+#include "utils/pmr/vector.hpp"
+
+namespace memgraph::query::plan {
+
+/// Rows of values written to a temporary file and read back in the same
+/// order. Vertices and edges are written as their gids and looked up again
+/// when they are read, all other values with the encoding of the property
+/// store. Paths, graphs and functions, also inside of lists and maps, can't
+/// be spilled. The file is removed when the object is destroyed.
+class SpillFile {
+ public:
+  /// Creates the file in @p directory, which is created if it doesn't exist.
+  /// @throw QueryRuntimeException if the file can't be created.
+  explicit SpillFile(const std::filesystem::path &directory);
+  ~SpillFile();
+
+  SpillFile(const SpillFile &) = delete;
+  SpillFile &operator=(const SpillFile &) = delete;
+  SpillFile(SpillFile &&) = delete;
+  SpillFile &operator=(SpillFile &&) = delete;
+
+  /// Returns true if @p value can be written to a spill file.
+  static bool CanSpill(const TypedValue &value);
+
+  /// Appends a row, all of its values have to satisfy `CanSpill`.
+  /// @throw QueryRuntimeException if the row can't be written.
+  void Write(const utils::pmr::vector<TypedValue> &row);
+
+  /// Ends writing, the rows are read from the beginning of the file after it.
+  void FinishWriting();
+
+  /// Reads the next row into @p row, replacing its values. The graph
+  /// elements are looked up through @p db.
+  /// @return false if all rows were read.
+  /// @throw QueryRuntimeException if the row can't be read back.
+  bool Read(DbAccessor *db, utils::pmr::vector<TypedValue> *row);
+
+ private:
+  std::filesystem::path path_;
+  std::fstream file_;
+};
+
+}  // namespace memgraph::query::plan
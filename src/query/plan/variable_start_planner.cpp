@@ -11,8 +11,9 @@
 
 #include "query/plan/variable_start_planner.hpp"
 
+#include <algorithm>
+#include <deque>
 #include <limits>
-#include <queue>
 #include <utility>
 
 #include "utils/flag_validation.hpp"
@@ -22,6 +23,9 @@
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_uint64(query_max_plans, 1000U, "Maximum number of generated plans for a query.",
                         FLAG_IN_RANGE(1, std::numeric_limits<std::uint64_t>::max()));
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(query_max_planning_time_ms, 1000U,
+              "Time after which no more plans are generated for a query once a valid one is found. 0 means no limit.");
 
 namespace memgraph::query::plan::impl {
 
@@ -33,7 +37,7 @@ namespace {
 void AddNextExpansions(const Symbol &atom_symbol, const Matching &matching, const SymbolTable &symbol_table,
                        std::unordered_set<Symbol> &expanded_symbols,
                        std::unordered_map<Symbol, std::set<size_t>> &atom_symbol_to_expansions,
-                       std::unordered_set<size_t> &seen_expansions, std::queue<Expansion> &next_expansions) {
+                       std::unordered_set<size_t> &seen_expansions, std::deque<Expansion> &next_expansions) {
   auto atom_to_expansions_it = atom_symbol_to_expansions.find(atom_symbol);
   if (atom_to_expansions_it == atom_symbol_to_expansions.end()) {
     return;
@@ -101,7 +105,7 @@ void AddNextExpansions(const Symbol &atom_symbol, const Matching &matching, cons
       expanded_symbols.insert(symbol_table.at(*expansion.edge->identifier_));
       expanded_symbols.insert(symbol_table.at(*expansion.node2->identifier_));
     }
-    next_expansions.emplace(std::move(expansion));
+    next_expansions.emplace_back(std::move(expansion));
     atom_expansions_it = atom_expansions.erase(atom_expansions_it);
   }
   if (atom_expansions.empty()) {
@@ -113,32 +117,68 @@ void AddNextExpansions(const Symbol &atom_symbol, const Matching &matching, cons
 // the chain can no longer be continued, a different starting node is picked
 // among remaining expansions and the process continues. This is done until all
 // matching.expansions are used.
+//
+// Without an estimator the expansions are chained in the order in which they
+// become possible. With it, the possible expansion which is expected to
+// produce the fewest rows is picked greedily: an expansion to an already
+// bound node only filters the rows, otherwise the fewer vertices the new node
+// can match, the better.
 std::vector<Expansion> ExpansionsFrom(const PatternAtom *start_atom, const Matching &matching,
-                                      const SymbolTable &symbol_table) {
+                                      const SymbolTable &symbol_table, const NodeCountEstimator &estimator) {
   // Make a copy of atom_symbol_to_expansions, because we will modify it as
   // expansions are chained.
   auto atom_symbol_to_expansions = matching.atom_symbol_to_expansions;
   std::unordered_set<size_t> seen_expansions;
-  std::queue<Expansion> next_expansions;
+  std::deque<Expansion> next_expansions;
   std::unordered_set<Symbol> expanded_symbols({symbol_table.at(*start_atom->identifier_)});
+  // Unlike `expanded_symbols`, doesn't contain the symbols of the expansions
+  // which are possible, but not yet chained.
+  std::unordered_set<Symbol> bound_symbols(expanded_symbols);
 
   auto add_next_expansions = [&](const auto *atom) {
     AddNextExpansions(symbol_table.at(*atom->identifier_), matching, symbol_table, expanded_symbols,
                       atom_symbol_to_expansions, seen_expansions, next_expansions);
   };
 
+  auto expansion_cost = [&](const Expansion &expansion) {
+    if (!expansion.node2 || bound_symbols.contains(symbol_table.at(*expansion.node2->identifier_))) return 0.0;
+    return estimator(*expansion.node2);
+  };
+  // The first possible expansion can always be chained, the others only if
+  // the symbols of their range are bound by the chained ones.
+  auto pick_next_expansion = [&]() -> size_t {
+    if (!estimator) return 0;
+    size_t picked = 0;
+    auto picked_cost = expansion_cost(next_expansions.front());
+    for (size_t i = 1; i < next_expansions.size(); ++i) {
+      const auto &expansion = next_expansions[i];
+      const auto is_range_bound = std::ranges::all_of(expansion.symbols_in_range, [&](const auto &symbol) {
+        return !matching.expansion_symbols.contains(symbol) || bound_symbols.contains(symbol);
+      });
+      if (!is_range_bound) continue;
+      if (auto cost = expansion_cost(expansion); cost < picked_cost) {
+        picked = i;
+        picked_cost = cost;
+      }
+    }
+    return picked;
+  };
+
   add_next_expansions(start_atom);
-  // Potential optimization: expansions and next_expansions could be merge into
-  // a single vector and an index could be used to determine from which should
-  // additional expansions be added.
   std::vector<Expansion> expansions;
   while (!next_expansions.empty()) {
-    auto expansion = next_expansions.front();
-    next_expansions.pop();
+    auto next_it = next_expansions.begin() + static_cast<std::ptrdiff_t>(pick_next_expansion());
+    auto expansion = std::move(*next_it);
+    next_expansions.erase(next_it);
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
     if (expansions.empty() && utils::Downcast<EdgeAtom>(const_cast<PatternAtom *>(start_atom))) {
       expansion.expand_from_edge = true;
     }
+    bound_symbols.insert(symbol_table.at(*expansion.node1->identifier_));
+    if (expansion.edge) {
+      bound_symbols.insert(symbol_table.at(*expansion.edge->identifier_));
+      bound_symbols.insert(symbol_table.at(*expansion.node2->identifier_));
+    }
     expansions.emplace_back(expansion);
     add_next_expansions(expansion.node1);
     if (expansion.node2) {
@@ -192,9 +232,10 @@ FilterMatching ToFilterMatching(Matching &matching) {
 
 }  // namespace
 
-VaryMatchingStart::VaryMatchingStart(Matching matching, const SymbolTable &symbol_table)
+VaryMatchingStart::VaryMatchingStart(Matching matching, const SymbolTable &symbol_table, NodeCountEstimator estimator)
     : matching_(matching),
       symbol_table_(symbol_table),
+      estimator_(std::move(estimator)),
       graph_atoms_(ExpansionAtoms(matching.expansions, symbol_table)) {}
 
 VaryMatchingStart::iterator::iterator(VaryMatchingStart *self, bool is_done)
@@ -208,7 +249,8 @@ VaryMatchingStart::iterator::iterator(VaryMatchingStart *self, bool is_done)
     // Overwrite the original matching expansions with the new ones by
     // generating it from the first start node.
     start_atoms_it_ = self_->graph_atoms_.begin();
-    current_matching_.expansions = ExpansionsFrom(**start_atoms_it_, self_->matching_, self_->symbol_table_);
+    current_matching_.expansions =
+        ExpansionsFrom(**start_atoms_it_, self_->matching_, self_->symbol_table_, self_->estimator_);
   }
   DMG_ASSERT(start_atoms_it_ || self_->graph_atoms_.empty(),
              "start_atoms_it_ should only be nullopt when self_->graph_atoms_ is empty");
@@ -232,22 +274,24 @@ VaryMatchingStart::iterator &VaryMatchingStart::iterator::operator++() {
     return *this;
   }
   const auto &start_atom = **start_atoms_it_;
-  current_matching_.expansions = ExpansionsFrom(start_atom, self_->matching_, self_->symbol_table_);
+  current_matching_.expansions = ExpansionsFrom(start_atom, self_->matching_, self_->symbol_table_, self_->estimator_);
   return *this;
 }
 
 CartesianProduct<VaryMatchingStart> VaryMultiMatchingStarts(const std::vector<Matching> &matchings,
-                                                            const SymbolTable &symbol_table) {
+                                                            const SymbolTable &symbol_table,
+                                                            const NodeCountEstimator &estimator) {
   std::vector<VaryMatchingStart> variants;
   variants.reserve(matchings.size());
   for (const auto &matching : matchings) {
-    variants.emplace_back(matching, symbol_table);
+    variants.emplace_back(matching, symbol_table, estimator);
   }
   return MakeCartesianProduct(std::move(variants));
 }
 
 CartesianProduct<VaryMatchingStart> VaryFilterMatchingStarts(const Matching &matching,
-                                                             const SymbolTable &symbol_table) {
+                                                             const SymbolTable &symbol_table,
+                                                             const NodeCountEstimator &estimator) {
   auto filter_matchings_cnt = 0;
   for (const auto &filter : matching.filters) {
     filter_matchings_cnt += static_cast<int>(filter.matchings.size());
@@ -258,19 +302,20 @@ CartesianProduct<VaryMatchingStart> VaryFilterMatchingStarts(const Matching &mat
 
   for (const auto &filter : matching.filters) {
     for (const auto &filter_matching : filter.matchings) {
-      variants.emplace_back(filter_matching, symbol_table);
+      variants.emplace_back(filter_matching, symbol_table, estimator);
     }
   }
 
   return MakeCartesianProduct(std::move(variants));
 }
 
-VaryQueryPartMatching::VaryQueryPartMatching(SingleQueryPart query_part, const SymbolTable &symbol_table)
+VaryQueryPartMatching::VaryQueryPartMatching(SingleQueryPart query_part, const SymbolTable &symbol_table,
+                                             const NodeCountEstimator &estimator)
     : query_part_(std::move(query_part)),
-      matchings_(VaryMatchingStart(query_part_.matching, symbol_table)),
-      optional_matchings_(VaryMultiMatchingStarts(query_part_.optional_matching, symbol_table)),
-      merge_matchings_(VaryMultiMatchingStarts(query_part_.merge_matching, symbol_table)),
-      filter_matchings_(VaryFilterMatchingStarts(query_part_.matching, symbol_table)) {}
+      matchings_(VaryMatchingStart(query_part_.matching, symbol_table, estimator)),
+      optional_matchings_(VaryMultiMatchingStarts(query_part_.optional_matching, symbol_table, estimator)),
+      merge_matchings_(VaryMultiMatchingStarts(query_part_.merge_matching, symbol_table, estimator)),
+      filter_matchings_(VaryFilterMatchingStarts(query_part_.matching, symbol_table, estimator)) {}
 
 VaryQueryPartMatching::iterator::iterator(SingleQueryPart query_part, VaryMatchingStart::iterator matchings_begin,
                                           VaryMatchingStart::iterator matchings_end,
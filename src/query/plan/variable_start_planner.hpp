@@ -12,6 +12,11 @@
 /// @file
 #pragma once
 
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <variant>
+
 #include "cppitertools/imap.hpp"
 #include "cppitertools/slice.hpp"
 #include "gflags/gflags.h"
@@ -19,6 +24,7 @@
 #include "query/plan/rule_based_planner.hpp"
 
 DECLARE_uint64(query_max_plans);
+DECLARE_uint64(query_max_planning_time_ms);
 
 namespace memgraph::query::plan {
 
@@ -154,6 +160,11 @@ auto MakeCartesianProduct(std::vector<TSet> sets) {
 
 namespace impl {
 
+/// Returns the estimated number of vertices a node atom can match. Used to
+/// order the expansions of a matching; when empty, the order in which the
+/// expansions become possible is kept.
+using NodeCountEstimator = std::function<double(const NodeAtom &)>;
+
 class PatternAtomSymbolHash {
  public:
   explicit PatternAtomSymbolHash(const SymbolTable &symbol_table) : symbol_table_(symbol_table) {}
@@ -182,7 +193,7 @@ class PatternAtomSymbolEqual {
 // will have a different node as a starting node for expansion.
 class VaryMatchingStart {
  public:
-  VaryMatchingStart(Matching, const SymbolTable &);
+  VaryMatchingStart(Matching, const SymbolTable &, NodeCountEstimator = {});
 
   class iterator {
    public:
@@ -223,21 +234,24 @@ class VaryMatchingStart {
   friend class iterator;
   Matching matching_;
   const SymbolTable &symbol_table_;
+  NodeCountEstimator estimator_;
   std::unordered_set<PatternAtom *, PatternAtomSymbolHash, PatternAtomSymbolEqual> graph_atoms_;
 };
 
 // Similar to VaryMatchingStart, but varies the starting nodes for all given
 // matchings. After all matchings produce multiple alternative starts, the
 // Cartesian product of all of them is returned.
-CartesianProduct<VaryMatchingStart> VaryMultiMatchingStarts(const std::vector<Matching> &, const SymbolTable &);
+CartesianProduct<VaryMatchingStart> VaryMultiMatchingStarts(const std::vector<Matching> &, const SymbolTable &,
+                                                            const NodeCountEstimator & = {});
 
-CartesianProduct<VaryMatchingStart> VaryFilterMatchingStarts(const Matching &matching, const SymbolTable &symbol_table);
+CartesianProduct<VaryMatchingStart> VaryFilterMatchingStarts(const Matching &matching, const SymbolTable &symbol_table,
+                                                             const NodeCountEstimator &estimator = {});
 
 // Produces alternative query parts out of a single part by varying how each
 // graph matching is done.
 class VaryQueryPartMatching {
  public:
-  VaryQueryPartMatching(SingleQueryPart, const SymbolTable &);
+  VaryQueryPartMatching(SingleQueryPart, const SymbolTable &, const NodeCountEstimator & = {});
 
   class iterator {
    public:
@@ -304,7 +318,9 @@ class VaryQueryPartMatching {
 /// traversal.
 ///
 /// This planner picks different starting nodes from which to start graph
-/// traversal. Generating a single plan is backed by @c RuleBasedPlanner.
+/// traversal. From each start, the expansions are ordered greedily by the
+/// label index statistics, so the most selective nodes are matched first.
+/// Generating a single plan is backed by @c RuleBasedPlanner.
 ///
 /// @sa MakeLogicalPlan
 template <class TPlanningContext>
@@ -319,8 +335,22 @@ class VariableStartPlanner {
 
     auto single_query_parts = ExtractSingleQueryParts(std::make_unique<QueryParts>(query_parts));
 
+    // A node can match at most as many vertices as its most selective indexed
+    // label has, nodes without indexed labels can match any vertex.
+    impl::NodeCountEstimator estimator = [db = context_->db](const NodeAtom &node) {
+      auto count = std::numeric_limits<double>::max();
+      for (const auto &label : node.labels_) {
+        const auto *label_ix = std::get_if<LabelIx>(&label);
+        if (!label_ix) continue;
+        const auto label_id = db->NameToLabel(label_ix->name);
+        if (!db->LabelIndexExists(label_id)) continue;
+        count = std::min(count, static_cast<double>(db->VerticesCount(label_id)));
+      }
+      return count;
+    };
+
     for (const auto &single_query_part : single_query_parts) {
-      varying_query_matchings.emplace_back(single_query_part, symbol_table);
+      varying_query_matchings.emplace_back(single_query_part, symbol_table, estimator);
     }
 
     return iter::slice(MakeCartesianProduct(std::move(varying_query_matchings)), 0UL, FLAGS_query_max_plans);
@@ -12,7 +12,9 @@
 /// @file
 #pragma once
 
+#include <map>
 #include <optional>
+#include <vector>
 
 #include "query/db_accessor.hpp"
 #include "query/typed_value.hpp"
@@ -77,6 +79,13 @@ class VertexCountCache {
     return bounds_vertex_count.at(bounds);
   }
 
+  int64_t VerticesCount(storage::LabelId label, const std::vector<storage::PropertyId> &properties) {
+    auto key = std::make_pair(label, properties);
+    if (label_properties_vertex_count_.find(key) == label_properties_vertex_count_.end())
+      label_properties_vertex_count_[key] = db_->VerticesCount(label, properties);
+    return label_properties_vertex_count_.at(key);
+  }
+
   int64_t EdgesCount(storage::EdgeTypeId edge_type) {
     if (edge_type_edge_count_.find(edge_type) == edge_type_edge_count_.end())
       edge_type_edge_count_[edge_type] = db_->EdgesCount(edge_type);
@@ -117,12 +126,20 @@ class VertexCountCache {
     return db_->LabelPropertyIndexExists(label, property);
   }
 
+  std::vector<std::vector<storage::PropertyId>> LabelPropertyCompositeIndices(storage::LabelId label) {
+    return db_->LabelPropertyCompositeIndices(label);
+  }
+
   bool EdgeTypeIndexExists(storage::EdgeTypeId edge_type) { return db_->EdgeTypeIndexExists(edge_type); }
 
   bool EdgeTypePropertyIndexExists(storage::EdgeTypeId edge_type, storage::PropertyId property) {
     return db_->EdgeTypePropertyIndexExists(edge_type, property);
   }
 
+  bool PointIndexExists(storage::LabelId label, storage::PropertyId property) {
+    return db_->PointIndexExists(label, property);
+  }
+
   std::optional<storage::LabelIndexStats> GetIndexStats(const storage::LabelId &label) const {
     return db_->GetIndexStats(label);
   }
@@ -183,6 +200,7 @@ class VertexCountCache {
   std::unordered_map<storage::LabelId, int64_t> label_vertex_count_;
   std::unordered_map<storage::EdgeTypeId, int64_t> edge_type_edge_count_;
   std::unordered_map<LabelPropertyKey, int64_t, LabelPropertyHash> label_property_vertex_count_;
+  std::map<std::pair<storage::LabelId, std::vector<storage::PropertyId>>, int64_t> label_properties_vertex_count_;
   std::unordered_map<EdgeTypePropertyKey, int64_t, EdgeTypePropertyHash> edge_type_property_edge_count_;
   std::unordered_map<
       LabelPropertyKey,
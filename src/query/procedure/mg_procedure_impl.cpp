@@ -12,6 +12,7 @@
 #include "query/procedure/mg_procedure_impl.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstring>
 #include <exception>
@@ -19,7 +20,9 @@
 #include <optional>
 #include <regex>
 #include <stdexcept>
+#include <thread>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <variant>
 
@@ -39,6 +42,7 @@
 #include "query/string_helpers.hpp"
 #include "query/typed_value.hpp"
 #include "storage/v2/indices/text_index.hpp"
+#include "storage/v2/indices/vector_index.hpp"
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/storage_mode.hpp"
 #include "storage/v2/view.hpp"
@@ -50,6 +54,7 @@
 #include "utils/memory_tracker.hpp"
 #include "utils/string.hpp"
 #include "utils/temporal.hpp"
+#include "utils/thread.hpp"
 #include "utils/variant_helpers.hpp"
 
 #include <cppitertools/filter.hpp>
@@ -224,7 +229,7 @@ template <typename TFunc, typename... Args>
 
 // Graph mutations
 bool MgpGraphIsMutable(const mgp_graph &graph) noexcept {
-  return graph.view == memgraph::storage::View::NEW && graph.ctx != nullptr;
+  return graph.view == memgraph::storage::View::NEW && graph.ctx != nullptr && !graph.read_only;
 }
 
 bool MgpVertexIsMutable(const mgp_vertex &vertex) { return MgpGraphIsMutable(*vertex.graph); }
@@ -1660,6 +1665,7 @@ mgp_error mgp_result_set_error_msg(mgp_result *res, const char *msg) {
 mgp_error mgp_result_new_record(mgp_result *res, mgp_result_record **result) {
   return WrapExceptions(
       [res] {
+        if (res->on_new_record) res->on_new_record();
         auto *memory = res->rows.get_allocator().GetMemoryResource();
         MG_ASSERT(res->signature, "Expected to have a valid signature");
         res->rows.push_back(mgp_result_record{
@@ -2385,53 +2391,74 @@ mgp_error mgp_edges_iterator_get(mgp_edges_iterator *it, mgp_edge **result) {
       result);
 }
 
-mgp_error mgp_edges_iterator_next(mgp_edges_iterator *it, mgp_edge **result) {
-  return WrapExceptions(
-      [it] {
-        MG_ASSERT(it->in || it->out);
-        auto next = [it](const bool for_in) -> mgp_edge * {
-          auto &impl_it = for_in ? it->in_it : it->out_it;
-          const auto end = for_in ? it->in->end() : it->out->end();
-          if (*impl_it == end) {
-            MG_ASSERT(!it->current_e,
-                      "Iteration is already done, so it->current_e "
-                      "should have been set to std::nullopt");
-            return nullptr;
-          }
+namespace {
+mgp_vertex_id VertexId(const mgp_vertex &v) {
+  return mgp_vertex_id{.as_int = std::visit([](const auto &impl) { return impl.Gid().AsInt(); }, v.impl)};
+}
+
+mgp_edge *NextEdge(mgp_edges_iterator *it) {
+  MG_ASSERT(it->in || it->out);
+  auto next = [it](const bool for_in) -> mgp_edge * {
+    auto &impl_it = for_in ? it->in_it : it->out_it;
+    const auto end = for_in ? it->in->end() : it->out->end();
+    if (*impl_it == end) {
+      MG_ASSERT(!it->current_e,
+                "Iteration is already done, so it->current_e "
+                "should have been set to std::nullopt");
+      return nullptr;
+    }
 
-          ++*impl_it;
+    ++*impl_it;
 
 #ifdef MG_ENTERPRISE
-          if (memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
-            NextPermittedEdge(*it, for_in);
-          }
+    if (memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
+      NextPermittedEdge(*it, for_in);
+    }
 #endif
 
-          if (*impl_it == end) {
-            it->current_e = std::nullopt;
-            return nullptr;
-          }
-          std::visit(memgraph::utils::Overloaded{
-                         [&](memgraph::query::DbAccessor *) {
-                           auto edgeAcc = **impl_it;
-                           it->current_e.emplace(edgeAcc, edgeAcc.From(), edgeAcc.To(), it->source_vertex.graph,
-                                                 it->GetMemoryResource());
-                         },
-                         [&](memgraph::query::SubgraphDbAccessor *impl) {
-                           auto edgeAcc = **impl_it;
-                           it->current_e.emplace(
-                               edgeAcc, memgraph::query::SubgraphVertexAccessor(edgeAcc.From(), impl->getGraph()),
-                               memgraph::query::SubgraphVertexAccessor(edgeAcc.To(), impl->getGraph()),
-                               it->source_vertex.graph, it->GetMemoryResource());
-                         }},
-                     it->source_vertex.graph->impl);
+    if (*impl_it == end) {
+      it->current_e = std::nullopt;
+      return nullptr;
+    }
+    std::visit(memgraph::utils::Overloaded{
+                   [&](memgraph::query::DbAccessor *) {
+                     auto edgeAcc = **impl_it;
+                     it->current_e.emplace(edgeAcc, edgeAcc.From(), edgeAcc.To(), it->source_vertex.graph,
+                                           it->GetMemoryResource());
+                   },
+                   [&](memgraph::query::SubgraphDbAccessor *impl) {
+                     auto edgeAcc = **impl_it;
+                     it->current_e.emplace(
+                         edgeAcc, memgraph::query::SubgraphVertexAccessor(edgeAcc.From(), impl->getGraph()),
+                         memgraph::query::SubgraphVertexAccessor(edgeAcc.To(), impl->getGraph()),
+                         it->source_vertex.graph, it->GetMemoryResource());
+                   }},
+               it->source_vertex.graph->impl);
 
-          return &*it->current_e;
-        };
-        if (it->in_it) {
-          return next(true);
+    return &*it->current_e;
+  };
+  if (it->in_it) {
+    return next(true);
+  }
+  return next(false);
+}
+}  // namespace
+
+mgp_error mgp_edges_iterator_next(mgp_edges_iterator *it, mgp_edge **result) {
+  return WrapExceptions([it] { return NextEdge(it); }, result);
+}
+
+mgp_error mgp_edges_iterator_next_neighbor_ids(mgp_edges_iterator *it, mgp_vertex_id *ids, size_t capacity,
+                                               size_t *result) {
+  return WrapExceptions(
+      [it, ids, capacity] {
+        const auto for_in = it->in_it.has_value();
+        size_t count = 0;
+        for (; count < capacity && it->current_e; ++count) {
+          ids[count] = VertexId(for_in ? it->current_e->from : it->current_e->to);
+          NextEdge(it);
         }
-        return next(false);
+        return count;
       },
       result);
 }
@@ -2672,6 +2699,43 @@ mgp_error mgp_graph_get_vertex_by_id(mgp_graph *graph, mgp_vertex_id id, mgp_mem
       result);
 }
 
+mgp_error mgp_graph_get_vertices_property(mgp_graph *graph, const mgp_vertex_id *ids, size_t count,
+                                          const char *property_name, mgp_memory *memory, mgp_value **values) {
+  return WrapExceptions([graph, ids, count, property_name, memory, values] {
+    const auto property =
+        std::visit([property_name](auto *impl) { return impl->NameToProperty(property_name); }, graph->impl);
+    size_t written = 0;
+    memgraph::utils::OnScopeExit destroy_written{[values, &written] {
+      for (size_t i = 0; i < written; ++i) mgp_value_destroy(values[i]);
+    }};
+    for (; written < count; ++written) {
+      const auto gid = memgraph::storage::Gid::FromInt(ids[written].as_int);
+      auto maybe_vertex = std::visit([graph, gid](auto *impl) { return impl->FindVertex(gid, graph->view); },
+                                     graph->impl);
+      auto value = memgraph::storage::PropertyValue();
+      if (maybe_vertex) {
+        auto maybe_prop = maybe_vertex->GetProperty(graph->view, property);
+        if (maybe_prop.HasError()) {
+          switch (maybe_prop.GetError()) {
+            case memgraph::storage::Error::DELETED_OBJECT:
+              throw DeletedObjectException{"Cannot get a property of a deleted vertex!"};
+            case memgraph::storage::Error::NONEXISTENT_OBJECT:
+              LOG_FATAL(
+                  "Query modules shouldn't have access to nonexistent objects when getting a property of a vertex.");
+            case memgraph::storage::Error::PROPERTIES_DISABLED:
+            case memgraph::storage::Error::VERTEX_HAS_EDGES:
+            case memgraph::storage::Error::SERIALIZATION_ERROR:
+              LOG_FATAL("Unexpected error when getting a property of a vertex.");
+          }
+        }
+        value = std::move(*maybe_prop);
+      }
+      values[written] = NewRawMgpObject<mgp_value>(memory, std::move(value));
+    }
+    destroy_written.Disable();
+  });
+}
+
 mgp_error mgp_create_label_index(mgp_graph *graph, const char *label, int *result) {
   return WrapExceptions(
       [graph, label]() {
@@ -3399,6 +3463,10 @@ mgp_error mgp_graph_has_text_index(mgp_graph *graph, const char *index_name, int
   });
 }
 
+mgp_error mgp_graph_refresh_text_index(mgp_graph *graph, const char *index_name) {
+  return WrapExceptions([graph, index_name]() { graph->getImpl()->TextIndexRefresh(index_name); });
+}
+
 mgp_vertex *GetVertexByGid(mgp_graph *graph, memgraph::storage::Gid id, mgp_memory *memory) {
   auto get_vertex_by_gid = memgraph::utils::Overloaded{
       [graph, id, memory](memgraph::query::DbAccessor *impl) -> mgp_vertex * {
@@ -3522,6 +3590,99 @@ mgp_error mgp_graph_aggregate_over_text_index(mgp_graph *graph, const char *inde
   });
 }
 
+void WrapVectorSearch(mgp_graph *graph, mgp_memory *memory, mgp_map **result,
+                      const std::vector<std::pair<memgraph::storage::Gid, double>> &found_vertices = {},
+                      const std::optional<std::string> &error_msg = std::nullopt) {
+  if (const auto err = mgp_map_make_empty(memory, result); err != mgp_error::MGP_ERROR_NO_ERROR) {
+    throw std::logic_error("Retrieving vector search results failed during creation of a mgp_map");
+  }
+
+  if (error_msg.has_value()) {
+    mgp_value *error_value;
+    if (const auto err = mgp_value_make_string(error_msg->data(), memory, &error_value);
+        err != mgp_error::MGP_ERROR_NO_ERROR) {
+      throw std::logic_error("Retrieving vector search results failed during creation of a string mgp_value");
+    }
+    if (const auto err = mgp_map_insert(*result, "error_msg", error_value); err != mgp_error::MGP_ERROR_NO_ERROR) {
+      throw std::logic_error("Retrieving vector index search error failed during insertion into mgp_map");
+    }
+    return;
+  }
+
+  mgp_list *search_results{};
+  if (const auto err = mgp_list_make_empty(found_vertices.size(), memory, &search_results);
+      err != mgp_error::MGP_ERROR_NO_ERROR) {
+    throw std::logic_error("Retrieving vector search results failed during creation of a mgp_list");
+  }
+
+  for (const auto &[vertex_id, similarity] : found_vertices) {
+    // Vertices outside of a subgraph aren't returned.
+    auto *found_vertex = GetVertexByGid(graph, vertex_id, memory);
+    if (!found_vertex) continue;
+
+    mgp_map *entry{};
+    if (const auto err = mgp_map_make_empty(memory, &entry); err != mgp_error::MGP_ERROR_NO_ERROR) {
+      throw std::logic_error("Retrieving vector search results failed during creation of a mgp_map");
+    }
+    mgp_value *vertex;
+    if (const auto err = mgp_value_make_vertex(found_vertex, &vertex); err != mgp_error::MGP_ERROR_NO_ERROR) {
+      throw std::logic_error("Retrieving vector search results failed during creation of a vertex mgp_value");
+    }
+    mgp_value *similarity_value;
+    if (const auto err = mgp_value_make_double(similarity, memory, &similarity_value);
+        err != mgp_error::MGP_ERROR_NO_ERROR) {
+      throw std::logic_error("Retrieving vector search results failed during creation of a double mgp_value");
+    }
+    if (mgp_map_insert(entry, "node", vertex) != mgp_error::MGP_ERROR_NO_ERROR ||
+        mgp_map_insert(entry, "similarity", similarity_value) != mgp_error::MGP_ERROR_NO_ERROR) {
+      throw std::logic_error("Retrieving vector search results failed during insertion into mgp_map");
+    }
+    mgp_value *entry_value;
+    if (const auto err = mgp_value_make_map(entry, &entry_value); err != mgp_error::MGP_ERROR_NO_ERROR) {
+      throw std::logic_error("Retrieving vector search results failed during creation of a map mgp_value");
+    }
+    if (const auto err = mgp_list_append(search_results, entry_value); err != mgp_error::MGP_ERROR_NO_ERROR) {
+      throw std::logic_error(
+          "Retrieving vector search results failed during insertion of the mgp_value into the result list");
+    }
+  }
+
+  mgp_value *search_results_value;
+  if (const auto err = mgp_value_make_list(search_results, &search_results_value);
+      err != mgp_error::MGP_ERROR_NO_ERROR) {
+    throw std::logic_error("Retrieving vector search results failed during creation of a list mgp_value");
+  }
+  if (const auto err = mgp_map_insert(*result, "search_results", search_results_value);
+      err != mgp_error::MGP_ERROR_NO_ERROR) {
+    throw std::logic_error("Retrieving vector index search results failed during insertion into mgp_map");
+  }
+}
+
+mgp_error mgp_graph_search_vector_index(mgp_graph *graph, const char *label, const char *property, mgp_list *query,
+                                        size_t k, mgp_memory *memory, mgp_map **result) {
+  return WrapExceptions([graph, label, property, query, k, memory, result]() {
+    auto *impl = graph->getImpl();
+    const auto label_id = impl->NameToLabel(label);
+    const auto property_id = impl->NameToProperty(property);
+    const auto dimension = impl->VectorIndexDimension(label_id, property_id);
+    if (!dimension) {
+      WrapVectorSearch(graph, memory, result, {}, fmt::format("There is no vector index on :{}({}).", label, property));
+      return;
+    }
+    const auto query_value = ToPropertyValue(*query);
+    if (!memgraph::storage::NormalizedVector(query_value, *dimension)) {
+      WrapVectorSearch(graph, memory, result, {},
+                       fmt::format("The query vector must be a non-zero list of {} numbers.", *dimension));
+      return;
+    }
+    std::vector<std::pair<memgraph::storage::Gid, double>> found_vertices;
+    for (const auto &[vertex, similarity] : impl->VectorIndexSearch(label_id, property_id, query_value, k, graph->view)) {
+      found_vertices.emplace_back(vertex.Gid(), similarity);
+    }
+    WrapVectorSearch(graph, memory, result, found_vertices);
+  });
+}
+
 #ifdef MG_ENTERPRISE
 namespace {
 void NextPermitted(mgp_vertices_iterator &it) {
@@ -3545,10 +3706,13 @@ void NextPermitted(mgp_vertices_iterator &it) {
 
 /// @throw anything VerticesIterable may throw
 mgp_vertices_iterator::mgp_vertices_iterator(mgp_graph *graph, memgraph::utils::MemoryResource *memory)
-    : memory(memory),
-      graph(graph),
-      vertices(std::visit([graph](auto *impl) { return impl->Vertices(graph->view); }, graph->impl)),
-      current_it(vertices.begin()) {
+    : mgp_vertices_iterator(graph,
+                            std::visit([graph](auto *impl) { return impl->Vertices(graph->view); }, graph->impl),
+                            memory) {}
+
+mgp_vertices_iterator::mgp_vertices_iterator(mgp_graph *graph, memgraph::query::VerticesIterable iterable,
+                                             memgraph::utils::MemoryResource *memory)
+    : memory(memory), graph(graph), vertices(std::move(iterable)), current_it(vertices.begin()) {
 #ifdef MG_ENTERPRISE
   if (memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
     NextPermitted(*this);
@@ -3587,45 +3751,308 @@ mgp_error mgp_vertices_iterator_get(mgp_vertices_iterator *it, mgp_vertex **resu
       result);
 }
 
+namespace {
+mgp_vertex *NextVertex(mgp_vertices_iterator *it) {
+  if (it->current_it == it->vertices.end()) {
+    MG_ASSERT(!it->current_v,
+              "Iteration is already done, so it->current_v "
+              "should have been set to std::nullopt");
+    return nullptr;
+  }
+
+  ++it->current_it;
+#ifdef MG_ENTERPRISE
+  if (memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
+    NextPermitted(*it);
+  }
+#endif
+  if (it->current_it == it->vertices.end()) {
+    it->current_v = std::nullopt;
+    return nullptr;
+  }
+
+  memgraph::utils::OnScopeExit clean_up([it] { it->current_v = std::nullopt; });
+  std::visit(memgraph::utils::Overloaded{[it](memgraph::query::DbAccessor *) {
+                                           it->current_v.emplace(*it->current_it, it->graph, it->GetMemoryResource());
+                                         },
+                                         [it](memgraph::query::SubgraphDbAccessor *impl) {
+                                           it->current_v.emplace(
+                                               memgraph::query::SubgraphVertexAccessor(*it->current_it,
+                                                                                       impl->getGraph()),
+                                               it->graph, it->GetMemoryResource());
+                                         }},
+             it->graph->impl);
+
+  clean_up.Disable();
+  return &*it->current_v;
+}
+}  // namespace
+
 mgp_error mgp_vertices_iterator_next(mgp_vertices_iterator *it, mgp_vertex **result) {
+  return WrapExceptions([it] { return NextVertex(it); }, result);
+}
+
+mgp_error mgp_vertices_iterator_next_ids(mgp_vertices_iterator *it, mgp_vertex_id *ids, size_t capacity,
+                                         size_t *result) {
   return WrapExceptions(
-      [it]() -> mgp_vertex * {
-        if (it->current_it == it->vertices.end()) {
-          MG_ASSERT(!it->current_v,
-                    "Iteration is already done, so it->current_v "
-                    "should have been set to std::nullopt");
-          return nullptr;
+      [it, ids, capacity] {
+        size_t count = 0;
+        for (; count < capacity && it->current_v; ++count) {
+          ids[count] = VertexId(*it->current_v);
+          NextVertex(it);
         }
+        return count;
+      },
+      result);
+}
 
-        ++it->current_it;
+mgp_csr::mgp_csr(mgp_graph *graph, memgraph::utils::MemoryResource *memory)
+    : memory(memory), vertex_ids(memory), offsets(memory), targets(memory) {
+  mgp_memory mgp_mem{memory};
+  auto vertices = NewMgpObject<mgp_vertices_iterator>(&mgp_mem, graph);
+  memgraph::utils::pmr::vector<int64_t> target_gids(memory);
+  offsets.push_back(0);
+  for (auto *vertex = vertices->current_v ? &*vertices->current_v : nullptr; vertex; vertex = NextVertex(&*vertices)) {
+    vertex_ids.push_back(VertexId(*vertex));
+    mgp_edges_iterator *raw_edges{nullptr};
+    if (const auto err = mgp_vertex_iter_out_edges(vertex, &mgp_mem, &raw_edges);
+        err != mgp_error::MGP_ERROR_NO_ERROR) {
+      throw std::logic_error("Exporting the graph failed due to failure of iterating the outbound edges of a vertex");
+    }
+    const MgpUniquePtr<mgp_edges_iterator> edges{raw_edges, &DeleteRawMgpObject<mgp_edges_iterator>};
+    for (auto *edge = edges->current_e ? &*edges->current_e : nullptr; edge; edge = NextEdge(&*edges)) {
+      target_gids.push_back(VertexId(edge->to).as_int);
+    }
+    offsets.push_back(target_gids.size());
+  }
+
+  std::unordered_map<int64_t, size_t> index_of_gid;
+  index_of_gid.reserve(vertex_ids.size());
+  for (size_t i = 0; i < vertex_ids.size(); ++i) index_of_gid.emplace(vertex_ids[i].as_int, i);
+
+  // Edges to vertices which aren't iterated, e.g. the ones the user isn't permitted to see, are left out
+  targets.reserve(target_gids.size());
+  size_t next_edge = 0;
+  for (size_t i = 0; i + 1 < offsets.size(); ++i) {
+    for (; next_edge < offsets[i + 1]; ++next_edge) {
+      if (auto it = index_of_gid.find(target_gids[next_edge]); it != index_of_gid.end()) {
+        targets.push_back(it->second);
+      }
+    }
+    offsets[i + 1] = targets.size();
+  }
+}
+
+void mgp_csr_destroy(mgp_csr *csr) { DeleteRawMgpObject(csr); }
+
+mgp_error mgp_graph_export_csr(mgp_graph *graph, mgp_memory *memory, mgp_csr **result) {
+  return WrapExceptions([graph, memory] { return NewRawMgpObject<mgp_csr>(memory, graph); }, result);
+}
+
+mgp_error mgp_csr_vertex_count(mgp_csr *csr, size_t *result) {
+  return WrapExceptions([csr] { return csr->vertex_ids.size(); }, result);
+}
+
+mgp_error mgp_csr_edge_count(mgp_csr *csr, size_t *result) {
+  return WrapExceptions([csr] { return csr->targets.size(); }, result);
+}
+
+mgp_error mgp_csr_vertex_ids(mgp_csr *csr, const mgp_vertex_id **result) {
+  return WrapExceptions([csr] { return static_cast<const mgp_vertex_id *>(csr->vertex_ids.data()); }, result);
+}
+
+mgp_error mgp_csr_offsets(mgp_csr *csr, const size_t **result) {
+  return WrapExceptions([csr] { return static_cast<const size_t *>(csr->offsets.data()); }, result);
+}
+
+mgp_error mgp_csr_targets(mgp_csr *csr, const size_t **result) {
+  return WrapExceptions([csr] { return static_cast<const size_t *>(csr->targets.data()); }, result);
+}
+
+mgp_projection::mgp_projection(std::shared_ptr<const memgraph::storage::GraphProjection> impl,
+                               memgraph::utils::MemoryResource *memory)
+    : memory(memory), impl(std::move(impl)), vertex_ids(memory) {
+  vertex_ids.reserve(this->impl->vertices.size());
+  for (const auto gid : this->impl->vertices) vertex_ids.push_back(mgp_vertex_id{.as_int = gid.AsInt()});
+}
+
+mgp_error mgp_graph_get_projection(mgp_graph *graph, const char *name, const char *const *labels, size_t label_count,
+                                   const char *const *edge_types, size_t edge_type_count,
+                                   const char *const *properties, size_t property_count, mgp_memory *memory,
+                                   mgp_projection **result) {
+  return WrapExceptions(
+      [=] {
+        auto *const *db = std::get_if<memgraph::query::DbAccessor *>(&graph->impl);
+        if (!db) {
+          throw std::logic_error("Projections of subgraphs aren't supported");
+        }
 #ifdef MG_ENTERPRISE
-        if (memgraph::license::global_license_checker.IsEnterpriseValidFast()) {
-          NextPermitted(*it);
+        if (memgraph::license::global_license_checker.IsEnterpriseValidFast() && graph->ctx &&
+            graph->ctx->auth_checker) {
+          throw std::logic_error("Projections aren't supported with fine-grained access control");
         }
 #endif
-        if (it->current_it == it->vertices.end()) {
-          it->current_v = std::nullopt;
-          return nullptr;
+        memgraph::storage::GraphProjectionFilter filter;
+        for (size_t i = 0; i < label_count; ++i) filter.labels.push_back((*db)->NameToLabel(labels[i]));
+        for (size_t i = 0; i < edge_type_count; ++i) filter.edge_types.push_back((*db)->NameToEdgeType(edge_types[i]));
+        for (size_t i = 0; i < property_count; ++i) filter.properties.push_back((*db)->NameToProperty(properties[i]));
+        return NewRawMgpObject<mgp_projection>(memory, (*db)->GetGraphProjection(name, filter, graph->view));
+      },
+      result);
+}
+
+void mgp_projection_destroy(mgp_projection *projection) { DeleteRawMgpObject(projection); }
+
+mgp_error mgp_projection_vertex_count(mgp_projection *projection, size_t *result) {
+  return WrapExceptions([projection] { return projection->vertex_ids.size(); }, result);
+}
+
+mgp_error mgp_projection_edge_count(mgp_projection *projection, size_t *result) {
+  return WrapExceptions([projection] { return projection->impl->targets.size(); }, result);
+}
+
+mgp_error mgp_projection_vertex_ids(mgp_projection *projection, const mgp_vertex_id **result) {
+  return WrapExceptions([projection] { return static_cast<const mgp_vertex_id *>(projection->vertex_ids.data()); },
+                        result);
+}
+
+mgp_error mgp_projection_offsets(mgp_projection *projection, const size_t **result) {
+  return WrapExceptions([projection] { return projection->impl->offsets.data(); }, result);
+}
+
+mgp_error mgp_projection_targets(mgp_projection *projection, const size_t **result) {
+  return WrapExceptions([projection] { return projection->impl->targets.data(); }, result);
+}
+
+mgp_error mgp_projection_vertex_property(mgp_projection *projection, size_t vertex, size_t property,
+                                         mgp_memory *memory, mgp_value **result) {
+  return WrapExceptions(
+      [=] {
+        const auto &impl = *projection->impl;
+        const auto property_count = impl.filter.properties.size();
+        if (vertex >= impl.vertices.size() || property >= property_count) {
+          throw std::out_of_range("The vertex or the property is out of the range of the projection");
         }
+        return NewRawMgpObject<mgp_value>(memory, impl.property_values[vertex * property_count + property]);
+      },
+      result);
+}
 
-        memgraph::utils::OnScopeExit clean_up([it] { it->current_v = std::nullopt; });
-        std::visit(memgraph::utils::Overloaded{[it](memgraph::query::DbAccessor *) {
-                                                 it->current_v.emplace(*it->current_it, it->graph,
-                                                                       it->GetMemoryResource());
-                                               },
-                                               [it](memgraph::query::SubgraphDbAccessor *impl) {
-                                                 it->current_v.emplace(memgraph::query::SubgraphVertexAccessor(
-                                                                           *it->current_it, impl->getGraph()),
-                                                                       it->graph, it->GetMemoryResource());
-                                               }},
-                   it->graph->impl);
+mgp_vertices_partitions::mgp_vertices_partitions(mgp_graph *graph, size_t count,
+                                                 memgraph::utils::MemoryResource *memory)
+    : memory(memory), graph(*graph), partitions(memory) {
+  this->graph.read_only = true;
+  auto *db = std::get_if<memgraph::query::DbAccessor *>(&graph->impl);
+  bool can_split = db && count > 1 && (*db)->GetTransactionId();
+#ifdef MG_ENTERPRISE
+  // Like the Gather operator, the fine-grained access checks aren't run concurrently
+  if (memgraph::license::global_license_checker.IsEnterpriseValidFast() && graph->ctx && graph->ctx->auth_checker) {
+    can_split = false;
+  }
+#endif
+  if (can_split) {
+    for (auto &chunk : (*db)->ChunkedVertices(graph->view, count)) partitions.push_back(std::move(chunk));
+  }
+  if (partitions.empty()) {
+    partitions.push_back(std::visit([graph](auto *impl) { return impl->Vertices(graph->view); }, graph->impl));
+  }
+}
 
-        clean_up.Disable();
-        return &*it->current_v;
+mgp_error mgp_graph_partition_vertices(mgp_graph *graph, size_t count, mgp_memory *memory,
+                                       mgp_vertices_partitions **result) {
+  return WrapExceptions(
+      [graph, count, memory] {
+        if (count == 0) {
+          throw std::invalid_argument("The vertices must be split into at least one partition");
+        }
+        return NewRawMgpObject<mgp_vertices_partitions>(memory, graph, count);
       },
       result);
 }
 
+void mgp_vertices_partitions_destroy(mgp_vertices_partitions *partitions) { DeleteRawMgpObject(partitions); }
+
+mgp_error mgp_vertices_partitions_size(mgp_vertices_partitions *partitions, size_t *result) {
+  return WrapExceptions([partitions] { return partitions->partitions.size(); }, result);
+}
+
+mgp_error mgp_parallel_default_threads(size_t *result) {
+  return WrapExceptions([] { return std::max<size_t>(std::thread::hardware_concurrency(), 1); }, result);
+}
+
+mgp_error mgp_vertices_partitions_run(mgp_vertices_partitions *partitions, size_t threads,
+                                      mgp_vertices_partition_cb cb, void *payload) {
+  mgp_error first_error = mgp_error::MGP_ERROR_NO_ERROR;
+  const auto run_error = WrapExceptions([partitions, threads, cb, payload, &first_error] {
+    if (std::exchange(partitions->was_run, true)) {
+      throw std::logic_error("The vertices partitions have already been run");
+    }
+    auto &graph = partitions->graph;
+    auto *db = graph.getImpl();
+    const auto transaction_id = db->GetTransactionId();
+    const auto num_partitions = partitions->partitions.size();
+    const auto num_threads =
+        std::min<size_t>(threads != 0 ? threads : std::max<size_t>(std::thread::hardware_concurrency(), 1),
+                         num_partitions);
+
+    std::atomic<size_t> next_partition{0};
+    std::atomic<bool> stop{false};
+    std::mutex error_lock;
+    auto run_worker = [&] {
+      if (transaction_id) db->TrackCurrentThreadAllocations();
+      memgraph::utils::OnScopeExit untrack{[db, &transaction_id] {
+        if (transaction_id) db->UntrackCurrentThreadAllocations();
+      }};
+      // The memory of the procedure isn't thread-safe
+      mgp_memory worker_memory{memgraph::utils::NewDeleteResource()};
+      auto set_error = [&](mgp_error error) {
+        stop.store(true, std::memory_order_release);
+        const std::lock_guard guard(error_lock);
+        if (first_error == mgp_error::MGP_ERROR_NO_ERROR) first_error = error;
+      };
+      for (auto idx = next_partition.fetch_add(1, std::memory_order_acq_rel);
+           idx < num_partitions && !stop.load(std::memory_order_acquire);
+           idx = next_partition.fetch_add(1, std::memory_order_acq_rel)) {
+        mgp_vertices_iterator *raw_vertices{nullptr};
+        if (const auto err = WrapExceptions(
+                [&] {
+                  return NewRawMgpObject<mgp_vertices_iterator>(&worker_memory, &graph,
+                                                                std::move(partitions->partitions[idx]));
+                },
+                &raw_vertices);
+            err != mgp_error::MGP_ERROR_NO_ERROR) {
+          set_error(err);
+          break;
+        }
+        const MgpUniquePtr<mgp_vertices_iterator> vertices{raw_vertices, &DeleteRawMgpObject<mgp_vertices_iterator>};
+        if (const auto err = cb(idx, vertices.get(), &worker_memory, payload); err != mgp_error::MGP_ERROR_NO_ERROR) {
+          set_error(err);
+          break;
+        }
+      }
+    };
+
+    db->SetParallelReadersActive(true);
+    memgraph::utils::OnScopeExit deactivate{[db] { db->SetParallelReadersActive(false); }};
+    std::vector<std::jthread> workers;
+    workers.reserve(num_threads);
+    try {
+      for (size_t i = 0; i < num_threads; ++i) {
+        workers.emplace_back([&run_worker] {
+          memgraph::utils::ThreadSetName("ProcWorker");
+          run_worker();
+        });
+      }
+    } catch (...) {
+      // The started workers still hold references to the state of this frame
+      stop.store(true, std::memory_order_release);
+      workers.clear();
+      throw;
+    }
+  });
+  return run_error != mgp_error::MGP_ERROR_NO_ERROR ? run_error : first_error;
+}
+
 /// Type System
 ///
 /// All types are allocated globally, so that we simplify the API and minimize
@@ -16,6 +16,7 @@
 
 #include "mg_procedure.h"
 
+#include <functional>
 #include <memory>
 #include <optional>
 #include <ostream>
@@ -564,6 +565,9 @@ struct mgp_graph {
   // `ctx` field is out of place here.
   memgraph::query::ExecutionContext *ctx;
   memgraph::storage::StorageMode storage_mode;
+  /// Set for the graph the workers of `mgp_vertices_partitions` read, which
+  /// mustn't be changed from their threads.
+  bool read_only{false};
 
   memgraph::query::DbAccessor *getImpl() const {
     return std::visit(
@@ -613,6 +617,9 @@ struct mgp_result {
   memgraph::utils::pmr::vector<mgp_result_record> rows;
   std::optional<memgraph::utils::pmr::string> error_msg;
   bool is_transactional = true;
+  /// Called before a new record is started, when all records in `rows` are
+  /// complete. Set when the records are pulled while the procedure runs.
+  std::function<void()> on_new_record;
 };
 
 struct mgp_func_result {
@@ -721,6 +728,11 @@ struct mgp_vertices_iterator {
   /// @throw anything VerticesIterable may throw
   mgp_vertices_iterator(mgp_graph *graph, memgraph::utils::MemoryResource *memory);
 
+  /// Iterates only the given `vertices` of the graph.
+  /// @throw anything VerticesIterable may throw
+  mgp_vertices_iterator(mgp_graph *graph, memgraph::query::VerticesIterable vertices,
+                        memgraph::utils::MemoryResource *memory);
+
   memgraph::utils::MemoryResource *GetMemoryResource() const { return memory; }
 
   memgraph::utils::MemoryResource *memory;
@@ -730,6 +742,54 @@ struct mgp_vertices_iterator {
   std::optional<mgp_vertex> current_v;
 };
 
+struct mgp_vertices_partitions {
+  using allocator_type = memgraph::utils::Allocator<mgp_vertices_partitions>;
+
+  /// @throw anything VerticesIterable may throw
+  mgp_vertices_partitions(mgp_graph *graph, size_t count, memgraph::utils::MemoryResource *memory);
+
+  memgraph::utils::MemoryResource *GetMemoryResource() const { return memory; }
+
+  memgraph::utils::MemoryResource *memory;
+  /// Read-only copy of the partitioned graph, shared by the workers.
+  mgp_graph graph;
+  memgraph::utils::pmr::vector<memgraph::query::VerticesIterable> partitions;
+  /// The iterables are consumed by the workers, so the partitions can be run once.
+  bool was_run{false};
+};
+
+/// Outbound adjacency of a graph in the compressed sparse row format.
+struct mgp_csr {
+  using allocator_type = memgraph::utils::Allocator<mgp_csr>;
+
+  /// Numbers the vertices in the order of `mgp_vertices_iterator`.
+  /// @throw anything VerticesIterable may throw
+  mgp_csr(mgp_graph *graph, memgraph::utils::MemoryResource *memory);
+
+  memgraph::utils::MemoryResource *GetMemoryResource() const { return memory; }
+
+  memgraph::utils::MemoryResource *memory;
+  memgraph::utils::pmr::vector<mgp_vertex_id> vertex_ids;
+  /// `offsets[i]` to `offsets[i + 1]` are the positions of the targets of the vertex `i` in `targets`.
+  memgraph::utils::pmr::vector<size_t> offsets;
+  memgraph::utils::pmr::vector<size_t> targets;
+};
+
+struct mgp_projection {
+  using allocator_type = memgraph::utils::Allocator<mgp_projection>;
+
+  /// @throw std::bad_alloc
+  mgp_projection(std::shared_ptr<const memgraph::storage::GraphProjection> impl,
+                 memgraph::utils::MemoryResource *memory);
+
+  memgraph::utils::MemoryResource *GetMemoryResource() const { return memory; }
+
+  memgraph::utils::MemoryResource *memory;
+  std::shared_ptr<const memgraph::storage::GraphProjection> impl;
+  /// IDs of `impl->vertices` in the representation of the C API.
+  memgraph::utils::pmr::vector<mgp_vertex_id> vertex_ids;
+};
+
 struct mgp_type {
   memgraph::query::procedure::CypherTypePtr impl;
 };
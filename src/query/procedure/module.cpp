@@ -816,6 +816,9 @@ class SharedLibraryModule final : public Module {
 
   std::optional<std::filesystem::path> Path() const override { return file_path_; }
 
+  // Unlike Python procedures, which hold the GIL while they yield records.
+  bool CanRunOnAnyThread() const override { return true; }
+
  private:
   /// Path as requested for loading the module from a library.
   std::filesystem::path file_path_;
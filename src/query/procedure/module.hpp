@@ -30,6 +30,7 @@
 #include <string_view>
 #include <unordered_map>
 
+class CallProcedureStreamTest;
 class CypherMainVisitorTest;
 
 namespace memgraph::query::procedure {
@@ -54,10 +55,15 @@ class Module {
   virtual const std::map<std::string, mgp_func, std::less<>> *Functions() const = 0;
 
   virtual std::optional<std::filesystem::path> Path() const = 0;
+
+  /// Returns true if the procedures can run on a thread other than the one
+  /// which pulls their records, so the records can be pulled while they run.
+  virtual bool CanRunOnAnyThread() const { return false; }
 };
 
 /// Thread-safe registration of modules from libraries, uses utils::RWLock.
 class ModuleRegistry final {
+  friend CallProcedureStreamTest;
   friend CypherMainVisitorTest;
 
  private:
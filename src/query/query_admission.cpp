@@ -0,0 +1,214 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#include "query/query_admission.hpp"
+
+#include <algorithm>
+#include <charconv>
+
+#include "query/query_user.hpp"
+#include "utils/event_counter.hpp"
+#include "utils/event_histogram.hpp"
+#include "utils/on_scope_exit.hpp"
+#include "utils/string.hpp"
+
+namespace memgraph::metrics {
+extern const Event QueuedQueries;
+extern const Event QueryAdmissionTimeouts;
+extern const Event QueryAdmissionWaitLatency_us;
+}  // namespace memgraph::metrics
+
+namespace memgraph::query {
+
+namespace {
+
+// How often the waiting queries check whether they have to be aborted.
+constexpr auto kAbortCheckInterval = std::chrono::milliseconds{100};
+
+std::optional<uint64_t> ParseNumber(std::string_view text) {
+  text = utils::Trim(text);
+  uint64_t value = 0;
+  const auto *end = text.data() + text.size();
+  const auto [ptr, ec] = std::from_chars(text.data(), end, value);
+  if (text.empty() || ec != std::errc{} || ptr != end) return std::nullopt;
+  return value;
+}
+
+std::optional<QueryAdmission::LaneConfig> ParseLane(std::string_view text) {
+  using Selector = QueryAdmission::LaneConfig::Selector;
+  const auto lane_and_limits = utils::Split(text, "=", 1);
+  if (lane_and_limits.size() != 2) return std::nullopt;
+
+  QueryAdmission::LaneConfig lane{.name = std::string{text}};
+  const auto selector = utils::Trim(lane_and_limits[0]);
+  if (selector == "read") {
+    lane.selector = Selector::READ;
+  } else if (selector == "write") {
+    lane.selector = Selector::WRITE;
+  } else if (selector == "read_write") {
+    lane.selector = Selector::READ_WRITE;
+  } else {
+    const auto kind_and_name = utils::Split(selector, ":", 1);
+    if (kind_and_name.size() != 2 || utils::Trim(kind_and_name[1]).empty()) return std::nullopt;
+    if (kind_and_name[0] == "db") {
+      lane.selector = Selector::DATABASE;
+    } else if (kind_and_name[0] == "user") {
+      lane.selector = Selector::USER;
+    } else if (kind_and_name[0] == "role") {
+      lane.selector = Selector::ROLE;
+    } else {
+      return std::nullopt;
+    }
+    lane.selector_name = utils::Trim(kind_and_name[1]);
+  }
+
+  const auto limits = utils::Split(lane_and_limits[1], ":");
+  if (limits.empty() || limits.size() > 2) return std::nullopt;
+  const auto max_running = ParseNumber(limits[0]);
+  if (!max_running || *max_running == 0) return std::nullopt;
+  lane.max_running = *max_running;
+  if (limits.size() == 2) {
+    const auto queue_timeout = ParseNumber(limits[1]);
+    if (!queue_timeout) return std::nullopt;
+    lane.queue_timeout = std::chrono::milliseconds{*queue_timeout};
+  }
+  return lane;
+}
+
+bool Matches(const QueryAdmission::LaneConfig &lane, QueryAdmission::QueryType type, std::string_view db,
+             const QueryUserOrRole *user_or_role) {
+  using Selector = QueryAdmission::LaneConfig::Selector;
+  using QueryType = QueryAdmission::QueryType;
+  switch (lane.selector) {
+    case Selector::READ:
+      return type == QueryType::READ;
+    case Selector::WRITE:
+      return type == QueryType::WRITE;
+    case Selector::READ_WRITE:
+      return type == QueryType::READ_WRITE;
+    case Selector::DATABASE:
+      return db == lane.selector_name;
+    case Selector::USER:
+      return user_or_role && user_or_role->username() == lane.selector_name;
+    case Selector::ROLE:
+      return user_or_role && user_or_role->rolename() == lane.selector_name;
+  }
+  return false;
+}
+
+}  // namespace
+
+struct QueryAdmission::Lane {
+  explicit Lane(LaneConfig config) : config(std::move(config)) {}
+
+  LaneConfig config;
+  std::mutex mutex;
+  std::condition_variable cv;
+  uint64_t running{0};
+  uint64_t next_ticket{0};
+  // Tickets of the waiting queries in the order they came.
+  std::deque<uint64_t> queue;
+};
+
+std::optional<std::vector<QueryAdmission::LaneConfig>> QueryAdmission::ParseLanes(std::string_view spec) {
+  std::vector<LaneConfig> lanes;
+  for (const auto &lane_spec : utils::Split(spec, ";")) {
+    const auto text = utils::Trim(lane_spec);
+    if (text.empty()) continue;
+    auto lane = ParseLane(text);
+    if (!lane) return std::nullopt;
+    lanes.push_back(std::move(*lane));
+  }
+  return lanes;
+}
+
+QueryAdmission::QueryAdmission(std::vector<LaneConfig> lanes) {
+  lanes_.reserve(lanes.size());
+  for (auto &lane : lanes) {
+    lanes_.push_back(std::make_unique<Lane>(std::move(lane)));
+  }
+}
+
+QueryAdmission::~QueryAdmission() = default;
+
+QueryAdmission::Slot &QueryAdmission::Slot::operator=(Slot &&other) noexcept {
+  if (this != &other) {
+    this->~Slot();
+    lane_ = std::exchange(other.lane_, nullptr);
+  }
+  return *this;
+}
+
+QueryAdmission::Slot::~Slot() {
+  if (!lane_) return;
+  {
+    auto guard = std::lock_guard{lane_->mutex};
+    --lane_->running;
+  }
+  lane_->cv.notify_all();
+  lane_ = nullptr;
+}
+
+std::optional<QueryAdmission::Slot> QueryAdmission::Admit(QueryType type, std::string_view db,
+                                                          const QueryUserOrRole *user_or_role,
+                                                          const std::function<AbortReason()> &must_abort) {
+  const auto lane_it = std::find_if(lanes_.begin(), lanes_.end(), [&](const auto &lane) {
+    return Matches(lane->config, type, db, user_or_role);
+  });
+  if (lane_it == lanes_.end()) return std::nullopt;
+  auto &lane = **lane_it;
+
+  auto guard = std::unique_lock{lane.mutex};
+  if (lane.queue.empty() && lane.running < lane.config.max_running) {
+    ++lane.running;
+    return Slot{&lane};
+  }
+  const auto &queue_timeout = lane.config.queue_timeout;
+  if (queue_timeout && queue_timeout->count() == 0) {
+    memgraph::metrics::IncrementCounter(memgraph::metrics::QueryAdmissionTimeouts);
+    throw QueryAdmissionTimeoutException(lane.config.name);
+  }
+
+  const auto ticket = lane.next_ticket++;
+  lane.queue.push_back(ticket);
+  memgraph::metrics::IncrementCounter(memgraph::metrics::QueuedQueries);
+  const auto start = std::chrono::steady_clock::now();
+  // Runs while the lock is still held. The next query may be admissible once
+  // this one leaves the queue.
+  utils::OnScopeExit leave_queue([&] {
+    lane.queue.erase(std::find(lane.queue.begin(), lane.queue.end(), ticket));
+    lane.cv.notify_all();
+    memgraph::metrics::DecrementCounter(memgraph::metrics::QueuedQueries);
+    memgraph::metrics::Measure(
+        memgraph::metrics::QueryAdmissionWaitLatency_us,
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+  });
+
+  const auto deadline = queue_timeout ? start + *queue_timeout : std::chrono::steady_clock::time_point::max();
+  while (true) {
+    if (lane.queue.front() == ticket && lane.running < lane.config.max_running) {
+      ++lane.running;
+      return Slot{&lane};
+    }
+    if (const auto reason = must_abort(); reason != AbortReason::NO_ABORT) {
+      throw HintedAbortError(reason);
+    }
+    const auto now = std::chrono::steady_clock::now();
+    if (now >= deadline) {
+      memgraph::metrics::IncrementCounter(memgraph::metrics::QueryAdmissionTimeouts);
+      throw QueryAdmissionTimeoutException(lane.config.name);
+    }
+    lane.cv.wait_until(guard, std::min(deadline, now + kAbortCheckInterval));
+  }
+}
+
+}  // namespace memgraph::query
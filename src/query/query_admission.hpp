@@ -0,0 +1,101 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+/// @file
+/// Admission control of queries. A query is admitted through the first lane
+/// it matches. Each lane limits how many of its queries run at once, the other
+/// queries wait in the order they came for one of them to finish.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "query/exceptions.hpp"
+
+namespace memgraph::query {
+
+struct QueryUserOrRole;
+
+class QueryAdmission {
+ public:
+  enum class QueryType : uint8_t { READ, WRITE, READ_WRITE };
+
+  struct LaneConfig {
+    enum class Selector : uint8_t { READ, WRITE, READ_WRITE, DATABASE, USER, ROLE };
+
+    /// The text of the lane in the specification, used in messages.
+    std::string name;
+    Selector selector;
+    /// Database, user or role name of the selector.
+    std::string selector_name;
+    uint64_t max_running;
+    /// How long a query waits for a free slot, forever if not set. A query
+    /// of a full lane is rejected right away with a zero timeout.
+    std::optional<std::chrono::milliseconds> queue_timeout;
+  };
+
+  /// Parses lanes separated by `;`, each written as
+  /// `<selector>=<max running>[:<queue timeout ms>]`. The selector is `read`,
+  /// `write`, `read_write`, `db:<name>`, `user:<name>` or `role:<name>`.
+  /// Returns std::nullopt if the specification is invalid.
+  static std::optional<std::vector<LaneConfig>> ParseLanes(std::string_view spec);
+
+  explicit QueryAdmission(std::vector<LaneConfig> lanes);
+
+  QueryAdmission(const QueryAdmission &) = delete;
+  QueryAdmission(QueryAdmission &&) = delete;
+  QueryAdmission &operator=(const QueryAdmission &) = delete;
+  QueryAdmission &operator=(QueryAdmission &&) = delete;
+  ~QueryAdmission();
+
+  struct Lane;
+
+  /// A running query of a lane, frees its slot when destroyed.
+  class Slot {
+   public:
+    explicit Slot(Lane *lane) : lane_(lane) {}
+    Slot(const Slot &) = delete;
+    Slot &operator=(const Slot &) = delete;
+    Slot(Slot &&other) noexcept : lane_(std::exchange(other.lane_, nullptr)) {}
+    Slot &operator=(Slot &&other) noexcept;
+    ~Slot();
+
+   private:
+    Lane *lane_;
+  };
+
+  bool Empty() const { return lanes_.empty(); }
+
+  /// Admits the query into the first lane it matches, waiting for a free slot
+  /// while the lane is full. Returns std::nullopt if no lane matches.
+  /// `must_abort` is checked while waiting.
+  /// @throw QueryAdmissionTimeoutException if no slot was freed in time
+  /// @throw HintedAbortError if the query has to be aborted while waiting
+  std::optional<Slot> Admit(QueryType type, std::string_view db, const QueryUserOrRole *user_or_role,
+                            const std::function<AbortReason()> &must_abort);
+
+ private:
+  std::vector<std::unique_ptr<Lane>> lanes_;
+};
+
+}  // namespace memgraph::query
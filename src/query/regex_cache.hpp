@@ -0,0 +1,44 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <regex>
+#include <string>
+#include <string_view>
+
+namespace memgraph::query {
+
+/// Compiled regular expressions of the `=~` operator, cached for the whole
+/// execution so a pattern given as a literal or a parameter is compiled once
+/// instead of for every row. Not thread-safe, each execution context has its
+/// own.
+class RegexCache {
+ public:
+  /// Returns the compiled @p pattern.
+  /// @throw std::regex_error if the pattern is invalid
+  const std::regex &Get(std::string_view pattern) {
+    if (auto it = regexes_.find(pattern); it != regexes_.end()) return it->second;
+    // Patterns which differ per row would grow the cache without bound
+    if (regexes_.size() >= kMaxPatterns) regexes_.clear();
+    return regexes_.emplace(std::string{pattern}, std::regex{pattern.begin(), pattern.end()}).first->second;
+  }
+
+ private:
+  static constexpr size_t kMaxPatterns = 64;
+
+  std::map<std::string, std::regex, std::less<>> regexes_;
+};
+
+}  // namespace memgraph::query
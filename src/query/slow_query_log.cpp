@@ -0,0 +1,76 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/slow_query_log.hpp"
+
+#include <spdlog/details/thread_pool.h>
+#include <spdlog/sinks/rotating_file_sink.h>
+
+namespace memgraph::query {
+
+namespace {
+// Entries queued for the background thread, the oldest ones are dropped if
+// the file can't keep up.
+constexpr size_t kQueueSize = 8192;
+}  // namespace
+
+uint64_t ParameterSize(const storage::PropertyValue &value) {
+  if (value.IsString()) return value.ValueString().size();
+  if (value.IsList()) return value.ValueList().size();
+  if (value.IsMap()) return value.ValueMap().size();
+  return 1;
+}
+
+nlohmann::json SlowQueryToJson(const SlowQuery &query) {
+  auto json = nlohmann::json{{"query", query.query},
+                             {"duration_ms", query.duration_ms},
+                             {"rows", query.rows},
+                             {"plan", query.plan},
+                             {"resource_usage", query.resource_usage}};
+  auto parameter_sizes = nlohmann::json::object();
+  for (const auto &[name, size] : query.parameter_sizes) {
+    parameter_sizes[name] = size;
+  }
+  json["parameter_sizes"] = std::move(parameter_sizes);
+  if (query.profile) json["profile"] = *query.profile;
+  return json;
+}
+
+void SlowQueryLog::Open(const std::filesystem::path &file, std::chrono::milliseconds threshold, size_t max_file_size,
+                        size_t max_files) {
+  thread_pool_ = std::make_shared<spdlog::details::thread_pool>(kQueueSize, 1);
+  auto sink = std::make_shared<spdlog::sinks::rotating_file_sink_mt>(file.string(), max_file_size, max_files);
+  logger_ = std::make_shared<spdlog::async_logger>("SlowQueryLog", std::move(sink), thread_pool_,
+                                                   spdlog::async_overflow_policy::overrun_oldest);
+  logger_->set_pattern("%v");
+  logger_->set_level(spdlog::level::info);
+  threshold_ = threshold;
+}
+
+void SlowQueryLog::Log(const SlowQuery &query) {
+  if (!logger_) return;
+  auto json = SlowQueryToJson(query);
+  json["timestamp_ms"] =
+      std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+  // The query and the plan can come with invalid UTF-8
+  logger_->info(json.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace));
+}
+
+void SlowQueryLog::Flush() {
+  if (logger_) logger_->flush();
+}
+
+SlowQueryLog &GlobalSlowQueryLog() {
+  static SlowQueryLog log;
+  return log;
+}
+
+}  // namespace memgraph::query
@@ -0,0 +1,80 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <spdlog/async_logger.h>
+#include <json/json.hpp>
+
+#include "storage/v2/property_value.hpp"
+
+namespace memgraph::query {
+
+/// An execution of a query which took longer than the threshold of the slow
+/// query log.
+struct SlowQuery {
+  std::string query;
+  /// Sizes of the user parameters, see `ParameterSize`.
+  std::vector<std::pair<std::string, uint64_t>> parameter_sizes;
+  double duration_ms{0};
+  uint64_t rows{0};
+  std::string plan;
+  /// Statistics of the operators of the plan if the execution was profiled.
+  std::optional<nlohmann::json> profile;
+  std::map<std::string, uint64_t> resource_usage;
+};
+
+/// Bytes of a string, elements of a list, entries of a map and 1 otherwise.
+uint64_t ParameterSize(const storage::PropertyValue &value);
+
+nlohmann::json SlowQueryToJson(const SlowQuery &query);
+
+/**
+ * Writes the slow queries as JSON lines to a file which is rotated when it
+ * grows too large. The entries are written by a background thread, so the
+ * query only pays for building the entry.
+ */
+class SlowQueryLog {
+ public:
+  /// Logs the queries which take at least @p threshold to @p file. The file
+  /// is rotated once it grows over @p max_file_size bytes and @p max_files of
+  /// the rotated files are kept. Must be called before the queries run.
+  void Open(const std::filesystem::path &file, std::chrono::milliseconds threshold, size_t max_file_size,
+            size_t max_files);
+
+  bool IsOpen() const { return logger_ != nullptr; }
+
+  bool IsSlow(std::chrono::duration<double> duration) const { return IsOpen() && duration >= threshold_; }
+
+  void Log(const SlowQuery &query);
+
+  /// Writes the queued entries.
+  void Flush();
+
+ private:
+  std::shared_ptr<spdlog::details::thread_pool> thread_pool_;
+  std::shared_ptr<spdlog::async_logger> logger_;
+  std::chrono::milliseconds threshold_{0};
+};
+
+SlowQueryLog &GlobalSlowQueryLog();
+
+}  // namespace memgraph::query
@@ -0,0 +1,149 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "query/stream/batched_query.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <iterator>
+
+#include <fmt/format.h>
+
+#include "utils/string.hpp"
+
+namespace memgraph::query::stream {
+namespace {
+constexpr std::string_view kBatchRowName{"__stream_row"};
+
+// Clauses which read the graph, return rows or split the query into parts
+constexpr std::array kUnbatchableKeywords{"CALL",    "EXPLAIN", "LOAD",   "MATCH", "PERIODIC", "PROFILE",
+                                          "RETURN",  "UNION",   "UNWIND", "USING", "WITH"};
+
+// Keywords after which a parameter starts an expression
+constexpr std::array kExpressionKeywords{"AND", "CASE", "CONTAINS", "ELSE", "IN", "IS", "NOT", "OR", "THEN", "WHEN", "XOR"};
+
+bool IsIdentifierStart(char c) { return std::isalpha(static_cast<unsigned char>(c)) || c == '_'; }
+bool IsIdentifierPart(char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; }
+
+bool Contains(const auto &keywords, std::string_view word) {
+  return std::find(keywords.begin(), keywords.end(), word) != keywords.end();
+}
+}  // namespace
+
+std::optional<BatchedQuery> RewriteAsBatchedQuery(std::string_view query) {
+  BatchedQuery batched{.query = fmt::format("UNWIND ${} AS {} ", kBatchParameterName, kBatchRowName)};
+  auto &out = batched.query;
+
+  bool has_clause = false;
+  // The last word outside of literals and the last significant character, which tell whether a parameter is an
+  // expression or a property map of a pattern (e.g. `(n:Label $props)`), which can't be read from a variable
+  std::string last_word;
+  char last_char = '\0';
+
+  const auto skip_whitespace = [&](size_t pos) {
+    while (pos < query.size() && std::isspace(static_cast<unsigned char>(query[pos]))) ++pos;
+    return pos;
+  };
+
+  size_t i = 0;
+  while (i < query.size()) {
+    const char c = query[i];
+    if (std::isspace(static_cast<unsigned char>(c))) {
+      out += c;
+      ++i;
+      continue;
+    }
+
+    if (c == '\'' || c == '"' || c == '`') {
+      // Literals and escaped names are copied as they are
+      auto end = i + 1;
+      while (end < query.size() && query[end] != c) {
+        if (query[end] == '\\' && c != '`') ++end;
+        ++end;
+      }
+      if (end >= query.size()) return std::nullopt;
+      out += query.substr(i, end - i + 1);
+      last_word.clear();
+      last_char = c;
+      i = end + 1;
+      continue;
+    }
+
+    if (query.substr(i, 2) == "//" || query.substr(i, 2) == "/*") {
+      const auto is_line_comment = query[i + 1] == '/';
+      const auto end = query.find(is_line_comment ? "\n" : "*/", i + 2);
+      if (end == std::string_view::npos) {
+        if (!is_line_comment) return std::nullopt;
+        i = query.size();
+      } else {
+        i = end + (is_line_comment ? 1 : 2);
+      }
+      out += ' ';
+      continue;
+    }
+
+    if (c == ';') return std::nullopt;
+
+    if (c == '$') {
+      const auto name_start = i + 1;
+      if (name_start >= query.size() || !IsIdentifierStart(query[name_start])) return std::nullopt;
+      const auto valid_position = last_word.empty() ? std::string_view{"=:,+-*/%^<>([{"}.find(last_char) !=
+                                                          std::string_view::npos
+                                                    : Contains(kExpressionKeywords, last_word);
+      if (!valid_position) return std::nullopt;
+      auto name_end = name_start;
+      while (name_end < query.size() && IsIdentifierPart(query[name_end])) ++name_end;
+      auto name = std::string{query.substr(name_start, name_end - name_start)};
+      fmt::format_to(std::back_inserter(out), "{}.{}", kBatchRowName, name);
+      if (std::find(batched.parameters.begin(), batched.parameters.end(), name) == batched.parameters.end()) {
+        batched.parameters.push_back(std::move(name));
+      }
+      last_word.clear();
+      last_char = 'a';
+      i = name_end;
+      continue;
+    }
+
+    if (IsIdentifierPart(c)) {
+      auto end = i;
+      while (end < query.size() && IsIdentifierPart(query[end])) ++end;
+      const auto word = query.substr(i, end - i);
+      if (word == kBatchRowName) return std::nullopt;
+      auto upper_word = utils::ToUpperCase(word);
+      if (Contains(kUnbatchableKeywords, upper_word)) return std::nullopt;
+      if (upper_word == "CREATE" || upper_word == "MERGE") {
+        // Only patterns, which also leaves out the schema and the administrative queries
+        const auto next = skip_whitespace(end);
+        if (next >= query.size() || query[next] != '(') return std::nullopt;
+        has_clause = true;
+      } else if (!has_clause && IsIdentifierStart(c)) {
+        return std::nullopt;
+      }
+      out += word;
+      // A word preceded by a dot or a colon is a property or a label, not a keyword
+      last_word = last_char == '.' || last_char == ':' ? std::string{"."} : std::move(upper_word);
+      last_char = 'a';
+      i = end;
+      continue;
+    }
+
+    out += c;
+    last_word.clear();
+    last_char = c;
+    ++i;
+  }
+
+  if (!has_clause) return std::nullopt;
+  return batched;
+}
+
+}  // namespace memgraph::query::stream
@@ -0,0 +1,41 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace memgraph::query::stream {
+
+/// Name of the list parameter a batched query unwinds, one element per
+/// merged query, each holding the parameters of that query.
+inline constexpr std::string_view kBatchParameterName{"__stream_batch"};
+
+struct BatchedQuery {
+  /// `UNWIND $__stream_batch AS __stream_row` followed by the original query,
+  /// with each of its parameters read from `__stream_row`.
+  std::string query;
+  /// Names of the parameters the original query uses.
+  std::vector<std::string> parameters;
+};
+
+/// Rewrites @p query into a query which runs it once for each element of
+/// the batch parameter. Returns std::nullopt if running the rewritten query
+/// might behave differently than running the original one for each element
+/// in order, e.g. if the query matches existing data (which an UNWIND doesn't
+/// see as it's being written), returns rows, has several parts or isn't a
+/// CREATE or MERGE of patterns.
+std::optional<BatchedQuery> RewriteAsBatchedQuery(std::string_view query);
+
+}  // namespace memgraph::query::stream
@@ -25,6 +25,8 @@ namespace memgraph::query::stream {
 
 inline constexpr std::chrono::milliseconds kDefaultBatchInterval{100};
 inline constexpr int64_t kDefaultBatchSize{1000};
+inline constexpr int64_t kDefaultWorkers{1};
+inline constexpr int64_t kDefaultPipelineDepth{0};
 
 template <typename TMessage>
 using ConsumerFunction = std::function<void(const std::vector<TMessage> &)>;
@@ -27,6 +27,8 @@ KafkaStream::KafkaStream(std::string stream_name, StreamInfo stream_info,
       .batch_size = stream_info.common_info.batch_size,
       .public_configs = std::move(stream_info.configs),
       .private_configs = std::move(stream_info.credentials),
+      .workers = stream_info.workers,
+      .pipeline_depth = stream_info.pipeline_depth,
   };
   consumer_.emplace(std::move(consumer_info), std::move(consumer_function));
 };
@@ -40,7 +42,9 @@ KafkaStream::StreamInfo KafkaStream::Info(std::string transformation_name) const
           .consumer_group = info.consumer_group,
           .bootstrap_servers = info.bootstrap_servers,
           .configs = info.public_configs,
-          .credentials = info.private_configs};
+          .credentials = info.private_configs,
+          .workers = info.workers,
+          .pipeline_depth = info.pipeline_depth};
 }
 
 void KafkaStream::Start() { consumer_->Start(); }
@@ -65,6 +69,8 @@ const std::string kConsumerGroupKey{"consumer_group"};
 const std::string kBoostrapServers{"bootstrap_servers"};
 const std::string kConfigs{"configs"};
 const std::string kCredentials{"credentials"};
+const std::string kWorkers{"workers"};
+const std::string kPipelineDepth{"pipeline_depth"};
 
 const std::unordered_map<std::string, std::string> kDefaultConfigsMap;
 }  // namespace
@@ -76,6 +82,8 @@ void to_json(nlohmann::json &data, KafkaStream::StreamInfo &&info) {
   data[kBoostrapServers] = std::move(info.bootstrap_servers);
   data[kConfigs] = std::move(info.configs);
   data[kCredentials] = std::move(info.credentials);
+  data[kWorkers] = info.workers;
+  data[kPipelineDepth] = info.pipeline_depth;
 }
 
 void from_json(const nlohmann::json &data, KafkaStream::StreamInfo &info) {
@@ -86,6 +94,8 @@ void from_json(const nlohmann::json &data, KafkaStream::StreamInfo &info) {
   // These values might not be present in the persisted JSON object
   info.configs = data.value(kConfigs, kDefaultConfigsMap);
   info.credentials = data.value(kCredentials, kDefaultConfigsMap);
+  info.workers = data.value(kWorkers, kDefaultWorkers);
+  info.pipeline_depth = data.value(kPipelineDepth, kDefaultPipelineDepth);
 }
 
 PulsarStream::PulsarStream(std::string stream_name, StreamInfo stream_info,
@@ -26,6 +26,10 @@ struct KafkaStream {
     std::string bootstrap_servers;
     std::unordered_map<std::string, std::string> configs;
     std::unordered_map<std::string, std::string> credentials;
+    // Consumers which split the partitions of the topics between them
+    int64_t workers{kDefaultWorkers};
+    // Batches polled ahead of the one being processed, 0 if the next batch is polled after the current one commits
+    int64_t pipeline_depth{kDefaultPipelineDepth};
   };
 
   using Message = integrations::kafka::Message;
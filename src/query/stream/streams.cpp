@@ -11,6 +11,8 @@
 
 #include "query/stream/streams.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <shared_mutex>
 #include <string_view>
 #include <utility>
@@ -29,6 +31,7 @@
 #include "query/procedure/mg_procedure_impl.hpp"
 #include "query/procedure/module.hpp"
 #include "query/query_user.hpp"
+#include "query/stream/batched_query.hpp"
 #include "query/stream/sources.hpp"
 #include "query/typed_value.hpp"
 #include "utils/event_counter.hpp"
@@ -116,6 +119,56 @@ void CallCustomTransformation(const std::string &transformation_name, const std:
   }
 }
 
+struct TransformedQuery {
+  std::string query;
+  storage::PropertyValue parameters;
+};
+
+// Collects the queries the transformation yielded. If `batch_queries` is set, consecutive rows with the same query text
+// are merged into a single query which unwinds their parameters, so the query is prepared once for all of them.
+std::vector<TransformedQuery> CollectTransformedQueries(const utils::pmr::vector<mgp_result_record> &rows,
+                                                        const std::string_view transformation_name,
+                                                        const std::string_view stream_name, const bool batch_queries) {
+  std::vector<TransformedQuery> queries;
+  queries.reserve(rows.size());
+  for (const auto &row : rows) {
+    auto [query_value, params_value] = ExtractTransformationResult(row.values, transformation_name, stream_name);
+    queries.push_back({std::string{query_value.ValueString()}, storage::PropertyValue{params_value}});
+  }
+  if (!batch_queries) return queries;
+
+  std::vector<TransformedQuery> batched_queries;
+  for (auto begin = queries.begin(); begin != queries.end();) {
+    const auto end = std::find_if(begin, queries.end(),
+                                  [&query = begin->query](const auto &other) { return other.query != query; });
+    auto batched = end - begin > 1 ? RewriteAsBatchedQuery(begin->query) : std::nullopt;
+    // A query which misses a parameter fails on its own
+    const auto has_parameters = [&batched](const TransformedQuery &query) {
+      return std::ranges::all_of(batched->parameters, [&query](const auto &name) {
+        return query.parameters.IsMap() && query.parameters.ValueMap().contains(name);
+      });
+    };
+    if (!batched || !std::all_of(begin, end, has_parameters)) {
+      std::move(begin, end, std::back_inserter(batched_queries));
+      begin = end;
+      continue;
+    }
+
+    storage::PropertyValue::list_t batch;
+    batch.reserve(end - begin);
+    for (auto it = begin; it != end; ++it) {
+      batch.push_back(it->parameters.IsMap() ? std::move(it->parameters)
+                                             : storage::PropertyValue{storage::PropertyValue::map_t{}});
+    }
+    batched_queries.push_back(
+        {std::move(batched->query),
+         storage::PropertyValue{storage::PropertyValue::map_t{
+             {std::string{kBatchParameterName}, storage::PropertyValue{std::move(batch)}}}}});
+    begin = end;
+  }
+  return batched_queries;
+}
+
 template <Stream TStream>
 StreamStatus<TStream> CreateStatus(std::string stream_name, std::string transformation_name,
                                    std::optional<std::string> owner, const TStream &stream) {
@@ -500,13 +553,29 @@ Streams::StreamsMap::iterator Streams::CreateConsumer(StreamsMap &map, const std
 
   auto *memory_resource = utils::NewDeleteResource();
 
+  // The workers of a stream call the consumer function concurrently, so each call takes an idle interpreter and
+  // returns it once the batch is committed
+  auto idle_interpreters = std::make_shared<utils::Synchronized<std::vector<std::shared_ptr<Interpreter>>>>();
+  idle_interpreters->Lock()->push_back(std::make_shared<Interpreter>(interpreter_context, db_acc));
+
   auto consumer_function = [interpreter_context, memory_resource, stream_name,
                             transformation_name = stream_info.common_info.transformation_name, owner = std::move(owner),
-                            interpreter = std::make_shared<Interpreter>(interpreter_context, std::move(db_acc)),
-                            result = mgp_result{nullptr, memory_resource},
+                            db_acc = std::move(db_acc), idle_interpreters = std::move(idle_interpreters),
                             total_retries = interpreter_context->config.stream_transaction_conflict_retries,
-                            retry_interval = interpreter_context->config.stream_transaction_retry_interval](
-                               const std::vector<typename TStream::Message> &messages) mutable {
+                            retry_interval = interpreter_context->config.stream_transaction_retry_interval,
+                            batch_queries = interpreter_context->config.stream_batched_queries](
+                               const std::vector<typename TStream::Message> &messages) {
+    auto interpreter = [&]() -> std::shared_ptr<Interpreter> {
+      auto locked_interpreters = idle_interpreters->Lock();
+      if (locked_interpreters->empty()) return std::make_shared<Interpreter>(interpreter_context, db_acc);
+      auto idle = std::move(locked_interpreters->back());
+      locked_interpreters->pop_back();
+      return idle;
+    }();
+    utils::OnScopeExit return_interpreter{
+        [&idle_interpreters, &interpreter]() { idle_interpreters->Lock()->push_back(interpreter); }};
+    mgp_result result{nullptr, memory_resource};
+
     // Set interpreter's user to the stream owner
     // NOTE: We generate an empty user to avoid generating interpreter's fine grained access control and rely only on
     // the global auth_checker used in the stream itself
@@ -533,19 +602,18 @@ Streams::StreamsMap::iterator Streams::CreateConsumer(StreamsMap &map, const std
     }};
 
     const static storage::PropertyValue::map_t empty_parameters{};
+    const auto queries = CollectTransformedQueries(result.rows, transformation_name, stream_name, batch_queries);
     uint32_t i = 0;
     while (true) {
       try {
         interpreter->BeginTransaction();
-        for (auto &row : result.rows) {
-          spdlog::trace("Processing row in stream '{}'", stream_name);
-          auto [query_value, params_value] = ExtractTransformationResult(row.values, transformation_name, stream_name);
-          storage::PropertyValue params_prop{params_value};
-          std::string query{query_value.ValueString()};
+        for (const auto &[query, params_prop] : queries) {
           spdlog::trace("Executing query '{}' in stream '{}'", query, stream_name);
           auto prepare_result = interpreter->Prepare(
               query,
-              [=](storage::Storage const *) { return params_prop.IsMap() ? params_prop.ValueMap() : empty_parameters; },
+              [&params_prop = params_prop](storage::Storage const *) {
+                return params_prop.IsMap() ? params_prop.ValueMap() : empty_parameters;
+              },
               {});
           if (!owner->IsAuthorized(prepare_result.privileges, "", &up_to_date_policy)) {
             throw StreamsException{
@@ -802,6 +870,8 @@ std::vector<StreamStatus<>> Streams::GetStreamInfo() const {
   return result;
 }
 
+size_t Streams::Count() const { return streams_.ReadLock()->size(); }
+
 template <typename TDbAccess>
 TransformationResult Streams::Check(const std::string &stream_name, TDbAccess db_acc,
                                     std::optional<std::chrono::milliseconds> timeout,
@@ -161,6 +161,9 @@ class Streams final {
   /// this function because of an error.
   std::vector<StreamStatus<>> GetStreamInfo() const;
 
+  /// Return the number of streams, without reading their status.
+  size_t Count() const;
+
   /// Do a dry-run consume from a stream.
   ///
   /// @param stream_name name of the stream we want to test
@@ -14,12 +14,14 @@
 #include <chrono>
 #include <memory>
 #include <optional>
+#include <string_view>
 #include <thread>
+#include <vector>
 
-#include "query/discard_value_stream.hpp"
 #include "query/interpreter.hpp"
 #include "query/interpreter_context.hpp"
 #include "query/typed_value.hpp"
+#include "storage/v2/property_value.hpp"
 #include "utils/logging.hpp"
 #include "utils/temporal.hpp"
 
@@ -31,6 +33,29 @@ extern const Event DeletedEdges;
 }  // namespace memgraph::metrics
 
 namespace {
+// Due vertices are scanned from the :TTL(ttl) index in ttl order, so each batch continues the scan from the largest
+// ttl the previous one deleted instead of walking over the index entries of the vertices deleted before.
+constexpr std::string_view kFirstBatchQuery =
+    "MATCH (n:TTL) WHERE n.ttl < $now WITH n LIMIT $batch WITH n, n.ttl AS ttl DETACH DELETE n RETURN max(ttl);";
+constexpr std::string_view kNextBatchQuery =
+    "MATCH (n:TTL) WHERE n.ttl >= $from AND n.ttl < $now WITH n LIMIT $batch WITH n, n.ttl AS ttl DETACH DELETE n "
+    "RETURN max(ttl);";
+constexpr int64_t kBatchSize = 10000;
+
+/// Keeps the largest ttl the batch query returns, unset if nothing was deleted.
+struct LastTtlResultStream {
+  void Result(const std::vector<memgraph::query::TypedValue> &values) {
+    if (values.empty()) return;
+    if (values[0].IsInt()) {
+      last_ttl = memgraph::storage::PropertyValue(values[0].ValueInt());
+    } else if (values[0].IsDouble()) {
+      last_ttl = memgraph::storage::PropertyValue(values[0].ValueDouble());
+    }
+  }
+
+  std::optional<memgraph::storage::PropertyValue> last_ttl;
+};
+
 template <typename T>
 int GetPart(auto &current) {
   const int whole_part = std::chrono::duration_cast<T>(current).count();
@@ -68,7 +93,7 @@ void TTL::Setup_(TDbAccess db_acc, InterpreterContext *interpreter_context) {
   interpreter_context->interpreters->insert(interpreter.get());
 
   auto TTL = [interpreter = std::move(interpreter)]() {
-    memgraph::query::DiscardValueResultStream result_stream;
+    std::optional<storage::PropertyValue> from;
     bool finished = false;
     // Using microseconds to be aligned with timestamp() query, could just use seconds
     const auto now = std::chrono::system_clock::now();
@@ -77,15 +102,16 @@ void TTL::Setup_(TDbAccess db_acc, InterpreterContext *interpreter_context) {
     while (!finished) {
       try {
         interpreter->BeginTransaction();
-        auto prepare_result =
-            interpreter->Prepare("MATCH (n:TTL) WHERE n.ttl < $now WITH n LIMIT $batch DETACH DELETE n;",
-                                 [now_us](auto) {
-                                   UserParameters params;
-                                   params.emplace("now", now_us.count());
-                                   params.emplace("batch", 10000);
-                                   return params;
-                                 },
-                                 {});
+        auto prepare_result = interpreter->Prepare(std::string{from ? kNextBatchQuery : kFirstBatchQuery},
+                                                   [now_us, from](auto) {
+                                                     UserParameters params;
+                                                     params.emplace("now", now_us.count());
+                                                     params.emplace("batch", kBatchSize);
+                                                     if (from) params.emplace("from", *from);
+                                                     return params;
+                                                   },
+                                                   {});
+        LastTtlResultStream result_stream;
         const auto pull_res = interpreter->PullAll(&result_stream);
         auto get_value = [&](std::string_view key) {
           int64_t n = 0;
@@ -98,9 +124,11 @@ void TTL::Setup_(TDbAccess db_acc, InterpreterContext *interpreter_context) {
           return n;
         };
         const auto n_deleted = get_value("nodes-deleted");
-        finished = !pull_res.at("has_more").ValueBool() && n_deleted == 0;
+        // A batch smaller than the limit means no due vertex is left, so there is no need for an empty last batch
+        finished = !pull_res.at("has_more").ValueBool() && n_deleted < kBatchSize;
         spdlog::trace("Committing TTL batch transaction");
         interpreter->CommitTransaction();
+        if (result_stream.last_ttl) from = std::move(result_stream.last_ttl);
         const auto n_edges_deleted = get_value("relationships-deleted");
         spdlog::trace("Committed TTL batch deleted {} vertices and {} edges", n_deleted, n_edges_deleted);
         // Telemetry
@@ -11,6 +11,9 @@
 
 #include "query/trigger.hpp"
 
+#include <algorithm>
+#include <utility>
+
 #include "query/config.hpp"
 #include "query/context.hpp"
 #include "query/cypher_query_interpreter.hpp"
@@ -23,14 +26,26 @@
 #include "query/typed_value.hpp"
 #include "storage/v2/property_value.hpp"
 #include "utils/event_counter.hpp"
+#include "utils/event_gauge.hpp"
 #include "utils/memory.hpp"
 
 namespace memgraph::metrics {
 extern const Event TriggersExecuted;
+extern const Event AfterCommitTriggerQueueDepth;
 }  // namespace memgraph::metrics
 
 namespace memgraph::query {
 namespace {
+// Entries of the queues of all databases
+std::atomic<uint64_t> after_commit_trigger_queue_depth{0};
+
+void AddToAfterCommitTriggerQueueDepth(int64_t change) {
+  const auto unsigned_change = static_cast<uint64_t>(change);
+  const auto depth =
+      after_commit_trigger_queue_depth.fetch_add(unsigned_change, std::memory_order_acq_rel) + unsigned_change;
+  memgraph::metrics::SetGaugeValue(memgraph::metrics::AfterCommitTriggerQueueDepth, depth);
+}
+
 auto IdentifierString(const TriggerIdentifierTag tag) noexcept {
   switch (tag) {
     case TriggerIdentifierTag::CREATED_VERTICES:
@@ -151,9 +166,8 @@ std::vector<std::pair<Identifier, TriggerIdentifierTag>> GetPredefinedIdentifier
 }  // namespace
 
 Trigger::Trigger(std::string name, const std::string &query, const storage::PropertyValue::map_t &user_parameters,
-                 const TriggerEventType event_type, utils::SkipList<QueryCacheEntry> *query_cache,
-                 DbAccessor *db_accessor, const InterpreterConfig::Query &query_config,
-                 std::shared_ptr<QueryUserOrRole> owner)
+                 const TriggerEventType event_type, AstCache *query_cache, DbAccessor *db_accessor,
+                 const InterpreterConfig::Query &query_config, std::shared_ptr<QueryUserOrRole> owner)
     : name_{std::move(name)},
       parsed_statements_{ParseQuery(query, user_parameters, query_cache, query_config)},
       event_type_{event_type},
@@ -208,8 +222,8 @@ void Trigger::Execute(DbAccessor *dba, DatabaseAccessProtector db_acc, utils::Me
   ctx.symbol_table = plan.symbol_table();
   ctx.evaluation_context.timestamp = QueryTimestamp();
   ctx.evaluation_context.parameters = parsed_statements_.parameters;
-  ctx.evaluation_context.properties = NamesToProperties(plan.ast_storage().properties_, dba);
-  ctx.evaluation_context.labels = NamesToLabels(plan.ast_storage().labels_, dba);
+  ctx.evaluation_context.properties = plan.properties(dba);
+  ctx.evaluation_context.labels = plan.labels(dba);
   ctx.timer = (max_execution_time_sec > 0.0) ? std::make_shared<utils::AsyncTimer>(max_execution_time_sec) : nullptr;
   ctx.is_shutting_down = is_shutting_down;
   ctx.transaction_status = transaction_status;
@@ -241,7 +255,7 @@ inline constexpr uint64_t kVersion{2};
 
 TriggerStore::TriggerStore(std::filesystem::path directory) : storage_{std::move(directory)} {}
 
-void TriggerStore::RestoreTrigger(utils::SkipList<QueryCacheEntry> *query_cache, DbAccessor *db_accessor,
+void TriggerStore::RestoreTrigger(AstCache *query_cache, DbAccessor *db_accessor,
                                   const InterpreterConfig::Query &query_config, const query::AuthChecker *auth_checker,
                                   std::string_view trigger_name, std::string_view trigger_data) {
   const auto get_failed_message = [&trigger_name = trigger_name](const std::string_view message) {
@@ -331,7 +345,7 @@ void TriggerStore::RestoreTrigger(utils::SkipList<QueryCacheEntry> *query_cache,
   spdlog::debug("Trigger loaded successfully!");
 }
 
-void TriggerStore::RestoreTriggers(utils::SkipList<QueryCacheEntry> *query_cache, DbAccessor *db_accessor,
+void TriggerStore::RestoreTriggers(AstCache *query_cache, DbAccessor *db_accessor,
                                    const InterpreterConfig::Query &query_config,
                                    const query::AuthChecker *auth_checker) {
   MG_ASSERT(before_commit_triggers_.size() == 0 && after_commit_triggers_.size() == 0,
@@ -345,9 +359,8 @@ void TriggerStore::RestoreTriggers(utils::SkipList<QueryCacheEntry> *query_cache
 
 void TriggerStore::AddTrigger(std::string name, const std::string &query,
                               const storage::PropertyValue::map_t &user_parameters, TriggerEventType event_type,
-                              TriggerPhase phase, utils::SkipList<QueryCacheEntry> *query_cache,
-                              DbAccessor *db_accessor, const InterpreterConfig::Query &query_config,
-                              std::shared_ptr<QueryUserOrRole> owner) {
+                              TriggerPhase phase, AstCache *query_cache, DbAccessor *db_accessor,
+                              const InterpreterConfig::Query &query_config, std::shared_ptr<QueryUserOrRole> owner) {
   std::unique_lock store_guard{store_lock_};
   if (storage_.Get(name)) {
     throw utils::BasicException("Trigger with the same name already exists.");
@@ -472,4 +485,30 @@ std::unordered_set<TriggerEventType> TriggerStore::GetEventTypes() const {
   add_event_types(after_commit_triggers_);
   return event_types;
 }
+
+bool AfterCommitTriggerQueue::Push(Entry entry) {
+  AddToAfterCommitTriggerQueueDepth(1);
+  return state_.WithLock([&entry](auto &state) {
+    state.entries.push_back(std::move(entry));
+    return !std::exchange(state.taking, true);
+  });
+}
+
+std::vector<AfterCommitTriggerQueue::Entry> AfterCommitTriggerQueue::PopBatch(size_t max_entries) {
+  auto batch = state_.WithLock([max_entries](auto &state) {
+    std::vector<Entry> batch;
+    while (!state.entries.empty() && batch.size() < std::max<size_t>(max_entries, 1)) {
+      batch.push_back(std::move(state.entries.front()));
+      state.entries.pop_front();
+    }
+    if (batch.empty()) state.taking = false;
+    return batch;
+  });
+  if (!batch.empty()) AddToAfterCommitTriggerQueueDepth(-static_cast<int64_t>(batch.size()));
+  return batch;
+}
+
+size_t AfterCommitTriggerQueue::Size() const {
+  return state_.WithLock([](const auto &state) { return state.entries.size(); });
+}
 }  // namespace memgraph::query
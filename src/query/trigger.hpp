@@ -12,6 +12,7 @@
 #pragma once
 
 #include <atomic>
+#include <deque>
 #include <filesystem>
 #include <map>
 #include <memory>
@@ -29,15 +30,14 @@
 #include "storage/v2/property_value.hpp"
 #include "utils/skip_list.hpp"
 #include "utils/spin_lock.hpp"
+#include "utils/synchronized.hpp"
 
 namespace memgraph::query {
 
-struct QueryCacheEntry;
-
 enum class TransactionStatus;
 struct Trigger {
   explicit Trigger(std::string name, const std::string &query, const storage::PropertyValue::map_t &user_parameters,
-                   TriggerEventType event_type, utils::SkipList<QueryCacheEntry> *query_cache, DbAccessor *db_accessor,
+                   TriggerEventType event_type, AstCache *query_cache, DbAccessor *db_accessor,
                    const InterpreterConfig::Query &query_config, std::shared_ptr<QueryUserOrRole> owner);
 
   void Execute(DbAccessor *dba, DatabaseAccessProtector db_acc, utils::MemoryResource *execution_memory,
@@ -82,13 +82,12 @@ enum class TriggerPhase : uint8_t { BEFORE_COMMIT, AFTER_COMMIT };
 struct TriggerStore {
   explicit TriggerStore(std::filesystem::path directory);
 
-  void RestoreTriggers(utils::SkipList<QueryCacheEntry> *query_cache, DbAccessor *db_accessor,
-                       const InterpreterConfig::Query &query_config, const query::AuthChecker *auth_checker);
+  void RestoreTriggers(AstCache *query_cache, DbAccessor *db_accessor, const InterpreterConfig::Query &query_config,
+                       const query::AuthChecker *auth_checker);
 
   void AddTrigger(std::string name, const std::string &query, const storage::PropertyValue::map_t &user_parameters,
-                  TriggerEventType event_type, TriggerPhase phase, utils::SkipList<QueryCacheEntry> *query_cache,
-                  DbAccessor *db_accessor, const InterpreterConfig::Query &query_config,
-                  std::shared_ptr<QueryUserOrRole> owner);
+                  TriggerEventType event_type, TriggerPhase phase, AstCache *query_cache, DbAccessor *db_accessor,
+                  const InterpreterConfig::Query &query_config, std::shared_ptr<QueryUserOrRole> owner);
 
   void DropTrigger(const std::string &name);
   void DropAll();
@@ -107,12 +106,13 @@ struct TriggerStore {
   const auto &AfterCommitTriggers() const noexcept { return after_commit_triggers_; }
 
   bool HasTriggers() const noexcept { return before_commit_triggers_.size() > 0 || after_commit_triggers_.size() > 0; }
+  size_t Count() const noexcept { return before_commit_triggers_.size() + after_commit_triggers_.size(); }
   std::unordered_set<TriggerEventType> GetEventTypes() const;
 
  private:
-  void RestoreTrigger(utils::SkipList<QueryCacheEntry> *query_cache, DbAccessor *db_accessor,
-                      const InterpreterConfig::Query &query_config, const query::AuthChecker *auth_checker,
-                      std::string_view trigger_name, std::string_view trigger_data);
+  void RestoreTrigger(AstCache *query_cache, DbAccessor *db_accessor, const InterpreterConfig::Query &query_config,
+                      const query::AuthChecker *auth_checker, std::string_view trigger_name,
+                      std::string_view trigger_data);
 
   utils::SpinLock store_lock_;
   kvstore::KVStore storage_;
@@ -121,4 +121,34 @@ struct TriggerStore {
   utils::SkipList<Trigger> after_commit_triggers_;
 };
 
+/// Committed transactions whose AFTER COMMIT triggers haven't run yet. The
+/// transactions are taken in commit order, several of them at a time, so that
+/// one execution of the triggers covers their combined context.
+class AfterCommitTriggerQueue {
+ public:
+  struct Entry {
+    TriggerContext context;
+    /// Objects of the context can belong to the transaction, so it's kept
+    /// until the triggers ran.
+    std::shared_ptr<storage::Storage::Accessor> user_transaction;
+  };
+
+  /// Returns true if nobody is taking the entries, in which case the caller
+  /// has to schedule a task which calls `PopBatch` until it returns nothing.
+  bool Push(Entry entry);
+
+  /// Takes at most `max_entries` of the oldest entries. An empty batch marks
+  /// that nobody takes the entries anymore.
+  std::vector<Entry> PopBatch(size_t max_entries);
+
+  size_t Size() const;
+
+ private:
+  struct State {
+    std::deque<Entry> entries;
+    bool taking{false};
+  };
+  mutable utils::Synchronized<State, utils::SpinLock> state_;
+};
+
 }  // namespace memgraph::query
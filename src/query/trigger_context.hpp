@@ -195,6 +195,11 @@ class TriggerContext {
   // to the sent DbAccessor so they can be used safely)
   void AdaptForAccessor(DbAccessor *accessor);
 
+  // Append the changes of a later transaction, so that a single execution of
+  // the triggers covers both transactions. The changes aren't combined, e.g. a
+  // vertex which a later transaction deleted is both created and deleted.
+  void Append(TriggerContext &&other);
+
   // Get TypedValue for the identifier defined with tag
   TypedValue GetTypedValue(TriggerIdentifierTag tag, DbAccessor *dba) const;
   bool ShouldEventTrigger(TriggerEventType) const;
@@ -43,6 +43,9 @@ struct ReplicationClientConfig {
 
   std::optional<SSL> ssl{};
 
+  // Whether the data sent to the replica is compressed.
+  bool compression{false};
+
   friend bool operator==(ReplicationClientConfig const &, ReplicationClientConfig const &) = default;
 };
 
@@ -92,7 +92,7 @@ struct ReplicationClient {
       };
 
       if (mode_ == memgraph::replication_coordination_glue::ReplicationMode::ASYNC) {
-        thread_pool_.AddTask([task = utils::CopyMovableFunctionWrapper{std::move(task)}]() mutable { task(); });
+        thread_pool_.AddTask([task = std::move(task)]() mutable { task(); });
         return true;
       }
 
@@ -24,7 +24,7 @@ static auto CreateClientContext(const memgraph::replication::ReplicationClientCo
 ReplicationClient::ReplicationClient(const memgraph::replication::ReplicationClientConfig &config)
     : name_{config.name},
       rpc_context_{CreateClientContext(config)},
-      rpc_client_{config.repl_server_endpoint, &rpc_context_},
+      rpc_client_{config.repl_server_endpoint, &rpc_context_, config.compression},
       replica_check_frequency_{config.replica_check_frequency},
       mode_{config.mode} {}
 
@@ -27,6 +27,7 @@ constexpr auto *kSyncMode = "replica_sync_mode";
 constexpr auto *kCheckFrequency = "replica_check_frequency";
 constexpr auto *kSSLKeyFile = "replica_ssl_key_file";
 constexpr auto *kSSLCertFile = "replica_ssl_cert_file";
+constexpr auto *kCompression = "replica_compression";
 constexpr auto *kReplicationRole = "replication_role";
 constexpr auto *kEpoch = "epoch";
 constexpr auto *kVersion = "durability_version";
@@ -97,7 +98,8 @@ void from_json(const nlohmann::json &j, ReplicationRoleEntry &p) {
 void to_json(nlohmann::json &j, const ReplicationReplicaEntry &p) {
   auto common = nlohmann::json{{kReplicaName, p.config.name},
                                {kSyncMode, p.config.mode},
-                               {kCheckFrequency, p.config.replica_check_frequency.count()}};
+                               {kCheckFrequency, p.config.replica_check_frequency.count()},
+                               {kCompression, p.config.compression}};
 
   common[kReplicaServer] = p.config.repl_server_endpoint;  // non-resolved
 
@@ -133,6 +135,10 @@ void from_json(const nlohmann::json &j, ReplicationReplicaEntry &p) {
   }();
 
   config.repl_server_endpoint = std::move(repl_server_endpoint);
+  // Replicas registered before compression was added don't have the key.
+  if (j.contains(kCompression)) {
+    j.at(kCompression).get_to(config.compression);
+  }
 
   if (!key_file.is_null()) {
     config.ssl = ReplicationClientConfig::SSL{};
@@ -209,7 +209,7 @@ struct ReplicationHandler : public memgraph::query::ReplicationQueryHandler {
           [is_data_instance_managed_by_coord = flags::CoordinationSetupInstance().IsDataInstanceManagedByCoordinator(),
            storage, &instance_client_ptr, db_acc = std::move(db_acc),
            main_uuid](auto &storage_clients) mutable {  // NOLINT
-            auto client = std::make_unique<storage::ReplicationStorageClient>(*instance_client_ptr, main_uuid);
+            auto client = std::make_shared<storage::ReplicationStorageClient>(*instance_client_ptr, main_uuid);
             client->Start(storage, std::move(db_acc));
             bool const success = std::invoke([&is_data_instance_managed_by_coord, state = client->State()]() {
               // We force sync replicas in other situation
@@ -32,6 +32,9 @@ void SystemRecoveryHandler(memgraph::system::ReplicaHandlerAccessToState &system
                            std::optional<utils::UUID> &current_main_uuid, dbms::DbmsHandler &dbms_handler,
                            auth::SynchedAuth &auth, slk::Reader *req_reader, slk::Builder *res_builder);
 
+void HotQueriesHandler(const std::optional<utils::UUID> &current_main_uuid, slk::Reader *req_reader,
+                       slk::Builder *res_builder);
+
 void Register(replication::RoleReplicaData const &data, system::System &system, dbms::DbmsHandler &dbms_handler,
               auth::SynchedAuth &auth);
 
@@ -12,6 +12,7 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
 #include <vector>
 
 #include "auth/auth.hpp"
@@ -86,6 +87,35 @@ struct SystemRecoveryRes {
 
 using SystemRecoveryRpc = rpc::RequestResponse<SystemRecoveryReq, SystemRecoveryRes>;
 
+/// The most executed queries of the MAIN, which the replica plans ahead.
+struct HotQueriesReq {
+  static const utils::TypeInfo kType;
+  static const utils::TypeInfo &GetTypeInfo() { return kType; }
+
+  static void Load(HotQueriesReq *self, memgraph::slk::Reader *reader);
+  static void Save(const HotQueriesReq &self, memgraph::slk::Builder *builder);
+  HotQueriesReq() = default;
+  HotQueriesReq(const utils::UUID &main_uuid, std::vector<std::string> queries)
+      : main_uuid(main_uuid), queries{std::move(queries)} {}
+
+  utils::UUID main_uuid;
+  std::vector<std::string> queries;
+};
+
+struct HotQueriesRes {
+  static const utils::TypeInfo kType;
+  static const utils::TypeInfo &GetTypeInfo() { return kType; }
+
+  static void Load(HotQueriesRes *self, memgraph::slk::Reader *reader);
+  static void Save(const HotQueriesRes &self, memgraph::slk::Builder *builder);
+  HotQueriesRes() = default;
+  explicit HotQueriesRes(bool success) : success(success) {}
+
+  bool success;
+};
+
+using HotQueriesRpc = rpc::RequestResponse<HotQueriesReq, HotQueriesRes>;
+
 }  // namespace memgraph::replication
 
 namespace memgraph::slk {
@@ -97,4 +127,8 @@ void Save(const memgraph::replication::SystemRecoveryReq &self, memgraph::slk::B
 void Load(memgraph::replication::SystemRecoveryReq *self, memgraph::slk::Reader *reader);
 void Save(const memgraph::replication::SystemRecoveryRes &self, memgraph::slk::Builder *builder);
 void Load(memgraph::replication::SystemRecoveryRes *self, memgraph::slk::Reader *reader);
+void Save(const memgraph::replication::HotQueriesReq &self, memgraph::slk::Builder *builder);
+void Load(memgraph::replication::HotQueriesReq *self, memgraph::slk::Reader *reader);
+void Save(const memgraph::replication::HotQueriesRes &self, memgraph::slk::Builder *builder);
+void Load(memgraph::replication::HotQueriesRes *self, memgraph::slk::Reader *reader);
 }  // namespace memgraph::slk
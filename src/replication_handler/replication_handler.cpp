@@ -12,10 +12,15 @@
 #include "replication_handler/replication_handler.hpp"
 #include "dbms/constants.hpp"
 #include "dbms/dbms_handler.hpp"
+#include "flags/replication.hpp"
+#include "query/hot_queries.hpp"
 #include "replication/replication_client.hpp"
 #include "replication_handler/system_replication.hpp"
+#include "replication_handler/system_rpc.hpp"
 #include "utils/functional.hpp"
 
+#include <algorithm>
+
 #include <spdlog/spdlog.h>
 
 namespace memgraph::replication {
@@ -126,6 +131,24 @@ inline std::optional<query::RegisterReplicaError> HandleRegisterReplicaStatus(
 }
 
 #ifdef MG_ENTERPRISE
+namespace {
+void SendHotQueries(replication::ReplicationClient &client, const utils::UUID &main_uuid,
+                    std::vector<std::string> &sent_queries) {
+  auto queries = query::MostExecutedQueries(FLAGS_replication_hot_queries);
+  // The replica keeps the plans of the queries it got last, they are sent again only once the hot queries change,
+  // not when they only change their order
+  std::ranges::sort(queries);
+  if (queries.empty() || queries == sent_queries) return;
+  try {
+    auto stream = client.rpc_client_.Stream<replication::HotQueriesRpc>(main_uuid, queries);
+    if (!stream.AwaitResponse().success) return;
+    sent_queries = std::move(queries);
+  } catch (const rpc::RpcFailedException &) {
+    spdlog::trace("Failed to send the hot queries to replica {}.", client.name_);
+  }
+}
+}  // namespace
+
 void StartReplicaClient(replication::ReplicationClient &client, system::System &system, dbms::DbmsHandler &dbms_handler,
                         utils::UUID main_uuid, auth::SynchedAuth &auth) {
 #else
@@ -135,7 +158,8 @@ void StartReplicaClient(replication::ReplicationClient &client, dbms::DbmsHandle
   // No client error, start instance level client
   auto const &endpoint = client.rpc_client_.Endpoint();
   spdlog::trace("Replication client started at: {}", endpoint.SocketAddress());  // non-resolved IP
-  client.StartFrequentCheck([&, license = license::global_license_checker.IsEnterpriseValidFast(), main_uuid](
+  client.StartFrequentCheck([&, license = license::global_license_checker.IsEnterpriseValidFast(), main_uuid,
+                              sent_hot_queries = std::vector<std::string>{}](
                                 bool reconnect, replication::ReplicationClient &client) mutable {
     if (client.try_set_uuid && replication_coordination_glue::SendSwapMainUUIDRpc(client.rpc_client_, main_uuid)) {
       client.try_set_uuid = false;
@@ -153,6 +177,10 @@ void StartReplicaClient(replication::ReplicationClient &client, dbms::DbmsHandle
     }
 #ifdef MG_ENTERPRISE
     SystemRestore<true>(client, system, dbms_handler, main_uuid, auth);
+    if (license) {
+      if (reconnect) sent_hot_queries.clear();
+      SendHotQueries(client, main_uuid, sent_hot_queries);
+    }
 #endif
     // Check if any database has been left behind
     dbms_handler.ForEach([&name = client.name_, reconnect](dbms::DatabaseAccess db_acc) {
@@ -224,6 +252,7 @@ bool ReplicationHandler::DoReplicaToMainPromotion(const utils::UUID &main_uuid)
   dbms_handler_.ForEach([&](dbms::DatabaseAccess db_acc) {
     auto *storage = db_acc->storage();
     storage->repl_storage_state_.epoch_ = epoch;
+    storage->repl_storage_state_.PublishEpoch();
 
     // Durability is tracking last durable timestamp from MAIN, whereas timestamp_ is dependent on MVCC
     // We need to take bigger timestamp not to lose durability ordering
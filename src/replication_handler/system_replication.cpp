@@ -17,6 +17,7 @@
 #include "dbms/replication_handlers.hpp"
 #include "flags/experimental.hpp"
 #include "license/license.hpp"
+#include "query/hot_queries.hpp"
 #include "replication_handler/system_rpc.hpp"
 
 namespace memgraph::replication {
@@ -81,6 +82,22 @@ void SystemRecoveryHandler(memgraph::system::ReplicaHandlerAccessToState &system
   res = SystemRecoveryRes(SystemRecoveryRes::Result::SUCCESS);
 }
 
+void HotQueriesHandler(const std::optional<utils::UUID> &current_main_uuid, slk::Reader *req_reader,
+                       slk::Builder *res_builder) {
+  replication::HotQueriesReq req;
+  replication::HotQueriesReq::Load(&req, req_reader);
+
+  if (!current_main_uuid.has_value() || req.main_uuid != current_main_uuid) [[unlikely]] {
+    LogWrongMain(current_main_uuid, req.main_uuid, replication::HotQueriesReq::kType.name);
+    memgraph::slk::Save(replication::HotQueriesRes{false}, res_builder);
+    return;
+  }
+
+  // Planned by the interpreter's scheduler, the RPC server doesn't wait for the planning
+  query::GlobalHotQueries().Set(std::move(req.queries));
+  memgraph::slk::Save(replication::HotQueriesRes{true}, res_builder);
+}
+
 void Register(replication::RoleReplicaData const &data, system::System &system, dbms::DbmsHandler &dbms_handler,
               auth::SynchedAuth &auth) {
   // NOTE: Register even without license as the user could add a license at run-time
@@ -102,6 +119,11 @@ void Register(replication::RoleReplicaData const &data, system::System &system,
         SystemRecoveryHandler(system_state_access, data.uuid_, dbms_handler, auth, req_reader, res_builder);
       });
 
+  data.server->rpc_server_.Register<replication::HotQueriesRpc>([&data](auto *req_reader, auto *res_builder) {
+    spdlog::debug("Received HotQueriesRpc");
+    HotQueriesHandler(data.uuid_, req_reader, res_builder);
+  });
+
   // DBMS
   dbms::Register(data, system_state_access, dbms_handler);
 
@@ -68,6 +68,25 @@ void Load(memgraph::replication::SystemRecoveryRes *self, memgraph::slk::Reader
   }
 }
 
+
+// Serialize code for HotQueriesReq
+void Save(const memgraph::replication::HotQueriesReq &self, memgraph::slk::Builder *builder) {
+  memgraph::slk::Save(self.main_uuid, builder);
+  memgraph::slk::Save(self.queries, builder);
+}
+void Load(memgraph::replication::HotQueriesReq *self, memgraph::slk::Reader *reader) {
+  memgraph::slk::Load(&self->main_uuid, reader);
+  memgraph::slk::Load(&self->queries, reader);
+}
+
+// Serialize code for HotQueriesRes
+void Save(const memgraph::replication::HotQueriesRes &self, memgraph::slk::Builder *builder) {
+  memgraph::slk::Save(self.success, builder);
+}
+void Load(memgraph::replication::HotQueriesRes *self, memgraph::slk::Reader *reader) {
+  memgraph::slk::Load(&self->success, reader);
+}
+
 }  // namespace memgraph::slk
 
 namespace memgraph::replication {
@@ -84,6 +103,10 @@ constexpr utils::TypeInfo SystemRecoveryReq::kType{utils::TypeId::REP_SYSTEM_REC
 constexpr utils::TypeInfo SystemRecoveryRes::kType{utils::TypeId::REP_SYSTEM_RECOVERY_RES, "SystemRecoveryRes",
                                                    nullptr};
 
+constexpr utils::TypeInfo HotQueriesReq::kType{utils::TypeId::REP_HOT_QUERIES_REQ, "HotQueriesReq", nullptr};
+
+constexpr utils::TypeInfo HotQueriesRes::kType{utils::TypeId::REP_HOT_QUERIES_RES, "HotQueriesRes", nullptr};
+
 void SystemHeartbeatReq::Save(const SystemHeartbeatReq &self, memgraph::slk::Builder *builder) {
   memgraph::slk::Save(self, builder);
 }
@@ -110,4 +133,17 @@ void SystemRecoveryRes::Load(SystemRecoveryRes *self, memgraph::slk::Reader *rea
   memgraph::slk::Load(self, reader);
 }
 
+void HotQueriesReq::Save(const HotQueriesReq &self, memgraph::slk::Builder *builder) {
+  memgraph::slk::Save(self, builder);
+}
+void HotQueriesReq::Load(HotQueriesReq *self, memgraph::slk::Reader *reader) {
+  memgraph::slk::Load(self, reader);
+}
+void HotQueriesRes::Save(const HotQueriesRes &self, memgraph::slk::Builder *builder) {
+  memgraph::slk::Save(self, builder);
+}
+void HotQueriesRes::Load(HotQueriesRes *self, memgraph::slk::Reader *reader) {
+  memgraph::slk::Load(self, reader);
+}
+
 }  // namespace memgraph::replication
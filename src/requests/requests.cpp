@@ -115,30 +115,51 @@ bool CreateAndDownloadFile(const std::string &url, const std::string &path, int
 }
 
 auto DownloadToStream(char const *url, std::ostream &os) -> bool {
-  constexpr auto WriteCallback = [](char *ptr, size_t size, size_t nmemb, std::ostream *os) -> size_t {
-    auto const totalSize = static_cast<std::streamsize>(size * nmemb);
-    os->write(ptr, totalSize);
-    return totalSize;
+  return DownloadInParts(url, [&os](std::string_view data) {
+    os.write(data.data(), static_cast<std::streamsize>(data.size()));
+    return true;
+  });
+}
+
+auto DownloadInParts(char const *url, std::function<bool(std::string_view)> const &on_data) -> bool {
+  constexpr auto protocol_matcher = ctre::starts_with<"(https?|ftp)://">;
+  const bool check_response_code = protocol_matcher(url);
+
+  struct Download {
+    CURL *curl_handle;
+    bool check_response_code;
+    std::function<bool(std::string_view)> const *on_data;
+  };
+  constexpr auto WriteCallback = [](char *ptr, size_t size, size_t nmemb, Download *download) -> size_t {
+    if (download->check_response_code) {
+      // Don't pass on the body of an error response, the request fails anyway.
+      long response_code = 0;  // NOLINT
+      curl_easy_getinfo(download->curl_handle, CURLINFO_RESPONSE_CODE, &response_code);
+      if (response_code != 200) return 0;
+    }
+    auto const total_size = size * nmemb;
+    if (!(*download->on_data)(std::string_view{ptr, total_size})) return 0;
+    return total_size;
   };
 
   auto *curl_handle{curl_easy_init()};
+  Download download{.curl_handle = curl_handle, .check_response_code = check_response_code, .on_data = &on_data};
   curl_easy_setopt(curl_handle, CURLOPT_URL, url);
   curl_easy_setopt(curl_handle, CURLOPT_WRITEFUNCTION, +WriteCallback);
-  curl_easy_setopt(curl_handle, CURLOPT_WRITEDATA, &os);
+  curl_easy_setopt(curl_handle, CURLOPT_WRITEDATA, &download);
 
   auto const res = curl_easy_perform(curl_handle);
   long response_code = 0;  // NOLINT
   curl_easy_getinfo(curl_handle, CURLINFO_RESPONSE_CODE, &response_code);
   curl_easy_cleanup(curl_handle);
 
-  if (res != CURLE_OK) {
-    SPDLOG_WARN("Couldn't perform request: {}", curl_easy_strerror(res));
+  if (check_response_code && response_code != 200) {
+    SPDLOG_WARN("Request response code isn't 200 (received {})!", response_code);
     return false;
   }
 
-  constexpr auto protocol_matcher = ctre::starts_with<"(https?|ftp)://">;
-  if (protocol_matcher(url) && response_code != 200) {
-    SPDLOG_WARN("Request response code isn't 200 (received {})!", response_code);
+  if (res != CURLE_OK) {
+    SPDLOG_WARN("Couldn't perform request: {}", curl_easy_strerror(res));
     return false;
   }
 
@@ -11,8 +11,10 @@
 
 #pragma once
 
+#include <functional>
 #include <ostream>
 #include <string>
+#include <string_view>
 
 #include <json/json.hpp>
 
@@ -60,4 +62,16 @@ bool CreateAndDownloadFile(const std::string &url, const std::string &path, int
  */
 auto DownloadToStream(char const *url, std::ostream &os) -> bool;
 
+/**
+ * Downloads content in parts, while the response is being received
+ *
+ * This function sends a GET request and passes each received part of the
+ * response to `on_data`. The request is aborted if `on_data` returns false.
+ *
+ * @param url url of the contents
+ * @param on_data called with each part of the response
+ * @return bool true if the request was successful, false otherwise.
+ */
+auto DownloadInParts(char const *url, std::function<bool(std::string_view)> const &on_data) -> bool;
+
 }  // namespace memgraph::requests
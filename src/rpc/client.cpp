@@ -13,15 +13,104 @@
 
 namespace memgraph::rpc {
 
-Client::Client(io::network::Endpoint endpoint, communication::ClientContext *context)
-    : endpoint_(std::move(endpoint)), context_(context) {}
+Client::Client(io::network::Endpoint endpoint, communication::ClientContext *context, bool compression)
+    : endpoint_(std::move(endpoint)),
+      context_(context),
+      multiplexed_(!context->use_ssl()),
+      compression_(compression) {}
 
 void Client::Abort() {
   if (!client_) return;
   // We need to call Shutdown on the client to abort any pending read or
-  // write operations.
+  // write operations. The connection is replaced by the next request, once
+  // the pending ones gave up on it.
+  broken_ = true;
   client_->Shutdown();
+}
+
+void Client::Connect() {
+  if (client_ && !broken_ && !client_->ErrorStatus()) return;
+
+  auto read_guard = std::lock_guard{read_mutex_};
   client_ = std::nullopt;
+  responses_.clear();
+  client_.emplace(context_);
+  if (!client_->Connect(endpoint_)) {
+    spdlog::error("Couldn't connect to remote address {}", endpoint_);
+    client_ = std::nullopt;
+    throw GenericRpcFailedException();
+  }
+  ++connection_;
+  broken_ = false;
+}
+
+Client::Response Client::ReceiveResponse(uint64_t request_id, uint64_t connection, std::vector<uint8_t> *received) {
+  while (true) {
+    if (auto it = responses_.find(request_id); it != responses_.end()) {
+      *received = std::move(it->second);
+      responses_.erase(it);
+      return {received->data(), received->size(), false};
+    }
+    if (connection != connection_ || broken_ || !client_) {
+      throw GenericRpcFailedException();
+    }
+
+    uint64_t response_data_size = 0;
+    while (true) {
+      auto ret = slk::CheckStreamComplete(client_->GetData(), client_->GetDataSize());
+      if (ret.status == slk::StreamStatus::INVALID) {
+        // The responses following the invalid one can't be found, so the connection is given up
+        Abort();
+        throw GenericRpcFailedException();
+      }
+      if (ret.status == slk::StreamStatus::PARTIAL) {
+        if (!client_->Read(ret.stream_size - client_->GetDataSize(), /* exactly_len = */ false)) {
+          // Failed connection, abort and let somebody retry in the future
+          Abort();
+          throw GenericRpcFailedException();
+        }
+      } else {
+        response_data_size = ret.stream_size;
+        break;
+      }
+    }
+
+    slk::Reader res_reader(client_->GetData(), response_data_size);
+    utils::TypeId res_id{utils::TypeId::UNKNOWN};
+    // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+    rpc::Version version;
+    uint64_t res_request_id = 0;
+    try {
+      slk::Load(&res_id, &res_reader);
+      slk::Load(&version, &res_reader);
+    } catch (const slk::SlkReaderException &) {
+      Abort();
+      throw SlkRpcFailedException();
+    }
+
+    if (version != rpc::current_version) {
+      // V1 we introduced versioning with, absolutely no backwards compatibility,
+      // because it's impossible to provide backwards compatibility with pre versioning.
+      // Future versions this may require mechanism for graceful version handling.
+      Abort();
+      throw VersionMismatchRpcFailedException();
+    }
+
+    try {
+      slk::Load(&res_request_id, &res_reader);
+    } catch (const slk::SlkReaderException &) {
+      Abort();
+      throw SlkRpcFailedException();
+    }
+
+    if (res_request_id == request_id) {
+      return {client_->GetData(), response_data_size, true};
+    }
+    // Keep the response of another request until that request takes it.
+    responses_.emplace(res_request_id,
+                       std::vector<uint8_t>(client_->GetData(), client_->GetData() + response_data_size));
+    client_->ShiftData(response_data_size);
+  }
 }
 
 }  // namespace memgraph::rpc
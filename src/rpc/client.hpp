@@ -11,10 +11,13 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "communication/client.hpp"
 #include "io/network/endpoint.hpp"
@@ -32,9 +35,17 @@
 namespace memgraph::rpc {
 
 /// Client is thread safe, but it is recommended to use thread_local clients.
+/// Client of an RPC server. Each request carries an id which the server sends
+/// back with its response, so the requests of many threads can be in flight on
+/// the one connection of the client: a request holds the connection only until
+/// it is sent and the responses are matched to their requests by the ids.
+/// Connections which use SSL are held for the whole exchange, because an SSL
+/// connection can't be read and written from two threads at once.
 class Client {
  public:
-  Client(io::network::Endpoint endpoint, communication::ClientContext *context);
+  /// @param compression whether the segments of the requests are compressed,
+  ///                    the responses are never compressed
+  Client(io::network::Endpoint endpoint, communication::ClientContext *context, bool compression = false);
 
   /// Object used to handle streaming of request data to the RPC server.
   template <class TRequestResponse>
@@ -42,22 +53,37 @@ class Client {
    private:
     friend class Client;
 
-    StreamHandler(Client *self, std::unique_lock<std::mutex> &&guard,
+    StreamHandler(Client *self, std::unique_lock<std::mutex> &&guard, uint64_t request_id, uint64_t connection,
                   std::function<typename TRequestResponse::Response(slk::Reader *)> res_load)
-        : self_(self), guard_(std::move(guard)), req_builder_(GenBuilderCallback(self, this)), res_load_(res_load) {}
+        : self_(self),
+          guard_(std::move(guard)),
+          request_id_(request_id),
+          connection_(connection),
+          req_builder_(GenBuilderCallback(self, this)),
+          res_load_(res_load) {
+      if (self->compression_) req_builder_.EnableCompression();
+    }
 
    public:
     StreamHandler(StreamHandler &&other) noexcept
         : self_{std::exchange(other.self_, nullptr)},
           defunct_{std::exchange(other.defunct_, true)},
+          finalized_{other.finalized_},
+          awaited_{other.awaited_},
           guard_{std::move(other.guard_)},
+          request_id_{other.request_id_},
+          connection_{other.connection_},
           req_builder_{std::move(other.req_builder_), GenBuilderCallback(self_, this)},
           res_load_{std::move(other.res_load_)} {}
     StreamHandler &operator=(StreamHandler &&other) noexcept {
       if (&other != this) {
         self_ = std::exchange(other.self_, nullptr);
         defunct_ = std::exchange(other.defunct_, true);
+        finalized_ = other.finalized_;
+        awaited_ = other.awaited_;
         guard_ = std::move(other.guard_);
+        request_id_ = other.request_id_;
+        connection_ = other.connection_;
         req_builder_ = slk::Builder(std::move(other.req_builder_, GenBuilderCallback(self_, this)));
         res_load_ = std::move(other.res_load_);
       }
@@ -67,69 +93,68 @@ class Client {
     StreamHandler(const StreamHandler &) = delete;
     StreamHandler &operator=(const StreamHandler &) = delete;
 
-    ~StreamHandler() = default;
+    ~StreamHandler() {
+      // The server would read the next request on the connection as the rest of an unfinished one.
+      if (self_ && !defunct_ && !awaited_) self_->Abort();
+    }
 
     slk::Builder *GetBuilder() { return &req_builder_; }
 
+    /// Sends the rest of the request without awaiting the response, so the
+    /// requests to several servers can be in flight before any response is
+    /// awaited. Called by `AwaitResponse` if it wasn't called before.
+    void FinalizeRequest() {
+      if (finalized_) return;
+      req_builder_.Finalize();
+      finalized_ = true;
+      // Let the other requests use the connection while this one waits for its response.
+      if (self_->multiplexed_) guard_.unlock();
+    }
+
     typename TRequestResponse::Response AwaitResponse() {
       auto res_type = TRequestResponse::Response::kType;
 
       // Finalize the request.
-      req_builder_.Finalize();
+      FinalizeRequest();
 
       // Receive the response.
-      uint64_t response_data_size = 0;
-      while (true) {
-        auto ret = slk::CheckStreamComplete(self_->client_->GetData(), self_->client_->GetDataSize());
-        if (ret.status == slk::StreamStatus::INVALID) {
-          // Logically invalid state, connection is still up, defunct stream and release
-          defunct_ = true;
-          guard_.unlock();
-          throw GenericRpcFailedException();
-        }
-        if (ret.status == slk::StreamStatus::PARTIAL) {
-          if (!self_->client_->Read(ret.stream_size - self_->client_->GetDataSize(),
-                                    /* exactly_len = */ false)) {
-            // Failed connection, abort and let somebody retry in the future
-            defunct_ = true;
-            self_->Abort();
-            guard_.unlock();
-            throw GenericRpcFailedException();
-          }
-        } else {
-          response_data_size = ret.stream_size;
-          break;
-        }
+      awaited_ = true;
+      auto read_guard = std::unique_lock{self_->read_mutex_};
+      std::vector<uint8_t> received;
+      Client::Response response;
+      try {
+        response = self_->ReceiveResponse(request_id_, connection_, &received);
+      } catch (const RpcFailedException &) {
+        defunct_ = true;
+        if (guard_.owns_lock()) guard_.unlock();
+        throw;
       }
 
       // Load the response.
-      slk::Reader res_reader(self_->client_->GetData(), response_data_size);
-      utils::OnScopeExit res_cleanup([&, response_data_size] { self_->client_->ShiftData(response_data_size); });
+      slk::Reader res_reader(response.data, response.size);
+      utils::OnScopeExit res_cleanup([&] {
+        if (response.in_buffer) self_->client_->ShiftData(response.size);
+      });
 
       utils::TypeId res_id{utils::TypeId::UNKNOWN};
       // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
       rpc::Version version;
+      uint64_t request_id = 0;
 
       try {
         slk::Load(&res_id, &res_reader);
         slk::Load(&version, &res_reader);
+        slk::Load(&request_id, &res_reader);
       } catch (const slk::SlkReaderException &) {
         throw SlkRpcFailedException();
       }
 
-      if (version != rpc::current_version) {
-        // V1 we introduced versioning with, absolutely no backwards compatibility,
-        // because it's impossible to provide backwards compatibility with pre versioning.
-        // Future versions this may require mechanism for graceful version handling.
-        throw VersionMismatchRpcFailedException();
-      }
-
       // Check the response ID.
       if (res_id != res_type.id && res_id != utils::TypeId::UNKNOWN) {
         spdlog::error("Message response was of unexpected type");
         // Logically invalid state, connection is still up, defunct stream and release
         defunct_ = true;
-        guard_.unlock();
+        if (guard_.owns_lock()) guard_.unlock();
         throw GenericRpcFailedException();
       }
 
@@ -155,16 +180,20 @@ class Client {
 
     Client *self_;
     bool defunct_ = false;
+    bool finalized_ = false;
+    bool awaited_ = false;
     std::unique_lock<std::mutex> guard_;
+    uint64_t request_id_;
+    uint64_t connection_;
     slk::Builder req_builder_;
     std::function<typename TRequestResponse::Response(slk::Reader *)> res_load_;
   };
 
-  /// Stream a previously defined and registered RPC call. This function can
-  /// initiate only one request at a time. The call returns a `StreamHandler`
-  /// object that can be used to send additional data to the request (with the
-  /// automatically sent `TRequestResponse::Request` object) and await until the
-  /// response is received from the server.
+  /// Stream a previously defined and registered RPC call. The call returns a
+  /// `StreamHandler` object that can be used to send additional data to the
+  /// request (with the automatically sent `TRequestResponse::Request` object)
+  /// and await until the response is received from the server. Other requests
+  /// wait until the request is sent, not until its response is received.
   ///
   /// @returns StreamHandler<TRequestResponse> object that is used to handle
   ///                                          streaming of additional data to
@@ -194,37 +223,25 @@ class Client {
 
     auto guard = std::unique_lock{mutex_};
 
-    // Check if the connection is broken (if we haven't used the client for a
-    // long time the server could have died).
-    if (client_ && client_->ErrorStatus()) {
-      client_ = std::nullopt;
-    }
-
-    // Connect to the remote server.
-    if (!client_) {
-      client_.emplace(context_);
-      if (!client_->Connect(endpoint_)) {
-        spdlog::error("Couldn't connect to remote address {}", endpoint_);
-        client_ = std::nullopt;
-        throw GenericRpcFailedException();
-      }
-    }
+    // Connect to the remote server, or connect again if the connection is broken
+    // (if we haven't used the client for a long time the server could have died).
+    Connect();
 
     // Create the stream handler.
-    StreamHandler<TRequestResponse> handler(this, std::move(guard), load);
+    StreamHandler<TRequestResponse> handler(this, std::move(guard), next_request_id_++, connection_, load);
 
     // Build and send the request.
     slk::Save(req_type.id, handler.GetBuilder());
     slk::Save(rpc::current_version, handler.GetBuilder());
+    slk::Save(handler.request_id_, handler.GetBuilder());
     TRequestResponse::Request::Save(request, handler.GetBuilder());
 
     // Return the handler to the user.
     return handler;
   }
 
-  /// Call a previously defined and registered RPC call. This function can
-  /// initiate only one request at a time. The call blocks until a response is
-  /// received.
+  /// Call a previously defined and registered RPC call. The call blocks until
+  /// a response is received.
   ///
   /// @returns TRequestResponse::Response object that was specified to be
   ///                                     returned by the RPC call
@@ -245,17 +262,51 @@ class Client {
     return stream.AwaitResponse();
   }
 
-  /// Call this function from another thread to abort a pending RPC call.
+  /// Call this function from another thread to abort the pending RPC calls.
   void Abort();
 
   auto Endpoint() const -> io::network::Endpoint const & { return endpoint_; }
 
  private:
+  /// A response either at the front of the data the connection read, or
+  /// read earlier for its request by another one.
+  struct Response {
+    const uint8_t *data{nullptr};
+    size_t size{0};
+    bool in_buffer{false};
+  };
+
+  /// Connects to the server unless connected already. Must be called with
+  /// `mutex_` held.
+  /// @throws GenericRpcFailedException
+  void Connect();
+
+  /// Reads the responses of the connection until the one of the request with
+  /// @p request_id, keeping the responses of the other requests for them.
+  /// Must be called with `read_mutex_` held.
+  /// @param received owns the response if it was read earlier
+  /// @throws RpcFailedException
+  Response ReceiveResponse(uint64_t request_id, uint64_t connection, std::vector<uint8_t> *received);
+
   io::network::Endpoint endpoint_;
   communication::ClientContext *context_;
   std::optional<communication::Client> client_;
+  const bool multiplexed_;
+  const bool compression_;
 
+  // Held while a request is sent, and while the connection is replaced.
   std::mutex mutex_;
+  uint64_t next_request_id_{0};
+  // Incremented for every made connection, so the requests of a broken
+  // connection aren't awaited on the next one.
+  uint64_t connection_{0};
+  std::atomic<bool> broken_{false};
+
+  // Held while the responses are read, and while the connection is replaced.
+  std::mutex read_mutex_;
+
+  // Responses read for the requests which haven't taken them yet.
+  std::unordered_map<uint64_t, std::vector<uint8_t>> responses_;
 };
 
 }  // namespace memgraph::rpc
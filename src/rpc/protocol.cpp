@@ -67,6 +67,14 @@ void Session::Execute() {
     throw SessionException("Session trying to execute a RPC call of an incorrect version!");
   }
 
+  // Load the id the client matches the response to the request with.
+  uint64_t request_id = 0;
+  try {
+    slk::Load(&request_id, &req_reader);
+  } catch (const slk::SlkReaderException &) {
+    throw rpc::SlkRpcFailedException();
+  }
+
   // Access to `callbacks_` and `extended_callbacks_` is done here without
   // acquiring the `mutex_` because we don't allow RPC registration after the
   // server was started so those two maps will never be updated when we `find`
@@ -85,6 +93,7 @@ void Session::Execute() {
     SPDLOG_TRACE("[RpcServer] received {}", extended_it->second.req_type.name);
     slk::Save(extended_it->second.res_type.id, &res_builder);
     slk::Save(rpc::current_version, &res_builder);
+    slk::Save(request_id, &res_builder);
     try {
       extended_it->second.callback(endpoint_, &req_reader, &res_builder);
     } catch (const slk::SlkReaderException &) {
@@ -94,6 +103,7 @@ void Session::Execute() {
     SPDLOG_TRACE("[RpcServer] received {}", it->second.req_type.name);
     slk::Save(it->second.res_type.id, &res_builder);
     slk::Save(rpc::current_version, &res_builder);
+    slk::Save(request_id, &res_builder);
     try {
       it->second.callback(&req_reader, &res_builder);
     } catch (const slk::SlkReaderException &) {
@@ -36,6 +36,16 @@ constexpr auto v3 = Version{2024'02'02'0'2'14};
 // this is due to auto index creation
 constexpr auto v4 = Version{2024'07'02'0'2'18};
 
-constexpr auto current_version = v4;
+// Requests and responses carry the id of the request after the version,
+// so many requests can be in flight on one connection
+constexpr auto v5 = Version{2024'11'04'0'2'21};
+
+// Segments of the requests may be compressed
+constexpr auto v6 = Version{2024'11'18'0'2'21};
+
+// Snapshots may be sent as the difference to a snapshot of the replica
+constexpr auto v7 = Version{2024'11'25'0'2'21};
+
+constexpr auto current_version = v7;
 
 }  // namespace memgraph::rpc
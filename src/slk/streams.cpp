@@ -11,6 +11,8 @@
 
 #include "slk/streams.hpp"
 
+#include <zlib.h>
+#include <algorithm>
 #include <cstring>
 #include <utility>
 
@@ -21,6 +23,11 @@ namespace memgraph::slk {
 Builder::Builder(std::function<void(const uint8_t *, size_t, bool)> write_func) : write_func_(std::move(write_func)) {}
 
 void Builder::Save(const uint8_t *data, uint64_t size) {
+  if (size >= kSegmentDirectSaveSize) {
+    SaveDirect(data, size);
+    return;
+  }
+
   size_t offset = 0;
   while (size > 0) {
     FlushSegment(false);
@@ -39,12 +46,44 @@ void Builder::Save(const uint8_t *data, uint64_t size) {
   }
 }
 
+void Builder::SaveDirect(const uint8_t *data, uint64_t size) {
+  // The buffered data goes out first so the data stays in order.
+  if (pos_ > 0) WriteSegment(false);
+
+  while (size > 0) {
+    auto len = static_cast<SegmentSize>(std::min(size, kSegmentMaxDataSize));
+    if (!WriteCompressedSegment(data, len, false)) {
+      write_func_(reinterpret_cast<const uint8_t *>(&len), sizeof(SegmentSize), true);
+      write_func_(data, len, true);
+    }
+    data += len;
+    size -= len;
+  }
+  wrote_segment_ = true;
+}
+
 void Builder::Finalize() { FlushSegment(true); }
 
 void Builder::FlushSegment(bool final_segment) {
   if (!final_segment && pos_ < kSegmentMaxDataSize) return;
+  WriteSegment(final_segment);
+}
+
+void Builder::WriteSegment(bool final_segment) {
+  if (final_segment && pos_ == 0 && wrote_segment_) {
+    // The data was written as segments of its own, only the footer is left.
+    SegmentSize footer = 0;
+    write_func_(reinterpret_cast<const uint8_t *>(&footer), sizeof(SegmentSize), false);
+    return;
+  }
   MG_ASSERT(pos_ > 0, "Trying to flush out a segment that has no data in it!");
 
+  if (WriteCompressedSegment(segment_.data() + sizeof(SegmentSize), pos_, final_segment)) {
+    pos_ = 0;
+    wrote_segment_ = true;
+    return;
+  }
+
   size_t total_size = sizeof(SegmentSize) + pos_;
 
   SegmentSize size = pos_;
@@ -59,6 +98,34 @@ void Builder::FlushSegment(bool final_segment) {
   write_func_(segment_.data(), total_size, !final_segment);
 
   pos_ = 0;
+  wrote_segment_ = true;
+}
+
+bool Builder::WriteCompressedSegment(const uint8_t *data, SegmentSize size, bool final_segment) {
+  if (!compress_ || size < kSegmentMinCompressSize) return false;
+
+  // The segment is written as its size, the uncompressed size, the compressed
+  // data and the footer if it is the final one.
+  auto bound = compressBound(size);
+  compressed_.resize(sizeof(SegmentSize) * 3 + bound);
+  auto *compressed_data = compressed_.data() + sizeof(SegmentSize) * 2;
+  uLongf compressed_size = bound;
+  if (compress2(compressed_data, &compressed_size, data, size, Z_BEST_SPEED) != Z_OK) return false;
+  if (sizeof(SegmentSize) + compressed_size >= size) return false;
+
+  auto len = static_cast<SegmentSize>(sizeof(SegmentSize) + compressed_size) | kSegmentCompressedFlag;
+  memcpy(compressed_.data(), &len, sizeof(SegmentSize));
+  memcpy(compressed_.data() + sizeof(SegmentSize), &size, sizeof(SegmentSize));
+  size_t total_size = sizeof(SegmentSize) * 2 + compressed_size;
+
+  if (final_segment) {
+    SegmentSize footer = 0;
+    memcpy(compressed_.data() + total_size, &footer, sizeof(SegmentSize));
+    total_size += sizeof(SegmentSize);
+  }
+
+  write_func_(compressed_.data(), total_size, !final_segment);
+  return true;
 }
 
 Reader::Reader(const uint8_t *data, size_t size) : data_(data), size_(size) {}
@@ -71,14 +138,27 @@ void Reader::Load(uint8_t *data, uint64_t size) {
     if (to_read > have_) {
       to_read = have_;
     }
-    memcpy(data + offset, data_ + pos_, to_read);
-    pos_ += to_read;
+    memcpy(data + offset, segment_, to_read);
+    segment_ += to_read;
     have_ -= to_read;
     offset += to_read;
     size -= to_read;
   }
 }
 
+std::span<const uint8_t> Reader::LoadSpan(uint64_t size) {
+  if (size == 0) return {};
+  GetSegment();
+  size_t to_read = size;
+  if (to_read > have_) {
+    to_read = have_;
+  }
+  std::span<const uint8_t> ret{segment_, to_read};
+  segment_ += to_read;
+  have_ -= to_read;
+  return ret;
+}
+
 void Reader::Finalize() { GetSegment(true); }
 
 void Reader::GetSegment(bool should_be_final) {
@@ -107,10 +187,39 @@ void Reader::GetSegment(bool should_be_final) {
   // segment can be reread if some of the above checks fail.
   pos_ += sizeof(SegmentSize);
 
+  bool compressed = (len & kSegmentCompressedFlag) != 0;
+  len &= ~kSegmentCompressedFlag;
   if (pos_ + len > size_) {
     throw SlkReaderException("There isn't enough data in the SLK stream!");
   }
-  have_ = len;
+  if (compressed) {
+    DecompressSegment(data_ + pos_, len);
+  } else {
+    segment_ = data_ + pos_;
+    have_ = len;
+  }
+  pos_ += len;
+}
+
+void Reader::DecompressSegment(const uint8_t *data, SegmentSize size) {
+  SegmentSize original_size = 0;
+  if (size < sizeof(SegmentSize)) {
+    throw SlkReaderException("Size data missing in compressed SLK segment!");
+  }
+  memcpy(&original_size, data, sizeof(SegmentSize));
+  if (original_size == 0 || original_size > kSegmentMaxDataSize) {
+    throw SlkReaderException("Invalid size of compressed SLK segment!");
+  }
+
+  decompressed_.resize(original_size);
+  uLongf decompressed_size = original_size;
+  if (uncompress(decompressed_.data(), &decompressed_size, data + sizeof(SegmentSize), size - sizeof(SegmentSize)) !=
+          Z_OK ||
+      decompressed_size != original_size) {
+    throw SlkReaderException("Couldn't decompress SLK segment!");
+  }
+  segment_ = decompressed_.data();
+  have_ = original_size;
 }
 
 StreamInfo CheckStreamComplete(const uint8_t *data, size_t size) {
@@ -128,6 +237,7 @@ StreamInfo CheckStreamComplete(const uint8_t *data, size_t size) {
     if (len == 0) {
       break;
     }
+    len &= ~kSegmentCompressedFlag;
 
     if (pos + len > size) {
       return {StreamStatus::PARTIAL, pos + kSegmentMaxTotalSize, data_size};
@@ -14,6 +14,8 @@
 #include <cstdint>
 #include <functional>
 #include <limits>
+#include <span>
+#include <vector>
 
 #include "utils/exceptions.hpp"
 
@@ -31,6 +33,22 @@ const uint64_t kSegmentMaxTotalSize = kSegmentMaxDataSize + sizeof(SegmentSize)
 static_assert(kSegmentMaxDataSize <= std::numeric_limits<SegmentSize>::max(),
               "The SLK segment can't be larger than the type used to store its size!");
 
+// Data of at least `kSegmentDirectSaveSize` bytes isn't copied into the
+// segment buffer, it is written from the memory of the caller as segments of
+// its own. Below that size fewer calls of the write function are cheaper than
+// the copy.
+const uint64_t kSegmentDirectSaveSize = 65536;
+
+// The highest bit of the `size` field marks a compressed segment, its data
+// is then the size of the uncompressed data followed by the zlib compressed
+// data. Segments smaller than `kSegmentMinCompressSize` aren't compressed
+// because their compression doesn't pay off.
+const SegmentSize kSegmentCompressedFlag = SegmentSize{1} << 31U;
+const uint64_t kSegmentMinCompressSize = 512;
+
+static_assert(kSegmentMaxDataSize < kSegmentCompressedFlag,
+              "The size of a SLK segment can't overlap with the compression flag!");
+
 /// SLK splits binary data into segments. Segments are used to avoid the need to
 /// have all of the encoded data in memory at once during the building process.
 /// That enables streaming during the building process and makes the whole
@@ -42,28 +60,50 @@ static_assert(kSegmentMaxDataSize <= std::numeric_limits<SegmentSize>::max(),
 /// size of `kSegmentMaxDataSize`. The `size` field itself has a size of
 /// `sizeof(SegmentSize)`. A segment of size 0 indicates that we have reached
 /// the end of a stream and that there is no more data to be read/written.
+/// The reader decompresses compressed segments, so a stream may mix them with
+/// uncompressed ones.
 
 /// Builder used to create a SLK segment stream.
 class Builder {
  public:
   explicit Builder(std::function<void(const uint8_t *, size_t, bool)> write_func);
   Builder(Builder &&other, std::function<void(const uint8_t *, size_t, bool)> write_func)
-      : write_func_{std::move(write_func)}, pos_{std::exchange(other.pos_, 0)}, segment_{other.segment_} {
+      : write_func_{std::move(write_func)},
+        pos_{std::exchange(other.pos_, 0)},
+        wrote_segment_{std::exchange(other.wrote_segment_, false)},
+        compress_{other.compress_},
+        segment_{other.segment_},
+        compressed_{std::move(other.compressed_)} {
     other.write_func_ = [](const uint8_t *, size_t, bool) { /* Moved builder is defunct, no write possible */ };
   }
 
-  /// Function used internally by SLK to serialize the data.
+  /// Function used internally by SLK to serialize the data. Data of at least
+  /// `kSegmentDirectSaveSize` bytes is passed to the write function without
+  /// being copied, so it only has to be valid during the call.
   void Save(const uint8_t *data, uint64_t size);
 
   /// Function that should be called after all `slk::Save` operations are done.
   void Finalize();
 
+  /// Compresses the segments which are written after the call. A segment is
+  /// written uncompressed if compression doesn't make it smaller.
+  void EnableCompression() { compress_ = true; }
+
  private:
   void FlushSegment(bool final_segment);
+  void WriteSegment(bool final_segment);
+  void SaveDirect(const uint8_t *data, uint64_t size);
+  // Returns false if the segment wasn't written because it isn't compressed.
+  bool WriteCompressedSegment(const uint8_t *data, SegmentSize size, bool final_segment);
 
   std::function<void(const uint8_t *, size_t, bool)> write_func_;
   size_t pos_{0};
+  // Set once a segment was written, the final segment may then be empty.
+  bool wrote_segment_{false};
+  bool compress_{false};
   std::array<uint8_t, kSegmentMaxTotalSize> segment_;
+  // Allocated once the first segment is compressed.
+  std::vector<uint8_t> compressed_;
 };
 
 /// Exception that will be thrown if segments can't be decoded from the byte
@@ -82,17 +122,29 @@ class Reader {
   /// Function used internally by SLK to deserialize the data.
   void Load(uint8_t *data, uint64_t size);
 
+  /// Returns at most @p size of the following bytes of the stream without
+  /// copying them. Fewer bytes are returned when a segment ends before, so
+  /// the caller loads the rest with further calls. The span points into the
+  /// data the reader was made with, or into the decompressed segment, and is
+  /// valid until the next load.
+  std::span<const uint8_t> LoadSpan(uint64_t size);
+
   /// Function that should be called after all `slk::Load` operations are done.
   void Finalize();
 
  private:
   void GetSegment(bool should_be_final = false);
+  void DecompressSegment(const uint8_t *data, SegmentSize size);
 
   const uint8_t *data_;
   size_t size_;
 
+  // Position of the next segment.
   size_t pos_{0};
+  // Unread data of the current segment.
+  const uint8_t *segment_{nullptr};
   size_t have_{0};
+  std::vector<uint8_t> decompressed_;
 };
 
 /// Stream status that is returned by the `CheckStreamComplete` function.
@@ -1,4 +1,4 @@
-// Copyright 2023 Memgraph Ltd.
+// Copyright 2024 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -24,6 +24,10 @@ class AllVerticesIterable final {
   Transaction *transaction_;
   View view_;
   std::optional<VertexAccessor> vertex_;
+  // Optional [lower, upper) Gid range used when the vertices are iterated in
+  // disjoint chunks (e.g. by parallel scans).
+  std::optional<Gid> lower_bound_;
+  std::optional<Gid> upper_bound_;
 
  public:
   class Iterator final {
@@ -46,7 +50,20 @@ class AllVerticesIterable final {
                       View view)
       : vertices_accessor_(std::move(vertices_accessor)), storage_(storage), transaction_(transaction), view_(view) {}
 
-  Iterator begin() { return {this, vertices_accessor_.begin()}; }
+  /// Iterable over the vertices with Gid in [lower_bound, upper_bound). Missing
+  /// bounds are treated as the beginning and the end of the list.
+  AllVerticesIterable(utils::SkipList<Vertex>::Accessor vertices_accessor, Storage *storage, Transaction *transaction,
+                      View view, std::optional<Gid> lower_bound, std::optional<Gid> upper_bound)
+      : vertices_accessor_(std::move(vertices_accessor)),
+        storage_(storage),
+        transaction_(transaction),
+        view_(view),
+        lower_bound_(lower_bound),
+        upper_bound_(upper_bound) {}
+
+  Iterator begin() {
+    return {this, lower_bound_ ? vertices_accessor_.find_equal_or_greater(*lower_bound_) : vertices_accessor_.begin()};
+  }
   Iterator end() { return {this, vertices_accessor_.end()}; }
 };
 
@@ -12,12 +12,202 @@
 #include "storage/v2/commit_log.hpp"
 #include "utils/memory.hpp"
 
+#include <limits>
 #include <mutex>
 
 namespace memgraph::storage {
-CommitLog::CommitLog() : allocator_(utils::NewDeleteResource()) {}
+CommitLog::CommitLog() : CommitLog(0) {}
 
 CommitLog::CommitLog(uint64_t oldest_active) : allocator_(utils::NewDeleteResource()) {
+  auto *head = NewBlock(oldest_active / kIdsInBlock * kIdsInBlock);
+
+  // set all the previous ids
+  const auto field_idx = (oldest_active % kIdsInBlock) / kIdsInField;
+  for (size_t i = 0; i < field_idx; ++i) {
+    head->field[i].store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+  }
+
+  const auto idx_in_field = oldest_active % kIdsInField;
+  if (idx_in_field != 0) {
+    head->field[field_idx].store(std::numeric_limits<uint64_t>::max() >> (kIdsInField - idx_in_field),
+                                 std::memory_order_relaxed);
+  }
+
+  head_.store(head);
+  tail_.store(head);
+  oldest_active_.store(oldest_active);
+}
+
+CommitLog::~CommitLog() {
+  for (auto *retired : {retired_, retiring_}) {
+    while (retired) {
+      Block *tmp = retired->retired_next;
+      DeleteBlock(retired);
+      retired = tmp;
+    }
+  }
+  Block *head = head_.load();
+  while (head) {
+    Block *tmp = head->next.load();
+    DeleteBlock(head);
+    head = tmp;
+  }
+}
+
+void CommitLog::MarkFinished(uint64_t id) {
+  const auto epoch = EnterBlocks();
+  bool reclaim = false;
+  try {
+    Block *block = FindOrCreateBlock(id);
+    block->field[(id % kIdsInBlock) / kIdsInField].fetch_or(1ULL << (id % kIdsInField));
+    // The oldest active id has to be checked after marking, see `UpdateOldestActive`
+    if (id == oldest_active_.load()) {
+      UpdateOldestActive();
+    }
+    reclaim = head_.load()->start + kIdsInBlock <= oldest_active_.load() || has_retired_.load();
+  } catch (...) {
+    ExitBlocks(epoch);
+    throw;
+  }
+  ExitBlocks(epoch);
+
+  if (reclaim) ReclaimBlocks();
+}
+
+uint64_t CommitLog::EnterBlocks() {
+  while (true) {
+    const auto epoch = epoch_.load();
+    readers_[epoch % 2].fetch_add(1);
+    // The epoch could have changed before the reader was registered
+    if (epoch_.load() == epoch) return epoch;
+    readers_[epoch % 2].fetch_sub(1);
+  }
+}
+
+void CommitLog::ExitBlocks(uint64_t epoch) { readers_[epoch % 2].fetch_sub(1); }
+
+CommitLog::Block *CommitLog::FindOrCreateBlock(const uint64_t id) {
+  // Unfinished ids are never before the head
+  Block *current = tail_.load();
+  if (current->start > id) current = head_.load();
+
+  while (id >= current->start + kIdsInBlock) {
+    Block *next = current->next.load();
+    if (!next) {
+      auto *block = NewBlock(current->start + kIdsInBlock);
+      if (current->next.compare_exchange_strong(next, block)) {
+        next = block;
+        auto *tail = tail_.load();
+        while (tail->start < block->start && !tail_.compare_exchange_weak(tail, block)) {
+        }
+      } else {
+        // Another thread appended the block, `next` was updated to it
+        DeleteBlock(block);
+      }
+    }
+    current = next;
+  }
+
+  return current;
+}
+
+CommitLog::Block *CommitLog::FindBlock(const uint64_t id) const {
+  Block *current = tail_.load();
+  if (current->start > id) current = head_.load();
+  while (current && id >= current->start + kIdsInBlock) {
+    current = current->next.load();
+  }
+  return current;
+}
+
+bool CommitLog::IsFinished(const uint64_t id) const {
+  const auto *block = FindBlock(id);
+  if (!block) return false;
+  return (block->field[(id % kIdsInBlock) / kIdsInField].load() & (1ULL << (id % kIdsInField))) != 0;
+}
+
+uint64_t CommitLog::FirstActiveFrom(uint64_t id) const {
+  const auto *block = FindBlock(id);
+  while (block) {
+    // Starting from the field of `id` keeps the complexity amortized constant
+    const auto start_field = (id - block->start) / kIdsInField;
+    for (uint64_t i = start_field; i < kBlockSize; ++i) {
+      auto field = block->field[i].load();
+      if (i == start_field) field |= (1ULL << (id % kIdsInField)) - 1;
+      if (field != std::numeric_limits<uint64_t>::max()) {
+        return block->start + i * kIdsInField + __builtin_ffsl(~field) - 1;
+      }
+    }
+    id = block->start + kIdsInBlock;
+    block = block->next.load();
+  }
+  return id;
+}
+
+void CommitLog::UpdateOldestActive() {
+  // A thread marking the id right after the oldest one might have checked the
+  // oldest active id before it was advanced. Because the advancing thread
+  // checks the new oldest id again after the CAS, one of the two threads
+  // always sees the other one's change.
+  auto oldest = oldest_active_.load();
+  while (IsFinished(oldest)) {
+    const auto next = FirstActiveFrom(oldest);
+    if (oldest_active_.compare_exchange_strong(oldest, next)) {
+      oldest = next;
+    }
+  }
+}
+
+void CommitLog::ReclaimBlocks() {
+  if (!reclaim_lock_.try_lock()) return;
+  auto guard = std::lock_guard{reclaim_lock_, std::adopt_lock};
+
+  const auto epoch = epoch_.load();
+  // Readers of the current epoch entered after the blocks were unlinked
+  if (retired_ && readers_[(epoch + 1) % 2].load() == 0) {
+    while (retired_) {
+      Block *tmp = retired_->retired_next;
+      DeleteBlock(retired_);
+      retired_ = tmp;
+    }
+  }
+
+  // Only this function changes the head, so it can be read without entering
+  const auto oldest = oldest_active_.load();
+  Block *head = head_.load();
+  while (head->start + kIdsInBlock <= oldest) {
+    Block *next = head->next.load();
+    if (!next) break;
+    head_.store(next);
+    Block *expected = head;
+    tail_.compare_exchange_strong(expected, next);
+    head->retired_next = retiring_;
+    retiring_ = head;
+    head = next;
+  }
+
+  if (!retired_ && retiring_) {
+    retired_ = retiring_;
+    retiring_ = nullptr;
+    epoch_.store(epoch + 1);
+  }
+  has_retired_.store(retired_ != nullptr || retiring_ != nullptr);
+}
+
+CommitLog::Block *CommitLog::NewBlock(uint64_t start) {
+  auto *block = allocator_.allocate(1);
+  allocator_.construct(block, start);
+  return block;
+}
+
+void CommitLog::DeleteBlock(Block *block) {
+  block->~Block();
+  allocator_.deallocate(block, 1);
+}
+
+LockingCommitLog::LockingCommitLog() : allocator_(utils::NewDeleteResource()) {}
+
+LockingCommitLog::LockingCommitLog(uint64_t oldest_active) : allocator_(utils::NewDeleteResource()) {
   head_ = allocator_.allocate(1);
   allocator_.construct(head_);
   head_start_ = oldest_active / kIdsInBlock * kIdsInBlock;
@@ -38,7 +228,7 @@ CommitLog::CommitLog(uint64_t oldest_active) : allocator_(utils::NewDeleteResour
   oldest_active_ = oldest_active;
 }
 
-CommitLog::~CommitLog() {
+LockingCommitLog::~LockingCommitLog() {
   while (head_) {
     Block *tmp = head_->next;
     head_->~Block();
@@ -47,7 +237,7 @@ CommitLog::~CommitLog() {
   }
 }
 
-void CommitLog::MarkFinished(uint64_t id) {
+void LockingCommitLog::MarkFinished(uint64_t id) {
   auto guard = std::lock_guard{lock_};
 
   Block *block = FindOrCreateBlock(id);
@@ -57,12 +247,12 @@ void CommitLog::MarkFinished(uint64_t id) {
   }
 }
 
-uint64_t CommitLog::OldestActive() {
+uint64_t LockingCommitLog::OldestActive() {
   auto guard = std::lock_guard{lock_};
   return oldest_active_;
 }
 
-void CommitLog::UpdateOldestActive() {
+void LockingCommitLog::UpdateOldestActive() {
   while (head_) {
     // This is necessary for amortized constant complexity. If we always start
     // from the 0th field, the amount of steps we make through each block is
@@ -86,7 +276,7 @@ void CommitLog::UpdateOldestActive() {
   oldest_active_ = next_start_;
 }
 
-CommitLog::Block *CommitLog::FindOrCreateBlock(const uint64_t id) {
+LockingCommitLog::Block *LockingCommitLog::FindOrCreateBlock(const uint64_t id) {
   if (!head_) {
     head_ = allocator_.allocate(1);
     allocator_.construct(head_);
@@ -12,6 +12,7 @@
 /// @file commit_log.hpp
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <mutex>
 
@@ -29,10 +30,12 @@ namespace memgraph::storage {
 /// SetFinished) and retrieve the minimal ID still in the set (\ref
 /// OldestActive).
 ///
-/// This class is thread-safe.
+/// This class is thread-safe and lock-free on the common path. IDs are marked
+/// with an atomic fetch_or on the bit fields of the blocks and the oldest active
+/// ID is advanced with a CAS. Blocks whose IDs are all finished are unlinked
+/// and freed once no thread entered before the unlinking still reads them.
 class CommitLog final {
  public:
-  // TODO(mtomic): use pool allocator for blocks
   CommitLog();
   /// Create a commit log which has the oldest active id set to
   /// oldest_active
@@ -51,6 +54,77 @@ class CommitLog final {
   void MarkFinished(uint64_t id);
 
   /// Retrieve the oldest transaction still not marked as finished.
+  uint64_t OldestActive() const { return oldest_active_.load(); }
+
+ private:
+  static constexpr uint64_t kBlockSize = 8192;
+  static constexpr uint64_t kIdsInField = sizeof(uint64_t) * 8;
+  static constexpr uint64_t kIdsInBlock = kBlockSize * kIdsInField;
+
+  struct Block {
+    explicit Block(uint64_t start) : start(start) {}
+
+    const uint64_t start;
+    std::atomic<Block *> next{nullptr};
+    // Links the blocks which were unlinked but not yet freed.
+    Block *retired_next{nullptr};
+    std::atomic<uint64_t> field[kBlockSize]{};
+  };
+
+  /// Registers the calling thread as a reader of the blocks. Returns the epoch
+  /// to pass to \ref ExitBlocks.
+  uint64_t EnterBlocks();
+  void ExitBlocks(uint64_t epoch);
+
+  /// @throw std::bad_alloc
+  Block *FindOrCreateBlock(uint64_t id);
+  Block *FindBlock(uint64_t id) const;
+  bool IsFinished(uint64_t id) const;
+  /// Returns the minimal ID no smaller than `id` which isn't finished.
+  uint64_t FirstActiveFrom(uint64_t id) const;
+  void UpdateOldestActive();
+  /// Unlinks the finished blocks and frees the ones no reader can access.
+  /// Skipped if another thread is already doing it.
+  void ReclaimBlocks();
+
+  /// @throw std::bad_alloc
+  Block *NewBlock(uint64_t start);
+  void DeleteBlock(Block *block);
+
+  std::atomic<Block *> head_{nullptr};
+  // A hint pointing at (or close before) the newest block.
+  std::atomic<Block *> tail_{nullptr};
+  std::atomic<uint64_t> oldest_active_{0};
+
+  std::atomic<uint64_t> epoch_{0};
+  std::atomic<uint64_t> readers_[2]{};
+  std::atomic<bool> has_retired_{false};
+  utils::SpinLock reclaim_lock_;
+  // Blocks unlinked before the last epoch change, only readers of the previous
+  // epoch can still access them.
+  Block *retired_{nullptr};
+  // Blocks unlinked after the last epoch change.
+  Block *retiring_{nullptr};
+  utils::Allocator<Block> allocator_;
+};
+
+/// The previous implementation of \ref CommitLog which guards the blocks with a
+/// spin lock. Kept as the baseline for the commit log benchmark.
+class LockingCommitLog final {
+ public:
+  LockingCommitLog();
+  explicit LockingCommitLog(uint64_t oldest_active);
+
+  LockingCommitLog(const LockingCommitLog &) = delete;
+  LockingCommitLog &operator=(const LockingCommitLog &) = delete;
+  LockingCommitLog(LockingCommitLog &&) = delete;
+  LockingCommitLog &operator=(LockingCommitLog &&) = delete;
+
+  ~LockingCommitLog();
+
+  /// @throw std::bad_alloc
+  void MarkFinished(uint64_t id);
+
   uint64_t OldestActive();
 
  private:
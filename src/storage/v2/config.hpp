@@ -100,6 +100,15 @@ struct Config {
 
     Type type{Type::PERIODIC};
     std::chrono::milliseconds interval{std::chrono::milliseconds(1000)};
+    // When non-zero, a periodic GC cycle is split into slices which unlink
+    // deltas for at most this long, so the GC doesn't hold its locks for long.
+    std::chrono::milliseconds slice{0};
+    // Number of background threads which free the collected deltas. When 0 the
+    // deltas are freed by the GC itself.
+    uint64_t release_threads{0};
+    // How often the adjacency lists are compacted while the storage is in the
+    // IN_MEMORY_ANALYTICAL mode, zero disables the compaction.
+    std::chrono::seconds analytical_compaction_interval{0};
     friend bool operator==(const Gc &lrh, const Gc &rhs) = default;
   } gc;  // SYSTEM FLAG
 
@@ -114,17 +123,25 @@ struct Config {
 
     std::chrono::milliseconds snapshot_interval{std::chrono::minutes(2)};  // PER DATABASE
     uint64_t snapshot_retention_count{3};                                  // PER DATABASE
+    uint64_t snapshot_min_wal_percent{0};                                  // PER DATABASE
 
     uint64_t wal_file_size_kibibytes{20 * 1024};  // PER DATABASE
     uint64_t wal_file_flush_every_n_tx{100000};   // PER DATABASE
+    bool wal_group_commit{false};                 // PER DATABASE
 
     bool snapshot_on_exit{false};                      // PER DATABASE
     bool restore_replication_state_on_startup{false};  // PER INSTANCE
 
     uint64_t items_per_batch{1'000'000};  // PER DATABASE
     uint64_t recovery_thread_count{8};    // PER INSTANCE SYSTEM FLAG
-
-    bool allow_parallel_schema_creation{false};  // PER DATABASE
+    // Databases (other than the default one) nobody used for this long are
+    // unloaded and recovered again on their next use, zero keeps them loaded.
+    std::chrono::seconds unload_idle_after{0};  // PER INSTANCE SYSTEM FLAG
+
+    bool allow_parallel_schema_creation{false};    // PER DATABASE
+    bool allow_parallel_snapshot_creation{false};  // PER DATABASE
+    bool snapshot_batch_compression{false};        // PER DATABASE
+    bool allow_parallel_wal_recovery{false};       // PER DATABASE
     friend bool operator==(const Durability &lrh, const Durability &rhs) = default;
   } durability;
 
@@ -133,6 +150,28 @@ struct Config {
     friend bool operator==(const Transaction &lrh, const Transaction &rhs) = default;
   } transaction;  // PER DATABASE
 
+  struct Indices {
+    // Number of threads which populate a label or label-property index that
+    // is created at runtime.
+    uint64_t creation_thread_count{1};
+    // How often the statistics of the analyzed indices are checked for
+    // staleness, zero disables the background refresh.
+    std::chrono::seconds stats_refresh_interval{0};
+    // Fraction of an index which has to change since its statistics were
+    // computed for them to be recomputed.
+    double stats_refresh_threshold{0.1};
+    // Unique constraints created in memory keep their entries in a hash table
+    // instead of a skip list.
+    bool hash_unique_constraints{false};
+    // In-memory vertices are also kept in an array indexed by gid, so they are
+    // found by gid without searching the skip list.
+    bool vertex_gid_table{false};
+    // How often the changes of committed transactions are applied to the text
+    // indices in the background, zero applies them at each commit.
+    std::chrono::milliseconds text_index_refresh_interval{0};
+    friend bool operator==(const Indices &lrh, const Indices &rhs) = default;
+  } indices;  // PER INSTANCE SYSTEM FLAG
+
   struct DiskConfig {
     std::filesystem::path main_storage_directory{"storage/rocksdb_main_storage"};
     std::filesystem::path label_index_directory{"storage/rocksdb_label_index"};
@@ -142,6 +181,15 @@ struct Config {
     std::filesystem::path id_name_mapper_directory{"storage/rocksdb_id_name_mapper"};
     std::filesystem::path durability_directory{"storage/rocksdb_durability"};
     std::filesystem::path wal_directory{"storage/rocksdb_wal"};
+    // Size of the RocksDB block cache the column families share, zero keeps
+    // the default cache of each column family.
+    uint64_t block_cache_size{0};
+    // Bits per key of the bloom filters of the column families read with
+    // point lookups, zero disables the filters.
+    uint64_t bloom_filter_bits_per_key{0};
+    // Vertices read from disk which are kept for the following transactions,
+    // zero disables the cache.
+    uint64_t vertex_cache_size{0};
     friend bool operator==(const DiskConfig &lrh, const DiskConfig &rhs) = default;
   } disk;
 
@@ -1,4 +1,4 @@
-// Copyright 2023 Memgraph Ltd.
+// Copyright 2024 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -24,7 +24,12 @@ void ConstraintVerificationInfo::AddedLabel(Vertex const *vertex) { added_labels
 
 void ConstraintVerificationInfo::AddedProperty(Vertex const *vertex) { added_properties_.insert(vertex); }
 
-void ConstraintVerificationInfo::RemovedProperty(Vertex const *vertex) { removed_properties_.insert(vertex); }
+void ConstraintVerificationInfo::RemovedProperty(Vertex const *vertex, PropertyId property) {
+  auto &properties = removed_properties_[vertex];
+  if (std::find(properties.begin(), properties.end(), property) == properties.end()) {
+    properties.push_back(property);
+  }
+}
 
 auto ConstraintVerificationInfo::GetVerticesForUniqueConstraintChecking() const -> std::unordered_set<Vertex const *> {
   std::unordered_set<Vertex const *> updated_vertices;
@@ -35,16 +40,6 @@ auto ConstraintVerificationInfo::GetVerticesForUniqueConstraintChecking() const
   return updated_vertices;
 }
 
-auto ConstraintVerificationInfo::GetVerticesForExistenceConstraintChecking() const
-    -> std::unordered_set<Vertex const *> {
-  std::unordered_set<Vertex const *> updated_vertices;
-
-  updated_vertices.insert(added_labels_.begin(), added_labels_.end());
-  updated_vertices.insert(removed_properties_.begin(), removed_properties_.end());
-
-  return updated_vertices;
-}
-
 bool ConstraintVerificationInfo::NeedsUniqueConstraintVerification() const {
   return !added_labels_.empty() || !added_properties_.empty();
 }
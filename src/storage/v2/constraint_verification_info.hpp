@@ -10,6 +10,11 @@
 // licenses/APL.txt.
 #pragma once
 
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "storage/v2/id_types.hpp"
 #include "storage/v2/vertex.hpp"
 
 namespace memgraph::storage {
@@ -36,10 +41,14 @@ struct ConstraintVerificationInfo final {
 
   void AddedProperty(Vertex const *vertex);
 
-  void RemovedProperty(Vertex const *vertex);
+  void RemovedProperty(Vertex const *vertex, PropertyId property);
 
   auto GetVerticesForUniqueConstraintChecking() const -> std::unordered_set<Vertex const *>;
-  auto GetVerticesForExistenceConstraintChecking() const -> std::unordered_set<Vertex const *>;
+
+  auto GetVerticesWithAddedLabels() const -> std::unordered_set<Vertex const *> const & { return added_labels_; }
+  auto GetRemovedProperties() const -> std::unordered_map<Vertex const *, std::vector<PropertyId>> const & {
+    return removed_properties_;
+  }
 
   bool NeedsUniqueConstraintVerification() const;
   bool NeedsExistenceConstraintVerification() const;
@@ -54,7 +63,8 @@ struct ConstraintVerificationInfo final {
   std::unordered_set<Vertex const *> added_properties_;
 
   // No update to unique constraints because uniqueness is preserved
-  // Update existence constraints because it might be the referenced property of the constraint
-  std::unordered_set<Vertex const *> removed_properties_;
+  // Update existence constraints because it might be the referenced property of the constraint, only the
+  // constraints on the removed properties have to be checked
+  std::unordered_map<Vertex const *, std::vector<PropertyId>> removed_properties_;
 };
 }  // namespace memgraph::storage
@@ -10,14 +10,26 @@
 // licenses/APL.txt.
 
 #include "storage/v2/constraints/existence_constraints.hpp"
+
+#include <unordered_map>
+
+#include "storage/v2/constraint_verification_info.hpp"
 #include "storage/v2/constraints/constraints.hpp"
 #include "storage/v2/constraints/utils.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/mvcc.hpp"
 #include "utils/logging.hpp"
 #include "utils/rw_spin_lock.hpp"
+#include "utils/thread_pool.hpp"
 namespace memgraph::storage {
 
+namespace {
+
+// Vertices validated by a thread of the pool before it takes the next batch.
+constexpr size_t kValidationBatchSize = 10'000;
+
+}  // namespace
+
 bool ExistenceConstraints::ConstraintExists(LabelId label, PropertyId property) const {
   return utils::Contains(constraints_, std::make_pair(label, property));
 }
@@ -49,6 +61,94 @@ std::vector<std::pair<LabelId, PropertyId>> ExistenceConstraints::ListConstraint
   return std::nullopt;
 }
 
+[[nodiscard]] std::optional<ConstraintViolation> ExistenceConstraints::ValidateVertices(
+    const ConstraintVerificationInfo &info) const {
+  // The constraints are grouped once, so each label of a vertex and each property it lost is looked up once.
+  std::unordered_map<LabelId, std::vector<PropertyId>> properties_by_label;
+  std::unordered_map<PropertyId, std::vector<LabelId>> labels_by_property;
+  for (const auto &[label, property] : constraints_) {
+    properties_by_label[label].push_back(property);
+    labels_by_property[property].push_back(label);
+  }
+
+  // The properties are nullptr for the vertices which got a label.
+  using VertexToValidate = std::pair<Vertex const *, std::vector<PropertyId> const *>;
+  std::vector<VertexToValidate> vertices;
+  const auto &added_labels = info.GetVerticesWithAddedLabels();
+  const auto &removed_properties = info.GetRemovedProperties();
+  vertices.reserve(added_labels.size() + removed_properties.size());
+  for (const auto *vertex : added_labels) {
+    vertices.emplace_back(vertex, nullptr);
+  }
+  for (const auto &[vertex, properties] : removed_properties) {
+    if (added_labels.contains(vertex)) continue;
+    vertices.emplace_back(vertex, &properties);
+  }
+
+  // No need to take any locks here because the transaction modified these vertices and no one else can touch them
+  // until it commits.
+  auto validate = [&](const VertexToValidate &to_validate) -> std::optional<ConstraintViolation> {
+    const auto &[vertex, removed] = to_validate;
+    if (vertex->deleted) return std::nullopt;
+    if (!removed) {
+      for (const auto label : vertex->labels) {
+        const auto it = properties_by_label.find(label);
+        if (it == properties_by_label.end()) continue;
+        for (const auto property : it->second) {
+          if (!vertex->properties.HasProperty(property)) {
+            return ConstraintViolation{ConstraintViolation::Type::EXISTENCE, label, std::set<PropertyId>{property}};
+          }
+        }
+      }
+      return std::nullopt;
+    }
+    for (const auto property : *removed) {
+      const auto it = labels_by_property.find(property);
+      // The property could have been set again later in the transaction.
+      if (it == labels_by_property.end() || vertex->properties.HasProperty(property)) continue;
+      for (const auto label : it->second) {
+        if (utils::Contains(vertex->labels, label)) {
+          return ConstraintViolation{ConstraintViolation::Type::EXISTENCE, label, std::set<PropertyId>{property}};
+        }
+      }
+    }
+    return std::nullopt;
+  };
+
+  if (vertices.size() < kParallelValidationThreshold) {
+    for (const auto &to_validate : vertices) {
+      if (auto violation = validate(to_validate); violation.has_value()) {
+        return violation;
+      }
+    }
+    return std::nullopt;
+  }
+
+  const auto batch_count = (vertices.size() + kValidationBatchSize - 1) / kValidationBatchSize;
+  std::atomic<uint64_t> batch_counter = 0;
+  memgraph::utils::Synchronized<std::optional<ConstraintViolation>, utils::RWSpinLock> maybe_error{};
+  auto &pool = utils::CpuThreadPool();
+  pool.RunParallel(std::min(batch_count, pool.Size() + 1), [&](size_t /*worker*/) {
+    while (!maybe_error.ReadLock()->has_value()) {
+      const auto batch_index = batch_counter.fetch_add(1, std::memory_order_acquire);
+      if (batch_index >= batch_count) return;
+      const auto begin = batch_index * kValidationBatchSize;
+      const auto end = std::min(begin + kValidationBatchSize, vertices.size());
+      for (auto i = begin; i < end; ++i) {
+        auto violation = validate(vertices[i]);
+        if (!violation.has_value()) [[likely]] {
+          continue;
+        }
+        maybe_error.WithLock([&violation](auto &maybe_error) {
+          if (!maybe_error.has_value()) maybe_error = std::move(violation);
+        });
+        return;
+      }
+    }
+  });
+  return *maybe_error.Lock();
+}
+
 void ExistenceConstraints::LoadExistenceConstraints(const std::vector<std::string> &keys) {
   for (const auto &key : keys) {
     const std::vector<std::string> parts = utils::Split(key, ",");
@@ -95,17 +195,10 @@ std::optional<ConstraintViolation> ExistenceConstraints::MultipleThreadsConstrai
 
   std::atomic<uint64_t> batch_counter = 0;
   memgraph::utils::Synchronized<std::optional<ConstraintViolation>, utils::RWSpinLock> maybe_error{};
-  {
-    std::vector<std::jthread> threads;
-    threads.reserve(thread_count);
-
-    for (auto i{0U}; i < thread_count; ++i) {
-      threads.emplace_back([&maybe_error, &vertex_batches, &batch_counter, &vertices, &label, &property]() {
-        do_per_thread_validation(maybe_error, ValidateVertexOnConstraint, vertex_batches, batch_counter, vertices,
-                                 label, property);
-      });
-    }
-  }
+  utils::CpuThreadPool().RunParallel(thread_count, [&](size_t /*worker*/) {
+    do_per_thread_validation(maybe_error, ValidateVertexOnConstraint, vertex_batches, batch_counter, vertices, label,
+                             property);
+  });
   if (maybe_error.Lock()->has_value()) {
     return maybe_error->value();
   }
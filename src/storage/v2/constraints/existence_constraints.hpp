@@ -24,6 +24,8 @@
 
 namespace memgraph::storage {
 
+struct ConstraintVerificationInfo;
+
 class ExistenceConstraints {
  private:
   std::vector<std::pair<LabelId, PropertyId>> constraints_;
@@ -64,6 +66,14 @@ class ExistenceConstraints {
   ///  otherwise.
   [[nodiscard]] std::optional<ConstraintViolation> Validate(const Vertex &vertex);
 
+  /// Validates the vertices a transaction changed, at its commit. The vertices which got a label are checked
+  /// against all of the constraints on their labels, the others only against the constraints on the properties
+  /// they lost. Above `kParallelValidationThreshold` vertices the validation is split over the CPU thread pool.
+  ///  Returns `std::nullopt` if all checks pass, and a `ConstraintViolation` otherwise.
+  [[nodiscard]] std::optional<ConstraintViolation> ValidateVertices(const ConstraintVerificationInfo &info) const;
+
+  static constexpr size_t kParallelValidationThreshold = 100'000;
+
   std::vector<std::pair<LabelId, PropertyId>> ListConstraints() const;
 
   void LoadExistenceConstraints(const std::vector<std::string> &keys);
@@ -13,6 +13,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <cstring>
 
 #include "storage/v2/edge_ref.hpp"
 #include "storage/v2/id_types.hpp"
@@ -124,22 +125,26 @@ inline bool operator==(const PreviousPtr::Pointer &a, const PreviousPtr::Pointer
 
 struct opt_str {
   opt_str(std::optional<std::string_view> other, utils::PageSlabMemoryResource *res)
-      : str_{other ? new_cstr(*other, res) : nullptr} {}
+      : str_{other ? new_str(*other, res) : nullptr} {}
 
   ~opt_str() = default;
 
   auto as_opt_str() const -> std::optional<std::string_view> {
     if (!str_) return std::nullopt;
-    return std::optional<std::string_view>{std::in_place, str_};
+    uint32_t size = 0;
+    std::memcpy(&size, str_, sizeof(size));
+    return std::optional<std::string_view>{std::in_place, str_ + sizeof(size), size};
   }
 
  private:
-  static auto new_cstr(std::string_view str, utils::PageSlabMemoryResource *res) -> char const * {
-    auto const n = str.size() + 1;
+  // The size is kept in front of the characters, because the keys of the
+  // disk storage are binary and can contain '\0'.
+  static auto new_str(std::string_view str, utils::PageSlabMemoryResource *res) -> char const * {
+    auto const size = static_cast<uint32_t>(str.size());
     auto alloc = std::pmr::polymorphic_allocator<char>{res};
-    auto *mem = (std::string_view::pointer)alloc.allocate_bytes(n, alignof(char));
-    std::copy(str.cbegin(), str.cend(), mem);
-    mem[n - 1] = '\0';
+    auto *mem = (std::string_view::pointer)alloc.allocate_bytes(sizeof(size) + str.size(), alignof(uint32_t));
+    std::memcpy(mem, &size, sizeof(size));
+    std::copy(str.cbegin(), str.cend(), mem + sizeof(size));
     return mem;
   }
 
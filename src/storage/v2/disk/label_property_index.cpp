@@ -65,12 +65,9 @@ bool DiskLabelPropertyIndex::CreateIndex(LabelId label, PropertyId property,
     return false;
   }
 
-  auto disk_transaction = CreateRocksDBTransaction();
-  for (const auto &[key, value] : vertices) {
-    disk_transaction->Put(key, value);
-  }
-
-  return CommitWithTimestamp(disk_transaction.get(), 0);
+  // The entries are ingested as an SST file instead of being written through a transaction. Index
+  // creation holds the unique storage lock, so no transaction writes to the index meanwhile.
+  return IngestEntries(*kvstore_, vertices, 0);
 }
 
 std::unique_ptr<rocksdb::Transaction> DiskLabelPropertyIndex::CreateRocksDBTransaction() const {
@@ -11,7 +11,12 @@
 
 #include "rocksdb_storage.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <string_view>
+
+#include <rocksdb/sst_file_writer.h>
+
 #include "utils/rocksdb_serialization.hpp"
 
 namespace memgraph::storage {
@@ -80,4 +85,44 @@ int ComparatorWithU64TsImpl::CompareTimestamp(const rocksdb::Slice &ts1, const r
   return 0;
 }
 
+bool IngestEntries(RocksDBStorage &kvstore, const std::vector<std::pair<std::string, std::string>> &entries,
+                   uint64_t ts) {
+  if (entries.empty()) return true;
+
+  // SST files must be written in the order of the comparator, which only compares the gids of the keys.
+  const auto *comparator = kvstore.options_.comparator;
+  std::vector<const std::pair<std::string, std::string> *> sorted;
+  sorted.reserve(entries.size());
+  for (const auto &entry : entries) sorted.push_back(&entry);
+  std::stable_sort(sorted.begin(), sorted.end(), [comparator](const auto *lhs, const auto *rhs) {
+    return comparator->CompareWithoutTimestamp(lhs->first, false, rhs->first, false) < 0;
+  });
+
+  static std::atomic<uint64_t> file_id{0};
+  const auto path =
+      fmt::format("{}/ingest_{}.sst", kvstore.db_->GetName(), file_id.fetch_add(1, std::memory_order_relaxed));
+  const auto timestamp = utils::StringTimestamp(ts);
+  rocksdb::SstFileWriter writer(rocksdb::EnvOptions(), kvstore.options_);
+  auto status = writer.Open(path);
+  for (auto it = sorted.begin(); status.ok() && it != sorted.end(); ++it) {
+    auto next = std::next(it);
+    if (next != sorted.end() && comparator->CompareWithoutTimestamp((*it)->first, false, (*next)->first, false) == 0) {
+      continue;
+    }
+    status = writer.Put((*it)->first, timestamp, (*it)->second);
+  }
+  if (status.ok()) status = writer.Finish();
+  if (status.ok()) {
+    rocksdb::IngestExternalFileOptions options;
+    options.move_files = true;
+    status = kvstore.db_->IngestExternalFile({path}, options);
+  }
+  if (!status.ok()) {
+    spdlog::error("rocksdb: Couldn't ingest {}: {}", path, status.ToString());
+    std::error_code error_code;
+    std::filesystem::remove(path, error_code);
+  }
+  return status.ok();
+}
+
 }  // namespace memgraph::storage
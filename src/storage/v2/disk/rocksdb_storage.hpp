@@ -18,6 +18,10 @@
 #include <rocksdb/status.h>
 #include <rocksdb/utilities/transaction_db.h>
 
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "storage/v2/edge_direction.hpp"
 #include "storage/v2/edge_ref.hpp"
 #include "storage/v2/id_types.hpp"
@@ -80,4 +84,11 @@ class ComparatorWithU64TsImpl : public rocksdb::Comparator {
   const Comparator *cmp_without_ts_{nullptr};
 };
 
+/// Writes `entries` with timestamp `ts` to an SST file and ingests it into
+/// `kvstore`, which skips the memtable and the WAL of the regular writes. The
+/// entries don't have to be sorted; of the entries with equal keys the last
+/// one is kept. Returns false if the file couldn't be written or ingested.
+bool IngestEntries(RocksDBStorage &kvstore, const std::vector<std::pair<std::string, std::string>> &entries,
+                   uint64_t ts);
+
 }  // namespace memgraph::storage
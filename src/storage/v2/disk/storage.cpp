@@ -11,6 +11,7 @@
 
 #include "storage/v2/disk/storage.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <limits>
@@ -19,11 +20,14 @@
 #include <string_view>
 #include <vector>
 
+#include <rocksdb/cache.h>
 #include <rocksdb/comparator.h>
 #include <rocksdb/db.h>
+#include <rocksdb/filter_policy.h>
 #include <rocksdb/slice.h>
 
 #include <rocksdb/options.h>
+#include <rocksdb/table.h>
 #include <rocksdb/utilities/transaction.h>
 #include <rocksdb/utilities/transaction_db.h>
 
@@ -235,12 +239,49 @@ bool IsPropertyValueWithinInterval(const PropertyValue &value,
   return true;
 }
 
+// Gids of the vertices a committing transaction writes to or deletes from the vertex column family.
+std::vector<Gid> CollectWrittenVertices(Transaction &transaction) {
+  std::vector<Gid> gids;
+  for (const Vertex &vertex : transaction.vertices_->access()) {
+    if (VertexNeedsToBeSerialized(vertex)) gids.push_back(vertex.gid);
+  }
+  for (const auto &vec : transaction.index_storage_) {
+    for (const Vertex &vertex : vec->access()) {
+      if (VertexNeedsToBeSerialized(vertex)) gids.push_back(vertex.gid);
+    }
+  }
+  for (const auto &[vertex_gid, key] : transaction.vertices_to_delete_) {
+    gids.push_back(Gid::FromString(vertex_gid));
+  }
+  return gids;
+}
+
+// Reads the values of the edges with `edge_gids` from the edge column family with one batched lookup.
+std::vector<std::string> MultiGetEdgeValues(rocksdb::Transaction *disk_transaction, rocksdb::ReadOptions ro,
+                                            rocksdb::ColumnFamilyHandle *edge_chandle,
+                                            const std::vector<std::string> &edge_gids) {
+  std::vector<rocksdb::Slice> keys(edge_gids.begin(), edge_gids.end());
+  std::vector<rocksdb::PinnableSlice> values(keys.size());
+  std::vector<rocksdb::Status> statuses(keys.size());
+  ro.async_io = true;
+  disk_transaction->MultiGet(ro, edge_chandle, keys.size(), keys.data(), values.data(), statuses.data());
+
+  std::vector<std::string> edge_values;
+  edge_values.reserve(keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    MG_ASSERT(statuses[i].ok(), "rocksdb: Failed to find edge with gid {} in edge column family", edge_gids[i]);
+    edge_values.emplace_back(values[i].ToStringView());
+  }
+  return edge_values;
+}
+
 }  // namespace
 
 DiskStorage::DiskStorage(Config config)
     : Storage(config, StorageMode::ON_DISK_TRANSACTIONAL),
       kvstore_(std::make_unique<RocksDBStorage>()),
-      durable_metadata_(config) {
+      durable_metadata_(config),
+      vertex_cache_(config.disk.vertex_cache_size) {
   LoadPersistingMetadataInfo();
   kvstore_->options_.create_if_missing = true;
   kvstore_->options_.comparator = new ComparatorWithU64TsImpl();
@@ -248,14 +289,28 @@ DiskStorage::DiskStorage(Config config)
   kvstore_->options_.wal_recovery_mode = rocksdb::WALRecoveryMode::kPointInTimeRecovery;
   kvstore_->options_.wal_dir = config_.disk.wal_directory;
   kvstore_->options_.wal_compression = rocksdb::kNoCompression;
+
+  // The vertex column family is only iterated, the others are read by key and get the bloom filters.
+  rocksdb::BlockBasedTableOptions table_options;
+  if (config.disk.block_cache_size > 0) {
+    table_options.block_cache = rocksdb::NewLRUCache(config.disk.block_cache_size);
+  }
+  kvstore_->options_.table_factory.reset(rocksdb::NewBlockBasedTableFactory(table_options));
+  rocksdb::ColumnFamilyOptions lookup_options{kvstore_->options_};
+  if (config.disk.bloom_filter_bits_per_key > 0) {
+    table_options.filter_policy.reset(
+        rocksdb::NewBloomFilterPolicy(static_cast<double>(config.disk.bloom_filter_bits_per_key)));
+    lookup_options.table_factory.reset(rocksdb::NewBlockBasedTableFactory(table_options));
+  }
+
   std::vector<rocksdb::ColumnFamilyHandle *> column_handles;
   std::vector<rocksdb::ColumnFamilyDescriptor> column_families;
   if (utils::DirExists(config.disk.main_storage_directory)) {
     column_families.emplace_back(kVertexHandle, kvstore_->options_);
-    column_families.emplace_back(kEdgeHandle, kvstore_->options_);
+    column_families.emplace_back(kEdgeHandle, lookup_options);
     column_families.emplace_back(kDefaultHandle, kvstore_->options_);
-    column_families.emplace_back(kOutEdgesHandle, kvstore_->options_);
-    column_families.emplace_back(kInEdgesHandle, kvstore_->options_);
+    column_families.emplace_back(kOutEdgesHandle, lookup_options);
+    column_families.emplace_back(kInEdgesHandle, lookup_options);
 
     logging::AssertRocksDBStatus(rocksdb::TransactionDB::Open(kvstore_->options_, rocksdb::TransactionDBOptions(),
                                                               config.disk.main_storage_directory, column_families,
@@ -271,11 +326,11 @@ DiskStorage::DiskStorage(Config config)
     logging::AssertRocksDBStatus(
         kvstore_->db_->CreateColumnFamily(kvstore_->options_, kVertexHandle, &kvstore_->vertex_chandle));
     logging::AssertRocksDBStatus(
-        kvstore_->db_->CreateColumnFamily(kvstore_->options_, kEdgeHandle, &kvstore_->edge_chandle));
+        kvstore_->db_->CreateColumnFamily(lookup_options, kEdgeHandle, &kvstore_->edge_chandle));
     logging::AssertRocksDBStatus(
-        kvstore_->db_->CreateColumnFamily(kvstore_->options_, kOutEdgesHandle, &kvstore_->out_edges_chandle));
+        kvstore_->db_->CreateColumnFamily(lookup_options, kOutEdgesHandle, &kvstore_->out_edges_chandle));
     logging::AssertRocksDBStatus(
-        kvstore_->db_->CreateColumnFamily(kvstore_->options_, kInEdgesHandle, &kvstore_->in_edges_chandle));
+        kvstore_->db_->CreateColumnFamily(lookup_options, kInEdgesHandle, &kvstore_->in_edges_chandle));
   }
 }
 
@@ -377,6 +432,10 @@ void DiskStorage::LoadVerticesToMainMemoryCache(Transaction *transaction) {
   auto it =
       std::unique_ptr<rocksdb::Iterator>(transaction->disk_transaction_->GetIterator(ro, kvstore_->vertex_chandle));
   for (it->SeekToFirst(); it->Valid(); it->Next()) {
+    if (vertex_cache_.Enabled()) {
+      vertex_cache_.Insert(utils::ExtractGidFromMainDiskStorage(it->key().ToStringView()), it->key().ToStringView(),
+                           it->value().ToStringView(), transaction->start_timestamp);
+    }
     // We should pass it->timestamp().ToString() instead of "0"
     // This is hack until RocksDB will support timestamp() in WBWI iterator
     LoadVertexToMainMemoryCache(transaction, it->key().ToString(), it->value().ToString(), kDeserializeTimestamp);
@@ -398,7 +457,7 @@ void DiskStorage::LoadVerticesFromMainStorageToEdgeImportCache(Transaction *tran
   for (it->SeekToFirst(); it->Valid(); it->Next()) {
     std::string key = it->key().ToString();
     std::string value = it->value().ToString();
-    storage::Gid gid = Gid::FromString(utils::ExtractGidFromMainDiskStorage(key));
+    storage::Gid gid = utils::ExtractGidFromMainDiskStorage(key);
     if (ObjectExistsInCache(cache_accessor, gid)) continue;
 
     utils::small_vector<LabelId> labels_id{utils::DeserializeLabelsFromMainDiskStorage(key)};
@@ -815,11 +874,37 @@ void DiskStorage::LoadVerticesFromDiskLabelPropertyIndexForIntervalSearch(
   }
 }
 
+VerticesIterable DiskStorage::DiskAccessor::Vertices(LabelId /*label*/, const std::vector<PropertyId> & /*properties*/,
+                                                     std::vector<PropertyValue> /*prefix*/,
+                                                     const std::optional<utils::Bound<PropertyValue>> & /*lower_bound*/,
+                                                     const std::optional<utils::Bound<PropertyValue>> & /*upper_bound*/,
+                                                     View /*view*/) {
+  throw utils::NotYetImplemented("Composite indices are not yet supported using on-disk storage mode.");
+}
+
+std::vector<VertexAccessor> DiskStorage::DiskAccessor::NearestPointVertices(LabelId /*label*/,
+                                                                            PropertyId /*property*/,
+                                                                            const PropertyValue & /*point*/,
+                                                                            std::size_t /*k*/, View /*view*/) {
+  throw utils::NotYetImplemented("Point index is not yet supported using on-disk storage mode.");
+}
+
+std::vector<std::pair<VertexAccessor, double>> DiskStorage::DiskAccessor::VectorIndexSearch(
+    LabelId /*label*/, PropertyId /*property*/, const PropertyValue & /*query*/, std::size_t /*k*/, View /*view*/) {
+  throw utils::NotYetImplemented("Vector index is not yet supported using on-disk storage mode.");
+}
+
 EdgesIterable DiskStorage::DiskAccessor::Edges(EdgeTypeId /*edge_type*/, View /*view*/) {
   throw utils::NotYetImplemented(
       "Edge-type index related operations are not yet supported using on-disk storage mode.");
 }
 
+EdgesIterable DiskStorage::DiskAccessor::Edges(EdgeTypeId /*edge_type*/, const VertexAccessor & /*from*/,
+                                               const VertexAccessor & /*to*/, View /*view*/) {
+  throw utils::NotYetImplemented(
+      "Edge-type index related operations are not yet supported using on-disk storage mode.");
+}
+
 EdgesIterable DiskStorage::DiskAccessor::Edges(EdgeTypeId /*edge_type*/, PropertyId /*property*/, View /*view*/) {
   throw utils::NotYetImplemented(
       "Edge-type index related operations are not yet supported using on-disk storage mode.");
@@ -876,16 +961,7 @@ StorageInfo DiskStorage::GetBaseInfo() {
 
 StorageInfo DiskStorage::GetInfo() {
   StorageInfo info = GetBaseInfo();
-  {
-    auto access = Access();
-    const auto &lbl = access->ListAllIndices();
-    info.label_indices = lbl.label.size();
-    info.label_property_indices = lbl.label_property.size();
-    info.text_indices = lbl.text_indices.size();
-    const auto &con = access->ListAllConstraints();
-    info.existence_constraints = con.existence.size();
-    info.unique_constraints = con.unique.size();
-  }
+  SetIndexAndConstraintCounts(info);
   info.storage_mode = storage_mode_;
   info.isolation_level = isolation_level_;
   info.durability_snapshot_enabled =
@@ -964,7 +1040,11 @@ DiskStorage::DiskAccessor::DetachDelete(std::vector<VertexAccessor *> nodes, std
 
   auto *disk_storage = static_cast<DiskStorage *>(storage_);
   for (const auto &vertex : deleted_vertices) {
-    transaction_.vertices_to_delete_.emplace(vertex.vertex_->gid.ToString(), utils::SerializeVertex(*vertex.vertex_));
+    // The vertex is deleted under the key it was loaded with, which can be in the text format or hold old labels.
+    auto old_disk_key = utils::GetOldDiskKeyOrNull(vertex.vertex_->delta);
+    transaction_.vertices_to_delete_.emplace(
+        vertex.vertex_->gid.ToString(),
+        old_disk_key ? std::string(*old_disk_key) : utils::SerializeVertex(*vertex.vertex_));
     transaction_.manyDeltasCache.Invalidate(vertex.vertex_);
     disk_storage->vertex_count_.fetch_sub(1, std::memory_order_acq_rel);
   }
@@ -1372,7 +1452,7 @@ std::optional<storage::VertexAccessor> DiskStorage::LoadVertexToMainMemoryCache(
                                                                                 std::string &&ts) {
   auto main_storage_accessor = transaction->vertices_->access();
 
-  storage::Gid gid = Gid::FromString(utils::ExtractGidFromKey(key));
+  storage::Gid gid = utils::ExtractGidFromMainDiskStorage(key);
   if (ObjectExistsInCache(main_storage_accessor, gid)) {
     return std::nullopt;
   }
@@ -1409,6 +1489,10 @@ std::optional<VertexAccessor> DiskStorage::FindVertex(storage::Gid gid, Transact
     }
   }
 
+  if (auto cached = vertex_cache_.Find(gid, transaction->start_timestamp)) {
+    return LoadVertexToMainMemoryCache(transaction, cached->key, cached->value, kDeserializeTimestamp);
+  }
+
   rocksdb::ReadOptions read_opts;
   auto strTs = utils::StringTimestamp(transaction->start_timestamp);
   rocksdb::Slice ts(strTs);
@@ -1417,7 +1501,10 @@ std::optional<VertexAccessor> DiskStorage::FindVertex(storage::Gid gid, Transact
       transaction->disk_transaction_->GetIterator(read_opts, kvstore_->vertex_chandle));
   for (it->SeekToFirst(); it->Valid(); it->Next()) {
     std::string key = it->key().ToString();
-    if (Gid::FromString(utils::ExtractGidFromKey(key)) == gid) {
+    const auto key_gid = utils::ExtractGidFromMainDiskStorage(key);
+    // The vertices passed on the way are cached, so the next lookups don't scan the column family again.
+    vertex_cache_.Insert(key_gid, key, it->value().ToStringView(), transaction->start_timestamp);
+    if (key_gid == gid) {
       // We should pass it->timestamp().ToString() instead of "0"
       // This is hack until RocksDB will support timestamp() in WBWI iterator
       return LoadVertexToMainMemoryCache(transaction, key, it->value().ToString(), kDeserializeTimestamp);
@@ -1426,6 +1513,45 @@ std::optional<VertexAccessor> DiskStorage::FindVertex(storage::Gid gid, Transact
   return std::nullopt;
 }
 
+void DiskStorage::PrefetchVertices(Transaction *transaction, std::vector<Gid> gids) {
+  if (edge_import_status_ == EdgeImportMode::ACTIVE) return;
+
+  std::sort(gids.begin(), gids.end());
+  gids.erase(std::unique(gids.begin(), gids.end()), gids.end());
+  auto acc = transaction->vertices_->access();
+  std::erase_if(gids, [&](Gid gid) {
+    if (acc.find(gid) != acc.end()) return true;
+    for (const auto &vec : transaction->index_storage_) {
+      auto index_acc = vec->access();
+      if (index_acc.find(gid) != index_acc.end()) return true;
+    }
+    if (auto cached = vertex_cache_.Find(gid, transaction->start_timestamp)) {
+      LoadVertexToMainMemoryCache(transaction, cached->key, cached->value, kDeserializeTimestamp);
+      return true;
+    }
+    return false;
+  });
+  // A single missing vertex is loaded by FindVertex with the same scan.
+  if (gids.size() < 2) return;
+
+  rocksdb::ReadOptions read_opts;
+  auto strTs = utils::StringTimestamp(transaction->start_timestamp);
+  rocksdb::Slice ts(strTs);
+  read_opts.timestamp = &ts;
+  auto it = std::unique_ptr<rocksdb::Iterator>(
+      transaction->disk_transaction_->GetIterator(read_opts, kvstore_->vertex_chandle));
+  size_t loaded = 0;
+  for (it->SeekToFirst(); it->Valid() && loaded < gids.size(); it->Next()) {
+    std::string key = it->key().ToString();
+    const auto key_gid = utils::ExtractGidFromMainDiskStorage(key);
+    vertex_cache_.Insert(key_gid, key, it->value().ToStringView(), transaction->start_timestamp);
+    if (std::binary_search(gids.begin(), gids.end(), key_gid)) {
+      LoadVertexToMainMemoryCache(transaction, key, it->value().ToString(), kDeserializeTimestamp);
+      ++loaded;
+    }
+  }
+}
+
 std::optional<EdgeAccessor> DiskStorage::CreateEdgeFromDisk(const VertexAccessor *from, const VertexAccessor *to,
                                                             Transaction *transaction, EdgeTypeId edge_type,
                                                             storage::Gid gid, const std::string_view properties,
@@ -1491,15 +1617,26 @@ std::vector<EdgeAccessor> DiskStorage::OutEdges(const VertexAccessor *src_vertex
 
   std::vector<EdgeAccessor> result;
   auto out_edges = utils::Split(out_edges_str, ",");
-  for (auto const &edge_gid_str : out_edges) {
+  const auto edge_values =
+      MultiGetEdgeValues(transaction->disk_transaction_, ro, kvstore_->edge_chandle, out_edges);
+  if (!destination) {
+    std::vector<Gid> dst_vertex_gids;
+    for (const auto &edge_val_str : edge_values) {
+      if (!edge_types.empty() && !utils::Contains(edge_types, utils::ExtractEdgeTypeIdFromEdgeValue(edge_val_str))) {
+        continue;
+      }
+      dst_vertex_gids.push_back(utils::ExtractDstVertexGidFromEdgeValue(edge_val_str));
+    }
+    PrefetchVertices(transaction, std::move(dst_vertex_gids));
+  }
+
+  for (size_t i = 0; i < out_edges.size(); ++i) {
     if (hops_limit && hops_limit->IsUsed()) {
       hops_limit->IncrementHopsCount(1);
       if (hops_limit->IsLimitReached()) break;
     }
-    std::string edge_val_str;
-    auto edge_res = transaction->disk_transaction_->Get(ro, kvstore_->edge_chandle, edge_gid_str, &edge_val_str);
-
-    MG_ASSERT(edge_res.ok(), "rocksdb: Failed to find edge with gid {} in edge column family", edge_gid_str);
+    const auto &edge_gid_str = out_edges[i];
+    const auto &edge_val_str = edge_values[i];
 
     auto edge_type_id = utils::ExtractEdgeTypeIdFromEdgeValue(edge_val_str);
     if (!edge_types.empty() && !utils::Contains(edge_types, edge_type_id)) continue;
@@ -1558,16 +1695,26 @@ std::vector<EdgeAccessor> DiskStorage::InEdges(const VertexAccessor *dst_vertex,
   }
 
   auto in_edges = utils::Split(in_edges_str, ",");
+  const auto edge_values = MultiGetEdgeValues(transaction->disk_transaction_, ro, kvstore_->edge_chandle, in_edges);
+  if (!source) {
+    std::vector<Gid> src_vertex_gids;
+    for (const auto &edge_val_str : edge_values) {
+      if (!edge_types.empty() && !utils::Contains(edge_types, utils::ExtractEdgeTypeIdFromEdgeValue(edge_val_str))) {
+        continue;
+      }
+      src_vertex_gids.push_back(utils::ExtractSrcVertexGidFromEdgeValue(edge_val_str));
+    }
+    PrefetchVertices(transaction, std::move(src_vertex_gids));
+  }
+
   std::vector<EdgeAccessor> result;
-  for (auto const &edge_gid_str : in_edges) {
+  for (size_t i = 0; i < in_edges.size(); ++i) {
     if (hops_limit && hops_limit->IsUsed()) {
       hops_limit->IncrementHopsCount(1);
       if (hops_limit->IsLimitReached()) break;
     }
-    std::string edge_val_str;
-    auto edge_res = transaction->disk_transaction_->Get(ro, kvstore_->edge_chandle, edge_gid_str, &edge_val_str);
-
-    MG_ASSERT(edge_res.ok(), "rocksdb: Failed to find edge with gid {} in edge column family", edge_gid_str);
+    const auto &edge_gid_str = in_edges[i];
+    const auto &edge_val_str = edge_values[i];
 
     auto edge_type_id = utils::ExtractEdgeTypeIdFromEdgeValue(edge_val_str);
     if (!edge_types.empty() && !utils::Contains(edge_types, edge_type_id)) continue;
@@ -1639,7 +1786,8 @@ DiskStorage::CheckExistingVerticesBeforeCreatingUniqueConstraint(LabelId label,
           target_property_values.has_value() && !utils::Contains(unique_storage, *target_property_values)) {
         unique_storage.insert(*target_property_values);
         vertices_for_constraints.emplace_back(
-            utils::SerializeVertexAsKeyForUniqueConstraint(label, properties, utils::ExtractGidFromKey(key_str)),
+            utils::SerializeVertexAsKeyForUniqueConstraint(label, properties,
+                                                       utils::ExtractGidFromMainDiskStorage(key_str).ToString()),
             utils::SerializeVertexAsValueForUniqueConstraint(label, labels, property_store));
       } else {
         return ConstraintViolation{ConstraintViolation::Type::UNIQUE, label, properties};
@@ -1771,6 +1919,12 @@ utils::BasicResult<StorageManipulationError, void> DiskStorage::DiskAccessor::Co
         case MetadataDelta::Action::POINT_INDEX_CREATE:
         case MetadataDelta::Action::POINT_INDEX_DROP:
           throw utils::NotYetImplemented("Point index is not implemented for DiskStorage.");
+        case MetadataDelta::Action::VECTOR_INDEX_CREATE:
+        case MetadataDelta::Action::VECTOR_INDEX_DROP:
+          throw utils::NotYetImplemented("Vector index is not implemented for DiskStorage.");
+        case MetadataDelta::Action::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+        case MetadataDelta::Action::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+          throw utils::NotYetImplemented("Composite indices are not yet supported using on-disk storage mode.");
       }
     }
   } else if (transaction_.deltas.empty() ||
@@ -1831,9 +1985,14 @@ utils::BasicResult<StorageManipulationError, void> DiskStorage::DiskAccessor::Co
     }
   }
 
+  std::vector<Gid> written_vertices;
   if (commit_timestamp_) {
     // commit_timestamp_ is set only if the transaction has writes.
     logging::AssertRocksDBStatus(transaction_.disk_transaction_->SetCommitTimestamp(*commit_timestamp_));
+    if (disk_storage->vertex_cache_.Enabled()) {
+      written_vertices = CollectWrittenVertices(transaction_);
+      disk_storage->vertex_cache_.Invalidate(written_vertices, *commit_timestamp_);
+    }
   }
   auto commitStatus = transaction_.disk_transaction_->Commit();
   if (!commitStatus.ok()) {
@@ -1841,13 +2000,17 @@ utils::BasicResult<StorageManipulationError, void> DiskStorage::DiskAccessor::Co
     spdlog::error("rocksdb: Commit failed with status {}", commitStatus.ToString());
     return StorageManipulationError{SerializationError{}};
   }
+  if (!written_vertices.empty()) {
+    // Transactions which read the vertices while the commit was written could have cached their old versions.
+    disk_storage->vertex_cache_.Invalidate(written_vertices, *commit_timestamp_);
+  }
 
   delete transaction_.disk_transaction_;
   transaction_.disk_transaction_ = nullptr;
 
   spdlog::trace("rocksdb: Commit successful");
   if (flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
-    disk_storage->indices_.text_index_.Commit();
+    disk_storage->indices_.text_index_.Commit(transaction_.transaction_id);
   }
   disk_storage->durable_metadata_.UpdateMetaData(disk_storage->timestamp_, disk_storage->vertex_count_,
                                                  disk_storage->edge_count_);
@@ -1871,15 +2034,13 @@ std::vector<std::pair<std::string, std::string>> DiskStorage::SerializeVerticesF
   ro.timestamp = &ts;
   auto it = std::unique_ptr<rocksdb::Iterator>(kvstore_->db_->NewIterator(ro, kvstore_->vertex_chandle));
 
-  const std::string serialized_label = label.ToString();
   for (it->SeekToFirst(); it->Valid(); it->Next()) {
     const std::string key_str = it->key().ToString();
-    if (const std::vector<std::string> labels_str = utils::ExtractLabelsFromMainDiskStorage(key_str);
-        utils::Contains(labels_str, serialized_label)) {
-      std::vector<LabelId> labels = utils::DeserializeLabelsFromMainDiskStorage(key_str);
+    if (std::vector<LabelId> labels = utils::DeserializeLabelsFromMainDiskStorage(key_str);
+        utils::Contains(labels, label)) {
       PropertyStore property_store = utils::DeserializePropertiesFromMainDiskStorage(it->value().ToStringView());
       vertices_to_be_indexed.emplace_back(
-          utils::SerializeVertexAsKeyForLabelIndex(label.ToString(), utils::ExtractGidFromMainDiskStorage(key_str)),
+          utils::SerializeVertexAsKeyForLabelIndex(label, utils::ExtractGidFromMainDiskStorage(key_str)),
           utils::SerializeVertexAsValueForLabelIndex(label, labels, property_store));
     }
   }
@@ -1896,15 +2057,13 @@ std::vector<std::pair<std::string, std::string>> DiskStorage::SerializeVerticesF
   ro.timestamp = &ts;
   auto it = std::unique_ptr<rocksdb::Iterator>(kvstore_->db_->NewIterator(ro, kvstore_->vertex_chandle));
 
-  const std::string serialized_label = label.ToString();
   for (it->SeekToFirst(); it->Valid(); it->Next()) {
     const std::string key_str = it->key().ToString();
     PropertyStore const property_store = utils::DeserializePropertiesFromMainDiskStorage(it->value().ToString());
-    if (const std::vector<std::string> labels_str = utils::ExtractLabelsFromMainDiskStorage(key_str);
-        utils::Contains(labels_str, serialized_label) && property_store.HasProperty(property)) {
-      std::vector<LabelId> labels = utils::DeserializeLabelsFromMainDiskStorage(key_str);
+    if (std::vector<LabelId> labels = utils::DeserializeLabelsFromMainDiskStorage(key_str);
+        utils::Contains(labels, label) && property_store.HasProperty(property)) {
       vertices_to_be_indexed.emplace_back(
-          utils::SerializeVertexAsKeyForLabelPropertyIndex(label.ToString(), property.ToString(),
+          utils::SerializeVertexAsKeyForLabelPropertyIndex(label, property,
                                                            utils::ExtractGidFromMainDiskStorage(key_str)),
           utils::SerializeVertexAsValueForLabelPropertyIndex(label, labels, property_store));
     }
@@ -1978,7 +2137,7 @@ void DiskStorage::DiskAccessor::Abort() {
   transaction_.disk_transaction_->Rollback();
   transaction_.disk_transaction_->ClearSnapshot();
   if (flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
-    storage_->indices_.text_index_.Rollback();
+    storage_->indices_.text_index_.Rollback(transaction_.transaction_id);
   }
   delete transaction_.disk_transaction_;
   transaction_.disk_transaction_ = nullptr;
@@ -2092,6 +2251,26 @@ utils::BasicResult<storage::StorageIndexDefinitionError, void> DiskStorage::Disk
   throw utils::NotYetImplemented("Point index related operations are not yet supported using on-disk storage mode.");
 }
 
+utils::BasicResult<storage::StorageIndexDefinitionError, void> DiskStorage::DiskAccessor::CreateVectorIndex(
+    const VectorIndexSpec & /*spec*/) {
+  throw utils::NotYetImplemented("Vector index related operations are not yet supported using on-disk storage mode.");
+}
+
+utils::BasicResult<storage::StorageIndexDefinitionError, void> DiskStorage::DiskAccessor::DropVectorIndex(
+    storage::LabelId /*label*/, storage::PropertyId /*property*/) {
+  throw utils::NotYetImplemented("Vector index related operations are not yet supported using on-disk storage mode.");
+}
+
+utils::BasicResult<StorageIndexDefinitionError, void> DiskStorage::DiskAccessor::CreateIndex(
+    LabelId /*label*/, const std::vector<PropertyId> & /*properties*/) {
+  throw utils::NotYetImplemented("Composite indices are not yet supported using on-disk storage mode.");
+}
+
+utils::BasicResult<StorageIndexDefinitionError, void> DiskStorage::DiskAccessor::DropIndex(
+    LabelId /*label*/, const std::vector<PropertyId> & /*properties*/) {
+  throw utils::NotYetImplemented("Composite indices are not yet supported using on-disk storage mode.");
+}
+
 utils::BasicResult<StorageExistenceConstraintDefinitionError, void>
 DiskStorage::DiskAccessor::CreateExistenceConstraint(LabelId label, PropertyId property) {
   MG_ASSERT(unique_guard_.owns_lock(), "Create existence constraint requires a unique access to the storage!");
@@ -2227,9 +2406,14 @@ IndicesInfo DiskStorage::DiskAccessor::ListAllIndices() const {
   auto *disk_label_property_index =
       static_cast<DiskLabelPropertyIndex *>(on_disk->indices_.label_property_index_.get());
   auto &text_index = storage_->indices_.text_index_;
-  return {disk_label_index->ListIndices(), disk_label_property_index->ListIndices(),
-          {/* edge type indices */},       {/* edge_type_property */},
-          text_index.ListIndices(),        {/*  */}};
+  return {disk_label_index->ListIndices(),
+          disk_label_property_index->ListIndices(),
+          {/* edge type indices */},
+          {/* edge_type_property */},
+          text_index.ListIndices(),
+          {/* point_label_property */},
+          {/* label_property_composite */},
+          {/* vector_label_property */}};
 }
 ConstraintsInfo DiskStorage::DiskAccessor::ListAllConstraints() const {
   auto *disk_storage = static_cast<DiskStorage *>(storage_);
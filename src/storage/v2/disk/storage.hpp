@@ -16,6 +16,7 @@
 #include "storage/v2/disk/durable_metadata.hpp"
 #include "storage/v2/disk/edge_import_mode_cache.hpp"
 #include "storage/v2/disk/rocksdb_storage.hpp"
+#include "storage/v2/disk/vertex_cache.hpp"
 #include "storage/v2/edge_import_mode.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/isolation_level.hpp"
@@ -73,10 +74,18 @@ class DiskStorage final : public Storage {
                               const std::optional<utils::Bound<PropertyValue>> &lower_bound,
                               const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) override;
 
+    VerticesIterable Vertices(LabelId label, const std::vector<PropertyId> &properties,
+                              std::vector<PropertyValue> prefix,
+                              const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                              const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) override;
+
     std::optional<EdgeAccessor> FindEdge(Gid gid, View view) override;
 
     EdgesIterable Edges(EdgeTypeId edge_type, View view) override;
 
+    EdgesIterable Edges(EdgeTypeId edge_type, const VertexAccessor &from, const VertexAccessor &to,
+                        View view) override;
+
     EdgesIterable Edges(EdgeTypeId edge_type, PropertyId property, View view) override;
 
     EdgesIterable Edges(EdgeTypeId edge_type, PropertyId property, const PropertyValue &value, View view) override;
@@ -102,6 +111,16 @@ class DiskStorage final : public Storage {
       return 10;
     }
 
+    uint64_t ApproximateVertexCount(LabelId /*label*/,
+                                    const std::vector<PropertyId> & /*properties*/) const override {
+      return 10;
+    }
+
+    uint64_t ApproximateVertexCount(LabelId /*label*/, const std::vector<PropertyId> & /*properties*/,
+                                    const std::vector<PropertyValue> & /*prefix*/) const override {
+      return 10;
+    }
+
     uint64_t ApproximateEdgeCount(EdgeTypeId /*edge_type*/) const override { return 10; }
 
     uint64_t ApproximateEdgeCount(EdgeTypeId /*edge_type*/, PropertyId /*property*/) const override { return 10; }
@@ -122,6 +141,18 @@ class DiskStorage final : public Storage {
       return 0;
     }
 
+    std::vector<VertexAccessor> NearestPointVertices(LabelId label, PropertyId property, const PropertyValue &point,
+                                                     std::size_t k, View view) override;
+
+    uint64_t ApproximateVectorCount(LabelId /*label*/, PropertyId /*property*/) const override {
+      // Vector index does not exist for on disk
+      return 0;
+    }
+
+    std::vector<std::pair<VertexAccessor, double>> VectorIndexSearch(LabelId label, PropertyId property,
+                                                                     const PropertyValue &query, std::size_t k,
+                                                                     View view) override;
+
     std::optional<storage::LabelIndexStats> GetIndexStats(const storage::LabelId & /*label*/) const override {
       return {};
     }
@@ -173,10 +204,26 @@ class DiskStorage final : public Storage {
       return disk_storage->indices_.label_property_index_->IndexExists(label, property);
     }
 
+    bool LabelPropertyCompositeIndexExists(LabelId /*label*/,
+                                           const std::vector<PropertyId> & /*properties*/) const override {
+      // Composite indices don't exist for on disk
+      return false;
+    }
+
+    std::vector<std::vector<PropertyId>> ListLabelPropertyCompositeIndices(LabelId /*label*/) const override {
+      return {};
+    }
+
     bool EdgeTypeIndexExists(EdgeTypeId edge_type) const override;
 
     bool EdgeTypePropertyIndexExists(EdgeTypeId edge_type, PropertyId proeprty) const override;
 
+    bool PointIndexExists(LabelId /*label*/, PropertyId /*property*/) const override { return false; }
+
+    std::optional<uint64_t> VectorIndexDimension(LabelId /*label*/, PropertyId /*property*/) const override {
+      return std::nullopt;
+    }
+
     IndicesInfo ListAllIndices() const override;
 
     ConstraintsInfo ListAllConstraints() const override;
@@ -200,6 +247,9 @@ class DiskStorage final : public Storage {
 
     utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(LabelId label, PropertyId property) override;
 
+    utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(
+        LabelId label, const std::vector<PropertyId> &properties) override;
+
     utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(EdgeTypeId edge_type,
                                                                       bool unique_access_needed = true) override;
 
@@ -210,6 +260,9 @@ class DiskStorage final : public Storage {
 
     utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(LabelId label, PropertyId property) override;
 
+    utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(
+        LabelId label, const std::vector<PropertyId> &properties) override;
+
     utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(EdgeTypeId edge_type) override;
 
     utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(EdgeTypeId edge_type, PropertyId property) override;
@@ -220,6 +273,12 @@ class DiskStorage final : public Storage {
     utils::BasicResult<storage::StorageIndexDefinitionError, void> DropPointIndex(
         storage::LabelId label, storage::PropertyId property) override;
 
+    utils::BasicResult<storage::StorageIndexDefinitionError, void> CreateVectorIndex(
+        const VectorIndexSpec &spec) override;
+
+    utils::BasicResult<storage::StorageIndexDefinitionError, void> DropVectorIndex(
+        storage::LabelId label, storage::PropertyId property) override;
+
     utils::BasicResult<StorageExistenceConstraintDefinitionError, void> CreateExistenceConstraint(
         LabelId label, PropertyId property) override;
 
@@ -332,6 +391,11 @@ class DiskStorage final : public Storage {
 
   std::optional<VertexAccessor> FindVertex(Gid gid, Transaction *transaction, View view);
 
+  /// Loads the vertices with `gids` which the transaction hasn't loaded yet
+  /// with a single pass over the vertex column family, so the FindVertex
+  /// calls for the neighbours of an expanded vertex don't scan it one by one.
+  void PrefetchVertices(Transaction *transaction, std::vector<Gid> gids);
+
   std::optional<EdgeAccessor> CreateEdgeFromDisk(const VertexAccessor *from, const VertexAccessor *to,
                                                  Transaction *transaction, EdgeTypeId edge_type, storage::Gid gid,
                                                  std::string_view properties, std::string_view old_disk_key,
@@ -386,6 +450,7 @@ class DiskStorage final : public Storage {
   EdgeImportMode edge_import_status_{EdgeImportMode::INACTIVE};
   std::unique_ptr<EdgeImportModeCache> edge_import_mode_cache_{nullptr};
   std::atomic<uint64_t> vertex_count_{0};
+  DiskVertexCache vertex_cache_;
   /// Disk does not have point index, yet an empty/null object is needed to make in_memory code for point index simple.
   static PointIndexStorage empty_point_index_;
 };
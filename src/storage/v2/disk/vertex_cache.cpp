@@ -0,0 +1,57 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#include "storage/v2/disk/vertex_cache.hpp"
+
+#include <algorithm>
+
+namespace memgraph::storage {
+
+std::optional<DiskVertexCache::Entry> DiskVertexCache::Find(Gid gid, uint64_t start_timestamp) const {
+  if (!Enabled()) return std::nullopt;
+  return state_.WithReadLock([&](const State &state) -> std::optional<Entry> {
+    auto it = state.vertices.find(gid);
+    if (it == state.vertices.end() || it->second.read_timestamp > start_timestamp) return std::nullopt;
+    return it->second.entry;
+  });
+}
+
+void DiskVertexCache::Insert(Gid gid, std::string_view key, std::string_view value, uint64_t start_timestamp) {
+  if (!Enabled()) return;
+  state_.WithLock([&](State &state) {
+    if (start_timestamp < state.last_write_timestamp) return;
+    if (auto it = state.vertices.find(gid); it != state.vertices.end()) {
+      if (it->second.read_timestamp < start_timestamp) {
+        it->second = CachedVertex{Entry{std::string(key), std::string(value)}, start_timestamp};
+      }
+      return;
+    }
+    if (state.vertices.size() >= capacity_) return;
+    state.vertices.emplace(gid, CachedVertex{Entry{std::string(key), std::string(value)}, start_timestamp});
+  });
+}
+
+void DiskVertexCache::Invalidate(std::span<Gid const> gids, uint64_t commit_timestamp) {
+  if (!Enabled()) return;
+  state_.WithLock([&](State &state) {
+    state.last_write_timestamp = std::max(state.last_write_timestamp, commit_timestamp);
+    for (const auto gid : gids) {
+      state.vertices.erase(gid);
+    }
+  });
+}
+
+void DiskVertexCache::Clear() {
+  state_.WithLock([](State &state) { state.vertices.clear(); });
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,75 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "storage/v2/id_types.hpp"
+#include "utils/rw_spin_lock.hpp"
+#include "utils/synchronized.hpp"
+
+namespace memgraph::storage {
+
+/// Keys and values of the vertex column family read by transactions, shared
+/// between all transactions of the storage so a vertex looked up by its gid
+/// isn't searched for on disk again.
+///
+/// An entry read at the start timestamp of a transaction is valid for the
+/// transactions which start at the same or a later timestamp. A commit which
+/// writes vertices removes their entries, and no entry read before the
+/// commit is added after it.
+class DiskVertexCache final {
+ public:
+  struct Entry {
+    std::string key;
+    std::string value;
+  };
+
+  /// The cache holds at most `capacity` vertices, it is disabled if it is 0.
+  explicit DiskVertexCache(uint64_t capacity) : capacity_(capacity) {}
+
+  bool Enabled() const { return capacity_ > 0; }
+
+  std::optional<Entry> Find(Gid gid, uint64_t start_timestamp) const;
+
+  /// Adds the vertex read by the transaction which started at
+  /// `start_timestamp`, unless the cache is full or a commit which wrote
+  /// vertices came after the start of the transaction.
+  void Insert(Gid gid, std::string_view key, std::string_view value, uint64_t start_timestamp);
+
+  /// Removes the vertices the commit at `commit_timestamp` wrote or deleted.
+  void Invalidate(std::span<Gid const> gids, uint64_t commit_timestamp);
+
+  void Clear();
+
+ private:
+  struct CachedVertex {
+    Entry entry;
+    uint64_t read_timestamp;
+  };
+
+  struct State {
+    std::unordered_map<Gid, CachedVertex> vertices;
+    uint64_t last_write_timestamp{0};
+  };
+
+  uint64_t capacity_;
+  mutable utils::Synchronized<State, utils::RWSpinLock> state_;
+};
+
+}  // namespace memgraph::storage
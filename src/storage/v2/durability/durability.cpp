@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <optional>
+#include <string>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -30,6 +31,7 @@
 #include "storage/v2/durability/durability.hpp"
 #include "storage/v2/durability/metadata.hpp"
 #include "storage/v2/durability/paths.hpp"
+#include "storage/v2/durability/recovery_profiler.hpp"
 #include "storage/v2/durability/snapshot.hpp"
 #include "storage/v2/durability/wal.hpp"
 #include "storage/v2/inmemory/edge_type_index.hpp"
@@ -43,6 +45,7 @@
 #include "utils/logging.hpp"
 #include "utils/memory_tracker.hpp"
 #include "utils/message.hpp"
+#include "utils/string.hpp"
 #include "utils/timer.hpp"
 namespace memgraph::metrics {
 extern const Event SnapshotRecoveryLatency_us;
@@ -161,6 +164,7 @@ std::optional<std::vector<WalDurabilityInfo>> GetWalFiles(const std::filesystem:
 void RecoverConstraints(const RecoveredIndicesAndConstraints::ConstraintsMetadata &constraints_metadata,
                         Constraints *constraints, utils::SkipList<Vertex> *vertices, NameIdMapper *name_id_mapper,
                         const std::optional<ParallelizedSchemaCreationInfo> &parallel_exec_info) {
+  auto const phase_timer = RecoveryPhaseTimer{RecoveryPhase::CONSTRAINTS};
   RecoverExistenceConstraints(constraints_metadata, constraints, vertices, name_id_mapper, parallel_exec_info);
   RecoverUniqueConstraints(constraints_metadata, constraints, vertices, name_id_mapper, parallel_exec_info);
   RecoverTypeConstraints(constraints_metadata, constraints, vertices, parallel_exec_info);
@@ -170,6 +174,7 @@ void RecoverIndicesAndStats(const RecoveredIndicesAndConstraints::IndicesMetadat
                             utils::SkipList<Vertex> *vertices, NameIdMapper *name_id_mapper, bool properties_on_edges,
                             const std::optional<ParallelizedSchemaCreationInfo> &parallel_exec_info,
                             const std::optional<std::filesystem::path> &storage_dir) {
+  auto const phase_timer = RecoveryPhaseTimer{RecoveryPhase::INDICES};
   spdlog::info("Recreating indices from metadata.");
 
   // Recover label indices.
@@ -248,6 +253,7 @@ void RecoverIndicesAndStats(const RecoveredIndicesAndConstraints::IndicesMetadat
 
   if (flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
     // Recover text indices.
+    auto const text_phase_timer = RecoveryPhaseTimer{RecoveryPhase::TEXT_INDICES};
     spdlog::info("Recreating {} text indices from metadata.", indices_metadata.text_indices.size());
     auto &mem_text_index = indices->text_index_;
     for (const auto &[index_name, label] : indices_metadata.text_indices) {
@@ -276,6 +282,27 @@ void RecoverIndicesAndStats(const RecoveredIndicesAndConstraints::IndicesMetadat
   }
   spdlog::info("Point indices are recreated.");
 
+  spdlog::info("Recreating {} vector indices from metadata.", indices_metadata.vector_indices.size());
+  for (const auto &spec : indices_metadata.vector_indices) {
+    if (!indices->vector_index_.CreateIndex(spec, vertices->access()))
+      throw RecoveryFailure("The vector index must be created here!");
+    spdlog::info("Vector index on :{}({}) is recreated from metadata", name_id_mapper->IdToName(spec.label.AsUint()),
+                 name_id_mapper->IdToName(spec.property.AsUint()));
+  }
+  spdlog::info("Vector indices are recreated.");
+
+  spdlog::info("Recreating {} composite indices from metadata.", indices_metadata.label_property_composite.size());
+  for (const auto &[label, properties] : indices_metadata.label_property_composite) {
+    if (!indices->label_property_composite_index_.CreateIndex(label, properties, vertices->access()))
+      throw RecoveryFailure("The composite index must be created here!");
+    std::vector<std::string> property_names;
+    property_names.reserve(properties.size());
+    for (const auto property : properties) property_names.push_back(name_id_mapper->IdToName(property.AsUint()));
+    spdlog::info("Composite index on :{}({}) is recreated from metadata", name_id_mapper->IdToName(label.AsUint()),
+                 utils::Join(property_names, ", "));
+  }
+  spdlog::info("Composite indices are recreated.");
+
   spdlog::info("Indices are recreated.");
 }
 
@@ -395,6 +422,7 @@ std::optional<RecoveryInfo> Recovery::RecoverData(
 
   auto *const epoch_history = &repl_storage_state.history;
   utils::Timer timer;
+  RecoveryProfiler profiler{config.salient.name};
 
   auto snapshot_files = GetSnapshotFiles(snapshot_directory_);
 
@@ -546,6 +574,7 @@ std::optional<RecoveryInfo> Recovery::RecoverData(
     std::optional<uint64_t> previous_seq_num;
     auto last_loaded_timestamp = snapshot_timestamp;
     spdlog::info("Trying to load WAL files.");
+    auto const phase_timer = RecoveryPhaseTimer{RecoveryPhase::WAL_REPLAY};
 
     if (last_loaded_timestamp) {
       epoch_history->emplace_back(repl_storage_state.epoch_.id(), *last_loaded_timestamp);
@@ -560,7 +589,11 @@ std::optional<RecoveryInfo> Recovery::RecoverData(
       try {
         auto info = LoadWal(wal_file.path, &indices_constraints, last_loaded_timestamp, vertices, edges, name_id_mapper,
                             edge_count, config.salient.items, enum_store,
-                            config.salient.items.enable_schema_info ? schema_info : nullptr, find_edge);
+                            config.salient.items.enable_schema_info ? schema_info : nullptr, find_edge,
+                            config.durability.allow_parallel_wal_recovery
+                                ? std::make_optional(ParallelizedWalReplayInfo{
+                                      config.durability.items_per_batch, config.durability.recovery_thread_count})
+                                : std::nullopt);
         recovery_info.next_vertex_id = std::max(recovery_info.next_vertex_id, info.next_vertex_id);
         recovery_info.next_edge_id = std::max(recovery_info.next_edge_id, info.next_edge_id);
         recovery_info.next_timestamp = std::max(recovery_info.next_timestamp, info.next_timestamp);
@@ -81,6 +81,10 @@ enum class Marker : uint8_t {
   DELTA_POINT_INDEX_DROP = 0x6f,
   DELTA_TYPE_CONSTRAINT_CREATE = 0x70,
   DELTA_TYPE_CONSTRAINT_DROP = 0x71,
+  DELTA_VECTOR_INDEX_CREATE = 0x72,
+  DELTA_VECTOR_INDEX_DROP = 0x73,
+  DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE = 0x74,
+  DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP = 0x75,
 
   VALUE_FALSE = 0x00,
   VALUE_TRUE = 0xff,
@@ -147,6 +151,10 @@ static const Marker kMarkersAll[] = {
     Marker::DELTA_POINT_INDEX_DROP,
     Marker::DELTA_TYPE_CONSTRAINT_CREATE,
     Marker::DELTA_TYPE_CONSTRAINT_DROP,
+    Marker::DELTA_VECTOR_INDEX_CREATE,
+    Marker::DELTA_VECTOR_INDEX_DROP,
+    Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE,
+    Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP,
     Marker::VALUE_FALSE,
     Marker::VALUE_TRUE,
 };
@@ -22,6 +22,7 @@
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/indices/label_index_stats.hpp"
 #include "storage/v2/indices/label_property_index_stats.hpp"
+#include "storage/v2/indices/vector_index_spec.hpp"
 
 namespace memgraph::storage::durability {
 
@@ -48,6 +49,8 @@ struct RecoveredIndicesAndConstraints {
     std::vector<EdgeTypeId> edge;
     std::vector<std::pair<EdgeTypeId, PropertyId>> edge_property;
     std::vector<std::pair<std::string, LabelId>> text_indices;
+    std::vector<VectorIndexSpec> vector_indices;
+    std::vector<std::pair<LabelId, std::vector<PropertyId>>> label_property_composite;
   } indices;
 
   struct ConstraintsMetadata {
@@ -0,0 +1,84 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/durability/recovery_profiler.hpp"
+
+#include <string_view>
+#include <utility>
+
+#include "utils/event_histogram.hpp"
+#include "utils/logging.hpp"
+
+namespace memgraph::metrics {
+extern const Event RecoverySnapshotEdgesLatency_us;
+extern const Event RecoverySnapshotVerticesLatency_us;
+extern const Event RecoverySnapshotConnectivityLatency_us;
+extern const Event RecoveryWalLatency_us;
+extern const Event RecoveryIndicesLatency_us;
+extern const Event RecoveryTextIndicesLatency_us;
+extern const Event RecoveryConstraintsLatency_us;
+}  // namespace memgraph::metrics
+
+namespace memgraph::storage::durability {
+
+namespace {
+thread_local RecoveryProfiler *current_profiler = nullptr;
+
+struct PhaseInfo {
+  std::string_view name;
+  metrics::Event histogram;
+};
+
+const std::array<PhaseInfo, kRecoveryPhaseCount> &PhaseInfos() {
+  static const std::array<PhaseInfo, kRecoveryPhaseCount> infos{{
+      {"snapshot edges", metrics::RecoverySnapshotEdgesLatency_us},
+      {"snapshot vertices", metrics::RecoverySnapshotVerticesLatency_us},
+      {"snapshot connectivity", metrics::RecoverySnapshotConnectivityLatency_us},
+      {"WAL replay", metrics::RecoveryWalLatency_us},
+      {"indices", metrics::RecoveryIndicesLatency_us},
+      {"text indices", metrics::RecoveryTextIndicesLatency_us},
+      {"constraints", metrics::RecoveryConstraintsLatency_us},
+  }};
+  return infos;
+}
+}  // namespace
+
+RecoveryProfiler::RecoveryProfiler(std::string database)
+    : database_{std::move(database)}, previous_{std::exchange(current_profiler, this)} {}
+
+RecoveryProfiler::~RecoveryProfiler() {
+  current_profiler = previous_;
+  const auto &infos = PhaseInfos();
+  for (size_t i = 0; i < kRecoveryPhaseCount; ++i) {
+    if (!ran_[i]) continue;
+    spdlog::info("Recovery of database {}: {} took {} ms.", database_, infos[i].name,
+                 std::chrono::duration_cast<std::chrono::milliseconds>(durations_[i]).count());
+    metrics::Measure(infos[i].histogram, durations_[i].count());
+  }
+  spdlog::info("Recovery of database {} took {} ms.", database_,
+               std::chrono::duration_cast<std::chrono::milliseconds>(timer_.Elapsed()).count());
+}
+
+RecoveryProfiler *RecoveryProfiler::Current() { return current_profiler; }
+
+void RecoveryProfiler::Add(RecoveryPhase phase, std::chrono::microseconds duration) {
+  const auto index = static_cast<size_t>(phase);
+  durations_[index] += duration;
+  ran_[index] = true;
+}
+
+RecoveryPhaseTimer::~RecoveryPhaseTimer() {
+  if (auto *profiler = RecoveryProfiler::Current()) {
+    profiler->Add(phase_, std::chrono::duration_cast<std::chrono::microseconds>(timer_.Elapsed()));
+  }
+}
+
+}  // namespace memgraph::storage::durability
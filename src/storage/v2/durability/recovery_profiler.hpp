@@ -0,0 +1,80 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "utils/timer.hpp"
+
+namespace memgraph::storage::durability {
+
+enum class RecoveryPhase : uint8_t {
+  SNAPSHOT_EDGES,
+  SNAPSHOT_VERTICES,
+  SNAPSHOT_CONNECTIVITY,
+  WAL_REPLAY,
+  // Includes the text indices.
+  INDICES,
+  TEXT_INDICES,
+  CONSTRAINTS,
+};
+
+constexpr size_t kRecoveryPhaseCount = 7;
+
+/// Times the phases of the recovery of a database. The phases are timed with
+/// a `RecoveryPhaseTimer` on the thread which runs the recovery, which finds
+/// the profiler through a thread-local pointer, so the functions recovering
+/// the phases don't need to pass it around. The durations are logged and
+/// measured in the histogram of each phase once the recovery is done.
+class RecoveryProfiler {
+ public:
+  explicit RecoveryProfiler(std::string database);
+  ~RecoveryProfiler();
+
+  RecoveryProfiler(const RecoveryProfiler &) = delete;
+  RecoveryProfiler &operator=(const RecoveryProfiler &) = delete;
+  RecoveryProfiler(RecoveryProfiler &&) = delete;
+  RecoveryProfiler &operator=(RecoveryProfiler &&) = delete;
+
+  /// The profiler of the recovery running on this thread, if any.
+  static RecoveryProfiler *Current();
+
+  void Add(RecoveryPhase phase, std::chrono::microseconds duration);
+
+ private:
+  std::string database_;
+  utils::Timer timer_;
+  std::array<std::chrono::microseconds, kRecoveryPhaseCount> durations_{};
+  std::array<bool, kRecoveryPhaseCount> ran_{};
+  RecoveryProfiler *previous_;
+};
+
+/// Adds the time it lived to `phase` of the current recovery.
+class [[nodiscard]] RecoveryPhaseTimer {
+ public:
+  explicit RecoveryPhaseTimer(RecoveryPhase phase) : phase_{phase} {}
+  ~RecoveryPhaseTimer();
+
+  RecoveryPhaseTimer(const RecoveryPhaseTimer &) = delete;
+  RecoveryPhaseTimer &operator=(const RecoveryPhaseTimer &) = delete;
+  RecoveryPhaseTimer(RecoveryPhaseTimer &&) = delete;
+  RecoveryPhaseTimer &operator=(RecoveryPhaseTimer &&) = delete;
+
+ private:
+  RecoveryPhase phase_;
+  utils::Timer timer_;
+};
+
+}  // namespace memgraph::storage::durability
@@ -20,4 +20,9 @@ struct ParallelizedSchemaCreationInfo {
   std::vector<std::pair<Gid, uint64_t>> vertex_recovery_info;
   uint64_t thread_count;
 };
+
+struct ParallelizedWalReplayInfo {
+  uint64_t window_size;   // number of deltas decoded and applied together
+  uint64_t thread_count;  // number of threads applying label and property updates
+};
 }  // namespace memgraph::storage::durability
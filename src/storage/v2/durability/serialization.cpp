@@ -9,8 +9,11 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <zlib.h>
 #include <chrono>
 #include <cstdint>
+#include <cstring>
+#include <limits>
 #include <optional>
 
 #include "storage/v2/durability/marker.hpp"
@@ -20,6 +23,7 @@
 #include "storage/v2/temporal.hpp"
 #include "utils/cast.hpp"
 #include "utils/endian.hpp"
+#include "utils/logging.hpp"
 #include "utils/temporal.hpp"
 
 namespace memgraph::storage::durability {
@@ -42,6 +46,10 @@ void Encoder::Initialize(const std::filesystem::path &path, const std::string_vi
   Write(reinterpret_cast<const uint8_t *>(&version_encoded), sizeof(version_encoded));
 }
 
+void Encoder::Initialize(const std::filesystem::path &path) {
+  file_.Open(path, utils::OutputFile::Mode::OVERWRITE_EXISTING);
+}
+
 void Encoder::OpenExisting(const std::filesystem::path &path) {
   file_.Open(path, utils::OutputFile::Mode::APPEND_TO_EXISTING);
 }
@@ -52,7 +60,13 @@ void Encoder::Close() {
   }
 }
 
-void Encoder::Write(const uint8_t *data, uint64_t size) { file_.Write(data, size); }
+void Encoder::Write(const uint8_t *data, uint64_t size) {
+  if (batch_) {
+    batch_->insert(batch_->end(), data, data + size);
+    return;
+  }
+  file_.Write(data, size);
+}
 
 void Encoder::WriteMarker(Marker marker) {
   auto value = static_cast<uint8_t>(marker);
@@ -197,6 +211,10 @@ void Encoder::Finalize() {
   file_.Close();
 }
 
+bool Encoder::Preallocate(size_t size) { return file_.Preallocate(size); }
+
+void Encoder::DropPageCache() { file_.DropPageCache(); }
+
 void Encoder::DisableFlushing() { file_.DisableFlushing(); }
 
 void Encoder::EnableFlushing() { file_.EnableFlushing(); }
@@ -207,6 +225,27 @@ std::pair<const uint8_t *, size_t> Encoder::CurrentFileBuffer() const { return f
 
 size_t Encoder::GetSize() { return file_.GetSize(); }
 
+void Encoder::StartCompressedBatch() {
+  MG_ASSERT(!batch_, "Compressed batch already started!");
+  batch_.emplace();
+}
+
+void Encoder::FinishCompressedBatch() {
+  MG_ASSERT(batch_, "Compressed batch wasn't started!");
+  auto data = std::move(*batch_);
+  batch_.reset();
+  if (data.empty()) return;
+  auto compressed = utils::Compressor::GetInstance()->Compress(data);
+  MG_ASSERT(compressed, "Couldn't compress snapshot batch of {} bytes!", data.size());
+  const auto view = compressed->view();
+  WriteUint(data.size());
+  WriteUint(view.size());
+  WriteUint(crc32(0UL, view.data(), view.size()));
+  Write(view.data(), view.size());
+}
+
+uint64_t Encoder::GetCompressedBatchSize() const { return batch_ ? batch_->size() : 0; }
+
 //////////////////////////
 // Decoder implementation.
 //////////////////////////
@@ -229,8 +268,9 @@ std::optional<uint64_t> ReadSize(Decoder *decoder) {
 }
 }  // namespace
 
-std::optional<uint64_t> Decoder::Initialize(const std::filesystem::path &path, const std::string &magic) {
-  if (!file_.Open(path)) return std::nullopt;
+std::optional<uint64_t> Decoder::Initialize(const std::filesystem::path &path, const std::string &magic,
+                                            const bool memory_mapped) {
+  if (!file_.Open(path, memory_mapped)) return std::nullopt;
   std::string file_magic(magic.size(), '\0');
   if (!Read(reinterpret_cast<uint8_t *>(file_magic.data()), file_magic.size())) return std::nullopt;
   if (file_magic != magic) return std::nullopt;
@@ -239,9 +279,24 @@ std::optional<uint64_t> Decoder::Initialize(const std::filesystem::path &path, c
   return utils::LittleEndianToHost(version_encoded);
 }
 
-bool Decoder::Read(uint8_t *data, size_t size) { return file_.Read(data, size); }
+bool Decoder::Read(uint8_t *data, size_t size) {
+  if (batch_) {
+    if (!Peek(data, size)) return false;
+    batch_position_ += size;
+    return true;
+  }
+  return file_.Read(data, size);
+}
 
-bool Decoder::Peek(uint8_t *data, size_t size) { return file_.Peek(data, size); }
+bool Decoder::Peek(uint8_t *data, size_t size) {
+  if (batch_) {
+    const auto view = batch_->view();
+    if (size > view.size() - batch_position_) return false;
+    std::memcpy(data, view.data() + batch_position_, size);
+    return true;
+  }
+  return file_.Peek(data, size);
+}
 
 std::optional<Marker> Decoder::PeekMarker() {
   uint8_t value;
@@ -535,6 +590,10 @@ std::optional<PropertyValue> Decoder::ReadPropertyValue() {
     case Marker::DELTA_POINT_INDEX_DROP:
     case Marker::DELTA_TYPE_CONSTRAINT_CREATE:
     case Marker::DELTA_TYPE_CONSTRAINT_DROP:
+    case Marker::DELTA_VECTOR_INDEX_CREATE:
+    case Marker::DELTA_VECTOR_INDEX_DROP:
+    case Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
     case Marker::VALUE_FALSE:
     case Marker::VALUE_TRUE:
       return std::nullopt;
@@ -665,6 +724,10 @@ bool Decoder::SkipPropertyValue() {
     case Marker::DELTA_POINT_INDEX_DROP:
     case Marker::DELTA_TYPE_CONSTRAINT_CREATE:
     case Marker::DELTA_TYPE_CONSTRAINT_DROP:
+    case Marker::DELTA_VECTOR_INDEX_CREATE:
+    case Marker::DELTA_VECTOR_INDEX_DROP:
+    case Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
     case Marker::VALUE_FALSE:
     case Marker::VALUE_TRUE:
       return false;
@@ -675,6 +738,37 @@ std::optional<uint64_t> Decoder::GetSize() { return file_.GetSize(); }
 
 std::optional<uint64_t> Decoder::GetPosition() { return file_.GetPosition(); }
 
-bool Decoder::SetPosition(uint64_t position) { return !!file_.SetPosition(utils::InputFile::Position::SET, position); }
+bool Decoder::SetPosition(uint64_t position) {
+  batch_.reset();
+  batch_position_ = 0;
+  return !!file_.SetPosition(utils::InputFile::Position::SET, position);
+}
+
+bool Decoder::LoadCompressedBatch() {
+  batch_.reset();
+  batch_position_ = 0;
+  const auto original_size = ReadUint();
+  const auto compressed_size = ReadUint();
+  const auto checksum = ReadUint();
+  if (!original_size || !compressed_size || !checksum) return false;
+  if (*original_size > std::numeric_limits<uint32_t>::max()) return false;
+  auto file_size = GetSize();
+  auto position = GetPosition();
+  if (!file_size || !position || *compressed_size > *file_size - *position) return false;
+
+  std::vector<uint8_t> compressed(*compressed_size);
+  if (!Read(compressed.data(), compressed.size())) return false;
+  if (crc32(0UL, compressed.data(), compressed.size()) != *checksum) return false;
+
+  auto decompressed = utils::Compressor::GetInstance()->Decompress(compressed, *original_size);
+  if (!decompressed) return false;
+  batch_ = std::move(*decompressed);
+  return true;
+}
+
+void Decoder::RewindCompressedBatch() {
+  MG_ASSERT(batch_, "Compressed batch wasn't loaded!");
+  batch_position_ = 0;
+}
 
 }  // namespace memgraph::storage::durability
@@ -13,12 +13,15 @@
 
 #include <cstdint>
 #include <filesystem>
+#include <optional>
 #include <string_view>
+#include <vector>
 
 #include "storage/v2/config.hpp"
 #include "storage/v2/durability/marker.hpp"
 #include "storage/v2/name_id_mapper.hpp"
 #include "storage/v2/property_value.hpp"
+#include "utils/compressor.hpp"
 #include "utils/file.hpp"
 
 namespace memgraph::storage::durability {
@@ -46,6 +49,10 @@ class Encoder final : public BaseEncoder {
  public:
   void Initialize(const std::filesystem::path &path, std::string_view magic, uint64_t version);
 
+  // Open a new file without writing the magic and the version. Used for the
+  // segments of a snapshot which are later appended to the snapshot file.
+  void Initialize(const std::filesystem::path &path);
+
   void OpenExisting(const std::filesystem::path &path);
 
   void Close();
@@ -70,6 +77,11 @@ class Encoder final : public BaseEncoder {
 
   void Finalize();
 
+  // Reserve the disk blocks of the first `size` bytes of the file.
+  bool Preallocate(size_t size);
+  // Evict the synced data of the file from the page cache.
+  void DropPageCache();
+
   // Disable flushing of the internal buffer.
   void DisableFlushing();
   // Enable flushing of the internal buffer.
@@ -82,8 +94,17 @@ class Encoder final : public BaseEncoder {
   // Get the total size of the current file.
   size_t GetSize();
 
+  // Start buffering all writes in memory. The buffered data is compressed and
+  // written to the file, together with its size and checksum, by
+  // `FinishCompressedBatch`. Empty batches aren't written at all.
+  void StartCompressedBatch();
+  void FinishCompressedBatch();
+  // Get the size of the data buffered since `StartCompressedBatch`.
+  uint64_t GetCompressedBatchSize() const;
+
  private:
   utils::OutputFile file_;
+  std::optional<std::vector<uint8_t>> batch_;
 };
 
 /// Decoder interface class. Used to implement streams from different sources
@@ -110,7 +131,10 @@ class BaseDecoder {
 /// Decoder that is used to read a generated snapshot/WAL.
 class Decoder final : public BaseDecoder {
  public:
-  std::optional<uint64_t> Initialize(const std::filesystem::path &path, const std::string &magic);
+  // If `memory_mapped` is set the file is read through a sequential memory
+  // mapping, see `utils::InputFile::Open`.
+  std::optional<uint64_t> Initialize(const std::filesystem::path &path, const std::string &magic,
+                                     bool memory_mapped = false);
 
   // Main read functions, the only one that are allowed to read from the `file_`
   // directly.
@@ -136,8 +160,17 @@ class Decoder final : public BaseDecoder {
   std::optional<uint64_t> GetPosition();
   bool SetPosition(uint64_t position);
 
+  // Read the batch written by `Encoder::FinishCompressedBatch` at the current
+  // position and verify its checksum. All following reads are served from the
+  // decompressed batch until the position is set again.
+  bool LoadCompressedBatch();
+  // Continue reading from the beginning of the loaded compressed batch.
+  void RewindCompressedBatch();
+
  private:
   utils::InputFile file_;
+  std::optional<utils::DecompressedBuffer> batch_;
+  size_t batch_position_{0};
 };
 
 }  // namespace memgraph::storage::durability
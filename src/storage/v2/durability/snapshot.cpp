@@ -11,6 +11,8 @@
 
 #include "storage/v2/durability/snapshot.hpp"
 
+#include <atomic>
+#include <exception>
 #include <thread>
 
 #include "flags/experimental.hpp"
@@ -20,6 +22,7 @@
 #include "storage/v2/constraints/type_constraints_kind.hpp"
 #include "storage/v2/durability/exceptions.hpp"
 #include "storage/v2/durability/paths.hpp"
+#include "storage/v2/durability/recovery_profiler.hpp"
 #include "storage/v2/durability/serialization.hpp"
 #include "storage/v2/durability/version.hpp"
 #include "storage/v2/durability/wal.hpp"
@@ -41,6 +44,7 @@
 #include "utils/file_locker.hpp"
 #include "utils/logging.hpp"
 #include "utils/message.hpp"
+#include "utils/on_scope_exit.hpp"
 #include "utils/spin_lock.hpp"
 #include "utils/synchronized.hpp"
 
@@ -207,6 +211,12 @@ SnapshotInfo ReadSnapshotInfo(const std::filesystem::path &path) {
     auto maybe_vertices = snapshot.ReadUint();
     if (!maybe_vertices) throw RecoveryFailure("Couldn't read the number of vertices!");
     info.vertices_count = *maybe_vertices;
+
+    if (*version >= kCompressedBatchesVersion) {
+      auto maybe_compressed_batches = snapshot.ReadBool();
+      if (!maybe_compressed_batches) throw RecoveryFailure("Couldn't read whether the batches are compressed!");
+      info.compressed_batches = *maybe_compressed_batches;
+    }
   }
 
   return info;
@@ -235,17 +245,28 @@ std::vector<BatchInfo> ReadBatchInfos(Decoder &snapshot) {
   return infos;
 }
 
+// Sets the position to the beginning of a batch. Compressed batches are
+// decompressed and verified here, before any of their objects are read.
+void SetBatchPosition(Decoder &snapshot, const uint64_t offset, const bool compressed_batch,
+                      const std::string_view error_message) {
+  if (!snapshot.SetPosition(offset)) throw RecoveryFailure(std::string{error_message});
+  if (compressed_batch && !snapshot.LoadCompressedBatch()) {
+    throw RecoveryFailure(fmt::format("Snapshot batch at offset {} is corrupt!", offset));
+  }
+}
+
 template <typename TFunc>
 void LoadPartialEdges(const std::filesystem::path &path, utils::SkipList<Edge> &edges, const uint64_t from_offset,
-                      const uint64_t edges_count, const SalientConfig::Items items, TFunc get_property_from_id) {
+                      const uint64_t edges_count, const SalientConfig::Items items, TFunc get_property_from_id,
+                      const bool compressed_batch = false) {
   Decoder snapshot;
-  snapshot.Initialize(path, kSnapshotMagic);
+  snapshot.Initialize(path, kSnapshotMagic, /* memory_mapped = */ true);
 
   // Recover edges.
   auto edge_acc = edges.access();
   uint64_t last_edge_gid = 0;
   spdlog::info("Recovering {} edges.", edges_count);
-  if (!snapshot.SetPosition(from_offset)) throw RecoveryFailure("Couldn't set offset position for reading edges!");
+  SetBatchPosition(snapshot, from_offset, compressed_batch, "Couldn't set offset position for reading edges!");
 
   std::vector<std::pair<PropertyId, PropertyValue>> read_properties;
   uint64_t five_percent_chunk = edges_count / 20;
@@ -318,11 +339,12 @@ void LoadPartialEdges(const std::filesystem::path &path, utils::SkipList<Edge> &
 template <typename TLabelFromIdFunc, typename TPropertyFromIdFunc>
 uint64_t LoadPartialVertices(const std::filesystem::path &path, utils::SkipList<Vertex> &vertices,
                              SchemaInfo *schema_info, const uint64_t from_offset, const uint64_t vertices_count,
-                             TLabelFromIdFunc get_label_from_id, TPropertyFromIdFunc get_property_from_id) {
+                             TLabelFromIdFunc get_label_from_id, TPropertyFromIdFunc get_property_from_id,
+                             const bool compressed_batch = false) {
   Decoder snapshot;
-  snapshot.Initialize(path, kSnapshotMagic);
-  if (!snapshot.SetPosition(from_offset))
-    throw RecoveryFailure("Couldn't set offset for reading vertices from a snapshot!");
+  snapshot.Initialize(path, kSnapshotMagic, /* memory_mapped = */ true);
+  SetBatchPosition(snapshot, from_offset, compressed_batch,
+                   "Couldn't set offset for reading vertices from a snapshot!");
 
   auto vertex_acc = vertices.access();
   uint64_t last_vertex_gid = 0;
@@ -441,11 +463,12 @@ LoadPartialConnectivityResult LoadPartialConnectivity(const std::filesystem::pat
                                                       SchemaInfo *schema_info, const uint64_t from_offset,
                                                       const uint64_t vertices_count, const SalientConfig::Items items,
                                                       const bool snapshot_has_edges,
-                                                      TEdgeTypeFromIdFunc get_edge_type_from_id) {
+                                                      TEdgeTypeFromIdFunc get_edge_type_from_id,
+                                                      const bool compressed_batch = false) {
   Decoder snapshot;
-  snapshot.Initialize(path, kSnapshotMagic);
-  if (!snapshot.SetPosition(from_offset))
-    throw RecoveryFailure("Couldn't set snapshot offset position doing loading partial connectivity!");
+  snapshot.Initialize(path, kSnapshotMagic, /* memory_mapped = */ true);
+  SetBatchPosition(snapshot, from_offset, compressed_batch,
+                   "Couldn't set snapshot offset position doing loading partial connectivity!");
 
   auto vertex_acc = vertices.access();
   auto edge_acc = edges.access();
@@ -472,7 +495,12 @@ LoadPartialConnectivityResult LoadPartialConnectivity(const std::filesystem::pat
 
   spdlog::info("Recovering connectivity for {} vertices.", vertices_count);
 
-  if (!snapshot.SetPosition(from_offset)) throw RecoveryFailure("Couldn't set from_offset position!");
+  // The decompressed batch is already in memory, so there is no need to read it again.
+  if (compressed_batch) {
+    snapshot.RewindCompressedBatch();
+  } else if (!snapshot.SetPosition(from_offset)) {
+    throw RecoveryFailure("Couldn't set from_offset position!");
+  }
 
   uint64_t five_percent_chunk = vertices_count / 20;
 
@@ -593,6 +621,7 @@ LoadPartialConnectivityResult LoadPartialConnectivity(const std::filesystem::pat
             auto [edge, inserted] = edge_acc.insert(Edge{Gid::FromUint(*edge_gid), nullptr});
             edge_ref = EdgeRef(&*edge);
           }
+          edge_ref.ptr->SetFromVertexHint(&vertex);
           if (items.enable_edges_metadata) {
             edge_metadata_acc.insert(EdgeMetadata{Gid::FromUint(*edge_gid), &vertex});
           }
@@ -2731,6 +2760,7 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
     spdlog::info("Recovering edges.");
     // Recover edges.
     if (snapshot_has_edges) {
+      auto const phase_timer = RecoveryPhaseTimer{RecoveryPhase::SNAPSHOT_EDGES};
       // We don't need to check whether we store properties on edge or not, because `LoadPartialEdges` will always
       // iterate over the edges in the snapshot (if they exist) and the current configuration of properties on edge only
       // affect what it does:
@@ -2743,9 +2773,9 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
 
       RecoverOnMultipleThreads(
           config.durability.recovery_thread_count,
-          [path, edges, items = config.salient.items, &get_property_from_id](const size_t /*batch_index*/,
-                                                                             const BatchInfo &batch) {
-            LoadPartialEdges(path, *edges, batch.offset, batch.count, items, get_property_from_id);
+          [path, edges, items = config.salient.items, compressed_batches = info.compressed_batches,
+           &get_property_from_id](const size_t /*batch_index*/, const BatchInfo &batch) {
+            LoadPartialEdges(path, *edges, batch.offset, batch.count, items, get_property_from_id, compressed_batches);
           },
           edge_batches);
     }
@@ -2760,12 +2790,15 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
     }
 
     const auto vertex_batches = ReadBatchInfos(snapshot);
+    std::optional<RecoveryPhaseTimer> phase_timer{std::in_place, RecoveryPhase::SNAPSHOT_VERTICES};
     RecoverOnMultipleThreads(
         config.durability.recovery_thread_count,
-        [path, vertices, schema_info, &vertex_batches, &get_label_from_id, &get_property_from_id, &last_vertex_gid](
-            const size_t batch_index, const BatchInfo &batch) {
-          const auto last_vertex_gid_in_batch = LoadPartialVertices(
-              path, *vertices, schema_info, batch.offset, batch.count, get_label_from_id, get_property_from_id);
+        [path, vertices, schema_info, compressed_batches = info.compressed_batches, &vertex_batches,
+         &get_label_from_id, &get_property_from_id, &last_vertex_gid](const size_t batch_index,
+                                                                      const BatchInfo &batch) {
+          const auto last_vertex_gid_in_batch =
+              LoadPartialVertices(path, *vertices, schema_info, batch.offset, batch.count, get_label_from_id,
+                                  get_property_from_id, compressed_batches);
           if (batch_index == vertex_batches.size() - 1) {
             last_vertex_gid = last_vertex_gid_in_batch;
           }
@@ -2776,6 +2809,7 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
 
     // Recover vertices (in/out edges).
     spdlog::info("Recover connectivity.");
+    phase_timer.emplace(RecoveryPhase::SNAPSHOT_CONNECTIVITY);
     recovery_info.vertex_batches.reserve(vertex_batches.size());
     for (const auto batch : vertex_batches) {
       recovery_info.vertex_batches.emplace_back(Gid::FromUint(0), batch.count);
@@ -2785,11 +2819,11 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
     RecoverOnMultipleThreads(
         config.durability.recovery_thread_count,
         [path, vertices, edges, edges_metadata, schema_info, edge_count, items = config.salient.items,
-         snapshot_has_edges, &get_edge_type_from_id, &highest_edge_gid,
+         snapshot_has_edges, compressed_batches = info.compressed_batches, &get_edge_type_from_id, &highest_edge_gid,
          &recovery_info](const size_t batch_index, const BatchInfo &batch) {
           const auto result =
               LoadPartialConnectivity(path, *vertices, *edges, *edges_metadata, schema_info, batch.offset, batch.count,
-                                      items, snapshot_has_edges, get_edge_type_from_id);
+                                      items, snapshot_has_edges, get_edge_type_from_id, compressed_batches);
           edge_count->fetch_add(result.edge_count);
           auto known_highest_edge_gid = highest_edge_gid.load();
           while (known_highest_edge_gid < result.highest_edge_id) {
@@ -2799,6 +2833,7 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
         },
         vertex_batches);
 
+    phase_timer.reset();
     spdlog::info("Connectivity is recovered.");
 
     // Set initial values for edge/vertex ID generators.
@@ -2891,11 +2926,24 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
           throw RecoveryFailure("Couldn't read average group size for label property index statistics!");
         const auto avg_degree = snapshot.ReadDouble();
         if (!avg_degree) throw RecoveryFailure("Couldn't read average degree for label property index statistics!");
+        std::vector<double> histogram;
+        if (*version >= kIndexStatsHistogramVersion) {
+          const auto histogram_size = snapshot.ReadUint();
+          if (!histogram_size)
+            throw RecoveryFailure("Couldn't read histogram size for label property index statistics!");
+          histogram.reserve(*histogram_size);
+          for (uint64_t j = 0; j < *histogram_size; ++j) {
+            const auto bound = snapshot.ReadDouble();
+            if (!bound) throw RecoveryFailure("Couldn't read histogram for label property index statistics!");
+            histogram.push_back(*bound);
+          }
+        }
         const auto label_id = get_label_from_id(*label);
         const auto property_id = get_property_from_id(*property);
         indices_constraints.indices.label_property_stats.emplace_back(
             label_id, std::make_pair(property_id, LabelPropertyIndexStats{*count, *distinct_values_count, *statistic,
-                                                                          *avg_group_size, *avg_degree}));
+                                                                          *avg_group_size, *avg_degree,
+                                                                          std::move(histogram)}));
         SPDLOG_TRACE("Recovered metadata of label+property index statistics for :{}({})",
                      name_id_mapper->IdToName(snapshot_id_map.at(*label)),
                      name_id_mapper->IdToName(snapshot_id_map.at(*property)));
@@ -2965,6 +3013,54 @@ RecoveredSnapshot LoadSnapshot(const std::filesystem::path &path, utils::SkipLis
       spdlog::info("Metadata of point indices are recovered.");
     }
 
+    // Recover vector indices.
+    if (*version >= kVectorIndexVersion) {
+      auto size = snapshot.ReadUint();
+      if (!size) throw RecoveryFailure("Couldn't recover the number of vector indices!");
+      spdlog::info("Recovering metadata of {} vector indices.", *size);
+      for (uint64_t i = 0; i < *size; ++i) {
+        auto label = snapshot.ReadUint();
+        if (!label) throw RecoveryFailure("Couldn't read label for vector index!");
+        auto property = snapshot.ReadUint();
+        if (!property) throw RecoveryFailure("Couldn't read property for vector index!");
+        auto dimension = snapshot.ReadUint();
+        if (!dimension) throw RecoveryFailure("Couldn't read dimension for vector index!");
+        AddRecoveredIndexConstraint(&indices_constraints.indices.vector_indices,
+                                    {get_label_from_id(*label), get_property_from_id(*property), *dimension},
+                                    "The vector index already exists!");
+        SPDLOG_TRACE("Recovered metadata of vector index for :{}({})",
+                     name_id_mapper->IdToName(snapshot_id_map.at(*label)),
+                     name_id_mapper->IdToName(snapshot_id_map.at(*property)));
+      }
+      spdlog::info("Metadata of vector indices are recovered.");
+    }
+
+    // Recover composite indices.
+    if (*version >= kCompositeIndexVersion) {
+      auto size = snapshot.ReadUint();
+      if (!size) throw RecoveryFailure("Couldn't recover the number of composite indices!");
+      spdlog::info("Recovering metadata of {} composite indices.", *size);
+      for (uint64_t i = 0; i < *size; ++i) {
+        auto label = snapshot.ReadUint();
+        if (!label) throw RecoveryFailure("Couldn't read label for composite index!");
+        auto properties_count = snapshot.ReadUint();
+        if (!properties_count) throw RecoveryFailure("Couldn't read the number of properties for composite index!");
+        std::vector<PropertyId> properties;
+        properties.reserve(*properties_count);
+        for (uint64_t j = 0; j < *properties_count; ++j) {
+          auto property = snapshot.ReadUint();
+          if (!property) throw RecoveryFailure("Couldn't read property for composite index!");
+          properties.push_back(get_property_from_id(*property));
+        }
+        AddRecoveredIndexConstraint(&indices_constraints.indices.label_property_composite,
+                                    {get_label_from_id(*label), std::move(properties)},
+                                    "The composite index already exists!");
+        SPDLOG_TRACE("Recovered metadata of composite index for :{}",
+                     name_id_mapper->IdToName(snapshot_id_map.at(*label)));
+      }
+      spdlog::info("Metadata of composite indices are recovered.");
+    }
+
     // Recover text indices.
     // NOTE: while this is experimental and hence optional
     //       it must be last in the SECTION_INDICES
@@ -3202,6 +3298,163 @@ auto EnsureRetentionCountSnapshotsExist(const std::filesystem::path &snapshot_di
   return old_snapshot_files;
 }
 
+// Infix of the segment files, which are named after their snapshot.
+constexpr std::string_view kSnapshotSegmentInfix = ".segment_";
+
+void RemoveSnapshotSegments(const std::filesystem::path &snapshot_directory) {
+  if (!utils::DirExists(snapshot_directory)) return;
+  std::error_code error_code;
+  for (const auto &item : std::filesystem::directory_iterator(snapshot_directory, error_code)) {
+    if (!item.is_regular_file() ||
+        item.path().filename().string().find(kSnapshotSegmentInfix) == std::string::npos) {
+      continue;
+    }
+    spdlog::info("Removing the segment {} of an unfinished snapshot.", item.path());
+    utils::DeleteFile(item.path());
+  }
+  if (error_code) {
+    spdlog::warn("Couldn't remove the segments of unfinished snapshots in {}: {}", snapshot_directory,
+                 error_code.message());
+  }
+}
+
+/// Part of the edges or vertices section written by a single thread into its
+/// own file. Batch offsets are relative to the beginning of the segment.
+struct SnapshotSegment {
+  std::filesystem::path path;
+  std::vector<BatchInfo> batch_infos;
+  uint64_t count{0};
+  std::unordered_set<uint64_t> used_ids;
+};
+
+// The compressor works with 32-bit sizes, so compressed batches are closed
+// early once they grow over this size.
+constexpr uint64_t kMaxCompressedBatchSize = 1UL << 30U;
+
+template <typename TIterable, typename TFunc>
+uint64_t WriteSnapshotObjects(Encoder &encoder, TIterable &objects, uint64_t items_per_batch, bool compress_batches,
+                              std::unordered_set<uint64_t> *used_ids, const TFunc &write_object,
+                              std::vector<BatchInfo> *batch_infos) {
+  uint64_t count = 0;
+  uint64_t items_in_current_batch = 0;
+  uint64_t batch_start_offset = 0;
+  auto start_batch = [&] {
+    batch_start_offset = encoder.GetPosition();
+    if (compress_batches) encoder.StartCompressedBatch();
+  };
+  auto finish_batch = [&] {
+    if (compress_batches) encoder.FinishCompressedBatch();
+    if (items_in_current_batch > 0) {
+      batch_infos->push_back(BatchInfo{batch_start_offset, items_in_current_batch});
+    }
+    items_in_current_batch = 0;
+  };
+
+  start_batch();
+  for (auto &object : objects) {
+    if (!write_object(encoder, *used_ids, object)) continue;
+    ++count;
+    ++items_in_current_batch;
+    if (items_in_current_batch == items_per_batch ||
+        (compress_batches && encoder.GetCompressedBatchSize() >= kMaxCompressedBatchSize)) {
+      finish_batch();
+      start_batch();
+    }
+  }
+  finish_batch();
+  return count;
+}
+
+void AppendSnapshotSegment(Encoder &snapshot, const std::filesystem::path &path) {
+  static constexpr size_t kCopyBufferSize = 1UL << 20U;
+  utils::InputFile file;
+  MG_ASSERT(file.Open(path), "Couldn't open snapshot segment {}!", path);
+  std::vector<uint8_t> buffer(kCopyBufferSize);
+  auto remaining = file.GetSize();
+  while (remaining > 0) {
+    const auto to_read = std::min(remaining, buffer.size());
+    MG_ASSERT(file.Read(buffer.data(), to_read), "Couldn't read snapshot segment {}!", path);
+    snapshot.Write(buffer.data(), to_read);
+    remaining -= to_read;
+  }
+  file.Close();
+}
+
+/// Writes all objects visible to the transaction into the snapshot. When more
+/// than one thread is allowed, the skip list is split into key ranges and each
+/// range is written into a separate segment file concurrently. The segments
+/// are then appended to the snapshot in key order, so the resulting section
+/// and its batch offsets are the same as if they were written sequentially.
+template <typename TObj, typename TFunc>
+uint64_t WriteSnapshotSection(Encoder &snapshot, utils::SkipList<TObj> *objects, Transaction *transaction,
+                              const std::filesystem::path &snapshot_path, uint64_t items_per_batch,
+                              bool compress_batches, uint64_t thread_count, std::unordered_set<uint64_t> *used_ids,
+                              const TFunc &write_object, std::vector<BatchInfo> *batch_infos) {
+  auto acc = objects->access();
+  if (thread_count <= 1 || acc.size() <= items_per_batch) {
+    return WriteSnapshotObjects(snapshot, acc, items_per_batch, compress_batches, used_ids, write_object,
+                                batch_infos);
+  }
+
+  auto chunks = acc.chunks(thread_count);
+  std::vector<SnapshotSegment> segments(chunks.size());
+  // Also if writing or appending a segment fails
+  utils::OnScopeExit remove_segments{[&segments] {
+    for (const auto &segment : segments) {
+      if (!segment.path.empty()) utils::DeleteFile(segment.path);
+    }
+  }};
+  utils::Synchronized<std::exception_ptr, utils::SpinLock> maybe_error{};
+  // Deltas are read concurrently, so the transaction mustn't use its cache.
+  transaction->parallel_readers_active = true;
+  {
+    std::atomic<uint64_t> chunk_counter = 0;
+    thread_count = std::min(thread_count, chunks.size());
+    std::vector<std::jthread> threads;
+    threads.reserve(thread_count);
+
+    for (auto i{0U}; i < thread_count; ++i) {
+      threads.emplace_back([&]() {
+        while (!*maybe_error.Lock()) {
+          const auto chunk_index = chunk_counter++;
+          if (chunk_index >= chunks.size()) {
+            return;
+          }
+          auto &segment = segments[chunk_index];
+          segment.path = fmt::format("{}{}{}", snapshot_path.string(), kSnapshotSegmentInfix, chunk_index);
+          try {
+            Encoder encoder;
+            encoder.Initialize(segment.path);
+            segment.count = WriteSnapshotObjects(encoder, chunks[chunk_index], items_per_batch, compress_batches,
+                                                 &segment.used_ids, write_object, &segment.batch_infos);
+            encoder.Close();
+          } catch (...) {
+            *maybe_error.Lock() = std::current_exception();
+          }
+        }
+      });
+    }
+  }
+  transaction->parallel_readers_active = false;
+
+  if (auto error = *maybe_error.Lock()) {
+    std::rethrow_exception(error);
+  }
+  uint64_t count = 0;
+  for (auto &segment : segments) {
+    if (segment.path.empty()) continue;
+    const auto segment_offset = snapshot.GetPosition();
+    AppendSnapshotSegment(snapshot, segment.path);
+    for (const auto &batch_info : segment.batch_infos) {
+      batch_infos->push_back(BatchInfo{segment_offset + batch_info.offset, batch_info.count});
+    }
+    used_ids->merge(segment.used_ids);
+    count += segment.count;
+    utils::DeleteFile(segment.path);
+  }
+  return count;
+}
+
 void CreateSnapshot(Storage *storage, Transaction *transaction, const std::filesystem::path &snapshot_directory,
                     const std::filesystem::path &wal_directory, utils::SkipList<Vertex> *vertices,
                     utils::SkipList<Edge> *edges, utils::UUID const &uuid,
@@ -3263,21 +3516,23 @@ void CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
     snapshot.WriteUint(mapping.AsUint());
   };
 
+  const auto items_per_batch = storage->config_.durability.items_per_batch;
+  const auto compress_batches = storage->config_.durability.snapshot_batch_compression;
+  const auto thread_count = storage->config_.durability.allow_parallel_snapshot_creation
+                                ? storage->config_.durability.recovery_thread_count
+                                : 1;
+
   std::vector<BatchInfo> edge_batch_infos;
-  auto items_in_current_batch{0UL};
-  auto batch_start_offset{0UL};
   // Store all edges.
   if (storage->config_.salient.items.properties_on_edges) {
     offset_edges = snapshot.GetPosition();
-    batch_start_offset = offset_edges;
-    auto acc = edges->access();
-    for (auto &edge : acc) {
+    auto write_edge = [storage, transaction](Encoder &encoder, std::unordered_set<uint64_t> &ids, Edge &edge) {
       // The edge visibility check must be done here manually because we don't
       // allow direct access to the edges through the public API.
       bool is_visible = true;
       Delta *delta = nullptr;
       {
-        auto guard = std::shared_lock{edge.lock};
+        auto guard = std::shared_lock{EdgeLock(&edge)};
         is_visible = !edge.deleted;
         delta = edge.delta;
       }
@@ -3302,7 +3557,7 @@ void CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
           }
         }
       });
-      if (!is_visible) continue;
+      if (!is_visible) return false;
       EdgeRef edge_ref(&edge);
       // Here we create an edge accessor that we will use to get the
       // properties of the edge. The accessor is created with an invalid
@@ -3317,41 +3572,35 @@ void CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
 
       // Store the edge.
       {
-        snapshot.WriteMarker(Marker::SECTION_EDGE);
-        snapshot.WriteUint(edge.gid.AsUint());
+        encoder.WriteMarker(Marker::SECTION_EDGE);
+        encoder.WriteUint(edge.gid.AsUint());
         const auto &props = maybe_props.GetValue();
-        snapshot.WriteUint(props.size());
+        encoder.WriteUint(props.size());
         for (const auto &item : props) {
-          write_mapping(item.first);
-          snapshot.WritePropertyValue(item.second);
+          ids.insert(item.first.AsUint());
+          encoder.WriteUint(item.first.AsUint());
+          encoder.WritePropertyValue(item.second);
         }
       }
-
-      ++edges_count;
-      ++items_in_current_batch;
-      if (items_in_current_batch == storage->config_.durability.items_per_batch) {
-        edge_batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
-        batch_start_offset = snapshot.GetPosition();
-        items_in_current_batch = 0;
-      }
-    }
-  }
-
-  if (items_in_current_batch > 0) {
-    edge_batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
+      return true;
+    };
+    edges_count = WriteSnapshotSection(snapshot, edges, transaction, path, items_per_batch, compress_batches,
+                                       thread_count, &used_ids, write_edge, &edge_batch_infos);
   }
 
   std::vector<BatchInfo> vertex_batch_infos;
   // Store all vertices.
   {
-    items_in_current_batch = 0;
     offset_vertices = snapshot.GetPosition();
-    batch_start_offset = offset_vertices;
-    auto acc = vertices->access();
-    for (auto &vertex : acc) {
+    auto write_vertex = [storage, transaction](Encoder &encoder, std::unordered_set<uint64_t> &ids, Vertex &vertex) {
+      auto write_mapping = [&encoder, &ids](auto mapping) {
+        ids.insert(mapping.AsUint());
+        encoder.WriteUint(mapping.AsUint());
+      };
+
       // The visibility check is implemented for vertices so we use it here.
       auto va = VertexAccessor::Create(&vertex, storage, transaction, View::OLD);
-      if (!va) continue;
+      if (!va) return false;
 
       // Get vertex data.
       // TODO (mferencevic): All of these functions could be written into a
@@ -3367,63 +3616,54 @@ void CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
 
       // Store the vertex.
       {
-        snapshot.WriteMarker(Marker::SECTION_VERTEX);
-        snapshot.WriteUint(vertex.gid.AsUint());
+        encoder.WriteMarker(Marker::SECTION_VERTEX);
+        encoder.WriteUint(vertex.gid.AsUint());
         const auto &labels = maybe_labels.GetValue();
-        snapshot.WriteUint(labels.size());
+        encoder.WriteUint(labels.size());
         for (const auto &item : labels) {
           write_mapping(item);
         }
         const auto &props = maybe_props.GetValue();
-        snapshot.WriteUint(props.size());
+        encoder.WriteUint(props.size());
         for (const auto &item : props) {
           write_mapping(item.first);
-          snapshot.WritePropertyValue(item.second);
+          encoder.WritePropertyValue(item.second);
         }
         const auto &in_edges = maybe_in_edges.GetValue().edges;
         const auto &out_edges = maybe_out_edges.GetValue().edges;
 
         if (storage->config_.salient.items.properties_on_edges) {
-          snapshot.WriteUint(in_edges.size());
+          encoder.WriteUint(in_edges.size());
           for (const auto &item : in_edges) {
-            snapshot.WriteUint(item.GidPropertiesOnEdges().AsUint());
-            snapshot.WriteUint(item.FromVertex().Gid().AsUint());
+            encoder.WriteUint(item.GidPropertiesOnEdges().AsUint());
+            encoder.WriteUint(item.FromVertex().Gid().AsUint());
             write_mapping(item.EdgeType());
           }
-          snapshot.WriteUint(out_edges.size());
+          encoder.WriteUint(out_edges.size());
           for (const auto &item : out_edges) {
-            snapshot.WriteUint(item.GidPropertiesOnEdges().AsUint());
-            snapshot.WriteUint(item.ToVertex().Gid().AsUint());
+            encoder.WriteUint(item.GidPropertiesOnEdges().AsUint());
+            encoder.WriteUint(item.ToVertex().Gid().AsUint());
             write_mapping(item.EdgeType());
           }
         } else {
-          snapshot.WriteUint(in_edges.size());
+          encoder.WriteUint(in_edges.size());
           for (const auto &item : in_edges) {
-            snapshot.WriteUint(item.GidNoPropertiesOnEdges().AsUint());
-            snapshot.WriteUint(item.FromVertex().Gid().AsUint());
+            encoder.WriteUint(item.GidNoPropertiesOnEdges().AsUint());
+            encoder.WriteUint(item.FromVertex().Gid().AsUint());
             write_mapping(item.EdgeType());
           }
-          snapshot.WriteUint(out_edges.size());
+          encoder.WriteUint(out_edges.size());
           for (const auto &item : out_edges) {
-            snapshot.WriteUint(item.GidNoPropertiesOnEdges().AsUint());
-            snapshot.WriteUint(item.ToVertex().Gid().AsUint());
+            encoder.WriteUint(item.GidNoPropertiesOnEdges().AsUint());
+            encoder.WriteUint(item.ToVertex().Gid().AsUint());
             write_mapping(item.EdgeType());
           }
         }
       }
-
-      ++vertices_count;
-      ++items_in_current_batch;
-      if (items_in_current_batch == storage->config_.durability.items_per_batch) {
-        vertex_batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
-        batch_start_offset = snapshot.GetPosition();
-        items_in_current_batch = 0;
-      }
-    }
-
-    if (items_in_current_batch > 0) {
-      vertex_batch_infos.push_back(BatchInfo{batch_start_offset, items_in_current_batch});
-    }
+      return true;
+    };
+    vertices_count = WriteSnapshotSection(snapshot, vertices, transaction, path, items_per_batch, compress_batches,
+                                          thread_count, &used_ids, write_vertex, &vertex_batch_infos);
   }
 
   // Write indices.
@@ -3493,6 +3733,10 @@ void CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
           snapshot.WriteDouble(stats->statistic);
           snapshot.WriteDouble(stats->avg_group_size);
           snapshot.WriteDouble(stats->avg_degree);
+          snapshot.WriteUint(stats->histogram.size());
+          for (const auto bound : stats->histogram) {
+            snapshot.WriteDouble(bound);
+          }
           ++i;
         }
       }
@@ -3535,6 +3779,30 @@ void CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
       }
     }
 
+    // Write vector indices.
+    {
+      auto vector_indices = storage->indices_.vector_index_.ListIndices();
+      snapshot.WriteUint(vector_indices.size());
+      for (const auto &spec : vector_indices) {
+        write_mapping(spec.label);
+        write_mapping(spec.property);
+        snapshot.WriteUint(spec.dimension);
+      }
+    }
+
+    // Write composite indices.
+    {
+      auto composite_indices = storage->indices_.label_property_composite_index_.ListIndices();
+      snapshot.WriteUint(composite_indices.size());
+      for (const auto &[label, properties] : composite_indices) {
+        write_mapping(label);
+        snapshot.WriteUint(properties.size());
+        for (const auto property : properties) {
+          write_mapping(property);
+        }
+      }
+    }
+
     // Write text indices.
     if (flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
       auto text_indices = storage->indices_.text_index_.ListIndices();
@@ -3634,6 +3902,7 @@ void CreateSnapshot(Storage *storage, Transaction *transaction, const std::files
     snapshot.WriteUint(transaction->start_timestamp);
     snapshot.WriteUint(edges_count);
     snapshot.WriteUint(vertices_count);
+    snapshot.WriteBool(compress_batches);
   }
 
   auto write_batch_infos = [&snapshot](const std::vector<BatchInfo> &batch_infos) {
@@ -50,6 +50,7 @@ struct SnapshotInfo {
   uint64_t start_timestamp;
   uint64_t edges_count;
   uint64_t vertices_count;
+  bool compressed_batches{false};
 };
 
 /// Structure used to hold information about the snapshot that has been
@@ -72,6 +73,10 @@ RecoveredSnapshot LoadSnapshot(std::filesystem::path const &path, utils::SkipLis
                                NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count, Config const &config,
                                memgraph::storage::EnumStore *enum_store, memgraph::storage::SchemaInfo *schema_info);
 
+/// Removes the segment files of the snapshots which weren't finished, e.g.
+/// because the process was killed while writing them.
+void RemoveSnapshotSegments(const std::filesystem::path &snapshot_directory);
+
 void CreateSnapshot(Storage *storage, Transaction *transaction, const std::filesystem::path &snapshot_directory,
                     const std::filesystem::path &wal_directory, utils::SkipList<Vertex> *vertices,
                     utils::SkipList<Edge> *edges, utils::UUID const &uuid,
@@ -40,6 +40,10 @@ enum class StorageMetadataOperation {
   ENUM_ALTER_UPDATE,
   POINT_INDEX_CREATE,
   POINT_INDEX_DROP,
+  VECTOR_INDEX_CREATE,
+  VECTOR_INDEX_DROP,
+  LABEL_PROPERTY_COMPOSITE_INDEX_CREATE,
+  LABEL_PROPERTY_COMPOSITE_INDEX_DROP,
 };
 
 }  // namespace memgraph::storage::durability
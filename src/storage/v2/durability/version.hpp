@@ -20,7 +20,7 @@ namespace memgraph::storage::durability {
 // The current version of snapshot and WAL encoding / decoding.
 // IMPORTANT: Please bump this version for every snapshot and/or WAL format
 // change!!!
-const uint64_t kVersion{20};
+const uint64_t kVersion{24};
 
 const uint64_t kOldestSupportedVersion{14};
 const uint64_t kUniqueConstraintVersion{13};
@@ -31,6 +31,10 @@ const uint64_t kEnumsVersion{18};
 // We prematurely bumped the version when making the point datatype as part of 2.19
 const uint64_t kAccidentalVersionBump1{19};
 const uint64_t kPointIndexAndTypeConstraints{20};
+const uint64_t kCompressedBatchesVersion{21};
+const uint64_t kIndexStatsHistogramVersion{22};
+const uint64_t kVectorIndexVersion{23};
+const uint64_t kCompositeIndexVersion{24};
 
 // Magic values written to the start of a snapshot/WAL file to identify it.
 const std::string kSnapshotMagic{"MGsn"};
@@ -11,6 +11,10 @@
 
 #include "storage/v2/durability/wal.hpp"
 
+#include <algorithm>
+#include <exception>
+#include <thread>
+
 #include "storage/v2/constraints/type_constraints_kind.hpp"
 #include "storage/v2/delta.hpp"
 #include "storage/v2/durability/exceptions.hpp"
@@ -25,6 +29,8 @@
 #include "storage/v2/vertex.hpp"
 #include "utils/file_locker.hpp"
 #include "utils/logging.hpp"
+#include "utils/spin_lock.hpp"
+#include "utils/synchronized.hpp"
 
 namespace memgraph::storage::durability {
 
@@ -112,6 +118,10 @@ constexpr Marker OperationToMarker(StorageMetadataOperation operation) {
     add_case(TYPE_CONSTRAINT_DROP);
     add_case(POINT_INDEX_CREATE);
     add_case(POINT_INDEX_DROP);
+    add_case(VECTOR_INDEX_CREATE);
+    add_case(VECTOR_INDEX_DROP);
+    add_case(LABEL_PROPERTY_COMPOSITE_INDEX_CREATE);
+    add_case(LABEL_PROPERTY_COMPOSITE_INDEX_DROP);
   }
 #undef add_case
 }
@@ -184,6 +194,10 @@ constexpr WalDeltaData::Type MarkerToWalDeltaDataType(Marker marker) {
     add_case(VERTEX_SET_PROPERTY);
     add_case(POINT_INDEX_CREATE);
     add_case(POINT_INDEX_DROP);
+    add_case(VECTOR_INDEX_CREATE);
+    add_case(VECTOR_INDEX_DROP);
+    add_case(LABEL_PROPERTY_COMPOSITE_INDEX_CREATE);
+    add_case(LABEL_PROPERTY_COMPOSITE_INDEX_DROP);
 
     case Marker::TYPE_NULL:
     case Marker::TYPE_BOOL:
@@ -334,6 +348,7 @@ WalDeltaData ReadSkipWalDeltaData(BaseDecoder *decoder) {
     case WalDeltaData::Type::LABEL_PROPERTY_INDEX_DROP:
     case WalDeltaData::Type::POINT_INDEX_CREATE:
     case WalDeltaData::Type::POINT_INDEX_DROP:
+    case WalDeltaData::Type::VECTOR_INDEX_DROP:
     case WalDeltaData::Type::EXISTENCE_CONSTRAINT_CREATE:
     case WalDeltaData::Type::EXISTENCE_CONSTRAINT_DROP: {
       if constexpr (read_data) {
@@ -403,6 +418,30 @@ WalDeltaData ReadSkipWalDeltaData(BaseDecoder *decoder) {
       }
       break;
     }
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP: {
+      if constexpr (read_data) {
+        auto label = decoder->ReadString();
+        if (!label) throw RecoveryFailure("Invalid WAL data!");
+        delta.operation_label_property_list.label = std::move(*label);
+        auto properties_count = decoder->ReadUint();
+        if (!properties_count) throw RecoveryFailure("Invalid WAL data!");
+        delta.operation_label_property_list.properties.reserve(*properties_count);
+        for (uint64_t i = 0; i < *properties_count; ++i) {
+          auto property = decoder->ReadString();
+          if (!property) throw RecoveryFailure("Invalid WAL data!");
+          delta.operation_label_property_list.properties.push_back(std::move(*property));
+        }
+      } else {
+        if (!decoder->SkipString()) throw RecoveryFailure("Invalid WAL data!");
+        auto properties_count = decoder->ReadUint();
+        if (!properties_count) throw RecoveryFailure("Invalid WAL data!");
+        for (uint64_t i = 0; i < *properties_count; ++i) {
+          if (!decoder->SkipString()) throw RecoveryFailure("Invalid WAL data!");
+        }
+      }
+      break;
+    }
     case WalDeltaData::Type::TYPE_CONSTRAINT_CREATE:
     case WalDeltaData::Type::TYPE_CONSTRAINT_DROP: {
       if constexpr (read_data) {
@@ -423,6 +462,23 @@ WalDeltaData ReadSkipWalDeltaData(BaseDecoder *decoder) {
       }
       break;
     }
+    case WalDeltaData::Type::VECTOR_INDEX_CREATE: {
+      if constexpr (read_data) {
+        auto label = decoder->ReadString();
+        if (!label) throw RecoveryFailure("Invalid WAL data!");
+        delta.operation_vector_index.label = std::move(*label);
+        auto property = decoder->ReadString();
+        if (!property) throw RecoveryFailure("Invalid WAL data!");
+        delta.operation_vector_index.property = std::move(*property);
+        auto dimension = decoder->ReadUint();
+        if (!dimension) throw RecoveryFailure("Invalid WAL data!");
+        delta.operation_vector_index.dimension = *dimension;
+      } else {
+        if (!decoder->SkipString() || !decoder->SkipString() || !decoder->ReadUint())
+          throw RecoveryFailure("Invalid WAL data!");
+      }
+      break;
+    }
     case WalDeltaData::Type::TEXT_INDEX_CREATE:
     case WalDeltaData::Type::TEXT_INDEX_DROP: {
       if constexpr (read_data) {
@@ -650,6 +706,7 @@ bool operator==(const WalDeltaData &a, const WalDeltaData &b) {
     case WalDeltaData::Type::LABEL_PROPERTY_INDEX_DROP:
     case WalDeltaData::Type::POINT_INDEX_CREATE:
     case WalDeltaData::Type::POINT_INDEX_DROP:
+    case WalDeltaData::Type::VECTOR_INDEX_DROP:
     case WalDeltaData::Type::EXISTENCE_CONSTRAINT_CREATE:
     case WalDeltaData::Type::EXISTENCE_CONSTRAINT_DROP:
       return a.operation_label_property.label == b.operation_label_property.label &&
@@ -664,11 +721,19 @@ bool operator==(const WalDeltaData &a, const WalDeltaData &b) {
     case WalDeltaData::Type::UNIQUE_CONSTRAINT_DROP:
       return a.operation_label_properties.label == b.operation_label_properties.label &&
              a.operation_label_properties.properties == b.operation_label_properties.properties;
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+    case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+      return a.operation_label_property_list.label == b.operation_label_property_list.label &&
+             a.operation_label_property_list.properties == b.operation_label_property_list.properties;
     case WalDeltaData::Type::TYPE_CONSTRAINT_CREATE:
     case WalDeltaData::Type::TYPE_CONSTRAINT_DROP:
       return a.operation_label_property_type.label == b.operation_label_property_type.label &&
              a.operation_label_property_type.property == b.operation_label_property_type.property &&
              a.operation_label_property_type.type == b.operation_label_property_type.type;
+    case WalDeltaData::Type::VECTOR_INDEX_CREATE:
+      return a.operation_vector_index.label == b.operation_vector_index.label &&
+             a.operation_vector_index.property == b.operation_vector_index.property &&
+             a.operation_vector_index.dimension == b.operation_vector_index.dimension;
     case WalDeltaData::Type::EDGE_INDEX_CREATE:
     case WalDeltaData::Type::EDGE_INDEX_DROP:
       return a.operation_edge_type.edge_type == b.operation_edge_type.edge_type;
@@ -779,7 +844,7 @@ void EncodeDelta(BaseEncoder *encoder, NameIdMapper *name_id_mapper, const Delta
   // actions.
   encoder->WriteMarker(Marker::SECTION_DELTA);
   encoder->WriteUint(timestamp);
-  auto guard = std::shared_lock{edge.lock};
+  auto guard = std::shared_lock{EdgeLock(&edge)};
   switch (delta.action) {
     case Delta::Action::SET_PROPERTY: {
       encoder->WriteMarker(Marker::DELTA_EDGE_SET_PROPERTY);
@@ -818,11 +883,160 @@ void EncodeTransactionEnd(BaseEncoder *encoder, uint64_t timestamp) {
   encoder->WriteMarker(Marker::DELTA_TRANSACTION_END);
 }
 
+namespace {
+
+// Phases in which a window of WAL deltas is applied during parallel replay.
+// Creations (and everything that isn't tied to a single object) are applied
+// first, then label and property updates, and finally edge and vertex
+// deletions. Gids are never reused, so this preserves the outcome of the
+// original WAL order.
+enum class WalReplayPhase : uint8_t { CREATE, UPDATE, DELETE_EDGE, DELETE_VERTEX };
+
+WalReplayPhase GetWalReplayPhase(const WalDeltaData::Type type) {
+  switch (type) {
+    case WalDeltaData::Type::VERTEX_ADD_LABEL:
+    case WalDeltaData::Type::VERTEX_REMOVE_LABEL:
+    case WalDeltaData::Type::VERTEX_SET_PROPERTY:
+    case WalDeltaData::Type::EDGE_SET_PROPERTY:
+      return WalReplayPhase::UPDATE;
+    case WalDeltaData::Type::EDGE_DELETE:
+      return WalReplayPhase::DELETE_EDGE;
+    case WalDeltaData::Type::VERTEX_DELETE:
+      return WalReplayPhase::DELETE_VERTEX;
+    default:
+      return WalReplayPhase::CREATE;
+  }
+}
+
+Gid GetWalUpdateDeltaGid(const WalDeltaData &delta) {
+  if (delta.type == WalDeltaData::Type::VERTEX_ADD_LABEL || delta.type == WalDeltaData::Type::VERTEX_REMOVE_LABEL) {
+    return delta.vertex_add_remove_label.gid;
+  }
+  return delta.vertex_edge_set_property.gid;
+}
+
+struct WalDeltaWindow {
+  std::vector<WalDeltaData> deltas;
+  uint64_t next_timestamp{0};
+};
+
+// Replays the WAL deltas in windows of `window_size` deltas. The next window is
+// decoded while the current one is applied. Within a window, label and
+// property updates are partitioned by object gid so that all updates of a
+// single object are applied by the same thread in WAL order.
+template <typename TApplyDelta>
+uint64_t ApplyWalDeltasInParallel(BaseDecoder *wal, const uint64_t num_deltas,
+                                  const std::optional<uint64_t> last_loaded_timestamp,
+                                  const ParallelizedWalReplayInfo &parallel_exec_info,
+                                  utils::SkipList<Vertex> *vertices, utils::SkipList<Edge> *edges, RecoveryInfo *ret,
+                                  const TApplyDelta &apply_delta) {
+  const auto window_size = std::max<uint64_t>(parallel_exec_info.window_size, 1);
+  const auto thread_count = parallel_exec_info.thread_count;
+
+  uint64_t remaining = num_deltas;
+  auto read_window = [&] {
+    WalDeltaWindow window;
+    window.deltas.reserve(std::min(window_size, remaining));
+    while (remaining > 0 && window.deltas.size() < window_size) {
+      --remaining;
+      // Read WAL delta header to find out the delta timestamp.
+      auto timestamp = ReadWalDeltaHeader(wal);
+      if (!last_loaded_timestamp || timestamp > *last_loaded_timestamp) {
+        // This delta should be loaded.
+        window.deltas.push_back(ReadWalDeltaData(wal));
+        window.next_timestamp = std::max(window.next_timestamp, timestamp + 1);
+      } else {
+        // This delta should be skipped.
+        SkipWalDeltaData(wal);
+      }
+    }
+    return window;
+  };
+
+  auto edge_acc = edges->access();
+  auto vertex_acc = vertices->access();
+  auto apply_window = [&](WalDeltaWindow &window) {
+    std::vector<std::vector<WalDeltaData *>> updates(thread_count);
+    std::vector<WalDeltaData *> edge_deletes;
+    std::vector<WalDeltaData *> vertex_deletes;
+    for (auto &delta : window.deltas) {
+      switch (GetWalReplayPhase(delta.type)) {
+        case WalReplayPhase::CREATE:
+          apply_delta(delta, vertex_acc, edge_acc);
+          break;
+        case WalReplayPhase::UPDATE:
+          updates[GetWalUpdateDeltaGid(delta).AsUint() % thread_count].push_back(&delta);
+          break;
+        case WalReplayPhase::DELETE_EDGE:
+          edge_deletes.push_back(&delta);
+          break;
+        case WalReplayPhase::DELETE_VERTEX:
+          vertex_deletes.push_back(&delta);
+          break;
+      }
+    }
+
+    {
+      utils::Synchronized<std::exception_ptr, utils::SpinLock> maybe_error{};
+      {
+        std::vector<std::jthread> threads;
+        threads.reserve(thread_count);
+        for (auto &partition : updates) {
+          if (partition.empty()) continue;
+          threads.emplace_back([&] {
+            try {
+              auto worker_edge_acc = edges->access();
+              auto worker_vertex_acc = vertices->access();
+              for (auto *delta : partition) {
+                apply_delta(*delta, worker_vertex_acc, worker_edge_acc);
+              }
+            } catch (...) {
+              maybe_error.WithLock([](auto &error) {
+                if (!error) error = std::current_exception();
+              });
+            }
+          });
+        }
+      }
+      if (auto error = *maybe_error.Lock(); error) std::rethrow_exception(error);
+    }
+
+    for (auto *delta : edge_deletes) apply_delta(*delta, vertex_acc, edge_acc);
+    for (auto *delta : vertex_deletes) apply_delta(*delta, vertex_acc, edge_acc);
+  };
+
+  uint64_t deltas_applied = 0;
+  auto current = read_window();
+  while (!current.deltas.empty() || remaining > 0) {
+    WalDeltaWindow next;
+    std::exception_ptr read_error;
+    {
+      std::jthread reader([&] {
+        try {
+          next = read_window();
+        } catch (...) {
+          read_error = std::current_exception();
+        }
+      });
+      apply_window(current);
+    }
+    if (read_error) std::rethrow_exception(read_error);
+
+    ret->next_timestamp = std::max(ret->next_timestamp, current.next_timestamp);
+    deltas_applied += current.deltas.size();
+    current = std::move(next);
+  }
+  return deltas_applied;
+}
+
+}  // namespace
+
 RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConstraints *indices_constraints,
                      const std::optional<uint64_t> last_loaded_timestamp, utils::SkipList<Vertex> *vertices,
                      utils::SkipList<Edge> *edges, NameIdMapper *name_id_mapper, std::atomic<uint64_t> *edge_count,
                      SalientConfig::Items items, EnumStore *enum_store, SchemaInfo *schema_info,
-                     std::function<std::optional<std::tuple<EdgeRef, EdgeTypeId, Vertex *, Vertex *>>(Gid)> find_edge) {
+                     std::function<std::optional<std::tuple<EdgeRef, EdgeTypeId, Vertex *, Vertex *>>(Gid)> find_edge,
+                     const std::optional<ParallelizedWalReplayInfo> &parallel_exec_info) {
   spdlog::info("Trying to load WAL file {}.", path);
   RecoveryInfo ret;
 
@@ -844,395 +1058,449 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
   // Recover deltas.
   wal.SetPosition(info.offset_deltas);
   uint64_t deltas_applied = 0;
-  auto edge_acc = edges->access();
-  auto vertex_acc = vertices->access();
   spdlog::info("WAL file contains {} deltas.", info.num_deltas);
-  for (uint64_t i = 0; i < info.num_deltas; ++i) {
-    // Read WAL delta header to find out the delta timestamp.
-    auto timestamp = ReadWalDeltaHeader(&wal);
 
-    if (!last_loaded_timestamp || timestamp > *last_loaded_timestamp) {
-      // This delta should be loaded.
-      auto delta = ReadWalDeltaData(&wal);
-      switch (delta.type) {
-        case WalDeltaData::Type::VERTEX_CREATE: {
-          auto [vertex, inserted] = vertex_acc.insert(Vertex{delta.vertex_create_delete.gid, nullptr});
-          if (!inserted) throw RecoveryFailure("The vertex must be inserted here!");
+  auto apply_delta = [&](WalDeltaData &delta, auto &vertex_acc, auto &edge_acc) {
+    switch (delta.type) {
+      case WalDeltaData::Type::VERTEX_CREATE: {
+        auto [vertex, inserted] = vertex_acc.insert(Vertex{delta.vertex_create_delete.gid, nullptr});
+        if (!inserted) throw RecoveryFailure("The vertex must be inserted here!");
 
-          ret.next_vertex_id = std::max(ret.next_vertex_id, delta.vertex_create_delete.gid.AsUint() + 1);
+        ret.next_vertex_id = std::max(ret.next_vertex_id, delta.vertex_create_delete.gid.AsUint() + 1);
 
-          if (schema_info) schema_info->AddVertex(&*vertex);
-          break;
-        }
-        case WalDeltaData::Type::VERTEX_DELETE: {
-          auto vertex = vertex_acc.find(delta.vertex_create_delete.gid);
-          if (vertex == vertex_acc.end()) throw RecoveryFailure("The vertex doesn't exist!");
-          if (!vertex->in_edges.empty() || !vertex->out_edges.empty())
-            throw RecoveryFailure("The vertex can't be deleted because it still has edges!");
+        if (schema_info) schema_info->AddVertex(&*vertex);
+        break;
+      }
+      case WalDeltaData::Type::VERTEX_DELETE: {
+        auto vertex = vertex_acc.find(delta.vertex_create_delete.gid);
+        if (vertex == vertex_acc.end()) throw RecoveryFailure("The vertex doesn't exist!");
+        if (!vertex->in_edges.empty() || !vertex->out_edges.empty())
+          throw RecoveryFailure("The vertex can't be deleted because it still has edges!");
 
-          if (!vertex_acc.remove(delta.vertex_create_delete.gid))
-            throw RecoveryFailure("The vertex must be removed here!");
+        if (!vertex_acc.remove(delta.vertex_create_delete.gid))
+          throw RecoveryFailure("The vertex must be removed here!");
 
-          if (schema_info) schema_info->DeleteVertex(&*vertex);
-          break;
-        }
-        case WalDeltaData::Type::VERTEX_ADD_LABEL:
-        case WalDeltaData::Type::VERTEX_REMOVE_LABEL: {
-          auto vertex = vertex_acc.find(delta.vertex_add_remove_label.gid);
-          if (vertex == vertex_acc.end()) throw RecoveryFailure("The vertex doesn't exist!");
-
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.vertex_add_remove_label.label));
-          auto it = std::find(vertex->labels.begin(), vertex->labels.end(), label_id);
-
-          std::optional<utils::small_vector<LabelId>> old_labels{};
-          if (schema_info) old_labels.emplace(vertex->labels);
-
-          if (delta.type == WalDeltaData::Type::VERTEX_ADD_LABEL) {
-            if (it != vertex->labels.end()) throw RecoveryFailure("The vertex already has the label!");
-            vertex->labels.push_back(label_id);
-          } else {
-            if (it == vertex->labels.end()) throw RecoveryFailure("The vertex doesn't have the label!");
-            std::swap(*it, vertex->labels.back());
-            vertex->labels.pop_back();
-          }
-
-          if (schema_info) schema_info->UpdateLabels(&*vertex, *old_labels, vertex->labels, items.properties_on_edges);
-          break;
+        if (schema_info) schema_info->DeleteVertex(&*vertex);
+        break;
+      }
+      case WalDeltaData::Type::VERTEX_ADD_LABEL:
+      case WalDeltaData::Type::VERTEX_REMOVE_LABEL: {
+        auto vertex = vertex_acc.find(delta.vertex_add_remove_label.gid);
+        if (vertex == vertex_acc.end()) throw RecoveryFailure("The vertex doesn't exist!");
+
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.vertex_add_remove_label.label));
+        auto it = std::find(vertex->labels.begin(), vertex->labels.end(), label_id);
+
+        std::optional<utils::small_vector<LabelId>> old_labels{};
+        if (schema_info) old_labels.emplace(vertex->labels);
+
+        if (delta.type == WalDeltaData::Type::VERTEX_ADD_LABEL) {
+          if (it != vertex->labels.end()) throw RecoveryFailure("The vertex already has the label!");
+          vertex->labels.push_back(label_id);
+        } else {
+          if (it == vertex->labels.end()) throw RecoveryFailure("The vertex doesn't have the label!");
+          std::swap(*it, vertex->labels.back());
+          vertex->labels.pop_back();
         }
-        case WalDeltaData::Type::VERTEX_SET_PROPERTY: {
-          auto vertex = vertex_acc.find(delta.vertex_edge_set_property.gid);
-          if (vertex == vertex_acc.end()) throw RecoveryFailure("The vertex doesn't exist!");
 
-          auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.vertex_edge_set_property.property));
-          auto &property_value = delta.vertex_edge_set_property.value;
+        if (schema_info) schema_info->UpdateLabels(&*vertex, *old_labels, vertex->labels, items.properties_on_edges);
+        break;
+      }
+      case WalDeltaData::Type::VERTEX_SET_PROPERTY: {
+        auto vertex = vertex_acc.find(delta.vertex_edge_set_property.gid);
+        if (vertex == vertex_acc.end()) throw RecoveryFailure("The vertex doesn't exist!");
 
-          if (schema_info) {
-            const auto old_type = vertex->properties.GetExtendedPropertyType(property_id);
-            schema_info->SetProperty(&*vertex, property_id, ExtendedPropertyType{property_value}, old_type);
-          }
+        auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.vertex_edge_set_property.property));
+        auto &property_value = delta.vertex_edge_set_property.value;
 
-          vertex->properties.SetProperty(property_id, property_value);
-          break;
+        if (schema_info) {
+          const auto old_type = vertex->properties.GetExtendedPropertyType(property_id);
+          schema_info->SetProperty(&*vertex, property_id, ExtendedPropertyType{property_value}, old_type);
         }
-        case WalDeltaData::Type::EDGE_CREATE: {
-          auto from_vertex = vertex_acc.find(delta.edge_create_delete.from_vertex);
-          if (from_vertex == vertex_acc.end()) throw RecoveryFailure("The from vertex doesn't exist!");
-          auto to_vertex = vertex_acc.find(delta.edge_create_delete.to_vertex);
-          if (to_vertex == vertex_acc.end()) throw RecoveryFailure("The to vertex doesn't exist!");
-
-          auto edge_gid = delta.edge_create_delete.gid;
-          auto edge_type_id = EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.edge_create_delete.edge_type));
-          EdgeRef edge_ref(edge_gid);
-          if (items.properties_on_edges) {
-            auto [edge, inserted] = edge_acc.insert(Edge{edge_gid, nullptr});
-            if (!inserted) throw RecoveryFailure("The edge must be inserted here!");
-            edge_ref = EdgeRef(&*edge);
-          }
-          {
-            std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*to_vertex, edge_ref};
-            auto it = std::find(from_vertex->out_edges.begin(), from_vertex->out_edges.end(), link);
-            if (it != from_vertex->out_edges.end()) throw RecoveryFailure("The from vertex already has this edge!");
-            from_vertex->out_edges.push_back(link);
-          }
-          {
-            std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*from_vertex, edge_ref};
-            auto it = std::find(to_vertex->in_edges.begin(), to_vertex->in_edges.end(), link);
-            if (it != to_vertex->in_edges.end()) throw RecoveryFailure("The to vertex already has this edge!");
-            to_vertex->in_edges.push_back(link);
-          }
-
-          ret.next_edge_id = std::max(ret.next_edge_id, edge_gid.AsUint() + 1);
 
-          // Increment edge count.
-          edge_count->fetch_add(1, std::memory_order_acq_rel);
-
-          if (schema_info) schema_info->CreateEdge(&*from_vertex, &*to_vertex, edge_type_id);
-          break;
+        vertex->properties.SetProperty(property_id, property_value);
+        break;
+      }
+      case WalDeltaData::Type::EDGE_CREATE: {
+        auto from_vertex = vertex_acc.find(delta.edge_create_delete.from_vertex);
+        if (from_vertex == vertex_acc.end()) throw RecoveryFailure("The from vertex doesn't exist!");
+        auto to_vertex = vertex_acc.find(delta.edge_create_delete.to_vertex);
+        if (to_vertex == vertex_acc.end()) throw RecoveryFailure("The to vertex doesn't exist!");
+
+        auto edge_gid = delta.edge_create_delete.gid;
+        auto edge_type_id = EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.edge_create_delete.edge_type));
+        EdgeRef edge_ref(edge_gid);
+        if (items.properties_on_edges) {
+          auto [edge, inserted] = edge_acc.insert(Edge{edge_gid, nullptr, &*from_vertex});
+          if (!inserted) throw RecoveryFailure("The edge must be inserted here!");
+          edge_ref = EdgeRef(&*edge);
+        }
+        {
+          std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*to_vertex, edge_ref};
+          auto it = FindVertexEdge(&*from_vertex, EdgeDirection::OUT, link);
+          if (it != from_vertex->out_edges.end()) throw RecoveryFailure("The from vertex already has this edge!");
+          AppendVertexEdge(&*from_vertex, EdgeDirection::OUT, link);
+        }
+        {
+          std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*from_vertex, edge_ref};
+          auto it = FindVertexEdge(&*to_vertex, EdgeDirection::IN, link);
+          if (it != to_vertex->in_edges.end()) throw RecoveryFailure("The to vertex already has this edge!");
+          AppendVertexEdge(&*to_vertex, EdgeDirection::IN, link);
         }
-        case WalDeltaData::Type::EDGE_DELETE: {
-          auto from_vertex = vertex_acc.find(delta.edge_create_delete.from_vertex);
-          if (from_vertex == vertex_acc.end()) throw RecoveryFailure("The from vertex doesn't exist!");
-          auto to_vertex = vertex_acc.find(delta.edge_create_delete.to_vertex);
-          if (to_vertex == vertex_acc.end()) throw RecoveryFailure("The to vertex doesn't exist!");
-
-          auto edge_gid = delta.edge_create_delete.gid;
-          auto edge_type_id = EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.edge_create_delete.edge_type));
-          EdgeRef edge_ref(edge_gid);
-          if (items.properties_on_edges) {
-            auto edge = edge_acc.find(edge_gid);
-            if (edge == edge_acc.end()) throw RecoveryFailure("The edge doesn't exist!");
-            edge_ref = EdgeRef(&*edge);
-          }
-          {
-            std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*to_vertex, edge_ref};
-            auto it = std::find(from_vertex->out_edges.begin(), from_vertex->out_edges.end(), link);
-            if (it == from_vertex->out_edges.end()) throw RecoveryFailure("The from vertex doesn't have this edge!");
-            std::swap(*it, from_vertex->out_edges.back());
-            from_vertex->out_edges.pop_back();
-          }
-          {
-            std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*from_vertex, edge_ref};
-            auto it = std::find(to_vertex->in_edges.begin(), to_vertex->in_edges.end(), link);
-            if (it == to_vertex->in_edges.end()) throw RecoveryFailure("The to vertex doesn't have this edge!");
-            std::swap(*it, to_vertex->in_edges.back());
-            to_vertex->in_edges.pop_back();
-          }
-          if (items.properties_on_edges) {
-            if (!edge_acc.remove(edge_gid)) throw RecoveryFailure("The edge must be removed here!");
-          }
 
-          // Decrement edge count.
-          edge_count->fetch_add(-1, std::memory_order_acq_rel);
+        ret.next_edge_id = std::max(ret.next_edge_id, edge_gid.AsUint() + 1);
 
-          if (schema_info)
-            schema_info->DeleteEdge(edge_type_id, edge_ref, &*from_vertex, &*to_vertex, items.properties_on_edges);
-          break;
-        }
-        case WalDeltaData::Type::EDGE_SET_PROPERTY: {
-          if (!items.properties_on_edges)
-            throw RecoveryFailure(
-                "The WAL has properties on edges, but the storage is "
-                "configured without properties on edges!");
-          auto edge = edge_acc.find(delta.vertex_edge_set_property.gid);
-          if (edge == edge_acc.end()) throw RecoveryFailure("The edge doesn't exist!");
-          auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.vertex_edge_set_property.property));
-          auto &property_value = delta.vertex_edge_set_property.value;
-
-          // TODO Add edge set property delta to WAL
-          if (schema_info) {
-            const auto old_type = edge->properties.GetExtendedPropertyType(property_id);
-            const auto maybe_edge = find_edge(edge->gid);
-            if (!maybe_edge) throw RecoveryFailure("Recovery failed, edge not found.");
-            const auto &[edge_ref, edge_type, from, to] = *maybe_edge;
-            schema_info->SetProperty(edge_type, from, to, property_id, ExtendedPropertyType{property_value}, old_type,
-                                     items.properties_on_edges);
-          }
+        // Increment edge count.
+        edge_count->fetch_add(1, std::memory_order_acq_rel);
 
-          edge->properties.SetProperty(property_id, property_value);
-          break;
-        }
-        case WalDeltaData::Type::TRANSACTION_END: {
-          break;
-        }
-        case WalDeltaData::Type::LABEL_INDEX_CREATE: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label.label));
-          AddRecoveredIndexConstraint(&indices_constraints->indices.label, label_id, "The label index already exists!");
-          break;
-        }
-        case WalDeltaData::Type::LABEL_INDEX_DROP: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label.label));
-          RemoveRecoveredIndexConstraint(&indices_constraints->indices.label, label_id,
-                                         "The label index doesn't exist!");
-          break;
-        }
-        case WalDeltaData::Type::EDGE_INDEX_CREATE: {
-          auto edge_type_id = EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type.edge_type));
-          AddRecoveredIndexConstraint(&indices_constraints->indices.edge, edge_type_id,
-                                      "The edge-type index already exists!");
-          break;
-        }
-        case WalDeltaData::Type::EDGE_INDEX_DROP: {
-          auto edge_type_id = EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type.edge_type));
-          RemoveRecoveredIndexConstraint(&indices_constraints->indices.edge, edge_type_id,
-                                         "The edge-type index doesn't exist!");
-          break;
-        }
-        case WalDeltaData::Type::EDGE_PROPERTY_INDEX_CREATE: {
-          auto edge_type_id =
-              EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type_property.edge_type));
-          auto property_id =
-              PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type_property.property));
-          AddRecoveredIndexConstraint(&indices_constraints->indices.edge_property, {edge_type_id, property_id},
-                                      "The edge-type + property index already exists!");
-          break;
-        }
-        case WalDeltaData::Type::EDGE_PROPERTY_INDEX_DROP: {
-          auto edge_type_id =
-              EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type_property.edge_type));
-          auto property_id =
-              PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type_property.property));
-          RemoveRecoveredIndexConstraint(&indices_constraints->indices.edge_property, {edge_type_id, property_id},
-                                         "The edge-type + property index doesn't exist!");
-          break;
-        }
-        case WalDeltaData::Type::LABEL_INDEX_STATS_SET: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_stats.label));
-          LabelIndexStats stats{};
-          if (!FromJson(delta.operation_label_stats.stats, stats)) {
-            throw RecoveryFailure("Failed to read statistics!");
-          }
-          indices_constraints->indices.label_stats.emplace_back(label_id, stats);
-          break;
-        }
-        case WalDeltaData::Type::LABEL_INDEX_STATS_CLEAR: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label.label));
-          RemoveRecoveredIndexStats(&indices_constraints->indices.label_stats, label_id,
-                                    "The label index stats doesn't exist!");
-          break;
-        }
-        case WalDeltaData::Type::LABEL_PROPERTY_INDEX_CREATE: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
-          auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
-          AddRecoveredIndexConstraint(&indices_constraints->indices.label_property, {label_id, property_id},
-                                      "The label property index already exists!");
-          break;
-        }
-        case WalDeltaData::Type::LABEL_PROPERTY_INDEX_DROP: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
-          auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
-          RemoveRecoveredIndexConstraint(&indices_constraints->indices.label_property, {label_id, property_id},
-                                         "The label property index doesn't exist!");
-          break;
+        if (schema_info) schema_info->CreateEdge(&*from_vertex, &*to_vertex, edge_type_id);
+        break;
+      }
+      case WalDeltaData::Type::EDGE_DELETE: {
+        auto from_vertex = vertex_acc.find(delta.edge_create_delete.from_vertex);
+        if (from_vertex == vertex_acc.end()) throw RecoveryFailure("The from vertex doesn't exist!");
+        auto to_vertex = vertex_acc.find(delta.edge_create_delete.to_vertex);
+        if (to_vertex == vertex_acc.end()) throw RecoveryFailure("The to vertex doesn't exist!");
+
+        auto edge_gid = delta.edge_create_delete.gid;
+        auto edge_type_id = EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.edge_create_delete.edge_type));
+        EdgeRef edge_ref(edge_gid);
+        if (items.properties_on_edges) {
+          auto edge = edge_acc.find(edge_gid);
+          if (edge == edge_acc.end()) throw RecoveryFailure("The edge doesn't exist!");
+          edge_ref = EdgeRef(&*edge);
         }
-        case WalDeltaData::Type::POINT_INDEX_CREATE: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
-          auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
-          AddRecoveredIndexConstraint(&indices_constraints->indices.point_label_property, {label_id, property_id},
-                                      "The label property index already exists!");
-          break;
+        {
+          std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*to_vertex, edge_ref};
+          auto it = FindVertexEdge(&*from_vertex, EdgeDirection::OUT, link);
+          if (it == from_vertex->out_edges.end()) throw RecoveryFailure("The from vertex doesn't have this edge!");
+          RemoveVertexEdge(&*from_vertex, EdgeDirection::OUT, it);
         }
-        case WalDeltaData::Type::POINT_INDEX_DROP: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
-          auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
-          RemoveRecoveredIndexConstraint(&indices_constraints->indices.point_label_property, {label_id, property_id},
-                                         "The label property index doesn't exist!");
-          break;
+        {
+          std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{edge_type_id, &*from_vertex, edge_ref};
+          auto it = FindVertexEdge(&*to_vertex, EdgeDirection::IN, link);
+          if (it == to_vertex->in_edges.end()) throw RecoveryFailure("The to vertex doesn't have this edge!");
+          RemoveVertexEdge(&*to_vertex, EdgeDirection::IN, it);
         }
-        case WalDeltaData::Type::LABEL_PROPERTY_INDEX_STATS_SET: {
-          auto &info = delta.operation_label_property_stats;
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(info.label));
-          auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(info.property));
-          LabelPropertyIndexStats stats{};
-          if (!FromJson(info.stats, stats)) {
-            throw RecoveryFailure("Failed to read statistics!");
-          }
-          indices_constraints->indices.label_property_stats.emplace_back(label_id, std::make_pair(property_id, stats));
-          break;
+        if (items.properties_on_edges) {
+          if (!edge_acc.remove(edge_gid)) throw RecoveryFailure("The edge must be removed here!");
         }
-        case WalDeltaData::Type::LABEL_PROPERTY_INDEX_STATS_CLEAR: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label.label));
-          RemoveRecoveredIndexStats(&indices_constraints->indices.label_property_stats, label_id,
-                                    "The label index stats doesn't exist!");
-          break;
-        }
-        case WalDeltaData::Type::TEXT_INDEX_CREATE: {
-          auto index_name = delta.operation_text.index_name;
-          auto label = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_text.label));
-          AddRecoveredIndexConstraint(&indices_constraints->indices.text_indices, {index_name, label},
-                                      "The text index already exists!");
-          break;
+
+        // Decrement edge count.
+        edge_count->fetch_add(-1, std::memory_order_acq_rel);
+
+        if (schema_info)
+          schema_info->DeleteEdge(edge_type_id, edge_ref, &*from_vertex, &*to_vertex, items.properties_on_edges);
+        break;
+      }
+      case WalDeltaData::Type::EDGE_SET_PROPERTY: {
+        if (!items.properties_on_edges)
+          throw RecoveryFailure(
+              "The WAL has properties on edges, but the storage is "
+              "configured without properties on edges!");
+        auto edge = edge_acc.find(delta.vertex_edge_set_property.gid);
+        if (edge == edge_acc.end()) throw RecoveryFailure("The edge doesn't exist!");
+        auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.vertex_edge_set_property.property));
+        auto &property_value = delta.vertex_edge_set_property.value;
+
+        // TODO Add edge set property delta to WAL
+        if (schema_info) {
+          const auto old_type = edge->properties.GetExtendedPropertyType(property_id);
+          const auto maybe_edge = find_edge(edge->gid);
+          if (!maybe_edge) throw RecoveryFailure("Recovery failed, edge not found.");
+          const auto &[edge_ref, edge_type, from, to] = *maybe_edge;
+          schema_info->SetProperty(edge_type, from, to, property_id, ExtendedPropertyType{property_value}, old_type,
+                                   items.properties_on_edges);
         }
-        case WalDeltaData::Type::TEXT_INDEX_DROP: {
-          auto index_name = delta.operation_text.index_name;
-          auto label = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_text.label));
-          RemoveRecoveredIndexConstraint(&indices_constraints->indices.text_indices, {index_name, label},
-                                         "The text index doesn't exist!");
-          break;
+
+        edge->properties.SetProperty(property_id, property_value);
+        break;
+      }
+      case WalDeltaData::Type::TRANSACTION_END: {
+        break;
+      }
+      case WalDeltaData::Type::LABEL_INDEX_CREATE: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label.label));
+        AddRecoveredIndexConstraint(&indices_constraints->indices.label, label_id, "The label index already exists!");
+        break;
+      }
+      case WalDeltaData::Type::LABEL_INDEX_DROP: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label.label));
+        RemoveRecoveredIndexConstraint(&indices_constraints->indices.label, label_id,
+                                       "The label index doesn't exist!");
+        break;
+      }
+      case WalDeltaData::Type::EDGE_INDEX_CREATE: {
+        auto edge_type_id = EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type.edge_type));
+        AddRecoveredIndexConstraint(&indices_constraints->indices.edge, edge_type_id,
+                                    "The edge-type index already exists!");
+        break;
+      }
+      case WalDeltaData::Type::EDGE_INDEX_DROP: {
+        auto edge_type_id = EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type.edge_type));
+        RemoveRecoveredIndexConstraint(&indices_constraints->indices.edge, edge_type_id,
+                                       "The edge-type index doesn't exist!");
+        break;
+      }
+      case WalDeltaData::Type::EDGE_PROPERTY_INDEX_CREATE: {
+        auto edge_type_id =
+            EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type_property.edge_type));
+        auto property_id =
+            PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type_property.property));
+        AddRecoveredIndexConstraint(&indices_constraints->indices.edge_property, {edge_type_id, property_id},
+                                    "The edge-type + property index already exists!");
+        break;
+      }
+      case WalDeltaData::Type::EDGE_PROPERTY_INDEX_DROP: {
+        auto edge_type_id =
+            EdgeTypeId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type_property.edge_type));
+        auto property_id =
+            PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_edge_type_property.property));
+        RemoveRecoveredIndexConstraint(&indices_constraints->indices.edge_property, {edge_type_id, property_id},
+                                       "The edge-type + property index doesn't exist!");
+        break;
+      }
+      case WalDeltaData::Type::LABEL_INDEX_STATS_SET: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_stats.label));
+        LabelIndexStats stats{};
+        if (!FromJson(delta.operation_label_stats.stats, stats)) {
+          throw RecoveryFailure("Failed to read statistics!");
         }
-        case WalDeltaData::Type::EXISTENCE_CONSTRAINT_CREATE: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
-          auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
-          AddRecoveredIndexConstraint(&indices_constraints->constraints.existence, {label_id, property_id},
-                                      "The existence constraint already exists!");
-          break;
+        indices_constraints->indices.label_stats.emplace_back(label_id, stats);
+        break;
+      }
+      case WalDeltaData::Type::LABEL_INDEX_STATS_CLEAR: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label.label));
+        RemoveRecoveredIndexStats(&indices_constraints->indices.label_stats, label_id,
+                                  "The label index stats doesn't exist!");
+        break;
+      }
+      case WalDeltaData::Type::LABEL_PROPERTY_INDEX_CREATE: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
+        auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
+        AddRecoveredIndexConstraint(&indices_constraints->indices.label_property, {label_id, property_id},
+                                    "The label property index already exists!");
+        break;
+      }
+      case WalDeltaData::Type::LABEL_PROPERTY_INDEX_DROP: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
+        auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
+        RemoveRecoveredIndexConstraint(&indices_constraints->indices.label_property, {label_id, property_id},
+                                       "The label property index doesn't exist!");
+        break;
+      }
+      case WalDeltaData::Type::POINT_INDEX_CREATE: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
+        auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
+        AddRecoveredIndexConstraint(&indices_constraints->indices.point_label_property, {label_id, property_id},
+                                    "The label property index already exists!");
+        break;
+      }
+      case WalDeltaData::Type::POINT_INDEX_DROP: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
+        auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
+        RemoveRecoveredIndexConstraint(&indices_constraints->indices.point_label_property, {label_id, property_id},
+                                       "The label property index doesn't exist!");
+        break;
+      }
+      case WalDeltaData::Type::VECTOR_INDEX_CREATE: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_vector_index.label));
+        auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_vector_index.property));
+        auto &vector_indices = indices_constraints->indices.vector_indices;
+        if (std::ranges::any_of(vector_indices, [&](auto const &spec) {
+              return spec.label == label_id && spec.property == property_id;
+            })) {
+          throw RecoveryFailure("The vector index already exists!");
         }
-        case WalDeltaData::Type::EXISTENCE_CONSTRAINT_DROP: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
-          auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
-          RemoveRecoveredIndexConstraint(&indices_constraints->constraints.existence, {label_id, property_id},
-                                         "The existence constraint doesn't exist!");
-          break;
+        vector_indices.push_back({label_id, property_id, delta.operation_vector_index.dimension});
+        break;
+      }
+      case WalDeltaData::Type::VECTOR_INDEX_DROP: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
+        auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
+        // The drop doesn't carry the dimension, so the spec is looked up by its key.
+        auto &vector_indices = indices_constraints->indices.vector_indices;
+        auto it = std::ranges::find_if(vector_indices, [&](auto const &spec) {
+          return spec.label == label_id && spec.property == property_id;
+        });
+        if (it == vector_indices.end()) throw RecoveryFailure("The vector index doesn't exist!");
+        vector_indices.erase(it);
+        break;
+      }
+      case WalDeltaData::Type::LABEL_PROPERTY_INDEX_STATS_SET: {
+        auto &info = delta.operation_label_property_stats;
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(info.label));
+        auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(info.property));
+        LabelPropertyIndexStats stats{};
+        if (!FromJson(info.stats, stats)) {
+          throw RecoveryFailure("Failed to read statistics!");
         }
-        case WalDeltaData::Type::UNIQUE_CONSTRAINT_CREATE: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_properties.label));
-          std::set<PropertyId> property_ids;
-          for (const auto &prop : delta.operation_label_properties.properties) {
-            property_ids.insert(PropertyId::FromUint(name_id_mapper->NameToId(prop)));
-          }
-          AddRecoveredIndexConstraint(&indices_constraints->constraints.unique, {label_id, property_ids},
-                                      "The unique constraint already exists!");
-          break;
+        indices_constraints->indices.label_property_stats.emplace_back(label_id, std::make_pair(property_id, stats));
+        break;
+      }
+      case WalDeltaData::Type::LABEL_PROPERTY_INDEX_STATS_CLEAR: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label.label));
+        RemoveRecoveredIndexStats(&indices_constraints->indices.label_property_stats, label_id,
+                                  "The label index stats doesn't exist!");
+        break;
+      }
+      case WalDeltaData::Type::TEXT_INDEX_CREATE: {
+        auto index_name = delta.operation_text.index_name;
+        auto label = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_text.label));
+        AddRecoveredIndexConstraint(&indices_constraints->indices.text_indices, {index_name, label},
+                                    "The text index already exists!");
+        break;
+      }
+      case WalDeltaData::Type::TEXT_INDEX_DROP: {
+        auto index_name = delta.operation_text.index_name;
+        auto label = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_text.label));
+        RemoveRecoveredIndexConstraint(&indices_constraints->indices.text_indices, {index_name, label},
+                                       "The text index doesn't exist!");
+        break;
+      }
+      case WalDeltaData::Type::EXISTENCE_CONSTRAINT_CREATE: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
+        auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
+        AddRecoveredIndexConstraint(&indices_constraints->constraints.existence, {label_id, property_id},
+                                    "The existence constraint already exists!");
+        break;
+      }
+      case WalDeltaData::Type::EXISTENCE_CONSTRAINT_DROP: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.label));
+        auto property_id = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property.property));
+        RemoveRecoveredIndexConstraint(&indices_constraints->constraints.existence, {label_id, property_id},
+                                       "The existence constraint doesn't exist!");
+        break;
+      }
+      case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property_list.label));
+        std::vector<PropertyId> property_ids;
+        property_ids.reserve(delta.operation_label_property_list.properties.size());
+        for (const auto &prop : delta.operation_label_property_list.properties) {
+          property_ids.push_back(PropertyId::FromUint(name_id_mapper->NameToId(prop)));
         }
-        case WalDeltaData::Type::UNIQUE_CONSTRAINT_DROP: {
-          auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_properties.label));
-          std::set<PropertyId> property_ids;
-          for (const auto &prop : delta.operation_label_properties.properties) {
-            property_ids.insert(PropertyId::FromUint(name_id_mapper->NameToId(prop)));
-          }
-          RemoveRecoveredIndexConstraint(&indices_constraints->constraints.unique, {label_id, property_ids},
-                                         "The unique constraint doesn't exist!");
-          break;
+        AddRecoveredIndexConstraint(&indices_constraints->indices.label_property_composite,
+                                    {label_id, std::move(property_ids)}, "The composite index already exists!");
+        break;
+      }
+      case WalDeltaData::Type::LABEL_PROPERTY_COMPOSITE_INDEX_DROP: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property_list.label));
+        std::vector<PropertyId> property_ids;
+        property_ids.reserve(delta.operation_label_property_list.properties.size());
+        for (const auto &prop : delta.operation_label_property_list.properties) {
+          property_ids.push_back(PropertyId::FromUint(name_id_mapper->NameToId(prop)));
         }
-        case WalDeltaData::Type::TYPE_CONSTRAINT_CREATE: {
-          auto label = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property_type.label));
-          auto property = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property_type.property));
-          auto type = static_cast<TypeConstraintKind>(delta.operation_label_property_type.type);
-          AddRecoveredIndexConstraint(&indices_constraints->constraints.type, {label, property, type},
-                                      "The type constraint already exists!");
-          break;
+        RemoveRecoveredIndexConstraint(&indices_constraints->indices.label_property_composite,
+                                       {label_id, std::move(property_ids)}, "The composite index doesn't exist!");
+        break;
+      }
+      case WalDeltaData::Type::UNIQUE_CONSTRAINT_CREATE: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_properties.label));
+        std::set<PropertyId> property_ids;
+        for (const auto &prop : delta.operation_label_properties.properties) {
+          property_ids.insert(PropertyId::FromUint(name_id_mapper->NameToId(prop)));
         }
-        case WalDeltaData::Type::TYPE_CONSTRAINT_DROP: {
-          auto label = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property_type.label));
-          auto property = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property_type.property));
-          auto type = static_cast<TypeConstraintKind>(delta.operation_label_property_type.type);
-          RemoveRecoveredIndexConstraint(&indices_constraints->constraints.type, {label, property, type},
-                                         "The type constraint doesn't exist!");
-          break;
+        AddRecoveredIndexConstraint(&indices_constraints->constraints.unique, {label_id, property_ids},
+                                    "The unique constraint already exists!");
+        break;
+      }
+      case WalDeltaData::Type::UNIQUE_CONSTRAINT_DROP: {
+        auto label_id = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_properties.label));
+        std::set<PropertyId> property_ids;
+        for (const auto &prop : delta.operation_label_properties.properties) {
+          property_ids.insert(PropertyId::FromUint(name_id_mapper->NameToId(prop)));
         }
-        case WalDeltaData::Type::ENUM_CREATE: {
-          auto res = enum_store->RegisterEnum(delta.operation_enum_create.etype, delta.operation_enum_create.evalues);
-          if (res.HasError()) {
-            switch (res.GetError()) {
-              case EnumStorageError::EnumExists:
-                throw RecoveryFailure("The enum already exist!");
-              case EnumStorageError::InvalidValue:
-                throw RecoveryFailure("The enum has invalid values!");
-              default:
-                // Should not happen
-                throw RecoveryFailure("The enum could not be registered!");
-            }
+        RemoveRecoveredIndexConstraint(&indices_constraints->constraints.unique, {label_id, property_ids},
+                                       "The unique constraint doesn't exist!");
+        break;
+      }
+      case WalDeltaData::Type::TYPE_CONSTRAINT_CREATE: {
+        auto label = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property_type.label));
+        auto property = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property_type.property));
+        auto type = static_cast<TypeConstraintKind>(delta.operation_label_property_type.type);
+        AddRecoveredIndexConstraint(&indices_constraints->constraints.type, {label, property, type},
+                                    "The type constraint already exists!");
+        break;
+      }
+      case WalDeltaData::Type::TYPE_CONSTRAINT_DROP: {
+        auto label = LabelId::FromUint(name_id_mapper->NameToId(delta.operation_label_property_type.label));
+        auto property = PropertyId::FromUint(name_id_mapper->NameToId(delta.operation_label_property_type.property));
+        auto type = static_cast<TypeConstraintKind>(delta.operation_label_property_type.type);
+        RemoveRecoveredIndexConstraint(&indices_constraints->constraints.type, {label, property, type},
+                                       "The type constraint doesn't exist!");
+        break;
+      }
+      case WalDeltaData::Type::ENUM_CREATE: {
+        auto res = enum_store->RegisterEnum(delta.operation_enum_create.etype, delta.operation_enum_create.evalues);
+        if (res.HasError()) {
+          switch (res.GetError()) {
+            case EnumStorageError::EnumExists:
+              throw RecoveryFailure("The enum already exist!");
+            case EnumStorageError::InvalidValue:
+              throw RecoveryFailure("The enum has invalid values!");
+            default:
+              // Should not happen
+              throw RecoveryFailure("The enum could not be registered!");
           }
-          break;
         }
-        case WalDeltaData::Type::ENUM_ALTER_ADD: {
-          auto res = enum_store->AddValue(delta.operation_enum_alter_add.etype, delta.operation_enum_alter_add.evalue);
-          if (res.HasError()) {
-            switch (res.GetError()) {
-              case storage::EnumStorageError::InvalidValue:
-                throw RecoveryFailure("Enum value already exists.");
-              case storage::EnumStorageError::UnknownEnumType:
-                throw RecoveryFailure("Unknown Enum type.");
-              default:
-                // Should not happen
-                throw RecoveryFailure("Enum could not be altered.");
-            }
+        break;
+      }
+      case WalDeltaData::Type::ENUM_ALTER_ADD: {
+        auto res = enum_store->AddValue(delta.operation_enum_alter_add.etype, delta.operation_enum_alter_add.evalue);
+        if (res.HasError()) {
+          switch (res.GetError()) {
+            case storage::EnumStorageError::InvalidValue:
+              throw RecoveryFailure("Enum value already exists.");
+            case storage::EnumStorageError::UnknownEnumType:
+              throw RecoveryFailure("Unknown Enum type.");
+            default:
+              // Should not happen
+              throw RecoveryFailure("Enum could not be altered.");
           }
-          break;
         }
-        case WalDeltaData::Type::ENUM_ALTER_UPDATE: {
-          auto const &[enum_name, enum_value_old, enum_value_new] = delta.operation_enum_alter_update;
-          auto res = enum_store->UpdateValue(enum_name, enum_value_old, enum_value_new);
-          if (res.HasError()) {
-            switch (res.GetError()) {
-              case storage::EnumStorageError::InvalidValue:
-                throw RecoveryFailure("Enum value {}::{} already exists.", enum_name, enum_value_new);
-              case storage::EnumStorageError::UnknownEnumType:
-                throw RecoveryFailure("Unknown Enum name {}.", enum_name);
-              case storage::EnumStorageError::UnknownEnumValue:
-                throw RecoveryFailure("Unknown Enum value {}::{}.", enum_name, enum_value_old);
-              default:
-                // Should not happen
-                throw RecoveryFailure("Enum could not be altered.");
-            }
+        break;
+      }
+      case WalDeltaData::Type::ENUM_ALTER_UPDATE: {
+        auto const &[enum_name, enum_value_old, enum_value_new] = delta.operation_enum_alter_update;
+        auto res = enum_store->UpdateValue(enum_name, enum_value_old, enum_value_new);
+        if (res.HasError()) {
+          switch (res.GetError()) {
+            case storage::EnumStorageError::InvalidValue:
+              throw RecoveryFailure("Enum value {}::{} already exists.", enum_name, enum_value_new);
+            case storage::EnumStorageError::UnknownEnumType:
+              throw RecoveryFailure("Unknown Enum name {}.", enum_name);
+            case storage::EnumStorageError::UnknownEnumValue:
+              throw RecoveryFailure("Unknown Enum value {}::{}.", enum_name, enum_value_old);
+            default:
+              // Should not happen
+              throw RecoveryFailure("Enum could not be altered.");
           }
-          break;
         }
+        break;
+      }
+    }
+  };
+
+  if (parallel_exec_info && parallel_exec_info->thread_count > 1 && !schema_info) {
+    deltas_applied = ApplyWalDeltasInParallel(&wal, info.num_deltas, last_loaded_timestamp, *parallel_exec_info,
+                                              vertices, edges, &ret, apply_delta);
+  } else {
+    auto edge_acc = edges->access();
+    auto vertex_acc = vertices->access();
+    for (uint64_t i = 0; i < info.num_deltas; ++i) {
+      // Read WAL delta header to find out the delta timestamp.
+      auto timestamp = ReadWalDeltaHeader(&wal);
+
+      if (!last_loaded_timestamp || timestamp > *last_loaded_timestamp) {
+        // This delta should be loaded.
+        auto delta = ReadWalDeltaData(&wal);
+        apply_delta(delta, vertex_acc, edge_acc);
+        ret.next_timestamp = std::max(ret.next_timestamp, timestamp + 1);
+        ++deltas_applied;
+      } else {
+        // This delta should be skipped.
+        SkipWalDeltaData(&wal);
       }
-      ret.next_timestamp = std::max(ret.next_timestamp, timestamp + 1);
-      ++deltas_applied;
-    } else {
-      // This delta should be skipped.
-      SkipWalDeltaData(&wal);
     }
   }
 
@@ -1244,7 +1512,7 @@ RecoveryInfo LoadWal(const std::filesystem::path &path, RecoveredIndicesAndConst
 
 WalFile::WalFile(const std::filesystem::path &wal_directory, utils::UUID const &uuid, const std::string_view epoch_id,
                  SalientConfig::Items items, NameIdMapper *name_id_mapper, uint64_t seq_num,
-                 utils::FileRetainer *file_retainer)
+                 utils::FileRetainer *file_retainer, uint64_t preallocate_size)
     : items_(items),
       name_id_mapper_(name_id_mapper),
       path_(wal_directory / MakeWalName()),
@@ -1258,6 +1526,9 @@ WalFile::WalFile(const std::filesystem::path &wal_directory, utils::UUID const &
 
   // Initialize the WAL file.
   wal_.Initialize(path_, kWalMagic, kVersion);
+  if (preallocate_size > 0 && !wal_.Preallocate(preallocate_size)) {
+    spdlog::trace("Couldn't preallocate {} bytes for the WAL file {}.", preallocate_size, path_);
+  }
 
   // Write placeholder offsets.
   uint64_t offset_offsets = 0;
@@ -1302,12 +1573,20 @@ WalFile::WalFile(std::filesystem::path current_wal_path, SalientConfig::Items it
 
 void WalFile::FinalizeWal() {
   if (count_ != 0) {
+    // A finalized WAL file is only read by recovery and by the replicas which
+    // are behind, its pages would push out the ones the queries read.
+    wal_.Sync();
+    wal_.DropPageCache();
     wal_.Finalize();
-    // Rename file.
+    // Rename file. The old name is removed through the retainer because it
+    // could still be read, a hard link gives the file its new name without
+    // copying it.
     std::filesystem::path new_path(path_);
     new_path.replace_filename(RemakeWalName(path_.filename(), from_timestamp_, to_timestamp_));
 
-    utils::CopyFile(path_, new_path);
+    if (!utils::LinkFile(path_, new_path)) {
+      utils::CopyFile(path_, new_path);
+    }
     wal_.Close();
     file_retainer_->DeleteFile(path_);
     path_ = std::move(new_path);
@@ -1433,6 +1712,15 @@ void EncodeLabelProperties(BaseEncoder &encoder, NameIdMapper &name_id_mapper, L
   }
 }
 
+void EncodeLabelPropertyList(BaseEncoder &encoder, NameIdMapper &name_id_mapper, LabelId label,
+                             std::vector<PropertyId> const &properties) {
+  encoder.WriteString(name_id_mapper.IdToName(label.AsUint()));
+  encoder.WriteUint(properties.size());
+  for (const auto &property : properties) {
+    encoder.WriteString(name_id_mapper.IdToName(property.AsUint()));
+  }
+}
+
 void EncodeTypeConstraint(BaseEncoder &encoder, NameIdMapper &name_id_mapper, LabelId label, PropertyId property,
                           TypeConstraintKind type) {
   encoder.WriteString(name_id_mapper.IdToName(label.AsUint()));
@@ -1446,6 +1734,12 @@ void EncodeTextIndex(BaseEncoder &encoder, NameIdMapper &name_id_mapper, std::st
   encoder.WriteString(name_id_mapper.IdToName(label.AsUint()));
 }
 
+void EncodeVectorIndex(BaseEncoder &encoder, NameIdMapper &name_id_mapper, VectorIndexSpec const &spec) {
+  encoder.WriteString(name_id_mapper.IdToName(spec.label.AsUint()));
+  encoder.WriteString(name_id_mapper.IdToName(spec.property.AsUint()));
+  encoder.WriteUint(spec.dimension);
+}
+
 void EncodeOperationPreamble(BaseEncoder &encoder, StorageMetadataOperation Op, uint64_t timestamp) {
   encoder.WriteMarker(Marker::SECTION_DELTA);
   encoder.WriteUint(timestamp);
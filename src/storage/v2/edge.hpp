@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <limits>
 
 #include "storage/v2/delta.hpp"
@@ -24,25 +26,89 @@ namespace memgraph::storage {
 struct Vertex;
 
 struct Edge {
-  Edge(Gid gid, Delta *delta) : gid(gid), deleted(false), delta(delta) {
+  Edge(Gid gid, Delta *delta, Vertex *from_vertex = nullptr) : gid(gid), deleted(false), delta(delta) {
     MG_ASSERT(delta == nullptr || delta->action == Delta::Action::DELETE_OBJECT ||
                   delta->action == Delta::Action::DELETE_DESERIALIZED_OBJECT,
               "Edge must be created with an initial DELETE_OBJECT delta!");
+    SetFromVertexHint(from_vertex);
   }
 
+#ifndef MG_COMPACT_EDGES
+  /// Returns the vertex the edge goes out of, or null if it isn't known, e.g.
+  /// for recovered edges which weren't looked up by gid yet. Has to be called
+  /// while holding the lock of the edge if the edge is shared.
+  Vertex *FromVertexHint() const {
+    uint64_t address = 0;
+    for (auto i = 0U; i < from_vertex_hint_.size(); ++i) address |= uint64_t{from_vertex_hint_[i]} << (8 * i);
+    return reinterpret_cast<Vertex *>(address);  // NOLINT(performance-no-int-to-ptr)
+  }
+
+  /// Records @p from_vertex for `FromVertexHint`, unless its address doesn't
+  /// fit in the 48 bits of the hint. Has to be called while holding the unique
+  /// lock of the edge if the edge is shared.
+  void SetFromVertexHint(Vertex *from_vertex) {
+    auto const address = reinterpret_cast<uint64_t>(from_vertex);
+    if (address >> (8 * from_vertex_hint_.size()) != 0) return;
+    for (auto i = 0U; i < from_vertex_hint_.size(); ++i) from_vertex_hint_[i] = (address >> (8 * i)) & 0xFF;
+  }
+#else
+  Vertex *FromVertexHint() const { return nullptr; }
+  void SetFromVertexHint(Vertex * /*from_vertex*/) {}
+#endif
+
   Gid gid;
 
   PropertyStore properties;
 
-  mutable utils::RWSpinLock lock;
+#ifndef MG_COMPACT_EDGES
+  // Use `EdgeLock` to get the lock of an edge.
+  mutable utils::RWSpinLock lock{utils::LockSite::EDGE};
+#endif
   bool deleted;
+#ifndef MG_COMPACT_EDGES
+  // The low 48 bits of the address of the vertex the edge goes out of, which
+  // lets finding an edge by gid skip the scan of all vertices. Stored in the
+  // padding after `deleted` so it doesn't grow the edge.
+  std::array<uint8_t, 6> from_vertex_hint_{};
+  // uint8_t PAD;
+#else
   // uint8_t PAD;
   // uint16_t PAD;
+#endif
 
   Delta *delta;
 };
 
 static_assert(alignof(Edge) >= 8, "The Edge should be aligned to at least 8!");
+#ifdef MG_COMPACT_EDGES
+static_assert(sizeof(Edge) == 32, "If this changes documentation needs changing");
+#elif !defined(MG_LOCK_CONTENTION_TRACKING)
+static_assert(sizeof(Edge) == 40, "If this changes documentation needs changing");
+#endif
+
+#ifdef MG_COMPACT_EDGES
+/// Number of locks shared by all edges when the edges don't embed a lock.
+inline constexpr uint64_t kEdgeLockStripes = 4096;
+
+/// Returns the lock guarding `edge`. With `MG_COMPACT_EDGES` the lock is
+/// taken from a table of striped locks keyed by the gid, which saves 8 bytes
+/// per edge. Because different edges share a stripe, a thread must never hold
+/// the locks of two edges at the same time, and it must lock the vertices of an
+/// edge before the edge, never a vertex while it holds the lock of an edge:
+/// otherwise two threads could each hold a vertex and a stripe the other waits for.
+inline utils::RWSpinLock &EdgeLock(Edge const *edge) {
+  struct alignas(64) Stripe {
+    utils::RWSpinLock lock{utils::LockSite::EDGE};
+  };
+  static std::array<Stripe, kEdgeLockStripes> stripes;
+  return stripes[edge->gid.AsUint() % kEdgeLockStripes].lock;
+}
+#else
+/// Returns the lock guarding `edge`. A thread must never hold the locks of two
+/// edges at the same time and must lock the vertices of an edge before the edge,
+/// see `MG_COMPACT_EDGES`.
+inline utils::RWSpinLock &EdgeLock(Edge const *edge) { return edge->lock; }
+#endif
 
 inline bool operator==(const Edge &first, const Edge &second) { return first.gid == second.gid; }
 inline bool operator<(const Edge &first, const Edge &second) { return first.gid < second.gid; }
@@ -25,6 +25,7 @@
 #include "storage/v2/vertex_accessor.hpp"
 #include "utils/atomic_memory_block.hpp"
 #include "utils/memory_tracker.hpp"
+#include "utils/prefetch.hpp"
 
 namespace memgraph::storage {
 std::optional<EdgeAccessor> EdgeAccessor::Create(EdgeRef edge, EdgeTypeId edge_type, Vertex *from_vertex,
@@ -126,7 +127,7 @@ bool EdgeAccessor::IsVisible(const View view) const {
     bool deleted = true;
     Delta *delta = nullptr;
     {
-      auto guard = std::shared_lock{edge_.ptr->lock};
+      auto guard = std::shared_lock{EdgeLock(edge_.ptr)};
       deleted = edge_.ptr->deleted;
       delta = edge_.ptr->delta;
     }
@@ -179,6 +180,12 @@ VertexAccessor EdgeAccessor::FromVertex() const { return VertexAccessor{from_ver
 
 VertexAccessor EdgeAccessor::ToVertex() const { return VertexAccessor{to_vertex_, storage_, transaction_}; }
 
+void EdgeAccessor::Prefetch() const {
+  utils::PrefetchObject(from_vertex_);
+  utils::PrefetchObject(to_vertex_);
+  if (storage_->config_.salient.items.properties_on_edges) utils::PrefetchObject(edge_.ptr);
+}
+
 VertexAccessor EdgeAccessor::DeletedEdgeFromVertex() const {
   return VertexAccessor{from_vertex_, storage_, transaction_, for_deleted_ && from_vertex_->deleted};
 }
@@ -193,7 +200,7 @@ Result<storage::PropertyValue> EdgeAccessor::SetProperty(PropertyId property, co
 
   // This needs to happen before locking the object
   auto schema_acc = storage_->SchemaInfoUniqueAccessor();
-  auto guard = std::unique_lock{edge_.ptr->lock};
+  auto guard = std::unique_lock{EdgeLock(edge_.ptr)};
 
   if (!PrepareForWrite(transaction_, edge_.ptr)) return Error::SERIALIZATION_ERROR;
 
@@ -236,7 +243,7 @@ Result<bool> EdgeAccessor::InitProperties(const std::map<storage::PropertyId, st
 
   // This needs to happen before locking the object
   auto schema_acc = storage_->SchemaInfoUniqueAccessor();
-  auto guard = std::unique_lock{edge_.ptr->lock};
+  auto guard = std::unique_lock{EdgeLock(edge_.ptr)};
 
   if (!PrepareForWrite(transaction_, edge_.ptr)) return Error::SERIALIZATION_ERROR;
 
@@ -265,7 +272,7 @@ Result<std::vector<std::tuple<PropertyId, PropertyValue, PropertyValue>>> EdgeAc
 
   // This needs to happen before locking the object
   auto schema_acc = storage_->SchemaInfoUniqueAccessor();
-  auto guard = std::unique_lock{edge_.ptr->lock};
+  auto guard = std::unique_lock{EdgeLock(edge_.ptr)};
 
   if (!PrepareForWrite(transaction_, edge_.ptr)) return Error::SERIALIZATION_ERROR;
 
@@ -296,7 +303,7 @@ Result<std::map<PropertyId, PropertyValue>> EdgeAccessor::ClearProperties() {
 
   // This needs to happen before locking the object
   auto schema_acc = storage_->SchemaInfoUniqueAccessor();
-  auto guard = std::unique_lock{edge_.ptr->lock};
+  auto guard = std::unique_lock{EdgeLock(edge_.ptr)};
 
   if (!PrepareForWrite(transaction_, edge_.ptr)) return Error::SERIALIZATION_ERROR;
 
@@ -330,7 +337,7 @@ Result<PropertyValue> EdgeAccessor::GetProperty(PropertyId property, View view)
   std::optional<PropertyValue> value;
   Delta *delta = nullptr;
   {
-    auto guard = std::shared_lock{edge_.ptr->lock};
+    auto guard = std::shared_lock{EdgeLock(edge_.ptr)};
     deleted = edge_.ptr->deleted;
     value.emplace(edge_.ptr->properties.GetProperty(property));
     delta = edge_.ptr->delta;
@@ -369,7 +376,7 @@ Result<PropertyValue> EdgeAccessor::GetProperty(PropertyId property, View view)
 Result<uint64_t> EdgeAccessor::GetPropertySize(PropertyId property, View view) const {
   if (!storage_->config_.salient.items.properties_on_edges) return 0;
 
-  auto guard = std::shared_lock{edge_.ptr->lock};
+  auto guard = std::shared_lock{EdgeLock(edge_.ptr)};
   Delta *delta = edge_.ptr->delta;
   if (!delta) {
     return edge_.ptr->properties.PropertySize(property);
@@ -394,7 +401,7 @@ Result<std::map<PropertyId, PropertyValue>> EdgeAccessor::Properties(View view)
   std::map<PropertyId, PropertyValue> properties;
   Delta *delta = nullptr;
   {
-    auto guard = std::shared_lock{edge_.ptr->lock};
+    auto guard = std::shared_lock{EdgeLock(edge_.ptr)};
     deleted = edge_.ptr->deleted;
     properties = edge_.ptr->properties.Properties();
     delta = edge_.ptr->delta;
@@ -25,7 +25,7 @@ inline bool IsEdgeVisible(Edge *edge, const Transaction *transaction, View view)
   bool deleted = true;
   Delta *delta = nullptr;
   {
-    auto guard = std::shared_lock{edge->lock};
+    auto guard = std::shared_lock{EdgeLock(edge)};
     deleted = edge->deleted;
     delta = edge->delta;
   }
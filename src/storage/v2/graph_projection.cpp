@@ -0,0 +1,56 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#include "storage/v2/graph_projection.hpp"
+
+#include <utility>
+
+namespace memgraph::storage {
+
+std::shared_ptr<const GraphProjection> GraphProjections::Find(std::string_view name,
+                                                              const GraphProjectionFilter &filter,
+                                                              uint64_t data_version) const {
+  return projections_.WithLock([&](const auto &projections) -> std::shared_ptr<const GraphProjection> {
+    auto it = projections.find(name);
+    if (it == projections.end()) return nullptr;
+    const auto &projection = it->second;
+    if (projection->data_version != data_version || projection->filter != filter) return nullptr;
+    return projection;
+  });
+}
+
+void GraphProjections::Store(std::string_view name, std::shared_ptr<const GraphProjection> projection) {
+  projections_.WithLock([&](auto &projections) {
+    auto it = projections.find(name);
+    if (it == projections.end()) {
+      projections.emplace(std::string{name}, std::move(projection));
+      return;
+    }
+    // An older transaction mustn't replace the projection a newer one built
+    if (it->second->data_version <= projection->data_version) it->second = std::move(projection);
+  });
+}
+
+bool GraphProjections::Drop(std::string_view name) {
+  return projections_.WithLock([&](auto &projections) {
+    auto it = projections.find(name);
+    if (it == projections.end()) return false;
+    projections.erase(it);
+    return true;
+  });
+}
+
+void GraphProjections::Clear() {
+  projections_.WithLock([](auto &projections) { projections.clear(); });
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,80 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/property_value.hpp"
+#include "utils/spin_lock.hpp"
+#include "utils/synchronized.hpp"
+
+namespace memgraph::storage {
+
+/// Which part of the graph a projection covers. Empty lists select all
+/// labels and all edge types.
+struct GraphProjectionFilter {
+  std::vector<LabelId> labels;
+  std::vector<EdgeTypeId> edge_types;
+  std::vector<PropertyId> properties;
+
+  bool operator==(const GraphProjectionFilter &) const = default;
+};
+
+/// Outbound adjacency of the vertices which have any of the filtered labels,
+/// over the edges of the filtered types between them, in the compressed sparse
+/// row format, together with the filtered properties of the vertices.
+struct GraphProjection {
+  GraphProjectionFilter filter;
+  /// Data version of the transactions which see the same graph, see
+  /// `Transaction::data_version`.
+  uint64_t data_version{0};
+  std::vector<Gid> vertices;
+  /// `offsets[i]` to `offsets[i + 1]` are the positions of the targets of the
+  /// vertex `i` in `targets`.
+  std::vector<size_t> offsets;
+  std::vector<size_t> targets;
+  /// Value of the property `j` of the vertex `i` at `i * filter.properties.size() + j`.
+  std::vector<PropertyValue> property_values;
+};
+
+/// Named projections kept by the storage so that repeated analytics don't
+/// rescan the graph. A projection is handed out only to transactions which
+/// see the graph it was built from, and is replaced once it is rebuilt from a
+/// newer one.
+class GraphProjections {
+ public:
+  /// Returns the projection named `name` if it was built with `filter` from
+  /// the data of `data_version`, nullptr otherwise.
+  std::shared_ptr<const GraphProjection> Find(std::string_view name, const GraphProjectionFilter &filter,
+                                              uint64_t data_version) const;
+
+  /// Keeps `projection` as `name` unless a projection of a newer version is already kept.
+  void Store(std::string_view name, std::shared_ptr<const GraphProjection> projection);
+
+  bool Drop(std::string_view name);
+
+  void Clear();
+
+ private:
+  using ProjectionsMap = std::map<std::string, std::shared_ptr<const GraphProjection>, std::less<>>;
+
+  mutable utils::Synchronized<ProjectionsMap, utils::SpinLock> projections_;
+};
+
+}  // namespace memgraph::storage
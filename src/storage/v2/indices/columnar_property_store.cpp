@@ -0,0 +1,249 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/indices/columnar_property_store.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_set>
+
+namespace memgraph::storage {
+
+bool ColumnarPropertyStore::CreateColumn(LabelId label, PropertyId property,
+                                         utils::SkipList<Vertex>::Accessor vertices) {
+  auto label_columns = labels_.WithLock([&](auto &labels) {
+    auto it = labels.find(label);
+    if (it == labels.end()) it = labels.emplace(label, std::make_shared<LabelColumns>(label)).first;
+    return it->second;
+  });
+
+  std::unique_lock guard{label_columns->lock};
+  if (label_columns->columns.contains(property)) return false;
+  label_columns->columns.emplace(property, std::vector<PropertyValue>(label_columns->vertices.size()));
+  Fill(*label_columns, vertices);
+  empty_.store(false, std::memory_order_release);
+  return true;
+}
+
+bool ColumnarPropertyStore::DropColumn(LabelId label, PropertyId property) {
+  return labels_.WithLock([&](auto &labels) {
+    auto it = labels.find(label);
+    if (it == labels.end()) return false;
+    {
+      std::unique_lock guard{it->second->lock};
+      if (it->second->columns.erase(property) == 0) return false;
+      if (!it->second->columns.empty()) return true;
+    }
+    labels.erase(it);
+    empty_.store(labels.empty(), std::memory_order_release);
+    return true;
+  });
+}
+
+bool ColumnarPropertyStore::ColumnExists(LabelId label, PropertyId property) const {
+  return labels_.WithReadLock([&](const auto &labels) {
+    auto it = labels.find(label);
+    if (it == labels.end()) return false;
+    std::shared_lock guard{it->second->lock};
+    return it->second->columns.contains(property);
+  });
+}
+
+std::vector<std::pair<LabelId, PropertyId>> ColumnarPropertyStore::ListColumns() const {
+  std::vector<std::pair<LabelId, PropertyId>> ret;
+  for (const auto &label_columns : AllLabelColumns()) {
+    std::shared_lock guard{label_columns->lock};
+    for (const auto &[property, _] : label_columns->columns) {
+      ret.emplace_back(label_columns->label, property);
+    }
+  }
+  return ret;
+}
+
+void ColumnarPropertyStore::UpdateOnAddLabel(LabelId label, Vertex *vertex) {
+  if (Empty()) return;
+  auto label_columns = labels_.WithReadLock([&](const auto &labels) -> std::shared_ptr<LabelColumns> {
+    auto it = labels.find(label);
+    if (it == labels.end()) return nullptr;
+    return it->second;
+  });
+  if (!label_columns) return;
+  label_columns->added.WithLock([&](auto &added) { added.push_back(vertex); });
+}
+
+void ColumnarPropertyStore::Refresh(std::span<Vertex *const> vertices) {
+  if (Empty()) return;
+  // All columns are locked at once, in the order of the labels, so the values
+  // of a vertex in every column are refreshed under one lock of the vertex.
+  auto all_label_columns = AllLabelColumns();
+  std::vector<std::unique_lock<std::shared_mutex>> guards;
+  guards.reserve(all_label_columns.size());
+  for (const auto &label_columns : all_label_columns) {
+    guards.emplace_back(label_columns->lock);
+  }
+  for (const auto &label_columns : all_label_columns) {
+    std::vector<Vertex *> added;
+    label_columns->added.WithLock([&](auto &vertices_with_label) { added.swap(vertices_with_label); });
+    for (auto *vertex : added) {
+      auto vertex_guard = std::shared_lock{vertex->lock};
+      RefreshSlot(*label_columns, vertex, true);
+    }
+  }
+  for (auto *vertex : vertices) {
+    auto vertex_guard = std::unique_lock{vertex->lock};
+    for (const auto &label_columns : all_label_columns) {
+      RefreshSlot(*label_columns, vertex, false);
+    }
+    // A vertex with a new delta chain has invalid slots until the chain is
+    // unlinked again, which marks it again.
+    vertex->columnar_stale = false;
+  }
+}
+
+void ColumnarPropertyStore::Rebuild(utils::SkipList<Vertex>::Accessor vertices) {
+  for (const auto &label_columns : AllLabelColumns()) {
+    std::unique_lock guard{label_columns->lock};
+    label_columns->added->clear();
+    label_columns->vertices.clear();
+    label_columns->slots.clear();
+    label_columns->valid.clear();
+    for (auto &[_, values] : label_columns->columns) {
+      values.clear();
+    }
+    Fill(*label_columns, vertices);
+  }
+}
+
+void ColumnarPropertyStore::Clear() {
+  labels_.WithLock([&](auto &labels) {
+    labels.clear();
+    empty_.store(true, std::memory_order_release);
+  });
+}
+
+bool ColumnarPropertyStore::Scan(LabelId label, PropertyId property, const bool use_values,
+                                 const std::function<void(Vertex *, const PropertyValue &)> &settled,
+                                 const std::function<void(Vertex *)> &unsettled) const {
+  auto label_columns = labels_.WithReadLock([&](const auto &labels) -> std::shared_ptr<LabelColumns> {
+    auto it = labels.find(label);
+    if (it == labels.end()) return nullptr;
+    return it->second;
+  });
+  if (!label_columns) return false;
+
+  std::unordered_set<Vertex *> added;
+  label_columns->added.WithLock([&](const auto &vertices) { added.insert(vertices.begin(), vertices.end()); });
+
+  std::shared_lock guard{label_columns->lock};
+  auto column = label_columns->columns.find(property);
+  if (column == label_columns->columns.end()) return false;
+  const auto &values = column->second;
+
+  for (size_t slot = 0; slot < label_columns->vertices.size(); ++slot) {
+    auto *vertex = label_columns->vertices[slot];
+    if (added.contains(vertex)) continue;
+    bool is_settled = use_values && label_columns->valid[slot];
+    if (is_settled) {
+      auto vertex_guard = std::shared_lock{vertex->lock};
+      // The vertex could have been modified, deleted or could have lost the
+      // label since the slot was refreshed, also by a change whose delta chain
+      // is already unlinked but not refreshed yet.
+      is_settled = vertex->delta == nullptr && !vertex->columnar_stale && !vertex->deleted &&
+                   std::find(vertex->labels.begin(), vertex->labels.end(), label) != vertex->labels.end();
+    }
+    if (is_settled) {
+      settled(vertex, values[slot]);
+    } else {
+      unsettled(vertex);
+    }
+  }
+  for (auto *vertex : added) {
+    unsettled(vertex);
+  }
+  return true;
+}
+
+void ColumnarPropertyStore::RefreshSlot(LabelColumns &label_columns, Vertex *vertex, const bool is_candidate) {
+  const bool has_label = std::find(vertex->labels.begin(), vertex->labels.end(), label_columns.label) !=
+                         vertex->labels.end();
+  const bool is_settled = vertex->delta == nullptr;
+  auto it = label_columns.slots.find(vertex);
+
+  if (is_settled && (vertex->deleted || !has_label)) {
+    // No transaction can see the vertex with the label anymore.
+    if (it != label_columns.slots.end()) RemoveSlot(label_columns, it->second);
+    return;
+  }
+
+  size_t slot = 0;
+  if (it != label_columns.slots.end()) {
+    slot = it->second;
+  } else {
+    // Vertices that don't have the label in any version are skipped. Vertices
+    // which were just given the label are kept even if they don't have it
+    // anymore because an older version could still be visible.
+    if (!has_label && !is_candidate) return;
+    slot = label_columns.vertices.size();
+    label_columns.vertices.push_back(vertex);
+    label_columns.valid.push_back(false);
+    for (auto &[_, values] : label_columns.columns) {
+      values.emplace_back();
+    }
+    label_columns.slots.emplace(vertex, slot);
+  }
+
+  if (!is_settled) {
+    label_columns.valid[slot] = false;
+    return;
+  }
+  for (auto &[property, values] : label_columns.columns) {
+    values[slot] = vertex->properties.GetProperty(property);
+  }
+  label_columns.valid[slot] = true;
+}
+
+void ColumnarPropertyStore::RemoveSlot(LabelColumns &label_columns, const size_t slot) {
+  const auto last = label_columns.vertices.size() - 1;
+  label_columns.slots.erase(label_columns.vertices[slot]);
+  if (slot != last) {
+    label_columns.vertices[slot] = label_columns.vertices[last];
+    label_columns.valid[slot] = label_columns.valid[last];
+    for (auto &[_, values] : label_columns.columns) {
+      values[slot] = std::move(values[last]);
+    }
+    label_columns.slots[label_columns.vertices[slot]] = slot;
+  }
+  label_columns.vertices.pop_back();
+  label_columns.valid.pop_back();
+  for (auto &[_, values] : label_columns.columns) {
+    values.pop_back();
+  }
+}
+
+void ColumnarPropertyStore::Fill(LabelColumns &label_columns, utils::SkipList<Vertex>::Accessor &vertices) {
+  for (auto &vertex : vertices) {
+    auto vertex_guard = std::shared_lock{vertex.lock};
+    RefreshSlot(label_columns, &vertex, false);
+  }
+}
+
+std::vector<std::shared_ptr<ColumnarPropertyStore::LabelColumns>> ColumnarPropertyStore::AllLabelColumns() const {
+  return labels_.WithReadLock([](const auto &labels) {
+    std::vector<std::shared_ptr<LabelColumns>> ret;
+    ret.reserve(labels.size());
+    for (const auto &[_, label_columns] : labels) {
+      ret.push_back(label_columns);
+    }
+    return ret;
+  });
+}
+
+}  // namespace memgraph::storage
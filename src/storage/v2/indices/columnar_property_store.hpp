@@ -0,0 +1,118 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/vertex.hpp"
+#include "utils/rw_spin_lock.hpp"
+#include "utils/skip_list.hpp"
+#include "utils/spin_lock.hpp"
+#include "utils/synchronized.hpp"
+
+namespace memgraph::storage {
+
+/// Side store which keeps the values of designated vertex properties of a
+/// label in dense arrays indexed by vertex slot, so scans and aggregations over
+/// those properties don't have to decode the whole `PropertyStore` of every
+/// vertex.
+///
+/// Every vertex that has (or had, in a version that may still be visible) the
+/// label owns a slot. The stored values of a slot are only valid while the
+/// vertex has no delta chain, i.e. while its current version is visible to
+/// every transaction. The values are refreshed whenever the delta chain of a
+/// vertex is completely unlinked. Until then the unlinking marks the vertex
+/// `columnar_stale`, so a change which was just unlinked isn't hidden by the
+/// older stored value. Vertices that got the label since the last refresh are
+/// kept aside and must be read through their delta chain.
+class ColumnarPropertyStore {
+ public:
+  /// Registers `property` as a columnar property of `label` and fills its
+  /// values from `vertices`. Returns `false` if the column already exists.
+  /// Must be called while no other transaction is modifying the vertices.
+  bool CreateColumn(LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices);
+
+  /// Returns `false` if the column doesn't exist.
+  bool DropColumn(LabelId label, PropertyId property);
+
+  bool ColumnExists(LabelId label, PropertyId property) const;
+
+  std::vector<std::pair<LabelId, PropertyId>> ListColumns() const;
+
+  bool Empty() const { return empty_.load(std::memory_order_acquire); }
+
+  /// This function should be called whenever a label is added to a vertex.
+  void UpdateOnAddLabel(LabelId label, Vertex *vertex);
+
+  /// This function should be called after the delta chain of `vertices` was
+  /// unlinked and they were marked `columnar_stale`, before any of the deleted
+  /// vertices is removed from the storage. The values of a vertex are read and
+  /// its mark is cleared under one lock of the vertex.
+  void Refresh(std::span<Vertex *const> vertices);
+
+  /// Refills all columns from `vertices`. Used when the stored values could
+  /// have become stale without a delta chain being unlinked, e.g. after
+  /// running in the IN_MEMORY_ANALYTICAL storage mode.
+  void Rebuild(utils::SkipList<Vertex>::Accessor vertices);
+
+  void Clear();
+
+  /// Calls `settled` with the stored value of every vertex whose value is
+  /// valid and `unsettled` with every other vertex which might have `label`.
+  /// Those vertices have to be checked and read through their delta chain. If
+  /// `use_values` is `false` every vertex is unsettled. Returns `false` if the
+  /// column doesn't exist.
+  bool Scan(LabelId label, PropertyId property, bool use_values,
+            const std::function<void(Vertex *, const PropertyValue &)> &settled,
+            const std::function<void(Vertex *)> &unsettled) const;
+
+ private:
+  struct LabelColumns {
+    explicit LabelColumns(LabelId label) : label(label) {}
+
+    const LabelId label;
+
+    // Guards the slots and the columns. Scans hold it shared for the whole
+    // scan; it must be taken before the lock of any vertex.
+    mutable std::shared_mutex lock;
+    std::vector<Vertex *> vertices;
+    std::unordered_map<Vertex *, size_t> slots;
+    std::vector<bool> valid;
+    std::map<PropertyId, std::vector<PropertyValue>> columns;
+
+    // Vertices which got the label since the last refresh. Taken while holding
+    // the vertex lock, so no other lock may be taken while holding it.
+    utils::Synchronized<std::vector<Vertex *>, utils::SpinLock> added;
+  };
+
+  // The vertex must be locked by the caller.
+  static void RefreshSlot(LabelColumns &label_columns, Vertex *vertex, bool is_candidate);
+  static void RemoveSlot(LabelColumns &label_columns, size_t slot);
+  static void Fill(LabelColumns &label_columns, utils::SkipList<Vertex>::Accessor &vertices);
+
+  std::vector<std::shared_ptr<LabelColumns>> AllLabelColumns() const;
+
+  utils::Synchronized<std::map<LabelId, std::shared_ptr<LabelColumns>>, utils::RWSpinLock> labels_;
+  std::atomic<bool> empty_{true};
+};
+
+}  // namespace memgraph::storage
@@ -0,0 +1,36 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/indices/index_cleanup_collector.hpp"
+
+namespace memgraph::storage {
+
+void IndexCleanupCollector::Merge(IndexCleanupCollector &&other) {
+  auto const count = other.overflowed_ ? kMaxEntries + 1 : other.label_changes_.size() + other.deleted_edges_.size();
+  if (Reserve(count)) {
+    label_changes_.insert(label_changes_.end(), other.label_changes_.begin(), other.label_changes_.end());
+    deleted_edges_.insert(deleted_edges_.end(), other.deleted_edges_.begin(), other.deleted_edges_.end());
+  }
+  // The deltas of the other transaction wait to be released, its entries don't have to
+  other = IndexCleanupCollector{};
+}
+
+bool IndexCleanupCollector::Reserve(size_t count) {
+  if (overflowed_) return false;
+  if (label_changes_.size() + deleted_edges_.size() + count <= kMaxEntries) return true;
+  overflowed_ = true;
+  // Release the memory, the full scans find the entries anyway
+  label_changes_ = {};
+  deleted_edges_ = {};
+  return false;
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,71 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "storage/v2/id_types.hpp"
+
+namespace memgraph::storage {
+
+struct Edge;
+struct Vertex;
+
+/// The GC looks up the collected entries instead of scanning an index once
+/// they are at most this fraction of the entries of the index.
+inline constexpr double kTargetedIndexCleanupRatio = 0.1;
+
+/// Collects the objects a transaction changed in a way that can leave
+/// obsolete entries in the label and the edge type indices, so the GC can look
+/// the entries up instead of scanning the whole indices. The memory is bounded,
+/// once more than `kMaxEntries` objects are changed the collector only
+/// remembers that it overflowed and the GC falls back to the full scans.
+class IndexCleanupCollector {
+ public:
+  static constexpr size_t kMaxEntries = 1UL << 16U;
+
+  struct DeletedEdge {
+    EdgeTypeId edge_type;
+    Vertex *from_vertex;
+    Vertex *to_vertex;
+    Edge *edge;
+  };
+
+  void UpdateOnChangeLabel(LabelId label, Vertex *vertex) {
+    if (Reserve(1)) label_changes_.emplace_back(label, vertex);
+  }
+
+  void UpdateOnDeleteEdge(EdgeTypeId edge_type, Vertex *from_vertex, Vertex *to_vertex, Edge *edge) {
+    if (Reserve(1)) deleted_edges_.push_back({edge_type, from_vertex, to_vertex, edge});
+  }
+
+  /// Adds the objects collected by @p other, the GC merges the collectors of
+  /// the transactions it unlinked in one cycle.
+  void Merge(IndexCleanupCollector &&other);
+
+  bool Overflowed() const { return overflowed_; }
+  bool Empty() const { return !overflowed_ && label_changes_.empty() && deleted_edges_.empty(); }
+
+  auto LabelChanges() const -> std::vector<std::pair<LabelId, Vertex *>> const & { return label_changes_; }
+  auto DeletedEdges() const -> std::vector<DeletedEdge> const & { return deleted_edges_; }
+
+ private:
+  bool Reserve(size_t count);
+
+  std::vector<std::pair<LabelId, Vertex *>> label_changes_;
+  std::vector<DeletedEdge> deleted_edges_;
+  bool overflowed_{false};
+};
+
+}  // namespace memgraph::storage
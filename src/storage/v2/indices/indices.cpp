@@ -55,6 +55,18 @@ void Indices::RemoveObsoleteVertexEntries(uint64_t oldest_active_start_timestamp
   static_cast<InMemoryLabelIndex *>(label_index_.get())->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
   static_cast<InMemoryLabelPropertyIndex *>(label_property_index_.get())
       ->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
+  label_property_composite_index_.RemoveObsoleteEntries(oldest_active_start_timestamp, token);
+}
+
+void Indices::RemoveObsoleteVertexEntries(uint64_t oldest_active_start_timestamp,
+                                          std::span<std::pair<LabelId, Vertex *> const> label_changes,
+                                          std::span<Vertex *const> deleted_vertices, std::stop_token token) const {
+  static_cast<InMemoryLabelIndex *>(label_index_.get())
+      ->RemoveObsoleteEntries(oldest_active_start_timestamp, label_changes, deleted_vertices, token);
+  // The entries of the property indices are ordered by the values, the ones of the older values can't be looked up
+  static_cast<InMemoryLabelPropertyIndex *>(label_property_index_.get())
+      ->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
+  label_property_composite_index_.RemoveObsoleteEntries(oldest_active_start_timestamp, token);
 }
 
 void Indices::RemoveObsoleteEdgeEntries(uint64_t oldest_active_start_timestamp, std::stop_token token) const {
@@ -64,17 +76,33 @@ void Indices::RemoveObsoleteEdgeEntries(uint64_t oldest_active_start_timestamp,
       ->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
 }
 
+void Indices::RemoveObsoleteEdgeEntries(uint64_t oldest_active_start_timestamp,
+                                        std::span<IndexCleanupCollector::DeletedEdge const> deleted_edges,
+                                        std::stop_token token) const {
+  static_cast<InMemoryEdgeTypeIndex *>(edge_type_index_.get())
+      ->RemoveObsoleteEntries(oldest_active_start_timestamp, deleted_edges, token);
+  static_cast<InMemoryEdgeTypePropertyIndex *>(edge_type_property_index_.get())
+      ->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
+}
+
 void Indices::DropGraphClearIndices() {
   static_cast<InMemoryLabelIndex *>(label_index_.get())->DropGraphClearIndices();
   static_cast<InMemoryLabelPropertyIndex *>(label_property_index_.get())->DropGraphClearIndices();
   static_cast<InMemoryEdgeTypeIndex *>(edge_type_index_.get())->DropGraphClearIndices();
   static_cast<InMemoryEdgeTypePropertyIndex *>(edge_type_property_index_.get())->DropGraphClearIndices();
+  label_property_composite_index_.DropGraphClearIndices();
   point_index_.Clear();
+  vector_index_.Clear();
+  columnar_property_store_.Clear();
 }
 
 void Indices::UpdateOnAddLabel(LabelId label, Vertex *vertex, const Transaction &tx) const {
   label_index_->UpdateOnAddLabel(label, vertex, tx);
   label_property_index_->UpdateOnAddLabel(label, vertex, tx);
+  if (!label_property_composite_index_.Empty()) {
+    label_property_composite_index_.UpdateOnAddLabel(label, vertex, tx);
+  }
+  columnar_property_store_.UpdateOnAddLabel(label, vertex);
 }
 
 void Indices::UpdateOnRemoveLabel(LabelId label, Vertex *vertex, const Transaction &tx) const {
@@ -85,6 +113,9 @@ void Indices::UpdateOnRemoveLabel(LabelId label, Vertex *vertex, const Transacti
 void Indices::UpdateOnSetProperty(PropertyId property, const PropertyValue &value, Vertex *vertex,
                                   const Transaction &tx) const {
   label_property_index_->UpdateOnSetProperty(property, value, vertex, tx);
+  if (!label_property_composite_index_.Empty()) {
+    label_property_composite_index_.UpdateOnSetProperty(property, vertex, tx);
+  }
 }
 
 void Indices::UpdateOnSetProperty(EdgeTypeId edge_type, PropertyId property, const PropertyValue &value,
@@ -98,7 +129,8 @@ void Indices::UpdateOnEdgeCreation(Vertex *from, Vertex *to, EdgeRef edge_ref, E
   edge_type_index_->UpdateOnEdgeCreation(from, to, edge_ref, edge_type, tx);
 }
 
-Indices::Indices(const Config &config, StorageMode storage_mode) {
+Indices::Indices(const Config &config, StorageMode storage_mode)
+    : text_index_(config.indices.text_index_refresh_interval) {
   std::invoke([this, config, storage_mode]() {
     if (storage_mode == StorageMode::IN_MEMORY_TRANSACTIONAL || storage_mode == StorageMode::IN_MEMORY_ANALYTICAL) {
       label_index_ = std::make_unique<InMemoryLabelIndex>();
@@ -17,10 +17,14 @@
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/indices/edge_type_index.hpp"
 #include "storage/v2/indices/edge_type_property_index.hpp"
+#include "storage/v2/indices/columnar_property_store.hpp"
+#include "storage/v2/indices/index_cleanup_collector.hpp"
 #include "storage/v2/indices/label_index.hpp"
 #include "storage/v2/indices/label_property_index.hpp"
 #include "storage/v2/indices/point_index.hpp"
 #include "storage/v2/indices/text_index.hpp"
+#include "storage/v2/indices/vector_index.hpp"
+#include "storage/v2/inmemory/label_property_composite_index.hpp"
 #include "storage/v2/storage_mode.hpp"
 
 namespace memgraph::storage {
@@ -39,11 +43,23 @@ struct Indices {
   /// TODO: unused in disk indices
   void RemoveObsoleteVertexEntries(uint64_t oldest_active_start_timestamp, std::stop_token token) const;
 
+  /// Same as above, but the label index only looks up the entries of the
+  /// vertices whose labels changed and of the deleted vertices.
+  void RemoveObsoleteVertexEntries(uint64_t oldest_active_start_timestamp,
+                                   std::span<std::pair<LabelId, Vertex *> const> label_changes,
+                                   std::span<Vertex *const> deleted_vertices, std::stop_token token) const;
+
   /// This function should be called from garbage collection to clean up the
   /// edge indices.
   /// TODO: unused in disk indices
   void RemoveObsoleteEdgeEntries(uint64_t oldest_active_start_timestamp, std::stop_token token) const;
 
+  /// Same as above, but the edge type index only looks up the entries of the
+  /// deleted edges.
+  void RemoveObsoleteEdgeEntries(uint64_t oldest_active_start_timestamp,
+                                 std::span<IndexCleanupCollector::DeletedEdge const> deleted_edges,
+                                 std::stop_token token) const;
+
   /// Surgical removal of entries that were inserted in this transaction
   /// TODO: unused in disk indices
   void AbortEntries(LabelId labelId, std::span<Vertex *const> vertices, uint64_t exact_start_timestamp) const;
@@ -96,6 +112,10 @@ struct Indices {
   std::unique_ptr<EdgeTypePropertyIndex> edge_type_property_index_;
   mutable TextIndex text_index_;
   PointIndexStorage point_index_;
+  VectorIndexStorage vector_index_;
+  mutable ColumnarPropertyStore columnar_property_store_;
+  // Only used by the in-memory storage.
+  mutable InMemoryLabelPropertyCompositeIndex label_property_composite_index_;
 };
 
 }  // namespace memgraph::storage
@@ -9,7 +9,11 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
-#include <thread>
+#include <algorithm>
+#include <atomic>
+#include <span>
+#include <vector>
+
 #include "storage/v2/delta.hpp"
 #include "storage/v2/durability/recovery_type.hpp"
 #include "storage/v2/mvcc.hpp"
@@ -18,6 +22,7 @@
 #include "storage/v2/vertex_info_helpers.hpp"
 #include "utils/spin_lock.hpp"
 #include "utils/synchronized.hpp"
+#include "utils/thread_pool.hpp"
 
 namespace memgraph::storage {
 
@@ -178,7 +183,7 @@ inline bool AnyVersionHasLabelProperty(const Edge &edge, PropertyId key, const P
   bool deleted;
   bool current_value_equal_to_value;
   {
-    auto guard = std::shared_lock{edge.lock};
+    auto guard = std::shared_lock{EdgeLock(&edge)};
     delta = edge.delta;
     deleted = edge.deleted;
     // Avoid IsPropertyEqual if already not possible
@@ -223,6 +228,54 @@ inline bool AnyVersionHasLabelProperty(const Edge &edge, PropertyId key, const P
       });
 }
 
+// Helper function for counting the entries of a label index. Returns true if
+// this transaction can see the given vertex, and the visible version has the
+// given label.
+inline bool CurrentVersionHasLabel(const Vertex &vertex, LabelId label, Transaction *transaction, View view) {
+  bool exists = true;
+  bool deleted = false;
+  bool has_label = false;
+  const Delta *delta = nullptr;
+  {
+    auto guard = std::shared_lock{vertex.lock};
+    deleted = vertex.deleted;
+    has_label = utils::Contains(vertex.labels, label);
+    delta = vertex.delta;
+  }
+
+  // Checking cache has a cost, only do it if we have any deltas
+  // if we have no deltas then what we already have from the vertex is correct.
+  if (delta && transaction->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
+    // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
+    // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
+    auto const useCache = transaction->UseManyDeltasCache();
+    if (useCache) {
+      auto const &cache = transaction->manyDeltasCache;
+      if (auto resError = HasError(view, cache, &vertex, false); resError) return false;
+      if (auto resLabel = cache.GetHasLabel(view, &vertex, label); resLabel) return *resLabel;
+    }
+
+    auto const n_processed = ApplyDeltasForRead(transaction, delta, view, [&, label](const Delta &delta) {
+      // clang-format off
+      DeltaDispatch(delta, utils::ChainedOverloaded{
+        Deleted_ActionMethod(deleted),
+        Exists_ActionMethod(exists),
+        HasLabel_ActionMethod(has_label, label)
+      });
+      // clang-format on
+    });
+
+    if (useCache && n_processed >= FLAGS_delta_chain_cache_threshold) {
+      auto &cache = transaction->manyDeltasCache;
+      cache.StoreExists(view, &vertex, exists);
+      cache.StoreDeleted(view, &vertex, deleted);
+      cache.StoreHasLabel(view, &vertex, label, has_label);
+    }
+  }
+
+  return exists && !deleted && has_label;
+}
+
 // Helper function for iterating through label-property index. Returns true if
 // this transaction can see the given vertex, and the visible version has the
 // given label and property.
@@ -246,7 +299,7 @@ inline bool CurrentVersionHasLabelProperty(const Vertex &vertex, LabelId label,
   if (delta && transaction->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
-    auto const useCache = transaction->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
+    auto const useCache = transaction->UseManyDeltasCache();
     if (useCache) {
       auto const &cache = transaction->manyDeltasCache;
       if (auto resError = HasError(view, cache, &vertex, false); resError) return false;
@@ -282,6 +335,114 @@ inline bool CurrentVersionHasLabelProperty(const Vertex &vertex, LabelId label,
   return exists && !deleted && has_label && current_value_equal_to_value;
 }
 
+/// Helper function for composite index garbage collection. Returns true if
+/// there's a reachable version of the vertex that has the given label and
+/// property values.
+inline bool AnyVersionHasLabelProperties(const Vertex &vertex, LabelId label, std::span<PropertyId const> keys,
+                                         std::span<PropertyValue const> values, uint64_t timestamp) {
+  Delta const *delta;
+  bool deleted;
+  bool has_label;
+  std::vector<PropertyValue> current_values;
+  {
+    auto guard = std::shared_lock{vertex.lock};
+    delta = vertex.delta;
+    deleted = vertex.deleted;
+    has_label = utils::Contains(vertex.labels, label);
+    // Avoid reading the properties if already not possible
+    if (delta == nullptr && (deleted || !has_label)) return false;
+    current_values = vertex.properties.GetProperties(keys);
+  }
+
+  auto values_equal = [&]() { return std::ranges::equal(current_values, values); };
+  if (!deleted && has_label && values_equal()) {
+    return true;
+  }
+
+  constexpr auto interesting = ActionSet<Delta::Action::ADD_LABEL, Delta::Action::REMOVE_LABEL,
+                                         Delta::Action::SET_PROPERTY, Delta::Action::RECREATE_OBJECT,
+                                         Delta::Action::DELETE_DESERIALIZED_OBJECT, Delta::Action::DELETE_OBJECT>{};
+  return AnyVersionSatisfiesPredicate<interesting>(timestamp, delta, [&](const Delta &delta) {
+    switch (delta.action) {
+      case Delta::Action::ADD_LABEL:
+        if (delta.label.value == label) {
+          MG_ASSERT(!has_label, "Invalid database state!");
+          has_label = true;
+        }
+        break;
+      case Delta::Action::REMOVE_LABEL:
+        if (delta.label.value == label) {
+          MG_ASSERT(has_label, "Invalid database state!");
+          has_label = false;
+        }
+        break;
+      case Delta::Action::SET_PROPERTY:
+        for (size_t i = 0; i < keys.size(); ++i) {
+          if (keys[i] == delta.property.key) current_values[i] = *delta.property.value;
+        }
+        break;
+      case Delta::Action::RECREATE_OBJECT: {
+        MG_ASSERT(deleted, "Invalid database state!");
+        deleted = false;
+        break;
+      }
+      case Delta::Action::DELETE_DESERIALIZED_OBJECT:
+      case Delta::Action::DELETE_OBJECT: {
+        MG_ASSERT(!deleted, "Invalid database state!");
+        deleted = true;
+        break;
+      }
+      case Delta::Action::ADD_IN_EDGE:
+      case Delta::Action::ADD_OUT_EDGE:
+      case Delta::Action::REMOVE_IN_EDGE:
+      case Delta::Action::REMOVE_OUT_EDGE:
+        break;
+    }
+    return !deleted && has_label && values_equal();
+  });
+}
+
+// Helper function for iterating through composite index. Returns true if this
+// transaction can see the given vertex, and the visible version has the given
+// label and property values.
+inline bool CurrentVersionHasLabelProperties(const Vertex &vertex, LabelId label, std::span<PropertyId const> keys,
+                                             std::span<PropertyValue const> values, Transaction *transaction,
+                                             View view) {
+  bool exists = true;
+  bool deleted = false;
+  bool has_label = false;
+  std::vector<PropertyValue> current_values;
+  const Delta *delta = nullptr;
+  {
+    auto guard = std::shared_lock{vertex.lock};
+    deleted = vertex.deleted;
+    has_label = utils::Contains(vertex.labels, label);
+    delta = vertex.delta;
+    if (delta == nullptr || transaction->isolation_level == IsolationLevel::READ_UNCOMMITTED) {
+      // What we have from the vertex is the visible version
+      if (deleted || !has_label) return false;
+      for (size_t i = 0; i < keys.size(); ++i) {
+        if (!vertex.properties.IsPropertyEqual(keys[i], values[i])) return false;
+      }
+      return true;
+    }
+    current_values = vertex.properties.GetProperties(keys);
+  }
+
+  ApplyDeltasForRead(transaction, delta, view, [&, label, keys](const Delta &delta) {
+    // clang-format off
+    DeltaDispatch(delta, utils::ChainedOverloaded{
+      Deleted_ActionMethod(deleted),
+      Exists_ActionMethod(exists),
+      HasLabel_ActionMethod(has_label, label),
+      PropertyValues_ActionMethod(current_values, keys)
+    });
+    // clang-format on
+  });
+
+  return exists && !deleted && has_label && std::ranges::equal(current_values, values);
+}
+
 // Helper function for iterating through label-property index. Returns true if
 // this transaction can see the given vertex, and the visible version has the
 // given label and property.
@@ -292,7 +453,7 @@ inline bool CurrentEdgeVersionHasProperty(const Edge &edge, PropertyId key, cons
   bool current_value_equal_to_value = value.IsNull();
   const Delta *delta = nullptr;
   {
-    auto guard = std::shared_lock{edge.lock};
+    auto guard = std::shared_lock{EdgeLock(&edge)};
     deleted = edge.deleted;
     current_value_equal_to_value = edge.properties.IsPropertyEqual(key, value);
     delta = edge.delta;
@@ -370,37 +531,63 @@ inline void CreateIndexOnMultipleThreads(utils::SkipList<Vertex>::Accessor &vert
   std::atomic<uint64_t> batch_counter = 0;
 
   utils::Synchronized<std::optional<utils::OutOfMemoryException>, utils::SpinLock> maybe_error{};
-  {
-    std::vector<std::jthread> threads;
-    threads.reserve(thread_count);
-
-    for (auto i{0U}; i < thread_count; ++i) {
-      threads.emplace_back(
-          [&skiplist_iter, &func, &index, &vertex_batches, &maybe_error, &batch_counter, &key, &vertices]() {
-            while (!maybe_error.Lock()->has_value()) {
-              const auto batch_index = batch_counter++;
-              if (batch_index >= vertex_batches.size()) {
-                return;
-              }
-              const auto &batch = vertex_batches[batch_index];
-              auto index_accessor = index.at(key).access();
-              auto it = vertices.find(batch.first);
-
-              try {
-                for (auto i{0U}; i < batch.second; ++i, ++it) {
-                  func(*it, key, index_accessor);
-                }
-
-              } catch (utils::OutOfMemoryException &failure) {
-                utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
-                index.erase(skiplist_iter);
-                *maybe_error.Lock() = std::move(failure);
-              }
-            }
-          });
+  utils::CpuThreadPool().RunParallel(thread_count, [&](size_t /*worker*/) {
+    while (!maybe_error.Lock()->has_value()) {
+      const auto batch_index = batch_counter++;
+      if (batch_index >= vertex_batches.size()) {
+        return;
+      }
+      const auto &batch = vertex_batches[batch_index];
+      auto index_accessor = index.at(key).access();
+      auto it = vertices.find(batch.first);
+
+      try {
+        for (auto i{0U}; i < batch.second; ++i, ++it) {
+          func(*it, key, index_accessor);
+        }
+
+      } catch (utils::OutOfMemoryException &failure) {
+        utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
+        *maybe_error.Lock() = std::move(failure);
+      }
     }
-  }
+  });
   if (maybe_error.Lock()->has_value()) {
+    // Erased only once all threads are done, the others still access the index.
+    utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
+    index.erase(skiplist_iter);
+    throw utils::OutOfMemoryException((*maybe_error.Lock())->what());
+  }
+}
+
+/// Populates the index on up to `thread_count` threads, each of which scans a
+/// chunk of the vertices. Unlike `CreateIndexOnMultipleThreads` this doesn't
+/// need the vertex batches collected during recovery, so it's used when an
+/// index is created at runtime.
+template <typename TIndex, typename TIndexKey, typename TSkiplistIter, typename TFunc>
+inline void CreateIndexOnChunks(utils::SkipList<Vertex>::Accessor &vertices, TSkiplistIter it, TIndex &index,
+                                TIndexKey key, uint64_t thread_count, const TFunc &func) {
+  auto chunks = vertices.chunks(thread_count);
+
+  std::atomic<bool> failed{false};
+  utils::Synchronized<std::optional<utils::OutOfMemoryException>, utils::SpinLock> maybe_error{};
+  utils::CpuThreadPool().RunParallel(chunks.size(), [&](size_t chunk_index) {
+    utils::MemoryTracker::OutOfMemoryExceptionEnabler oom_exception;
+    try {
+      auto index_accessor = it->second.access();
+      for (Vertex &vertex : chunks[chunk_index]) {
+        if (failed.load(std::memory_order_relaxed)) return;
+        func(vertex, key, index_accessor);
+      }
+    } catch (utils::OutOfMemoryException &failure) {
+      utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
+      failed.store(true, std::memory_order_relaxed);
+      *maybe_error.Lock() = std::move(failure);
+    }
+  });
+  if (failed.load(std::memory_order_relaxed)) {
+    utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_exception_blocker;
+    index.erase(it);
     throw utils::OutOfMemoryException((*maybe_error.Lock())->what());
   }
 }
@@ -1,4 +1,4 @@
-// Copyright 2023 Memgraph Ltd.
+// Copyright 2024 Memgraph Ltd.
 //
 // Use of this software is governed by the Business Source License
 // included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -11,6 +11,10 @@
 
 #pragma once
 
+#include <sstream>
+#include <string>
+#include <vector>
+
 #include <fmt/core.h>
 #include "utils/simple_json.hpp"
 
@@ -19,12 +23,28 @@ namespace memgraph::storage {
 struct LabelPropertyIndexStats {
   uint64_t count, distinct_values_count;
   double statistic, avg_group_size, avg_degree;
+  // Bounds of the buckets of an equi-depth histogram of the property values,
+  // from the smallest to the largest value. Every bucket holds about the same
+  // number of values, so a value spanning several buckets is frequent. Only
+  // built when all the values are numeric, empty otherwise.
+  std::vector<double> histogram{};
 };
 
 static inline std::string ToJson(const LabelPropertyIndexStats &in) {
-  return fmt::format(
-      R"({{"count":{}, "distinct_values_count":{}, "statistic":{}, "avg_group_size":{} "avg_degree":{}}})", in.count,
+  auto json = fmt::format(
+      R"({{"count":{}, "distinct_values_count":{}, "statistic":{}, "avg_group_size":{} "avg_degree":{})", in.count,
       in.distinct_values_count, in.statistic, in.avg_group_size, in.avg_degree);
+  if (!in.histogram.empty()) {
+    // Stats written before the histograms were added don't have the key
+    json += R"(, "histogram":")";
+    for (size_t i = 0; i < in.histogram.size(); ++i) {
+      if (i != 0) json += ' ';
+      json += fmt::format("{}", in.histogram[i]);
+    }
+    json += '"';
+  }
+  json += '}';
+  return json;
 }
 
 static inline bool FromJson(const std::string &json, LabelPropertyIndexStats &out) {
@@ -34,6 +54,11 @@ static inline bool FromJson(const std::string &json, LabelPropertyIndexStats &ou
   res &= utils::GetJsonValue(json, "statistic", out.statistic);
   res &= utils::GetJsonValue(json, "avg_group_size", out.avg_group_size);
   res &= utils::GetJsonValue(json, "avg_degree", out.avg_degree);
+  out.histogram.clear();
+  if (std::string histogram; utils::GetJsonValue(json, "histogram", histogram)) {
+    std::istringstream ss(histogram);
+    for (double bound{0}; ss >> bound;) out.histogram.push_back(bound);
+  }
   return res;
 }
 
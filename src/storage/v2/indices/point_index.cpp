@@ -11,8 +11,11 @@
 
 #include "storage/v2/indices/point_index.hpp"
 #include "storage/v2/indices/point_index_change_collector.hpp"
+#include "storage/v2/point_functions.hpp"
 #include "storage/v2/vertex.hpp"
 
+#include <algorithm>
+
 #include <boost/geometry.hpp>
 #include <boost/geometry/geometries/point.hpp>
 #include <boost/geometry/index/rtree.hpp>
@@ -84,6 +87,8 @@ struct PointIndex {
   auto CreateNewPointIndex(LabelPropKey labelPropKey, absl::flat_hash_set<Vertex const *> const &changed_vertices) const
       -> PointIndex;
 
+  auto NearestVertices(PropertyValue const &point, std::size_t k) const -> std::vector<Vertex const *>;
+
   auto EntryCount() const -> std::size_t {
     return wgs_2d_index_->size() + wgs_3d_index_->size() + cartesian_2d_index_->size() + cartesian_3d_index_->size();
   }
@@ -103,6 +108,46 @@ struct PointIndex {
 };
 
 namespace {
+template <typename IndexPoint>
+auto NearestEntries(index_t<IndexPoint> const &index, IndexPoint const &point, std::size_t k)
+    -> std::vector<Vertex const *> {
+  auto result = std::vector<Vertex const *>{};
+  auto const count = std::min(k, index.size());
+  if (count == 0) return result;
+  result.reserve(count);
+  // The query iterator descends into the nodes nearest to `point` first and
+  // yields the entries ordered by distance, so the rest of the tree is never
+  // read.
+  for (auto it = index.qbegin(bgi::nearest(point.rep, static_cast<unsigned>(count))); it != index.qend(); ++it) {
+    result.push_back(it->vertex());
+  }
+  return result;
+}
+
+// The distance strategies of boost don't cover 3d points on a sphere, so the
+// entries are scanned while keeping the `k` nearest ones in a bounded max-heap.
+auto NearestEntriesWGS3d(index_t<IndexPointWGS3d> const &index, Point3d const &point, std::size_t k)
+    -> std::vector<Vertex const *> {
+  using Candidate = std::pair<double, Vertex const *>;
+  auto heap = std::vector<Candidate>{};
+  heap.reserve(std::min(k, index.size()));
+  for (auto const &entry : index) {
+    auto const &p = entry.point();
+    auto const distance = Distance(point, Point3d{point.crs(), bg::get<0>(p), bg::get<1>(p), bg::get<2>(p)});
+    if (heap.size() < k) {
+      heap.emplace_back(distance, entry.vertex());
+      std::ranges::push_heap(heap, {}, &Candidate::first);
+    } else if (distance < heap.front().first) {
+      std::ranges::pop_heap(heap, {}, &Candidate::first);
+      heap.back() = Candidate{distance, entry.vertex()};
+      std::ranges::push_heap(heap, {}, &Candidate::first);
+    }
+  }
+  std::ranges::sort_heap(heap, {}, &Candidate::first);
+  auto vertices = heap | std::views::values;
+  return {vertices.begin(), vertices.end()};
+}
+
 auto update_internal(index_container_t const &src, TrackedChanges const &tracked_changes)
     -> std::optional<index_container_t> {
   // All previous txns will use older index, this new built index will not concurrently be seen by older txns
@@ -227,6 +272,10 @@ std::vector<std::pair<LabelId, PropertyId>> PointIndexStorage::ListIndices() {
   return {keys.begin(), keys.end()};
 }
 
+bool PointIndexStorage::PointIndexExists(LabelId label, PropertyId property) const {
+  return indexes_->contains(LabelPropKey{label, property});
+}
+
 uint64_t PointIndexStorage::ApproximatePointCount(LabelId labelId, PropertyId propertyId) {
   auto it = indexes_->find(LabelPropKey{labelId, propertyId});
   if (it == indexes_->end()) return 0;
@@ -298,6 +347,28 @@ auto PointIndex::CreateNewPointIndex(LabelPropKey labelPropKey,
                     helper(cartesian_3d_index_, changed_cartesian_3d)};
 }
 
+auto PointIndex::NearestVertices(PropertyValue const &point, std::size_t k) const -> std::vector<Vertex const *> {
+  if (k == 0) return {};
+  if (point.IsPoint2d()) {
+    auto const &val = point.ValuePoint2d();
+    if (IsWGS(val.crs())) return NearestEntries(*wgs_2d_index_, IndexPointWGS2d{val}, k);
+    return NearestEntries(*cartesian_2d_index_, IndexPointCartesian2d{val}, k);
+  }
+  if (point.IsPoint3d()) {
+    auto const &val = point.ValuePoint3d();
+    if (IsWGS(val.crs())) return NearestEntriesWGS3d(*wgs_3d_index_, val, k);
+    return NearestEntries(*cartesian_3d_index_, IndexPointCartesian3d{val}, k);
+  }
+  return {};
+}
+
+auto PointIndexContext::NearestVertices(LabelId label, PropertyId property, PropertyValue const &point,
+                                        std::size_t k) const -> std::vector<Vertex const *> {
+  auto it = current_indexes_->find(LabelPropKey{label, property});
+  if (it == current_indexes_->end()) return {};
+  return it->second->NearestVertices(point, k);
+}
+
 void PointIndexContext::rebuild_current(std::shared_ptr<index_container_t> latest_index,
                                         PointIndexChangeCollector &collector) {
   orig_indexes_ = std::move(latest_index);
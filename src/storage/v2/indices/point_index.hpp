@@ -27,6 +27,13 @@ struct PointIndexContext {
 
   void AdvanceCommand(PointIndexChangeCollector &collector) { update_current(collector); }
 
+  /// Returns up to `k` vertices indexed under `label` and `property`, ordered
+  /// by the distance of their indexed point to `point`, nearest first. Only
+  /// the points of the same coordinate reference system as `point` are
+  /// considered. The returned vertices still need a visibility check.
+  auto NearestVertices(LabelId label, PropertyId property, PropertyValue const &point, std::size_t k) const
+      -> std::vector<Vertex const *>;
+
  private:
   // Only PointIndexStorage can make these
   friend struct PointIndexStorage;
@@ -58,6 +65,8 @@ struct PointIndexStorage {
 
   std::vector<std::pair<LabelId, PropertyId>> ListIndices();
 
+  bool PointIndexExists(LabelId label, PropertyId property) const;
+
   uint64_t ApproximatePointCount(LabelId labelId, PropertyId propertyId);
 
  private:
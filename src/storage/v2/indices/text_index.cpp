@@ -18,8 +18,10 @@
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/view.hpp"
+#include "utils/logging.hpp"
 
 #include <span>
+#include <utility>
 #include <vector>
 
 namespace memgraph::storage {
@@ -28,6 +30,20 @@ std::string GetPropertyName(PropertyId prop_id, NameIdMapper *name_id_mapper) {
   return name_id_mapper->IdToName(prop_id.AsUint());
 }
 
+TextIndex::TextIndex(std::chrono::milliseconds refresh_interval) : refresh_interval_(refresh_interval) {
+  if (refresh_interval_.count() > 0) {
+    writer_.Run("Text index", refresh_interval_, [this] {
+      try {
+        ApplyPendingChanges();
+      } catch (const std::exception &e) {
+        spdlog::warn("Failed to apply the pending text index changes: {}", e.what());
+      }
+    });
+  }
+}
+
+TextIndex::~TextIndex() { writer_.Stop(); }
+
 inline std::string TextIndex::MakeIndexPath(const std::filesystem::path &storage_dir, const std::string &index_name) {
   return (storage_dir / kTextIndicesDirectory / index_name).string();
 }
@@ -42,6 +58,8 @@ void TextIndex::CreateEmptyIndex(const std::filesystem::path &storage_dir, const
     throw query::TextSearchException("Text index \"{}\" already exists.", index_name);
   }
 
+  std::lock_guard writer_guard(writer_lock_);
+  std::lock_guard guard(changes_lock_);
   try {
     nlohmann::json mappings = {};
     mappings["properties"] = {};
@@ -118,28 +136,22 @@ std::string TextIndex::StringifyProperties(const std::map<PropertyId, PropertyVa
   return utils::Join(indexable_properties_as_string, " ");
 }
 
-std::vector<mgcxx::text_search::Context *> TextIndex::GetApplicableTextIndices(
-    std::span<storage::LabelId const> labels) {
+std::vector<std::string> TextIndex::GetApplicableTextIndices(std::span<storage::LabelId const> labels) {
   if (!flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
     throw query::TextSearchDisabledException();
   }
 
-  std::vector<mgcxx::text_search::Context *> applicable_text_indices;
+  std::vector<std::string> applicable_text_indices;
   for (const auto &label : labels) {
-    if (label_to_index_.contains(label)) {
-      applicable_text_indices.push_back(&index_.at(label_to_index_.at(label)).context_);
+    if (auto it = label_to_index_.find(label); it != label_to_index_.end()) {
+      applicable_text_indices.push_back(it->second);
     }
   }
   return applicable_text_indices;
 }
 
-void TextIndex::LoadNodeToTextIndices(const std::int64_t gid, const nlohmann::json &properties,
-                                      const std::string &property_values_as_str,
-                                      const std::vector<mgcxx::text_search::Context *> &applicable_text_indices) {
-  if (applicable_text_indices.empty()) {
-    return;
-  }
-
+std::string TextIndex::MakeDocument(const std::int64_t gid, const nlohmann::json &properties,
+                                    const std::string &property_values_as_str) {
   // NOTE: Text indexes are presently all-property indices. If we allow text indexes restricted to specific properties,
   // an indexable document should be created for each applicable index.
   nlohmann::json document = {};
@@ -149,17 +161,66 @@ void TextIndex::LoadNodeToTextIndices(const std::int64_t gid, const nlohmann::js
   document["metadata"]["gid"] = gid;
   document["metadata"]["deleted"] = false;
   document["metadata"]["is_node"] = true;
+  return document.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace);
+}
+
+void TextIndex::AddDocument(mgcxx::text_search::Context &index_context, const std::string &document) {
+  try {
+    mgcxx::text_search::add_document(index_context, mgcxx::text_search::DocumentInput{.data = document},
+                                     kDoSkipCommit);
+  } catch (const std::exception &e) {
+    throw query::TextSearchException("Tantivy error: {}", e.what());
+  }
+}
+
+void TextIndex::DeleteDocument(mgcxx::text_search::Context &index_context, const std::int64_t gid) {
+  try {
+    mgcxx::text_search::delete_document(
+        index_context, mgcxx::text_search::SearchInput{.search_query = fmt::format("metadata.gid:{}", gid)},
+        kDoSkipCommit);
+  } catch (const std::exception &e) {
+    throw query::TextSearchException("Tantivy error: {}", e.what());
+  }
+}
+
+void TextIndex::ApplyOrStageChange(const std::string &index_name, TextIndexChange change, uint64_t transaction_id) {
+  if (refresh_interval_.count() == 0) {
+    auto &index_context = index_.at(index_name).context_;
+    if (change.document) {
+      AddDocument(index_context, *change.document);
+    } else {
+      DeleteDocument(index_context, change.gid);
+    }
+    return;
+  }
+
+  std::lock_guard guard(changes_lock_);
+  staged_changes_[transaction_id].emplace_back(index_name, std::move(change));
+}
+
+void TextIndex::ApplyPendingChanges(const std::optional<std::string> &index_name) {
+  std::lock_guard writer_guard(writer_lock_);
+
+  // Changes are taken in one go so that committing transactions aren't blocked while Tantivy applies them
+  std::vector<std::pair<TextIndexData *, std::vector<TextIndexChange>>> batches;
+  {
+    std::lock_guard guard(changes_lock_);
+    for (auto &[name, index_data] : index_) {
+      if (index_name && name != *index_name) continue;
+      if (index_data.pending_changes_.empty()) continue;
+      batches.emplace_back(&index_data, std::exchange(index_data.pending_changes_, {}));
+    }
+  }
 
-  for (auto *index_context : applicable_text_indices) {
-    try {
-      mgcxx::text_search::add_document(
-          *index_context,
-          mgcxx::text_search::DocumentInput{
-              .data = document.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace)},
-          kDoSkipCommit);
-    } catch (const std::exception &e) {
-      throw query::TextSearchException("Tantivy error: {}", e.what());
+  for (auto &[index_data, changes] : batches) {
+    for (const auto &change : changes) {
+      if (change.document) {
+        AddDocument(index_data->context_, *change.document);
+      } else {
+        DeleteDocument(index_data->context_, change.gid);
+      }
     }
+    CommitLoadedNodes(index_data->context_);
   }
 }
 
@@ -174,9 +235,8 @@ void TextIndex::CommitLoadedNodes(mgcxx::text_search::Context &index_context) {
   }
 }
 
-void TextIndex::AddNode(
-    Vertex *vertex_after_update, NameIdMapper *name_id_mapper,
-    const std::optional<std::vector<mgcxx::text_search::Context *>> &maybe_applicable_text_indices) {
+void TextIndex::AddNode(Vertex *vertex_after_update, NameIdMapper *name_id_mapper, uint64_t transaction_id,
+                        const std::optional<std::vector<std::string>> &maybe_applicable_text_indices) {
   if (!flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
     throw query::TextSearchDisabledException();
   }
@@ -188,11 +248,14 @@ void TextIndex::AddNode(
   }
 
   auto vertex_properties = vertex_after_update->properties.Properties();
-  LoadNodeToTextIndices(vertex_after_update->gid.AsInt(), SerializeProperties(vertex_properties, name_id_mapper),
-                        StringifyProperties(vertex_properties), applicable_text_indices);
+  auto document = MakeDocument(vertex_after_update->gid.AsInt(), SerializeProperties(vertex_properties, name_id_mapper),
+                               StringifyProperties(vertex_properties));
+  for (const auto &index_name : applicable_text_indices) {
+    ApplyOrStageChange(index_name, {.gid = vertex_after_update->gid.AsInt(), .document = document}, transaction_id);
+  }
 }
 
-void TextIndex::UpdateNode(Vertex *vertex_after_update, NameIdMapper *name_id_mapper,
+void TextIndex::UpdateNode(Vertex *vertex_after_update, NameIdMapper *name_id_mapper, uint64_t transaction_id,
                            const std::vector<LabelId> &removed_labels) {
   if (!flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
     throw query::TextSearchDisabledException();
@@ -200,32 +263,25 @@ void TextIndex::UpdateNode(Vertex *vertex_after_update, NameIdMapper *name_id_ma
 
   if (!removed_labels.empty()) {
     auto indexes_to_remove_node_from = GetApplicableTextIndices(removed_labels);
-    RemoveNode(vertex_after_update, indexes_to_remove_node_from);
+    RemoveNode(vertex_after_update, transaction_id, indexes_to_remove_node_from);
   }
 
   auto applicable_text_indices = GetApplicableTextIndices(vertex_after_update->labels);
   if (applicable_text_indices.empty()) return;
-  RemoveNode(vertex_after_update, applicable_text_indices);
-  AddNode(vertex_after_update, name_id_mapper, applicable_text_indices);
+  RemoveNode(vertex_after_update, transaction_id, applicable_text_indices);
+  AddNode(vertex_after_update, name_id_mapper, transaction_id, applicable_text_indices);
 }
 
-void TextIndex::RemoveNode(
-    Vertex *vertex_after_update,
-    const std::optional<std::vector<mgcxx::text_search::Context *>> &maybe_applicable_text_indices) {
+void TextIndex::RemoveNode(Vertex *vertex_after_update, uint64_t transaction_id,
+                           const std::optional<std::vector<std::string>> &maybe_applicable_text_indices) {
   if (!flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
     throw query::TextSearchDisabledException();
   }
 
-  auto search_node_to_be_deleted =
-      mgcxx::text_search::SearchInput{.search_query = fmt::format("metadata.gid:{}", vertex_after_update->gid.AsInt())};
-
-  for (auto *index_context :
+  for (const auto &index_name :
        maybe_applicable_text_indices.value_or(GetApplicableTextIndices(vertex_after_update->labels))) {
-    try {
-      mgcxx::text_search::delete_document(*index_context, search_node_to_be_deleted, kDoSkipCommit);
-    } catch (const std::exception &e) {
-      throw query::TextSearchException("Tantivy error: {}", e.what());
-    }
+    ApplyOrStageChange(index_name, {.gid = vertex_after_update->gid.AsInt(), .document = std::nullopt},
+                       transaction_id);
   }
 }
 
@@ -243,8 +299,9 @@ void TextIndex::CreateIndex(std::filesystem::path const &storage_dir, std::strin
     }
 
     auto vertex_properties = v.Properties(View::NEW).GetValue();
-    LoadNodeToTextIndices(v.Gid().AsInt(), SerializeProperties(vertex_properties, nameIdMapper),
-                          StringifyProperties(vertex_properties), {&index_.at(index_name).context_});
+    AddDocument(index_.at(index_name).context_,
+                MakeDocument(v.Gid().AsInt(), SerializeProperties(vertex_properties, nameIdMapper),
+                             StringifyProperties(vertex_properties)));
   }
 
   CommitLoadedNodes(index_.at(index_name).context_);
@@ -267,8 +324,9 @@ void TextIndex::RecoverIndex(const std::filesystem::path &storage_dir, const std
     }
 
     auto vertex_properties = v.properties.Properties();
-    LoadNodeToTextIndices(v.gid.AsInt(), SerializeProperties(vertex_properties, name_id_mapper),
-                          StringifyProperties(vertex_properties), {&index_.at(index_name).context_});
+    AddDocument(index_.at(index_name).context_,
+                MakeDocument(v.gid.AsInt(), SerializeProperties(vertex_properties, name_id_mapper),
+                             StringifyProperties(vertex_properties)));
   }
 
   CommitLoadedNodes(index_.at(index_name).context_);
@@ -283,6 +341,8 @@ LabelId TextIndex::DropIndex(const std::filesystem::path &storage_dir, const std
     throw query::TextSearchException("Text index \"{}\" doesn’t exist.", index_name);
   }
 
+  std::lock_guard writer_guard(writer_lock_);
+  std::lock_guard guard(changes_lock_);
   try {
     mgcxx::text_search::drop_index(MakeIndexPath(storage_dir, index_name));
   } catch (const std::exception &e) {
@@ -405,24 +465,54 @@ std::string TextIndex::Aggregate(const std::string &index_name, const std::strin
   return result_string;
 }
 
-void TextIndex::Commit() {
+void TextIndex::Refresh(const std::string &index_name) {
   if (!flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
     throw query::TextSearchDisabledException();
   }
 
-  for (auto &[_, index_data] : index_) {
-    mgcxx::text_search::commit(index_data.context_);
+  if (refresh_interval_.count() == 0) return;
+  ApplyPendingChanges(index_name);
+}
+
+void TextIndex::Commit(uint64_t transaction_id) {
+  if (!flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
+    throw query::TextSearchDisabledException();
+  }
+
+  if (refresh_interval_.count() == 0) {
+    for (auto &[_, index_data] : index_) {
+      mgcxx::text_search::commit(index_data.context_);
+    }
+    return;
   }
+
+  // The background writer applies the changes in the order the transactions committed
+  std::lock_guard guard(changes_lock_);
+  auto staged = staged_changes_.find(transaction_id);
+  if (staged == staged_changes_.end()) return;
+  for (auto &[index_name, change] : staged->second) {
+    auto index = index_.find(index_name);
+    if (index == index_.end()) continue;
+    index->second.pending_changes_.push_back(std::move(change));
+  }
+  staged_changes_.erase(staged);
 }
 
-void TextIndex::Rollback() {
+void TextIndex::Rollback(uint64_t transaction_id) {
   if (!flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
     throw query::TextSearchDisabledException();
   }
 
-  for (auto &[_, index_data] : index_) {
-    mgcxx::text_search::rollback(index_data.context_);
+  if (refresh_interval_.count() == 0) {
+    for (auto &[_, index_data] : index_) {
+      mgcxx::text_search::rollback(index_data.context_);
+    }
+    return;
   }
+
+  // Staged changes haven't reached Tantivy, so the changes of other transactions are kept
+  std::lock_guard guard(changes_lock_);
+  staged_changes_.erase(transaction_id);
 }
 
 std::vector<std::pair<std::string, LabelId>> TextIndex::ListIndices() const {
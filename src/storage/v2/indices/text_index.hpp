@@ -11,6 +11,10 @@
 
 #pragma once
 
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+
 #include <json/json.hpp>
 #include "mg_procedure.h"
 #include "storage/v2/id_types.hpp"
@@ -18,15 +22,24 @@
 #include "storage/v2/vertex.hpp"
 #include "storage/v2/vertices_iterable.hpp"
 #include "text_search.hpp"
+#include "utils/scheduler.hpp"
 
 namespace memgraph::query {
 class DbAccessor;
 }
 
 namespace memgraph::storage {
+struct TextIndexChange {
+  std::int64_t gid;
+  // Document to add for the node; the node's document is removed if not set
+  std::optional<std::string> document;
+};
+
 struct TextIndexData {
   mgcxx::text_search::Context context_;
   LabelId scope_;
+  // Changes of committed transactions which the background writer hasn't applied yet
+  std::vector<TextIndexChange> pending_changes_;
 };
 
 class TextIndex {
@@ -43,11 +56,21 @@ class TextIndex {
 
   std::string StringifyProperties(const std::map<PropertyId, PropertyValue> &properties);
 
-  std::vector<mgcxx::text_search::Context *> GetApplicableTextIndices(std::span<storage::LabelId const> labels);
+  std::vector<std::string> GetApplicableTextIndices(std::span<storage::LabelId const> labels);
+
+  std::string MakeDocument(const std::int64_t gid, const nlohmann::json &properties,
+                           const std::string &property_values_as_str);
+
+  void AddDocument(mgcxx::text_search::Context &index_context, const std::string &document);
 
-  void LoadNodeToTextIndices(const std::int64_t gid, const nlohmann::json &properties,
-                             const std::string &property_values_as_str,
-                             const std::vector<mgcxx::text_search::Context *> &applicable_text_indices);
+  void DeleteDocument(mgcxx::text_search::Context &index_context, const std::int64_t gid);
+
+  /// Applies `change` to the index at once, or holds it until the transaction commits if the indices are refreshed in
+  /// the background.
+  void ApplyOrStageChange(const std::string &index_name, TextIndexChange change, uint64_t transaction_id);
+
+  /// Applies the pending changes of the named index, or of all indices, and commits them.
+  void ApplyPendingChanges(const std::optional<std::string> &index_name = std::nullopt);
 
   void CommitLoadedNodes(mgcxx::text_search::Context &index_context);
 
@@ -59,27 +82,29 @@ class TextIndex {
   mgcxx::text_search::SearchOutput SearchAllProperties(const std::string &index_name, const std::string &search_query);
 
  public:
-  TextIndex() = default;
+  /// With a non-zero `refresh_interval`, the changes of a transaction are queued when it commits and a background
+  /// writer applies them in batches once per interval. Searches then see them after the next refresh, unless they
+  /// refresh the index themselves.
+  explicit TextIndex(std::chrono::milliseconds refresh_interval = std::chrono::milliseconds{0});
 
   TextIndex(const TextIndex &) = delete;
   TextIndex(TextIndex &&) = delete;
   TextIndex &operator=(const TextIndex &) = delete;
   TextIndex &operator=(TextIndex &&) = delete;
 
-  ~TextIndex() = default;
+  ~TextIndex();
 
   std::map<std::string, TextIndexData> index_;
   std::map<LabelId, std::string> label_to_index_;
 
-  void AddNode(
-      Vertex *vertex, NameIdMapper *name_id_mapper,
-      const std::optional<std::vector<mgcxx::text_search::Context *>> &maybe_applicable_text_indices = std::nullopt);
+  void AddNode(Vertex *vertex, NameIdMapper *name_id_mapper, uint64_t transaction_id,
+               const std::optional<std::vector<std::string>> &maybe_applicable_text_indices = std::nullopt);
 
-  void UpdateNode(Vertex *vertex, NameIdMapper *name_id_mapper, const std::vector<LabelId> &removed_labels = {});
+  void UpdateNode(Vertex *vertex, NameIdMapper *name_id_mapper, uint64_t transaction_id,
+                  const std::vector<LabelId> &removed_labels = {});
 
-  void RemoveNode(
-      Vertex *vertex,
-      const std::optional<std::vector<mgcxx::text_search::Context *>> &maybe_applicable_text_indices = std::nullopt);
+  void RemoveNode(Vertex *vertex, uint64_t transaction_id,
+                  const std::optional<std::vector<std::string>> &maybe_applicable_text_indices = std::nullopt);
 
   void CreateIndex(std::filesystem::path const &storage_dir, std::string const &index_name, LabelId label,
                    memgraph::storage::VerticesIterable vertices, NameIdMapper *nameIdMapper);
@@ -96,11 +121,25 @@ class TextIndex {
   std::string Aggregate(const std::string &index_name, const std::string &search_query,
                         const std::string &aggregation_query);
 
-  void Commit();
+  /// Applies the committed changes the background writer hasn't applied yet, so that the following searches of the
+  /// index see all committed transactions. Does nothing if the indices are updated at each commit.
+  void Refresh(const std::string &index_name);
+
+  void Commit(uint64_t transaction_id);
 
-  void Rollback();
+  void Rollback(uint64_t transaction_id);
 
   std::vector<std::pair<std::string, LabelId>> ListIndices() const;
+
+ private:
+  std::chrono::milliseconds refresh_interval_;
+  // Changes made by the active transactions, by transaction id
+  std::unordered_map<uint64_t, std::vector<std::pair<std::string, TextIndexChange>>> staged_changes_;
+  // Protects the staged changes and the pending changes of the indices
+  std::mutex changes_lock_;
+  // Serializes applying the pending changes with creating and dropping indices, taken before changes_lock_
+  std::mutex writer_lock_;
+  utils::Scheduler writer_;  //!< Applies the pending changes in the background, stopped first
 };
 
 }  // namespace memgraph::storage
@@ -0,0 +1,294 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/indices/vector_index.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <numeric>
+#include <queue>
+#include <ranges>
+
+#include "storage/v2/vertex.hpp"
+#include "utils/algorithm.hpp"
+
+namespace memgraph::storage {
+
+namespace {
+// Number of neighbours a node is linked to when it is inserted, and the most
+// it can have on the upper layers. The bottom layer allows twice as many.
+constexpr std::size_t kMaxNeighbours = 16;
+constexpr std::size_t kMaxNeighboursBottomLayer = 2 * kMaxNeighbours;
+// Number of the best candidates kept while looking for the neighbours of an
+// inserted node, and the least kept while searching.
+constexpr std::size_t kEfConstruction = 128;
+constexpr std::size_t kEfSearch = 64;
+constexpr std::size_t kMaxLayer = 16;
+
+float Similarity(std::span<float const> lhs, std::span<float const> rhs) {
+  return std::inner_product(lhs.begin(), lhs.end(), rhs.begin(), 0.0F);
+}
+}  // namespace
+
+std::optional<std::vector<float>> NormalizedVector(PropertyValue const &value, uint64_t dimension) {
+  if (!value.IsList()) return std::nullopt;
+  auto const &list = value.ValueList();
+  if (list.size() != dimension) return std::nullopt;
+
+  auto vector = std::vector<float>{};
+  vector.reserve(list.size());
+  for (auto const &element : list) {
+    if (element.IsInt()) {
+      vector.push_back(static_cast<float>(element.ValueInt()));
+    } else if (element.IsDouble()) {
+      vector.push_back(static_cast<float>(element.ValueDouble()));
+    } else {
+      return std::nullopt;
+    }
+  }
+
+  auto const norm = std::sqrt(Similarity(vector, vector));
+  if (norm == 0.0F || !std::isfinite(norm)) return std::nullopt;
+  std::ranges::transform(vector, vector.begin(), [norm](float x) { return x / norm; });
+  return vector;
+}
+
+VectorIndex::VectorIndex(LabelId label, PropertyId property, uint64_t dimension)
+    : label_{label}, property_{property}, dimension_{dimension} {}
+
+std::size_t VectorIndex::Size() const {
+  auto guard = std::shared_lock{lock_};
+  return live_nodes_.size();
+}
+
+void VectorIndex::Insert(Vertex const *vertex) {
+  if (vertex->deleted || !utils::Contains(vertex->labels, label_)) return;
+  auto vector = NormalizedVector(vertex->properties.GetProperty(property_), dimension_);
+  if (!vector) return;
+  auto guard = std::unique_lock{lock_};
+  InsertNode(vertex, *std::move(vector));
+}
+
+void VectorIndex::Update(absl::flat_hash_set<Vertex const *> const &vertices) {
+  auto guard = std::unique_lock{lock_};
+  for (auto const *vertex : vertices) {
+    auto vector = std::invoke([&]() -> std::optional<std::vector<float>> {
+      auto vertex_guard = std::shared_lock{vertex->lock};
+      if (vertex->deleted || !utils::Contains(vertex->labels, label_)) return std::nullopt;
+      return NormalizedVector(vertex->properties.GetProperty(property_), dimension_);
+    });
+    auto it = live_nodes_.find(vertex);
+    if (vector && it != live_nodes_.end() && nodes_[it->second].vector == *vector) continue;
+    RemoveNode(vertex);
+    if (vector) InsertNode(vertex, *std::move(vector));
+  }
+  if (removed_count_ > live_nodes_.size()) Rebuild();
+}
+
+std::vector<Vertex const *> VectorIndex::Search(std::span<float const> query, std::size_t k) const {
+  auto guard = std::shared_lock{lock_};
+  auto result = std::vector<Vertex const *>{};
+  if (k == 0 || !entry_point_) return result;
+
+  auto found = SearchLayer(query, EntryPointsOfLayer(query, 0), std::max(k, kEfSearch), 0);
+  for (auto const &candidate : found) {
+    auto const &node = nodes_[candidate.second];
+    if (node.removed) continue;
+    result.push_back(node.vertex);
+    if (result.size() == k) break;
+  }
+  return result;
+}
+
+void VectorIndex::InsertNode(Vertex const *vertex, std::vector<float> vector) {
+  auto const id = static_cast<NodeId>(nodes_.size());
+  auto const layer = RandomLayer();
+  nodes_.push_back(Node{.vertex = vertex,
+                        .vector = std::move(vector),
+                        .neighbours = std::vector<std::vector<NodeId>>(layer + 1)});
+  live_nodes_.emplace(vertex, id);
+  if (!entry_point_) {
+    entry_point_ = id;
+    top_layer_ = layer;
+    return;
+  }
+
+  // `nodes_` isn't resized below, the span stays valid
+  auto const query = std::span<float const>{nodes_[id].vector};
+  auto const start_layer = std::min(layer, top_layer_);
+  auto entry_points = EntryPointsOfLayer(query, start_layer);
+  for (auto current : std::views::iota(std::size_t{0}, start_layer + 1) | std::views::reverse) {
+    entry_points = SearchLayer(query, std::move(entry_points), kEfConstruction, current);
+    auto const max_neighbours = current == 0 ? kMaxNeighboursBottomLayer : kMaxNeighbours;
+    for (auto const &candidate : entry_points | std::views::take(kMaxNeighbours)) {
+      auto const neighbour = candidate.second;
+      nodes_[id].neighbours[current].push_back(neighbour);
+      auto &back_links = nodes_[neighbour].neighbours[current];
+      back_links.push_back(id);
+      if (back_links.size() > max_neighbours) ShrinkNeighbours(neighbour, current, max_neighbours);
+    }
+  }
+
+  if (layer > top_layer_) {
+    entry_point_ = id;
+    top_layer_ = layer;
+  }
+}
+
+void VectorIndex::RemoveNode(Vertex const *vertex) {
+  auto it = live_nodes_.find(vertex);
+  if (it == live_nodes_.end()) return;
+  nodes_[it->second].removed = true;
+  live_nodes_.erase(it);
+  ++removed_count_;
+}
+
+void VectorIndex::Rebuild() {
+  auto nodes = std::exchange(nodes_, {});
+  live_nodes_.clear();
+  removed_count_ = 0;
+  entry_point_.reset();
+  top_layer_ = 0;
+  for (auto &node : nodes) {
+    if (node.removed) continue;
+    InsertNode(node.vertex, std::move(node.vector));
+  }
+}
+
+std::size_t VectorIndex::RandomLayer() {
+  // Each layer holds about 1 / kMaxNeighbours of the nodes of the one below
+  static double const level_multiplier = 1.0 / std::log(static_cast<double>(kMaxNeighbours));
+  auto distribution = std::uniform_real_distribution<double>{0.0, 1.0};
+  auto const layer = static_cast<std::size_t>(-std::log(1.0 - distribution(random_)) * level_multiplier);
+  return std::min(layer, kMaxLayer);
+}
+
+auto VectorIndex::EntryPointsOfLayer(std::span<float const> query, std::size_t layer) const
+    -> std::vector<Candidate> {
+  auto entry_points = std::vector{Candidate{Similarity(query, nodes_[*entry_point_].vector), *entry_point_}};
+  // Greedy descent through the upper layers, keeping only the closest node
+  for (auto current = top_layer_; current > layer; --current) {
+    entry_points = SearchLayer(query, std::move(entry_points), 1, current);
+  }
+  return entry_points;
+}
+
+auto VectorIndex::SearchLayer(std::span<float const> query, std::vector<Candidate> entry_points, std::size_t ef,
+                              std::size_t layer) const -> std::vector<Candidate> {
+  auto visited = absl::flat_hash_set<NodeId>{};
+  // The most similar candidate not yet expanded is on top
+  auto candidates = std::priority_queue<Candidate>{};
+  // The least similar of the best `ef` found so far is on top
+  auto found = std::priority_queue<Candidate, std::vector<Candidate>, std::greater<>>{};
+
+  for (auto const &entry_point : entry_points) {
+    if (!visited.insert(entry_point.second).second) continue;
+    candidates.push(entry_point);
+    found.push(entry_point);
+    if (found.size() > ef) found.pop();
+  }
+
+  while (!candidates.empty()) {
+    auto const [similarity, id] = candidates.top();
+    if (found.size() >= ef && similarity < found.top().first) break;
+    candidates.pop();
+    for (auto neighbour : nodes_[id].neighbours[layer]) {
+      if (!visited.insert(neighbour).second) continue;
+      auto const neighbour_similarity = Similarity(query, nodes_[neighbour].vector);
+      if (found.size() >= ef && neighbour_similarity <= found.top().first) continue;
+      candidates.emplace(neighbour_similarity, neighbour);
+      found.emplace(neighbour_similarity, neighbour);
+      if (found.size() > ef) found.pop();
+    }
+  }
+
+  auto result = std::vector<Candidate>(found.size());
+  for (auto it = result.rbegin(); it != result.rend(); ++it) {
+    *it = found.top();
+    found.pop();
+  }
+  return result;
+}
+
+void VectorIndex::ShrinkNeighbours(NodeId id, std::size_t layer, std::size_t max_neighbours) {
+  auto &links = nodes_[id].neighbours[layer];
+  auto ranked = std::vector<Candidate>{};
+  ranked.reserve(links.size());
+  for (auto neighbour : links) {
+    ranked.emplace_back(Similarity(nodes_[id].vector, nodes_[neighbour].vector), neighbour);
+  }
+  std::ranges::partial_sort(ranked, ranked.begin() + static_cast<std::ptrdiff_t>(max_neighbours), std::greater<>{});
+  links.clear();
+  for (auto const &candidate : ranked | std::views::take(max_neighbours)) {
+    links.push_back(candidate.second);
+  }
+}
+
+bool VectorIndexStorage::CreateIndex(VectorIndexSpec const &spec, utils::SkipList<Vertex>::Accessor vertices) {
+  auto key = LabelPropKey{spec.label, spec.property};
+  if (indices_.contains(key)) return false;
+
+  auto index = std::make_unique<VectorIndex>(spec.label, spec.property, spec.dimension);
+  for (auto const &vertex : vertices) {
+    index->Insert(&vertex);
+  }
+  indices_.emplace(key, std::move(index));
+  return true;
+}
+
+bool VectorIndexStorage::DropIndex(LabelId label, PropertyId property) {
+  return indices_.erase(LabelPropKey{label, property}) != 0;
+}
+
+std::vector<LabelPropKey> VectorIndexStorage::IndexKeys() const {
+  auto keys = indices_ | std::views::keys;
+  return {keys.begin(), keys.end()};
+}
+
+void VectorIndexStorage::ApplyChanges(VectorIndexChangeCollector const &collector) {
+  for (auto const &[key, vertices] : collector.Changes()) {
+    if (vertices.empty()) continue;
+    auto it = indices_.find(key);
+    if (it == indices_.end()) continue;
+    it->second->Update(vertices);
+  }
+}
+
+std::optional<uint64_t> VectorIndexStorage::IndexDimension(LabelId label, PropertyId property) const {
+  auto it = indices_.find(LabelPropKey{label, property});
+  if (it == indices_.end()) return std::nullopt;
+  return it->second->Dimension();
+}
+
+std::vector<Vertex const *> VectorIndexStorage::Search(LabelId label, PropertyId property,
+                                                       std::span<float const> query, std::size_t k) const {
+  auto it = indices_.find(LabelPropKey{label, property});
+  if (it == indices_.end()) return {};
+  return it->second->Search(query, k);
+}
+
+std::vector<VectorIndexSpec> VectorIndexStorage::ListIndices() const {
+  auto specs = indices_ | std::views::transform([](auto const &entry) {
+                 return VectorIndexSpec{entry.first.label(), entry.first.property(), entry.second->Dimension()};
+               });
+  return {specs.begin(), specs.end()};
+}
+
+uint64_t VectorIndexStorage::ApproximateVectorCount(LabelId label, PropertyId property) const {
+  auto it = indices_.find(LabelPropKey{label, property});
+  if (it == indices_.end()) return 0;
+  return it->second->Size();
+}
+
+void VectorIndexStorage::Clear() { indices_.clear(); }
+
+}  // namespace memgraph::storage
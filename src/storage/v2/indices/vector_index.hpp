@@ -0,0 +1,140 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <random>
+#include <shared_mutex>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
+
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/indices/vector_index_change_collector.hpp"
+#include "storage/v2/indices/vector_index_spec.hpp"
+#include "storage/v2/property_value.hpp"
+#include "utils/skip_list.hpp"
+
+namespace memgraph::storage {
+
+struct Vertex;
+
+/// Returns `value` scaled to unit length if it is a list of exactly
+/// `dimension` numbers which aren't all zero, `std::nullopt` otherwise.
+std::optional<std::vector<float>> NormalizedVector(PropertyValue const &value, uint64_t dimension);
+
+/// Approximate nearest neighbour index over a list property of a label, a
+/// hierarchical navigable small world (HNSW) graph. Vectors are normalized
+/// when inserted, so the cosine similarity of two of them is their dot
+/// product.
+///
+/// Entries of updated or removed vertices are only marked as removed, they
+/// still route the searches. The graph is built anew once the removed
+/// entries outnumber the live ones.
+class VectorIndex {
+ public:
+  VectorIndex(LabelId label, PropertyId property, uint64_t dimension);
+
+  uint64_t Dimension() const { return dimension_; }
+
+  /// Number of the indexed vertices.
+  std::size_t Size() const;
+
+  /// Inserts `vertex` with its current vector, if it has one. Doesn't lock
+  /// the vertex, used while building the index under unique access.
+  void Insert(Vertex const *vertex);
+
+  /// Brings the entries of `vertices` in line with their current state. Must
+  /// be called while no other transaction can modify the vertices.
+  void Update(absl::flat_hash_set<Vertex const *> const &vertices);
+
+  /// Returns up to `k` vertices whose vectors have the highest approximate
+  /// cosine similarity to the normalized `query`, most similar first.
+  std::vector<Vertex const *> Search(std::span<float const> query, std::size_t k) const;
+
+ private:
+  using NodeId = uint32_t;
+  // Similarity to the searched vector and the node.
+  using Candidate = std::pair<float, NodeId>;
+
+  struct Node {
+    Vertex const *vertex;
+    std::vector<float> vector;
+    // Neighbours of the node on each of the layers it is in, starting with
+    // the bottom one.
+    std::vector<std::vector<NodeId>> neighbours;
+    bool removed{false};
+  };
+
+  void InsertNode(Vertex const *vertex, std::vector<float> vector);
+  void RemoveNode(Vertex const *vertex);
+  void Rebuild();
+
+  std::size_t RandomLayer();
+
+  std::vector<Candidate> SearchLayer(std::span<float const> query, std::vector<Candidate> entry_points,
+                                     std::size_t ef, std::size_t layer) const;
+
+  std::vector<Candidate> EntryPointsOfLayer(std::span<float const> query, std::size_t layer) const;
+
+  void ShrinkNeighbours(NodeId id, std::size_t layer, std::size_t max_neighbours);
+
+  LabelId label_;
+  PropertyId property_;
+  uint64_t dimension_;
+
+  std::vector<Node> nodes_;
+  absl::flat_hash_map<Vertex const *, NodeId> live_nodes_;
+  std::size_t removed_count_{0};
+  std::optional<NodeId> entry_point_;
+  std::size_t top_layer_{0};
+  std::mt19937 random_;
+
+  mutable std::shared_mutex lock_;
+};
+
+struct VectorIndexStorage {
+  // Query (modify index set)
+  bool CreateIndex(VectorIndexSpec const &spec, utils::SkipList<Vertex>::Accessor vertices);
+  bool DropIndex(LabelId label, PropertyId property);
+
+  // Transaction (establish what to collect)
+  std::vector<LabelPropKey> IndexKeys() const;
+
+  // Commit
+  void ApplyChanges(VectorIndexChangeCollector const &collector);
+
+  std::optional<uint64_t> IndexDimension(LabelId label, PropertyId property) const;
+
+  /// Returns up to `k` vertices indexed under `label` and `property` which
+  /// are the most similar to the normalized `query`. The returned vertices
+  /// still need a visibility check.
+  std::vector<Vertex const *> Search(LabelId label, PropertyId property, std::span<float const> query,
+                                     std::size_t k) const;
+
+  std::vector<VectorIndexSpec> ListIndices() const;
+
+  uint64_t ApproximateVectorCount(LabelId label, PropertyId property) const;
+
+  void Clear();
+
+ private:
+  std::map<LabelPropKey, std::unique_ptr<VectorIndex>> indices_;
+};
+
+}  // namespace memgraph::storage
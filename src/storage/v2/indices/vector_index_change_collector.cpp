@@ -0,0 +1,65 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/indices/vector_index_change_collector.hpp"
+
+#include <algorithm>
+#include <ranges>
+
+#include "storage/v2/vertex.hpp"
+#include "utils/algorithm.hpp"
+
+namespace memgraph::storage {
+
+VectorIndexChangeCollector::VectorIndexChangeCollector(std::vector<LabelPropKey> const &index_keys) {
+  for (auto const &key : index_keys) {
+    changes_.try_emplace(key);
+  }
+}
+
+void VectorIndexChangeCollector::UpdateOnChangeLabel(LabelId label, Vertex const *vertex) {
+  if (changes_.empty()) return;
+
+  for (auto &[key, vertices] : changes_) {
+    if (key.label() != label) continue;
+    // Without the property the vertex isn't indexed before nor after the change
+    if (!vertex->properties.HasProperty(key.property())) continue;
+    vertices.insert(vertex);
+  }
+}
+
+void VectorIndexChangeCollector::UpdateOnSetProperty(PropertyId prop_id, PropertyValue const &old_value,
+                                                     PropertyValue const &new_value, Vertex const *vertex) {
+  if (changes_.empty()) return;
+  if (!(old_value.IsList() || new_value.IsList())) return;
+
+  for (auto label : vertex->labels) {
+    auto it = changes_.find(LabelPropKey{label, prop_id});
+    if (it != changes_.end()) {
+      it->second.insert(vertex);
+    }
+  }
+}
+
+void VectorIndexChangeCollector::UpdateOnDeleteVertex(Vertex const *vertex) {
+  if (changes_.empty()) return;
+
+  for (auto &[key, vertices] : changes_) {
+    if (!utils::Contains(vertex->labels, key.label())) continue;
+    vertices.insert(vertex);
+  }
+}
+
+bool VectorIndexChangeCollector::AnyChanges() const {
+  return std::ranges::any_of(changes_ | std::views::values, [](auto const &vertices) { return !vertices.empty(); });
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,52 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/property_value.hpp"
+
+#include <map>
+#include <vector>
+
+#include "absl/container/flat_hash_set.h"
+
+namespace memgraph::storage {
+
+struct Vertex;
+
+/// Collects the vertices a transaction changed in a way that can affect one
+/// of the vector indices which existed when it started. The vector indices
+/// are brought up to date with the collected vertices when the transaction
+/// commits.
+struct VectorIndexChangeCollector {
+  using ChangedVertices = std::map<LabelPropKey, absl::flat_hash_set<Vertex const *>>;
+
+  VectorIndexChangeCollector() = default;
+
+  explicit VectorIndexChangeCollector(std::vector<LabelPropKey> const &index_keys);
+
+  void UpdateOnChangeLabel(LabelId label, Vertex const *vertex);
+
+  void UpdateOnSetProperty(PropertyId prop_id, const PropertyValue &old_value, const PropertyValue &new_value,
+                           Vertex const *vertex);
+
+  void UpdateOnDeleteVertex(Vertex const *vertex);
+
+  bool AnyChanges() const;
+
+  auto Changes() const -> ChangedVertices const & { return changes_; }
+
+ private:
+  ChangedVertices changes_;
+};
+
+}  // namespace memgraph::storage
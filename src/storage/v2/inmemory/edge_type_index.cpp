@@ -154,6 +154,34 @@ void InMemoryEdgeTypeIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_t
   }
 }
 
+void InMemoryEdgeTypeIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp,
+                                                  std::span<IndexCleanupCollector::DeletedEdge const> deleted_edges,
+                                                  std::stop_token token) {
+  uint64_t entries = 0;
+  for (const auto &[edge_type, edge_type_storage] : index_) entries += edge_type_storage.size();
+  if (static_cast<double>(deleted_edges.size()) > kTargetedIndexCleanupRatio * static_cast<double>(entries)) {
+    RemoveObsoleteEntries(oldest_active_start_timestamp, token);
+    return;
+  }
+
+  auto maybe_stop = utils::ResettableCounter<2048>();
+  for (const auto &[edge_type, from_vertex, to_vertex, edge] : deleted_edges) {
+    if (maybe_stop() && token.stop_requested()) return;
+    auto it = index_.find(edge_type);
+    if (it == index_.end()) continue;
+
+    // The edge was deleted by a transaction older than every active one, none of its entries is visible anymore
+    auto edges_acc = it->second.access();
+    const auto endpoints = std::make_pair(from_vertex->gid, to_vertex->gid);
+    for (auto entry = edges_acc.find_equal_or_greater(endpoints); entry != edges_acc.end() && *entry == endpoints;) {
+      auto next_entry = entry;
+      ++next_entry;
+      if (entry->edge == edge) edges_acc.remove(*entry);
+      entry = next_entry;
+    }
+  }
+}
+
 uint64_t InMemoryEdgeTypeIndex::ApproximateEdgeCount(EdgeTypeId edge_type) const {
   if (auto it = index_.find(edge_type); it != index_.end()) {
     return it->second.size();
@@ -198,13 +226,22 @@ void InMemoryEdgeTypeIndex::UpdateOnEdgeModification(Vertex *old_from, Vertex *o
 void InMemoryEdgeTypeIndex::DropGraphClearIndices() { index_.clear(); }
 
 InMemoryEdgeTypeIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor, EdgeTypeId edge_type,
-                                          View view, Storage *storage, Transaction *transaction)
+                                          std::optional<std::pair<Gid, Gid>> endpoints, View view, Storage *storage,
+                                          Transaction *transaction)
     : index_accessor_(std::move(index_accessor)),
       edge_type_(edge_type),
+      endpoints_(endpoints),
       view_(view),
       storage_(storage),
       transaction_(transaction) {}
 
+InMemoryEdgeTypeIndex::Iterable::Iterator InMemoryEdgeTypeIndex::Iterable::begin() {
+  if (endpoints_) {
+    return {this, index_accessor_.find_equal_or_greater(*endpoints_)};
+  }
+  return {this, index_accessor_.begin()};
+}
+
 InMemoryEdgeTypeIndex::Iterable::Iterator::Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator)
     : self_(self),
       index_iterator_(index_iterator),
@@ -221,6 +258,12 @@ InMemoryEdgeTypeIndex::Iterable::Iterator &InMemoryEdgeTypeIndex::Iterable::Iter
 
 void InMemoryEdgeTypeIndex::Iterable::Iterator::AdvanceUntilValid() {
   for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
+    if (self_->endpoints_ && !(*index_iterator_ == *self_->endpoints_)) {
+      // The edges between the endpoints are adjacent
+      index_iterator_ = self_->index_accessor_.end();
+      break;
+    }
+
     if (index_iterator_->edge == current_edge_.ptr) {
       continue;
     }
@@ -251,11 +294,27 @@ void InMemoryEdgeTypeIndex::RunGC() {
   }
 }
 
+std::vector<std::pair<EdgeTypeId, uint64_t>> InMemoryEdgeTypeIndex::GarbageSizes() const {
+  std::vector<std::pair<EdgeTypeId, uint64_t>> garbage_sizes;
+  garbage_sizes.reserve(index_.size());
+  for (const auto &[key, index] : index_) {
+    garbage_sizes.emplace_back(key, index.garbage_size());
+  }
+  return garbage_sizes;
+}
+
 InMemoryEdgeTypeIndex::Iterable InMemoryEdgeTypeIndex::Edges(EdgeTypeId edge_type, View view, Storage *storage,
                                                              Transaction *transaction) {
   const auto it = index_.find(edge_type);
   MG_ASSERT(it != index_.end(), "Index for edge-type {} doesn't exist", edge_type.AsUint());
-  return {it->second.access(), edge_type, view, storage, transaction};
+  return {it->second.access(), edge_type, std::nullopt, view, storage, transaction};
+}
+
+InMemoryEdgeTypeIndex::Iterable InMemoryEdgeTypeIndex::Edges(EdgeTypeId edge_type, Gid from, Gid to, View view,
+                                                             Storage *storage, Transaction *transaction) {
+  const auto it = index_.find(edge_type);
+  MG_ASSERT(it != index_.end(), "Index for edge-type {} doesn't exist", edge_type.AsUint());
+  return {it->second.access(), edge_type, std::make_pair(from, to), view, storage, transaction};
 }
 
 std::vector<EdgeTypeId> InMemoryEdgeTypeIndex::Analysis() const {
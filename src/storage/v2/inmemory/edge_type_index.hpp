@@ -12,12 +12,16 @@
 #pragma once
 
 #include <map>
+#include <optional>
+#include <span>
 #include <utility>
+#include <vector>
 
 #include "storage/v2/constraints/constraints.hpp"
 #include "storage/v2/edge_accessor.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/indices/edge_type_index.hpp"
+#include "storage/v2/indices/index_cleanup_collector.hpp"
 #include "storage/v2/indices/label_index_stats.hpp"
 #include "storage/v2/vertex_accessor.hpp"
 #include "utils/rw_lock.hpp"
@@ -35,14 +39,24 @@ class InMemoryEdgeTypeIndex : public storage::EdgeTypeIndex {
 
     uint64_t timestamp;
 
+    // Entries are sorted by the endpoints first, so all edges between a pair
+    // of vertices are adjacent and can be found without scanning them.
     bool operator<(const Entry &rhs) const {
-      return std::tie(edge->gid, from_vertex->gid, to_vertex->gid, timestamp) <
-             std::tie(rhs.edge->gid, rhs.from_vertex->gid, rhs.to_vertex->gid, rhs.timestamp);
+      return std::tie(from_vertex->gid, to_vertex->gid, edge->gid, timestamp) <
+             std::tie(rhs.from_vertex->gid, rhs.to_vertex->gid, rhs.edge->gid, rhs.timestamp);
     }
     bool operator==(const Entry &rhs) const {
       return std::tie(edge, from_vertex, to_vertex, timestamp) ==
              std::tie(rhs.edge, rhs.from_vertex, rhs.to_vertex, rhs.timestamp);
     }
+
+    // Compare only the endpoints, used for endpoint lookups.
+    bool operator<(const std::pair<Gid, Gid> &endpoints) const {
+      return std::tie(from_vertex->gid, to_vertex->gid) < std::tie(endpoints.first, endpoints.second);
+    }
+    bool operator==(const std::pair<Gid, Gid> &endpoints) const {
+      return from_vertex->gid == endpoints.first && to_vertex->gid == endpoints.second;
+    }
   };
 
  public:
@@ -60,6 +74,12 @@ class InMemoryEdgeTypeIndex : public storage::EdgeTypeIndex {
 
   void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp, std::stop_token token);
 
+  /// Removes the entries of the deleted edges by looking them up by their
+  /// endpoints. Falls back to the full scan once the lookups would be more than
+  /// `kTargetedIndexCleanupRatio` of the entries.
+  void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp,
+                             std::span<IndexCleanupCollector::DeletedEdge const> deleted_edges, std::stop_token token);
+
   void AbortEntries(EdgeTypeId edge_type, std::span<std::tuple<Vertex *const, Vertex *const, Edge *const> const> edges,
                     uint64_t exact_start_timestamp);
 
@@ -81,8 +101,8 @@ class InMemoryEdgeTypeIndex : public storage::EdgeTypeIndex {
 
   class Iterable {
    public:
-    Iterable(utils::SkipList<Entry>::Accessor index_accessor, EdgeTypeId edge_type, View view, Storage *storage,
-             Transaction *transaction);
+    Iterable(utils::SkipList<Entry>::Accessor index_accessor, EdgeTypeId edge_type,
+             std::optional<std::pair<Gid, Gid>> endpoints, View view, Storage *storage, Transaction *transaction);
 
     class Iterator {
      public:
@@ -104,12 +124,14 @@ class InMemoryEdgeTypeIndex : public storage::EdgeTypeIndex {
       EdgeAccessor current_accessor_;
     };
 
-    Iterator begin() { return {this, index_accessor_.begin()}; }
+    Iterator begin();
     Iterator end() { return {this, index_accessor_.end()}; }
 
    private:
     utils::SkipList<Entry>::Accessor index_accessor_;
     [[maybe_unused]] EdgeTypeId edge_type_;
+    // When set, only the edges from the first to the second vertex are returned.
+    std::optional<std::pair<Gid, Gid>> endpoints_;
     View view_;
     Storage *storage_;
     Transaction *transaction_;
@@ -117,8 +139,15 @@ class InMemoryEdgeTypeIndex : public storage::EdgeTypeIndex {
 
   void RunGC();
 
+  /// Removed entries of each index which are waiting for the garbage
+  /// collection of its skip list.
+  std::vector<std::pair<EdgeTypeId, uint64_t>> GarbageSizes() const;
+
   Iterable Edges(EdgeTypeId edge_type, View view, Storage *storage, Transaction *transaction);
 
+  /// Returns the edges of `edge_type` going from `from` to `to`.
+  Iterable Edges(EdgeTypeId edge_type, Gid from, Gid to, View view, Storage *storage, Transaction *transaction);
+
  private:
   std::map<EdgeTypeId, utils::SkipList<Entry>> index_;  // This should be a std::map because we use it with assumption
                                                         // that it's sorted
@@ -460,6 +460,16 @@ void InMemoryEdgeTypePropertyIndex::RunGC() {
   }
 }
 
+std::vector<std::pair<std::pair<EdgeTypeId, PropertyId>, uint64_t>> InMemoryEdgeTypePropertyIndex::GarbageSizes()
+    const {
+  std::vector<std::pair<std::pair<EdgeTypeId, PropertyId>, uint64_t>> garbage_sizes;
+  garbage_sizes.reserve(index_.size());
+  for (const auto &[key, index] : index_) {
+    garbage_sizes.emplace_back(key, index.garbage_size());
+  }
+  return garbage_sizes;
+}
+
 InMemoryEdgeTypePropertyIndex::Iterable InMemoryEdgeTypePropertyIndex::Edges(
     EdgeTypeId edge_type, PropertyId property, const std::optional<utils::Bound<PropertyValue>> &lower_bound,
     const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Storage *storage,
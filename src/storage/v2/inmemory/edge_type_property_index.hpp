@@ -14,6 +14,7 @@
 #include <cstdint>
 #include <map>
 #include <utility>
+#include <vector>
 
 #include "storage/v2/constraints/constraints.hpp"
 #include "storage/v2/edge_accessor.hpp"
@@ -137,6 +138,10 @@ class InMemoryEdgeTypePropertyIndex : public storage::EdgeTypePropertyIndex {
 
   void RunGC();
 
+  /// Removed entries of each index which are waiting for the garbage
+  /// collection of its skip list.
+  std::vector<std::pair<std::pair<EdgeTypeId, PropertyId>, uint64_t>> GarbageSizes() const;
+
   Iterable Edges(EdgeTypeId edge_type, PropertyId property,
                  const std::optional<utils::Bound<PropertyValue>> &lower_bound,
                  const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Storage *storage,
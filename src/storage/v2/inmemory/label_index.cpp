@@ -14,6 +14,7 @@
 #include <span>
 
 #include "storage/v2/constraints/constraints.hpp"
+#include "storage/v2/indices/index_cleanup_collector.hpp"
 #include "storage/v2/indices/indices_utils.hpp"
 #include "storage/v2/inmemory/storage.hpp"
 #include "utils/counter.hpp"
@@ -25,19 +26,24 @@ void InMemoryLabelIndex::UpdateOnAddLabel(LabelId added_label, Vertex *vertex_af
   if (it == index_.end()) return;
   auto acc = it->second.access();
   acc.insert(Entry{vertex_after_update, tx.start_timestamp});
+  modifications_.at(added_label).fetch_add(1, std::memory_order_relaxed);
 }
 
 bool InMemoryLabelIndex::CreateIndex(
     LabelId label, utils::SkipList<Vertex>::Accessor vertices,
-    const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info) {
-  const auto create_index_seq = [this](LabelId label, utils::SkipList<Vertex>::Accessor &vertices,
-                                       std::map<LabelId, utils::SkipList<Entry>>::iterator it) {
+    const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info, uint64_t thread_count) {
+  const auto create_index_seq = [this, thread_count](LabelId label, utils::SkipList<Vertex>::Accessor &vertices,
+                                                     std::map<LabelId, utils::SkipList<Entry>>::iterator it) {
     using IndexAccessor = decltype(it->second.access());
 
-    CreateIndexOnSingleThread(vertices, it, index_, label,
-                              [](Vertex &vertex, LabelId label, IndexAccessor &index_accessor) {
-                                TryInsertLabelIndex(vertex, label, index_accessor);
-                              });
+    const auto insert = [](Vertex &vertex, LabelId label, IndexAccessor &index_accessor) {
+      TryInsertLabelIndex(vertex, label, index_accessor);
+    };
+    if (thread_count > 1) {
+      CreateIndexOnChunks(vertices, it, index_, label, thread_count, insert);
+    } else {
+      CreateIndexOnSingleThread(vertices, it, index_, label, insert);
+    }
 
     return true;
   };
@@ -60,6 +66,7 @@ bool InMemoryLabelIndex::CreateIndex(
     // Index already exists.
     return false;
   }
+  modifications_.try_emplace(label);
 
   if (parallel_exec_info) {
     return create_index_par(label, vertices, it, *parallel_exec_info);
@@ -67,7 +74,10 @@ bool InMemoryLabelIndex::CreateIndex(
   return create_index_seq(label, vertices, it);
 }
 
-bool InMemoryLabelIndex::DropIndex(LabelId label) { return index_.erase(label) > 0; }
+bool InMemoryLabelIndex::DropIndex(LabelId label) {
+  modifications_.erase(label);
+  return index_.erase(label) > 0;
+}
 
 bool InMemoryLabelIndex::IndexExists(LabelId label) const { return index_.find(label) != index_.end(); }
 
@@ -100,9 +110,12 @@ void InMemoryLabelIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_time
         continue;
       }
 
-      if ((next_it != vertices_acc.end() && it->vertex == next_it->vertex) ||
-          !AnyVersionHasLabel(*it->vertex, label_storage.first, oldest_active_start_timestamp)) {
+      if (next_it != vertices_acc.end() && it->vertex == next_it->vertex) {
         vertices_acc.remove(*it);
+      } else if (!AnyVersionHasLabel(*it->vertex, label_storage.first, oldest_active_start_timestamp)) {
+        // The label was removed or the vertex deleted
+        vertices_acc.remove(*it);
+        modifications_.at(label_storage.first).fetch_add(1, std::memory_order_relaxed);
       }
 
       it = next_it;
@@ -110,6 +123,55 @@ void InMemoryLabelIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_time
   }
 }
 
+void InMemoryLabelIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp,
+                                               std::span<std::pair<LabelId, Vertex *> const> label_changes,
+                                               std::span<Vertex *const> deleted_vertices, std::stop_token token) {
+  // Each deleted vertex is looked up in every index, its entries of the labels removed earlier are obsolete too
+  uint64_t entries = 0;
+  for (const auto &[label, label_storage] : index_) entries += label_storage.size();
+  const auto lookups = label_changes.size() + (deleted_vertices.size() * index_.size());
+  if (static_cast<double>(lookups) > kTargetedIndexCleanupRatio * static_cast<double>(entries)) {
+    RemoveObsoleteEntries(oldest_active_start_timestamp, token);
+    return;
+  }
+
+  for (const auto &[label, vertex] : label_changes) {
+    if (token.stop_requested()) return;
+    auto it = index_.find(label);
+    if (it == index_.end()) continue;
+    auto vertices_acc = it->second.access();
+    RemoveObsoleteEntriesOf(vertices_acc, label, vertex, oldest_active_start_timestamp);
+  }
+  for (auto &[label, label_storage] : index_) {
+    if (token.stop_requested()) return;
+    auto vertices_acc = label_storage.access();
+    for (auto *vertex : deleted_vertices) {
+      RemoveObsoleteEntriesOf(vertices_acc, label, vertex, oldest_active_start_timestamp);
+    }
+  }
+}
+
+void InMemoryLabelIndex::RemoveObsoleteEntriesOf(utils::SkipList<Entry>::Accessor &vertices_acc, LabelId label,
+                                                 Vertex *vertex, uint64_t oldest_active_start_timestamp) {
+  // The entries of a vertex are adjacent and ordered by their timestamp, the same rules as in the full scan apply
+  auto it = vertices_acc.find_equal_or_greater(Entry{vertex, 0});
+  while (it != vertices_acc.end() && it->vertex == vertex) {
+    auto next_it = it;
+    ++next_it;
+
+    if (it->timestamp < oldest_active_start_timestamp) {
+      if (next_it != vertices_acc.end() && next_it->vertex == vertex) {
+        vertices_acc.remove(*it);
+      } else if (!AnyVersionHasLabel(*vertex, label, oldest_active_start_timestamp)) {
+        vertices_acc.remove(*it);
+        modifications_.at(label).fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+
+    it = next_it;
+  }
+}
+
 void InMemoryLabelIndex::AbortEntries(LabelId labelId, std::span<Vertex *const> vertices,
                                       uint64_t exact_start_timestamp) {
   auto const it = index_.find(labelId);
@@ -132,6 +194,19 @@ InMemoryLabelIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_ac
       storage_(storage),
       transaction_(transaction) {}
 
+InMemoryLabelIndex::Iterable::Iterable(utils::SkipList<Entry>::Accessor index_accessor,
+                                       utils::SkipList<Vertex>::ConstAccessor vertices_accessor, LabelId label,
+                                       View view, Storage *storage, Transaction *transaction, Vertex *lower_bound,
+                                       Vertex *upper_bound)
+    : pin_accessor_(std::move(vertices_accessor)),
+      index_accessor_(std::move(index_accessor)),
+      label_(label),
+      view_(view),
+      storage_(storage),
+      transaction_(transaction),
+      lower_bound_(lower_bound),
+      upper_bound_(upper_bound) {}
+
 InMemoryLabelIndex::Iterable::Iterator::Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator)
     : self_(self),
       index_iterator_(index_iterator),
@@ -148,6 +223,12 @@ InMemoryLabelIndex::Iterable::Iterator &InMemoryLabelIndex::Iterable::Iterator::
 
 void InMemoryLabelIndex::Iterable::Iterator::AdvanceUntilValid() {
   for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
+    if (self_->upper_bound_ && !std::less<>{}(index_iterator_->vertex, self_->upper_bound_)) {
+      // Reached the end of the chunk, the rest belongs to some other iterable.
+      index_iterator_ = self_->index_accessor_.end();
+      break;
+    }
+
     if (index_iterator_->vertex == current_vertex_) {
       continue;
     }
@@ -166,18 +247,50 @@ void InMemoryLabelIndex::Iterable::Iterator::AdvanceUntilValid() {
   }
 }
 
+uint64_t InMemoryLabelIndex::Iterable::Count() {
+  uint64_t count = 0;
+  const Vertex *counted_vertex = nullptr;
+  auto it = lower_bound_ ? index_accessor_.find_equal_or_greater(Entry{lower_bound_, 0}) : index_accessor_.begin();
+  for (; it != index_accessor_.end(); ++it) {
+    if (upper_bound_ && !std::less<>{}(it->vertex, upper_bound_)) break;
+    // Same checks as `AdvanceUntilValid`, but the visible version is read
+    // straight from the vertex and its delta chain.
+    if (it->vertex == counted_vertex) continue;
+    if (!CanSeeEntityWithTimestamp(it->timestamp, transaction_)) continue;
+    if (CurrentVersionHasLabel(*it->vertex, label_, transaction_, view_)) {
+      counted_vertex = it->vertex;
+      ++count;
+    }
+  }
+  return count;
+}
+
 uint64_t InMemoryLabelIndex::ApproximateVertexCount(LabelId label) const {
   auto it = index_.find(label);
   MG_ASSERT(it != index_.end(), "Index for label {} doesn't exist", label.AsUint());
   return it->second.size();
 }
 
+uint64_t InMemoryLabelIndex::ModificationCount(LabelId label) const {
+  auto it = modifications_.find(label);
+  return it == modifications_.end() ? 0 : it->second.load(std::memory_order_relaxed);
+}
+
 void InMemoryLabelIndex::RunGC() {
   for (auto &index_entry : index_) {
     index_entry.second.run_gc();
   }
 }
 
+std::vector<std::pair<LabelId, uint64_t>> InMemoryLabelIndex::GarbageSizes() const {
+  std::vector<std::pair<LabelId, uint64_t>> garbage_sizes;
+  garbage_sizes.reserve(index_.size());
+  for (const auto &[key, index] : index_) {
+    garbage_sizes.emplace_back(key, index.garbage_size());
+  }
+  return garbage_sizes;
+}
+
 InMemoryLabelIndex::Iterable InMemoryLabelIndex::Vertices(LabelId label, View view, Storage *storage,
                                                           Transaction *transaction) {
   DMG_ASSERT(storage->storage_mode_ == StorageMode::IN_MEMORY_TRANSACTIONAL ||
@@ -197,6 +310,40 @@ InMemoryLabelIndex::Iterable InMemoryLabelIndex::Vertices(
   return {it->second.access(), std::move(vertices_acc), label, view, storage, transaction};
 }
 
+std::vector<InMemoryLabelIndex::Iterable> InMemoryLabelIndex::ChunkedVertices(LabelId label, View view,
+                                                                              Storage *storage,
+                                                                              Transaction *transaction,
+                                                                              size_t num_chunks) {
+  const auto it = index_.find(label);
+  MG_ASSERT(it != index_.end(), "Index for label {} doesn't exist", label.AsUint());
+  const auto *mem_storage = static_cast<InMemoryStorage const *>(storage);
+
+  // Chunks are split at vertices rather than index entries because entries
+  // of the same vertex are adjacent and must end up in the same chunk.
+  std::vector<Vertex *> boundaries;
+  {
+    auto index_acc = it->second.access();
+    for (const auto &chunk : index_acc.chunks(num_chunks)) {
+      const auto *upper = chunk.upper();
+      if (upper == nullptr) continue;
+      if (!boundaries.empty() && boundaries.back() == upper->vertex) continue;
+      boundaries.push_back(upper->vertex);
+    }
+  }
+
+  std::vector<Iterable> chunks;
+  chunks.reserve(boundaries.size() + 1);
+  Vertex *lower_bound = nullptr;
+  for (auto *upper_bound : boundaries) {
+    chunks.emplace_back(it->second.access(), mem_storage->vertices_.access(), label, view, storage, transaction,
+                        lower_bound, upper_bound);
+    lower_bound = upper_bound;
+  }
+  chunks.emplace_back(it->second.access(), mem_storage->vertices_.access(), label, view, storage, transaction,
+                      lower_bound, nullptr);
+  return chunks;
+}
+
 void InMemoryLabelIndex::SetIndexStats(const storage::LabelId &label, const storage::LabelIndexStats &stats) {
   auto locked_stats = stats_.Lock();
   locked_stats->insert_or_assign(label, stats);
@@ -243,6 +390,7 @@ std::vector<LabelId> InMemoryLabelIndex::Analysis() const {
 
 void InMemoryLabelIndex::DropGraphClearIndices() {
   index_.clear();
+  modifications_.clear();
   stats_->clear();
 }
 
@@ -11,7 +11,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <span>
+#include <utility>
 
 #include "storage/v2/constraints/constraints.hpp"
 #include "storage/v2/durability/recovery_type.hpp"
@@ -43,9 +45,12 @@ class InMemoryLabelIndex : public storage::LabelIndex {
 
   void UpdateOnRemoveLabel(LabelId removed_label, Vertex *vertex_before_update, const Transaction &tx) override {}
 
+  /// Without `parallel_exec_info` the vertices are split into `thread_count`
+  /// chunks which are indexed concurrently.
   /// @throw std::bad_alloc
   bool CreateIndex(LabelId label, utils::SkipList<Vertex>::Accessor vertices,
-                   const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info);
+                   const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info,
+                   uint64_t thread_count = 1);
 
   /// Returns false if there was no index to drop
   bool DropIndex(LabelId label) override;
@@ -56,6 +61,13 @@ class InMemoryLabelIndex : public storage::LabelIndex {
 
   void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp, std::stop_token token);
 
+  /// Removes the obsolete entries of the vertices whose labels changed and of
+  /// the deleted vertices by looking them up. Falls back to the full scan once
+  /// the lookups would be more than `kTargetedIndexCleanupRatio` of the entries.
+  void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp,
+                             std::span<std::pair<LabelId, Vertex *> const> label_changes,
+                             std::span<Vertex *const> deleted_vertices, std::stop_token token);
+
   /// Surgical removal of entries that was inserted this transaction
   void AbortEntries(LabelId labelId, std::span<Vertex *const> vertices, uint64_t exact_start_timestamp);
 
@@ -66,6 +78,13 @@ class InMemoryLabelIndex : public storage::LabelIndex {
     Iterable(utils::SkipList<Entry>::Accessor index_accessor, utils::SkipList<Vertex>::ConstAccessor vertices_accessor,
              LabelId label, View view, Storage *storage, Transaction *transaction);
 
+    /// Iterable over the index entries whose vertex is in [lower_bound,
+    /// upper_bound) in index order. A `nullptr` bound is treated as the
+    /// beginning or the end of the index.
+    Iterable(utils::SkipList<Entry>::Accessor index_accessor, utils::SkipList<Vertex>::ConstAccessor vertices_accessor,
+             LabelId label, View view, Storage *storage, Transaction *transaction, Vertex *lower_bound,
+             Vertex *upper_bound);
+
     class Iterator {
      public:
       Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator);
@@ -86,9 +105,16 @@ class InMemoryLabelIndex : public storage::LabelIndex {
       Vertex *current_vertex_;
     };
 
-    Iterator begin() { return {this, index_accessor_.begin()}; }
+    Iterator begin() {
+      return {this, lower_bound_ ? index_accessor_.find_equal_or_greater(Entry{lower_bound_, 0})
+                                 : index_accessor_.begin()};
+    }
     Iterator end() { return {this, index_accessor_.end()}; }
 
+    /// Number of vertices the iteration would return, counted from the index
+    /// entries without making an accessor for each of them.
+    uint64_t Count();
+
    private:
     utils::SkipList<Vertex>::ConstAccessor pin_accessor_;
     utils::SkipList<Entry>::Accessor index_accessor_;
@@ -96,17 +122,33 @@ class InMemoryLabelIndex : public storage::LabelIndex {
     View view_;
     Storage *storage_;
     Transaction *transaction_;
+    Vertex *lower_bound_{nullptr};
+    Vertex *upper_bound_{nullptr};
   };
 
   uint64_t ApproximateVertexCount(LabelId label) const override;
 
+  /// Number of times the label was added to or removed from a vertex since the
+  /// index was created, used to tell when the statistics become stale.
+  uint64_t ModificationCount(LabelId label) const;
+
   void RunGC();
 
+  /// Removed entries of each index which are waiting for the garbage
+  /// collection of its skip list.
+  std::vector<std::pair<LabelId, uint64_t>> GarbageSizes() const;
+
   Iterable Vertices(LabelId label, View view, Storage *storage, Transaction *transaction);
 
   Iterable Vertices(LabelId label, memgraph::utils::SkipList<memgraph::storage::Vertex>::ConstAccessor vertices_acc,
                     View view, Storage *storage, Transaction *transaction);
 
+  /// Splits the index for the given label into at most `num_chunks` disjoint
+  /// iterables which can be consumed concurrently. All entries of a single
+  /// vertex always belong to the same chunk.
+  std::vector<Iterable> ChunkedVertices(LabelId label, View view, Storage *storage, Transaction *transaction,
+                                        size_t num_chunks);
+
   void SetIndexStats(const storage::LabelId &label, const storage::LabelIndexStats &stats);
 
   std::optional<storage::LabelIndexStats> GetIndexStats(const storage::LabelId &label) const;
@@ -118,7 +160,12 @@ class InMemoryLabelIndex : public storage::LabelIndex {
   void DropGraphClearIndices() override;
 
  private:
+  void RemoveObsoleteEntriesOf(utils::SkipList<Entry>::Accessor &vertices_acc, LabelId label, Vertex *vertex,
+                               uint64_t oldest_active_start_timestamp);
+
   std::map<LabelId, utils::SkipList<Entry>> index_;
+  // Changes together with `index_`, only the counters change concurrently.
+  std::map<LabelId, std::atomic<uint64_t>> modifications_;
   utils::Synchronized<std::map<LabelId, storage::LabelIndexStats>, utils::ReadPrioritizedRWLock> stats_;
 };
 
@@ -0,0 +1,436 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/inmemory/label_property_composite_index.hpp"
+
+#include <algorithm>
+
+#include "storage/v2/indices/indices_utils.hpp"
+#include "storage/v2/inmemory/property_constants.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+#include "utils/counter.hpp"
+#include "utils/logging.hpp"
+
+namespace memgraph::storage {
+
+namespace {
+
+// Smallest value of the type following the type of `value`, nullopt if it's
+// of the last type.
+std::optional<PropertyValue> SmallestOfNextType(const PropertyValue &value) {
+  switch (value.type()) {
+    case PropertyValue::Type::Null:
+      return kSmallestBool;
+    case PropertyValue::Type::Bool:
+      return kSmallestNumber;
+    case PropertyValue::Type::Int:
+    case PropertyValue::Type::Double:
+      // Both integers and doubles are treated as the same type in
+      // `PropertyValue` and they are interleaved when sorted.
+      return kSmallestString;
+    case PropertyValue::Type::String:
+      return kSmallestList;
+    case PropertyValue::Type::List:
+      return kSmallestMap;
+    case PropertyValue::Type::Map:
+      return kSmallestTemporalData;
+    case PropertyValue::Type::TemporalData:
+      return kSmallestZonedTemporalData;
+    case PropertyValue::Type::ZonedTemporalData:
+      return kSmallestEnum;
+    case PropertyValue::Type::Enum:
+      return kSmallestPoint2d;
+    case PropertyValue::Type::Point2d:
+      return kSmallestPoint3d;
+    case PropertyValue::Type::Point3d:
+      return std::nullopt;
+  }
+  return std::nullopt;
+}
+
+// Smallest value of the type of `value`.
+PropertyValue SmallestOfType(const PropertyValue &value) {
+  switch (value.type()) {
+    case PropertyValue::Type::Null:
+      return PropertyValue();
+    case PropertyValue::Type::Bool:
+      return kSmallestBool;
+    case PropertyValue::Type::Int:
+    case PropertyValue::Type::Double:
+      return kSmallestNumber;
+    case PropertyValue::Type::String:
+      return kSmallestString;
+    case PropertyValue::Type::List:
+      return kSmallestList;
+    case PropertyValue::Type::Map:
+      return kSmallestMap;
+    case PropertyValue::Type::TemporalData:
+      return kSmallestTemporalData;
+    case PropertyValue::Type::ZonedTemporalData:
+      return kSmallestZonedTemporalData;
+    case PropertyValue::Type::Enum:
+      return kSmallestEnum;
+    case PropertyValue::Type::Point2d:
+      return kSmallestPoint2d;
+    case PropertyValue::Type::Point3d:
+      return kSmallestPoint3d;
+  }
+  return PropertyValue();
+}
+
+// Returns the values of `properties` if the vertex should be in the index.
+std::optional<std::vector<PropertyValue>> IndexedValues(const Vertex &vertex,
+                                                        const std::vector<PropertyId> &properties) {
+  auto values = vertex.properties.GetProperties(properties);
+  if (std::ranges::all_of(values, [](const auto &value) { return value.IsNull(); })) return std::nullopt;
+  return values;
+}
+
+}  // namespace
+
+bool InMemoryLabelPropertyCompositeIndex::Entry::operator<(const Entry &rhs) const {
+  if (values < rhs.values) {
+    return true;
+  }
+  if (rhs.values < values) {
+    return false;
+  }
+  return std::make_tuple(vertex, timestamp) < std::make_tuple(rhs.vertex, rhs.timestamp);
+}
+
+bool InMemoryLabelPropertyCompositeIndex::Entry::operator==(const Entry &rhs) const {
+  return values == rhs.values && vertex == rhs.vertex && timestamp == rhs.timestamp;
+}
+
+bool InMemoryLabelPropertyCompositeIndex::Entry::operator<(const std::vector<PropertyValue> &rhs) const {
+  DMG_ASSERT(rhs.size() <= values.size(), "Prefix is longer than the indexed properties");
+  return std::lexicographical_compare(values.begin(), values.begin() + rhs.size(), rhs.begin(), rhs.end());
+}
+
+bool InMemoryLabelPropertyCompositeIndex::Entry::operator==(const std::vector<PropertyValue> &rhs) const {
+  DMG_ASSERT(rhs.size() <= values.size(), "Prefix is longer than the indexed properties");
+  return std::equal(rhs.begin(), rhs.end(), values.begin());
+}
+
+bool InMemoryLabelPropertyCompositeIndex::CreateIndex(LabelId label, const std::vector<PropertyId> &properties,
+                                                      utils::SkipList<Vertex>::Accessor vertices) {
+  MG_ASSERT(!properties.empty(), "Composite index must have at least one property");
+  auto [it, emplaced] = index_.emplace(std::piecewise_construct, std::forward_as_tuple(label, properties),
+                                       std::forward_as_tuple());
+  if (!emplaced) {
+    // Index already exists.
+    return false;
+  }
+
+  using IndexAccessor = decltype(it->second.access());
+  CreateIndexOnSingleThread(vertices, it, index_, it->first,
+                            [](Vertex &vertex, const IndexKey &key, IndexAccessor &index_accessor) {
+                              const auto &[label, properties] = key;
+                              if (vertex.deleted || !utils::Contains(vertex.labels, label)) return;
+                              auto values = IndexedValues(vertex, properties);
+                              if (!values) return;
+                              index_accessor.insert(Entry{std::move(*values), &vertex, 0});
+                            });
+
+  // Properties repeated in the list are registered once
+  for (auto property : properties) {
+    auto &indices = indices_by_property_[property];
+    if (std::ranges::find(indices, it) == indices.end()) indices.push_back(it);
+  }
+  return true;
+}
+
+bool InMemoryLabelPropertyCompositeIndex::DropIndex(LabelId label, const std::vector<PropertyId> &properties) {
+  auto it = index_.find({label, properties});
+  if (it == index_.end()) return false;
+
+  for (auto property : properties) {
+    auto by_property = indices_by_property_.find(property);
+    if (by_property == indices_by_property_.end()) continue;
+    std::erase(by_property->second, it);
+    if (by_property->second.empty()) indices_by_property_.erase(by_property);
+  }
+  index_.erase(it);
+  return true;
+}
+
+bool InMemoryLabelPropertyCompositeIndex::IndexExists(LabelId label, const std::vector<PropertyId> &properties) const {
+  return index_.find({label, properties}) != index_.end();
+}
+
+std::vector<std::pair<LabelId, std::vector<PropertyId>>> InMemoryLabelPropertyCompositeIndex::ListIndices() const {
+  std::vector<std::pair<LabelId, std::vector<PropertyId>>> ret;
+  ret.reserve(index_.size());
+  for (const auto &[key, _] : index_) {
+    ret.push_back(key);
+  }
+  return ret;
+}
+
+std::vector<std::vector<PropertyId>> InMemoryLabelPropertyCompositeIndex::ListIndices(LabelId label) const {
+  std::vector<std::vector<PropertyId>> ret;
+  // The map is ordered by the label first
+  for (auto it = index_.lower_bound({label, {}}); it != index_.end() && it->first.first == label; ++it) {
+    ret.push_back(it->first.second);
+  }
+  return ret;
+}
+
+void InMemoryLabelPropertyCompositeIndex::UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update,
+                                                           const Transaction &tx) {
+  for (auto it = index_.lower_bound({added_label, {}}); it != index_.end() && it->first.first == added_label; ++it) {
+    auto values = IndexedValues(*vertex_after_update, it->first.second);
+    if (!values) continue;
+    auto acc = it->second.access();
+    acc.insert(Entry{std::move(*values), vertex_after_update, tx.start_timestamp});
+  }
+}
+
+void InMemoryLabelPropertyCompositeIndex::UpdateOnSetProperty(PropertyId property, Vertex *vertex,
+                                                              const Transaction &tx) {
+  auto by_property = indices_by_property_.find(property);
+  if (by_property == indices_by_property_.end()) {
+    return;
+  }
+
+  for (auto it : by_property->second) {
+    const auto &[label, properties] = it->first;
+    if (!utils::Contains(vertex->labels, label)) continue;
+    // The entry holds the whole new tuple, the old one is kept until GC finds
+    // no version which still has it.
+    auto values = IndexedValues(*vertex, properties);
+    if (!values) continue;
+    auto acc = it->second.access();
+    acc.insert(Entry{std::move(*values), vertex, tx.start_timestamp});
+  }
+}
+
+void InMemoryLabelPropertyCompositeIndex::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp,
+                                                                std::stop_token token) {
+  auto maybe_stop = utils::ResettableCounter<2048>();
+
+  for (auto &[key, index] : index_) {
+    const auto &[label, properties] = key;
+    // before starting index, check if stop_requested
+    if (token.stop_requested()) return;
+
+    auto index_acc = index.access();
+    auto it = index_acc.begin();
+    auto end_it = index_acc.end();
+    if (it == end_it) continue;
+    while (true) {
+      // Hot loop, don't check stop_requested every time
+      if (maybe_stop() && token.stop_requested()) return;
+
+      auto next_it = it;
+      ++next_it;
+
+      bool has_next = next_it != end_it;
+      if (it->timestamp < oldest_active_start_timestamp) {
+        bool redundant_duplicate = has_next && it->vertex == next_it->vertex && it->values == next_it->values;
+        if (redundant_duplicate || !AnyVersionHasLabelProperties(*it->vertex, label, properties, it->values,
+                                                                 oldest_active_start_timestamp)) {
+          index_acc.remove(*it);
+        }
+      }
+      if (!has_next) break;
+      it = next_it;
+    }
+  }
+}
+
+void InMemoryLabelPropertyCompositeIndex::CollectAbortedEntries(Vertex *vertex, uint64_t exact_start_timestamp,
+                                                                AbortedEntries *entries) {
+  for (auto label : vertex->labels) {
+    for (auto it = index_.lower_bound({label, {}}); it != index_.end() && it->first.first == label; ++it) {
+      auto values = IndexedValues(*vertex, it->first.second);
+      if (!values) continue;
+      entries->emplace_back(it, Entry{std::move(*values), vertex, exact_start_timestamp});
+    }
+  }
+}
+
+void InMemoryLabelPropertyCompositeIndex::AbortEntries(const AbortedEntries &entries) {
+  for (const auto &[it, entry] : entries) {
+    auto acc = it->second.access();
+    acc.remove(entry);
+  }
+}
+
+InMemoryLabelPropertyCompositeIndex::Iterable::Iterator::Iterator(Iterable *self,
+                                                                  utils::SkipList<Entry>::Iterator index_iterator)
+    : self_(self),
+      index_iterator_(index_iterator),
+      current_vertex_accessor_(nullptr, self_->storage_, nullptr),
+      current_vertex_(nullptr) {
+  AdvanceUntilValid();
+}
+
+InMemoryLabelPropertyCompositeIndex::Iterable::Iterator &
+InMemoryLabelPropertyCompositeIndex::Iterable::Iterator::operator++() {
+  ++index_iterator_;
+  AdvanceUntilValid();
+  return *this;
+}
+
+void InMemoryLabelPropertyCompositeIndex::Iterable::Iterator::AdvanceUntilValid() {
+  const auto bounded = self_->prefix_.size();
+  for (; index_iterator_ != self_->index_accessor_.end(); ++index_iterator_) {
+    // The entries with the prefix are adjacent
+    if (!(*index_iterator_ == self_->prefix_)) {
+      index_iterator_ = self_->index_accessor_.end();
+      break;
+    }
+
+    if (index_iterator_->vertex == current_vertex_) {
+      continue;
+    }
+
+    if (!CanSeeEntityWithTimestamp(index_iterator_->timestamp, self_->transaction_)) {
+      continue;
+    }
+
+    if (bounded < self_->properties_.size()) {
+      const auto &value = index_iterator_->values[bounded];
+      if (self_->lower_bound_) {
+        if (value < self_->lower_bound_->value()) {
+          continue;
+        }
+        if (!self_->lower_bound_->IsInclusive() && value == self_->lower_bound_->value()) {
+          continue;
+        }
+      }
+      if (self_->upper_bound_) {
+        if (self_->upper_bound_->value() < value) {
+          index_iterator_ = self_->index_accessor_.end();
+          break;
+        }
+        if (!self_->upper_bound_->IsInclusive() && value == self_->upper_bound_->value()) {
+          index_iterator_ = self_->index_accessor_.end();
+          break;
+        }
+      }
+    }
+
+    if (CurrentVersionHasLabelProperties(*index_iterator_->vertex, self_->label_, self_->properties_,
+                                         index_iterator_->values, self_->transaction_, self_->view_)) {
+      current_vertex_ = index_iterator_->vertex;
+      current_vertex_accessor_ = VertexAccessor(current_vertex_, self_->storage_, self_->transaction_);
+      break;
+    }
+  }
+}
+
+InMemoryLabelPropertyCompositeIndex::Iterable::Iterable(
+    utils::SkipList<Entry>::Accessor index_accessor, utils::SkipList<Vertex>::ConstAccessor vertices_accessor,
+    LabelId label, std::vector<PropertyId> properties, std::vector<PropertyValue> prefix,
+    const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Storage *storage,
+    Transaction *transaction)
+    : pin_accessor_(std::move(vertices_accessor)),
+      index_accessor_(std::move(index_accessor)),
+      label_(label),
+      properties_(std::move(properties)),
+      prefix_(std::move(prefix)),
+      lower_bound_(lower_bound),
+      upper_bound_(upper_bound),
+      view_(view),
+      storage_(storage),
+      transaction_(transaction) {
+  MG_ASSERT(prefix_.size() <= properties_.size(), "Prefix is longer than the indexed properties");
+  // `Null` means that the property doesn't exist, it's never equal to a value.
+  if (std::ranges::any_of(prefix_, [](const auto &value) { return value.IsNull(); })) {
+    bounds_valid_ = false;
+    return;
+  }
+  if (prefix_.size() == properties_.size()) {
+    lower_bound_ = std::nullopt;
+    upper_bound_ = std::nullopt;
+    return;
+  }
+
+  // Fix the bounds like the label-property index does: with a single bound
+  // only values of the same type are returned, and `Null` bounds are ignored.
+  if (lower_bound_ && lower_bound_->value().IsNull()) {
+    lower_bound_ = std::nullopt;
+  }
+  if (upper_bound_ && upper_bound_->value().IsNull()) {
+    upper_bound_ = std::nullopt;
+  }
+  if (lower_bound_ && upper_bound_ && !AreComparableTypes(lower_bound_->value().type(), upper_bound_->value().type())) {
+    bounds_valid_ = false;
+    return;
+  }
+  if (lower_bound_ && !upper_bound_) {
+    if (auto next = SmallestOfNextType(lower_bound_->value())) {
+      upper_bound_ = utils::MakeBoundExclusive(std::move(*next));
+    }
+  }
+  if (upper_bound_ && !lower_bound_) {
+    lower_bound_ = utils::MakeBoundInclusive(SmallestOfType(upper_bound_->value()));
+  }
+}
+
+InMemoryLabelPropertyCompositeIndex::Iterable::Iterator InMemoryLabelPropertyCompositeIndex::Iterable::begin() {
+  if (!bounds_valid_) return {this, index_accessor_.end()};
+  auto key = prefix_;
+  if (lower_bound_) key.push_back(lower_bound_->value());
+  return {this, index_accessor_.find_equal_or_greater(key)};
+}
+
+InMemoryLabelPropertyCompositeIndex::Iterable::Iterator InMemoryLabelPropertyCompositeIndex::Iterable::end() {
+  return {this, index_accessor_.end()};
+}
+
+InMemoryLabelPropertyCompositeIndex::Iterable InMemoryLabelPropertyCompositeIndex::Vertices(
+    LabelId label, const std::vector<PropertyId> &properties, std::vector<PropertyValue> prefix,
+    const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Storage *storage,
+    Transaction *transaction) {
+  DMG_ASSERT(storage->storage_mode_ == StorageMode::IN_MEMORY_TRANSACTIONAL ||
+                 storage->storage_mode_ == StorageMode::IN_MEMORY_ANALYTICAL,
+             "Composite index trying to access InMemory vertices from OnDisk!");
+  auto vertices_acc = static_cast<InMemoryStorage const *>(storage)->vertices_.access();
+  auto it = index_.find({label, properties});
+  MG_ASSERT(it != index_.end(), "Composite index for label {} doesn't exist", label.AsUint());
+  return {it->second.access(), std::move(vertices_acc), label, properties, std::move(prefix), lower_bound,
+          upper_bound, view, storage, transaction};
+}
+
+uint64_t InMemoryLabelPropertyCompositeIndex::ApproximateVertexCount(LabelId label,
+                                                                     const std::vector<PropertyId> &properties) const {
+  auto it = index_.find({label, properties});
+  MG_ASSERT(it != index_.end(), "Composite index for label {} doesn't exist", label.AsUint());
+  return it->second.size();
+}
+
+uint64_t InMemoryLabelPropertyCompositeIndex::ApproximateVertexCount(LabelId label,
+                                                                     const std::vector<PropertyId> &properties,
+                                                                     const std::vector<PropertyValue> &prefix) const {
+  auto it = index_.find({label, properties});
+  MG_ASSERT(it != index_.end(), "Composite index for label {} doesn't exist", label.AsUint());
+  auto acc = it->second.access();
+  // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
+  return acc.estimate_count(prefix, utils::SkipListLayerForCountEstimation(acc.size()));
+}
+
+void InMemoryLabelPropertyCompositeIndex::RunGC() {
+  for (auto &[_, index] : index_) {
+    index.run_gc();
+  }
+}
+
+void InMemoryLabelPropertyCompositeIndex::DropGraphClearIndices() {
+  index_.clear();
+  indices_by_property_.clear();
+}
+
+}  // namespace memgraph::storage
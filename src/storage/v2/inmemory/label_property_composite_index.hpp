@@ -0,0 +1,170 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <map>
+#include <optional>
+#include <stop_token>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/property_value.hpp"
+#include "storage/v2/transaction.hpp"
+#include "storage/v2/vertex.hpp"
+#include "storage/v2/vertex_accessor.hpp"
+#include "storage/v2/view.hpp"
+#include "utils/bound.hpp"
+#include "utils/skip_list.hpp"
+
+namespace memgraph::storage {
+
+/// Index over an ordered list of properties of a label. Entries are sorted by
+/// the tuple of the property values, so all vertices whose first properties
+/// have given values (a prefix) are adjacent and can be looked up together,
+/// optionally with a range on the property following the prefix.
+///
+/// A vertex is indexed if it has the label and at least one of the
+/// properties; the missing ones are stored as `Null`.
+class InMemoryLabelPropertyCompositeIndex {
+ private:
+  struct Entry {
+    std::vector<PropertyValue> values;
+    Vertex *vertex;
+    uint64_t timestamp;
+
+    bool operator<(const Entry &rhs) const;
+    bool operator==(const Entry &rhs) const;
+
+    // Compare only the first `rhs.size()` values, used for prefix lookups.
+    bool operator<(const std::vector<PropertyValue> &rhs) const;
+    bool operator==(const std::vector<PropertyValue> &rhs) const;
+  };
+
+  using IndexKey = std::pair<LabelId, std::vector<PropertyId>>;
+  using IndexMap = std::map<IndexKey, utils::SkipList<Entry>>;
+
+ public:
+  using AbortedEntries = std::vector<std::pair<IndexMap::iterator, Entry>>;
+
+  InMemoryLabelPropertyCompositeIndex() = default;
+
+  /// @throw std::bad_alloc
+  bool CreateIndex(LabelId label, const std::vector<PropertyId> &properties,
+                   utils::SkipList<Vertex>::Accessor vertices);
+
+  bool DropIndex(LabelId label, const std::vector<PropertyId> &properties);
+
+  bool IndexExists(LabelId label, const std::vector<PropertyId> &properties) const;
+
+  std::vector<std::pair<LabelId, std::vector<PropertyId>>> ListIndices() const;
+
+  /// Returns the property lists of all composite indices of `label`.
+  std::vector<std::vector<PropertyId>> ListIndices(LabelId label) const;
+
+  bool Empty() const { return index_.empty(); }
+
+  /// @throw std::bad_alloc
+  void UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update, const Transaction &tx);
+
+  /// Must be called after `property` of `vertex` has been changed, while the
+  /// vertex is still locked.
+  /// @throw std::bad_alloc
+  void UpdateOnSetProperty(PropertyId property, Vertex *vertex, const Transaction &tx);
+
+  void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp, std::stop_token token);
+
+  /// Collects the entries which the transaction with `exact_start_timestamp`
+  /// inserted for the current state of `vertex`. Must be called before each
+  /// change of the vertex made by the transaction is undone, while the vertex
+  /// is locked.
+  void CollectAbortedEntries(Vertex *vertex, uint64_t exact_start_timestamp, AbortedEntries *entries);
+
+  /// Removes the collected entries, must be called before the vertices
+  /// created by the aborted transaction are unlinked.
+  void AbortEntries(const AbortedEntries &entries);
+
+  class Iterable {
+   public:
+    Iterable(utils::SkipList<Entry>::Accessor index_accessor, utils::SkipList<Vertex>::ConstAccessor vertices_accessor,
+             LabelId label, std::vector<PropertyId> properties, std::vector<PropertyValue> prefix,
+             const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+             const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Storage *storage,
+             Transaction *transaction);
+
+    class Iterator {
+     public:
+      Iterator(Iterable *self, utils::SkipList<Entry>::Iterator index_iterator);
+
+      VertexAccessor const &operator*() const { return current_vertex_accessor_; }
+
+      /// Values of the index properties of the current vertex, in the index
+      /// order. They are equal to the values of the version the iterable
+      /// returns the vertex for.
+      const std::vector<PropertyValue> &IndexedValues() const { return index_iterator_->values; }
+
+      bool operator==(const Iterator &other) const { return index_iterator_ == other.index_iterator_; }
+      bool operator!=(const Iterator &other) const { return index_iterator_ != other.index_iterator_; }
+
+      Iterator &operator++();
+
+     private:
+      void AdvanceUntilValid();
+
+      Iterable *self_;
+      utils::SkipList<Entry>::Iterator index_iterator_;
+      VertexAccessor current_vertex_accessor_;
+      Vertex *current_vertex_;
+    };
+
+    Iterator begin();
+    Iterator end();
+
+   private:
+    utils::SkipList<Vertex>::ConstAccessor pin_accessor_;
+    utils::SkipList<Entry>::Accessor index_accessor_;
+    LabelId label_;
+    std::vector<PropertyId> properties_;
+    std::vector<PropertyValue> prefix_;
+    // Bounds of the property following the prefix.
+    std::optional<utils::Bound<PropertyValue>> lower_bound_;
+    std::optional<utils::Bound<PropertyValue>> upper_bound_;
+    bool bounds_valid_{true};
+    View view_;
+    Storage *storage_;
+    Transaction *transaction_;
+  };
+
+  /// Returns the vertices whose first `prefix.size()` properties are equal to
+  /// `prefix` and whose next property is within the bounds, if any are given.
+  /// A `Null` in the prefix doesn't match any vertex.
+  Iterable Vertices(LabelId label, const std::vector<PropertyId> &properties, std::vector<PropertyValue> prefix,
+                    const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Storage *storage,
+                    Transaction *transaction);
+
+  uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties) const;
+
+  uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                  const std::vector<PropertyValue> &prefix) const;
+
+  void RunGC();
+
+  void DropGraphClearIndices();
+
+ private:
+  IndexMap index_;
+  std::unordered_map<PropertyId, std::vector<IndexMap::iterator>> indices_by_property_;
+};
+
+}  // namespace memgraph::storage
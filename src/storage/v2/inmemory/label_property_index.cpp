@@ -47,16 +47,21 @@ bool InMemoryLabelPropertyIndex::Entry::operator==(const PropertyValue &rhs) con
 
 bool InMemoryLabelPropertyIndex::CreateIndex(
     LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices,
-    const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info) {
+    const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info, uint64_t thread_count) {
   spdlog::trace("Vertices size when creating index: {}", vertices.size());
-  auto create_index_seq = [this](LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor &vertices,
-                                 std::map<std::pair<LabelId, PropertyId>, utils::SkipList<Entry>>::iterator it) {
+  auto create_index_seq = [this, thread_count](
+                              LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor &vertices,
+                              std::map<std::pair<LabelId, PropertyId>, utils::SkipList<Entry>>::iterator it) {
     using IndexAccessor = decltype(it->second.access());
 
-    CreateIndexOnSingleThread(vertices, it, index_, std::make_pair(label, property),
-                              [](Vertex &vertex, std::pair<LabelId, PropertyId> key, IndexAccessor &index_accessor) {
-                                TryInsertLabelPropertyIndex(vertex, key, index_accessor);
-                              });
+    const auto insert = [](Vertex &vertex, std::pair<LabelId, PropertyId> key, IndexAccessor &index_accessor) {
+      TryInsertLabelPropertyIndex(vertex, key, index_accessor);
+    };
+    if (thread_count > 1) {
+      CreateIndexOnChunks(vertices, it, index_, std::make_pair(label, property), thread_count, insert);
+    } else {
+      CreateIndexOnSingleThread(vertices, it, index_, std::make_pair(label, property), insert);
+    }
 
     return true;
   };
@@ -85,6 +90,7 @@ bool InMemoryLabelPropertyIndex::CreateIndex(
     // Index already exists.
     return false;
   }
+  modifications_.try_emplace({label, property});
 
   if (parallel_exec_info) {
     return create_index_par(label, property, vertices, it, *parallel_exec_info);
@@ -103,6 +109,7 @@ void InMemoryLabelPropertyIndex::UpdateOnAddLabel(LabelId added_label, Vertex *v
     if (!prop_value.IsNull()) {
       auto acc = storage.access();
       acc.insert(Entry{std::move(prop_value), vertex_after_update, tx.start_timestamp});
+      modifications_.at(label_prop).fetch_add(1, std::memory_order_relaxed);
     }
   }
 }
@@ -122,6 +129,7 @@ void InMemoryLabelPropertyIndex::UpdateOnSetProperty(PropertyId property, const
     if (!utils::Contains(vertex->labels, label)) continue;
     auto acc = storage->access();
     acc.insert(Entry{value, vertex, tx.start_timestamp});
+    modifications_.at({label, property}).fetch_add(1, std::memory_order_relaxed);
   }
 }
 
@@ -134,6 +142,7 @@ bool InMemoryLabelPropertyIndex::DropIndex(LabelId label, PropertyId property) {
     }
   }
 
+  modifications_.erase({label, property});
   return index_.erase({label, property}) > 0;
 }
 
@@ -172,9 +181,12 @@ void InMemoryLabelPropertyIndex::RemoveObsoleteEntries(uint64_t oldest_active_st
       bool has_next = next_it != end_it;
       if (it->timestamp < oldest_active_start_timestamp) {
         bool redundant_duplicate = has_next && it->vertex == next_it->vertex && it->value == next_it->value;
-        if (redundant_duplicate ||
-            !AnyVersionHasLabelProperty(*it->vertex, label_id, prop_id, it->value, oldest_active_start_timestamp)) {
+        if (redundant_duplicate) {
           index_acc.remove(*it);
+        } else if (!AnyVersionHasLabelProperty(*it->vertex, label_id, prop_id, it->value,
+                                               oldest_active_start_timestamp)) {
+          index_acc.remove(*it);
+          modifications_.at(label_property).fetch_add(1, std::memory_order_relaxed);
         }
       }
       if (!has_next) break;
@@ -375,6 +387,36 @@ InMemoryLabelPropertyIndex::Iterable::Iterator InMemoryLabelPropertyIndex::Itera
   return {this, index_accessor_.end()};
 }
 
+uint64_t InMemoryLabelPropertyIndex::Iterable::Count() {
+  if (!bounds_valid_) return 0;
+  uint64_t count = 0;
+  const Vertex *counted_vertex = nullptr;
+  auto it = lower_bound_ ? index_accessor_.find_equal_or_greater(lower_bound_->value()) : index_accessor_.begin();
+  for (; it != index_accessor_.end(); ++it) {
+    // Same checks as `AdvanceUntilValid`, without making the accessor.
+    if (it->vertex == counted_vertex) continue;
+    if (!CanSeeEntityWithTimestamp(it->timestamp, transaction_)) continue;
+    if (lower_bound_) {
+      if (it->value < lower_bound_->value()) continue;
+      if (!lower_bound_->IsInclusive() && it->value == lower_bound_->value()) continue;
+    }
+    if (upper_bound_) {
+      if (upper_bound_->value() < it->value) break;
+      if (!upper_bound_->IsInclusive() && it->value == upper_bound_->value()) break;
+    }
+    if (CurrentVersionHasLabelProperty(*it->vertex, label_, property_, it->value, transaction_, view_)) {
+      counted_vertex = it->vertex;
+      ++count;
+    }
+  }
+  return count;
+}
+
+uint64_t InMemoryLabelPropertyIndex::ModificationCount(LabelId label, PropertyId property) const {
+  auto it = modifications_.find({label, property});
+  return it == modifications_.end() ? 0 : it->second.load(std::memory_order_relaxed);
+}
+
 uint64_t InMemoryLabelPropertyIndex::ApproximateVertexCount(LabelId label, PropertyId property) const {
   auto it = index_.find({label, property});
   MG_ASSERT(it != index_.end(), "Index for label {} and property {} doesn't exist", label.AsUint(), property.AsUint());
@@ -457,6 +499,15 @@ void InMemoryLabelPropertyIndex::RunGC() {
   }
 }
 
+std::vector<std::pair<std::pair<LabelId, PropertyId>, uint64_t>> InMemoryLabelPropertyIndex::GarbageSizes() const {
+  std::vector<std::pair<std::pair<LabelId, PropertyId>, uint64_t>> garbage_sizes;
+  garbage_sizes.reserve(index_.size());
+  for (const auto &[key, index] : index_) {
+    garbage_sizes.emplace_back(key, index.garbage_size());
+  }
+  return garbage_sizes;
+}
+
 InMemoryLabelPropertyIndex::Iterable InMemoryLabelPropertyIndex::Vertices(
     LabelId label, PropertyId property, const std::optional<utils::Bound<PropertyValue>> &lower_bound,
     const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Storage *storage,
@@ -518,6 +569,7 @@ void InMemoryLabelPropertyIndex::AbortEntries(LabelId label,
 void InMemoryLabelPropertyIndex::DropGraphClearIndices() {
   index_.clear();
   indices_by_property_.clear();
+  modifications_.clear();
   stats_->clear();
 }
 
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <span>
 
 #include "storage/v2/constraints/constraints.hpp"
@@ -41,9 +42,12 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
  public:
   InMemoryLabelPropertyIndex() = default;
 
+  /// Without `parallel_exec_info` the vertices are split into `thread_count`
+  /// chunks which are indexed concurrently.
   /// @throw std::bad_alloc
   bool CreateIndex(LabelId label, PropertyId property, utils::SkipList<Vertex>::Accessor vertices,
-                   const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info);
+                   const std::optional<durability::ParallelizedSchemaCreationInfo> &parallel_exec_info,
+                   uint64_t thread_count = 1);
 
   /// @throw std::bad_alloc
   void UpdateOnAddLabel(LabelId added_label, Vertex *vertex_after_update, const Transaction &tx) override;
@@ -107,6 +111,10 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
     Iterator begin();
     Iterator end();
 
+    /// Number of vertices the iteration would return, counted from the index
+    /// entries without making an accessor for each of them.
+    uint64_t Count();
+
    private:
     utils::SkipList<Vertex>::ConstAccessor pin_accessor_;
     utils::SkipList<Entry>::Accessor index_accessor_;
@@ -122,6 +130,10 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
 
   uint64_t ApproximateVertexCount(LabelId label, PropertyId property) const override;
 
+  /// Number of values inserted into or removed from the index since it was
+  /// created, used to tell when the statistics become stale.
+  uint64_t ModificationCount(LabelId label, PropertyId property) const;
+
   /// Supplying a specific value into the count estimation function will return
   /// an estimated count of nodes which have their property's value set to
   /// `value`. If the `value` specified is `Null`, then an average number of
@@ -144,6 +156,10 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
 
   void RunGC();
 
+  /// Removed entries of each index which are waiting for the garbage
+  /// collection of its skip list.
+  std::vector<std::pair<std::pair<LabelId, PropertyId>, uint64_t>> GarbageSizes() const;
+
   Iterable Vertices(LabelId label, PropertyId property, const std::optional<utils::Bound<PropertyValue>> &lower_bound,
                     const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view, Storage *storage,
                     Transaction *transaction);
@@ -159,6 +175,8 @@ class InMemoryLabelPropertyIndex : public storage::LabelPropertyIndex {
  private:
   std::map<std::pair<LabelId, PropertyId>, utils::SkipList<Entry>> index_;
   std::unordered_map<PropertyId, std::unordered_map<LabelId, utils::SkipList<Entry> *>> indices_by_property_;
+  // Changes together with `index_`, only the counters change concurrently.
+  std::map<std::pair<LabelId, PropertyId>, std::atomic<uint64_t>> modifications_;
   utils::Synchronized<std::map<std::pair<LabelId, PropertyId>, storage::LabelPropertyIndexStats>,
                       utils::ReadPrioritizedRWLock>
       stats_;
@@ -87,9 +87,19 @@ replication::WalFilesRes TransferWalFiles(const utils::UUID &main_uuid, const ut
 
 replication::SnapshotRes TransferSnapshot(const utils::UUID &main_uuid, const utils::UUID &uuid, rpc::Client &client,
                                           const std::filesystem::path &path) {
-  auto stream = client.Stream<replication::SnapshotRpc>(main_uuid, uuid);
+  // The blocks of the snapshot which the newest snapshot of the replica has as well aren't sent.
+  auto base = client.Call<replication::SnapshotBlockHashesRpc>(main_uuid, uuid);
+  if (!base.success || base.snapshot.empty()) {
+    auto stream = client.Stream<replication::SnapshotRpc>(main_uuid, uuid);
+    replication::Encoder encoder(stream.GetBuilder());
+    encoder.WriteFile(path);
+    return stream.AwaitResponse();
+  }
+  auto stream = client.Stream<replication::SnapshotRpc>(main_uuid, uuid, base.snapshot);
   replication::Encoder encoder(stream.GetBuilder());
-  encoder.WriteFile(path);
+  auto reused = encoder.WriteFileDiff(path, base.block_hashes);
+  spdlog::debug("Sending snapshot {}, {} bytes are taken from the snapshot {} of the replica", path, reused,
+                base.snapshot);
   return stream.AwaitResponse();
 }
 
@@ -13,6 +13,7 @@
 #include <algorithm>
 #include <filesystem>
 #include <functional>
+#include <numeric>
 #include <optional>
 #include "dbms/constants.hpp"
 #include "flags/experimental.hpp"
@@ -27,6 +28,7 @@
 #include "storage/v2/inmemory/edge_type_index.hpp"
 #include "storage/v2/inmemory/edge_type_property_index.hpp"
 #include "storage/v2/metadata_delta.hpp"
+#include "storage/v2/property_store_tier.hpp"
 
 /// REPLICATION ///
 #include "dbms/inmemory/replication_handlers.hpp"
@@ -34,11 +36,13 @@
 #include "storage/v2/inmemory/unique_constraints.hpp"
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/schema_info.hpp"
+#include "utils/allocator/small_block_pool.hpp"
 #include "utils/atomic_memory_block.hpp"
 #include "utils/event_gauge.hpp"
 #include "utils/exceptions.hpp"
 #include "utils/resource_lock.hpp"
 #include "utils/stat.hpp"
+#include "utils/tracing.hpp"
 
 #include <mutex>
 #include <ranges>
@@ -82,6 +86,10 @@ constexpr auto ActionToStorageOperation(MetadataDelta::Action action) -> durabil
     add_case(ENUM_ALTER_UPDATE);
     add_case(POINT_INDEX_CREATE);
     add_case(POINT_INDEX_DROP);
+    add_case(VECTOR_INDEX_CREATE);
+    add_case(VECTOR_INDEX_DROP);
+    add_case(LABEL_PROPERTY_COMPOSITE_INDEX_CREATE);
+    add_case(LABEL_PROPERTY_COMPOSITE_INDEX_DROP);
   }
 #undef add_case
 }
@@ -119,6 +127,8 @@ using OOMExceptionEnabler = utils::MemoryTracker::OutOfMemoryExceptionEnabler;
 
 InMemoryStorage::InMemoryStorage(Config config, std::optional<free_mem_fn> free_mem_fn_override)
     : Storage(config, config.salient.storage_mode),
+      vertices_(utils::StorageObjectsResource()),
+      edges_(utils::StorageObjectsResource()),
       recovery_{config.durability.storage_directory / durability::kSnapshotDirectory,
                 config.durability.storage_directory / durability::kWalDirectory},
       lock_file_path_(config.durability.storage_directory / durability::kLockFile),
@@ -149,6 +159,12 @@ InMemoryStorage::InMemoryStorage(Config config, std::optional<free_mem_fn> free_
               "storage directory, please stop it first before starting this "
               "process!",
               config_.durability.storage_directory);
+
+    // Nobody else uses the directory, so the segments left by an interrupted snapshot aren't written anymore
+    durability::RemoveSnapshotSegments(recovery_.snapshot_directory_);
+  }
+  if (config_.indices.vertex_gid_table) {
+    vertex_gid_table_ = std::make_unique<VertexGidTable>();
   }
   if (config_.durability.recover_on_startup) {
     auto info = recovery_.RecoverData(uuid(), repl_storage_state_, &vertices_, &edges_, &edges_metadata_, &edge_count_,
@@ -163,6 +179,7 @@ InMemoryStorage::InMemoryStorage(Config config, std::optional<free_mem_fn> free_
         spdlog::trace("Recovering last durable timestamp {}.", *info->last_durable_timestamp);
       }
     }
+    repl_storage_state_.PublishEpoch();
   } else if (config_.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::DISABLED ||
              config_.durability.snapshot_on_exit) {
     bool files_moved = false;
@@ -203,6 +220,7 @@ InMemoryStorage::InMemoryStorage(Config config, std::optional<free_mem_fn> free_
       static_cast<InMemoryLabelPropertyIndex *>(indices_.label_property_index_.get())->RunGC();
       static_cast<InMemoryEdgeTypeIndex *>(indices_.edge_type_index_.get())->RunGC();
       static_cast<InMemoryEdgeTypePropertyIndex *>(indices_.edge_type_property_index_.get())->RunGC();
+      indices_.label_property_composite_index_.RunGC();
 
       // SkipList is already threadsafe
       vertices_.run_gc();
@@ -210,9 +228,27 @@ InMemoryStorage::InMemoryStorage(Config config, std::optional<free_mem_fn> free_
     };
   }
 
+  if (config_.gc.release_threads > 0) {
+    gc_release_pool_.emplace(config_.gc.release_threads);
+  }
+
   if (config_.gc.type == Config::Gc::Type::PERIODIC) {
     // TODO: move out of storage have one global gc_runner_
-    gc_runner_.Run("Storage GC", config_.gc.interval, [this] { this->FreeMemory({}, true); });
+    gc_runner_.Run("Storage GC", config_.gc.interval, [this] {
+      // With sliced GC keep running slices until the GC catches up. The locks
+      // are released between the slices.
+      do {
+        this->FreeMemory({}, true);
+      } while (gc_backlog_.exchange(false, std::memory_order_acq_rel) && !stop_source.stop_requested());
+    });
+  }
+  if (PropertyStoreTier::GetInstance() && FLAGS_storage_property_tier_interval_sec > 0) {
+    property_tier_runner_.Run("Property tier", std::chrono::seconds(FLAGS_storage_property_tier_interval_sec),
+                              [this] { TierProperties(); });
+  }
+  if (config_.gc.analytical_compaction_interval.count() > 0) {
+    analytical_compaction_runner_.Run("Analytical compaction", config_.gc.analytical_compaction_interval,
+                                      [this] { CompactAdjacency(); });
   }
   if (timestamp_ == kTimestampInitialId) {
     commit_log_.emplace();
@@ -227,11 +263,14 @@ InMemoryStorage::~InMemoryStorage() {
   if (config_.gc.type == Config::Gc::Type::PERIODIC) {
     gc_runner_.Stop();
   }
+  property_tier_runner_.Stop();
+  analytical_compaction_runner_.Stop();
   {
     // Stop replication (Stop all clients or stop the REPLICA server)
     repl_storage_state_.Reset();
   }
   if (wal_file_) {
+    auto file_guard = std::lock_guard{wal_file_lock_};
     wal_file_->FinalizeWal();
     wal_file_ = std::nullopt;
   }
@@ -248,7 +287,12 @@ InMemoryStorage::InMemoryAccessor::InMemoryAccessor(auto tag, InMemoryStorage *s
                                                     StorageMode storage_mode)
     : Accessor(tag, storage, isolation_level, storage_mode), config_(storage->config_.salient.items) {}
 InMemoryStorage::InMemoryAccessor::InMemoryAccessor(InMemoryAccessor &&other) noexcept
-    : Accessor(std::move(other)), config_(other.config_) {}
+    : Accessor(std::move(other)),
+      config_(other.config_),
+      vertex_gids_(std::exchange(other.vertex_gids_, {})),
+      edge_gids_(std::exchange(other.edge_gids_, {})),
+      vertices_insert_acc_(std::move(other.vertices_insert_acc_)),
+      edges_insert_acc_(std::move(other.edges_insert_acc_)) {}
 
 InMemoryStorage::InMemoryAccessor::~InMemoryAccessor() {
   if (is_transaction_active_) {
@@ -260,10 +304,37 @@ InMemoryStorage::InMemoryAccessor::~InMemoryAccessor() {
   FinalizeTransaction();
 }
 
+uint64_t InMemoryStorage::InMemoryAccessor::NextGid(std::atomic<uint64_t> &counter, GidBlock &block) {
+  if (block.next == block.end) {
+    block.size = std::clamp<uint64_t>(block.size * 2, 1, kMaxGidBlockSize);
+    block.next = counter.fetch_add(block.size, std::memory_order_acq_rel);
+    block.end = block.next + block.size;
+  }
+  return block.next++;
+}
+
+void InMemoryStorage::InMemoryAccessor::ReleaseGids(std::atomic<uint64_t> &counter, GidBlock &block) {
+  if (block.next != block.end) {
+    auto expected = block.end;
+    counter.compare_exchange_strong(expected, block.next, std::memory_order_acq_rel);
+  }
+  block = GidBlock{};
+}
+
+utils::SkipList<Vertex>::Accessor &InMemoryStorage::InMemoryAccessor::VerticesInsertAccessor() {
+  if (!vertices_insert_acc_) vertices_insert_acc_.emplace(static_cast<InMemoryStorage *>(storage_)->vertices_.access());
+  return *vertices_insert_acc_;
+}
+
+utils::SkipList<Edge>::Accessor &InMemoryStorage::InMemoryAccessor::EdgesInsertAccessor() {
+  if (!edges_insert_acc_) edges_insert_acc_.emplace(static_cast<InMemoryStorage *>(storage_)->edges_.access());
+  return *edges_insert_acc_;
+}
+
 VertexAccessor InMemoryStorage::InMemoryAccessor::CreateVertex() {
   auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
-  auto gid = mem_storage->vertex_id_.fetch_add(1, std::memory_order_acq_rel);
-  auto acc = mem_storage->vertices_.access();
+  auto gid = NextGid(mem_storage->vertex_id_, vertex_gids_);
+  auto &acc = VerticesInsertAccessor();
 
   auto *delta = CreateDeleteObjectDelta(&transaction_);
   auto schema_acc = storage_->SchemaInfoAccessor();
@@ -274,6 +345,7 @@ VertexAccessor InMemoryStorage::InMemoryAccessor::CreateVertex() {
   if (delta) {
     delta->prev.Set(&*it);
   }
+  if (mem_storage->vertex_gid_table_) mem_storage->vertex_gid_table_->Insert(&*it);
   if (schema_acc) schema_acc->CreateVertex(&*it);
   return {&*it, storage_, &transaction_};
 }
@@ -288,7 +360,7 @@ VertexAccessor InMemoryStorage::InMemoryAccessor::CreateVertexEx(storage::Gid gi
   auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
   mem_storage->vertex_id_.store(std::max(mem_storage->vertex_id_.load(std::memory_order_acquire), gid.AsUint() + 1),
                                 std::memory_order_release);
-  auto acc = mem_storage->vertices_.access();
+  auto &acc = VerticesInsertAccessor();
 
   auto *delta = CreateDeleteObjectDelta(&transaction_);
   auto schema_acc = storage_->SchemaInfoAccessor();
@@ -305,11 +377,80 @@ VertexAccessor InMemoryStorage::InMemoryAccessor::CreateVertexEx(storage::Gid gi
 std::optional<VertexAccessor> InMemoryStorage::InMemoryAccessor::FindVertex(Gid gid, View view) {
   auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
   auto acc = mem_storage->vertices_.access();
+  auto *table = mem_storage->vertex_gid_table_.get();
+  if (table) {
+    if (auto *vertex = table->Find(gid)) return VertexAccessor::Create(vertex, storage_, &transaction_, view);
+  }
   auto it = acc.find(gid);
   if (it == acc.end()) return std::nullopt;
+  if (table) {
+    // A vertex which isn't deleted can't be removed from the skip list before it's put into the table
+    auto guard = std::shared_lock{it->lock};
+    if (!it->deleted) table->Insert(&*it);
+  }
   return VertexAccessor::Create(&*it, storage_, &transaction_, view);
 }
 
+std::vector<VertexAccessor> InMemoryStorage::InMemoryAccessor::NearestPointVertices(LabelId label,
+                                                                                   PropertyId property,
+                                                                                   const PropertyValue &point,
+                                                                                   std::size_t k, View view) {
+  auto result = std::vector<VertexAccessor>{};
+  if (k == 0) return result;
+  // The index holds the points of the latest state this transaction can see,
+  // the vertices are checked against `view` like in the other indices. If
+  // some of the nearest ones aren't visible, more of them are fetched.
+  for (auto requested = k;; requested = requested > SIZE_MAX / 2 ? SIZE_MAX : requested * 2) {
+    auto candidates = transaction_.point_index_ctx_.NearestVertices(label, property, point, requested);
+    result.clear();
+    for (auto const *vertex : candidates) {
+      auto maybe_vertex = VertexAccessor::Create(const_cast<Vertex *>(vertex), storage_, &transaction_, view);
+      if (!maybe_vertex) continue;
+      auto has_label = maybe_vertex->HasLabel(label, view);
+      if (has_label.HasError() || !*has_label) continue;
+      result.push_back(*maybe_vertex);
+      if (result.size() == k) return result;
+    }
+    if (candidates.size() < requested) return result;
+  }
+}
+
+std::vector<std::pair<VertexAccessor, double>> InMemoryStorage::InMemoryAccessor::VectorIndexSearch(
+    LabelId label, PropertyId property, const PropertyValue &query, std::size_t k, View view) {
+  auto result = std::vector<std::pair<VertexAccessor, double>>{};
+  auto &vector_index = storage_->indices_.vector_index_;
+  auto const dimension = vector_index.IndexDimension(label, property);
+  if (k == 0 || !dimension) return result;
+  auto const normalized_query = NormalizedVector(query, *dimension);
+  if (!normalized_query) return result;
+
+  // Keeps the found vertices from being released by the GC
+  auto vertices_acc = static_cast<InMemoryStorage *>(storage_)->vertices_.access();
+  // The index holds the committed vectors, the vertices are checked against
+  // `view` and scored by their visible vector. If some of the most similar
+  // ones aren't visible, more of them are fetched.
+  for (auto requested = k;; requested = requested > SIZE_MAX / 2 ? SIZE_MAX : requested * 2) {
+    auto candidates = vector_index.Search(label, property, *normalized_query, requested);
+    result.clear();
+    for (auto const *vertex : candidates) {
+      auto maybe_vertex = VertexAccessor::Create(const_cast<Vertex *>(vertex), storage_, &transaction_, view);
+      if (!maybe_vertex) continue;
+      auto has_label = maybe_vertex->HasLabel(label, view);
+      if (has_label.HasError() || !*has_label) continue;
+      auto value = maybe_vertex->GetProperty(property, view);
+      if (value.HasError()) continue;
+      auto vector = NormalizedVector(*value, *dimension);
+      if (!vector) continue;
+      auto const similarity = std::inner_product(vector->begin(), vector->end(), normalized_query->begin(), 0.0);
+      result.emplace_back(*maybe_vertex, similarity);
+      if (result.size() == k) break;
+    }
+    if (result.size() == k || candidates.size() < requested) break;
+  }
+  std::ranges::stable_sort(result, std::greater{}, &std::pair<VertexAccessor, double>::second);
+  return result;
+}
+
 Result<std::optional<std::pair<std::vector<VertexAccessor>, std::vector<EdgeAccessor>>>>
 InMemoryStorage::InMemoryAccessor::DetachDelete(std::vector<VertexAccessor *> nodes, std::vector<EdgeAccessor *> edges,
                                                 bool detach) {
@@ -414,13 +555,13 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::CreateEdge(VertexAccesso
     storage_->stored_edge_types_.try_insert(edge_type);
   }
   auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
-  auto gid = storage::Gid::FromUint(mem_storage->edge_id_.fetch_add(1, std::memory_order_acq_rel));
+  auto gid = storage::Gid::FromUint(NextGid(mem_storage->edge_id_, edge_gids_));
   EdgeRef edge(gid);
   if (config_.properties_on_edges) {
-    auto acc = mem_storage->edges_.access();
+    auto &acc = EdgesInsertAccessor();
     // SchemaInfo handles edge creation via vertices; add collector here if that evert changes
     auto *delta = CreateDeleteObjectDelta(&transaction_);
-    auto [it, inserted] = acc.insert(Edge(gid, delta));
+    auto [it, inserted] = acc.insert(Edge(gid, delta, from_vertex));
     MG_ASSERT(inserted, "The edge must be inserted here!");
     MG_ASSERT(it != acc.end(), "Invalid Edge accessor!");
     edge = EdgeRef(&*it);
@@ -436,10 +577,10 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::CreateEdge(VertexAccesso
   utils::AtomicMemoryBlock(
       [this, edge, from_vertex = from_vertex, edge_type = edge_type, to_vertex = to_vertex, &schema_acc]() {
         CreateAndLinkDelta(&transaction_, from_vertex, Delta::RemoveOutEdgeTag(), edge_type, to_vertex, edge);
-        from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge);
+        AppendVertexEdge(from_vertex, EdgeDirection::OUT, edge_type, to_vertex, edge);
 
         CreateAndLinkDelta(&transaction_, to_vertex, Delta::RemoveInEdgeTag(), edge_type, from_vertex, edge);
-        to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge);
+        AppendVertexEdge(to_vertex, EdgeDirection::IN, edge_type, from_vertex, edge);
 
         transaction_.manyDeltasCache.Invalidate(from_vertex, edge_type, EdgeDirection::OUT);
         transaction_.manyDeltasCache.Invalidate(to_vertex, edge_type, EdgeDirection::IN);
@@ -526,11 +667,11 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::CreateEdgeEx(VertexAcces
 
   EdgeRef edge(gid);
   if (config_.properties_on_edges) {
-    auto acc = mem_storage->edges_.access();
+    auto &acc = EdgesInsertAccessor();
 
     // SchemaInfo handles edge creation via vertices; add collector here if that evert changes
     auto *delta = CreateDeleteObjectDelta(&transaction_);
-    auto [it, inserted] = acc.insert(Edge(gid, delta));
+    auto [it, inserted] = acc.insert(Edge(gid, delta, from_vertex));
     MG_ASSERT(inserted, "The edge must be inserted here!");
     MG_ASSERT(it != acc.end(), "Invalid Edge accessor!");
     edge = EdgeRef(&*it);
@@ -546,10 +687,10 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::CreateEdgeEx(VertexAcces
   utils::AtomicMemoryBlock(
       [this, edge, from_vertex = from_vertex, edge_type = edge_type, to_vertex = to_vertex, &schema_acc]() {
         CreateAndLinkDelta(&transaction_, from_vertex, Delta::RemoveOutEdgeTag(), edge_type, to_vertex, edge);
-        from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge);
+        AppendVertexEdge(from_vertex, EdgeDirection::OUT, edge_type, to_vertex, edge);
 
         CreateAndLinkDelta(&transaction_, to_vertex, Delta::RemoveInEdgeTag(), edge_type, from_vertex, edge);
-        to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge);
+        AppendVertexEdge(to_vertex, EdgeDirection::IN, edge_type, from_vertex, edge);
 
         transaction_.manyDeltasCache.Invalidate(from_vertex, edge_type, EdgeDirection::OUT);
         transaction_.manyDeltasCache.Invalidate(to_vertex, edge_type, EdgeDirection::IN);
@@ -592,16 +733,6 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetFrom(EdgeAccessor
   auto edge_ref = edge->edge_;
   auto edge_type = edge->edge_type_;
 
-  std::unique_lock<utils::RWSpinLock> guard;
-  if (config_.properties_on_edges) {
-    auto *edge_ptr = edge_ref.ptr;
-    guard = std::unique_lock{edge_ptr->lock};
-
-    if (!PrepareForWrite(&transaction_, edge_ptr)) return Error::SERIALIZATION_ERROR;
-
-    if (edge_ptr->deleted) return Error::DELETED_OBJECT;
-  }
-
   auto guard_old_from = std::unique_lock{old_from_vertex->lock, std::defer_lock};
   auto guard_new_from = std::unique_lock{new_from_vertex->lock, std::defer_lock};
   auto guard_to = std::unique_lock{to_vertex->lock, std::defer_lock};
@@ -626,6 +757,17 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetFrom(EdgeAccessor
     }
   }
 
+  // The edge is locked after its vertices, see `EdgeLock`.
+  std::unique_lock<utils::RWSpinLock> guard;
+  if (config_.properties_on_edges) {
+    auto *edge_ptr = edge_ref.ptr;
+    guard = std::unique_lock{EdgeLock(edge_ptr)};
+
+    if (!PrepareForWrite(&transaction_, edge_ptr)) return Error::SERIALIZATION_ERROR;
+
+    if (edge_ptr->deleted) return Error::DELETED_OBJECT;
+  }
+
   if (!PrepareForWrite(&transaction_, old_from_vertex)) return Error::SERIALIZATION_ERROR;
   MG_ASSERT(!old_from_vertex->deleted, "Invalid database state!");
 
@@ -637,21 +779,20 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetFrom(EdgeAccessor
     MG_ASSERT(!to_vertex->deleted, "Invalid database state!");
   }
 
-  auto delete_edge_from_storage = [&edge_type, &edge_ref, this](auto *vertex, auto *edges) {
+  auto delete_edge_from_storage = [&edge_type, &edge_ref, this](auto *vertex, auto *owner, EdgeDirection direction) {
     std::tuple<EdgeTypeId, Vertex *, EdgeRef> link(edge_type, vertex, edge_ref);
-    auto it = std::find(edges->begin(), edges->end(), link);
+    auto it = FindVertexEdge(owner, direction, link);
     if (config_.properties_on_edges) {
-      MG_ASSERT(it != edges->end(), "Invalid database state!");
-    } else if (it == edges->end()) {
+      MG_ASSERT(it != VertexEdges(owner, direction).end(), "Invalid database state!");
+    } else if (it == VertexEdges(owner, direction).end()) {
       return false;
     }
-    std::swap(*it, *edges->rbegin());
-    edges->pop_back();
+    RemoveVertexEdge(owner, direction, it);
     return true;
   };
 
-  auto op1 = delete_edge_from_storage(to_vertex, &old_from_vertex->out_edges);
-  auto op2 = delete_edge_from_storage(old_from_vertex, &to_vertex->in_edges);
+  auto op1 = delete_edge_from_storage(to_vertex, old_from_vertex, EdgeDirection::OUT);
+  auto op2 = delete_edge_from_storage(old_from_vertex, to_vertex, EdgeDirection::IN);
 
   if (config_.properties_on_edges) {
     MG_ASSERT((op1 && op2), "Invalid database state!");
@@ -668,9 +809,9 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetFrom(EdgeAccessor
     if (schema_acc) schema_acc->DeleteEdge(old_from_vertex, to_vertex, edge_type, edge_ref);
 
     CreateAndLinkDelta(&transaction_, new_from_vertex, Delta::RemoveOutEdgeTag(), edge_type, to_vertex, edge_ref);
-    new_from_vertex->out_edges.emplace_back(edge_type, to_vertex, edge_ref);
+    AppendVertexEdge(new_from_vertex, EdgeDirection::OUT, edge_type, to_vertex, edge_ref);
     CreateAndLinkDelta(&transaction_, to_vertex, Delta::RemoveInEdgeTag(), edge_type, new_from_vertex, edge_ref);
-    to_vertex->in_edges.emplace_back(edge_type, new_from_vertex, edge_ref);
+    AppendVertexEdge(to_vertex, EdgeDirection::IN, edge_type, new_from_vertex, edge_ref);
     if (schema_acc) schema_acc->CreateEdge(new_from_vertex, to_vertex, edge_type);
 
     auto *in_memory = static_cast<InMemoryStorage *>(storage_);
@@ -714,16 +855,6 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetTo(EdgeAccessor *
   auto &edge_ref = edge->edge_;
   auto &edge_type = edge->edge_type_;
 
-  std::unique_lock<utils::RWSpinLock> guard;
-  if (config_.properties_on_edges) {
-    auto *edge_ptr = edge_ref.ptr;
-    guard = std::unique_lock{edge_ptr->lock};
-
-    if (!PrepareForWrite(&transaction_, edge_ptr)) return Error::SERIALIZATION_ERROR;
-
-    if (edge_ptr->deleted) return Error::DELETED_OBJECT;
-  }
-
   auto guard_from = std::unique_lock{from_vertex->lock, std::defer_lock};
   auto guard_old_to = std::unique_lock{old_to_vertex->lock, std::defer_lock};
   auto guard_new_to = std::unique_lock{new_to_vertex->lock, std::defer_lock};
@@ -748,6 +879,17 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetTo(EdgeAccessor *
     }
   }
 
+  // The edge is locked after its vertices, see `EdgeLock`.
+  std::unique_lock<utils::RWSpinLock> guard;
+  if (config_.properties_on_edges) {
+    auto *edge_ptr = edge_ref.ptr;
+    guard = std::unique_lock{EdgeLock(edge_ptr)};
+
+    if (!PrepareForWrite(&transaction_, edge_ptr)) return Error::SERIALIZATION_ERROR;
+
+    if (edge_ptr->deleted) return Error::DELETED_OBJECT;
+  }
+
   if (!PrepareForWrite(&transaction_, old_to_vertex)) return Error::SERIALIZATION_ERROR;
   MG_ASSERT(!old_to_vertex->deleted, "Invalid database state!");
 
@@ -759,21 +901,20 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetTo(EdgeAccessor *
     MG_ASSERT(!from_vertex->deleted, "Invalid database state!");
   }
 
-  auto delete_edge_from_storage = [&edge_type, &edge_ref, this](auto *vertex, auto *edges) {
+  auto delete_edge_from_storage = [&edge_type, &edge_ref, this](auto *vertex, auto *owner, EdgeDirection direction) {
     std::tuple<EdgeTypeId, Vertex *, EdgeRef> link(edge_type, vertex, edge_ref);
-    auto it = std::find(edges->begin(), edges->end(), link);
+    auto it = FindVertexEdge(owner, direction, link);
     if (config_.properties_on_edges) {
-      MG_ASSERT(it != edges->end(), "Invalid database state!");
-    } else if (it == edges->end()) {
+      MG_ASSERT(it != VertexEdges(owner, direction).end(), "Invalid database state!");
+    } else if (it == VertexEdges(owner, direction).end()) {
       return false;
     }
-    std::swap(*it, *edges->rbegin());
-    edges->pop_back();
+    RemoveVertexEdge(owner, direction, it);
     return true;
   };
 
-  auto op1 = delete_edge_from_storage(old_to_vertex, &from_vertex->out_edges);
-  auto op2 = delete_edge_from_storage(from_vertex, &old_to_vertex->in_edges);
+  auto op1 = delete_edge_from_storage(old_to_vertex, from_vertex, EdgeDirection::OUT);
+  auto op2 = delete_edge_from_storage(from_vertex, old_to_vertex, EdgeDirection::IN);
 
   if (config_.properties_on_edges) {
     MG_ASSERT((op1 && op2), "Invalid database state!");
@@ -791,9 +932,9 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeSetTo(EdgeAccessor *
     if (schema_acc) schema_acc->DeleteEdge(from_vertex, old_to_vertex, edge_type, edge_ref);
 
     CreateAndLinkDelta(&transaction_, from_vertex, Delta::RemoveOutEdgeTag(), edge_type, new_to_vertex, edge_ref);
-    from_vertex->out_edges.emplace_back(edge_type, new_to_vertex, edge_ref);
+    AppendVertexEdge(from_vertex, EdgeDirection::OUT, edge_type, new_to_vertex, edge_ref);
     CreateAndLinkDelta(&transaction_, new_to_vertex, Delta::RemoveInEdgeTag(), edge_type, from_vertex, edge_ref);
-    new_to_vertex->in_edges.emplace_back(edge_type, from_vertex, edge_ref);
+    AppendVertexEdge(new_to_vertex, EdgeDirection::IN, edge_type, from_vertex, edge_ref);
     if (schema_acc) schema_acc->CreateEdge(from_vertex, new_to_vertex, edge_type);
 
     auto *in_memory = static_cast<InMemoryStorage *>(storage_);
@@ -824,15 +965,6 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeChangeType(EdgeAcces
   auto &edge_ref = edge->edge_;
   auto &edge_type = edge->edge_type_;
 
-  std::unique_lock<utils::RWSpinLock> guard;
-  if (config_.properties_on_edges) {
-    auto *edge_ptr = edge_ref.ptr;
-    guard = std::unique_lock{edge_ptr->lock};
-
-    if (!PrepareForWrite(&transaction_, edge_ptr)) return Error::SERIALIZATION_ERROR;
-    if (edge_ptr->deleted) return Error::DELETED_OBJECT;
-  }
-
   auto *from_vertex = edge->from_vertex_;
   auto *to_vertex = edge->to_vertex_;
 
@@ -852,26 +984,38 @@ Result<EdgeAccessor> InMemoryStorage::InMemoryAccessor::EdgeChangeType(EdgeAcces
     guard_from.lock();
   }
 
+  // The edge is locked after its vertices, see `EdgeLock`.
+  std::unique_lock<utils::RWSpinLock> guard;
+  if (config_.properties_on_edges) {
+    auto *edge_ptr = edge_ref.ptr;
+    guard = std::unique_lock{EdgeLock(edge_ptr)};
+
+    if (!PrepareForWrite(&transaction_, edge_ptr)) return Error::SERIALIZATION_ERROR;
+    if (edge_ptr->deleted) return Error::DELETED_OBJECT;
+  }
+
   if (!PrepareForWrite(&transaction_, from_vertex)) return Error::SERIALIZATION_ERROR;
   MG_ASSERT(!from_vertex->deleted, "Invalid database state!");
 
   if (!PrepareForWrite(&transaction_, to_vertex)) return Error::SERIALIZATION_ERROR;
   MG_ASSERT(!to_vertex->deleted, "Invalid database state!");
 
-  auto change_edge_type_in_storage = [&edge_type, &edge_ref, &new_edge_type, this](auto *vertex, auto *edges) {
+  auto change_edge_type_in_storage = [&edge_type, &edge_ref, &new_edge_type, this](auto *vertex, auto *owner,
+                                                                                    EdgeDirection direction) {
     std::tuple<EdgeTypeId, Vertex *, EdgeRef> link(edge_type, vertex, edge_ref);
-    auto it = std::find(edges->begin(), edges->end(), link);
+    auto it = FindVertexEdge(owner, direction, link);
     if (config_.properties_on_edges) {
-      MG_ASSERT(it != edges->end(), "Invalid database state!");
-    } else if (it == edges->end()) {
+      MG_ASSERT(it != VertexEdges(owner, direction).end(), "Invalid database state!");
+    } else if (it == VertexEdges(owner, direction).end()) {
       return false;
     }
     *it = std::tuple<EdgeTypeId, Vertex *, EdgeRef>{new_edge_type, vertex, edge_ref};
+    UngroupEdges(owner, direction);
     return true;
   };
 
-  auto op1 = change_edge_type_in_storage(to_vertex, &from_vertex->out_edges);
-  auto op2 = change_edge_type_in_storage(from_vertex, &to_vertex->in_edges);
+  auto op1 = change_edge_type_in_storage(to_vertex, from_vertex, EdgeDirection::OUT);
+  auto op2 = change_edge_type_in_storage(from_vertex, to_vertex, EdgeDirection::IN);
 
   MG_ASSERT((op1 && op2), "Invalid database state!");
 
@@ -901,6 +1045,7 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
   MG_ASSERT(!transaction_.must_abort, "The transaction can't be committed!");
 
   auto could_replicate_all_sync_replicas = true;
+  std::optional<uint64_t> wal_group_commit_ticket;
 
   auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
 
@@ -908,6 +1053,9 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
   if (transaction_.deltas.empty() && transaction_.md_deltas.empty()) {
     // We don't have to update the commit timestamp here because no one reads
     // it.
+    // IN_MEMORY_ANALYTICAL transactions have no deltas, but their changes
+    // still have to reach the vector indices
+    mem_storage->indices_.vector_index_.ApplyChanges(transaction_.vector_index_change_collector_);
     mem_storage->commit_log_->MarkFinished(transaction_.start_timestamp);
   } else {
     // This is usually done by the MVCC, but it does not handle the metadata deltas
@@ -916,17 +1064,12 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
     // ExistenceConstraints validation block
     if (transaction_.constraint_verification_info &&
         transaction_.constraint_verification_info->NeedsExistenceConstraintVerification()) {
-      const auto vertices_to_update =
-          transaction_.constraint_verification_info->GetVerticesForExistenceConstraintChecking();
-      for (auto const *vertex : vertices_to_update) {
-        // No need to take any locks here because we modified this vertex and no
-        // one else can touch it until we commit.
-        auto validation_result = storage_->constraints_.existence_constraints_->Validate(*vertex);
-        if (validation_result) {
-          Abort();
-          DMG_ASSERT(!commit_timestamp_.has_value());
-          return StorageManipulationError{*validation_result};
-        }
+      auto validation_result = storage_->constraints_.existence_constraints_->ValidateVertices(
+          *transaction_.constraint_verification_info);
+      if (validation_result) {
+        Abort();
+        DMG_ASSERT(!commit_timestamp_.has_value());
+        return StorageManipulationError{*validation_result};
       }
     }
 
@@ -1027,18 +1170,17 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
         if (is_main_or_replica_write) {
           could_replicate_all_sync_replicas =
               mem_storage->AppendToWal(transaction_, durability_commit_timestamp, std::move(db_acc));
+          if (mem_storage->config_.durability.wal_group_commit) {
+            // The ticket is only modified under the engine lock which we are holding.
+            wal_group_commit_ticket = mem_storage->wal_group_commit_.written;
+          }
 
           if (config_.enable_schema_info) {
-            if (transaction_.deltas.size() < 16) {  // TODO Fine tune
-              // Small transaction => process in place
-              mem_storage->SchemaInfoWriteAccessor().ProcessTransaction(
-                  transaction_, mem_storage->config_.salient.items.properties_on_edges);
-            } else {
-              // Large transaction => make a local copy of the schema, process and move back
-              auto stats = mem_storage->SchemaInfoReadAccessor().Get();
-              stats.ProcessTransaction(transaction_, mem_storage->config_.salient.items.properties_on_edges);
-              mem_storage->SchemaInfoWriteAccessor().Set(std::move(stats));
-            }
+            // Process the transaction into its own difference without holding the schema lock, only the merge
+            // blocks the readers
+            Tracking diff;
+            diff.ProcessTransaction(transaction_, mem_storage->config_.salient.items.properties_on_edges);
+            mem_storage->SchemaInfoWriteAccessor().Merge(std::move(diff));
           }
 
           // TODO: release lock, and update all deltas to have a local copy of the commit timestamp
@@ -1054,6 +1196,10 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
         mem_storage->indices_.point_index_.InstallNewPointIndex(transaction_.point_index_change_collector_,
                                                                 transaction_.point_index_ctx_);
 
+        // Bring the vector indices up to date, the changed vertices are still
+        // owned by this transaction
+        mem_storage->indices_.vector_index_.ApplyChanges(transaction_.vector_index_change_collector_);
+
         // TODO: can and should this be moved earlier?
         mem_storage->commit_log_->MarkFinished(start_timestamp);
 
@@ -1069,6 +1215,8 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
           auto gc_guard = std::unique_lock{mem_storage->gc_lock_, std::defer_lock};
           if (gc_guard.try_lock()) {
             FastDiscardOfDeltas(std::move(gc_guard));
+          } else {
+            utils::RecordLockContention(utils::LockSite::GC, {});
           }
         }
       }
@@ -1081,8 +1229,14 @@ utils::BasicResult<StorageManipulationError, void> InMemoryStorage::InMemoryAcce
       return StorageManipulationError{*unique_constraint_violation};
     }
 
+    // Wait for the WAL sync outside of the engine lock so other transactions
+    // can be written to the WAL and synced together with this one.
+    if (wal_group_commit_ticket) {
+      mem_storage->WaitForWalGroupCommit(*wal_group_commit_ticket);
+    }
+
     if (flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
-      mem_storage->indices_.text_index_.Commit();
+      mem_storage->indices_.text_index_.Commit(transaction_.transaction_id);
     }
   }
 
@@ -1125,6 +1279,9 @@ void InMemoryStorage::InMemoryAccessor::GCRapidDeltaCleanup(std::list<Gid> &curr
                                                             std::list<Gid> &current_deleted_vertices,
                                                             IndexPerformanceTracker &impact_tracker) {
   auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
+  auto &columnar_property_store = mem_storage->indices_.columnar_property_store_;
+  const bool refresh_columnar_properties = !columnar_property_store.Empty();
+  std::vector<Vertex *> unlinked_vertices;
 
   auto const unlink_remove_clear = [&](delta_container &deltas) {
     for (auto &delta : deltas) {
@@ -1138,6 +1295,10 @@ void InMemoryStorage::InMemoryAccessor::GCRapidDeltaCleanup(std::list<Gid> &curr
           // safe because no other txn can be reading this while we have engine lock
           auto &vertex = *prev.vertex;
           vertex.delta = nullptr;
+          if (refresh_columnar_properties) {
+            vertex.columnar_stale = true;
+            unlinked_vertices.push_back(&vertex);
+          }
           if (vertex.deleted) {
             DMG_ASSERT(delta.action == Delta::Action::RECREATE_OBJECT);
             current_deleted_vertices.push_back(vertex.gid);
@@ -1185,6 +1346,9 @@ void InMemoryStorage::InMemoryAccessor::GCRapidDeltaCleanup(std::list<Gid> &curr
 
   // STEP 2) this transactions deltas also mininal unlinking + remove + clear
   unlink_remove_clear(transaction_.deltas);
+
+  // STEP 3) the unlinked vertices are now visible to everyone, refresh their columnar values
+  if (refresh_columnar_properties) columnar_property_store.Refresh(unlinked_vertices);
 }
 
 void InMemoryStorage::InMemoryAccessor::FastDiscardOfDeltas(std::unique_lock<std::mutex> /*gc_guard*/) {
@@ -1240,6 +1404,12 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
     // by one and acquiring lock every time.
     std::list<Gid> my_deleted_vertices;
     std::list<Gid> my_deleted_edges;
+    // Vertices left without a delta chain, their columnar values have to be refreshed.
+    const bool refresh_columnar_properties = !storage_->indices_.columnar_property_store_.Empty();
+    std::vector<Vertex *> unlinked_vertices;
+    auto &composite_index = storage_->indices_.label_property_composite_index_;
+    const bool composite_cleanup_needed = !composite_index.Empty();
+    InMemoryLabelPropertyCompositeIndex::AbortedEntries composite_cleanup;
 
     std::map<LabelId, std::vector<Vertex *>> label_cleanup;
     std::map<LabelId, std::vector<std::pair<PropertyValue, Vertex *>>> label_property_cleanup;
@@ -1262,6 +1432,11 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
           Delta *current = vertex->delta;
           while (current != nullptr &&
                  current->timestamp->load(std::memory_order_acquire) == transaction_.transaction_id) {
+            if (composite_cleanup_needed && (current->action == Delta::Action::REMOVE_LABEL ||
+                                             current->action == Delta::Action::SET_PROPERTY)) {
+              // Every change which inserted into the composite indices is undone here
+              composite_index.CollectAbortedEntries(vertex, transaction_.start_timestamp, &composite_cleanup);
+            }
             switch (current->action) {
               case Delta::Action::REMOVE_LABEL: {
                 auto it = std::find(vertex->labels.begin(), vertex->labels.end(), current->label.value);
@@ -1313,17 +1488,17 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
               case Delta::Action::ADD_IN_EDGE: {
                 std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{current->vertex_edge.edge_type,
                                                                current->vertex_edge.vertex, current->vertex_edge.edge};
-                auto it = std::find(vertex->in_edges.begin(), vertex->in_edges.end(), link);
+                auto it = FindVertexEdge(vertex, EdgeDirection::IN, link);
                 MG_ASSERT(it == vertex->in_edges.end(), "Invalid database state!");
-                vertex->in_edges.push_back(link);
+                AppendVertexEdge(vertex, EdgeDirection::IN, link);
                 break;
               }
               case Delta::Action::ADD_OUT_EDGE: {
                 std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{current->vertex_edge.edge_type,
                                                                current->vertex_edge.vertex, current->vertex_edge.edge};
-                auto it = std::find(vertex->out_edges.begin(), vertex->out_edges.end(), link);
+                auto it = FindVertexEdge(vertex, EdgeDirection::OUT, link);
                 MG_ASSERT(it == vertex->out_edges.end(), "Invalid database state!");
-                vertex->out_edges.push_back(link);
+                AppendVertexEdge(vertex, EdgeDirection::OUT, link);
                 // Increment edge count. We only increment the count here because
                 // the information in `ADD_IN_EDGE` and `Edge/RECREATE_OBJECT` is
                 // redundant. Also, `Edge/RECREATE_OBJECT` isn't available when
@@ -1334,19 +1509,17 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
               case Delta::Action::REMOVE_IN_EDGE: {
                 std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{current->vertex_edge.edge_type,
                                                                current->vertex_edge.vertex, current->vertex_edge.edge};
-                auto it = std::find(vertex->in_edges.begin(), vertex->in_edges.end(), link);
+                auto it = FindVertexEdge(vertex, EdgeDirection::IN, link);
                 MG_ASSERT(it != vertex->in_edges.end(), "Invalid database state!");
-                std::swap(*it, *vertex->in_edges.rbegin());
-                vertex->in_edges.pop_back();
+                RemoveVertexEdge(vertex, EdgeDirection::IN, it);
                 break;
               }
               case Delta::Action::REMOVE_OUT_EDGE: {
                 std::tuple<EdgeTypeId, Vertex *, EdgeRef> link{current->vertex_edge.edge_type,
                                                                current->vertex_edge.vertex, current->vertex_edge.edge};
-                auto it = std::find(vertex->out_edges.begin(), vertex->out_edges.end(), link);
+                auto it = FindVertexEdge(vertex, EdgeDirection::OUT, link);
                 MG_ASSERT(it != vertex->out_edges.end(), "Invalid database state!");
-                std::swap(*it, *vertex->out_edges.rbegin());
-                vertex->out_edges.pop_back();
+                RemoveVertexEdge(vertex, EdgeDirection::OUT, it);
                 // Decrement edge count. We only decrement the count here because
                 // the information in `REMOVE_IN_EDGE` and `Edge/DELETE_OBJECT` is
                 // redundant. Also, `Edge/DELETE_OBJECT` isn't available when edge
@@ -1387,13 +1560,16 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
           vertex->delta = current;
           if (current != nullptr) {
             current->prev.Set(vertex);
+          } else if (refresh_columnar_properties) {
+            vertex->columnar_stale = true;
+            unlinked_vertices.push_back(vertex);
           }
 
           break;
         }
         case PreviousPtr::Type::EDGE: {
           auto *edge = prev.edge;
-          auto guard = std::lock_guard{edge->lock};
+          auto guard = std::lock_guard{EdgeLock(edge)};
           Delta *current = edge->delta;
           while (current != nullptr &&
                  current->timestamp->load(std::memory_order_acquire) == transaction_.transaction_id) {
@@ -1499,8 +1675,9 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
       for (auto const &[property, prop_vertices] : property_cleanup) {
         storage_->indices_.AbortEntries(property, prop_vertices, transaction_.start_timestamp);
       }
+      composite_index.AbortEntries(composite_cleanup);
       if (flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
-        storage_->indices_.text_index_.Rollback();
+        storage_->indices_.text_index_.Rollback(transaction_.transaction_id);
       }
       for (auto const &[edge_type, edge] : edge_type_cleanup) {
         storage_->indices_.AbortEntries(edge_type, edge, transaction_.start_timestamp);
@@ -1511,11 +1688,15 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
       for (auto const &[edge_type_property, edge] : edge_property_cleanup) {
         storage_->indices_.AbortEntries(edge_type_property, edge, transaction_.start_timestamp);
       }
+      if (refresh_columnar_properties) {
+        storage_->indices_.columnar_property_store_.Refresh(unlinked_vertices);
+      }
 
       // VERTICES
       {
         auto vertices_acc = mem_storage->vertices_.access();
         for (auto gid : my_deleted_vertices) {
+          if (mem_storage->vertex_gid_table_) mem_storage->vertex_gid_table_->Erase(gid);
           vertices_acc.remove(gid);
         }
       }
@@ -1537,16 +1718,20 @@ void InMemoryStorage::InMemoryAccessor::Abort() {
 }
 
 void InMemoryStorage::InMemoryAccessor::FinalizeTransaction() {
+  auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
+  ReleaseGids(mem_storage->vertex_id_, vertex_gids_);
+  ReleaseGids(mem_storage->edge_id_, edge_gids_);
+  vertices_insert_acc_.reset();
+  edges_insert_acc_.reset();
   if (commit_timestamp_) {
-    auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
     mem_storage->commit_log_->MarkFinished(*commit_timestamp_);
 
     if (!transaction_.deltas.empty()) {
       // Only hand over delta to be GC'ed if there was any deltas
       mem_storage->committed_transactions_.WithLock([&](auto &committed_transactions) {
         // using mark of 0 as GC will assign a mark_timestamp after unlinking
-        committed_transactions.emplace_back(0, std::move(transaction_.deltas),
-                                            std::move(transaction_.commit_timestamp));
+        committed_transactions.emplace_back(0, std::move(transaction_.deltas), std::move(transaction_.commit_timestamp),
+                                            std::move(transaction_.index_cleanup_collector_));
       });
     }
     commit_timestamp_.reset();
@@ -1560,7 +1745,8 @@ utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryA
   }
   auto *in_memory = static_cast<InMemoryStorage *>(storage_);
   auto *mem_label_index = static_cast<InMemoryLabelIndex *>(in_memory->indices_.label_index_.get());
-  if (!mem_label_index->CreateIndex(label, in_memory->vertices_.access(), std::nullopt)) {
+  if (!mem_label_index->CreateIndex(label, in_memory->vertices_.access(), std::nullopt,
+                                    in_memory->config_.indices.creation_thread_count)) {
     return StorageIndexDefinitionError{IndexDefinitionError{}};
   }
   transaction_.md_deltas.emplace_back(MetadataDelta::label_index_create, label);
@@ -1575,7 +1761,8 @@ utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryA
   auto *in_memory = static_cast<InMemoryStorage *>(storage_);
   auto *mem_label_property_index =
       static_cast<InMemoryLabelPropertyIndex *>(in_memory->indices_.label_property_index_.get());
-  if (!mem_label_property_index->CreateIndex(label, property, in_memory->vertices_.access(), std::nullopt)) {
+  if (!mem_label_property_index->CreateIndex(label, property, in_memory->vertices_.access(), std::nullopt,
+                                             in_memory->config_.indices.creation_thread_count)) {
     return StorageIndexDefinitionError{IndexDefinitionError{}};
   }
   transaction_.md_deltas.emplace_back(MetadataDelta::label_property_index_create, label, property);
@@ -1584,6 +1771,19 @@ utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryA
   return {};
 }
 
+utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryAccessor::CreateIndex(
+    LabelId label, const std::vector<PropertyId> &properties) {
+  MG_ASSERT(unique_guard_.owns_lock(), "Creating composite index requires a unique access to the storage!");
+  auto *in_memory = static_cast<InMemoryStorage *>(storage_);
+  if (!in_memory->indices_.label_property_composite_index_.CreateIndex(label, properties,
+                                                                       in_memory->vertices_.access())) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
+  }
+  transaction_.md_deltas.emplace_back(MetadataDelta::label_property_composite_index_create, label, properties);
+  // We don't care if there is a replication error because on main node the change will go through
+  return {};
+}
+
 utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryAccessor::CreateIndex(
     EdgeTypeId edge_type, bool unique_access_needed) {
   if (unique_access_needed) {
@@ -1639,6 +1839,17 @@ utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryA
   return {};
 }
 
+utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryAccessor::DropIndex(
+    LabelId label, const std::vector<PropertyId> &properties) {
+  MG_ASSERT(unique_guard_.owns_lock(), "Dropping composite index requires a unique access to the storage!");
+  if (!storage_->indices_.label_property_composite_index_.DropIndex(label, properties)) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
+  }
+  transaction_.md_deltas.emplace_back(MetadataDelta::label_property_composite_index_drop, label, properties);
+  // We don't care if there is a replication error because on main node the change will go through
+  return {};
+}
+
 utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryAccessor::DropIndex(
     EdgeTypeId edge_type) {
   MG_ASSERT(unique_guard_.owns_lock(), "Drop index requires a unique access to the storage!");
@@ -1692,6 +1903,76 @@ utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryA
   return {};
 }
 
+utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryAccessor::CreateVectorIndex(
+    const VectorIndexSpec &spec) {
+  MG_ASSERT(unique_guard_.owns_lock(), "Creating vector index requires a unique access to the storage!");
+  auto *in_memory = static_cast<InMemoryStorage *>(storage_);
+  auto &vector_index = in_memory->indices_.vector_index_;
+  if (!vector_index.CreateIndex(spec, in_memory->vertices_.access())) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
+  }
+  transaction_.md_deltas.emplace_back(MetadataDelta::vector_index_create, spec);
+  // We don't care if there is a replication error because on main node the change will go through
+  memgraph::metrics::IncrementCounter(memgraph::metrics::ActiveVectorIndices);
+  return {};
+}
+
+utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryAccessor::DropVectorIndex(
+    storage::LabelId label, storage::PropertyId property) {
+  MG_ASSERT(unique_guard_.owns_lock(), "Dropping vector index requires a unique access to the storage!");
+  auto *in_memory = static_cast<InMemoryStorage *>(storage_);
+  auto &vector_index = in_memory->indices_.vector_index_;
+  if (!vector_index.DropIndex(label, property)) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
+  }
+  transaction_.md_deltas.emplace_back(MetadataDelta::vector_index_drop, label, property);
+  // We don't care if there is a replication error because on main node the change will go through
+  memgraph::metrics::DecrementCounter(memgraph::metrics::ActiveVectorIndices);
+  return {};
+}
+
+utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryAccessor::CreateColumnarProperty(
+    LabelId label, PropertyId property) {
+  MG_ASSERT(unique_guard_.owns_lock(), "Creating columnar property requires a unique access to the storage!");
+  auto *in_memory = static_cast<InMemoryStorage *>(storage_);
+  if (!in_memory->indices_.columnar_property_store_.CreateColumn(label, property, in_memory->vertices_.access())) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
+  }
+  return {};
+}
+
+utils::BasicResult<StorageIndexDefinitionError, void> InMemoryStorage::InMemoryAccessor::DropColumnarProperty(
+    LabelId label, PropertyId property) {
+  MG_ASSERT(unique_guard_.owns_lock(), "Dropping columnar property requires a unique access to the storage!");
+  auto *in_memory = static_cast<InMemoryStorage *>(storage_);
+  if (!in_memory->indices_.columnar_property_store_.DropColumn(label, property)) {
+    return StorageIndexDefinitionError{IndexDefinitionError{}};
+  }
+  return {};
+}
+
+bool InMemoryStorage::InMemoryAccessor::ScanColumnarProperty(
+    LabelId label, PropertyId property, View view,
+    const std::function<void(const VertexAccessor &, const PropertyValue &)> &func) {
+  auto *in_memory = static_cast<InMemoryStorage *>(storage_);
+  // Keeps the vertices handed out by the columnar store from being freed.
+  auto vertices_acc = in_memory->vertices_.access();
+  // Analytical transactions modify vertices without creating deltas.
+  const bool use_values = transaction_.storage_mode == StorageMode::IN_MEMORY_TRANSACTIONAL;
+  return in_memory->indices_.columnar_property_store_.Scan(
+      label, property, use_values,
+      [&](Vertex *vertex, const PropertyValue &value) { func(VertexAccessor{vertex, storage_, &transaction_}, value); },
+      [&](Vertex *vertex) {
+        auto vertex_acc = VertexAccessor::Create(vertex, storage_, &transaction_, view);
+        if (!vertex_acc) return;
+        auto has_label = vertex_acc->HasLabel(label, view);
+        if (has_label.HasError() || !*has_label) return;
+        auto value = vertex_acc->GetProperty(property, view);
+        if (value.HasError()) return;
+        func(*vertex_acc, *value);
+      });
+}
+
 utils::BasicResult<StorageExistenceConstraintDefinitionError, void>
 InMemoryStorage::InMemoryAccessor::CreateExistenceConstraint(LabelId label, PropertyId property) {
   MG_ASSERT(unique_guard_.owns_lock(), "Creating existence requires a unique access to the storage!");
@@ -1814,11 +2095,81 @@ VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(
       mem_label_property_index->Vertices(label, property, lower_bound, upper_bound, view, storage_, &transaction_));
 }
 
+uint64_t InMemoryStorage::InMemoryAccessor::CountVertices(LabelId label, View view) {
+  auto *mem_label_index = static_cast<InMemoryLabelIndex *>(storage_->indices_.label_index_.get());
+  return mem_label_index->Vertices(label, view, storage_, &transaction_).Count();
+}
+
+uint64_t InMemoryStorage::InMemoryAccessor::CountVertices(LabelId label, PropertyId property, View view) {
+  return CountVertices(label, property, std::nullopt, std::nullopt, view);
+}
+
+uint64_t InMemoryStorage::InMemoryAccessor::CountVertices(
+    LabelId label, PropertyId property, const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) {
+  auto *mem_label_property_index =
+      static_cast<InMemoryLabelPropertyIndex *>(storage_->indices_.label_property_index_.get());
+  return mem_label_property_index->Vertices(label, property, lower_bound, upper_bound, view, storage_, &transaction_)
+      .Count();
+}
+
+VerticesIterable InMemoryStorage::InMemoryAccessor::Vertices(
+    LabelId label, const std::vector<PropertyId> &properties, std::vector<PropertyValue> prefix,
+    const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+    const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) {
+  return VerticesIterable(storage_->indices_.label_property_composite_index_.Vertices(
+      label, properties, std::move(prefix), lower_bound, upper_bound, view, storage_, &transaction_));
+}
+
+std::vector<VerticesIterable> InMemoryStorage::InMemoryAccessor::ChunkedVertices(View view, size_t num_chunks) {
+  auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
+
+  // Chunks are delimited by gids rather than skip list nodes, so every chunk
+  // gets its own accessor below.
+  std::vector<Gid> boundaries;
+  {
+    auto vertices_acc = mem_storage->vertices_.access();
+    for (const auto &chunk : vertices_acc.chunks(num_chunks)) {
+      if (const auto *upper = chunk.upper()) boundaries.push_back(upper->gid);
+    }
+  }
+
+  std::vector<VerticesIterable> chunks;
+  chunks.reserve(boundaries.size() + 1);
+  std::optional<Gid> lower_bound;
+  for (const auto upper_bound : boundaries) {
+    chunks.emplace_back(
+        AllVerticesIterable(mem_storage->vertices_.access(), storage_, &transaction_, view, lower_bound, upper_bound));
+    lower_bound = upper_bound;
+  }
+  chunks.emplace_back(
+      AllVerticesIterable(mem_storage->vertices_.access(), storage_, &transaction_, view, lower_bound, std::nullopt));
+  return chunks;
+}
+
+std::vector<VerticesIterable> InMemoryStorage::InMemoryAccessor::ChunkedVertices(LabelId label, View view,
+                                                                                 size_t num_chunks) {
+  auto *mem_label_index = static_cast<InMemoryLabelIndex *>(storage_->indices_.label_index_.get());
+  auto index_chunks = mem_label_index->ChunkedVertices(label, view, storage_, &transaction_, num_chunks);
+  std::vector<VerticesIterable> chunks;
+  chunks.reserve(index_chunks.size());
+  for (auto &index_chunk : index_chunks) {
+    chunks.emplace_back(std::move(index_chunk));
+  }
+  return chunks;
+}
+
 EdgesIterable InMemoryStorage::InMemoryAccessor::Edges(EdgeTypeId edge_type, View view) {
   auto *mem_edge_type_index = static_cast<InMemoryEdgeTypeIndex *>(storage_->indices_.edge_type_index_.get());
   return EdgesIterable(mem_edge_type_index->Edges(edge_type, view, storage_, &transaction_));
 }
 
+EdgesIterable InMemoryStorage::InMemoryAccessor::Edges(EdgeTypeId edge_type, const VertexAccessor &from,
+                                                       const VertexAccessor &to, View view) {
+  auto *mem_edge_type_index = static_cast<InMemoryEdgeTypeIndex *>(storage_->indices_.edge_type_index_.get());
+  return EdgesIterable(mem_edge_type_index->Edges(edge_type, from.Gid(), to.Gid(), view, storage_, &transaction_));
+}
+
 EdgesIterable InMemoryStorage::InMemoryAccessor::Edges(EdgeTypeId edge_type, PropertyId property, View view) {
   auto *mem_edge_type_property_index =
       static_cast<InMemoryEdgeTypePropertyIndex *>(storage_->indices_.edge_type_property_index_.get());
@@ -1860,22 +2211,33 @@ Transaction InMemoryStorage::CreateTransaction(IsolationLevel isolation_level, S
   // `timestamp`) below.
   uint64_t transaction_id = 0;
   uint64_t start_timestamp = 0;
+  uint64_t last_durable_timestamp = 0;
   std::optional<PointIndexContext> point_index_context;
+  std::vector<LabelPropKey> vector_index_keys;
   {
     auto guard = std::lock_guard{engine_lock_};
     transaction_id = transaction_id_++;
     start_timestamp = timestamp_++;
+    // Commits update the timestamp while holding the lock, so the transaction sees exactly the commits until it
+    last_durable_timestamp = repl_storage_state_.last_durable_timestamp_.load(std::memory_order_acquire);
     // IMPORTANT: this is retrieved while under the lock so that the index is consistant with the timestamp
     point_index_context = indices_.point_index_.CreatePointIndexContext();
+    vector_index_keys = indices_.vector_index_.IndexKeys();
   }
   DMG_ASSERT(point_index_context.has_value(), "Expected a value, even if got 0 point indexes");
-  return {transaction_id,
-          start_timestamp,
-          isolation_level,
-          storage_mode,
-          false,
-          !constraints_.empty(),
-          *std::move(point_index_context)};
+  Transaction transaction{transaction_id,
+                          start_timestamp,
+                          isolation_level,
+                          storage_mode,
+                          false,
+                          !constraints_.empty(),
+                          *std::move(point_index_context)};
+  transaction.vector_index_change_collector_ = VectorIndexChangeCollector{vector_index_keys};
+  if (storage_mode == StorageMode::IN_MEMORY_TRANSACTIONAL && isolation_level == IsolationLevel::SNAPSHOT_ISOLATION) {
+    transaction.vertex_versions = &vertex_versions_;
+    transaction.data_version = last_durable_timestamp;
+  }
+  return transaction;
 }
 
 void InMemoryStorage::SetStorageMode(StorageMode new_storage_mode) {
@@ -1888,8 +2250,17 @@ void InMemoryStorage::SetStorageMode(StorageMode new_storage_mode) {
     if (new_storage_mode == StorageMode::IN_MEMORY_ANALYTICAL) {
       snapshot_runner_.Stop();
     } else if (config_.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::DISABLED) {
-      snapshot_runner_.Run("Snapshot", config_.durability.snapshot_interval,
-                           [this]() { this->create_snapshot_handler(); });
+      snapshot_runner_.Run("Snapshot", config_.durability.snapshot_interval, [this]() {
+        if (this->PeriodicSnapshotNeeded()) {
+          this->create_snapshot_handler();
+        }
+      });
+    }
+
+    if (storage_mode_ == StorageMode::IN_MEMORY_ANALYTICAL) {
+      // Analytical transactions modify vertices in place, so no delta chain
+      // was unlinked for the columnar values to be refreshed.
+      indices_.columnar_property_store_.Rebuild(vertices_.access());
     }
 
     storage_mode_ = new_storage_mode;
@@ -1935,6 +2306,7 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
   // Only one gc run at a time
   auto gc_guard = std::unique_lock{gc_lock_, std::try_to_lock};
   if (!gc_guard.owns_lock()) {
+    utils::RecordLockContention(utils::LockSite::GC, {});
     return;
   }
 
@@ -1943,6 +2315,19 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
   auto trace_on_exit = utils::OnScopeExit{
       [&] { spdlog::trace("Storage GC on '{}' finished [{}]", name(), periodic ? "periodic" : "forced"); }};
 
+  utils::Timer timer;
+  auto measure_on_exit = utils::OnScopeExit{[&] {
+    memgraph::metrics::Measure(memgraph::metrics::GCLatency_us,
+                               std::chrono::duration_cast<std::chrono::microseconds>(timer.Elapsed()).count());
+  }};
+
+  // A periodic GC with a slice configured stops unlinking once the slice is
+  // used up and leaves the rest for the following slices. A transaction's
+  // deltas are always unlinked together, so a slice can take longer than
+  // configured when a single transaction has many deltas.
+  auto const slice = periodic ? config_.gc.slice : std::chrono::milliseconds::zero();
+  bool slice_exhausted = false;
+
   // Garbage collection must be performed in two phases. In the first phase,
   // deltas that won't be applied by any transaction anymore are unlinked from
   // the version chains. They cannot be deleted immediately, because there
@@ -1952,26 +2337,32 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
   // ones.
 
   uint64_t oldest_active_start_timestamp = commit_log_->OldestActive();
+  vertex_versions_.CollectGarbage(oldest_active_start_timestamp);
 
   {
     auto guard = std::unique_lock{engine_lock_};
     uint64_t mark_timestamp = timestamp_;  // a timestamp no active transaction can currently have
 
     // Deltas from previous GC runs or from aborts can be cleaned up here
+    auto releasable_undo_buffers = std::list<GCDeltas>{};
     garbage_undo_buffers_.WithLock([&](auto &garbage_undo_buffers) {
       guard.unlock();
       if (aggressive or mark_timestamp == oldest_active_start_timestamp) {
         // We know no transaction is active, it is safe to simply delete all the garbage undos
         // Nothing can be reading them
-        garbage_undo_buffers.clear();
+        releasable_undo_buffers.swap(garbage_undo_buffers);
       } else {
         // garbage_undo_buffers is ordered, pop until we can't
-        while (!garbage_undo_buffers.empty() &&
-               garbage_undo_buffers.front().mark_timestamp_ <= oldest_active_start_timestamp) {
-          garbage_undo_buffers.pop_front();
+        auto it = garbage_undo_buffers.begin();
+        while (it != garbage_undo_buffers.end() && it->mark_timestamp_ <= oldest_active_start_timestamp) {
+          ++it;
         }
+        releasable_undo_buffers.splice(releasable_undo_buffers.end(), garbage_undo_buffers,
+                                       garbage_undo_buffers.begin(), it);
       }
     });
+    // Free outside of the lock, so commits and aborts aren't blocked meanwhile
+    ReleaseGarbage(std::move(releasable_undo_buffers));
   }
 
   // We don't move undo buffers of unlinked transactions to garbage_undo_buffers
@@ -1984,6 +2375,9 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
   // vertices that appear in an index also exist in main storage.
   std::list<Gid> current_deleted_edges{};
   std::list<Gid> current_deleted_vertices{};
+  // Vertices whose delta chain was unlinked in this GC cycle.
+  const bool refresh_columnar_properties = !indices_.columnar_property_store_.Empty();
+  std::vector<Vertex *> unlinked_vertices{};
 
   deleted_vertices_.WithLock([&](auto &deleted_vertices) { current_deleted_vertices.swap(deleted_vertices); });
   deleted_edges_.WithLock([&](auto &deleted_edges) { current_deleted_edges.swap(deleted_edges); });
@@ -1999,7 +2393,10 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
   // This is to track if any of the unlinked deltas would have an impact on index performance, ie. do they hint that
   // there are possible stale/duplicate entries that can be removed
   auto index_impact = IndexPerformanceTracker{};
+  // The index entries the unlinked transactions may have left obsolete, looked up instead of scanning the indices
+  auto index_cleanup = IndexCleanupCollector{};
 
+  utils::Timer unlink_timer;
   auto const end_linked_undo_buffers = linked_undo_buffers.end();
   for (auto linked_entry = linked_undo_buffers.begin(); linked_entry != end_linked_undo_buffers;) {
     auto const *const commit_timestamp_ptr = linked_entry->commit_timestamp_.get();
@@ -2056,6 +2453,10 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
               continue;
             }
             vertex->delta = nullptr;
+            if (refresh_columnar_properties) {
+              vertex->columnar_stale = true;
+              unlinked_vertices.push_back(vertex);
+            }
             if (vertex->deleted) {
               DMG_ASSERT(delta.action == memgraph::storage::Delta::Action::RECREATE_OBJECT);
               current_deleted_vertices.push_back(vertex->gid);
@@ -2064,7 +2465,7 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
           }
           case PreviousPtr::Type::EDGE: {
             Edge *edge = prev.edge;
-            auto edge_guard = std::unique_lock{edge->lock};
+            auto edge_guard = std::unique_lock{EdgeLock(edge)};
             if (edge->delta != &delta) {
               // Something changed, we're not the first delta in the chain
               // anymore.
@@ -2116,7 +2517,7 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
                 case PreviousPtr::Type::VERTEX:
                   return std::unique_lock{parent.vertex->lock};
                 case PreviousPtr::Type::EDGE:
-                  return std::unique_lock{parent.edge->lock};
+                  return std::unique_lock{EdgeLock(parent.edge)};
                 case PreviousPtr::Type::DELTA:
                 case PreviousPtr::Type::NULLPTR:
                   LOG_FATAL("Invalid database state!");
@@ -2139,12 +2540,26 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
       }
     }
 
+    index_cleanup.Merge(std::move(linked_entry->index_cleanup_));
+
     // Now unlinked, move to unlinked_undo_buffers
     auto const to_move = linked_entry;
     ++linked_entry;  // advanced to next before we move the list node
     unlinked_undo_buffers.splice(unlinked_undo_buffers.end(), linked_undo_buffers, to_move);
+
+    if (slice != std::chrono::milliseconds::zero() && timer.Elapsed() >= slice) {
+      slice_exhausted = linked_entry != end_linked_undo_buffers;
+      break;
+    }
   }
 
+  memgraph::metrics::Measure(memgraph::metrics::GCDeltaUnlinkLatency_us,
+                             std::chrono::duration_cast<std::chrono::microseconds>(unlink_timer.Elapsed()).count());
+  memgraph::metrics::Measure(
+      memgraph::metrics::GCUnlinkedDeltas,
+      std::accumulate(unlinked_undo_buffers.begin(), unlinked_undo_buffers.end(), uint64_t{0},
+                      [](uint64_t curr, auto const &gc_deltas) { return curr + gc_deltas.deltas_.size(); }));
+
   if (!linked_undo_buffers.empty()) {
     // some were not able to be collected, add them back to committed_transactions_ for the next GC run
     committed_transactions_.WithLock([&linked_undo_buffers](auto &committed_transactions) {
@@ -2165,11 +2580,32 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
 
   // Used to determine whether the Index GC should be run for performance reasons (removing redundant entries). It
   // should be run when hinted by FastDiscardOfDeltas or by the deltas we processed this GC run.
-  auto index_cleanup_vertex_performance =
-      gc_index_cleanup_vertex_performance_.exchange(false, std::memory_order_acq_rel) ||
-      index_impact.impacts_vertex_indexes();
-  auto index_cleanup_edge_performance = gc_index_cleanup_edge_performance_.exchange(false, std::memory_order_acq_rel) ||
-                                        index_impact.impacts_edge_indexes();
+  auto const vertex_performance_hint = gc_index_cleanup_vertex_performance_.exchange(false, std::memory_order_acq_rel);
+  auto const edge_performance_hint = gc_index_cleanup_edge_performance_.exchange(false, std::memory_order_acq_rel);
+  auto index_cleanup_vertex_performance = vertex_performance_hint || index_impact.impacts_vertex_indexes();
+  auto index_cleanup_edge_performance = edge_performance_hint || index_impact.impacts_edge_indexes();
+
+  // The label and the edge type indices are only scanned if the changes which left their entries obsolete aren't
+  // all known: after IN_MEMORY_ANALYTICAL deletions, after a hint of FastDiscardOfDeltas or a deferred slice, or once
+  // the transactions changed too many objects to collect them
+  bool const targeted_vertex_cleanup =
+      !need_full_scan_vertices && !vertex_performance_hint && !index_cleanup.Overflowed();
+  bool const targeted_edge_cleanup = !need_full_scan_edges && !edge_performance_hint && !index_cleanup.Overflowed();
+
+  if (slice_exhausted) {
+    // The expensive cleanup of the indices and the removal of the deleted
+    // objects is done once, in the slice which catches up with the backlog.
+    gc_backlog_.store(true, std::memory_order_release);
+    deleted_vertices_.WithLock([&](auto &deleted_vertices) {
+      deleted_vertices.splice(deleted_vertices.end(), current_deleted_vertices);
+    });
+    deleted_edges_.WithLock(
+        [&](auto &deleted_edges) { deleted_edges.splice(deleted_edges.end(), current_deleted_edges); });
+    if (need_full_scan_vertices) gc_full_scan_vertices_delete_.store(true, std::memory_order_release);
+    if (need_full_scan_edges) gc_full_scan_edges_delete_.store(true, std::memory_order_release);
+    if (index_cleanup_vertex_performance) gc_index_cleanup_vertex_performance_.store(true, std::memory_order_release);
+    if (index_cleanup_edge_performance) gc_index_cleanup_edge_performance_.store(true, std::memory_order_release);
+  }
 
   // After unlinking deltas from vertices, we refresh the indices. That way
   // we're sure that none of the vertices from `current_deleted_vertices`
@@ -2177,14 +2613,38 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
   // after the last currently active transaction is finished.
   // This operation is very expensive as it traverses through all of the items
   // in every index every time.
-  if (auto token = stop_source.get_token(); !token.stop_requested()) {
+  if (auto token = stop_source.get_token(); !slice_exhausted && !token.stop_requested()) {
+    utils::Timer index_cleanup_timer;
     if (index_cleanup_vertex_needed || index_cleanup_vertex_performance) {
-      indices_.RemoveObsoleteVertexEntries(oldest_active_start_timestamp, token);
+      if (targeted_vertex_cleanup) {
+        std::vector<Vertex *> deleted_vertices;
+        deleted_vertices.reserve(current_deleted_vertices.size());
+        auto vertex_acc = vertices_.access();
+        for (auto gid : current_deleted_vertices) {
+          auto it = vertex_acc.find(gid);
+          MG_ASSERT(it != vertex_acc.end(), "Invalid database state!");
+          deleted_vertices.push_back(&*it);
+        }
+        indices_.RemoveObsoleteVertexEntries(oldest_active_start_timestamp, index_cleanup.LabelChanges(),
+                                             deleted_vertices, token);
+      } else {
+        indices_.RemoveObsoleteVertexEntries(oldest_active_start_timestamp, token);
+      }
       auto *mem_unique_constraints = static_cast<InMemoryUniqueConstraints *>(constraints_.unique_constraints_.get());
       mem_unique_constraints->RemoveObsoleteEntries(oldest_active_start_timestamp, token);
     }
     if (index_cleanup_edge_needed || index_cleanup_edge_performance) {
-      indices_.RemoveObsoleteEdgeEntries(oldest_active_start_timestamp, token);
+      if (targeted_edge_cleanup) {
+        indices_.RemoveObsoleteEdgeEntries(oldest_active_start_timestamp, index_cleanup.DeletedEdges(), token);
+      } else {
+        indices_.RemoveObsoleteEdgeEntries(oldest_active_start_timestamp, token);
+      }
+    }
+    if (index_cleanup_vertex_needed || index_cleanup_vertex_performance || index_cleanup_edge_needed ||
+        index_cleanup_edge_performance) {
+      memgraph::metrics::Measure(
+          memgraph::metrics::GCIndexCleanupLatency_us,
+          std::chrono::duration_cast<std::chrono::microseconds>(index_cleanup_timer.Elapsed()).count());
     }
   }
 
@@ -2202,7 +2662,7 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
           std::accumulate(unlinked_undo_buffers.begin(), unlinked_undo_buffers.end(), 0U, sum_func);
 
       // Now total_deltas contains the sum of all deltas in the unlinked_undo_buffers list
-      unlinked_undo_buffers.clear();
+      ReleaseGarbage(std::move(unlinked_undo_buffers));
       memgraph::metrics::DecrementCounter(memgraph::metrics::UnreleasedDeltaObjects, total_delta_size);
     } else {
       // Take garbage_undo_buffers lock while holding the engine lock to make
@@ -2221,9 +2681,15 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
     }
   }
 
+  // Vertices without a delta chain are visible to everyone, refresh their
+  // columnar values. Deleted vertices are removed from the columnar store here,
+  // before they are removed from the main storage.
+  if (refresh_columnar_properties) indices_.columnar_property_store_.Refresh(unlinked_vertices);
+
   {
     auto vertex_acc = vertices_.access();
     for (auto vertex : current_deleted_vertices) {
+      if (vertex_gid_table_) vertex_gid_table_->Erase(vertex);
       MG_ASSERT(vertex_acc.remove(vertex), "Invalid database state!");
     }
   }
@@ -2243,18 +2709,21 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
   //  accessor.remove_if([](auto const & item){ return item.delta == nullptr && item.deleted;});
   //  alternatively, an auxiliary data structure within skip_list to track these, hence a full scan wouldn't be needed
   //  we will wait for evidence that this is needed before doing so.
-  if (need_full_scan_vertices) {
+  if (need_full_scan_vertices && !slice_exhausted) {
     auto vertex_acc = vertices_.access();
     for (auto &vertex : vertex_acc) {
       // a deleted vertex which as no deltas must have come from IN_MEMORY_ANALYTICAL deletion
       if (vertex.delta == nullptr && vertex.deleted) {
+        Vertex *const deleted_vertex = &vertex;
+        indices_.columnar_property_store_.Refresh({&deleted_vertex, 1});
+        if (vertex_gid_table_) vertex_gid_table_->Erase(vertex.gid);
         vertex_acc.remove(vertex);
       }
     }
   }
 
   // EXPENSIVE full scan, is only run if an IN_MEMORY_ANALYTICAL transaction involved any deletions
-  if (need_full_scan_edges) {
+  if (need_full_scan_edges && !slice_exhausted) {
     auto edge_acc = edges_.access();
     auto edge_metadata_acc = edges_metadata_.access();
     for (auto &edge : edge_acc) {
@@ -2265,12 +2734,34 @@ void InMemoryStorage::CollectGarbage(std::unique_lock<utils::ResourceLock> main_
       }
     }
   }
+
+  // The property buffers and adjacency lists freed by the GC go back to the writers
+  utils::SmallBlockPool::FlushThreadCache();
 }
 
 // tell the linker he can find the CollectGarbage definitions here
 template void InMemoryStorage::CollectGarbage<true>(std::unique_lock<utils::ResourceLock> main_guard, bool periodic);
 template void InMemoryStorage::CollectGarbage<false>(std::unique_lock<utils::ResourceLock> main_guard, bool periodic);
 
+void InMemoryStorage::ReleaseGarbage(std::list<GCDeltas> garbage) {
+  if (garbage.empty()) return;
+  if (!gc_release_pool_) {
+    garbage.clear();
+    return;
+  }
+
+  // Split the garbage into one part per release thread, so a large GC cycle is
+  // freed by all of them.
+  auto const parts = config_.gc.release_threads;
+  auto const part_size = std::max<size_t>(garbage.size() / parts, 1);
+  while (!garbage.empty()) {
+    auto part = std::list<GCDeltas>{};
+    auto end = garbage.size() <= part_size ? garbage.end() : std::next(garbage.begin(), part_size);
+    part.splice(part.end(), garbage, garbage.begin(), end);
+    gc_release_pool_->AddTask([part = std::move(part)]() mutable { part.clear(); });
+  }
+}
+
 StorageInfo InMemoryStorage::GetBaseInfo() {
   StorageInfo info{};
   info.vertex_count = vertices_.size();
@@ -2311,16 +2802,7 @@ StorageInfo InMemoryStorage::GetBaseInfo() {
 
 StorageInfo InMemoryStorage::GetInfo() {
   StorageInfo info = GetBaseInfo();
-  {
-    auto access = Access();  // TODO: override isolation level?
-    const auto &lbl = access->ListAllIndices();
-    info.label_indices = lbl.label.size();
-    info.label_property_indices = lbl.label_property.size();
-    info.text_indices = lbl.text_indices.size();
-    const auto &con = access->ListAllConstraints();
-    info.existence_constraints = con.existence.size();
-    info.unique_constraints = con.unique.size();
-  }
+  SetIndexAndConstraintCounts(info);
   info.storage_mode = storage_mode_;
   info.isolation_level = isolation_level_;
   info.durability_snapshot_enabled =
@@ -2333,29 +2815,92 @@ StorageInfo InMemoryStorage::GetInfo() {
   return info;
 }
 
+GarbageInfo InMemoryStorage::GetGarbageInfo() {
+  GarbageInfo info{};
+  auto const sum_deltas = [](uint64_t curr, auto const &gc_deltas) { return curr + gc_deltas.deltas_.size(); };
+  committed_transactions_.WithLock([&](auto const &committed_transactions) {
+    info.committed_transactions = committed_transactions.size();
+    info.committed_deltas =
+        std::accumulate(committed_transactions.begin(), committed_transactions.end(), uint64_t{0}, sum_deltas);
+  });
+  garbage_undo_buffers_.WithLock([&](auto const &garbage_undo_buffers) {
+    info.unlinked_transactions = garbage_undo_buffers.size();
+    info.unlinked_deltas =
+        std::accumulate(garbage_undo_buffers.begin(), garbage_undo_buffers.end(), uint64_t{0}, sum_deltas);
+  });
+  info.delta_bytes = (info.committed_deltas + info.unlinked_deltas) * sizeof(Delta);
+  info.deleted_vertices =
+      deleted_vertices_.WithLock([](auto const &deleted_vertices) { return deleted_vertices.size(); });
+  info.deleted_edges = deleted_edges_.WithLock([](auto const &deleted_edges) { return deleted_edges.size(); });
+
+  info.skip_list_garbage.emplace_back("vertices", vertices_.garbage_size());
+  info.skip_list_garbage.emplace_back("edges", edges_.garbage_size());
+  info.skip_list_garbage.emplace_back("edges_metadata", edges_metadata_.garbage_size());
+  {
+    // The accessor keeps the indices from being created or dropped meanwhile.
+    auto access = Access();
+    for (auto const &[label, size] : static_cast<InMemoryLabelIndex *>(indices_.label_index_.get())->GarbageSizes()) {
+      info.skip_list_garbage.emplace_back(fmt::format("label_index(:{})", LabelToName(label)), size);
+    }
+    for (auto const &[key, size] :
+         static_cast<InMemoryLabelPropertyIndex *>(indices_.label_property_index_.get())->GarbageSizes()) {
+      info.skip_list_garbage.emplace_back(
+          fmt::format("label_property_index(:{}({}))", LabelToName(key.first), PropertyToName(key.second)), size);
+    }
+    for (auto const &[edge_type, size] :
+         static_cast<InMemoryEdgeTypeIndex *>(indices_.edge_type_index_.get())->GarbageSizes()) {
+      info.skip_list_garbage.emplace_back(fmt::format("edge_type_index(:{})", EdgeTypeToName(edge_type)), size);
+    }
+    for (auto const &[key, size] :
+         static_cast<InMemoryEdgeTypePropertyIndex *>(indices_.edge_type_property_index_.get())->GarbageSizes()) {
+      info.skip_list_garbage.emplace_back(
+          fmt::format("edge_type_property_index(:{}({}))", EdgeTypeToName(key.first), PropertyToName(key.second)),
+          size);
+    }
+  }
+  return info;
+}
+
 bool InMemoryStorage::InitializeWalFile(memgraph::replication::ReplicationEpoch &epoch) {
   if (config_.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL) {
     return false;
   }
 
   if (!wal_file_) {
+    auto file_guard = std::lock_guard{wal_file_lock_};
     wal_file_.emplace(recovery_.wal_directory_, uuid(), epoch.id(), config_.salient.items, name_id_mapper_.get(),
-                      wal_seq_num_++, &file_retainer_);
+                      wal_seq_num_++, &file_retainer_, config_.durability.wal_file_size_kibibytes * 1024);
   }
 
   return true;
 }
 
 void InMemoryStorage::FinalizeWalFile() {
-  ++wal_unsynced_transactions_;
-  if (wal_unsynced_transactions_ >= config_.durability.wal_file_flush_every_n_tx) {
-    wal_file_->Sync();
-    wal_unsynced_transactions_ = 0;
+  const auto group_commit = config_.durability.wal_group_commit;
+  if (group_commit) {
+    // The transaction is synced later by the group commit leader.
+    auto guard = std::lock_guard{wal_group_commit_.lock};
+    ++wal_group_commit_.written;
+  } else {
+    ++wal_unsynced_transactions_;
+    if (wal_unsynced_transactions_ >= config_.durability.wal_file_flush_every_n_tx) {
+      wal_file_->Sync();
+      wal_unsynced_transactions_ = 0;
+    }
   }
   if (wal_file_->GetSize() / 1024 >= config_.durability.wal_file_size_kibibytes) {
-    wal_file_->FinalizeWal();
-    wal_file_ = std::nullopt;
+    {
+      auto file_guard = std::lock_guard{wal_file_lock_};
+      wal_file_->FinalizeWal();
+      wal_file_ = std::nullopt;
+    }
     wal_unsynced_transactions_ = 0;
+    if (group_commit) {
+      // Finalizing the WAL syncs it, so everything written so far is durable.
+      auto guard = std::lock_guard{wal_group_commit_.lock};
+      wal_group_commit_.synced = wal_group_commit_.written;
+      wal_group_commit_.cv.notify_all();
+    }
   } else {
     // Try writing the internal buffer if possible, if not
     // the data should be written as soon as it's possible
@@ -2365,11 +2910,36 @@ void InMemoryStorage::FinalizeWalFile() {
   }
 }
 
-bool InMemoryStorage::AppendToWal(const Transaction &transaction, uint64_t durability_commit_timestamp,
+void InMemoryStorage::WaitForWalGroupCommit(uint64_t ticket) {
+  auto guard = std::unique_lock{wal_group_commit_.lock};
+  while (wal_group_commit_.synced < ticket) {
+    if (wal_group_commit_.leader_active) {
+      wal_group_commit_.cv.wait(guard);
+      continue;
+    }
+    // Become the leader; every transaction written until now is covered by this sync.
+    wal_group_commit_.leader_active = true;
+    const auto target = wal_group_commit_.written;
+    guard.unlock();
+    {
+      auto file_guard = std::lock_guard{wal_file_lock_};
+      // Missing WAL file means it was finalized (and synced) in the meantime.
+      if (wal_file_) wal_file_->Sync();
+    }
+    guard.lock();
+    wal_group_commit_.synced = std::max(wal_group_commit_.synced, target);
+    wal_group_commit_.leader_active = false;
+    wal_group_commit_.cv.notify_all();
+  }
+}
+
+bool InMemoryStorage::AppendToWal(Transaction &transaction, uint64_t durability_commit_timestamp,
                                   DatabaseAccessProtector db_acc) {
+  utils::tracing::ScopedSpan const span("storage.append_to_wal");
   if (!InitializeWalFile(repl_storage_state_.epoch_)) {
     return true;
   }
+  const auto wal_size_before = wal_file_->GetSize();
   // Traverse deltas and append them to the WAL file.
   // A single transaction will always be contained in a single WAL file.
   auto current_commit_timestamp = transaction.commit_timestamp->load(std::memory_order_acquire);
@@ -2437,13 +3007,20 @@ bool InMemoryStorage::AppendToWal(const Transaction &transaction, uint64_t durab
       case MetadataDelta::Action::EXISTENCE_CONSTRAINT_CREATE:
       case MetadataDelta::Action::EXISTENCE_CONSTRAINT_DROP:
       case MetadataDelta::Action::POINT_INDEX_CREATE:
-      case MetadataDelta::Action::POINT_INDEX_DROP: {
+      case MetadataDelta::Action::POINT_INDEX_DROP:
+      case MetadataDelta::Action::VECTOR_INDEX_DROP: {
         apply_encode(op, [&](durability::BaseEncoder &encoder) {
           EncodeLabelProperty(encoder, *name_id_mapper_, md_delta.label_property.label,
                               md_delta.label_property.property);
         });
         break;
       }
+      case MetadataDelta::Action::VECTOR_INDEX_CREATE: {
+        apply_encode(op, [&](durability::BaseEncoder &encoder) {
+          EncodeVectorIndex(encoder, *name_id_mapper_, md_delta.vector_index);
+        });
+        break;
+      }
       case MetadataDelta::Action::LABEL_INDEX_STATS_SET: {
         apply_encode(op, [&](durability::BaseEncoder &encoder) {
           EncodeLabelStats(encoder, *name_id_mapper_, md_delta.label_stats.label, md_delta.label_stats.stats);
@@ -2457,6 +3034,14 @@ bool InMemoryStorage::AppendToWal(const Transaction &transaction, uint64_t durab
         });
         break;
       }
+      case MetadataDelta::Action::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+      case MetadataDelta::Action::LABEL_PROPERTY_COMPOSITE_INDEX_DROP: {
+        apply_encode(op, [&](durability::BaseEncoder &encoder) {
+          EncodeLabelPropertyList(encoder, *name_id_mapper_, md_delta.label_property_list.label,
+                                  md_delta.label_property_list.properties);
+        });
+        break;
+      }
       case MetadataDelta::Action::UNIQUE_CONSTRAINT_CREATE:
       case MetadataDelta::Action::UNIQUE_CONSTRAINT_DROP: {
         apply_encode(op, [&](durability::BaseEncoder &encoder) {
@@ -2496,6 +3081,17 @@ bool InMemoryStorage::AppendToWal(const Transaction &transaction, uint64_t durab
   }
 
   auto append_deltas = [&](auto callback) {
+    // A SET_PROPERTY delta is encoded with the value the object has now, so
+    // all SET_PROPERTY deltas of a property in the chain of an object encode
+    // the same value and only the first one of them is appended.
+    std::vector<PropertyId> appended_properties;
+    auto is_repeated_set = [&](const Delta &delta) {
+      if (delta.action != Delta::Action::SET_PROPERTY) return false;
+      if (std::ranges::find(appended_properties, delta.property.key) != appended_properties.end()) return true;
+      appended_properties.push_back(delta.property.key);
+      return false;
+    };
+
     // Helper lambda that traverses the delta chain on order to find the first
     // delta that should be processed and then appends all discovered deltas.
     auto find_and_apply_deltas = [&](const auto *delta, const auto &parent, auto filter) {
@@ -2504,8 +3100,9 @@ bool InMemoryStorage::AppendToWal(const Transaction &transaction, uint64_t durab
         if (older == nullptr || older->timestamp->load(std::memory_order_acquire) != current_commit_timestamp) break;
         delta = older;
       }
+      appended_properties.clear();
       while (true) {
-        if (filter(delta->action)) {
+        if (filter(delta->action) && !is_repeated_set(*delta)) {
           callback(*delta, parent, durability_commit_timestamp);
         }
         auto prev = delta->prev.Get();
@@ -2644,9 +3241,11 @@ bool InMemoryStorage::AppendToWal(const Transaction &transaction, uint64_t durab
 
   // Handle MVCC deltas
   if (!transaction.deltas.empty()) {
-    append_deltas([&](const Delta &delta, const auto &parent, uint64_t durability_commit_timestamp) {
-      wal_file_->AppendDelta(delta, parent, durability_commit_timestamp);
-      repl_storage_state_.AppendDelta(streams, delta, parent, durability_commit_timestamp);
+    repl_storage_state_.WithDeltaAppender(streams, [&](const auto &append_to_replicas) {
+      append_deltas([&](const Delta &delta, const auto &parent, uint64_t durability_commit_timestamp) {
+        wal_file_->AppendDelta(delta, parent, durability_commit_timestamp);
+        append_to_replicas(delta, parent, durability_commit_timestamp);
+      });
     });
   }
 
@@ -2654,6 +3253,7 @@ bool InMemoryStorage::AppendToWal(const Transaction &transaction, uint64_t durab
   // TODO: (andi) I think this should happen in reverse order because it could happen that we fsync on replica
   // before than on main.
   wal_file_->AppendTransactionEnd(durability_commit_timestamp);
+  transaction.wal_bytes = wal_file_->GetSize() - wal_size_before;
   FinalizeWalFile();
 
   return repl_storage_state_.FinalizeTransaction(durability_commit_timestamp, this, std::move(db_acc),
@@ -2692,11 +3292,42 @@ void InMemoryStorage::FreeMemory(std::unique_lock<utils::ResourceLock> main_guar
   std::invoke(free_memory_func_, std::move(main_guard), periodic);
 }
 
+void InMemoryStorage::TierProperties() {
+  auto vertex_acc = vertices_.access();
+  for (auto &vertex : vertex_acc) {
+    if (stop_source.stop_requested()) return;
+    auto guard = std::lock_guard{vertex.lock};
+    if (vertex.deleted) continue;
+    auto const reads = std::atomic_ref{vertex.properties_reads}.exchange(0, std::memory_order_relaxed);
+    try {
+      if (reads != 0) {
+        vertex.properties.Restore();
+      } else if (vertex.delta == nullptr) {
+        // Vertices with deltas are still being changed or read at older versions.
+        vertex.properties.Evict(FLAGS_storage_property_tier_min_size);
+      }
+    } catch (const utils::BasicException &e) {
+      spdlog::warn("Couldn't restore the properties of vertex {}: {}", vertex.gid.AsUint(), e.what());
+    }
+  }
+}
+
+void InMemoryStorage::CompactAdjacency() {
+  auto vertex_acc = vertices_.access();
+  for (auto &vertex : vertex_acc) {
+    if (stop_source.stop_requested() || GetStorageMode() != StorageMode::IN_MEMORY_ANALYTICAL) return;
+    auto guard = std::lock_guard{vertex.lock};
+    if (vertex.deleted) continue;
+    CompactVertexEdges(&vertex);
+  }
+}
+
 uint64_t InMemoryStorage::GetCommitTimestamp() { return timestamp_++; }
 
 void InMemoryStorage::PrepareForNewEpoch() {
   std::unique_lock engine_guard{engine_lock_};
   if (wal_file_) {
+    auto file_guard = std::lock_guard{wal_file_lock_};
     wal_file_->FinalizeWal();
     wal_file_.reset();
   }
@@ -2756,16 +3387,61 @@ void InMemoryStorage::CreateSnapshotHandler(
   // Run the snapshot thread (if enabled)
   if (config_.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::DISABLED) {
     snapshot_runner_.Run("Snapshot", config_.durability.snapshot_interval, [this, token = stop_source.get_token()]() {
-      if (!token.stop_requested()) {
+      if (!token.stop_requested() && this->PeriodicSnapshotNeeded()) {
         this->create_snapshot_handler();
       }
     });
   }
 }
 
+bool InMemoryStorage::PeriodicSnapshotNeeded() {
+  const auto min_wal_percent = config_.durability.snapshot_min_wal_percent;
+  if (min_wal_percent == 0 ||
+      config_.durability.snapshot_wal_mode != Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL) {
+    return true;
+  }
+
+  const auto uuid_str = std::string{uuid()};
+  const auto snapshot_files = durability::GetSnapshotFiles(recovery_.snapshot_directory_, uuid_str);
+  if (snapshot_files.empty()) return true;
+  const auto &latest = *std::ranges::max_element(
+      snapshot_files, {}, [](const durability::SnapshotDurabilityInfo &info) { return info.start_timestamp; });
+  std::error_code error_code;
+  const auto snapshot_size = std::filesystem::file_size(latest.path, error_code);
+  if (error_code || snapshot_size == 0) return true;
+
+  // The current WAL file isn't finalized, so its size is taken from the file
+  // itself and it is left out of the finalized files read from the directory
+  uint64_t wal_size = 0;
+  std::optional<size_t> current_seq_num;
+  {
+    auto file_guard = std::lock_guard{wal_file_lock_};
+    if (wal_file_) {
+      if (wal_file_->Count() != 0 && wal_file_->ToTimestamp() > latest.start_timestamp) {
+        wal_size += wal_file_->GetSize();
+      }
+      current_seq_num = wal_file_->SequenceNumber();
+    }
+  }
+  if (auto wal_files = durability::GetWalFiles(recovery_.wal_directory_, uuid_str, current_seq_num)) {
+    for (const auto &wal_file : *wal_files) {
+      if (wal_file.to_timestamp <= latest.start_timestamp) continue;
+      const auto size = std::filesystem::file_size(wal_file.path, error_code);
+      if (!error_code) wal_size += size;
+    }
+  }
+
+  if (wal_size * 100 >= min_wal_percent * snapshot_size) return true;
+  spdlog::trace("Skipping periodic snapshot, {} bytes of WAL files were written since the snapshot {} of {} bytes.",
+                wal_size, latest.path, snapshot_size);
+  return false;
+}
+
 std::optional<std::tuple<EdgeRef, EdgeTypeId, Vertex *, Vertex *>> InMemoryStorage::FindEdge(Gid gid) {
   using EdgeInfo = std::optional<std::tuple<EdgeRef, EdgeTypeId, Vertex *, Vertex *>>;
 
+  // Taken before the edge is found so the vertex of its hint isn't freed
+  auto vertices_acc = vertices_.access();
   auto edge_acc = edges_.access();
   auto edge_it = edge_acc.find(gid);
   if (edge_it == edge_acc.end()) {
@@ -2773,7 +3449,6 @@ std::optional<std::tuple<EdgeRef, EdgeTypeId, Vertex *, Vertex *>> InMemoryStora
   }
 
   auto *edge_ptr = &(*edge_it);
-  auto vertices_acc = vertices_.access();
 
   auto extract_edge_info = [&](Vertex *from_vertex) -> EdgeInfo {
     for (auto &out_edge : from_vertex->out_edges) {
@@ -2794,8 +3469,17 @@ std::optional<std::tuple<EdgeRef, EdgeTypeId, Vertex *, Vertex *>> InMemoryStora
     return maybe_edge_info;
   }
 
-  // If metadata on edges is not enabled we will have to do
-  // a full scan.
+  auto *from_vertex_hint = std::invoke([&] {
+    auto guard = std::shared_lock{EdgeLock(edge_ptr)};
+    return edge_ptr->FromVertexHint();
+  });
+  if (from_vertex_hint) {
+    if (auto maybe_edge_info = extract_edge_info(from_vertex_hint)) return maybe_edge_info;
+  }
+
+  // If the edge doesn't know its from vertex, e.g. because it was recovered
+  // from an older snapshot, we will have to do a full scan and remember the
+  // vertex for the next lookup.
   auto maybe_edge_info = std::invoke([&]() -> EdgeInfo {
     for (auto &from_vertex : vertices_acc) {
       auto maybe_edge_info = extract_edge_info(&from_vertex);
@@ -2805,6 +3489,10 @@ std::optional<std::tuple<EdgeRef, EdgeTypeId, Vertex *, Vertex *>> InMemoryStora
     }
     return std::nullopt;
   });
+  if (maybe_edge_info) {
+    auto guard = std::unique_lock{EdgeLock(edge_ptr)};
+    edge_ptr->SetFromVertexHint(std::get<2>(*maybe_edge_info));
+  }
 
   return maybe_edge_info;
 }
@@ -2820,9 +3508,14 @@ IndicesInfo InMemoryStorage::InMemoryAccessor::ListAllIndices() const {
   auto &text_index = storage_->indices_.text_index_;
   auto &point_index = storage_->indices_.point_index_;
 
-  return {mem_label_index->ListIndices(),     mem_label_property_index->ListIndices(),
-          mem_edge_type_index->ListIndices(), mem_edge_type_property_index->ListIndices(),
-          text_index.ListIndices(),           point_index.ListIndices()};
+  return {mem_label_index->ListIndices(),
+          mem_label_property_index->ListIndices(),
+          mem_edge_type_index->ListIndices(),
+          mem_edge_type_property_index->ListIndices(),
+          text_index.ListIndices(),
+          point_index.ListIndices(),
+          in_memory->indices_.label_property_composite_index_.ListIndices(),
+          in_memory->indices_.vector_index_.ListIndices()};
 }
 ConstraintsInfo InMemoryStorage::InMemoryAccessor::ListAllConstraints() const {
   const auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
@@ -2861,9 +3554,16 @@ std::vector<std::pair<LabelId, PropertyId>> InMemoryStorage::InMemoryAccessor::D
 
 void InMemoryStorage::InMemoryAccessor::DropGraph() {
   auto *mem_storage = static_cast<InMemoryStorage *>(storage_);
+  // Clearing the skip lists invalidates their accessors
+  vertices_insert_acc_.reset();
+  edges_insert_acc_.reset();
 
   // we take the control from the GC to clear any deltas
-  auto gc_guard = std::unique_lock{mem_storage->gc_lock_};
+  auto gc_guard = std::unique_lock{mem_storage->gc_lock_, std::try_to_lock};
+  if (!gc_guard.owns_lock()) {
+    auto const wait = utils::LockWait{utils::LockSite::GC};
+    gc_guard.lock();
+  }
   mem_storage->garbage_undo_buffers_.WithLock([&](auto &garbage_undo_buffers) { garbage_undo_buffers.clear(); });
   mem_storage->committed_transactions_.WithLock([&](auto &committed_transactions) { committed_transactions.clear(); });
 
@@ -2873,6 +3573,7 @@ void InMemoryStorage::InMemoryAccessor::DropGraph() {
 
   if (mem_storage->config_.salient.items.enable_schema_info) mem_storage->SchemaInfoWriteAccessor().Clear();
 
+  if (mem_storage->vertex_gid_table_) mem_storage->vertex_gid_table_->Clear();
   mem_storage->vertices_.clear();
   mem_storage->edges_.clear();
   mem_storage->edge_count_.store(0);
@@ -11,15 +11,21 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <utility>
+#include "storage/v2/indices/index_cleanup_collector.hpp"
 #include "storage/v2/indices/label_index_stats.hpp"
 #include "storage/v2/inmemory/edge_type_index.hpp"
 #include "storage/v2/inmemory/label_index.hpp"
 #include "storage/v2/inmemory/label_property_index.hpp"
 #include "storage/v2/inmemory/replication/recovery.hpp"
+#include "storage/v2/inmemory/vertex_gid_table.hpp"
 #include "storage/v2/replication/replication_client.hpp"
 #include "storage/v2/schema_info.hpp"
 #include "storage/v2/storage.hpp"
@@ -33,9 +39,11 @@
 #include "storage/v2/replication/rpc.hpp"
 #include "storage/v2/replication/serialization.hpp"
 #include "storage/v2/transaction.hpp"
+#include "storage/v2/vertex_version_store.hpp"
 #include "utils/memory.hpp"
 #include "utils/resource_lock.hpp"
 #include "utils/synchronized.hpp"
+#include "utils/thread_pool.hpp"
 
 namespace memgraph::dbms {
 class InMemoryReplicationHandlers;
@@ -150,10 +158,30 @@ class InMemoryStorage final : public Storage {
                               const std::optional<utils::Bound<PropertyValue>> &lower_bound,
                               const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) override;
 
+    uint64_t CountVertices(LabelId label, View view) override;
+
+    uint64_t CountVertices(LabelId label, PropertyId property, View view) override;
+
+    uint64_t CountVertices(LabelId label, PropertyId property,
+                           const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                           const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) override;
+
+    VerticesIterable Vertices(LabelId label, const std::vector<PropertyId> &properties,
+                              std::vector<PropertyValue> prefix,
+                              const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                              const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) override;
+
+    std::vector<VerticesIterable> ChunkedVertices(View view, size_t num_chunks) override;
+
+    std::vector<VerticesIterable> ChunkedVertices(LabelId label, View view, size_t num_chunks) override;
+
     std::optional<EdgeAccessor> FindEdge(Gid gid, View view) override;
 
     EdgesIterable Edges(EdgeTypeId edge_type, View view) override;
 
+    EdgesIterable Edges(EdgeTypeId edge_type, const VertexAccessor &from, const VertexAccessor &to,
+                        View view) override;
+
     EdgesIterable Edges(EdgeTypeId edge_type, PropertyId property, View view) override;
 
     EdgesIterable Edges(EdgeTypeId edge_type, PropertyId property, const PropertyValue &value, View view) override;
@@ -200,6 +228,21 @@ class InMemoryStorage final : public Storage {
           label, property, lower, upper);
     }
 
+    /// Return approximate number of vertices in the composite index over
+    /// `properties` of `label`.
+    uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties) const override {
+      return static_cast<InMemoryStorage *>(storage_)->indices_.label_property_composite_index_.ApproximateVertexCount(
+          label, properties);
+    }
+
+    /// Return approximate number of vertices in the composite index over
+    /// `properties` of `label` whose first properties are equal to `prefix`.
+    uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                    const std::vector<PropertyValue> &prefix) const override {
+      return static_cast<InMemoryStorage *>(storage_)->indices_.label_property_composite_index_.ApproximateVertexCount(
+          label, properties, prefix);
+    }
+
     uint64_t ApproximateEdgeCount(EdgeTypeId edge_type) const override {
       return static_cast<InMemoryStorage *>(storage_)->indices_.edge_type_index_->ApproximateEdgeCount(edge_type);
     }
@@ -226,6 +269,17 @@ class InMemoryStorage final : public Storage {
       return storage_->indices_.point_index_.ApproximatePointCount(label, property);
     }
 
+    std::vector<VertexAccessor> NearestPointVertices(LabelId label, PropertyId property, const PropertyValue &point,
+                                                     std::size_t k, View view) override;
+
+    uint64_t ApproximateVectorCount(LabelId label, PropertyId property) const override {
+      return storage_->indices_.vector_index_.ApproximateVectorCount(label, property);
+    }
+
+    std::vector<std::pair<VertexAccessor, double>> VectorIndexSearch(LabelId label, PropertyId property,
+                                                                     const PropertyValue &query, std::size_t k,
+                                                                     View view) override;
+
     template <typename TResult, typename TIndex, typename TIndexKey>
     std::optional<TResult> GetIndexStatsForIndex(TIndex *index, TIndexKey &&key) const {
       return index->GetIndexStats(key);
@@ -285,6 +339,15 @@ class InMemoryStorage final : public Storage {
       return static_cast<InMemoryStorage *>(storage_)->indices_.label_property_index_->IndexExists(label, property);
     }
 
+    bool LabelPropertyCompositeIndexExists(LabelId label, const std::vector<PropertyId> &properties) const override {
+      return static_cast<InMemoryStorage *>(storage_)->indices_.label_property_composite_index_.IndexExists(
+          label, properties);
+    }
+
+    std::vector<std::vector<PropertyId>> ListLabelPropertyCompositeIndices(LabelId label) const override {
+      return static_cast<InMemoryStorage *>(storage_)->indices_.label_property_composite_index_.ListIndices(label);
+    }
+
     bool EdgeTypeIndexExists(EdgeTypeId edge_type) const override {
       return static_cast<InMemoryStorage *>(storage_)->indices_.edge_type_index_->IndexExists(edge_type);
     }
@@ -294,6 +357,14 @@ class InMemoryStorage final : public Storage {
                                                                                                        property);
     }
 
+    bool PointIndexExists(LabelId label, PropertyId property) const override {
+      return storage_->indices_.point_index_.PointIndexExists(label, property);
+    }
+
+    std::optional<uint64_t> VectorIndexDimension(LabelId label, PropertyId property) const override {
+      return storage_->indices_.vector_index_.IndexDimension(label, property);
+    }
+
     IndicesInfo ListAllIndices() const override;
 
     ConstraintsInfo ListAllConstraints() const override;
@@ -333,6 +404,14 @@ class InMemoryStorage final : public Storage {
     /// @throw std::bad_alloc
     utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(LabelId label, PropertyId property) override;
 
+    /// Create a composite index over the ordered list of `properties`.
+    /// Returns void if the index has been created.
+    /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
+    /// * `IndexDefinitionError`: the index already exists.
+    /// @throw std::bad_alloc
+    utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(
+        LabelId label, const std::vector<PropertyId> &properties) override;
+
     /// Create an index.
     /// Returns void if the index has been created.
     /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
@@ -365,6 +444,13 @@ class InMemoryStorage final : public Storage {
     /// * `IndexDefinitionError`: the index does not exist.
     utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(LabelId label, PropertyId property) override;
 
+    /// Drop an existing composite index.
+    /// Returns void if the index has been dropped.
+    /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
+    /// * `IndexDefinitionError`: the index does not exist.
+    utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(
+        LabelId label, const std::vector<PropertyId> &properties) override;
+
     /// Drop an existing index.
     /// Returns void if the index has been dropped.
     /// Returns `StorageIndexDefinitionError` if an error occures. Error can be:
@@ -385,6 +471,32 @@ class InMemoryStorage final : public Storage {
     utils::BasicResult<StorageIndexDefinitionError, void> DropPointIndex(storage::LabelId label,
                                                                          storage::PropertyId property) override;
 
+    /// Create a vector index over the lists of `spec.dimension` numbers in
+    /// `spec.property` of the vertices with `spec.label`.
+    /// Returns `IndexDefinitionError` if the index already exists.
+    utils::BasicResult<StorageIndexDefinitionError, void> CreateVectorIndex(const VectorIndexSpec &spec) override;
+
+    utils::BasicResult<StorageIndexDefinitionError, void> DropVectorIndex(storage::LabelId label,
+                                                                          storage::PropertyId property) override;
+
+    /// Keep the values of `property` of vertices with `label` in the columnar
+    /// store, see `ColumnarPropertyStore`. The designation is neither made
+    /// durable nor replicated.
+    /// Returns `IndexDefinitionError` if the columnar property already exists.
+    /// @throw std::bad_alloc
+    utils::BasicResult<StorageIndexDefinitionError, void> CreateColumnarProperty(LabelId label, PropertyId property);
+
+    /// Returns `IndexDefinitionError` if the columnar property doesn't exist.
+    utils::BasicResult<StorageIndexDefinitionError, void> DropColumnarProperty(LabelId label, PropertyId property);
+
+    /// Calls `func` with every vertex that has `label` in the `view` together
+    /// with its value of `property`. Values of vertices whose current version is
+    /// visible to every transaction are read from the columnar store, the rest
+    /// are read through their delta chain.
+    /// Returns `false` if `property` isn't a columnar property of `label`.
+    bool ScanColumnarProperty(LabelId label, PropertyId property, View view,
+                              const std::function<void(const VertexAccessor &, const PropertyValue &)> &func) override;
+
     /// Returns void if the existence constraint has been created.
     /// Returns `StorageExistenceConstraintDefinitionError` if an error occures. Error can be:
     /// * `ReplicationError`: there is at least one SYNC replica that has not confirmed receiving the transaction.
@@ -451,7 +563,32 @@ class InMemoryStorage final : public Storage {
     void FastDiscardOfDeltas(std::unique_lock<std::mutex> gc_guard);
     void GCRapidDeltaCleanup(std::list<Gid> &current_deleted_edges, std::list<Gid> &current_deleted_vertices,
                              IndexPerformanceTracker &impact_tracker);
+
+    /// Gids reserved for the objects the transaction creates. Blocks double
+    /// in size up to `kMaxGidBlockSize`, so an accessor which creates a
+    /// single object reserves a single gid.
+    struct GidBlock {
+      uint64_t next{0};
+      uint64_t end{0};
+      uint64_t size{0};
+    };
+    static constexpr uint64_t kMaxGidBlockSize = 1024;
+    static uint64_t NextGid(std::atomic<uint64_t> &counter, GidBlock &block);
+    /// Hands the unused gids of @p block back if no gids were reserved after
+    /// it, so that sequential transactions keep the gids dense.
+    static void ReleaseGids(std::atomic<uint64_t> &counter, GidBlock &block);
+
+    /// Skip list accessors reused by the inserts of the transaction, so bulk
+    /// inserts don't acquire and release one per object. Released when the
+    /// transaction is finalized.
+    utils::SkipList<Vertex>::Accessor &VerticesInsertAccessor();
+    utils::SkipList<Edge>::Accessor &EdgesInsertAccessor();
+
     SalientConfig::Items config_;
+    GidBlock vertex_gids_;
+    GidBlock edge_gids_;
+    std::optional<utils::SkipList<Vertex>::Accessor> vertices_insert_acc_;
+    std::optional<utils::SkipList<Edge>::Accessor> edges_insert_acc_;
   };
 
   class ReplicationAccessor final : public InMemoryAccessor {
@@ -487,6 +624,11 @@ class InMemoryStorage final : public Storage {
 
   void CreateSnapshotHandler(std::function<utils::BasicResult<InMemoryStorage::CreateSnapshotError>()> cb);
 
+  /// Returns false if the WAL files written since the latest snapshot are
+  /// smaller than `snapshot_min_wal_percent` of its size, recovery then
+  /// replays them on top of that snapshot instead of a new one.
+  bool PeriodicSnapshotNeeded();
+
   Transaction CreateTransaction(IsolationLevel isolation_level, StorageMode storage_mode) override;
 
   void SetStorageMode(StorageMode storage_mode);
@@ -510,12 +652,17 @@ class InMemoryStorage final : public Storage {
 
   bool InitializeWalFile(memgraph::replication::ReplicationEpoch &epoch);
   void FinalizeWalFile();
+  /// Blocks until the WAL is synced up to the given group commit ticket. The
+  /// first waiter becomes the leader and syncs everything written so far.
+  void WaitForWalGroupCommit(uint64_t ticket);
 
   StorageInfo GetBaseInfo() override;
   StorageInfo GetInfo() override;
+  GarbageInfo GetGarbageInfo() override;
 
   /// Return true in all cases except if any sync replicas have not sent confirmation.
-  [[nodiscard]] bool AppendToWal(const Transaction &transaction, uint64_t durability_commit_timestamp,
+  /// Also sets the `wal_bytes` of the transaction.
+  [[nodiscard]] bool AppendToWal(Transaction &transaction, uint64_t durability_commit_timestamp,
                                  DatabaseAccessProtector db_acc);
   void AppendToWalDataDefinition(durability::StorageMetadataOperation operation, LabelId label,
                                  uint64_t final_commit_timestamp, std::span<std::optional<ReplicaStream>> streams);
@@ -553,6 +700,8 @@ class InMemoryStorage final : public Storage {
   utils::SkipList<storage::Vertex> vertices_;
   utils::SkipList<storage::Edge> edges_;
   utils::SkipList<storage::EdgeMetadata> edges_metadata_;
+  // Lookup of the vertices by gid, only set if `Config::Indices::vertex_gid_table` is enabled.
+  std::unique_ptr<VertexGidTable> vertex_gid_table_;
 
   // Durability
   durability::Recovery recovery_;
@@ -568,6 +717,20 @@ class InMemoryStorage final : public Storage {
 
   std::optional<durability::WalFile> wal_file_;
   uint64_t wal_unsynced_transactions_{0};
+  // Held while `wal_file_` is replaced and while the group commit leader syncs
+  // it outside of the engine lock.
+  std::mutex wal_file_lock_;
+
+  // State of the WAL group commit. Every transaction written to the WAL gets a
+  // ticket (`written` is only increased under the engine lock) and is durable
+  // once `synced` reaches it.
+  struct WalGroupCommit {
+    std::mutex lock;
+    std::condition_variable cv;
+    uint64_t written{0};
+    uint64_t synced{0};
+    bool leader_active{false};
+  } wal_group_commit_;
 
   utils::FileRetainer file_retainer_;
 
@@ -581,11 +744,30 @@ class InMemoryStorage final : public Storage {
   std::optional<CommitLog> commit_log_;
 
   utils::Scheduler gc_runner_;
+  // The failed attempts to take it are tracked as the contention of `utils::LockSite::GC`.
   std::mutex gc_lock_;
 
+  /// Moves the properties of the vertices which weren't read since the
+  /// previous pass to the `PropertyStoreTier`, and the properties of the
+  /// evicted vertices which were read back to memory.
+  void TierProperties();
+
+  utils::Scheduler property_tier_runner_;
+
+  /// Compacts the adjacency lists of the vertices, see `CompactVertexEdges`.
+  /// Only runs while the storage is in the IN_MEMORY_ANALYTICAL mode, where
+  /// the graph is usually bulk loaded and then mostly read.
+  void CompactAdjacency();
+
+  utils::Scheduler analytical_compaction_runner_;
+
   struct GCDeltas {
-    GCDeltas(uint64_t mark_timestamp, delta_container deltas, std::unique_ptr<std::atomic<uint64_t>> commit_timestamp)
-        : mark_timestamp_{mark_timestamp}, deltas_{std::move(deltas)}, commit_timestamp_{std::move(commit_timestamp)} {}
+    GCDeltas(uint64_t mark_timestamp, delta_container deltas, std::unique_ptr<std::atomic<uint64_t>> commit_timestamp,
+             IndexCleanupCollector index_cleanup = {})
+        : mark_timestamp_{mark_timestamp},
+          deltas_{std::move(deltas)},
+          commit_timestamp_{std::move(commit_timestamp)},
+          index_cleanup_{std::move(index_cleanup)} {}
 
     GCDeltas(GCDeltas &&) = default;
     GCDeltas &operator=(GCDeltas &&) = default;
@@ -593,8 +775,12 @@ class InMemoryStorage final : public Storage {
     uint64_t mark_timestamp_{};                                  //!< a timestamp no active transaction currently has
     delta_container deltas_;                                     //!< the deltas that need cleaning
     std::unique_ptr<std::atomic<uint64_t>> commit_timestamp_{};  //!< the timestamp the deltas are pointing at
+    IndexCleanupCollector index_cleanup_;                        //!< the index entries the commit may leave obsolete
   };
 
+  /// Frees the unlinked deltas, on the release threads if there are any.
+  void ReleaseGarbage(std::list<GCDeltas> garbage);
+
   // Ownership of linked deltas is transferred to committed_transactions_ once transaction is commited
   utils::Synchronized<std::list<GCDeltas>, utils::SpinLock> committed_transactions_{};
 
@@ -616,6 +802,16 @@ class InMemoryStorage final : public Storage {
   std::atomic<bool> gc_full_scan_vertices_delete_ = false;
   std::atomic<bool> gc_full_scan_edges_delete_ = false;
 
+  // Set when a GC slice ran out of time before collecting everything it could
+  std::atomic<bool> gc_backlog_ = false;
+
+  // Threads which free the collected deltas (see Config::Gc::release_threads)
+  std::optional<utils::ThreadPool> gc_release_pool_;
+
+  // Versions of heavily modified vertices materialized for long-running
+  // readers, dropped by the GC once no active transaction can see them.
+  VertexVersionStore vertex_versions_;
+
   free_mem_fn free_memory_func_;
 
   // Moved the create snapshot to a user defined handler so we can remove the global replication state from the storage
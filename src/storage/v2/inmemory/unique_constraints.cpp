@@ -10,6 +10,7 @@
 // licenses/APL.txt.
 
 #include "storage/v2/inmemory/unique_constraints.hpp"
+#include <algorithm>
 #include <memory>
 #include "storage/v2/constraints/constraint_violation.hpp"
 #include "storage/v2/constraints/utils.hpp"
@@ -17,8 +18,10 @@
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/transaction.hpp"
 #include "utils/counter.hpp"
+#include "utils/fnv.hpp"
 #include "utils/logging.hpp"
 #include "utils/skip_list.hpp"
+#include "utils/thread_pool.hpp"
 namespace memgraph::storage {
 
 namespace {
@@ -242,8 +245,115 @@ bool AnyVersionHasLabelProperty(const Vertex &vertex, LabelId label, const std::
   return false;
 }
 
+/// Hash of a property value which agrees with `operator==`, so an integer and
+/// a double that compare equal hash equally. Values of the types which are
+/// rarely constrained are hashed by their type only.
+struct PropertyValueHash {
+  size_t operator()(const PropertyValue &value) const {
+    switch (value.type()) {
+      case PropertyValueType::Null:
+        return 0;
+      case PropertyValueType::Bool:
+        return std::hash<bool>{}(value.ValueBool());
+      case PropertyValueType::Int:
+        return std::hash<double>{}(static_cast<double>(value.ValueInt()));
+      case PropertyValueType::Double:
+        return std::hash<double>{}(value.ValueDouble());
+      case PropertyValueType::String:
+        return std::hash<std::string_view>{}(std::string_view{value.ValueString()});
+      case PropertyValueType::TemporalData: {
+        const auto &temporal = value.ValueTemporalData();
+        return utils::HashCombine<uint8_t, int64_t>{}(static_cast<uint8_t>(temporal.type), temporal.microseconds);
+      }
+      default:
+        return std::hash<uint8_t>{}(static_cast<uint8_t>(value.type()));
+    }
+  }
+};
+
 }  // namespace
 
+size_t InMemoryUniqueConstraints::HashTable::ValuesHash::operator()(const std::vector<PropertyValue> &values) const {
+  return utils::FnvCollection<std::vector<PropertyValue>, PropertyValue, PropertyValueHash>{}(values);
+}
+
+void InMemoryUniqueConstraints::HashTable::Insert(const std::vector<PropertyValue> &values, const Vertex *vertex,
+                                                  uint64_t timestamp) {
+  Shard(values).WithLock([&](auto &map) {
+    auto &entries = map[values];
+    if (std::ranges::any_of(entries, [&](const auto &e) { return e.vertex == vertex && e.timestamp == timestamp; })) {
+      return;
+    }
+    entries.push_back(VertexEntry{vertex, timestamp});
+  });
+}
+
+void InMemoryUniqueConstraints::HashTable::Remove(const std::vector<PropertyValue> &values, const Vertex *vertex,
+                                                  uint64_t timestamp) {
+  Shard(values).WithLock([&](auto &map) {
+    auto it = map.find(values);
+    if (it == map.end()) return;
+    std::erase_if(it->second, [&](const auto &e) { return e.vertex == vertex && e.timestamp == timestamp; });
+    if (it->second.empty()) map.erase(it);
+  });
+}
+
+std::vector<const Vertex *> InMemoryUniqueConstraints::HashTable::Vertices(
+    const std::vector<PropertyValue> &values) const {
+  return Shard(values).WithReadLock([&](const auto &map) {
+    std::vector<const Vertex *> vertices;
+    auto it = map.find(values);
+    if (it == map.end()) return vertices;
+    vertices.reserve(it->second.size());
+    for (const auto &entry : it->second) vertices.push_back(entry.vertex);
+    return vertices;
+  });
+}
+
+template <typename TIsObsolete>
+void InMemoryUniqueConstraints::HashTable::RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp,
+                                                                 std::stop_token token, TIsObsolete &&is_obsolete) {
+  struct Candidate {
+    std::vector<PropertyValue> values;
+    VertexEntry entry;
+    bool superseded;
+  };
+
+  for (auto &shard : shards_) {
+    if (token.stop_requested()) return;
+
+    // The vertices are checked without holding the shard lock, commits lock
+    // the vertex first and the shard afterwards.
+    std::vector<Candidate> candidates;
+    shard.WithReadLock([&](const auto &map) {
+      for (const auto &[values, entries] : map) {
+        for (const auto &entry : entries) {
+          if (entry.timestamp >= oldest_active_start_timestamp) continue;
+          bool const superseded = std::ranges::any_of(
+              entries, [&](const auto &e) { return e.vertex == entry.vertex && e.timestamp > entry.timestamp; });
+          candidates.push_back(Candidate{values, entry, superseded});
+        }
+      }
+    });
+
+    std::erase_if(candidates, [&](const auto &candidate) {
+      return !candidate.superseded && !is_obsolete(candidate.values, *candidate.entry.vertex);
+    });
+    if (candidates.empty()) continue;
+
+    shard.WithLock([&](auto &map) {
+      for (const auto &candidate : candidates) {
+        auto it = map.find(candidate.values);
+        if (it == map.end()) continue;
+        std::erase_if(it->second, [&](const auto &e) {
+          return e.vertex == candidate.entry.vertex && e.timestamp == candidate.entry.timestamp;
+        });
+        if (it->second.empty()) map.erase(it);
+      }
+    });
+  }
+}
+
 bool InMemoryUniqueConstraints::Entry::operator<(const Entry &rhs) const {
   if (values < rhs.values) {
     return true;
@@ -276,7 +386,11 @@ void InMemoryUniqueConstraints::UpdateBeforeCommit(const Vertex *vertex, const T
         continue;
       }
 
-      auto acc = storage->access();
+      if (storage->hash_table) {
+        storage->hash_table->Insert(*values, vertex, tx.start_timestamp);
+        continue;
+      }
+      auto acc = storage->skip_list.access();
       acc.insert(Entry{std::move(*values), vertex, tx.start_timestamp});
     }
   }
@@ -304,17 +418,10 @@ bool InMemoryUniqueConstraints::MultipleThreadsConstraintValidation::operator()(
 
   std::atomic<uint64_t> batch_counter = 0;
   memgraph::utils::Synchronized<std::optional<ConstraintViolation>, utils::RWSpinLock> has_error;
-  {
-    std::vector<std::jthread> threads;
-    threads.reserve(thread_count);
-    for (auto i{0U}; i < thread_count; ++i) {
-      threads.emplace_back(
-          [&has_error, &vertex_batches, &batch_counter, &vertex_accessor, &constraint_accessor, &label, &properties]() {
-            do_per_thread_validation(has_error, DoValidate, vertex_batches, batch_counter, vertex_accessor,
-                                     constraint_accessor, label, properties);
-          });
-    }
-  }
+  utils::CpuThreadPool().RunParallel(thread_count, [&](size_t /*worker*/) {
+    do_per_thread_validation(has_error, DoValidate, vertex_batches, batch_counter, vertex_accessor, constraint_accessor,
+                             label, properties);
+  });
   return has_error.Lock()->has_value();
 }
 
@@ -366,7 +473,11 @@ void InMemoryUniqueConstraints::AbortEntries(std::span<Vertex const *const> vert
           continue;
         }
 
-        auto acc = storage->access();
+        if (storage->hash_table) {
+          storage->hash_table->Remove(*values, vertex, exact_start_timestamp);
+          continue;
+        }
+        auto acc = storage->skip_list.access();
         acc.remove(Entry{std::move(*values), vertex, exact_start_timestamp});
       }
     }
@@ -402,7 +513,16 @@ InMemoryUniqueConstraints::CreateConstraint(
     return ConstraintViolation{ConstraintViolation::Type::UNIQUE, label, properties};
   }
 
-  auto [it, _] = constraints_.emplace(std::make_pair(label, properties), std::move(constraints_skip_list));
+  ConstraintStorage storage;
+  if (use_hash_table_) {
+    storage.hash_table = std::make_unique<HashTable>();
+    for (const auto &entry : constraint_accessor) {
+      storage.hash_table->Insert(entry.values, entry.vertex, entry.timestamp);
+    }
+  } else {
+    storage.skip_list = std::move(constraints_skip_list);
+  }
+  auto [it, _] = constraints_.emplace(std::make_pair(label, properties), std::move(storage));
 
   // Add the new constraint to the optimized structure only if there are no violations.
   constraints_by_label_[label].insert({properties, &it->second});
@@ -458,7 +578,17 @@ std::optional<ConstraintViolation> InMemoryUniqueConstraints::Validate(const Ver
         continue;
       }
 
-      auto acc = storage->access();
+      if (storage->hash_table) {
+        for (const auto *other : storage->hash_table->Vertices(*value_array)) {
+          if (&vertex != other &&
+              LastCommittedVersionHasLabelProperty(*other, label, properties, *value_array, tx, commit_timestamp)) {
+            return ConstraintViolation{ConstraintViolation::Type::UNIQUE, label, properties};
+          }
+        }
+        continue;
+      }
+
+      auto acc = storage->skip_list.access();
       auto it = acc.find_equal_or_greater(*value_array);
       for (; it != acc.end(); ++it) {
         if (*value_array < it->values) {
@@ -496,7 +626,16 @@ void InMemoryUniqueConstraints::RemoveObsoleteEntries(uint64_t oldest_active_sta
     // before starting constraint, check if stop_requested
     if (token.stop_requested()) return;
 
-    auto acc = storage.access();
+    if (storage.hash_table) {
+      storage.hash_table->RemoveObsoleteEntries(
+          oldest_active_start_timestamp, token, [&](const std::vector<PropertyValue> &values, const Vertex &vertex) {
+            return !AnyVersionHasLabelProperty(vertex, label_props.first, label_props.second, values,
+                                               oldest_active_start_timestamp);
+          });
+      continue;
+    }
+
+    auto acc = storage.skip_list.access();
     for (auto it = acc.begin(); it != acc.end();) {
       // Hot loop, don't check stop_requested every time
       if (maybe_stop() && token.stop_requested()) return;
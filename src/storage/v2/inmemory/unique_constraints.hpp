@@ -11,9 +11,12 @@
 
 #pragma once
 
+#include <array>
+#include <memory>
 #include <optional>
 #include <span>
 #include <thread>
+#include <unordered_map>
 #include <variant>
 #include "storage/v2/constraints/constraint_violation.hpp"
 #include "storage/v2/constraints/unique_constraints.hpp"
@@ -45,6 +48,11 @@ using PropertyIdArray = FixedCapacityArray<PropertyId>;
 
 class InMemoryUniqueConstraints : public UniqueConstraints {
  public:
+  /// Constraints created with `use_hash_table` keep their entries in a hash
+  /// table keyed by the property values instead of a skip list, so validating
+  /// a vertex on commit is a single bucket lookup.
+  explicit InMemoryUniqueConstraints(bool use_hash_table = false) : use_hash_table_(use_hash_table) {}
+
   bool empty() const override;
 
  private:
@@ -60,6 +68,53 @@ class InMemoryUniqueConstraints : public UniqueConstraints {
     bool operator==(const std::vector<PropertyValue> &rhs) const;
   };
 
+  /// Entries of a constraint grouped by their values. The table is split into
+  /// shards with a lock each, the locks are never held while a vertex is
+  /// locked.
+  class HashTable {
+   public:
+    struct VertexEntry {
+      const Vertex *vertex;
+      uint64_t timestamp;
+    };
+
+    /// @throw std::bad_alloc
+    void Insert(const std::vector<PropertyValue> &values, const Vertex *vertex, uint64_t timestamp);
+
+    void Remove(const std::vector<PropertyValue> &values, const Vertex *vertex, uint64_t timestamp);
+
+    /// Returns the vertices of all the entries with the given values.
+    std::vector<const Vertex *> Vertices(const std::vector<PropertyValue> &values) const;
+
+    /// Removes the entries older than `oldest_active_start_timestamp` which
+    /// are superseded by a newer entry of the same vertex, or for which
+    /// `is_obsolete` returns true.
+    template <typename TIsObsolete>
+    void RemoveObsoleteEntries(uint64_t oldest_active_start_timestamp, std::stop_token token,
+                               TIsObsolete &&is_obsolete);
+
+   private:
+    struct ValuesHash {
+      size_t operator()(const std::vector<PropertyValue> &values) const;
+    };
+    using Map = std::unordered_map<std::vector<PropertyValue>, std::vector<VertexEntry>, ValuesHash>;
+    static constexpr size_t kShards = 64;
+
+    auto &Shard(const std::vector<PropertyValue> &values) { return shards_[ValuesHash{}(values) % kShards]; }
+    const auto &Shard(const std::vector<PropertyValue> &values) const {
+      return shards_[ValuesHash{}(values) % kShards];
+    }
+
+    std::array<utils::Synchronized<Map, utils::RWSpinLock>, kShards> shards_;
+  };
+
+  /// Entries of a single constraint, in the hash table if one is created and
+  /// in the skip list otherwise.
+  struct ConstraintStorage {
+    utils::SkipList<Entry> skip_list;
+    std::unique_ptr<HashTable> hash_table;
+  };
+
   static std::optional<ConstraintViolation> DoValidate(const Vertex &vertex,
                                                        utils::SkipList<Entry>::Accessor &constraint_accessor,
                                                        const LabelId &label, const std::set<PropertyId> &properties);
@@ -138,8 +193,9 @@ class InMemoryUniqueConstraints : public UniqueConstraints {
       const std::optional<durability::ParallelizedSchemaCreationInfo> &);
 
  private:
-  std::map<std::pair<LabelId, std::set<PropertyId>>, utils::SkipList<Entry>> constraints_;
-  std::map<LabelId, std::map<std::set<PropertyId>, utils::SkipList<Entry> *>> constraints_by_label_;
+  bool use_hash_table_;
+  std::map<std::pair<LabelId, std::set<PropertyId>>, ConstraintStorage> constraints_;
+  std::map<LabelId, std::map<std::set<PropertyId>, ConstraintStorage *>> constraints_by_label_;
 };
 
 }  // namespace memgraph::storage
@@ -0,0 +1,57 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#include "storage/v2/inmemory/vertex_gid_table.hpp"
+
+namespace memgraph::storage {
+
+VertexGidTable::VertexGidTable() : segments_{std::make_unique<std::atomic<Segment *>[]>(kMaxSegments)} {}
+
+VertexGidTable::~VertexGidTable() { Clear(); }
+
+Vertex *VertexGidTable::Find(Gid gid) const {
+  auto const id = gid.AsUint();
+  if (id >= kSegmentSize * kMaxSegments) return nullptr;
+  auto const *segment = segments_[id >> kSegmentBits].load(std::memory_order_acquire);
+  if (segment == nullptr) return nullptr;
+  return (*segment)[id & (kSegmentSize - 1)].load(std::memory_order_acquire);
+}
+
+void VertexGidTable::Insert(Vertex *vertex) {
+  auto const id = vertex->gid.AsUint();
+  if (id >= kSegmentSize * kMaxSegments) return;
+  auto &slot = segments_[id >> kSegmentBits];
+  auto *segment = slot.load(std::memory_order_acquire);
+  if (segment == nullptr) {
+    auto new_segment = std::make_unique<Segment>();
+    if (slot.compare_exchange_strong(segment, new_segment.get(), std::memory_order_acq_rel)) {
+      segment = new_segment.release();
+    }
+  }
+  (*segment)[id & (kSegmentSize - 1)].store(vertex, std::memory_order_release);
+}
+
+void VertexGidTable::Erase(Gid gid) {
+  auto const id = gid.AsUint();
+  if (id >= kSegmentSize * kMaxSegments) return;
+  auto *segment = segments_[id >> kSegmentBits].load(std::memory_order_acquire);
+  if (segment == nullptr) return;
+  (*segment)[id & (kSegmentSize - 1)].store(nullptr, std::memory_order_release);
+}
+
+void VertexGidTable::Clear() {
+  for (uint64_t i = 0; i < kMaxSegments; ++i) {
+    delete segments_[i].exchange(nullptr, std::memory_order_acq_rel);
+  }
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,70 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/vertex.hpp"
+
+namespace memgraph::storage {
+
+/// Array of the vertices indexed by their gid, kept besides the skip list of
+/// the vertices so a vertex is found by its gid without searching the skip
+/// list. Gids are allocated sequentially, so the array is split into segments
+/// which are only allocated once a gid in them is used; gids past the last
+/// segment are only kept in the skip list.
+///
+/// The table is a cache of the skip list: vertices are put into it when they
+/// are created or found in the skip list (recovered and replicated vertices go
+/// straight into the skip list) and must be erased before they are removed from
+/// the skip list.
+class VertexGidTable {
+ public:
+  static constexpr uint64_t kSegmentBits = 16;
+  static constexpr uint64_t kSegmentSize = 1UL << kSegmentBits;
+  static constexpr uint64_t kMaxSegments = 1UL << 12;
+
+  VertexGidTable();
+  ~VertexGidTable();
+
+  VertexGidTable(const VertexGidTable &) = delete;
+  VertexGidTable(VertexGidTable &&) = delete;
+  VertexGidTable &operator=(const VertexGidTable &) = delete;
+  VertexGidTable &operator=(VertexGidTable &&) = delete;
+
+  /// Returns the vertex with `gid` or `nullptr` if it isn't in the table. The
+  /// vertex stays valid while an accessor of the skip list of the vertices
+  /// taken before the call is held.
+  Vertex *Find(Gid gid) const;
+
+  /// The vertex mustn't be removed from the skip list before it's put into
+  /// the table, so it must be locked and not deleted, or just created.
+  void Insert(Vertex *vertex);
+
+  void Erase(Gid gid);
+
+  /// Must be called while nobody else uses the table, e.g. when the skip list
+  /// of the vertices is cleared.
+  void Clear();
+
+ private:
+  using Segment = std::array<std::atomic<Vertex *>, kSegmentSize>;
+
+  std::unique_ptr<std::atomic<Segment *>[]> segments_;
+};
+
+}  // namespace memgraph::storage
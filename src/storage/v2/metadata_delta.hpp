@@ -12,11 +12,13 @@
 #pragma once
 
 #include <set>
+#include <vector>
 
 #include "storage/v2/constraints/type_constraints.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/indices/label_index_stats.hpp"
 #include "storage/v2/indices/label_property_index_stats.hpp"
+#include "storage/v2/indices/vector_index_spec.hpp"
 
 namespace memgraph::storage {
 
@@ -48,6 +50,10 @@ struct MetadataDelta {
     ENUM_ALTER_UPDATE,
     POINT_INDEX_CREATE,
     POINT_INDEX_DROP,
+    VECTOR_INDEX_CREATE,
+    VECTOR_INDEX_DROP,
+    LABEL_PROPERTY_COMPOSITE_INDEX_CREATE,
+    LABEL_PROPERTY_COMPOSITE_INDEX_DROP,
   };
 
   static constexpr struct LabelIndexCreate {
@@ -64,8 +70,16 @@ struct MetadataDelta {
   } point_index_create;
   static constexpr struct PointIndexDrop {
   } point_index_drop;
+  static constexpr struct VectorIndexCreate {
+  } vector_index_create;
+  static constexpr struct VectorIndexDrop {
+  } vector_index_drop;
   static constexpr struct LabelPropertyIndexDrop {
   } label_property_index_drop;
+  static constexpr struct LabelPropertyCompositeIndexCreate {
+  } label_property_composite_index_create;
+  static constexpr struct LabelPropertyCompositeIndexDrop {
+  } label_property_composite_index_drop;
   static constexpr struct LabelPropertyIndexStatsSet {
   } label_property_index_stats_set;
   static constexpr struct LabelPropertyIndexStatsClear {
@@ -116,6 +130,12 @@ struct MetadataDelta {
   MetadataDelta(LabelPropertyIndexDrop /*tag*/, LabelId label, PropertyId property)
       : action(Action::LABEL_PROPERTY_INDEX_DROP), label_property{label, property} {}
 
+  MetadataDelta(LabelPropertyCompositeIndexCreate /*tag*/, LabelId label, std::vector<PropertyId> properties)
+      : action(Action::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE), label_property_list{label, std::move(properties)} {}
+
+  MetadataDelta(LabelPropertyCompositeIndexDrop /*tag*/, LabelId label, std::vector<PropertyId> properties)
+      : action(Action::LABEL_PROPERTY_COMPOSITE_INDEX_DROP), label_property_list{label, std::move(properties)} {}
+
   MetadataDelta(LabelPropertyIndexStatsSet /*tag*/, LabelId label, PropertyId property,
                 LabelPropertyIndexStats const &stats)
       : action(Action::LABEL_PROPERTY_INDEX_STATS_SET), label_property_stats{label, property, stats} {}
@@ -146,6 +166,12 @@ struct MetadataDelta {
   MetadataDelta(PointIndexDrop /*tag*/, LabelId label, PropertyId property)
       : action(Action::POINT_INDEX_DROP), label_property{label, property} {}
 
+  MetadataDelta(VectorIndexCreate /*tag*/, VectorIndexSpec spec)
+      : action(Action::VECTOR_INDEX_CREATE), vector_index{spec} {}
+
+  MetadataDelta(VectorIndexDrop /*tag*/, LabelId label, PropertyId property)
+      : action(Action::VECTOR_INDEX_DROP), label_property{label, property} {}
+
   MetadataDelta(ExistenceConstraintCreate /*tag*/, LabelId label, PropertyId property)
       : action(Action::EXISTENCE_CONSTRAINT_CREATE), label_property{label, property} {}
 
@@ -186,7 +212,6 @@ struct MetadataDelta {
       case LABEL_INDEX_STATS_CLEAR:
       case LABEL_PROPERTY_INDEX_CREATE:
       case LABEL_PROPERTY_INDEX_DROP:
-      case LABEL_PROPERTY_INDEX_STATS_SET:
       case LABEL_PROPERTY_INDEX_STATS_CLEAR:
       case Action::EDGE_INDEX_CREATE:
       case Action::EDGE_INDEX_DROP:
@@ -201,17 +226,28 @@ struct MetadataDelta {
       case ENUM_ALTER_UPDATE:
       case POINT_INDEX_CREATE:
       case POINT_INDEX_DROP:
+      case VECTOR_INDEX_CREATE:
+      case VECTOR_INDEX_DROP:
         break;
       case UNIQUE_CONSTRAINT_CREATE:
       case UNIQUE_CONSTRAINT_DROP: {
         std::destroy_at(&label_properties);
         break;
       }
+      case LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+      case LABEL_PROPERTY_COMPOSITE_INDEX_DROP: {
+        std::destroy_at(&label_property_list);
+        break;
+      }
       case TEXT_INDEX_CREATE:
       case TEXT_INDEX_DROP: {
         std::destroy_at(&text_index);
         break;
       }
+      case LABEL_PROPERTY_INDEX_STATS_SET: {
+        std::destroy_at(&label_property_stats);
+        break;
+      }
     }
   }
 
@@ -232,6 +268,11 @@ struct MetadataDelta {
       std::set<PropertyId> properties;
     } label_properties;
 
+    struct {
+      LabelId label;
+      std::vector<PropertyId> properties;
+    } label_property_list;
+
     struct {
       LabelId label;
       LabelIndexStats stats;
@@ -254,6 +295,8 @@ struct MetadataDelta {
       PropertyId property;
     } edge_type_property;
 
+    VectorIndexSpec vector_index;
+
     struct {
       std::string index_name;
       LabelId label;
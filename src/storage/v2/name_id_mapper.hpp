@@ -11,9 +11,12 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <bit>
 #include <string>
 #include <string_view>
+#include <utility>
 
 #include "utils/logging.hpp"
 #include "utils/skip_list.hpp"
@@ -44,6 +47,66 @@ class NameIdMapper {
     bool operator==(uint64_t other) const { return id == other; }
   };
 
+  /// Names of the `id_to_name_` mapping indexed by their id. The ids are dense
+  /// and never removed, so the names are kept in segments of doubling size
+  /// which are never moved or freed while the mapper exists. Lookups are
+  /// two atomic loads instead of a skip list search.
+  class IdToNameArray {
+   public:
+    IdToNameArray() = default;
+    IdToNameArray(const IdToNameArray &) = delete;
+    IdToNameArray &operator=(const IdToNameArray &) = delete;
+    IdToNameArray(IdToNameArray &&) = delete;
+    IdToNameArray &operator=(IdToNameArray &&) = delete;
+
+    ~IdToNameArray() {
+      for (auto &segment : segments_) delete[] segment.load(std::memory_order_acquire);
+    }
+
+    /// Returns nullptr if the name of @p id wasn't set yet.
+    const std::string *Get(uint64_t id) const {
+      const auto [segment, offset] = Locate(id);
+      if (segment >= kSegments) return nullptr;
+      const auto *names = segments_[segment].load(std::memory_order_acquire);
+      if (names == nullptr) return nullptr;
+      return names[offset].load(std::memory_order_acquire);
+    }
+
+    /// @p name has to outlive the array.
+    /// @throw std::bad_alloc if unable to allocate a new segment
+    void Set(uint64_t id, const std::string *name) {
+      const auto [segment, offset] = Locate(id);
+      if (segment >= kSegments) return;  // Left to the skip list
+      auto *names = segments_[segment].load(std::memory_order_acquire);
+      if (names == nullptr) {
+        auto *new_names = new std::atomic<const std::string *>[SegmentSize(segment)] {};
+        if (segments_[segment].compare_exchange_strong(names, new_names, std::memory_order_acq_rel)) {
+          names = new_names;
+        } else {
+          // Another thread allocated the segment first
+          delete[] new_names;
+        }
+      }
+      names[offset].store(name, std::memory_order_release);
+    }
+
+   private:
+    static constexpr uint64_t kFirstSegmentBits = 6;
+    static constexpr uint64_t kSegments = 32 - kFirstSegmentBits;
+
+    static constexpr uint64_t SegmentSize(uint64_t segment) { return uint64_t{1} << (segment + kFirstSegmentBits); }
+
+    /// Segment `i` holds the ids [2^(i + 6) - 64, 2^(i + 7) - 64).
+    static std::pair<uint64_t, uint64_t> Locate(uint64_t id) {
+      if (id >= (uint64_t{1} << 32U) - SegmentSize(0)) return {kSegments, 0};
+      const auto index = id + SegmentSize(0);
+      const auto segment = static_cast<uint64_t>(std::bit_width(index)) - 1 - kFirstSegmentBits;
+      return {segment, index - SegmentSize(segment)};
+    }
+
+    std::array<std::atomic<std::atomic<const std::string *> *>, kSegments> segments_{};
+  };
+
  public:
   explicit NameIdMapper() = default;
 
@@ -112,16 +175,21 @@ class NameIdMapper {
 
  protected:
   std::optional<std::reference_wrapper<const std::string>> MaybeIdToName(uint64_t id) const {
+    if (const auto *name = id_to_name_array_.Get(id)) return *name;
     auto id_to_name_acc = id_to_name_.access();
     auto result = id_to_name_acc.find(id);
     if (result == id_to_name_acc.end()) {
       return std::nullopt;
     }
+    // The names in the skip list are never removed, so the array can point to them
+    id_to_name_array_.Set(id, &result->name);
     return result->name;
   }
 
   std::atomic<uint64_t> counter_{0};
   utils::SkipList<MapNameToId> name_to_id_;
   utils::SkipList<MapIdToName> id_to_name_;
+  // Filled on the first lookup of each id, the skip list stays the owner of the names
+  mutable IdToNameArray id_to_name_array_;
 };
 }  // namespace memgraph::storage
@@ -11,6 +11,8 @@
 
 #include "storage/v2/property_store.hpp"
 
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <concepts>
 #include <cstdint>
@@ -18,6 +20,7 @@
 #include <iterator>
 #include <limits>
 #include <map>
+#include <numeric>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -26,11 +29,15 @@
 #include <utility>
 
 #include "storage/v2/id_types.hpp"
+#include "storage/v2/property_store_tier.hpp"
 #include "storage/v2/property_value.hpp"
+#include "storage/v2/string_interner.hpp"
 #include "storage/v2/temporal.hpp"
+#include "utils/allocator/small_block_pool.hpp"
 #include "utils/cast.hpp"
 #include "utils/compressor.hpp"
 #include "utils/logging.hpp"
+#include "utils/on_scope_exit.hpp"
 #include "utils/temporal.hpp"
 
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
@@ -78,6 +85,11 @@ namespace {
 // buffer, the current buffer is used. All mappings are encoded independently of
 // each other.
 //
+// Stores with many properties additionally keep a small directory of the
+// property IDs and their offsets in front of the encoded mappings. That makes
+// the lookup of a single property O(log(n)) while small stores keep using the
+// compact format (see `kPropertyDirectoryThreshold`).
+//
 // Each mapping starts with an encoded metadata field that is used for several
 // purposes:
 //   * to determine the encoded type
@@ -201,6 +213,13 @@ const uint8_t kShiftIdSize = 2;
 //     - type; payload size is used to encode the crs type (this only works becuase there are 4 sizes + 4 crs types)
 //     - encoded property ID
 //     - encoded value as 2 (for 2D) or 3 (for 3D) doubles forced to be encoded as int64
+//   * INTERNED_STRING
+//     - type; payload size is used to indicate whether the id is encoded as
+//       `uint8_t`, `uint16_t`, `uint32_t` or `uint32_t`
+//     - encoded property ID
+//     - encoded id of the string in the `StringInterner`
+//     - only used for the values of the properties, the strings inside lists
+//       and maps are always stored inline
 
 const auto TZ_NAME_LENGTH_SIZE = Size::INT8;
 // As the underlying type for zoned temporal data is std::chrono::zoned_time, valid timezone names are limited
@@ -346,6 +365,21 @@ class Writer {
   uint32_t pos_{0};
 };
 
+// Function used to resolve the name of a timezone in the tz database. The
+// values of a graph usually use a few timezones, so the ones a thread resolved
+// last are looked up before the whole database is searched.
+utils::Timezone LocateTimezone(std::string_view name) {
+  thread_local std::array<const std::chrono::time_zone *, 4> recent_zones{};
+  thread_local size_t next_zone = 0;
+  for (const auto *zone : recent_zones) {
+    if (zone && zone->name() == name) return utils::Timezone(zone);
+  }
+  const auto *zone = std::chrono::locate_zone(name);
+  recent_zones[next_zone] = zone;
+  next_zone = (next_zone + 1) % recent_zones.size();
+  return utils::Timezone(zone);
+}
+
 // Helper class used to read data from the binary stream.
 class Reader {
  public:
@@ -442,13 +476,14 @@ class Reader {
     if (type == Type::ZONED_TEMPORAL_DATA) {
       auto tz_str_length = ReadUint(TZ_NAME_LENGTH_SIZE);
       if (!tz_str_length) return std::nullopt;
-      std::string tz_str_v(*tz_str_length, '\0');
-      if (!ReadBytes(tz_str_v.data(), *tz_str_length)) return std::nullopt;
-      return utils::Timezone(tz_str_v);
+      if (pos_ + *tz_str_length > size_) return std::nullopt;
+      const std::string_view tz_name{reinterpret_cast<const char *>(data_ + pos_), *tz_str_length};
+      pos_ += *tz_str_length;
+      return LocateTimezone(tz_name);
     }
 
     if (type == Type::OFFSET_ZONED_TEMPORAL_DATA) {
-      auto offset_value = InternalReadInt<tz_offset_int>();
+      auto offset_value = ReadTimezoneOffset();
       if (!offset_value) return std::nullopt;
       return utils::Timezone(std::chrono::minutes{static_cast<int64_t>(*offset_value)});
     }
@@ -456,6 +491,8 @@ class Reader {
     return std::nullopt;
   }
 
+  std::optional<tz_offset_int> ReadTimezoneOffset() { return InternalReadInt<tz_offset_int>(); }
+
   bool ReadBytes(uint8_t *data, uint32_t size) {
     if (pos_ + size > size_) return false;
     memcpy(data, data_ + pos_, size);
@@ -731,6 +768,35 @@ std::optional<ZonedTemporalData> DecodeZonedTemporalData(Reader &reader) {
                            *timezone};
 }
 
+// Function used to compare a zoned temporal value to the one stored in the byte
+// stream. The stored timezone is compared by its name or offset, so it doesn't
+// have to be resolved.
+bool CompareZonedTemporalData(Reader &reader, const ZonedTemporalData &value) {
+  auto metadata = reader.ReadMetadata();
+  if (!metadata ||
+      (metadata->type != Type::ZONED_TEMPORAL_DATA && metadata->type != Type::OFFSET_ZONED_TEMPORAL_DATA)) {
+    return false;
+  }
+
+  auto type_value = reader.ReadUint(metadata->id_size);
+  if (!type_value || static_cast<ZonedTemporalType>(*type_value) != value.type) return false;
+
+  auto microseconds_value = reader.ReadInt(metadata->payload_size);
+  if (!microseconds_value || *microseconds_value != value.IntMicroseconds()) return false;
+
+  if (metadata->type == Type::ZONED_TEMPORAL_DATA) {
+    if (!value.timezone.InTzDatabase()) return false;
+    const auto tz_name = value.timezone.TimezoneName();
+    auto tz_str_length = reader.ReadUint(TZ_NAME_LENGTH_SIZE);
+    if (!tz_str_length || *tz_str_length != tz_name.size()) return false;
+    return reader.VerifyBytes(tz_name.data(), *tz_str_length);
+  }
+
+  if (value.timezone.InTzDatabase()) return false;
+  auto offset_value = reader.ReadTimezoneOffset();
+  return offset_value && *offset_value == value.timezone.DefiningOffset();
+}
+
 std::optional<uint64_t> DecodeZonedTemporalDataSize(Reader &reader) {
   uint64_t zoned_temporal_data_size = 0;
 
@@ -807,6 +873,12 @@ std::optional<uint64_t> DecodeZonedTemporalDataSize(Reader &reader) {
       value = PropertyValue(std::move(str_v));
       return true;
     }
+    case Type::INTERNED_STRING: {
+      auto id = reader->ReadUint(payload_size);
+      if (!id) return false;
+      value = PropertyValue(std::string{StringInterner::GetInstance().Get(*id)});
+      return true;
+    }
     case Type::LIST: {
       auto size = reader->ReadUint(payload_size);
       if (!size) return false;
@@ -906,6 +978,12 @@ std::optional<uint64_t> DecodeZonedTemporalDataSize(Reader &reader) {
 
       return true;
     }
+    case Type::INTERNED_STRING: {
+      const auto size = SizeToByteSize(payload_size);
+      if (!reader->SkipBytes(size)) return false;
+      property_size += size;
+      return true;
+    }
     case Type::LIST: {
       auto size = reader->ReadUint(payload_size);
       if (!size) return false;
@@ -1008,6 +1086,9 @@ std::optional<uint64_t> DecodeZonedTemporalDataSize(Reader &reader) {
       if (!reader->SkipBytes(*size)) return false;
       return true;
     }
+    case Type::INTERNED_STRING: {
+      return reader->ReadUint(payload_size).has_value();
+    }
     case Type::LIST: {
       auto const size = reader->ReadUint(payload_size);
       if (!size) return false;
@@ -1109,6 +1190,12 @@ std::optional<uint64_t> DecodeZonedTemporalDataSize(Reader &reader) {
       if (*size != str.size()) return false;
       return reader->VerifyBytes(str.data(), *size);
     }
+    case Type::INTERNED_STRING: {
+      if (!value.IsString()) return false;
+      auto id = reader->ReadUint(payload_size);
+      if (!id) return false;
+      return StringInterner::GetInstance().Get(*id) == value.ValueString();
+    }
     case Type::LIST: {
       if (!value.IsList()) return false;
       const auto &list = value.ValueList();
@@ -1152,13 +1239,7 @@ std::optional<uint64_t> DecodeZonedTemporalDataSize(Reader &reader) {
     case Type::ZONED_TEMPORAL_DATA:
     case Type::OFFSET_ZONED_TEMPORAL_DATA: {
       if (!value.IsZonedTemporalData()) return false;
-
-      const auto maybe_zoned_temporal_data = DecodeZonedTemporalData(*reader);
-      if (!maybe_zoned_temporal_data) {
-        return false;
-      }
-
-      return *maybe_zoned_temporal_data == value.ValueZonedTemporalData();
+      return CompareZonedTemporalData(*reader, value.ValueZonedTemporalData());
     }
     case Type::ENUM: {
       if (!value.IsEnum()) return false;
@@ -1187,6 +1268,24 @@ std::optional<uint64_t> DecodeZonedTemporalDataSize(Reader &reader) {
   }
 }
 
+// Function used to get the type of the value encoded as @p type, as seen by
+// the users of the store.
+constexpr Type ValueType(Type type) { return type == Type::INTERNED_STRING ? Type::STRING : type; }
+
+// Set while the buffers which leave the process are encoded, the ids of the
+// `StringInterner` aren't valid in another one.
+thread_local bool encode_strings_inline = false;
+
+// Function used to get the id in the `StringInterner` of a property value
+// which should be encoded as INTERNED_STRING, nullopt if it's encoded inline.
+std::optional<uint32_t> InternedStringId(const PropertyValue &value) {
+  if (!value.IsString() || encode_strings_inline) return std::nullopt;
+  const auto &str = value.ValueString();
+  // Strings shorter than 2 bytes take as much space inline.
+  if (str.size() < 2 || str.size() > FLAGS_storage_property_store_intern_max_length) return std::nullopt;
+  return StringInterner::GetInstance().Intern(str);
+}
+
 // Function used to encode a property (PropertyId, PropertyValue) into a byte
 // stream.
 bool EncodeProperty(Writer *writer, PropertyId property, const PropertyValue &value) {
@@ -1196,7 +1295,14 @@ bool EncodeProperty(Writer *writer, PropertyId property, const PropertyValue &va
   auto id_size = writer->WriteUint(property.AsUint());
   if (!id_size) return false;
 
-  auto type_property_size = EncodePropertyValue(writer, value);
+  std::optional<std::pair<Type, Size>> type_property_size;
+  if (auto interned_id = InternedStringId(value)) {
+    auto size = writer->WriteUint(*interned_id);
+    if (!size) return false;
+    type_property_size = {Type::INTERNED_STRING, *size};
+  } else {
+    type_property_size = EncodePropertyValue(writer, value);
+  }
   if (!type_property_size) return false;
 
   metadata->Set({type_property_size->first, *id_size, type_property_size->second});
@@ -1292,6 +1398,7 @@ enum class ExpectedPropertyStatus {
       type = ExtendedPropertyType{PropertyValue::Type::Double};
       break;
     case STRING:
+    case INTERNED_STRING:
       type = ExtendedPropertyType{PropertyValue::Type::String};
       break;
     case LIST:
@@ -1325,17 +1432,11 @@ enum class ExpectedPropertyStatus {
         return ExpectedPropertyStatus::EQUAL;
       }
     } break;
-    case POINT: {
-      // Found the property
-      if (*property_id == expected_property.AsUint()) {
-        PropertyValue value;
-        if (!DecodePropertyValue(reader, metadata->type, metadata->payload_size, value))
-          return ExpectedPropertyStatus::MISSING_DATA;
-        type = ExtendedPropertyType{
-            value.type()};  // PropertyStoreType has only Point; while PropertyValueType has point 2d and 3d
-        return ExpectedPropertyStatus::EQUAL;
-      }
-    } break;
+    case POINT:
+      // PropertyStoreType has only Point; while PropertyValueType has point 2d and 3d
+      type = ExtendedPropertyType{valid2d(SizeToCrs(metadata->payload_size)) ? PropertyValue::Type::Point2d
+                                                                             : PropertyValue::Type::Point3d};
+      break;
   }
 
   if (*property_id == expected_property.AsUint()) {
@@ -1399,7 +1500,7 @@ enum class ExpectedPropertyStatus {
 
   if (!SkipPropertyValue(reader, metadata->type, metadata->payload_size)) return std::nullopt;
 
-  return PropertyStoreMemberInfo{PropertyId::FromUint(*property_id), metadata->type, std::nullopt};
+  return PropertyStoreMemberInfo{PropertyId::FromUint(*property_id), ValueType(metadata->type), std::nullopt};
 }
 
 // Function used to decode a property (PropertyId, PropertyValue) from a byte
@@ -1442,6 +1543,7 @@ enum class ExpectedPropertyStatus {
       type = ExtendedPropertyType{PropertyValue::Type::Double};
       break;
     case STRING:
+    case INTERNED_STRING:
       type = ExtendedPropertyType{PropertyValue::Type::String};
       break;
     case LIST:
@@ -1466,13 +1568,11 @@ enum class ExpectedPropertyStatus {
       type = ExtendedPropertyType{value.ValueEnum().type_id()};
       return PropertyId::FromUint(*property_id);
     }
-    case POINT: {
-      PropertyValue value;
-      if (!DecodePropertyValue(reader, metadata->type, metadata->payload_size, value)) return std::nullopt;
-      type = ExtendedPropertyType{
-          value.type()};  // PropertyStoreType has only Point; while PropertyValueType has point 2d and 3d
-      return PropertyId::FromUint(*property_id);
-    }
+    case POINT:
+      // PropertyStoreType has only Point; while PropertyValueType has point 2d and 3d
+      type = ExtendedPropertyType{valid2d(SizeToCrs(metadata->payload_size)) ? PropertyValue::Type::Point2d
+                                                                             : PropertyValue::Type::Point3d};
+      break;
   }
 
   if (!SkipPropertyValue(reader, metadata->type, metadata->payload_size)) return std::nullopt;
@@ -1559,6 +1659,7 @@ struct SpecificPropertyAndBufferInfo {
   uint32_t all_begin;
   uint32_t all_end;
   uint32_t all_size;
+  uint32_t all_count;
 };
 
 // Struct used to return info about the property position
@@ -1573,7 +1674,7 @@ struct SpecificPropertyAndBufferInfoMinimal {
 // buffer. It keeps the properties in the buffer sorted by `PropertyId` and
 // returns the positions in the buffer where the seeked property starts and
 // ends. It also returns the positions where all of the properties start and
-// end. Also, sizes are calculated.
+// end. Also, sizes and the number of all properties are calculated.
 // If the function doesn't find the property, the `property_size` will be `0`
 // and `property_begin` will be equal to `property_end`. Positions and size of
 // all properties is always calculated (even if the specific property isn't
@@ -1585,11 +1686,13 @@ SpecificPropertyAndBufferInfo FindSpecificPropertyAndBufferInfo(Reader *reader,
   uint32_t property_end = reader->GetPosition();
   const uint32_t all_begin = reader->GetPosition();
   uint32_t all_end = reader->GetPosition();
+  uint32_t all_count = 0;
   while (true) {
     auto ret = HasExpectedProperty(reader, property);
     if (ret == ExpectedPropertyStatus::MISSING_DATA) {
       break;
     }
+    ++all_count;
     if (ret == ExpectedPropertyStatus::SMALLER) {
       property_begin = reader->GetPosition();
       property_end = reader->GetPosition();
@@ -1598,7 +1701,8 @@ SpecificPropertyAndBufferInfo FindSpecificPropertyAndBufferInfo(Reader *reader,
     }
     all_end = reader->GetPosition();
   }
-  return {property_begin, property_end, property_end - property_begin, all_begin, all_end, all_end - all_begin};
+  return {property_begin, property_end, property_end - property_begin, all_begin, all_end, all_end - all_begin,
+          all_count};
 }
 
 // Like FindSpecificPropertyAndBufferInfo, but will early exit. No need to find the "all" information
@@ -1629,6 +1733,96 @@ uint32_t ToMultipleOf8(uint32_t size) {
   return size - mod + 8;
 }
 
+// Stores holding more than `kPropertyDirectoryThreshold` properties keep a
+// directory in front of the encoded properties so that a single property can be
+// found with a binary search instead of decoding all of the properties before
+// it. Smaller stores keep the compact format without the directory.
+//
+// The directory is encoded as follows:
+//   * marker byte `kPropertyDirectoryMarker`; it is never a valid first byte of
+//     an encoded property (properties never start with an `EMPTY` type and the
+//     tombstone is always encoded as 0x00)
+//   * number of properties as `uint32_t`
+//   * for each property (sorted by ID)
+//     - property ID as `uint32_t`
+//     - offset of the encoded property, relative to the end of the directory,
+//       as `uint32_t`
+constexpr uint32_t kPropertyDirectoryThreshold = 16;
+const uint8_t kPropertyDirectoryMarker = 0x0f;
+constexpr uint32_t kPropertyDirectoryHeaderSize = 1 + sizeof(uint32_t);
+constexpr uint32_t kPropertyDirectoryEntrySize = sizeof(uint32_t) + sizeof(uint32_t);
+
+// Returns the size of the directory needed for a store with `count` properties.
+constexpr uint32_t PropertyDirectorySize(uint32_t count) {
+  if (count <= kPropertyDirectoryThreshold) return 0;
+  return kPropertyDirectoryHeaderSize + count * kPropertyDirectoryEntrySize;
+}
+
+uint32_t PropertyDirectoryCount(std::span<uint8_t const> view) {
+  if (view.size_bytes() < kPropertyDirectoryHeaderSize || view[0] != kPropertyDirectoryMarker) return 0;
+  uint32_t count = 0;
+  memcpy(&count, view.data() + 1, sizeof(count));
+  return count;
+}
+
+// Returns the size of the directory with which `view` starts, or 0 if there is
+// no directory.
+uint32_t ExistingPropertyDirectorySize(std::span<uint8_t const> view) {
+  return PropertyDirectorySize(PropertyDirectoryCount(view));
+}
+
+// Function used to find the offset of the property in the directory with which
+// `view` starts. The offset is relative to the end of the directory.
+std::optional<uint32_t> FindInPropertyDirectory(std::span<uint8_t const> view, PropertyId property) {
+  auto const count = PropertyDirectoryCount(view);
+  auto const *entries = view.data() + kPropertyDirectoryHeaderSize;
+  auto entry_id = [&](uint32_t index) {
+    uint32_t id = 0;
+    memcpy(&id, entries + index * kPropertyDirectoryEntrySize, sizeof(id));
+    return id;
+  };
+
+  uint32_t low = 0;
+  uint32_t high = count;
+  while (low < high) {
+    auto const mid = low + (high - low) / 2;
+    if (entry_id(mid) < property.AsUint()) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  if (low == count || entry_id(low) != property.AsUint()) return std::nullopt;
+
+  uint32_t offset = 0;
+  memcpy(&offset, entries + low * kPropertyDirectoryEntrySize + sizeof(uint32_t), sizeof(offset));
+  return offset;
+}
+
+// Writes the directory of the `count` properties that are encoded in `view`
+// right after the space reserved for the directory.
+void WritePropertyDirectory(std::span<uint8_t> view, uint32_t count) {
+  auto const directory_size = PropertyDirectorySize(count);
+  DMG_ASSERT(directory_size != 0 && directory_size <= view.size_bytes());
+
+  view[0] = kPropertyDirectoryMarker;
+  memcpy(view.data() + 1, &count, sizeof(count));
+
+  auto *entries = view.data() + kPropertyDirectoryHeaderSize;
+  Reader reader(view.data() + directory_size, view.size_bytes() - directory_size);
+  for (uint32_t i = 0; i < count; ++i) {
+    const uint32_t offset = reader.GetPosition();
+    auto metadata = reader.ReadMetadata();
+    MG_ASSERT(metadata, "Invalid database state!");
+    auto property_id = reader.ReadUint(metadata->id_size);
+    MG_ASSERT(property_id && SkipPropertyValue(&reader, metadata->type, metadata->payload_size),
+              "Invalid database state!");
+    auto const id = static_cast<uint32_t>(*property_id);
+    memcpy(entries + i * kPropertyDirectoryEntrySize, &id, sizeof(id));
+    memcpy(entries + i * kPropertyDirectoryEntrySize + sizeof(uint32_t), &offset, sizeof(offset));
+  }
+}
+
 // The `PropertyStore` also uses a small buffer optimization in it. If the data
 // fits into the size of the internally stored pointer and size, then the
 // pointer and size are used as a in-place buffer. In order to be able to do
@@ -1660,23 +1854,30 @@ static_assert(std::endian::native == std::endian::little, "Our code assumes litt
 
 const uint8_t kUseLocalBuffer = 0x01;
 const uint8_t kUseCompressedBuffer = 0x02;
+// The buffer was moved to the `PropertyStoreTier`, the `data` field holds its
+// key there and the `size` field the size of the (uncompressed) buffer.
+const uint8_t kUseTieredBuffer = 0x03;
 static_assert(kUseLocalBuffer % 8 != 0, "Special storage modes need to be not a multiple of 8");
 static_assert(kUseCompressedBuffer % 8 != 0, "Special storage modes need to be not a multiple of 8");
+static_assert(kUseTieredBuffer % 8 != 0, "Special storage modes need to be not a multiple of 8");
 
 enum class StorageMode : uint8_t {
   EMPTY,
   BUFFER,
   LOCAL,
   COMPRESSED,
+  TIERED,
 };
 
 struct DecodedBufferConst {
   std::span<uint8_t const> view;
   StorageMode storage_mode;
+  uint64_t tier_key{0};
 };
 struct DecodedBuffer {
   std::span<uint8_t> view;
   StorageMode storage_mode;
+  uint64_t tier_key{0};
 
   // implicit conversion operator
   // NOLINTNEXTLINE( hicpp-explicit-conversions )
@@ -1684,15 +1885,56 @@ struct DecodedBuffer {
     return {
         .view = view,
         .storage_mode = storage_mode,
+        .tier_key = tier_key,
     };
   }
 };
 
+// Small buffers come from the pool, the larger ones are arrays so that the loaded buffers can be adopted without a
+// copy.
+uint8_t *AllocateBuffer(uint32_t size) {
+  if (utils::SmallBlockPool::IsPooled(size, alignof(uint8_t))) {
+    return static_cast<uint8_t *>(utils::SmallBlockPool::Allocate(size, alignof(uint8_t)));
+  }
+  return new uint8_t[size];
+}
+
+void DeallocateBuffer(std::span<uint8_t> buffer) {
+  if (utils::SmallBlockPool::IsPooled(buffer.size_bytes(), alignof(uint8_t))) {
+    utils::SmallBlockPool::Deallocate(buffer.data(), buffer.size_bytes(), alignof(uint8_t));
+    return;
+  }
+  delete[] buffer.data();
+}
+
+// Takes the data of a decompressed or loaded buffer as a buffer of the store.
+std::span<uint8_t> AdoptBuffer(utils::DecompressedBuffer &buffer) {
+  auto view = buffer.view();
+  if (!utils::SmallBlockPool::IsPooled(view.size_bytes(), alignof(uint8_t))) {
+    buffer.release();
+    return view;
+  }
+  auto *data = AllocateBuffer(view.size_bytes());
+  memcpy(data, view.data(), view.size_bytes());
+  return {data, view.size_bytes()};
+}
+
+// Counts the freed compressed buffers. The memory of a freed buffer can be
+// reused for another buffer, so the decompressed buffers cached before it was
+// freed can't be matched by their address anymore.
+std::atomic<uint64_t> compressed_buffers_freed{0};
+
 void FreeMemory(DecodedBuffer const &buffer_info) {
   switch (buffer_info.storage_mode) {
-    case StorageMode::BUFFER:
     case StorageMode::COMPRESSED:
-      delete[] buffer_info.view.data();
+      compressed_buffers_freed.fetch_add(1, std::memory_order_acq_rel);
+      DeallocateBuffer(buffer_info.view);
+      break;
+    case StorageMode::BUFFER:
+      DeallocateBuffer(buffer_info.view);
+      break;
+    case StorageMode::TIERED:
+      PropertyStoreTier::GetInstance()->Delete(buffer_info.tier_key);
       break;
     case StorageMode::LOCAL:
     case StorageMode::EMPTY:
@@ -1713,7 +1955,7 @@ DecodedBuffer SetupLocalBuffer(uint8_t (&buffer)[12]) {
 }
 DecodedBuffer SetupExternalBuffer(uint32_t size) {
   auto alloc_size = ToMultipleOf8(size);
-  auto *alloc_data = new uint8_t[alloc_size];
+  auto *alloc_data = AllocateBuffer(alloc_size);
 
   return DecodedBuffer{
       .view = std::span{alloc_data, alloc_size},
@@ -1756,6 +1998,66 @@ std::optional<utils::DecompressedBuffer> DecompressBuffer(DecodedBufferConst con
   return decompressed_buffer;
 }
 
+// Returns the buffer of the stores which don't keep it uncompressed in memory.
+std::optional<utils::DecompressedBuffer> LoadBuffer(DecodedBufferConst const &buffer_info) {
+  if (buffer_info.storage_mode == StorageMode::TIERED) {
+    return PropertyStoreTier::GetInstance()->Get(buffer_info.tier_key);
+  }
+  return DecompressBuffer(buffer_info);
+}
+
+// The buffers the thread decompressed last, so reading several properties of
+// a compressed store one after another decompresses it once. A compressed
+// buffer is never changed in place, it is replaced by a newly allocated one,
+// so a cached buffer is valid until any compressed buffer is freed.
+struct DecompressedBufferCache {
+  struct Entry {
+    uint8_t const *compressed_data{nullptr};
+    uint64_t freed{0};
+    utils::DecompressedBuffer buffer;
+  };
+  static constexpr size_t kEntries = 4;
+  std::array<Entry, kEntries> entries;
+  size_t next{0};
+};
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+thread_local DecompressedBufferCache decompressed_buffer_cache;
+
+// Returns the decompressed buffer of a compressed store, which stays valid
+// until the thread decompresses `kEntries` other buffers.
+std::span<uint8_t const> CachedDecompressBuffer(DecodedBufferConst const &buffer_info) {
+  auto const freed = compressed_buffers_freed.load(std::memory_order_acquire);
+  auto &cache = decompressed_buffer_cache;
+  for (auto &entry : cache.entries) {
+    if (entry.compressed_data == buffer_info.view.data() && entry.freed == freed) return entry.buffer.view();
+  }
+  auto &entry = cache.entries[cache.next];
+  cache.next = (cache.next + 1) % DecompressedBufferCache::kEntries;
+  entry.buffer = std::move(*DecompressBuffer(buffer_info));
+  entry.compressed_data = buffer_info.view.data();
+  entry.freed = freed;
+  return entry.buffer.view();
+}
+
+// Returns the uncompressed buffer of the store for reading, the buffer of a
+// tiered store is kept alive by @p loaded_buffer.
+std::span<uint8_t const> ReadBuffer(DecodedBufferConst const &buffer_info,
+                                    std::optional<utils::DecompressedBuffer> &loaded_buffer) {
+  switch (buffer_info.storage_mode) {
+    case StorageMode::COMPRESSED:
+      return CachedDecompressBuffer(buffer_info);
+    case StorageMode::TIERED:
+      loaded_buffer = LoadBuffer(buffer_info);
+      return loaded_buffer->view();
+    case StorageMode::EMPTY:
+    case StorageMode::BUFFER:
+    case StorageMode::LOCAL:
+      return buffer_info.view;
+  }
+  return buffer_info.view;
+}
+
 void CompressBuffer(uint8_t (&buffer)[12], DecodedBuffer const &buffer_info) {
   if (buffer_info.storage_mode != StorageMode::BUFFER) {
     return;
@@ -1777,23 +2079,23 @@ void CompressBuffer(uint8_t (&buffer)[12], DecodedBuffer const &buffer_info) {
     return;
   }
 
-  auto compressed_data = std::make_unique_for_overwrite<uint8_t[]>(compressed_size_to_multiple_of_8);
+  auto *compressed_data = AllocateBuffer(compressed_size_to_multiple_of_8);
 
   // We have compressed data + new buffer to put it into, no need for old uncompressed buffer
   FreeMemory(buffer_info);
 
   // first 4 bytes are the size of the original buffer
   auto orig_size = compressed_buffer->original_size();
-  memcpy(compressed_data.get(), &orig_size, sizeof(uint32_t));
+  memcpy(compressed_data, &orig_size, sizeof(uint32_t));
 
   // next byte is the mod before multiple of 8
   const uint8_t mod = size_needed % 8;
   compressed_data[sizeof(uint32_t)] = mod;
 
   // the rest of the buffer is the compressed data
-  memcpy(compressed_data.get() + metadata_size, compressed_view.data(), compressed_view.size_bytes());
+  memcpy(compressed_data + metadata_size, compressed_view.data(), compressed_view.size_bytes());
 
-  SetSizeData(buffer, compressed_size_to_multiple_of_8 + kUseCompressedBuffer, compressed_data.release());
+  SetSizeData(buffer, compressed_size_to_multiple_of_8 + kUseCompressedBuffer, compressed_data);
 }
 
 // Helper functions used to retrieve/store `size` and `data` from/into the
@@ -1823,6 +2125,11 @@ auto GetDecodedBuffer(uint8_t (&buffer)[12]) -> DecodedBuffer {
       auto real_size = static_cast<uint32_t>(size & ~(sizeof(uint8_t) * CHAR_BIT - 1));
       return {std::span{data, real_size}, StorageMode::COMPRESSED};
     }
+    case kUseTieredBuffer: {
+      uint64_t tier_key = 0;
+      memcpy(&tier_key, buffer + sizeof(uint32_t), sizeof(tier_key));
+      return {{}, StorageMode::TIERED, tier_key};
+    }
     default: {
       MG_ASSERT(false, "Corrupt property storage");
     }
@@ -1854,6 +2161,11 @@ auto GetDecodedBuffer(uint8_t const (&buffer)[12]) -> DecodedBufferConst {
       auto real_size = static_cast<uint32_t>(size & ~(sizeof(uint8_t) * CHAR_BIT - 1));
       return {std::span{data, real_size}, StorageMode::COMPRESSED};
     }
+    case kUseTieredBuffer: {
+      uint64_t tier_key = 0;
+      memcpy(&tier_key, buffer + sizeof(uint32_t), sizeof(tier_key));
+      return {{}, StorageMode::TIERED, tier_key};
+    }
     default: {
       MG_ASSERT(false, "Corrupt property storage");
     }
@@ -1890,14 +2202,26 @@ PropertyStore::~PropertyStore() {
 
 template <typename Func>
 auto PropertyStore::WithReader(Func &&func) const {
-  auto buffer_info = GetDecodedBuffer(buffer_);
-  if (buffer_info.storage_mode == StorageMode::COMPRESSED) {
-    auto decompressed_buffer = DecompressBuffer(buffer_info);
-    auto view = decompressed_buffer->view();
-    Reader reader(view.data(), view.size_bytes());
-    return std::forward<Func>(func)(reader);
-  }
-  Reader reader(buffer_info.view.data(), buffer_info.view.size_bytes());
+  std::optional<utils::DecompressedBuffer> loaded_buffer;
+  auto const buffer = ReadBuffer(GetDecodedBuffer(buffer_), loaded_buffer);
+  // The properties are read past the directory (if there is one).
+  auto view = buffer.subspan(ExistingPropertyDirectorySize(buffer));
+  Reader reader(view.data(), view.size_bytes());
+  return std::forward<Func>(func)(reader);
+}
+
+template <typename Func>
+auto PropertyStore::WithPropertyReader(PropertyId property, Func &&func) const {
+  std::optional<utils::DecompressedBuffer> loaded_buffer;
+  auto view = ReadBuffer(GetDecodedBuffer(buffer_), loaded_buffer);
+  auto const directory_size = ExistingPropertyDirectorySize(view);
+  if (directory_size != 0) {
+    // Jump straight to the property; if it isn't in the directory the reader
+    // is left empty so the search finds nothing.
+    auto offset = FindInPropertyDirectory(view, property);
+    view = offset ? view.subspan(directory_size + *offset) : std::span<uint8_t const>{};
+  }
+  Reader reader(view.data(), view.size_bytes());
   return std::forward<Func>(func)(reader);
 }
 
@@ -1907,7 +2231,48 @@ PropertyValue PropertyStore::GetProperty(PropertyId property) const {
     if (FindSpecificProperty(&reader, property, value) != ExpectedPropertyStatus::EQUAL) return {};
     return value;
   };
-  return WithReader(get_property);
+  return WithPropertyReader(property, get_property);
+}
+
+std::vector<PropertyValue> PropertyStore::GetProperties(std::span<PropertyId const> properties) const {
+  std::vector<PropertyValue> values(properties.size());
+  if (properties.empty()) return values;
+
+  // The properties are sorted (by ID) in the buffer, so the requested
+  // properties are visited in the same order to find all of them in one pass.
+  std::vector<uint32_t> order(properties.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](auto lhs, auto rhs) { return properties[lhs] < properties[rhs]; });
+
+  auto get_properties = [&](Reader &reader) {
+    auto it = order.begin();
+    while (it != order.end()) {
+      auto metadata = reader.ReadMetadata();
+      if (!metadata || metadata->type == Type::EMPTY) break;
+
+      auto property_id = reader.ReadUint(metadata->id_size);
+      if (!property_id) break;
+
+      // Requested properties with a smaller ID don't exist in the store.
+      while (it != order.end() && properties[*it].AsUint() < *property_id) ++it;
+      if (it == order.end()) break;
+
+      if (properties[*it].AsUint() != *property_id) {
+        // Don't load the value if this isn't a requested property.
+        if (!SkipPropertyValue(&reader, metadata->type, metadata->payload_size)) break;
+        continue;
+      }
+
+      auto &value = values[*it];
+      if (!DecodePropertyValue(&reader, metadata->type, metadata->payload_size, value)) break;
+      // The same property could be requested more than once.
+      for (++it; it != order.end() && properties[*it].AsUint() == *property_id; ++it) {
+        values[*it] = value;
+      }
+    }
+  };
+  WithReader(get_properties);
+  return values;
 }
 
 ExtendedPropertyType PropertyStore::GetExtendedPropertyType(PropertyId property) const {
@@ -1916,7 +2281,7 @@ ExtendedPropertyType PropertyStore::GetExtendedPropertyType(PropertyId property)
     if (FindSpecificExtendedPropertyType(&reader, property, type) != ExpectedPropertyStatus::EQUAL) return {};
     return type;
   };
-  return WithReader(get_property_type);
+  return WithPropertyReader(property, get_property_type);
 }
 
 uint32_t PropertyStore::PropertySize(PropertyId property) const {
@@ -1925,14 +2290,14 @@ uint32_t PropertyStore::PropertySize(PropertyId property) const {
     if (FindSpecificPropertySize(&reader, property, property_size) != ExpectedPropertyStatus::EQUAL) return 0;
     return property_size;
   };
-  return WithReader(get_property_size);
+  return WithPropertyReader(property, get_property_size);
 }
 
 bool PropertyStore::HasProperty(PropertyId property) const {
   auto property_exists = [&](Reader &reader) -> uint32_t {
     return ExistsSpecificProperty(&reader, property) == ExpectedPropertyStatus::EQUAL;
   };
-  return WithReader(property_exists);
+  return WithPropertyReader(property, property_exists);
 }
 
 bool PropertyStore::HasAllProperties(const std::set<PropertyId> &properties) const {
@@ -1975,7 +2340,7 @@ bool PropertyStore::IsPropertyEqual(PropertyId property, const PropertyValue &va
     if (!CompareExpectedProperty(&prop_reader, property, value)) return false;
     return prop_reader.GetPosition() == property_size;
   };
-  return WithReader(property_equal);
+  return WithPropertyReader(property, property_equal);
 }
 
 std::map<PropertyId, PropertyValue> PropertyStore::Properties() const {
@@ -2048,17 +2413,24 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
     std::optional<utils::DecompressedBuffer> decompressed_buffer;
 
     auto current_view = std::invoke([&] {
-      if (buffer_info.storage_mode == StorageMode::COMPRESSED) {
-        decompressed_buffer = DecompressBuffer(buffer_info);
+      decompressed_buffer = LoadBuffer(buffer_info);
+      if (decompressed_buffer) {
         return decompressed_buffer->view();
       }
       return buffer_info.view;
     });
 
+    // The positions found are relative to the start of the buffer, i.e. they
+    // include the directory (if there is one).
+    auto const old_directory_size = ExistingPropertyDirectorySize(current_view);
     auto reader = Reader(current_view.data(), current_view.size_bytes());
+    reader.SkipBytes(old_directory_size);
     auto info = FindSpecificPropertyAndBufferInfo(&reader, property);
     existed = info.property_size != 0;
-    auto new_size = info.all_size - info.property_size + property_size;
+    auto const new_count = info.all_count - (existed ? 1 : 0) + (value.IsNull() ? 0 : 1);
+    auto const new_directory_size = PropertyDirectorySize(new_count);
+    auto const new_property_begin = info.property_begin - old_directory_size + new_directory_size;
+    auto new_size = new_directory_size + info.all_size - info.property_size + property_size;
     auto new_size_to_multiple_of_8 = ToMultipleOf8(new_size);
 
     if (new_size == 0) {
@@ -2075,9 +2447,10 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
       auto new_view = new_buffer_info.view;
 
       // Copy everything before the property to the new buffer.
-      memmove(new_view.data(), current_view.data(), info.property_begin);
+      memmove(new_view.data() + new_directory_size, current_view.data() + old_directory_size,
+              info.property_begin - old_directory_size);
       // Copy everything after the property to the new buffer.
-      memmove(new_view.data() + info.property_begin + property_size, current_view.data() + info.property_end,
+      memmove(new_view.data() + new_property_begin + property_size, current_view.data() + info.property_end,
               info.all_end - info.property_end);
 
       // Make buffer perminant
@@ -2091,23 +2464,39 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
       buffer_info = new_buffer_info;
       current_view = new_buffer_info.view;
 
-    } else if (property_size != info.property_size) {
+    } else if (property_size != info.property_size || new_directory_size != old_directory_size) {
       // We can keep the data in the same buffer, but the new property is
-      // larger/smaller than the old property. We need to move the following
-      // properties to the right/left.
-      memmove(current_view.data() + info.property_begin + property_size, current_view.data() + info.property_end,
-              info.all_end - info.property_end);
+      // larger/smaller than the old property or the directory changed its
+      // size. We need to move the preceding and the following properties to
+      // the right/left. When moving to the right the following properties are
+      // moved first, otherwise the preceding ones, so that neither overwrites
+      // the other before being moved.
+      auto move_preceding = [&] {
+        memmove(current_view.data() + new_directory_size, current_view.data() + old_directory_size,
+                info.property_begin - old_directory_size);
+      };
+      auto move_following = [&] {
+        memmove(current_view.data() + new_property_begin + property_size, current_view.data() + info.property_end,
+                info.all_end - info.property_end);
+      };
+      if (new_directory_size > old_directory_size) {
+        move_following();
+        move_preceding();
+      } else {
+        if (new_directory_size != old_directory_size) move_preceding();
+        move_following();
+      }
     }
 
-    // If we still started with compressed buffer
+    // If we still started with compressed or tiered buffer
     // take ownership of the decompressed buffer before writing
-    if (buffer_info.storage_mode == StorageMode::COMPRESSED) {
+    if (buffer_info.storage_mode == StorageMode::COMPRESSED || buffer_info.storage_mode == StorageMode::TIERED) {
+      // take ownership of decompressed buffer
+      current_view = AdoptBuffer(*decompressed_buffer);
+      decompressed_buffer.reset();
       // remove compressed buffer
       FreeMemory(buffer_info);
-      // take ownership of decompressed buffer
-      decompressed_buffer->release();
       SetSizeData(buffer_, current_view.size_bytes(), current_view.data());
-      decompressed_buffer.reset();
       buffer_info = DecodedBuffer{
           .view = current_view,
           .storage_mode = StorageMode::BUFFER,  // decompressed buffer is now a regular buffer
@@ -2116,7 +2505,7 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
 
     if (!value.IsNull()) {
       // We need to encode the new value.
-      Writer writer(current_view.data() + info.property_begin, property_size);
+      Writer writer(current_view.data() + new_property_begin, property_size);
       MG_ASSERT(EncodeProperty(&writer, property, value), "Invalid database state!");
     }
 
@@ -2126,6 +2515,10 @@ bool PropertyStore::SetProperty(PropertyId property, const PropertyValue &value)
     if (metadata) {
       metadata->Set({Type::EMPTY});
     }
+
+    if (new_directory_size != 0) {
+      WritePropertyDirectory(current_view, new_count);
+    }
   }
 
   if (FLAGS_storage_property_store_compression_enabled) {
@@ -2143,6 +2536,7 @@ bool PropertyStore::DoInitProperties(const TContainer &properties) {
   }
 
   uint32_t property_size = 0;
+  uint32_t property_count = 0;
   {
     Writer writer;
     for (const auto &[property, value] : properties) {
@@ -2151,14 +2545,16 @@ bool PropertyStore::DoInitProperties(const TContainer &properties) {
       }
       EncodeProperty(&writer, property, value);
       property_size = writer.Written();
+      ++property_count;
     }
   }
 
-  auto buffer_info = SetupBuffer(buffer_, property_size);
+  auto const directory_size = PropertyDirectorySize(property_count);
+  auto buffer_info = SetupBuffer(buffer_, directory_size + property_size);
   auto view = buffer_info.view;
 
   // Encode the property into the data buffer.
-  Writer writer(view.data(), view.size_bytes());
+  Writer writer(view.data() + directory_size, view.size_bytes() - directory_size);
 
   for (const auto &[property, value] : properties) {
     if (value.IsNull()) {
@@ -2175,6 +2571,10 @@ bool PropertyStore::DoInitProperties(const TContainer &properties) {
     metadata->Set({Type::EMPTY});
   }
 
+  if (directory_size != 0) {
+    WritePropertyDirectory(view, property_count);
+  }
+
   // Make buffer perminant
   if (buffer_info.storage_mode == StorageMode::BUFFER) {
     SetSizeData(buffer_, view.size_bytes(), view.data());
@@ -2238,10 +2638,73 @@ bool PropertyStore::ClearProperties() {
 }
 
 std::string PropertyStore::StringBuffer() const {
+  if (StringInterner::AnyInterned() && !encode_strings_inline) {
+    auto has_interned_strings = [](Reader &reader) {
+      while (true) {
+        auto metadata = reader.ReadMetadata();
+        if (!metadata || metadata->type == Type::EMPTY) return false;
+        if (metadata->type == Type::INTERNED_STRING) return true;
+        if (!reader.ReadUint(metadata->id_size)) return false;
+        if (!SkipPropertyValue(&reader, metadata->type, metadata->payload_size)) return false;
+      }
+    };
+    // The ids aren't valid outside of this process, so the strings are
+    // written inline to a copy of the store.
+    if (WithReader(has_interned_strings)) {
+      encode_strings_inline = true;
+      utils::OnScopeExit const reset{[] { encode_strings_inline = false; }};
+      PropertyStore inline_store;
+      MG_ASSERT(inline_store.InitProperties(Properties()));
+      return inline_store.StringBuffer();
+    }
+  }
+
   auto buffer_info = GetDecodedBuffer(buffer_);
+  if (buffer_info.storage_mode == StorageMode::TIERED) {
+    auto loaded_buffer = LoadBuffer(buffer_info);
+    return {loaded_buffer->view().begin(), loaded_buffer->view().end()};
+  }
   return {buffer_info.view.begin(), buffer_info.view.end()};
 }
 
+bool PropertyStore::Evict(uint64_t min_size) {
+  auto *tier = PropertyStoreTier::GetInstance();
+  if (!tier) return false;
+
+  auto buffer_info = GetDecodedBuffer(buffer_);
+  if (buffer_info.storage_mode != StorageMode::BUFFER && buffer_info.storage_mode != StorageMode::COMPRESSED) {
+    return false;
+  }
+  // The tier keeps the buffers uncompressed, so they can be read without decompressing them.
+  auto decompressed_buffer = DecompressBuffer(buffer_info);
+  auto view = decompressed_buffer ? decompressed_buffer->view() : buffer_info.view;
+  if (view.size_bytes() < min_size) return false;
+
+  auto tier_key = tier->Put(view);
+  if (!tier_key) return false;
+  FreeMemory(buffer_info);
+  auto size = static_cast<uint32_t>(view.size_bytes()) + kUseTieredBuffer;
+  memcpy(buffer_, &size, sizeof(size));
+  memcpy(buffer_ + sizeof(size), &*tier_key, sizeof(*tier_key));
+  return true;
+}
+
+bool PropertyStore::Restore() {
+  auto buffer_info = GetDecodedBuffer(buffer_);
+  if (buffer_info.storage_mode != StorageMode::TIERED) return false;
+
+  auto loaded_buffer = LoadBuffer(buffer_info);
+  auto view = AdoptBuffer(*loaded_buffer);
+  FreeMemory(buffer_info);
+  SetSizeData(buffer_, view.size_bytes(), view.data());
+  if (FLAGS_storage_property_store_compression_enabled) {
+    CompressBuffer(buffer_, {.view = view, .storage_mode = StorageMode::BUFFER});
+  }
+  return true;
+}
+
+bool PropertyStore::IsEvicted() const { return GetDecodedBuffer(buffer_).storage_mode == StorageMode::TIERED; }
+
 void PropertyStore::SetBuffer(const std::string_view buffer) {
   if (buffer.empty()) {
     return;
@@ -2271,7 +2734,7 @@ std::vector<PropertyId> PropertyStore::PropertiesOfTypes(std::span<Type const> t
       auto property_id = reader.ReadUint(metadata->id_size);
       if (!property_id) break;
 
-      if (utils::Contains(types, metadata->type)) {
+      if (utils::Contains(types, ValueType(metadata->type))) {
         props.emplace_back(PropertyId::FromUint(*property_id));
       }
 
@@ -2299,7 +2762,7 @@ std::optional<PropertyValue> PropertyStore::GetPropertyOfTypes(PropertyId proper
       // found property
       if (*property_id == property.AsUint()) {
         // check its the type we are looking for
-        if (!utils::Contains(types, metadata->type)) {
+        if (!utils::Contains(types, ValueType(metadata->type))) {
           return std::nullopt;
         }
         if (!DecodePropertyValue(&reader, metadata->type, metadata->payload_size, value)) {
@@ -2317,7 +2780,7 @@ std::optional<PropertyValue> PropertyStore::GetPropertyOfTypes(PropertyId proper
     return std::nullopt;
   };
 
-  return WithReader(get_properties);
+  return WithPropertyReader(property, get_properties);
 }
 
 auto PropertyStore::PropertiesMatchTypes(TypeConstraintsValidator const &constraint) const
@@ -51,19 +51,31 @@ class PropertyStore {
 
   /// Returns the currently stored value for property `property`. If the
   /// property doesn't exist a Null value is returned. The time complexity of
-  /// this function is O(n).
+  /// this function is O(n), or O(log(n)) when the store is large enough to
+  /// keep a property directory.
   /// @throw std::bad_alloc
   PropertyValue GetProperty(PropertyId property) const;
 
   ExtendedPropertyType GetExtendedPropertyType(PropertyId property) const;
 
+  /// Returns the currently stored values for properties `properties`, in the
+  /// same order. Properties that don't exist are returned as Null values. All
+  /// of the properties are decoded in a single pass over the store, so this is
+  /// cheaper than calling `GetProperty` for each of them. The time complexity
+  /// of this function is O(n + k*log(k)) where k is the number of requested
+  /// properties.
+  /// @throw std::bad_alloc
+  std::vector<PropertyValue> GetProperties(std::span<PropertyId const> properties) const;
+
   /// Returns the size of the encoded property in bytes.
   /// Returns 0 if the property does not exist.
-  /// The time complexity of this function is O(n).
+  /// The time complexity of this function is O(n), or O(log(n)) when the store
+  /// keeps a property directory.
   uint32_t PropertySize(PropertyId property) const;
 
   /// Checks whether the property `property` exists in the store. The time
-  /// complexity of this function is O(n).
+  /// complexity of this function is O(n), or O(log(n)) when the store keeps a
+  /// property directory.
   bool HasProperty(PropertyId property) const;
 
   /// Checks whether all properties in the set `properties` exist in the store. The time
@@ -81,7 +93,7 @@ class PropertyStore {
   /// Checks whether the property `property` is equal to the specified value
   /// `value`. This function doesn't perform any memory allocations while
   /// performing the equality check. The time complexity of this function is
-  /// O(n).
+  /// O(n), or O(log(n)) when the store keeps a property directory.
   bool IsPropertyEqual(PropertyId property, const PropertyValue &value) const;
 
   /// Returns all properties currently stored in the store. The time complexity
@@ -135,6 +147,20 @@ class PropertyStore {
   /// Sets buffer
   void SetBuffer(std::string_view buffer);
 
+  /// Moves the buffer to the `PropertyStoreTier` if the tier is enabled and
+  /// the encoded properties take at least `min_size` bytes. The properties
+  /// are read from the tier until the store is changed or `Restore` is
+  /// called. Must be called while no one else reads the store. Returns
+  /// `true` if the buffer was moved.
+  bool Evict(uint64_t min_size);
+
+  /// Moves the buffer back from the `PropertyStoreTier` and returns `true`
+  /// if it was evicted.
+  /// @throw PropertyValueException
+  bool Restore();
+
+  bool IsEvicted() const;
+
   auto PropertiesMatchTypes(TypeConstraintsValidator const &constraint) const
       -> std::optional<PropertyStoreConstraintViolation>;
 
@@ -145,6 +171,9 @@ class PropertyStore {
   template <typename Func>
   auto WithReader(Func &&func) const;
 
+  template <typename Func>
+  auto WithPropertyReader(PropertyId property, Func &&func) const;
+
   uint8_t buffer_[sizeof(uint32_t) + sizeof(uint8_t *)];
 };
 
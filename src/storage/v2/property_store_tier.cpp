@@ -0,0 +1,102 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/property_store_tier.hpp"
+
+#include <cstring>
+#include <string>
+
+#include <rocksdb/db.h>
+#include <rocksdb/options.h>
+
+#include "spdlog/spdlog.h"
+#include "storage/v2/property_value.hpp"
+#include "utils/logging.hpp"
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_string(storage_property_tier_directory, "",
+              "Directory of the RocksDB instance to which the properties of the cold in-memory vertices are moved. "
+              "The properties are never moved out of memory if it isn't set. The directory is cleared on startup.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_property_tier_interval_sec, 60,
+              "Seconds between two passes which move the properties of the vertices which weren't read since the "
+              "previous pass to the property tier, and the ones of the vertices which were read back to memory.");
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_property_tier_min_size, 256,
+              "Encoded size in bytes below which the properties of a vertex are kept in memory even if it is cold.");
+
+namespace memgraph::storage {
+
+namespace {
+
+rocksdb::Slice KeySlice(const uint64_t &key) {
+  return {reinterpret_cast<const char *>(&key), sizeof(key)};  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+}  // namespace
+
+auto PropertyStoreTier::GetInstance() -> PropertyStoreTier * {
+  static std::unique_ptr<PropertyStoreTier> const instance =
+      FLAGS_storage_property_tier_directory.empty()
+          ? nullptr
+          : std::make_unique<PropertyStoreTier>(FLAGS_storage_property_tier_directory);
+  return instance.get();
+}
+
+PropertyStoreTier::PropertyStoreTier(const std::filesystem::path &directory) {
+  rocksdb::Options options;
+  options.create_if_missing = true;
+  // The buffers are written once and read by key, there is nothing to gain from keeping them ordered by the keys.
+  options.OptimizeForPointLookup(64);
+  std::filesystem::remove_all(directory);
+  rocksdb::DB *db = nullptr;
+  logging::AssertRocksDBStatus(rocksdb::DB::Open(options, directory.string(), &db));
+  db_.reset(db);
+}
+
+PropertyStoreTier::~PropertyStoreTier() = default;
+
+std::optional<uint64_t> PropertyStoreTier::Put(std::span<uint8_t const> buffer) {
+  auto const key = next_key_.fetch_add(1, std::memory_order_relaxed);
+  rocksdb::WriteOptions options;
+  // Nothing is recovered from the tier, see the class comment.
+  options.disableWAL = true;
+  rocksdb::Slice value{reinterpret_cast<const char *>(buffer.data()),  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                       buffer.size_bytes()};
+  auto status = db_->Put(options, KeySlice(key), value);
+  if (!status.ok()) {
+    spdlog::warn("Couldn't move properties to the property tier: {}", status.ToString());
+    return std::nullopt;
+  }
+  return key;
+}
+
+utils::DecompressedBuffer PropertyStoreTier::Get(uint64_t key) const {
+  rocksdb::PinnableSlice value;
+  auto status = db_->Get(rocksdb::ReadOptions{}, db_->DefaultColumnFamily(), KeySlice(key), &value);
+  if (!status.ok()) [[unlikely]] {
+    throw PropertyValueException("Failed to read properties from the property tier: {}", status.ToString());
+  }
+  auto size = static_cast<uint32_t>(value.size());
+  auto data = std::make_unique_for_overwrite<uint8_t[]>(size);
+  memcpy(data.get(), value.data(), size);
+  return {std::move(data), size};
+}
+
+void PropertyStoreTier::Delete(uint64_t key) {
+  rocksdb::WriteOptions options;
+  options.disableWAL = true;
+  if (auto status = db_->Delete(options, KeySlice(key)); !status.ok()) {
+    spdlog::warn("Couldn't delete properties from the property tier: {}", status.ToString());
+  }
+}
+
+}  // namespace memgraph::storage
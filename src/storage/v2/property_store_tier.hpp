@@ -0,0 +1,74 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <span>
+
+#include <gflags/gflags.h>
+
+#include "utils/compressor.hpp"
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_string(storage_property_tier_directory);
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_uint64(storage_property_tier_interval_sec);
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_uint64(storage_property_tier_min_size);
+
+namespace rocksdb {
+class DB;
+}  // namespace rocksdb
+
+namespace memgraph::storage {
+
+/// Cold tier of the property stores of in-memory vertices. The buffers of the
+/// vertices whose properties aren't read between two tiering passes are moved
+/// to a RocksDB instance and the `PropertyStore` only keeps their key, see
+/// `PropertyStore::Evict`.
+///
+/// The tier holds no durable state: the in-memory storage recovers from its
+/// snapshots and WALs, so the directory is cleared when the tier is opened.
+class PropertyStoreTier {
+ public:
+  /// Returns nullptr if no directory is set with
+  /// --storage-property-tier-directory.
+  static auto GetInstance() -> PropertyStoreTier *;
+
+  explicit PropertyStoreTier(const std::filesystem::path &directory);
+
+  PropertyStoreTier(const PropertyStoreTier &) = delete;
+  PropertyStoreTier &operator=(const PropertyStoreTier &) = delete;
+  PropertyStoreTier(PropertyStoreTier &&) = delete;
+  PropertyStoreTier &operator=(PropertyStoreTier &&) = delete;
+
+  ~PropertyStoreTier();
+
+  /// Returns the key of the stored buffer, or nullopt if it couldn't be
+  /// written.
+  std::optional<uint64_t> Put(std::span<uint8_t const> buffer);
+
+  /// @throw PropertyValueException if the buffer can't be read
+  utils::DecompressedBuffer Get(uint64_t key) const;
+
+  void Delete(uint64_t key);
+
+ private:
+  std::unique_ptr<rocksdb::DB> db_;
+  std::atomic<uint64_t> next_key_{0};
+};
+
+}  // namespace memgraph::storage
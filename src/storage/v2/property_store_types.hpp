@@ -31,5 +31,6 @@ enum class PropertyStoreType : uint8_t {
   OFFSET_ZONED_TEMPORAL_DATA = 0xA0,
   ENUM = 0xB0,
   POINT = 0xC0,
+  INTERNED_STRING = 0xD0,  // STRING whose bytes are kept by the StringInterner.
 };
 }  // namespace memgraph::storage
@@ -18,6 +18,7 @@
 #include "storage/v2/storage.hpp"
 #include "utils/exceptions.hpp"
 #include "utils/on_scope_exit.hpp"
+#include "utils/tracing.hpp"
 #include "utils/uuid.hpp"
 #include "utils/variant_helpers.hpp"
 
@@ -242,7 +243,14 @@ auto ReplicationStorageClient::StartTransactionReplication(const uint64_t curren
 }
 
 bool ReplicationStorageClient::FinalizeTransactionReplication(Storage *storage, DatabaseAccessProtector db_acc,
-                                                              std::optional<ReplicaStream> &&replica_stream) {
+                                                              std::optional<ReplicaStream> &&replica_stream,
+                                                              std::function<void(bool)> on_finalized) {
+  utils::tracing::ScopedSpan const span("replication.finalize");
+  auto const finalized = [&on_finalized](bool result) {
+    if (on_finalized) on_finalized(result);
+    return result;
+  };
+
   // We can only check the state because it guarantees to be only
   // valid during a single transaction replication (if the assumption
   // that this and other transaction replication functions can only be
@@ -251,7 +259,7 @@ bool ReplicationStorageClient::FinalizeTransactionReplication(Storage *storage,
                 StateToString(*replica_state_.Lock()));
   if (State() != replication::ReplicaState::REPLICATING) {
     spdlog::trace("Skipping finalizing transaction on replica {} because it's not replicating", client_.name_);
-    return false;
+    return finalized(false);
   }
 
   if (!replica_stream || replica_stream->IsDefunct()) {
@@ -260,7 +268,7 @@ bool ReplicationStorageClient::FinalizeTransactionReplication(Storage *storage,
       state = replication::ReplicaState::MAYBE_BEHIND;
     });
     LogRpcFailure();
-    return false;
+    return finalized(false);
   }
 
   auto task = [storage, db_acc = std::move(db_acc), this,
@@ -302,6 +310,16 @@ bool ReplicationStorageClient::FinalizeTransactionReplication(Storage *storage,
     return true;
   }
 
+  if (on_finalized) {
+    // The caller waits for the responses of several SYNC replicas at once
+    auto finalize = [task = std::move(task), on_finalized = std::move(on_finalized)]() mutable {
+      on_finalized(task());
+    };
+    client_.thread_pool_.AddTask(
+        [finalize = utils::CopyMovableFunctionWrapper{std::move(finalize)}]() mutable { finalize(); });
+    return false;
+  }
+
   // If we are in SYNC mode, we return the result of task().
   // If replica is in RECOVERY or stream wasn't correctly finalized, we return false
   // If replica is READY, we return true
@@ -435,6 +453,8 @@ void ReplicaStream::AppendTransactionEnd(uint64_t final_commit_timestamp) {
   EncodeTransactionEnd(&encoder, final_commit_timestamp);
 }
 
+void ReplicaStream::FinalizeRequest() { stream_.FinalizeRequest(); }
+
 replication::AppendDeltasRes ReplicaStream::Finalize() { return stream_.AwaitResponse(); }
 
 }  // namespace memgraph::storage
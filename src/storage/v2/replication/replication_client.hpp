@@ -71,6 +71,11 @@ class ReplicaStream {
   void AppendOperation(durability::StorageMetadataOperation operation, EdgeTypeId edge_type,
                        const std::set<PropertyId> &properties, uint64_t timestamp);
 
+  /// Sends the rest of the transaction without awaiting the response of the
+  /// replica, which `Finalize` awaits.
+  /// @throw rpc::RpcFailedException
+  void FinalizeRequest();
+
   /// @throw rpc::RpcFailedException
   replication::AppendDeltasRes Finalize();
 
@@ -194,11 +199,15 @@ class ReplicationStorageClient {
    * @param storage pointer to the storage associated with the client
    * @param gk gatekeeper access that protects the database; std::any to have separation between dbms and storage
    * @param replica_stream replica stream to finalize the transaction on
+   * @param on_finalized if set, the response of a SYNC replica is awaited on the thread pool of the client, as the
+   *                     one of an ASYNC replica, and @p on_finalized is called once with whether the transaction was
+   *                     finalized; the returned value is then meaningless
    * @return true
    * @return false
    */
   [[nodiscard]] bool FinalizeTransactionReplication(Storage *storage, DatabaseAccessProtector db_acc,
-                                                    std::optional<ReplicaStream> &&replica_stream);
+                                                    std::optional<ReplicaStream> &&replica_stream,
+                                                    std::function<void(bool)> on_finalized = {});
 
   /**
    * @brief Asynchronously try to check the replica state and start a recovery thread if necessary
@@ -11,37 +11,54 @@
 
 #include "storage/v2/replication/replication_storage_state.hpp"
 
+#include "flags/replication.hpp"
 #include "replication/replication_server.hpp"
 #include "storage/v2/replication/replication_client.hpp"
 
-#include <span>
+#include <algorithm>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 
 #include <range/v3/view.hpp>
 
 namespace memgraph::storage {
 
 auto ReplicationStorageState::InitializeTransaction(uint64_t seq_num, Storage *storage, DatabaseAccessProtector db_acc)
-    -> std::vector<std::optional<ReplicaStream>> {
-  std::vector<std::optional<ReplicaStream>> replica_streams;
-  replication_clients_.WithLock([&, db_accessor = std::move(db_acc)](auto &clients) mutable {
-    replica_streams.reserve(clients.size());
-    for (auto &client : clients) {
-      replica_streams.emplace_back(client->StartTransactionReplication(seq_num, storage, db_accessor));
-    }
-  });
+    -> ReplicaStreams {
+  ReplicaStreams replica_streams;
+  replica_streams.clients = replication_clients_.WithReadLock([](auto const &clients) { return clients; });
+  replica_streams.streams.reserve(replica_streams.clients.size());
+  for (auto const &client : replica_streams.clients) {
+    replica_streams.streams.emplace_back(client->StartTransactionReplication(seq_num, storage, db_acc));
+  }
   return replica_streams;
 }
 
 bool ReplicationStorageState::FinalizeTransaction(uint64_t timestamp, Storage *storage, DatabaseAccessProtector db_acc,
-                                                  std::vector<std::optional<ReplicaStream>> replica_streams) {
-  return replication_clients_.WithLock([=, db_acc = std::move(db_acc),
-                                        replica_streams = std::move(replica_streams)](auto &clients) mutable {
+                                                  ReplicaStreams replica_streams) {
+  auto const &clients = replica_streams.clients;
+  MG_ASSERT(clients.empty() || db_acc.has_value(),
+            "Any clients assumes we are MAIN, we should have gatekeeper_access_wrapper so we can correctly "
+            "handle ASYNC tasks");
+  // The replicas apply the transaction while the responses of the others are awaited
+  for (auto &&[i, replica_stream] : ranges::views::enumerate(replica_streams.streams)) {
+    clients[i]->IfStreamingTransaction(
+        [&](auto &stream) {
+          stream.AppendTransactionEnd(timestamp);
+          stream.FinalizeRequest();
+        },
+        replica_stream);
+  }
+
+  const auto sync_replicas =
+      static_cast<uint64_t>(std::count_if(clients.begin(), clients.end(), [](const auto &client) {
+        return client->Mode() == replication_coordination_glue::ReplicationMode::SYNC;
+      }));
+  const auto quorum = FLAGS_replication_sync_quorum;
+  if (quorum == 0 || quorum >= sync_replicas) {
     bool finalized_on_all_replicas = true;
-    MG_ASSERT(clients.empty() || db_acc.has_value(),
-              "Any clients assumes we are MAIN, we should have gatekeeper_access_wrapper so we can correctly "
-              "handle ASYNC tasks");
-    for (auto &&[i, replica_stream] : ranges::views::enumerate(replica_streams)) {
-      clients[i]->IfStreamingTransaction([&](auto &stream) { stream.AppendTransactionEnd(timestamp); }, replica_stream);
+    for (auto &&[i, replica_stream] : ranges::views::enumerate(replica_streams.streams)) {
       const auto finalized = clients[i]->FinalizeTransactionReplication(storage, db_acc, std::move(replica_stream));
 
       if (clients[i]->Mode() == replication_coordination_glue::ReplicationMode::SYNC) {
@@ -49,7 +66,37 @@ bool ReplicationStorageState::FinalizeTransaction(uint64_t timestamp, Storage *s
       }
     }
     return finalized_on_all_replicas;
+  }
+
+  // The commit is acknowledged once the quorum of SYNC replicas confirmed it, or can't confirm it anymore. The
+  // responses of the other replicas are awaited on their threads after that.
+  struct Confirmations {
+    std::mutex mutex;
+    std::condition_variable cv;
+    uint64_t confirmed{0};
+    uint64_t failed{0};
+  };
+  auto confirmations = std::make_shared<Confirmations>();
+  for (auto &&[i, replica_stream] : ranges::views::enumerate(replica_streams.streams)) {
+    if (clients[i]->Mode() != replication_coordination_glue::ReplicationMode::SYNC) {
+      (void)clients[i]->FinalizeTransactionReplication(storage, db_acc, std::move(replica_stream));
+      continue;
+    }
+    (void)clients[i]->FinalizeTransactionReplication(storage, db_acc, std::move(replica_stream),
+                                                     [confirmations](bool finalized) {
+                                                       {
+                                                         auto guard = std::lock_guard{confirmations->mutex};
+                                                         ++(finalized ? confirmations->confirmed
+                                                                      : confirmations->failed);
+                                                       }
+                                                       confirmations->cv.notify_one();
+                                                     });
+  }
+  auto guard = std::unique_lock{confirmations->mutex};
+  confirmations->cv.wait(guard, [&] {
+    return confirmations->confirmed >= quorum || confirmations->failed > sync_replicas - quorum;
   });
+  return confirmations->confirmed >= quorum;
 }
 
 std::optional<replication::ReplicaState> ReplicationStorageState::GetReplicaState(std::string_view name) const {
@@ -87,10 +134,19 @@ void ReplicationStorageState::TrackLatestHistory() {
     history.pop_front();
   }
   history.emplace_back(epoch_.id(), last_durable_timestamp_);
+  PublishEpoch();
 }
 
 void ReplicationStorageState::AddEpochToHistoryForce(std::string prev_epoch) {
   history.emplace_back(std::move(prev_epoch), last_durable_timestamp_);
+  PublishEpoch();
+}
+
+void ReplicationStorageState::PublishEpoch() {
+  auto snapshot = std::make_shared<const EpochSnapshot>(
+      EpochSnapshot{.epoch = std::string{epoch_.id()}, .history = {history.begin(), history.end()}});
+  *published_epoch_.Lock() = std::move(snapshot);
+  NotifyApplied();
 }
 
 }  // namespace memgraph::storage
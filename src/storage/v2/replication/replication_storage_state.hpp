@@ -12,7 +12,13 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "kvstore/kvstore.hpp"
 #include "storage/v2/delta.hpp"
@@ -33,7 +39,6 @@
 #include "utils/synchronized.hpp"
 
 #include <range/v3/view.hpp>
-#include <span>
 
 namespace memgraph::storage {
 
@@ -43,35 +48,59 @@ class ReplicationStorageClient;
 class ReplicaStream;
 
 struct ReplicationStorageState {
+  // The clients are shared so that a commit can keep replicating to a client while it is removed from the list, see
+  // `ReplicaStreams`.
+  using ReplicationClientPtr = std::shared_ptr<ReplicationStorageClient>;
+  using ReplicationClientList = utils::Synchronized<std::vector<ReplicationClientPtr>, utils::RWSpinLock>;
+
+  // The clients a transaction is replicated to, copied from `replication_clients_` when the transaction starts,
+  // together with their streams. The deltas are encoded and sent to the replicas without holding the lock of the
+  // client list, which is only held while copying it, so registering or listing the replicas doesn't wait on the
+  // network.
+  struct ReplicaStreams {
+    std::vector<ReplicationClientPtr> clients;
+    std::vector<std::optional<ReplicaStream>> streams;
+
+    bool empty() const { return clients.empty(); }
+  };
+
   // Only MAIN can send
-  auto InitializeTransaction(uint64_t seq_num, Storage *storage, DatabaseAccessProtector db_acc)
-      -> std::vector<std::optional<ReplicaStream>>;
+  auto InitializeTransaction(uint64_t seq_num, Storage *storage, DatabaseAccessProtector db_acc) -> ReplicaStreams;
 
   template <typename... Args>
-  void AppendDelta(std::span<std::optional<ReplicaStream>> replica_streams, Args &&...args) {
-    replication_clients_.WithLock([&](auto &clients) {
-      for (auto &&[client, replica_stream] : ranges::views::zip(clients, replica_streams)) {
-        client->IfStreamingTransaction([&](auto &stream) { stream.AppendDelta(args...); }, replica_stream);
-      }
-    });
+  void AppendDelta(ReplicaStreams &replica_streams, Args &&...args) {
+    for (auto &&[client, replica_stream] : ranges::views::zip(replica_streams.clients, replica_streams.streams)) {
+      client->IfStreamingTransaction([&](auto &stream) { stream.AppendDelta(args...); }, replica_stream);
+    }
   }
 
+  // Calls `func` with a callback which appends a delta to the replica streams, like `AppendDelta`, or does nothing
+  // without replica streams.
   template <typename Func>
-  void EncodeToReplicas(std::span<std::optional<ReplicaStream>> replica_streams, Func &&func) {
-    replication_clients_.WithLock([&](auto &clients) {
-      for (auto &&[client, replica_stream] : ranges::views::zip(clients, replica_streams)) {
-        client->IfStreamingTransaction(
-            [&](auto &stream) {
-              auto encoder = stream.encoder();
-              func(encoder);
-            },
-            replica_stream);
-      }
-    });
+  void WithDeltaAppender(ReplicaStreams &replica_streams, Func &&func) {
+    if (replica_streams.empty()) {
+      func([](auto const &...) {});
+      return;
+    }
+    func([&](auto const &...args) { AppendDelta(replica_streams, args...); });
   }
 
+  template <typename Func>
+  void EncodeToReplicas(ReplicaStreams &replica_streams, Func &&func) {
+    for (auto &&[client, replica_stream] : ranges::views::zip(replica_streams.clients, replica_streams.streams)) {
+      client->IfStreamingTransaction(
+          [&](auto &stream) {
+            auto encoder = stream.encoder();
+            func(encoder);
+          },
+          replica_stream);
+    }
+  }
+
+  // Sends the end of the transaction to all replicas before awaiting any of them, so the SYNC replicas confirm it
+  // concurrently. Returns whether the SYNC replicas confirmed it, `--replication-sync-quorum` of them if set.
   bool FinalizeTransaction(uint64_t timestamp, Storage *storage, DatabaseAccessProtector db_acc,
-                           std::vector<std::optional<ReplicaStream>> replica_stream);
+                           ReplicaStreams replica_streams);
 
   // Getters
   auto GetReplicaState(std::string_view name) const -> std::optional<replication::ReplicaState>;
@@ -81,6 +110,36 @@ struct ReplicationStorageState {
   void TrackLatestHistory();
   void AddEpochToHistoryForce(std::string prev_epoch);
 
+  // Epoch and history as of the last PublishEpoch, for the readers outside of the replication threads, e.g. the
+  // bookmark checks of the queries. `epoch_` and `history` are changed without synchronization, so their writers
+  // publish a copy after each change.
+  struct EpochSnapshot {
+    std::string epoch;
+    std::vector<std::pair<std::string, uint64_t>> history;
+  };
+  void PublishEpoch();
+  auto PublishedEpoch() const -> std::shared_ptr<const EpochSnapshot> { return *published_epoch_.Lock(); }
+
+  // Progress of the commits applied from the MAIN, which the bookmark checks wait on instead of polling. Take the
+  // progress before checking `last_durable_timestamp_` and the published epoch, then wait for it to move on.
+  // NotifyApplied is called after their writes on the replica.
+  auto AppliedProgress() const -> uint64_t {
+    auto guard = std::lock_guard{applied_mutex_};
+    return applied_progress_;
+  }
+  void NotifyApplied() {
+    {
+      auto guard = std::lock_guard{applied_mutex_};
+      ++applied_progress_;
+    }
+    applied_cv_.notify_all();
+  }
+  // Returns false if `deadline` passed before the progress moved on from `seen`.
+  bool WaitForApplied(uint64_t seen, std::chrono::steady_clock::time_point deadline) const {
+    auto guard = std::unique_lock{applied_mutex_};
+    return applied_cv_.wait_until(guard, deadline, [&] { return applied_progress_ != seen; });
+  }
+
   void Reset();
 
   template <typename F>
@@ -105,22 +164,27 @@ struct ReplicationStorageState {
   std::deque<std::pair<std::string, uint64_t>> history;
   std::atomic<uint64_t> last_durable_timestamp_{kTimestampInitialId};
 
-  // We create ReplicationClient using unique_ptr so we can move
+  // We create ReplicationClient using a pointer so we can move
   // newly created client into the vector.
   // We cannot move the client directly because it contains ThreadPool
   // which cannot be moved. Also, the move is necessary because
   // we don't want to create the client directly inside the vector
   // because that would require the lock on the list putting all
-  // commits (they iterate list of clients) to halt.
+  // commits (they copy the list of clients) to halt.
   // This way we can initialize client in main thread which means
   // that we can immediately notify the user if the initialization
   // failed.
-  using ReplicationClientPtr = std::unique_ptr<ReplicationStorageClient>;
-  using ReplicationClientList = utils::Synchronized<std::vector<ReplicationClientPtr>, utils::RWSpinLock>;
-
   ReplicationClientList replication_clients_;
 
   memgraph::replication::ReplicationEpoch epoch_;
+
+ private:
+  mutable std::mutex applied_mutex_;
+  mutable std::condition_variable applied_cv_;
+  uint64_t applied_progress_{0};
+
+  mutable utils::Synchronized<std::shared_ptr<const EpochSnapshot>, utils::SpinLock> published_epoch_{
+      std::make_shared<const EpochSnapshot>(EpochSnapshot{.epoch = std::string{epoch_.id()}, .history = {}})};
 };
 
 }  // namespace memgraph::storage
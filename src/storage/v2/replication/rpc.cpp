@@ -39,6 +39,18 @@ void SnapshotReq::Save(const SnapshotReq &self, memgraph::slk::Builder *builder)
 void SnapshotReq::Load(SnapshotReq *self, memgraph::slk::Reader *reader) { memgraph::slk::Load(self, reader); }
 void SnapshotRes::Save(const SnapshotRes &self, memgraph::slk::Builder *builder) { memgraph::slk::Save(self, builder); }
 void SnapshotRes::Load(SnapshotRes *self, memgraph::slk::Reader *reader) { memgraph::slk::Load(self, reader); }
+void SnapshotBlockHashesReq::Save(const SnapshotBlockHashesReq &self, memgraph::slk::Builder *builder) {
+  memgraph::slk::Save(self, builder);
+}
+void SnapshotBlockHashesReq::Load(SnapshotBlockHashesReq *self, memgraph::slk::Reader *reader) {
+  memgraph::slk::Load(self, reader);
+}
+void SnapshotBlockHashesRes::Save(const SnapshotBlockHashesRes &self, memgraph::slk::Builder *builder) {
+  memgraph::slk::Save(self, builder);
+}
+void SnapshotBlockHashesRes::Load(SnapshotBlockHashesRes *self, memgraph::slk::Reader *reader) {
+  memgraph::slk::Load(self, reader);
+}
 void WalFilesReq::Save(const WalFilesReq &self, memgraph::slk::Builder *builder) { memgraph::slk::Save(self, builder); }
 void WalFilesReq::Load(WalFilesReq *self, memgraph::slk::Reader *reader) { memgraph::slk::Load(self, reader); }
 void WalFilesRes::Save(const WalFilesRes &self, memgraph::slk::Builder *builder) { memgraph::slk::Save(self, builder); }
@@ -93,6 +105,12 @@ constexpr utils::TypeInfo storage::replication::SnapshotReq::kType{utils::TypeId
 constexpr utils::TypeInfo storage::replication::SnapshotRes::kType{utils::TypeId::REP_SNAPSHOT_RES, "SnapshotRes",
                                                                    nullptr};
 
+constexpr utils::TypeInfo storage::replication::SnapshotBlockHashesReq::kType{
+    utils::TypeId::REP_SNAPSHOT_BLOCK_HASHES_REQ, "SnapshotBlockHashesReq", nullptr};
+
+constexpr utils::TypeInfo storage::replication::SnapshotBlockHashesRes::kType{
+    utils::TypeId::REP_SNAPSHOT_BLOCK_HASHES_RES, "SnapshotBlockHashesRes", nullptr};
+
 constexpr utils::TypeInfo storage::replication::WalFilesReq::kType{utils::TypeId::REP_WALFILES_REQ, "WalFilesReq",
                                                                    nullptr};
 
@@ -210,11 +228,39 @@ void Load(memgraph::storage::replication::SnapshotRes *self, memgraph::slk::Read
 void Save(const memgraph::storage::replication::SnapshotReq &self, memgraph::slk::Builder *builder) {
   memgraph::slk::Save(self.main_uuid, builder);
   memgraph::slk::Save(self.uuid, builder);
+  memgraph::slk::Save(self.base_snapshot, builder);
 }
 
 void Load(memgraph::storage::replication::SnapshotReq *self, memgraph::slk::Reader *reader) {
   memgraph::slk::Load(&self->main_uuid, reader);
   memgraph::slk::Load(&self->uuid, reader);
+  memgraph::slk::Load(&self->base_snapshot, reader);
+}
+
+// Serialize code for SnapshotBlockHashesRes
+
+void Save(const memgraph::storage::replication::SnapshotBlockHashesRes &self, memgraph::slk::Builder *builder) {
+  memgraph::slk::Save(self.success, builder);
+  memgraph::slk::Save(self.snapshot, builder);
+  memgraph::slk::Save(self.block_hashes, builder);
+}
+
+void Load(memgraph::storage::replication::SnapshotBlockHashesRes *self, memgraph::slk::Reader *reader) {
+  memgraph::slk::Load(&self->success, reader);
+  memgraph::slk::Load(&self->snapshot, reader);
+  memgraph::slk::Load(&self->block_hashes, reader);
+}
+
+// Serialize code for SnapshotBlockHashesReq
+
+void Save(const memgraph::storage::replication::SnapshotBlockHashesReq &self, memgraph::slk::Builder *builder) {
+  memgraph::slk::Save(self.main_uuid, builder);
+  memgraph::slk::Save(self.uuid, builder);
+}
+
+void Load(memgraph::storage::replication::SnapshotBlockHashesReq *self, memgraph::slk::Reader *reader) {
+  memgraph::slk::Load(&self->main_uuid, reader);
+  memgraph::slk::Load(&self->uuid, reader);
 }
 
 // Serialize code for HeartbeatRes
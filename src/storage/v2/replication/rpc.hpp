@@ -15,6 +15,7 @@
 #include <cstring>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "rpc/messages.hpp"
 #include "slk/serialization.hpp"
@@ -99,10 +100,14 @@ struct SnapshotReq {
   static void Load(SnapshotReq *self, memgraph::slk::Reader *reader);
   static void Save(const SnapshotReq &self, memgraph::slk::Builder *builder);
   SnapshotReq() = default;
-  explicit SnapshotReq(const utils::UUID &main_uuid, const utils::UUID &uuid) : main_uuid{main_uuid}, uuid{uuid} {}
+  explicit SnapshotReq(const utils::UUID &main_uuid, const utils::UUID &uuid, std::string base_snapshot = {})
+      : main_uuid{main_uuid}, uuid{uuid}, base_snapshot{std::move(base_snapshot)} {}
 
   utils::UUID main_uuid;
   utils::UUID uuid;
+  // Filename of the snapshot of the replica whose blocks the sent snapshot
+  // reuses, the whole snapshot is sent if it is empty.
+  std::string base_snapshot;
 };
 
 struct SnapshotRes {
@@ -121,6 +126,39 @@ struct SnapshotRes {
 
 using SnapshotRpc = rpc::RequestResponse<SnapshotReq, SnapshotRes>;
 
+struct SnapshotBlockHashesReq {
+  static const utils::TypeInfo kType;
+  static const utils::TypeInfo &GetTypeInfo() { return kType; }
+
+  static void Load(SnapshotBlockHashesReq *self, memgraph::slk::Reader *reader);
+  static void Save(const SnapshotBlockHashesReq &self, memgraph::slk::Builder *builder);
+  SnapshotBlockHashesReq() = default;
+  explicit SnapshotBlockHashesReq(const utils::UUID &main_uuid, const utils::UUID &uuid)
+      : main_uuid{main_uuid}, uuid{uuid} {}
+
+  utils::UUID main_uuid;
+  utils::UUID uuid;
+};
+
+struct SnapshotBlockHashesRes {
+  static const utils::TypeInfo kType;
+  static const utils::TypeInfo &GetTypeInfo() { return kType; }
+
+  static void Load(SnapshotBlockHashesRes *self, memgraph::slk::Reader *reader);
+  static void Save(const SnapshotBlockHashesRes &self, memgraph::slk::Builder *builder);
+  SnapshotBlockHashesRes() = default;
+  SnapshotBlockHashesRes(bool success, std::string snapshot, std::vector<std::string> block_hashes)
+      : success(success), snapshot(std::move(snapshot)), block_hashes(std::move(block_hashes)) {}
+
+  bool success;
+  // Filename of the newest snapshot of the replica, empty if it has none.
+  std::string snapshot;
+  // SHA-256 digests of the `kFileBlockSize` blocks of the snapshot.
+  std::vector<std::string> block_hashes;
+};
+
+using SnapshotBlockHashesRpc = rpc::RequestResponse<SnapshotBlockHashesReq, SnapshotBlockHashesRes>;
+
 struct WalFilesReq {
   static const utils::TypeInfo kType;
   static const utils::TypeInfo &GetTypeInfo() { return kType; }
@@ -269,6 +307,14 @@ void Save(const memgraph::storage::replication::WalFilesReq &self, memgraph::slk
 
 void Load(memgraph::storage::replication::WalFilesReq *self, memgraph::slk::Reader *reader);
 
+void Save(const memgraph::storage::replication::SnapshotBlockHashesRes &self, memgraph::slk::Builder *builder);
+
+void Load(memgraph::storage::replication::SnapshotBlockHashesRes *self, memgraph::slk::Reader *reader);
+
+void Save(const memgraph::storage::replication::SnapshotBlockHashesReq &self, memgraph::slk::Builder *builder);
+
+void Load(memgraph::storage::replication::SnapshotBlockHashesReq *self, memgraph::slk::Reader *reader);
+
 void Save(const memgraph::storage::replication::SnapshotRes &self, memgraph::slk::Builder *builder);
 
 void Load(memgraph::storage::replication::SnapshotRes *self, memgraph::slk::Reader *reader);
@@ -11,7 +11,61 @@
 
 #include "storage/v2/replication/serialization.hpp"
 
+#include <openssl/evp.h>
+#include <unordered_map>
+
 namespace memgraph::storage::replication {
+
+namespace {
+std::string Digest(const uint8_t *data, uint64_t size) {
+  std::string digest(kFileDigestSize, '\0');
+  MG_ASSERT(EVP_Digest(data, size, reinterpret_cast<unsigned char *>(digest.data()), nullptr, EVP_sha256(), nullptr),
+            "Failed to hash a file block");
+  return digest;
+}
+
+// Digest of the whole file, built from its blocks.
+class FileDigest {
+ public:
+  FileDigest() : ctx_(EVP_MD_CTX_new()) {
+    MG_ASSERT(ctx_ && EVP_DigestInit_ex(ctx_, EVP_sha256(), nullptr), "Failed to initialize a file digest");
+  }
+  ~FileDigest() { EVP_MD_CTX_free(ctx_); }
+  FileDigest(const FileDigest &) = delete;
+  FileDigest(FileDigest &&) = delete;
+  FileDigest &operator=(const FileDigest &) = delete;
+  FileDigest &operator=(FileDigest &&) = delete;
+
+  void Update(const uint8_t *data, uint64_t size) {
+    MG_ASSERT(EVP_DigestUpdate(ctx_, data, size), "Failed to update a file digest");
+  }
+
+  std::string Finalize() {
+    std::string digest(kFileDigestSize, '\0');
+    MG_ASSERT(EVP_DigestFinal_ex(ctx_, reinterpret_cast<unsigned char *>(digest.data()), nullptr),
+              "Failed to finalize a file digest");
+    return digest;
+  }
+
+ private:
+  EVP_MD_CTX *ctx_;
+};
+}  // namespace
+
+std::vector<std::string> HashFileBlocks(const std::filesystem::path &path) {
+  utils::InputFile file;
+  if (!file.Open(path)) return {};
+  std::vector<std::string> hashes;
+  std::vector<uint8_t> block(kFileBlockSize);
+  for (auto file_size = file.GetSize(); file_size > 0;) {
+    const auto block_size = std::min(file_size, kFileBlockSize);
+    if (!file.Read(block.data(), block_size)) return {};
+    hashes.push_back(Digest(block.data(), block_size));
+    file_size -= block_size;
+  }
+  return hashes;
+}
+
 ////// Encoder //////
 void Encoder::WriteMarker(durability::Marker marker) { slk::Save(marker, builder_); }
 
@@ -80,6 +134,44 @@ void Encoder::WriteFile(const std::filesystem::path &path) {
   file.Close();
 }
 
+uint64_t Encoder::WriteFileDiff(const std::filesystem::path &path,
+                                const std::vector<std::string> &base_block_hashes) {
+  std::unordered_map<std::string_view, uint64_t> base_blocks;
+  for (uint64_t i = 0; i < base_block_hashes.size(); ++i) {
+    base_blocks.emplace(base_block_hashes[i], i);
+  }
+
+  utils::InputFile file;
+  MG_ASSERT(file.Open(path), "Failed to open file {}", path);
+  MG_ASSERT(path.has_filename(), "Path does not have a filename!");
+  WriteString(path.filename().generic_string());
+  auto file_size = file.GetSize();
+  WriteUint(file_size);
+
+  // Each block starts with the index of the equal base block plus one, or
+  // with 0 followed by the data of the block. The digest of the whole file
+  // comes last.
+  FileDigest digest;
+  uint64_t reused = 0;
+  std::vector<uint8_t> block(kFileBlockSize);
+  while (file_size > 0) {
+    const auto block_size = std::min(file_size, kFileBlockSize);
+    MG_ASSERT(file.Read(block.data(), block_size), "Failed to read file {}", path);
+    digest.Update(block.data(), block_size);
+    if (auto it = base_blocks.find(Digest(block.data(), block_size)); it != base_blocks.end()) {
+      WriteUint(it->second + 1);
+      reused += block_size;
+    } else {
+      WriteUint(0);
+      WriteBuffer(block.data(), block_size);
+    }
+    file_size -= block_size;
+  }
+  file.Close();
+  WriteString(digest.Finalize());
+  return reused;
+}
+
 ////// Decoder //////
 std::optional<durability::Marker> Decoder::ReadMarker() {
   durability::Marker marker;
@@ -172,14 +264,78 @@ std::optional<std::filesystem::path> Decoder::ReadFile(const std::filesystem::pa
   std::optional<size_t> maybe_file_size = ReadUint();
   MG_ASSERT(maybe_file_size, "File size missing");
   auto file_size = *maybe_file_size;
-  uint8_t buffer[utils::kFileBufferSize];
+  // The file is written straight from the received segments.
   while (file_size > 0) {
-    const auto chunk_size = std::min(file_size, utils::kFileBufferSize);
-    reader_->Load(buffer, chunk_size);
-    file.Write(buffer, chunk_size);
-    file_size -= chunk_size;
+    const auto chunk = reader_->LoadSpan(file_size);
+    file.Write(chunk.data(), chunk.size());
+    file_size -= chunk.size();
+  }
+  file.Close();
+  return std::move(path);
+}
+
+std::optional<std::filesystem::path> Decoder::ReadFileDiff(const std::filesystem::path &directory,
+                                                           const std::filesystem::path &base) {
+  MG_ASSERT(std::filesystem::exists(directory) && std::filesystem::is_directory(directory),
+            "Sent path for streamed files should be a valid directory!");
+  const auto maybe_filename = ReadString();
+  MG_ASSERT(maybe_filename, "Filename missing for the file");
+  std::optional<size_t> maybe_file_size = ReadUint();
+  MG_ASSERT(maybe_file_size, "File size missing");
+  auto file_size = *maybe_file_size;
+
+  utils::InputFile base_file;
+  if (!base_file.Open(base)) {
+    spdlog::error("Failed to open the base file {} of the received file", base);
+    return std::nullopt;
+  }
+  const auto base_size = base_file.GetSize();
+
+  // The base may be the received file, so the file is renamed once it is complete.
+  auto path = directory / *maybe_filename;
+  auto tmp_path = directory / (*maybe_filename + ".tmp");
+  utils::OutputFile file;
+  file.Open(tmp_path, utils::OutputFile::Mode::OVERWRITE_EXISTING);
+  auto fail = [&]() -> std::optional<std::filesystem::path> {
+    file.Close();
+    std::filesystem::remove(tmp_path);
+    return std::nullopt;
+  };
+
+  FileDigest digest;
+  std::vector<uint8_t> block(kFileBlockSize);
+  while (file_size > 0) {
+    const auto block_size = std::min<uint64_t>(file_size, kFileBlockSize);
+    const auto base_block = ReadUint();
+    if (!base_block) return fail();
+    if (*base_block == 0) {
+      for (auto left = block_size; left > 0;) {
+        const auto chunk = reader_->LoadSpan(left);
+        file.Write(chunk.data(), chunk.size());
+        digest.Update(chunk.data(), chunk.size());
+        left -= chunk.size();
+      }
+    } else {
+      const auto offset = (*base_block - 1) * kFileBlockSize;
+      if (offset + block_size > base_size ||
+          !base_file.SetPosition(utils::InputFile::Position::SET, static_cast<ssize_t>(offset)) ||
+          !base_file.Read(block.data(), block_size)) {
+        spdlog::error("The base file {} of the received file doesn't have block {}", base, *base_block - 1);
+        return fail();
+      }
+      file.Write(block.data(), block_size);
+      digest.Update(block.data(), block_size);
+    }
+    file_size -= block_size;
+  }
+  base_file.Close();
+  // The base could have changed since it was hashed
+  if (const auto sent_digest = ReadString(); !sent_digest || *sent_digest != digest.Finalize()) {
+    spdlog::error("The received file {} doesn't match the sent one, its base file {} changed", path, base);
+    return fail();
   }
   file.Close();
+  std::filesystem::rename(tmp_path, path);
   return std::move(path);
 }
 }  // namespace memgraph::storage::replication
@@ -12,6 +12,8 @@
 #pragma once
 
 #include <filesystem>
+#include <string>
+#include <vector>
 
 #include "slk/streams.hpp"
 #include "storage/v2/durability/serialization.hpp"
@@ -21,6 +23,16 @@
 
 namespace memgraph::storage::replication {
 
+// Size of the blocks by which a sent file is compared with a file the
+// receiver already has.
+constexpr uint64_t kFileBlockSize = 1024UL * 1024UL;
+// Size of the SHA-256 digests of the blocks and of the whole file.
+constexpr uint64_t kFileDigestSize = 32;
+
+/// Returns the SHA-256 digests of the `kFileBlockSize` blocks of the file,
+/// the last block may be shorter. Empty if the file can't be read.
+std::vector<std::string> HashFileBlocks(const std::filesystem::path &path);
+
 class Encoder final : public durability::BaseEncoder {
  public:
   explicit Encoder(slk::Builder *builder) : builder_(builder) {}
@@ -49,6 +61,13 @@ class Encoder final : public durability::BaseEncoder {
 
   void WriteFile(const std::filesystem::path &path);
 
+  /// Writes the file like `WriteFile`, except for the blocks whose hash is
+  /// in @p base_block_hashes. Only the index of the equal block of the base
+  /// file is written for them, the receiver copies them from its base file.
+  /// The digest of the whole file is written last.
+  /// @return the number of bytes which weren't written for that reason
+  uint64_t WriteFileDiff(const std::filesystem::path &path, const std::vector<std::string> &base_block_hashes);
+
  private:
   slk::Builder *builder_;
 };
@@ -85,6 +104,14 @@ class Decoder final : public durability::BaseDecoder {
   /// @return If the read was successful, path to the read file.
   std::optional<std::filesystem::path> ReadFile(const std::filesystem::path &directory, const std::string &suffix = "");
 
+  /// Read the file written by `Encoder::WriteFileDiff` and save it inside the
+  /// specified directory. The blocks which weren't sent are copied from
+  /// @p base, which may be the file that is received. The file is kept only
+  /// if its digest matches the one of the sent file.
+  /// @return If the read was successful, path to the read file.
+  std::optional<std::filesystem::path> ReadFileDiff(const std::filesystem::path &directory,
+                                                    const std::filesystem::path &base);
+
  private:
   slk::Reader *reader_;
 };
@@ -269,6 +269,32 @@ void Tracking::ProcessTransaction(Transaction &transaction, bool properties_on_e
   }
 }
 
+void Tracking::Merge(Tracking &&diff) {
+  auto merge_info = [](TrackingInfo &into, TrackingInfo &&from) {
+    into.n += from.n;
+    for (auto &[key, from_prop] : from.properties) {
+      auto &into_prop = into.properties[key];
+      into_prop.n += from_prop.n;
+      for (const auto &[type, count] : from_prop.types) {
+        into_prop.types[type] += count;
+      }
+    }
+  };
+  auto merge_state = [&merge_info](auto &into, auto &&from) {
+    for (auto &[key, info] : from) {
+      auto [itr, inserted] = into.try_emplace(key);
+      if (inserted) {
+        // New schema entry; take the whole diff
+        itr->second = std::move(info);
+      } else {
+        merge_info(itr->second, std::move(info));
+      }
+    }
+  };
+  merge_state(vertex_state_, std::move(diff.vertex_state_));
+  merge_state(edge_state_, std::move(diff.edge_state_));
+}
+
 void Tracking::CleanUp() {
   // Erase all elements that don't have any vertices associated
   std::erase_if(vertex_state_, [](auto &elem) { return elem.second.n <= 0; });
@@ -691,8 +717,8 @@ std::map<PropertyId, ExtendedPropertyType> TransactionEdgeHandler::GetPrePropert
   std::map<PropertyId, ExtendedPropertyType> properties;
   if (properties_on_edges_) {
     const auto *edge = edge_ref.ptr;
-    auto guard = std::invoke([&]() -> std::optional<std::unique_lock<decltype(edge->lock)>> {
-      if (lock) return std::unique_lock{edge->lock};
+    auto guard = std::invoke([&]() -> std::optional<std::unique_lock<utils::RWSpinLock>> {
+      if (lock) return std::unique_lock{EdgeLock(edge)};
       return std::nullopt;
     });
     properties = edge->properties.ExtendedPropertyTypes();
@@ -233,6 +233,16 @@ struct Tracking {
    */
   void ProcessTransaction(Transaction &transaction, bool properties_on_edges);
 
+  /**
+   * @brief Add the statistics of @p diff, which can also be negative.
+   *
+   * Transactions are processed into an empty Tracking, so only the merge of the (usually small) difference needs to be
+   * done under the schema lock.
+   *
+   * @param diff
+   */
+  void Merge(Tracking &&diff);
+
   /**
    * @brief Clear all schema statistics.
    */
@@ -576,6 +586,8 @@ struct SchemaInfo {
       schema_info_->tracking_.ProcessTransaction(transaction, properties_on_edges);
     }
 
+    void Merge(Tracking &&diff) { schema_info_->tracking_.Merge(std::move(diff)); }
+
    private:
     SchemaInfo *schema_info_;
     std::unique_lock<utils::RWSpinLock> lock_;
@@ -9,9 +9,12 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <algorithm>
+#include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <tuple>
+#include <unordered_map>
 
 #include "spdlog/spdlog.h"
 
@@ -122,6 +125,28 @@ std::vector<EventInfo> Storage::GetMetrics() noexcept {
 
 IsolationLevel Storage::GetIsolationLevel() const noexcept { return isolation_level_; }
 
+void Storage::SetIndexAndConstraintCounts(StorageInfo &info) {
+  std::optional<IndexAndConstraintCounts> counts;
+  if (auto storage_guard = std::shared_lock{main_lock_, std::try_to_lock}; storage_guard.owns_lock()) {
+    counts = IndexAndConstraintCounts{
+        .label_indices = indices_.label_index_->ListIndices().size(),
+        .label_property_indices = indices_.label_property_index_->ListIndices().size(),
+        .text_indices = indices_.text_index_.ListIndices().size(),
+        .existence_constraints = constraints_.existence_constraints_->ListConstraints().size(),
+        .unique_constraints = constraints_.unique_constraints_->ListConstraints().size()};
+  }
+  if (counts) {
+    *index_and_constraint_counts_.Lock() = *counts;
+  } else {
+    counts = *index_and_constraint_counts_.Lock();
+  }
+  info.label_indices = counts->label_indices;
+  info.label_property_indices = counts->label_property_indices;
+  info.text_indices = counts->text_indices;
+  info.existence_constraints = counts->existence_constraints;
+  info.unique_constraints = counts->unique_constraints;
+}
+
 utils::BasicResult<Storage::SetIsolationLevelError> Storage::SetIsolationLevel(IsolationLevel isolation_level) {
   std::unique_lock main_guard{main_lock_};
   isolation_level_ = isolation_level;
@@ -155,6 +180,100 @@ void Storage::Accessor::AdvanceCommand() {
   transaction_.point_index_ctx_.AdvanceCommand(transaction_.point_index_change_collector_);
 }
 
+namespace {
+
+uint64_t CountIterable(VerticesIterable vertices) {
+  uint64_t count = 0;
+  // Every vertex the iterator stops at is still read through an accessor.
+  for (auto it = vertices.begin(); it != vertices.end(); ++it) {
+    ++count;
+  }
+  return count;
+}
+
+}  // namespace
+
+uint64_t Storage::Accessor::CountVertices(LabelId label, View view) { return CountIterable(Vertices(label, view)); }
+
+uint64_t Storage::Accessor::CountVertices(LabelId label, PropertyId property, View view) {
+  return CountIterable(Vertices(label, property, view));
+}
+
+uint64_t Storage::Accessor::CountVertices(LabelId label, PropertyId property,
+                                          const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                          const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) {
+  return CountIterable(Vertices(label, property, lower_bound, upper_bound, view));
+}
+
+std::vector<VerticesIterable> Storage::Accessor::ChunkedVertices(View view, size_t /*num_chunks*/) {
+  std::vector<VerticesIterable> chunks;
+  chunks.emplace_back(Vertices(view));
+  return chunks;
+}
+
+std::vector<VerticesIterable> Storage::Accessor::ChunkedVertices(LabelId label, View view, size_t /*num_chunks*/) {
+  std::vector<VerticesIterable> chunks;
+  chunks.emplace_back(Vertices(label, view));
+  return chunks;
+}
+
+std::shared_ptr<const GraphProjection> Storage::Accessor::GetGraphProjection(std::string_view name,
+                                                                             const GraphProjectionFilter &filter,
+                                                                             View view) {
+  // The changes of the transaction itself aren't seen by the others
+  std::optional<uint64_t> data_version;
+  if (view == View::OLD || transaction_.deltas.empty()) data_version = transaction_.data_version;
+  if (data_version) {
+    if (auto cached = storage_->graph_projections_.Find(name, filter, *data_version)) return cached;
+  }
+
+  auto projection = std::make_shared<GraphProjection>();
+  projection->filter = filter;
+  projection->data_version = data_version.value_or(0);
+  auto has_filtered_label = [&filter, view](const VertexAccessor &vertex) {
+    if (filter.labels.empty()) return true;
+    return std::ranges::any_of(filter.labels, [&vertex, view](LabelId label) {
+      auto has_label = vertex.HasLabel(label, view);
+      return has_label.HasValue() && *has_label;
+    });
+  };
+
+  std::vector<Gid> target_gids;
+  projection->offsets.push_back(0);
+  for (auto vertex : Vertices(view)) {
+    if (!has_filtered_label(vertex)) continue;
+    projection->vertices.push_back(vertex.Gid());
+    for (auto property : filter.properties) {
+      auto value = vertex.GetProperty(property, view);
+      projection->property_values.push_back(value.HasValue() ? std::move(*value) : PropertyValue());
+    }
+    if (auto edges = vertex.OutEdges(view, filter.edge_types); edges.HasValue()) {
+      for (const auto &edge : edges->edges) target_gids.push_back(edge.ToVertex().Gid());
+    }
+    projection->offsets.push_back(target_gids.size());
+  }
+
+  std::unordered_map<Gid, size_t> index_of_gid;
+  index_of_gid.reserve(projection->vertices.size());
+  for (size_t i = 0; i < projection->vertices.size(); ++i) index_of_gid.emplace(projection->vertices[i], i);
+
+  // Edges to vertices without the filtered labels are left out
+  auto &offsets = projection->offsets;
+  projection->targets.reserve(target_gids.size());
+  size_t next_edge = 0;
+  for (size_t i = 0; i + 1 < offsets.size(); ++i) {
+    for (; next_edge < offsets[i + 1]; ++next_edge) {
+      if (auto it = index_of_gid.find(target_gids[next_edge]); it != index_of_gid.end()) {
+        projection->targets.push_back(it->second);
+      }
+    }
+    offsets[i + 1] = projection->targets.size();
+  }
+
+  if (data_version) storage_->graph_projections_.Store(name, projection);
+  return projection;
+}
+
 Result<std::optional<VertexAccessor>> Storage::Accessor::DeleteVertex(VertexAccessor *vertex) {
   /// NOTE: Checking whether the vertex can be deleted must be done by loading edges from disk.
   /// Loading edges is done through VertexAccessor so we do it here.
@@ -307,7 +426,7 @@ Storage::Accessor::DetachDelete(std::vector<VertexAccessor *> nodes, std::vector
 
   if (flags::AreExperimentsEnabled(flags::Experiments::TEXT_SEARCH)) {
     for (auto *node : nodes_to_delete) {
-      storage_->indices_.text_index_.RemoveNode(node);
+      storage_->indices_.text_index_.RemoveNode(node, transaction_.transaction_id);
     }
   }
 
@@ -320,6 +439,7 @@ Result<std::optional<std::unordered_set<Vertex *>>> Storage::Accessor::PrepareDe
     const std::vector<VertexAccessor *> &vertices) {
   // Some of the vertices could be already deleted in the system so we need to check
   std::unordered_set<Vertex *> nodes_to_delete{};
+  nodes_to_delete.reserve(vertices.size());
   for (const auto &vertex : vertices) {
     MG_ASSERT(vertex->transaction_ == &transaction_,
               "VertexAccessor must be from the same transaction as the storage "
@@ -363,22 +483,16 @@ EdgeInfoForDeletion Storage::Accessor::PrepareDeletableEdges(const std::unordere
     }
   };
 
-  // add nodes which need to be detached on the other end of the edge
+  // add nodes which need to be detached on the other end of the edge; the
+  // edges are read under the lock instead of copied since only the local
+  // sets are filled, which matters for the high-degree vertices of bulk deletes
   if (detach) {
     for (auto *vertex_ptr : vertices) {
-      utils::small_vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>> in_edges;
-      utils::small_vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>> out_edges;
-
-      {
-        auto vertex_lock = std::shared_lock{vertex_ptr->lock};
-        in_edges = vertex_ptr->in_edges;
-        out_edges = vertex_ptr->out_edges;
-      }
-
-      for (auto const &item : in_edges) {
+      auto vertex_lock = std::shared_lock{vertex_ptr->lock};
+      for (auto const &item : vertex_ptr->in_edges) {
         try_adding_partial_delete_vertices(partial_src_vertices, src_edge_ids, item);
       }
-      for (auto const &item : out_edges) {
+      for (auto const &item : vertex_ptr->out_edges) {
         try_adding_partial_delete_vertices(partial_dest_vertices, dest_edge_ids, item);
       }
     }
@@ -417,6 +531,12 @@ Result<std::optional<std::vector<EdgeAccessor>>> Storage::Accessor::ClearEdgesOn
     // TODO Double check that the shared access is enough
     auto schema_acc = storage_->SchemaInfoAccessor();
     auto vertex_lock = std::unique_lock{vertex_ptr->lock};
+    if (attached_edges_to_vertex->empty()) return std::make_optional<ReturnType>();
+    // The vertex stays locked while its edges are cleared, so checking it
+    // once covers all of them
+    if (!PrepareForWrite(&transaction_, vertex_ptr)) return Error::SERIALIZATION_ERROR;
+    MG_ASSERT(!vertex_ptr->deleted, "Invalid database state!");
+    deleted_edge_ids.reserve(deleted_edge_ids.size() + attached_edges_to_vertex->size());
     while (!attached_edges_to_vertex->empty()) {
       // get the information about the last edge in the vertex collection
       auto const &[edge_type, opposing_vertex, edge_ref] = *attached_edges_to_vertex->rbegin();
@@ -425,30 +545,27 @@ Result<std::optional<std::vector<EdgeAccessor>>> Storage::Accessor::ClearEdgesOn
       std::unique_lock<utils::RWSpinLock> guard;
       if (storage_->config_.salient.items.properties_on_edges) {
         auto edge_ptr = edge_ref.ptr;
-        guard = std::unique_lock{edge_ptr->lock};
+        guard = std::unique_lock{EdgeLock(edge_ptr)};
 
         if (!PrepareForWrite(&transaction_, edge_ptr)) return Error::SERIALIZATION_ERROR;
       }
 
-      if (!PrepareForWrite(&transaction_, vertex_ptr)) return Error::SERIALIZATION_ERROR;
-      MG_ASSERT(!vertex_ptr->deleted, "Invalid database state!");
-
       // MarkEdgeAsDeleted allocates additional memory
       // and CreateAndLinkDelta needs memory
       utils::AtomicMemoryBlock([&attached_edges_to_vertex, &deleted_edge_ids, &reverse_vertex_order, &vertex_ptr,
                                 &deleted_edges, deletion_delta = deletion_delta, edge_type = edge_type,
                                 opposing_vertex = opposing_vertex, edge_ref = edge_ref, &schema_acc, this]() {
         attached_edges_to_vertex->pop_back();
+        auto *from_vertex = reverse_vertex_order ? vertex_ptr : opposing_vertex;
+        auto *to_vertex = reverse_vertex_order ? opposing_vertex : vertex_ptr;
         if (this->storage_->config_.salient.items.properties_on_edges) {
           auto *edge_ptr = edge_ref.ptr;
-          MarkEdgeAsDeleted(edge_ptr);
+          MarkEdgeAsDeleted(edge_ptr, edge_type, from_vertex, to_vertex);
         }
 
         auto const edge_gid = storage_->config_.salient.items.properties_on_edges ? edge_ref.ptr->gid : edge_ref.gid;
         auto const [_, was_inserted] = deleted_edge_ids.insert(edge_gid);
         bool const edge_cleared_from_both_directions = !was_inserted;
-        auto *from_vertex = reverse_vertex_order ? vertex_ptr : opposing_vertex;
-        auto *to_vertex = reverse_vertex_order ? opposing_vertex : vertex_ptr;
         if (edge_cleared_from_both_directions) {
           deleted_edges.emplace_back(edge_ref, edge_type, from_vertex, to_vertex, storage_, &transaction_, true);
         }
@@ -512,6 +629,9 @@ Result<std::optional<std::vector<EdgeAccessor>>> Storage::Accessor::DetachRemain
           auto const edge_gid = storage_->config_.salient.items.properties_on_edges ? edge_ref.ptr->gid : edge_ref.gid;
           return !set_for_erasure.contains(edge_gid);
         });
+    // std::partition doesn't keep the edges grouped by type
+    UngroupEdges(vertex_ptr,
+                 edges_attached_to_vertex == &vertex_ptr->in_edges ? EdgeDirection::IN : EdgeDirection::OUT);
 
     // Creating deltas and erasing edge only at the end -> we might have incomplete state as
     // delta might cause OOM, so we don't remove edges from edges_attached_to_vertex
@@ -519,13 +639,15 @@ Result<std::optional<std::vector<EdgeAccessor>>> Storage::Accessor::DetachRemain
                               vertex_ptr, deletion_delta, reverse_vertex_order, &schema_acc]() {
       for (auto it = mid; it != edges_attached_to_vertex->end(); it++) {
         auto const &[edge_type, opposing_vertex, edge_ref] = *it;
+        auto *from_vertex = reverse_vertex_order ? opposing_vertex : vertex_ptr;
+        auto *to_vertex = reverse_vertex_order ? vertex_ptr : opposing_vertex;
         std::unique_lock<utils::RWSpinLock> guard;
         if (storage_->config_.salient.items.properties_on_edges) {
           auto edge_ptr = edge_ref.ptr;
-          guard = std::unique_lock{edge_ptr->lock};
+          guard = std::unique_lock{EdgeLock(edge_ptr)};
           // this can happen only if we marked edges for deletion with no nodes,
           // so the method detaching nodes will not do anything
-          MarkEdgeAsDeleted(edge_ptr);
+          MarkEdgeAsDeleted(edge_ptr, edge_type, from_vertex, to_vertex);
         }
 
         CreateAndLinkDelta(&transaction_, vertex_ptr, deletion_delta, edge_type, opposing_vertex, edge_ref);
@@ -533,8 +655,6 @@ Result<std::optional<std::vector<EdgeAccessor>>> Storage::Accessor::DetachRemain
         auto const edge_gid = storage_->config_.salient.items.properties_on_edges ? edge_ref.ptr->gid : edge_ref.gid;
         auto const [_, was_inserted] = partially_detached_edge_ids.insert(edge_gid);
         bool const edge_cleared_from_both_directions = !was_inserted;
-        auto *from_vertex = reverse_vertex_order ? opposing_vertex : vertex_ptr;
-        auto *to_vertex = reverse_vertex_order ? vertex_ptr : opposing_vertex;
         if (edge_cleared_from_both_directions) {
           deleted_edges.emplace_back(edge_ref, edge_type, from_vertex, to_vertex, storage_, &transaction_, true);
         }
@@ -597,6 +717,7 @@ Result<std::vector<VertexAccessor>> Storage::Accessor::TryDeleteVertices(const s
 
     CreateAndLinkDelta(&transaction_, vertex_ptr, Delta::RecreateObjectTag());
     if (schema_acc) schema_acc->DeleteVertex(vertex_ptr);
+    transaction_.UpdateOnDeleteVertex(vertex_ptr);
 
     vertex_ptr->deleted = true;
 
@@ -606,10 +727,11 @@ Result<std::vector<VertexAccessor>> Storage::Accessor::TryDeleteVertices(const s
   return deleted_vertices;
 }
 
-void Storage::Accessor::MarkEdgeAsDeleted(Edge *edge) {
+void Storage::Accessor::MarkEdgeAsDeleted(Edge *edge, EdgeTypeId edge_type, Vertex *from_vertex, Vertex *to_vertex) {
   if (!edge->deleted) {
     // NOTE Schema handles this via vertex deltas; add schema info collector here if that evert changes
     CreateAndLinkDelta(&transaction_, edge, Delta::RecreateObjectTag());
+    transaction_.UpdateOnDeleteEdge(edge_type, from_vertex, to_vertex, edge);
     edge->deleted = true;
     storage_->edge_count_.fetch_sub(1, std::memory_order_acq_rel);
   }
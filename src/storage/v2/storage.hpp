@@ -13,9 +13,11 @@
 
 #include <chrono>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <semaphore>
 #include <span>
+#include <string_view>
 #include <thread>
 
 #include "io/network/endpoint.hpp"
@@ -34,6 +36,7 @@
 #include "storage/v2/edge_accessor.hpp"
 #include "storage/v2/edges_iterable.hpp"
 #include "storage/v2/enum_store.hpp"
+#include "storage/v2/graph_projection.hpp"
 #include "storage/v2/indices/indices.hpp"
 #include "storage/v2/mvcc.hpp"
 #include "storage/v2/replication/enums.hpp"
@@ -56,10 +59,12 @@
 
 namespace memgraph::metrics {
 extern const Event SnapshotCreationLatency_us;
+extern const Event GCLatency_us;
 
 extern const Event ActiveLabelIndices;
 extern const Event ActiveLabelPropertyIndices;
 extern const Event ActivePointIndices;
+extern const Event ActiveVectorIndices;
 extern const Event ActiveTextIndices;
 }  // namespace memgraph::metrics
 
@@ -74,6 +79,8 @@ struct IndicesInfo {
   std::vector<std::pair<EdgeTypeId, PropertyId>> edge_type_property;
   std::vector<std::pair<std::string, LabelId>> text_indices;
   std::vector<std::pair<LabelId, PropertyId>> point_label_property;
+  std::vector<std::pair<LabelId, std::vector<PropertyId>>> label_property_composite;
+  std::vector<VectorIndexSpec> vector_label_property;
 };
 
 struct ConstraintsInfo {
@@ -105,6 +112,24 @@ struct StorageInfo {
   uint64_t schema_edge_count;
 };
 
+/// Objects which are waiting to be released by the garbage collector.
+struct GarbageInfo {
+  // Committed transactions whose deltas are still linked to the objects.
+  uint64_t committed_transactions;
+  uint64_t committed_deltas;
+  // Transactions whose deltas are unlinked but could still be read.
+  uint64_t unlinked_transactions;
+  uint64_t unlinked_deltas;
+  // Size of the pending deltas, without the property values they own.
+  uint64_t delta_bytes;
+  // Deleted objects which are still in the indices and the main storage.
+  uint64_t deleted_vertices;
+  uint64_t deleted_edges;
+  // Removed elements of each skip list which aren't freed yet, e.g. of
+  // "vertices" or "label_index(:Person)".
+  std::vector<std::pair<std::string, uint64_t>> skip_list_garbage;
+};
+
 struct EventInfo {
   std::string name;
   std::string type;
@@ -204,10 +229,72 @@ class Storage {
                                       const std::optional<utils::Bound<PropertyValue>> &lower_bound,
                                       const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) = 0;
 
+    /// Looks up the composite index over `properties` of `label`. Returns the
+    /// vertices whose first properties are equal to `prefix` and whose next
+    /// property is within the bounds, if any are given.
+    virtual VerticesIterable Vertices(LabelId label, const std::vector<PropertyId> &properties,
+                                      std::vector<PropertyValue> prefix,
+                                      const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                      const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view) = 0;
+
+    /// Number of vertices `Vertices(label, view)` returns. The default walks
+    /// the iterable, storages override it to count the index entries without
+    /// making an accessor for each of them.
+    virtual uint64_t CountVertices(LabelId label, View view);
+
+    /// Number of vertices `Vertices(label, property, view)` returns.
+    virtual uint64_t CountVertices(LabelId label, PropertyId property, View view);
+
+    /// Number of vertices `Vertices(label, property, lower_bound, upper_bound,
+    /// view)` returns.
+    virtual uint64_t CountVertices(LabelId label, PropertyId property,
+                                   const std::optional<utils::Bound<PropertyValue>> &lower_bound,
+                                   const std::optional<utils::Bound<PropertyValue>> &upper_bound, View view);
+
+    /// Splits the vertices into at most `num_chunks` disjoint iterables which
+    /// can be consumed concurrently by different threads. Storages that don't
+    /// support splitting return a single chunk with all of the vertices.
+    virtual std::vector<VerticesIterable> ChunkedVertices(View view, size_t num_chunks);
+
+    /// Same as `ChunkedVertices(View, size_t)`, but only vertices with the
+    /// given label are returned.
+    virtual std::vector<VerticesIterable> ChunkedVertices(LabelId label, View view, size_t num_chunks);
+
+    /// Calls `func` with every vertex that has `label` in the `view` together
+    /// with its value of `property`, read from the columnar store where
+    /// possible. Returns `false` if `property` isn't a columnar property of
+    /// `label`, which is always the case for storages without a columnar store.
+    virtual bool ScanColumnarProperty(LabelId /*label*/, PropertyId /*property*/, View /*view*/,
+                                      const std::function<void(const VertexAccessor &, const PropertyValue &)> &
+                                      /*func*/) {
+      return false;
+    }
+
+    /// Returns the projection of the graph the transaction sees with `view`.
+    /// The projection named `name` is reused if it was built with the same
+    /// `filter` from the same data, otherwise it is built and kept as `name`
+    /// for the following transactions which see the same data.
+    /// @throw std::bad_alloc
+    std::shared_ptr<const GraphProjection> GetGraphProjection(std::string_view name, const GraphProjectionFilter &filter,
+                                                              View view);
+
+    /// Upper bound of the gids of the vertices, which are handed out densely
+    /// starting from 0. Vertices created after the call can have larger gids.
+    uint64_t VertexGidUpperBound() const { return storage_->vertex_id_.load(std::memory_order_acquire); }
+
+    /// Opens another accessor of the same storage, with a transaction of its
+    /// own.
+    std::unique_ptr<Accessor> AccessStorage() const { return storage_->Access(); }
+
     virtual std::optional<EdgeAccessor> FindEdge(Gid gid, View view) = 0;
 
     virtual EdgesIterable Edges(EdgeTypeId edge_type, View view) = 0;
 
+    /// Returns the edges of `edge_type` going from `from` to `to`, looked up in
+    /// the edge-type index.
+    virtual EdgesIterable Edges(EdgeTypeId edge_type, const VertexAccessor &from, const VertexAccessor &to,
+                                View view) = 0;
+
     virtual EdgesIterable Edges(EdgeTypeId edge_type, PropertyId property, View view) = 0;
 
     virtual EdgesIterable Edges(EdgeTypeId edge_type, PropertyId property, const PropertyValue &value, View view) = 0;
@@ -236,6 +323,11 @@ class Storage {
                                             const std::optional<utils::Bound<PropertyValue>> &lower,
                                             const std::optional<utils::Bound<PropertyValue>> &upper) const = 0;
 
+    virtual uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties) const = 0;
+
+    virtual uint64_t ApproximateVertexCount(LabelId label, const std::vector<PropertyId> &properties,
+                                            const std::vector<PropertyValue> &prefix) const = 0;
+
     virtual uint64_t ApproximateEdgeCount(EdgeTypeId edge_type) const = 0;
 
     virtual uint64_t ApproximateEdgeCount(EdgeTypeId edge_type, PropertyId property) const = 0;
@@ -249,6 +341,26 @@ class Storage {
 
     virtual uint64_t ApproximatePointCount(LabelId label, PropertyId property) const = 0;
 
+    /// Returns up to `k` vertices with `label`, ordered by the distance of
+    /// their `property` to `point`, nearest first. Uses the point index on
+    /// (`label`, `property`), vertices without a point of the same coordinate
+    /// reference system as `point` aren't returned.
+    virtual std::vector<VertexAccessor> NearestPointVertices(LabelId label, PropertyId property,
+                                                             const PropertyValue &point, std::size_t k,
+                                                             View view) = 0;
+
+    virtual uint64_t ApproximateVectorCount(LabelId label, PropertyId property) const = 0;
+
+    /// Returns up to `k` vertices with `label` whose `property` has the
+    /// highest approximate cosine similarity to `query`, most similar first,
+    /// with the similarity of their visible vector. Uses the vector index on
+    /// (`label`, `property`), which holds the committed vectors, so the
+    /// vectors set by this transaction aren't searched. Nothing is returned
+    /// if `query` isn't a list of as many numbers as the index dimension.
+    virtual std::vector<std::pair<VertexAccessor, double>> VectorIndexSearch(LabelId label, PropertyId property,
+                                                                             const PropertyValue &query,
+                                                                             std::size_t k, View view) = 0;
+
     virtual std::optional<storage::LabelIndexStats> GetIndexStats(const storage::LabelId &label) const = 0;
 
     virtual std::optional<storage::LabelPropertyIndexStats> GetIndexStats(
@@ -281,20 +393,38 @@ class Storage {
 
     virtual bool LabelPropertyIndexExists(LabelId label, PropertyId property) const = 0;
 
+    virtual bool LabelPropertyCompositeIndexExists(LabelId label, const std::vector<PropertyId> &properties) const = 0;
+
+    /// Returns the property lists of all composite indices of `label`.
+    virtual std::vector<std::vector<PropertyId>> ListLabelPropertyCompositeIndices(LabelId label) const = 0;
+
     virtual bool EdgeTypeIndexExists(EdgeTypeId edge_type) const = 0;
 
     virtual bool EdgeTypePropertyIndexExists(EdgeTypeId edge_type, PropertyId property) const = 0;
 
+    virtual bool PointIndexExists(LabelId label, PropertyId property) const = 0;
+
+    /// Returns the dimension of the vector index on (`label`, `property`), if
+    /// it exists.
+    virtual std::optional<uint64_t> VectorIndexDimension(LabelId label, PropertyId property) const = 0;
+
     bool TextIndexExists(const std::string &index_name) const {
       return storage_->indices_.text_index_.IndexExists(index_name);
     }
 
     void TextIndexAddVertex(const VertexAccessor &vertex) {
-      storage_->indices_.text_index_.AddNode(vertex.vertex_, storage_->name_id_mapper_.get());
+      storage_->indices_.text_index_.AddNode(vertex.vertex_, storage_->name_id_mapper_.get(),
+                                             transaction_.transaction_id);
     }
 
     void TextIndexUpdateVertex(const VertexAccessor &vertex, const std::vector<LabelId> &removed_labels = {}) {
-      storage_->indices_.text_index_.UpdateNode(vertex.vertex_, storage_->name_id_mapper_.get(), removed_labels);
+      storage_->indices_.text_index_.UpdateNode(vertex.vertex_, storage_->name_id_mapper_.get(),
+                                                transaction_.transaction_id, removed_labels);
+    }
+
+    /// Lets the following searches of the text index see all committed transactions.
+    void TextIndexRefresh(const std::string &index_name) const {
+      storage_->indices_.text_index_.Refresh(index_name);
     }
 
     std::vector<Gid> TextIndexSearch(const std::string &index_name, const std::string &search_query,
@@ -343,6 +473,10 @@ class Storage {
 
     EdgeTypeId NameToEdgeType(std::string_view name) { return storage_->NameToEdgeType(name); }
 
+    std::optional<EdgeTypeId> NameToEdgeTypeIfExists(std::string_view name) const {
+      return storage_->NameToEdgeTypeIfExists(name);
+    }
+
     StorageMode GetCreationStorageMode() const noexcept;
 
     const std::string &id() const { return storage_->name(); }
@@ -356,6 +490,10 @@ class Storage {
 
     virtual utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(LabelId label, PropertyId property) = 0;
 
+    /// Creates a composite index over the ordered list of `properties`.
+    virtual utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(
+        LabelId label, const std::vector<PropertyId> &properties) = 0;
+
     virtual utils::BasicResult<StorageIndexDefinitionError, void> CreateIndex(EdgeTypeId edge_type,
                                                                               bool unique_access_needed = true) = 0;
 
@@ -366,6 +504,9 @@ class Storage {
 
     virtual utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(LabelId label, PropertyId property) = 0;
 
+    virtual utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(
+        LabelId label, const std::vector<PropertyId> &properties) = 0;
+
     virtual utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(EdgeTypeId edge_type) = 0;
 
     virtual utils::BasicResult<StorageIndexDefinitionError, void> DropIndex(EdgeTypeId edge_type,
@@ -377,6 +518,12 @@ class Storage {
     virtual utils::BasicResult<storage::StorageIndexDefinitionError, void> DropPointIndex(
         storage::LabelId label, storage::PropertyId property) = 0;
 
+    virtual utils::BasicResult<storage::StorageIndexDefinitionError, void> CreateVectorIndex(
+        const VectorIndexSpec &spec) = 0;
+
+    virtual utils::BasicResult<storage::StorageIndexDefinitionError, void> DropVectorIndex(
+        storage::LabelId label, storage::PropertyId property) = 0;
+
     void CreateTextIndex(const std::string &index_name, LabelId label);
 
     void DropTextIndex(const std::string &index_name);
@@ -465,7 +612,7 @@ class Storage {
     Result<std::optional<std::vector<EdgeAccessor>>> DetachRemainingEdges(
         EdgeInfoForDeletion info, std::unordered_set<Gid> &partially_detached_edge_ids);
     Result<std::vector<VertexAccessor>> TryDeleteVertices(const std::unordered_set<Vertex *> &vertices);
-    void MarkEdgeAsDeleted(Edge *edge);
+    void MarkEdgeAsDeleted(Edge *edge, EdgeTypeId edge_type, Vertex *from_vertex, Vertex *to_vertex);
 
    private:
     StorageMode creation_storage_mode_;
@@ -497,6 +644,14 @@ class Storage {
     return EdgeTypeId::FromUint(name_id_mapper_->NameToId(name));
   }
 
+  std::optional<EdgeTypeId> NameToEdgeTypeIfExists(std::string_view name) const {
+    const auto id = name_id_mapper_->NameToIdIfExists(name);
+    if (!id) {
+      return std::nullopt;
+    }
+    return EdgeTypeId::FromUint(*id);
+  }
+
   StorageMode GetStorageMode() const noexcept;
 
   virtual void FreeMemory(std::unique_lock<utils::ResourceLock> main_guard, bool periodic) = 0;
@@ -527,6 +682,15 @@ class Storage {
 
   virtual StorageInfo GetInfo() = 0;
 
+  /// Sets the counts of the indices and the constraints in @p info without starting a transaction. While an
+  /// exclusive operation, e.g. an index creation, holds the storage, the counts of the last read are used instead of
+  /// waiting for it.
+  void SetIndexAndConstraintCounts(StorageInfo &info);
+
+  /// Garbage waiting for the next garbage collection cycles. Storages which
+  /// don't keep the garbage in memory report none.
+  virtual GarbageInfo GetGarbageInfo() { return {}; }
+
   virtual Transaction CreateTransaction(IsolationLevel isolation_level, StorageMode storage_mode) = 0;
 
   virtual void PrepareForNewEpoch() = 0;
@@ -544,7 +708,7 @@ class Storage {
   // creation of new accessors by taking a unique lock. This is used when doing
   // operations on storage that affect the global state, for example index
   // creation.
-  mutable utils::ResourceLock main_lock_;
+  mutable utils::ResourceLock main_lock_{utils::LockSite::MAIN};
 
   // Even though the edge count is already kept in the `edges_` SkipList, the
   // list is used only when properties are enabled for edges. Because of that we
@@ -556,7 +720,7 @@ class Storage {
   Config config_;
 
   // Transaction engine
-  mutable utils::SpinLock engine_lock_;
+  mutable utils::SpinLock engine_lock_{utils::LockSite::ENGINE};
   uint64_t timestamp_{kTimestampInitialId};
   uint64_t transaction_id_{kTransactionInitialId};
 
@@ -595,6 +759,9 @@ class Storage {
   // Mutable methods only safe if we have UniqueAccess to this storage
   EnumStore enum_store_;
 
+  // Projections of the graph shared by the analytics procedures.
+  GraphProjections graph_projections_;
+
   std::optional<SchemaInfo::AnalyticalAccessor> SchemaInfoAccessor() {
     if (!config_.salient.items.enable_schema_info) return std::nullopt;
     if (storage_mode_ != StorageMode::IN_MEMORY_ANALYTICAL) return std::nullopt;
@@ -611,6 +778,16 @@ class Storage {
   SchemaInfo::WriteAccessor SchemaInfoWriteAccessor() { return schema_info_.CreateWriteAccessor(); }
 
   SchemaInfo schema_info_;
+
+ private:
+  struct IndexAndConstraintCounts {
+    uint64_t label_indices{0};
+    uint64_t label_property_indices{0};
+    uint64_t text_indices{0};
+    uint64_t existence_constraints{0};
+    uint64_t unique_constraints{0};
+  };
+  utils::Synchronized<IndexAndConstraintCounts, utils::SpinLock> index_and_constraint_counts_;
 };
 
 }  // namespace memgraph::storage
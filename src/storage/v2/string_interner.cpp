@@ -0,0 +1,50 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/string_interner.hpp"
+
+#include <mutex>
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(storage_property_store_intern_max_length, 0,
+              "String property values up to this length in bytes are kept once in a process-wide table and the "
+              "property stores only keep their id. Meant for low-cardinality values, the strings are never removed "
+              "and at most 65536 of them are interned. Set to 0 to keep all strings inline.");
+
+namespace memgraph::storage {
+
+std::atomic<bool> StringInterner::any_interned_{false};
+
+auto StringInterner::GetInstance() -> StringInterner & {
+  static StringInterner instance;
+  return instance;
+}
+
+StringInterner::StringInterner() : strings_(std::make_unique<std::atomic<std::string const *>[]>(kMaxStrings)) {}
+
+std::optional<uint32_t> StringInterner::Intern(std::string_view value) {
+  {
+    std::shared_lock guard{lock_};
+    if (auto it = ids_.find(value); it != ids_.end()) return it->second;
+  }
+  std::unique_lock guard{lock_};
+  if (auto it = ids_.find(value); it != ids_.end()) return it->second;
+  if (owned_.size() == kMaxStrings) return std::nullopt;
+
+  auto const id = static_cast<uint32_t>(owned_.size());
+  auto const &str = owned_.emplace_back(value);
+  strings_[id].store(&str, std::memory_order_release);
+  ids_.emplace(str, id);
+  any_interned_.store(true, std::memory_order_release);
+  return id;
+}
+
+}  // namespace memgraph::storage
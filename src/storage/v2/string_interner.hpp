@@ -0,0 +1,72 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <gflags/gflags.h>
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+DECLARE_uint64(storage_property_store_intern_max_length);
+
+namespace memgraph::storage {
+
+/// Process-wide table of the string property values which the property stores
+/// keep as an id instead of their bytes, see
+/// --storage-property-store-intern-max-length. The strings are never removed,
+/// so the ids stay valid for the lifetime of the process, but they aren't
+/// valid in another one: `PropertyStore::StringBuffer` writes the strings
+/// inline.
+class StringInterner {
+ public:
+  static constexpr uint32_t kMaxStrings = 1U << 16U;
+
+  static auto GetInstance() -> StringInterner &;
+
+  /// Returns whether any string was interned, so the stores can't hold ids.
+  static bool AnyInterned() { return any_interned_.load(std::memory_order_acquire); }
+
+  StringInterner();
+
+  StringInterner(const StringInterner &) = delete;
+  StringInterner &operator=(const StringInterner &) = delete;
+  StringInterner(StringInterner &&) = delete;
+  StringInterner &operator=(StringInterner &&) = delete;
+
+  ~StringInterner() = default;
+
+  /// Returns the id of @p value, or nullopt if `kMaxStrings` other strings
+  /// were already interned.
+  std::optional<uint32_t> Intern(std::string_view value);
+
+  /// @p id must be returned by `Intern`.
+  std::string_view Get(uint32_t id) const { return *strings_[id].load(std::memory_order_acquire); }
+
+ private:
+  static std::atomic<bool> any_interned_;
+
+  std::shared_mutex lock_;
+  std::deque<std::string> owned_;
+  std::unordered_map<std::string_view, uint32_t> ids_;
+  // Read without the lock, the strings are published before their ids.
+  std::unique_ptr<std::atomic<std::string const *>[]> strings_;
+};
+
+}  // namespace memgraph::storage
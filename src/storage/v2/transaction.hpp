@@ -23,8 +23,10 @@
 #include "storage/v2/constraint_verification_info.hpp"
 #include "storage/v2/delta.hpp"
 #include "storage/v2/edge.hpp"
+#include "storage/v2/indices/index_cleanup_collector.hpp"
 #include "storage/v2/indices/point_index.hpp"
 #include "storage/v2/indices/point_index_change_collector.hpp"
+#include "storage/v2/indices/vector_index_change_collector.hpp"
 #include "storage/v2/isolation_level.hpp"
 #include "storage/v2/metadata_delta.hpp"
 #include "storage/v2/modified_edge.hpp"
@@ -39,6 +41,8 @@
 
 namespace memgraph::storage {
 
+class VertexVersionStore;
+
 const uint64_t kTimestampInitialId = 0;
 const uint64_t kTransactionInitialId = 1ULL << 63U;
 
@@ -87,17 +91,32 @@ struct Transaction {
 
   bool RemoveModifiedEdge(const Gid &gid) { return modified_edges_.erase(gid) > 0U; }
 
+  /// `manyDeltasCache` is not synchronized, so it is bypassed while several
+  /// threads read through this transaction at once.
+  bool UseManyDeltasCache() const {
+    return isolation_level == IsolationLevel::SNAPSHOT_ISOLATION && !parallel_readers_active;
+  }
+
   void UpdateOnChangeLabel(LabelId label, Vertex *vertex) {
     point_index_change_collector_.UpdateOnChangeLabel(label, vertex);
+    vector_index_change_collector_.UpdateOnChangeLabel(label, vertex);
+    index_cleanup_collector_.UpdateOnChangeLabel(label, vertex);
     manyDeltasCache.Invalidate(vertex, label);
   }
 
   void UpdateOnSetProperty(PropertyId property, const PropertyValue &old_value, const PropertyValue &new_value,
                            Vertex *vertex) {
     point_index_change_collector_.UpdateOnSetProperty(property, old_value, new_value, vertex);
+    vector_index_change_collector_.UpdateOnSetProperty(property, old_value, new_value, vertex);
     manyDeltasCache.Invalidate(vertex, property);
   }
 
+  void UpdateOnDeleteVertex(Vertex *vertex) { vector_index_change_collector_.UpdateOnDeleteVertex(vertex); }
+
+  void UpdateOnDeleteEdge(EdgeTypeId edge_type, Vertex *from_vertex, Vertex *to_vertex, Edge *edge) {
+    index_cleanup_collector_.UpdateOnDeleteEdge(edge_type, from_vertex, to_vertex, edge);
+  }
+
   uint64_t transaction_id{};
   uint64_t start_timestamp{};
   std::optional<uint64_t> original_start_timestamp{};
@@ -119,6 +138,17 @@ struct Transaction {
   // Used to speedup getting info about a vertex when there is a long delta
   // chain involved in rebuilding that info.
   mutable VertexInfoCache manyDeltasCache{};
+  // Set while a parallel read-only operator is scanning through this transaction.
+  bool parallel_readers_active{false};
+  // Bytes of the WAL file the commit of the transaction wrote.
+  uint64_t wal_bytes{0};
+  // Timestamp of the last commit which was durable when the transaction
+  // started, the transactions with the same version see the same data. Only
+  // set for snapshot isolation transactions of the in-memory storage.
+  std::optional<uint64_t> data_version{};
+  // Materialized versions of vertices shared between transactions, only set
+  // for snapshot isolation transactions in the IN_MEMORY_TRANSACTIONAL mode.
+  VertexVersionStore *vertex_versions{nullptr};
   mutable std::optional<ConstraintVerificationInfo> constraint_verification_info{};
 
   // Store modified edges GID mapped to changed Delta and serialized edge key
@@ -142,6 +172,10 @@ struct Transaction {
   PointIndexContext point_index_ctx_;
   /// Tracks changes relevant to point index (used during Commit/AdvanceCommand)
   PointIndexChangeCollector point_index_change_collector_;
+  /// Tracks changes relevant to the vector indices (applied on Commit)
+  VectorIndexChangeCollector vector_index_change_collector_;
+  /// Tracks the index entries the commit may leave obsolete (handed over to the GC)
+  IndexCleanupCollector index_cleanup_collector_;
 };
 
 inline bool operator==(const Transaction &first, const Transaction &second) {
@@ -12,12 +12,17 @@
 #pragma once
 
 #include <alloca.h>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <iterator>
 #include <limits>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include "storage/v2/delta.hpp"
+#include "storage/v2/edge_direction.hpp"
 #include "storage/v2/edge_ref.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/property_store.hpp"
@@ -41,16 +46,138 @@ struct Vertex {
   utils::small_vector<std::tuple<EdgeTypeId, Vertex *, EdgeRef>> out_edges;
 
   PropertyStore properties;
-  mutable utils::RWSpinLock lock;
+  mutable utils::RWSpinLock lock{utils::LockSite::VERTEX};
   bool deleted;
-  // uint8_t PAD;
-  // uint16_t PAD;
+  // Bit per `EdgeDirection` set while the edges of that direction are sorted by
+  // edge type, see `GroupEdgesByType`.
+  uint8_t edges_grouped_by_type{0};
+  // Reads of the properties since the last pass of the property tier
+  // (saturating), only counted while the tier is enabled.
+  mutable uint8_t properties_reads{0};
+  // Set when the delta chain is unlinked while the columnar store has columns,
+  // until the store refreshes the values of the vertex, see
+  // `ColumnarPropertyStore`.
+  bool columnar_stale{false};
 
   Delta *delta;
 };
 
 static_assert(alignof(Vertex) >= 8, "The Vertex should be aligned to at least 8!");
+// Tracking the lock contention adds the site of the lock to it.
+#ifndef MG_LOCK_CONTENTION_TRACKING
 static_assert(sizeof(Vertex) == 88, "If this changes documentation needs changing");
+#endif
+
+/// Edges of hub vertices can be kept grouped (sorted) by edge type, so that
+/// expansions filtered by edge type can binary search the matching range
+/// instead of scanning every edge of the vertex. Every change of `in_edges` or
+/// `out_edges` of an in-memory vertex must go through the helpers below (or
+/// call `UngroupEdges`) so that the grouping stays valid.
+
+inline auto &VertexEdges(Vertex *vertex, EdgeDirection direction) {
+  return direction == EdgeDirection::IN ? vertex->in_edges : vertex->out_edges;
+}
+
+inline auto const &VertexEdges(Vertex const &vertex, EdgeDirection direction) {
+  return direction == EdgeDirection::IN ? vertex.in_edges : vertex.out_edges;
+}
+
+inline uint8_t GroupedEdgesBit(EdgeDirection direction) { return 1U << static_cast<uint8_t>(direction); }
+
+inline bool EdgesGroupedByType(Vertex const &vertex, EdgeDirection direction) {
+  return (vertex.edges_grouped_by_type & GroupedEdgesBit(direction)) != 0;
+}
+
+inline void UngroupEdges(Vertex *vertex, EdgeDirection direction) {
+  vertex->edges_grouped_by_type &= ~GroupedEdgesBit(direction);
+}
+
+/// Returns the range of `edges` of the given type. `edges` must be grouped.
+template <typename TEdges>
+inline auto EdgesOfType(TEdges &edges, EdgeTypeId edge_type) {
+  auto first = std::lower_bound(edges.begin(), edges.end(), edge_type,
+                                [](auto const &edge, EdgeTypeId type) { return std::get<0>(edge) < type; });
+  auto last = std::upper_bound(first, edges.end(), edge_type,
+                               [](EdgeTypeId type, auto const &edge) { return type < std::get<0>(edge); });
+  return std::pair{first, last};
+}
+
+/// Sorts the edges of the given direction by edge type. Only the part appended
+/// since the last grouping has to be sorted. The vertex must be locked
+/// exclusively.
+inline void GroupEdgesByType(Vertex *vertex, EdgeDirection direction) {
+  if (EdgesGroupedByType(*vertex, direction)) return;
+  auto &edges = VertexEdges(vertex, direction);
+  auto type_less = [](auto const &lhs, auto const &rhs) { return std::get<0>(lhs) < std::get<0>(rhs); };
+  auto sorted_end = std::is_sorted_until(edges.begin(), edges.end(), type_less);
+  std::sort(sorted_end, edges.end(), type_less);
+  std::inplace_merge(edges.begin(), sorted_end, edges.end(), type_less);
+  vertex->edges_grouped_by_type |= GroupedEdgesBit(direction);
+}
+
+/// Sorts the edges of both directions by edge type and then by the other
+/// vertex, and releases their unused capacity. The edges of a type end up in
+/// one contiguous range ordered like the neighbours in memory, so the vertex
+/// is left grouped in both directions. The vertex must be locked exclusively.
+inline void CompactVertexEdges(Vertex *vertex) {
+  auto edge_less = [](auto const &lhs, auto const &rhs) {
+    if (std::get<0>(lhs) != std::get<0>(rhs)) return std::get<0>(lhs) < std::get<0>(rhs);
+    return std::less<>{}(std::get<1>(lhs), std::get<1>(rhs));
+  };
+  for (auto direction : {EdgeDirection::OUT, EdgeDirection::IN}) {
+    auto &edges = VertexEdges(vertex, direction);
+    if (!std::is_sorted(edges.begin(), edges.end(), edge_less)) {
+      std::sort(edges.begin(), edges.end(), edge_less);
+    }
+    edges.shrink_to_fit();
+    vertex->edges_grouped_by_type |= GroupedEdgesBit(direction);
+  }
+  vertex->labels.shrink_to_fit();
+}
+
+/// Appends an edge and keeps the grouping if the edge type doesn't break it.
+template <typename... Args>
+inline void AppendVertexEdge(Vertex *vertex, EdgeDirection direction, Args &&...args) {
+  auto &edges = VertexEdges(vertex, direction);
+  edges.emplace_back(std::forward<Args>(args)...);
+  if (EdgesGroupedByType(*vertex, direction) && edges.size() > 1 &&
+      std::get<0>(edges.back()) < std::get<0>(edges[edges.size() - 2])) {
+    UngroupEdges(vertex, direction);
+  }
+}
+
+/// Finds the given edge, using a binary search if the edges are grouped.
+template <typename TLink>
+inline auto FindVertexEdge(Vertex *vertex, EdgeDirection direction, TLink const &link) {
+  auto &edges = VertexEdges(vertex, direction);
+  if (!EdgesGroupedByType(*vertex, direction)) return std::find(edges.begin(), edges.end(), link);
+  auto [first, last] = EdgesOfType(edges, std::get<0>(link));
+  auto it = std::find(first, last, link);
+  return it == last ? edges.end() : it;
+}
+
+/// Removes the edge at `it`. Grouped edges are kept grouped by moving the hole
+/// through the following groups, one swap per group.
+template <typename TIterator>
+inline void RemoveVertexEdge(Vertex *vertex, EdgeDirection direction, TIterator it) {
+  auto &edges = VertexEdges(vertex, direction);
+  if (!EdgesGroupedByType(*vertex, direction)) {
+    std::swap(*it, edges.back());
+    edges.pop_back();
+    return;
+  }
+  auto type = std::get<0>(*it);
+  while (true) {
+    auto last = std::prev(std::upper_bound(std::next(it), edges.end(), type, [](EdgeTypeId lhs, auto const &edge) {
+      return lhs < std::get<0>(edge);
+    }));
+    std::swap(*it, *last);
+    it = last;
+    if (std::next(it) == edges.end()) break;
+    type = std::get<0>(*std::next(it));
+  }
+  edges.pop_back();
+}
 
 inline bool operator==(const Vertex &first, const Vertex &second) { return first.gid == second.gid; }
 inline bool operator<(const Vertex &first, const Vertex &second) { return first.gid < second.gid; }
@@ -14,6 +14,7 @@
 #include <algorithm>
 #include <chrono>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <thread>
 #include <tuple>
@@ -29,6 +30,7 @@
 #include "storage/v2/edge_direction.hpp"
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/mvcc.hpp"
+#include "storage/v2/property_store_tier.hpp"
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/result.hpp"
 #include "storage/v2/schema_info.hpp"
@@ -36,6 +38,7 @@
 #include "storage/v2/transaction.hpp"
 #include "storage/v2/vertex_info_cache.hpp"
 #include "storage/v2/vertex_info_helpers.hpp"
+#include "storage/v2/vertex_version_store.hpp"
 #include "storage/v2/view.hpp"
 #include "utils/atomic_memory_block.hpp"
 #include "utils/logging.hpp"
@@ -43,14 +46,55 @@
 #include "utils/small_vector.hpp"
 #include "utils/variant_helpers.hpp"
 
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(adjacency_grouping_threshold, 0,
+              "The number of edges in one direction of a vertex after which the edges are kept grouped by edge "
+              "type, so expansions filtered by edge type only visit the matching edges. Set to 0 to disable.");
+
 namespace memgraph::storage {
 
 namespace {
+
+// Properties of the vertices which aren't read between two passes of the property tier are moved out of memory.
+void CountPropertiesRead(Vertex const &vertex) {
+  if (!PropertyStoreTier::GetInstance()) return;
+  auto reads = std::atomic_ref{vertex.properties_reads};
+  if (reads.load(std::memory_order_relaxed) != std::numeric_limits<uint8_t>::max()) {
+    reads.fetch_add(1, std::memory_order_relaxed);
+  }
+}
 void HandleTypeConstraintViolation(Storage const *storage, ConstraintViolation const &violation) {
   throw query::QueryException("IS TYPED {} violation on {}({})", TypeConstraintKindToString(*violation.constraint_kind),
                               storage->LabelToName(violation.label),
                               storage->PropertyToName(*violation.properties.begin()));
 }
+
+std::shared_ptr<VertexVersion const> FindVertexVersion(Vertex const *vertex, Delta const *delta,
+                                                       Transaction const *transaction) {
+  if (transaction->vertex_versions == nullptr) return nullptr;
+  return transaction->vertex_versions->Find(vertex, delta, transaction);
+}
+
+void MaterializeVertexVersion(Vertex const *vertex, Transaction const *transaction, std::size_t n_processed) {
+  if (transaction->vertex_versions == nullptr || FLAGS_delta_chain_materialize_threshold == 0 ||
+      n_processed < FLAGS_delta_chain_materialize_threshold) {
+    return;
+  }
+  transaction->vertex_versions->Materialize(vertex, transaction);
+}
+
+void GroupHubEdges(Vertex *vertex, EdgeDirection direction) {
+  if (FLAGS_adjacency_grouping_threshold == 0) return;
+  {
+    auto guard = std::shared_lock{vertex->lock};
+    if (EdgesGroupedByType(*vertex, direction) ||
+        VertexEdges(*vertex, direction).size() < FLAGS_adjacency_grouping_threshold) {
+      return;
+    }
+  }
+  auto guard = std::unique_lock{vertex->lock};
+  GroupEdgesByType(vertex, direction);
+}
 }  // namespace
 
 namespace detail {
@@ -69,7 +113,7 @@ std::pair<bool, bool> IsVisible(Vertex const *vertex, Transaction const *transac
   if (delta && transaction->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
-    auto const useCache = transaction->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
+    auto const useCache = transaction->UseManyDeltasCache();
 
     if (useCache) {
       auto const &cache = transaction->manyDeltasCache;
@@ -78,6 +122,8 @@ std::pair<bool, bool> IsVisible(Vertex const *vertex, Transaction const *transac
       if (existsRes && deletedRes) return {*existsRes, *deletedRes};
     }
 
+    if (auto version = FindVertexVersion(vertex, delta, transaction)) return {version->exists, version->deleted};
+
     auto const n_processed = ApplyDeltasForRead(transaction, delta, view, [&](const Delta &delta) {
       // clang-format off
       DeltaDispatch(delta, utils::ChainedOverloaded{
@@ -92,6 +138,7 @@ std::pair<bool, bool> IsVisible(Vertex const *vertex, Transaction const *transac
       cache.StoreExists(view, vertex, exists);
       cache.StoreDeleted(view, vertex, deleted);
     }
+    MaterializeVertexVersion(vertex, transaction, n_processed);
   }
 
   return {exists, deleted};
@@ -273,13 +320,19 @@ Result<bool> VertexAccessor::HasLabel(LabelId label, View view) const {
   if (delta && transaction_->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
-    auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
+    auto const useCache = transaction_->UseManyDeltasCache();
     if (useCache) {
       auto const &cache = transaction_->manyDeltasCache;
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
       if (auto resLabel = cache.GetHasLabel(view, vertex_, label); resLabel) return {resLabel.value()};
     }
 
+    if (auto version = FindVertexVersion(vertex_, delta, transaction_)) {
+      if (!version->exists) return Error::NONEXISTENT_OBJECT;
+      if (!for_deleted_ && version->deleted) return Error::DELETED_OBJECT;
+      return std::find(version->labels.begin(), version->labels.end(), label) != version->labels.end();
+    }
+
     auto const n_processed = ApplyDeltasForRead(transaction_, delta, view, [&, label](const Delta &delta) {
       // clang-format off
       DeltaDispatch(delta, utils::ChainedOverloaded{
@@ -296,6 +349,7 @@ Result<bool> VertexAccessor::HasLabel(LabelId label, View view) const {
       cache.StoreDeleted(view, vertex_, deleted);
       cache.StoreHasLabel(view, vertex_, label, has_label);
     }
+    MaterializeVertexVersion(vertex_, transaction_, n_processed);
   }
 
   if (!exists) return Error::NONEXISTENT_OBJECT;
@@ -320,13 +374,19 @@ Result<utils::small_vector<LabelId>> VertexAccessor::Labels(View view) const {
   if (delta && transaction_->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
-    auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
+    auto const useCache = transaction_->UseManyDeltasCache();
     if (useCache) {
       auto const &cache = transaction_->manyDeltasCache;
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
       if (auto resLabels = cache.GetLabels(view, vertex_); resLabels) return {*resLabels};
     }
 
+    if (auto version = FindVertexVersion(vertex_, delta, transaction_)) {
+      if (!version->exists) return Error::NONEXISTENT_OBJECT;
+      if (!for_deleted_ && version->deleted) return Error::DELETED_OBJECT;
+      return version->labels;
+    }
+
     auto const n_processed = ApplyDeltasForRead(transaction_, delta, view, [&](const Delta &delta) {
       // clang-format off
       DeltaDispatch(delta, utils::ChainedOverloaded{
@@ -343,6 +403,7 @@ Result<utils::small_vector<LabelId>> VertexAccessor::Labels(View view) const {
       cache.StoreDeleted(view, vertex_, deleted);
       cache.StoreLabels(view, vertex_, labels);
     }
+    MaterializeVertexVersion(vertex_, transaction_, n_processed);
   }
 
   if (!exists) return Error::NONEXISTENT_OBJECT;
@@ -402,7 +463,7 @@ Result<PropertyValue> VertexAccessor::SetProperty(PropertyId property, const Pro
     if (!new_value.IsNull()) {
       transaction_->constraint_verification_info->AddedProperty(vertex_);
     } else {
-      transaction_->constraint_verification_info->RemovedProperty(vertex_);
+      transaction_->constraint_verification_info->RemovedProperty(vertex_, property);
     }
   }
   storage_->indices_.UpdateOnSetProperty(property, new_value, vertex_, *transaction_);
@@ -439,7 +500,7 @@ Result<bool> VertexAccessor::InitProperties(const std::map<storage::PropertyId,
             if (!new_value.IsNull()) {
               transaction->constraint_verification_info->AddedProperty(vertex);
             } else {
-              transaction->constraint_verification_info->RemovedProperty(vertex);
+              transaction->constraint_verification_info->RemovedProperty(vertex, property);
             }
           }
           if (schema_acc)
@@ -494,7 +555,7 @@ Result<std::vector<std::tuple<PropertyId, PropertyValue, PropertyValue>>> Vertex
         if (!new_value.IsNull()) {
           transaction->constraint_verification_info->AddedProperty(vertex);
         } else {
-          transaction->constraint_verification_info->RemovedProperty(vertex);
+          transaction->constraint_verification_info->RemovedProperty(vertex, id);
         }
       }
       if (schema_acc)
@@ -535,12 +596,12 @@ Result<std::map<PropertyId, PropertyValue>> VertexAccessor::ClearProperties() {
           CreateAndLinkDelta(transaction, vertex, Delta::SetPropertyTag(), property, old_value);
           storage->indices_.UpdateOnSetProperty(property, new_value, vertex, *transaction);
           transaction->UpdateOnSetProperty(property, old_value, new_value, vertex);
+          if (transaction->constraint_verification_info) {
+            transaction->constraint_verification_info->RemovedProperty(vertex, property);
+          }
           if (schema_acc)
             schema_acc->SetProperty(vertex, property, ExtendedPropertyType{}, ExtendedPropertyType{old_value});
         }
-        if (transaction->constraint_verification_info) {
-          transaction->constraint_verification_info->RemovedProperty(vertex);
-        }
         vertex->properties.ClearProperties();
       });
 
@@ -556,6 +617,7 @@ Result<PropertyValue> VertexAccessor::GetProperty(PropertyId property, View view
     auto guard = std::shared_lock{vertex_->lock};
     deleted = vertex_->deleted;
     value = vertex_->properties.GetProperty(property);
+    CountPropertiesRead(*vertex_);
     delta = vertex_->delta;
   }
 
@@ -564,13 +626,20 @@ Result<PropertyValue> VertexAccessor::GetProperty(PropertyId property, View view
   if (delta && transaction_->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
-    auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
+    auto const useCache = transaction_->UseManyDeltasCache();
     if (useCache) {
       auto const &cache = transaction_->manyDeltasCache;
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
       if (auto resProperty = cache.GetProperty(view, vertex_, property); resProperty) return {*resProperty};
     }
 
+    if (auto version = FindVertexVersion(vertex_, delta, transaction_)) {
+      if (!version->exists) return Error::NONEXISTENT_OBJECT;
+      if (!for_deleted_ && version->deleted) return Error::DELETED_OBJECT;
+      auto it = version->properties.find(property);
+      return it != version->properties.end() ? it->second : PropertyValue();
+    }
+
     auto const n_processed =
         ApplyDeltasForRead(transaction_, delta, view, [&exists, &deleted, &value, property](const Delta &delta) {
           // clang-format off
@@ -588,6 +657,7 @@ Result<PropertyValue> VertexAccessor::GetProperty(PropertyId property, View view
       cache.StoreDeleted(view, vertex_, deleted);
       cache.StoreProperty(view, vertex_, property, value);
     }
+    MaterializeVertexVersion(vertex_, transaction_, n_processed);
   }
 
   if (!exists) return Error::NONEXISTENT_OBJECT;
@@ -595,6 +665,78 @@ Result<PropertyValue> VertexAccessor::GetProperty(PropertyId property, View view
   return std::move(value);
 }
 
+Result<std::vector<PropertyValue>> VertexAccessor::GetProperties(std::span<PropertyId const> properties,
+                                                                 View view) const {
+  bool exists = true;
+  bool deleted = false;
+  std::vector<PropertyValue> values;
+  Delta *delta = nullptr;
+  {
+    auto guard = std::shared_lock{vertex_->lock};
+    deleted = vertex_->deleted;
+    values = vertex_->properties.GetProperties(properties);
+    CountPropertiesRead(*vertex_);
+    delta = vertex_->delta;
+  }
+
+  // Checking cache has a cost, only do it if we have any deltas
+  // if we have no deltas then what we already have from the vertex is correct.
+  if (delta && transaction_->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
+    // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
+    // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
+    auto const useCache = transaction_->UseManyDeltasCache();
+    if (useCache) {
+      auto const &cache = transaction_->manyDeltasCache;
+      if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
+      auto cached_values = std::vector<PropertyValue>{};
+      cached_values.reserve(properties.size());
+      for (auto property : properties) {
+        auto resProperty = cache.GetProperty(view, vertex_, property);
+        if (!resProperty) break;
+        cached_values.emplace_back(*resProperty);
+      }
+      if (cached_values.size() == properties.size()) return std::move(cached_values);
+    }
+
+    if (auto version = FindVertexVersion(vertex_, delta, transaction_)) {
+      if (!version->exists) return Error::NONEXISTENT_OBJECT;
+      if (!for_deleted_ && version->deleted) return Error::DELETED_OBJECT;
+      auto version_values = std::vector<PropertyValue>{};
+      version_values.reserve(properties.size());
+      for (auto property : properties) {
+        auto it = version->properties.find(property);
+        version_values.emplace_back(it != version->properties.end() ? it->second : PropertyValue());
+      }
+      return std::move(version_values);
+    }
+
+    auto const n_processed = ApplyDeltasForRead(
+        transaction_, delta, view, [&exists, &deleted, &values, properties](const Delta &delta) {
+          // clang-format off
+          DeltaDispatch(delta, utils::ChainedOverloaded{
+            Deleted_ActionMethod(deleted),
+            Exists_ActionMethod(exists),
+            PropertyValues_ActionMethod(values, properties)
+          });
+          // clang-format on
+        });
+
+    if (useCache && n_processed >= FLAGS_delta_chain_cache_threshold) {
+      auto &cache = transaction_->manyDeltasCache;
+      cache.StoreExists(view, vertex_, exists);
+      cache.StoreDeleted(view, vertex_, deleted);
+      for (size_t i = 0; i < properties.size(); ++i) {
+        cache.StoreProperty(view, vertex_, properties[i], values[i]);
+      }
+    }
+    MaterializeVertexVersion(vertex_, transaction_, n_processed);
+  }
+
+  if (!exists) return Error::NONEXISTENT_OBJECT;
+  if (!for_deleted_ && deleted) return Error::DELETED_OBJECT;
+  return std::move(values);
+}
+
 Result<uint64_t> VertexAccessor::GetPropertySize(PropertyId property, View view) const {
   {
     auto guard = std::shared_lock{vertex_->lock};
@@ -624,6 +766,7 @@ Result<std::map<PropertyId, PropertyValue>> VertexAccessor::Properties(View view
     auto guard = std::shared_lock{vertex_->lock};
     deleted = vertex_->deleted;
     properties = vertex_->properties.Properties();
+    CountPropertiesRead(*vertex_);
     delta = vertex_->delta;
   }
 
@@ -632,13 +775,19 @@ Result<std::map<PropertyId, PropertyValue>> VertexAccessor::Properties(View view
   if (delta && transaction_->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
-    auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
+    auto const useCache = transaction_->UseManyDeltasCache();
     if (useCache) {
       auto const &cache = transaction_->manyDeltasCache;
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
       if (auto resProperties = cache.GetProperties(view, vertex_); resProperties) return {*resProperties};
     }
 
+    if (auto version = FindVertexVersion(vertex_, delta, transaction_)) {
+      if (!version->exists) return Error::NONEXISTENT_OBJECT;
+      if (!for_deleted_ && version->deleted) return Error::DELETED_OBJECT;
+      return version->properties;
+    }
+
     auto const n_processed =
         ApplyDeltasForRead(transaction_, delta, view, [&exists, &deleted, &properties](const Delta &delta) {
           // clang-format off
@@ -656,6 +805,7 @@ Result<std::map<PropertyId, PropertyValue>> VertexAccessor::Properties(View view
       cache.StoreDeleted(view, vertex_, deleted);
       cache.StoreProperties(view, vertex_, properties);
     }
+    MaterializeVertexVersion(vertex_, transaction_, n_processed);
   }
 
   if (!exists) return Error::NONEXISTENT_OBJECT;
@@ -741,6 +891,7 @@ Result<EdgesVertexAccessorResult> VertexAccessor::InEdges(View view, const std::
   auto in_edges = edge_store{};
   Delta *delta = nullptr;
   int64_t expanded_count = 0;
+  if (!edge_types.empty() && !transaction_->IsDiskStorage()) GroupHubEdges(vertex_, EdgeDirection::IN);
   {
     auto guard = std::shared_lock{vertex_->lock};
     deleted = vertex_->deleted;
@@ -757,7 +908,7 @@ Result<EdgesVertexAccessorResult> VertexAccessor::InEdges(View view, const std::
   if (delta && transaction_->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
-    auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
+    auto const useCache = transaction_->UseManyDeltasCache();
     if (useCache) {
       auto const &cache = transaction_->manyDeltasCache;
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
@@ -825,6 +976,7 @@ Result<EdgesVertexAccessorResult> VertexAccessor::OutEdges(View view, const std:
   auto out_edges = edge_store{};
   Delta *delta = nullptr;
   int64_t expanded_count = 0;
+  if (!edge_types.empty() && !transaction_->IsDiskStorage()) GroupHubEdges(vertex_, EdgeDirection::OUT);
   {
     auto guard = std::shared_lock{vertex_->lock};
     deleted = vertex_->deleted;
@@ -842,7 +994,7 @@ Result<EdgesVertexAccessorResult> VertexAccessor::OutEdges(View view, const std:
   if (delta && transaction_->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
-    auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
+    auto const useCache = transaction_->UseManyDeltasCache();
     if (useCache) {
       auto const &cache = transaction_->manyDeltasCache;
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
@@ -906,7 +1058,7 @@ Result<size_t> VertexAccessor::InDegree(View view) const {
   if (delta && transaction_->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
-    auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
+    auto const useCache = transaction_->UseManyDeltasCache();
     if (useCache) {
       auto const &cache = transaction_->manyDeltasCache;
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
@@ -962,7 +1114,7 @@ Result<size_t> VertexAccessor::OutDegree(View view) const {
   if (delta && transaction_->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
     // IsolationLevel::READ_COMMITTED would be tricky to propagate invalidation to
     // so for now only cache for IsolationLevel::SNAPSHOT_ISOLATION
-    auto const useCache = transaction_->isolation_level == IsolationLevel::SNAPSHOT_ISOLATION;
+    auto const useCache = transaction_->UseManyDeltasCache();
     if (useCache) {
       auto const &cache = transaction_->manyDeltasCache;
       if (auto resError = HasError(view, cache, vertex_, for_deleted_); resError) return *resError;
@@ -993,18 +1145,74 @@ Result<size_t> VertexAccessor::OutDegree(View view) const {
   return degree;
 }
 
+Result<size_t> VertexAccessor::InDegree(View view, EdgeTypeId edge_type) const {
+  return DegreeOfType(view, edge_type, EdgeDirection::IN);
+}
+
+Result<size_t> VertexAccessor::OutDegree(View view, EdgeTypeId edge_type) const {
+  return DegreeOfType(view, edge_type, EdgeDirection::OUT);
+}
+
+Result<size_t> VertexAccessor::DegreeOfType(View view, EdgeTypeId edge_type, EdgeDirection direction) const {
+  if (transaction_->IsDiskStorage()) {
+    auto res = direction == EdgeDirection::IN ? InEdges(view, {edge_type}) : OutEdges(view, {edge_type});
+    if (res.HasValue()) {
+      return res->edges.size();
+    }
+    return res.GetError();
+  }
+
+  GroupHubEdges(vertex_, direction);
+
+  bool exists = true;
+  bool deleted = false;
+  size_t degree = 0;
+  Delta *delta = nullptr;
+  {
+    auto guard = std::shared_lock{vertex_->lock};
+    deleted = vertex_->deleted;
+    const auto &edges = VertexEdges(*vertex_, direction);
+    if (EdgesGroupedByType(*vertex_, direction)) {
+      auto [first, last] = EdgesOfType(edges, edge_type);
+      degree = std::distance(first, last);
+    } else {
+      degree = std::count_if(edges.begin(), edges.end(),
+                             [edge_type](const auto &edge) { return std::get<0>(edge) == edge_type; });
+    }
+    delta = vertex_->delta;
+  }
+
+  if (delta && transaction_->isolation_level != IsolationLevel::READ_UNCOMMITTED) {
+    auto apply = [&](auto action_method) {
+      ApplyDeltasForRead(transaction_, delta, view, [&](const Delta &delta) {
+        // clang-format off
+        DeltaDispatch(delta, utils::ChainedOverloaded{
+          Deleted_ActionMethod(deleted),
+          Exists_ActionMethod(exists),
+          action_method
+        });
+        // clang-format on
+      });
+    };
+    if (direction == EdgeDirection::IN) {
+      apply(DegreeOfType_ActionMethod<EdgeDirection::IN>(degree, edge_type));
+    } else {
+      apply(DegreeOfType_ActionMethod<EdgeDirection::OUT>(degree, edge_type));
+    }
+  }
+
+  if (!exists) return Error::NONEXISTENT_OBJECT;
+  if (!for_deleted_ && deleted) return Error::DELETED_OBJECT;
+  return degree;
+}
+
 int64_t VertexAccessor::HandleExpansionsWithoutEdgeTypes(edge_store &result_edges, query::HopsLimit *hops_limit,
                                                          EdgeDirection direction) const {
   int64_t expanded_count = 0;
   const auto &edges = direction == EdgeDirection::IN ? vertex_->in_edges : vertex_->out_edges;
   if (hops_limit && hops_limit->IsUsed()) {
-    if (hops_limit->LeftHops() == 0 && static_cast<int64_t>(edges.size()) > 0) {
-      hops_limit->limit_reached = true;
-    } else {
-      expanded_count = std::min(hops_limit->LeftHops(), static_cast<int64_t>(edges.size()));
-      hops_limit->IncrementHopsCount(expanded_count);
-      std::copy_n(edges.begin(), expanded_count, std::back_inserter(result_edges));
-    }
+    expanded_count = hops_limit->TakeHops(static_cast<int64_t>(edges.size()));
+    std::copy_n(edges.begin(), expanded_count, std::back_inserter(result_edges));
   } else {
     expanded_count = static_cast<int64_t>(edges.size());
     result_edges = edges;
@@ -1018,6 +1226,30 @@ int64_t VertexAccessor::HandleExpansionsWithEdgeTypes(edge_store &result_edges,
                                                       EdgeDirection direction) const {
   int64_t expanded_count = 0;
   const auto &edges = direction == EdgeDirection::IN ? vertex_->in_edges : vertex_->out_edges;
+  auto expand = [&](auto first, auto last) {
+    for (auto it = first; it != last; ++it) {
+      const auto &[edge_type, vertex, edge] = *it;
+      if (hops_limit && hops_limit->IsUsed()) {
+        hops_limit->IncrementHopsCount(1);
+        if (hops_limit->IsLimitReached()) return false;
+      }
+      expanded_count++;
+      if (destination && vertex != destination->vertex_) continue;
+      result_edges.emplace_back(edge_type, vertex, edge);
+    }
+    return true;
+  };
+  if (!edge_types.empty() && EdgesGroupedByType(*vertex_, direction)) {
+    // Only the ranges of the requested edge types have to be visited
+    auto sorted_edge_types = edge_types;
+    std::sort(sorted_edge_types.begin(), sorted_edge_types.end());
+    sorted_edge_types.erase(std::unique(sorted_edge_types.begin(), sorted_edge_types.end()), sorted_edge_types.end());
+    for (auto edge_type : sorted_edge_types) {
+      auto [first, last] = EdgesOfType(edges, edge_type);
+      if (!expand(first, last)) break;
+    }
+    return expanded_count;
+  }
   for (const auto &[edge_type, vertex, edge] : edges) {
     if (hops_limit && hops_limit->IsUsed()) {
       hops_limit->IncrementHopsCount(1);
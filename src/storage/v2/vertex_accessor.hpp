@@ -12,6 +12,9 @@
 #pragma once
 
 #include <optional>
+#include <span>
+
+#include <gflags/gflags.h>
 
 #include "storage/v2/vertex.hpp"
 
@@ -22,6 +25,8 @@
 #include "storage/v2/view.hpp"
 #include "utils/small_vector.hpp"
 
+DECLARE_uint64(adjacency_grouping_threshold);
+
 namespace memgraph::storage {
 
 class EdgeAccessor;
@@ -43,6 +48,8 @@ class VertexAccessor final {
                                         const std::vector<EdgeTypeId> &edge_types, const VertexAccessor *destination,
                                         query::HopsLimit *hops_limit, EdgeDirection direction) const;
 
+  Result<size_t> DegreeOfType(View view, EdgeTypeId edge_type, EdgeDirection direction) const;
+
  public:
   VertexAccessor(Vertex *vertex, Storage *storage, Transaction *transaction, bool for_deleted = false)
       : vertex_(vertex), storage_(storage), transaction_(transaction), for_deleted_(for_deleted) {}
@@ -90,6 +97,12 @@ class VertexAccessor final {
   /// @throw std::bad_alloc
   Result<PropertyValue> GetProperty(PropertyId property, View view) const;
 
+  /// Returns the values of `properties`, in the same order. Properties that
+  /// don't exist are returned as Null values. All of the properties are read in
+  /// a single pass over the vertex and its delta chain.
+  /// @throw std::bad_alloc
+  Result<std::vector<PropertyValue>> GetProperties(std::span<PropertyId const> properties, View view) const;
+
   /// Returns the size of the encoded vertex property in bytes.
   Result<uint64_t> GetPropertySize(PropertyId property, View view) const;
 
@@ -121,6 +134,14 @@ class VertexAccessor final {
 
   Result<size_t> OutDegree(View view) const;
 
+  /// Number of edges of the given type. Mutations are applied through the
+  /// delta chain like for the untyped degree; the current count is read with
+  /// a binary search if the edges are grouped by type, see
+  /// `adjacency_grouping_threshold`.
+  Result<size_t> InDegree(View view, EdgeTypeId edge_type) const;
+
+  Result<size_t> OutDegree(View view, EdgeTypeId edge_type) const;
+
   Gid Gid() const noexcept { return vertex_->gid; }
 
   bool operator==(const VertexAccessor &other) const noexcept {
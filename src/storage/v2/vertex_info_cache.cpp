@@ -13,12 +13,14 @@
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/view.hpp"
+#include "utils/event_counter.hpp"
 #include "utils/flag_validation.hpp"
 #include "utils/small_vector.hpp"
 
 #include <functional>
 #include <optional>
 #include <span>
+#include <utility>
 
 // NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
 DEFINE_VALIDATED_uint64(delta_chain_cache_threshold, 128,
@@ -26,20 +28,33 @@ DEFINE_VALIDATED_uint64(delta_chain_cache_threshold, 128,
                         "workloads where repeated processing of delta chains can become costly.",
                         { return value > 0; });
 
+namespace memgraph::metrics {
+extern const Event VertexInfoCacheHits;
+extern const Event VertexInfoCacheMisses;
+}  // namespace memgraph::metrics
+
 namespace memgraph::storage {
 
 /// Helpers to reduce typo errors
 template <typename Ret, typename Func, typename... Keys>
 auto FetchHelper(VertexInfoCache const &caches, Func &&getCache, View view, Keys &&...keys)
     -> std::optional<std::conditional_t<std::is_trivially_copyable_v<Ret>, Ret, std::reference_wrapper<Ret const>>> {
+  if (!caches.enabled_) return std::nullopt;
   auto const &cache = (view == View::OLD) ? getCache(caches.old_) : getCache(caches.new_);
   // check empty first, cheaper than the relative cost of doing an actual hash + find
-  if (cache.empty()) return std::nullopt;
+  if (cache.empty()) {
+    ++caches.misses_;
+    return std::nullopt;
+  }
 
   // defer building the key, maybe a cost at construction
   using key_type = typename std::remove_cvref_t<decltype(cache)>::key_type;
   auto const it = cache.find(key_type{std::forward<Keys>(keys)...});
-  if (it == cache.end()) return std::nullopt;
+  if (it == cache.end()) {
+    ++caches.misses_;
+    return std::nullopt;
+  }
+  ++caches.hits_;
 
   if constexpr (std::is_trivially_copyable_v<Ret>) {
     return {it->second};
@@ -51,13 +66,38 @@ auto FetchHelper(VertexInfoCache const &caches, Func &&getCache, View view, Keys
 
 template <typename Value, typename Func, typename... Keys>
 void Store(Value &&value, VertexInfoCache &caches, Func &&getCache, View view, Keys &&...keys) {
+  caches.enabled_ = true;
   auto &cache = (view == View::OLD) ? getCache(caches.old_) : getCache(caches.new_);
   using key_type = typename std::remove_cvref_t<decltype(cache)>::key_type;
   cache.emplace(key_type{std::forward<Keys>(keys)...}, std::forward<Value>(value));
 }
 
-VertexInfoCache::VertexInfoCache(VertexInfoCache &&) noexcept = default;
-VertexInfoCache &VertexInfoCache::operator=(VertexInfoCache &&) noexcept = default;
+VertexInfoCache::VertexInfoCache(VertexInfoCache &&other) noexcept
+    : old_(std::move(other.old_)),
+      new_(std::move(other.new_)),
+      enabled_(std::exchange(other.enabled_, false)),
+      hits_(std::exchange(other.hits_, 0)),
+      misses_(std::exchange(other.misses_, 0)) {}
+
+VertexInfoCache &VertexInfoCache::operator=(VertexInfoCache &&other) noexcept {
+  if (this == &other) return *this;
+  FlushStats();
+  old_ = std::move(other.old_);
+  new_ = std::move(other.new_);
+  enabled_ = std::exchange(other.enabled_, false);
+  hits_ = std::exchange(other.hits_, 0);
+  misses_ = std::exchange(other.misses_, 0);
+  return *this;
+}
+
+VertexInfoCache::~VertexInfoCache() { FlushStats(); }
+
+void VertexInfoCache::FlushStats() {
+  if (hits_ != 0) metrics::IncrementCounter(metrics::VertexInfoCacheHits, hits_);
+  if (misses_ != 0) metrics::IncrementCounter(metrics::VertexInfoCacheMisses, misses_);
+  hits_ = 0;
+  misses_ = 0;
+}
 
 auto VertexInfoCache::GetExists(View view, Vertex const *vertex) const -> std::optional<bool> {
   return FetchHelper<bool>(*this, std::mem_fn(&Caches::existsCache_), view, vertex);
@@ -73,6 +113,7 @@ void VertexInfoCache::StoreDeleted(View view, Vertex const *vertex, bool res) {
 }
 
 void VertexInfoCache::Invalidate(Vertex const *vertex) {
+  if (!enabled_) return;
   new_.existsCache_.erase(vertex);
   new_.deletedCache_.erase(vertex);
   new_.labelCache_.erase(vertex);
@@ -102,6 +143,7 @@ void VertexInfoCache::StoreHasLabel(View view, Vertex const *vertex, LabelId lab
   Store(res, *this, std::mem_fn(&Caches::hasLabelCache_), view, vertex, label);
 }
 void VertexInfoCache::Invalidate(Vertex const *vertex, LabelId label) {
+  if (!enabled_) return;
   new_.labelCache_.erase(vertex);
   new_.hasLabelCache_.erase(std::tuple{vertex, label});
 }
@@ -121,6 +163,7 @@ void VertexInfoCache::StoreProperties(View view, Vertex const *vertex, std::map<
   Store(std::move(properties), *this, std::mem_fn(&Caches::propertiesCache_), view, vertex);
 }
 void VertexInfoCache::Invalidate(Vertex const *vertex, PropertyId property_key) {
+  if (!enabled_) return;
   new_.propertiesCache_.erase(vertex);
   new_.propertyValueCache_.erase(std::tuple{vertex, property_key});
 }
@@ -163,6 +206,7 @@ void VertexInfoCache::StoreOutDegree(View view, Vertex const *vertex, std::size_
 }
 
 void VertexInfoCache::Invalidate(Vertex const *vertex, EdgeTypeId /*unused*/, EdgeDirection direction) {
+  if (!enabled_) return;
   // EdgeTypeId is currently unused but could be used to be more precise in future
   if (direction == EdgeDirection::IN) {
     new_.inDegreeCache_.erase(vertex);
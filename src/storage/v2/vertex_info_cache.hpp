@@ -45,10 +45,16 @@ struct Transaction;
  * - transaction_id
  * - command_id
  * - only for View::OLD
+ *
+ * Most transactions never see a long delta chain, so the cache starts out
+ * disabled: lookups and invalidations are no-ops until the first result is
+ * stored, which only happens once a chain of at least
+ * `delta_chain_cache_threshold` deltas was walked. The hits and misses of an
+ * enabled cache are reported to the metrics when the cache is destroyed.
  */
 struct VertexInfoCache final {
   VertexInfoCache() = default;
-  ~VertexInfoCache() = default;
+  ~VertexInfoCache();
 
   // By design would be a mistake to copy the cache
   VertexInfoCache(VertexInfoCache const &) = delete;
@@ -112,6 +118,7 @@ struct VertexInfoCache final {
 
   void Invalidate(Vertex const *vertex, EdgeTypeId /*unused*/, EdgeDirection direction);
 
+  /// Clears the cached results, the cache stays enabled.
   void Clear();
 
  private:
@@ -159,6 +166,11 @@ struct VertexInfoCache final {
   };
   Caches old_;
   Caches new_;
+  bool enabled_{false};
+  mutable uint64_t hits_{0};
+  mutable uint64_t misses_{0};
+
+  void FlushStats();
 
   // Helpers
   template <typename Ret, typename Func, typename... Keys>
@@ -11,6 +11,7 @@
 #pragma once
 
 #include <algorithm>
+#include <span>
 #include <tuple>
 #include <vector>
 
@@ -121,6 +122,15 @@ inline auto PropertyValue_ActionMethod(PropertyValue &value, PropertyId property
   });
 }
 
+inline auto PropertyValues_ActionMethod(std::vector<PropertyValue> &values, std::span<PropertyId const> properties) {
+  using enum Delta::Action;
+  return ActionMethod<SET_PROPERTY>([&, properties](Delta const &delta) {
+    for (size_t i = 0; i < properties.size(); ++i) {
+      if (properties[i] == delta.property.key) values[i] = *delta.property.value;
+    }
+  });
+}
+
 inline auto PropertyValueMatch_ActionMethod(bool &match, PropertyId property, PropertyValue const &value) {
   using enum Delta::Action;
   return ActionMethod<SET_PROPERTY>([&, property](Delta const &delta) {
@@ -204,6 +214,21 @@ inline auto Degree_ActionMethod(size_t &degree) {
   // clang-format on
 }
 
+template <EdgeDirection dir>
+inline auto DegreeOfType_ActionMethod(size_t &degree, EdgeTypeId edge_type) {
+  using enum Delta::Action;
+  // clang-format off
+  return utils::Overloaded{
+    ActionMethod <(dir == EdgeDirection::IN) ? ADD_IN_EDGE : ADD_OUT_EDGE> (
+      [&](Delta const &delta) { if (delta.vertex_edge.edge_type == edge_type) ++degree; }
+    ),
+    ActionMethod <(dir == EdgeDirection::IN) ? REMOVE_IN_EDGE : REMOVE_OUT_EDGE> (
+      [&](Delta const &delta) { if (delta.vertex_edge.edge_type == edge_type) --degree; }
+    ),
+  };
+  // clang-format on
+}
+
 inline auto HasError(View view, VertexInfoCache const &cache, Vertex const *vertex, bool for_deleted)
     -> std::optional<Error> {
   if (auto resExists = cache.GetExists(view, vertex); resExists && !resExists.value()) return Error::NONEXISTENT_OBJECT;
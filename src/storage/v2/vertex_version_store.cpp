@@ -0,0 +1,137 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/vertex_version_store.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+
+#include "storage/v2/delta.hpp"
+#include "storage/v2/transaction.hpp"
+#include "storage/v2/vertex.hpp"
+#include "storage/v2/vertex_info_helpers.hpp"
+#include "utils/variant_helpers.hpp"
+
+// NOLINTNEXTLINE (cppcoreguidelines-avoid-non-const-global-variables)
+DEFINE_uint64(delta_chain_materialize_threshold, 1024,
+              "The length of a delta chain after which the version of a vertex seen by a snapshot isolation "
+              "transaction is materialized and shared with all transactions seeing the same version. This is used "
+              "for long-running reads of heavily modified vertices. Set to 0 to disable.");
+
+namespace memgraph::storage {
+
+namespace {
+/// The timestamp of the deltas created by `transaction`, see `ApplyDeltasForRead`.
+uint64_t OwnTimestamp(Transaction const *transaction) {
+  return transaction->commit_timestamp ? transaction->commit_timestamp->load(std::memory_order_acquire)
+                                       : transaction->transaction_id;
+}
+}  // namespace
+
+std::shared_ptr<VertexVersion const> VertexVersionStore::Find(Vertex const *vertex, Delta const *delta,
+                                                               Transaction const *transaction) const {
+  if (empty_.load(std::memory_order_acquire)) return nullptr;
+  // Uncommitted changes of the transaction itself are always at the head of
+  // the chain, committed ones could be anywhere.
+  auto const own_timestamp = OwnTimestamp(transaction);
+  if (own_timestamp < kTransactionInitialId || delta->timestamp->load(std::memory_order_acquire) == own_timestamp) {
+    return nullptr;
+  }
+
+  auto const start_timestamp = transaction->start_timestamp;
+  return versions_.WithReadLock([&](auto const &versions) -> std::shared_ptr<VertexVersion const> {
+    auto it = versions.find(vertex);
+    if (it == versions.end()) return nullptr;
+    for (auto const &version : it->second) {
+      if (version->valid_from < start_timestamp && start_timestamp <= version->valid_to) return version;
+    }
+    return nullptr;
+  });
+}
+
+void VertexVersionStore::Materialize(Vertex const *vertex, Transaction const *transaction) {
+  auto version = std::make_shared<VertexVersion>();
+  Delta const *delta = nullptr;
+  {
+    auto guard = std::shared_lock{vertex->lock};
+    version->deleted = vertex->deleted;
+    version->labels = vertex->labels;
+    version->properties = vertex->properties.Properties();
+    delta = vertex->delta;
+  }
+
+  // This is the walk done by `ApplyDeltasForRead` for a snapshot isolation
+  // transaction that doesn't have its own changes on the chain. While walking,
+  // it records the range of start timestamps that would apply the same
+  // deltas: everything after the newest commit that isn't applied, up to the
+  // oldest commit that is applied. Uncommitted deltas are applied by all of
+  // those transactions because they will get a larger commit timestamp.
+  auto const start_timestamp = transaction->start_timestamp;
+  auto const own_timestamp = OwnTimestamp(transaction);
+  version->valid_to = start_timestamp;
+  for (; delta != nullptr; delta = delta->next.load(std::memory_order_acquire)) {
+    auto const ts = delta->timestamp->load(std::memory_order_acquire);
+    if (ts < start_timestamp) {
+      version->valid_from = ts;
+      break;
+    }
+    if (ts == own_timestamp) return;
+    // Committed deltas further down the chain are older.
+    if (ts < kTransactionInitialId) version->valid_to = ts;
+
+    // clang-format off
+    DeltaDispatch(*delta, utils::ChainedOverloaded{
+      Deleted_ActionMethod(version->deleted),
+      Exists_ActionMethod(version->exists),
+      Labels_ActionMethod(version->labels),
+      Properties_ActionMethod(version->properties)
+    });
+    // clang-format on
+  }
+
+  versions_.WithLock([&](auto &versions) {
+    auto &vertex_versions = versions[vertex];
+    const bool exists = std::any_of(vertex_versions.begin(), vertex_versions.end(), [&](auto const &other) {
+      return other->valid_from < start_timestamp && start_timestamp <= other->valid_to;
+    });
+    if (!exists) vertex_versions.push_back(std::move(version));
+    empty_.store(false, std::memory_order_release);
+  });
+}
+
+void VertexVersionStore::CollectGarbage(uint64_t oldest_active_start_timestamp) {
+  if (empty_.load(std::memory_order_acquire)) return;
+  versions_.WithLock([&](auto &versions) {
+    for (auto it = versions.begin(); it != versions.end();) {
+      auto &vertex_versions = it->second;
+      auto new_end = std::remove_if(vertex_versions.begin(), vertex_versions.end(), [&](auto const &version) {
+        return version->valid_to < oldest_active_start_timestamp;
+      });
+      vertex_versions.erase(new_end, vertex_versions.end());
+      if (vertex_versions.empty()) {
+        versions.erase(it++);
+      } else {
+        ++it;
+      }
+    }
+    if (versions.empty()) empty_.store(true, std::memory_order_release);
+  });
+}
+
+void VertexVersionStore::Clear() {
+  versions_.WithLock([&](auto &versions) {
+    versions.clear();
+    empty_.store(true, std::memory_order_release);
+  });
+}
+
+}  // namespace memgraph::storage
@@ -0,0 +1,86 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <gflags/gflags.h>
+#include "absl/container/flat_hash_map.h"
+
+#include "storage/v2/id_types.hpp"
+#include "storage/v2/property_value.hpp"
+#include "utils/rw_spin_lock.hpp"
+#include "utils/small_vector.hpp"
+#include "utils/synchronized.hpp"
+
+DECLARE_uint64(delta_chain_materialize_threshold);
+
+namespace memgraph::storage {
+
+// forward declarations
+struct Delta;
+struct Vertex;
+struct Transaction;
+
+/// The version of a vertex as seen by snapshot isolation transactions with a
+/// start timestamp in `(valid_from, valid_to]`. Those transactions apply
+/// exactly the same deltas when reading the vertex, so they all see the same
+/// version and it doesn't change when new deltas are added to the chain.
+struct VertexVersion {
+  uint64_t valid_from{0};
+  uint64_t valid_to{0};
+  bool exists{true};
+  bool deleted{false};
+  utils::small_vector<LabelId> labels;
+  std::map<PropertyId, PropertyValue> properties;
+};
+
+/** Long-running snapshot isolation readers have to walk past every delta that
+ * was committed since they started, which gets slow for heavily modified
+ * vertices. Once a read walks a chain of at least
+ * `delta_chain_materialize_threshold` deltas, the whole version of the vertex
+ * is materialized and stored here, so later reads of the vertex by any
+ * transaction that sees the same version don't walk the chain at all.
+ *
+ * Versions are dropped by the GC once no active transaction can see them.
+ */
+class VertexVersionStore final {
+ public:
+  /// Returns the version of `vertex` visible to `transaction` or `nullptr` if
+  /// it wasn't materialized. `delta` is the head of the delta chain, read
+  /// under the vertex lock. Transactions with their own changes of the vertex
+  /// always have to walk the chain.
+  std::shared_ptr<VertexVersion const> Find(Vertex const *vertex, Delta const *delta,
+                                            Transaction const *transaction) const;
+
+  /// Materializes the version of `vertex` visible to `transaction`. Does
+  /// nothing if `transaction` changed the vertex itself.
+  void Materialize(Vertex const *vertex, Transaction const *transaction);
+
+  /// Drops all versions that aren't visible to transactions which started at
+  /// or after `oldest_active_start_timestamp`.
+  void CollectGarbage(uint64_t oldest_active_start_timestamp);
+
+  void Clear();
+
+ private:
+  using Versions = std::vector<std::shared_ptr<VertexVersion const>>;
+
+  utils::Synchronized<absl::flat_hash_map<Vertex const *, Versions>, utils::RWSpinLock> versions_;
+  std::atomic<bool> empty_{true};
+};
+
+}  // namespace memgraph::storage
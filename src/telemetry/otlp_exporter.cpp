@@ -0,0 +1,76 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#include "telemetry/otlp_exporter.hpp"
+
+#include <fmt/format.h>
+
+#include "requests/requests.hpp"
+#include "utils/logging.hpp"
+
+namespace memgraph::telemetry {
+
+namespace {
+// Spans sent in a single request.
+constexpr size_t kMaxSpansPerRequest = 2048;
+constexpr int kRequestTimeoutSec = 5;
+// SPAN_KIND_INTERNAL
+constexpr int kSpanKindInternal = 1;
+
+std::string HexId(uint64_t id) { return fmt::format("{:016x}", id); }
+}  // namespace
+
+nlohmann::json SpansToOtlpJson(const std::vector<utils::tracing::Span> &spans, const std::string &service_name) {
+  auto json_spans = nlohmann::json::array();
+  for (const auto &span : spans) {
+    auto json_span = nlohmann::json{{"traceId", HexId(span.trace_id_high) + HexId(span.trace_id_low)},
+                                    {"spanId", HexId(span.span_id)},
+                                    {"name", span.name},
+                                    {"kind", kSpanKindInternal},
+                                    // The 64-bit integers are strings in OTLP/JSON
+                                    {"startTimeUnixNano", std::to_string(span.start_ns)},
+                                    {"endTimeUnixNano", std::to_string(span.end_ns)}};
+    if (span.parent_span_id != 0) json_span["parentSpanId"] = HexId(span.parent_span_id);
+    json_spans.push_back(std::move(json_span));
+  }
+  auto service = nlohmann::json{{"key", "service.name"}, {"value", {{"stringValue", service_name}}}};
+  auto scope_spans = nlohmann::json{{"scope", {{"name", "memgraph"}}}, {"spans", std::move(json_spans)}};
+  auto resource_spans = nlohmann::json{{"resource", {{"attributes", nlohmann::json::array({std::move(service)})}}},
+                                       {"scopeSpans", nlohmann::json::array({std::move(scope_spans)})}};
+  return {{"resourceSpans", nlohmann::json::array({std::move(resource_spans)})}};
+}
+
+OtlpExporter::OtlpExporter(std::string endpoint, std::string service_name, std::chrono::milliseconds interval)
+    : url_(fmt::format("{}/v1/traces", endpoint.ends_with('/') ? endpoint.substr(0, endpoint.size() - 1) : endpoint)),
+      service_name_(std::move(service_name)) {
+  scheduler_.Run("OtlpExporter", interval, [this] { Export(); });
+}
+
+OtlpExporter::~OtlpExporter() {
+  scheduler_.Stop();
+  // Sends the spans finished since the last export.
+  Export();
+}
+
+void OtlpExporter::Export() {
+  while (true) {
+    const auto spans = utils::tracing::TakeSpans(kMaxSpansPerRequest);
+    if (spans.empty()) return;
+    if (!requests::RequestPostJson(url_, SpansToOtlpJson(spans, service_name_), kRequestTimeoutSec)) {
+      spdlog::trace("Couldn't send {} spans to {}", spans.size(), url_);
+      return;
+    }
+    if (spans.size() < kMaxSpansPerRequest) return;
+  }
+}
+
+}  // namespace memgraph::telemetry
@@ -0,0 +1,55 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <json/json.hpp>
+
+#include "utils/scheduler.hpp"
+#include "utils/tracing.hpp"
+
+namespace memgraph::telemetry {
+
+/// The spans as an OTLP/JSON ExportTraceServiceRequest.
+nlohmann::json SpansToOtlpJson(const std::vector<utils::tracing::Span> &spans, const std::string &service_name);
+
+/**
+ * Periodically sends the finished spans of the sampled traces to an
+ * OpenTelemetry collector over OTLP/HTTP with JSON encoding. The spans of a
+ * request which failed are dropped, so an unavailable collector doesn't hold
+ * any memory.
+ */
+class OtlpExporter final {
+ public:
+  /// @param endpoint base URL of the collector, the spans are sent to its
+  /// `/v1/traces` path.
+  OtlpExporter(std::string endpoint, std::string service_name, std::chrono::milliseconds interval);
+  ~OtlpExporter();
+
+  OtlpExporter(const OtlpExporter &) = delete;
+  OtlpExporter(OtlpExporter &&) = delete;
+  OtlpExporter &operator=(const OtlpExporter &) = delete;
+  OtlpExporter &operator=(OtlpExporter &&) = delete;
+
+ private:
+  void Export();
+
+  const std::string url_;
+  const std::string service_name_;
+  utils::Scheduler scheduler_;
+};
+
+}  // namespace memgraph::telemetry
@@ -0,0 +1,169 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#include "utils/allocator/small_block_pool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <mutex>
+
+#include "utils/spin_lock.hpp"
+
+namespace memgraph::utils {
+
+namespace {
+
+constexpr std::size_t kSizeClasses = SmallBlockPool::kMaxBlockSize / SmallBlockPool::kGranularity;
+
+struct FreeBlock {
+  FreeBlock *next;
+};
+
+struct FreeList {
+  FreeBlock *head{nullptr};
+  std::size_t count{0};
+
+  void Push(FreeBlock *block) {
+    block->next = head;
+    head = block;
+    ++count;
+  }
+
+  FreeBlock *Pop() {
+    auto *block = head;
+    head = block->next;
+    --count;
+    return block;
+  }
+
+  // Moves up to `n` blocks to the front of `other`.
+  void MoveTo(FreeList &other, std::size_t n) {
+    for (; n != 0 && head != nullptr; --n) other.Push(Pop());
+  }
+};
+
+constexpr std::size_t BlockSize(std::size_t size_class) { return (size_class + 1) * SmallBlockPool::kGranularity; }
+
+// Blocks a thread exchanges with the shared free list at a time, about a page worth.
+constexpr std::size_t BatchSize(std::size_t size_class) {
+  return std::max<std::size_t>(16, 4096 / BlockSize(size_class));
+}
+
+struct SharedFreeList {
+  SpinLock lock;
+  FreeList blocks;
+};
+
+// Never destroyed, the thread caches are flushed into it until the process exits.
+std::array<SharedFreeList, kSizeClasses> &SharedFreeLists() {
+  static auto *lists = new std::array<SharedFreeList, kSizeClasses>{};
+  return *lists;
+}
+
+struct ThreadCache {
+  std::array<FreeList, kSizeClasses> lists{};
+
+  ThreadCache() = default;
+  ThreadCache(const ThreadCache &) = delete;
+  ThreadCache &operator=(const ThreadCache &) = delete;
+  ThreadCache(ThreadCache &&) = delete;
+  ThreadCache &operator=(ThreadCache &&) = delete;
+  ~ThreadCache();
+
+  void Flush(std::size_t size_class, std::size_t n) {
+    auto &shared = SharedFreeLists()[size_class];
+    auto guard = std::lock_guard{shared.lock};
+    lists[size_class].MoveTo(shared.blocks, n);
+  }
+
+  void FlushAll() {
+    for (std::size_t size_class = 0; size_class != kSizeClasses; ++size_class) {
+      if (lists[size_class].count != 0) Flush(size_class, lists[size_class].count);
+    }
+  }
+};
+
+// Blocks freed by the thread after its cache is destroyed go to the shared lists.
+thread_local bool thread_cache_destroyed{false};
+
+ThreadCache::~ThreadCache() {
+  FlushAll();
+  thread_cache_destroyed = true;
+}
+
+ThreadCache &CurrentThreadCache() {
+  thread_local ThreadCache cache;
+  return cache;
+}
+
+void RefillFromSlab(FreeList &list, std::size_t size_class) {
+  auto const block_size = BlockSize(size_class);
+  auto *slab = static_cast<std::byte *>(operator new (SmallBlockPool::kSlabSize, std::align_val_t{64}));
+  for (auto offset = (SmallBlockPool::kSlabSize / block_size) * block_size; offset != 0; offset -= block_size) {
+    list.Push(reinterpret_cast<FreeBlock *>(slab + offset - block_size));
+  }
+}
+
+}  // namespace
+
+void *SmallBlockPool::AllocateBlock(std::size_t size_class) {
+  if (thread_cache_destroyed) [[unlikely]] {
+    auto &shared = SharedFreeLists()[size_class];
+    auto guard = std::lock_guard{shared.lock};
+    if (shared.blocks.head == nullptr) RefillFromSlab(shared.blocks, size_class);
+    return shared.blocks.Pop();
+  }
+
+  auto &list = CurrentThreadCache().lists[size_class];
+  if (list.head == nullptr) [[unlikely]] {
+    auto &shared = SharedFreeLists()[size_class];
+    {
+      auto guard = std::lock_guard{shared.lock};
+      shared.blocks.MoveTo(list, BatchSize(size_class));
+    }
+    if (list.head == nullptr) {
+      // The thread takes a batch of the new slab, the other threads can take the rest
+      FreeList slab;
+      RefillFromSlab(slab, size_class);
+      slab.MoveTo(list, BatchSize(size_class));
+      auto guard = std::lock_guard{shared.lock};
+      slab.MoveTo(shared.blocks, slab.count);
+    }
+  }
+  return list.Pop();
+}
+
+void SmallBlockPool::DeallocateBlock(void *ptr, std::size_t size_class) noexcept {
+  auto *block = static_cast<FreeBlock *>(ptr);
+  if (thread_cache_destroyed) [[unlikely]] {
+    auto &shared = SharedFreeLists()[size_class];
+    auto guard = std::lock_guard{shared.lock};
+    shared.blocks.Push(block);
+    return;
+  }
+
+  auto &cache = CurrentThreadCache();
+  auto &list = cache.lists[size_class];
+  list.Push(block);
+  // Two batches are kept, so a thread which allocates and frees around the bound doesn't exchange on every block
+  if (list.count > 2 * BatchSize(size_class)) [[unlikely]] {
+    cache.Flush(size_class, BatchSize(size_class));
+  }
+}
+
+void SmallBlockPool::FlushThreadCache() noexcept {
+  if (thread_cache_destroyed) return;
+  CurrentThreadCache().FlushAll();
+}
+
+}  // namespace memgraph::utils
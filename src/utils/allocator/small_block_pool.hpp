@@ -0,0 +1,68 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+namespace memgraph::utils {
+
+/// Pool of small blocks in size classes of `kGranularity` bytes up to
+/// `kMaxBlockSize`, used for the buffers of the objects which are created and
+/// destroyed in large numbers (property buffers, adjacency lists).
+/// - each thread keeps a free list per size class, so most allocations and
+///   frees don't synchronize
+/// - the threads exchange batches of blocks with the shared free lists of the
+///   pool, a thread which only frees (e.g. the GC) returns its blocks to the
+///   threads which allocate
+/// - blocks are carved from slabs of `kSlabSize`, the blocks of a size class
+///   allocated together are close together
+/// - slabs are never released, freed blocks are reused for the same size class
+///
+/// Larger or over-aligned requests go through `operator new`, so `Deallocate`
+/// must be called with the same size and alignment as `Allocate`.
+class SmallBlockPool {
+ public:
+  static constexpr std::size_t kGranularity = 8;
+  static constexpr std::size_t kMaxBlockSize = 256;
+  static constexpr std::size_t kSlabSize = 64UL * 1024;
+
+  static constexpr bool IsPooled(std::size_t size, std::size_t alignment) {
+    return size != 0 && size <= kMaxBlockSize && alignment <= kGranularity;
+  }
+
+  static void *Allocate(std::size_t size, std::size_t alignment = kGranularity) {
+    if (!IsPooled(size, alignment)) return operator new (size, std::align_val_t{alignment});
+    return AllocateBlock(SizeClass(size));
+  }
+
+  static void Deallocate(void *ptr, std::size_t size, std::size_t alignment = kGranularity) noexcept {
+    if (!IsPooled(size, alignment)) {
+      operator delete (ptr, std::align_val_t{alignment});
+      return;
+    }
+    DeallocateBlock(ptr, SizeClass(size));
+  }
+
+  /// Returns the blocks cached by the current thread to the shared free lists.
+  static void FlushThreadCache() noexcept;
+
+ private:
+  static constexpr std::size_t SizeClass(std::size_t size) { return (size - 1) / kGranularity; }
+
+  /// @throw std::bad_alloc
+  static void *AllocateBlock(std::size_t size_class);
+  static void DeallocateBlock(void *ptr, std::size_t size_class) noexcept;
+};
+
+}  // namespace memgraph::utils
@@ -0,0 +1,60 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+namespace memgraph::utils {
+
+/// Notified when the thread it's set on starts and stops waiting on I/O, so
+/// that the pool which owns the thread can run its other work meanwhile.
+class BlockingObserver {
+ public:
+  virtual void OnBlock() = 0;
+  virtual void OnUnblock() = 0;
+
+ protected:
+  BlockingObserver() = default;
+  BlockingObserver(const BlockingObserver &) = default;
+  BlockingObserver &operator=(const BlockingObserver &) = default;
+  BlockingObserver(BlockingObserver &&) = default;
+  BlockingObserver &operator=(BlockingObserver &&) = default;
+  ~BlockingObserver() = default;
+};
+
+namespace detail {
+inline thread_local BlockingObserver *blocking_observer = nullptr;
+}  // namespace detail
+
+/// Sets the observer notified by the `BlockingSection`s of the calling thread.
+inline void SetBlockingObserver(BlockingObserver *observer) { detail::blocking_observer = observer; }
+
+/// Marks the calling thread as waiting on I/O while in scope, e.g. while a
+/// query waits for the next part of a downloaded file.
+class [[nodiscard]] BlockingSection {
+ public:
+  BlockingSection() : observer_{detail::blocking_observer} {
+    if (observer_) observer_->OnBlock();
+  }
+
+  BlockingSection(const BlockingSection &) = delete;
+  BlockingSection &operator=(const BlockingSection &) = delete;
+  BlockingSection(BlockingSection &&) = delete;
+  BlockingSection &operator=(BlockingSection &&) = delete;
+
+  ~BlockingSection() {
+    if (observer_) observer_->OnUnblock();
+  }
+
+ private:
+  BlockingObserver *observer_;
+};
+
+}  // namespace memgraph::utils
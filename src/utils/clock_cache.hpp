@@ -0,0 +1,158 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "utils/sharded_rw_lock.hpp"
+
+namespace memgraph::utils {
+
+/// A concurrent cache which holds at most `capacity` entries. The entries are
+/// split into shards by the hash of their key and each shard is locked on its
+/// own, so there is no lock shared by all the users of the cache.
+///
+/// Each shard evicts its entries with the CLOCK algorithm: a hit marks the
+/// entry as referenced and, when the shard is full, the hand of the clock
+/// clears the marks of the entries it passes until it reaches an unmarked one,
+/// which is evicted. Unlike with LRU, a hit doesn't reorder the entries, so
+/// `get` takes the shard lock only for reading.
+template <class TKey, class TVal, class THash = std::hash<TKey>>
+class ClockCache {
+ public:
+  static constexpr size_t kDefaultShards = 16;
+
+  explicit ClockCache(size_t capacity, size_t num_shards = kDefaultShards) : capacity_(capacity) {
+    num_shards = std::max<size_t>(1, std::min(num_shards, capacity));
+    shards_.reserve(num_shards);
+    for (size_t i = 0; i < num_shards; ++i) {
+      shards_.emplace_back(std::make_unique<Shard>(capacity / num_shards + (i < capacity % num_shards ? 1 : 0)));
+    }
+  }
+
+  std::optional<TVal> get(const TKey &key) const {
+    const auto &shard = ShardOf(key);
+    auto guard = std::shared_lock{shard.lock};
+    auto found = shard.index.find(key);
+    if (found == shard.index.end()) return std::nullopt;
+    auto &slot = shard.slots[found->second];
+    slot.referenced.store(true, std::memory_order_relaxed);
+    return slot.value;
+  }
+
+  /// Inserts the entry or replaces the value of the existing one.
+  void put(const TKey &key, TVal val) {
+    auto &shard = ShardOf(key);
+    if (shard.slots.empty()) return;
+    // Declared before the guard so the evicted value is destroyed unlocked.
+    TVal evicted{};
+    auto guard = std::unique_lock{shard.lock};
+    auto found = shard.index.find(key);
+    if (found != shard.index.end()) {
+      evicted = std::exchange(shard.slots[found->second].value, std::move(val));
+      return;
+    }
+    const auto position = FreeSlot(shard);
+    auto &slot = shard.slots[position];
+    slot.key = key;
+    evicted = std::exchange(slot.value, std::move(val));
+    slot.occupied = true;
+    slot.referenced.store(false, std::memory_order_relaxed);
+    shard.index.emplace(key, position);
+  }
+
+  void reset() {
+    for (auto &shard : shards_) {
+      // Declared before the guard so the evicted values are destroyed unlocked.
+      std::vector<TVal> evicted;
+      auto guard = std::unique_lock{shard->lock};
+      evicted.reserve(shard->index.size());
+      for (auto &slot : shard->slots) {
+        if (!slot.occupied) continue;
+        evicted.emplace_back(std::exchange(slot.value, TVal{}));
+        slot.occupied = false;
+      }
+      shard->index.clear();
+    }
+    // After the values are dropped, so a value taken before the reset is never
+    // seen with the new generation.
+    generation_.fetch_add(1, std::memory_order_acq_rel);
+  }
+
+  size_t size() const {
+    size_t size = 0;
+    for (const auto &shard : shards_) {
+      auto guard = std::shared_lock{shard->lock};
+      size += shard->index.size();
+    }
+    return size;
+  }
+
+  size_t capacity() const { return capacity_; }
+
+  /// Number of resets of the cache, lets the holders of a value which was
+  /// taken from the cache tell whether it was dropped since.
+  uint64_t generation() const { return generation_.load(std::memory_order_acquire); }
+
+ private:
+  struct Slot {
+    TKey key{};
+    TVal value{};
+    bool occupied{false};
+    mutable std::atomic<bool> referenced{false};
+  };
+
+  struct Shard {
+    explicit Shard(size_t capacity) : slots(capacity) {}
+
+    mutable ShardedRWLock lock;
+    std::unordered_map<TKey, size_t, THash> index;
+    std::vector<Slot> slots;
+    size_t hand{0};
+  };
+
+  const Shard &ShardOf(const TKey &key) const { return *shards_[THash{}(key) % shards_.size()]; }
+  Shard &ShardOf(const TKey &key) { return *shards_[THash{}(key) % shards_.size()]; }
+
+  /// Returns the position of an unoccupied slot, evicting an entry if there is
+  /// none. The shard must be locked for writing, so no hit marks the entries
+  /// meanwhile and the hand stops within two rounds.
+  static size_t FreeSlot(Shard &shard) {
+    while (true) {
+      const auto position = shard.hand;
+      shard.hand = (shard.hand + 1) % shard.slots.size();
+      auto &slot = shard.slots[position];
+      if (!slot.occupied) return position;
+      if (slot.referenced.exchange(false, std::memory_order_relaxed)) continue;
+      shard.index.erase(slot.key);
+      slot.occupied = false;
+      return position;
+    }
+  }
+
+  size_t capacity_;
+  std::vector<std::unique_ptr<Shard>> shards_;
+  std::atomic<uint64_t> generation_{0};
+};
+
+}  // namespace memgraph::utils
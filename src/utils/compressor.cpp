@@ -94,7 +94,7 @@ auto ZlibCompressor::Compress(std::span<uint8_t const> uncompressed_data) const
   auto const compress_bound = compressBound(original_size);
 
   auto const buffer_size = static_cast<uint32_t>(compress_bound);
-  auto compressed_data = std::make_unique<uint8_t[]>(buffer_size);
+  auto compressed_data = std::make_unique_for_overwrite<uint8_t[]>(buffer_size);
 
   auto compression_level =
       CompressionLevelToZlibCompressionLevel(static_cast<CompressionLevel>(memgraph::flags::ParseCompressionLevel()));
@@ -112,7 +112,7 @@ auto ZlibCompressor::Compress(std::span<uint8_t const> uncompressed_data) const
   }
 
   auto new_buffer_size = static_cast<uint32_t>(actual_size);
-  auto result_compressed_data = std::make_unique<uint8_t[]>(new_buffer_size);
+  auto result_compressed_data = std::make_unique_for_overwrite<uint8_t[]>(new_buffer_size);
   std::copy_n(compressed_data.get(), new_buffer_size, result_compressed_data.get());
   return CompressedBuffer{std::move(result_compressed_data), new_buffer_size, original_size};
 }
@@ -123,7 +123,8 @@ auto ZlibCompressor::Decompress(std::span<uint8_t const> compressed_data, uint32
     return DecompressedBuffer{nullptr, 0};
   }
 
-  auto uncompressed_data = std::make_unique<uint8_t[]>(original_size);
+  // The whole buffer is written by `uncompress`, so it isn't zeroed first.
+  auto uncompressed_data = std::make_unique_for_overwrite<uint8_t[]>(original_size);
 
   // needed correct type to avoid UB in `uncompress` call
   uLongf original_size_tmp = original_size;
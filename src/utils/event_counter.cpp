@@ -17,6 +17,15 @@
   M(WriteQuery, QueryType, "Number of write-only queries executed.")                                                 \
   M(ReadWriteQuery, QueryType, "Number of read-write queries executed.")                                             \
                                                                                                                      \
+  M(QueryAstCacheHits, Query, "Number of queries whose parsed form was found in the AST cache.")                     \
+  M(QueryAstCacheMisses, Query, "Number of queries parsed because they weren't in the AST cache.")                   \
+  M(QueryPlanCacheHits, Query, "Number of queries executed with a cached plan.")                                     \
+  M(QueryPlanCacheMisses, Query, "Number of queries planned because no valid plan of theirs was cached.")            \
+  M(QueryPlanCacheStalePlans, Query,                                                                                 \
+    "Number of cached plans replaced because the graph size changed since they were made.")                          \
+  M(QueuedQueries, Query, "Number of queries waiting for a free slot of their admission lane.")                      \
+  M(QueryAdmissionTimeouts, Query, "Number of queries rejected because their admission lane stayed full.")           \
+                                                                                                                     \
   M(OnceOperator, Operator, "Number of times Once operator was used.")                                               \
   M(CreateNodeOperator, Operator, "Number of times CreateNode operator was used.")                                   \
   M(CreateExpandOperator, Operator, "Number of times CreateExpand operator was used.")                               \
@@ -26,6 +35,7 @@
   M(ScanAllByLabelPropertyValueOperator, Operator, "Number of times ScanAllByLabelPropertyValue operator was used.") \
   M(ScanAllByLabelPropertyOperator, Operator, "Number of times ScanAllByLabelProperty operator was used.")           \
   M(ScanAllByIdOperator, Operator, "Number of times ScanAllById operator was used.")                                 \
+  M(ScanAllByPointNearestOperator, Operator, "Number of times ScanAllByPointNearest operator was used.")             \
   M(ScanAllByEdgeOperator, Operator, "Number of times ScanAllByEdgeOperator operator was used.")                     \
   M(ScanAllByEdgeTypeOperator, Operator, "Number of times ScanAllByEdgeTypeOperator operator was used.")             \
   M(ScanAllByEdgeTypePropertyOperator, Operator,                                                                     \
@@ -37,6 +47,7 @@
   M(ScanAllByEdgeIdOperator, Operator, "Number of times ScanAllByEdgeIdOperator operator was used.")                 \
   M(ExpandOperator, Operator, "Number of times Expand operator was used.")                                           \
   M(ExpandVariableOperator, Operator, "Number of times ExpandVariable operator was used.")                           \
+  M(ExpandIntersectionOperator, Operator, "Number of times ExpandIntersection operator was used.")                   \
   M(ConstructNamedPathOperator, Operator, "Number of times ConstructNamedPath operator was used.")                   \
   M(FilterOperator, Operator, "Number of times Filter operator was used.")                                           \
   M(ProduceOperator, Operator, "Number of times Produce operator was used.")                                         \
@@ -68,11 +79,16 @@
   M(RollUpApplyOperator, Operator, "Number of times RollUpApply operator was used.")                                 \
   M(PeriodicCommitOperator, Operator, "Number of times PeriodicCommit operator was used.")                           \
   M(PeriodicSubqueryOperator, Operator, "Number of times PeriodicSubquery operator was used.")                       \
+  M(GatherOperator, Operator, "Number of times Gather operator was used.")                                           \
+  M(LoadPropertiesOperator, Operator, "Number of times LoadProperties operator was used.")                           \
+  M(ComputeExpressionsOperator, Operator, "Number of times ComputeExpressions operator was used.")                   \
+  M(CountVerticesOperator, Operator, "Number of times CountVertices operator was used.")                             \
                                                                                                                      \
   M(ActiveLabelIndices, Index, "Number of active label indices in the system.")                                      \
   M(ActiveLabelPropertyIndices, Index, "Number of active label property indices in the system.")                     \
   M(ActivePointIndices, Index, "Number of active point indices in the system.")                                      \
   M(ActiveTextIndices, Index, "Number of active text indices in the system.")                                        \
+  M(ActiveVectorIndices, Index, "Number of active vector indices in the system.")                                    \
                                                                                                                      \
   M(StreamsCreated, Stream, "Number of Streams created.")                                                            \
   M(MessagesConsumed, Stream, "Number of consumed streamed messages.")                                               \
@@ -86,6 +102,10 @@
   M(ActiveSSLSessions, Session, "Number of active SSL connections.")                                                 \
   M(ActiveWebSocketSessions, Session, "Number of active websocket connections.")                                     \
   M(BoltMessages, Session, "Number of Bolt messages sent.")                                                          \
+  M(QueuedBoltExecutions, Session, "Number of Bolt messages waiting for an execution worker.")                       \
+  M(AuthenticationAttempts, Session, "Number of times a connection authenticated with a username and password.")    \
+  M(AuthenticationCacheHits, Session, "Number of authentications answered by the credential cache.")                \
+  M(AuthenticationCacheMisses, Session, "Number of authentications which had to verify the password hash.")         \
                                                                                                                      \
   M(ActiveTransactions, Transaction, "Number of active transactions.")                                               \
   M(CommitedTransactions, Transaction, "Number of committed transactions.")                                          \
@@ -94,7 +114,13 @@
   M(FailedPrepare, Transaction, "Number of times preparing a query failed.")                                         \
   M(FailedPull, Transaction, "Number of times executing a prepared query failed.")                                   \
   M(SuccessfulQuery, Transaction, "Number of successful queries.")                                                   \
+  M(VertexInfoCacheHits, Transaction, "Number of vertex reads answered by the delta chain cache of a transaction.")  \
+  M(VertexInfoCacheMisses, Transaction,                                                                              \
+    "Number of vertex reads that missed the enabled delta chain cache of a transaction.")                            \
   M(UnreleasedDeltaObjects, Memory, "Total number of unreleased delta objects in memory.")                           \
+  M(NumaLocalAllocations, Memory, "Number of storage objects allocated on the NUMA node of the allocating thread.")  \
+  M(NumaUnknownNodeAllocations, Memory,                                                                              \
+    "Number of storage objects allocated with NUMA-aware allocation while the NUMA node was unknown.")               \
                                                                                                                      \
   M(DeletedNodes, TTL, "Number of nodes deleted via TTL")                                                            \
   M(DeletedEdges, TTL, "Number of edges deleted via TTL")                                                            \
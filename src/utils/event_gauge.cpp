@@ -12,7 +12,10 @@
 #include "utils/event_gauge.hpp"
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
-#define APPLY_FOR_GAUGES(M) M(PeakMemoryRes, MAX, Memory, "Peak res memory in the system.")
+#define APPLY_FOR_GAUGES(M)                                      \
+  M(PeakMemoryRes, MAX, Memory, "Peak res memory in the system.") \
+  M(AfterCommitTriggerQueueDepth, CURRENT_VALUE, Trigger,         \
+    "Committed transactions whose AFTER COMMIT triggers haven't run yet.")
 
 namespace memgraph::metrics {
 
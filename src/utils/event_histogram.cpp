@@ -12,10 +12,26 @@
 #include "utils/event_histogram.hpp"
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
-#define APPLY_FOR_HISTOGRAMS(M)                                                                    \
-  M(QueryExecutionLatency_us, Query, "Query execution latency in microseconds", 50, 90, 99)        \
-  M(SnapshotCreationLatency_us, Snapshot, "Snapshot creation latency in microseconds", 50, 90, 99) \
-  M(SnapshotRecoveryLatency_us, Snapshot, "Snapshot recovery latency in microseconds", 50, 90, 99)
+#define APPLY_FOR_HISTOGRAMS(M)                                                                                       \
+  M(QueryExecutionLatency_us, Query, "Query execution latency in microseconds", 50, 90, 99)                           \
+  M(QueryAdmissionWaitLatency_us, Query, "Query admission wait latency in microseconds", 50, 90, 99)                  \
+  M(SnapshotCreationLatency_us, Snapshot, "Snapshot creation latency in microseconds", 50, 90, 99)                    \
+  M(SnapshotRecoveryLatency_us, Snapshot, "Snapshot recovery latency in microseconds", 50, 90, 99)                    \
+  M(RecoverySnapshotEdgesLatency_us, Recovery, "Snapshot edges recovery latency in microseconds", 50, 90, 99)         \
+  M(RecoverySnapshotVerticesLatency_us, Recovery, "Snapshot vertices recovery latency in microseconds", 50, 90, 99)   \
+  M(RecoverySnapshotConnectivityLatency_us, Recovery, "Snapshot connectivity recovery in microseconds", 50, 90, 99)   \
+  M(RecoveryWalLatency_us, Recovery, "WAL replay latency during recovery in microseconds", 50, 90, 99)                \
+  M(RecoveryIndicesLatency_us, Recovery, "Index recovery latency in microseconds", 50, 90, 99)                        \
+  M(RecoveryTextIndicesLatency_us, Recovery, "Text index recovery latency in microseconds", 50, 90, 99)               \
+  M(RecoveryConstraintsLatency_us, Recovery, "Constraint recovery latency in microseconds", 50, 90, 99)               \
+  M(GCLatency_us, Memory, "Storage garbage collection cycle latency in microseconds", 50, 90, 99)                     \
+  M(GCDeltaUnlinkLatency_us, Memory, "GC delta unlinking latency in microseconds", 50, 90, 99)                        \
+  M(GCIndexCleanupLatency_us, Memory, "GC index and constraint cleanup latency in microseconds", 50, 90, 99)          \
+  M(GCUnlinkedDeltas, Memory, "Deltas unlinked in a garbage collection cycle", 50, 90, 99)                            \
+  M(BoltExecutionWaitLatency_us, Session, "Bolt message execution wait latency in microseconds", 50, 90, 99)          \
+  M(BoltBytesPerWrite, Session, "Bytes the Bolt server sends to a socket in one write", 50, 90, 99)                   \
+  M(InstanceHeartbeatLatency_us, HighAvailability, "Data instance heartbeat round trip in microseconds", 50, 90, 99)  \
+  M(InstanceDownDetectionLatency_us, HighAvailability, "Instance down detection latency in microseconds", 50, 90, 99)
 
 namespace memgraph::metrics {
 
@@ -12,10 +12,12 @@
 #include "utils/file.hpp"
 
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <cstring>
 #include <fstream>
 #include <mutex>
@@ -76,6 +78,12 @@ bool CopyFile(const std::filesystem::path &src, const std::filesystem::path &dst
   return std::filesystem::copy_file(src, dst, error_code);
 }
 
+bool LinkFile(const std::filesystem::path &src, const std::filesystem::path &dst) noexcept {
+  std::error_code error_code;  // For exception suppression.
+  std::filesystem::create_hard_link(src, dst, error_code);
+  return !error_code;
+}
+
 bool RenamePath(const std::filesystem::path &src, const std::filesystem::path &dst) {
   std::error_code error_code;  // For exception suppression.
   std::filesystem::rename(src, dst, error_code);
@@ -93,6 +101,8 @@ InputFile::InputFile(InputFile &&other) noexcept
       path_(std::move(other.path_)),
       file_size_(other.file_size_),
       file_position_(other.file_position_),
+      mapping_(other.mapping_),
+      prefetched_until_(other.prefetched_until_),
       buffer_start_(other.buffer_start_),
       buffer_size_(other.buffer_size_),
       buffer_position_(other.buffer_position_) {
@@ -100,6 +110,8 @@ InputFile::InputFile(InputFile &&other) noexcept
   other.fd_ = -1;
   other.file_size_ = 0;
   other.file_position_ = 0;
+  other.mapping_ = nullptr;
+  other.prefetched_until_ = 0;
   other.buffer_start_ = std::nullopt;
   other.buffer_size_ = 0;
   other.buffer_position_ = 0;
@@ -112,6 +124,8 @@ InputFile &InputFile::operator=(InputFile &&other) noexcept {
   path_ = std::move(other.path_);
   file_size_ = other.file_size_;
   file_position_ = other.file_position_;
+  mapping_ = other.mapping_;
+  prefetched_until_ = other.prefetched_until_;
   buffer_start_ = other.buffer_start_;
   buffer_size_ = other.buffer_size_;
   buffer_position_ = other.buffer_position_;
@@ -120,6 +134,8 @@ InputFile &InputFile::operator=(InputFile &&other) noexcept {
   other.fd_ = -1;
   other.file_size_ = 0;
   other.file_position_ = 0;
+  other.mapping_ = nullptr;
+  other.prefetched_until_ = 0;
   other.buffer_start_ = std::nullopt;
   other.buffer_size_ = 0;
   other.buffer_position_ = 0;
@@ -127,7 +143,7 @@ InputFile &InputFile::operator=(InputFile &&other) noexcept {
   return *this;
 }
 
-bool InputFile::Open(const std::filesystem::path &path) {
+bool InputFile::Open(const std::filesystem::path &path, const bool memory_mapped) {
   if (IsOpen()) return false;
 
   path_ = path;
@@ -154,6 +170,18 @@ bool InputFile::Open(const std::filesystem::path &path) {
   }
   file_size_ = *size;
 
+  if (memory_mapped && file_size_ > 0) {
+    auto *mapping = mmap(nullptr, file_size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (mapping == MAP_FAILED) {
+      spdlog::warn("Couldn't memory map {}, falling back to buffered reads: {} ({})", path_, strerror(errno), errno);
+    } else {
+      // The file is mostly read front to back so the kernel can read ahead
+      // aggressively and drop the pages behind the current position.
+      madvise(mapping, file_size_, MADV_SEQUENTIAL);
+      mapping_ = static_cast<uint8_t *>(mapping);
+    }
+  }
+
   return true;
 }
 
@@ -162,6 +190,12 @@ bool InputFile::IsOpen() const { return fd_ != -1; }
 const std::filesystem::path &InputFile::path() const { return path_; }
 
 bool InputFile::Read(uint8_t *data, size_t size) {
+  if (mapping_) {
+    if (!Peek(data, size)) return false;
+    file_position_ += size;
+    return true;
+  }
+
   size_t offset = 0;
 
   while (size > 0) {
@@ -181,6 +215,15 @@ bool InputFile::Read(uint8_t *data, size_t size) {
 }
 
 bool InputFile::Peek(uint8_t *data, size_t size) {
+  if (mapping_) {
+    if (file_position_ > file_size_ || size > file_size_ - file_position_) return false;
+    // Keep the pages of the region that is read next resident, this is
+    // especially important after a jump to another part of the file.
+    if (file_position_ + size > prefetched_until_) Prefetch(kFileBufferSize * 32);
+    memcpy(data, mapping_ + file_position_, size);
+    return true;
+  }
+
   auto old_buffer_start = buffer_start_;
   auto old_buffer_position = buffer_position_;
   auto real_position = GetPosition();
@@ -206,7 +249,26 @@ size_t InputFile::GetPosition() {
   return file_position_;
 }
 
+void InputFile::Prefetch(size_t size) {
+  if (!mapping_ || file_position_ >= file_size_) return;
+  static const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  const auto start = file_position_ - (file_position_ % page_size);
+  const auto end = file_position_ + std::min(size, file_size_ - file_position_);
+  madvise(mapping_ + start, end - start, MADV_WILLNEED);
+  prefetched_until_ = end;
+}
+
 std::optional<size_t> InputFile::SetPosition(Position position, ssize_t offset) {
+  if (mapping_) {
+    ssize_t pos = offset;
+    if (position == Position::RELATIVE_TO_CURRENT) pos += static_cast<ssize_t>(file_position_);
+    if (position == Position::RELATIVE_TO_END) pos += static_cast<ssize_t>(file_size_);
+    if (pos < 0) return std::nullopt;
+    file_position_ = pos;
+    prefetched_until_ = 0;
+    return pos;
+  }
+
   int whence;
   switch (position) {
     case Position::SET:
@@ -236,6 +298,14 @@ std::optional<size_t> InputFile::SetPosition(Position position, ssize_t offset)
 void InputFile::Close() noexcept {
   if (!IsOpen()) return;
 
+  if (mapping_) {
+    if (munmap(mapping_, file_size_) != 0) {
+      spdlog::error("While trying to unmap {} an error occured: {} ({})", path_, strerror(errno), errno);
+    }
+    mapping_ = nullptr;
+    prefetched_until_ = 0;
+  }
+
   int ret = 0;
   while (true) {
     ret = close(fd_);
@@ -295,10 +365,14 @@ OutputFile::~OutputFile() {
 }
 
 OutputFile::OutputFile(OutputFile &&other) noexcept
-    : fd_(other.fd_), written_since_last_sync_(other.written_since_last_sync_), path_(std::move(other.path_)) {
+    : fd_(other.fd_),
+      preallocated_(other.preallocated_),
+      written_since_last_sync_(other.written_since_last_sync_.load()),
+      path_(std::move(other.path_)) {
   memcpy(buffer_, other.buffer_, kFileBufferSize);
   buffer_position_.store(other.buffer_position_.load());
   other.fd_ = -1;
+  other.preallocated_ = 0;
   other.written_since_last_sync_ = 0;
   other.buffer_position_ = 0;
 }
@@ -307,12 +381,14 @@ OutputFile &OutputFile::operator=(OutputFile &&other) noexcept {
   if (IsOpen()) Close();
 
   fd_ = other.fd_;
-  written_since_last_sync_ = other.written_since_last_sync_;
+  preallocated_ = other.preallocated_;
+  written_since_last_sync_ = other.written_since_last_sync_.load();
   path_ = std::move(other.path_);
   buffer_position_ = other.buffer_position_.load();
   memcpy(buffer_, other.buffer_, kFileBufferSize);
 
   other.fd_ = -1;
+  other.preallocated_ = 0;
   other.written_since_last_sync_ = 0;
   other.buffer_position_ = 0;
 
@@ -469,15 +545,50 @@ void OutputFile::Sync() {
   MG_ASSERT(ret == 0,
             "While trying to sync {}, an error occurred: {} ({}). Possibly {} "
             "bytes from previous write calls were lost.",
-            path_, strerror(errno), errno, written_since_last_sync_);
+            path_, strerror(errno), errno, written_since_last_sync_.load());
 
   // Reset the counter.
   written_since_last_sync_ = 0;
 }
 
+bool OutputFile::Preallocate(size_t size) {
+  MG_ASSERT(IsOpen(), "Preallocating an unopened file.");
+
+  int ret = 0;
+  while (true) {
+    ret = fallocate(fd_, FALLOC_FL_KEEP_SIZE, 0, static_cast<off_t>(size));
+    if (ret == -1 && errno == EINTR) {
+      // The call was interrupted, try again...
+      continue;
+    }
+    break;
+  }
+  if (ret == -1) return false;
+
+  preallocated_ = std::max(preallocated_, size);
+  return true;
+}
+
+void OutputFile::DropPageCache() {
+  MG_ASSERT(IsOpen(), "Dropping the page cache of an unopened file.");
+  // Pages which weren't synced yet aren't dropped.
+  posix_fadvise(fd_, 0, 0, POSIX_FADV_DONTNEED);
+}
+
 void OutputFile::Close() noexcept {
   FlushBuffer(true);
 
+  if (preallocated_ > 0) {
+    // Truncating the file to its own size releases the reserved blocks past
+    // its end. If that fails they stay reserved, which only costs disk space.
+    const auto size = SeekFile(Position::RELATIVE_TO_END, 0);
+    if (size < preallocated_) {
+      while (ftruncate(fd_, static_cast<off_t>(size)) == -1 && errno == EINTR) {
+      }
+    }
+    preallocated_ = 0;
+  }
+
   int ret = 0;
   while (true) {
     ret = close(fd_);
@@ -494,7 +605,7 @@ void OutputFile::Close() noexcept {
   MG_ASSERT(ret == 0,
             "While trying to close {}, an error occurred: {} ({}). Possibly {} "
             "bytes from previous write calls were lost.",
-            path_, strerror(errno), errno, written_since_last_sync_);
+            path_, strerror(errno), errno, written_since_last_sync_.load());
 
   fd_ = -1;
   written_since_last_sync_ = 0;
@@ -528,7 +639,7 @@ void OutputFile::FlushBufferInternal() {
               "while trying to write to {} an error occurred: {} ({}). "
               "Possibly {} bytes of data were lost from this call and "
               "possibly {} bytes were lost from previous calls.",
-              path_, strerror(errno), errno, buffer_position_, written_since_last_sync_);
+              path_, strerror(errno), errno, buffer_position_, written_since_last_sync_.load());
 
     buffer_position -= written;
     buffer += written;
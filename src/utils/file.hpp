@@ -59,6 +59,10 @@ bool DeleteFile(const std::filesystem::path &file) noexcept;
 /// Copies the file from `src` to `dst`.
 bool CopyFile(const std::filesystem::path &src, const std::filesystem::path &dst) noexcept;
 
+/// Creates `dst` as a hard link to the file `src`, so the file is reachable
+/// under both names without copying its data.
+bool LinkFile(const std::filesystem::path &src, const std::filesystem::path &dst) noexcept;
+
 /// Renames the path from `src` to `dst`. If the `dst` contains directories that
 /// don't exist, the renaming fails. Symlinks are not followed.
 bool RenamePath(const std::filesystem::path &src, const std::filesystem::path &dst);
@@ -97,8 +101,11 @@ class InputFile {
   InputFile &operator=(InputFile &&other) noexcept;
 
   /// This method opens the file used for reading. If the file can't be opened
-  /// or doesn't exist it returns `false`.
-  bool Open(const std::filesystem::path &path);
+  /// or doesn't exist it returns `false`. If `memory_mapped` is set the whole
+  /// file is mapped into memory and read sequentially from the mapping instead
+  /// of through the internal buffer. If the mapping fails the file is read
+  /// through the internal buffer.
+  bool Open(const std::filesystem::path &path, bool memory_mapped = false);
 
   /// Returns a boolean indicating whether a file is opened.
   bool IsOpen() const;
@@ -123,6 +130,10 @@ class InputFile {
   /// This method gets the current absolute position in the file.
   size_t GetPosition();
 
+  /// Hints the kernel that the next `size` bytes starting at the current
+  /// position will be read soon. It has an effect only on memory mapped files.
+  void Prefetch(size_t size);
+
   /// This method sets the current position in the file and returns the absolute
   /// set position in the file. The position is set to `offset` with the
   /// starting point taken from `position`. On failure it returns
@@ -140,6 +151,9 @@ class InputFile {
   size_t file_size_{0};
   size_t file_position_{0};
 
+  uint8_t *mapping_{nullptr};
+  size_t prefetched_until_{0};
+
   uint8_t buffer_[kFileBufferSize];
   std::optional<size_t> buffer_start_;
   size_t buffer_size_{0};
@@ -235,6 +249,18 @@ class OutputFile {
   /// and misuse it crashes the program.
   void Sync();
 
+  /// Reserves the disk blocks of the first `size` bytes of the file without
+  /// changing its size, so the writes up to it don't allocate blocks and
+  /// update the file system metadata. The blocks which weren't written to are
+  /// released by `Close`. Returns `false` if the file system doesn't support
+  /// it. On misuse it crashes the program.
+  bool Preallocate(size_t size);
+
+  /// Evicts the already synced data of the file from the page cache. Used for
+  /// files which aren't read again soon, so they don't push out the pages of
+  /// the files which are. On misuse it crashes the program.
+  void DropPageCache();
+
   /// Closes the currently opened file. It doesn't perform a `Sync` on the
   /// file. On failure and misuse it crashes the program.
   void Close() noexcept;
@@ -263,7 +289,9 @@ class OutputFile {
   size_t SeekFile(Position position, ssize_t offset);
 
   int fd_{-1};
-  size_t written_since_last_sync_{0};
+  size_t preallocated_{0};
+  // Atomic because the WAL group commit syncs the file while it is written to.
+  std::atomic<size_t> written_since_last_sync_{0};
   std::filesystem::path path_;
   uint8_t buffer_[kFileBufferSize];
   std::atomic<size_t> buffer_position_{0};
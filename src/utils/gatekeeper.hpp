@@ -11,7 +11,10 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <cassert>
+#include <chrono>
 #include <condition_variable>
 #include <cstdint>
 #include <functional>
@@ -78,15 +81,121 @@ struct EvalResult {
 template <typename Func, typename T>
 EvalResult(run_t, Func &&, T &) -> EvalResult<std::invoke_result_t<Func, T &>>;
 
+namespace detail {
+// Number of counters the accesses of a `Gatekeeper` are spread over.
+constexpr size_t kGatekeeperSlots = 16;
+
+inline size_t GatekeeperSlotOfThread() {
+  static std::atomic<size_t> next_slot{0};
+  thread_local const size_t slot = next_slot.fetch_add(1, std::memory_order_relaxed) % kGatekeeperSlots;
+  return slot;
+}
+}  // namespace detail
+
+/// The accesses are counted in one of the slots picked by the thread which
+/// gained the access, so concurrent accesses don't contend for a lock or a
+/// cache line. The operations which need the exact count (exclusive access,
+/// deletion) close the gate to new accesses while they check it: accesses
+/// which find the gate closed wait for `mutex_`, held by the closing
+/// operation, and are counted once it's reopened.
 template <typename T>
 struct GKInternals {
   template <typename... Args>
   explicit GKInternals(Args &&...args) : value_{std::in_place, std::forward<Args>(args)...} {}
 
+  struct alignas(64) Slot {
+    std::atomic<int64_t> count{0};
+  };
+
+  /// Holds `mutex_` and keeps the gate closed while it lives.
+  struct ClosedGate {
+    ClosedGate(GKInternals *owner, std::unique_lock<std::mutex> lock) : owner{owner}, lock{std::move(lock)} {
+      owner->closed_.store(true, std::memory_order_seq_cst);
+    }
+    ClosedGate(ClosedGate const &) = delete;
+    ClosedGate(ClosedGate &&other) noexcept : owner{other.owner}, lock{std::move(other.lock)} {}
+    ClosedGate &operator=(ClosedGate const &) = delete;
+    ClosedGate &operator=(ClosedGate &&) = delete;
+    // Reopened before `lock` unlocks the mutex.
+    ~ClosedGate() {
+      if (lock) owner->closed_.store(false, std::memory_order_seq_cst);
+    }
+
+    explicit operator bool() const { return lock.owns_lock(); }
+
+    GKInternals *owner;
+    std::unique_lock<std::mutex> lock;
+  };
+
+  /// Counts an access in @p slot. Returns false if @p check_value is set
+  /// and the value is deleted.
+  bool Acquire(size_t slot, bool check_value) {
+    auto &count = slots_[slot].count;
+    count.fetch_add(1, std::memory_order_seq_cst);
+    if (!closed_.load(std::memory_order_seq_cst)) [[likely]] {
+      if (!check_value || has_value_.load(std::memory_order_acquire)) return true;
+      Release(slot);
+      return false;
+    }
+    Release(slot);
+    // No closing operation can check the count while this access is counted
+    // under the lock.
+    auto guard = std::unique_lock{mutex_};
+    if (check_value && !has_value_.load(std::memory_order_acquire)) return false;
+    count.fetch_add(1, std::memory_order_seq_cst);
+    return true;
+  }
+
+  void Release(size_t slot) {
+    slots_[slot].count.fetch_sub(1, std::memory_order_seq_cst);
+    if (watchers_.load(std::memory_order_seq_cst) != 0) [[unlikely]] {
+      auto guard = std::unique_lock{wait_mutex_};
+      cv_.notify_all();
+    }
+  }
+
+  /// Exact only while the gate is closed.
+  int64_t Count() const {
+    int64_t count = 0;
+    for (const auto &slot : slots_) count += slot.count.load(std::memory_order_seq_cst);
+    return count;
+  }
+
+  /// Closes the gate once only @p count accesses are left. The returned gate
+  /// is empty if that didn't happen within @p timeout. New accesses aren't
+  /// blocked while this waits.
+  ClosedGate CloseWhenCount(int64_t count, std::optional<std::chrono::milliseconds> timeout) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout.value_or(std::chrono::milliseconds::zero());
+    watchers_.fetch_add(1, std::memory_order_seq_cst);
+    while (true) {
+      {
+        auto gate = ClosedGate{this, std::unique_lock{mutex_}};
+        if (Count() == count) {
+          watchers_.fetch_sub(1, std::memory_order_seq_cst);
+          return gate;
+        }
+      }
+      if (timeout && std::chrono::steady_clock::now() >= deadline) {
+        watchers_.fetch_sub(1, std::memory_order_seq_cst);
+        return {this, std::unique_lock<std::mutex>{}};
+      }
+      // The count is only a hint while the gate is open, so the wait is
+      // bounded and the exact count is checked again after it.
+      auto guard = std::unique_lock{wait_mutex_};
+      cv_.wait_for(guard, std::chrono::milliseconds(10), [&] { return Count() == count; });
+    }
+  }
+
   std::optional<T> value_;
-  uint64_t count_ = 0;
+  std::atomic_bool has_value_ = true;
   std::atomic_bool is_deleting = false;
-  std::mutex mutex_;  // TODO change to something cheaper?
+  std::array<Slot, detail::kGatekeeperSlots> slots_;
+  std::atomic_bool closed_ = false;
+  // Operations waiting for the count to drop, notified on each release.
+  std::atomic<int> watchers_ = 0;
+  // Held by the operations while they check the exact count.
+  std::mutex mutex_;
+  std::mutex wait_mutex_;
   std::condition_variable cv_;
 };
 
@@ -104,16 +213,13 @@ struct Gatekeeper {
     friend Gatekeeper;
 
    private:
-    explicit Accessor(Gatekeeper *owner) : owner_{owner->pimpl_.get()} { ++owner_->count_; }
+    Accessor(GKInternals<T> *owner, size_t slot) : owner_{owner}, slot_{slot} {}
 
    public:
-    Accessor(Accessor const &other) : owner_{other.owner_} {
-      if (owner_) {
-        auto guard = std::unique_lock{owner_->mutex_};
-        ++owner_->count_;
-      }
+    Accessor(Accessor const &other) : owner_{other.owner_}, slot_{detail::GatekeeperSlotOfThread()} {
+      if (owner_) owner_->Acquire(slot_, false);
     };
-    Accessor(Accessor &&other) noexcept : owner_{std::exchange(other.owner_, nullptr)} {};
+    Accessor(Accessor &&other) noexcept : owner_{std::exchange(other.owner_, nullptr)}, slot_{other.slot_} {};
     Accessor &operator=(Accessor const &other) {
       // no change assignment
       if (owner_ == other.owner_) {
@@ -121,19 +227,15 @@ struct Gatekeeper {
       }
 
       // gain ownership
-      if (other.owner_) {
-        auto guard = std::unique_lock{other.owner_->mutex_};
-        ++other.owner_->count_;
-      }
+      auto const slot = detail::GatekeeperSlotOfThread();
+      if (other.owner_) other.owner_->Acquire(slot, false);
 
       // reliquish ownership
-      if (owner_) {
-        auto guard = std::unique_lock{owner_->mutex_};
-        --owner_->count_;
-      }
+      if (owner_) owner_->Release(slot_);
 
       // correct owner
       owner_ = other.owner_;
+      slot_ = slot;
       return *this;
     };
     Accessor &operator=(Accessor &&other) noexcept {
@@ -141,13 +243,11 @@ struct Gatekeeper {
       if (&other == this) return *this;
 
       // reliquish ownership
-      if (owner_) {
-        auto guard = std::unique_lock{owner_->mutex_};
-        --owner_->count_;
-      }
+      if (owner_) owner_->Release(slot_);
 
       // correct owners
       owner_ = std::exchange(other.owner_, nullptr);
+      slot_ = other.slot_;
       return *this;
     }
 
@@ -180,10 +280,9 @@ struct Gatekeeper {
 
     template <typename Func>
     [[nodiscard]] auto try_exclusively(Func &&func) -> EvalResult<std::invoke_result_t<Func, T &>> {
-      // Prevent new access
-      auto guard = std::unique_lock{owner_->mutex_};
-      // Only invoke if we have exclusive access
-      if (owner_->count_ != 1) {
+      // Prevent new access; only invoke if we have exclusive access
+      auto const gate = owner_->CloseWhenCount(1, std::chrono::milliseconds::zero());
+      if (!gate) {
         return {not_run_t{}};
       }
       // Invoke and hold result in wrapper type
@@ -195,14 +294,15 @@ struct Gatekeeper {
     [[nodiscard]] bool try_delete(std::chrono::milliseconds timeout = std::chrono::milliseconds(100),
                                   Func &&predicate = {}) {
       // Prevent new access
-      auto guard = std::unique_lock{owner_->mutex_};
-      if (!owner_->cv_.wait_for(guard, timeout, [this] { return owner_->count_ == 1; })) {
+      auto const gate = owner_->CloseWhenCount(1, timeout);
+      if (!gate) {
         return false;
       }
       // Already deleted
       if (owner_->value_ == std::nullopt) return true;
       // Delete value if ok
       if (!predicate(*owner_->value_)) return false;
+      owner_->has_value_.store(false, std::memory_order_release);
       owner_->value_ = std::nullopt;
       return true;
     }
@@ -213,13 +313,7 @@ struct Gatekeeper {
     }
 
     void reset() {
-      if (owner_) {
-        {
-          auto guard = std::unique_lock{owner_->mutex_};
-          --owner_->count_;
-        }
-        owner_->cv_.notify_all();
-      }
+      if (owner_) owner_->Release(slot_);
       owner_ = nullptr;
     }
 
@@ -227,12 +321,14 @@ struct Gatekeeper {
 
    private:
     GKInternals<T> *owner_ = nullptr;
+    // The slot in which this access is counted.
+    size_t slot_ = 0;
   };
 
   std::optional<Accessor> access() {
-    auto guard = std::unique_lock{pimpl_->mutex_};
-    if (pimpl_->value_) {
-      return Accessor{this};
+    auto const slot = detail::GatekeeperSlotOfThread();
+    if (pimpl_->Acquire(slot, true)) {
+      return Accessor{pimpl_.get(), slot};
     }
     return std::nullopt;
   }
@@ -241,8 +337,7 @@ struct Gatekeeper {
     if (!pimpl_) return;  // Moved out, nothing to do
     pimpl_->is_deleting = true;
     // wait for count to drain to 0
-    auto lock = std::unique_lock{pimpl_->mutex_};
-    pimpl_->cv_.wait(lock, [this] { return pimpl_->count_ == 0; });
+    auto const gate = pimpl_->CloseWhenCount(0, std::nullopt);
   }
 
  private:
@@ -0,0 +1,72 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "utils/lock_contention.hpp"
+
+#include <atomic>
+
+namespace memgraph::utils {
+
+namespace {
+
+#ifdef MG_LOCK_CONTENTION_TRACKING
+// The sites are updated from many threads, so each of them gets a cache line.
+struct alignas(64) SiteCounters {
+  std::atomic<uint64_t> contended{0};
+  std::atomic<uint64_t> wait_ns{0};
+};
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::array<SiteCounters, kLockSiteCount> site_counters;
+#endif
+
+}  // namespace
+
+std::string_view LockSiteName(LockSite site) {
+  switch (site) {
+    case LockSite::OTHER:
+      return "other";
+    case LockSite::VERTEX:
+      return "vertex";
+    case LockSite::EDGE:
+      return "edge";
+    case LockSite::MAIN:
+      return "main";
+    case LockSite::ENGINE:
+      return "engine";
+    case LockSite::GC:
+      return "gc";
+    case LockSite::SKIP_LIST_GC:
+      return "skip_list_gc";
+  }
+  return "unknown";
+}
+
+std::array<LockContentionStats, kLockSiteCount> GetLockContentionStats() {
+  std::array<LockContentionStats, kLockSiteCount> stats{};
+#ifdef MG_LOCK_CONTENTION_TRACKING
+  for (size_t i = 0; i < kLockSiteCount; ++i) {
+    stats[i].contended = site_counters[i].contended.load(std::memory_order_relaxed);
+    stats[i].wait_ns = site_counters[i].wait_ns.load(std::memory_order_relaxed);
+  }
+#endif
+  return stats;
+}
+
+#ifdef MG_LOCK_CONTENTION_TRACKING
+void RecordLockContention(LockSite site, std::chrono::nanoseconds wait) {
+  auto &counters = site_counters[static_cast<size_t>(site)];
+  counters.contended.fetch_add(1, std::memory_order_relaxed);
+  counters.wait_ns.fetch_add(wait.count(), std::memory_order_relaxed);
+}
+#endif
+
+}  // namespace memgraph::utils
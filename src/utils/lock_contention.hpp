@@ -0,0 +1,78 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace memgraph::utils {
+
+/// The locks whose contention is tracked separately. The locks which aren't
+/// given a site are tracked as `OTHER`.
+enum class LockSite : uint8_t { OTHER, VERTEX, EDGE, MAIN, ENGINE, GC, SKIP_LIST_GC };
+
+inline constexpr size_t kLockSiteCount = 7;
+
+/// Whether the build tracks the lock contention, see the
+/// `MG_LOCK_CONTENTION_TRACKING` build option.
+#ifdef MG_LOCK_CONTENTION_TRACKING
+inline constexpr bool kLockContentionTracking = true;
+#else
+inline constexpr bool kLockContentionTracking = false;
+#endif
+
+/// Lowercase name of the site, e.g. "skip_list_gc".
+std::string_view LockSiteName(LockSite site);
+
+struct LockContentionStats {
+  // Acquisitions which couldn't take the lock at the first attempt.
+  uint64_t contended{0};
+  uint64_t wait_ns{0};
+};
+
+/// Contention of each site since the start, all zero if it isn't tracked.
+std::array<LockContentionStats, kLockSiteCount> GetLockContentionStats();
+
+#ifdef MG_LOCK_CONTENTION_TRACKING
+void RecordLockContention(LockSite site, std::chrono::nanoseconds wait);
+#else
+inline void RecordLockContention(LockSite /*site*/, std::chrono::nanoseconds /*wait*/) {}
+#endif
+
+/// Measures the wait for a contended lock until it is destroyed. Nothing is
+/// recorded if the lock wasn't `contended` or the contention isn't tracked.
+class LockWait {
+ public:
+  explicit LockWait(LockSite site, bool contended = true)
+      : site_{site},
+        start_{kLockContentionTracking && contended ? std::chrono::steady_clock::now()
+                                                    : std::chrono::steady_clock::time_point{}} {}
+  ~LockWait() {
+    if (start_ != std::chrono::steady_clock::time_point{}) {
+      RecordLockContention(site_, std::chrono::steady_clock::now() - start_);
+    }
+  }
+
+  LockWait(const LockWait &) = delete;
+  LockWait(LockWait &&) = delete;
+  LockWait &operator=(const LockWait &) = delete;
+  LockWait &operator=(LockWait &&) = delete;
+
+ private:
+  LockSite site_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace memgraph::utils
@@ -12,6 +12,7 @@
 #include "utils/memory.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cstdint>
 #include <limits>
@@ -223,6 +224,19 @@ MemoryResource *NullMemoryResource() noexcept {
   return &res;
 }
 
+namespace {
+std::atomic<MemoryResource *> storage_objects_resource{nullptr};
+}  // namespace
+
+MemoryResource *StorageObjectsResource() noexcept {
+  auto *memory = storage_objects_resource.load(std::memory_order_acquire);
+  return memory ? memory : NewDeleteResource();
+}
+
+void SetStorageObjectsResource(MemoryResource *memory) noexcept {
+  storage_objects_resource.store(memory, std::memory_order_release);
+}
+
 namespace impl {
 
 /// 1 bit sensitivity test
@@ -304,6 +304,15 @@ inline MemoryResource *NewDeleteResource() noexcept {
   return &memory;
 }
 
+/// Return the MemoryResource from which storages allocate their vertices and
+/// edges. It is NewDeleteResource() unless replaced, e.g. with a resource that
+/// places the objects on the NUMA node of the allocating thread.
+MemoryResource *StorageObjectsResource() noexcept;
+
+/// Replace the resource returned by StorageObjectsResource(). Must be called
+/// before any storage is created and the resource must outlive all storages.
+void SetStorageObjectsResource(MemoryResource *memory) noexcept;
+
 /// MemoryResource which releases the memory only when the resource is
 /// destroyed.
 ///
@@ -0,0 +1,114 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "utils/perf_counters.hpp"
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "utils/logging.hpp"
+
+namespace memgraph::utils {
+
+namespace {
+
+int OpenEvent(PerfEvent event, int group_fd) {
+  perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  switch (event) {
+    case PerfEvent::INSTRUCTIONS:
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+      break;
+    case PerfEvent::CACHE_MISSES:
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_CACHE_MISSES;
+      break;
+    case PerfEvent::BRANCH_MISSES:
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+      break;
+    case PerfEvent::PAGE_FAULTS:
+      attr.type = PERF_TYPE_SOFTWARE;
+      attr.config = PERF_COUNT_SW_PAGE_FAULTS;
+      break;
+  }
+  // The group starts disabled and is enabled once all of its events are open,
+  // so they are all counted over the same time.
+  attr.disabled = group_fd == -1 ? 1 : 0;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_GROUP;
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+
+}  // namespace
+
+std::string_view PerfEventName(PerfEvent event) {
+  switch (event) {
+    case PerfEvent::INSTRUCTIONS:
+      return "instructions";
+    case PerfEvent::CACHE_MISSES:
+      return "cache_misses";
+    case PerfEvent::BRANCH_MISSES:
+      return "branch_misses";
+    case PerfEvent::PAGE_FAULTS:
+      return "page_faults";
+  }
+  return "unknown";
+}
+
+PerfCounters::PerfCounters() {
+  fds_.fill(-1);
+  for (size_t i = 0; i < kPerfEventCount; ++i) {
+    fds_[i] = OpenEvent(static_cast<PerfEvent>(i), group_fd_);
+    if (fds_[i] == -1) {
+      spdlog::trace("Couldn't open the perf event {}: {}", PerfEventName(static_cast<PerfEvent>(i)),
+                    std::strerror(errno));
+      continue;
+    }
+    counted_.set(i);
+    if (group_fd_ == -1) group_fd_ = fds_[i];
+  }
+  if (group_fd_ != -1) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg,hicpp-vararg)
+    ioctl(group_fd_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  }
+}
+
+PerfCounters::~PerfCounters() {
+  for (const auto fd : fds_) {
+    if (fd != -1) close(fd);
+  }
+}
+
+PerfCounterValues PerfCounters::Read() const {
+  PerfCounterValues values{};
+  if (group_fd_ == -1) return values;
+  // The values of the group in the order its events were opened.
+  std::array<uint64_t, 1 + kPerfEventCount> buffer{};
+  const auto size = read(group_fd_, buffer.data(), sizeof(buffer));
+  if (size < static_cast<ssize_t>(sizeof(uint64_t)) || buffer[0] != counted_.count()) return values;
+  size_t position = 1;
+  for (size_t i = 0; i < kPerfEventCount; ++i) {
+    if (counted_.test(i)) values.counts[i] = buffer[position++];
+  }
+  return values;
+}
+
+}  // namespace memgraph::utils
@@ -0,0 +1,76 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace memgraph::utils {
+
+enum class PerfEvent : uint8_t { INSTRUCTIONS, CACHE_MISSES, BRANCH_MISSES, PAGE_FAULTS };
+
+inline constexpr size_t kPerfEventCount = 4;
+
+/// Lowercase name of the event, e.g. "cache_misses".
+std::string_view PerfEventName(PerfEvent event);
+
+/// Counts of the events.
+struct PerfCounterValues {
+  uint64_t &operator[](PerfEvent event) { return counts[static_cast<size_t>(event)]; }
+  uint64_t operator[](PerfEvent event) const { return counts[static_cast<size_t>(event)]; }
+
+  PerfCounterValues &operator+=(const PerfCounterValues &other) {
+    for (size_t i = 0; i < kPerfEventCount; ++i) counts[i] += other.counts[i];
+    return *this;
+  }
+
+  friend PerfCounterValues operator-(PerfCounterValues lhs, const PerfCounterValues &rhs) {
+    for (size_t i = 0; i < kPerfEventCount; ++i) lhs.counts[i] -= rhs.counts[i];
+    return lhs;
+  }
+
+  std::array<uint64_t, kPerfEventCount> counts{};
+};
+
+/// Counts the events of the thread which constructed it in user space, using
+/// perf_event_open(2). All of the events are read with a single read(2), so
+/// a read costs a system call. The events which the kernel doesn't allow to
+/// count (e.g. because of `perf_event_paranoid` or a virtual machine without
+/// hardware counters) always read as zero, see `Counted`.
+class PerfCounters {
+ public:
+  PerfCounters();
+  ~PerfCounters();
+
+  PerfCounters(const PerfCounters &) = delete;
+  PerfCounters(PerfCounters &&) = delete;
+  PerfCounters &operator=(const PerfCounters &) = delete;
+  PerfCounters &operator=(PerfCounters &&) = delete;
+
+  /// The events which are counted.
+  const std::bitset<kPerfEventCount> &Counted() const { return counted_; }
+
+  /// Events counted since the construction. Must be called on the thread
+  /// which constructed the counters.
+  PerfCounterValues Read() const;
+
+ private:
+  // The first opened event leads the group, the others are read with it.
+  int group_fd_{-1};
+  std::array<int, kPerfEventCount> fds_;
+  std::bitset<kPerfEventCount> counted_;
+};
+
+}  // namespace memgraph::utils
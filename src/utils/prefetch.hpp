@@ -0,0 +1,32 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace memgraph::utils {
+
+inline constexpr size_t kCacheLineSize = 64;
+
+/// Hints the CPU to start loading every cache line of `*object` for reading.
+/// Prefetching never faults, so `object` doesn't have to point to a live object.
+template <typename T>
+inline void PrefetchObject(T const *object) {
+  auto const address = reinterpret_cast<uintptr_t>(object);
+  for (auto line = address & ~(kCacheLineSize - 1); line < address + sizeof(T); line += kCacheLineSize) {
+    __builtin_prefetch(reinterpret_cast<void const *>(line));
+  }
+}
+
+}  // namespace memgraph::utils
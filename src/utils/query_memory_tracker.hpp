@@ -61,6 +61,9 @@ class QueryMemoryTracker {
   // Stop procedure tracking
   void StopProcTracking();
 
+  // Peak memory of the query, zero if the query has no limit
+  int64_t QueryPeak() const { return query_tracker_ ? query_tracker_->Peak() : 0; }
+
  private:
   static constexpr int64_t NO_PROCEDURE{-1};
   void InitializeQueryTracker();
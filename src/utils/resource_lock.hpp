@@ -10,10 +10,15 @@
 // licenses/APL.txt.
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstdint>
 #include <mutex>
 
+#include "utils/lock_contention.hpp"
+
 namespace memgraph::utils {
 
 /* A type that complies to the
@@ -21,97 +26,188 @@ namespace memgraph::utils {
  *
  * Unlike `std::shared_mutex` it can be locked in one thread
  * and unlocked in another.
+ * The shared holders are counted in shards, so taking the lock in shared mode
+ * is an increment of the shard of the thread and a read of the unique flag,
+ * and the readers on different cores don't share a cache line. Only a unique
+ * holder takes the mutex; it sets the flag and waits for the shards to sum to
+ * zero. Like before the shards, the lock prefers readers: a failed unique
+ * attempt clears the flag again, so the shared holders which arrive while it
+ * waits aren't blocked.
+ * With MG_LOCK_CONTENTION_TRACKING the waits are recorded for the `site`.
  */
 struct ResourceLock {
- private:
-  enum states { UNLOCKED, UNIQUE, SHARED };
-
  public:
+  ResourceLock() = default;
+#ifdef MG_LOCK_CONTENTION_TRACKING
+  explicit ResourceLock(LockSite site) : site_{site} {}
+#else
+  explicit ResourceLock(LockSite /*site*/) {}
+#endif
+
   void lock() {
     auto lock = std::unique_lock{mtx};
-    // block until available
-    cv.wait(lock, [this] { return state == UNLOCKED; });
-    state = UNIQUE;
+#ifdef MG_LOCK_CONTENTION_TRACKING
+    auto const wait = LockWait{site_, unique_.load() || SharedCount() != 0};
+#endif
+    AcquireUnique(0, [&](auto pred) {
+      cv.wait(lock, pred);
+      return true;
+    });
   }
   void lock_shared() {
+    if (TryLockSharedFast()) return;
     auto lock = std::unique_lock{mtx};
+#ifdef MG_LOCK_CONTENTION_TRACKING
+    auto const wait = LockWait{site_, unique_.load()};
+#endif
     // block until available
-    cv.wait(lock, [this] { return state != UNIQUE; });
-    state = SHARED;
-    ++count;
+    cv.wait(lock, [this] { return !unique_.load(); });
+    Shard().fetch_add(1);
   }
   bool try_lock() {
     auto lock = std::unique_lock{mtx};
-    if (state == UNLOCKED) {
-      state = UNIQUE;
-      return true;
-    }
-    return false;
+    if (unique_.load()) return false;
+    return TryAcquireUnique(0);
   }
 
   template <class Rep, class Period>
   bool try_lock_for(const std::chrono::duration<Rep, Period> &timeout_duration) {
     auto lock = std::unique_lock{mtx};
-    if (!cv.wait_for(lock, timeout_duration, [this] { return state == UNLOCKED; })) return false;
-    state = UNIQUE;
-    return true;
+    auto const deadline = std::chrono::steady_clock::now() + timeout_duration;
+    return AcquireUnique(0, [&](auto pred) { return cv.wait_until(lock, deadline, pred); });
   }
 
   bool try_lock_shared() {
+    if (TryLockSharedFast()) return true;
+    // Under the mutex the flag is only set while the lock is held uniquely
     auto lock = std::unique_lock{mtx};
-    if (state != UNIQUE) {
-      state = SHARED;
-      ++count;
-      return true;
-    }
-    return false;
+    if (unique_.load()) return false;
+    Shard().fetch_add(1);
+    return true;
   }
 
   template <typename Rep, typename Period>
   bool try_lock_shared_for(std::chrono::duration<Rep, Period> const &time) {
+    if (TryLockSharedFast()) return true;
     auto lock = std::unique_lock{mtx};
     // block until available
-    if (!cv.wait_for(lock, time, [this] { return state != UNIQUE; })) return false;
-    state = SHARED;
-    ++count;
+    if (!cv.wait_for(lock, time, [this] { return !unique_.load(); })) return false;
+    Shard().fetch_add(1);
     return true;
   }
 
   void unlock() {
     auto lock = std::unique_lock{mtx};
-    state = UNLOCKED;
+    unique_.store(false);
     cv.notify_all();  // multiple lock_shared maybe waiting
   }
   void unlock_shared() {
-    auto lock = std::unique_lock{mtx};
-    --count;
-    if (count == 0) {
-      state = UNLOCKED;
-      cv.notify_one();  // should be 0 waiting in lock_shared, only 1 wait in lock can progress
+    // The holder may be on another thread than the one which locked, only the
+    // sum of the shards is meaningful.
+    Shard().fetch_sub(1);
+    if (waiting_unique_.load() != 0) {
+      auto lock = std::unique_lock{mtx};
+      cv.notify_all();  // a waiting lock or upgrade may progress
     }
   }
 
   void upgrade_to_unique() {
     auto lock = std::unique_lock{mtx};
-    cv.wait(lock, [this] { return count == 1; });
-    state = UNIQUE;
-    count = 0;
+#ifdef MG_LOCK_CONTENTION_TRACKING
+    auto const wait = LockWait{site_, SharedCount() != 1};
+#endif
+    AcquireUnique(1, [&](auto pred) {
+      cv.wait(lock, pred);
+      return true;
+    });
+    // The shared hold of the caller becomes the unique one
+    Shard().fetch_sub(1);
   }
 
   template <class Rep, class Period>
   bool try_upgrade_to_unique(const std::chrono::duration<Rep, Period> &timeout_duration) {
     auto lock = std::unique_lock{mtx};
-    if (!cv.wait_for(lock, timeout_duration, [this] { return count == 1; })) return false;
-    state = UNIQUE;
-    count = 0;
+    auto const deadline = std::chrono::steady_clock::now() + timeout_duration;
+    if (!AcquireUnique(1, [&](auto pred) { return cv.wait_until(lock, deadline, pred); })) return false;
+    Shard().fetch_sub(1);
     return true;
   }
 
  private:
+  static constexpr size_t kShards = 64;
+
+  // Shared holders of the lock counted on a shard, the count of a shard can be
+  // negative if the lock was unlocked on another thread.
+  struct alignas(64) SharedShard {
+    std::atomic<int64_t> count{0};
+  };
+
+  std::atomic<int64_t> &Shard() { return shards_[ThreadShard()].count; }
+
+  static size_t ThreadShard() {
+    static std::atomic<size_t> next_shard{0};
+    thread_local size_t const shard = next_shard.fetch_add(1, std::memory_order_relaxed) % kShards;
+    return shard;
+  }
+
+  int64_t SharedCount() const {
+    int64_t count = 0;
+    for (auto const &shard : shards_) count += shard.count.load();
+    return count;
+  }
+
+  // The increment and the read of the flag are sequentially consistent, as are
+  // the write of the flag and the reads of the shards by a unique attempt, so
+  // either the reader sees the flag or the attempt sees the reader.
+  bool TryLockSharedFast() {
+    auto &shard = Shard();
+    shard.fetch_add(1);
+    if (!unique_.load()) return true;
+    shard.fetch_sub(1);
+    if (waiting_unique_.load() != 0) {
+      auto lock = std::unique_lock{mtx};
+      cv.notify_all();  // the attempt may have seen the backed off reader
+    }
+    return false;
+  }
+
+  // Must be called with the mutex held and without an other unique holder.
+  // Sets the flag if only the expected shared holders remain.
+  bool TryAcquireUnique(int64_t expected_shared) {
+    unique_.store(true);
+    if (SharedCount() == expected_shared) return true;
+    unique_.store(false);
+    cv.notify_all();  // the readers which saw the flag
+    return false;
+  }
+
+  // Must be called with the mutex held. Retries the unique attempt each time
+  // the lock has no unique holder and the expected shared holders remain.
+  // `wait` waits on the condition variable for the predicate and returns false
+  // on timeout.
+  template <typename TWait>
+  bool AcquireUnique(int64_t expected_shared, TWait &&wait) {
+    waiting_unique_.fetch_add(1);
+    bool acquired = false;
+    while (!acquired) {
+      if (!wait([&] { return !unique_.load() && SharedCount() == expected_shared; })) break;
+      acquired = TryAcquireUnique(expected_shared);
+    }
+    waiting_unique_.fetch_sub(1);
+    return acquired;
+  }
+
   std::mutex mtx;
   std::condition_variable cv;
-  states state = UNLOCKED;
-  uint64_t count = 0;
+  // Set while the lock is held uniquely and for the moment of a unique attempt,
+  // changed only under the mutex.
+  std::atomic<bool> unique_{false};
+  // Unique attempts waiting for the shared holders, which notify them on unlock.
+  std::atomic<uint64_t> waiting_unique_{0};
+  std::array<SharedShard, kShards> shards_;
+#ifdef MG_LOCK_CONTENTION_TRACKING
+  LockSite site_{LockSite::OTHER};
+#endif
 };
 
 struct ResourceLockGuard {
@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <charconv>
 #include <cstdint>
 #include <iomanip>
@@ -167,12 +168,72 @@ inline storage::PropertyStore DeserializePropertiesFromAuxiliaryStorages(std::st
   return storage::PropertyStore::CreateFromBuffer(FindPartOfStringView(value, '|', 2));
 }
 
+/// Keys of the main disk storage are written in a binary format: a marker
+/// byte, the number of labels and the label ids as varints, and the gid as
+/// a fixed-width big-endian integer. Keys in the text format, comma joined
+/// label ids and the gid separated by `|`, are still read; the vertex is
+/// written under a binary key when it is written again.
+inline constexpr char kBinaryVertexKeyMarker = '\x01';
+
+inline bool IsBinaryVertexKey(std::string_view key) { return !key.empty() && key.front() == kBinaryVertexKeyMarker; }
+
+inline void PutVarint64(std::string *dst, uint64_t value) {
+  while (value >= 0x80) {
+    dst->push_back(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  dst->push_back(static_cast<char>(value));
+}
+
+/// Decodes the varint at the start of `src` and removes it from `src`.
+inline uint64_t GetVarint64(std::string_view *src) {
+  uint64_t result = 0;
+  for (uint32_t shift = 0; shift < 64 && !src->empty(); shift += 7) {
+    auto const byte = static_cast<uint8_t>(src->front());
+    src->remove_prefix(1);
+    result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    if ((byte & 0x80) == 0) return result;
+  }
+  throw utils::BasicException("Invalid varint in a key of the disk storage.");
+}
+
+inline void PutFixed64BigEndian(std::string *dst, uint64_t value) {
+  for (int shift = 56; shift >= 0; shift -= 8) {
+    dst->push_back(static_cast<char>(value >> shift));
+  }
+}
+
+inline uint64_t DecodeFixed64BigEndian(std::string_view src) {
+  uint64_t result = 0;
+  for (size_t i = 0; i < sizeof(uint64_t); ++i) {
+    result = (result << 8) | static_cast<uint8_t>(src[i]);
+  }
+  return result;
+}
+
 inline std::string SerializeVertex(const storage::Vertex &vertex) {
-  std::string result = utils::SerializeLabels(TransformIDsToString(vertex.labels)) + "|";
-  return result + vertex.gid.ToString();
+  std::string result;
+  result.reserve(2 + vertex.labels.size() * 2 + sizeof(uint64_t));
+  result += kBinaryVertexKeyMarker;
+  PutVarint64(&result, vertex.labels.size());
+  for (const auto label : vertex.labels) {
+    PutVarint64(&result, label.AsUint());
+  }
+  PutFixed64BigEndian(&result, vertex.gid.AsUint());
+  return result;
 }
 
 inline std::vector<storage::LabelId> DeserializeLabelsFromMainDiskStorage(std::string_view key) {
+  if (IsBinaryVertexKey(key)) {
+    key.remove_prefix(1);
+    auto const count = GetVarint64(&key);
+    std::vector<storage::LabelId> labels;
+    labels.reserve(std::min<uint64_t>(count, key.size()));
+    for (uint64_t i = 0; i < count; ++i) {
+      labels.emplace_back(storage::LabelId::FromUint(static_cast<uint32_t>(GetVarint64(&key))));
+    }
+    return labels;
+  }
   std::string labels_str = std::string(key.substr(0, key.find('|')));
   if (SerializedVertexHasLabels(labels_str)) {
     return TransformFromStringLabels(utils::Split(labels_str, ","));
@@ -181,6 +242,9 @@ inline std::vector<storage::LabelId> DeserializeLabelsFromMainDiskStorage(std::s
 }
 
 inline std::vector<std::string> ExtractLabelsFromMainDiskStorage(std::string_view key) {
+  if (IsBinaryVertexKey(key)) {
+    return TransformIDsToString(DeserializeLabelsFromMainDiskStorage(key));
+  }
   return utils::Split(FindPartOfStringView(key, '|', 1), ",");
 }
 
@@ -188,7 +252,15 @@ inline storage::PropertyStore DeserializePropertiesFromMainDiskStorage(const std
   return storage::PropertyStore::CreateFromBuffer(value);
 }
 
-inline std::string_view ExtractGidFromMainDiskStorage(std::string_view key) { return ExtractGidFromKey(key); }
+inline storage::Gid ExtractGidFromMainDiskStorage(std::string_view key) {
+  if (IsBinaryVertexKey(key)) {
+    if (key.size() < 1 + sizeof(uint64_t)) {
+      throw utils::BasicException("Invalid vertex key in the disk storage.");
+    }
+    return storage::Gid::FromUint(DecodeFixed64BigEndian(key.substr(key.size() - sizeof(uint64_t))));
+  }
+  return storage::Gid::FromString(ExtractGidFromKey(key));
+}
 
 inline std::string_view ExtractGidFromUniqueConstraintStorage(std::string_view key) { return ExtractGidFromKey(key); }
 
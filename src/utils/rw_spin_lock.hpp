@@ -15,6 +15,8 @@
 #include <atomic>
 #include <cstdint>
 
+#include "utils/lock_contention.hpp"
+
 namespace memgraph::utils {
 namespace {
 /// A helper for RWSpinLock, allows a contended spin lock to yield to another thread.
@@ -47,9 +49,15 @@ struct yeilder {
  * The lock is friendly to writers.
  * - writer lock() will wait for all readers to leave unlock_shared()
  * - new reader lock_shared() will wait until writer has unlock()
+ * With MG_LOCK_CONTENTION_TRACKING the waits are recorded for the `site`.
  **/
 struct RWSpinLock {
   RWSpinLock() = default;
+#ifdef MG_LOCK_CONTENTION_TRACKING
+  explicit RWSpinLock(LockSite site) : site_{site} {}
+#else
+  explicit RWSpinLock(LockSite /*site*/) {}
+#endif
 
   ~RWSpinLock() = default;
   RWSpinLock(const RWSpinLock &) = delete;
@@ -58,6 +66,13 @@ struct RWSpinLock {
   RWSpinLock &operator=(RWSpinLock &&) = default;
 
   void lock() {
+#ifdef MG_LOCK_CONTENTION_TRACKING
+    auto expected = status_t{0};
+    if (std::atomic_ref{lock_status_}.compare_exchange_strong(expected, UNIQUE_LOCKED, std::memory_order_acq_rel)) {
+      return;
+    }
+    auto const wait = LockWait{site_};
+#endif
     // spin: to grant the UNIQUE_LOCKED bit
     while (true) {
       // optimistic: assume we will be granted the lock
@@ -93,6 +108,14 @@ struct RWSpinLock {
   void unlock() { std::atomic_ref{lock_status_}.fetch_and(~UNIQUE_LOCKED, std::memory_order_release); }
 
   void lock_shared() {
+#ifdef MG_LOCK_CONTENTION_TRACKING
+    auto current = std::atomic_ref{lock_status_}.load(std::memory_order_relaxed);
+    if ((current & UNIQUE_LOCKED) != UNIQUE_LOCKED &&
+        std::atomic_ref{lock_status_}.compare_exchange_strong(current, current + READER, std::memory_order_acquire)) {
+      return;
+    }
+    auto const wait = LockWait{site_};
+#endif
     while (true) {
       // optimistic: assume we will be granted the lock
       auto const phase1 = std::atomic_ref{lock_status_}.fetch_add(READER, std::memory_order_acquire);
@@ -128,5 +151,8 @@ struct RWSpinLock {
   // TODO: ATM not atomic, just used via atomic_ref, because the type needs to be movable into skip_list
   //       fix the design flaw and then make RWSpinLock a non-copy/non-move type
   status_t lock_status_ = 0;
+#ifdef MG_LOCK_CONTENTION_TRACKING
+  LockSite site_{LockSite::OTHER};
+#endif
 };
 }  // namespace memgraph::utils
@@ -0,0 +1,100 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+/// @file
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace memgraph::utils {
+
+/// A reader/writer lock for read-mostly structures. The readers are counted
+/// in one of `kSlots` cache lines picked by their thread, so readers on
+/// different cores don't contend for the same cache line. Writing is more
+/// expensive as the writer has to check all of the slots.
+///
+/// The lock is friendly to writers:
+/// - writer lock() blocks the new readers and waits for the current ones to
+///   leave
+/// - new readers wait until the writer has unlocked, blocked on its mutex
+///
+/// A shared lock must be unlocked on the thread which locked it.
+class ShardedRWLock {
+ public:
+  static constexpr size_t kSlots = 16;
+
+  ShardedRWLock() = default;
+
+  ShardedRWLock(const ShardedRWLock &) = delete;
+  ShardedRWLock &operator=(const ShardedRWLock &) = delete;
+  ShardedRWLock(ShardedRWLock &&) = delete;
+  ShardedRWLock &operator=(ShardedRWLock &&) = delete;
+
+  ~ShardedRWLock() = default;
+
+  void lock() {
+    writer_mutex_.lock();
+    writing_.store(true, std::memory_order_seq_cst);
+    for (auto &slot : slots_) {
+      // The readers may hold the lock for a while, e.g. while a user is
+      // authenticated by an external module.
+      for (auto tries = 0; slot.readers.load(std::memory_order_seq_cst) != 0; ++tries) {
+        if (tries < 64) {
+          std::this_thread::yield();
+        } else {
+          std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+      }
+    }
+  }
+
+  void unlock() {
+    writing_.store(false, std::memory_order_release);
+    writer_mutex_.unlock();
+  }
+
+  void lock_shared() {
+    auto &readers = slots_[SlotOfThread()].readers;
+    while (true) {
+      readers.fetch_add(1, std::memory_order_seq_cst);
+      if (!writing_.load(std::memory_order_seq_cst)) [[likely]]
+        return;
+      readers.fetch_sub(1, std::memory_order_release);
+      // Wait for the writer to unlock without spinning on the flag.
+      auto const wait_for_writer = std::lock_guard{writer_mutex_};
+    }
+  }
+
+  void unlock_shared() { slots_[SlotOfThread()].readers.fetch_sub(1, std::memory_order_release); }
+
+ private:
+  static size_t SlotOfThread() {
+    static std::atomic<size_t> next_slot{0};
+    thread_local const size_t slot = next_slot.fetch_add(1, std::memory_order_relaxed) % kSlots;
+    return slot;
+  }
+
+  struct alignas(64) Slot {
+    std::atomic<uint32_t> readers{0};
+  };
+
+  std::array<Slot, kSlots> slots_;
+  std::atomic<bool> writing_{false};
+  std::mutex writer_mutex_;
+};
+
+}  // namespace memgraph::utils
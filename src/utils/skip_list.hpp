@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <cmath>
 #include <cstdint>
@@ -20,6 +21,7 @@
 #include <optional>
 #include <random>
 #include <utility>
+#include <vector>
 
 #include "spdlog/spdlog.h"
 #include "utils/bound.hpp"
@@ -305,6 +307,7 @@ class SkipListGc final {
   void Collect(TNode *node) {
     std::unique_lock guard(lock_);
     deleted_.Push({accessor_id_.load(std::memory_order_acquire), node});
+    garbage_size_.fetch_add(1, std::memory_order_relaxed);
   }
 
   void Run() {
@@ -361,20 +364,27 @@ class SkipListGc final {
     }
     TStack leftover;
     std::optional<TDeleted> item;
+    uint64_t freed = 0;
     while ((item = deleted_.Pop())) {
       if (item->first < last_dead) {
         size_t bytes = SkipListNodeSize(*item->second);
         item->second->~TNode();
         memory_->Deallocate(item->second, bytes, SkipListNodeAlign<TObj>());
+        ++freed;
       } else {
         leftover.Push(*item);
       }
     }
     deleted_ = std::move(leftover);
+    garbage_size_.fetch_sub(freed, std::memory_order_relaxed);
   }
 
   MemoryResource *GetMemoryResource() const { return memory_; }
 
+  /// Number of removed nodes which aren't freed yet because an accessor
+  /// that was alive when they were removed could still be reading them.
+  uint64_t GarbageSize() const { return garbage_size_.load(std::memory_order_relaxed); }
+
   void Clear() {
     // Delete all allocated blocks.
     Block *head = head_.load(std::memory_order_acquire);
@@ -395,6 +405,7 @@ class SkipListGc final {
         item->second->~TNode();
         memory_->Deallocate(item->second, bytes, SkipListNodeAlign<TObj>());
       }
+      garbage_size_ = 0;
     }
 
     // Reset all variables.
@@ -406,17 +417,159 @@ class SkipListGc final {
 
  private:
   MemoryResource *memory_;
-  SpinLock lock_;
+  SpinLock lock_{LockSite::SKIP_LIST_GC};
   std::atomic<uint64_t> accessor_id_{0};
   std::atomic<Block *> head_{nullptr};
   std::atomic<Block *> tail_{nullptr};
   uint64_t last_id_{0};
   TStack deleted_;
+  std::atomic<uint64_t> garbage_size_{0};
 #ifndef NDEBUG
   std::atomic<uint64_t> alive_accessors_{0};
 #endif
 };
 
+/// This is the number of slots that the accessors of a `SkipListEpochGc` are
+/// spread over. Each thread always uses the same slot so that threads rarely
+/// contend on the cache line of the epoch counters.
+constexpr uint64_t kSkipListEpochGcSlots = 16;
+
+/// This is an alternative garbage collector for the SkipList which is based on
+/// epoch-based reclamation. It can be selected using the `TGc` template
+/// parameter of the SkipList (eg. `SkipList<int64_t, SkipListEpochGc>`).
+///
+/// The GC has a global epoch counter. Each accessor announces the epoch in
+/// which it was created by incrementing the counter of that epoch in the slot
+/// of its thread, and decrements the counter when it is destroyed. Each removed
+/// node is put into the limbo list of the epoch in which it was removed. The
+/// epoch can only be advanced when no accessor from the previous epoch is alive
+/// anymore. At that point no accessor can have a pointer to the nodes that are
+/// in the limbo list of the previous epoch so they are destroyed.
+///
+/// Because only three epochs can be active at once, the counters and the limbo
+/// lists are reused in a round-robin fashion. Compared to `SkipListGc` there is
+/// no structure that grows with the number of created accessors, but a single
+/// long-lived accessor stops all reclamation until it is destroyed.
+template <typename TObj>
+class SkipListEpochGc final {
+ private:
+  using TNode = SkipListNode<TObj>;
+  using TDeleted = std::pair<uint64_t, TNode *>;
+  using TStack = Stack<TDeleted, kSkipListGcStackSize>;
+
+  static constexpr uint64_t kEpochs = 3;
+
+  // The counter is padded to occupy a whole cache line.
+  struct Counter {
+    std::atomic<uint64_t> value{0};
+    char padding[64 - sizeof(std::atomic<uint64_t>)];
+  };
+
+  static uint64_t ThreadSlot() {
+    static std::atomic<uint64_t> next_slot{0};
+    static thread_local const uint64_t slot = next_slot.fetch_add(1, std::memory_order_relaxed) % kSkipListEpochGcSlots;
+    return slot;
+  }
+
+  bool IsQuiescent(uint64_t epoch) const {
+    for (const auto &counter : active_[epoch % kEpochs]) {
+      if (counter.value.load() != 0) return false;
+    }
+    return true;
+  }
+
+  void FreeLimbo(TStack &limbo) {
+    std::optional<TDeleted> item;
+    while ((item = limbo.Pop())) {
+      size_t bytes = SkipListNodeSize(*item->second);
+      item->second->~TNode();
+      memory_->Deallocate(item->second, bytes, SkipListNodeAlign<TObj>());
+      garbage_size_.fetch_sub(1, std::memory_order_relaxed);
+    }
+  }
+
+ public:
+  explicit SkipListEpochGc(MemoryResource *memory) : memory_(memory) {}
+
+  SkipListEpochGc(const SkipListEpochGc &) = delete;
+  SkipListEpochGc &operator=(const SkipListEpochGc &) = delete;
+  SkipListEpochGc(SkipListEpochGc &&other) = delete;
+  SkipListEpochGc &operator=(SkipListEpochGc &&other) = delete;
+
+  ~SkipListEpochGc() { Clear(); }
+
+  uint64_t AllocateId() {
+    const uint64_t slot = ThreadSlot();
+    while (true) {
+      // The epoch must be read again after the counter is incremented. If the
+      // epoch was advanced in the meantime, the GC could have already decided
+      // that the announced epoch is quiescent. All of the operations on the
+      // counters and on the epoch must be sequentially consistent for this to
+      // hold.
+      uint64_t epoch = epoch_.load();
+      auto &counter = active_[epoch % kEpochs][slot].value;
+      counter.fetch_add(1);
+      if (epoch_.load() == epoch) return epoch * kSkipListEpochGcSlots + slot;
+      counter.fetch_sub(1);
+    }
+  }
+
+  void ReleaseId(uint64_t id) {
+    const uint64_t epoch = id / kSkipListEpochGcSlots;
+    const uint64_t slot = id % kSkipListEpochGcSlots;
+    auto ret = active_[epoch % kEpochs][slot].value.fetch_sub(1);
+    MG_ASSERT(ret != 0, "A SkipList Accessor was released twice!");
+  }
+
+  void Collect(TNode *node) {
+    std::unique_lock guard(lock_);
+    // The epoch is only advanced while holding the lock, so the node is always
+    // put into the limbo list of the current epoch.
+    uint64_t epoch = epoch_.load(std::memory_order_acquire);
+    limbo_[epoch % kEpochs].Push({epoch, node});
+    garbage_size_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void Run() {
+    // See the note in `SkipListGc::Run`.
+    utils::MemoryTracker::OutOfMemoryExceptionBlocker oom_blocker;
+    if (!lock_.try_lock()) return;
+    OnScopeExit cleanup([&] { lock_.unlock(); });
+    // Nodes removed in the previous epoch can only be reached by accessors
+    // from the previous epoch (or older ones, which are already gone). After
+    // they are freed the epoch is advanced and the counters and the limbo list
+    // of the previous epoch are reused for the next one.
+    for (uint64_t i = 0; i < kEpochs - 1; ++i) {
+      uint64_t epoch = epoch_.load();
+      if (!IsQuiescent(epoch - 1)) break;
+      FreeLimbo(limbo_[(epoch - 1) % kEpochs]);
+      epoch_.store(epoch + 1);
+    }
+  }
+
+  MemoryResource *GetMemoryResource() const { return memory_; }
+
+  /// See `SkipListGc::GarbageSize`.
+  uint64_t GarbageSize() const { return garbage_size_.load(std::memory_order_relaxed); }
+
+  void Clear() {
+    std::unique_lock guard(lock_);
+    for (auto &limbo : limbo_) {
+      FreeLimbo(limbo);
+    }
+    epoch_ = 1;
+  }
+
+ private:
+  MemoryResource *memory_;
+  SpinLock lock_{LockSite::SKIP_LIST_GC};
+  // The epoch starts at 1 so that the previous epoch is always valid.
+  std::atomic<uint64_t> epoch_{1};
+  Counter active_[kEpochs][kSkipListEpochGcSlots];
+  TStack limbo_[kEpochs];
+  std::atomic<uint64_t> garbage_size_{0};
+};
+
 /// Concurrent skip list. It is mostly lock-free and fine-grained locking is
 /// used for conflict resolution.
 ///
@@ -578,7 +731,9 @@ class SkipListGc final {
 /// change must be implemented thread-safe inside the object.
 ///
 /// @tparam TObj object type that is stored in the list
-template <typename TObj>
+/// @tparam TGc garbage collector used to free the removed nodes, either
+///             `SkipListGc` or `SkipListEpochGc`
+template <typename TObj, template <typename> class TGc = SkipListGc>
 class SkipList final : detail::SkipListNode_base {
  private:
   using TNode = SkipListNode<TObj>;
@@ -678,6 +833,84 @@ class SkipList final : detail::SkipListNode_base {
     TNode *node_;
   };
 
+  /// A range of consecutive objects in the list, returned by
+  /// `Accessor::chunks`. The range ends before the first object which isn't
+  /// less than the object of the end boundary node. Comparing against the
+  /// boundary object (instead of stopping at the boundary node) keeps chunks
+  /// disjoint even when the boundary object is concurrently removed from the
+  /// list, because removed nodes are kept alive while any accessor exists.
+  ///
+  /// @tparam TValue `TObj` or `const TObj`, depending on the accessor
+  template <typename TValue>
+  class Chunk final {
+   public:
+    class Iterator final {
+     private:
+      friend class Chunk;
+
+      Iterator(TNode *node, TNode *end) : node_(node), end_(end) {
+        // The boundary node of the chunk could have been removed in the meantime.
+        while (node_ != nullptr && node_->marked.load(std::memory_order_acquire)) {
+          node_ = node_->nexts[0].load(std::memory_order_acquire);
+        }
+        CheckEnd();
+      }
+
+     public:
+      using value_type = TValue;
+      using difference_type = std::ptrdiff_t;
+
+      Iterator() = default;
+
+      value_type &operator*() const { return node_->obj; }
+
+      value_type *operator->() const { return &node_->obj; }
+
+      friend bool operator==(Iterator const &lhs, Iterator const &rhs) { return lhs.node_ == rhs.node_; }
+
+      Iterator &operator++() {
+        do {
+          node_ = node_->nexts[0].load(std::memory_order_acquire);
+        } while (node_ != nullptr && node_->marked.load(std::memory_order_acquire));
+        CheckEnd();
+        return *this;
+      }
+
+      Iterator operator++(int) {
+        Iterator old = *this;
+        ++(*this);
+        return old;
+      }
+
+     private:
+      void CheckEnd() {
+        if (node_ != nullptr && end_ != nullptr && !(node_->obj < end_->obj)) node_ = nullptr;
+      }
+
+      TNode *node_{nullptr};
+      TNode *end_{nullptr};
+    };
+
+    Iterator begin() const { return Iterator{begin_, end_}; }
+    Iterator end() const { return Iterator{nullptr, nullptr}; }
+
+    /// First object of the chunk, or nullptr if the chunk starts at the
+    /// beginning of the list.
+    TValue *lower() const { return lower_ ? &lower_->obj : nullptr; }
+    /// Object at which the chunk ends (exclusive), or nullptr if the chunk
+    /// reaches the end of the list.
+    TValue *upper() const { return end_ ? &end_->obj : nullptr; }
+
+   private:
+    friend class SkipList;
+
+    Chunk(TNode *lower, TNode *begin, TNode *end) : lower_(lower), begin_(begin), end_(end) {}
+
+    TNode *lower_{nullptr};
+    TNode *begin_{nullptr};
+    TNode *end_{nullptr};
+  };
+
   class Accessor final {
    private:
     friend class SkipList;
@@ -817,6 +1050,16 @@ class SkipList final : detail::SkipListNode_base {
       return skiplist_->estimate_average_number_of_equals(equal_cmp, max_layer_for_estimation);
     }
 
+    /// Splits the list into at most `num_chunks` disjoint ranges of
+    /// approximately equal size which together cover the whole list. The
+    /// boundaries are sampled from the highest layer of the list which still
+    /// has enough nodes, so the split costs O(num_chunks) instead of a pass
+    /// over the whole list. Objects inserted concurrently end up in exactly
+    /// one of the chunks if they are visible at all.
+    ///
+    /// @return std::vector<Chunk<TObj>> chunks ordered by their keys
+    std::vector<Chunk<TObj>> chunks(uint64_t num_chunks) { return skiplist_->template chunks<TObj>(num_chunks); }
+
     /// Removes the key from the list.
     ///
     /// @return bool indicating whether the removal was successful
@@ -902,6 +1145,10 @@ class SkipList final : detail::SkipListNode_base {
       return skiplist_->estimate_average_number_of_equals(equal_cmp, max_layer_for_estimation);
     }
 
+    std::vector<Chunk<const TObj>> chunks(uint64_t num_chunks) const {
+      return skiplist_->template chunks<const TObj>(num_chunks);
+    }
+
     uint64_t size() const { return skiplist_->size(); }
 
    private:
@@ -971,6 +1218,10 @@ class SkipList final : detail::SkipListNode_base {
   /// atomic operation.
   uint64_t size() const { return size_.load(std::memory_order_acquire); }
 
+  /// Number of removed elements which are still waiting for the garbage
+  /// collection of the list.
+  uint64_t garbage_size() const { return gc_.GarbageSize(); }
+
   MemoryResource *GetMemoryResource() const { return gc_.GetMemoryResource(); }
 
   /// This function removes all elements from the list.
@@ -995,6 +1246,56 @@ class SkipList final : detail::SkipListNode_base {
   void run_gc() { gc_.Run(); }
 
  private:
+  template <typename TValue>
+  std::vector<Chunk<TValue>> chunks(uint64_t num_chunks) const {
+    auto boundaries = sample_chunk_boundaries(num_chunks);
+    std::vector<Chunk<TValue>> result;
+    result.reserve(boundaries.size() + 1);
+    TNode *lower = nullptr;
+    TNode *begin = head_->nexts[0].load(std::memory_order_acquire);
+    for (auto *boundary : boundaries) {
+      result.push_back(Chunk<TValue>{lower, begin, boundary});
+      lower = boundary;
+      begin = boundary;
+    }
+    result.push_back(Chunk<TValue>{lower, begin, nullptr});
+    return result;
+  }
+
+  /// Picks up to `num_chunks - 1` nodes which split the list into ranges of
+  /// about the same size. Each layer holds about half of the nodes of the one
+  /// below it, so the nodes of the highest layer with at least `num_chunks`
+  /// of them are spread evenly over the whole list.
+  std::vector<TNode *> sample_chunk_boundaries(uint64_t num_chunks) const {
+    std::vector<TNode *> boundaries;
+    const auto size = size_.load(std::memory_order_acquire);
+    num_chunks = std::min(num_chunks, size);
+    if (num_chunks <= 1) return boundaries;
+
+    int layer = 0;
+    while (layer + 1 < kSkipListMaxHeight && (size >> (layer + 1)) >= num_chunks) ++layer;
+
+    std::vector<TNode *> samples;
+    // Towers are random, so the chosen layer may end up too sparse; fall back
+    // to the layers below it.
+    for (; layer >= 0; --layer) {
+      samples.clear();
+      for (TNode *curr = head_->nexts[layer].load(std::memory_order_acquire); curr != nullptr;
+           curr = curr->nexts[layer].load(std::memory_order_acquire)) {
+        if (!curr->marked.load(std::memory_order_acquire)) samples.push_back(curr);
+      }
+      if (samples.size() >= num_chunks) break;
+    }
+    if (samples.size() < 2) return boundaries;
+    num_chunks = std::min<uint64_t>(num_chunks, samples.size());
+
+    boundaries.reserve(num_chunks - 1);
+    for (uint64_t i = 1; i < num_chunks; ++i) {
+      boundaries.push_back(samples[i * samples.size() / num_chunks]);
+    }
+    return boundaries;
+  }
+
   template <typename TKey>
   int find_node(const TKey &key, TNode *preds[], TNode *succs[]) const {
     int layer_found = -1;
@@ -1365,7 +1666,7 @@ class SkipList final : detail::SkipListNode_base {
  private:
   TNode *head_{nullptr};
   // gc_ also stores the only copy of `MemoryResource *`, to save space.
-  mutable SkipListGc<TObj> gc_;
+  mutable TGc<TObj> gc_;
 
   std::atomic<uint64_t> size_{0};
 };
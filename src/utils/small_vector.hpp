@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include "utils/allocator/small_block_pool.hpp"
 #include "utils/memory_layout.hpp"
 
 #include <cassert>
@@ -191,7 +192,7 @@ struct small_vector {
     // NOTE 1: smallest capacity is kSmallCapacity
     // NOTE 2: upon copy construct we only need enough capacity to satisfy size requirement
     if (!usingSmallBuffer(capacity_)) {
-      buffer_ = reinterpret_cast<pointer>(operator new (capacity_ * sizeof(T), std::align_val_t{alignof(T)}));
+      buffer_ = allocate(capacity_);
     }
     std::ranges::uninitialized_copy(other, *this);
   }
@@ -215,12 +216,12 @@ struct small_vector {
     }
     // NOTE : ensure we have enough capacity
     if (capacity_ < other.size_) {
-      auto *new_data = reinterpret_cast<pointer>(operator new (other.size_ * sizeof(T), std::align_val_t{alignof(T)}));
+      auto *new_data = allocate(other.size_);
       // NOTE: move values to the new buffer
       std::ranges::uninitialized_move(begin(), end(), new_data, new_data + size_);
       std::destroy(begin(), end());
       if (!usingSmallBuffer(capacity_)) {
-        operator delete (buffer_, std::align_val_t{alignof(T)});
+        deallocate(buffer_, capacity_);
       }
       buffer_ = new_data;
       capacity_ = other.size_;
@@ -283,9 +284,9 @@ struct small_vector {
       } else {
         std::destroy(begin(), end());
         size_ = std::exchange(other.size_, 0);
-        capacity_ = std::exchange(other.capacity_, kSmallCapacity);
+        auto old_capacity = std::exchange(capacity_, std::exchange(other.capacity_, kSmallCapacity));
         auto old_buffer = std::exchange(buffer_, other.buffer_);
-        operator delete (old_buffer, std::align_val_t{alignof(T)});
+        deallocate(old_buffer, old_capacity);
       }
     }
     return *this;
@@ -294,7 +295,7 @@ struct small_vector {
   ~small_vector() {
     std::destroy(begin(), end());
     if (!usingSmallBuffer(capacity_)) {
-      operator delete (buffer_, std::align_val_t{alignof(T)});
+      deallocate(buffer_, capacity_);
     }
   }
 
@@ -305,7 +306,7 @@ struct small_vector {
   // TODO: generalise to not just vector
   explicit small_vector(std::vector<T> &&other) : size_(other.size()), capacity_{std::max(size_, kSmallCapacity)} {
     if (!usingSmallBuffer(capacity_)) {
-      buffer_ = reinterpret_cast<pointer>(operator new (capacity_ * sizeof(T), std::align_val_t{alignof(T)}));
+      buffer_ = allocate(capacity_);
     }
     std::ranges::uninitialized_move(other.begin(), other.end(), begin(), end());
   }
@@ -314,7 +315,7 @@ struct small_vector {
   explicit small_vector(It first, It last)
       : size_(std::distance(first, last)), capacity_{std::max(size_, kSmallCapacity)} {
     if (!usingSmallBuffer(capacity_)) {
-      buffer_ = reinterpret_cast<pointer>(operator new (capacity_ * sizeof(T), std::align_val_t{alignof(T)}));
+      buffer_ = allocate(capacity_);
     }
     std::ranges::uninitialized_copy(first, last, begin(), end());
   }
@@ -379,16 +380,36 @@ struct small_vector {
       return;
     }
 
-    auto *new_data = reinterpret_cast<pointer>(operator new (new_capacity * sizeof(T), std::align_val_t{alignof(T)}));
+    auto *new_data = allocate(new_capacity);
     std::uninitialized_move(begin(), end(), new_data);
     std::destroy(begin(), end());
     if (!usingSmallBuffer(capacity_)) {
-      operator delete (buffer_, std::align_val_t{alignof(T)});
+      deallocate(buffer_, capacity_);
     }
     buffer_ = new_data;
     capacity_ = new_capacity;
   }
 
+  /// Releases the unused capacity. The elements are moved back into the small
+  /// buffer if they fit in it.
+  void shrink_to_fit() {
+    auto const new_capacity = std::max(size_, kSmallCapacity);
+    if (new_capacity >= capacity_) {
+      return;
+    }
+
+    // NOTE: the small buffer shares the memory with `buffer_`
+    auto *old_data = buffer_;
+    auto *new_data = usingSmallBuffer(new_capacity) ? small_buffer_->as() : allocate(new_capacity);
+    std::uninitialized_move(old_data, old_data + size_, new_data);
+    std::destroy(old_data, old_data + size_);
+    deallocate(old_data, capacity_);
+    if (!usingSmallBuffer(new_capacity)) {
+      buffer_ = new_data;
+    }
+    capacity_ = new_capacity;
+  }
+
   void resize(uint32_t new_size) {
     if (size_ < new_size) {
       reserve(new_size);
@@ -470,6 +491,15 @@ struct small_vector {
  private:
   constexpr static bool usingSmallBuffer(uint32_t capacity) { return capacity == kSmallCapacity; }
 
+  // Small heap buffers, e.g. the adjacency lists of most vertices, come from the pool
+  static auto allocate(uint32_t capacity) -> pointer {
+    return reinterpret_cast<pointer>(SmallBlockPool::Allocate(capacity * sizeof(T), alignof(T)));
+  }
+
+  static void deallocate(pointer buffer, uint32_t capacity) noexcept {
+    SmallBlockPool::Deallocate(buffer, capacity * sizeof(T), alignof(T));
+  }
+
   uint32_t size_{};                    // max 4 billion
   uint32_t capacity_{kSmallCapacity};  // max 4 billion
   union {
@@ -13,6 +13,7 @@
 
 #include <pthread.h>
 
+#include "utils/lock_contention.hpp"
 #include "utils/logging.hpp"
 
 namespace memgraph::utils {
@@ -28,8 +29,15 @@ namespace memgraph::utils {
 /// mispredictions, etc... The explanation can be seen here:
 /// https://stackoverflow.com/questions/26583433/c11-implementation-of-spinlock-using-atomic/29195378#29195378
 /// https://software.intel.com/en-us/node/524249
+/// With MG_LOCK_CONTENTION_TRACKING the waits are recorded for the `site`.
 class SpinLock {
  public:
+#ifdef MG_LOCK_CONTENTION_TRACKING
+  explicit SpinLock(LockSite site) : SpinLock() { site_ = site; }
+#else
+  explicit SpinLock(LockSite /*site*/) : SpinLock() {}
+#endif
+
   SpinLock() {
     // `pthread_spin_init` returns -1 only when there isn't enough memory to
     // initialize the lock. That should never occur because the
@@ -40,12 +48,18 @@ class SpinLock {
 
   SpinLock(SpinLock &&other) noexcept : lock_(other.lock_) {
     MG_ASSERT(pthread_spin_init(&other.lock_, PTHREAD_PROCESS_PRIVATE) == 0, "Couldn't construct utils::SpinLock!");
+#ifdef MG_LOCK_CONTENTION_TRACKING
+    site_ = other.site_;
+#endif
   }
 
   SpinLock &operator=(SpinLock &&other) noexcept {
     MG_ASSERT(pthread_spin_destroy(&lock_) == 0, "Couldn't destruct utils::SpinLock!");
     lock_ = other.lock_;
     MG_ASSERT(pthread_spin_init(&other.lock_, PTHREAD_PROCESS_PRIVATE) == 0, "Couldn't construct utils::SpinLock!");
+#ifdef MG_LOCK_CONTENTION_TRACKING
+    site_ = other.site_;
+#endif
     return *this;
   }
 
@@ -55,6 +69,10 @@ class SpinLock {
   ~SpinLock() { MG_ASSERT(pthread_spin_destroy(&lock_) == 0, "Couldn't destruct utils::SpinLock!"); }
 
   void lock() {
+#ifdef MG_LOCK_CONTENTION_TRACKING
+    if (try_lock()) return;
+    auto const wait = LockWait{site_};
+#endif
     // `pthread_spin_lock` returns -1 only when there is a deadlock detected
     // (errno EDEADLOCK).
     MG_ASSERT(pthread_spin_lock(&lock_) == 0, "Couldn't lock utils::SpinLock!");
@@ -74,5 +92,8 @@ class SpinLock {
 
  private:
   pthread_spinlock_t lock_;
+#ifdef MG_LOCK_CONTENTION_TRACKING
+  LockSite site_{LockSite::OTHER};
+#endif
 };
 }  // namespace memgraph::utils
@@ -10,19 +10,36 @@
 // licenses/APL.txt.
 
 #include "utils/thread_pool.hpp"
+
+#include <algorithm>
+
 namespace memgraph::utils {
 
+namespace {
+// The pool and the queue of the worker running on this thread, if any.
+thread_local const ThreadPool *current_pool = nullptr;
+thread_local size_t current_worker_id = 0;
+}  // namespace
+
 ThreadPool::ThreadPool(const size_t pool_size) {
+  queues_.reserve(pool_size);
   for (size_t i = 0; i < pool_size; ++i) {
-    thread_pool_.emplace_back(([this] { this->ThreadLoop(); }));
+    queues_.emplace_back(std::make_unique<TaskQueue>());
+  }
+  for (size_t i = 0; i < pool_size; ++i) {
+    thread_pool_.emplace_back(([this, i] { this->ThreadLoop(i); }));
   }
 }
 
-void ThreadPool::AddTask(std::function<void()> new_task) {
-  task_queue_.WithLock([&](auto &queue) {
-    queue.emplace(std::make_unique<TaskSignature>(std::move(new_task)));
-    unfinished_tasks_num_.fetch_add(1);
-  });
+void ThreadPool::AddTask(Task new_task, TaskPriority priority) {
+  unfinished_tasks_num_.fetch_add(1);
+  if (priority == TaskPriority::HIGH || queues_.empty()) {
+    high_priority_queue_->emplace_back(std::move(new_task));
+  } else {
+    const auto queue_id =
+        current_pool == this ? current_worker_id : next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+    (*queues_[queue_id])->emplace_back(std::move(new_task));
+  }
   std::unique_lock pool_guard(pool_lock_);
   queue_cv_.notify_one();
 }
@@ -50,32 +67,47 @@ ThreadPool::~ThreadPool() {
   }
 }
 
-std::unique_ptr<ThreadPool::TaskSignature> ThreadPool::PopTask() {
-  return task_queue_.WithLock([](auto &queue) -> std::unique_ptr<TaskSignature> {
-    if (queue.empty()) {
-      return nullptr;
-    }
+Task ThreadPool::PopTask(const size_t worker_id) {
+  auto pop_front = [](auto &queue) -> Task {
+    if (queue.empty()) return {};
     auto front = std::move(queue.front());
-    queue.pop();
+    queue.pop_front();
     return front;
-  });
+  };
+  if (auto task = high_priority_queue_.WithLock(pop_front)) return task;
+  if (auto task = queues_[worker_id]->WithLock(pop_front)) return task;
+
+  // Steal the newest task of another worker, the oldest ones are the most
+  // likely to be taken by their own worker next.
+  for (size_t i = 1; i < queues_.size(); ++i) {
+    auto task = queues_[(worker_id + i) % queues_.size()]->WithLock([](auto &queue) -> Task {
+      if (queue.empty()) return {};
+      auto back = std::move(queue.back());
+      queue.pop_back();
+      return back;
+    });
+    if (task) return task;
+  }
+  return {};
 }
 
-void ThreadPool::ThreadLoop() {
-  std::unique_ptr<TaskSignature> task = PopTask();
+void ThreadPool::ThreadLoop(const size_t worker_id) {
+  current_pool = this;
+  current_worker_id = worker_id;
+  Task task = PopTask(worker_id);
   while (true) {
     while (task) {
       if (terminate_pool_.load()) {
         return;
       }
-      (*task)();
+      task();
       unfinished_tasks_num_.fetch_sub(1);
-      task = PopTask();
+      task = PopTask(worker_id);
     }
 
     std::unique_lock guard(pool_lock_);
     queue_cv_.wait(guard, [&] {
-      task = PopTask();
+      task = PopTask(worker_id);
       return task || terminate_pool_.load();
     });
     if (terminate_pool_.load()) {
@@ -86,4 +118,9 @@ void ThreadPool::ThreadLoop() {
 
 size_t ThreadPool::UnfinishedTasksNum() const { return unfinished_tasks_num_.load(); }
 
+ThreadPool &CpuThreadPool() {
+  static ThreadPool pool{std::max(std::thread::hardware_concurrency(), 2U) - 1};
+  return pool;
+}
+
 }  // namespace memgraph::utils
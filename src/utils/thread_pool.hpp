@@ -11,11 +11,19 @@
 
 #pragma once
 #include <atomic>
+#include <concepts>
 #include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
 #include <functional>
+#include <memory>
 #include <mutex>
-#include <queue>
+#include <new>
 #include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "utils/spin_lock.hpp"
 #include "utils/synchronized.hpp"
@@ -33,13 +41,125 @@ struct CopyMovableFunctionWrapper {
   std::shared_ptr<Func> func_;
 };
 
-class ThreadPool {
-  using TaskSignature = std::function<void()>;
+/// Move-only `void()` callable. Callables of up to `kInlineSize` bytes are
+/// kept inline, so most tasks are queued without an allocation, and unlike
+/// `std::function` the callable doesn't have to be copyable.
+class Task {
+ public:
+  static constexpr size_t kInlineSize = 48;
+
+  Task() = default;
+
+  template <typename Func>
+  requires(!std::same_as<std::remove_cvref_t<Func>, Task>) && std::invocable<std::remove_cvref_t<Func> &>
+  // NOLINTNEXTLINE(google-explicit-constructor,hicpp-explicit-conversions)
+  Task(Func &&func) : ops_{&kOps<std::remove_cvref_t<Func>>} {
+    using Stored = std::remove_cvref_t<Func>;
+    if constexpr (kIsInline<Stored>) {
+      new (storage_) Stored(std::forward<Func>(func));
+    } else {
+      new (storage_) Stored *(new Stored(std::forward<Func>(func)));
+    }
+  }
+
+  Task(Task &&other) noexcept : ops_{std::exchange(other.ops_, nullptr)} {
+    if (ops_) ops_->move(storage_, other.storage_);
+  }
+
+  Task &operator=(Task &&other) noexcept {
+    if (this == &other) return *this;
+    Reset();
+    ops_ = std::exchange(other.ops_, nullptr);
+    if (ops_) ops_->move(storage_, other.storage_);
+    return *this;
+  }
+
+  Task(const Task &) = delete;
+  Task &operator=(const Task &) = delete;
+
+  ~Task() { Reset(); }
+
+  explicit operator bool() const { return ops_ != nullptr; }
+
+  void operator()() { ops_->invoke(storage_); }
+
+ private:
+  struct Ops {
+    void (*invoke)(std::byte *);
+    // Move constructs the callable in `dst` and destroys the one in `src`.
+    void (*move)(std::byte *dst, std::byte *src) noexcept;
+    void (*destroy)(std::byte *) noexcept;
+  };
+
+  template <typename Func>
+  static constexpr bool kIsInline = sizeof(Func) <= kInlineSize && alignof(Func) <= alignof(std::max_align_t) &&
+                                    std::is_nothrow_move_constructible_v<Func>;
+
+  template <typename Func>
+  static Func &Get(std::byte *storage) {
+    if constexpr (kIsInline<Func>) {
+      return *std::launder(reinterpret_cast<Func *>(storage));
+    } else {
+      return **std::launder(reinterpret_cast<Func **>(storage));
+    }
+  }
+
+  template <typename Func>
+  static constexpr Ops kOps{
+      .invoke = [](std::byte *storage) { Get<Func>(storage)(); },
+      .move =
+          [](std::byte *dst, std::byte *src) noexcept {
+            if constexpr (kIsInline<Func>) {
+              new (dst) Func(std::move(Get<Func>(src)));
+              Get<Func>(src).~Func();
+            } else {
+              new (dst) Func *(&Get<Func>(src));
+            }
+          },
+      .destroy =
+          [](std::byte *storage) noexcept {
+            if constexpr (kIsInline<Func>) {
+              Get<Func>(storage).~Func();
+            } else {
+              delete &Get<Func>(storage);
+            }
+          },
+  };
+
+  void Reset() {
+    if (ops_) std::exchange(ops_, nullptr)->destroy(storage_);
+  }
+
+  alignas(std::max_align_t) std::byte storage_[kInlineSize];
+  const Ops *ops_{nullptr};
+};
+
+enum class TaskPriority : uint8_t {
+  LOW,
+  /// Started before all of the LOW priority tasks which weren't started yet.
+  HIGH,
+};
 
+/// Pool of threads, each with its own queue of tasks. The tasks added by a
+/// worker go to its own queue and the tasks added by other threads are spread
+/// over the queues. A worker takes the oldest task of its queue and steals
+/// the newest tasks of the others when its queue is empty, so the tasks
+/// aren't contended over a single lock. The tasks of a single queue start in
+/// the order they were added, so a pool with a single thread runs its tasks
+/// in order.
+class ThreadPool {
  public:
   explicit ThreadPool(size_t pool_size);
 
-  void AddTask(std::function<void()> new_task);
+  void AddTask(Task new_task, TaskPriority priority = TaskPriority::LOW);
+
+  /// Calls @p func with each index in [0, count) on the workers of the pool
+  /// and the calling thread, and returns once all of the calls returned. The
+  /// calling thread makes the calls no worker took, so it can be called from
+  /// a task of the pool or on a pool whose workers are busy. The first
+  /// exception a call throws is rethrown once all of the calls returned.
+  template <typename Func>
+  void RunParallel(size_t count, const Func &func);
 
   void ShutDown();
 
@@ -52,19 +172,67 @@ class ThreadPool {
 
   size_t UnfinishedTasksNum() const;
 
+  size_t Size() const { return queues_.size(); }
+
  private:
-  std::unique_ptr<TaskSignature> PopTask();
+  using TaskQueue = utils::Synchronized<std::deque<Task>, utils::SpinLock>;
+
+  Task PopTask(size_t worker_id);
 
-  void ThreadLoop();
+  void ThreadLoop(size_t worker_id);
 
   std::vector<std::thread> thread_pool_;
 
   std::atomic<size_t> unfinished_tasks_num_{0};
   std::atomic<bool> terminate_pool_{false};
   std::atomic<bool> stopped_{false};
-  utils::Synchronized<std::queue<std::unique_ptr<TaskSignature>>, utils::SpinLock> task_queue_;
+  std::vector<std::unique_ptr<TaskQueue>> queues_;
+  TaskQueue high_priority_queue_;
+  std::atomic<size_t> next_queue_{0};
   std::mutex pool_lock_;
   std::condition_variable queue_cv_;
 };
 
+/// Pool with a thread for each CPU but one, shared by the operations which
+/// split their work over multiple threads, so they don't start threads of
+/// their own and together don't use more threads than there are CPUs.
+ThreadPool &CpuThreadPool();
+
+template <typename Func>
+void ThreadPool::RunParallel(size_t count, const Func &func) {
+  struct State {
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> done{0};
+    std::mutex lock;
+    std::condition_variable cv;
+    std::exception_ptr error;
+  };
+  // The tasks which start once all of the calls were made only touch the
+  // state, so it outlives this call.
+  auto state = std::make_shared<State>();
+  auto make_calls = [state, count, &func] {
+    for (auto index = state->next.fetch_add(1); index < count; index = state->next.fetch_add(1)) {
+      try {
+        func(index);
+      } catch (...) {
+        std::lock_guard guard{state->lock};
+        if (!state->error) state->error = std::current_exception();
+      }
+      if (state->done.fetch_add(1) + 1 == count) {
+        std::lock_guard guard{state->lock};
+        state->cv.notify_all();
+      }
+    }
+  };
+
+  for (size_t i = 1; i < std::min(count, Size() + 1); ++i) {
+    AddTask(make_calls);
+  }
+  make_calls();
+
+  std::unique_lock guard{state->lock};
+  state->cv.wait(guard, [&] { return state->done.load() == count; });
+  if (state->error) std::rethrow_exception(state->error);
+}
+
 }  // namespace memgraph::utils
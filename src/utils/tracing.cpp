@@ -0,0 +1,152 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#include "utils/tracing.hpp"
+
+#include <chrono>
+#include <random>
+
+namespace memgraph::utils::tracing {
+
+namespace {
+
+// The trace the thread is in, the trace ID is zero outside of a trace.
+struct Context {
+  uint64_t trace_id_high{0};
+  uint64_t trace_id_low{0};
+  uint64_t span_id{0};
+};
+
+thread_local Context context;
+
+// Each thread counts its own requests, so the sampling doesn't share a counter.
+thread_local uint64_t requests{0};
+
+std::atomic<uint64_t> sample_rate{0};
+
+SpanBuffer &Buffer() {
+  static SpanBuffer buffer;
+  return buffer;
+}
+
+// Random non-zero ID, zero is reserved for a missing ID.
+uint64_t RandomId() {
+  thread_local std::mt19937_64 generator{std::random_device{}()};
+  uint64_t id = 0;
+  while (id == 0) id = generator();
+  return id;
+}
+
+uint64_t NowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+// Starts a trace on the thread if it isn't in one and the request is sampled.
+bool StartTrace() {
+  if (context.trace_id_low != 0) return false;
+  const auto rate = sample_rate.load(std::memory_order_relaxed);
+  if (rate == 0 || requests++ % rate != 0) return false;
+  context = {.trace_id_high = RandomId(), .trace_id_low = RandomId(), .span_id = 0};
+  return true;
+}
+
+}  // namespace
+
+// Vyukov's bounded queue: the sequence of a cell tells whether it is free for
+// the producer at the position or holds a span for the consumer at it.
+SpanBuffer::SpanBuffer() {
+  for (size_t i = 0; i < kCapacity; ++i) cells_[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+bool SpanBuffer::Push(const Span &span) {
+  auto position = enqueue_position_.load(std::memory_order_relaxed);
+  while (true) {
+    auto &cell = cells_[position & (kCapacity - 1)];
+    const auto sequence = cell.sequence.load(std::memory_order_acquire);
+    const auto diff = static_cast<int64_t>(sequence - position);
+    if (diff == 0) {
+      if (enqueue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+        cell.span = span;
+        cell.sequence.store(position + 1, std::memory_order_release);
+        return true;
+      }
+    } else if (diff < 0) {
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    } else {
+      position = enqueue_position_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+std::optional<Span> SpanBuffer::Pop() {
+  auto position = dequeue_position_.load(std::memory_order_relaxed);
+  while (true) {
+    auto &cell = cells_[position & (kCapacity - 1)];
+    const auto sequence = cell.sequence.load(std::memory_order_acquire);
+    const auto diff = static_cast<int64_t>(sequence - (position + 1));
+    if (diff == 0) {
+      if (dequeue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+        auto span = cell.span;
+        cell.sequence.store(position + kCapacity, std::memory_order_release);
+        return span;
+      }
+    } else if (diff < 0) {
+      return std::nullopt;
+    } else {
+      position = dequeue_position_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+void SetSampleRate(uint64_t rate) { sample_rate.store(rate, std::memory_order_relaxed); }
+
+std::vector<Span> TakeSpans(size_t max_spans) {
+  std::vector<Span> spans;
+  while (spans.size() < max_spans) {
+    auto span = Buffer().Pop();
+    if (!span) break;
+    spans.push_back(*span);
+  }
+  return spans;
+}
+
+uint64_t DroppedSpans() { return Buffer().Dropped(); }
+
+ScopedSpan::ScopedSpan(const char *name) {
+  if (context.trace_id_low == 0) return;
+  recording_ = true;
+  span_ = {.trace_id_high = context.trace_id_high,
+           .trace_id_low = context.trace_id_low,
+           .span_id = RandomId(),
+           .parent_span_id = context.span_id,
+           .name = name,
+           .start_ns = NowNs()};
+  context.span_id = span_.span_id;
+}
+
+ScopedSpan::~ScopedSpan() {
+  if (!recording_) return;
+  span_.end_ns = NowNs();
+  context.span_id = span_.parent_span_id;
+  Buffer().Push(span_);
+}
+
+Trace::Trace(const char *name) : root_(StartTrace()), span_(name) {}
+
+Trace::~Trace() {
+  // The root span still has the trace after it is cleared from the thread.
+  if (root_) context.trace_id_low = 0;
+}
+
+}  // namespace memgraph::utils::tracing
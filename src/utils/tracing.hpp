@@ -0,0 +1,106 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace memgraph::utils::tracing {
+
+/// A finished span, the times are nanoseconds since the Unix epoch. The name
+/// must be a string literal, the spans keep the pointer.
+struct Span {
+  uint64_t trace_id_high{0};
+  uint64_t trace_id_low{0};
+  uint64_t span_id{0};
+  uint64_t parent_span_id{0};
+  const char *name{nullptr};
+  uint64_t start_ns{0};
+  uint64_t end_ns{0};
+};
+
+/// Bounded multi-producer multi-consumer queue of the finished spans which
+/// don't take a lock. The spans which don't fit are dropped and counted.
+class SpanBuffer {
+ public:
+  static constexpr size_t kCapacity = 1U << 14U;
+
+  SpanBuffer();
+
+  bool Push(const Span &span);
+  std::optional<Span> Pop();
+
+  uint64_t Dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+ private:
+  struct Cell {
+    std::atomic<uint64_t> sequence;
+    Span span;
+  };
+
+  std::array<Cell, kCapacity> cells_;
+  alignas(64) std::atomic<uint64_t> enqueue_position_{0};
+  alignas(64) std::atomic<uint64_t> dequeue_position_{0};
+  std::atomic<uint64_t> dropped_{0};
+};
+
+/// Traces 1 in @p rate of the requests started on each thread, 0 disables
+/// the tracing.
+void SetSampleRate(uint64_t rate);
+
+/// Takes at most @p max_spans of the finished spans.
+std::vector<Span> TakeSpans(size_t max_spans);
+
+/// Spans dropped because the buffer was full.
+uint64_t DroppedSpans();
+
+/// Times a scope as a child of the span open on the thread. Doesn't record
+/// anything if the thread isn't in a sampled trace, which costs a read of a
+/// thread local.
+class ScopedSpan {
+ public:
+  explicit ScopedSpan(const char *name);
+  ~ScopedSpan();
+
+  ScopedSpan(const ScopedSpan &) = delete;
+  ScopedSpan(ScopedSpan &&) = delete;
+  ScopedSpan &operator=(const ScopedSpan &) = delete;
+  ScopedSpan &operator=(ScopedSpan &&) = delete;
+
+ private:
+  Span span_;
+  bool recording_{false};
+};
+
+/// Starts a trace if the thread isn't in one and the request is sampled, and
+/// times the scope as its root span. Inside of a trace it is a ScopedSpan.
+class Trace {
+ public:
+  explicit Trace(const char *name);
+  ~Trace();
+
+  Trace(const Trace &) = delete;
+  Trace(Trace &&) = delete;
+  Trace &operator=(const Trace &) = delete;
+  Trace &operator=(Trace &&) = delete;
+
+ private:
+  // Initialized before the span, so the root span is in the started trace.
+  bool root_;
+  ScopedSpan span_;
+};
+
+}  // namespace memgraph::utils::tracing
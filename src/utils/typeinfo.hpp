@@ -32,6 +32,7 @@ enum class TypeId : uint64_t {
   SCAN_ALL_BY_LABEL_PROPERTY_VALUE,
   SCAN_ALL_BY_LABEL_PROPERTY,
   SCAN_ALL_BY_ID,
+  SCAN_ALL_BY_POINT_NEAREST,
   SCAN_ALL_BY_EDGE,
   SCAN_ALL_BY_EDGE_TYPE,
   SCAN_ALL_BY_EDGE_TYPE_PROPERTY,
@@ -77,6 +78,11 @@ enum class TypeId : uint64_t {
   ROLLUP_APPLY,
   PERIODIC_COMMIT,
   PERIODIC_SUBQUERY,
+  GATHER,
+  EXPAND_INTERSECTION,
+  LOAD_PROPERTIES,
+  COMPUTE_EXPRESSIONS,
+  COUNT_VERTICES,
 
   // Replication
   // NOTE: these NEED to be stable in the 2000+ range (see rpc version)
@@ -132,6 +138,12 @@ enum class TypeId : uint64_t {
   COORD_SHOW_INSTANCES_REQ,
   COORD_SHOW_INSTANCES_RES,
 
+  // Appended after the coordinator types so their ids stay stable
+  REP_SNAPSHOT_BLOCK_HASHES_REQ,
+  REP_SNAPSHOT_BLOCK_HASHES_RES,
+  REP_HOT_QUERIES_REQ,
+  REP_HOT_QUERIES_RES,
+
   // AST
   AST_LABELIX = 3000,
   AST_PROPERTYIX,
@@ -202,6 +214,7 @@ enum class TypeId : uint64_t {
   AST_INDEX_QUERY,
   AST_EDGE_INDEX_QUERY,
   AST_POINT_INDEX_QUERY,
+  AST_VECTOR_INDEX_QUERY,
   AST_TEXT_INDEX_QUERY,
   AST_CREATE,
   AST_CALL_PROCEDURE,
@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+
+# Copyright 2024 Memgraph Ltd.
+#
+# Use of this software is governed by the Business Source License
+# included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+# License, and you may not use this file except in compliance with the Business Source License.
+#
+# As of the Change Date specified in that file, in accordance with
+# the Business Source License, use of this software will be governed
+# by the Apache License, Version 2.0, included in the file
+# licenses/APL.txt.
+
+"""
+Compares the JSON outputs of two runs of a Google Benchmark binary, e.g.:
+
+    ./storage_v2_hot_paths --benchmark_out=from.json --benchmark_out_format=json
+    ./compare_benchmarks.py from.json to.json --threshold 0.05
+
+Exits with status 1 if a benchmark got slower by more than the threshold.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load_times(fname):
+    with open(fname) as f:
+        results = json.load(f)
+    times = {}
+    for benchmark in results["benchmarks"]:
+        # With repetitions only the median is compared.
+        if benchmark.get("run_type") == "aggregate" and benchmark.get("aggregate_name") != "median":
+            continue
+        name = benchmark.get("run_name", benchmark["name"])
+        if benchmark.get("run_type") != "aggregate" and name in times:
+            continue
+        times[name] = benchmark["real_time"], benchmark["time_unit"]
+    return times
+
+
+def compare(times_from, times_to, threshold):
+    regressions = []
+    for name, (time_to, unit) in times_to.items():
+        if name not in times_from:
+            print(f"{name:<50} {time_to:>14.1f}{unit:<2} (new)")
+            continue
+        time_from, unit_from = times_from[name]
+        if unit != unit_from:
+            raise Exception(f"Benchmark {name} changed its time unit!")
+        diff = (time_to - time_from) / time_from
+        regressed = diff > threshold
+        if regressed:
+            regressions.append(name)
+        mark = " !" if regressed else ""
+        print(f"{name:<50} {time_from:>14.1f}{unit:<2} {time_to:>14.1f}{unit:<2} {diff:>+8.1%}{mark}")
+    return regressions
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Compare results of two Google Benchmark runs.")
+    parser.add_argument("results_from", help="JSON output of the baseline run")
+    parser.add_argument("results_to", help="JSON output of the compared run")
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.05,
+        help="Slowdown reported as a regression, 0.05 = 5%%",
+    )
+    args = parser.parse_args()
+
+    regressions = compare(load_times(args.results_from), load_times(args.results_to), args.threshold)
+    if regressions:
+        print(f"{len(regressions)} benchmark(s) regressed by more than {args.threshold:.0%}: {', '.join(regressions)}")
+        sys.exit(1)
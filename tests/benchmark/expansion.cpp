@@ -11,6 +11,8 @@
 
 #include <benchmark/benchmark.h>
 #include <memory>
+#include <random>
+#include <vector>
 
 #include "communication/result_stream_faker.hpp"
 #include "query/config.hpp"
@@ -52,6 +54,14 @@ class ExpansionBenchFixture : public benchmark::Fixture {
 #endif
     );
 
+    Populate(db_acc, state);
+
+    interpreter.emplace(&*interpreter_context, std::move(db_acc));
+    interpreter->SetUser(auth_checker->GenQueryUser(std::nullopt, std::nullopt));
+  }
+
+  // One vertex expanding to 1000 others, besides `state.range(0)` vertices without edges
+  virtual void Populate(memgraph::dbms::DatabaseAccess &db_acc, const benchmark::State &state) {
     auto label = db_acc->storage()->NameToLabel("Starting");
 
     {
@@ -73,9 +83,6 @@ class ExpansionBenchFixture : public benchmark::Fixture {
       auto unique_acc = db_acc->UniqueAccess();
       MG_ASSERT(!unique_acc->CreateIndex(label).HasError());
     }
-
-    interpreter.emplace(&*interpreter_context, std::move(db_acc));
-    interpreter->SetUser(auth_checker->GenQueryUser(std::nullopt, std::nullopt));
   }
 
   void TearDown(const benchmark::State &) override {
@@ -118,6 +125,66 @@ BENCHMARK_REGISTER_F(ExpansionBenchFixture, Expand)
     ->Range(1, 1 << 20)
     ->Unit(benchmark::kMillisecond);
 
+// Each of the `state.range(0)` vertices has edges to random others, so the neighbours of a vertex are scattered
+// over the memory and the expansions are bound by the cache misses of reading them.
+class RandomGraphExpansionBenchFixture : public ExpansionBenchFixture {
+ protected:
+  static constexpr int kEdgesPerVertex = 16;
+
+  void Populate(memgraph::dbms::DatabaseAccess &db_acc, const benchmark::State &state) override {
+    auto label = db_acc->storage()->NameToLabel("Starting");
+    {
+      std::mt19937 gen(42);
+      auto dba = db_acc->Access();
+      std::vector<memgraph::storage::VertexAccessor> vertices;
+      vertices.reserve(state.range(0));
+      for (int i = 0; i < state.range(0); i++) vertices.push_back(dba->CreateVertex());
+      std::uniform_int_distribution<size_t> dist(0, vertices.size() - 1);
+      auto edge_type = dba->NameToEdgeType("edge_type");
+      for (auto &from : vertices) {
+        for (int i = 0; i < kEdgesPerVertex; i++) {
+          MG_ASSERT(dba->CreateEdge(&from, &vertices[dist(gen)], edge_type).HasValue());
+        }
+      }
+      for (int i = 0; i < 64; i++) MG_ASSERT(vertices[dist(gen)].AddLabel(label).HasValue());
+      MG_ASSERT(!dba->Commit().HasError());
+    }
+
+    auto unique_acc = db_acc->UniqueAccess();
+    MG_ASSERT(!unique_acc->CreateIndex(label).HasError());
+  }
+};
+
+BENCHMARK_DEFINE_F(RandomGraphExpansionBenchFixture, TwoHopExpand)(benchmark::State &state) {
+  auto query = "MATCH (s:Starting)-->()-->(d) RETURN count(d)";
+
+  while (state.KeepRunning()) {
+    ResultStreamFaker results(interpreter->current_db_.db_acc_->get()->storage());
+    interpreter->Prepare(query, memgraph::query::no_params_fn, {});
+    interpreter->PullAll(&results);
+  }
+}
+
+BENCHMARK_REGISTER_F(RandomGraphExpansionBenchFixture, TwoHopExpand)
+    ->RangeMultiplier(16)
+    ->Range(1 << 12, 1 << 20)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(RandomGraphExpansionBenchFixture, Bfs)(benchmark::State &state) {
+  auto query = "MATCH (s:Starting)-[*BFS ..3]->(d) RETURN count(d)";
+
+  while (state.KeepRunning()) {
+    ResultStreamFaker results(interpreter->current_db_.db_acc_->get()->storage());
+    interpreter->Prepare(query, memgraph::query::no_params_fn, {});
+    interpreter->PullAll(&results);
+  }
+}
+
+BENCHMARK_REGISTER_F(RandomGraphExpansionBenchFixture, Bfs)
+    ->RangeMultiplier(16)
+    ->Range(1 << 12, 1 << 20)
+    ->Unit(benchmark::kMillisecond);
+
 int main(int argc, char **argv) {
   ::benchmark::Initialize(&argc, argv);
   ::benchmark::RunSpecifiedBenchmarks();
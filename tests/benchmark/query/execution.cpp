@@ -9,6 +9,8 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <algorithm>
+#include <cmath>
 #include <random>
 #include <string>
 
@@ -433,6 +435,49 @@ BENCHMARK_TEMPLATE(Aggregate, MonotonicBufferResource)
 
 BENCHMARK_TEMPLATE(Aggregate, PoolResource)->Ranges({{4, 1U << 7U}, {512, 1U << 13U}})->Unit(benchmark::kMicrosecond);
 
+// Groups by a list of strings of `state.range(0)` characters, so each row
+// evaluates a list literal and copies its strings into the group key. Keys of
+// up to 15 characters are kept inline by the string and aren't allocated.
+template <class TMemory>
+// NOLINTNEXTLINE(google-runtime-references)
+static void AggregateListKeys(benchmark::State &state) {
+  memgraph::query::AstStorage ast;
+  memgraph::query::Parameters parameters;
+  std::unique_ptr<memgraph::storage::Storage> db(new memgraph::storage::InMemoryStorage());
+  AddVertices(db.get(), state.range(1));
+  memgraph::query::SymbolTable symbol_table;
+  auto scan_all = std::make_shared<memgraph::query::plan::ScanAll>(nullptr, symbol_table.CreateSymbol("v", false));
+  auto *key = ast.Create<memgraph::query::ListLiteral>(std::vector<memgraph::query::Expression *>{
+      ast.Create<memgraph::query::PrimitiveLiteral>(std::string(state.range(0), 'a')),
+      ast.Create<memgraph::query::PrimitiveLiteral>(std::string(state.range(0), 'b'))});
+  std::vector<memgraph::query::plan::Aggregate::Element> aggregations{
+      {nullptr, nullptr, memgraph::query::Aggregation::Op::COUNT, symbol_table.CreateSymbol("count", false)}};
+  memgraph::query::plan::Aggregate aggregate(scan_all, aggregations, {key}, {});
+  auto storage_dba = db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  TMemory per_pull_memory;
+  memgraph::query::EvaluationContext evaluation_context{per_pull_memory.get()};
+  while (state.KeepRunning()) {
+    memgraph::query::ExecutionContext execution_context{
+        .db_accessor = &dba, .symbol_table = symbol_table, .evaluation_context = evaluation_context};
+    TMemory memory;
+    memgraph::query::Frame frame(symbol_table.max_position(), memory.get());
+    auto cursor = aggregate.MakeCursor(memory.get());
+    while (cursor->Pull(frame, execution_context)) per_pull_memory.Reset();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(AggregateListKeys, NewDeleteResource)
+    ->Ranges({{8, 64}, {512, 1U << 13U}})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(AggregateListKeys, MonotonicBufferResource)
+    ->Ranges({{8, 64}, {512, 1U << 13U}})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(AggregateListKeys, PoolResource)->Ranges({{8, 64}, {512, 1U << 13U}})->Unit(benchmark::kMicrosecond);
+
 template <class TMemory>
 // NOLINTNEXTLINE(google-runtime-references)
 static void OrderBy(benchmark::State &state) {
@@ -554,4 +599,201 @@ BENCHMARK_TEMPLATE(Foreach, MonotonicBufferResource)
 
 BENCHMARK_TEMPLATE(Foreach, PoolResource)->Ranges({{4, 1U << 7U}, {512, 1U << 13U}})->Unit(benchmark::kMicrosecond);
 
+// The i-th vertex gets `max_degree / (i + 1)^(skew / 10)` out edges to random
+// vertices, so with a skew of 0 all of the vertices have the same degree and
+// larger skews concentrate the edges on fewer hubs. The first vertex, the
+// biggest hub, has the start label. Returns the number of edges.
+static int AddSkewedGraph(memgraph::storage::Storage *db, int vertex_count, int max_degree, int skew) {
+  int edge_count = 0;
+  {
+    auto dba = db->Access();
+    std::vector<memgraph::storage::VertexAccessor> vertices;
+    vertices.reserve(vertex_count);
+    for (int i = 0; i < vertex_count; ++i) vertices.push_back(dba->CreateVertex());
+    MG_ASSERT(vertices.front().AddLabel(dba->NameToLabel(kStartLabel)).HasValue());
+    const auto edge_type = dba->NameToEdgeType("Type");
+    // NOLINTNEXTLINE(cert-msc32-c,cert-msc51-cpp)
+    std::mt19937_64 rg(42);
+    std::uniform_int_distribution<> dis(0, vertex_count - 1);
+    for (int i = 0; i < vertex_count; ++i) {
+      const auto degree = std::max(1, static_cast<int>(max_degree / std::pow(i + 1, skew / 10.0)));
+      for (int j = 0; j < degree; ++j) {
+        MG_ASSERT(dba->CreateEdge(&vertices[i], &vertices[dis(rg)], edge_type).HasValue());
+      }
+      edge_count += degree;
+    }
+    MG_ASSERT(!dba->Commit().HasError());
+  }
+  {
+    auto unique_acc = db->UniqueAccess();
+    MG_ASSERT(!unique_acc->CreateIndex(db->NameToLabel(kStartLabel)).HasError());
+  }
+  return edge_count;
+}
+
+// The first `percent` out of every 100 vertices get the start label, so the
+// label selects `percent`% of the vertices.
+static void AddLabeledVertices(memgraph::storage::Storage *db, int vertex_count, int percent) {
+  {
+    auto dba = db->Access();
+    const auto label = dba->NameToLabel(kStartLabel);
+    for (int i = 0; i < vertex_count; ++i) {
+      auto vertex = dba->CreateVertex();
+      if (i % 100 < percent) MG_ASSERT(vertex.AddLabel(label).HasValue());
+    }
+    MG_ASSERT(!dba->Commit().HasError());
+  }
+  {
+    auto unique_acc = db->UniqueAccess();
+    MG_ASSERT(!unique_acc->CreateIndex(db->NameToLabel(kStartLabel)).HasError());
+  }
+}
+
+template <class TMemory>
+// NOLINTNEXTLINE(google-runtime-references)
+static void ScanAllByLabelSelectivity(benchmark::State &state) {
+  std::unique_ptr<memgraph::storage::Storage> db(new memgraph::storage::InMemoryStorage());
+  AddLabeledVertices(db.get(), state.range(1), state.range(0));
+  memgraph::query::SymbolTable symbol_table;
+  memgraph::query::plan::ScanAllByLabel scan_all_by_label(nullptr, symbol_table.CreateSymbol("v", false),
+                                                          db->NameToLabel(kStartLabel));
+  auto storage_dba = db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  TMemory per_pull_memory;
+  memgraph::query::EvaluationContext evaluation_context{per_pull_memory.get()};
+  int64_t rows = 0;
+  while (state.KeepRunning()) {
+    memgraph::query::ExecutionContext execution_context{
+        .db_accessor = &dba, .symbol_table = symbol_table, .evaluation_context = evaluation_context};
+    TMemory memory;
+    memgraph::query::Frame frame(symbol_table.max_position(), memory.get());
+    auto cursor = scan_all_by_label.MakeCursor(memory.get());
+    while (cursor->Pull(frame, execution_context)) {
+      ++rows;
+      per_pull_memory.Reset();
+    }
+  }
+  state.SetItemsProcessed(rows);
+}
+
+BENCHMARK_TEMPLATE(ScanAllByLabelSelectivity, MonotonicBufferResource)
+    ->ArgsProduct({{1, 10, 50, 100}, {1U << 16U}})
+    ->Unit(benchmark::kMicrosecond);
+
+template <class TMemory>
+// NOLINTNEXTLINE(google-runtime-references)
+static void ExpandSkewed(benchmark::State &state) {
+  std::unique_ptr<memgraph::storage::Storage> db(new memgraph::storage::InMemoryStorage());
+  const auto edge_count = AddSkewedGraph(db.get(), state.range(1), 64, state.range(0));
+  memgraph::query::SymbolTable symbol_table;
+  auto input_symbol = symbol_table.CreateSymbol("input", false);
+  auto scan_all = std::make_shared<memgraph::query::plan::ScanAll>(nullptr, input_symbol);
+  memgraph::query::plan::Expand expand(scan_all, input_symbol, symbol_table.CreateSymbol("dest", false),
+                                       symbol_table.CreateSymbol("edge", false),
+                                       memgraph::query::EdgeAtom::Direction::OUT, {}, false,
+                                       memgraph::storage::View::OLD);
+  auto storage_dba = db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  TMemory per_pull_memory;
+  memgraph::query::EvaluationContext evaluation_context{per_pull_memory.get()};
+  while (state.KeepRunning()) {
+    memgraph::query::ExecutionContext execution_context{
+        .db_accessor = &dba, .symbol_table = symbol_table, .evaluation_context = evaluation_context};
+    TMemory memory;
+    memgraph::query::Frame frame(symbol_table.max_position(), memory.get());
+    auto cursor = expand.MakeCursor(memory.get());
+    while (cursor->Pull(frame, execution_context)) per_pull_memory.Reset();
+  }
+  state.SetItemsProcessed(state.iterations() * edge_count);
+}
+
+BENCHMARK_TEMPLATE(ExpandSkewed, MonotonicBufferResource)
+    ->ArgsProduct({{0, 5, 10, 15}, {1U << 14U}})
+    ->Unit(benchmark::kMicrosecond);
+
+template <class TMemory>
+// NOLINTNEXTLINE(google-runtime-references)
+static void ExpandBfsSkewed(benchmark::State &state) {
+  std::unique_ptr<memgraph::storage::Storage> db(new memgraph::storage::InMemoryStorage());
+  const auto edge_count = AddSkewedGraph(db.get(), state.range(1), 64, state.range(0));
+  memgraph::query::SymbolTable symbol_table;
+  auto expand_variable = MakeExpandVariable(memgraph::query::EdgeAtom::Type::BREADTH_FIRST, &symbol_table);
+  auto storage_dba = db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  TMemory per_pull_memory;
+  memgraph::query::EvaluationContext evaluation_context{per_pull_memory.get()};
+  while (state.KeepRunning()) {
+    memgraph::query::ExecutionContext execution_context{
+        .db_accessor = &dba, .symbol_table = symbol_table, .evaluation_context = evaluation_context};
+    TMemory memory;
+    memgraph::query::Frame frame(symbol_table.max_position(), memory.get());
+    auto cursor = expand_variable.MakeCursor(memory.get());
+    for (const auto &v : dba.Vertices(memgraph::storage::View::OLD, dba.NameToLabel(kStartLabel))) {
+      frame[expand_variable.input_symbol_] = memgraph::query::TypedValue(memgraph::query::VertexAccessor(v));
+      while (cursor->Pull(frame, execution_context)) per_pull_memory.Reset();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * edge_count);
+}
+
+BENCHMARK_TEMPLATE(ExpandBfsSkewed, MonotonicBufferResource)
+    ->ArgsProduct({{0, 5, 10, 15}, {1U << 14U}})
+    ->Unit(benchmark::kMicrosecond);
+
+// Joins the vertices on a property with `state.range(0)` distinct values, so
+// each vertex of the probe side matches `state.range(1) / state.range(0)`
+// vertices of the build side.
+template <class TMemory>
+// NOLINTNEXTLINE(google-runtime-references)
+static void HashJoin(benchmark::State &state) {
+  memgraph::query::AstStorage ast;
+  std::unique_ptr<memgraph::storage::Storage> db(new memgraph::storage::InMemoryStorage());
+  const auto key = db->NameToProperty("key");
+  {
+    auto dba = db->Access();
+    for (int i = 0; i < state.range(1); ++i) {
+      auto vertex = dba->CreateVertex();
+      MG_ASSERT(vertex.SetProperty(key, memgraph::storage::PropertyValue(i % state.range(0))).HasValue());
+    }
+    MG_ASSERT(!dba->Commit().HasError());
+  }
+  memgraph::query::SymbolTable symbol_table;
+  auto left_symbol = symbol_table.CreateSymbol("a", false);
+  auto right_symbol = symbol_table.CreateSymbol("b", false);
+  auto left = std::make_shared<memgraph::query::plan::ScanAll>(nullptr, left_symbol);
+  auto right = std::make_shared<memgraph::query::plan::ScanAll>(nullptr, right_symbol);
+  auto *condition = ast.Create<memgraph::query::EqualOperator>(
+      ast.Create<memgraph::query::PropertyLookup>(ast.Create<memgraph::query::Identifier>("a")->MapTo(left_symbol),
+                                                  ast.GetPropertyIx("key")),
+      ast.Create<memgraph::query::PropertyLookup>(ast.Create<memgraph::query::Identifier>("b")->MapTo(right_symbol),
+                                                  ast.GetPropertyIx("key")));
+  memgraph::query::plan::HashJoin hash_join(left, {left_symbol}, right, {right_symbol}, condition);
+  auto storage_dba = db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  TMemory per_pull_memory;
+  memgraph::query::EvaluationContext evaluation_context{per_pull_memory.get()};
+  evaluation_context.properties = memgraph::query::NamesToProperties(ast.properties_, &dba);
+  int64_t rows = 0;
+  while (state.KeepRunning()) {
+    memgraph::query::ExecutionContext execution_context{
+        .db_accessor = &dba, .symbol_table = symbol_table, .evaluation_context = evaluation_context};
+    TMemory memory;
+    memgraph::query::Frame frame(symbol_table.max_position(), memory.get());
+    auto cursor = hash_join.MakeCursor(memory.get());
+    while (cursor->Pull(frame, execution_context)) {
+      ++rows;
+      per_pull_memory.Reset();
+    }
+  }
+  state.SetItemsProcessed(rows);
+}
+
+BENCHMARK_TEMPLATE(HashJoin, NewDeleteResource)
+    ->Ranges({{64, 1U << 12U}, {1U << 10U, 1U << 12U}})
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(HashJoin, MonotonicBufferResource)
+    ->Ranges({{64, 1U << 12U}, {1U << 10U, 1U << 12U}})
+    ->Unit(benchmark::kMicrosecond);
+
 BENCHMARK_MAIN();
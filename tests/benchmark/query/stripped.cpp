@@ -57,10 +57,17 @@ auto BM_Strip = [](benchmark::State &state, auto &function, std::string query) {
 };
 
 int main(int argc, char *argv[]) {
-  auto preprocess = [](const std::string &query) { return memgraph::query::frontend::StrippedQuery(query); };
+  using memgraph::query::frontend::StrippedQuery;
+  auto table = [](const std::string &query) { return StrippedQuery(query, StrippedQuery::Lexer::TABLE); };
+  auto simd = [](const std::string &query) { return StrippedQuery(query, StrippedQuery::Lexer::SIMD); };
 
   for (auto test : kQueries) {
-    benchmark::RegisterBenchmark(test, BM_Strip, preprocess, test)->Range(1, 1)->Complexity(benchmark::oN);
+    benchmark::RegisterBenchmark((std::string("TABLE/") + test).c_str(), BM_Strip, table, test)
+        ->Range(1, 1)
+        ->Complexity(benchmark::oN);
+    benchmark::RegisterBenchmark((std::string("SIMD/") + test).c_str(), BM_Strip, simd, test)
+        ->Range(1, 1)
+        ->Complexity(benchmark::oN);
   }
 
   benchmark::Initialize(&argc, argv);
@@ -0,0 +1,243 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "auth/auth.hpp"
+#include "dbms/database.hpp"
+#include "dbms/dbms_handler.hpp"
+#include "replication/config.hpp"
+#include "replication/state.hpp"
+#include "replication_handler/replication_handler.hpp"
+#include "storage/v2/config.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/replication/enums.hpp"
+#include "utils/logging.hpp"
+#include "utils/timer.hpp"
+
+// Benchmarks replication between an in-process MAIN and REPLICA over the
+// loopback interface: the commit latency of replicated transactions and the
+// time a new replica takes to recover from the WAL files or the snapshot of
+// MAIN.
+
+using memgraph::io::network::Endpoint;
+using memgraph::replication::ReplicationClientConfig;
+using memgraph::replication::ReplicationHandler;
+using memgraph::replication::ReplicationServerConfig;
+using memgraph::replication_coordination_glue::ReplicationMode;
+using memgraph::storage::Config;
+using memgraph::storage::PropertyValue;
+using memgraph::storage::replication::ReplicaState;
+
+namespace {
+
+const auto kMainDirectory = std::filesystem::temp_directory_path() / "MG_benchmark_replication_main";
+const auto kReplicaDirectory = std::filesystem::temp_directory_path() / "MG_benchmark_replication_replica";
+constexpr uint16_t kReplicaPort = 10300;
+constexpr auto kReplicaName = "REPLICA";
+
+struct MinMemgraph {
+  explicit MinMemgraph(const Config &conf)
+      : auth{conf.durability.storage_directory / "auth", memgraph::auth::Auth::Config{/* default */}},
+        repl_state{ReplicationStateRootPath(conf)},
+        dbms{conf, repl_state
+#ifdef MG_ENTERPRISE
+             ,
+             auth, true
+#endif
+        },
+        db_acc{dbms.Get()},
+        db{*db_acc.get()},
+        repl_handler(repl_state, dbms
+#ifdef MG_ENTERPRISE
+                     ,
+                     system_, auth
+#endif
+        ) {
+  }
+  memgraph::auth::SynchedAuth auth;
+  memgraph::system::System system_;
+  memgraph::replication::ReplicationState repl_state;
+  memgraph::dbms::DbmsHandler dbms;
+  memgraph::dbms::DatabaseAccess db_acc;
+  memgraph::dbms::Database &db;
+  ReplicationHandler repl_handler;
+};
+
+Config MakeConfig(const std::filesystem::path &directory, uint64_t wal_file_size_kibibytes = 20 * 1024) {
+  Config config{
+      .durability =
+          {
+              .snapshot_wal_mode = Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+              .wal_file_size_kibibytes = wal_file_size_kibibytes,
+          },
+      .salient.items = {.properties_on_edges = true},
+  };
+  UpdatePaths(config, directory);
+  return config;
+}
+
+void RemoveDirectories() {
+  std::filesystem::remove_all(kMainDirectory);
+  std::filesystem::remove_all(kReplicaDirectory);
+}
+
+void WaitUntilReady(MinMemgraph &main) {
+  while (main.db.storage()->GetReplicaState(kReplicaName) != ReplicaState::READY) {
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+}
+
+// Starts a replica and registers it on `main`, waiting until it caught up.
+std::unique_ptr<MinMemgraph> StartReplica(MinMemgraph &main, ReplicationMode mode) {
+  auto replica = std::make_unique<MinMemgraph>(MakeConfig(kReplicaDirectory));
+  replica->repl_handler.TrySetReplicationRoleReplica(
+      ReplicationServerConfig{.repl_server = Endpoint("127.0.0.1", kReplicaPort)}, std::nullopt);
+  auto registered = main.repl_handler.TryRegisterReplica(ReplicationClientConfig{
+      .name = kReplicaName,
+      .mode = mode,
+      .repl_server_endpoint = Endpoint("127.0.0.1", kReplicaPort),
+  });
+  MG_ASSERT(!registered.HasError(), "Couldn't register the replica");
+  WaitUntilReady(main);
+  return replica;
+}
+
+void StopReplica(MinMemgraph &main, std::unique_ptr<MinMemgraph> replica) {
+  main.repl_handler.UnregisterReplica(kReplicaName);
+  replica.reset();
+  std::filesystem::remove_all(kReplicaDirectory);
+}
+
+// Reports the percentiles of the commit latencies of the thread, averaged over
+// the benchmark threads.
+void ReportLatencies(benchmark::State &state, std::vector<double> latencies) {
+  if (latencies.empty()) return;
+  std::sort(latencies.begin(), latencies.end());
+  auto percentile = [&](double p) {
+    return latencies[std::min(latencies.size() - 1, static_cast<size_t>(p * latencies.size()))];
+  };
+  state.counters["p50_us"] = benchmark::Counter(percentile(0.5), benchmark::Counter::kAvgThreads);
+  state.counters["p99_us"] = benchmark::Counter(percentile(0.99), benchmark::Counter::kAvgThreads);
+  state.counters["p999_us"] = benchmark::Counter(percentile(0.999), benchmark::Counter::kAvgThreads);
+  state.counters["max_us"] = benchmark::Counter(latencies.back(), benchmark::Counter::kAvgThreads);
+}
+
+std::unique_ptr<MinMemgraph> main_instance;
+std::unique_ptr<MinMemgraph> replica_instance;
+
+}  // namespace
+
+// Arguments: replication mode, vertices created by a transaction, bytes of the
+// string property of each vertex. The benchmark threads are the concurrent
+// writers. For ASYNC the time the replica takes to catch up after the last
+// commit is reported as `catch_up_ms`.
+static void ReplicatedCommit(benchmark::State &state) {
+  const auto mode = static_cast<ReplicationMode>(state.range(0));
+  const auto vertices = state.range(1);
+  const auto property = PropertyValue{std::string(state.range(2), 'a')};
+
+  if (state.thread_index() == 0) {
+    RemoveDirectories();
+    main_instance = std::make_unique<MinMemgraph>(MakeConfig(kMainDirectory));
+    replica_instance = StartReplica(*main_instance, mode);
+  }
+
+  std::vector<double> latencies;
+  for (auto _ : state) {
+    auto &main = *main_instance;
+    const auto property_id = main.db.storage()->NameToProperty("property");
+    memgraph::utils::Timer timer;
+    auto acc = main.db.Access();
+    for (int64_t i = 0; i < vertices; ++i) {
+      auto vertex = acc->CreateVertex();
+      MG_ASSERT(vertex.SetProperty(property_id, property).HasValue());
+    }
+    MG_ASSERT(!acc->Commit({}, main.db_acc).HasError());
+    latencies.push_back(std::chrono::duration<double, std::micro>(timer.Elapsed()).count());
+  }
+  ReportLatencies(state, std::move(latencies));
+  state.SetItemsProcessed(state.iterations() * vertices);
+  state.SetBytesProcessed(state.iterations() * vertices * state.range(2));
+
+  if (state.thread_index() == 0) {
+    memgraph::utils::Timer catch_up;
+    WaitUntilReady(*main_instance);
+    if (mode == ReplicationMode::ASYNC) {
+      state.counters["catch_up_ms"] = std::chrono::duration<double, std::milli>(catch_up.Elapsed()).count();
+    }
+    StopReplica(*main_instance, std::move(replica_instance));
+    main_instance.reset();
+    RemoveDirectories();
+  }
+}
+
+BENCHMARK(ReplicatedCommit)
+    ->ArgsProduct({{static_cast<int64_t>(ReplicationMode::SYNC), static_cast<int64_t>(ReplicationMode::ASYNC)},
+                   {1, 16, 256},
+                   {16, 1024}})
+    ->Args({static_cast<int64_t>(ReplicationMode::SYNC), 1, 1 << 20})
+    ->Args({static_cast<int64_t>(ReplicationMode::ASYNC), 1, 1 << 20})
+    ->ThreadRange(1, 8)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+// Arguments: vertices MAIN holds, whether MAIN has a snapshot of them (the
+// replica recovers from the snapshot) or only WAL files. Measures the time
+// from registering the replica until it is ready.
+static void ReplicaRecovery(benchmark::State &state) {
+  const auto vertices = state.range(0);
+  const auto from_snapshot = state.range(1) != 0;
+
+  RemoveDirectories();
+  MinMemgraph main(MakeConfig(kMainDirectory, /* wal_file_size_kibibytes = */ 1024));
+  const auto property_id = main.db.storage()->NameToProperty("property");
+  constexpr int64_t kVerticesPerTransaction = 1000;
+  for (int64_t created = 0; created < vertices; created += kVerticesPerTransaction) {
+    auto acc = main.db.Access();
+    for (int64_t i = 0; i < std::min(kVerticesPerTransaction, vertices - created); ++i) {
+      auto vertex = acc->CreateVertex();
+      MG_ASSERT(vertex.SetProperty(property_id, PropertyValue{created + i}).HasValue());
+    }
+    MG_ASSERT(!acc->Commit({}, main.db_acc).HasError());
+  }
+  if (from_snapshot) {
+    auto *storage = static_cast<memgraph::storage::InMemoryStorage *>(main.db.storage());
+    // Snapshots over the retention count also remove the WAL files they cover.
+    for (uint64_t i = 0; i <= main.db.config().durability.snapshot_retention_count; ++i) {
+      MG_ASSERT(!storage->CreateSnapshot(memgraph::replication_coordination_glue::ReplicationRole::MAIN).HasError());
+    }
+  }
+
+  for (auto _ : state) {
+    auto replica = StartReplica(main, ReplicationMode::SYNC);
+    state.PauseTiming();
+    StopReplica(main, std::move(replica));
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * vertices);
+}
+
+BENCHMARK(ReplicaRecovery)
+    ->ArgsProduct({{10'000, 1'000'000}, {0, 1}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
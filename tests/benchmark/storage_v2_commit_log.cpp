@@ -0,0 +1,46 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include "storage/v2/commit_log.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+using namespace memgraph::storage;
+
+// Every thread marks ids taken from a shared counter and reads the oldest
+// active id, like finishing transactions do.
+template <typename Log>
+static void BM_MarkFinished(benchmark::State &state) {
+  static std::unique_ptr<Log> log;
+  static std::atomic<uint64_t> next_id{0};
+  if (state.thread_index() == 0) {
+    log = std::make_unique<Log>();
+    next_id = 0;
+  }
+
+  for (auto _ : state) {
+    log->MarkFinished(next_id.fetch_add(1, std::memory_order_relaxed));
+    benchmark::DoNotOptimize(log->OldestActive());
+  }
+
+  if (state.thread_index() == 0) {
+    state.SetItemsProcessed(static_cast<int64_t>(next_id.load()));
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_MarkFinished, CommitLog)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_MarkFinished, LockingCommitLog)->ThreadRange(1, 16)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,272 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+// Benchmarks of the storage paths every query goes through. The datasets are
+// generated from fixed seeds and sizes, so the results of two builds can be
+// compared; run with `--benchmark_out=<file> --benchmark_out_format=json` and
+// compare the files with `compare_benchmarks.py`.
+
+#include <chrono>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/storage.hpp"
+#include "utils/logging.hpp"
+
+namespace {
+
+using memgraph::storage::Gid;
+using memgraph::storage::InMemoryStorage;
+using memgraph::storage::PropertyValue;
+using memgraph::storage::Storage;
+using memgraph::storage::View;
+
+constexpr uint64_t kSeed = 42;
+
+// The garbage is collected by the benchmarks which measure it, so it doesn't
+// run concurrently with the others.
+std::unique_ptr<Storage> MakeStorage() {
+  return std::make_unique<InMemoryStorage>(
+      memgraph::storage::Config{.gc = {.type = memgraph::storage::Config::Gc::Type::NONE}});
+}
+
+}  // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+// Creating vertices and committing the transaction
+///////////////////////////////////////////////////////////////////////////////
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void CreateAndCommit(benchmark::State &state) {
+  auto storage = MakeStorage();
+  const auto label = storage->NameToLabel("Label");
+  const auto property = storage->NameToProperty("property");
+  for (auto _ : state) {
+    auto acc = storage->Access();
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      auto vertex = acc->CreateVertex();
+      MG_ASSERT(vertex.AddLabel(label).HasValue());
+      MG_ASSERT(vertex.SetProperty(property, PropertyValue(i)).HasValue());
+    }
+    MG_ASSERT(!acc->Commit().HasError());
+    state.PauseTiming();
+    storage->FreeMemory();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(CreateAndCommit)->RangeMultiplier(16)->Range(1, 4096)->Unit(benchmark::kMicrosecond);
+
+///////////////////////////////////////////////////////////////////////////////
+// Reading a vertex through the chain of deltas committed after the snapshot
+///////////////////////////////////////////////////////////////////////////////
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void DeltaChainRead(benchmark::State &state) {
+  auto storage = MakeStorage();
+  const auto property = storage->NameToProperty("property");
+  Gid gid;
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->CreateVertex();
+    MG_ASSERT(vertex.SetProperty(property, PropertyValue(0)).HasValue());
+    gid = vertex.Gid();
+    MG_ASSERT(!acc->Commit().HasError());
+  }
+  // The reader's snapshot predates all of the updates, so each read undoes
+  // all of them.
+  auto reader = storage->Access();
+  for (int64_t i = 1; i <= state.range(0); ++i) {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gid, View::OLD);
+    MG_ASSERT(vertex && vertex->SetProperty(property, PropertyValue(i)).HasValue());
+    MG_ASSERT(!acc->Commit().HasError());
+  }
+  for (auto _ : state) {
+    auto vertex = reader->FindVertex(gid, View::OLD);
+    benchmark::DoNotOptimize(vertex->GetProperty(property, View::OLD));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(DeltaChainRead)->RangeMultiplier(8)->Range(1, 4096)->Unit(benchmark::kNanosecond);
+
+///////////////////////////////////////////////////////////////////////////////
+// Collecting the garbage of deleted vertices
+///////////////////////////////////////////////////////////////////////////////
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void GcPause(benchmark::State &state) {
+  auto storage = MakeStorage();
+  const auto property = storage->NameToProperty("property");
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::vector<Gid> gids;
+    gids.reserve(state.range(0));
+    {
+      auto acc = storage->Access();
+      for (int64_t i = 0; i < state.range(0); ++i) {
+        auto vertex = acc->CreateVertex();
+        MG_ASSERT(vertex.SetProperty(property, PropertyValue(i)).HasValue());
+        gids.push_back(vertex.Gid());
+      }
+      MG_ASSERT(!acc->Commit().HasError());
+    }
+    {
+      auto acc = storage->Access();
+      for (const auto gid : gids) {
+        auto vertex = acc->FindVertex(gid, View::OLD);
+        MG_ASSERT(vertex && acc->DeleteVertex(&*vertex).HasValue());
+      }
+      MG_ASSERT(!acc->Commit().HasError());
+    }
+    state.ResumeTiming();
+    storage->FreeMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(GcPause)->RangeMultiplier(16)->Range(16, 1 << 16)->Unit(benchmark::kMicrosecond);
+
+///////////////////////////////////////////////////////////////////////////////
+// Looking up a vertex through the label property index
+///////////////////////////////////////////////////////////////////////////////
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void LabelPropertyIndexLookup(benchmark::State &state) {
+  auto storage = MakeStorage();
+  const auto label = storage->NameToLabel("Label");
+  const auto property = storage->NameToProperty("property");
+  {
+    auto acc = storage->Access();
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      auto vertex = acc->CreateVertex();
+      MG_ASSERT(vertex.AddLabel(label).HasValue());
+      MG_ASSERT(vertex.SetProperty(property, PropertyValue(i)).HasValue());
+    }
+    MG_ASSERT(!acc->Commit().HasError());
+  }
+  {
+    auto acc = storage->UniqueAccess();
+    MG_ASSERT(!acc->CreateIndex(label, property).HasError());
+  }
+  std::mt19937 gen(kSeed);
+  std::uniform_int_distribution<int64_t> dist(0, state.range(0) - 1);
+  auto acc = storage->Access();
+  for (auto _ : state) {
+    size_t found = 0;
+    for (auto vertex : acc->Vertices(label, property, PropertyValue(dist(gen)), View::OLD)) {
+      benchmark::DoNotOptimize(vertex);
+      ++found;
+    }
+    MG_ASSERT(found == 1);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(LabelPropertyIndexLookup)->RangeMultiplier(16)->Range(16, 1 << 20)->Unit(benchmark::kNanosecond);
+
+///////////////////////////////////////////////////////////////////////////////
+// Getting and setting a property of a vertex by the size of its store
+///////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+Gid CreateVertexWithProperties(Storage *storage, int64_t count) {
+  auto acc = storage->Access();
+  auto vertex = acc->CreateVertex();
+  for (int64_t i = 0; i < count; ++i) {
+    MG_ASSERT(vertex.SetProperty(memgraph::storage::PropertyId::FromInt(i), PropertyValue(i)).HasValue());
+  }
+  const auto gid = vertex.Gid();
+  MG_ASSERT(!acc->Commit().HasError());
+  return gid;
+}
+
+}  // namespace
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void VertexPropertyGet(benchmark::State &state) {
+  auto storage = MakeStorage();
+  const auto gid = CreateVertexWithProperties(storage.get(), state.range(0));
+  std::mt19937 gen(kSeed);
+  std::uniform_int_distribution<int64_t> dist(0, state.range(0) - 1);
+  auto acc = storage->Access();
+  auto vertex = acc->FindVertex(gid, View::OLD);
+  MG_ASSERT(vertex);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(vertex->GetProperty(memgraph::storage::PropertyId::FromInt(dist(gen)), View::OLD));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(VertexPropertyGet)->RangeMultiplier(4)->Range(1, 1024)->Unit(benchmark::kNanosecond);
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void VertexPropertySet(benchmark::State &state) {
+  auto storage = MakeStorage();
+  const auto gid = CreateVertexWithProperties(storage.get(), state.range(0));
+  std::mt19937 gen(kSeed);
+  std::uniform_int_distribution<int64_t> dist(0, state.range(0) - 1);
+  for (auto _ : state) {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gid, View::OLD);
+    MG_ASSERT(vertex);
+    for (int i = 0; i < 100; ++i) {
+      MG_ASSERT(vertex->SetProperty(memgraph::storage::PropertyId::FromInt(dist(gen)), PropertyValue(i)).HasValue());
+    }
+    MG_ASSERT(!acc->Commit().HasError());
+    state.PauseTiming();
+    storage->FreeMemory();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * 100);
+}
+
+BENCHMARK(VertexPropertySet)->RangeMultiplier(4)->Range(1, 1024)->Unit(benchmark::kMicrosecond);
+
+///////////////////////////////////////////////////////////////////////////////
+// Expanding the edges of a supernode
+///////////////////////////////////////////////////////////////////////////////
+
+// NOLINTNEXTLINE(google-runtime-references)
+static void ExpandSupernode(benchmark::State &state) {
+  auto storage = MakeStorage();
+  const auto edge_type = storage->NameToEdgeType("EDGE");
+  Gid gid;
+  {
+    auto acc = storage->Access();
+    auto supernode = acc->CreateVertex();
+    gid = supernode.Gid();
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      auto dest = acc->CreateVertex();
+      MG_ASSERT(acc->CreateEdge(&supernode, &dest, edge_type).HasValue());
+    }
+    MG_ASSERT(!acc->Commit().HasError());
+  }
+  auto acc = storage->Access();
+  for (auto _ : state) {
+    auto supernode = acc->FindVertex(gid, View::OLD);
+    auto result = supernode->OutEdges(View::OLD);
+    MG_ASSERT(result.HasValue() && result->edges.size() == static_cast<size_t>(state.range(0)));
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(ExpandSupernode)->RangeMultiplier(16)->Range(16, 1 << 20)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
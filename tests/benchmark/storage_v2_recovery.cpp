@@ -0,0 +1,158 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+// Benchmarks the recovery of a database on startup from a snapshot and the
+// WAL files written after it. The dataset has a label index, a label property
+// index and an existence constraint, so all of the recovery phases run; the
+// time each of them took is logged once the database is recovered.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "replication_coordination_glue/role.hpp"
+#include "storage/v2/config.hpp"
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/storage.hpp"
+#include "utils/logging.hpp"
+
+using memgraph::storage::Config;
+using memgraph::storage::InMemoryStorage;
+using memgraph::storage::PropertyValue;
+
+namespace {
+
+const auto kDirectory = std::filesystem::temp_directory_path() / "MG_benchmark_storage_v2_recovery";
+constexpr uint64_t kSeed = 42;
+constexpr int64_t kEdgesPerVertex = 4;
+constexpr int64_t kVerticesPerTransaction = 10'000;
+
+// Vertices of the dataset on disk, 0 if there is none.
+int64_t generated_vertices = 0;
+
+void CreateVertices(InMemoryStorage *storage, int64_t first, int64_t count) {
+  const auto label = storage->NameToLabel("Node");
+  const auto property = storage->NameToProperty("id");
+  for (int64_t created = 0; created < count; created += kVerticesPerTransaction) {
+    auto acc = storage->Access();
+    for (int64_t i = 0; i < std::min(kVerticesPerTransaction, count - created); ++i) {
+      auto vertex = acc->CreateVertex();
+      MG_ASSERT(vertex.AddLabel(label).HasValue());
+      MG_ASSERT(vertex.SetProperty(property, PropertyValue{first + created + i}).HasValue());
+    }
+    MG_ASSERT(!acc->Commit().HasError());
+  }
+}
+
+void CreateEdges(InMemoryStorage *storage, int64_t vertices) {
+  const auto edge_type = storage->NameToEdgeType("EDGE");
+  std::mt19937 gen(kSeed);
+  std::uniform_int_distribution<int64_t> dist(0, vertices - 1);
+  std::vector<memgraph::storage::Gid> gids;
+  gids.reserve(vertices);
+  {
+    auto acc = storage->Access();
+    for (auto vertex : acc->Vertices(memgraph::storage::View::OLD)) {
+      gids.push_back(vertex.Gid());
+    }
+  }
+  for (int64_t created = 0; created < vertices; created += kVerticesPerTransaction) {
+    auto acc = storage->Access();
+    for (int64_t i = created; i < std::min(created + kVerticesPerTransaction, vertices); ++i) {
+      auto from = acc->FindVertex(gids[i], memgraph::storage::View::OLD);
+      for (int64_t j = 0; j < kEdgesPerVertex; ++j) {
+        auto to = acc->FindVertex(gids[dist(gen)], memgraph::storage::View::OLD);
+        MG_ASSERT(from && to && acc->CreateEdge(&*from, &*to, edge_type).HasValue());
+      }
+    }
+    MG_ASSERT(!acc->Commit().HasError());
+  }
+}
+
+// Writes a snapshot of `vertices` vertices with their edges and a tenth as
+// many vertices more to the WAL files after it.
+void GenerateDataset(int64_t vertices) {
+  if (generated_vertices == vertices) return;
+  std::filesystem::remove_all(kDirectory);
+  Config config{
+      .durability = {.storage_directory = kDirectory,
+                     .snapshot_wal_mode = Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+                     .snapshot_interval = std::chrono::hours(24)},
+  };
+  auto storage = std::make_unique<InMemoryStorage>(config);
+  const auto label = storage->NameToLabel("Node");
+  const auto property = storage->NameToProperty("id");
+  {
+    auto acc = storage->UniqueAccess();
+    MG_ASSERT(!acc->CreateIndex(label).HasError());
+    MG_ASSERT(!acc->Commit().HasError());
+  }
+  {
+    auto acc = storage->UniqueAccess();
+    MG_ASSERT(!acc->CreateIndex(label, property).HasError());
+    MG_ASSERT(!acc->Commit().HasError());
+  }
+  {
+    auto acc = storage->UniqueAccess();
+    MG_ASSERT(!acc->CreateExistenceConstraint(label, property).HasError());
+    MG_ASSERT(!acc->Commit().HasError());
+  }
+  CreateVertices(storage.get(), 0, vertices);
+  CreateEdges(storage.get(), vertices);
+  MG_ASSERT(!storage->CreateSnapshot(memgraph::replication_coordination_glue::ReplicationRole::MAIN).HasError());
+  CreateVertices(storage.get(), vertices, vertices / 10);
+  storage.reset();
+  generated_vertices = vertices;
+}
+
+}  // namespace
+
+// Arguments: vertices in the snapshot, recovery threads. The recovered
+// database doesn't write any durability files, so each iteration recovers
+// the same dataset.
+// NOLINTNEXTLINE(google-runtime-references)
+static void Recovery(benchmark::State &state) {
+  const auto vertices = state.range(0);
+  GenerateDataset(vertices);
+  Config config{
+      .durability = {.storage_directory = kDirectory,
+                     .recover_on_startup = true,
+                     .recovery_thread_count = static_cast<uint64_t>(state.range(1)),
+                     .allow_parallel_schema_creation = true,
+                     .allow_parallel_wal_recovery = true},
+  };
+  for (auto _ : state) {
+    auto storage = std::make_unique<InMemoryStorage>(config);
+    state.PauseTiming();
+    MG_ASSERT(storage->GetBaseInfo().vertex_count == static_cast<uint64_t>(vertices + vertices / 10));
+    storage.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * (vertices + vertices / 10));
+}
+
+BENCHMARK(Recovery)
+    ->ArgsProduct({{100'000, 1'000'000}, {1, 2, 4, 8}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+int main(int argc, char **argv) {
+  ::benchmark::Initialize(&argc, argv);
+  ::benchmark::RunSpecifiedBenchmarks();
+  std::filesystem::remove_all(kDirectory);
+  return 0;
+}
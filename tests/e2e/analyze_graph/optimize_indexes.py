@@ -569,5 +569,26 @@ def test_given_empty_graph_when_analyzing_graph_return_zero_degree(memgraph):
     assert set(label_stats) == set(expected_analysis)
 
 
+def test_given_large_label_when_analyzing_graph_then_chunks_are_merged(memgraph):
+    memgraph.execute("CREATE INDEX ON :Node;")
+    memgraph.execute("CREATE INDEX ON :Node(id);")
+    memgraph.execute("CREATE INDEX ON :Other(id);")
+    memgraph.execute("UNWIND range(0, 99999) AS i CREATE (:Node {id: i % 1000});")
+    memgraph.execute("UNWIND range(0, 9) AS i CREATE (:Node);")
+    memgraph.execute("UNWIND range(0, 99) AS i CREATE (:Other {id: i});")
+
+    results = list(memgraph.execute_and_fetch("analyze graph;"))
+
+    stats = {(result["label"], result["property"]): result for result in results}
+    assert stats[("Node", None)]["num estimation nodes"] == 100010
+    assert stats[("Node", None)]["avg degree"] == 0.0
+    assert stats[("Node", "id")]["num estimation nodes"] == 100000
+    assert stats[("Node", "id")]["num groups"] == 1000
+    assert stats[("Node", "id")]["avg group size"] == 100
+    assert stats[("Node", "id")]["chi-squared value"] == 0
+    assert stats[("Other", "id")]["num estimation nodes"] == 100
+    assert stats[("Other", "id")]["num groups"] == 100
+
+
 if __name__ == "__main__":
     sys.exit(pytest.main([__file__, "-rA"]))
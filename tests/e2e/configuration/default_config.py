@@ -15,6 +15,16 @@
 
 
 startup_config_dict = {
+    "auth_cache_size": (
+        "1024",
+        "1024",
+        "Number of recently verified credentials remembered so the password hash isn't verified on every connection. Set to 0 to disable the cache.",
+    ),
+    "auth_cache_ttl_sec": (
+        "60",
+        "60",
+        "Time in seconds after which remembered credentials have to be verified again.",
+    ),
     "auth_module_mappings": (
         "",
         "",
@@ -49,6 +59,16 @@ startup_config_dict = {
     "bolt_address": ("0.0.0.0", "0.0.0.0", "IP address on which the Bolt server should listen."),
     "bolt_cert_file": ("", "", "Certificate file which should be used for the Bolt server."),
     "bolt_key_file": ("", "", "Key file which should be used for the Bolt server."),
+    "bolt_long_execution_threshold_ms": (
+        "1000",
+        "1000",
+        "Time in milliseconds after which an execution of a Bolt session is considered long. The next message of such a session waits until the messages of the other sessions are executed. Used only with Bolt execution workers.",
+    ),
+    "bolt_num_execution_workers": (
+        "0",
+        "0",
+        "Number of workers which execute the queries of the Bolt sessions, so that the Bolt workers only handle the connections. If 0, the queries are executed by the Bolt workers.",
+    ),
     "bolt_num_workers": (
         "12",
         "12",
@@ -72,6 +92,11 @@ startup_config_dict = {
     "ha_durability": ("true", "true", "Whether to use durability for coordinator logs and snapshots."),
     "instance_down_timeout_sec": ("5", "5", "Time duration after which an instance is considered down."),
     "instance_health_check_frequency_sec": ("1", "1", "The time duration between two health checks/pings."),
+    "instance_down_phi_threshold": (
+        "0",
+        "0",
+        "Suspicion level at which the phi accrual failure detector considers an instance down before the instance down timeout passes. Learned from the intervals between the instance's heartbeats, 8 means a chance of 1e-8 that the instance is only slow. If 0, only the timeout is used.",
+    ),
     "instance_get_uuid_frequency_sec": ("10", "10", "The time duration between two instance uuid checks."),
     "coordinator_hostname": ("", "", "Instance's hostname. Used as output of SHOW INSTANCES query."),
     "data_directory": ("mg_data", "mg_data", "Path to directory in which to save all permanent data."),
@@ -80,6 +105,11 @@ startup_config_dict = {
         "true",
         "Controls whether the database recovers persisted data on startup.",
     ),
+    "database_memory_limit": (
+        "0",
+        "0",
+        "Memory limit of each database in MiB. The queries of a database allocate from a dedicated arena whose memory is purged when the database is dropped. Set to 0 to keep the databases on the shared arenas.",
+    ),
     "isolation_level": (
         "SNAPSHOT_ISOLATION",
         "SNAPSHOT_ISOLATION",
@@ -102,6 +132,11 @@ startup_config_dict = {
         "0",
         "Total memory limit in MiB. Set to 0 to use the default values which are 100% of the phyisical memory if the swap is enabled and 90% of the physical memory otherwise.",
     ),
+    "memory_tracking_batch_kib": (
+        "0",
+        "0",
+        "Memory in KiB a thread allocates or frees before it is added to the total and the query memory trackers. The memory limits are checked at the same cadence, so each thread can exceed them by this amount. Set to 0 to track every allocation directly.",
+    ),
     "memory_warning_threshold": (
         "1024",
         "1024",
@@ -124,6 +159,21 @@ startup_config_dict = {
         "false",
         "Controls whether the index creation can be done in a multithreaded fashion.",
     ),
+    "storage_parallel_snapshot_creation": (
+        "false",
+        "false",
+        "Controls whether the vertices and edges are written to the snapshot in a multithreaded fashion. The number of threads is set by storage_recovery_thread_count.",
+    ),
+    "storage_numa_aware_allocation": (
+        "false",
+        "false",
+        "Controls whether vertices and edges are allocated from a jemalloc arena per NUMA node, on the node of the thread creating them. Pin the workers to nodes to keep the objects they create local.",
+    ),
+    "storage_parallel_wal_recovery": (
+        "false",
+        "false",
+        "Controls whether the label and property updates from WAL files are applied in a multithreaded fashion. Deltas are replayed in windows of storage_items_per_batch deltas on storage_recovery_thread_count threads.",
+    ),
     "storage_parallel_schema_recovery": (
         "false",
         "false",
@@ -159,18 +209,105 @@ startup_config_dict = {
         "mid",
         "Compression level for storing properties. Allowed values: low, mid, high.",
     ),
+    "storage_property_store_intern_max_length": (
+        "0",
+        "0",
+        "String property values up to this length in bytes are kept once in a process-wide table and the property stores only keep their id. Meant for low-cardinality values, the strings are never removed and at most 65536 of them are interned. Set to 0 to keep all strings inline.",
+    ),
+    "storage_property_tier_directory": (
+        "",
+        "",
+        "Directory of the RocksDB instance to which the properties of the cold in-memory vertices are moved. The properties are never moved out of memory if it isn't set. The directory is cleared on startup.",
+    ),
+    "storage_property_tier_interval_sec": (
+        "60",
+        "60",
+        "Seconds between two passes which move the properties of the vertices which weren't read since the previous pass to the property tier, and the ones of the vertices which were read back to memory.",
+    ),
+    "storage_property_tier_min_size": (
+        "256",
+        "256",
+        "Encoded size in bytes below which the properties of a vertex are kept in memory even if it is cold.",
+    ),
     "password_encryption_algorithm": ("bcrypt", "bcrypt", "The password encryption algorithm used for authentication."),
     "pulsar_service_url": ("", "", "Default URL used while connecting to Pulsar brokers."),
+    "query_admission_lanes": (
+        "",
+        "",
+        "Lanes which limit the number of concurrently executed queries, separated by ';'. A lane is written as <selector>=<max running>[:<queue timeout ms>], where the selector is read, write, read_write, db:<name>, user:<name> or role:<name>. A query is admitted through the first lane it matches and waits while the lane is full. Queries which match no lane aren't limited.",
+    ),
+    "query_execution_batch_size": (
+        "0",
+        "0",
+        "Number of rows the operators of read-only queries exchange at a time. Set to 0 to pull the rows one at a time.",
+    ),
     "query_execution_timeout_sec": (
         "600",
         "600",
         "Maximum allowed query execution time. Queries exceeding this limit will be aborted. Value of 0 means no limit.",
     ),
+    "query_fingerprint_metrics_size": (
+        "100",
+        "100",
+        "Number of query fingerprints, the hashes of the stripped queries, whose latency, rows, memory peak and plan cache hits the metrics endpoint exports. The fingerprints with the fewest executions are replaced first. Set to 0 to disable the fingerprint metrics.",
+    ),
+    "query_load_csv_parallel_workers": (
+        "0",
+        "0",
+        "Number of threads which parse the file of LOAD CSV in concurrent chunks. The rows are still created in the order of the file. Set to 0 or 1 to parse the file on the query thread.",
+    ),
+    "query_analytical_write_workers": (
+        "0",
+        "0",
+        "Number of threads which run UNWIND write queries in IN_MEMORY_ANALYTICAL storage mode. The unwound list is split into parts which the threads write in transactions of their own. Set to 0 or 1 to write on the query thread.",
+    ),
+    "query_periodic_commit_delta_budget": (
+        "0",
+        "0",
+        "Deltas a batch of USING PERIODIC COMMIT may write before it's committed. With a budget the number of the query only sizes the first batch, the next ones are sized by the deltas and the time the previous batch took. Set to 0 to disable the budget.",
+    ),
+    "query_periodic_commit_time_budget_ms": (
+        "0",
+        "0",
+        "Time in milliseconds a batch of USING PERIODIC COMMIT may take, including its commit. With a budget the number of the query only sizes the first batch, the next ones are sized by the deltas and the time the previous batch took. Set to 0 to disable the budget.",
+    ),
+    "query_max_prepared_statements": (
+        "100",
+        "100",
+        'Number of prepared statements a session holds. A query run with the Bolt extra "prepared" set to true is kept with its plan, and running it again skips parsing and the cache lookups. One statement is dropped to make room for a new one when the session holds this many. Set to 0 to disable prepared statements.',
+    ),
     "query_modules_directory": (
         "",
         "",
         "Directory where modules with custom query procedures are stored. NOTE: Multiple comma-separated directories can be defined.",
     ),
+    "query_profile_sample_rate": (
+        "0",
+        "0",
+        "Profile 1 in this many executions of each query plan and aggregate the time and rows of its operators, shown by SHOW PROFILE INFO and the metrics endpoint. The sampled executions pull their rows one at a time. Set to 0 to disable the sampling.",
+    ),
+    "query_analyze_graph_sample_rate": (
+        "0",
+        "0",
+        "Make ANALYZE GRAPH examine 1 in this many vertices of each index and approximate the index statistics from them. The vertex counts of the label indices stay exact. Set to 0 or 1 to examine all of the vertices.",
+    ),
+    "query_slow_log_file": (
+        "",
+        "",
+        "Path of the file which the Cypher queries running longer than --query_slow_log_threshold_ms are logged to as JSON lines, with their plan, parameter sizes and resource usage. The executions sampled by --query_profile_sample_rate are logged with their profile. Leave empty to disable the log.",
+    ),
+    "query_slow_log_max_file_size": ("100", "100", "Size (in MiB) at which the slow query log file is rotated."),
+    "query_slow_log_max_files": ("5", "5", "Number of rotated slow query log files which are kept."),
+    "query_slow_log_threshold_ms": (
+        "1000",
+        "1000",
+        "Execution time from which a query is logged to the slow query log.",
+    ),
+    "query_spill_rows": (
+        "0",
+        "0",
+        "Number of rows ORDER BY keeps in memory before it writes them as a sorted run to a temporary file under the data directory. The runs are merged back when the rows are returned. Set to 0 to sort all rows in memory.",
+    ),
     "replication_replica_check_frequency_sec": (
         "1",
         "1",
@@ -181,8 +318,53 @@ startup_config_dict = {
         "true",
         "Controls whether updating a property with the same value should create a delta object.",
     ),
+    "storage_disk_block_cache_mib": (
+        "0",
+        "0",
+        "Size (in MiB) of the RocksDB block cache shared by the column families of the on-disk storage. Set to 0 to keep the default cache of each column family.",
+    ),
+    "storage_disk_bloom_filter_bits_per_key": (
+        "0",
+        "0",
+        "Bits per key of the bloom filters of the on-disk storage column families which are read by key. Set to 0 to disable the filters.",
+    ),
+    "storage_disk_vertex_cache_size": (
+        "0",
+        "0",
+        "Number of vertices read by on-disk storage transactions which are kept for the following transactions. Set to 0 to disable the cache.",
+    ),
+    "storage_analytical_compaction_interval_sec": (
+        "0",
+        "0",
+        "Interval (in seconds) of compacting the adjacency lists of the vertices while the storage is in the IN_MEMORY_ANALYTICAL mode. The edges are sorted by edge type and neighbour and their unused capacity is released. Set to 0 to disable the compaction.",
+    ),
     "storage_gc_cycle_sec": ("30", "30", "Storage garbage collector interval (in seconds)."),
+    "storage_gc_release_threads": (
+        "0",
+        "0",
+        "Number of background threads which free the deltas collected by the storage garbage collector. Set to 0 to free them on the garbage collector thread.",
+    ),
+    "storage_gc_slice_ms": (
+        "0",
+        "0",
+        "Maximum time (in milliseconds) a storage garbage collector slice spends unlinking deltas. The collection is split into slices until it catches up. Set to 0 to collect everything in one pass.",
+    ),
     "storage_python_gc_cycle_sec": ("180", "180", "Storage python full garbage collection interval (in seconds)."),
+    "storage_index_creation_thread_count": (
+        "1",
+        "1",
+        "The number of threads used to populate a label or label-property index when it is created.",
+    ),
+    "storage_index_stats_refresh_interval_sec": (
+        "0",
+        "0",
+        "Interval (in seconds) of checking whether the statistics computed by ANALYZE GRAPH are stale and recomputing them. Set to 0 to disable the background refresh.",
+    ),
+    "storage_index_stats_refresh_threshold": (
+        "0.1",
+        "0.1",
+        "Fraction of an analyzed index which has to change for its statistics to be recomputed in the background.",
+    ),
     "storage_items_per_batch": (
         "1000000",
         "1000000",
@@ -190,18 +372,53 @@ startup_config_dict = {
     ),
     "storage_properties_on_edges": ("false", "true", "Controls whether edges have properties."),
     "storage_recovery_thread_count": ("12", "12", "The number of threads used to recover persisted data from disk."),
+    "storage_unload_idle_databases_sec": (
+        "0",
+        "0",
+        "Databases other than the default one which no session used for this many seconds are unloaded from memory and recovered on their next use. Requires data recovery on startup and periodic snapshots with WAL. 0 keeps all databases loaded.",
+    ),
+    "storage_snapshot_batch_compression": (
+        "false",
+        "false",
+        "Controls whether each batch of edges and vertices in a snapshot file is compressed and checksummed. The compression level is set by storage_property_store_compression_level.",
+    ),
     "storage_snapshot_interval_sec": (
         "0",
         "300",
         "Storage snapshot creation interval (in seconds). Set to 0 to disable periodic snapshot creation.",
     ),
+    "storage_snapshot_min_wal_percent": (
+        "0",
+        "0",
+        "Periodic snapshots are skipped while the WAL files written since the latest snapshot are smaller than this percentage of its size. Set to 0 to always create periodic snapshots.",
+    ),
     "storage_snapshot_on_exit": ("false", "false", "Controls whether the storage creates another snapshot on exit."),
     "storage_snapshot_retention_count": ("3", "3", "The number of snapshots that should always be kept."),
+    "storage_text_index_refresh_interval_ms": (
+        "0",
+        "0",
+        "Interval (in milliseconds) at which the changes of committed transactions are applied to the text indices in the background. Set to 0 to apply them at each commit.",
+    ),
+    "storage_unique_constraints_hash_index": (
+        "false",
+        "false",
+        "Controls whether in-memory unique constraints keep their entries in a hash table instead of a skip list, which makes validating a commit cheaper.",
+    ),
+    "storage_vertex_gid_table": (
+        "false",
+        "false",
+        "Controls whether in-memory vertices are also kept in an array indexed by their id, so looking a vertex up by its id doesn't search the skip list of the vertices.",
+    ),
     "storage_wal_enabled": (
         "false",
         "true",
         "Controls whether the storage uses write-ahead-logging. To enable WAL periodic snapshots must be enabled.",
     ),
+    "storage_wal_group_commit": (
+        "false",
+        "false",
+        "Controls whether each commit waits until its WAL records are synced to disk. Concurrent commits share a single 'fsync' and storage_wal_file_flush_every_n_tx is ignored.",
+    ),
     "storage_wal_file_flush_every_n_tx": (
         "100000",
         "100000",
@@ -213,6 +430,11 @@ startup_config_dict = {
         "Default storage mode Memgraph uses. Allowed values: IN_MEMORY_TRANSACTIONAL, IN_MEMORY_ANALYTICAL, ON_DISK_TRANSACTIONAL",
     ),
     "storage_wal_file_size_kib": ("20480", "20480", "Minimum file size of each WAL file."),
+    "stream_batched_queries": (
+        "true",
+        "true",
+        "Set to true to run consecutive identical CREATE and MERGE queries of a stream transformation as a single query which unwinds their parameters.",
+    ),
     "stream_transaction_conflict_retries": (
         "30",
         "30",
@@ -233,14 +455,66 @@ startup_config_dict = {
         "UTC",
         "Define instance's timezone (IANA format).",
     ),
+    "tracing_export_interval_ms": ("1000", "1000", "Interval at which the spans are sent to the collector."),
+    "tracing_otlp_endpoint": (
+        "",
+        "",
+        "Base URL of the OpenTelemetry collector, e.g. http://localhost:4318, which the spans of the sampled requests are sent to over OTLP/HTTP. Leave empty to disable the tracing.",
+    ),
+    "tracing_sample_rate": (
+        "100",
+        "100",
+        "Trace 1 in this many of the Bolt requests which each worker thread executes, from decoding the messages to the WAL and the replication of the commit. Set to 0 to disable the tracing.",
+    ),
+    "trigger_batch_size": (
+        "1",
+        "1",
+        "Number of committed transactions whose AFTER COMMIT triggers run once for their combined changes. Set to 1 to run the triggers for each transaction.",
+    ),
+    "trigger_parallel_workers": (
+        "1",
+        "1",
+        "Number of threads which run the AFTER COMMIT triggers of a batch of committed transactions concurrently, each trigger in its own transaction.",
+    ),
+    "query_ast_cache_max_size": ("1000", "1000", "Maximum number of parsed queries to cache."),
     "query_cost_planner": ("true", "true", "Use the cost-estimating query planner."),
     "query_plan_cache_max_size": ("1000", "1000", "Maximum number of query plans to cache."),
+    "query_plan_cache_parameter_sensitive": (
+        "false",
+        "false",
+        "Cache separate plans of a query for parameters of different types and for list parameters of different magnitudes of sizes.",
+    ),
     "query_vertex_count_to_expand_existing": (
         "10",
         "10",
         "Maximum count of indexed vertices which provoke indexed lookup and then expand to existing, instead of a regular expand. Default is 10, to turn off use -1.",
     ),
+    "query_load_properties": (
+        "false",
+        "false",
+        "Read the properties which the filters and the projection of a read-only query look up more than once into frame slots, once for every row.",
+    ),
+    "query_common_subexpressions": (
+        "false",
+        "false",
+        "Compute the deterministic expressions which occur more than once in the filters, the projection and the ordering of a read-only query once for every row.",
+    ),
+    "query_count_vertices_from_index": (
+        "true",
+        "true",
+        "Count the vertices of a label or label property index scan in the storage when a query only counts them, e.g. MATCH (n:Label) RETURN count(n).",
+    ),
+    "query_parallel_scan_workers": (
+        "0",
+        "0",
+        "Number of threads used to scan vertices in read-only queries. Default is 0, values 0 and 1 turn parallel scans off.",
+    ),
     "query_max_plans": ("1000", "1000", "Maximum number of generated plans for a query."),
+    "query_max_planning_time_ms": (
+        "1000",
+        "1000",
+        "Time after which no more plans are generated for a query once a valid one is found. 0 means no limit.",
+    ),
     "flag_file": ("", "", "load flags from file"),
     "hops_limit_partial_results": (
         "true",
@@ -258,6 +532,26 @@ startup_config_dict = {
         "true",
         "Restore replication state on startup, e.g. recover replica",
     ),
+    "replication_sync_quorum": (
+        "0",
+        "0",
+        "Number of SYNC replicas which have to confirm a transaction before its commit is acknowledged. The other SYNC replicas confirm it in the background, like ASYNC replicas. If 0, or larger than the number of SYNC replicas, all SYNC replicas have to confirm it.",
+    ),
+    "replication_compression": (
+        "false",
+        "false",
+        "Compress the deltas, WAL files and snapshots sent to the replicas which are registered while it is set. Helps when the network between the instances is slower than the compression.",
+    ),
+    "replication_bookmark_wait_ms": (
+        "10000",
+        "10000",
+        "Time a transaction which was started with bookmarks waits for the database to apply the commits the bookmarks refer to, before it fails. Lets clients read their own writes from the replicas.",
+    ),
+    "replication_hot_queries": (
+        "32",
+        "32",
+        "Number of the most executed queries the MAIN sends to its replicas, which parse and plan them ahead, so a replica promoted to MAIN serves them from warm AST and plan caches. If 0, no queries are sent.",
+    ),
     "query_callable_mappings_path": (
         "",
         "",
@@ -268,6 +562,21 @@ startup_config_dict = {
         "128",
         "The threshold for when to cache long delta chains. This is used for heavy read + write workloads where repeated processing of delta chains can become costly.",
     ),
+    "adjacency_grouping_threshold": (
+        "0",
+        "0",
+        "The number of edges in one direction of a vertex after which the edges are kept grouped by edge type, so expansions filtered by edge type only visit the matching edges. Set to 0 to disable.",
+    ),
+    "delta_chain_materialize_threshold": (
+        "1024",
+        "1024",
+        "The length of a delta chain after which the version of a vertex seen by a snapshot isolation transaction is materialized and shared with all transactions seeing the same version. This is used for long-running reads of heavily modified vertices. Set to 0 to disable.",
+    ),
+    "dump_parallel_workers": (
+        "1",
+        "1",
+        "Number of threads which generate the vertex and edge statements of DUMP DATABASE. Set to 1 to generate them on the thread which runs the query.",
+    ),
     "experimental_enabled": (
         "",
         "",
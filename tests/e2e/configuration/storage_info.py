@@ -26,6 +26,8 @@ default_storage_info_dict = {
     "disk_usage": "",  # machine dependent
     "memory_tracked": "",  # machine dependent
     "allocation_limit": "",  # machine dependent
+    "database_memory_tracked": "0B",
+    "database_allocation_limit": "0B",
     "global_isolation_level": "SNAPSHOT_ISOLATION",
     "session_isolation_level": "",
     "next_session_isolation_level": "",
@@ -0,0 +1,43 @@
+# Copyright 2024 Memgraph Ltd.
+#
+# Use of this software is governed by the Business Source License
+# included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+# License, and you may not use this file except in compliance with the Business Source License.
+#
+# As of the Change Date specified in that file, in accordance with
+# the Business Source License, use of this software will be governed
+# by the Apache License, Version 2.0, included in the file
+# licenses/APL.txt.
+
+import re
+import sys
+
+import pytest
+from common import connect_with_autocommit, execute_and_fetch_all, memgraph
+
+# The cluster runs with --query-periodic-commit-delta-budget=300, a created
+# vertex with a label and a property writes 3 deltas.
+DELTA_BUDGET_ROWS = 100
+
+
+def test_adaptive_periodic_commit_stays_within_delta_budget(memgraph):
+    cursor = connect_with_autocommit().cursor()
+    results = execute_and_fetch_all(
+        cursor, "PROFILE USING PERIODIC COMMIT 10 UNWIND range(1, 1000) AS i CREATE (:Node {id: i})"
+    )
+
+    operators = [row[0] for row in results if "PeriodicCommit" in row[0]]
+    assert len(operators) == 1
+    match = re.search(r"adaptive, (\d+) batches of (\d+)\.\.(\d+) rows", operators[0])
+    assert match is not None
+    batches, smallest, largest = map(int, match.groups())
+    assert smallest == 10
+    assert largest <= DELTA_BUDGET_ROWS + 1
+    assert batches > 1000 // (DELTA_BUDGET_ROWS + 1)
+
+    actual = list(memgraph.execute_and_fetch("MATCH (n:Node) RETURN count(n) AS cnt"))[0]["cnt"]
+    assert actual == 1000
+
+
+if __name__ == "__main__":
+    sys.exit(pytest.main([__file__, "-rA"]))
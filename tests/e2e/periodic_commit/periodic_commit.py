@@ -1,4 +1,4 @@
-# Copyright 2023 Memgraph Ltd.
+# Copyright 2024 Memgraph Ltd.
 #
 # Use of this software is governed by the Business Source License
 # included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -87,5 +87,33 @@ def test_periodic_commit_acid_guarantee_in_batches(memgraph):
     assert results[3]["id"] == 4
 
 
+def test_concurrent_transactions_write_every_batch(memgraph):
+    memgraph.execute("UNWIND range(1, 1000) AS i CREATE (:Node {id: i})")
+
+    memgraph.execute("MATCH (n:Node) CALL { WITH n SET n.doubled = n.id * 2 } IN 4 CONCURRENT TRANSACTIONS OF 50 ROWS")
+
+    results = list(memgraph.execute_and_fetch("MATCH (n:Node) WHERE n.doubled = n.id * 2 RETURN count(n) AS cnt"))
+    assert results[0]["cnt"] == 1000
+
+
+def test_concurrent_transactions_retry_conflicting_batches(memgraph):
+    memgraph.execute("CREATE (:Counter {value: 0})")
+
+    memgraph.execute(
+        "UNWIND range(1, 100) AS i CALL { MATCH (c:Counter) SET c.value = c.value + 1 } "
+        "IN 2 CONCURRENT TRANSACTIONS OF 10 ROWS"
+    )
+
+    results = list(memgraph.execute_and_fetch("MATCH (c:Counter) RETURN c.value AS value"))
+    assert results[0]["value"] == 100
+
+
+def test_concurrent_transactions_reject_returning_subquery(memgraph):
+    with pytest.raises(Exception):
+        memgraph.execute(
+            "UNWIND range(1, 10) AS i CALL { RETURN 1 AS x } IN CONCURRENT TRANSACTIONS OF 1 ROWS RETURN x"
+        )
+
+
 if __name__ == "__main__":
     sys.exit(pytest.main([__file__, "-rA"]))
@@ -1,4 +1,4 @@
-# Copyright 2023 Memgraph Ltd.
+# Copyright 2024 Memgraph Ltd.
 #
 # Use of this software is governed by the Business Source License
 # included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
@@ -20,20 +20,43 @@ def test_all_show_metrics_info_values_are_present(memgraph):
         {"name": "AverageDegree", "type": "General", "metric type": "Gauge"},
         {"name": "EdgeCount", "type": "General", "metric type": "Gauge"},
         {"name": "VertexCount", "type": "General", "metric type": "Gauge"},
+        {"name": "InstanceDownDetectionLatency_us_50p", "type": "HighAvailability", "metric type": "Histogram"},
+        {"name": "InstanceDownDetectionLatency_us_90p", "type": "HighAvailability", "metric type": "Histogram"},
+        {"name": "InstanceDownDetectionLatency_us_99p", "type": "HighAvailability", "metric type": "Histogram"},
+        {"name": "InstanceHeartbeatLatency_us_50p", "type": "HighAvailability", "metric type": "Histogram"},
+        {"name": "InstanceHeartbeatLatency_us_90p", "type": "HighAvailability", "metric type": "Histogram"},
+        {"name": "InstanceHeartbeatLatency_us_99p", "type": "HighAvailability", "metric type": "Histogram"},
         {"name": "ActiveLabelIndices", "type": "Index", "metric type": "Counter"},
         {"name": "ActiveLabelPropertyIndices", "type": "Index", "metric type": "Counter"},
         {"name": "ActivePointIndices", "type": "Index", "metric type": "Counter"},
         {"name": "ActiveTextIndices", "type": "Index", "metric type": "Counter"},
+        {"name": "ActiveVectorIndices", "type": "Index", "metric type": "Counter"},
+        {"name": "NumaLocalAllocations", "type": "Memory", "metric type": "Counter"},
+        {"name": "NumaUnknownNodeAllocations", "type": "Memory", "metric type": "Counter"},
         {"name": "UnreleasedDeltaObjects", "type": "Memory", "metric type": "Counter"},
         {"name": "DiskUsage", "type": "Memory", "metric type": "Gauge"},
         {"name": "MemoryRes", "type": "Memory", "metric type": "Gauge"},
         {"name": "PeakMemoryRes", "type": "Memory", "metric type": "Gauge"},
+        {"name": "GCDeltaUnlinkLatency_us_50p", "type": "Memory", "metric type": "Histogram"},
+        {"name": "GCDeltaUnlinkLatency_us_90p", "type": "Memory", "metric type": "Histogram"},
+        {"name": "GCDeltaUnlinkLatency_us_99p", "type": "Memory", "metric type": "Histogram"},
+        {"name": "GCIndexCleanupLatency_us_50p", "type": "Memory", "metric type": "Histogram"},
+        {"name": "GCIndexCleanupLatency_us_90p", "type": "Memory", "metric type": "Histogram"},
+        {"name": "GCIndexCleanupLatency_us_99p", "type": "Memory", "metric type": "Histogram"},
+        {"name": "GCLatency_us_50p", "type": "Memory", "metric type": "Histogram"},
+        {"name": "GCLatency_us_90p", "type": "Memory", "metric type": "Histogram"},
+        {"name": "GCLatency_us_99p", "type": "Memory", "metric type": "Histogram"},
+        {"name": "GCUnlinkedDeltas_50p", "type": "Memory", "metric type": "Histogram"},
+        {"name": "GCUnlinkedDeltas_90p", "type": "Memory", "metric type": "Histogram"},
+        {"name": "GCUnlinkedDeltas_99p", "type": "Memory", "metric type": "Histogram"},
         {"name": "AccumulateOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "AggregateOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "ApplyOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "CallProcedureOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "CartesianOperator", "type": "Operator", "metric type": "Counter"},
+        {"name": "ComputeExpressionsOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "ConstructNamedPathOperator", "type": "Operator", "metric type": "Counter"},
+        {"name": "CountVerticesOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "CreateExpandOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "CreateNodeOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "DeleteOperator", "type": "Operator", "metric type": "Counter"},
@@ -43,11 +66,14 @@ def test_all_show_metrics_info_values_are_present(memgraph):
         {"name": "EvaluatePatternFilterOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "ExpandOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "ExpandVariableOperator", "type": "Operator", "metric type": "Counter"},
+        {"name": "ExpandIntersectionOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "FilterOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "ForeachOperator", "type": "Operator", "metric type": "Counter"},
+        {"name": "GatherOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "HashJoinOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "IndexedJoinOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "LimitOperator", "type": "Operator", "metric type": "Counter"},
+        {"name": "LoadPropertiesOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "MergeOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "OnceOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "OptionalOperator", "type": "Operator", "metric type": "Counter"},
@@ -69,6 +95,7 @@ def test_all_show_metrics_info_values_are_present(memgraph):
         {"name": "ScanAllByLabelPropertyOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "ScanAllByLabelPropertyRangeOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "ScanAllByLabelPropertyValueOperator", "type": "Operator", "metric type": "Counter"},
+        {"name": "ScanAllByPointNearestOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "ScanAllOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "SetLabelsOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "SetPropertiesOperator", "type": "Operator", "metric type": "Counter"},
@@ -76,19 +103,60 @@ def test_all_show_metrics_info_values_are_present(memgraph):
         {"name": "SkipOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "UnionOperator", "type": "Operator", "metric type": "Counter"},
         {"name": "UnwindOperator", "type": "Operator", "metric type": "Counter"},
+        {"name": "QueryAdmissionTimeouts", "type": "Query", "metric type": "Counter"},
+        {"name": "QueryAstCacheHits", "type": "Query", "metric type": "Counter"},
+        {"name": "QueryAstCacheMisses", "type": "Query", "metric type": "Counter"},
+        {"name": "QueryPlanCacheHits", "type": "Query", "metric type": "Counter"},
+        {"name": "QueryPlanCacheMisses", "type": "Query", "metric type": "Counter"},
+        {"name": "QueryPlanCacheStalePlans", "type": "Query", "metric type": "Counter"},
+        {"name": "QueuedQueries", "type": "Query", "metric type": "Counter"},
+        {"name": "QueryAdmissionWaitLatency_us_50p", "type": "Query", "metric type": "Histogram"},
+        {"name": "QueryAdmissionWaitLatency_us_90p", "type": "Query", "metric type": "Histogram"},
+        {"name": "QueryAdmissionWaitLatency_us_99p", "type": "Query", "metric type": "Histogram"},
         {"name": "QueryExecutionLatency_us_50p", "type": "Query", "metric type": "Histogram"},
         {"name": "QueryExecutionLatency_us_90p", "type": "Query", "metric type": "Histogram"},
         {"name": "QueryExecutionLatency_us_99p", "type": "Query", "metric type": "Histogram"},
         {"name": "ReadQuery", "type": "QueryType", "metric type": "Counter"},
         {"name": "ReadWriteQuery", "type": "QueryType", "metric type": "Counter"},
         {"name": "WriteQuery", "type": "QueryType", "metric type": "Counter"},
+        {"name": "RecoveryConstraintsLatency_us_50p", "type": "Recovery", "metric type": "Histogram"},
+        {"name": "RecoveryConstraintsLatency_us_90p", "type": "Recovery", "metric type": "Histogram"},
+        {"name": "RecoveryConstraintsLatency_us_99p", "type": "Recovery", "metric type": "Histogram"},
+        {"name": "RecoveryIndicesLatency_us_50p", "type": "Recovery", "metric type": "Histogram"},
+        {"name": "RecoveryIndicesLatency_us_90p", "type": "Recovery", "metric type": "Histogram"},
+        {"name": "RecoveryIndicesLatency_us_99p", "type": "Recovery", "metric type": "Histogram"},
+        {"name": "RecoverySnapshotConnectivityLatency_us_50p", "type": "Recovery", "metric type": "Histogram"},
+        {"name": "RecoverySnapshotConnectivityLatency_us_90p", "type": "Recovery", "metric type": "Histogram"},
+        {"name": "RecoverySnapshotConnectivityLatency_us_99p", "type": "Recovery", "metric type": "Histogram"},
+        {"name": "RecoverySnapshotEdgesLatency_us_50p", "type": "Recovery", "metric type": "Histogram"},
+        {"name": "RecoverySnapshotEdgesLatency_us_90p", "type": "Recovery", "metric type": "Histogram"},
+        {"name": "RecoverySnapshotEdgesLatency_us_99p", "type": "Recovery", "metric type": "Histogram"},
+        {"name": "RecoverySnapshotVerticesLatency_us_50p", "type": "Recovery", "metric type": "Histogram"},
+        {"name": "RecoverySnapshotVerticesLatency_us_90p", "type": "Recovery", "metric type": "Histogram"},
+        {"name": "RecoverySnapshotVerticesLatency_us_99p", "type": "Recovery", "metric type": "Histogram"},
+        {"name": "RecoveryTextIndicesLatency_us_50p", "type": "Recovery", "metric type": "Histogram"},
+        {"name": "RecoveryTextIndicesLatency_us_90p", "type": "Recovery", "metric type": "Histogram"},
+        {"name": "RecoveryTextIndicesLatency_us_99p", "type": "Recovery", "metric type": "Histogram"},
+        {"name": "RecoveryWalLatency_us_50p", "type": "Recovery", "metric type": "Histogram"},
+        {"name": "RecoveryWalLatency_us_90p", "type": "Recovery", "metric type": "Histogram"},
+        {"name": "RecoveryWalLatency_us_99p", "type": "Recovery", "metric type": "Histogram"},
         {"name": "ShowSchema", "type": "SchemaInfo", "metric type": "Counter"},
         {"name": "ActiveBoltSessions", "type": "Session", "metric type": "Counter"},
         {"name": "ActiveSSLSessions", "type": "Session", "metric type": "Counter"},
         {"name": "ActiveSessions", "type": "Session", "metric type": "Counter"},
         {"name": "ActiveTCPSessions", "type": "Session", "metric type": "Counter"},
         {"name": "ActiveWebSocketSessions", "type": "Session", "metric type": "Counter"},
+        {"name": "AuthenticationAttempts", "type": "Session", "metric type": "Counter"},
+        {"name": "AuthenticationCacheHits", "type": "Session", "metric type": "Counter"},
+        {"name": "AuthenticationCacheMisses", "type": "Session", "metric type": "Counter"},
         {"name": "BoltMessages", "type": "Session", "metric type": "Counter"},
+        {"name": "QueuedBoltExecutions", "type": "Session", "metric type": "Counter"},
+        {"name": "BoltBytesPerWrite_50p", "type": "Session", "metric type": "Histogram"},
+        {"name": "BoltBytesPerWrite_90p", "type": "Session", "metric type": "Histogram"},
+        {"name": "BoltBytesPerWrite_99p", "type": "Session", "metric type": "Histogram"},
+        {"name": "BoltExecutionWaitLatency_us_50p", "type": "Session", "metric type": "Histogram"},
+        {"name": "BoltExecutionWaitLatency_us_90p", "type": "Session", "metric type": "Histogram"},
+        {"name": "BoltExecutionWaitLatency_us_99p", "type": "Session", "metric type": "Histogram"},
         {"name": "SnapshotCreationLatency_us_50p", "type": "Snapshot", "metric type": "Histogram"},
         {"name": "SnapshotCreationLatency_us_90p", "type": "Snapshot", "metric type": "Histogram"},
         {"name": "SnapshotCreationLatency_us_99p", "type": "Snapshot", "metric type": "Histogram"},
@@ -106,8 +174,11 @@ def test_all_show_metrics_info_values_are_present(memgraph):
         {"name": "FailedQuery", "type": "Transaction", "metric type": "Counter"},
         {"name": "RollbackedTransactions", "type": "Transaction", "metric type": "Counter"},
         {"name": "SuccessfulQuery", "type": "Transaction", "metric type": "Counter"},
+        {"name": "VertexInfoCacheHits", "type": "Transaction", "metric type": "Counter"},
+        {"name": "VertexInfoCacheMisses", "type": "Transaction", "metric type": "Counter"},
         {"name": "TriggersCreated", "type": "Trigger", "metric type": "Counter"},
         {"name": "TriggersExecuted", "type": "Trigger", "metric type": "Counter"},
+        {"name": "AfterCommitTriggerQueueDepth", "type": "Trigger", "metric type": "Gauge"},
     ]
     results = list(memgraph.execute_and_fetch("SHOW METRICS INFO"))
     actual_metrics = [{"name": x["name"], "type": x["type"], "metric type": x["metric type"]} for x in results]
@@ -273,6 +273,17 @@ class InteractiveDbAccessor {
     return label_property_index_.at(key);
   }
 
+  // Composite indices aren't offered, so the planner never asks for their vertex counts.
+  std::vector<std::vector<memgraph::storage::PropertyId>> LabelPropertyCompositeIndices(
+      memgraph::storage::LabelId /*label*/) {
+    return {};
+  }
+
+  int64_t VerticesCount(memgraph::storage::LabelId /*label*/,
+                        const std::vector<memgraph::storage::PropertyId> & /*properties*/) {
+    return 0;
+  }
+
   bool EdgeTypeIndexExists(memgraph::storage::EdgeTypeId edge_type_id) { return true; }
 
   bool EdgeTypePropertyIndexExists(memgraph::storage::EdgeTypeId edge_type_id,
@@ -288,6 +299,10 @@ class InteractiveDbAccessor {
     return edge_type_property_index_.at(key);
   }
 
+  bool PointIndexExists(memgraph::storage::LabelId label_id, memgraph::storage::PropertyId property_id) {
+    return false;
+  }
+
   std::optional<memgraph::storage::LabelIndexStats> GetIndexStats(const memgraph::storage::LabelId label) const {
     return dba_->GetIndexStats(label);
   }
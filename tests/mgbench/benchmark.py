@@ -887,6 +887,18 @@ def log_output_summary(benchmark_context, ret, usage, funcname, sample_query):
             log.success("{:<10} {:>10}".format(key, value))
         else:
             log.success("{:<10} {:>10.06f} seconds".format(key, value))
+    if LATENCY_STATS_PER_CLASS in ret:
+        log.success("Latency statistics per query class:")
+        for query_class, stats in ret[LATENCY_STATS_PER_CLASS].items():
+            if "p50" not in stats:
+                log.success("{:<15} {:>10} iterations".format(query_class, stats[ITERATIONS]))
+                continue
+            log.success(
+                "{:<15} {:>10} iterations, p50 {:.06f}, p99 {:.06f}, p999 {:.06f} seconds".format(
+                    query_class, stats[ITERATIONS], stats["p50"], stats["p99"], stats["p999"]
+                )
+            )
+        log.success("{} events during the run".format(len(ret[EVENTS])))
     log.success("Throughput: {:02f} QPS\n\n".format(ret[THROUGHPUT]))
 
 
@@ -63,9 +63,42 @@ DEFINE_int64(time_dependent_execution, 0,
              "Time-dependent executions execute the queries for a specified number of seconds."
              "If all queries are executed, and there is still time, queries are rerun again."
              "If the time runs out, the client is done with the job and returning results.");
+DEFINE_double(latency_interval, 1.0,
+              "Length in seconds of the intervals the latency timeline of classified queries is split into.");
+DEFINE_string(event_classes, "gc,snapshot",
+              "Comma-separated classes of queries whose executions are reported as events of the timeline.");
 
 using bolt_map_t = memgraph::communication::bolt::map_t;
 
+/// Classes of the queries which were loaded as JSON with a third element,
+/// the name of the class. The latencies of classified queries are reported
+/// per class and over time.
+struct QueryClasses {
+  std::vector<std::string> names;
+  // Index of the name of each query's class.
+  std::vector<uint32_t> of_query;
+
+  bool Empty() const { return names.empty(); }
+
+  void Add(const std::string &name) {
+    auto it = std::find(names.begin(), names.end(), name);
+    if (it == names.end()) it = names.insert(names.end(), name);
+    of_query.push_back(it - names.begin());
+  }
+
+  void Clear() {
+    names.clear();
+    of_query.clear();
+  }
+};
+
+struct ClassifiedLatency {
+  uint32_t query_class;
+  // Seconds since the workload started.
+  double start;
+  double latency;
+};
+
 std::pair<bolt_map_t, uint64_t> ExecuteNTimesTillSuccess(memgraph::communication::bolt::Client *client,
                                                          const std::string &query, const bolt_map_t &params,
                                                          int max_attempts) {
@@ -195,14 +228,8 @@ class Metadata final {
   std::map<std::string, Record> storage_;
 };
 
-nlohmann::json LatencyStatistics(std::vector<std::vector<double>> &worker_query_latency) {
+nlohmann::json LatencyStatistics(std::vector<double> query_latency) {
   nlohmann::json statistics = nlohmann::json::object();
-  std::vector<double> query_latency;
-  for (int i = 0; i < FLAGS_num_workers; i++) {
-    for (auto &e : worker_query_latency[i]) {
-      query_latency.push_back(e);
-    }
-  }
   auto iterations = query_latency.size();
   const int lower_bound = 10;
   if (iterations > lower_bound) {
@@ -211,6 +238,7 @@ nlohmann::json LatencyStatistics(std::vector<std::vector<double>> &worker_query_
     statistics["min"] = query_latency.front();
     statistics["max"] = query_latency.back();
     statistics["mean"] = std::accumulate(query_latency.begin(), query_latency.end(), 0.0) / iterations;
+    statistics["p999"] = query_latency[floor(iterations * 0.999)];
     statistics["p99"] = query_latency[floor(iterations * 0.99)];
     statistics["p95"] = query_latency[floor(iterations * 0.95)];
     statistics["p90"] = query_latency[floor(iterations * 0.90)];
@@ -224,8 +252,69 @@ nlohmann::json LatencyStatistics(std::vector<std::vector<double>> &worker_query_
   return statistics;
 }
 
+nlohmann::json LatencyStatistics(std::vector<std::vector<double>> &worker_query_latency) {
+  std::vector<double> query_latency;
+  for (int i = 0; i < FLAGS_num_workers; i++) {
+    for (auto &e : worker_query_latency[i]) {
+      query_latency.push_back(e);
+    }
+  }
+  return LatencyStatistics(std::move(query_latency));
+}
+
+nlohmann::json TimelineStatistics(std::vector<double> query_latency) {
+  nlohmann::json statistics = nlohmann::json::object();
+  std::sort(query_latency.begin(), query_latency.end());
+  auto iterations = query_latency.size();
+  statistics["iterations"] = iterations;
+  statistics["p50"] = query_latency[floor(iterations * 0.50)];
+  statistics["p99"] = query_latency[floor(iterations * 0.99)];
+  statistics["p999"] = query_latency[floor(iterations * 0.999)];
+  statistics["max"] = query_latency.back();
+  return statistics;
+}
+
+/// Adds the latency statistics of each class, the statistics of each class in
+/// each `--latency_interval`, and the executions of the `--event_classes` to
+/// the summary.
+void AddClassifiedLatencyStatistics(const std::vector<std::vector<ClassifiedLatency>> &worker_latencies,
+                                    const QueryClasses &classes, nlohmann::json *summary) {
+  const auto event_classes = memgraph::utils::Split(FLAGS_event_classes, ",");
+  std::vector<std::vector<double>> class_latencies(classes.names.size());
+  std::vector<std::map<uint64_t, std::vector<double>>> class_timelines(classes.names.size());
+  nlohmann::json events = nlohmann::json::array();
+  for (const auto &latencies : worker_latencies) {
+    for (const auto &latency : latencies) {
+      const auto &name = classes.names[latency.query_class];
+      if (std::find(event_classes.begin(), event_classes.end(), name) != event_classes.end()) {
+        events.push_back({{"class", name}, {"start", latency.start}, {"duration", latency.latency}});
+      }
+      class_latencies[latency.query_class].push_back(latency.latency);
+      const auto interval = static_cast<uint64_t>((latency.start + latency.latency) / FLAGS_latency_interval);
+      class_timelines[latency.query_class][interval].push_back(latency.latency);
+    }
+  }
+  std::sort(events.begin(), events.end(), [](const auto &a, const auto &b) { return a["start"] < b["start"]; });
+
+  nlohmann::json per_class = nlohmann::json::object();
+  nlohmann::json timeline = nlohmann::json::object();
+  for (size_t i = 0; i < classes.names.size(); ++i) {
+    per_class[classes.names[i]] = LatencyStatistics(std::move(class_latencies[i]));
+    nlohmann::json intervals = nlohmann::json::array();
+    for (auto &[interval, latencies] : class_timelines[i]) {
+      auto statistics = TimelineStatistics(std::move(latencies));
+      statistics["end"] = (interval + 1) * FLAGS_latency_interval;
+      intervals.push_back(std::move(statistics));
+    }
+    timeline[classes.names[i]] = std::move(intervals);
+  }
+  (*summary)["latency_stats_per_class"] = std::move(per_class);
+  (*summary)["latency_timeline"] = std::move(timeline);
+  (*summary)["events"] = std::move(events);
+}
+
 void ExecuteTimeDependentWorkload(const std::vector<std::pair<std::string, bolt_map_t>> &queries,
-                                  std::ostream *stream) {
+                                  const QueryClasses &classes, std::ostream *stream) {
   std::vector<std::thread> threads;
   threads.reserve(FLAGS_num_workers);
 
@@ -233,6 +322,7 @@ void ExecuteTimeDependentWorkload(const std::vector<std::pair<std::string, bolt_
   std::vector<Metadata> worker_metadata(FLAGS_num_workers, Metadata());
   std::vector<double> worker_duration(FLAGS_num_workers, 0.0);
   std::vector<std::vector<double>> worker_query_durations(FLAGS_num_workers);
+  std::vector<std::vector<ClassifiedLatency>> worker_classified_latencies(FLAGS_num_workers);
 
   // Start workers and execute queries.
   auto size = queries.size();
@@ -243,6 +333,7 @@ void ExecuteTimeDependentWorkload(const std::vector<std::pair<std::string, bolt_
 
   std::chrono::time_point<std::chrono::steady_clock> workload_start;
   std::chrono::duration<double> time_limit = std::chrono::seconds(FLAGS_time_dependent_execution);
+  std::chrono::time_point<std::chrono::steady_clock> classified_start;
   for (int worker = 0; worker < FLAGS_num_workers; ++worker) {
     threads.push_back(std::thread([&, worker]() {
       memgraph::io::network::Endpoint endpoint(FLAGS_address, FLAGS_port);
@@ -257,6 +348,7 @@ void ExecuteTimeDependentWorkload(const std::vector<std::pair<std::string, bolt_
       auto &metadata = worker_metadata[worker];
       auto &duration = worker_duration[worker];
       auto &query_duration = worker_query_durations[worker];
+      auto &classified_latencies = worker_classified_latencies[worker];
 
       // After all threads have been initialised, start the workload timer
       if (!start_workload_timer.load()) {
@@ -277,6 +369,10 @@ void ExecuteTimeDependentWorkload(const std::vector<std::pair<std::string, bolt_
         memgraph::utils::Timer query_timer;
         auto ret = ExecuteNTimesTillSuccess(&client, query.first, query.second, FLAGS_max_retries);
         query_duration.emplace_back(query_timer.Elapsed().count());
+        if (!classes.Empty()) {
+          const auto end = std::chrono::duration<double>(std::chrono::steady_clock::now() - classified_start).count();
+          classified_latencies.push_back({classes.of_query[pos], end - query_duration.back(), query_duration.back()});
+        }
         retries += ret.second;
         metadata.Append(ret.first);
         duration = worker_timer.Elapsed().count();
@@ -289,6 +385,7 @@ void ExecuteTimeDependentWorkload(const std::vector<std::pair<std::string, bolt_
   while (ready.load(std::memory_order_acq_rel) < FLAGS_num_workers)
     ;
 
+  classified_start = std::chrono::steady_clock::now();
   run.store(true);
   for (int i = 0; i < FLAGS_num_workers; ++i) {
     threads[i].join();
@@ -326,11 +423,13 @@ void ExecuteTimeDependentWorkload(const std::vector<std::pair<std::string, bolt_
   summary["retries"] = final_retries;
   summary["metadata"] = final_metadata.Export();
   summary["num_workers"] = FLAGS_num_workers;
+  if (!classes.Empty()) AddClassifiedLatencyStatistics(worker_classified_latencies, classes, &summary);
 
   (*stream) << summary.dump() << std::endl;
 }
 
-void ExecuteWorkload(const std::vector<std::pair<std::string, bolt_map_t>> &queries, std::ostream *stream) {
+void ExecuteWorkload(const std::vector<std::pair<std::string, bolt_map_t>> &queries, const QueryClasses &classes,
+                     std::ostream *stream) {
   std::vector<std::thread> threads;
   threads.reserve(FLAGS_num_workers);
 
@@ -340,12 +439,14 @@ void ExecuteWorkload(const std::vector<std::pair<std::string, bolt_map_t>> &quer
   std::vector<Metadata> worker_metadata(FLAGS_num_workers, Metadata());
   std::vector<double> worker_duration(FLAGS_num_workers, 0.0);
   std::vector<std::vector<double>> worker_query_durations(FLAGS_num_workers);
+  std::vector<std::vector<ClassifiedLatency>> worker_classified_latencies(FLAGS_num_workers);
 
   // Start workers and execute queries.
   auto size = queries.size();
   std::atomic<bool> run(false);
   std::atomic<uint64_t> ready(0);
   std::atomic<uint64_t> position(0);
+  std::chrono::time_point<std::chrono::steady_clock> classified_start;
   for (int worker = 0; worker < FLAGS_num_workers; ++worker) {
     threads.push_back(std::thread([&, worker]() {
       memgraph::io::network::Endpoint endpoint(FLAGS_address, FLAGS_port);
@@ -361,6 +462,7 @@ void ExecuteWorkload(const std::vector<std::pair<std::string, bolt_map_t>> &quer
       auto &metadata = worker_metadata[worker];
       auto &duration = worker_duration[worker];
       auto &query_duration = worker_query_durations[worker];
+      auto &classified_latencies = worker_classified_latencies[worker];
 
       memgraph::utils::Timer worker_timer;
       while (true) {
@@ -370,6 +472,10 @@ void ExecuteWorkload(const std::vector<std::pair<std::string, bolt_map_t>> &quer
         memgraph::utils::Timer query_timer;
         auto ret = ExecuteNTimesTillSuccess(&client, query.first, query.second, FLAGS_max_retries);
         query_duration.emplace_back(query_timer.Elapsed().count());
+        if (!classes.Empty()) {
+          const auto end = std::chrono::duration<double>(std::chrono::steady_clock::now() - classified_start).count();
+          classified_latencies.push_back({classes.of_query[pos], end - query_duration.back(), query_duration.back()});
+        }
         retries += ret.second;
         metadata.Append(ret.first);
       }
@@ -381,6 +487,7 @@ void ExecuteWorkload(const std::vector<std::pair<std::string, bolt_map_t>> &quer
   // Synchronize workers and collect runtime.
   while (ready.load(std::memory_order_acq_rel) < FLAGS_num_workers)
     ;
+  classified_start = std::chrono::steady_clock::now();
   run.store(true, std::memory_order_acq_rel);
 
   for (int i = 0; i < FLAGS_num_workers; ++i) {
@@ -410,6 +517,7 @@ void ExecuteWorkload(const std::vector<std::pair<std::string, bolt_map_t>> &quer
   summary["metadata"] = final_metadata.Export();
   summary["num_workers"] = FLAGS_num_workers;
   summary["latency_stats"] = LatencyStatistics(worker_query_durations);
+  if (!classes.Empty()) AddClassifiedLatencyStatistics(worker_classified_latencies, classes, &summary);
   (*stream) << summary.dump() << std::endl;
 }
 
@@ -499,14 +607,16 @@ int main(int argc, char **argv) {
   }
 
   std::vector<std::pair<std::string, bolt_map_t>> queries;
+  QueryClasses classes;
   if (!FLAGS_queries_json) {
     // Load simple queries.
     std::string query;
     while (std::getline(*istream, query)) {
       auto trimmed = memgraph::utils::Trim(query);
       if (trimmed == "" || trimmed == ";") {
-        ExecuteWorkload(queries, ostream);
+        ExecuteWorkload(queries, classes, ostream);
         queries.clear();
+        classes.Clear();
         continue;
       }
       queries.emplace_back(query, bolt_map_t{});
@@ -519,15 +629,16 @@ int main(int argc, char **argv) {
       MG_ASSERT(data.is_array() && data.size() > 0,
                 "The root item of the loaded JSON queries must be a non-empty "
                 "array!");
-      MG_ASSERT(data.is_array() && data.size() == 2, "Each item of the loaded JSON queries must be an array!");
+      MG_ASSERT(data.is_array(), "Each item of the loaded JSON queries must be an array!");
       if (data.size() == 0) {
-        ExecuteWorkload(queries, ostream);
+        ExecuteWorkload(queries, classes, ostream);
         queries.clear();
+        classes.Clear();
         continue;
       }
-      MG_ASSERT(data.size() == 2,
+      MG_ASSERT(data.size() == 2 || data.size() == 3,
                 "Each item of the loaded JSON queries that has "
-                "data must be an array of length 2!");
+                "data must be an array of length 2, or 3 if it has a class!");
       const auto &query = data[0];
       const auto &param = data[1];
       MG_ASSERT(query.is_string() && param.is_object(),
@@ -536,15 +647,21 @@ int main(int argc, char **argv) {
       auto bolt_param = JsonToBoltValue(param);
       MG_ASSERT(bolt_param.IsMap(), "The Bolt parameters must be a map!");
       queries.emplace_back(query, std::move(bolt_param.ValueMap()));
+      if (data.size() == 3) {
+        MG_ASSERT(data[2].is_string(), "The class of the query must be a string!");
+        classes.Add(data[2].get<std::string>());
+      }
+      MG_ASSERT(classes.Empty() || classes.of_query.size() == queries.size(),
+                "Either all of the loaded JSON queries have a class or none of them do!");
     }
   }
 
   if (FLAGS_validation) {
     ExecuteValidation(queries, ostream);
   } else if (FLAGS_time_dependent_execution > 0) {
-    ExecuteTimeDependentWorkload(queries, ostream);
+    ExecuteTimeDependentWorkload(queries, classes, ostream);
   } else {
-    ExecuteWorkload(queries, ostream);
+    ExecuteWorkload(queries, classes, ostream);
   }
 
   return 0;
@@ -37,6 +37,8 @@ RETRIES = "retries"
 DOCKER = "docker"
 METADATA = "metadata"
 LATENCY_STATS = "latency_stats"
+LATENCY_STATS_PER_CLASS = "latency_stats_per_class"
+EVENTS = "events"
 ITERATIONS = "iterations"
 USERNAME = "user"
 PASSWORD = "test"
@@ -0,0 +1,85 @@
+# Copyright 2024 Memgraph Ltd.
+#
+# Use of this software is governed by the Business Source License
+# included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+# License, and you may not use this file except in compliance with the Business Source License.
+#
+# As of the Change Date specified in that file, in accordance with
+# the Business Source License, use of this software will be governed
+# by the Apache License, Version 2.0, included in the file
+# licenses/APL.txt.
+
+import random
+
+from workloads.base import Workload
+
+
+# Short transactional queries running concurrently with heavy aggregations,
+# garbage collection and snapshots. Each query is returned with its class, so
+# the client reports the latencies of each class over time together with the
+# times the garbage was collected and the snapshots were created. Run it with
+# --time-depended-execution so the classes share the whole run; the memory
+# and snapshot queries are Memgraph specific.
+class OltpAnalytics(Workload):
+    NAME = "oltp_analytics"
+    CARDINALITY = 10000
+    EDGES_PER_NODE = 10
+
+    # Shares of the queries of the classes which aren't short.
+    AGGREGATION_SHARE = 0.01
+    GC_SHARE = 0.001
+    SNAPSHOT_SHARE = 0.0005
+
+    def indexes_generator(self):
+        return [
+            ("CREATE INDEX ON :User;", {}),
+            ("CREATE INDEX ON :User(id);", {}),
+        ]
+
+    def dataset_generator(self):
+        rng = random.Random(0)
+        queries = []
+        for i in range(0, OltpAnalytics.CARDINALITY):
+            queries.append(("CREATE (:User {id: $id, score: 0, age: $age});", {"id": i, "age": i % 80}))
+        for i in range(0, OltpAnalytics.CARDINALITY):
+            for _ in range(0, OltpAnalytics.EDGES_PER_NODE):
+                queries.append(
+                    (
+                        "MATCH (a:User {id: $from}), (b:User {id: $to}) CREATE (a)-[:FOLLOWS]->(b);",
+                        {"from": i, "to": rng.randrange(OltpAnalytics.CARDINALITY)},
+                    )
+                )
+        return queries
+
+    def _random_id(self):
+        return random.randrange(OltpAnalytics.CARDINALITY)
+
+    def benchmark__mixed__oltp_with_analytics(self):
+        sample = random.random()
+        if sample < OltpAnalytics.SNAPSHOT_SHARE:
+            return ("CREATE SNAPSHOT;", {}, "snapshot")
+        sample -= OltpAnalytics.SNAPSHOT_SHARE
+        if sample < OltpAnalytics.GC_SHARE:
+            return ("FREE MEMORY;", {}, "gc")
+        sample -= OltpAnalytics.GC_SHARE
+        if sample < OltpAnalytics.AGGREGATION_SHARE:
+            return (
+                "MATCH (u:User)-[:FOLLOWS]->(f:User) RETURN u.age AS age, count(f) AS follows, avg(f.score) AS score;",
+                {},
+                "aggregation",
+            )
+
+        short = random.choice(["point_lookup", "upsert", "traversal"])
+        if short == "point_lookup":
+            return ("MATCH (u:User {id: $id}) RETURN u;", {"id": self._random_id()}, short)
+        if short == "upsert":
+            return (
+                "MERGE (u:User {id: $id}) ON CREATE SET u.score = 0 ON MATCH SET u.score = u.score + 1;",
+                {"id": self._random_id() + random.randrange(2) * OltpAnalytics.CARDINALITY},
+                short,
+            )
+        return (
+            "MATCH (u:User {id: $id})-[:FOLLOWS*2..3]->(f:User) RETURN count(DISTINCT f);",
+            {"id": self._random_id()},
+            short,
+        )
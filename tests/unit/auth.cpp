@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 
 #include "auth/auth.hpp"
+#include "auth/credential_cache.hpp"
 #include "auth/crypto.hpp"
 #include "auth/models.hpp"
 #include "glue/auth_global.hpp"
@@ -115,6 +116,39 @@ TEST_F(AuthWithStorage, Authenticate) {
   ASSERT_EQ(auth->Authenticate("nonexistant", "123"), std::nullopt);
 }
 
+TEST(AuthWithoutStorage, CredentialCache) {
+  using namespace std::chrono_literals;
+  CredentialCache cache{2, 10s};
+  const auto now = CredentialCache::Clock::now();
+
+  ASSERT_FALSE(cache.Contains("test", "123", "hash", now));
+  cache.Insert("test", "123", "hash", now);
+  ASSERT_TRUE(cache.Contains("test", "123", "hash", now + 5s));
+  ASSERT_FALSE(cache.Contains("test", "456", "hash", now + 5s));
+  ASSERT_FALSE(cache.Contains("test", "123", "changed_hash", now + 5s));
+  ASSERT_FALSE(cache.Contains("other", "123", "hash", now + 5s));
+
+  // Expired
+  ASSERT_FALSE(cache.Contains("test", "123", "hash", now + 10s));
+  ASSERT_EQ(cache.Size(), 0);
+
+  // The oldest entry is evicted when the cache is full
+  cache.Insert("a", "1", "hash", now);
+  cache.Insert("b", "2", "hash", now + 1s);
+  cache.Insert("c", "3", "hash", now + 2s);
+  ASSERT_EQ(cache.Size(), 2);
+  ASSERT_FALSE(cache.Contains("a", "1", "hash", now + 3s));
+  ASSERT_TRUE(cache.Contains("b", "2", "hash", now + 3s));
+  ASSERT_TRUE(cache.Contains("c", "3", "hash", now + 3s));
+
+  cache.Clear();
+  ASSERT_FALSE(cache.Contains("c", "3", "hash", now + 3s));
+
+  CredentialCache disabled{0, 10s};
+  disabled.Insert("test", "123", "hash", now);
+  ASSERT_FALSE(disabled.Contains("test", "123", "hash", now));
+}
+
 TEST_F(AuthWithStorage, UserRolePermissions) {
   ASSERT_FALSE(auth->HasUsers());
   ASSERT_TRUE(auth->AddUser("test"));
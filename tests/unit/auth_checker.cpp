@@ -197,6 +197,30 @@ TYPED_TEST(FineGrainedAuthCheckerFixture, MultipleVertexLabels) {
       auth_checker.Has(this->v2, memgraph::storage::View::OLD, memgraph::query::AuthQuery::FineGrainedPrivilege::READ));
 }
 
+TYPED_TEST(FineGrainedAuthCheckerFixture, RepeatedChecksOfLabels) {
+  memgraph::auth::User user{"test"};
+  user.fine_grained_access_handler().label_permissions().Grant("l1", memgraph::auth::FineGrainedPermission::READ);
+  user.fine_grained_access_handler().label_permissions().Grant("*", memgraph::auth::FineGrainedPermission::UPDATE);
+  memgraph::glue::FineGrainedAuthChecker auth_checker{user, &this->dba};
+
+  for (auto i = 0; i < 2; ++i) {
+    ASSERT_TRUE(auth_checker.Has(this->v1, memgraph::storage::View::NEW,
+                                 memgraph::query::AuthQuery::FineGrainedPrivilege::READ));
+    ASSERT_FALSE(auth_checker.Has(this->v1, memgraph::storage::View::NEW,
+                                  memgraph::query::AuthQuery::FineGrainedPrivilege::UPDATE));
+    ASSERT_TRUE(auth_checker.Has(this->v2, memgraph::storage::View::NEW,
+                                 memgraph::query::AuthQuery::FineGrainedPrivilege::UPDATE));
+    ASSERT_FALSE(auth_checker.Has(this->v2, memgraph::storage::View::NEW,
+                                  memgraph::query::AuthQuery::FineGrainedPrivilege::CREATE_DELETE));
+  }
+
+  // Labels created after the checker are resolved as well
+  ASSERT_TRUE(auth_checker.Has(std::vector{this->dba.NameToLabel("l4")},
+                               memgraph::query::AuthQuery::FineGrainedPrivilege::UPDATE));
+  ASSERT_FALSE(auth_checker.Has(std::vector{this->dba.NameToLabel("l1"), this->dba.NameToLabel("l4")},
+                                memgraph::query::AuthQuery::FineGrainedPrivilege::UPDATE));
+}
+
 TYPED_TEST(FineGrainedAuthCheckerFixture, GrantEdgeType) {
   memgraph::auth::User user{"test"};
   user.fine_grained_access_handler().edge_type_permissions().Grant(
@@ -175,3 +175,87 @@ INSTANTIATE_TEST_SUITE_P(FilterLambda, SingleNodeBfsTestOnDisk,
                                           testing::Values(FilterLambdaType::NONE, FilterLambdaType::USE_FRAME,
                                                           FilterLambdaType::USE_FRAME_NULL, FilterLambdaType::USE_CTX,
                                                           FilterLambdaType::ERROR)));
+
+// Levels with many vertices are expanded on worker threads, top-down while they
+// are small compared to the vertices not visited yet and bottom-up once they
+// aren't. The paths are as short as the ones found on a single thread.
+class SingleNodeBfsParallel : public ::testing::Test {
+ protected:
+  memgraph::query::AstStorage storage;
+};
+
+TEST_F(SingleNodeBfsParallel, LevelsExpandedOnWorkers) {
+  memgraph::storage::Config config;
+  auto db = std::make_unique<memgraph::storage::InMemoryStorage>(config);
+  auto storage_dba = db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  // Each child of the source starts a chain, and each vertex of a chain also
+  // points to the next vertex of the neighbouring chain, so most vertices can
+  // be reached from two parents on the previous level.
+  constexpr int kWidth = 2000;
+  constexpr int kDepth = 4;
+  const auto edge_type = dba.NameToEdgeType("edge");
+  auto source = dba.InsertVertex();
+  std::vector<std::vector<memgraph::query::VertexAccessor>> chains(kWidth);
+  for (auto &chain : chains) {
+    chain.push_back(dba.InsertVertex());
+    ASSERT_TRUE(dba.InsertEdge(&source, &chain.back(), edge_type).HasValue());
+  }
+  for (int depth = 1; depth < kDepth; ++depth) {
+    for (auto &chain : chains) chain.push_back(dba.InsertVertex());
+    for (int i = 0; i < kWidth; ++i) {
+      ASSERT_TRUE(dba.InsertEdge(&chains[i][depth - 1], &chains[i][depth], edge_type).HasValue());
+      ASSERT_TRUE(dba.InsertEdge(&chains[i][depth - 1], &chains[(i + 1) % kWidth][depth], edge_type).HasValue());
+    }
+  }
+  // Unreachable vertices, which keep the first levels top-down.
+  for (int i = 0; i < 12 * kWidth; ++i) dba.InsertVertex();
+  // The last vertex of the first chain can't be expanded to.
+  auto blocked_vertex = chains[0].back();
+  dba.AdvanceCommand();
+
+  memgraph::query::ExecutionContext context{.db_accessor = &dba};
+  auto blocked_sym = context.symbol_table.CreateSymbol("blocked", true);
+  auto source_sym = context.symbol_table.CreateSymbol("source", true);
+  auto sink_sym = context.symbol_table.CreateSymbol("sink", true);
+  auto edges_sym = context.symbol_table.CreateSymbol("edges", true);
+  auto inner_node_sym = context.symbol_table.CreateSymbol("inner_node", true);
+  auto inner_edge_sym = context.symbol_table.CreateSymbol("inner_edge", true);
+  auto *blocked = IDENT("blocked")->MapTo(blocked_sym);
+  auto *inner_node = IDENT("inner_node")->MapTo(inner_node_sym);
+
+  std::shared_ptr<LogicalOperator> input_op = std::make_shared<Yield>(
+      nullptr, std::vector<memgraph::query::Symbol>{blocked_sym},
+      std::vector<std::vector<memgraph::query::TypedValue>>{{memgraph::query::TypedValue(blocked_vertex)}});
+  input_op = YieldVertices(&dba, {source}, source_sym, input_op);
+
+  for (auto direction : {EdgeAtom::Direction::OUT, EdgeAtom::Direction::BOTH}) {
+    SCOPED_TRACE(fmt::format("direction = {}", static_cast<int>(direction)));
+    ExpandVariable bfs(input_op, source_sym, sink_sym, edges_sym, EdgeAtom::Type::BREADTH_FIRST, direction, {}, false,
+                       nullptr, nullptr, false, ExpansionLambda{inner_edge_sym, inner_node_sym, NEQ(inner_node, blocked)},
+                       std::nullopt, std::nullopt);
+
+    auto path_lengths = [&](uint64_t num_workers) {
+      bfs.num_workers_ = num_workers;
+      std::map<memgraph::storage::Gid, size_t> lengths;
+      for (const auto &row : PullResults(&bfs, &context, {sink_sym, edges_sym})) {
+        const auto &edges = row[1].ValueList();
+        auto vertex = source;
+        for (const auto &edge : edges) {
+          const auto &edge_accessor = edge.ValueEdge();
+          EXPECT_TRUE(edge_accessor.From() == vertex);
+          vertex = edge_accessor.To();
+        }
+        EXPECT_TRUE(vertex == row[0].ValueVertex());
+        EXPECT_TRUE(lengths.emplace(vertex.Gid(), edges.size()).second);
+      }
+      return lengths;
+    };
+
+    auto sequential = path_lengths(0);
+    EXPECT_EQ(sequential.size(), kWidth * kDepth - 1);
+    EXPECT_EQ(path_lengths(4), sequential);
+  }
+  dba.Abort();
+}
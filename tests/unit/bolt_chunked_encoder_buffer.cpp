@@ -109,3 +109,41 @@ TEST_F(BoltChunkedEncoderBuffer, OneAndAHalfOfMaxChunk) {
   VerifyChunkOfTestData(output, kChunkMaxDataSize);
   VerifyChunkOfTestData(output + kChunkWholeSize, kTestDataSize - kChunkMaxDataSize, kChunkMaxDataSize);
 }
+
+TEST_F(BoltChunkedEncoderBuffer, CoalescesMessagesWhileMoreFollow) {
+  int size = 100;
+
+  // initialize tested buffer
+  TestOutputStream output_stream;
+  BufferT buffer(output_stream);
+
+  // write two messages which are followed by more data
+  for (auto i = 0; i < 2; ++i) {
+    buffer.Write(test_data + i * size, size);
+    buffer.Flush(true);
+    buffer.Flush(true);
+  }
+  EXPECT_TRUE(output_stream.output.empty());
+  EXPECT_FALSE(buffer.HasData());
+
+  // clearing drops only the unfinished message
+  buffer.Write(test_data, size);
+  EXPECT_TRUE(buffer.HasData());
+  buffer.Clear();
+  EXPECT_FALSE(buffer.HasData());
+
+  buffer.Flush();
+
+  // check the output array
+  // the output array should look like this:
+  // [0, 100, first 100 bytes of test data, 0, 0] +
+  // [0, 100, second 100 bytes of test data, 0, 0] +
+  // [0, 0]
+  auto *data = output_stream.output.data();
+  ASSERT_EQ(output_stream.output.size(), 3 * kChunkHeaderSize + 2 * (kChunkHeaderSize + size));
+  VerifyChunkOfTestData(data, size);
+  VerifyChunkOfTestData(data + kChunkHeaderSize + size, 0);
+  VerifyChunkOfTestData(data + 2 * kChunkHeaderSize + size, size, size);
+  VerifyChunkOfTestData(data + 3 * kChunkHeaderSize + 2 * size, 0);
+  VerifyChunkOfTestData(data + 4 * kChunkHeaderSize + 2 * size, 0);
+}
@@ -857,3 +857,41 @@ TEST_F(BoltDecoder, Point3d) {
   std::invoke(run_test, point_wgs);
   std::invoke(run_test, point_cartesian);
 }
+
+TEST_F(BoltDecoder, PropertyMap) {
+  using memgraph::storage::PropertyValue;
+  TestDecoderBuffer buffer;
+  DecoderT decoder(buffer);
+  PropertyValue::map_t map;
+
+  // test not a map
+  buffer.Clear();
+  buffer.Write((const uint8_t *)"\x91\x01", 2);
+  ASSERT_EQ(decoder.ReadPropertyMap(&map), false);
+
+  // test elements with same key
+  buffer.Clear();
+  buffer.Write((const uint8_t *)"\xA2\x81\x61\x01\x81\x61\x02", 7);
+  ASSERT_EQ(decoder.ReadPropertyMap(&map), false);
+
+  // test a vertex, which isn't a property value
+  buffer.Clear();
+  buffer.Write((const uint8_t *)"\xA1\x81\x61\xB3\x4E\x00\x90\xA0", 8);
+  ASSERT_EQ(decoder.ReadPropertyMap(&map), false);
+
+  // test all ok, {b: [1, "x"], a: {c: null}, d: date}
+  buffer.Clear();
+  buffer.Write((const uint8_t *)"\xA3\x81\x62\x92\x01\x81\x78\x81\x61\xA1\x81\x63\xC0\x81\x64\xB1\x44\x05", 18);
+  ASSERT_EQ(decoder.ReadPropertyMap(&map), true);
+  ASSERT_EQ(map.size(), 3);
+  ASSERT_EQ(map.begin()->first, "a");
+  ASSERT_TRUE(map.at("a").IsMap());
+  ASSERT_TRUE(map.at("a").ValueMap().at("c").IsNull());
+  ASSERT_TRUE(map.at("b").IsList());
+  ASSERT_EQ(map.at("b").ValueList().size(), 2);
+  EXPECT_EQ(map.at("b").ValueList()[0].ValueInt(), 1);
+  EXPECT_EQ(map.at("b").ValueList()[1].ValueString(), "x");
+  ASSERT_TRUE(map.at("d").IsTemporalData());
+  EXPECT_EQ(map.at("d").ValueTemporalData().type, memgraph::storage::TemporalType::Date);
+  EXPECT_EQ(map.at("d").ValueTemporalData().microseconds, memgraph::utils::Date({1970, 1, 6}).MicrosecondsSinceEpoch());
+}
@@ -242,6 +242,55 @@ TEST_F(BoltEncoder, VertexAndEdgeOnDiskStorage) {
   disk_test_utils::RemoveRocksDbDirs(testSuite);
 }
 
+TEST_F(BoltEncoder, TypedValueRecordMatchesValueRecord) {
+  std::unique_ptr<memgraph::storage::Storage> db{new memgraph::storage::InMemoryStorage()};
+  auto dba = db->Access();
+  auto va1 = dba->CreateVertex();
+  auto va2 = dba->CreateVertex();
+  ASSERT_TRUE(va1.AddLabel(dba->NameToLabel("label")).HasValue());
+  ASSERT_TRUE(va1.SetProperty(dba->NameToProperty("name"), memgraph::storage::PropertyValue("one")).HasValue());
+  auto ea = dba->CreateEdge(&va1, &va2, dba->NameToEdgeType("edgetype")).GetValue();
+  ASSERT_TRUE(ea.SetProperty(dba->NameToProperty("list"),
+                             memgraph::storage::PropertyValue(std::vector<memgraph::storage::PropertyValue>{
+                                 memgraph::storage::PropertyValue(1), memgraph::storage::PropertyValue(2.5)}))
+                  .HasValue());
+
+  const auto vertex1 = memgraph::query::VertexAccessor(va1);
+  const auto vertex2 = memgraph::query::VertexAccessor(va2);
+  const auto edge = memgraph::query::EdgeAccessor(ea);
+  std::vector<memgraph::query::TypedValue> values;
+  values.emplace_back();
+  values.emplace_back(true);
+  values.emplace_back(-200);
+  values.emplace_back("string");
+  values.emplace_back(std::vector<memgraph::query::TypedValue>{memgraph::query::TypedValue(1),
+                                                               memgraph::query::TypedValue(vertex2)});
+  values.emplace_back(std::map<std::string, memgraph::query::TypedValue>{{"a", memgraph::query::TypedValue(3.5)},
+                                                                         {"b", memgraph::query::TypedValue(edge)}});
+  values.emplace_back(vertex1);
+  values.emplace_back(edge);
+  values.emplace_back(memgraph::query::Path(vertex1, edge, vertex2));
+
+  for (const auto major_v : {1, 5}) {
+    std::vector<Value> bolt_values;
+    for (const auto &value : values) {
+      bolt_values.push_back(*memgraph::glue::ToBoltValue(value, db.get(), memgraph::storage::View::NEW));
+    }
+    bolt_encoder.UpdateVersion(major_v);
+    bolt_encoder.MessageRecord(bolt_values);
+    const auto expected = output;
+    output.clear();
+
+    memgraph::glue::TypedValueRecordEncoder record_encoder(db.get(), memgraph::storage::View::NEW);
+    record_encoder.UpdateVersion(major_v);
+    ASSERT_FALSE(record_encoder.Encode(values).HasError());
+    bolt_encoder.MessageRecord(values.size(), record_encoder.Bytes());
+    EXPECT_EQ(output, expected);
+    output.clear();
+  }
+  bolt_encoder.UpdateVersion(0);
+}
+
 TEST_F(BoltEncoder, BoltV1ExampleMessages) {
   // this test checks example messages from: http://boltprotocol.org/v1/
 
@@ -43,7 +43,8 @@ class TestSession final : public Session<TestInputStream, TestOutputStream> {
 
   TestSession(TestSessionContext *data, TestInputStream *input_stream, TestOutputStream *output_stream)
       : Session<TestInputStream, TestOutputStream>(input_stream, output_stream) {}
-  std::pair<std::vector<std::string>, std::optional<int>> Interpret(const std::string &query, const bolt_map_t &params,
+  std::pair<std::vector<std::string>, std::optional<int>> Interpret(const std::string &query,
+                                                                    memgraph::storage::PropertyValue::map_t params,
                                                                     const bolt_map_t &extra) override {
     if (extra.contains("tx_metadata")) {
       auto const &metadata = extra.at("tx_metadata").ValueMap();
@@ -105,7 +106,10 @@ class TestSession final : public Session<TestInputStream, TestOutputStream> {
       if (!metadata.empty()) md_ = metadata;
     }
   }
-  void CommitTransaction() override { md_.clear(); }
+  bolt_map_t CommitTransaction() override {
+    md_.clear();
+    return {};
+  }
   void RollbackTransaction() override { md_.clear(); }
 
   void Abort() override { md_.clear(); }
@@ -904,6 +908,37 @@ TEST(BoltSession, MultipleChunksInOneExecute) {
   ASSERT_EQ(num, 3);
 }
 
+TEST(BoltSession, PipelinedMessagesInOneWrite) {
+  INIT_VARS;
+
+  ExecuteHandshake(input_stream, session, output);
+  ExecuteInit(input_stream, session, output);
+
+  // Two RUN and PULL_ALL pairs which arrive in a single read.
+  for (auto i = 0; i < 2; ++i) {
+    WriteRunRequest(input_stream, kQueryReturn42);
+    WriteChunkHeader(input_stream, sizeof(pullall_req));
+    input_stream.Write(pullall_req, sizeof(pullall_req));
+    WriteChunkTail(input_stream);
+  }
+  output_stream.writes = 0;
+  session.Execute();
+
+  ASSERT_EQ(session.state_, State::Idle);
+  ASSERT_EQ(output_stream.writes, 1);
+
+  // Count chunks in output
+  int len, num = 0;
+  while (output.size() > 0) {
+    len = (output[0] << 8) + output[1];
+    output.erase(output.begin(), output.begin() + len + 4);
+    ++num;
+  }
+
+  // a success, a record and a success message for each query
+  ASSERT_EQ(num, 6);
+}
+
 TEST(BoltSession, PartialPull) {
   INIT_VARS;
 
@@ -0,0 +1,133 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#include "utils/clock_cache.hpp"
+
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+TEST(ClockCacheTest, BasicTest) {
+  memgraph::utils::ClockCache<int, int> cache(2, 1);
+  cache.put(1, 1);
+  cache.put(2, 2);
+
+  std::optional<int> value;
+  value = cache.get(1);
+  EXPECT_TRUE(value.has_value());
+  EXPECT_EQ(value.value(), 1);
+
+  // The hand passes the referenced entry 1 and evicts 2.
+  cache.put(3, 3);
+
+  value = cache.get(2);
+  EXPECT_FALSE(value.has_value());
+
+  // Entry 1 lost its mark in the previous sweep.
+  cache.put(4, 4);
+
+  value = cache.get(1);
+  EXPECT_FALSE(value.has_value());
+
+  value = cache.get(3);
+  EXPECT_TRUE(value.has_value());
+  EXPECT_EQ(value.value(), 3);
+
+  value = cache.get(4);
+  EXPECT_TRUE(value.has_value());
+  EXPECT_EQ(value.value(), 4);
+
+  EXPECT_EQ(cache.size(), 2);
+}
+
+TEST(ClockCacheTest, DuplicatePutTest) {
+  memgraph::utils::ClockCache<int, int> cache(2, 1);
+  cache.put(1, 1);
+  cache.put(2, 2);
+  cache.put(1, 10);
+
+  std::optional<int> value;
+  value = cache.get(1);
+  EXPECT_TRUE(value.has_value());
+  EXPECT_EQ(value.value(), 10);
+
+  value = cache.get(2);
+  EXPECT_TRUE(value.has_value());
+  EXPECT_EQ(value.value(), 2);
+
+  EXPECT_EQ(cache.size(), 2);
+}
+
+TEST(ClockCacheTest, ResetTest) {
+  memgraph::utils::ClockCache<int, int> cache(4);
+  for (int i = 0; i < 4; ++i) cache.put(i, i);
+  cache.reset();
+  EXPECT_EQ(cache.size(), 0);
+  EXPECT_FALSE(cache.get(0).has_value());
+
+  cache.put(5, 5);
+  EXPECT_EQ(cache.get(5), 5);
+}
+
+TEST(ClockCacheTest, GenerationTest) {
+  memgraph::utils::ClockCache<int, int> cache(10);
+  cache.put(1, 1);
+  EXPECT_EQ(cache.generation(), 0);
+  cache.put(2, 2);
+  EXPECT_EQ(cache.generation(), 0);
+  cache.reset();
+  EXPECT_EQ(cache.generation(), 1);
+  cache.reset();
+  EXPECT_EQ(cache.generation(), 2);
+}
+
+TEST(ClockCacheTest, ZeroCapacityTest) {
+  memgraph::utils::ClockCache<int, int> cache(0);
+  cache.put(1, 1);
+  EXPECT_FALSE(cache.get(1).has_value());
+  EXPECT_EQ(cache.size(), 0);
+}
+
+TEST(ClockCacheTest, BoundedSizeTest) {
+  constexpr size_t kCapacity = 100;
+  memgraph::utils::ClockCache<int, int> cache(kCapacity);
+  for (int i = 0; i < 1000; ++i) {
+    cache.put(i, i);
+    EXPECT_LE(cache.size(), kCapacity);
+  }
+}
+
+TEST(ClockCacheTest, ConcurrentAccessTest) {
+  constexpr int kThreads = 8;
+  constexpr int kKeys = 1000;
+  memgraph::utils::ClockCache<int, int> cache(kKeys / 4);
+
+  std::vector<std::jthread> threads;
+  threads.reserve(kThreads);
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&cache, t] {
+      for (int i = 0; i < kKeys; ++i) {
+        const auto key = (i * (t + 1)) % kKeys;
+        if (auto value = cache.get(key)) {
+          EXPECT_EQ(*value, key);
+        } else {
+          cache.put(key, key);
+        }
+      }
+    });
+  }
+  threads.clear();
+
+  EXPECT_LE(cache.size(), cache.capacity());
+}
@@ -11,14 +11,24 @@
 
 #include "storage/v2/commit_log.hpp"
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 namespace {
 inline constexpr size_t ids_per_block = 8192 * 64;
 }  // namespace
 
-TEST(CommitLog, Simple) {
-  memgraph::storage::CommitLog log;
+template <typename Log>
+class CommitLog : public ::testing::Test {};
+
+using CommitLogTypes = ::testing::Types<memgraph::storage::CommitLog, memgraph::storage::LockingCommitLog>;
+TYPED_TEST_SUITE(CommitLog, CommitLogTypes);
+
+TYPED_TEST(CommitLog, Simple) {
+  TypeParam log;
   EXPECT_EQ(log.OldestActive(), 0);
 
   log.MarkFinished(1);
@@ -28,8 +38,8 @@ TEST(CommitLog, Simple) {
   EXPECT_EQ(log.OldestActive(), 2);
 }
 
-TEST(CommitLog, Fields) {
-  memgraph::storage::CommitLog log;
+TYPED_TEST(CommitLog, Fields) {
+  TypeParam log;
 
   for (uint64_t i = 0; i < 64; ++i) {
     log.MarkFinished(i);
@@ -47,8 +57,8 @@ TEST(CommitLog, Fields) {
   }
 }
 
-TEST(CommitLog, Blocks) {
-  memgraph::storage::CommitLog log;
+TYPED_TEST(CommitLog, Blocks) {
+  TypeParam log;
 
   for (uint64_t i = 0; i < ids_per_block; ++i) {
     log.MarkFinished(i);
@@ -66,7 +76,7 @@ TEST(CommitLog, Blocks) {
   }
 }
 
-TEST(CommitLog, TrackAfterInitialId) {
+TYPED_TEST(CommitLog, TrackAfterInitialId) {
   const auto check_marking_ids = [](auto *log, auto current_oldest_active) {
     ASSERT_EQ(log->OldestActive(), current_oldest_active);
     log->MarkFinished(current_oldest_active);
@@ -75,7 +85,32 @@ TEST(CommitLog, TrackAfterInitialId) {
   };
 
   for (uint64_t i = 0; i < 2 * ids_per_block; ++i) {
-    memgraph::storage::CommitLog log{i};
+    TypeParam log{i};
     check_marking_ids(&log, i);
   }
 }
+
+TYPED_TEST(CommitLog, Concurrent) {
+  constexpr uint64_t kThreads = 8;
+  constexpr uint64_t kIds = 3 * ids_per_block;
+  TypeParam log;
+  std::atomic<uint64_t> next_id{0};
+
+  std::vector<std::jthread> threads;
+  threads.reserve(kThreads);
+  for (uint64_t i = 0; i < kThreads; ++i) {
+    threads.emplace_back([&] {
+      uint64_t last_oldest = 0;
+      for (auto id = next_id.fetch_add(1); id < kIds; id = next_id.fetch_add(1)) {
+        log.MarkFinished(id);
+        const auto oldest = log.OldestActive();
+        // The oldest active id never moves backwards
+        EXPECT_GE(oldest, last_oldest);
+        last_oldest = oldest;
+      }
+    });
+  }
+  threads.clear();
+
+  EXPECT_EQ(log.OldestActive(), kIds);
+}
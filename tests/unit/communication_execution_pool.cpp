@@ -0,0 +1,64 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+
+#include "communication/v2/pool.hpp"
+#include "utils/blocking_section.hpp"
+
+using memgraph::communication::v2::ExecutionThreadPool;
+using namespace std::chrono_literals;
+
+TEST(ExecutionThreadPool, RunsOtherTasksWhileOneIsBlocked) {
+  ExecutionThreadPool pool{1, 1s};
+  pool.Run();
+
+  std::promise<void> unblock;
+  auto unblocked = unblock.get_future().share();
+  std::promise<void> other_ran;
+  pool.Submit(
+      [unblocked] {
+        memgraph::utils::BlockingSection const blocked;
+        unblocked.wait();
+      },
+      false);
+  pool.Submit([&] { other_ran.set_value(); }, false);
+
+  ASSERT_EQ(other_ran.get_future().wait_for(10s), std::future_status::ready);
+  unblock.set_value();
+}
+
+TEST(ExecutionThreadPool, LimitsRunningTasks) {
+  ExecutionThreadPool pool{1, 1s};
+  pool.Run();
+
+  std::promise<void> finish;
+  auto finished = finish.get_future().share();
+  std::promise<void> first_started;
+  std::atomic<bool> second_started{false};
+  pool.Submit(
+      [&, finished] {
+        first_started.set_value();
+        finished.wait();
+      },
+      false);
+  pool.Submit([&] { second_started.store(true); }, false);
+
+  // Not waiting in a blocking section, so the other task has to wait.
+  first_started.get_future().wait();
+  std::this_thread::sleep_for(100ms);
+  ASSERT_FALSE(second_started.load());
+  finish.set_value();
+}
@@ -0,0 +1,79 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#include <chrono>
+
+#include <gtest/gtest.h>
+#include "coordination/failure_detector.hpp"
+
+using memgraph::coordination::PhiAccrualFailureDetector;
+using namespace std::chrono_literals;
+
+TEST(PhiAccrualFailureDetector, NoSuspicionWithoutHistory) {
+  PhiAccrualFailureDetector detector{8.0, 0ms};
+  auto const start = PhiAccrualFailureDetector::Clock::now();
+  ASSERT_EQ(detector.Phi(start), 0.0);
+  detector.Heartbeat(start);
+  // A single heartbeat gives no interval to learn from.
+  ASSERT_EQ(detector.Phi(start + 1h), 0.0);
+  ASSERT_TRUE(detector.IsAvailable(start + 1h));
+}
+
+TEST(PhiAccrualFailureDetector, SuspicionGrowsWithSilence) {
+  PhiAccrualFailureDetector detector{8.0, 0ms};
+  auto now = PhiAccrualFailureDetector::Clock::now();
+  for (auto i = 0; i < 20; ++i) {
+    detector.Heartbeat(now);
+    now += 1000ms;
+  }
+  now -= 1000ms;
+
+  // The next heartbeat is expected after a second.
+  ASSERT_LT(detector.Phi(now + 500ms), 0.5);
+  ASSERT_TRUE(detector.IsAvailable(now + 1000ms));
+  ASSERT_LT(detector.Phi(now + 1100ms), detector.Phi(now + 1300ms));
+  ASSERT_FALSE(detector.IsAvailable(now + 2000ms));
+}
+
+TEST(PhiAccrualFailureDetector, AcceptablePauseDelaysSuspicion) {
+  PhiAccrualFailureDetector strict{8.0, 0ms};
+  PhiAccrualFailureDetector tolerant{8.0, 1000ms};
+  auto now = PhiAccrualFailureDetector::Clock::now();
+  for (auto i = 0; i < 20; ++i) {
+    strict.Heartbeat(now);
+    tolerant.Heartbeat(now);
+    now += 1000ms;
+  }
+  now -= 1000ms;
+
+  ASSERT_FALSE(strict.IsAvailable(now + 2000ms));
+  ASSERT_TRUE(tolerant.IsAvailable(now + 2000ms));
+  ASSERT_FALSE(tolerant.IsAvailable(now + 3000ms));
+}
+
+TEST(PhiAccrualFailureDetector, JitteryHeartbeatsWidenTheEstimate) {
+  PhiAccrualFailureDetector steady{8.0, 0ms};
+  PhiAccrualFailureDetector jittery{8.0, 0ms};
+  auto steady_now = PhiAccrualFailureDetector::Clock::now();
+  auto jittery_now = steady_now;
+  for (auto i = 0; i < 20; ++i) {
+    steady.Heartbeat(steady_now);
+    jittery.Heartbeat(jittery_now);
+    steady_now += 1000ms;
+    jittery_now += (i % 2 == 0) ? 500ms : 1500ms;
+  }
+  steady_now -= 1000ms;
+  jittery_now -= 1500ms;
+
+  ASSERT_GT(steady.Phi(steady_now + 1800ms), jittery.Phi(jittery_now + 1800ms));
+  ASSERT_TRUE(jittery.IsAvailable(jittery_now + 1800ms));
+}
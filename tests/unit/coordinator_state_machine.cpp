@@ -235,6 +235,77 @@ TEST_P(CoordinatorStateMachineTestParam, SerializeDeserializeSnapshot) {
   }
 }
 
+TEST_F(CoordinatorStateMachineTest, ClusterStateVersionChangesOnCommit) {
+  using memgraph::coordination::Logger;
+  using memgraph::coordination::LoggerWrapper;
+
+  Logger logger("");
+  LoggerWrapper my_logger(&logger);
+  CoordinatorStateMachine state_machine{my_logger, std::nullopt};
+  auto const initial_version = state_machine.ClusterStateVersion();
+
+  auto config = CoordinatorToReplicaConfig{
+      .instance_name = "instance1",
+      .mgt_server = Endpoint{"127.0.0.1", mgt_port},
+      .bolt_server = Endpoint{"127.0.0.1", bolt_port},
+      .replication_client_info = {.instance_name = "instance1",
+                                  .replication_mode = ReplicationMode::ASYNC,
+                                  .replication_server = Endpoint{"127.0.0.1", replication_port}},
+      .instance_health_check_frequency_sec = std::chrono::seconds{1},
+      .instance_down_timeout_sec = std::chrono::seconds{5},
+      .instance_get_uuid_frequency_sec = std::chrono::seconds{10},
+      .ssl = std::nullopt};
+  auto register_log = CoordinatorStateMachine::SerializeRegisterInstance(config);
+  state_machine.commit(1, *register_log);
+  auto const registered_version = state_machine.ClusterStateVersion();
+  ASSERT_NE(registered_version, initial_version);
+  ASSERT_EQ(state_machine.GetReplicationInstances().size(), 1);
+
+  auto main_log = CoordinatorStateMachine::SerializeSetInstanceAsMain(
+      InstanceUUIDUpdate{.instance_name = "instance1", .uuid = memgraph::utils::UUID{}});
+  state_machine.commit(2, *main_log);
+  ASSERT_NE(state_machine.ClusterStateVersion(), registered_version);
+  ASSERT_TRUE(state_machine.HasMainState("instance1"));
+}
+
+TEST_F(CoordinatorStateMachineTest, OutdatedSnapshotsDeletedFromDisk) {
+  using memgraph::coordination::Logger;
+  using memgraph::coordination::LoggerWrapper;
+
+  Logger logger("");
+  LoggerWrapper my_logger(&logger);
+  auto const path = test_folder_ / "outdated_snapshots" / "state_machine";
+  auto const count_stored_snapshots = [](memgraph::kvstore::KVStore &kv_store) {
+    auto const prefix = std::string{memgraph::coordination::kSnapshotIdPrefix};
+    auto stored_snapshots = 0;
+    auto const end_iter = kv_store.end(prefix);
+    for (auto it = kv_store.begin(prefix); it != end_iter; ++it) ++stored_snapshots;
+    return stored_snapshots;
+  };
+  {
+    auto kv_store = std::make_shared<memgraph::kvstore::KVStore>(path);
+    memgraph::coordination::LogStoreDurability log_store_durability{kv_store,
+                                                                    memgraph::coordination::kActiveVersion};
+    CoordinatorStateMachine state_machine{my_logger, log_store_durability};
+    nuraft::async_result<bool>::handler_type handler = [](auto &e, auto &t) {};
+    for (uint64_t idx = 1; idx <= 5; ++idx) {
+      auto nuraft_snapshot = cs_new<snapshot>(idx, 1, cs_new<cluster_config>(), 1);
+      state_machine.create_snapshot(*nuraft_snapshot, handler);
+    }
+    ASSERT_EQ(state_machine.last_snapshot()->get_last_log_idx(), 5);
+    ASSERT_EQ(count_stored_snapshots(*kv_store), 3);
+  }
+
+  {
+    auto kv_store = std::make_shared<memgraph::kvstore::KVStore>(path);
+    memgraph::coordination::LogStoreDurability log_store_durability{kv_store,
+                                                                    memgraph::coordination::kActiveVersion};
+    CoordinatorStateMachine state_machine{my_logger, log_store_durability};
+    ASSERT_EQ(state_machine.last_snapshot()->get_last_log_idx(), 5);
+    ASSERT_EQ(count_stored_snapshots(*kv_store), 3);
+  }
+}
+
 INSTANTIATE_TEST_SUITE_P(ParameterizedLogStoreVersionTests, CoordinatorStateMachineTestParam,
                          ::testing::Values(memgraph::coordination::LogStoreVersion::kV1,
                                            memgraph::coordination::LogStoreVersion::kV2),
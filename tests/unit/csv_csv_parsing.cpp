@@ -17,6 +17,7 @@
 #include <boost/iostreams/filter/bzip2.hpp>
 #include <boost/iostreams/filter/gzip.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
+#include <fmt/format.h>
 
 using namespace memgraph::csv;
 
@@ -367,6 +368,84 @@ TEST_P(CsvReaderTest, EmptyColumns) {
   }
 }
 
+TEST_P(CsvReaderTest, ParallelWorkersReturnRowsInOrder) {
+  // The file spans several chunks of the parallel parser, so their boundaries
+  // fall into the middle of rows and of quoted fields with line feeds.
+  const auto filepath = csv_directory / "bla.csv";
+  auto writer = FileWriter(filepath, GetParam().newline, GetParam().compressionMethod);
+
+  memgraph::utils::MemoryResource *mem(memgraph::utils::NewDeleteResource());
+
+  const memgraph::utils::pmr::string delimiter{",", mem};
+  const memgraph::utils::pmr::string quote{"\"", mem};
+
+  writer.WriteLine(CreateRow({"id", "text", "padding"}, delimiter));
+  constexpr auto kRows = 200'000;
+  for (auto i = 0; i < kRows; ++i) {
+    if (i % 1000 == 1) {
+      // a bad row, which is skipped
+      writer.WriteLine(CreateRow({"bad", "\"unclosed\"x", "row"}, delimiter));
+    }
+    auto text = i % 1000 == 0 ? fmt::format("\"multiline{}{}text\"", GetParam().newline, i)
+                              : fmt::format("\"a, {}\"", i);
+    writer.WriteLine(CreateRow({std::to_string(i), text, std::string(40, 'p')}, delimiter));
+  }
+  writer.Close();
+
+  const bool with_header = true;
+  const bool ignore_bad = true;
+  Reader::Config sequential_cfg{with_header, ignore_bad, delimiter, quote};
+  Reader::Config parallel_cfg{with_header, ignore_bad, delimiter, quote};
+  parallel_cfg.parallel_workers = 4;
+  auto sequential_reader = Reader(FileCsvSource{filepath}, sequential_cfg, mem);
+  auto parallel_reader = Reader(FileCsvSource{filepath}, parallel_cfg, mem);
+  ASSERT_EQ(parallel_reader.GetHeader(), sequential_reader.GetHeader());
+
+  auto rows = 0;
+  while (auto expected_row = sequential_reader.GetNextRow(mem)) {
+    auto parsed_row = parallel_reader.GetNextRow(mem);
+    ASSERT_TRUE(parsed_row.has_value()) << "row " << rows;
+    ASSERT_EQ(*parsed_row, *expected_row) << "row " << rows;
+    ++rows;
+  }
+  EXPECT_EQ(rows, kRows);
+  EXPECT_FALSE(parallel_reader.GetNextRow(mem).has_value());
+}
+
+TEST_P(CsvReaderTest, UrlSourceReadsWhileDownloading) {
+  // The file has several blocks of the download, so the reader has to wait for
+  // the next ones while it parses.
+  const auto filepath = csv_directory / "bla.csv";
+  auto writer = FileWriter(filepath, GetParam().newline, GetParam().compressionMethod);
+
+  memgraph::utils::MemoryResource *mem(memgraph::utils::NewDeleteResource());
+
+  const memgraph::utils::pmr::string delimiter{",", mem};
+  const memgraph::utils::pmr::string quote{"\"", mem};
+
+  constexpr auto kRows = 100'000;
+  for (auto i = 0; i < kRows; ++i) {
+    writer.WriteLine(CreateRow({std::to_string(i), std::string(20, 'a'), std::string(20, 'b')}, delimiter));
+  }
+  writer.Close();
+
+  const Reader::Config cfg{false, false, delimiter, quote};
+  auto file_reader = Reader(FileCsvSource{filepath}, cfg, mem);
+  auto url_reader = Reader(UrlCsvSource{("file://" + filepath.string()).c_str()}, cfg, mem);
+
+  auto rows = 0;
+  while (auto expected_row = file_reader.GetNextRow(mem)) {
+    auto parsed_row = url_reader.GetNextRow(mem);
+    ASSERT_TRUE(parsed_row.has_value()) << "row " << rows;
+    ASSERT_EQ(*parsed_row, *expected_row) << "row " << rows;
+    ++rows;
+  }
+  EXPECT_EQ(rows, kRows);
+  EXPECT_FALSE(url_reader.GetNextRow(mem).has_value());
+
+  EXPECT_THROW(UrlCsvSource{("file://" + (csv_directory / "missing.csv").string()).c_str()}, CsvReadException);
+}
+
 INSTANTIATE_TEST_SUITE_P(NewlineParameterizedTest, CsvReaderTest,
                          ::testing::Values(TestParam{"\n", CompressionMethod::NONE},
                                            TestParam{"\r\n", CompressionMethod::NONE},
@@ -2121,6 +2121,50 @@ TEST_P(CypherMainVisitorTest, MatchWShortestNoFilterReturn) {
   EXPECT_FALSE(shortest->total_weight_->user_declared_);
 }
 
+TEST_P(CypherMainVisitorTest, MatchWShortestWithHeuristic) {
+  auto &ast_generator = *GetParam();
+  auto *query = dynamic_cast<CypherQuery *>(
+      ast_generator.ParseQuery("MATCH (a)-[r *wShortest (we, wn | 42) w (fe, fn | true) (he, hn | 7)]->(b) RETURN r"));
+  ASSERT_TRUE(query);
+  ASSERT_TRUE(query->single_query_);
+  auto *match = dynamic_cast<Match *>(query->single_query_->clauses_[0]);
+  ASSERT_TRUE(match);
+  auto *shortest = dynamic_cast<EdgeAtom *>(match->patterns_[0]->atoms_[1]);
+  ASSERT_TRUE(shortest);
+  EXPECT_EQ(shortest->type_, EdgeAtom::Type::WEIGHTED_SHORTEST_PATH);
+  ast_generator.CheckLiteral(shortest->weight_lambda_.expression, 42);
+  ast_generator.CheckLiteral(shortest->filter_lambda_.expression, true);
+  EXPECT_EQ(shortest->heuristic_lambda_.inner_edge->name_, "he");
+  EXPECT_EQ(shortest->heuristic_lambda_.inner_node->name_, "hn");
+  ast_generator.CheckLiteral(shortest->heuristic_lambda_.expression, 7);
+  ASSERT_THROW(ast_generator.ParseQuery("MATCH ()-[r *bfs (e, n | true) (e2, n2 | 1) (e3, n3 | 1)]-() RETURN r"),
+               SemanticException);
+}
+
+TEST_P(CypherMainVisitorTest, MatchKShortestReturn) {
+  auto &ast_generator = *GetParam();
+  auto *query = dynamic_cast<CypherQuery *>(
+      ast_generator.ParseQuery("MATCH (a)-[r *kShortest 5 (we, wn | 42) w (e, n | true)]->(b) RETURN r LIMIT 3"));
+  ASSERT_TRUE(query);
+  ASSERT_TRUE(query->single_query_);
+  auto *match = dynamic_cast<Match *>(query->single_query_->clauses_[0]);
+  ASSERT_TRUE(match);
+  auto *shortest = dynamic_cast<EdgeAtom *>(match->patterns_[0]->atoms_[1]);
+  ASSERT_TRUE(shortest);
+  EXPECT_TRUE(shortest->IsVariable());
+  EXPECT_EQ(shortest->type_, EdgeAtom::Type::K_SHORTEST_PATHS);
+  ast_generator.CheckLiteral(shortest->upper_bound_, 5);
+  EXPECT_FALSE(shortest->lower_bound_);
+  ast_generator.CheckLiteral(shortest->weight_lambda_.expression, 42);
+  ast_generator.CheckLiteral(shortest->filter_lambda_.expression, true);
+  ASSERT_TRUE(shortest->total_weight_);
+  EXPECT_EQ(shortest->total_weight_->name_, "w");
+  ASSERT_THROW(ast_generator.ParseQuery("MATCH ()-[r *kShortest]-() RETURN r"), SemanticException);
+  ASSERT_THROW(ast_generator.ParseQuery("MATCH ()-[r *kShortest 2.. (e, n | 42)]-() RETURN r"), SemanticException);
+  ASSERT_THROW(ast_generator.ParseQuery("MATCH ()-[r *kShortest (e, n | 42) (e2, n2, p | true)]-() RETURN r"),
+               SemanticException);
+}
+
 TEST_P(CypherMainVisitorTest, SemanticExceptionOnWShortestLowerBound) {
   auto &ast_generator = *GetParam();
   ASSERT_THROW(ast_generator.ParseQuery("MATCH ()-[r *wShortest 10.. (e, n | 42)]-() RETURN r"), SemanticException);
@@ -2794,6 +2838,20 @@ TEST_P(CypherMainVisitorTest, TestProfileComplicatedQuery) {
   }
 }
 
+TEST_P(CypherMainVisitorTest, TestProfileWithCountersQuery) {
+  auto &ast_generator = *GetParam();
+  {
+    auto *query = dynamic_cast<ProfileQuery *>(ast_generator.ParseQuery("PROFILE WITH COUNTERS MATCH (n) RETURN n"));
+    ASSERT_TRUE(query);
+    EXPECT_TRUE(query->with_counters_);
+  }
+  {
+    auto *query = dynamic_cast<ProfileQuery *>(ast_generator.ParseQuery("PROFILE WITH 1 AS counters RETURN counters"));
+    ASSERT_TRUE(query);
+    EXPECT_FALSE(query->with_counters_);
+  }
+}
+
 TEST_P(CypherMainVisitorTest, TestProfileProfileQuery) {
   auto &ast_generator = *GetParam();
   EXPECT_THROW(ast_generator.ParseQuery("PROFILE PROFILE RETURN n"), SyntaxException);
@@ -2811,6 +2869,13 @@ TEST_P(CypherMainVisitorTest, TestShowStorageInfo) {
   EXPECT_EQ(query->info_type_, SystemInfoQuery::InfoType::STORAGE);
 }
 
+TEST_P(CypherMainVisitorTest, TestShowProfileInfo) {
+  auto &ast_generator = *GetParam();
+  auto *query = dynamic_cast<SystemInfoQuery *>(ast_generator.ParseQuery("SHOW PROFILE INFO"));
+  ASSERT_TRUE(query);
+  EXPECT_EQ(query->info_type_, SystemInfoQuery::InfoType::PROFILE);
+}
+
 TEST_P(CypherMainVisitorTest, TestShowIndexInfo) {
   auto &ast_generator = *GetParam();
   auto *query = dynamic_cast<DatabaseInfoQuery *>(ast_generator.ParseQuery("SHOW INDEX INFO"));
@@ -4021,6 +4086,8 @@ void ValidateMostlyEmptyStreamQuery(Base &ast_generator, const std::string &quer
   EXPECT_NO_FATAL_FAILURE(CheckOptionalExpression(ast_generator, parsed_query->timeout_, timeout));
   EXPECT_TRUE(parsed_query->configs_.empty());
   EXPECT_TRUE(parsed_query->credentials_.empty());
+  EXPECT_EQ(parsed_query->workers_, nullptr);
+  EXPECT_EQ(parsed_query->pipeline_depth_, nullptr);
 }
 
 TEST_P(CypherMainVisitorTest, DropStream) {
@@ -4314,6 +4381,23 @@ TEST_P(CypherMainVisitorTest, CreateKafkaStream) {
   for (const auto &map_to_test : config_maps) {
     EXPECT_NO_FATAL_FAILURE(check_config_map(map_to_test));
   }
+
+  TestInvalidQuery("CREATE KAFKA STREAM stream TOPICS topic1 TRANSFORM transform WORKERS", ast_generator);
+  TestInvalidQuery<SemanticException>("CREATE KAFKA STREAM stream TOPICS topic1 TRANSFORM transform WORKERS 'four'",
+                                      ast_generator);
+  TestInvalidQuery<SemanticException>(
+      "CREATE KAFKA STREAM stream TOPICS topic1 TRANSFORM transform WORKERS 2 WORKERS 3", ast_generator);
+  auto *parsed_query = dynamic_cast<StreamQuery *>(
+      ast_generator.ParseQuery("CREATE KAFKA STREAM stream TOPICS topic1 TRANSFORM transform WORKERS 4"));
+  ASSERT_NE(parsed_query, nullptr);
+  EXPECT_NO_FATAL_FAILURE(CheckOptionalExpression(ast_generator, parsed_query->workers_, TypedValue(4)));
+
+  TestInvalidQuery<SemanticException>(
+      "CREATE KAFKA STREAM stream TOPICS topic1 TRANSFORM transform PIPELINE_DEPTH 'two'", ast_generator);
+  parsed_query = dynamic_cast<StreamQuery *>(
+      ast_generator.ParseQuery("CREATE KAFKA STREAM stream TOPICS topic1 TRANSFORM transform PIPELINE_DEPTH 2"));
+  ASSERT_NE(parsed_query, nullptr);
+  EXPECT_NO_FATAL_FAILURE(CheckOptionalExpression(ast_generator, parsed_query->pipeline_depth_, TypedValue(2)));
 }
 
 void ValidateCreatePulsarStreamQuery(Base &ast_generator, const std::string &query_string,
@@ -5117,6 +5201,44 @@ TEST_P(CypherMainVisitorTest, NestedPeriodicCommitQuery) {
   }
 }
 
+TEST_P(CypherMainVisitorTest, NestedConcurrentPeriodicCommitQuery) {
+  auto &ast_generator = *GetParam();
+  auto nested_directives = [&](const std::string &query_string) {
+    const auto *query = dynamic_cast<CypherQuery *>(ast_generator.ParseQuery(query_string));
+    EXPECT_NE(query, nullptr);
+    auto *call_subquery = dynamic_cast<CallSubquery *>(query->single_query_->clauses_[1]);
+    return call_subquery->cypher_query_->pre_query_directives_;
+  };
+
+  {
+    auto directives = nested_directives("UNWIND range(1, 100) as x CALL { CREATE () } IN TRANSACTIONS OF 10 ROWS;");
+    ASSERT_FALSE(directives.concurrent_commit_);
+    ASSERT_EQ(directives.commit_concurrency_, nullptr);
+  }
+
+  {
+    auto directives =
+        nested_directives("UNWIND range(1, 100) as x CALL { CREATE () } IN CONCURRENT TRANSACTIONS OF 10 ROWS;");
+    ASSERT_TRUE(directives.concurrent_commit_);
+    ASSERT_EQ(directives.commit_concurrency_, nullptr);
+    ast_generator.CheckLiteral(directives.commit_frequency_, 10);
+  }
+
+  {
+    auto directives =
+        nested_directives("UNWIND range(1, 100) as x CALL { CREATE () } IN 4 CONCURRENT TRANSACTIONS OF 10 ROWS;");
+    ASSERT_TRUE(directives.concurrent_commit_);
+    ast_generator.CheckLiteral(directives.commit_concurrency_, 4);
+    ast_generator.CheckLiteral(directives.commit_frequency_, 10);
+  }
+
+  {
+    ASSERT_THROW(ast_generator.ParseQuery(
+                     "UNWIND range(1, 100) as x CALL { CREATE () } IN 'a' CONCURRENT TRANSACTIONS OF 10 ROWS;"),
+                 SyntaxException);
+  }
+}
+
 TEST_P(CypherMainVisitorTest, ShowSchemaInfoQuery) {
   auto &ast_generator = *GetParam();
   const auto *query = dynamic_cast<ShowSchemaInfoQuery *>(ast_generator.ParseQuery("SHOW SCHEMA INFO;"));
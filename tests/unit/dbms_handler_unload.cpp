@@ -0,0 +1,195 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#ifdef MG_ENTERPRISE
+#include <gtest/gtest.h>
+#include <chrono>
+#include <filesystem>
+#include <set>
+#include <thread>
+
+#include "auth/auth.hpp"
+#include "dbms/constants.hpp"
+#include "dbms/dbms_handler.hpp"
+#include "replication/state.hpp"
+#include "storage/v2/config.hpp"
+#include "storage/v2/view.hpp"
+
+namespace {
+constexpr int64_t kVertices = 10;
+constexpr auto kUnloadTimeout = std::chrono::seconds(10);
+}  // namespace
+
+class DBMS_HandlerUnload : public testing::Test {
+ public:
+  void SetUp() override {
+    std::filesystem::remove_all(storage_directory);
+    memgraph::storage::UpdatePaths(config, storage_directory);
+    config.durability.snapshot_wal_mode =
+        memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL;
+    config.durability.recover_on_startup = true;
+    config.durability.unload_idle_after = std::chrono::seconds(1);
+    auth = std::make_unique<memgraph::auth::SynchedAuth>(storage_directory / "auth",
+                                                         memgraph::auth::Auth::Config{/* default */});
+    repl_state = std::make_unique<memgraph::replication::ReplicationState>(ReplicationStateRootPath(config));
+    dbms = std::make_unique<memgraph::dbms::DbmsHandler>(config, *repl_state, *auth, true);
+  }
+
+  void TearDown() override {
+    dbms.reset();
+    repl_state.reset();
+    auth.reset();
+    std::filesystem::remove_all(storage_directory);
+  }
+
+  // Creates the database with `kVertices` vertices and releases it.
+  void NewWithData(const std::string &name) {
+    auto db = dbms->New(name);
+    ASSERT_TRUE(db.HasValue());
+    auto acc = db.GetValue()->Access();
+    const auto label = acc->NameToLabel("L");
+    const auto property = acc->NameToProperty("id");
+    for (int64_t i = 0; i < kVertices; ++i) {
+      auto vertex = acc->CreateVertex();
+      ASSERT_TRUE(vertex.AddLabel(label).HasValue());
+      ASSERT_TRUE(vertex.SetProperty(property, memgraph::storage::PropertyValue(i)).HasValue());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  void ExpectData(memgraph::dbms::DatabaseAccess &db) {
+    auto acc = db->Access();
+    const auto label = acc->NameToLabel("L");
+    const auto property = acc->NameToProperty("id");
+    std::set<int64_t> ids;
+    for (auto vertex : acc->Vertices(memgraph::storage::View::OLD)) {
+      auto has_label = vertex.HasLabel(label, memgraph::storage::View::OLD);
+      ASSERT_TRUE(has_label.HasValue() && *has_label);
+      auto value = vertex.GetProperty(property, memgraph::storage::View::OLD);
+      ASSERT_TRUE(value.HasValue() && value->IsInt());
+      ids.insert(value->ValueInt());
+    }
+    EXPECT_EQ(ids.size(), kVertices);
+    EXPECT_EQ(*ids.begin(), 0);
+    EXPECT_EQ(*ids.rbegin(), kVertices - 1);
+  }
+
+  bool WaitUnloaded(std::string_view name) const {
+    const auto deadline = std::chrono::steady_clock::now() + kUnloadTimeout;
+    while (std::chrono::steady_clock::now() < deadline) {
+      if (dbms->IsUnloaded(name)) return true;
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    return false;
+  }
+
+  std::filesystem::path storage_directory{std::filesystem::temp_directory_path() /
+                                          "MG_test_unit_dbms_handler_unload"};
+  memgraph::storage::Config config;
+  std::unique_ptr<memgraph::auth::SynchedAuth> auth;
+  std::unique_ptr<memgraph::replication::ReplicationState> repl_state;
+  std::unique_ptr<memgraph::dbms::DbmsHandler> dbms;
+};
+
+TEST_F(DBMS_HandlerUnload, IdleDatabaseIsReloadedIntact) {
+  NewWithData("db1");
+  {
+    // A database in use is never unloaded
+    auto db1 = dbms->Get("db1");
+    std::this_thread::sleep_for(3 * config.durability.unload_idle_after);
+    ASSERT_FALSE(dbms->IsUnloaded("db1"));
+  }
+  ASSERT_TRUE(WaitUnloaded("db1"));
+  ASSERT_FALSE(dbms->IsUnloaded(memgraph::dbms::kDefaultDB));
+
+  // Still listed while unloaded
+  const auto all = dbms->All();
+  ASSERT_EQ(all.size(), 2);
+  ASSERT_TRUE(std::find(all.begin(), all.end(), "db1") != all.end());
+  ASSERT_EQ(dbms->Count(), 2);
+
+  auto db1 = dbms->Get("db1");
+  ASSERT_TRUE(db1);
+  ASSERT_FALSE(dbms->IsUnloaded("db1"));
+  ASSERT_EQ(db1->name(), "db1");
+  ExpectData(db1);
+
+  // The uuid survives the reload
+  const auto uuid = db1->uuid();
+  db1.reset();
+  ASSERT_TRUE(WaitUnloaded("db1"));
+  auto by_uuid = dbms->Get(uuid);
+  ASSERT_TRUE(by_uuid);
+  ASSERT_EQ(by_uuid->name(), "db1");
+  ExpectData(by_uuid);
+}
+
+TEST_F(DBMS_HandlerUnload, NewAndDeleteOfUnloadedDatabase) {
+  NewWithData("db1");
+  NewWithData("db2");
+  ASSERT_TRUE(WaitUnloaded("db1"));
+  ASSERT_TRUE(WaitUnloaded("db2"));
+
+  {
+    auto db = dbms->New("db1");
+    ASSERT_TRUE(db.HasError() && db.GetError() == memgraph::dbms::NewError::EXISTS);
+    ASSERT_TRUE(dbms->IsUnloaded("db1"));
+  }
+  {
+    const auto db_dir = dbms->Get("db1")->storage()->config_.durability.storage_directory;
+    ASSERT_TRUE(WaitUnloaded("db1"));
+    auto del = dbms->TryDelete("db1");
+    ASSERT_FALSE(del.HasError()) << (int)del.GetError();
+    ASSERT_FALSE(dbms->IsUnloaded("db1"));
+    ASSERT_FALSE(std::filesystem::exists(db_dir));
+    ASSERT_ANY_THROW(dbms->Get("db1"));
+    auto del2 = dbms->TryDelete("db1");
+    ASSERT_TRUE(del2.HasError() && del2.GetError() == memgraph::dbms::DeleteError::NON_EXISTENT);
+  }
+  {
+    auto del = dbms->Delete("db2");
+    ASSERT_FALSE(del.HasError()) << (int)del.GetError();
+    ASSERT_FALSE(dbms->IsUnloaded("db2"));
+    ASSERT_ANY_THROW(dbms->Get("db2"));
+  }
+  {
+    const auto all = dbms->All();
+    ASSERT_EQ(all.size(), 1);
+    ASSERT_EQ(all[0], memgraph::dbms::kDefaultDB);
+  }
+  {
+    // The name is free again, and the new database doesn't have the old data
+    auto db = dbms->New("db1");
+    ASSERT_TRUE(db.HasValue());
+    ASSERT_EQ(db.GetValue()->storage()->GetBaseInfo().vertex_count, 0);
+  }
+}
+
+TEST_F(DBMS_HandlerUnload, ForEachLoadsUnloadedDatabases) {
+  NewWithData("db1");
+  NewWithData("db2");
+  ASSERT_TRUE(WaitUnloaded("db1"));
+  ASSERT_TRUE(WaitUnloaded("db2"));
+
+  std::set<std::string> loaded;
+  dbms->ForEachLoaded([&](memgraph::dbms::DatabaseAccess db) { loaded.insert(db->name()); });
+  ASSERT_EQ(loaded, std::set<std::string>{memgraph::dbms::kDefaultDB});
+
+  std::set<std::string> all;
+  dbms->ForEach([&](memgraph::dbms::DatabaseAccess db) {
+    all.insert(db->name());
+    if (db->name() != memgraph::dbms::kDefaultDB) ExpectData(db);
+  });
+  ASSERT_EQ(all, (std::set<std::string>{memgraph::dbms::kDefaultDB, "db1", "db2"}));
+  ASSERT_FALSE(dbms->IsUnloaded("db1"));
+  ASSERT_FALSE(dbms->IsUnloaded("db2"));
+}
+#endif
@@ -314,6 +314,74 @@ TEST_F(ConsumerTest, InvalidBatchSize) {
   EXPECT_NO_THROW(Consumer(info, kDummyConsumerFunction));
 }
 
+TEST_F(ConsumerTest, InvalidWorkers) {
+  auto info = CreateDefaultConsumerInfo();
+
+  info.workers = 0;
+  EXPECT_THROW(Consumer(info, kDummyConsumerFunction), ConsumerFailedToInitializeException);
+
+  info.workers = -1;
+  EXPECT_THROW(Consumer(info, kDummyConsumerFunction), ConsumerFailedToInitializeException);
+
+  info.workers = 3;
+  EXPECT_NO_THROW(Consumer(info, kDummyConsumerFunction));
+}
+
+TEST_F(ConsumerTest, StartStopWithWorkers) {
+  auto info = CreateDefaultConsumerInfo();
+  info.workers = 3;
+  Consumer consumer{std::move(info), kDummyConsumerFunction};
+
+  for (auto i = 0; i < 2; ++i) {
+    consumer.Start();
+    EXPECT_TRUE(consumer.IsRunning());
+    EXPECT_THROW(consumer.Start(), ConsumerRunningException);
+    consumer.Stop();
+    EXPECT_FALSE(consumer.IsRunning());
+  }
+}
+
+TEST_F(ConsumerTest, InvalidPipelineDepth) {
+  auto info = CreateDefaultConsumerInfo();
+
+  info.pipeline_depth = -1;
+  EXPECT_THROW(Consumer(info, kDummyConsumerFunction), ConsumerFailedToInitializeException);
+
+  info.pipeline_depth = 2;
+  EXPECT_NO_THROW(Consumer(info, kDummyConsumerFunction));
+}
+
+TEST_F(ConsumerTest, PipelinedBatchesKeepOrder) {
+  static constexpr auto kBatchSize = 2;
+  static constexpr auto kMessageCount = 5 * kBatchSize;
+  auto info = CreateDefaultConsumerInfo();
+  info.batch_size = kBatchSize;
+  info.pipeline_depth = 2;
+
+  std::vector<std::string> received_messages;
+  auto consumer_function = [&](const std::vector<Message> &messages) {
+    // Slow processing lets the consumer poll the next batches in the meantime
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    for (const auto &message : messages) {
+      received_messages.emplace_back(message.Payload().data(), message.Payload().size());
+    }
+  };
+
+  auto consumer = CreateConsumer(std::move(info), std::move(consumer_function));
+  consumer->Start();
+  ASSERT_TRUE(consumer->IsRunning());
+
+  std::vector<std::string> sent_messages;
+  for (auto i = 0; i < kMessageCount; ++i) {
+    sent_messages.push_back(fmt::format("PipelinedMessage{}", i));
+    cluster.SeedTopic(kTopicName, sent_messages.back());
+  }
+  std::this_thread::sleep_for(std::chrono::seconds{2});
+  consumer->Stop();
+
+  EXPECT_EQ(sent_messages, received_messages);
+}
+
 TEST_F(ConsumerTest, DISABLED_StartsFromPreviousOffset) {
   static constexpr auto kBatchSize = 1;
   auto info = CreateDefaultConsumerInfo();
@@ -17,6 +17,7 @@
 #include "communication/result_stream_faker.hpp"
 #include "csv/parsing.hpp"
 #include "disk_test_utils.hpp"
+#include "flags/replication.hpp"
 #include "flags/run_time_configurable.hpp"
 #include "glue/communication.hpp"
 #include "gmock/gmock.h"
@@ -37,7 +38,7 @@
 #include "storage/v2/property_value.hpp"
 #include "storage/v2/storage_mode.hpp"
 #include "utils/logging.hpp"
-#include "utils/lru_cache.hpp"
+#include "utils/clock_cache.hpp"
 #include "utils/synchronized.hpp"
 
 namespace {
@@ -561,6 +562,32 @@ TYPED_TEST(InterpreterTest, CreateLabelPropertyIndexInMulticommandTransaction) {
   this->Interpret("ROLLBACK");
 }
 
+TYPED_TEST(InterpreterTest, CoveringCompositeIndexScan) {
+  if constexpr (std::is_same_v<TypeParam, memgraph::storage::DiskStorage>) {
+    return;
+  }
+  this->Interpret("CREATE (:L {a: 1, b: 'x', c: 1.5}), (:L {a: 1, b: 'y'}), (:L {a: 2, b: 'z', c: 3.0})");
+  this->Interpret("CREATE INDEX ON :L(a, b, c)");
+
+  auto check = [this](const std::vector<std::pair<std::string, std::optional<double>>> &expected) {
+    auto stream = this->Interpret("MATCH (n:L) WHERE n.a = 1 RETURN n.b AS b, n.c AS c ORDER BY b");
+    ASSERT_EQ(stream.GetResults().size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      const auto &row = stream.GetResults()[i];
+      EXPECT_EQ(row[0].ValueString(), expected[i].first);
+      if (expected[i].second) {
+        EXPECT_EQ(row[1].ValueDouble(), *expected[i].second);
+      } else {
+        EXPECT_TRUE(row[1].IsNull());
+      }
+    }
+  };
+  check({{"x", 1.5}, {"y", std::nullopt}});
+
+  this->Interpret("MATCH (n:L) WHERE n.b = 'y' SET n.b = 'w', n.c = 2.5");
+  check({{"w", 2.5}, {"x", 1.5}});
+}
+
 TYPED_TEST(InterpreterTest, CreateExistenceConstraintInMulticommandTransaction) {
   this->Interpret("BEGIN");
   ASSERT_THROW(this->Interpret("CREATE CONSTRAINT ON (n:A) ASSERT EXISTS (n.a)"),
@@ -678,7 +705,7 @@ TYPED_TEST(InterpreterTest, UniqueConstraintTest) {
 }
 
 TYPED_TEST(InterpreterTest, ExplainQuery) {
-  EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 0U);
+  EXPECT_EQ(this->db->plan_cache()->size(), 0U);
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 0U);
   auto stream = this->Interpret("EXPLAIN MATCH (n) RETURN *;");
   ASSERT_EQ(stream.GetHeader().size(), 1U);
@@ -692,16 +719,16 @@ TYPED_TEST(InterpreterTest, ExplainQuery) {
     ++expected_it;
   }
   // We should have a plan cache for MATCH ...
-  EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 1U);
+  EXPECT_EQ(this->db->plan_cache()->size(), 1U);
   // We should have AST cache for EXPLAIN ... and for inner MATCH ...
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 2U);
   this->Interpret("MATCH (n) RETURN *;");
-  EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 1U);
+  EXPECT_EQ(this->db->plan_cache()->size(), 1U);
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 2U);
 }
 
 TYPED_TEST(InterpreterTest, ExplainQueryMultiplePulls) {
-  EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 0U);
+  EXPECT_EQ(this->db->plan_cache()->size(), 0U);
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 0U);
   auto [stream, qid] = this->Prepare("EXPLAIN MATCH (n) RETURN *;");
   ASSERT_EQ(stream.GetHeader().size(), 1U);
@@ -725,16 +752,16 @@ TYPED_TEST(InterpreterTest, ExplainQueryMultiplePulls) {
   ASSERT_EQ(stream.GetResults()[2].size(), 1U);
   EXPECT_EQ(stream.GetResults()[2].front().ValueString(), *expected_it);
   // We should have a plan cache for MATCH ...
-  EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 1U);
+  EXPECT_EQ(this->db->plan_cache()->size(), 1U);
   // We should have AST cache for EXPLAIN ... and for inner MATCH ...
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 2U);
   this->Interpret("MATCH (n) RETURN *;");
-  EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 1U);
+  EXPECT_EQ(this->db->plan_cache()->size(), 1U);
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 2U);
 }
 
 TYPED_TEST(InterpreterTest, ExplainQueryInMulticommandTransaction) {
-  EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 0U);
+  EXPECT_EQ(this->db->plan_cache()->size(), 0U);
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 0U);
   this->Interpret("BEGIN");
   auto stream = this->Interpret("EXPLAIN MATCH (n) RETURN *;");
@@ -750,16 +777,32 @@ TYPED_TEST(InterpreterTest, ExplainQueryInMulticommandTransaction) {
     ++expected_it;
   }
   // We should have a plan cache for MATCH ...
-  EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 1U);
+  EXPECT_EQ(this->db->plan_cache()->size(), 1U);
   // We should have AST cache for EXPLAIN ... and for inner MATCH ...
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 2U);
   this->Interpret("MATCH (n) RETURN *;");
-  EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 1U);
+  EXPECT_EQ(this->db->plan_cache()->size(), 1U);
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 2U);
 }
 
+TYPED_TEST(InterpreterTest, ParameterSensitivePlanCache) {
+  auto cache_size = [this] { return this->db->plan_cache()->size(); };
+  FLAGS_query_plan_cache_parameter_sensitive = true;
+  this->Interpret("MATCH (n) WHERE n.id = $id RETURN n;", {{"id", memgraph::storage::PropertyValue(42)}});
+  EXPECT_EQ(cache_size(), 1U);
+  this->Interpret("MATCH (n) WHERE n.id = $id RETURN n;", {{"id", memgraph::storage::PropertyValue(7)}});
+  EXPECT_EQ(cache_size(), 1U);
+  this->Interpret("MATCH (n) WHERE n.id = $id RETURN n;", {{"id", memgraph::storage::PropertyValue("42")}});
+  EXPECT_EQ(cache_size(), 2U);
+  FLAGS_query_plan_cache_parameter_sensitive = false;
+
+  // Constraints invalidate the cached plans, the same as indices.
+  this->Interpret("CREATE CONSTRAINT ON (n:A) ASSERT EXISTS (n.a);");
+  EXPECT_EQ(cache_size(), 0U);
+}
+
 TYPED_TEST(InterpreterTest, ExplainQueryWithParams) {
-  EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 0U);
+  EXPECT_EQ(this->db->plan_cache()->size(), 0U);
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 0U);
   auto stream =
       this->Interpret("EXPLAIN MATCH (n) WHERE n.id = $id RETURN *;", {{"id", memgraph::storage::PropertyValue(42)}});
@@ -774,16 +817,16 @@ TYPED_TEST(InterpreterTest, ExplainQueryWithParams) {
     ++expected_it;
   }
   // We should have a plan cache for MATCH ...
-  EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 1U);
+  EXPECT_EQ(this->db->plan_cache()->size(), 1U);
   // We should have AST cache for EXPLAIN ... and for inner MATCH ...
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 2U);
   this->Interpret("MATCH (n) WHERE n.id = $id RETURN *;", {{"id", memgraph::storage::PropertyValue("something else")}});
-  EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 1U);
+  EXPECT_EQ(this->db->plan_cache()->size(), 1U);
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 2U);
 }
 
 TYPED_TEST(InterpreterTest, ProfileQuery) {
-  EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 0U);
+  EXPECT_EQ(this->db->plan_cache()->size(), 0U);
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 0U);
   auto stream = this->Interpret("PROFILE MATCH (n) RETURN *;");
   std::vector<std::string> expected_header{"OPERATOR", "ACTUAL HITS", "RELATIVE TIME", "ABSOLUTE TIME"};
@@ -797,16 +840,16 @@ TYPED_TEST(InterpreterTest, ProfileQuery) {
     ++expected_it;
   }
   // We should have a plan cache for MATCH ...
-  EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 1U);
+  EXPECT_EQ(this->db->plan_cache()->size(), 1U);
   // We should have AST cache for PROFILE ... and for inner MATCH ...
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 2U);
   this->Interpret("MATCH (n) RETURN *;");
-  EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 1U);
+  EXPECT_EQ(this->db->plan_cache()->size(), 1U);
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 2U);
 }
 
 TYPED_TEST(InterpreterTest, ProfileQueryMultiplePulls) {
-  EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 0U);
+  EXPECT_EQ(this->db->plan_cache()->size(), 0U);
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 0U);
   auto [stream, qid] = this->Prepare("PROFILE MATCH (n) RETURN *;");
   std::vector<std::string> expected_header{"OPERATOR", "ACTUAL HITS", "RELATIVE TIME", "ABSOLUTE TIME"};
@@ -833,11 +876,11 @@ TYPED_TEST(InterpreterTest, ProfileQueryMultiplePulls) {
   ASSERT_EQ(stream.GetResults()[2][0].ValueString(), *expected_it);
 
   // We should have a plan cache for MATCH ...
-  EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 1U);
+  EXPECT_EQ(this->db->plan_cache()->size(), 1U);
   // We should have AST cache for PROFILE ... and for inner MATCH ...
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 2U);
   this->Interpret("MATCH (n) RETURN *;");
-  EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 1U);
+  EXPECT_EQ(this->db->plan_cache()->size(), 1U);
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 2U);
 }
 
@@ -848,7 +891,7 @@ TYPED_TEST(InterpreterTest, ProfileQueryInMulticommandTransaction) {
 }
 
 TYPED_TEST(InterpreterTest, ProfileQueryWithParams) {
-  EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 0U);
+  EXPECT_EQ(this->db->plan_cache()->size(), 0U);
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 0U);
   auto stream =
       this->Interpret("PROFILE MATCH (n) WHERE n.id = $id RETURN *;", {{"id", memgraph::storage::PropertyValue(42)}});
@@ -863,16 +906,16 @@ TYPED_TEST(InterpreterTest, ProfileQueryWithParams) {
     ++expected_it;
   }
   // We should have a plan cache for MATCH ...
-  EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 1U);
+  EXPECT_EQ(this->db->plan_cache()->size(), 1U);
   // We should have AST cache for PROFILE ... and for inner MATCH ...
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 2U);
   this->Interpret("MATCH (n) WHERE n.id = $id RETURN *;", {{"id", memgraph::storage::PropertyValue("something else")}});
-  EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 1U);
+  EXPECT_EQ(this->db->plan_cache()->size(), 1U);
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 2U);
 }
 
 TYPED_TEST(InterpreterTest, ProfileQueryWithLiterals) {
-  EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 0U);
+  EXPECT_EQ(this->db->plan_cache()->size(), 0U);
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 0U);
   auto stream = this->Interpret("PROFILE UNWIND range(1, 1000) AS x CREATE (:Node {id: x});", {});
   std::vector<std::string> expected_header{"OPERATOR", "ACTUAL HITS", "RELATIVE TIME", "ABSOLUTE TIME"};
@@ -886,14 +929,36 @@ TYPED_TEST(InterpreterTest, ProfileQueryWithLiterals) {
     ++expected_it;
   }
   // We should have a plan cache for UNWIND ...
-  EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 1U);
+  EXPECT_EQ(this->db->plan_cache()->size(), 1U);
   // We should have AST cache for PROFILE ... and for inner UNWIND ...
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 2U);
   this->Interpret("UNWIND range(42, 4242) AS x CREATE (:Node {id: x});", {});
-  EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 1U);
+  EXPECT_EQ(this->db->plan_cache()->size(), 1U);
   EXPECT_EQ(this->interpreter_context.ast_cache.size(), 2U);
 }
 
+TYPED_TEST(InterpreterTest, ValuesOutliveReleasedPullMemory) {
+  // The memory of the evaluated values is released every few thousand rows,
+  // the streamed rows and the values kept by Accumulate and Aggregate stay.
+  {
+    auto stream = this->Interpret("UNWIND range(1, 5000) AS x RETURN 'value ' + toString(x) AS s");
+    ASSERT_EQ(stream.GetResults().size(), 5000U);
+    for (size_t i = 0; i < stream.GetResults().size(); ++i) {
+      EXPECT_EQ(stream.GetResults()[i][0].ValueString(), fmt::format("value {}", i + 1));
+    }
+  }
+  {
+    auto stream = this->Interpret(
+        "UNWIND range(1, 5000) AS x WITH x % 3 AS k, 'value ' + toString(x) AS s "
+        "RETURN k, size(collect(s)) AS n, max(s) AS m ORDER BY k");
+    ASSERT_EQ(stream.GetResults().size(), 3U);
+    EXPECT_EQ(stream.GetResults()[0][1].ValueInt(), 1666);
+    EXPECT_EQ(stream.GetResults()[0][2].ValueString(), "value 999");
+    EXPECT_EQ(stream.GetResults()[1][1].ValueInt(), 1667);
+    EXPECT_EQ(stream.GetResults()[2][1].ValueInt(), 1667);
+  }
+}
+
 TYPED_TEST(InterpreterTest, Transactions) {
   auto &interpreter = this->default_interpreter.interpreter;
   {
@@ -925,6 +990,56 @@ TYPED_TEST(InterpreterTest, Transactions) {
   }
 }
 
+TYPED_TEST(InterpreterTest, Bookmarks) {
+  auto &interpreter = this->default_interpreter.interpreter;
+  std::string bookmark;
+  {
+    auto [stream, qid] = this->Prepare("CREATE ()");
+    this->Pull(&stream);
+    ASSERT_EQ(stream.GetSummary().count("bookmark"), 1);
+    bookmark = stream.GetSummary().at("bookmark").ValueString();
+    ASSERT_TRUE(bookmark.starts_with("memgraph:"));
+  }
+  {
+    interpreter.BeginTransaction({.bookmarks = {bookmark, "unknown-bookmark"}});
+    auto [stream, qid] = this->Prepare("MATCH (n) RETURN count(n)");
+    this->Pull(&stream);
+    ASSERT_EQ(stream.GetResults()[0][0].ValueInt(), 1);
+    const auto commit_bookmark = interpreter.CommitTransaction();
+    ASSERT_TRUE(commit_bookmark.has_value());
+  }
+  {
+    // The database never reaches a bookmark from the future.
+    const auto wait_ms = FLAGS_replication_bookmark_wait_ms;
+    FLAGS_replication_bookmark_wait_ms = 10;
+    const auto separator = bookmark.rfind(':');
+    const auto future_bookmark = fmt::format("{}:{}", bookmark.substr(0, separator),
+                                             std::stoull(bookmark.substr(separator + 1)) + 1000);
+    ASSERT_THROW(interpreter.BeginTransaction({.bookmarks = {future_bookmark}}), memgraph::query::QueryException);
+    FLAGS_replication_bookmark_wait_ms = wait_ms;
+  }
+  {
+    // A commit of an earlier epoch after its last commit on this instance is lost for good.
+    auto &repl_storage_state = this->db->storage()->repl_storage_state_;
+    repl_storage_state.history.emplace_back("ended-epoch", 2);
+    repl_storage_state.PublishEpoch();
+    const auto db_name = std::string{this->db->name()};
+    interpreter.BeginTransaction({.bookmarks = {fmt::format("memgraph:{}:ended-epoch:2", db_name)}});
+    interpreter.RollbackTransaction();
+    ASSERT_THROW(interpreter.BeginTransaction({.bookmarks = {fmt::format("memgraph:{}:ended-epoch:3", db_name)}}),
+                 memgraph::query::QueryException);
+
+    // The commits of an epoch the instance didn't receive yet are waited for.
+    const auto wait_ms = FLAGS_replication_bookmark_wait_ms;
+    FLAGS_replication_bookmark_wait_ms = 10;
+    ASSERT_THROW(interpreter.BeginTransaction({.bookmarks = {fmt::format("memgraph:{}:next-epoch:1", db_name)}}),
+                 memgraph::query::QueryException);
+    FLAGS_replication_bookmark_wait_ms = wait_ms;
+    repl_storage_state.history.pop_back();
+    repl_storage_state.PublishEpoch();
+  }
+}
+
 TYPED_TEST(InterpreterTest, Qid) {
   auto &interpreter = this->default_interpreter.interpreter;
   {
@@ -1116,7 +1231,7 @@ TYPED_TEST(InterpreterTest, CacheableQueries) {
     SCOPED_TRACE("Cacheable query");
     this->Interpret("RETURN 1");
     EXPECT_EQ(this->interpreter_context.ast_cache.size(), 1U);
-    EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 1U);
+    EXPECT_EQ(this->db->plan_cache()->size(), 1U);
   }
 
   {
@@ -1125,7 +1240,7 @@ TYPED_TEST(InterpreterTest, CacheableQueries) {
     // result signature could be changed
     this->Interpret("CALL mg.load_all()");
     EXPECT_EQ(this->interpreter_context.ast_cache.size(), 1U);
-    EXPECT_EQ(this->db->plan_cache()->WithLock([&](auto &cache) { return cache.size(); }), 1U);
+    EXPECT_EQ(this->db->plan_cache()->size(), 1U);
   }
 }
 
@@ -11,6 +11,7 @@
 
 #include "gtest/gtest.h"
 
+#include "mgp.hpp"
 #include "query/procedure/mg_procedure_impl.hpp"
 #include "query/procedure/module.hpp"
 #include "test_utils.hpp"
@@ -33,3 +34,17 @@ TEST(MgpTransTest, TestMgpTransApi) {
   EXPECT_EQ(mgp_module_add_transformation(&module, "transform", no_op_cb), mgp_error::MGP_ERROR_LOGIC_ERROR);
   EXPECT_TRUE(module.transformations.size() == 1);
 }
+
+TEST(MgpTransTest, TestMgpTransCppApi) {
+  static constexpr auto no_op_cb = [](mgp_messages *msg, mgp_graph *graph, mgp_result *result, mgp_memory *memory) {};
+  mgp_module module(memgraph::utils::NewDeleteResource());
+
+  EXPECT_THROW(mgp::AddTransformation(no_op_cb, "dash-dash", &module), mg_exception::InvalidArgumentException);
+  EXPECT_TRUE(module.transformations.empty());
+
+  EXPECT_NO_THROW(mgp::AddTransformation(no_op_cb, "transform", &module));
+  EXPECT_NE(module.transformations.find("transform"), module.transformations.end());
+
+  EXPECT_THROW(mgp::AddTransformation(no_op_cb, "transform", &module), mg_exception::LogicException);
+  EXPECT_TRUE(module.transformations.size() == 1);
+}
@@ -0,0 +1,128 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "query/exceptions.hpp"
+#include "query/query_admission.hpp"
+#include "utils/synchronized.hpp"
+
+using memgraph::query::AbortReason;
+using memgraph::query::QueryAdmission;
+using QueryType = QueryAdmission::QueryType;
+using Selector = QueryAdmission::LaneConfig::Selector;
+
+namespace {
+
+AbortReason NoAbort() { return AbortReason::NO_ABORT; }
+
+QueryAdmission MakeAdmission(std::string_view spec) {
+  auto lanes = QueryAdmission::ParseLanes(spec);
+  EXPECT_TRUE(lanes);
+  return QueryAdmission{std::move(*lanes)};
+}
+
+}  // namespace
+
+TEST(QueryAdmission, ParseLanes) {
+  auto lanes = QueryAdmission::ParseLanes("read=8; write=2:500 ;db:analytics=1:0;user:etl=3;role:admin=4");
+  ASSERT_TRUE(lanes);
+  ASSERT_EQ(lanes->size(), 5);
+  EXPECT_EQ((*lanes)[0].selector, Selector::READ);
+  EXPECT_EQ((*lanes)[0].max_running, 8);
+  EXPECT_FALSE((*lanes)[0].queue_timeout);
+  EXPECT_EQ((*lanes)[1].selector, Selector::WRITE);
+  EXPECT_EQ((*lanes)[1].queue_timeout, std::chrono::milliseconds{500});
+  EXPECT_EQ((*lanes)[2].selector, Selector::DATABASE);
+  EXPECT_EQ((*lanes)[2].selector_name, "analytics");
+  EXPECT_EQ((*lanes)[2].queue_timeout, std::chrono::milliseconds{0});
+  EXPECT_EQ((*lanes)[3].selector, Selector::USER);
+  EXPECT_EQ((*lanes)[3].selector_name, "etl");
+  EXPECT_EQ((*lanes)[4].selector, Selector::ROLE);
+  EXPECT_EQ((*lanes)[4].selector_name, "admin");
+
+  auto empty = QueryAdmission::ParseLanes("");
+  ASSERT_TRUE(empty);
+  EXPECT_TRUE(empty->empty());
+
+  for (const auto *spec : {"read", "read=", "read=0", "read=x", "read=1:", "read=1:2:3", "scan=1", "db:=1", "db=1"}) {
+    EXPECT_FALSE(QueryAdmission::ParseLanes(spec)) << spec;
+  }
+}
+
+TEST(QueryAdmission, UnmatchedQueryIsNotLimited) {
+  auto admission = MakeAdmission("write=1:0;db:analytics=1:0");
+  auto write = admission.Admit(QueryType::WRITE, "memgraph", nullptr, NoAbort);
+  EXPECT_TRUE(write);
+  for (auto i = 0; i < 3; ++i) {
+    EXPECT_FALSE(admission.Admit(QueryType::READ, "memgraph", nullptr, NoAbort));
+  }
+  // The queries of a user can't match without one.
+  auto user_admission = MakeAdmission("user:etl=1:0");
+  EXPECT_FALSE(user_admission.Admit(QueryType::WRITE, "memgraph", nullptr, NoAbort));
+}
+
+TEST(QueryAdmission, FullLaneRejectsWithZeroTimeout) {
+  auto admission = MakeAdmission("read=1:0");
+  {
+    auto slot = admission.Admit(QueryType::READ, "memgraph", nullptr, NoAbort);
+    ASSERT_TRUE(slot);
+    EXPECT_THROW(admission.Admit(QueryType::READ, "memgraph", nullptr, NoAbort),
+                 memgraph::query::QueryAdmissionTimeoutException);
+  }
+  EXPECT_TRUE(admission.Admit(QueryType::READ, "memgraph", nullptr, NoAbort));
+}
+
+TEST(QueryAdmission, QueueTimesOut) {
+  auto admission = MakeAdmission("db:memgraph=1:50");
+  auto slot = admission.Admit(QueryType::WRITE, "memgraph", nullptr, NoAbort);
+  ASSERT_TRUE(slot);
+  const auto start = std::chrono::steady_clock::now();
+  EXPECT_THROW(admission.Admit(QueryType::READ, "memgraph", nullptr, NoAbort),
+               memgraph::query::QueryAdmissionTimeoutException);
+  EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds{50});
+}
+
+TEST(QueryAdmission, WaitingQueryIsAborted) {
+  auto admission = MakeAdmission("read=1");
+  auto slot = admission.Admit(QueryType::READ, "memgraph", nullptr, NoAbort);
+  ASSERT_TRUE(slot);
+  EXPECT_THROW(admission.Admit(QueryType::READ, "memgraph", nullptr, [] { return AbortReason::TERMINATED; }),
+               memgraph::query::HintedAbortError);
+}
+
+TEST(QueryAdmission, WaitingQueriesAreAdmittedInOrder) {
+  auto admission = MakeAdmission("write=1");
+  auto slot = admission.Admit(QueryType::WRITE, "memgraph", nullptr, NoAbort);
+  ASSERT_TRUE(slot);
+
+  constexpr auto kWaiting = 4;
+  memgraph::utils::Synchronized<std::vector<int>, std::mutex> admitted;
+  std::vector<std::jthread> waiting;
+  for (auto i = 0; i < kWaiting; ++i) {
+    waiting.emplace_back([&, i] {
+      auto waiting_slot = admission.Admit(QueryType::WRITE, "memgraph", nullptr, NoAbort);
+      ASSERT_TRUE(waiting_slot);
+      admitted->push_back(i);
+    });
+    // Let the query join the queue before the next one comes.
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+  }
+  EXPECT_TRUE(admitted->empty());
+
+  slot.reset();
+  waiting.clear();
+  EXPECT_EQ(*admitted.Lock(), (std::vector<int>{0, 1, 2, 3}));
+}
@@ -177,6 +177,25 @@ TEST_F(QueryCostEstimator, ScanAllByLabelPropertyRangeConstExpr) {
   }
 }
 
+TEST_F(QueryCostEstimator, ScanAllByLabelPropertyHistogram) {
+  AddVertices(100, 30, 20);
+  // 5 is frequent, it covers two of the four buckets
+  dba->SetIndexStats(label, property,
+                     memgraph::storage::LabelPropertyIndexStats{
+                         .count = 20, .distinct_values_count = 20, .histogram = {0.0, 5.0, 5.0, 5.0, 19.0}});
+  MakeOp<ScanAllByLabelPropertyValue>(nullptr, NextSymbol(), label, property, Literal(5));
+  EXPECT_COST(10 * CostParam::MakeScanAllByLabelPropertyValue);
+  MakeOp<ScanAllByLabelPropertyValue>(nullptr, NextSymbol(), label, property, Literal(12));
+  EXPECT_COST(1 * CostParam::MakeScanAllByLabelPropertyValue);
+  MakeOp<ScanAllByLabelPropertyValue>(nullptr, NextSymbol(), label, property,
+                                      storage_.Create<UnaryPlusOperator>(Literal(12)));
+  EXPECT_COST(1 * CostParam::MakeScanAllByLabelPropertyValue);
+  MakeOp<ScanAllByLabelPropertyRange>(nullptr, NextSymbol(), label, property, nullopt, InclusiveBound(Literal(5)));
+  EXPECT_COST(15 * CostParam::MakeScanAllByLabelPropertyRange);
+  MakeOp<ScanAllByLabelPropertyRange>(nullptr, NextSymbol(), label, property, InclusiveBound(Literal(12)), nullopt);
+  EXPECT_COST(2.5 * CostParam::MakeScanAllByLabelPropertyRange);
+}
+
 TEST_F(QueryCostEstimator, Expand) {
   MakeOp<Expand>(last_op_, NextSymbol(), NextSymbol(), NextSymbol(), EdgeAtom::Direction::IN,
                  std::vector<memgraph::storage::EdgeTypeId>{}, false, memgraph::storage::View::OLD);
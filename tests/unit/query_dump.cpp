@@ -640,6 +640,43 @@ TYPED_TEST(DumpTest, MultipleEdges) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(DumpTest, ParallelWorkers) {
+  constexpr auto kVertexCount = 3000;
+  {
+    auto dba = this->db->Access();
+    std::vector<memgraph::storage::VertexAccessor> vertices;
+    for (auto i = 0; i < kVertexCount; ++i) {
+      vertices.push_back(CreateVertex(dba.get(), {"Label"}, {{"prop", memgraph::storage::PropertyValue(i)}}, false));
+    }
+    for (auto i = 0; i + 1 < kVertexCount; ++i) {
+      CreateEdge(dba.get(), &vertices[i], &vertices[i + 1], "EdgeType", {}, false);
+    }
+    ASSERT_FALSE(dba->Commit().HasError());
+  }
+
+  auto dump = [&](size_t num_workers, std::optional<int> pull_size) {
+    ResultStreamFaker stream(this->db->storage());
+    memgraph::query::AnyStream query_stream(&stream, memgraph::utils::NewDeleteResource());
+    auto acc = this->db->Access();
+    memgraph::query::DbAccessor dba(acc.get());
+    memgraph::query::PullPlanDump pull_plan{&dba, this->db, num_workers};
+    while (!pull_plan.Pull(&query_stream, pull_size)) {
+    }
+    std::vector<std::string> statements;
+    for (const auto &row : stream.GetResults()) {
+      statements.push_back(row[0].ValueString());
+    }
+    return statements;
+  };
+
+  const auto sequential = dump(1, std::nullopt);
+  // Internal index, vertices, edges and the internal index cleanup
+  ASSERT_EQ(sequential.size(), 2 * kVertexCount + 2);
+  EXPECT_EQ(dump(4, std::nullopt), sequential);
+  EXPECT_EQ(dump(4, 777), sequential);
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TYPED_TEST(DumpTest, EdgeWithProperties) {
   {
@@ -1320,7 +1357,7 @@ TYPED_TEST(DumpTest, DumpDatabaseWithTriggers) {
     const std::string trigger_statement = "UNWIND createdVertices AS newNodes SET newNodes.created = timestamp()";
     memgraph::query::TriggerEventType trigger_event_type = memgraph::query::TriggerEventType::VERTEX_CREATE;
     memgraph::query::TriggerPhase trigger_phase = memgraph::query::TriggerPhase::AFTER_COMMIT;
-    memgraph::utils::SkipList<memgraph::query::QueryCacheEntry> ast_cache;
+    memgraph::query::AstCache ast_cache{1000};
     memgraph::query::AllowEverythingAuthChecker auth_checker;
     memgraph::query::InterpreterConfig::Query query_config;
     memgraph::query::DbAccessor dba(acc.get());
@@ -26,6 +26,7 @@
 #include "query/frontend/ast/ast.hpp"
 #include "query/frontend/opencypher/parser.hpp"
 #include "query/interpret/awesome_memgraph_functions.hpp"
+#include "query/interpret/compiled_expression.hpp"
 #include "query/interpret/eval.hpp"
 #include "query/interpret/frame.hpp"
 #include "query/path.hpp"
@@ -865,6 +866,37 @@ TYPED_TEST(ExpressionEvaluatorTest, ListLiteral) {
   ;
 }
 
+TYPED_TEST(ExpressionEvaluatorTest, ListLiteralAllocatesOnlyItsElements) {
+  // Counts the allocations, so we can check that the evaluated list isn't
+  // copied once more into the result.
+  class CountingMemory final : public memgraph::utils::MemoryResource {
+   public:
+    size_t allocations{0};
+
+   private:
+    void *DoAllocate(size_t bytes, size_t alignment) override {
+      ++allocations;
+      return memgraph::utils::NewDeleteResource()->Allocate(bytes, alignment);
+    }
+    void DoDeallocate(void *p, size_t bytes, size_t alignment) override {
+      memgraph::utils::NewDeleteResource()->Deallocate(p, bytes, alignment);
+    }
+    bool DoIsEqual(const memgraph::utils::MemoryResource &other) const noexcept override { return this == &other; }
+  };
+  CountingMemory memory;
+  EvaluationContext ctx{.memory = &memory};
+  ExpressionEvaluator eval{&this->frame, this->symbol_table, ctx, &this->dba, memgraph::storage::View::OLD};
+  auto *list_literal = this->storage.template Create<ListLiteral>(std::vector<Expression *>{
+      this->storage.template Create<PrimitiveLiteral>(1), this->storage.template Create<PrimitiveLiteral>("short"),
+      this->storage.template Create<PrimitiveLiteral>(true)});
+  auto result = list_literal->Accept(eval);
+  ASSERT_TRUE(result.IsList());
+  EXPECT_EQ(result.ValueList().size(), 3);
+  // Strings of up to 15 characters are kept inline, so only the storage of the
+  // list is allocated.
+  EXPECT_EQ(memory.allocations, 1);
+}
+
 TYPED_TEST(ExpressionEvaluatorTest, ParameterLookup) {
   this->ctx.parameters.Add(0, memgraph::storage::PropertyValue(42));
   auto *param_lookup = this->storage.template Create<ParameterLookup>(0);
@@ -873,6 +905,21 @@ TYPED_TEST(ExpressionEvaluatorTest, ParameterLookup) {
   EXPECT_EQ(value.ValueInt(), 42);
 }
 
+TYPED_TEST(ExpressionEvaluatorTest, ConstantFunctionIsEvaluatedOnce) {
+  this->ctx.parameters.Add(0, memgraph::storage::PropertyValue("a"));
+  auto *constant = FN("TOUPPER", this->storage.template Create<ParameterLookup>(0));
+  constant->constant_ = true;
+  auto *function = FN("TOUPPER", this->storage.template Create<ParameterLookup>(0));
+  EXPECT_EQ(this->Eval(constant).ValueString(), "A");
+  // The cached result outlives the memory of the pull and doesn't see the
+  // changed parameter.
+  this->mem.Release();
+  this->ctx.parameters = memgraph::query::Parameters{};
+  this->ctx.parameters.Add(0, memgraph::storage::PropertyValue("b"));
+  EXPECT_EQ(this->Eval(constant).ValueString(), "A");
+  EXPECT_EQ(this->Eval(function).ValueString(), "B");
+}
+
 TYPED_TEST(ExpressionEvaluatorTest, FunctionAll1) {
   AstStorage storage;
   auto *ident_x = IDENT("x");
@@ -1224,6 +1271,19 @@ TYPED_TEST(ExpressionEvaluatorTest, RegexMatch) {
   EXPECT_TRUE(this->Eval(this->storage.template Create<RegexMatch>(LITERAL("text"), LITERAL(".+[ext]"))).ValueBool());
 }
 
+TYPED_TEST(ExpressionEvaluatorTest, RegexMatchReusesPattern) {
+  // The same pattern is compiled once and used against different strings
+  auto *first = this->storage.template Create<RegexMatch>(LITERAL("text"), LITERAL("t.*t"));
+  auto *second = this->storage.template Create<RegexMatch>(LITERAL("tax"), LITERAL("t.*t"));
+  for (auto i = 0; i < 3; ++i) {
+    EXPECT_TRUE(this->Eval(first).ValueBool());
+    EXPECT_FALSE(this->Eval(second).ValueBool());
+  }
+  EXPECT_THROW(this->Eval(this->storage.template Create<RegexMatch>(LITERAL("text"), LITERAL("[ext"))),
+               QueryRuntimeException);
+  EXPECT_TRUE(this->Eval(first).ValueBool());
+}
+
 template <typename StorageType>
 class ExpressionEvaluatorPropertyLookup : public ExpressionEvaluatorTest<StorageType> {
  protected:
@@ -1471,6 +1531,59 @@ TYPED_TEST(ExpressionEvaluatorPropertyLookup, Map) {
   EXPECT_TRUE(this->Value(this->prop_height).IsNull());
 }
 
+TYPED_TEST(ExpressionEvaluatorPropertyLookup, CompiledExpression) {
+  auto v1 = this->dba.InsertVertex();
+  ASSERT_TRUE(v1.SetProperty(this->prop_age.second, memgraph::storage::PropertyValue(10)).HasValue());
+  this->dba.AdvanceCommand();
+  this->frame[this->symbol] = TypedValue(v1);
+  auto lookup = [this](const std::string &name) {
+    return this->storage.template Create<PropertyLookup>(this->identifier, this->storage.GetPropertyIx(name));
+  };
+  auto evaluate = [this](Expression *expression) {
+    auto compiled = CompiledExpression::Compile(expression, this->symbol_table);
+    EXPECT_TRUE(compiled);
+    if (!compiled) return std::optional<TypedValue>{};
+    this->ctx.properties = NamesToProperties(this->storage.properties_, &this->dba);
+    return compiled->Evaluate(this->frame, this->ctx, memgraph::storage::View::OLD);
+  };
+
+  std::vector<Expression *> expressions{
+      this->storage.template Create<LessOperator>(lookup("age"), LITERAL(20)),
+      this->storage.template Create<AndOperator>(
+          this->storage.template Create<GreaterEqualOperator>(lookup("age"), LITERAL(10.0)),
+          this->storage.template Create<NotEqualOperator>(lookup("age"), LITERAL("ten"))),
+      this->storage.template Create<AdditionOperator>(
+          this->storage.template Create<MultiplicationOperator>(lookup("age"), LITERAL(3)), LITERAL(0.5)),
+      this->storage.template Create<ModOperator>(lookup("age"), LITERAL(4)),
+      this->storage.template Create<EqualOperator>(lookup("height"), LITERAL(1)),
+      this->storage.template Create<OrOperator>(
+          LITERAL(true), this->storage.template Create<DivisionOperator>(lookup("age"), LITERAL(0))),
+      this->storage.template Create<IsNullOperator>(
+          this->storage.template Create<UnaryMinusOperator>(lookup("height")))};
+  for (auto *expression : expressions) {
+    auto value = evaluate(expression);
+    ASSERT_TRUE(value);
+    EXPECT_TRUE(TypedValue::BoolEqual{}(*value, this->Eval(expression)));
+  }
+
+  auto *filter = this->storage.template Create<LessOperator>(lookup("height"), LITERAL(20));
+  auto compiled_filter = CompiledExpression::Compile(filter, this->symbol_table);
+  ASSERT_TRUE(compiled_filter);
+  EXPECT_EQ(compiled_filter->EvaluateFilter(this->frame, this->ctx, memgraph::storage::View::OLD), false);
+
+  // Errors and the values which aren't handled are left to the evaluator.
+  auto *division = this->storage.template Create<DivisionOperator>(lookup("age"), LITERAL(0));
+  EXPECT_FALSE(evaluate(division));
+  EXPECT_THROW(this->Eval(division), QueryRuntimeException);
+  auto *concatenation = this->storage.template Create<AdditionOperator>(lookup("age"), LITERAL("years"));
+  EXPECT_FALSE(evaluate(concatenation));
+  EXPECT_EQ(this->Eval(concatenation).ValueString(), "10years");
+
+  EXPECT_FALSE(CompiledExpression::Compile(lookup("age"), this->symbol_table));
+  EXPECT_FALSE(CompiledExpression::Compile(
+      this->storage.template Create<RegexMatch>(lookup("name"), LITERAL(".*")), this->symbol_table));
+}
+
 template <typename StorageType>
 class ExpressionEvaluatorAllPropertiesLookup : public ExpressionEvaluatorTest<StorageType> {
  protected:
@@ -1729,6 +1842,13 @@ TYPED_TEST(FunctionTest, Degree) {
   ASSERT_EQ(this->EvaluateFunction("DEGREE", v3).ValueInt(), 1);
   ASSERT_THROW(this->EvaluateFunction("DEGREE", 2), QueryRuntimeException);
   ASSERT_THROW(this->EvaluateFunction("DEGREE", *e12), QueryRuntimeException);
+  ASSERT_EQ(this->EvaluateFunction("DEGREE", v1, "t").ValueInt(), 1);
+  ASSERT_EQ(this->EvaluateFunction("DEGREE", v2, "t").ValueInt(), 2);
+  ASSERT_EQ(this->EvaluateFunction("DEGREE", v3, "t").ValueInt(), 1);
+  ASSERT_EQ(this->EvaluateFunction("DEGREE", v2, "u").ValueInt(), 0);
+  // A missing edge type isn't created by the read.
+  ASSERT_FALSE(this->dba.NameToEdgeTypeIfExists("u"));
+  ASSERT_THROW(this->EvaluateFunction("DEGREE", v1, 2), QueryRuntimeException);
 }
 
 TYPED_TEST(FunctionTest, InDegree) {
@@ -1746,6 +1866,12 @@ TYPED_TEST(FunctionTest, InDegree) {
   ASSERT_EQ(this->EvaluateFunction("INDEGREE", v3).ValueInt(), 0);
   ASSERT_THROW(this->EvaluateFunction("INDEGREE", 2), QueryRuntimeException);
   ASSERT_THROW(this->EvaluateFunction("INDEGREE", *e12), QueryRuntimeException);
+  ASSERT_EQ(this->EvaluateFunction("INDEGREE", v1, "t").ValueInt(), 0);
+  ASSERT_EQ(this->EvaluateFunction("INDEGREE", v2, "t").ValueInt(), 2);
+  ASSERT_EQ(this->EvaluateFunction("INDEGREE", v3, "t").ValueInt(), 0);
+  ASSERT_EQ(this->EvaluateFunction("INDEGREE", v2, "u").ValueInt(), 0);
+  ASSERT_FALSE(this->dba.NameToEdgeTypeIfExists("u"));
+  ASSERT_THROW(this->EvaluateFunction("INDEGREE", v1, 2), QueryRuntimeException);
 }
 
 TYPED_TEST(FunctionTest, OutDegree) {
@@ -1763,6 +1889,12 @@ TYPED_TEST(FunctionTest, OutDegree) {
   ASSERT_EQ(this->EvaluateFunction("OUTDEGREE", v3).ValueInt(), 1);
   ASSERT_THROW(this->EvaluateFunction("OUTDEGREE", 2), QueryRuntimeException);
   ASSERT_THROW(this->EvaluateFunction("OUTDEGREE", *e12), QueryRuntimeException);
+  ASSERT_EQ(this->EvaluateFunction("OUTDEGREE", v1, "t").ValueInt(), 1);
+  ASSERT_EQ(this->EvaluateFunction("OUTDEGREE", v2, "t").ValueInt(), 0);
+  ASSERT_EQ(this->EvaluateFunction("OUTDEGREE", v3, "t").ValueInt(), 1);
+  ASSERT_EQ(this->EvaluateFunction("OUTDEGREE", v2, "u").ValueInt(), 0);
+  ASSERT_FALSE(this->dba.NameToEdgeTypeIfExists("u"));
+  ASSERT_THROW(this->EvaluateFunction("OUTDEGREE", v1, 2), QueryRuntimeException);
 }
 
 TYPED_TEST(FunctionTest, ToBoolean) {
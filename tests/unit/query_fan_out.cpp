@@ -0,0 +1,84 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "query/exceptions.hpp"
+#include "query/fan_out.hpp"
+#include "query/frontend/ast/ast.hpp"
+
+#include "query_common.hpp"
+
+using namespace memgraph::query;
+using Column = FanOutMerger::Column;
+using ::testing::ElementsAre;
+
+class FanOutTest : public ::testing::Test {
+ protected:
+  AstStorage storage;
+};
+
+TEST_F(FanOutTest, Columns) {
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n"))),
+                                   RETURN(IDENT("n"), AS("n"), COUNT(IDENT("n"), false), AS("c"),
+                                          SUM(IDENT("n"), false), AS("s"))));
+  auto columns = FanOutMerger::Columns(*query);
+  ASSERT_TRUE(columns);
+  EXPECT_THAT(*columns, ElementsAre(Column::KEY, Column::COUNT, Column::SUM));
+}
+
+TEST_F(FanOutTest, ColumnsWithoutAggregation) {
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n"))), RETURN(IDENT("n"), AS("n"))));
+  EXPECT_FALSE(FanOutMerger::Columns(*query));
+}
+
+TEST_F(FanOutTest, UnmergeableColumns) {
+  auto *nested =
+      QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n"))), RETURN(ADD(COUNT(IDENT("n"), false), LITERAL(1)), AS("c"))));
+  EXPECT_THROW(FanOutMerger::Columns(*nested), SemanticException);
+  auto *distinct = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n"))), RETURN(COUNT(IDENT("n"), true), AS("c"))));
+  EXPECT_THROW(FanOutMerger::Columns(*distinct), SemanticException);
+  auto *avg = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n"))), RETURN(AVG(IDENT("n"), false), AS("a"))));
+  EXPECT_THROW(FanOutMerger::Columns(*avg), SemanticException);
+  auto *limit = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n"))), RETURN(IDENT("n"), AS("n"), LIMIT(LITERAL(1)))));
+  EXPECT_THROW(FanOutMerger::Columns(*limit), SemanticException);
+}
+
+TEST_F(FanOutTest, MergeAggregations) {
+  FanOutMerger merger(std::vector{Column::KEY, Column::COUNT, Column::MIN, Column::MAX});
+  merger.Add({TypedValue("a"), TypedValue(2), TypedValue(3), TypedValue(3)});
+  merger.Add({TypedValue("b"), TypedValue(1), TypedValue(), TypedValue()});
+  merger.Add({TypedValue("a"), TypedValue(4), TypedValue(1), TypedValue(2)});
+  merger.Add({TypedValue("b"), TypedValue(0), TypedValue(5), TypedValue(5)});
+
+  auto rows = std::move(merger).Rows();
+  ASSERT_EQ(rows.size(), 2);
+  EXPECT_EQ(rows[0][0].ValueString(), "a");
+  EXPECT_EQ(rows[0][1].ValueInt(), 6);
+  EXPECT_EQ(rows[0][2].ValueInt(), 1);
+  EXPECT_EQ(rows[0][3].ValueInt(), 3);
+  EXPECT_EQ(rows[1][0].ValueString(), "b");
+  EXPECT_EQ(rows[1][1].ValueInt(), 1);
+  EXPECT_EQ(rows[1][2].ValueInt(), 5);
+  EXPECT_EQ(rows[1][3].ValueInt(), 5);
+}
+
+TEST_F(FanOutTest, ConcatenateRows) {
+  FanOutMerger merger(std::nullopt);
+  merger.Add({TypedValue(1)});
+  merger.Add({TypedValue(1)});
+  merger.Add({TypedValue(2)});
+  auto rows = std::move(merger).Rows();
+  ASSERT_EQ(rows.size(), 3);
+  EXPECT_EQ(rows[2][0].ValueInt(), 2);
+}
@@ -0,0 +1,97 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "query/fingerprint_metrics.hpp"
+#include "query/hot_queries.hpp"
+
+using memgraph::query::QueryFingerprintMetrics;
+
+TEST(QueryFingerprintMetrics, AggregatesExecutions) {
+  QueryFingerprintMetrics metrics;
+  metrics.Record(1, "MATCH (n) RETURN n", {.latency_us = 100, .rows = 3, .peak_memory = 10, .plan_cache_hit = false},
+                 10);
+  metrics.Record(1, "MATCH (n) RETURN n", {.latency_us = 300, .rows = 2, .peak_memory = 40, .plan_cache_hit = true},
+                 10);
+
+  auto fingerprints = metrics.Fingerprints();
+  ASSERT_EQ(fingerprints.size(), 1);
+  const auto &stats = fingerprints[0];
+  EXPECT_EQ(stats.fingerprint, 1);
+  EXPECT_EQ(stats.query, "MATCH (n) RETURN n");
+  EXPECT_EQ(stats.executions, 2);
+  EXPECT_EQ(stats.rows, 5);
+  EXPECT_EQ(stats.peak_memory, 40);
+  EXPECT_EQ(stats.plan_cache_hits, 1);
+  EXPECT_EQ(stats.plan_cache_misses, 1);
+  EXPECT_EQ(stats.latency_sum_us, 400);
+  EXPECT_FALSE(stats.latency_percentiles_us.empty());
+}
+
+TEST(QueryFingerprintMetrics, ReplacesTheLeastExecutedFingerprint) {
+  QueryFingerprintMetrics metrics;
+  metrics.Record(1, "RETURN 1", {}, 2);
+  metrics.Record(1, "RETURN 1", {}, 2);
+  metrics.Record(2, "RETURN 2", {}, 2);
+  metrics.Record(3, "RETURN 3", {}, 2);
+
+  auto fingerprints = metrics.Fingerprints();
+  ASSERT_EQ(fingerprints.size(), 2);
+  EXPECT_EQ(fingerprints[0].fingerprint, 1);
+  EXPECT_EQ(fingerprints[1].fingerprint, 3);
+
+  metrics.Record(4, "RETURN 4", {}, 0);
+  EXPECT_EQ(metrics.Fingerprints().size(), 2);
+}
+
+TEST(QueryFingerprintMetrics, Prometheus) {
+  QueryFingerprintMetrics metrics;
+  metrics.Record(7, "RETURN \"a\"", {.latency_us = 50, .rows = 1}, 10);
+
+  const auto text = memgraph::query::QueryFingerprintsToPrometheus(metrics.Fingerprints());
+  EXPECT_THAT(text, testing::HasSubstr("# TYPE memgraph_query_fingerprint_latency_us summary\n"));
+  EXPECT_THAT(text,
+              testing::HasSubstr("memgraph_query_fingerprint_info{fingerprint=\"7\",query=\"RETURN \\\"a\\\"\"} 1\n"));
+  EXPECT_THAT(text, testing::HasSubstr("memgraph_query_fingerprint_latency_us_count{fingerprint=\"7\"} 1\n"));
+  EXPECT_THAT(text, testing::HasSubstr("memgraph_query_fingerprint_rows_total{fingerprint=\"7\"} 1\n"));
+  EXPECT_THAT(text, testing::HasSubstr("memgraph_query_fingerprint_plan_cache_misses_total{fingerprint=\"7\"} 1\n"));
+  EXPECT_TRUE(memgraph::query::QueryFingerprintsToPrometheus({}).empty());
+}
+
+TEST(QueryFingerprintMetrics, MostExecutedQueries) {
+  auto &metrics = memgraph::query::GlobalQueryFingerprintMetrics();
+  metrics.Clear();
+  metrics.Record(1, "RETURN 1", {}, 10);
+  metrics.Record(2, "RETURN 2", {}, 10);
+  metrics.Record(2, "RETURN 2", {}, 10);
+  metrics.Record(3, "RETURN 3", {}, 10);
+  metrics.Record(3, "RETURN 3", {}, 10);
+  metrics.Record(3, "RETURN 3", {}, 10);
+
+  EXPECT_THAT(memgraph::query::MostExecutedQueries(2), testing::ElementsAre("RETURN 3", "RETURN 2"));
+  EXPECT_EQ(memgraph::query::MostExecutedQueries(10).size(), 3);
+  EXPECT_TRUE(memgraph::query::MostExecutedQueries(0).empty());
+  metrics.Clear();
+}
+
+TEST(QueryFingerprintMetrics, HotQueriesAreTakenOnce) {
+  memgraph::query::HotQueries hot_queries;
+  EXPECT_FALSE(hot_queries.Take());
+
+  hot_queries.Set({"RETURN 1"});
+  hot_queries.Set({"RETURN 2", "RETURN 3"});
+  auto queries = hot_queries.Take();
+  ASSERT_TRUE(queries);
+  EXPECT_THAT(*queries, testing::ElementsAre("RETURN 2", "RETURN 3"));
+  EXPECT_FALSE(hot_queries.Take());
+}
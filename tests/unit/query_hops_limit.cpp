@@ -0,0 +1,86 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "query/hops_limit.hpp"
+
+using memgraph::query::HopsLimit;
+
+TEST(HopsLimit, TakeHops) {
+  HopsLimit hops_limit{.limit = 5};
+  EXPECT_EQ(hops_limit.TakeHops(3), 3);
+  EXPECT_EQ(hops_limit.TakeHops(3), 2);
+  EXPECT_FALSE(hops_limit.IsLimitReached());
+  EXPECT_EQ(hops_limit.TakeHops(0), 0);
+  EXPECT_FALSE(hops_limit.IsLimitReached());
+  EXPECT_EQ(hops_limit.TakeHops(1), 0);
+  EXPECT_TRUE(hops_limit.IsLimitReached());
+}
+
+TEST(HopsLimit, UnusedWorkerLimit) {
+  HopsLimit hops_limit;
+  auto worker = hops_limit.ForWorker();
+  EXPECT_FALSE(worker.IsUsed());
+  EXPECT_FALSE(hops_limit.shared);
+}
+
+TEST(HopsLimit, WorkersShareTheLeftHops) {
+  HopsLimit hops_limit{.limit = 10};
+  hops_limit.IncrementHopsCount(4);
+  auto first = hops_limit.ForWorker();
+  auto second = hops_limit.ForWorker();
+  EXPECT_EQ(first.TakeHops(5), 5);
+  // The first worker reserved all of the hops which were left.
+  EXPECT_EQ(second.TakeHops(1), 0);
+  EXPECT_TRUE(second.IsLimitReached());
+  // Once a worker reached the limit, nothing more is handed out.
+  first.ReleaseReservation();
+  EXPECT_TRUE(hops_limit.IsLimitReached());
+  EXPECT_EQ(hops_limit.TakeHops(1), 0);
+}
+
+TEST(HopsLimit, ReleasedHopsAreReservedAgain) {
+  HopsLimit hops_limit{.limit = 2 * HopsLimit::kSharedReservation};
+  auto first = hops_limit.ForWorker();
+  auto second = hops_limit.ForWorker();
+  first.IncrementHopsCount(1);
+  second.IncrementHopsCount(1);
+  first.ReleaseReservation();
+  EXPECT_EQ(second.TakeHops(HopsLimit::kSharedReservation), HopsLimit::kSharedReservation);
+  EXPECT_FALSE(second.IsLimitReached());
+}
+
+TEST(HopsLimit, ConcurrentWorkersDontExceedTheLimit) {
+  constexpr int64_t kLimit = 100'000;
+  constexpr int kWorkers = 8;
+  HopsLimit hops_limit{.limit = kLimit};
+  std::atomic<int64_t> expanded{0};
+  {
+    std::vector<std::jthread> threads;
+    for (int i = 0; i < kWorkers; ++i) {
+      threads.emplace_back([&expanded, worker = hops_limit.ForWorker()]() mutable {
+        while (!worker.IsLimitReached()) {
+          worker.IncrementHopsCount(1);
+          if (!worker.IsLimitReached()) expanded.fetch_add(1, std::memory_order_relaxed);
+        }
+      });
+    }
+  }
+  EXPECT_TRUE(hops_limit.IsLimitReached());
+  EXPECT_LE(expanded.load(), kLimit);
+  EXPECT_GE(expanded.load(), kLimit - kWorkers * HopsLimit::kSharedReservation);
+}
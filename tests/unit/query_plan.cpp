@@ -183,6 +183,38 @@ TYPED_TEST(TestPlanner, MatchLabeledNodes) {
   }
 }
 
+TYPED_TEST(TestPlanner, MatchLabeledNodesCount) {
+  // Test MATCH (n :label) RETURN count(n) AS c
+  FakeDbAccessor dba;
+  auto label = "label";
+  dba.SetIndexCount(dba.Label(label), 0);
+  {
+    auto count = COUNT(IDENT("n"), false);
+    auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", label))), RETURN(count, AS("c"))));
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+    CheckPlan(planner.plan(), symbol_table, ExpectScanAllByLabel(), ExpectCountVertices(), ExpectProduce());
+  }
+  {
+    // Test MATCH (n :label) RETURN count(*) AS c
+    auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", label))), RETURN(COUNT(nullptr, false), AS("c"))));
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+    CheckPlan(planner.plan(), symbol_table, ExpectScanAllByLabel(), ExpectCountVertices(), ExpectProduce());
+  }
+  {
+    // Test MATCH (n :label) RETURN n.prop AS p, count(n) AS c
+    auto prop = dba.Property("prop");
+    auto count = COUNT(IDENT("n"), false);
+    auto n_prop = PROPERTY_LOOKUP(dba, "n", prop);
+    auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", label))), RETURN(n_prop, AS("p"), count, AS("c"))));
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+    CheckPlan(planner.plan(), symbol_table, ExpectScanAllByLabel(), ExpectAggregate({count}, {n_prop}),
+              ExpectProduce());
+  }
+}
+
 TYPED_TEST(TestPlanner, MatchPathReturn) {
   // Test MATCH (n) -[r :relationship]- (m) RETURN n
   FakeDbAccessor dba;
@@ -636,6 +668,55 @@ TYPED_TEST(TestPlanner, MatchReturnOrderBy) {
   CheckPlan(planner.plan(), symbol_table, ExpectScanAll(), ExpectProduce(), ExpectOrderBy());
 }
 
+TYPED_TEST(TestPlanner, MatchReturnOrderBySkipLimit) {
+  // Test MATCH (n) RETURN n ORDER BY n.prop SKIP 2 LIMIT 3
+  FakeDbAccessor dba;
+  auto prop = dba.Property("prop");
+  auto *as_n = NEXPR("n", IDENT("n"));
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n"))), RETURN(as_n, ORDER_BY(PROPERTY_LOOKUP(dba, "n", prop)),
+                                                                     SKIP(LITERAL(2)), LIMIT(LITERAL(3)))));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAll(), ExpectProduce(), ExpectOrderBy(), ExpectSkip(),
+            ExpectLimit());
+  // OrderBy keeps only the first SKIP + LIMIT rows.
+  auto &order_by = dynamic_cast<OrderBy &>(*planner.plan().input()->input());
+  auto *skip = memgraph::utils::Downcast<PrimitiveLiteral>(order_by.skip_);
+  auto *limit = memgraph::utils::Downcast<PrimitiveLiteral>(order_by.limit_);
+  ASSERT_TRUE(skip);
+  ASSERT_TRUE(limit);
+  EXPECT_EQ(skip->value_.ValueInt(), 2);
+  EXPECT_EQ(limit->value_.ValueInt(), 3);
+}
+
+TYPED_TEST(TestPlanner, MatchOrderByPointDistanceLimit) {
+  // Test MATCH (n :label) RETURN n ORDER BY point.distance(n.loc, $0) LIMIT 3
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto loc = PROPERTY_PAIR(dba, "loc");
+  dba.SetIndexCount(label, 1);
+  auto make_query = [&] {
+    auto *as_n = NEXPR("n", IDENT("n"));
+    auto *distance = FN("point.distance", PROPERTY_LOOKUP(dba, "n", loc), PARAMETER_LOOKUP(0));
+    return QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label"))), RETURN(as_n, ORDER_BY(distance), LIMIT(LITERAL(3)))));
+  };
+  {
+    // Without a point index the label scan is kept.
+    auto *query = make_query();
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+    CheckPlan(planner.plan(), symbol_table, ExpectScanAllByLabel(), ExpectProduce(), ExpectOrderBy(), ExpectLimit());
+  }
+  {
+    dba.SetPointIndex(label, loc.second);
+    auto *query = make_query();
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+    CheckPlan(planner.plan(), symbol_table, ExpectScanAllByPointNearest(label, loc), ExpectProduce(), ExpectOrderBy(),
+              ExpectLimit());
+  }
+}
+
 TYPED_TEST(TestPlanner, CreateWithOrderByWhere) {
   // Test CREATE (n) -[r :r]-> (m)
   //      WITH n AS new ORDER BY new.prop, r.prop WHERE m.prop < 42
@@ -880,6 +961,50 @@ TYPED_TEST(TestPlanner, MatchEdgeTypeIndex) {
   }
 }
 
+TYPED_TEST(TestPlanner, MatchEdgeTypeIndexBetweenBoundNodes) {
+  FakeDbAccessor dba;
+  auto indexed_edge_type = dba.EdgeType("indexed_edgetype");
+  dba.SetIndexCount(indexed_edge_type, 1);
+  {
+    // Test MATCH (a)-[r1:not_indexed_edgetype]->(b)-[r2:indexed_edgetype]->(a) RETURN r2;
+    auto *query = QUERY(SINGLE_QUERY(
+        MATCH(PATTERN(NODE("a"), EDGE("r1", memgraph::query::EdgeAtom::Direction::OUT, {"not_indexed_edgetype"}),
+                      NODE("b"), EDGE("r2", memgraph::query::EdgeAtom::Direction::OUT, {"indexed_edgetype"}),
+                      NODE("a"))),
+        RETURN("r2")));
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+    CheckPlan(planner.plan(), symbol_table, ExpectScanAll(), ExpectExpand(), ExpectExpandByEdgeTypeIndex(),
+              ExpectEdgeUniquenessFilter(), ExpectProduce());
+  }
+  {
+    // Test MATCH (a)-[r1:indexed_edgetype]->(b)-[r2:not_indexed_edgetype]->(a) RETURN r2;
+    auto *query = QUERY(SINGLE_QUERY(
+        MATCH(PATTERN(NODE("a"), EDGE("r1", memgraph::query::EdgeAtom::Direction::OUT, {"indexed_edgetype"}),
+                      NODE("b"), EDGE("r2", memgraph::query::EdgeAtom::Direction::OUT, {"not_indexed_edgetype"}),
+                      NODE("a"))),
+        RETURN("r2")));
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+    CheckPlan(planner.plan(), symbol_table, ExpectScanAllByEdgeType(), ExpectExpand(), ExpectEdgeUniquenessFilter(),
+              ExpectProduce());
+  }
+}
+
+TYPED_TEST(TestPlanner, MatchTriangleIntersectsAdjacencyLists) {
+  // Test MATCH (a)-[r1]->(b)-[r2]->(c)-[r3]->(a) RETURN c;
+  FakeDbAccessor dba;
+  auto *query = QUERY(SINGLE_QUERY(
+      MATCH(PATTERN(NODE("a"), EDGE("r1", memgraph::query::EdgeAtom::Direction::OUT), NODE("b"),
+                    EDGE("r2", memgraph::query::EdgeAtom::Direction::OUT), NODE("c"),
+                    EDGE("r3", memgraph::query::EdgeAtom::Direction::OUT), NODE("a"))),
+      RETURN("c")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAll(), ExpectExpand(), ExpectExpandIntersection(),
+            ExpectEdgeUniquenessFilter(), ExpectEdgeUniquenessFilter(), ExpectProduce());
+}
+
 TYPED_TEST(TestPlanner, MatchEdgeTypePropertyIndexExistence) {
   FakeDbAccessor dba;
   auto edge_type = dba.EdgeType("indexed_edgetype");
@@ -1278,6 +1403,71 @@ TYPED_TEST(TestPlanner, MatchFilterPropIsNotNull) {
   }
 }
 
+TYPED_TEST(TestPlanner, MatchFilterPropertyCompositeIndex) {
+  FakeDbAccessor dba;
+  auto label = dba.Label("label");
+  auto prop_a = PROPERTY_PAIR(dba, "a");
+  auto prop_b = PROPERTY_PAIR(dba, "b");
+  auto prop_c = PROPERTY_PAIR(dba, "c");
+  dba.SetIndexCount(label, 100);
+  dba.SetIndexCount(label, prop_a.second, 10);
+  dba.SetIndexCount(label, {prop_a.second, prop_b.second, prop_c.second}, 100);
+  {
+    // Test MATCH (n :label) WHERE n.a = 1 AND n.b = 2 RETURN n
+    auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label"))),
+                                     WHERE(AND(EQ(PROPERTY_LOOKUP(dba, "n", prop_a), LITERAL(1)),
+                                               EQ(PROPERTY_LOOKUP(dba, "n", prop_b), LITERAL(2)))),
+                                     RETURN("n")));
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+    // The prefix (a, b) of the composite index covers both filters.
+    CheckPlan(planner.plan(), symbol_table,
+              ExpectScanAllByLabelPropertyCompositeValue(label, {prop_a.second, prop_b.second, prop_c.second}, 2),
+              ExpectProduce());
+  }
+  {
+    // Test MATCH (n :label) WHERE n.a = 1 AND n.c = 2 RETURN n
+    auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label"))),
+                                     WHERE(AND(EQ(PROPERTY_LOOKUP(dba, "n", prop_a), LITERAL(1)),
+                                               EQ(PROPERTY_LOOKUP(dba, "n", prop_c), LITERAL(2)))),
+                                     RETURN("n")));
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+    // Only `a` is a prefix of the composite index, so the label-property index is used.
+    CheckPlan(planner.plan(), symbol_table, ExpectScanAllByLabelPropertyValue(label, prop_a, LITERAL(1)),
+              ExpectFilter(), ExpectProduce());
+  }
+  {
+    // Test MATCH (n :label) WHERE n.a = 1 RETURN n.b AS b, n.c AS c
+    auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label"))),
+                                     WHERE(EQ(PROPERTY_LOOKUP(dba, "n", prop_a), LITERAL(1))),
+                                     RETURN(PROPERTY_LOOKUP(dba, "n", prop_b), AS("b"),
+                                            PROPERTY_LOOKUP(dba, "n", prop_c), AS("c"))));
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+    // Only the indexed properties are used, so the composite index answers the query alone.
+    CheckPlan(planner.plan(), symbol_table,
+              ExpectScanAllByLabelPropertyCompositeValue(label, {prop_a.second, prop_b.second, prop_c.second}, 1,
+                                                         true),
+              ExpectProduce());
+  }
+  {
+    // Test MATCH (n :label) WHERE n.a = 1 AND n.b = 2 RETURN n.c AS c, n.d AS d
+    auto prop_d = PROPERTY_PAIR(dba, "d");
+    auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n", "label"))),
+                                     WHERE(AND(EQ(PROPERTY_LOOKUP(dba, "n", prop_a), LITERAL(1)),
+                                               EQ(PROPERTY_LOOKUP(dba, "n", prop_b), LITERAL(2)))),
+                                     RETURN(PROPERTY_LOOKUP(dba, "n", prop_c), AS("c"),
+                                            PROPERTY_LOOKUP(dba, "n", prop_d), AS("d"))));
+    auto symbol_table = memgraph::query::MakeSymbolTable(query);
+    auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+    // `d` isn't in the index, so the vertices have to be read.
+    CheckPlan(planner.plan(), symbol_table,
+              ExpectScanAllByLabelPropertyCompositeValue(label, {prop_a.second, prop_b.second, prop_c.second}, 2),
+              ExpectProduce());
+  }
+}
+
 TYPED_TEST(TestPlanner, MatchFilterWhere) {
   // Test MATCH (n)-[r]-(m) WHERE exists((n)-[]-()) and n!=n and 7!=8 RETURN n
   auto *query = QUERY(SINGLE_QUERY(
@@ -1287,8 +1477,9 @@ TYPED_TEST(TestPlanner, MatchFilterWhere) {
                 AND(NEQ(IDENT("n"), IDENT("n")), NEQ(LITERAL(7), LITERAL(8))))),
       RETURN("n")));
 
+  // The pattern depends only on `n`, but not on `r` and `m`.
   std::list<BaseOpChecker *> pattern_filter{new ExpectScanAll(), new ExpectExpand(), new ExpectLimit(),
-                                            new ExpectEvaluatePatternFilter()};
+                                            new ExpectCorrelatedPatternFilter({"n"})};
   CheckPlan<TypeParam>(
       query, this->storage,
       ExpectFilter(),  // 7!=8
@@ -1912,6 +2103,94 @@ TYPED_TEST(TestPlanner, MatchWhereAndSplit) {
                        ExpectProduce());
 }
 
+TYPED_TEST(TestPlanner, MatchWhereReturnLoadsProperties) {
+  // Test MATCH (n) -[r]- (m) WHERE n.prop < 5 RETURN n.prop, m.prop
+  FakeDbAccessor dba;
+  auto prop = PROPERTY_PAIR(dba, "prop");
+  auto *return_n = NEXPR("n.prop", PROPERTY_LOOKUP(dba, "n", prop));
+  auto *return_m = PROPERTY_LOOKUP(dba, "m", prop);
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("n"), EDGE("r"), NODE("m"))),
+                                   WHERE(LESS(PROPERTY_LOOKUP(dba, "n", prop), LITERAL(5))),
+                                   RETURN(return_n, NEXPR("m.prop", return_m))));
+  FLAGS_query_load_properties = true;
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+  FLAGS_query_load_properties = false;
+  // `n.prop` is loaded once for the filter and the produce, `m.prop` is only
+  // looked up once.
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAll(), ExpectLoadProperties(), ExpectFilter(), ExpectExpand(),
+            ExpectProduce());
+  EXPECT_TRUE(dynamic_cast<PropertyLookup *>(return_n->expression_)->loaded_value_);
+  EXPECT_FALSE(return_m->loaded_value_);
+}
+
+TYPED_TEST(TestPlanner, MatchWhereReturnComputesCommonSubexpressions) {
+  // Test MATCH (n) WHERE n.a + n.b > 5 RETURN n.a + n.b, n.a
+  FakeDbAccessor dba;
+  auto prop_a = PROPERTY_PAIR(dba, "a");
+  auto prop_b = PROPERTY_PAIR(dba, "b");
+  auto *return_sum = NEXPR("sum", ADD(PROPERTY_LOOKUP(dba, "n", prop_a), PROPERTY_LOOKUP(dba, "n", prop_b)));
+  auto *return_a = NEXPR("n.a", PROPERTY_LOOKUP(dba, "n", prop_a));
+  auto *query = QUERY(SINGLE_QUERY(
+      MATCH(PATTERN(NODE("n"))),
+      WHERE(GREATER(ADD(PROPERTY_LOOKUP(dba, "n", prop_a), PROPERTY_LOOKUP(dba, "n", prop_b)), LITERAL(5))),
+      RETURN(return_sum, return_a)));
+  FLAGS_query_common_subexpressions = true;
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+  FLAGS_query_common_subexpressions = false;
+  // The sum is computed once below the filter, `n.a` alone isn't repeated.
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAll(), ExpectComputeExpressions(), ExpectFilter(),
+            ExpectProduce());
+  EXPECT_TRUE(dynamic_cast<Identifier *>(return_sum->expression_));
+  EXPECT_TRUE(dynamic_cast<PropertyLookup *>(return_a->expression_));
+}
+
+TYPED_TEST(TestPlanner, ConditionalExpressionIsComputedAboveFilter) {
+  // Test MATCH (n) WHERE n.a = 0 OR n.b / n.a > 1 RETURN n.b / n.a, n.b / n.a
+  FakeDbAccessor dba;
+  auto prop_a = PROPERTY_PAIR(dba, "a");
+  auto prop_b = PROPERTY_PAIR(dba, "b");
+  auto division = [&] {
+    return this->storage.template Create<memgraph::query::DivisionOperator>(PROPERTY_LOOKUP(dba, "n", prop_b),
+                                                                            PROPERTY_LOOKUP(dba, "n", prop_a));
+  };
+  auto *query = QUERY(SINGLE_QUERY(
+      MATCH(PATTERN(NODE("n"))),
+      WHERE(OR(EQ(PROPERTY_LOOKUP(dba, "n", prop_a), LITERAL(0)), GREATER(division(), LITERAL(1)))),
+      RETURN(NEXPR("x", division()), NEXPR("y", division()))));
+  FLAGS_query_common_subexpressions = true;
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+  FLAGS_query_common_subexpressions = false;
+  // The filter divides only when `n.a` isn't 0, so the division is computed
+  // for the rows it passes.
+  CheckPlan(planner.plan(), symbol_table, ExpectScanAll(), ExpectFilter(), ExpectComputeExpressions(),
+            ExpectProduce());
+}
+
+TYPED_TEST(TestPlanner, FoldConstantFunctions) {
+  // Test MATCH (n) RETURN toLower($0), toLower(n.name), rand(), size([1, abs(-1)]), sum(abs(1))
+  FakeDbAccessor dba;
+  auto prop = PROPERTY_PAIR(dba, "name");
+  auto *lower_parameter = FN("toLower", PARAMETER_LOOKUP(0));
+  auto *lower_property = FN("toLower", PROPERTY_LOOKUP(dba, "n", prop));
+  auto *random = FN("rand");
+  auto *abs = FN("abs", LITERAL(-1));
+  auto *size = FN("size", LIST(LITERAL(1), abs));
+  auto *abs_aggregated = FN("abs", LITERAL(1));
+  auto *query = QUERY(SINGLE_QUERY(
+      MATCH(PATTERN(NODE("n"))), RETURN(NEXPR("a", lower_parameter), NEXPR("b", lower_property), NEXPR("c", random),
+                                        NEXPR("d", size), NEXPR("e", SUM(abs_aggregated, false)))));
+  FoldConstantFunctions(query);
+  EXPECT_TRUE(lower_parameter->constant_);
+  EXPECT_FALSE(lower_property->constant_);
+  EXPECT_FALSE(random->constant_);
+  EXPECT_TRUE(abs->constant_);
+  EXPECT_TRUE(size->constant_);
+  EXPECT_TRUE(abs_aggregated->constant_);
+}
+
 TYPED_TEST(TestPlanner, ReturnAsteriskOmitsLambdaSymbols) {
   // Test MATCH (n) -[r* (ie, in | true)]- (m) RETURN *
   FakeDbAccessor dba;
@@ -2869,6 +3148,41 @@ TYPED_TEST(TestPlanner, PeriodicCommitLoadCsvNestedWholeQuery) {
   DeleteListContent(&subquery_plan);
 }
 
+TYPED_TEST(TestPlanner, LoadCsvLooksUpOnlyUsedColumns) {
+  // Test LOAD CSV FROM "x" WITH HEADER AS row RETURN row.a AS a, row.b AS b, row.a AS c;
+  FakeDbAccessor dba;
+
+  auto *query = QUERY(SINGLE_QUERY(LOAD_CSV(LITERAL("temp"), "row"),
+                                   RETURN(PROPERTY_LOOKUP(dba, IDENT("row"), "a"), AS("a"),
+                                          PROPERTY_LOOKUP(dba, IDENT("row"), "b"), AS("b"),
+                                          PROPERTY_LOOKUP(dba, IDENT("row"), "a"), AS("c"))));
+
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+
+  CheckPlan(planner.plan(), symbol_table, ExpectLoadCsv(), ExpectProduce());
+  auto *load_csv = dynamic_cast<LoadCsv *>(planner.plan().input().get());
+  ASSERT_TRUE(load_csv);
+  ASSERT_TRUE(load_csv->columns_);
+  EXPECT_EQ(*load_csv->columns_, (std::vector<std::string>{"a", "b"}));
+}
+
+TYPED_TEST(TestPlanner, LoadCsvKeepsAllColumnsOfWholeRow) {
+  // Test LOAD CSV FROM "x" WITH HEADER AS row RETURN row.a AS a, row;
+  FakeDbAccessor dba;
+
+  auto *query = QUERY(SINGLE_QUERY(LOAD_CSV(LITERAL("temp"), "row"),
+                                   RETURN(PROPERTY_LOOKUP(dba, IDENT("row"), "a"), AS("a"), IDENT("row"), AS("row"))));
+
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto planner = MakePlanner<TypeParam>(&dba, this->storage, symbol_table, query);
+
+  CheckPlan(planner.plan(), symbol_table, ExpectLoadCsv(), ExpectProduce());
+  auto *load_csv = dynamic_cast<LoadCsv *>(planner.plan().input().get());
+  ASSERT_TRUE(load_csv);
+  EXPECT_FALSE(load_csv->columns_);
+}
+
 TYPED_TEST(TestPlanner, PeriodicCommitCreateCallProcedure) {
   // Test USING PERIODIC COMMIT 1 CALL migrate.migrate() YIELD result CREATE (n);
   FakeDbAccessor dba;
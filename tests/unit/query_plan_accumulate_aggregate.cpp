@@ -11,6 +11,7 @@
 
 #include <algorithm>
 #include <iterator>
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -402,6 +403,60 @@ TYPED_TEST(QueryPlanTest, AggregateMultipleGroupBy) {
   EXPECT_EQ(results.size(), 2 * 3 * 5);
 }
 
+TYPED_TEST(QueryPlanTest, AggregateOverGather) {
+  // Aggregating a Gather's input on the workers must give the same groups
+  // and values as aggregating a plain scan.
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  auto group_prop = dba.NameToProperty("group");
+  auto value_prop = dba.NameToProperty("value");
+  for (int i = 0; i < 1000; ++i) {
+    auto v = dba.InsertVertex();
+    ASSERT_TRUE(v.SetProperty(group_prop, memgraph::storage::PropertyValue(i % 7)).HasValue());
+    // leave some values null, they are skipped by all aggregations except COUNT(*)
+    if (i % 10 != 0) ASSERT_TRUE(v.SetProperty(value_prop, memgraph::storage::PropertyValue(i)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  const std::vector<Aggregation::Op> ops{Aggregation::Op::COUNT, Aggregation::Op::COUNT, Aggregation::Op::MIN,
+                                         Aggregation::Op::MAX,   Aggregation::Op::SUM,   Aggregation::Op::AVG,
+                                         Aggregation::Op::COLLECT_LIST};
+  auto aggregate = [&](bool parallel) {
+    SymbolTable symbol_table;
+    auto n = MakeScanAll(this->storage, symbol_table, "n");
+    auto n_group = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), group_prop);
+    auto n_value = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), value_prop);
+    std::vector<Expression *> aggregation_expressions(ops.size(), n_value);
+    aggregation_expressions[0] = nullptr;
+    std::shared_ptr<LogicalOperator> input = n.op_;
+    if (parallel) input = std::make_shared<Gather>(input, std::nullopt, memgraph::storage::View::OLD, 4);
+    auto produce =
+        this->MakeAggregationProduce(input, symbol_table, aggregation_expressions, ops, {n_group}, {}, false);
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    std::map<int64_t, std::vector<TypedValue>> results;
+    for (auto &row : CollectProduce(*produce, &context)) {
+      auto group = row.back().ValueInt();
+      results.emplace(group, std::move(row));
+    }
+    return results;
+  };
+
+  auto expected = aggregate(false);
+  auto results = aggregate(true);
+  ASSERT_EQ(results.size(), 7);
+  ASSERT_EQ(expected.size(), results.size());
+  for (auto &[group, row] : results) {
+    const auto &expected_row = expected.at(group);
+    ASSERT_EQ(row.size(), expected_row.size());
+    for (size_t i = 0; i < 5; ++i) {
+      EXPECT_TRUE(TypedValue::BoolEqual{}(row[i], expected_row[i])) << "group " << group << ", column " << i;
+    }
+    EXPECT_FLOAT_EQ(row[5].ValueDouble(), expected_row[5].ValueDouble());
+    EXPECT_THAT(ToIntList(row[6]), testing::UnorderedElementsAreArray(ToIntList(expected_row[6])));
+  }
+}
+
 TYPED_TEST(QueryPlanTest, AggregateNoInput) {
   auto storage_dba = this->db->Access();
   memgraph::query::DbAccessor dba(storage_dba.get());
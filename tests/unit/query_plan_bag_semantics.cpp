@@ -15,10 +15,15 @@
 //
 
 #include <algorithm>
+#include <filesystem>
 #include <iterator>
 #include <memory>
+#include <numeric>
+#include <random>
 #include <vector>
 
+#include <fmt/format.h>
+
 #include "disk_test_utils.hpp"
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -263,6 +268,107 @@ TYPED_TEST(QueryPlanTest, OrderByMultiple) {
   }
 }
 
+TYPED_TEST(QueryPlanTest, OrderByTopK) {
+  // With a skip and a limit OrderBy keeps only the first rows of the
+  // ordering, also when they are collected on the workers of a Gather.
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  auto prop = dba.NameToProperty("prop");
+
+  std::vector<int64_t> values(1000);
+  std::iota(values.begin(), values.end(), 0);
+  std::random_device rd;
+  std::mt19937 g(rd());
+  std::shuffle(values.begin(), values.end(), g);
+  for (auto value : values) {
+    ASSERT_TRUE(dba.InsertVertex().SetProperty(prop, memgraph::storage::PropertyValue(value)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  auto top_k = [&](bool parallel, int64_t skip, int64_t limit) {
+    SymbolTable symbol_table;
+    auto n = MakeScanAll(this->storage, symbol_table, "n");
+    std::shared_ptr<LogicalOperator> input = n.op_;
+    if (parallel) input = std::make_shared<Gather>(input, std::nullopt, memgraph::storage::View::OLD, 4);
+    auto p_sym = symbol_table.CreateSymbol("p", true);
+    auto p_ne = NEXPR("p", PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), prop))->MapTo(p_sym);
+    auto order_by = std::make_shared<plan::OrderBy>(MakeProduce(input, p_ne),
+                                                    std::vector<SortItem>{{Ordering::DESC, IDENT("p")->MapTo(p_sym)}},
+                                                    std::vector<Symbol>{p_sym});
+    order_by->skip_ = LITERAL(skip);
+    order_by->limit_ = LITERAL(limit);
+    auto skip_op = std::make_shared<plan::Skip>(order_by, LITERAL(skip));
+    auto limit_op = std::make_shared<plan::Limit>(skip_op, LITERAL(limit));
+    auto result_ne = NEXPR("result", IDENT("p")->MapTo(p_sym))->MapTo(symbol_table.CreateSymbol("result", true));
+    auto produce = MakeProduce(limit_op, result_ne);
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    std::vector<int64_t> results;
+    for (const auto &row : CollectProduce(*produce, &context)) results.push_back(row[0].ValueInt());
+    return results;
+  };
+
+  for (auto parallel : {false, true}) {
+    EXPECT_THAT(top_k(parallel, 3, 5), testing::ElementsAre(996, 995, 994, 993, 992));
+    EXPECT_THAT(top_k(parallel, 0, 0), testing::IsEmpty());
+    EXPECT_THAT(top_k(parallel, 995, 100), testing::ElementsAre(4, 3, 2, 1, 0));
+  }
+}
+
+TYPED_TEST(QueryPlanTest, OrderBySpilled) {
+  // Sorted runs written to spill files are merged into the same order as
+  // sorting in memory, and the files are removed with the cursor.
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  auto prop = dba.NameToProperty("prop");
+
+  std::vector<int64_t> values(1000);
+  std::iota(values.begin(), values.end(), 0);
+  std::random_device rd;
+  std::mt19937 g(rd());
+  std::shuffle(values.begin(), values.end(), g);
+  for (auto value : values) {
+    // String values, so the ordering compares values read back from the files.
+    ASSERT_TRUE(
+        dba.InsertVertex().SetProperty(prop, memgraph::storage::PropertyValue(fmt::format("{:04}", value))).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  const auto spill_directory = std::filesystem::temp_directory_path() / "MG_test_unit_query_plan_order_by_spilled";
+  std::filesystem::remove_all(spill_directory);
+  // With 4 rows per run the 250 runs are merged, so far fewer files are open at once.
+  for (const uint64_t spill_rows : {64, 4}) {
+    SymbolTable symbol_table;
+    auto n = MakeScanAll(this->storage, symbol_table, "n");
+    auto n_p = PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), prop);
+    auto order_by = std::make_shared<plan::OrderBy>(n.op_, std::vector<SortItem>{{Ordering::ASC, n_p}},
+                                                    std::vector<Symbol>{n.sym_});
+    auto n_ne = NEXPR("n", IDENT("n")->MapTo(n.sym_))->MapTo(symbol_table.CreateSymbol("n", true));
+    auto produce = MakeProduce(order_by, n_ne);
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    context.spill_rows = spill_rows;
+    context.spill_directory = spill_directory;
+
+    Frame frame(context.symbol_table.max_position());
+    auto cursor = produce->MakeCursor(memgraph::utils::NewDeleteResource());
+    for (int64_t i = 0; i < values.size(); ++i) {
+      ASSERT_TRUE(cursor->Pull(frame, context));
+      if (i == 0) {
+        const auto files = std::distance(std::filesystem::directory_iterator(spill_directory),
+                                         std::filesystem::directory_iterator());
+        EXPECT_LE(files, 32);
+      }
+      const auto &vertex = frame[symbol_table.at(*n_ne)];
+      ASSERT_TRUE(vertex.IsVertex());
+      auto value = vertex.ValueVertex().GetProperty(memgraph::storage::View::OLD, prop);
+      ASSERT_TRUE(value.HasValue());
+      EXPECT_EQ(value->ValueString(), fmt::format("{:04}", i));
+    }
+    ASSERT_FALSE(cursor->Pull(frame, context));
+  }
+  EXPECT_TRUE(std::filesystem::is_empty(spill_directory));
+  std::filesystem::remove_all(spill_directory);
+}
+
 TYPED_TEST(QueryPlanTest, OrderByExceptions) {
   auto storage_dba = this->db->Access();
   memgraph::query::DbAccessor dba(storage_dba.get());
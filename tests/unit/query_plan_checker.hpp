@@ -12,6 +12,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <climits>
+#include <set>
 #include <utility>
 
 #include "query/frontend/ast/ast.hpp"
@@ -73,8 +74,10 @@ class PlanChecker : public virtual HierarchicalLogicalOperatorVisitor {
   PRE_VISIT(ScanAllByEdgeTypePropertyRange);
   PRE_VISIT(ScanAllByEdgeId);
   PRE_VISIT(ScanAllById);
+  PRE_VISIT(ScanAllByPointNearest);
   PRE_VISIT(Expand);
   PRE_VISIT(ExpandVariable);
+  PRE_VISIT(ExpandIntersection);
   PRE_VISIT(ConstructNamedPath);
   PRE_VISIT(EmptyResult);
   PRE_VISIT(Produce);
@@ -155,6 +158,10 @@ class PlanChecker : public virtual HierarchicalLogicalOperatorVisitor {
 
   PRE_VISIT(PeriodicCommit);
   PRE_VISIT(LoadCsv);
+  PRE_VISIT(Gather);
+  PRE_VISIT(LoadProperties);
+  PRE_VISIT(ComputeExpressions);
+  PRE_VISIT(CountVertices);
 
   bool PreVisit(PeriodicSubquery &op) override {
     CheckOp(op);
@@ -196,6 +203,7 @@ using ExpectScanAllByEdgeType = OpChecker<ScanAllByEdgeType>;
 using ExpectScanAllByEdgeId = OpChecker<ScanAllByEdgeId>;
 using ExpectScanAllById = OpChecker<ScanAllById>;
 using ExpectExpand = OpChecker<Expand>;
+using ExpectExpandIntersection = OpChecker<ExpandIntersection>;
 using ExpectConstructNamedPath = OpChecker<ConstructNamedPath>;
 using ExpectProduce = OpChecker<Produce>;
 using ExpectEmptyResult = OpChecker<EmptyResult>;
@@ -212,9 +220,38 @@ using ExpectUnwind = OpChecker<Unwind>;
 using ExpectDistinct = OpChecker<Distinct>;
 using ExpectEvaluatePatternFilter = OpChecker<EvaluatePatternFilter>;
 using ExpectPeriodicCommit = OpChecker<PeriodicCommit>;
+using ExpectGather = OpChecker<Gather>;
+using ExpectLoadProperties = OpChecker<LoadProperties>;
+using ExpectComputeExpressions = OpChecker<ComputeExpressions>;
+using ExpectCountVertices = OpChecker<CountVertices>;
 using ExpectLoadCsv = OpChecker<LoadCsv>;
 using ExpectBasicCallProcedure = OpChecker<CallProcedure>;
 
+class ExpectCorrelatedPatternFilter : public OpChecker<EvaluatePatternFilter> {
+ public:
+  explicit ExpectCorrelatedPatternFilter(std::vector<std::string> symbol_names)
+      : symbol_names_(std::move(symbol_names)) {}
+
+  void ExpectOp(EvaluatePatternFilter &op, const SymbolTable &) override {
+    ASSERT_TRUE(op.correlated_symbols_);
+    std::vector<std::string> names;
+    for (const auto &symbol : *op.correlated_symbols_) names.push_back(symbol.name());
+    std::sort(names.begin(), names.end());
+    EXPECT_EQ(names, symbol_names_);
+  }
+
+ private:
+  std::vector<std::string> symbol_names_;
+};
+
+class ExpectExpandByEdgeTypeIndex : public OpChecker<Expand> {
+ public:
+  void ExpectOp(Expand &expand, const SymbolTable &) override {
+    EXPECT_TRUE(expand.common_.existing_node);
+    EXPECT_TRUE(expand.edge_type_index_lookup_);
+  }
+};
+
 class ExpectFilter : public OpChecker<Filter> {
  public:
   explicit ExpectFilter(const std::vector<std::list<BaseOpChecker *>> &pattern_filters = {})
@@ -426,6 +463,29 @@ class ExpectScanAllByLabelPropertyValue : public OpChecker<ScanAllByLabelPropert
   memgraph::query::Expression *expression_;
 };
 
+class ExpectScanAllByLabelPropertyCompositeValue : public OpChecker<ScanAllByLabelPropertyValue> {
+ public:
+  ExpectScanAllByLabelPropertyCompositeValue(memgraph::storage::LabelId label,
+                                             std::vector<memgraph::storage::PropertyId> properties, size_t prefix_size,
+                                             bool covering = false)
+      : label_(label), properties_(std::move(properties)), prefix_size_(prefix_size), covering_(covering) {}
+
+  void ExpectOp(ScanAllByLabelPropertyValue &scan_all, const SymbolTable &) override {
+    EXPECT_EQ(scan_all.label_, label_);
+    EXPECT_EQ(scan_all.composite_properties_, properties_);
+    ASSERT_FALSE(properties_.empty());
+    EXPECT_EQ(scan_all.property_, properties_.front());
+    EXPECT_EQ(scan_all.composite_expressions_.size() + 1, prefix_size_);
+    EXPECT_EQ(scan_all.covering_, covering_);
+  }
+
+ private:
+  memgraph::storage::LabelId label_;
+  std::vector<memgraph::storage::PropertyId> properties_;
+  size_t prefix_size_;
+  bool covering_;
+};
+
 class ExpectScanAllByLabelPropertyRange : public OpChecker<ScanAllByLabelPropertyRange> {
  public:
   ExpectScanAllByLabelPropertyRange(memgraph::storage::LabelId label, memgraph::storage::PropertyId property,
@@ -473,6 +533,22 @@ class ExpectScanAllByLabelProperty : public OpChecker<ScanAllByLabelProperty> {
   memgraph::storage::PropertyId property_;
 };
 
+class ExpectScanAllByPointNearest : public OpChecker<ScanAllByPointNearest> {
+ public:
+  ExpectScanAllByPointNearest(memgraph::storage::LabelId label,
+                              const std::pair<std::string, memgraph::storage::PropertyId> &prop_pair)
+      : label_(label), property_(prop_pair.second) {}
+
+  void ExpectOp(ScanAllByPointNearest &scan_all, const SymbolTable &) override {
+    EXPECT_EQ(scan_all.label_, label_);
+    EXPECT_EQ(scan_all.property_, property_);
+  }
+
+ private:
+  memgraph::storage::LabelId label_;
+  memgraph::storage::PropertyId property_;
+};
+
 class ExpectScanAllByEdgeTypePropertyValue : public OpChecker<ScanAllByEdgeTypePropertyValue> {
  public:
   ExpectScanAllByEdgeTypePropertyValue(memgraph::storage::EdgeTypeId edge_type,
@@ -693,6 +769,16 @@ class FakeDbAccessor {
     return 0;
   }
 
+  int64_t VerticesCount(memgraph::storage::LabelId label,
+                        const std::vector<memgraph::storage::PropertyId> &properties) const {
+    for (const auto &index : label_property_composite_index_) {
+      if (std::get<0>(index) == label && std::get<1>(index) == properties) {
+        return std::get<2>(index);
+      }
+    }
+    return 0;
+  }
+
   int64_t EdgesCount(memgraph::storage::EdgeTypeId edge_type) const {
     auto found = edge_type_index_.find(edge_type);
     if (found != edge_type_index_.end()) return found->second;
@@ -721,6 +807,15 @@ class FakeDbAccessor {
     return false;
   }
 
+  std::vector<std::vector<memgraph::storage::PropertyId>> LabelPropertyCompositeIndices(
+      memgraph::storage::LabelId label) const {
+    std::vector<std::vector<memgraph::storage::PropertyId>> indices;
+    for (const auto &index : label_property_composite_index_) {
+      if (std::get<0>(index) == label) indices.push_back(std::get<1>(index));
+    }
+    return indices;
+  }
+
   bool EdgeTypeIndexExists(memgraph::storage::EdgeTypeId edge_type) const {
     return edge_type_index_.find(edge_type) != edge_type_index_.end();
   }
@@ -735,6 +830,10 @@ class FakeDbAccessor {
     return false;
   }
 
+  bool PointIndexExists(memgraph::storage::LabelId label, memgraph::storage::PropertyId property) const {
+    return point_index_.contains({label, property});
+  }
+
   std::optional<memgraph::storage::LabelPropertyIndexStats> GetIndexStats(
       const memgraph::storage::LabelId label, const memgraph::storage::PropertyId property) const {
     return memgraph::storage::LabelPropertyIndexStats{.statistic = 0, .avg_group_size = 1};  // unique id
@@ -756,6 +855,17 @@ class FakeDbAccessor {
     label_property_index_.emplace_back(label, property, count);
   }
 
+  void SetIndexCount(memgraph::storage::LabelId label, const std::vector<memgraph::storage::PropertyId> &properties,
+                     int64_t count) {
+    for (auto &index : label_property_composite_index_) {
+      if (std::get<0>(index) == label && std::get<1>(index) == properties) {
+        std::get<2>(index) = count;
+        return;
+      }
+    }
+    label_property_composite_index_.emplace_back(label, properties, count);
+  }
+
   void SetIndexCount(memgraph::storage::EdgeTypeId edge_type, int64_t count) { edge_type_index_[edge_type] = count; }
 
   void SetIndexCount(memgraph::storage::EdgeTypeId edge_type, memgraph::storage::PropertyId property, int64_t count) {
@@ -768,6 +878,10 @@ class FakeDbAccessor {
     edge_type_property_index_.emplace_back(edge_type, property, count);
   }
 
+  void SetPointIndex(memgraph::storage::LabelId label, memgraph::storage::PropertyId property) {
+    point_index_.emplace(label, property);
+  }
+
   memgraph::storage::LabelId NameToLabel(const std::string &name) {
     auto found = labels_.find(name);
     if (found != labels_.end()) return found->second;
@@ -814,9 +928,12 @@ class FakeDbAccessor {
 
   std::unordered_map<memgraph::storage::LabelId, int64_t> label_index_;
   std::vector<std::tuple<memgraph::storage::LabelId, memgraph::storage::PropertyId, int64_t>> label_property_index_;
+  std::vector<std::tuple<memgraph::storage::LabelId, std::vector<memgraph::storage::PropertyId>, int64_t>>
+      label_property_composite_index_;
   std::unordered_map<memgraph::storage::EdgeTypeId, int64_t> edge_type_index_;
   std::vector<std::tuple<memgraph::storage::EdgeTypeId, memgraph::storage::PropertyId, int64_t>>
       edge_type_property_index_;
+  std::set<std::pair<memgraph::storage::LabelId, memgraph::storage::PropertyId>> point_index_;
 };
 
 }  // namespace memgraph::query::plan
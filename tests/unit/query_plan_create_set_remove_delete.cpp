@@ -11,6 +11,7 @@
 
 #include <iterator>
 #include <memory>
+#include <set>
 #include <string>
 #include <variant>
 #include <vector>
@@ -1659,6 +1660,53 @@ TYPED_TEST(QueryPlanTest, MergeNoInput) {
   EXPECT_EQ(1, CountIterable(dba.Vertices(memgraph::storage::View::OLD)));
 }
 
+TYPED_TEST(QueryPlanTest, MergeByPropertyValue) {
+  // UNWIND [1, 2, 2, 3] AS x MERGE (n:L {id: x}) with one (:L {id: 1})
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  auto label = dba.NameToLabel("L");
+  auto prop = PROPERTY_PAIR(dba, "id");
+  auto v1 = dba.InsertVertex();
+  ASSERT_TRUE(v1.AddLabel(label).HasValue());
+  ASSERT_TRUE(v1.SetProperty(prop.second, memgraph::storage::PropertyValue(1)).HasValue());
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+  std::vector<Expression *> values{LITERAL(1), LITERAL(2), LITERAL(2), LITERAL(3)};
+  auto x = symbol_table.CreateSymbol("x", true);
+  auto unwind =
+      std::make_shared<Unwind>(std::make_shared<Once>(), this->storage.template Create<ListLiteral>(values), x);
+
+  // merge_match branch
+  auto n = MakeScanAllByLabel(this->storage, symbol_table, "n", label, nullptr, memgraph::storage::View::NEW);
+  auto *x_ident = IDENT("x")->MapTo(x);
+  Filters filters;
+  filters.SetFilters({FilterInfo{FilterInfo::Type::Property, nullptr, {x},
+                                 PropertyFilter(symbol_table, n.sym_, this->storage.GetPropertyIx(prop.first), x_ident,
+                                                PropertyFilter::Type::EQUAL)}});
+  auto filter = std::make_shared<Filter>(n.op_, std::vector<std::shared_ptr<LogicalOperator>>{},
+                                         EQ(PROPERTY_LOOKUP(dba, IDENT("n")->MapTo(n.sym_), prop), x_ident), filters);
+
+  // merge_create branch
+  NodeCreationInfo node;
+  node.symbol = n.sym_;
+  node.labels.emplace_back(label);
+  std::get<PropertiesMapList>(node.properties).emplace_back(prop.second, x_ident);
+  auto create = std::make_shared<CreateNode>(std::make_shared<Once>(), node);
+
+  auto merge = std::make_shared<plan::Merge>(unwind, filter, create);
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+  EXPECT_EQ(4, PullAll(*merge, &context));
+  EXPECT_EQ(context.execution_stats[memgraph::query::ExecutionStats::Key::CREATED_NODES], 2);
+  dba.AdvanceCommand();
+
+  std::multiset<int64_t> ids;
+  for (const auto &vertex : dba.Vertices(memgraph::storage::View::OLD)) {
+    ids.insert(vertex.GetProperty(memgraph::storage::View::OLD, prop.second)->ValueInt());
+  }
+  EXPECT_EQ(ids, (std::multiset<int64_t>{1, 2, 3}));
+}
+
 TYPED_TEST(QueryPlanTest, SetPropertyWithCaching) {
   // SET (Null).prop = 42
   auto storage_dba = this->db->Access();
@@ -2702,3 +2750,52 @@ TYPED_TEST(DynamicExpandFixture, Expand) {
   ASSERT_EQ(expansion_info.direction, EdgeAtom::Direction::IN);
   ASSERT_EQ(expansion_info.existing_node.value(), this->v4);
 }
+
+class QueryPlanAnalyticalTest : public testing::Test {
+ public:
+  static memgraph::storage::Config AnalyticalConfig() {
+    memgraph::storage::Config config;
+    config.salient.storage_mode = memgraph::storage::StorageMode::IN_MEMORY_ANALYTICAL;
+    return config;
+  }
+
+  std::unique_ptr<memgraph::storage::Storage> db =
+      std::make_unique<memgraph::storage::InMemoryStorage>(AnalyticalConfig());
+  AstStorage storage;
+};
+
+TEST_F(QueryPlanAnalyticalTest, UnwindCreateInParallel) {
+  SymbolTable symbol_table;
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  auto property = PROPERTY_PAIR(dba, "id");
+
+  // UNWIND [0, ..., 999] AS x CREATE (:Person {id: x})
+  constexpr int64_t kRows = 1000;
+  std::vector<Expression *> values;
+  for (int64_t i = 0; i < kRows; ++i) values.push_back(LITERAL(i));
+  auto x = symbol_table.CreateSymbol("x", true);
+  auto unwind =
+      std::make_shared<Unwind>(std::make_shared<Once>(), this->storage.Create<ListLiteral>(std::move(values)), x);
+  NodeCreationInfo node;
+  node.symbol = symbol_table.CreateSymbol("n", true);
+  node.labels.emplace_back(dba.NameToLabel("Person"));
+  std::get<std::vector<std::pair<memgraph::storage::PropertyId, Expression *>>>(node.properties)
+      .emplace_back(property.second, IDENT("x")->MapTo(x));
+  auto empty_result = std::make_shared<EmptyResult>(std::make_shared<CreateNode>(unwind, node));
+
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+  context.analytical_write_workers = 4;
+  PullAll(*empty_result, &context);
+  EXPECT_EQ(context.execution_stats[memgraph::query::ExecutionStats::Key::CREATED_NODES], kRows);
+
+  // The workers commit transactions of their own, which analytical mode makes
+  // visible to the transaction of the query.
+  std::set<int64_t> ids;
+  for (auto vertex : dba.Vertices(memgraph::storage::View::NEW)) {
+    ids.insert(vertex.GetProperty(memgraph::storage::View::NEW, property.second)->ValueInt());
+  }
+  EXPECT_EQ(ids.size(), kRows);
+  EXPECT_EQ(*ids.begin(), 0);
+  EXPECT_EQ(*ids.rbegin(), kRows - 1);
+}
@@ -13,6 +13,7 @@
 #include "query/frontend/ast/ast.hpp"
 #include "query_plan_common.hpp"
 
+#include <algorithm>
 #include <iterator>
 #include <memory>
 #include <optional>
@@ -131,6 +132,50 @@ TYPED_TEST(MatchReturnFixture, MatchReturnPath) {
   EXPECT_TRUE(std::is_permutation(expected_paths.begin(), expected_paths.end(), results.begin()));
 }
 
+TYPED_TEST(MatchReturnFixture, GatherScanAll) {
+  this->AddVertices(1000);
+  this->dba.AdvanceCommand();
+
+  auto scan_all = MakeScanAll(this->storage, this->symbol_table, "n", nullptr);
+  auto gather = std::make_shared<Gather>(scan_all.op_, std::nullopt, memgraph::storage::View::OLD, 4);
+  auto output =
+      NEXPR("n", IDENT("n")->MapTo(scan_all.sym_))->MapTo(this->symbol_table.CreateSymbol("named_expression_1", true));
+  auto produce = MakeProduce(gather, output);
+
+  std::vector<memgraph::storage::Gid> expected;
+  for (const auto &v : this->dba.Vertices(memgraph::storage::View::OLD)) expected.push_back(v.Gid());
+
+  // Pull twice to check the cursor can be restarted.
+  for (int i = 0; i < 2; ++i) {
+    auto context = MakeContext(this->storage, this->symbol_table, &this->dba);
+    std::vector<memgraph::storage::Gid> gids;
+    for (const auto &row : CollectProduce(*produce, &context)) gids.push_back(row[0].ValueVertex().Gid());
+    EXPECT_THAT(gids, testing::UnorderedElementsAreArray(expected));
+  }
+}
+
+TYPED_TEST(MatchReturnFixture, HashJoinOverGather) {
+  // MATCH (a), (b) WHERE a.key = b.key with the left side built in parallel
+  auto key = this->dba.NameToProperty("key");
+  for (int i = 0; i < 200; ++i) {
+    auto v = this->dba.InsertVertex();
+    ASSERT_TRUE(v.SetProperty(key, memgraph::storage::PropertyValue(i % 10)).HasValue());
+  }
+  this->dba.AdvanceCommand();
+
+  auto a = MakeScanAll(this->storage, this->symbol_table, "a", nullptr);
+  auto b = MakeScanAll(this->storage, this->symbol_table, "b", nullptr);
+  auto *condition = this->storage.template Create<EqualOperator>(
+      PROPERTY_LOOKUP(this->dba, IDENT("a")->MapTo(a.sym_), key),
+      PROPERTY_LOOKUP(this->dba, IDENT("b")->MapTo(b.sym_), key));
+  auto gather = std::make_shared<Gather>(a.op_, std::nullopt, memgraph::storage::View::OLD, 4);
+  auto join = std::make_shared<HashJoin>(gather, std::vector<Symbol>{a.sym_}, b.op_, std::vector<Symbol>{b.sym_},
+                                         condition);
+
+  auto context = MakeContext(this->storage, this->symbol_table, &this->dba);
+  EXPECT_EQ(PullAll(*join, &context), 200 * 20);
+}
+
 #ifdef MG_ENTERPRISE
 TYPED_TEST(MatchReturnFixture, ScanAllWithAuthChecker) {
   std::string labelName = "l1";
@@ -338,6 +383,144 @@ TYPED_TEST(QueryPlan, NodeFilterLabelsAndProperties) {
   EXPECT_EQ(2, PullAll(*produce, &context));
 }
 
+TYPED_TEST(QueryPlan, LoadProperties) {
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  auto prop_a = PROPERTY_PAIR(dba, "a");
+  auto prop_b = PROPERTY_PAIR(dba, "b");
+  auto v1 = dba.InsertVertex();
+  ASSERT_TRUE(v1.SetProperty(prop_a.second, memgraph::storage::PropertyValue(1)).HasValue());
+  ASSERT_TRUE(v1.SetProperty(prop_b.second, memgraph::storage::PropertyValue("x")).HasValue());
+  auto v2 = dba.InsertVertex();
+  ASSERT_TRUE(v2.SetProperty(prop_b.second, memgraph::storage::PropertyValue("y")).HasValue());
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+
+  auto n = MakeScanAll(this->storage, symbol_table, "n");
+  auto slot_a = symbol_table.CreateSymbol("anon1", false);
+  auto slot_b = symbol_table.CreateSymbol("anon2", false);
+  auto load = std::make_shared<LoadProperties>(
+      n.op_, std::vector<LoadProperties::Entry>{{.symbol = n.sym_,
+                                                 .lookups = {PROPERTY_LOOKUP(dba, n.node_->identifier_, prop_a),
+                                                             PROPERTY_LOOKUP(dba, n.node_->identifier_, prop_b)},
+                                                 .output_symbols = {slot_a, slot_b}}});
+  auto output_a = NEXPR("a", IDENT("anon1")->MapTo(slot_a))->MapTo(symbol_table.CreateSymbol("named_expression_1", true));
+  auto output_b = NEXPR("b", IDENT("anon2")->MapTo(slot_b))->MapTo(symbol_table.CreateSymbol("named_expression_2", true));
+  auto produce = MakeProduce(load, output_a, output_b);
+
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+  auto results = CollectProduce(*produce, &context);
+  ASSERT_EQ(results.size(), 2);
+  for (const auto &row : results) {
+    if (row[1].ValueString() == "x") {
+      EXPECT_EQ(row[0].ValueInt(), 1);
+    } else {
+      EXPECT_EQ(row[1].ValueString(), "y");
+      EXPECT_TRUE(row[0].IsNull());
+    }
+  }
+}
+
+TYPED_TEST(QueryPlan, ComputeExpressions) {
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  auto prop = PROPERTY_PAIR(dba, "prop");
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_TRUE(dba.InsertVertex().SetProperty(prop.second, memgraph::storage::PropertyValue(i)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+
+  auto n = MakeScanAll(this->storage, symbol_table, "n");
+  auto slot = symbol_table.CreateSymbol("anon1", false);
+  auto compute = std::make_shared<ComputeExpressions>(
+      n.op_, std::vector<Expression *>{ADD(PROPERTY_LOOKUP(dba, n.node_->identifier_, prop), LITERAL(10))},
+      std::vector<Symbol>{slot});
+  auto output = NEXPR("x", IDENT("anon1")->MapTo(slot))->MapTo(symbol_table.CreateSymbol("named_expression_1", true));
+  auto produce = MakeProduce(compute, output);
+
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+  auto results = CollectProduce(*produce, &context);
+  ASSERT_EQ(results.size(), 3);
+  std::vector<int64_t> values;
+  for (const auto &row : results) {
+    values.push_back(row[0].ValueInt());
+  }
+  std::ranges::sort(values);
+  EXPECT_EQ(values, (std::vector<int64_t>{10, 11, 12}));
+}
+
+TYPED_TEST(QueryPlan, BatchedPull) {
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  auto property = PROPERTY_PAIR(dba, "p");
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_TRUE(dba.InsertVertex().SetProperty(property.second, memgraph::storage::PropertyValue(i)).HasValue());
+  }
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+
+  // MATCH (n) WHERE n.p < 6 RETURN n.p AS x LIMIT 5
+  auto n = MakeScanAll(this->storage, symbol_table, "n");
+  auto filter = std::make_shared<Filter>(n.op_, std::vector<std::shared_ptr<LogicalOperator>>{},
+                                         LESS(PROPERTY_LOOKUP(dba, n.node_->identifier_, property), LITERAL(6)));
+  auto output = NEXPR("x", PROPERTY_LOOKUP(dba, n.node_->identifier_, property))
+                    ->MapTo(symbol_table.CreateSymbol("named_expression_1", true));
+  auto produce = MakeProduce(filter, output);
+  auto limit = std::make_shared<Limit>(produce, LITERAL(5));
+
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+  auto pull_rows = [&] {
+    Frame frame(symbol_table.max_position());
+    auto cursor = limit->MakeCursor(memgraph::utils::NewDeleteResource());
+    std::vector<int64_t> values;
+    while (cursor->Pull(frame, context)) values.push_back(frame[symbol_table.at(*output)].ValueInt());
+    return values;
+  };
+  auto pull_batches = [&](size_t batch_size) {
+    Frame frame(symbol_table.max_position());
+    FrameBatch batch(symbol_table.max_position(), batch_size, memgraph::utils::NewDeleteResource());
+    auto cursor = limit->MakeCursor(memgraph::utils::NewDeleteResource());
+    std::vector<int64_t> values;
+    while (cursor->PullBatch(frame, batch, context)) {
+      EXPECT_LE(batch.size(), batch_size);
+      for (size_t row = 0; row < batch.size(); ++row) {
+        values.push_back(batch[row][symbol_table.at(*output)].ValueInt());
+      }
+    }
+    return values;
+  };
+
+  auto expected = pull_rows();
+  EXPECT_EQ(expected.size(), 5);
+  for (size_t batch_size : {1, 2, 3, 100}) {
+    EXPECT_EQ(pull_batches(batch_size), expected);
+  }
+
+  // Aggregate pulls its input in batches when the context asks for them
+  auto sum_symbol = symbol_table.CreateSymbol("sum", true);
+  auto aggregate = std::make_shared<Aggregate>(
+      filter,
+      std::vector<Aggregate::Element>{{PROPERTY_LOOKUP(dba, n.node_->identifier_, property), nullptr,
+                                       Aggregation::Op::SUM, sum_symbol, false}},
+      std::vector<Expression *>{}, std::vector<Symbol>{});
+  auto sum_output = NEXPR("s", IDENT("sum")->MapTo(sum_symbol))->MapTo(symbol_table.CreateSymbol("s", true));
+  auto sum_produce = MakeProduce(aggregate, sum_output);
+  for (size_t batch_size : {0, 4}) {
+    auto sum_context = MakeContext(this->storage, symbol_table, &dba);
+    sum_context.batch_size = batch_size;
+    auto results = CollectProduce(*sum_produce, &sum_context);
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_EQ(results[0][0].ValueInt(), 15);
+  }
+}
+
 TYPED_TEST(QueryPlan, NodeFilterMultipleLabels) {
   auto storage_dba = this->db->Access();
   memgraph::query::DbAccessor dba(storage_dba.get());
@@ -1829,6 +2012,9 @@ class QueryPlanExpandWeightedShortestPath : public testing::Test {
   Symbol weight_edge = symbol_table.CreateSymbol("w_edge", true);
   Symbol weight_node = symbol_table.CreateSymbol("w_node", true);
 
+  Symbol heuristic_edge = symbol_table.CreateSymbol("h_edge", true);
+  Symbol heuristic_node = symbol_table.CreateSymbol("h_node", true);
+
   Symbol total_weight = symbol_table.CreateSymbol("total_weight", true);
 
   void SetUp() override {
@@ -1868,7 +2054,7 @@ class QueryPlanExpandWeightedShortestPath : public testing::Test {
   // vertex)
   auto ExpandWShortest(EdgeAtom::Direction direction, std::optional<int> max_depth, Expression *where,
                        std::optional<int> node_id = 0, ScanAllTuple *existing_node_input = nullptr,
-                       memgraph::auth::User *user = nullptr) {
+                       memgraph::auth::User *user = nullptr, Expression *heuristic = nullptr) {
     // scan the nodes optionally filtering on property value
     auto n = MakeScanAll(storage, symbol_table, "n", existing_node_input ? existing_node_input->op_ : nullptr);
     auto last_op = n.op_;
@@ -1887,7 +2073,8 @@ class QueryPlanExpandWeightedShortestPath : public testing::Test {
         last_op, n.sym_, node_sym, edge_list_sym, EdgeAtom::Type::WEIGHTED_SHORTEST_PATH, direction,
         std::vector<memgraph::storage::EdgeTypeId>{}, false, nullptr, max_depth ? LITERAL(max_depth.value()) : nullptr,
         existing_node_input != nullptr, ExpansionLambda{filter_edge, filter_node, where},
-        ExpansionLambda{weight_edge, weight_node, PROPERTY_LOOKUP(dba, ident_e, prop)}, total_weight);
+        ExpansionLambda{weight_edge, weight_node, PROPERTY_LOOKUP(dba, ident_e, prop)}, total_weight,
+        heuristic ? std::make_optional(ExpansionLambda{heuristic_edge, heuristic_node, heuristic}) : std::nullopt);
 
     Frame frame(symbol_table.max_position());
     auto cursor = last_op->MakeCursor(memgraph::utils::NewDeleteResource());
@@ -2051,6 +2238,45 @@ TYPED_TEST(QueryPlanExpandWeightedShortestPath, ExistingNode) {
   }
 }
 
+TYPED_TEST(QueryPlanExpandWeightedShortestPath, ExistingNodeWithoutUpperBound) {
+  // Without a depth bound, the path to the bound node is searched from both
+  // of its ends, or as A* when there is a heuristic.
+  auto ExpandToNode4 = [this](EdgeAtom::Direction direction, Expression *heuristic) {
+    auto n0 = MakeScanAll(this->storage, this->symbol_table, "n0");
+    n0.op_ = std::make_shared<Filter>(n0.op_, std::vector<std::shared_ptr<LogicalOperator>>{},
+                                      EQ(PROPERTY_LOOKUP(this->dba, n0.node_->identifier_, this->prop), LITERAL(4)));
+    return this->ExpandWShortest(direction, std::nullopt, LITERAL(true), 0, &n0, nullptr, heuristic);
+  };
+  // Four minus the number of a node never exceeds the weight from it to [4],
+  // and it drops by at most the weight of each edge.
+  auto *ident_h = IDENT("h_node");
+  ident_h->MapTo(this->heuristic_node);
+  auto *heuristic = ADD(LITERAL(4), UMINUS(PROPERTY_LOOKUP(this->dba, ident_h, this->prop)));
+
+  for (auto *estimate : {static_cast<Expression *>(nullptr), heuristic}) {
+    {
+      auto results = ExpandToNode4(EdgeAtom::Direction::OUT, estimate);
+      ASSERT_EQ(results.size(), 1);
+      EXPECT_EQ(this->GetProp(results[0].vertex), 4);
+      EXPECT_EQ(results[0].total_weight, 9);
+      EXPECT_EQ(results[0].path, (std::vector<memgraph::query::EdgeAccessor>{this->e.at({0, 2}), this->e.at({2, 3}),
+                                                                            this->e.at({3, 4})}));
+    }
+    {
+      auto results = ExpandToNode4(EdgeAtom::Direction::IN, estimate);
+      ASSERT_EQ(results.size(), 1);
+      EXPECT_EQ(results[0].total_weight, 12);
+      EXPECT_EQ(results[0].path, std::vector<memgraph::query::EdgeAccessor>{this->e.at({4, 0})});
+    }
+    {
+      auto results = ExpandToNode4(EdgeAtom::Direction::BOTH, estimate);
+      ASSERT_EQ(results.size(), 1);
+      EXPECT_EQ(results[0].total_weight, 9);
+      EXPECT_EQ(results[0].path.size(), 3);
+    }
+  }
+}
+
 TYPED_TEST(QueryPlanExpandWeightedShortestPath, UpperBound) {
   {
     auto results = this->ExpandWShortest(EdgeAtom::Direction::BOTH, std::nullopt, LITERAL(true));
@@ -2307,12 +2533,13 @@ class QueryPlanExpandAllShortestPaths : public testing::Test {
     }
   }
 
-  // defines and performs an all shortest paths expansion with the given
-  // params returns a vector of pairs. each pair is (vector-of-edges,
-  // vertex)
+  // defines and performs an all shortest paths (or k shortest paths)
+  // expansion with the given params returns a vector of pairs. each pair is
+  // (vector-of-edges, vertex)
   auto ExpandAllShortest(EdgeAtom::Direction direction, std::optional<int> max_depth, Expression *where,
                          std::optional<int> node_id = 0, ScanAllTuple *existing_node_input = nullptr,
-                         const memgraph::auth::User *user = nullptr) {
+                         const memgraph::auth::User *user = nullptr,
+                         EdgeAtom::Type type = EdgeAtom::Type::ALL_SHORTEST_PATHS) {
     // scan the nodes optionally filtering on property value
     auto n = MakeScanAll(storage, symbol_table, "n", existing_node_input ? existing_node_input->op_ : nullptr);
     auto last_op = n.op_;
@@ -2328,7 +2555,7 @@ class QueryPlanExpandAllShortestPaths : public testing::Test {
     auto node_sym = existing_node_input ? existing_node_input->sym_ : symbol_table.CreateSymbol("node", true);
     auto edge_list_sym = symbol_table.CreateSymbol("edgelist_", true);
     auto filter_lambda = last_op = std::make_shared<ExpandVariable>(
-        last_op, n.sym_, node_sym, edge_list_sym, EdgeAtom::Type::ALL_SHORTEST_PATHS, direction,
+        last_op, n.sym_, node_sym, edge_list_sym, type, direction,
         std::vector<memgraph::storage::EdgeTypeId>{}, false, nullptr, max_depth ? LITERAL(max_depth.value()) : nullptr,
         existing_node_input != nullptr, ExpansionLambda{filter_edge, filter_node, where},
         ExpansionLambda{weight_edge, weight_node, PROPERTY_LOOKUP(dba, ident_e, prop)}, total_weight);
@@ -2370,6 +2597,14 @@ class QueryPlanExpandAllShortestPaths : public testing::Test {
     ident->MapTo(symbol);
     return NEQ(PROPERTY_LOOKUP(dba, ident, prop), LITERAL(value));
   }
+
+  // k shortest paths from v[0] to v[4], in the order they are yielded
+  auto ExpandKShortest(EdgeAtom::Direction direction, std::optional<int> max_depth, Expression *where) {
+    auto sink = MakeScanAll(storage, symbol_table, "sink");
+    sink.op_ = std::make_shared<Filter>(sink.op_, std::vector<std::shared_ptr<LogicalOperator>>{},
+                                        EQ(PROPERTY_LOOKUP(dba, sink.node_->identifier_, prop), LITERAL(4)));
+    return ExpandAllShortest(direction, max_depth, where, 0, &sink, nullptr, EdgeAtom::Type::K_SHORTEST_PATHS);
+  }
 };
 
 using StorageTypes = ::testing::Types<memgraph::storage::InMemoryStorage, memgraph::storage::DiskStorage>;
@@ -2618,6 +2853,37 @@ TYPED_TEST(QueryPlanExpandAllShortestPaths, MultiEdge) {
   EXPECT_EQ(results[5].total_weight, 9);
 }
 
+TYPED_TEST(QueryPlanExpandAllShortestPaths, KShortestPaths) {
+  auto weights = [](const auto &results) {
+    std::vector<double> weights;
+    for (const auto &result : results) weights.push_back(result.total_weight);
+    return weights;
+  };
+
+  {
+    auto results = this->ExpandKShortest(EdgeAtom::Direction::BOTH, std::nullopt, LITERAL(true));
+    EXPECT_EQ(weights(results), std::vector<double>({9, 10, 12}));
+    ASSERT_EQ(results.size(), 3);
+    EXPECT_EQ(results[0].path.size(), 3);
+    EXPECT_EQ(results[1].path.size(), 2);
+    EXPECT_EQ(results[2].path.size(), 1);
+    for (const auto &result : results) EXPECT_EQ(this->GetProp(result.vertex), 4);
+  }
+  EXPECT_EQ(weights(this->ExpandKShortest(EdgeAtom::Direction::OUT, std::nullopt, LITERAL(true))),
+            std::vector<double>({9, 10}));
+  EXPECT_EQ(weights(this->ExpandKShortest(EdgeAtom::Direction::BOTH, 2, LITERAL(true))),
+            std::vector<double>({10, 12}));
+  EXPECT_EQ(weights(this->ExpandKShortest(EdgeAtom::Direction::BOTH, std::nullopt,
+                                          this->PropNe(this->filter_node, 2))),
+            std::vector<double>({10, 12}));
+}
+
+TYPED_TEST(QueryPlanExpandAllShortestPaths, KShortestPathsUnboundDestination) {
+  EXPECT_THROW(this->ExpandAllShortest(EdgeAtom::Direction::BOTH, std::nullopt, LITERAL(true), 0, nullptr, nullptr,
+                                       EdgeAtom::Type::K_SHORTEST_PATHS),
+               QueryRuntimeException);
+}
+
 #ifdef MG_ENTERPRISE
 TYPED_TEST(QueryPlanExpandAllShortestPaths, BasicWithFineGrainedFiltering) {
   // All edge_types and labels allowed
@@ -2892,6 +3158,45 @@ TYPED_TEST(QueryPlan, ExpandBothCycleEdgeCase) {
   EXPECT_EQ(1, PullAll(*r_.op_, &context));
 }
 
+TYPED_TEST(QueryPlan, ExpandIntersection) {
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+
+  // make a triangle (v1)->(v2)->(v3)->(v1) with two edges from v2 to v3, a
+  // chord (v1)->(v3) and a node (v4)->(v1) outside of the cycle
+  auto v1 = dba.InsertVertex();
+  auto v2 = dba.InsertVertex();
+  auto v3 = dba.InsertVertex();
+  auto v4 = dba.InsertVertex();
+  auto edge_type = dba.NameToEdgeType("Edge");
+  ASSERT_TRUE(dba.InsertEdge(&v1, &v2, edge_type).HasValue());
+  ASSERT_TRUE(dba.InsertEdge(&v2, &v3, edge_type).HasValue());
+  ASSERT_TRUE(dba.InsertEdge(&v2, &v3, edge_type).HasValue());
+  ASSERT_TRUE(dba.InsertEdge(&v3, &v1, edge_type).HasValue());
+  ASSERT_TRUE(dba.InsertEdge(&v1, &v3, edge_type).HasValue());
+  ASSERT_TRUE(dba.InsertEdge(&v4, &v1, edge_type).HasValue());
+  dba.AdvanceCommand();
+
+  SymbolTable symbol_table;
+
+  // MATCH (a)-[r1]->(b)-[r2]->(c)-[r3]->(a)
+  auto a = MakeScanAll(this->storage, symbol_table, "a");
+  auto r1_b = MakeExpand(this->storage, symbol_table, a.op_, a.sym_, "r1", EdgeAtom::Direction::OUT, {}, "b", false,
+                         memgraph::storage::View::OLD);
+  auto c_sym = symbol_table.CreateSymbol("c", true);
+  auto r2_sym = symbol_table.CreateSymbol("r2", true);
+  auto r3_sym = symbol_table.CreateSymbol("r3", true);
+  std::vector<ExpandIntersection::Leg> legs{
+      {.input_symbol = r1_b.node_sym_, .edge_symbol = r2_sym, .direction = EdgeAtom::Direction::OUT, .edge_types = {}},
+      {.input_symbol = a.sym_, .edge_symbol = r3_sym, .direction = EdgeAtom::Direction::IN, .edge_types = {}}};
+  auto intersection =
+      std::make_shared<ExpandIntersection>(r1_b.op_, c_sym, std::move(legs), memgraph::storage::View::OLD);
+
+  // each rotation of the triangle, twice for the two edges from v2 to v3
+  auto context = MakeContext(this->storage, symbol_table, &dba);
+  EXPECT_EQ(6, PullAll(*intersection, &context));
+}
+
 TYPED_TEST(QueryPlan, EdgeFilter) {
   auto storage_dba = this->db->Access();
   memgraph::query::DbAccessor dba(storage_dba.get());
@@ -3081,6 +3386,13 @@ TYPED_TEST(QueryPlan, Distinct) {
       {TypedValue(3), TypedValue("two"), TypedValue(), TypedValue(3), TypedValue(true), TypedValue(false),
        TypedValue("TWO"), TypedValue()},
       {TypedValue(3), TypedValue("two"), TypedValue(), TypedValue(true), TypedValue(false), TypedValue("TWO")}, false);
+  check_distinct({TypedValue(1), TypedValue(1.0), TypedValue(2.0), TypedValue(2)}, {TypedValue(1), TypedValue(2.0)},
+                 false);
+
+  auto v1 = dba.InsertVertex();
+  auto v2 = dba.InsertVertex();
+  check_distinct({TypedValue(v1), TypedValue(3), TypedValue(v2), TypedValue(v1), TypedValue(3), TypedValue(v2)},
+                 {TypedValue(v1), TypedValue(3), TypedValue(v2)}, false);
 }
 
 TYPED_TEST(QueryPlan, ScanAllByLabel) {
@@ -3113,6 +3425,62 @@ TYPED_TEST(QueryPlan, ScanAllByLabel) {
   EXPECT_EQ(result_vertex.Gid(), labeled_vertex.Gid());
 }
 
+TYPED_TEST(QueryPlan, CountVertices) {
+  auto label = this->db->NameToLabel("label");
+  auto prop = this->db->NameToProperty("prop");
+  {
+    auto unique_acc = this->db->UniqueAccess();
+    [[maybe_unused]] auto _ = unique_acc->CreateIndex(label);
+    ASSERT_FALSE(unique_acc->Commit().HasError());
+  }
+  {
+    auto unique_acc = this->db->UniqueAccess();
+    [[maybe_unused]] auto _ = unique_acc->CreateIndex(label, prop);
+    ASSERT_FALSE(unique_acc->Commit().HasError());
+  }
+  auto storage_dba = this->db->Access();
+  memgraph::query::DbAccessor dba(storage_dba.get());
+  // 10 labeled vertices, 5 of them with the property, and one without a label.
+  for (int i = 0; i < 10; ++i) {
+    auto vertex = dba.InsertVertex();
+    ASSERT_TRUE(vertex.AddLabel(label).HasValue());
+    if (i % 2 == 0) ASSERT_TRUE(vertex.SetProperty(prop, memgraph::storage::PropertyValue(i)).HasValue());
+  }
+  dba.InsertVertex();
+  dba.AdvanceCommand();
+  // A vertex the OLD view doesn't see yet.
+  ASSERT_TRUE(dba.InsertVertex().AddLabel(label).HasValue());
+
+  auto count = [&](auto make_scan, memgraph::storage::View view) {
+    SymbolTable symbol_table;
+    auto scan = make_scan(symbol_table, view);
+    auto count_sym = symbol_table.CreateSymbol("count", true);
+    auto count_vertices = std::make_shared<CountVertices>(scan.op_, count_sym);
+    auto output = NEXPR("count", IDENT("count")->MapTo(count_sym))->MapTo(symbol_table.CreateSymbol("c", true));
+    auto produce = MakeProduce(count_vertices, output);
+    auto context = MakeContext(this->storage, symbol_table, &dba);
+    auto results = CollectProduce(*produce, &context);
+    EXPECT_EQ(results.size(), 1);
+    return results.empty() ? -1 : results[0][0].ValueInt();
+  };
+  auto by_label = [&](SymbolTable &symbol_table, memgraph::storage::View view) {
+    return MakeScanAllByLabel(this->storage, symbol_table, "n", label, nullptr, view);
+  };
+  auto by_range = [&](SymbolTable &symbol_table, memgraph::storage::View view) {
+    return MakeScanAllByLabelPropertyRange(this->storage, symbol_table, "n", label, prop,
+                                           Bound{LITERAL(2), Bound::Type::INCLUSIVE}, std::nullopt, nullptr, view);
+  };
+  auto by_null_range = [&](SymbolTable &symbol_table, memgraph::storage::View view) {
+    auto *null = LITERAL(memgraph::storage::PropertyValue());
+    return MakeScanAllByLabelPropertyRange(this->storage, symbol_table, "n", label, prop,
+                                           Bound{null, Bound::Type::INCLUSIVE}, std::nullopt, nullptr, view);
+  };
+  EXPECT_EQ(count(by_label, memgraph::storage::View::OLD), 10);
+  EXPECT_EQ(count(by_label, memgraph::storage::View::NEW), 11);
+  EXPECT_EQ(count(by_range, memgraph::storage::View::OLD), 4);
+  EXPECT_EQ(count(by_null_range, memgraph::storage::View::OLD), 0);
+}
+
 TYPED_TEST(QueryPlan, ScanAllByLabelProperty) {
   // Add 5 vertices with same label, but with different property values.
   auto label = this->db->NameToLabel("label");
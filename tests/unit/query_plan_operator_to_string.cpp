@@ -190,6 +190,28 @@ TYPED_TEST(OperatorToStringTest, ExpandVariable) {
   EXPECT_EQ(last_op->ToString(), expected_string);
 }
 
+TYPED_TEST(OperatorToStringTest, ExpandIntersection) {
+  auto node1_sym = this->GetSymbol("node1");
+  auto node2_sym = this->GetSymbol("node2");
+  std::shared_ptr<LogicalOperator> last_op = std::make_shared<ScanAll>(nullptr, node1_sym);
+  last_op = std::make_shared<ScanAll>(last_op, node2_sym);
+  std::vector<ExpandIntersection::Leg> legs{
+      {.input_symbol = node1_sym,
+       .edge_symbol = this->GetSymbol("edge1"),
+       .direction = EdgeAtom::Direction::OUT,
+       .edge_types = {this->dba.NameToEdgeType("EdgeType1")}},
+      {.input_symbol = node2_sym,
+       .edge_symbol = this->GetSymbol("edge2"),
+       .direction = EdgeAtom::Direction::IN,
+       .edge_types = {}}};
+  last_op = std::make_shared<ExpandIntersection>(last_op, this->GetSymbol("node3"), std::move(legs),
+                                                 memgraph::storage::View::OLD);
+  last_op->dba_ = &this->dba;
+
+  std::string expected_string{"ExpandIntersection (node1)-[edge1:EdgeType1]->(node3), (node2)<-[edge2]-(node3)"};
+  EXPECT_EQ(last_op->ToString(), expected_string);
+}
+
 TYPED_TEST(OperatorToStringTest, ConstructNamedPath) {
   auto node1_sym = this->GetSymbol("node1");
   auto edge1_sym = this->GetSymbol("edge1");
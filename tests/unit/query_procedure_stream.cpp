@@ -0,0 +1,271 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <filesystem>
+#include <stdexcept>
+#include <vector>
+
+#include "communication/result_stream_faker.hpp"
+#include "interpreter_faker.hpp"
+#include "query/exceptions.hpp"
+#include "query/interpreter.hpp"
+#include "query/interpreter_context.hpp"
+#include "query/procedure/cypher_types.hpp"
+#include "query/procedure/mg_procedure_impl.hpp"
+#include "query/procedure/module.hpp"
+#include "replication/state.hpp"
+#include "storage/v2/config.hpp"
+#include "utils/logging.hpp"
+
+namespace {
+
+constexpr auto kNoHandler = nullptr;
+constexpr int64_t kRecords = 10;
+
+// The procedures of shared library modules are the ones whose records are
+// pulled while they run.
+class StreamingModule : public memgraph::query::procedure::Module {
+ public:
+  StreamingModule() = default;
+  ~StreamingModule() override = default;
+  StreamingModule(const StreamingModule &) = delete;
+  StreamingModule(StreamingModule &&) = delete;
+  StreamingModule &operator=(const StreamingModule &) = delete;
+  StreamingModule &operator=(StreamingModule &&) = delete;
+
+  bool Close() override { return true; };
+
+  const std::map<std::string, mgp_proc, std::less<>> *Procedures() const override { return &procedures; }
+
+  const std::map<std::string, mgp_trans, std::less<>> *Transformations() const override { return &transformations; }
+
+  const std::map<std::string, mgp_func, std::less<>> *Functions() const override { return &functions; }
+
+  std::optional<std::filesystem::path> Path() const override { return std::nullopt; };
+
+  bool CanRunOnAnyThread() const override { return true; }
+
+  std::map<std::string, mgp_proc, std::less<>> procedures{};
+  std::map<std::string, mgp_trans, std::less<>> transformations{};
+  std::map<std::string, mgp_func, std::less<>> functions{};
+};
+
+// Returns false if the record couldn't be started, e.g. because the records
+// are no longer pulled.
+bool Yield(mgp_result *result, const char *field, mgp_value *value) {
+  mgp_result_record *record{nullptr};
+  if (mgp_result_new_record(result, &record) != mgp_error::MGP_ERROR_NO_ERROR) {
+    mgp_value_destroy(value);
+    return false;
+  }
+  const auto error = mgp_result_record_insert(record, field, value);
+  mgp_value_destroy(value);
+  return error == mgp_error::MGP_ERROR_NO_ERROR;
+}
+
+mgp_value *MakeInt(int64_t value, mgp_memory *memory) {
+  mgp_value *result{nullptr};
+  MG_ASSERT(mgp_value_make_int(value, memory, &result) == mgp_error::MGP_ERROR_NO_ERROR);
+  return result;
+}
+
+}  // namespace
+
+class CallProcedureStreamTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    auto module = std::make_unique<StreamingModule>();
+    // Yields the numbers up to `kRecords`.
+    AddProc(*module, "count", "i", [this](mgp_list *, mgp_graph *, mgp_result *result, mgp_memory *memory) {
+      for (int64_t i = 0; i < kRecords; ++i) {
+        if (!Yield(result, "i", MakeInt(i, memory))) {
+          new_record_failed = true;
+          break;
+        }
+        ++yielded;
+      }
+      returned = true;
+    });
+    // Yields 3 numbers and throws.
+    AddProc(*module, "fail", "i", [this](mgp_list *, mgp_graph *, mgp_result *result, mgp_memory *memory) {
+      for (int64_t i = 0; i < 3; ++i) {
+        if (!Yield(result, "i", MakeInt(i, memory))) return;
+        ++yielded;
+      }
+      throw std::runtime_error("The procedure failed.");
+    });
+    // Yields 3 numbers and sets an error.
+    AddProc(*module, "error", "i", [this](mgp_list *, mgp_graph *, mgp_result *result, mgp_memory *memory) {
+      for (int64_t i = 0; i < 3; ++i) {
+        if (!Yield(result, "i", MakeInt(i, memory))) return;
+        ++yielded;
+      }
+      mgp_result_set_error_msg(result, "The procedure set an error.");
+    });
+    // Collects all vertices before it yields any, so the vertices can be
+    // deleted while they are yielded.
+    AddProc(*module, "nodes", "node", [this](mgp_list *, mgp_graph *graph, mgp_result *result, mgp_memory *memory) {
+      std::vector<mgp_vertex *> vertices;
+      mgp_vertices_iterator *it{nullptr};
+      MG_ASSERT(mgp_graph_iter_vertices(graph, memory, &it) == mgp_error::MGP_ERROR_NO_ERROR);
+      mgp_vertex *vertex{nullptr};
+      for (mgp_vertices_iterator_get(it, &vertex); vertex; mgp_vertices_iterator_next(it, &vertex)) {
+        mgp_vertex *copy{nullptr};
+        MG_ASSERT(mgp_vertex_copy(vertex, memory, &copy) == mgp_error::MGP_ERROR_NO_ERROR);
+        vertices.push_back(copy);
+      }
+      mgp_vertices_iterator_destroy(it);
+      auto next = vertices.begin();
+      for (; next != vertices.end(); ++next) {
+        mgp_value *value{nullptr};
+        MG_ASSERT(mgp_value_make_vertex(*next, &value) == mgp_error::MGP_ERROR_NO_ERROR);
+        if (!Yield(result, "node", value)) {
+          ++next;
+          break;
+        }
+        ++yielded;
+      }
+      for (; next != vertices.end(); ++next) mgp_vertex_destroy(*next);
+    });
+    memgraph::query::procedure::gModuleRegistry.RegisterModule("stream_test", std::move(module));
+  }
+
+  void TearDown() override {
+    memgraph::query::procedure::gModuleRegistry.UnloadAllModules();
+    std::filesystem::remove_all(data_directory);
+  }
+
+  static void AddProc(StreamingModule &module, const char *name, const char *result,
+                      std::function<void(mgp_list *, mgp_graph *, mgp_result *, mgp_memory *)> cb) {
+    auto *memory = memgraph::utils::NewDeleteResource();
+    mgp_proc proc(name, std::move(cb), memory, {.is_write = false});
+    proc.results.emplace(memgraph::utils::pmr::string{result, memory}, std::make_pair(&any_type, false));
+    module.procedures.emplace(name, std::move(proc));
+  }
+
+  static const memgraph::query::procedure::AnyType any_type;
+
+  std::atomic<int64_t> yielded{0};
+  std::atomic<bool> new_record_failed{false};
+  std::atomic<bool> returned{false};
+
+  std::filesystem::path data_directory = std::filesystem::temp_directory_path() / "MG_tests_unit_procedure_stream";
+  memgraph::storage::Config config{[&] {
+    memgraph::storage::Config config{};
+    config.durability.storage_directory = data_directory;
+    config.disk.main_storage_directory = config.durability.storage_directory / "disk";
+    // The deleted vertices stay in memory while the procedure holds them.
+    config.gc.type = memgraph::storage::Config::Gc::Type::NONE;
+    return config;
+  }()};
+  memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+  memgraph::utils::Gatekeeper<memgraph::dbms::Database> db_gk{config, repl_state};
+  memgraph::dbms::DatabaseAccess db{[&] {
+    auto db_acc_opt = db_gk.access();
+    MG_ASSERT(db_acc_opt, "Failed to access db");
+    return *db_acc_opt;
+  }()};
+  memgraph::system::System system_state;
+  memgraph::query::InterpreterContext interpreter_context{{},
+                                                          kNoHandler,
+                                                          &repl_state,
+                                                          system_state
+#ifdef MG_ENTERPRISE
+                                                          ,
+                                                          std::nullopt
+#endif
+  };
+  InterpreterFaker interpreter{&interpreter_context, db};
+};
+
+const memgraph::query::procedure::AnyType CallProcedureStreamTest::any_type{};
+
+TEST_F(CallProcedureStreamTest, ProcedureIsSuspendedBetweenPulls) {
+  auto [stream, qid] = interpreter.Prepare("CALL stream_test.count() YIELD i RETURN i");
+  // Every pull also yields the record which tells whether there are more.
+  interpreter.Pull(&stream, 1);
+  ASSERT_TRUE(stream.GetSummary().at("has_more").ValueBool());
+  ASSERT_EQ(stream.GetResults().size(), 1);
+  EXPECT_EQ(yielded, 2);
+  EXPECT_FALSE(returned);
+
+  interpreter.Pull(&stream, 2);
+  ASSERT_TRUE(stream.GetSummary().at("has_more").ValueBool());
+  ASSERT_EQ(stream.GetResults().size(), 3);
+  EXPECT_EQ(yielded, 4);
+  EXPECT_FALSE(returned);
+
+  interpreter.Pull(&stream);
+  ASSERT_FALSE(stream.GetSummary().at("has_more").ValueBool());
+  ASSERT_EQ(stream.GetResults().size(), kRecords);
+  for (int64_t i = 0; i < kRecords; ++i) {
+    EXPECT_EQ(stream.GetResults()[i][0].ValueInt(), i);
+  }
+  EXPECT_EQ(yielded, kRecords);
+  EXPECT_TRUE(returned);
+  EXPECT_FALSE(new_record_failed);
+}
+
+TEST_F(CallProcedureStreamTest, AbortStopsTheSuspendedProcedure) {
+  auto [stream, qid] = interpreter.Prepare("CALL stream_test.count() YIELD i RETURN i");
+  interpreter.Pull(&stream, 1);
+  ASSERT_TRUE(stream.GetSummary().at("has_more").ValueBool());
+  ASSERT_FALSE(returned);
+
+  // The procedure is resumed, fails to start its next record and is joined.
+  interpreter.interpreter.Abort();
+  EXPECT_TRUE(returned);
+  EXPECT_TRUE(new_record_failed);
+  EXPECT_EQ(yielded, 2);
+
+  auto result = interpreter.Interpret("RETURN 1");
+  ASSERT_EQ(result.GetResults().size(), 1);
+}
+
+TEST_F(CallProcedureStreamTest, ExceptionOfTheProcedureReachesTheCaller) {
+  auto [stream, qid] = interpreter.Prepare("CALL stream_test.fail() YIELD i RETURN i");
+  interpreter.Pull(&stream, 1);
+  ASSERT_TRUE(stream.GetSummary().at("has_more").ValueBool());
+  EXPECT_THROW(interpreter.Pull(&stream), std::runtime_error);
+  EXPECT_EQ(yielded, 3);
+  interpreter.interpreter.Abort();
+
+  auto [error_stream, error_qid] = interpreter.Prepare("CALL stream_test.error() YIELD i RETURN i");
+  interpreter.Pull(&error_stream, 1);
+  ASSERT_TRUE(error_stream.GetSummary().at("has_more").ValueBool());
+  EXPECT_THROW(interpreter.Pull(&error_stream), memgraph::query::QueryRuntimeException);
+}
+
+TEST_F(CallProcedureStreamTest, RecordsWithDeletedValuesAreSkipped) {
+  // Only the records of non-transactional storage can have deleted values.
+  interpreter.Interpret("STORAGE MODE IN_MEMORY_ANALYTICAL");
+  interpreter.Interpret("UNWIND range(0, 3) AS i CREATE (:V {id: i})");
+
+  auto [stream, qid] = interpreter.Prepare("CALL stream_test.nodes() YIELD node RETURN node.id AS id");
+  interpreter.Pull(&stream, 1);
+  ASSERT_TRUE(stream.GetSummary().at("has_more").ValueBool());
+  ASSERT_EQ(yielded, 2);
+
+  // The vertex is deleted while the procedure is suspended, before it's yielded.
+  InterpreterFaker other{&interpreter_context, db};
+  other.Interpret("MATCH (n:V {id: 3}) DELETE n");
+
+  interpreter.Pull(&stream);
+  ASSERT_FALSE(stream.GetSummary().at("has_more").ValueBool());
+  ASSERT_EQ(stream.GetResults().size(), 3);
+  for (int64_t i = 0; i < 3; ++i) {
+    EXPECT_EQ(stream.GetResults()[i][0].ValueInt(), i);
+  }
+  EXPECT_EQ(yielded, 4);
+}
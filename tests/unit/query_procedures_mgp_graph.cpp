@@ -13,6 +13,7 @@
 #include <iterator>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include <gmock/gmock.h>
@@ -609,6 +610,154 @@ TYPED_TEST(MgpGraphTest, EdgesIterator) {
   }
 }
 
+TYPED_TEST(MgpGraphTest, BatchedGraphAccess) {
+  const auto vertex_ids = this->CreateEdge();
+  mgp_graph graph = this->CreateGraph(memgraph::storage::View::OLD);
+  {
+    SCOPED_TRACE("Vertex ids");
+    MgpVerticesIteratorPtr iter{EXPECT_MGP_NO_ERROR(mgp_vertices_iterator *, mgp_graph_iter_vertices, &graph,
+                                                    &this->memory)};
+    std::array<mgp_vertex_id, 3> ids{};
+    EXPECT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_vertices_iterator_next_ids, iter.get(), ids.data(), 1), 1);
+    EXPECT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_vertices_iterator_next_ids, iter.get(), ids.data() + 1, 2), 1);
+    EXPECT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_vertices_iterator_next_ids, iter.get(), ids.data(), ids.size()), 0);
+    std::vector<int64_t> found{ids[0].as_int, ids[1].as_int};
+    EXPECT_THAT(found, testing::UnorderedElementsAre(vertex_ids[0].AsInt(), vertex_ids[1].AsInt()));
+  }
+  {
+    SCOPED_TRACE("Neighbor ids");
+    MgpVertexPtr from{EXPECT_MGP_NO_ERROR(mgp_vertex *, mgp_graph_get_vertex_by_id, &graph,
+                                          mgp_vertex_id{vertex_ids[0].AsInt()}, &this->memory)};
+    MgpEdgesIteratorPtr iter{
+        EXPECT_MGP_NO_ERROR(mgp_edges_iterator *, mgp_vertex_iter_out_edges, from.get(), &this->memory)};
+    std::array<mgp_vertex_id, 2> ids{};
+    ASSERT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_edges_iterator_next_neighbor_ids, iter.get(), ids.data(), ids.size()),
+              1);
+    EXPECT_EQ(ids[0].as_int, vertex_ids[1].AsInt());
+    EXPECT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_edges_iterator_next_neighbor_ids, iter.get(), ids.data(), ids.size()),
+              0);
+  }
+  {
+    SCOPED_TRACE("Vertices property");
+    const std::array<mgp_vertex_id, 2> ids{mgp_vertex_id{vertex_ids[0].AsInt()}, mgp_vertex_id{vertex_ids[1].AsInt()}};
+    std::array<mgp_value *, 2> values{};
+    ASSERT_EQ(mgp_graph_get_vertices_property(&graph, ids.data(), ids.size(), "missing", &this->memory, values.data()),
+              mgp_error::MGP_ERROR_NO_ERROR);
+    for (auto *value : values) {
+      MgpValuePtr owned{value};
+      EXPECT_NE(EXPECT_MGP_NO_ERROR(int, mgp_value_is_null, owned.get()), 0);
+    }
+  }
+  {
+    SCOPED_TRACE("CSR");
+    mgp_csr *csr = EXPECT_MGP_NO_ERROR(mgp_csr *, mgp_graph_export_csr, &graph, &this->memory);
+    ASSERT_NE(csr, nullptr);
+    ASSERT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_csr_vertex_count, csr), 2);
+    ASSERT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_csr_edge_count, csr), 1);
+    const auto *csr_ids = EXPECT_MGP_NO_ERROR(const mgp_vertex_id *, mgp_csr_vertex_ids, csr);
+    const auto *offsets = EXPECT_MGP_NO_ERROR(const size_t *, mgp_csr_offsets, csr);
+    const auto *targets = EXPECT_MGP_NO_ERROR(const size_t *, mgp_csr_targets, csr);
+    const size_t from = csr_ids[0].as_int == vertex_ids[0].AsInt() ? 0 : 1;
+    EXPECT_EQ(offsets[from + 1] - offsets[from], 1);
+    EXPECT_EQ(offsets[2], 1);
+    EXPECT_EQ(csr_ids[targets[offsets[from]]].as_int, vertex_ids[1].AsInt());
+    mgp_csr_destroy(csr);
+  }
+}
+
+TYPED_TEST(MgpGraphTest, VerticesPartitions) {
+  constexpr auto kVertexCount = 100;
+  std::vector<int64_t> vertex_ids;
+  {
+    auto accessor = this->CreateDbAccessor(memgraph::storage::IsolationLevel::SNAPSHOT_ISOLATION);
+    for (auto i = 0; i < kVertexCount; ++i) vertex_ids.push_back(accessor.InsertVertex().Gid().AsInt());
+    ASSERT_FALSE(accessor.Commit().HasError());
+  }
+  mgp_graph graph = this->CreateGraph(memgraph::storage::View::OLD);
+  mgp_vertices_partitions *invalid{nullptr};
+  EXPECT_EQ(mgp_graph_partition_vertices(&graph, 0, &this->memory, &invalid), mgp_error::MGP_ERROR_INVALID_ARGUMENT);
+
+  struct Payload {
+    std::mutex lock;
+    std::vector<int64_t> found;
+  } payload;
+  const auto collect = [](size_t /*partition*/, mgp_vertices_iterator *vertices, mgp_memory * /*memory*/,
+                          void *raw_payload) {
+    std::vector<int64_t> found;
+    for (auto *vertex = EXPECT_MGP_NO_ERROR(mgp_vertex *, mgp_vertices_iterator_get, vertices); vertex;
+         vertex = EXPECT_MGP_NO_ERROR(mgp_vertex *, mgp_vertices_iterator_next, vertices)) {
+      found.push_back(EXPECT_MGP_NO_ERROR(mgp_vertex_id, mgp_vertex_get_id, vertex).as_int);
+    }
+    auto *payload = static_cast<Payload *>(raw_payload);
+    const std::lock_guard guard(payload->lock);
+    payload->found.insert(payload->found.end(), found.begin(), found.end());
+    return mgp_error::MGP_ERROR_NO_ERROR;
+  };
+
+  auto *partitions = EXPECT_MGP_NO_ERROR(mgp_vertices_partitions *, mgp_graph_partition_vertices, &graph, 4,
+                                         &this->memory);
+  ASSERT_NE(partitions, nullptr);
+  const auto size = EXPECT_MGP_NO_ERROR(size_t, mgp_vertices_partitions_size, partitions);
+  EXPECT_GE(size, 1);
+  EXPECT_LE(size, 4);
+  EXPECT_EQ(mgp_vertices_partitions_run(partitions, 2, collect, &payload), mgp_error::MGP_ERROR_NO_ERROR);
+  EXPECT_THAT(payload.found, testing::UnorderedElementsAreArray(vertex_ids));
+  EXPECT_EQ(mgp_vertices_partitions_run(partitions, 2, collect, &payload), mgp_error::MGP_ERROR_LOGIC_ERROR);
+  mgp_vertices_partitions_destroy(partitions);
+}
+
+TYPED_TEST(MgpGraphTest, GraphProjection) {
+  const auto vertex_ids = this->CreateEdge();
+  auto get_projection = [this]() {
+    mgp_graph graph = this->CreateGraph(memgraph::storage::View::OLD);
+    const std::array<const char *, 1> edge_types{"EDGE"};
+    const std::array<const char *, 1> properties{"missing"};
+    return EXPECT_MGP_NO_ERROR(mgp_projection *, mgp_graph_get_projection, &graph, "projection", nullptr, 0,
+                               edge_types.data(), edge_types.size(), properties.data(), properties.size(),
+                               &this->memory);
+  };
+
+  auto *projection = get_projection();
+  ASSERT_NE(projection, nullptr);
+  ASSERT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_projection_vertex_count, projection), 2);
+  ASSERT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_projection_edge_count, projection), 1);
+  const auto *ids = EXPECT_MGP_NO_ERROR(const mgp_vertex_id *, mgp_projection_vertex_ids, projection);
+  const auto *offsets = EXPECT_MGP_NO_ERROR(const size_t *, mgp_projection_offsets, projection);
+  const auto *targets = EXPECT_MGP_NO_ERROR(const size_t *, mgp_projection_targets, projection);
+  const size_t from = ids[0].as_int == vertex_ids[0].AsInt() ? 0 : 1;
+  EXPECT_EQ(offsets[from + 1] - offsets[from], 1);
+  EXPECT_EQ(ids[targets[offsets[from]]].as_int, vertex_ids[1].AsInt());
+  {
+    MgpValuePtr value{EXPECT_MGP_NO_ERROR(mgp_value *, mgp_projection_vertex_property, projection, 0, 0,
+                                          &this->memory)};
+    EXPECT_NE(EXPECT_MGP_NO_ERROR(int, mgp_value_is_null, value.get()), 0);
+    mgp_value *out_of_range{nullptr};
+    EXPECT_EQ(mgp_projection_vertex_property(projection, 2, 0, &this->memory, &out_of_range),
+              mgp_error::MGP_ERROR_OUT_OF_RANGE);
+  }
+
+  auto *same_data = get_projection();
+  ASSERT_NE(same_data, nullptr);
+  if (std::is_same<TypeParam, memgraph::storage::InMemoryStorage>::value) {
+    // Only the in-memory storage can tell that the transactions see the same data
+    EXPECT_EQ(same_data->impl, projection->impl);
+  }
+
+  {
+    auto accessor = this->CreateDbAccessor(memgraph::storage::IsolationLevel::SNAPSHOT_ISOLATION);
+    accessor.InsertVertex();
+    ASSERT_FALSE(accessor.Commit().HasError());
+  }
+  auto *new_data = get_projection();
+  ASSERT_NE(new_data, nullptr);
+  EXPECT_NE(new_data->impl, projection->impl);
+  EXPECT_EQ(EXPECT_MGP_NO_ERROR(size_t, mgp_projection_vertex_count, new_data), 3);
+
+  mgp_projection_destroy(new_data);
+  mgp_projection_destroy(same_data);
+  mgp_projection_destroy(projection);
+}
+
 TYPED_TEST(MgpGraphTest, EdgeSetProperty) {
   if (std::is_same<TypeParam, memgraph::storage::DiskStorage>::value) {
     // DiskStorage doesn't support READ_UNCOMMITTED isolation level
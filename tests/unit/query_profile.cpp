@@ -9,7 +9,10 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <bitset>
 #include <chrono>
+#include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -270,3 +273,86 @@ TEST(QueryProfileTest, ComplicatedQuery) {
   EXPECT_EQ(children5[0]["name"], "Once");
   EXPECT_TRUE(children5[0]["children"].empty());
 }
+
+TEST(QueryProfileTest, PerfCounters) {
+  using memgraph::utils::PerfEvent;
+  std::chrono::duration<double> total_time{0.001};
+  ProfilingStats once{2, 25, 0, "Once", {}};
+  once.perf_counters[PerfEvent::INSTRUCTIONS] = 100;
+  once.perf_counters[PerfEvent::PAGE_FAULTS] = 1;
+  ProfilingStats produce{2, 100, 0, "Produce", {once}};
+  produce.perf_counters[PerfEvent::INSTRUCTIONS] = 400;
+  produce.perf_counters[PerfEvent::PAGE_FAULTS] = 3;
+
+  EXPECT_EQ(ProfilingStatsColumns(true),
+            (std::vector<std::string>{"OPERATOR", "ACTUAL HITS", "RELATIVE TIME", "ABSOLUTE TIME", "INSTRUCTIONS",
+                                      "CACHE MISSES", "BRANCH MISSES", "PAGE FAULTS"}));
+
+  // Only the instructions and the page faults were counted, the counts of
+  // each operator exclude the ones of its children.
+  std::bitset<memgraph::utils::kPerfEventCount> counted;
+  counted.set(static_cast<size_t>(PerfEvent::INSTRUCTIONS));
+  counted.set(static_cast<size_t>(PerfEvent::PAGE_FAULTS));
+  auto table = ProfilingStatsToTable(ProfilingStatsWithTotalTime{produce, total_time, counted});
+  ASSERT_EQ(table.size(), 2);
+  ASSERT_EQ(table[0].size(), 8);
+  EXPECT_EQ(table[0][4].ValueInt(), 300);
+  EXPECT_TRUE(table[0][5].IsNull());
+  EXPECT_TRUE(table[0][6].IsNull());
+  EXPECT_EQ(table[0][7].ValueInt(), 2);
+  EXPECT_EQ(table[1][4].ValueInt(), 100);
+  EXPECT_EQ(table[1][7].ValueInt(), 1);
+
+  auto json = ProfilingStatsToJson(ProfilingStatsWithTotalTime{produce, total_time, counted});
+  EXPECT_EQ(json["perf_counters"]["instructions"], 300);
+  EXPECT_EQ(json["perf_counters"]["page_faults"], 2);
+  EXPECT_FALSE(json["perf_counters"].contains("cache_misses"));
+  EXPECT_EQ(json["children"][0]["perf_counters"]["instructions"], 100);
+
+  // Without the perf counters the table has no columns for them.
+  EXPECT_EQ(ProfilingStatsToTable(ProfilingStatsWithTotalTime{produce, total_time})[0].size(), 4);
+  EXPECT_FALSE(ProfilingStatsToJson(ProfilingStatsWithTotalTime{produce, total_time}).contains("perf_counters"));
+}
+
+TEST(QueryProfileTest, SampledProfilesAreAggregated) {
+  ProfileSampler sampler;
+  EXPECT_FALSE(sampler.ShouldSample(42, 0));
+  EXPECT_TRUE(sampler.ShouldSample(42, 3));
+  EXPECT_FALSE(sampler.ShouldSample(42, 3));
+  EXPECT_FALSE(sampler.ShouldSample(42, 3));
+  EXPECT_TRUE(sampler.ShouldSample(42, 3));
+
+  std::chrono::duration<double> total_time{0.001};
+  ProfilingStats once{2, 25, 1, "Once", {}};
+  ProfilingStats produce{2, 100, 2, "Produce", {once}};
+  sampler.Record(42, "MATCH (n) RETURN n", {produce, total_time});
+  sampler.Record(42, "MATCH (n) RETURN n", {produce, total_time});
+
+  auto profiles = sampler.Profiles();
+  ASSERT_EQ(profiles.size(), 1);
+  EXPECT_EQ(profiles[0].plan_hash, 42);
+  EXPECT_EQ(profiles[0].query, "MATCH (n) RETURN n");
+  EXPECT_EQ(profiles[0].samples, 2);
+  EXPECT_DOUBLE_EQ(profiles[0].total_time_ms, 2.0);
+
+  const auto &root = profiles[0].cumulative_stats;
+  EXPECT_EQ(root.name, "Produce");
+  EXPECT_EQ(root.actual_hits, 4);
+  EXPECT_DOUBLE_EQ(root.absolute_time_ms, 1.5);
+  ASSERT_EQ(root.children.size(), 1);
+  EXPECT_EQ(root.children[0].name, "Once");
+  EXPECT_EQ(root.children[0].actual_hits, 4);
+  EXPECT_DOUBLE_EQ(root.children[0].absolute_time_ms, 0.5);
+
+  auto table = SampledProfilesToTable(profiles);
+  ASSERT_EQ(table.size(), 2);
+  EXPECT_EQ(table[0][0].ValueString(), "42");
+  EXPECT_EQ(table[0][2].ValueInt(), 2);
+  EXPECT_EQ(table[0][3].ValueString(), "* Produce");
+  EXPECT_EQ(table[0][4].ValueInt(), 4);
+  EXPECT_EQ(table[0][5].ValueString(), "  1.500000 ms");
+  EXPECT_EQ(table[1][3].ValueString(), "* Once");
+
+  sampler.Clear();
+  EXPECT_TRUE(sampler.Profiles().empty());
+}
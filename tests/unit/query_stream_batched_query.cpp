@@ -0,0 +1,48 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gtest/gtest.h>
+
+#include "query/stream/batched_query.hpp"
+
+using memgraph::query::stream::RewriteAsBatchedQuery;
+
+TEST(StreamBatchedQuery, RewritesParameters) {
+  const auto batched = RewriteAsBatchedQuery("MERGE (n:Node {id: $id}) SET n.name = $name, n += $props");
+  ASSERT_TRUE(batched);
+  EXPECT_EQ(batched->query,
+            "UNWIND $__stream_batch AS __stream_row MERGE (n:Node {id: __stream_row.id}) SET n.name = "
+            "__stream_row.name, n += __stream_row.props");
+  EXPECT_EQ(batched->parameters, (std::vector<std::string>{"id", "name", "props"}));
+}
+
+TEST(StreamBatchedQuery, KeepsLiterals) {
+  const auto batched = RewriteAsBatchedQuery("CREATE (:Node {text: 'MATCH $id', `$name`: \"it\\\"s $x\"})");
+  ASSERT_TRUE(batched);
+  EXPECT_EQ(batched->query,
+            "UNWIND $__stream_batch AS __stream_row CREATE (:Node {text: 'MATCH $id', `$name`: \"it\\\"s $x\"})");
+  EXPECT_TRUE(batched->parameters.empty());
+}
+
+TEST(StreamBatchedQuery, RewritesExpressionParameters) {
+  const auto batched = RewriteAsBatchedQuery("CREATE (n {flag: $a IN $list AND NOT $b})");
+  ASSERT_TRUE(batched);
+  EXPECT_EQ(batched->parameters, (std::vector<std::string>{"a", "list", "b"}));
+}
+
+TEST(StreamBatchedQuery, RejectsUnbatchableQueries) {
+  for (const auto *query : {"MATCH (n) SET n.x = $x", "MERGE (n {id: $id}) RETURN n", "CREATE (n) WITH n CREATE (m)",
+                            "CREATE INDEX ON :Node(id)", "CREATE (n:Node $props)", "CREATE ()-[:EDGE $props]->()",
+                            "CREATE (n {id: $0})", "CREATE (n); CREATE (m)", "UNWIND $list AS x CREATE ({x: x})",
+                            "CREATE (__stream_row)", "SHOW STREAMS", "CREATE (n {text: 'unterminated})"}) {
+    EXPECT_FALSE(RewriteAsBatchedQuery(query)) << query;
+  }
+}
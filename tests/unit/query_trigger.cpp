@@ -386,6 +386,45 @@ TYPED_TEST(TriggerContextTest, ReturnCreateOnlyEvent) {
   CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::UPDATED_OBJECTS, 0, dba);
 }
 
+// A batch of committed transactions runs the triggers once for all of their changes.
+TYPED_TEST(TriggerContextTest, AppendContexts) {
+  memgraph::query::DbAccessor dba{this->StartTransaction()};
+  auto create_context = [&](const size_t vertex_count) {
+    memgraph::query::TriggerContextCollector trigger_context_collector{kAllEventTypes};
+    for (size_t i = 0; i < vertex_count; ++i) {
+      trigger_context_collector.RegisterCreatedObject(dba.InsertVertex());
+    }
+    return std::move(trigger_context_collector).TransformToTriggerContext();
+  };
+
+  auto trigger_context = create_context(2);
+  trigger_context.Append(create_context(1));
+  dba.AdvanceCommand();
+
+  CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::CREATED_VERTICES, 3, dba);
+  CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::CREATED_OBJECTS, 3, dba);
+  CheckTypedValueSize(trigger_context, memgraph::query::TriggerIdentifierTag::DELETED_VERTICES, 0, dba);
+}
+
+TEST(AfterCommitTriggerQueueTest, Batches) {
+  memgraph::query::AfterCommitTriggerQueue queue;
+  // Only the first entry schedules a task which takes them
+  ASSERT_TRUE(queue.Push({}));
+  ASSERT_FALSE(queue.Push({}));
+  ASSERT_FALSE(queue.Push({}));
+  ASSERT_EQ(queue.Size(), 3);
+
+  ASSERT_EQ(queue.PopBatch(2).size(), 2);
+  ASSERT_FALSE(queue.Push({}));
+  ASSERT_EQ(queue.PopBatch(2).size(), 2);
+  ASSERT_TRUE(queue.PopBatch(2).empty());
+  ASSERT_EQ(queue.Size(), 0);
+
+  // Nobody takes the entries after an empty batch
+  ASSERT_TRUE(queue.Push({}));
+  ASSERT_EQ(queue.PopBatch(0).size(), 1);
+}
+
 namespace {
 void EXPECT_PROP_TRUE(const memgraph::query::TypedValue &a) {
   EXPECT_TRUE(a.type() == memgraph::query::TypedValue::Type::Bool && a.ValueBool());
@@ -934,7 +973,7 @@ class TriggerStoreTest : public ::testing::Test {
 
   std::optional<memgraph::query::DbAccessor> dba;
 
-  memgraph::utils::SkipList<memgraph::query::QueryCacheEntry> ast_cache;
+  memgraph::query::AstCache ast_cache{1000};
   memgraph::query::AllowEverythingAuthChecker auth_checker;
 
  private:
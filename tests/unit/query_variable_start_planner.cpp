@@ -10,7 +10,10 @@
 // licenses/APL.txt.
 
 #include <algorithm>
+#include <limits>
+#include <string>
 #include <variant>
+#include <vector>
 
 #include "disk_test_utils.hpp"
 #include "gtest/gtest.h"
@@ -439,4 +442,36 @@ TYPED_TEST(TestVariableStartPlanner, TestSubqueryWithTripleUnion) {
                dba);
   });
 }
+
+TYPED_TEST(TestVariableStartPlanner, ExpansionsOrderedBySelectivity) {
+  // Test MATCH (a) -[r]-> (b:Common), (a) -[e]-> (c:Rare) RETURN a
+  auto *query = QUERY(SINGLE_QUERY(MATCH(PATTERN(NODE("a"), EDGE("r", Direction::OUT), NODE("b", "Common")),
+                                         PATTERN(NODE("a"), EDGE("e", Direction::OUT), NODE("c", "Rare"))),
+                                   RETURN("a")));
+  auto symbol_table = memgraph::query::MakeSymbolTable(query);
+  auto query_parts = CollectQueryParts(symbol_table, this->storage, query, false);
+  const auto &matching = query_parts.query_parts.at(0).single_query_parts.at(0).matching;
+  auto node_name = [&](const auto *atom) { return symbol_table.at(*atom->identifier_).name(); };
+  // Returns the names of the nodes expanded to, starting from `a`.
+  auto expanded_nodes = [&](impl::VaryMatchingStart variants) {
+    for (const auto &variant : variants) {
+      const auto &first = variant.expansions.front();
+      if (first.expand_from_edge || node_name(first.node1) != "a") continue;
+      std::vector<std::string> names;
+      for (const auto &expansion : variant.expansions) names.push_back(node_name(expansion.node2));
+      return names;
+    }
+    return std::vector<std::string>{};
+  };
+
+  // Without an estimator the pattern order is kept.
+  EXPECT_EQ(expanded_nodes(impl::VaryMatchingStart(matching, symbol_table)), (std::vector<std::string>{"b", "c"}));
+
+  impl::NodeCountEstimator estimator = [](const memgraph::query::NodeAtom &node) {
+    if (node.labels_.empty()) return std::numeric_limits<double>::max();
+    return std::get<memgraph::query::LabelIx>(node.labels_[0]).name == "Rare" ? 1.0 : 100.0;
+  };
+  EXPECT_EQ(expanded_nodes(impl::VaryMatchingStart(matching, symbol_table, estimator)),
+            (std::vector<std::string>{"c", "b"}));
+}
 }  // namespace
@@ -163,6 +163,28 @@ TEST(ReplicationDurability, ReplicaEntryAsync) {
   ASSERT_EQ(replica_entry, deser);
 }
 
+TEST(ReplicationDurability, ReplicaEntryCompression) {
+  using namespace std::chrono_literals;
+  using namespace std::string_literals;
+  auto const replica_entry = ReplicationReplicaEntry{.config = ReplicationClientConfig{
+                                                         .name = "TEST_NAME"s,
+                                                         .mode = ReplicationMode::ASYNC,
+                                                         .repl_server_endpoint = Endpoint("000.123.456.789", 2023),
+                                                         .replica_check_frequency = 3s,
+                                                         .compression = true,
+                                                     }};
+  nlohmann::json j;
+  to_json(j, replica_entry);
+  ReplicationReplicaEntry deser;
+  from_json(j, deser);
+  ASSERT_EQ(replica_entry, deser);
+
+  // Entries written before compression was added aren't compressed.
+  j.erase("replica_compression");
+  from_json(j, deser);
+  ASSERT_FALSE(deser.config.compression);
+}
+
 TEST(ReplicationDurability, ReplicaEntryMigrationNoVersionToV4) {
   using namespace std::chrono_literals;
   using namespace std::string_literals;
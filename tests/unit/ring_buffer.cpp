@@ -94,3 +94,29 @@ TEST(RingBuffer, NonCopyable) {
 
   std::unique_ptr<std::string> a(new std::string("bla"));
 }
+
+TEST(RingBuffer, PopMany) {
+  RingBuffer<int> buffer{4};
+  std::vector<int> popped;
+  EXPECT_EQ(buffer.pop_many(popped, 10), 0);
+
+  // Wrap around the end of the buffer
+  for (int i = 0; i < 3; i++) buffer.emplace(i);
+  EXPECT_EQ(buffer.pop_many(popped, 2), 2);
+  for (int i = 3; i < 6; i++) buffer.emplace(i);
+  EXPECT_EQ(buffer.pop_many(popped, 10), 4);
+  EXPECT_EQ(popped, (std::vector<int>{0, 1, 2, 3, 4, 5}));
+  EXPECT_FALSE(buffer.pop());
+}
+
+TEST(RingBuffer, TryEmplace) {
+  RingBuffer<int> buffer{2};
+  EXPECT_TRUE(buffer.try_emplace(1));
+  EXPECT_TRUE(buffer.try_emplace(2));
+  EXPECT_FALSE(buffer.try_emplace(3));
+  EXPECT_EQ(*buffer.pop(), 1);
+  EXPECT_TRUE(buffer.try_emplace(4));
+  EXPECT_EQ(*buffer.pop(), 2);
+  EXPECT_EQ(*buffer.pop(), 4);
+  EXPECT_FALSE(buffer.pop());
+}
@@ -167,6 +167,39 @@ TEST(Rpc, ClientPool) {
   server.AwaitShutdown();
 }
 
+TEST(Rpc, ConcurrentCallsShareConnection) {
+  memgraph::communication::ServerContext server_context;
+  Server server({"127.0.0.1", 0}, &server_context);
+  server.Register<Sum>([](auto *req_reader, auto *res_builder) {
+    SumReq req;
+    memgraph::slk::Load(&req, req_reader);
+    SumRes res(req.x + req.y);
+    memgraph::slk::Save(res, res_builder);
+  });
+  ASSERT_TRUE(server.Start());
+  std::this_thread::sleep_for(100ms);
+
+  memgraph::communication::ClientContext client_context;
+  Client client(server.endpoint(), &client_context);
+
+  // Each response has to reach the thread which sent its request.
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; ++t) {
+    threads.emplace_back([&client, t] {
+      for (int i = 0; i < 100; ++i) {
+        auto sum = client.Call<Sum>(t * 1000, i);
+        EXPECT_EQ(sum.sum, t * 1000 + i);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  server.Shutdown();
+  server.AwaitShutdown();
+}
+
 TEST(Rpc, LargeMessage) {
   memgraph::communication::ServerContext server_context;
   Server server({"127.0.0.1", 0}, &server_context);
@@ -9,6 +9,7 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <atomic>
 #include <vector>
 
 #include <fmt/format.h>
@@ -868,3 +869,202 @@ TEST(SkipList, EstimateAverageNumberOfEquals5) {
     ASSERT_EQ(count, kMaxElements);
   }
 }
+
+TEST(SkipList, Chunks) {
+  memgraph::utils::SkipList<int64_t> list;
+  const int64_t kMaxElements = 100000;
+  {
+    auto acc = list.access();
+    for (int64_t i = 0; i < kMaxElements; ++i) {
+      ASSERT_TRUE(acc.insert(i).second);
+    }
+  }
+
+  for (uint64_t num_chunks : {1, 2, 7, 64, 1000}) {
+    auto acc = list.access();
+    auto chunks = acc.chunks(num_chunks);
+    ASSERT_GE(chunks.size(), 1);
+    ASSERT_LE(chunks.size(), num_chunks);
+    ASSERT_EQ(chunks.front().lower(), nullptr);
+    ASSERT_EQ(chunks.back().upper(), nullptr);
+
+    // Chunks are consecutive and together contain every element exactly once.
+    int64_t expected = 0;
+    uint64_t max_chunk_size = 0;
+    for (const auto &chunk : chunks) {
+      uint64_t chunk_size = 0;
+      for (auto item : chunk) {
+        ASSERT_EQ(item, expected++);
+        ++chunk_size;
+      }
+      if (chunk.upper() != nullptr) ASSERT_EQ(*chunk.upper(), expected);
+      max_chunk_size = std::max(max_chunk_size, chunk_size);
+    }
+    ASSERT_EQ(expected, kMaxElements);
+
+    // Sampling is random, but no chunk should be wildly larger than the average.
+    ASSERT_LE(max_chunk_size, 4 * kMaxElements / chunks.size()) << "num_chunks = " << num_chunks;
+  }
+}
+
+TEST(SkipList, ChunksSmallList) {
+  memgraph::utils::SkipList<int64_t> list;
+  {
+    auto acc = list.access();
+    auto chunks = acc.chunks(4);
+    ASSERT_EQ(chunks.size(), 1);
+    ASSERT_EQ(chunks[0].begin(), chunks[0].end());
+  }
+  {
+    auto acc = list.access();
+    ASSERT_TRUE(acc.insert(5).second);
+    ASSERT_TRUE(acc.insert(6).second);
+  }
+  {
+    const auto &const_list = list;
+    auto acc = const_list.access();
+    std::vector<int64_t> items;
+    for (const auto &chunk : acc.chunks(16)) {
+      for (auto item : chunk) items.push_back(item);
+    }
+    ASSERT_EQ(items, (std::vector<int64_t>{5, 6}));
+  }
+}
+
+TEST(SkipList, ChunksRemovedBoundary) {
+  memgraph::utils::SkipList<int64_t> list;
+  {
+    auto acc = list.access();
+    for (int64_t i = 0; i < 10000; ++i) {
+      ASSERT_TRUE(acc.insert(i).second);
+    }
+  }
+
+  auto acc = list.access();
+  auto chunks = acc.chunks(8);
+  ASSERT_GT(chunks.size(), 1);
+  // Removing the boundaries must not make the neighbouring chunks overlap.
+  std::vector<int64_t> removed;
+  for (const auto &chunk : chunks) {
+    if (chunk.upper() != nullptr) removed.push_back(*chunk.upper());
+  }
+  for (auto item : removed) ASSERT_TRUE(acc.remove(item));
+
+  int64_t count = 0;
+  int64_t last = -1;
+  for (const auto &chunk : chunks) {
+    for (auto item : chunk) {
+      ASSERT_GT(item, last);
+      last = item;
+      ++count;
+    }
+  }
+  ASSERT_EQ(count, 10000 - static_cast<int64_t>(removed.size()));
+}
+
+struct Counted {
+  static inline std::atomic<int64_t> alive{0};
+
+  explicit Counted(int64_t value) : value(value) { ++alive; }
+  Counted(const Counted &other) : value(other.value) { ++alive; }
+  Counted(Counted &&other) noexcept : value(other.value) { ++alive; }
+  Counted &operator=(const Counted &) = default;
+  Counted &operator=(Counted &&) = default;
+  ~Counted() { --alive; }
+
+  int64_t value;
+};
+bool operator==(const Counted &a, const Counted &b) { return a.value == b.value; }
+bool operator<(const Counted &a, const Counted &b) { return a.value < b.value; }
+bool operator==(const Counted &a, const int64_t &b) { return a.value == b; }
+bool operator<(const Counted &a, const int64_t &b) { return a.value < b; }
+
+TEST(SkipList, EpochGc) {
+  {
+    memgraph::utils::SkipList<Counted, memgraph::utils::SkipListEpochGc> list;
+    {
+      auto acc = list.access();
+      for (int64_t i = 0; i < 1000; ++i) {
+        ASSERT_TRUE(acc.insert(Counted{i}).second);
+      }
+    }
+    ASSERT_EQ(Counted::alive, 1000);
+
+    {
+      // An old accessor keeps the removed nodes alive.
+      auto old_acc = list.access();
+      {
+        auto acc = list.access();
+        for (int64_t i = 0; i < 1000; i += 2) {
+          ASSERT_TRUE(acc.remove(i));
+        }
+        ASSERT_EQ(acc.size(), 500);
+      }
+      list.run_gc();
+      list.run_gc();
+      ASSERT_EQ(Counted::alive, 1000);
+      ASSERT_EQ(list.garbage_size(), 500);
+      int64_t count = 0;
+      for (const auto &item : old_acc) {
+        ASSERT_EQ(item.value % 2, 1);
+        ++count;
+      }
+      ASSERT_EQ(count, 500);
+    }
+
+    list.run_gc();
+    list.run_gc();
+    ASSERT_EQ(Counted::alive, 500);
+    ASSERT_EQ(list.garbage_size(), 0);
+
+    {
+      auto acc = list.access();
+      for (int64_t i = 1; i < 1000; i += 2) {
+        ASSERT_TRUE(acc.contains(i));
+        ASSERT_FALSE(acc.contains(i - 1));
+      }
+      ASSERT_TRUE(acc.remove(1));
+    }
+  }
+  ASSERT_EQ(Counted::alive, 0);
+}
+
+TEST(SkipList, GarbageSize) {
+  memgraph::utils::SkipList<int64_t> list;
+  {
+    auto acc = list.access();
+    for (int64_t i = 0; i < 1000; ++i) {
+      ASSERT_TRUE(acc.insert(i).second);
+    }
+  }
+  ASSERT_EQ(list.garbage_size(), 0);
+
+  {
+    // An old accessor keeps the removed nodes from being freed.
+    auto old_acc = list.access();
+    {
+      auto acc = list.access();
+      for (int64_t i = 0; i < 100; ++i) {
+        ASSERT_TRUE(acc.remove(i));
+      }
+    }
+    list.run_gc();
+    ASSERT_EQ(list.garbage_size(), 100);
+  }
+
+  // The nodes are freed once all of the accessors up to the ones created after
+  // the removal are gone.
+  for (int i = 0; i < 2; ++i) {
+    auto acc = list.access();
+  }
+  list.run_gc();
+  ASSERT_EQ(list.garbage_size(), 0);
+
+  {
+    auto acc = list.access();
+    ASSERT_TRUE(acc.remove(100));
+  }
+  ASSERT_EQ(list.garbage_size(), 1);
+  list.clear();
+  ASSERT_EQ(list.garbage_size(), 0);
+}
@@ -136,6 +136,31 @@ TEST(Builder, MultipleSegments) {
   ASSERT_EQ(splits[4], footer_expected);
 }
 
+TEST(Builder, DirectSaveAfterBufferedData) {
+  std::vector<uint8_t> buffer;
+  memgraph::slk::Builder builder([&buffer](const uint8_t *data, size_t size, bool have_more) {
+    for (size_t i = 0; i < size; ++i) buffer.push_back(data[i]);
+  });
+
+  auto small = GetRandomData(5);
+  auto large = GetRandomData(memgraph::slk::kSegmentDirectSaveSize);
+  builder.Save(small.data(), small.size());
+  builder.Save(large.data(), large.size());
+  builder.Finalize();
+
+  ASSERT_EQ(buffer.size(), small.size() + large.size() + 3 * sizeof(memgraph::slk::SegmentSize));
+
+  auto splits = BufferToBinaryData(buffer.data(), buffer.size(),
+                                   {sizeof(memgraph::slk::SegmentSize), small.size(),
+                                    sizeof(memgraph::slk::SegmentSize), large.size(), sizeof(memgraph::slk::SegmentSize)});
+
+  ASSERT_EQ(splits[0], SizeToBinaryData(small.size()));
+  ASSERT_EQ(splits[1], small);
+  ASSERT_EQ(splits[2], SizeToBinaryData(large.size()));
+  ASSERT_EQ(splits[3], large);
+  ASSERT_EQ(splits[4], SizeToBinaryData(0));
+}
+
 TEST(Reader, SingleSegment) {
   std::vector<uint8_t> buffer;
   memgraph::slk::Builder builder([&buffer](const uint8_t *data, size_t size, bool have_more) {
@@ -296,6 +321,78 @@ TEST(Reader, MultipleSegments) {
   }
 }
 
+TEST(Reader, LoadSpan) {
+  std::vector<uint8_t> buffer;
+  memgraph::slk::Builder builder([&buffer](const uint8_t *data, size_t size, bool have_more) {
+    for (size_t i = 0; i < size; ++i) buffer.push_back(data[i]);
+  });
+
+  auto input = GetRandomData(memgraph::slk::kSegmentMaxDataSize + 100);
+  builder.Save(input.data(), input.size());
+  builder.Finalize();
+
+  memgraph::slk::Reader reader(buffer.data(), buffer.size());
+  std::vector<uint8_t> output;
+  // The spans end with the segments.
+  auto first = reader.LoadSpan(input.size());
+  ASSERT_EQ(first.size(), memgraph::slk::kSegmentMaxDataSize);
+  output.insert(output.end(), first.begin(), first.end());
+  auto second = reader.LoadSpan(input.size() - first.size());
+  ASSERT_EQ(second.size(), 100);
+  output.insert(output.end(), second.begin(), second.end());
+  reader.Finalize();
+  ASSERT_EQ(BinaryData(output.data(), output.size()), input);
+
+  memgraph::slk::Reader short_reader(buffer.data(), buffer.size());
+  ASSERT_EQ(short_reader.LoadSpan(10).size(), 10);
+  ASSERT_THROW(short_reader.Finalize(), memgraph::slk::SlkReaderException);
+}
+
+TEST(Reader, CompressedSegments) {
+  std::vector<uint8_t> buffer;
+  memgraph::slk::Builder builder([&buffer](const uint8_t *data, size_t size, bool have_more) {
+    for (size_t i = 0; i < size; ++i) buffer.push_back(data[i]);
+  });
+  builder.EnableCompression();
+
+  // Random data doesn't compress and is written as it is, repeated data is
+  // compressed both when buffered and when it is saved directly.
+  auto random = GetRandomData(1000);
+  std::vector<uint8_t> repeated(memgraph::slk::kSegmentMaxDataSize + 1000, 42);
+  auto small = BinaryData(repeated.data(), 2000);
+  auto large = BinaryData(repeated.data(), repeated.size());
+  builder.Save(random.data(), random.size());
+  builder.Save(small.data(), small.size());
+  builder.Save(large.data(), large.size());
+  builder.Finalize();
+  ASSERT_LT(buffer.size(), random.size() + small.size() + large.size());
+
+  auto status = memgraph::slk::CheckStreamComplete(buffer.data(), buffer.size());
+  ASSERT_EQ(status.status, memgraph::slk::StreamStatus::COMPLETE);
+  ASSERT_EQ(status.stream_size, buffer.size());
+
+  memgraph::slk::Reader reader(buffer.data(), buffer.size());
+  auto expected = random + small + large;
+  std::unique_ptr<uint8_t[]> output(new uint8_t[expected.size()]);
+  reader.Load(output.get(), expected.size());
+  reader.Finalize();
+  ASSERT_EQ(BinaryData(std::move(output), expected.size()), expected);
+
+  // A corrupted compressed segment can't be read.
+  std::vector<uint8_t> corrupted;
+  memgraph::slk::Builder corrupted_builder([&corrupted](const uint8_t *data, size_t size, bool have_more) {
+    for (size_t i = 0; i < size; ++i) corrupted.push_back(data[i]);
+  });
+  corrupted_builder.EnableCompression();
+  corrupted_builder.Save(small.data(), small.size());
+  corrupted_builder.Finalize();
+  corrupted[2 * sizeof(memgraph::slk::SegmentSize) + 1] ^= 0xFF;
+  memgraph::slk::Reader corrupted_reader(corrupted.data(), corrupted.size());
+  std::vector<uint8_t> corrupted_output(small.size());
+  ASSERT_THROW(corrupted_reader.Load(corrupted_output.data(), corrupted_output.size()),
+               memgraph::slk::SlkReaderException);
+}
+
 TEST(CheckStreamComplete, SingleSegment) {
   std::vector<uint8_t> buffer;
   memgraph::slk::Builder builder([&buffer](const uint8_t *data, size_t size, bool have_more) {
@@ -138,6 +138,27 @@ TYPED_TEST(SmallVectorCommon, Resize) {
   EXPECT_EQ(std::as_const(vec).size(), kTwiceTheSmallStorage);
 }
 
+TYPED_TEST(SmallVectorCommon, ShrinkToFit) {
+  constexpr auto kMaxElements = 10;
+  auto vec = make_seq<TypeParam>(this, kMaxElements);
+  vec.push_back(this->make_value(kMaxElements));
+  EXPECT_LT(vec.size(), vec.capacity());
+
+  vec.shrink_to_fit();
+  EXPECT_EQ(std::as_const(vec).capacity(), kMaxElements + 1);
+  for (auto i : rv::iota(0, kMaxElements + 1)) {
+    EXPECT_EQ(vec[i], i);
+  }
+
+  // Back into the small buffer
+  vec.clear();
+  vec.shrink_to_fit();
+  EXPECT_EQ(std::as_const(vec).capacity(), small_vector<TypeParam>::kSmallCapacity);
+  EXPECT_TRUE(vec.empty());
+  vec.push_back(this->make_value(1));
+  EXPECT_EQ(vec[0], 1);
+}
+
 TYPED_TEST(SmallVectorCommon, ResizeToSame) {
   auto vec = make_seq<TypeParam>(this, 10);
   vec.resize(10);
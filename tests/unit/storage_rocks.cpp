@@ -13,6 +13,7 @@
 #include <gtest/gtest.h>
 #include <cassert>
 #include <exception>
+#include <limits>
 #include <string>
 #include <unordered_set>
 
@@ -60,7 +61,9 @@ TEST_F(RocksDBStorageTest, SerializeVertexGID) {
   auto acc = storage->Access();
   auto vertex = acc->CreateVertex();
   auto gid = vertex.Gid();
-  ASSERT_EQ(memgraph::utils::SerializeVertex(*vertex.vertex_), "|" + gid.ToString());
+  const auto key = memgraph::utils::SerializeVertex(*vertex.vertex_);
+  ASSERT_EQ(memgraph::utils::ExtractGidFromMainDiskStorage(key), gid);
+  ASSERT_TRUE(memgraph::utils::DeserializeLabelsFromMainDiskStorage(key).empty());
 }
 
 TEST_F(RocksDBStorageTest, SerializeVertexGIDLabels) {
@@ -71,8 +74,10 @@ TEST_F(RocksDBStorageTest, SerializeVertexGIDLabels) {
   ASSERT_FALSE(vertex.AddLabel(ser_player_label).HasError());
   ASSERT_FALSE(vertex.AddLabel(ser_user_label).HasError());
   auto gid = vertex.Gid();
-  ASSERT_EQ(memgraph::utils::SerializeVertex(*vertex.vertex_),
-            ser_player_label.ToString() + "," + ser_user_label.ToString() + "|" + gid.ToString());
+  const auto key = memgraph::utils::SerializeVertex(*vertex.vertex_);
+  ASSERT_EQ(memgraph::utils::ExtractGidFromMainDiskStorage(key), gid);
+  ASSERT_EQ(memgraph::utils::DeserializeLabelsFromMainDiskStorage(key),
+            (std::vector<LabelId>{ser_player_label, ser_user_label}));
 }
 
 TEST_F(RocksDBStorageTest, SerializePropertiesLocalBuffer) {
@@ -120,33 +125,29 @@ TEST_F(RocksDBStorageTest, SerializePropertiesExternalBuffer) {
   }
 }
 
-TEST(RocksDbSerDeSuite, ExtractVertexGidFromVertexKeyNoLabels) {
-  auto gid = Gid::FromInt(1);
-  Vertex vertex(gid, nullptr);
-  std::string serializedVertex = memgraph::utils::SerializeVertex(vertex);
-
-  ASSERT_EQ(memgraph::utils::ExtractGidFromKey(serializedVertex), "1");
+TEST(RocksDbSerDeSuite, ExtractVertexGidFromTextVertexKey) {
+  ASSERT_EQ(memgraph::utils::ExtractGidFromMainDiskStorage("|1"), Gid::FromInt(1));
+  ASSERT_EQ(memgraph::utils::ExtractGidFromMainDiskStorage("2|1"), Gid::FromInt(1));
+  ASSERT_EQ(memgraph::utils::ExtractGidFromMainDiskStorage("2,3,4|1"), Gid::FromInt(1));
 }
 
-TEST(RocksDbSerDeSuite, ExtractVertexGidFromVertexKeyWithOneLabel) {
-  auto gid = Gid::FromInt(1);
-  Vertex vertex(gid, nullptr);
-  vertex.labels.push_back(LabelId::FromInt(2));
-  std::string serializedVertex = memgraph::utils::SerializeVertex(vertex);
-
-  ASSERT_EQ(memgraph::utils::ExtractGidFromKey(serializedVertex), "1");
+TEST(RocksDbSerDeSuite, DeserializeLabelsFromTextVertexKey) {
+  ASSERT_TRUE(memgraph::utils::DeserializeLabelsFromMainDiskStorage("|1").empty());
+  ASSERT_EQ(memgraph::utils::DeserializeLabelsFromMainDiskStorage("2,3,4|1"),
+            (std::vector<LabelId>{LabelId::FromInt(2), LabelId::FromInt(3), LabelId::FromInt(4)}));
 }
 
-TEST(RocksDbSerDeSuite, ExtractVertexGidFromVertexKeyWithMultipleLabels) {
-  auto gid = Gid::FromInt(1);
+TEST(RocksDbSerDeSuite, SerializeVertexWithLargeIds) {
+  auto gid = Gid::FromUint(std::numeric_limits<uint64_t>::max() - 1);
   Vertex vertex(gid, nullptr);
-  std::vector<unsigned> labels = {2, 3, 4};
-  for (unsigned label : labels) {
-    vertex.labels.push_back(LabelId::FromInt(label));
-  }
+  vertex.labels.push_back(LabelId::FromUint(127));
+  vertex.labels.push_back(LabelId::FromUint(128));
+  vertex.labels.push_back(LabelId::FromUint(std::numeric_limits<uint32_t>::max()));
   std::string serializedVertex = memgraph::utils::SerializeVertex(vertex);
 
-  ASSERT_EQ(memgraph::utils::ExtractGidFromKey(serializedVertex), "1");
+  ASSERT_EQ(memgraph::utils::ExtractGidFromMainDiskStorage(serializedVertex), gid);
+  ASSERT_EQ(memgraph::utils::DeserializeLabelsFromMainDiskStorage(serializedVertex),
+            (std::vector<LabelId>{vertex.labels.begin(), vertex.labels.end()}));
 }
 
 TEST(RocksDbSerDeSuite, ExtractLabelsFromMainDiskStorageWhenOnlyOneLabel) {
@@ -180,7 +181,7 @@ TEST(RocksDbSerDeSuite, ExtractVertexGidFromMainDiskStorageNoLabels) {
   Vertex vertex(gid, nullptr);
   std::string serializedVertex = memgraph::utils::SerializeVertex(vertex);
 
-  ASSERT_EQ(memgraph::utils::ExtractGidFromMainDiskStorage(serializedVertex), "1");
+  ASSERT_EQ(memgraph::utils::ExtractGidFromMainDiskStorage(serializedVertex), gid);
 }
 
 TEST(RocksDbSerDeSuite, ExtractVertexGidFromMainDiskStorageWithOneLabel) {
@@ -189,7 +190,7 @@ TEST(RocksDbSerDeSuite, ExtractVertexGidFromMainDiskStorageWithOneLabel) {
   vertex.labels.push_back(LabelId::FromInt(2));
   std::string serializedVertex = memgraph::utils::SerializeVertex(vertex);
 
-  ASSERT_EQ(memgraph::utils::ExtractGidFromMainDiskStorage(serializedVertex), "1");
+  ASSERT_EQ(memgraph::utils::ExtractGidFromMainDiskStorage(serializedVertex), gid);
 }
 
 TEST(RocksDbSerDeSuite, ExtractVertexGidFromMainDiskStorageWithMultipleLabels) {
@@ -200,7 +201,7 @@ TEST(RocksDbSerDeSuite, ExtractVertexGidFromMainDiskStorageWithMultipleLabels) {
   vertex.labels.push_back(LabelId::FromInt(4));
   std::string serializedVertex = memgraph::utils::SerializeVertex(vertex);
 
-  ASSERT_EQ(memgraph::utils::ExtractGidFromLabelIndexStorage(serializedVertex), "1");
+  ASSERT_EQ(memgraph::utils::ExtractGidFromMainDiskStorage(serializedVertex), gid);
 }
 
 TEST(RocksDbSerDeSuite, ExtractGidFromLabelIndexStorageKey) {
@@ -98,6 +98,30 @@ TYPED_TEST(StorageV2Test, Commit) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(StorageV2Test, CreateManyVertices) {
+  // Bulk inserts reserve gids in blocks, but the gids stay consecutive
+  std::vector<memgraph::storage::Gid> gids;
+  {
+    auto acc = this->store->Access();
+    for (int i = 0; i < 3000; ++i) gids.push_back(acc->CreateVertex().Gid());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto acc = this->store->Access();
+    gids.push_back(acc->CreateVertex().Gid());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  for (size_t i = 1; i < gids.size(); ++i) {
+    ASSERT_EQ(gids[i].AsUint(), gids[i - 1].AsUint() + 1);
+  }
+  auto acc = this->store->Access();
+  EXPECT_EQ(CountVertices(*acc, memgraph::storage::View::OLD), gids.size());
+  for (const auto gid : gids) {
+    ASSERT_TRUE(acc->FindVertex(gid, memgraph::storage::View::OLD).has_value());
+  }
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TYPED_TEST(StorageV2Test, Abort) {
   memgraph::storage::Gid gid = memgraph::storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
@@ -233,6 +257,34 @@ TYPED_TEST(StorageV2Test, SnapshotIsolation) {
   acc3->Abort();
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(StorageV2Test, ChunkedVertices) {
+  std::vector<memgraph::storage::Gid> expected;
+  {
+    auto acc = this->store->Access();
+    for (int i = 0; i < 100; ++i) {
+      auto vertex = acc->CreateVertex();
+      if (i % 5 == 0) {
+        ASSERT_FALSE(acc->DeleteVertex(&vertex).HasError());
+      } else {
+        expected.push_back(vertex.Gid());
+      }
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  auto acc = this->store->Access();
+  for (size_t num_chunks : {1, 4, 9, 500}) {
+    std::vector<memgraph::storage::Gid> gids;
+    for (auto &chunk : acc->ChunkedVertices(memgraph::storage::View::OLD, num_chunks)) {
+      for (auto vertex : chunk) {
+        gids.push_back(vertex.Gid());
+      }
+    }
+    EXPECT_THAT(gids, testing::UnorderedElementsAreArray(expected)) << "num_chunks = " << num_chunks;
+  }
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TYPED_TEST(StorageV2Test, AccessorMove) {
   memgraph::storage::Gid gid = memgraph::storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
@@ -2256,6 +2308,49 @@ TYPED_TEST(StorageV2Test, VertexPropertyClear) {
   }
 }
 
+TYPED_TEST(StorageV2Test, VertexGetProperties) {
+  memgraph::storage::Gid gid = memgraph::storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
+  auto acc = this->store->Access();
+  auto property1 = acc->NameToProperty("property1");
+  auto property2 = acc->NameToProperty("property2");
+  auto property3 = acc->NameToProperty("property3");
+  const std::vector<memgraph::storage::PropertyId> properties{property3, property1, property2, property1};
+  {
+    auto vertex = acc->CreateVertex();
+    gid = vertex.Gid();
+    ASSERT_FALSE(vertex.SetProperty(property1, memgraph::storage::PropertyValue(42)).HasError());
+    ASSERT_FALSE(vertex.SetProperty(property2, memgraph::storage::PropertyValue("nandare")).HasError());
+
+    auto values = vertex.GetProperties(properties, memgraph::storage::View::NEW).GetValue();
+    ASSERT_EQ(values.size(), 4);
+    ASSERT_TRUE(values[0].IsNull());
+    ASSERT_EQ(values[1], memgraph::storage::PropertyValue(42));
+    ASSERT_EQ(values[2], memgraph::storage::PropertyValue("nandare"));
+    ASSERT_EQ(values[3], memgraph::storage::PropertyValue(42));
+
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto acc = this->store->Access();
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex);
+
+    ASSERT_FALSE(vertex->SetProperty(property1, memgraph::storage::PropertyValue()).HasError());
+    ASSERT_FALSE(vertex->SetProperty(property3, memgraph::storage::PropertyValue(false)).HasError());
+
+    auto old_values = vertex->GetProperties(properties, memgraph::storage::View::OLD).GetValue();
+    ASSERT_EQ(old_values, (std::vector{memgraph::storage::PropertyValue(), memgraph::storage::PropertyValue(42),
+                                       memgraph::storage::PropertyValue("nandare"),
+                                       memgraph::storage::PropertyValue(42)}));
+
+    auto new_values = vertex->GetProperties(properties, memgraph::storage::View::NEW).GetValue();
+    ASSERT_EQ(new_values, (std::vector{memgraph::storage::PropertyValue(false), memgraph::storage::PropertyValue(),
+                                       memgraph::storage::PropertyValue("nandare"), memgraph::storage::PropertyValue()}));
+
+    acc->Abort();
+  }
+}
+
 TYPED_TEST(StorageV2Test, VertexNonexistentLabelPropertyEdgeAPI) {
   auto label = this->store->NameToLabel("label");
   auto property = this->store->NameToProperty("property");
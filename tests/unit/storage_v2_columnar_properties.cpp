@@ -0,0 +1,222 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <map>
+
+#include "storage/v2/inmemory/storage.hpp"
+
+using memgraph::storage::Gid;
+using memgraph::storage::InMemoryStorage;
+using memgraph::storage::PropertyValue;
+using memgraph::storage::View;
+
+class ColumnarPropertiesTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    storage = std::make_unique<InMemoryStorage>(
+        memgraph::storage::Config{.gc = {.type = memgraph::storage::Config::Gc::Type::NONE}});
+    label = storage->NameToLabel("Label");
+    other_label = storage->NameToLabel("Other");
+    property = storage->NameToProperty("value");
+  }
+
+  std::map<Gid, PropertyValue> Scan(memgraph::storage::Storage::Accessor *acc, View view = View::OLD) {
+    std::map<Gid, PropertyValue> ret;
+    auto *mem_acc = static_cast<InMemoryStorage::InMemoryAccessor *>(acc);
+    EXPECT_TRUE(mem_acc->ScanColumnarProperty(label, property, view, [&](const auto &vertex, const auto &value) {
+      EXPECT_TRUE(ret.emplace(vertex.Gid(), value).second);
+    }));
+    return ret;
+  }
+
+  void CreateColumnarProperty() {
+    auto acc = storage->UniqueAccess();
+    auto *mem_acc = static_cast<InMemoryStorage::InMemoryAccessor *>(acc.get());
+    ASSERT_FALSE(mem_acc->CreateColumnarProperty(label, property).HasError());
+    ASSERT_TRUE(mem_acc->CreateColumnarProperty(label, property).HasError());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  std::unique_ptr<memgraph::storage::Storage> storage;
+  memgraph::storage::LabelId label;
+  memgraph::storage::LabelId other_label;
+  memgraph::storage::PropertyId property;
+};
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(ColumnarPropertiesTest, ScanExistingVertices) {
+  std::vector<Gid> gids;
+  {
+    auto acc = storage->Access();
+    for (int64_t i = 0; i < 10; ++i) {
+      auto vertex = acc->CreateVertex();
+      gids.push_back(vertex.Gid());
+      ASSERT_FALSE(vertex.AddLabel(i % 2 == 0 ? label : other_label).HasError());
+      ASSERT_FALSE(vertex.SetProperty(property, PropertyValue(i)).HasError());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  storage->FreeMemory();
+  CreateColumnarProperty();
+
+  auto acc = storage->Access();
+  auto values = Scan(acc.get());
+  ASSERT_EQ(values.size(), 5);
+  for (int64_t i = 0; i < 10; i += 2) {
+    ASSERT_EQ(values.at(gids[i]), PropertyValue(i));
+  }
+
+  {
+    auto *mem_acc = static_cast<InMemoryStorage::InMemoryAccessor *>(acc.get());
+    ASSERT_FALSE(mem_acc->ScanColumnarProperty(other_label, property, View::OLD, [](const auto &, const auto &) {}));
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(ColumnarPropertiesTest, ScanRespectsTransactions) {
+  CreateColumnarProperty();
+
+  Gid gid;
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->CreateVertex();
+    gid = vertex.Gid();
+    ASSERT_FALSE(vertex.AddLabel(label).HasError());
+    ASSERT_FALSE(vertex.SetProperty(property, PropertyValue(1)).HasError());
+    // The vertex got the label in this transaction, it is read through its delta chain.
+    ASSERT_EQ(Scan(acc.get(), View::NEW).at(gid), PropertyValue(1));
+    ASSERT_TRUE(Scan(acc.get(), View::OLD).empty());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  storage->FreeMemory();
+
+  auto reader = storage->Access();
+  ASSERT_EQ(Scan(reader.get()).at(gid), PropertyValue(1));
+
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gid, View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_FALSE(vertex->SetProperty(property, PropertyValue(2)).HasError());
+    ASSERT_EQ(Scan(acc.get(), View::NEW).at(gid), PropertyValue(2));
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  storage->FreeMemory();
+
+  // The older transaction still sees the old value.
+  ASSERT_EQ(Scan(reader.get()).at(gid), PropertyValue(1));
+  ASSERT_FALSE(reader->Commit().HasError());
+  storage->FreeMemory();
+
+  {
+    auto acc = storage->Access();
+    ASSERT_EQ(Scan(acc.get()).at(gid), PropertyValue(2));
+  }
+
+  // Aborted changes don't leak into the columnar values.
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gid, View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_FALSE(vertex->SetProperty(property, PropertyValue(3)).HasError());
+    auto created = acc->CreateVertex();
+    ASSERT_FALSE(created.AddLabel(label).HasError());
+    acc->Abort();
+  }
+  {
+    auto acc = storage->Access();
+    auto values = Scan(acc.get());
+    ASSERT_EQ(values.size(), 1);
+    ASSERT_EQ(values.at(gid), PropertyValue(2));
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(ColumnarPropertiesTest, RemovedLabelsAndDeletedVertices) {
+  CreateColumnarProperty();
+
+  std::vector<Gid> gids;
+  {
+    auto acc = storage->Access();
+    for (int64_t i = 0; i < 3; ++i) {
+      auto vertex = acc->CreateVertex();
+      gids.push_back(vertex.Gid());
+      ASSERT_FALSE(vertex.AddLabel(label).HasError());
+      ASSERT_FALSE(vertex.SetProperty(property, PropertyValue(i)).HasError());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  storage->FreeMemory();
+
+  {
+    auto acc = storage->Access();
+    auto first = acc->FindVertex(gids[0], View::OLD);
+    ASSERT_TRUE(first);
+    ASSERT_FALSE(first->RemoveLabel(label).HasError());
+    auto second = acc->FindVertex(gids[1], View::OLD);
+    ASSERT_TRUE(second);
+    ASSERT_FALSE(acc->DeleteVertex(&*second).HasError());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  storage->FreeMemory();
+
+  auto acc = storage->Access();
+  auto values = Scan(acc.get());
+  ASSERT_EQ(values.size(), 1);
+  ASSERT_EQ(values.at(gids[2]), PropertyValue(2));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(ColumnarPropertiesTest, StaleVerticesAreReadThroughTheAccessor) {
+  CreateColumnarProperty();
+
+  Gid gid;
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->CreateVertex();
+    gid = vertex.Gid();
+    ASSERT_FALSE(vertex.AddLabel(label).HasError());
+    ASSERT_FALSE(vertex.SetProperty(property, PropertyValue(1)).HasError());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  storage->FreeMemory();
+
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gid, View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_FALSE(vertex->vertex_->columnar_stale);
+    // The state between the unlinking of a committed change and the refresh
+    // of the columns: the vertex has no delta chain, but the stored value is
+    // older than its current one.
+    vertex->vertex_->properties.SetProperty(property, PropertyValue(2));
+    vertex->vertex_->columnar_stale = true;
+    ASSERT_EQ(Scan(acc.get()).at(gid), PropertyValue(2));
+  }
+
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gid, View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_FALSE(vertex->SetProperty(property, PropertyValue(3)).HasError());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  storage->FreeMemory();
+
+  auto acc = storage->Access();
+  auto vertex = acc->FindVertex(gid, View::OLD);
+  ASSERT_TRUE(vertex);
+  ASSERT_FALSE(vertex->vertex_->columnar_stale);
+  ASSERT_EQ(Scan(acc.get()).at(gid), PropertyValue(3));
+}
@@ -294,6 +294,64 @@ TYPED_TEST(ConstraintsTest, ExistenceConstraintsViolationOnCommit) {
   }
 }
 
+TYPED_TEST(ConstraintsTest, ExistenceConstraintsRemovedProperties) {
+  {
+    auto unique_acc = this->db_acc_->get()->UniqueAccess();
+    ASSERT_NO_ERROR(unique_acc->CreateExistenceConstraint(this->label1, this->prop1));
+    ASSERT_NO_ERROR(unique_acc->Commit());
+  }
+  {
+    auto acc = this->storage->Access();
+    auto vertex = acc->CreateVertex();
+    ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+    ASSERT_NO_ERROR(vertex.SetProperty(this->prop1, PropertyValue(1)));
+    ASSERT_NO_ERROR(vertex.SetProperty(this->prop2, PropertyValue(2)));
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  // Removing a property no constraint is on doesn't violate one
+  {
+    auto acc = this->storage->Access();
+    for (auto vertex : acc->Vertices(View::OLD)) {
+      ASSERT_NO_ERROR(vertex.SetProperty(this->prop2, PropertyValue()));
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  // Neither does removing a property which is set again before the commit
+  {
+    auto acc = this->storage->Access();
+    for (auto vertex : acc->Vertices(View::OLD)) {
+      ASSERT_NO_ERROR(vertex.SetProperty(this->prop1, PropertyValue()));
+      ASSERT_NO_ERROR(vertex.SetProperty(this->prop1, PropertyValue(3)));
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  // Clearing the properties removes the constrained one too
+  {
+    auto acc = this->storage->Access();
+    for (auto vertex : acc->Vertices(View::OLD)) {
+      ASSERT_NO_ERROR(vertex.ClearProperties());
+    }
+    auto res = acc->Commit();
+    ASSERT_TRUE(res.HasError());
+    EXPECT_EQ(
+        std::get<ConstraintViolation>(res.GetError()),
+        (ConstraintViolation{ConstraintViolation::Type::EXISTENCE, this->label1, std::set<PropertyId>{this->prop1}}));
+  }
+
+  // The vertex doesn't have to keep the property once it lost the label
+  {
+    auto acc = this->storage->Access();
+    for (auto vertex : acc->Vertices(View::OLD)) {
+      ASSERT_NO_ERROR(vertex.RemoveLabel(this->label1));
+      ASSERT_NO_ERROR(vertex.SetProperty(this->prop1, PropertyValue()));
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TYPED_TEST(ConstraintsTest, UniqueConstraintsCreateAndDropAndList) {
   {
@@ -1546,3 +1604,115 @@ TYPED_TEST(ConstraintsTest, TypeConstraintsDrop) {
     ASSERT_NO_ERROR(res2);
   }
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(UniqueConstraintsHashTableTest, ValidateAndCollect) {
+  memgraph::storage::Config config;
+  config.indices.hash_unique_constraints = true;
+  memgraph::storage::InMemoryStorage storage(config);
+  auto label = storage.NameToLabel("label");
+  auto prop = storage.NameToProperty("prop");
+  {
+    auto acc = storage.Access();
+    auto vertex1 = acc->CreateVertex();
+    auto vertex2 = acc->CreateVertex();
+    ASSERT_NO_ERROR(vertex1.AddLabel(label));
+    ASSERT_NO_ERROR(vertex1.SetProperty(prop, PropertyValue(1)));
+    ASSERT_NO_ERROR(vertex2.AddLabel(label));
+    ASSERT_NO_ERROR(vertex2.SetProperty(prop, PropertyValue(2)));
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+  {
+    auto unique_acc = storage.UniqueAccess();
+    auto res = unique_acc->CreateUniqueConstraint(label, {prop});
+    ASSERT_TRUE(res.HasValue());
+    ASSERT_EQ(res.GetValue(), UniqueConstraints::CreationStatus::SUCCESS);
+    ASSERT_NO_ERROR(unique_acc->Commit());
+  }
+
+  // Values which compare equal violate the constraint regardless of their type
+  {
+    auto acc = storage.Access();
+    auto vertex = acc->CreateVertex();
+    ASSERT_NO_ERROR(vertex.AddLabel(label));
+    ASSERT_NO_ERROR(vertex.SetProperty(prop, PropertyValue(1.0)));
+    auto res = acc->Commit();
+    ASSERT_TRUE(res.HasError());
+    EXPECT_EQ(std::get<ConstraintViolation>(res.GetError()),
+              (ConstraintViolation{ConstraintViolation::Type::UNIQUE, label, std::set<PropertyId>{prop}}));
+  }
+
+  // A value becomes available once the vertex holding it changes
+  {
+    auto acc = storage.Access();
+    for (auto vertex : acc->Vertices(View::OLD)) {
+      if (vertex.GetProperty(prop, View::OLD)->ValueInt() == 1) {
+        ASSERT_NO_ERROR(vertex.SetProperty(prop, PropertyValue(3)));
+      }
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+  storage.FreeMemory({}, false);
+  {
+    auto acc = storage.Access();
+    auto vertex = acc->CreateVertex();
+    ASSERT_NO_ERROR(vertex.AddLabel(label));
+    ASSERT_NO_ERROR(vertex.SetProperty(prop, PropertyValue(1)));
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+  {
+    auto acc = storage.Access();
+    auto vertex = acc->CreateVertex();
+    ASSERT_NO_ERROR(vertex.AddLabel(label));
+    ASSERT_NO_ERROR(vertex.SetProperty(prop, PropertyValue(3)));
+    ASSERT_TRUE(acc->Commit().HasError());
+  }
+}
+
+TEST(ExistenceConstraintsTest, ParallelValidation) {
+  memgraph::storage::InMemoryStorage storage;
+  auto label = storage.NameToLabel("label");
+  auto prop = storage.NameToProperty("prop");
+  {
+    auto unique_acc = storage.UniqueAccess();
+    ASSERT_NO_ERROR(unique_acc->CreateExistenceConstraint(label, prop));
+    ASSERT_NO_ERROR(unique_acc->Commit());
+  }
+
+  // Enough vertices for the commit to validate them on multiple threads
+  const auto vertex_count = ExistenceConstraints::kParallelValidationThreshold + 1;
+  {
+    auto acc = storage.Access();
+    for (size_t i = 0; i < vertex_count; ++i) {
+      auto vertex = acc->CreateVertex();
+      ASSERT_NO_ERROR(vertex.AddLabel(label));
+      ASSERT_NO_ERROR(vertex.SetProperty(prop, PropertyValue(static_cast<int64_t>(i))));
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  // A single vertex without the property fails the whole commit
+  {
+    auto acc = storage.Access();
+    size_t i = 0;
+    for (auto vertex : acc->Vertices(View::OLD)) {
+      ASSERT_NO_ERROR(vertex.SetProperty(prop, PropertyValue()));
+      if (i++ != vertex_count / 2) {
+        ASSERT_NO_ERROR(vertex.SetProperty(prop, PropertyValue(0)));
+      }
+    }
+    auto res = acc->Commit();
+    ASSERT_TRUE(res.HasError());
+    EXPECT_EQ(std::get<ConstraintViolation>(res.GetError()),
+              (ConstraintViolation{ConstraintViolation::Type::EXISTENCE, label, std::set<PropertyId>{prop}}));
+  }
+
+  {
+    auto acc = storage.Access();
+    for (auto vertex : acc->Vertices(View::OLD)) {
+      ASSERT_NO_ERROR(vertex.SetProperty(prop, PropertyValue()));
+      ASSERT_NO_ERROR(vertex.SetProperty(prop, PropertyValue(1)));
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+}
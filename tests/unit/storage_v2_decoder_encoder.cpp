@@ -433,6 +433,10 @@ TEST_F(DecoderEncoderTest, PropertyValueInvalidMarker) {
         case memgraph::storage::durability::Marker::DELTA_UNIQUE_CONSTRAINT_DROP:
         case memgraph::storage::durability::Marker::DELTA_TYPE_CONSTRAINT_CREATE:
         case memgraph::storage::durability::Marker::DELTA_TYPE_CONSTRAINT_DROP:
+        case memgraph::storage::durability::Marker::DELTA_VECTOR_INDEX_CREATE:
+        case memgraph::storage::durability::Marker::DELTA_VECTOR_INDEX_DROP:
+        case memgraph::storage::durability::Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+        case memgraph::storage::durability::Marker::DELTA_LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
         case memgraph::storage::durability::Marker::DELTA_ENUM_CREATE:
         case memgraph::storage::durability::Marker::DELTA_ENUM_ALTER_ADD:
         case memgraph::storage::durability::Marker::DELTA_ENUM_ALTER_UPDATE:
@@ -516,6 +520,42 @@ TEST_F(DecoderEncoderTest, DecoderPosition) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(DecoderEncoderTest, MemoryMappedDecoder) {
+  {
+    memgraph::storage::durability::Encoder encoder;
+    encoder.Initialize(storage_file, kTestMagic, kTestVersion);
+    for (uint64_t i = 0; i < 100000; ++i) {
+      encoder.WriteUint(i);
+    }
+    encoder.WriteString("end");
+    encoder.Finalize();
+  }
+  {
+    memgraph::storage::durability::Decoder decoder;
+    auto version = decoder.Initialize(storage_file, kTestMagic, /* memory_mapped = */ true);
+    ASSERT_TRUE(version);
+    ASSERT_EQ(*version, kTestVersion);
+    const auto start = decoder.GetPosition();
+    ASSERT_TRUE(start);
+    for (uint64_t i = 0; i < 100000; ++i) {
+      auto decoded = decoder.ReadUint();
+      ASSERT_TRUE(decoded);
+      ASSERT_EQ(*decoded, i);
+    }
+    auto decoded = decoder.ReadString();
+    ASSERT_TRUE(decoded);
+    ASSERT_EQ(*decoded, "end");
+    ASSERT_EQ(decoder.GetPosition(), decoder.GetSize());
+    ASSERT_FALSE(decoder.ReadUint());
+
+    ASSERT_TRUE(decoder.SetPosition(*start));
+    auto first = decoder.ReadUint();
+    ASSERT_TRUE(first);
+    ASSERT_EQ(*first, 0);
+  }
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_F(DecoderEncoderTest, EncoderPosition) {
   {
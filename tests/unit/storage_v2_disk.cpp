@@ -13,6 +13,7 @@
 
 #include "disk_test_utils.hpp"
 #include "storage/v2/disk/storage.hpp"
+#include "storage/v2/disk/vertex_cache.hpp"
 #include "storage/v2/inmemory/storage.hpp"
 #include "utils/file.hpp"
 
@@ -27,3 +28,76 @@ TEST_F(DiskStorageTest, CreateDiskStorageInDataDirectory) {
 
   disk_test_utils::RemoveRocksDbDirs(testSuite);
 }
+
+TEST(DiskVertexCacheTest, EntriesAreValidFromTheirReadTimestamp) {
+  memgraph::storage::DiskVertexCache cache(10);
+  const auto gid = memgraph::storage::Gid::FromUint(1);
+  cache.Insert(gid, "key", "value", 5);
+  ASSERT_FALSE(cache.Find(gid, 4));
+  auto entry = cache.Find(gid, 6);
+  ASSERT_TRUE(entry);
+  ASSERT_EQ(entry->key, "key");
+  ASSERT_EQ(entry->value, "value");
+}
+
+TEST(DiskVertexCacheTest, CommitInvalidatesEarlierReads) {
+  memgraph::storage::DiskVertexCache cache(10);
+  const auto gid = memgraph::storage::Gid::FromUint(1);
+  cache.Insert(gid, "key", "value", 5);
+  cache.Invalidate(std::vector{gid}, 7);
+  ASSERT_FALSE(cache.Find(gid, 8));
+
+  // A transaction which started before the commit read the old version.
+  cache.Insert(gid, "key", "value", 6);
+  ASSERT_FALSE(cache.Find(gid, 8));
+
+  cache.Insert(gid, "key", "new value", 8);
+  ASSERT_EQ(cache.Find(gid, 8)->value, "new value");
+}
+
+TEST(DiskVertexCacheTest, Capacity) {
+  memgraph::storage::DiskVertexCache cache(1);
+  cache.Insert(memgraph::storage::Gid::FromUint(1), "1", "", 1);
+  cache.Insert(memgraph::storage::Gid::FromUint(2), "2", "", 1);
+  ASSERT_TRUE(cache.Find(memgraph::storage::Gid::FromUint(1), 1));
+  ASSERT_FALSE(cache.Find(memgraph::storage::Gid::FromUint(2), 1));
+}
+
+TEST(DiskVertexCacheTest, StorageReadsCommittedChangesOfCachedVertices) {
+  const std::string testSuite = "storage_v2_disk_vertex_cache";
+  memgraph::storage::Config config = disk_test_utils::GenerateOnDiskConfig(testSuite);
+  config.disk.vertex_cache_size = 10;
+  auto storage = std::make_unique<memgraph::storage::DiskStorage>(config);
+  const auto property = storage->NameToProperty("p");
+
+  memgraph::storage::Gid gid;
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->CreateVertex();
+    gid = vertex.Gid();
+    ASSERT_FALSE(vertex.SetProperty(property, memgraph::storage::PropertyValue(1)).HasError());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  for (auto i = 0; i < 2; ++i) {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_EQ(*vertex->GetProperty(property, memgraph::storage::View::OLD), memgraph::storage::PropertyValue(1));
+  }
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_FALSE(vertex->SetProperty(property, memgraph::storage::PropertyValue(2)).HasError());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_EQ(*vertex->GetProperty(property, memgraph::storage::View::OLD), memgraph::storage::PropertyValue(2));
+  }
+
+  storage.reset();
+  disk_test_utils::RemoveRocksDbDirs(testSuite);
+}
@@ -25,6 +25,7 @@
 #include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "dbms/database.hpp"
 #include "license/license.hpp"
@@ -52,6 +53,7 @@
 
 using memgraph::replication_coordination_glue::ReplicationRole;
 using testing::Contains;
+using testing::ElementsAre;
 using testing::UnorderedElementsAre;
 
 using namespace std::string_literals;
@@ -277,7 +279,8 @@ class DurabilityTest : public ::testing::TestWithParam<bool> {
       // Create label+property index statistics.
       auto acc = store->Access();
       acc->SetIndexStats(label_indexed, property_count,
-                         memgraph::storage::LabelPropertyIndexStats{456798, 312345, 12312312.2, 123123.2, 67876.9});
+                         memgraph::storage::LabelPropertyIndexStats{456798, 312345, 12312312.2, 123123.2, 67876.9,
+                                                                    {-1.5, 0.0, 0.0, 17.25, 1e20}});
       ASSERT_TRUE(acc->GetIndexStats(label_indexed, property_count));
       ASSERT_FALSE(acc->Commit().HasError());
     }
@@ -472,6 +475,7 @@ class DurabilityTest : public ::testing::TestWithParam<bool> {
           ASSERT_EQ(lp_stats->statistic, 12312312.2);
           ASSERT_EQ(lp_stats->avg_group_size, 123123.2);
           ASSERT_EQ(lp_stats->avg_degree, 67876.9);
+          ASSERT_THAT(lp_stats->histogram, ElementsAre(-1.5, 0.0, 0.0, 17.25, 1e20));
           break;
         }
         case DatasetType::ONLY_BASE_WITH_EXTENDED_INDICES_AND_CONSTRAINTS:
@@ -502,6 +506,7 @@ class DurabilityTest : public ::testing::TestWithParam<bool> {
           ASSERT_EQ(lp_stats_ex->statistic, 12312312.2);
           ASSERT_EQ(lp_stats_ex->avg_group_size, 123123.2);
           ASSERT_EQ(lp_stats_ex->avg_degree, 67876.9);
+          ASSERT_THAT(lp_stats_ex->histogram, ElementsAre(-1.5, 0.0, 0.0, 17.25, 1e20));
           break;
         }
       }
@@ -1088,6 +1093,31 @@ TEST_P(DurabilityTest, SnapshotPeriodic) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, SnapshotPeriodicSkippedWhileWalIsSmall) {
+  memgraph::storage::Config config{
+      .durability = {.storage_directory = storage_directory,
+                     .snapshot_wal_mode =
+                         memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+                     .snapshot_interval = std::chrono::hours(1),
+                     .snapshot_min_wal_percent = 1},
+      .salient = {.items = {.properties_on_edges = GetParam()}},
+  };
+  memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+  memgraph::dbms::Database db{config, repl_state};
+  auto *in_memory = static_cast<memgraph::storage::InMemoryStorage *>(db.storage());
+
+  // There is no snapshot the WAL files could be replayed on yet.
+  CreateBaseDataset(db.storage(), GetParam());
+  ASSERT_TRUE(in_memory->PeriodicSnapshotNeeded());
+
+  ASSERT_FALSE(in_memory->CreateSnapshot(ReplicationRole::MAIN).HasError());
+  ASSERT_FALSE(in_memory->PeriodicSnapshotNeeded());
+
+  CreateExtendedDataset(db.storage());
+  ASSERT_TRUE(in_memory->PeriodicSnapshotNeeded());
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_P(DurabilityTest, SnapshotFallback) {
   // Create snapshot.
@@ -1643,6 +1673,50 @@ TEST_P(DurabilityTest, WalBasic) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, WalParallelRecovery) {
+  // Create WALs.
+  {
+    memgraph::storage::Config config{
+        .durability = {.storage_directory = storage_directory,
+                       .snapshot_wal_mode =
+                           memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+                       .snapshot_interval = std::chrono::minutes(20),
+                       .wal_file_flush_every_n_tx = kFlushWalEvery},
+        .salient = {.items = {.properties_on_edges = GetParam()}},
+    };
+    memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+    memgraph::dbms::Database db{config, repl_state};
+    CreateBaseDataset(db.storage(), GetParam());
+    CreateExtendedDataset(db.storage());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 0);
+  ASSERT_GE(GetWalsList().size(), 1);
+
+  // Recover WALs in small windows so that a single WAL is replayed in many of them.
+  memgraph::storage::Config config{
+      .durability = {.storage_directory = storage_directory,
+                     .recover_on_startup = true,
+                     .items_per_batch = 13,
+                     .recovery_thread_count = 4,
+                     .allow_parallel_wal_recovery = true},
+      .salient = {.items = {.properties_on_edges = GetParam()}},
+  };
+  memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+  memgraph::dbms::Database db{config, repl_state};
+  VerifyDataset(db.storage(), DatasetType::BASE_WITH_EXTENDED, GetParam());
+
+  // Try to use the storage.
+  {
+    auto acc = db.Access();
+    auto vertex = acc->CreateVertex();
+    auto edge = acc->CreateEdge(&vertex, &vertex, db.storage()->NameToEdgeType("et"));
+    ASSERT_TRUE(edge.HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_P(DurabilityTest, WalBackup) {
   // Create WALs.
@@ -1692,6 +1766,54 @@ TEST_P(DurabilityTest, WalBackup) {
   ASSERT_EQ(GetBackupWalsList().size(), num_wals);
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, WalGroupCommit) {
+  static constexpr uint64_t kNumThreads = 4;
+  static constexpr uint64_t kNumTransactions = 200;
+  // Create WALs; the small WAL size makes the files rotate during the commits.
+  {
+    memgraph::storage::Config config{
+        .durability = {.storage_directory = storage_directory,
+                       .snapshot_wal_mode =
+                           memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+                       .snapshot_interval = std::chrono::minutes(20),
+                       .wal_file_size_kibibytes = 1,
+                       .wal_group_commit = true},
+        .salient = {.items = {.properties_on_edges = GetParam()}},
+    };
+    memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+    memgraph::dbms::Database db{config, repl_state};
+    std::vector<std::jthread> threads;
+    threads.reserve(kNumThreads);
+    for (uint64_t i = 0; i < kNumThreads; ++i) {
+      threads.emplace_back([&db] {
+        for (uint64_t j = 0; j < kNumTransactions; ++j) {
+          auto acc = db.Access();
+          acc->CreateVertex();
+          ASSERT_FALSE(acc->Commit().HasError());
+        }
+      });
+    }
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 0);
+  ASSERT_GE(GetWalsList().size(), 2);
+
+  // Recover WALs.
+  memgraph::storage::Config config{
+      .durability = {.storage_directory = storage_directory, .recover_on_startup = true},
+      .salient = {.items = {.properties_on_edges = GetParam()}},
+  };
+  memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+  memgraph::dbms::Database db{config, repl_state};
+  auto acc = db.Access();
+  uint64_t count = 0;
+  for ([[maybe_unused]] auto vertex : acc->Vertices(memgraph::storage::View::OLD)) {
+    ++count;
+  }
+  ASSERT_EQ(count, kNumThreads * kNumTransactions);
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_P(DurabilityTest, WalAppendToExisting) {
   // Create WALs.
@@ -2151,6 +2273,69 @@ TEST_P(DurabilityTest, WalTransactionOrdering) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, WalRepeatedSetPropertyWrittenOnce) {
+  memgraph::storage::Gid gid;
+
+  // Create WAL.
+  {
+    memgraph::storage::Config config{
+        .durability = {.storage_directory = storage_directory,
+                       .snapshot_wal_mode =
+                           memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+                       .snapshot_interval = std::chrono::minutes(20),
+                       .wal_file_flush_every_n_tx = kFlushWalEvery},
+        .salient = {.items = {.properties_on_edges = GetParam()}},
+    };
+    memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+    memgraph::dbms::Database db{config, repl_state};
+    auto acc = db.Access();
+    auto vertex = acc->CreateVertex();
+    gid = vertex.Gid();
+    const auto counter = db.storage()->NameToProperty("counter");
+    for (int64_t i = 0; i < 10; ++i) {
+      ASSERT_TRUE(vertex.SetProperty(counter, memgraph::storage::PropertyValue(i)).HasValue());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  ASSERT_EQ(GetWalsList().size(), 1);
+
+  // Verify WAL data.
+  {
+    auto path = GetWalsList().front();
+    auto info = memgraph::storage::durability::ReadWalInfo(path);
+    memgraph::storage::durability::Decoder wal;
+    wal.Initialize(path, memgraph::storage::durability::kWalMagic);
+    wal.SetPosition(info.offset_deltas);
+    ASSERT_EQ(info.num_deltas, 3);
+    std::vector<memgraph::storage::durability::WalDeltaData> data;
+    for (uint64_t i = 0; i < info.num_deltas; ++i) {
+      memgraph::storage::durability::ReadWalDeltaHeader(&wal);
+      data.emplace_back(memgraph::storage::durability::ReadWalDeltaData(&wal));
+    }
+    ASSERT_EQ(data[0].type, memgraph::storage::durability::WalDeltaData::Type::VERTEX_CREATE);
+    ASSERT_EQ(data[1].type, memgraph::storage::durability::WalDeltaData::Type::VERTEX_SET_PROPERTY);
+    ASSERT_EQ(data[1].vertex_edge_set_property.gid, gid);
+    ASSERT_EQ(data[1].vertex_edge_set_property.property, "counter");
+    ASSERT_EQ(data[1].vertex_edge_set_property.value, memgraph::storage::PropertyValue(9));
+    ASSERT_EQ(data[2].type, memgraph::storage::durability::WalDeltaData::Type::TRANSACTION_END);
+  }
+
+  // Recover WALs.
+  memgraph::storage::Config config{
+      .durability = {.storage_directory = storage_directory, .recover_on_startup = true},
+      .salient = {.items = {.properties_on_edges = GetParam()}},
+  };
+  memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+  memgraph::dbms::Database db{config, repl_state};
+  auto acc = db.Access();
+  auto vertex = acc->FindVertex(gid, memgraph::storage::View::OLD);
+  ASSERT_TRUE(vertex);
+  ASSERT_EQ(*vertex->GetProperty(db.storage()->NameToProperty("counter"), memgraph::storage::View::OLD),
+            memgraph::storage::PropertyValue(9));
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_P(DurabilityTest, WalCreateAndRemoveOnlyBaseDataset) {
   // Create WALs.
@@ -3110,6 +3295,144 @@ TEST_P(DurabilityTest, ParallelConstraintsRecovery) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, ParallelSnapshotCreation) {
+  // Create snapshot.
+  {
+    memgraph::storage::Config config{
+        .durability = {.storage_directory = storage_directory,
+                       .snapshot_on_exit = true,
+                       .items_per_batch = 13,
+                       .recovery_thread_count = 4,
+                       .allow_parallel_snapshot_creation = true},
+        .salient = {.items = {.properties_on_edges = GetParam()}},
+    };
+    memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+    memgraph::dbms::Database db{config, repl_state};
+    CreateBaseDataset(db.storage(), GetParam());
+    VerifyDataset(db.storage(), DatasetType::ONLY_BASE, GetParam());
+    CreateExtendedDataset(db.storage());
+    VerifyDataset(db.storage(), DatasetType::BASE_WITH_EXTENDED, GetParam());
+  }
+
+  // The segments written by the threads are removed after they are appended.
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+  ASSERT_EQ(GetBackupSnapshotsList().size(), 0);
+  ASSERT_EQ(GetWalsList().size(), 0);
+  ASSERT_EQ(GetBackupWalsList().size(), 0);
+
+  // Recover snapshot.
+  memgraph::storage::Config config{
+      .durability = {.storage_directory = storage_directory,
+                     .recover_on_startup = true,
+                     .snapshot_on_exit = false,
+                     .items_per_batch = 13},
+      .salient = {.items = {.properties_on_edges = GetParam()}},
+  };
+  memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+  memgraph::dbms::Database db{config, repl_state};
+  VerifyDataset(db.storage(), DatasetType::BASE_WITH_EXTENDED, GetParam());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, SegmentsOfUnfinishedSnapshotRemovedOnStartup) {
+  // Create snapshot.
+  {
+    memgraph::storage::Config config{
+        .durability = {.storage_directory = storage_directory, .snapshot_on_exit = true},
+        .salient = {.items = {.properties_on_edges = GetParam()}},
+    };
+    memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+    memgraph::dbms::Database db{config, repl_state};
+    CreateBaseDataset(db.storage(), GetParam());
+  }
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+
+  // The segments of a snapshot the process was killed while writing.
+  const auto segment = GetSnapshotsList().front().string() + "_next.segment_0";
+  {
+    memgraph::utils::OutputFile file;
+    file.Open(segment, memgraph::utils::OutputFile::Mode::OVERWRITE_EXISTING);
+    file.Write("segment");
+    file.Close();
+  }
+  ASSERT_EQ(GetSnapshotsList().size(), 2);
+
+  // Recover snapshot.
+  memgraph::storage::Config config{
+      .durability = {.storage_directory = storage_directory, .recover_on_startup = true, .snapshot_on_exit = false},
+      .salient = {.items = {.properties_on_edges = GetParam()}},
+  };
+  memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+  memgraph::dbms::Database db{config, repl_state};
+  ASSERT_FALSE(std::filesystem::exists(segment));
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+  VerifyDataset(db.storage(), DatasetType::ONLY_BASE, GetParam());
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, SnapshotBatchCompression) {
+  // Create snapshot.
+  {
+    memgraph::storage::Config config{
+        .durability = {.storage_directory = storage_directory,
+                       .snapshot_on_exit = true,
+                       .items_per_batch = 13,
+                       .snapshot_batch_compression = true},
+        .salient = {.items = {.properties_on_edges = GetParam()}},
+    };
+    memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+    memgraph::dbms::Database db{config, repl_state};
+    CreateBaseDataset(db.storage(), GetParam());
+    CreateExtendedDataset(db.storage());
+    VerifyDataset(db.storage(), DatasetType::BASE_WITH_EXTENDED, GetParam());
+  }
+
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+  const auto snapshot = *GetSnapshotsList().begin();
+  ASSERT_TRUE(memgraph::storage::durability::ReadSnapshotInfo(snapshot).compressed_batches);
+
+  // Recover snapshot.
+  memgraph::storage::Config config{
+      .durability = {.storage_directory = storage_directory, .recover_on_startup = true, .items_per_batch = 13},
+      .salient = {.items = {.properties_on_edges = GetParam()}},
+  };
+  {
+    memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+    memgraph::dbms::Database db{config, repl_state};
+    VerifyDataset(db.storage(), DatasetType::BASE_WITH_EXTENDED, GetParam());
+  }
+
+  // Flip a byte in the compressed data of the first vertex batch; the header of
+  // the batch consists of three integers.
+  {
+    const auto info = memgraph::storage::durability::ReadSnapshotInfo(snapshot);
+    const auto position = info.offset_vertices + 3 * (sizeof(uint8_t) + sizeof(uint64_t)) + 1;
+    uint8_t value = 0;
+    {
+      memgraph::utils::InputFile file;
+      ASSERT_TRUE(file.Open(snapshot));
+      ASSERT_TRUE(file.SetPosition(memgraph::utils::InputFile::Position::SET, position).has_value());
+      ASSERT_TRUE(file.Read(&value, sizeof(value)));
+    }
+    value = ~value;
+    memgraph::utils::OutputFile file;
+    file.Open(snapshot, memgraph::utils::OutputFile::Mode::OVERWRITE_EXISTING);
+    file.SetPosition(memgraph::utils::OutputFile::Position::SET, position);
+    file.Write(&value, sizeof(value));
+    file.Sync();
+    file.Close();
+  }
+
+  ASSERT_DEATH(
+      ([&]() {
+        memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+        memgraph::dbms::Database db{config, repl_state};
+      }())  // iile
+      ,
+      "");
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TEST_P(DurabilityTest, ConstraintsRecoveryFunctionSetting) {
   memgraph::storage::Config config{
@@ -3362,3 +3685,101 @@ TEST_P(DurabilityTest, EdgeMetadataRecovered) {
     ASSERT_FALSE(acc->Commit().HasError());
   }
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(DurabilityTest, CompositeIndexRecovered) {
+  auto composite_indices = [](memgraph::storage::Storage *store) {
+    auto acc = store->Access();
+    auto indices = acc->ListAllIndices().label_property_composite;
+    std::sort(indices.begin(), indices.end());
+    return indices;
+  };
+  auto create_index = [](memgraph::storage::Storage *store, memgraph::storage::LabelId label,
+                         const std::vector<memgraph::storage::PropertyId> &properties) {
+    auto unique_acc = store->UniqueAccess();
+    ASSERT_FALSE(unique_acc->CreateIndex(label, properties).HasError());
+    ASSERT_FALSE(unique_acc->Commit().HasError());
+  };
+  const auto wal_config = [&](bool recover_on_startup, bool snapshot_on_exit) {
+    return memgraph::storage::Config{
+        .durability = {.storage_directory = storage_directory,
+                       .recover_on_startup = recover_on_startup,
+                       .snapshot_wal_mode =
+                           memgraph::storage::Config::Durability::SnapshotWalMode::PERIODIC_SNAPSHOT_WITH_WAL,
+                       .snapshot_interval = std::chrono::minutes(20),
+                       .wal_file_flush_every_n_tx = kFlushWalEvery,
+                       .snapshot_on_exit = snapshot_on_exit},
+        .salient = {.items = {.properties_on_edges = GetParam()}},
+    };
+  };
+
+  // Create the snapshot with two composite indices.
+  {
+    auto config = wal_config(false, true);
+    memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+    memgraph::dbms::Database db{config, repl_state};
+    auto *store = db.storage();
+    auto label = store->NameToLabel("composite_label");
+    auto a = store->NameToProperty("a");
+    auto b = store->NameToProperty("b");
+    {
+      auto acc = db.Access();
+      for (int64_t i = 0; i < 10; ++i) {
+        auto vertex = acc->CreateVertex();
+        ASSERT_FALSE(vertex.AddLabel(label).HasError());
+        ASSERT_FALSE(vertex.SetProperty(a, memgraph::storage::PropertyValue(i % 2)).HasError());
+        ASSERT_FALSE(vertex.SetProperty(b, memgraph::storage::PropertyValue(i)).HasError());
+      }
+      ASSERT_FALSE(acc->Commit().HasError());
+    }
+    create_index(store, label, {a, b});
+    create_index(store, label, {b, a});
+  }
+  ASSERT_EQ(GetSnapshotsList().size(), 1);
+
+  // Change the indices on top of the snapshot, only the WAL has the changes.
+  {
+    auto config = wal_config(true, false);
+    memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+    memgraph::dbms::Database db{config, repl_state};
+    auto *store = db.storage();
+    auto label = store->NameToLabel("composite_label");
+    auto a = store->NameToProperty("a");
+    auto b = store->NameToProperty("b");
+    auto c = store->NameToProperty("c");
+    ASSERT_EQ(composite_indices(store), (std::vector<std::pair<memgraph::storage::LabelId,
+                                                               std::vector<memgraph::storage::PropertyId>>>{
+                                            {label, {a, b}}, {label, {b, a}}}));
+    {
+      auto unique_acc = store->UniqueAccess();
+      ASSERT_FALSE(unique_acc->DropIndex(label, std::vector{b, a}).HasError());
+      ASSERT_FALSE(unique_acc->Commit().HasError());
+    }
+    create_index(store, label, {a, c});
+  }
+  ASSERT_GE(GetWalsList().size(), 1);
+
+  // Recover the snapshot and the WAL.
+  auto config = wal_config(true, false);
+  memgraph::replication::ReplicationState repl_state{memgraph::storage::ReplicationStateRootPath(config)};
+  memgraph::dbms::Database db{config, repl_state};
+  auto *store = db.storage();
+  auto label = store->NameToLabel("composite_label");
+  auto a = store->NameToProperty("a");
+  auto b = store->NameToProperty("b");
+  auto c = store->NameToProperty("c");
+  ASSERT_EQ(composite_indices(store), (std::vector<std::pair<memgraph::storage::LabelId,
+                                                             std::vector<memgraph::storage::PropertyId>>>{
+                                          {label, {a, b}}, {label, {a, c}}}));
+
+  // The recovered index is filled.
+  auto acc = db.Access();
+  auto vertices = acc->Vertices(label, {a, b}, {memgraph::storage::PropertyValue(1)}, std::nullopt, std::nullopt,
+                                memgraph::storage::View::OLD);
+  uint64_t count = 0;
+  for (const auto &vertex : vertices) {
+    ASSERT_EQ(*vertex.GetProperty(a, memgraph::storage::View::OLD), memgraph::storage::PropertyValue(1));
+    ++count;
+  }
+  ASSERT_EQ(count, 5);
+}
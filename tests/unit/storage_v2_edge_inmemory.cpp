@@ -12,10 +12,15 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
 #include <limits>
+#include <thread>
+#include <vector>
 
 #include "storage/v2/inmemory/storage.hpp"
 #include "storage/v2/storage.hpp"
+#include "storage/v2/vertex_accessor.hpp"
 
 using memgraph::replication_coordination_glue::ReplicationRole;
 using testing::UnorderedElementsAre;
@@ -5414,3 +5419,275 @@ TEST(StorageWithProperties, EdgeNonexistentPropertyAPI) {
 
   ASSERT_FALSE(acc->Commit().HasError());
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_P(StorageEdgeTest, EdgeGroupedByType) {
+  auto const old_threshold = FLAGS_adjacency_grouping_threshold;
+  FLAGS_adjacency_grouping_threshold = 4;
+
+  std::unique_ptr<memgraph::storage::Storage> store(
+      new memgraph::storage::InMemoryStorage({.salient = {.items = {.properties_on_edges = GetParam()}}}));
+  memgraph::storage::Gid gid_hub = memgraph::storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
+  std::vector<memgraph::storage::EdgeTypeId> ets;
+
+  auto count_edges = [](auto &vertex, memgraph::storage::View view, std::vector<memgraph::storage::EdgeTypeId> types) {
+    auto ret = vertex.OutEdges(view, types);
+    EXPECT_TRUE(ret.HasValue());
+    for (auto const &edge : ret->edges) {
+      EXPECT_NE(std::find(types.begin(), types.end(), edge.EdgeType()), types.end());
+    }
+    return ret->edges.size();
+  };
+
+  // Create a hub with interleaved edge types
+  {
+    auto acc = store->Access();
+    auto hub = acc->CreateVertex();
+    gid_hub = hub.Gid();
+    for (auto const *name : {"et0", "et1", "et2"}) ets.push_back(acc->NameToEdgeType(name));
+    for (int i = 0; i < 12; ++i) {
+      auto other = acc->CreateVertex();
+      ASSERT_TRUE(acc->CreateEdge(&hub, &other, ets[2 - i % 3]).HasValue());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  // Filtered expansions group the edges and only visit the matching ones
+  {
+    auto acc = store->Access();
+    auto hub = acc->FindVertex(gid_hub, memgraph::storage::View::OLD);
+    ASSERT_TRUE(hub);
+    ASSERT_EQ(count_edges(*hub, memgraph::storage::View::OLD, {ets[1]}), 4);
+    auto ret = hub->OutEdges(memgraph::storage::View::OLD, {ets[0], ets[0]});
+    ASSERT_TRUE(ret.HasValue());
+    ASSERT_EQ(ret->edges.size(), 4);
+    ASSERT_EQ(ret->expanded_count, 4);
+    ASSERT_EQ(count_edges(*hub, memgraph::storage::View::OLD, {ets[2], ets[0]}), 8);
+    ASSERT_EQ(hub->OutEdges(memgraph::storage::View::OLD)->edges.size(), 12);
+  }
+
+  // Modifications keep the filtered expansions correct
+  {
+    auto acc = store->Access();
+    auto hub = acc->FindVertex(gid_hub, memgraph::storage::View::OLD);
+    ASSERT_TRUE(hub);
+    auto edges = hub->OutEdges(memgraph::storage::View::OLD, {ets[0]})->edges;
+    ASSERT_EQ(edges.size(), 4);
+    ASSERT_TRUE(acc->DeleteEdge(&edges[0]).HasValue());
+    auto other = acc->CreateVertex();
+    ASSERT_TRUE(acc->CreateEdge(&*hub, &other, ets[2]).HasValue());
+    ASSERT_TRUE(acc->CreateEdge(&*hub, &other, ets[1]).HasValue());
+    ASSERT_EQ(count_edges(*hub, memgraph::storage::View::NEW, {ets[0]}), 3);
+    ASSERT_EQ(count_edges(*hub, memgraph::storage::View::NEW, {ets[1]}), 5);
+    ASSERT_EQ(count_edges(*hub, memgraph::storage::View::NEW, {ets[2]}), 5);
+    ASSERT_EQ(count_edges(*hub, memgraph::storage::View::OLD, {ets[0]}), 4);
+    ASSERT_EQ(count_edges(*hub, memgraph::storage::View::OLD, {ets[1]}), 4);
+    acc->Abort();
+  }
+
+  {
+    auto acc = store->Access();
+    auto hub = acc->FindVertex(gid_hub, memgraph::storage::View::OLD);
+    ASSERT_TRUE(hub);
+    ASSERT_EQ(count_edges(*hub, memgraph::storage::View::OLD, {ets[0]}), 4);
+    ASSERT_EQ(count_edges(*hub, memgraph::storage::View::OLD, {ets[1]}), 4);
+    ASSERT_EQ(count_edges(*hub, memgraph::storage::View::OLD, {ets[2]}), 4);
+    ASSERT_EQ(hub->OutEdges(memgraph::storage::View::OLD)->edges.size(), 12);
+  }
+
+  FLAGS_adjacency_grouping_threshold = old_threshold;
+}
+
+TEST(StorageEdgeCompactionTest, CompactVertexEdges) {
+  using memgraph::storage::EdgeDirection;
+  using memgraph::storage::EdgeRef;
+  using memgraph::storage::EdgeTypeId;
+  using memgraph::storage::Gid;
+  using memgraph::storage::Vertex;
+
+  Vertex hub{Gid::FromUint(0), nullptr};
+  std::vector<std::unique_ptr<Vertex>> others;
+  for (uint64_t i = 1; i <= 9; ++i) others.push_back(std::make_unique<Vertex>(Gid::FromUint(i), nullptr));
+  for (uint64_t i = 0; i < others.size(); ++i) {
+    auto *other = others[others.size() - 1 - i].get();
+    AppendVertexEdge(&hub, EdgeDirection::OUT, EdgeTypeId::FromUint(i % 3), other, EdgeRef{Gid::FromUint(i)});
+  }
+  hub.in_edges.emplace_back(EdgeTypeId::FromUint(0), others[0].get(), EdgeRef{Gid::FromUint(100)});
+  ASSERT_LT(hub.out_edges.size(), hub.out_edges.capacity());
+
+  CompactVertexEdges(&hub);
+  ASSERT_TRUE(EdgesGroupedByType(hub, EdgeDirection::OUT));
+  ASSERT_TRUE(EdgesGroupedByType(hub, EdgeDirection::IN));
+  ASSERT_EQ(hub.out_edges.size(), 9);
+  ASSERT_EQ(hub.out_edges.capacity(), 9);
+  ASSERT_EQ(hub.in_edges.size(), 1);
+  for (uint64_t i = 1; i < hub.out_edges.size(); ++i) {
+    auto const &prev = hub.out_edges[i - 1];
+    auto const &edge = hub.out_edges[i];
+    ASSERT_TRUE(std::get<0>(prev) < std::get<0>(edge) ||
+                (std::get<0>(prev) == std::get<0>(edge) && std::less<>{}(std::get<1>(prev), std::get<1>(edge))));
+  }
+
+  // Every edge stays reachable through the binary search of its type
+  for (uint64_t i = 0; i < others.size(); ++i) {
+    auto *other = others[others.size() - 1 - i].get();
+    std::tuple link{EdgeTypeId::FromUint(i % 3), other, EdgeRef{Gid::FromUint(i)}};
+    ASSERT_NE(FindVertexEdge(&hub, EdgeDirection::OUT, link), hub.out_edges.end());
+  }
+}
+
+TEST_P(StorageEdgeTest, VertexDetachDeleteMany) {
+  std::unique_ptr<memgraph::storage::Storage> store(
+      new memgraph::storage::InMemoryStorage({.salient = {.items = {.properties_on_edges = GetParam()}}}));
+  memgraph::storage::Gid gid_hub = memgraph::storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
+
+  // Create a clique of 4 vertices, each also connected to a hub
+  {
+    auto acc = store->Access();
+    auto et = acc->NameToEdgeType("et");
+    auto hub = acc->CreateVertex();
+    gid_hub = hub.Gid();
+    std::vector<memgraph::storage::VertexAccessor> clique;
+    for (int i = 0; i < 4; ++i) clique.push_back(acc->CreateVertex());
+    for (auto &from : clique) {
+      for (auto &to : clique) {
+        if (from.Gid() != to.Gid()) ASSERT_TRUE(acc->CreateEdge(&from, &to, et).HasValue());
+      }
+      ASSERT_TRUE(acc->CreateEdge(&hub, &from, et).HasValue());
+      ASSERT_TRUE(acc->CreateEdge(&from, &from, et).HasValue());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  // Delete the clique in one call, every edge is deleted once
+  {
+    auto acc = store->Access();
+    std::vector<memgraph::storage::VertexAccessor> clique;
+    for (auto vertex : acc->Vertices(memgraph::storage::View::OLD)) {
+      if (vertex.Gid() != gid_hub) clique.push_back(vertex);
+    }
+    std::vector<memgraph::storage::VertexAccessor *> nodes;
+    for (auto &vertex : clique) nodes.push_back(&vertex);
+    auto res = acc->DetachDelete(std::move(nodes), {}, true);
+    ASSERT_TRUE(res.HasValue());
+    ASSERT_TRUE(*res);
+    ASSERT_EQ((*res)->first.size(), 4);
+    ASSERT_EQ((*res)->second.size(), 20);
+    auto hub = acc->FindVertex(gid_hub, memgraph::storage::View::NEW);
+    ASSERT_TRUE(hub);
+    ASSERT_EQ(*hub->OutDegree(memgraph::storage::View::NEW), 0);
+    ASSERT_EQ(*hub->OutDegree(memgraph::storage::View::OLD), 4);
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  {
+    auto acc = store->Access();
+    ASSERT_EQ(acc->ApproximateVertexCount(), 1);
+    auto hub = acc->FindVertex(gid_hub, memgraph::storage::View::OLD);
+    ASSERT_TRUE(hub);
+    ASSERT_EQ(*hub->OutDegree(memgraph::storage::View::OLD), 0);
+  }
+}
+
+TEST_P(StorageEdgeTest, FindEdgeByGid) {
+  if (!GetParam()) GTEST_SKIP() << "Edges without properties can't be found by gid";
+  std::unique_ptr<memgraph::storage::Storage> store(
+      new memgraph::storage::InMemoryStorage({.salient = {.items = {.properties_on_edges = GetParam()}}}));
+  memgraph::storage::Gid gid_edge = memgraph::storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
+  memgraph::storage::Gid gid_to = memgraph::storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
+
+  {
+    auto acc = store->Access();
+    auto et = acc->NameToEdgeType("et");
+    for (int i = 0; i < 10; ++i) acc->CreateVertex();
+    auto from = acc->CreateVertex();
+    auto to = acc->CreateVertex();
+    gid_to = to.Gid();
+    for (int i = 0; i < 3; ++i) ASSERT_TRUE(acc->CreateEdge(&from, &from, et).HasValue());
+    auto res = acc->CreateEdge(&from, &to, et);
+    ASSERT_TRUE(res.HasValue());
+    gid_edge = res->Gid();
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  {
+    auto acc = store->Access();
+    auto edge = acc->FindEdge(gid_edge, memgraph::storage::View::OLD);
+    ASSERT_TRUE(edge);
+    ASSERT_EQ(edge->Gid(), gid_edge);
+    ASSERT_EQ(edge->ToVertex().Gid(), gid_to);
+    ASSERT_FALSE(acc->FindEdge(memgraph::storage::Gid::FromUint(gid_edge.AsUint() + 1), memgraph::storage::View::OLD));
+  }
+}
+
+// The edge is locked after its vertices everywhere, otherwise moving an edge
+// while one of its vertices is detach deleted could deadlock. With
+// `MG_COMPACT_EDGES` the edge locks are striped, so this also covers a stripe
+// held together with a vertex lock.
+TEST(StorageWithProperties, EdgeSetFromAndDetachDeleteConcurrently) {
+  std::unique_ptr<memgraph::storage::Storage> store(
+      new memgraph::storage::InMemoryStorage({.salient = {.items = {.properties_on_edges = true}}}));
+  for (int round = 0; round < 200; ++round) {
+    memgraph::storage::Gid gid_a = memgraph::storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
+    memgraph::storage::Gid gid_c = memgraph::storage::Gid::FromUint(std::numeric_limits<uint64_t>::max());
+    {
+      auto acc = store->Access();
+      auto a = acc->CreateVertex();
+      auto b = acc->CreateVertex();
+      auto c = acc->CreateVertex();
+      gid_a = a.Gid();
+      gid_c = c.Gid();
+      ASSERT_TRUE(acc->CreateEdge(&a, &b, acc->NameToEdgeType("et")).HasValue());
+      ASSERT_FALSE(acc->Commit().HasError());
+    }
+
+    auto move_edge = store->Access();
+    auto delete_vertex = store->Access();
+    std::atomic<int> ready{0};
+    auto wait_for_both = [&ready] {
+      ready.fetch_add(1);
+      while (ready.load() < 2) {
+      }
+    };
+
+    std::thread mover([&] {
+      wait_for_both();
+      auto a = move_edge->FindVertex(gid_a, memgraph::storage::View::OLD);
+      auto c = move_edge->FindVertex(gid_c, memgraph::storage::View::OLD);
+      ASSERT_TRUE(a && c);
+      auto edges = a->OutEdges(memgraph::storage::View::OLD);
+      ASSERT_TRUE(edges.HasValue());
+      ASSERT_EQ(edges->edges.size(), 1);
+      auto edge = edges->edges[0];
+      if (move_edge->EdgeSetFrom(&edge, &*c).HasValue()) {
+        ASSERT_FALSE(move_edge->Commit().HasError());
+      } else {
+        move_edge->Abort();
+      }
+    });
+    std::thread deleter([&] {
+      wait_for_both();
+      auto a = delete_vertex->FindVertex(gid_a, memgraph::storage::View::OLD);
+      ASSERT_TRUE(a);
+      if (delete_vertex->DetachDelete({&*a}, {}, true).HasValue()) {
+        ASSERT_FALSE(delete_vertex->Commit().HasError());
+      } else {
+        delete_vertex->Abort();
+      }
+    });
+    mover.join();
+    deleter.join();
+    move_edge.reset();
+    delete_vertex.reset();
+
+    // Only one of the transactions could have changed the edge: it either
+    // goes out of `c` or was deleted together with `a`.
+    auto acc = store->Access();
+    auto a = acc->FindVertex(gid_a, memgraph::storage::View::OLD);
+    auto c = acc->FindVertex(gid_c, memgraph::storage::View::OLD);
+    ASSERT_TRUE(c);
+    auto edge_count = *c->OutDegree(memgraph::storage::View::OLD);
+    if (a) edge_count += *a->OutDegree(memgraph::storage::View::OLD);
+    ASSERT_EQ(edge_count, a ? 1 : 0);
+  }
+}
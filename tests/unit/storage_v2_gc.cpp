@@ -204,3 +204,218 @@ TEST(StorageV2Gc, Indices) {
     EXPECT_EQ(gids.size(), 1000);
   }
 }
+
+// Collect many small transactions with a GC cycle split into short slices and
+// the deltas freed on release threads. All of the deleted vertices have to be
+// removed once the GC catches up.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2Gc, Sliced) {
+  std::unique_ptr<memgraph::storage::Storage> storage(
+      std::make_unique<memgraph::storage::InMemoryStorage>(memgraph::storage::Config{
+          .gc = {.type = memgraph::storage::Config::Gc::Type::PERIODIC,
+                 .interval = std::chrono::milliseconds(100),
+                 .slice = std::chrono::milliseconds(1),
+                 .release_threads = 2}}));
+
+  std::vector<memgraph::storage::Gid> vertices;
+  {
+    auto acc = storage->Access();
+    for (uint64_t i = 0; i < 1000; ++i) {
+      vertices.push_back(acc->CreateVertex().Gid());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  auto const property = storage->NameToProperty("property");
+  for (uint64_t i = 0; i < 1000; ++i) {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(vertices[i], memgraph::storage::View::OLD);
+    ASSERT_TRUE(vertex.has_value());
+    ASSERT_FALSE(vertex->SetProperty(property, memgraph::storage::PropertyValue(static_cast<int64_t>(i))).HasError());
+    if (i % 5 == 0) {
+      ASSERT_FALSE(acc->DeleteVertex(&vertex.value()).HasError());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  // Wait for GC.
+  for (int retry = 0; retry < 100 && storage->GetBaseInfo().vertex_count != 800; ++retry) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  }
+  EXPECT_EQ(storage->GetBaseInfo().vertex_count, 800);
+
+  {
+    auto acc = storage->Access();
+    for (uint64_t i = 0; i < 1000; ++i) {
+      auto vertex = acc->FindVertex(vertices[i], memgraph::storage::View::OLD);
+      ASSERT_EQ(vertex.has_value(), i % 5 != 0);
+      if (vertex) {
+        ASSERT_EQ(*vertex->GetProperty(property, memgraph::storage::View::OLD),
+                  memgraph::storage::PropertyValue(static_cast<int64_t>(i)));
+      }
+    }
+  }
+}
+
+// The garbage of the committed transactions is reported until a GC cycle
+// releases it. An older transaction is kept alive, so the committing ones
+// can't discard their deltas themselves.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2Gc, GarbageInfo) {
+  std::unique_ptr<memgraph::storage::Storage> storage(std::make_unique<memgraph::storage::InMemoryStorage>(
+      memgraph::storage::Config{.gc = {.type = memgraph::storage::Config::Gc::Type::NONE}}));
+  auto const label = storage->NameToLabel("label");
+  {
+    auto unique_acc = storage->UniqueAccess();
+    ASSERT_FALSE(unique_acc->CreateIndex(label).HasError());
+    ASSERT_FALSE(unique_acc->Commit().HasError());
+  }
+  storage->FreeMemory();
+
+  std::vector<memgraph::storage::Gid> vertices;
+  {
+    auto reader = storage->Access();
+    auto acc = storage->Access();
+    for (uint64_t i = 0; i < 100; ++i) {
+      auto vertex = acc->CreateVertex();
+      ASSERT_TRUE(*vertex.AddLabel(label));
+      vertices.push_back(vertex.Gid());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+
+    auto info = storage->GetGarbageInfo();
+    EXPECT_EQ(info.committed_transactions, 1);
+    EXPECT_EQ(info.committed_deltas, 200);
+    EXPECT_EQ(info.delta_bytes, 200 * sizeof(memgraph::storage::Delta));
+    EXPECT_THAT(info.skip_list_garbage, testing::Contains(testing::Pair("label_index(:label)", 0)));
+  }
+
+  storage->FreeMemory();
+  auto info = storage->GetGarbageInfo();
+  EXPECT_EQ(info.committed_transactions, 0);
+  EXPECT_EQ(info.committed_deltas, 0);
+  EXPECT_EQ(info.unlinked_deltas, 0);
+
+  {
+    auto reader = storage->Access();
+    auto acc = storage->Access();
+    for (uint64_t i = 0; i < 10; ++i) {
+      auto vertex = acc->FindVertex(vertices[i], memgraph::storage::View::OLD);
+      ASSERT_TRUE(vertex.has_value());
+      ASSERT_FALSE(acc->DeleteVertex(&vertex.value()).HasError());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+    EXPECT_EQ(storage->GetGarbageInfo().committed_transactions, 1);
+  }
+
+  storage->FreeMemory();
+  info = storage->GetGarbageInfo();
+  EXPECT_EQ(info.committed_transactions, 0);
+  EXPECT_EQ(info.deleted_vertices, 0);
+  EXPECT_EQ(storage->GetBaseInfo().vertex_count, 90);
+}
+
+// Vertices found through the gid table are erased from it before the GC frees them.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2Gc, VertexGidTable) {
+  std::unique_ptr<memgraph::storage::Storage> storage(
+      std::make_unique<memgraph::storage::InMemoryStorage>(memgraph::storage::Config{
+          .gc = {.type = memgraph::storage::Config::Gc::Type::NONE}, .indices = {.vertex_gid_table = true}}));
+
+  std::vector<memgraph::storage::Gid> vertices;
+  {
+    auto acc = storage->Access();
+    for (uint64_t i = 0; i < 100; ++i) vertices.push_back(acc->CreateVertex().Gid());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  memgraph::storage::Gid aborted_gid;
+  {
+    auto acc = storage->Access();
+    aborted_gid = acc->CreateVertex().Gid();
+    acc->Abort();
+  }
+  {
+    auto acc = storage->Access();
+    for (uint64_t i = 0; i < 100; i += 2) {
+      auto vertex = acc->FindVertex(vertices[i], memgraph::storage::View::OLD);
+      ASSERT_TRUE(vertex);
+      ASSERT_FALSE(acc->DeleteVertex(&*vertex).HasError());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  storage->FreeMemory();
+
+  auto acc = storage->Access();
+  for (uint64_t i = 0; i < 100; ++i) {
+    EXPECT_EQ(acc->FindVertex(vertices[i], memgraph::storage::View::OLD).has_value(), i % 2 != 0);
+  }
+  EXPECT_FALSE(acc->FindVertex(aborted_gid, memgraph::storage::View::OLD));
+  EXPECT_FALSE(acc->FindVertex(memgraph::storage::Gid::FromUint(1'000'000), memgraph::storage::View::OLD));
+}
+
+// A few changes to big label and edge type indices are cleaned up by looking
+// up only the changed entries. An older transaction is kept alive during the
+// commits, so their deltas reach the GC instead of being discarded right away.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(StorageV2Gc, TargetedIndexCleanup) {
+  std::unique_ptr<memgraph::storage::Storage> storage(std::make_unique<memgraph::storage::InMemoryStorage>(
+      memgraph::storage::Config{.gc = {.type = memgraph::storage::Config::Gc::Type::NONE}}));
+  auto const label = storage->NameToLabel("label");
+  auto const edge_type = storage->NameToEdgeType("edge_type");
+  {
+    auto unique_acc = storage->UniqueAccess();
+    ASSERT_FALSE(unique_acc->CreateIndex(label).HasError());
+    ASSERT_FALSE(unique_acc->Commit().HasError());
+  }
+  {
+    auto unique_acc = storage->UniqueAccess();
+    ASSERT_FALSE(unique_acc->CreateIndex(edge_type).HasError());
+    ASSERT_FALSE(unique_acc->Commit().HasError());
+  }
+
+  std::vector<memgraph::storage::Gid> vertices;
+  std::vector<memgraph::storage::Gid> edges;
+  {
+    auto acc = storage->Access();
+    auto hub = acc->CreateVertex();
+    for (uint64_t i = 0; i < 1000; ++i) {
+      auto vertex = acc->CreateVertex();
+      ASSERT_TRUE(*vertex.AddLabel(label));
+      vertices.push_back(vertex.Gid());
+      auto edge = acc->CreateEdge(&hub, &vertex, edge_type);
+      ASSERT_FALSE(edge.HasError());
+      edges.push_back(edge->Gid());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  storage->FreeMemory();
+  EXPECT_EQ(storage->Access()->ApproximateVertexCount(label), 1000);
+  EXPECT_EQ(storage->Access()->ApproximateEdgeCount(edge_type), 1000);
+
+  {
+    auto reader = storage->Access();
+    auto acc = storage->Access();
+    for (uint64_t i = 0; i < 10; ++i) {
+      auto vertex = acc->FindVertex(vertices[i], memgraph::storage::View::OLD);
+      ASSERT_TRUE(vertex.has_value());
+      ASSERT_TRUE(*vertex->RemoveLabel(label));
+      auto edge = acc->FindEdge(edges[i + 10], memgraph::storage::View::OLD);
+      ASSERT_TRUE(edge.has_value());
+      ASSERT_FALSE(acc->DeleteEdge(&edge.value()).HasError());
+    }
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  storage->FreeMemory();
+  EXPECT_EQ(storage->Access()->ApproximateVertexCount(label), 990);
+  EXPECT_EQ(storage->Access()->ApproximateEdgeCount(edge_type), 990);
+
+  {
+    auto acc = storage->Access();
+    uint64_t count = 0;
+    for (auto vertex : acc->Vertices(label, memgraph::storage::View::OLD)) {
+      EXPECT_TRUE(*vertex.HasLabel(label, memgraph::storage::View::OLD));
+      ++count;
+    }
+    EXPECT_EQ(count, 990);
+  }
+}
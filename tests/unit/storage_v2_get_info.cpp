@@ -154,3 +154,25 @@ TYPED_TEST(InfoTest, InfoCheck) {
   ASSERT_EQ(info.durability_snapshot_enabled, true);
   ASSERT_EQ(info.durability_wal_enabled, true);
 }
+
+// The counts of the indices are read without waiting for an exclusive access,
+// the ones of the last read are reported while it holds the storage.
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(InfoTest, InfoDuringUniqueAccess) {
+  auto lbl = this->storage->NameToLabel("label");
+  auto lbl2 = this->storage->NameToLabel("abc");
+  {
+    auto unique_acc = this->storage->UniqueAccess();
+    ASSERT_FALSE(unique_acc->CreateIndex(lbl).HasError());
+    ASSERT_FALSE(unique_acc->Commit().HasError());
+  }
+  ASSERT_EQ(this->storage->GetInfo().label_indices, 1);
+
+  {
+    auto unique_acc = this->storage->UniqueAccess();
+    ASSERT_FALSE(unique_acc->CreateIndex(lbl2).HasError());
+    ASSERT_EQ(this->storage->GetInfo().label_indices, 1);
+    ASSERT_FALSE(unique_acc->Commit().HasError());
+  }
+  ASSERT_EQ(this->storage->GetInfo().label_indices, 2);
+}
@@ -9,6 +9,8 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include <cmath>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest-typed-test.h>
 #include <gtest/gtest.h>
@@ -28,6 +30,7 @@ using namespace memgraph::storage;
 using testing::IsEmpty;
 using testing::Types;
 using testing::UnorderedElementsAre;
+using testing::UnorderedElementsAreArray;
 
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
 #define ASSERT_NO_ERROR(result) ASSERT_FALSE((result).HasError())
@@ -409,6 +412,50 @@ TYPED_TEST(IndexTest, LabelIndexDuplicateVersions) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(IndexTest, LabelIndexChunkedVertices) {
+  {
+    auto unique_acc = this->storage->UniqueAccess();
+    EXPECT_FALSE(unique_acc->CreateIndex(this->label1).HasError());
+    ASSERT_NO_ERROR(unique_acc->Commit());
+  }
+
+  std::vector<int64_t> expected;
+  {
+    auto acc = this->storage->Access();
+    for (int i = 0; i < 100; ++i) {
+      auto vertex = this->CreateVertex(acc.get());
+      if (i % 2 == 0) {
+        ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+        expected.push_back(i);
+      }
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  // Removing and adding the label again leaves duplicate index entries, chunks
+  // must not split a vertex between them.
+  {
+    auto acc = this->storage->Access();
+    for (auto vertex : acc->Vertices(View::OLD)) {
+      if (!*vertex.HasLabel(this->label1, View::OLD)) continue;
+      ASSERT_NO_ERROR(vertex.RemoveLabel(this->label1));
+      ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  auto acc = this->storage->Access();
+  for (size_t num_chunks : {1, 3, 7, 200}) {
+    std::vector<int64_t> ids;
+    for (auto &chunk : acc->ChunkedVertices(this->label1, View::OLD, num_chunks)) {
+      auto chunk_ids = this->GetIds(std::move(chunk), View::OLD);
+      ids.insert(ids.end(), chunk_ids.begin(), chunk_ids.end());
+    }
+    EXPECT_THAT(ids, UnorderedElementsAreArray(expected)) << "num_chunks = " << num_chunks;
+  }
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 // passes
 TYPED_TEST(IndexTest, LabelIndexTransactionalIsolation) {
@@ -451,6 +498,58 @@ TYPED_TEST(IndexTest, LabelIndexTransactionalIsolation) {
               UnorderedElementsAre(0, 1, 2, 3, 4));
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(IndexTest, LabelIndexCountVerticesConcurrentRemove) {
+  // The count must match the iteration while another transaction has
+  // uncommitted changes to the indexed label.
+  if constexpr ((std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    {
+      auto unique_acc = this->storage->UniqueAccess();
+      EXPECT_FALSE(unique_acc->CreateIndex(this->label1).HasError());
+      ASSERT_NO_ERROR(unique_acc->Commit());
+    }
+
+    std::vector<memgraph::storage::Gid> gids;
+    {
+      auto acc = this->storage->Access();
+      for (int i = 0; i < 5; ++i) {
+        auto vertex = this->CreateVertex(acc.get());
+        ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+        gids.push_back(vertex.Gid());
+      }
+      ASSERT_NO_ERROR(acc->Commit());
+    }
+
+    auto acc_remove = this->storage->Access();
+    for (auto idx : {1, 3}) {
+      auto vertex = acc_remove->FindVertex(gids[idx], View::OLD);
+      ASSERT_TRUE(vertex);
+      ASSERT_NO_ERROR(vertex->RemoveLabel(this->label1));
+    }
+    {
+      auto vertex = this->CreateVertex(acc_remove.get());
+      ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+    }
+    auto acc_other = this->storage->Access();
+
+    auto expect_count = [this](Storage::Accessor *acc, View view, uint64_t expected) {
+      EXPECT_EQ(acc->CountVertices(this->label1, view), expected);
+      EXPECT_EQ(this->GetIds(acc->Vertices(this->label1, view), view).size(), expected);
+    };
+
+    expect_count(acc_remove.get(), View::OLD, 5);
+    expect_count(acc_remove.get(), View::NEW, 4);
+    expect_count(acc_other.get(), View::OLD, 5);
+    expect_count(acc_other.get(), View::NEW, 5);
+
+    ASSERT_NO_ERROR(acc_remove->Commit());
+
+    auto acc_after_commit = this->storage->Access();
+    expect_count(acc_other.get(), View::NEW, 5);
+    expect_count(acc_after_commit.get(), View::NEW, 4);
+  }
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TYPED_TEST(IndexTest, LabelIndexCountEstimate) {
   if constexpr ((std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
@@ -893,6 +992,65 @@ TYPED_TEST(IndexTest, LabelPropertyIndexTransactionalIsolation) {
               UnorderedElementsAre(0, 1, 2, 3, 4));
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(IndexTest, LabelPropertyIndexCountVerticesConcurrentRemove) {
+  if constexpr ((std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    {
+      auto unique_acc = this->storage->UniqueAccess();
+      EXPECT_FALSE(unique_acc->CreateIndex(this->label1, this->prop_val).HasError());
+      ASSERT_NO_ERROR(unique_acc->Commit());
+    }
+
+    std::vector<memgraph::storage::Gid> gids;
+    {
+      auto acc = this->storage->Access();
+      for (int i = 0; i < 10; ++i) {
+        auto vertex = this->CreateVertex(acc.get());
+        ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+        ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(i)));
+        gids.push_back(vertex.Gid());
+      }
+      ASSERT_NO_ERROR(acc->Commit());
+    }
+
+    // Uncommitted: the vertex with value 2 loses the label and the one with
+    // value 6 moves out of the range.
+    auto acc_remove = this->storage->Access();
+    {
+      auto vertex = acc_remove->FindVertex(gids[2], View::OLD);
+      ASSERT_TRUE(vertex);
+      ASSERT_NO_ERROR(vertex->RemoveLabel(this->label1));
+    }
+    {
+      auto vertex = acc_remove->FindVertex(gids[6], View::OLD);
+      ASSERT_TRUE(vertex);
+      ASSERT_NO_ERROR(vertex->SetProperty(this->prop_val, PropertyValue(20)));
+    }
+    auto acc_other = this->storage->Access();
+
+    const auto lower = memgraph::utils::MakeBoundInclusive(PropertyValue(2));
+    const auto upper = memgraph::utils::MakeBoundExclusive(PropertyValue(7));
+    auto expect_count = [&, this](Storage::Accessor *acc, View view, uint64_t expected_all, uint64_t expected_range) {
+      EXPECT_EQ(acc->CountVertices(this->label1, this->prop_val, view), expected_all);
+      EXPECT_EQ(this->GetIds(acc->Vertices(this->label1, this->prop_val, view), view).size(), expected_all);
+      EXPECT_EQ(acc->CountVertices(this->label1, this->prop_val, lower, upper, view), expected_range);
+      EXPECT_EQ(this->GetIds(acc->Vertices(this->label1, this->prop_val, lower, upper, view), view).size(),
+                expected_range);
+    };
+
+    expect_count(acc_remove.get(), View::OLD, 10, 5);
+    expect_count(acc_remove.get(), View::NEW, 9, 3);
+    expect_count(acc_other.get(), View::OLD, 10, 5);
+    expect_count(acc_other.get(), View::NEW, 10, 5);
+
+    ASSERT_NO_ERROR(acc_remove->Commit());
+
+    auto acc_after_commit = this->storage->Access();
+    expect_count(acc_other.get(), View::NEW, 10, 5);
+    expect_count(acc_after_commit.get(), View::NEW, 9, 3);
+  }
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TYPED_TEST(IndexTest, LabelPropertyIndexFiltering) {
   // We insert vertices with values:
@@ -1361,6 +1519,299 @@ TYPED_TEST(IndexTest, LabelPropertyIndexClearOldDataFromDisk) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(IndexTest, LabelPropertyCompositeIndexCreateAndDrop) {
+  if constexpr (!(std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    return;
+  }
+  PropertyId prop_other = this->storage->Access()->NameToProperty("other");
+  std::vector<PropertyId> properties{this->prop_val, prop_other};
+  {
+    auto unique_acc = this->storage->UniqueAccess();
+    EXPECT_FALSE(unique_acc->CreateIndex(this->label1, properties).HasError());
+    EXPECT_TRUE(unique_acc->CreateIndex(this->label1, properties).HasError());
+    ASSERT_NO_ERROR(unique_acc->Commit());
+  }
+  {
+    auto acc = this->storage->Access();
+    EXPECT_TRUE(acc->LabelPropertyCompositeIndexExists(this->label1, properties));
+    // The order of the properties matters
+    EXPECT_FALSE(acc->LabelPropertyCompositeIndexExists(this->label1, {prop_other, this->prop_val}));
+    EXPECT_FALSE(acc->LabelPropertyIndexExists(this->label1, this->prop_val));
+    EXPECT_THAT(acc->ListLabelPropertyCompositeIndices(this->label1), UnorderedElementsAre(properties));
+    EXPECT_THAT(acc->ListLabelPropertyCompositeIndices(this->label2), IsEmpty());
+    EXPECT_THAT(acc->ListAllIndices().label_property_composite,
+                UnorderedElementsAre(std::make_pair(this->label1, properties)));
+  }
+  {
+    auto unique_acc = this->storage->UniqueAccess();
+    EXPECT_FALSE(unique_acc->DropIndex(this->label1, properties).HasError());
+    EXPECT_TRUE(unique_acc->DropIndex(this->label1, properties).HasError());
+    ASSERT_NO_ERROR(unique_acc->Commit());
+  }
+  {
+    auto acc = this->storage->Access();
+    EXPECT_FALSE(acc->LabelPropertyCompositeIndexExists(this->label1, properties));
+    EXPECT_THAT(acc->ListAllIndices().label_property_composite, IsEmpty());
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(IndexTest, LabelPropertyCompositeIndexBasic) {
+  if constexpr (!(std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    return;
+  }
+  PropertyId prop_other = this->storage->Access()->NameToProperty("other");
+  std::vector<PropertyId> properties{this->prop_val, prop_other};
+  {
+    auto unique_acc = this->storage->UniqueAccess();
+    EXPECT_FALSE(unique_acc->CreateIndex(this->label1, properties).HasError());
+    ASSERT_NO_ERROR(unique_acc->Commit());
+  }
+
+  auto vertices = [&](Storage::Accessor *acc, std::vector<PropertyValue> prefix,
+                      const std::optional<memgraph::utils::Bound<PropertyValue>> &lower,
+                      const std::optional<memgraph::utils::Bound<PropertyValue>> &upper, View view) {
+    return this->GetIds(acc->Vertices(this->label1, properties, std::move(prefix), lower, upper, view), view);
+  };
+
+  Gid gid_4;
+  {
+    auto acc = this->storage->Access();
+    for (int i = 0; i < 10; ++i) {
+      auto vertex = this->CreateVertex(acc.get());
+      ASSERT_NO_ERROR(vertex.AddLabel(i == 9 ? this->label2 : this->label1));
+      ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(i % 3)));
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_other, PropertyValue(i)));
+      if (i == 4) gid_4 = vertex.Gid();
+    }
+    // Not indexed, none of the properties is set
+    ASSERT_NO_ERROR(this->CreateVertex(acc.get()).AddLabel(this->label1));
+
+    EXPECT_THAT(vertices(acc.get(), {}, std::nullopt, std::nullopt, View::OLD), IsEmpty());
+    EXPECT_THAT(vertices(acc.get(), {}, std::nullopt, std::nullopt, View::NEW),
+                UnorderedElementsAre(0, 1, 2, 3, 4, 5, 6, 7, 8));
+    EXPECT_THAT(vertices(acc.get(), {PropertyValue(1)}, std::nullopt, std::nullopt, View::NEW),
+                UnorderedElementsAre(1, 4, 7));
+    EXPECT_THAT(vertices(acc.get(), {PropertyValue(1), PropertyValue(4)}, std::nullopt, std::nullopt, View::NEW),
+                UnorderedElementsAre(4));
+    EXPECT_THAT(vertices(acc.get(), {PropertyValue(1), PropertyValue(5)}, std::nullopt, std::nullopt, View::NEW),
+                IsEmpty());
+    EXPECT_THAT(vertices(acc.get(), {PropertyValue()}, std::nullopt, std::nullopt, View::NEW), IsEmpty());
+
+    // Range on the property following the prefix
+    EXPECT_THAT(vertices(acc.get(), {PropertyValue(1)}, memgraph::utils::MakeBoundInclusive(PropertyValue(4)),
+                         memgraph::utils::MakeBoundExclusive(PropertyValue(7)), View::NEW),
+                UnorderedElementsAre(4));
+    EXPECT_THAT(vertices(acc.get(), {PropertyValue(1)}, memgraph::utils::MakeBoundExclusive(PropertyValue(1)),
+                         std::nullopt, View::NEW),
+                UnorderedElementsAre(4, 7));
+    EXPECT_THAT(vertices(acc.get(), {}, memgraph::utils::MakeBoundInclusive(PropertyValue(1)),
+                         memgraph::utils::MakeBoundInclusive(PropertyValue(2)), View::NEW),
+                UnorderedElementsAre(1, 2, 4, 5, 7, 8));
+    EXPECT_THAT(vertices(acc.get(), {}, std::nullopt, memgraph::utils::MakeBoundExclusive(PropertyValue(1)), View::NEW),
+                UnorderedElementsAre(0, 3, 6));
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  auto acc_before = this->storage->Access();
+  {
+    auto acc = this->storage->Access();
+    auto vertex = acc->FindVertex(gid_4, View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_NO_ERROR(vertex->SetProperty(prop_other, PropertyValue(40)));
+
+    EXPECT_THAT(vertices(acc.get(), {PropertyValue(1), PropertyValue(4)}, std::nullopt, std::nullopt, View::OLD),
+                UnorderedElementsAre(4));
+    EXPECT_THAT(vertices(acc.get(), {PropertyValue(1), PropertyValue(4)}, std::nullopt, std::nullopt, View::NEW),
+                IsEmpty());
+    EXPECT_THAT(vertices(acc.get(), {PropertyValue(1), PropertyValue(40)}, std::nullopt, std::nullopt, View::NEW),
+                UnorderedElementsAre(4));
+    EXPECT_THAT(vertices(acc.get(), {PropertyValue(1)}, std::nullopt, std::nullopt, View::NEW),
+                UnorderedElementsAre(1, 4, 7));
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  // The vertex keeps its old values for the older transaction
+  EXPECT_THAT(vertices(acc_before.get(), {PropertyValue(1), PropertyValue(4)}, std::nullopt, std::nullopt, View::OLD),
+              UnorderedElementsAre(4));
+  EXPECT_THAT(
+      vertices(acc_before.get(), {PropertyValue(1), PropertyValue(40)}, std::nullopt, std::nullopt, View::OLD),
+      IsEmpty());
+  acc_before->Abort();
+  acc_before.reset();
+
+  // Check that GC doesn't remove useful elements
+  this->storage->FreeMemory({}, false);
+  {
+    auto acc = this->storage->Access();
+    EXPECT_THAT(vertices(acc.get(), {PropertyValue(1)}, std::nullopt, std::nullopt, View::OLD),
+                UnorderedElementsAre(1, 4, 7));
+    EXPECT_THAT(vertices(acc.get(), {PropertyValue(1), PropertyValue(40)}, std::nullopt, std::nullopt, View::OLD),
+                UnorderedElementsAre(4));
+    EXPECT_THAT(vertices(acc.get(), {PropertyValue(1), PropertyValue(4)}, std::nullopt, std::nullopt, View::OLD),
+                IsEmpty());
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(IndexTest, LabelPropertyCompositeIndexAbort) {
+  if constexpr (!(std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    return;
+  }
+  PropertyId prop_other = this->storage->Access()->NameToProperty("other");
+  std::vector<PropertyId> properties{this->prop_val, prop_other};
+  {
+    auto unique_acc = this->storage->UniqueAccess();
+    EXPECT_FALSE(unique_acc->CreateIndex(this->label1, properties).HasError());
+    ASSERT_NO_ERROR(unique_acc->Commit());
+  }
+  {
+    auto acc = this->storage->Access();
+    for (int i = 0; i < 5; ++i) {
+      auto vertex = this->CreateVertex(acc.get());
+      ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+      ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(i)));
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_other, PropertyValue(i)));
+    }
+    EXPECT_EQ(acc->ApproximateVertexCount(this->label1, properties), 10);
+    acc->Abort();
+  }
+  {
+    auto acc = this->storage->Access();
+    EXPECT_EQ(acc->ApproximateVertexCount(this->label1, properties), 0);
+    EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, properties, {}, std::nullopt, std::nullopt, View::NEW),
+                             View::NEW),
+                IsEmpty());
+  }
+  this->storage->FreeMemory({}, false);
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(IndexTest, LabelPropertyCompositeIndexCountEstimate) {
+  if constexpr (!(std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    return;
+  }
+  PropertyId prop_other = this->storage->Access()->NameToProperty("other");
+  std::vector<PropertyId> properties{this->prop_val, prop_other};
+  {
+    auto unique_acc = this->storage->UniqueAccess();
+    EXPECT_FALSE(unique_acc->CreateIndex(this->label1, properties).HasError());
+    ASSERT_NO_ERROR(unique_acc->Commit());
+  }
+
+  auto acc = this->storage->Access();
+  for (int i = 1; i <= 10; ++i) {
+    for (int j = 0; j < i; ++j) {
+      auto vertex = this->CreateVertex(acc.get());
+      // Set the properties before the label, so every vertex has a single entry
+      ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(i)));
+      ASSERT_NO_ERROR(vertex.SetProperty(prop_other, PropertyValue(j % 2)));
+      ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+    }
+  }
+
+  EXPECT_EQ(acc->ApproximateVertexCount(this->label1, properties), 55);
+  for (int i = 1; i <= 10; ++i) {
+    EXPECT_EQ(acc->ApproximateVertexCount(this->label1, properties, {PropertyValue(i)}), i);
+    EXPECT_EQ(acc->ApproximateVertexCount(this->label1, properties, {PropertyValue(i), PropertyValue(0)}), (i + 1) / 2);
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(IndexTest, IndexModificationCount) {
+  if constexpr ((std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    {
+      auto unique_acc = this->storage->UniqueAccess();
+      EXPECT_FALSE(unique_acc->CreateIndex(this->label1).HasError());
+      EXPECT_FALSE(unique_acc->CreateIndex(this->label1, this->prop_val).HasError());
+      ASSERT_NO_ERROR(unique_acc->Commit());
+    }
+    auto *label_index = static_cast<InMemoryLabelIndex *>(this->storage->indices_.label_index_.get());
+    auto *label_property_index =
+        static_cast<InMemoryLabelPropertyIndex *>(this->storage->indices_.label_property_index_.get());
+
+    {
+      auto acc = this->storage->Access();
+      for (int i = 0; i < 10; ++i) {
+        auto vertex = this->CreateVertex(acc.get());
+        ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+        ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, PropertyValue(i)));
+        ASSERT_NO_ERROR(vertex.AddLabel(this->label2));
+      }
+      ASSERT_NO_ERROR(acc->Commit());
+    }
+    EXPECT_EQ(label_index->ModificationCount(this->label1), 10);
+    EXPECT_EQ(label_index->ModificationCount(this->label2), 0);
+    EXPECT_EQ(label_property_index->ModificationCount(this->label1, this->prop_val), 10);
+
+    {
+      auto acc = this->storage->Access();
+      for (auto vertex : acc->Vertices(this->label1, View::OLD)) {
+        if (vertex.GetProperty(this->prop_val, View::OLD)->ValueInt() < 5) {
+          ASSERT_NO_ERROR(vertex.RemoveLabel(this->label1));
+        }
+      }
+      ASSERT_NO_ERROR(acc->Commit());
+    }
+    // Removals are counted when the garbage collector drops the entries
+    EXPECT_EQ(label_index->ModificationCount(this->label1), 10);
+    this->storage->FreeMemory({}, false);
+    EXPECT_EQ(label_index->ModificationCount(this->label1), 15);
+    EXPECT_EQ(label_property_index->ModificationCount(this->label1, this->prop_val), 15);
+
+    {
+      auto unique_acc = this->storage->UniqueAccess();
+      EXPECT_FALSE(unique_acc->DropIndex(this->label1).HasError());
+      ASSERT_NO_ERROR(unique_acc->Commit());
+    }
+    EXPECT_EQ(label_index->ModificationCount(this->label1), 0);
+  }
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(IndexTest, IndexCreateOnMultipleThreads) {
+  if constexpr (!(std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    return;
+  }
+  this->storage.reset(nullptr);
+  this->config_.indices.creation_thread_count = 4;
+  this->storage = std::make_unique<TypeParam>(this->config_);
+
+  std::vector<int64_t> expected;
+  {
+    auto acc = this->storage->Access();
+    for (int i = 0; i < 10000; ++i) {
+      auto vertex = this->CreateVertex(acc.get());
+      if (i % 3 == 0) {
+        ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+        expected.push_back(i);
+      }
+    }
+    ASSERT_NO_ERROR(acc->Commit());
+  }
+
+  {
+    auto unique_acc = this->storage->UniqueAccess();
+    EXPECT_FALSE(unique_acc->CreateIndex(this->label1).HasError());
+    ASSERT_NO_ERROR(unique_acc->Commit());
+  }
+  {
+    auto unique_acc = this->storage->UniqueAccess();
+    EXPECT_FALSE(unique_acc->CreateIndex(this->label1, this->prop_id).HasError());
+    ASSERT_NO_ERROR(unique_acc->Commit());
+  }
+
+  {
+    auto acc = this->storage->Access();
+    EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, View::OLD), View::OLD), UnorderedElementsAreArray(expected));
+    EXPECT_THAT(this->GetIds(acc->Vertices(this->label1, this->prop_id, View::OLD), View::OLD),
+                UnorderedElementsAreArray(expected));
+    EXPECT_EQ(acc->ApproximateVertexCount(this->label1), expected.size());
+    EXPECT_EQ(acc->ApproximateVertexCount(this->label1, this->prop_id), expected.size());
+  }
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TYPED_TEST(IndexTest, EdgeTypeIndexCreate) {
   if constexpr ((std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
@@ -1736,6 +2187,52 @@ TYPED_TEST(IndexTest, EdgeTypeIndexRepeatingEdgeTypesBetweenSameVertices) {
   }
 }
 
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(IndexTest, EdgeTypeIndexEdgesBetweenVertices) {
+  if constexpr ((std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    {
+      auto unique_acc = this->storage->UniqueAccess();
+      EXPECT_FALSE(unique_acc->CreateIndex(this->edge_type_id1).HasError());
+      ASSERT_NO_ERROR(unique_acc->Commit());
+    }
+
+    auto acc = this->storage->Access();
+    auto vertex_a = this->CreateVertexWithoutProperties(acc.get());
+    auto vertex_b = this->CreateVertexWithoutProperties(acc.get());
+    auto vertex_c = this->CreateVertexWithoutProperties(acc.get());
+
+    this->CreateEdge(&vertex_a, &vertex_b, this->edge_type_id1, acc.get());
+    this->CreateEdge(&vertex_a, &vertex_b, this->edge_type_id1, acc.get());
+    this->CreateEdge(&vertex_b, &vertex_a, this->edge_type_id1, acc.get());
+    this->CreateEdge(&vertex_a, &vertex_c, this->edge_type_id1, acc.get());
+    this->CreateEdge(&vertex_a, &vertex_b, this->edge_type_id2, acc.get());
+
+    EXPECT_THAT(this->GetIds(acc->Edges(this->edge_type_id1, vertex_a, vertex_b, View::NEW), View::NEW),
+                UnorderedElementsAre(0, 1));
+    EXPECT_THAT(this->GetIds(acc->Edges(this->edge_type_id1, vertex_b, vertex_a, View::NEW), View::NEW),
+                UnorderedElementsAre(2));
+    EXPECT_THAT(this->GetIds(acc->Edges(this->edge_type_id1, vertex_a, vertex_c, View::NEW), View::NEW),
+                UnorderedElementsAre(3));
+    EXPECT_THAT(this->GetIds(acc->Edges(this->edge_type_id1, vertex_c, vertex_a, View::NEW), View::NEW), IsEmpty());
+    EXPECT_THAT(this->GetIds(acc->Edges(this->edge_type_id1, vertex_b, vertex_b, View::NEW), View::NEW), IsEmpty());
+    EXPECT_THAT(this->GetIds(acc->Edges(this->edge_type_id1, vertex_a, vertex_b, View::OLD), View::OLD), IsEmpty());
+
+    acc->AdvanceCommand();
+
+    for (auto edge : acc->Edges(this->edge_type_id1, vertex_a, vertex_b, View::OLD)) {
+      if (edge.GetProperty(this->prop_id, View::OLD)->ValueInt() == 0) {
+        ASSERT_NO_ERROR(acc->DetachDelete({}, {&edge}, false));
+      }
+    }
+
+    EXPECT_THAT(this->GetIds(acc->Edges(this->edge_type_id1, vertex_a, vertex_b, View::OLD), View::OLD),
+                UnorderedElementsAre(0, 1));
+    EXPECT_THAT(this->GetIds(acc->Edges(this->edge_type_id1, vertex_a, vertex_b, View::NEW), View::NEW),
+                UnorderedElementsAre(1));
+    EXPECT_THAT(this->GetIds(acc->Edges(this->edge_type_id1, View::NEW), View::NEW), UnorderedElementsAre(1, 2, 3));
+  }
+}
+
 // NOLINTNEXTLINE(hicpp-special-member-functions)
 TYPED_TEST(IndexTest, EdgeTypePropertyIndexCreate) {
   if constexpr (!(std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
@@ -2156,3 +2653,82 @@ TYPED_TEST(IndexTest, EdgeTypePropertyIndexRepeatingEdgeTypesBetweenSameVertices
   EXPECT_THAT(this->GetIds(acc->Edges(this->edge_type_id1, this->edge_prop_id1, View::NEW), View::NEW),
               UnorderedElementsAre(1, 2, 3, 4, 5));
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TYPED_TEST(IndexTest, VectorIndexSearch) {
+  if constexpr ((std::is_same_v<TypeParam, memgraph::storage::InMemoryStorage>)) {
+    auto vector_of = [](std::vector<double> const &values) {
+      std::vector<PropertyValue> list;
+      for (auto value : values) list.emplace_back(value);
+      return PropertyValue(std::move(list));
+    };
+
+    {
+      auto acc = this->storage->Access();
+      for (int i = 0; i < 100; ++i) {
+        auto vertex = this->CreateVertex(acc.get());
+        ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+        auto const angle = i * 0.01;
+        ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, vector_of({std::cos(angle), std::sin(angle), 0.0})));
+      }
+      // Wrong dimension, not indexed
+      auto vertex = this->CreateVertex(acc.get());
+      ASSERT_NO_ERROR(vertex.AddLabel(this->label1));
+      ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, vector_of({1.0, 0.0})));
+      ASSERT_NO_ERROR(acc->Commit());
+    }
+
+    {
+      auto unique_acc = this->storage->UniqueAccess();
+      EXPECT_FALSE(unique_acc->CreateVectorIndex({this->label1, this->prop_val, 3}).HasError());
+      EXPECT_TRUE(unique_acc->CreateVectorIndex({this->label1, this->prop_val, 3}).HasError());
+      ASSERT_NO_ERROR(unique_acc->Commit());
+    }
+
+    auto search_ids = [this, &vector_of](std::vector<double> const &query, size_t k) {
+      auto acc = this->storage->Access();
+      std::vector<int64_t> ids;
+      for (auto const &[vertex, similarity] :
+           acc->VectorIndexSearch(this->label1, this->prop_val, vector_of(query), k, View::OLD)) {
+        ids.push_back(vertex.GetProperty(this->prop_id, View::OLD)->ValueInt());
+      }
+      return ids;
+    };
+
+    {
+      auto acc = this->storage->Access();
+      EXPECT_EQ(acc->ApproximateVectorCount(this->label1, this->prop_val), 100);
+      auto dimension = acc->VectorIndexDimension(this->label1, this->prop_val);
+      ASSERT_TRUE(dimension);
+      EXPECT_EQ(*dimension, 3);
+    }
+    EXPECT_EQ(search_ids({1.0, 0.0, 0.0}, 3), (std::vector<int64_t>{0, 1, 2}));
+    EXPECT_EQ(search_ids({std::cos(0.5), std::sin(0.5), 0.0}, 1), std::vector<int64_t>{50});
+    EXPECT_THAT(search_ids({1.0, 0.0}, 3), IsEmpty());
+
+    {
+      auto acc = this->storage->Access();
+      for (auto vertex : acc->Vertices(this->label1, View::OLD)) {
+        auto id = vertex.GetProperty(this->prop_id, View::OLD)->ValueInt();
+        if (id == 0) {
+          ASSERT_NO_ERROR(acc->DeleteVertex(&vertex));
+        } else if (id == 99) {
+          ASSERT_NO_ERROR(vertex.SetProperty(this->prop_val, vector_of({1.0, 0.0, 0.0})));
+        }
+      }
+
+      // The changes are applied to the index on commit
+      EXPECT_EQ(search_ids({1.0, 0.0, 0.0}, 2), (std::vector<int64_t>{0, 1}));
+      ASSERT_NO_ERROR(acc->Commit());
+    }
+    EXPECT_EQ(search_ids({1.0, 0.0, 0.0}, 2), (std::vector<int64_t>{99, 1}));
+
+    {
+      auto unique_acc = this->storage->UniqueAccess();
+      EXPECT_FALSE(unique_acc->DropVectorIndex(this->label1, this->prop_val).HasError());
+      EXPECT_TRUE(unique_acc->DropVectorIndex(this->label1, this->prop_val).HasError());
+      ASSERT_NO_ERROR(unique_acc->Commit());
+    }
+    EXPECT_THAT(search_ids({1.0, 0.0, 0.0}, 2), IsEmpty());
+  }
+}
@@ -45,3 +45,20 @@ TEST(NameIdMapper, Correctness) {
   ASSERT_EQ(mapper.IdToName(1), "n2");
   ASSERT_EQ(mapper.IdToName(0), "n1");
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(NameIdMapper, ManyIds) {
+  memgraph::storage::NameIdMapper mapper;
+
+  // Spans multiple segments of the id to name array
+  constexpr uint64_t kNames = 1000;
+  for (uint64_t i = 0; i < kNames; ++i) {
+    ASSERT_EQ(mapper.NameToId("n" + std::to_string(i)), i);
+  }
+  for (auto repeat = 0; repeat < 2; ++repeat) {
+    for (uint64_t i = 0; i < kNames; ++i) {
+      ASSERT_EQ(mapper.IdToName(i), "n" + std::to_string(i));
+    }
+  }
+  ASSERT_DEATH(mapper.IdToName(kNames), "");
+}
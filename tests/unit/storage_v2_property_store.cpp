@@ -12,11 +12,14 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <filesystem>
 #include <limits>
 
 #include "storage/v2/id_types.hpp"
 #include "storage/v2/property_store.hpp"
+#include "storage/v2/property_store_tier.hpp"
 #include "storage/v2/property_value.hpp"
+#include "storage/v2/string_interner.hpp"
 #include "storage/v2/temporal.hpp"
 
 using testing::UnorderedElementsAre;
@@ -650,6 +653,12 @@ TEST(PropertyStore, IsPropertyEqualZonedTemporalData) {
     const auto unequal_type = PropertyValue(TemporalData{TemporalType::Duration, 23});
     const auto unequal_value = PropertyValue(
         ZonedTemporalData{ZonedTemporalType::ZonedDateTime, memgraph::utils::AsSysTime(common_duration + 1), timezone});
+    const auto unequal_timezone = PropertyValue(ZonedTemporalData{ZonedTemporalType::ZonedDateTime,
+                                                                  memgraph::utils::AsSysTime(common_duration),
+                                                                  memgraph::utils::Timezone("Europe/Zagreb")});
+    const auto unequal_offset =
+        PropertyValue(ZonedTemporalData{ZonedTemporalType::ZonedDateTime, memgraph::utils::AsSysTime(common_duration),
+                                        memgraph::utils::Timezone(std::chrono::minutes{30})});
 
     auto prop = PropertyId::FromInt(42);
 
@@ -659,6 +668,10 @@ TEST(PropertyStore, IsPropertyEqualZonedTemporalData) {
     ASSERT_FALSE(props.IsPropertyEqual(prop, unequal_type));
     // Same type, different value.
     ASSERT_FALSE(props.IsPropertyEqual(prop, unequal_value));
+    // Same instant, different timezone.
+    ASSERT_FALSE(props.IsPropertyEqual(prop, unequal_timezone));
+    ASSERT_FALSE(props.IsPropertyEqual(prop, unequal_offset));
+    ASSERT_EQ(props.GetProperty(prop), zoned_temporal);
   };
 
   for (const auto &timezone : timezone_offset_encoding_cases) {
@@ -843,12 +856,192 @@ TEST(PropertyStore, GetPropertyOfTypes) {
   ASSERT_EQ(prop_of_type3, std::nullopt);
 }
 
+TEST(PropertyStore, ManyProperties) {
+  // Enough properties for the store to keep a property directory.
+  constexpr int kCount = 64;
+  auto value_of = [](int id) {
+    return id % 3 == 0 ? PropertyValue(std::string(static_cast<size_t>(id), 'v')) : PropertyValue(id * 1000);
+  };
+  auto check_store = [](const PropertyStore &store, const std::map<PropertyId, PropertyValue> &expected) {
+    ASSERT_EQ(store.Properties(), expected);
+    for (int id = 0; id <= kCount + 1; ++id) {
+      auto prop = PropertyId::FromInt(id);
+      auto it = expected.find(prop);
+      auto value = it == expected.end() ? PropertyValue() : it->second;
+      ASSERT_EQ(store.GetProperty(prop), value);
+      ASSERT_EQ(store.HasProperty(prop), !value.IsNull());
+      ASSERT_TRUE(store.IsPropertyEqual(prop, value));
+      ASSERT_EQ(store.PropertySize(prop) != 0, !value.IsNull());
+    }
+  };
+
+  PropertyStore store;
+  std::map<PropertyId, PropertyValue> expected;
+  // Insert in a non monotonic order.
+  for (int i = 0; i < kCount; ++i) {
+    auto id = (i * 37) % kCount + 1;
+    ASSERT_TRUE(store.SetProperty(PropertyId::FromInt(id), value_of(id)));
+    expected.emplace(PropertyId::FromInt(id), value_of(id));
+    check_store(store, expected);
+  }
+
+  // Replace with larger and smaller values.
+  for (int id = 1; id <= kCount; id += 5) {
+    auto value = id % 2 == 0 ? PropertyValue(std::string(100, 'x')) : PropertyValue(false);
+    ASSERT_FALSE(store.SetProperty(PropertyId::FromInt(id), value));
+    expected[PropertyId::FromInt(id)] = value;
+    check_store(store, expected);
+  }
+
+  // Store and load the buffer.
+  if (!FLAGS_storage_property_store_compression_enabled) {
+    check_store(PropertyStore::CreateFromBuffer(store.StringBuffer()), expected);
+  }
+
+  // Remove properties until the store is small again.
+  for (int i = 0; i < kCount; ++i) {
+    auto id = (i * 11) % kCount + 1;
+    ASSERT_FALSE(store.SetProperty(PropertyId::FromInt(id), PropertyValue()));
+    expected.erase(PropertyId::FromInt(id));
+    check_store(store, expected);
+  }
+
+  std::vector<std::pair<PropertyId, PropertyValue>> data;
+  for (int id = kCount; id > 0; --id) {
+    data.emplace_back(PropertyId::FromInt(id), value_of(id));
+    expected.emplace(PropertyId::FromInt(id), value_of(id));
+  }
+  ASSERT_TRUE(store.InitProperties(data));
+  check_store(store, expected);
+}
+
+TEST(PropertyStore, GetProperties) {
+  const std::vector<std::pair<PropertyId, PropertyValue>> data{
+      {PropertyId::FromInt(1), PropertyValue(true)},
+      {PropertyId::FromInt(3), PropertyValue("three")},
+      {PropertyId::FromInt(5), PropertyValue(std::vector<PropertyValue>{PropertyValue(5), PropertyValue("five")})},
+  };
+  PropertyStore store;
+  ASSERT_TRUE(store.GetProperties(std::vector{PropertyId::FromInt(1)}).front().IsNull());
+  ASSERT_TRUE(store.InitProperties(data));
+
+  const std::vector<PropertyId> properties{PropertyId::FromInt(5), PropertyId::FromInt(2), PropertyId::FromInt(3),
+                                           PropertyId::FromInt(6), PropertyId::FromInt(5), PropertyId::FromInt(1)};
+  auto values = store.GetProperties(properties);
+  ASSERT_EQ(values.size(), properties.size());
+  for (size_t i = 0; i < properties.size(); ++i) {
+    ASSERT_EQ(values[i], store.GetProperty(properties[i]));
+  }
+  ASSERT_TRUE(store.GetProperties({}).empty());
+}
+
+TEST(PropertyStore, ReadManyStoresInTurns) {
+  // More stores than the decompressed buffers a thread keeps, the stores are
+  // compressed when compression is enabled.
+  std::vector<PropertyStore> stores(8);
+  const auto property = PropertyId::FromInt(1);
+  for (size_t i = 0; i < stores.size(); ++i) {
+    ASSERT_TRUE(stores[i].SetProperty(property, PropertyValue(std::string(200, static_cast<char>('a' + i)))));
+  }
+  for (auto round = 0; round < 3; ++round) {
+    for (size_t i = 0; i < stores.size(); ++i) {
+      ASSERT_EQ(stores[i].GetProperty(property), PropertyValue(std::string(200, static_cast<char>('a' + i))));
+    }
+  }
+  // The replaced buffer of a store is read instead of the one read before.
+  ASSERT_EQ(stores[0].GetProperty(property), PropertyValue(std::string(200, 'a')));
+  ASSERT_FALSE(stores[0].SetProperty(property, PropertyValue(std::string(200, 'z'))));
+  ASSERT_EQ(stores[0].GetProperty(property), PropertyValue(std::string(200, 'z')));
+  ASSERT_TRUE(stores[0].HasProperty(property));
+  stores.erase(stores.begin());
+  ASSERT_EQ(stores[0].GetProperty(property), PropertyValue(std::string(200, 'b')));
+}
+
+TEST(PropertyStore, InternedStrings) {
+  FLAGS_storage_property_store_intern_max_length = 16;
+  const auto property = PropertyId::FromInt(1);
+  const auto other_property = PropertyId::FromInt(2);
+  const PropertyValue short_value("interned");
+  const PropertyValue long_value(std::string(32, 'x'));
+  const PropertyValue list_value(std::vector<PropertyValue>{short_value, short_value});
+
+  std::vector<PropertyStore> stores(4);
+  for (auto &store : stores) {
+    ASSERT_TRUE(store.SetProperty(property, short_value));
+    ASSERT_TRUE(store.SetProperty(other_property, long_value));
+    ASSERT_TRUE(store.SetProperty(PropertyId::FromInt(3), list_value));
+  }
+  ASSERT_TRUE(StringInterner::AnyInterned());
+  for (auto &store : stores) {
+    ASSERT_EQ(store.GetProperty(property), short_value);
+    ASSERT_EQ(store.GetProperty(other_property), long_value);
+    ASSERT_EQ(store.GetProperty(PropertyId::FromInt(3)), list_value);
+    ASSERT_TRUE(store.IsPropertyEqual(property, short_value));
+    ASSERT_FALSE(store.IsPropertyEqual(property, PropertyValue("interned!")));
+    ASSERT_FALSE(store.IsPropertyEqual(property, PropertyValue(8)));
+    ASSERT_THAT(store.PropertiesOfTypes(std::array{PropertyStoreType::STRING}),
+                UnorderedElementsAre(property, other_property));
+    ASSERT_EQ(store.GetPropertyOfTypes(property, std::array{PropertyStoreType::STRING}), short_value);
+  }
+
+  // The buffer is portable, the strings are written inline.
+  FLAGS_storage_property_store_intern_max_length = 0;
+  PropertyStore copy;
+  copy.SetBuffer(stores[0].StringBuffer());
+  ASSERT_EQ(copy.Properties(), stores[0].Properties());
+  ASSERT_EQ(copy.StringBuffer(), stores[0].StringBuffer());
+
+  ASSERT_FALSE(stores[0].SetProperty(property, PropertyValue("inline")));
+  ASSERT_EQ(stores[0].GetProperty(property), PropertyValue("inline"));
+  ASSERT_EQ(stores[1].GetProperty(property), short_value);
+}
+
+TEST(PropertyStore, EvictAndRestore) {
+  PropertyStore props;
+  std::map<PropertyId, PropertyValue> properties;
+  for (auto i = 0; i < 32; ++i) {
+    properties.emplace(PropertyId::FromInt(i), PropertyValue(std::string(16, static_cast<char>('a' + i % 26))));
+  }
+  ASSERT_TRUE(props.InitProperties(properties));
+
+  // Small stores stay in memory.
+  ASSERT_FALSE(props.Evict(std::numeric_limits<uint32_t>::max()));
+  ASSERT_FALSE(props.IsEvicted());
+
+  ASSERT_TRUE(props.Evict(0));
+  ASSERT_TRUE(props.IsEvicted());
+  ASSERT_FALSE(props.Evict(0));
+  ASSERT_EQ(props.Properties(), properties);
+  ASSERT_EQ(props.GetProperty(PropertyId::FromInt(3)), properties[PropertyId::FromInt(3)]);
+  ASSERT_TRUE(props.HasProperty(PropertyId::FromInt(31)));
+
+  ASSERT_TRUE(props.Restore());
+  ASSERT_FALSE(props.IsEvicted());
+  ASSERT_FALSE(props.Restore());
+  ASSERT_EQ(props.Properties(), properties);
+
+  // Changing an evicted store brings it back to memory.
+  ASSERT_TRUE(props.Evict(0));
+  ASSERT_FALSE(props.SetProperty(PropertyId::FromInt(3), PropertyValue(3)));
+  properties[PropertyId::FromInt(3)] = PropertyValue(3);
+  ASSERT_FALSE(props.IsEvicted());
+  ASSERT_EQ(props.Properties(), properties);
+
+  ASSERT_TRUE(props.Evict(0));
+  ASSERT_TRUE(props.ClearProperties());
+  ASSERT_FALSE(props.IsEvicted());
+  ASSERT_TRUE(props.Properties().empty());
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
+  auto const tier_directory = std::filesystem::temp_directory_path() / "MG_test_unit_storage_v2_property_store_tier";
+  FLAGS_storage_property_tier_directory = tier_directory.string();
   int result = RUN_ALL_TESTS();
 
   // now run with compression on
   FLAGS_storage_property_store_compression_enabled = true;
   result &= RUN_ALL_TESTS();
+  std::filesystem::remove_all(tier_directory);
   return result;
 }
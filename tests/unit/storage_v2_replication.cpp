@@ -11,6 +11,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <thread>
@@ -25,6 +26,7 @@
 #include "auth/auth.hpp"
 #include "dbms/database.hpp"
 #include "dbms/dbms_handler.hpp"
+#include "flags/replication.hpp"
 #include "query/interpreter_context.hpp"
 #include "replication/config.hpp"
 #include "replication/state.hpp"
@@ -32,8 +34,10 @@
 #include "storage/v2/durability/paths.hpp"
 #include "storage/v2/indices/label_index_stats.hpp"
 #include "storage/v2/replication/recovery.hpp"
+#include "storage/v2/replication/serialization.hpp"
 #include "storage/v2/storage.hpp"
 #include "storage/v2/view.hpp"
+#include "utils/on_scope_exit.hpp"
 
 using testing::UnorderedElementsAre;
 
@@ -293,6 +297,7 @@ TEST_F(ReplicationTest, BasicSynchronousReplicationTest) {
 
   // label index create
   // label property index create
+  // composite index create
   // existence constraint create
   // unique constriant create
   const auto *label = "label";
@@ -324,6 +329,15 @@ TEST_F(ReplicationTest, BasicSynchronousReplicationTest) {
                               lp_stats);
     ASSERT_FALSE(unique_acc->Commit({}, main.db_acc).HasError());
   }
+  {
+    auto unique_acc = main.db.UniqueAccess();
+    ASSERT_FALSE(unique_acc
+                     ->CreateIndex(main.db.storage()->NameToLabel(label),
+                                   std::vector{main.db.storage()->NameToProperty(property_extra),
+                                               main.db.storage()->NameToProperty(property)})
+                     .HasError());
+    ASSERT_FALSE(unique_acc->Commit({}, main.db_acc).HasError());
+  }
   {
     auto unique_acc = main.db.UniqueAccess();
     ASSERT_FALSE(unique_acc
@@ -348,6 +362,10 @@ TEST_F(ReplicationTest, BasicSynchronousReplicationTest) {
     ASSERT_THAT(indices.label_property,
                 UnorderedElementsAre(std::make_pair(replica.db.storage()->NameToLabel(label),
                                                     replica.db.storage()->NameToProperty(property))));
+    ASSERT_THAT(indices.label_property_composite,
+                UnorderedElementsAre(std::make_pair(replica.db.storage()->NameToLabel(label),
+                                                    std::vector{replica.db.storage()->NameToProperty(property_extra),
+                                                                replica.db.storage()->NameToProperty(property)})));
     const auto &l_stats_rep = replica.db.Access()->GetIndexStats(replica.db.storage()->NameToLabel(label));
     ASSERT_TRUE(l_stats_rep);
     ASSERT_EQ(l_stats_rep->count, l_stats.count);
@@ -372,6 +390,7 @@ TEST_F(ReplicationTest, BasicSynchronousReplicationTest) {
 
   // label index drop
   // label property index drop
+  // composite index drop
   // existence constraint drop
   // unique constriant drop
   {
@@ -396,6 +415,15 @@ TEST_F(ReplicationTest, BasicSynchronousReplicationTest) {
             .HasError());
     ASSERT_FALSE(unique_acc->Commit({}, main.db_acc).HasError());
   }
+  {
+    auto unique_acc = main.db.UniqueAccess();
+    ASSERT_FALSE(unique_acc
+                     ->DropIndex(main.db.storage()->NameToLabel(label),
+                                 std::vector{main.db.storage()->NameToProperty(property_extra),
+                                             main.db.storage()->NameToProperty(property)})
+                     .HasError());
+    ASSERT_FALSE(unique_acc->Commit({}, main.db_acc).HasError());
+  }
   {
     auto unique_acc = main.db.UniqueAccess();
     ASSERT_FALSE(unique_acc
@@ -417,6 +445,7 @@ TEST_F(ReplicationTest, BasicSynchronousReplicationTest) {
     const auto indices = replica.db.Access()->ListAllIndices();
     ASSERT_EQ(indices.label.size(), 0);
     ASSERT_EQ(indices.label_property.size(), 0);
+    ASSERT_EQ(indices.label_property_composite.size(), 0);
 
     const auto &l_stats_rep = replica.db.Access()->GetIndexStats(replica.db.storage()->NameToLabel(label));
     ASSERT_FALSE(l_stats_rep);
@@ -514,6 +543,81 @@ TEST_F(ReplicationTest, MultipleSynchronousReplicationTest) {
   }
 }
 
+TEST_F(ReplicationTest, SynchronousReplicationQuorum) {
+  MinMemgraph main(main_conf);
+  std::optional<MinMemgraph> replica1{std::in_place, repl_conf};
+  std::optional<MinMemgraph> replica2{std::in_place, repl2_conf};
+  FLAGS_replication_sync_quorum = 1;
+  memgraph::utils::OnScopeExit reset_quorum{[] { FLAGS_replication_sync_quorum = 0; }};
+
+  for (auto i = 0; i < 2; ++i) {
+    auto &replica = i == 0 ? replica1 : replica2;
+    replica->repl_handler.TrySetReplicationRoleReplica(
+        ReplicationServerConfig{
+            .repl_server = Endpoint(local_host, ports[i]),
+        },
+        std::nullopt);
+    ASSERT_FALSE(main.repl_handler
+                     .TryRegisterReplica(ReplicationClientConfig{
+                         .name = replicas[i],
+                         .mode = ReplicationMode::SYNC,
+                         .repl_server_endpoint = Endpoint(local_host, ports[i]),
+                     })
+                     .HasError());
+  }
+
+  const auto create_vertex = [&] {
+    auto acc = main.db.Access();
+    const auto gid = acc->CreateVertex().Gid();
+    return std::make_pair(gid, !acc->Commit({}, main.db_acc).HasError());
+  };
+  const auto has_vertex = [](memgraph::dbms::Database &database, Gid gid) {
+    auto acc = database.Access();
+    return acc->FindVertex(gid, View::OLD).has_value();
+  };
+  const auto eventually_has_vertex = [&](memgraph::dbms::Database &database, Gid gid) {
+    for (auto tries = 0; tries < 100; ++tries) {
+      if (has_vertex(database, gid)) return true;
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    return false;
+  };
+
+  {
+    // The replica which doesn't count towards the quorum confirms the commit in the background
+    const auto [gid, committed] = create_vertex();
+    ASSERT_TRUE(committed);
+    ASSERT_TRUE(eventually_has_vertex(replica1->db, gid));
+    ASSERT_TRUE(eventually_has_vertex(replica2->db, gid));
+  }
+
+  replica2.reset();
+  {
+    // One SYNC replica is enough for the quorum
+    const auto [gid, committed] = create_vertex();
+    ASSERT_TRUE(committed);
+    ASSERT_TRUE(has_vertex(replica1->db, gid));
+  }
+  {
+    // A quorum of all SYNC replicas can't be met without REPLICA2
+    FLAGS_replication_sync_quorum = 2;
+    const auto [gid, committed] = create_vertex();
+    ASSERT_FALSE(committed);
+    // The transaction is still committed on MAIN and the other replicas
+    ASSERT_TRUE(has_vertex(main.db, gid));
+    ASSERT_TRUE(eventually_has_vertex(replica1->db, gid));
+    FLAGS_replication_sync_quorum = 1;
+  }
+
+  replica1.reset();
+  {
+    // No SYNC replica confirms the commit
+    const auto [gid, committed] = create_vertex();
+    ASSERT_FALSE(committed);
+    ASSERT_TRUE(has_vertex(main.db, gid));
+  }
+}
+
 TEST_F(ReplicationTest, RecoveryProcess) {
   std::vector<Gid> vertex_gids;
   // Force the creation of snapshot
@@ -1327,3 +1431,70 @@ TEST_F(ReplicationTest, RecoverySteps) {
     ASSERT_TRUE(std::holds_alternative<memgraph::storage::RecoveryCurrentWal>(recovery_steps[2]));
   }
 }
+
+TEST_F(ReplicationTest, SnapshotDiffReusesEqualBlocks) {
+  using memgraph::storage::replication::kFileBlockSize;
+  std::filesystem::create_directories(storage_directory);
+  std::filesystem::create_directories(repl_storage_directory);
+
+  auto write_file = [](const std::filesystem::path &path, const std::vector<uint8_t> &data) {
+    memgraph::utils::OutputFile file;
+    file.Open(path, memgraph::utils::OutputFile::Mode::OVERWRITE_EXISTING);
+    file.Write(data.data(), data.size());
+    file.Close();
+  };
+  auto read_file = [](const std::filesystem::path &path) {
+    memgraph::utils::InputFile file;
+    MG_ASSERT(file.Open(path));
+    std::vector<uint8_t> data(file.GetSize());
+    MG_ASSERT(file.Read(data.data(), data.size()));
+    return data;
+  };
+
+  // The replica has the first and the third block, and the second one moved to the end.
+  std::vector<uint8_t> base(kFileBlockSize * 3);
+  for (size_t i = 0; i < base.size(); ++i) base[i] = static_cast<uint8_t>(i / kFileBlockSize + 1);
+  std::vector<uint8_t> sent(base.begin(), base.begin() + kFileBlockSize);
+  sent.insert(sent.end(), kFileBlockSize, 42);
+  sent.insert(sent.end(), base.begin() + 2 * kFileBlockSize, base.end());
+  sent.insert(sent.end(), base.begin() + kFileBlockSize, base.begin() + 2 * kFileBlockSize);
+  sent.insert(sent.end(), 100, 7);
+  write_file(storage_directory / "snapshot", sent);
+
+  auto send = [&](const std::filesystem::path &base_path, const std::function<void()> &before_receive) {
+    write_file(repl_storage_directory / "snapshot", base);
+    std::vector<uint8_t> buffer;
+    memgraph::slk::Builder builder([&buffer](const uint8_t *data, size_t size, bool /*have_more*/) {
+      buffer.insert(buffer.end(), data, data + size);
+    });
+    memgraph::storage::replication::Encoder encoder(&builder);
+    auto hashes = memgraph::storage::replication::HashFileBlocks(repl_storage_directory / "snapshot");
+    MG_ASSERT(hashes.size() == 3);
+    MG_ASSERT(encoder.WriteFileDiff(storage_directory / "snapshot", hashes) == kFileBlockSize * 3);
+    builder.Finalize();
+    MG_ASSERT(buffer.size() < sent.size() - kFileBlockSize * 3 + kFileBlockSize / 2);
+
+    before_receive();
+    memgraph::slk::Reader reader(buffer.data(), buffer.size());
+    memgraph::storage::replication::Decoder decoder(&reader);
+    return decoder.ReadFileDiff(repl_storage_directory, base_path);
+  };
+
+  {
+    auto path = send(repl_storage_directory / "snapshot", [] {});
+    ASSERT_TRUE(path);
+    ASSERT_EQ(*path, repl_storage_directory / "snapshot");
+    ASSERT_EQ(read_file(*path), sent);
+  }
+  ASSERT_FALSE(send(repl_storage_directory / "missing", [] {}));
+  {
+    // The base changed after it was hashed, the received file doesn't match and the base is kept
+    auto changed = base;
+    changed[kFileBlockSize * 2] = 0;
+    auto path = send(repl_storage_directory / "snapshot",
+                     [&] { write_file(repl_storage_directory / "snapshot", changed); });
+    ASSERT_FALSE(path);
+    ASSERT_EQ(read_file(repl_storage_directory / "snapshot"), changed);
+    ASSERT_FALSE(std::filesystem::exists(repl_storage_directory / "snapshot.tmp"));
+  }
+}
@@ -2330,3 +2330,39 @@ TYPED_TEST(SchemaInfoTestWEdgeProp, AllPropertyTypes) {
     check_json(json["edges"], 100.0);
   }
 }
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST(SchemaInfoTracking, MergeDiff) {
+  const auto l1 = LabelId::FromUint(1);
+  const auto l2 = LabelId::FromUint(2);
+  const auto p = PropertyId::FromUint(1);
+  const auto e = EdgeTypeId::FromUint(1);
+  const auto int_type = ExtendedPropertyType{PropertyValueType::Int};
+
+  Tracking tracking;
+  tracking[VertexKey{l1}].n = 2;
+  tracking[VertexKey{l1}].properties[p].n = 1;
+  tracking[VertexKey{l1}].properties[p].types[int_type] = 1;
+
+  // Move one vertex from l1 to l2 (with its property) and add an edge between them
+  Tracking diff;
+  --diff[VertexKey{l1}].n;
+  --diff[VertexKey{l1}].properties[p].n;
+  --diff[VertexKey{l1}].properties[p].types[int_type];
+  ++diff[VertexKey{l2}].n;
+  ++diff[VertexKey{l2}].properties[p].n;
+  ++diff[VertexKey{l2}].properties[p].types[int_type];
+  ++diff[EdgeKey{e, VertexKey{l1}, VertexKey{l2}}].n;
+
+  tracking.Merge(std::move(diff));
+
+  EXPECT_EQ(tracking.NumberOfVertices(), 2);
+  EXPECT_EQ(tracking.NumberOfEdges(), 1);
+  EXPECT_EQ(tracking[VertexKey{l1}].n, 1);
+  EXPECT_EQ(tracking[VertexKey{l1}].properties[p].n, 0);
+  EXPECT_EQ(tracking[VertexKey{l1}].properties[p].types[int_type], 0);
+  EXPECT_EQ(tracking[VertexKey{l2}].n, 1);
+  EXPECT_EQ(tracking[VertexKey{l2}].properties[p].n, 1);
+  EXPECT_EQ(tracking[VertexKey{l2}].properties[p].types[int_type], 1);
+  EXPECT_EQ((tracking[EdgeKey{e, VertexKey{l1}, VertexKey{l2}}].n), 1);
+}
@@ -0,0 +1,142 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "storage/v2/inmemory/storage.hpp"
+#include "storage/v2/vertex_version_store.hpp"
+
+using memgraph::storage::Gid;
+using memgraph::storage::InMemoryStorage;
+using memgraph::storage::PropertyValue;
+using memgraph::storage::View;
+using testing::ElementsAre;
+using testing::UnorderedElementsAre;
+
+class VertexVersionsTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    old_threshold = FLAGS_delta_chain_materialize_threshold;
+    FLAGS_delta_chain_materialize_threshold = 4;
+    storage = std::make_unique<InMemoryStorage>(
+        memgraph::storage::Config{.gc = {.type = memgraph::storage::Config::Gc::Type::NONE}});
+    label = storage->NameToLabel("Label");
+    other_label = storage->NameToLabel("Other");
+    property = storage->NameToProperty("value");
+
+    auto acc = storage->Access();
+    auto vertex = acc->CreateVertex();
+    gid = vertex.Gid();
+    ASSERT_TRUE(vertex.AddLabel(label).HasValue());
+    ASSERT_TRUE(vertex.SetProperty(property, PropertyValue(0)).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+
+  void TearDown() override { FLAGS_delta_chain_materialize_threshold = old_threshold; }
+
+  void Modify(int64_t times) {
+    for (int64_t i = 1; i <= times; ++i) {
+      auto acc = storage->Access();
+      auto vertex = acc->FindVertex(gid, View::OLD);
+      ASSERT_TRUE(vertex);
+      ASSERT_TRUE(vertex->SetProperty(property, PropertyValue(i)).HasValue());
+      if (i % 2 == 1) {
+        ASSERT_TRUE(vertex->AddLabel(other_label).HasValue());
+      } else {
+        ASSERT_TRUE(vertex->RemoveLabel(other_label).HasValue());
+      }
+      ASSERT_FALSE(acc->Commit().HasError());
+    }
+  }
+
+  void ExpectOriginal(memgraph::storage::Storage::Accessor *acc) {
+    for (int repeat = 0; repeat < 2; ++repeat) {
+      for (auto view : {View::OLD, View::NEW}) {
+        auto vertex = acc->FindVertex(gid, view);
+        ASSERT_TRUE(vertex);
+        EXPECT_EQ(*vertex->GetProperty(property, view), PropertyValue(0));
+        EXPECT_THAT(*vertex->Properties(view), UnorderedElementsAre(std::pair{property, PropertyValue(0)}));
+        EXPECT_THAT(*vertex->Labels(view), ElementsAre(label));
+        EXPECT_TRUE(*vertex->HasLabel(label, view));
+        EXPECT_FALSE(*vertex->HasLabel(other_label, view));
+      }
+    }
+  }
+
+  uint64_t old_threshold{};
+  std::unique_ptr<memgraph::storage::Storage> storage;
+  memgraph::storage::LabelId label;
+  memgraph::storage::LabelId other_label;
+  memgraph::storage::PropertyId property;
+  Gid gid;
+};
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(VertexVersionsTest, LongRunningReaders) {
+  auto reader = storage->Access();
+  auto other_reader = storage->Access();
+  Modify(9);
+
+  // The first read materializes the version, the following ones and the reads
+  // of the other reader (which sees the same version) use it.
+  ExpectOriginal(reader.get());
+  ExpectOriginal(other_reader.get());
+
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gid, View::OLD);
+    ASSERT_TRUE(vertex);
+    EXPECT_EQ(*vertex->GetProperty(property, View::OLD), PropertyValue(9));
+    EXPECT_TRUE(*vertex->HasLabel(other_label, View::OLD));
+  }
+
+  // New changes don't change the version seen by the readers.
+  Modify(9);
+  {
+    auto acc = storage->Access();
+    auto vertex = acc->FindVertex(gid, View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_TRUE(acc->DeleteVertex(&*vertex).HasValue());
+    ASSERT_FALSE(acc->Commit().HasError());
+  }
+  ExpectOriginal(reader.get());
+  ExpectOriginal(other_reader.get());
+
+  reader.reset();
+  other_reader.reset();
+  storage->FreeMemory();
+
+  auto acc = storage->Access();
+  EXPECT_FALSE(acc->FindVertex(gid, View::OLD));
+}
+
+// NOLINTNEXTLINE(hicpp-special-member-functions)
+TEST_F(VertexVersionsTest, OwnChanges) {
+  auto reader = storage->Access();
+  {
+    auto acc = storage->Access();
+    Modify(9);
+    // `acc` started before the changes, so it sees the original version.
+    ExpectOriginal(acc.get());
+  }
+
+  auto writer = storage->Access();
+  {
+    auto vertex = writer->FindVertex(gid, View::OLD);
+    ASSERT_TRUE(vertex);
+    ASSERT_TRUE(vertex->SetProperty(property, PropertyValue(100)).HasValue());
+    EXPECT_EQ(*vertex->GetProperty(property, View::NEW), PropertyValue(100));
+    EXPECT_EQ(*vertex->GetProperty(property, View::OLD), PropertyValue(9));
+  }
+  ExpectOriginal(reader.get());
+  ASSERT_FALSE(writer->Commit().HasError());
+}
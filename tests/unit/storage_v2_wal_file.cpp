@@ -50,6 +50,10 @@ memgraph::storage::durability::WalDeltaData::Type StorageMetadataOperationToWalD
     add_case(LABEL_PROPERTY_INDEX_DROP);
     add_case(POINT_INDEX_CREATE);
     add_case(POINT_INDEX_DROP);
+    add_case(VECTOR_INDEX_CREATE);
+    add_case(VECTOR_INDEX_DROP);
+    add_case(LABEL_PROPERTY_COMPOSITE_INDEX_CREATE);
+    add_case(LABEL_PROPERTY_COMPOSITE_INDEX_DROP);
     add_case(LABEL_PROPERTY_INDEX_STATS_SET);
     add_case(LABEL_PROPERTY_INDEX_STATS_CLEAR);
     add_case(TEXT_INDEX_CREATE);
@@ -67,6 +71,9 @@ memgraph::storage::durability::WalDeltaData::Type StorageMetadataOperationToWalD
 #undef add_case
 }
 
+// Dimension written for the generated vector index operations.
+constexpr uint64_t kVectorIndexDimension = 3;
+
 // This class mimics the internals of the storage to generate the deltas.
 class DeltaGenerator final {
  public:
@@ -325,6 +332,7 @@ class DeltaGenerator final {
       case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_INDEX_DROP:
       case memgraph::storage::durability::StorageMetadataOperation::POINT_INDEX_CREATE:
       case memgraph::storage::durability::StorageMetadataOperation::POINT_INDEX_DROP:
+      case memgraph::storage::durability::StorageMetadataOperation::VECTOR_INDEX_DROP:
       case memgraph::storage::durability::StorageMetadataOperation::EXISTENCE_CONSTRAINT_CREATE:
       case memgraph::storage::durability::StorageMetadataOperation::EXISTENCE_CONSTRAINT_DROP: {
         apply_encode(operation, [&](memgraph::storage::durability::BaseEncoder &encoder) {
@@ -332,6 +340,12 @@ class DeltaGenerator final {
         });
         break;
       }
+      case memgraph::storage::durability::StorageMetadataOperation::VECTOR_INDEX_CREATE: {
+        apply_encode(operation, [&](memgraph::storage::durability::BaseEncoder &encoder) {
+          EncodeVectorIndex(encoder, mapper_, {label_id, *property_ids.begin(), kVectorIndexDimension});
+        });
+        break;
+      }
       case memgraph::storage::durability::StorageMetadataOperation::LABEL_INDEX_STATS_SET: {
         apply_encode(operation, [&](memgraph::storage::durability::BaseEncoder &encoder) {
           EncodeLabelStats(encoder, mapper_, label_id, l_stats);
@@ -352,6 +366,18 @@ class DeltaGenerator final {
         });
         break;
       }
+      case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+      case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_COMPOSITE_INDEX_DROP: {
+        // The properties are kept in the order of their names.
+        std::vector<memgraph::storage::PropertyId> property_list;
+        for (const auto &property : properties) {
+          property_list.push_back(memgraph::storage::PropertyId::FromUint(mapper_.NameToId(property)));
+        }
+        apply_encode(operation, [&](memgraph::storage::durability::BaseEncoder &encoder) {
+          EncodeLabelPropertyList(encoder, mapper_, label_id, property_list);
+        });
+        break;
+      }
       case memgraph::storage::durability::StorageMetadataOperation::TYPE_CONSTRAINT_CREATE:
       case memgraph::storage::durability::StorageMetadataOperation::TYPE_CONSTRAINT_DROP: {
         apply_encode(operation, [&](memgraph::storage::durability::BaseEncoder &encoder) {
@@ -403,11 +429,17 @@ class DeltaGenerator final {
         case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_INDEX_DROP:
         case memgraph::storage::durability::StorageMetadataOperation::POINT_INDEX_CREATE:
         case memgraph::storage::durability::StorageMetadataOperation::POINT_INDEX_DROP:
+        case memgraph::storage::durability::StorageMetadataOperation::VECTOR_INDEX_DROP:
         case memgraph::storage::durability::StorageMetadataOperation::EXISTENCE_CONSTRAINT_CREATE:
         case memgraph::storage::durability::StorageMetadataOperation::EXISTENCE_CONSTRAINT_DROP:
           data.operation_label_property.label = label;
           data.operation_label_property.property = *properties.begin();
           break;
+        case memgraph::storage::durability::StorageMetadataOperation::VECTOR_INDEX_CREATE:
+          data.operation_vector_index.label = label;
+          data.operation_vector_index.property = *properties.begin();
+          data.operation_vector_index.dimension = kVectorIndexDimension;
+          break;
         case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_INDEX_STATS_SET:
           data.operation_label_property_stats.label = label;
           data.operation_label_property_stats.property = *properties.begin();
@@ -418,6 +450,11 @@ class DeltaGenerator final {
           data.operation_label_properties.label = label;
           data.operation_label_properties.properties = properties;
           break;
+        case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_COMPOSITE_INDEX_CREATE:
+        case memgraph::storage::durability::StorageMetadataOperation::LABEL_PROPERTY_COMPOSITE_INDEX_DROP:
+          data.operation_label_property_list.label = label;
+          data.operation_label_property_list.properties = {properties.begin(), properties.end()};
+          break;
         case memgraph::storage::durability::StorageMetadataOperation::TYPE_CONSTRAINT_CREATE:
         case memgraph::storage::durability::StorageMetadataOperation::TYPE_CONSTRAINT_DROP:
           data.operation_label_property_type.label = label;
@@ -780,6 +817,10 @@ GENERATE_SIMPLE_TEST(AllGlobalOperations, {
   OPERATION_TX(UNIQUE_CONSTRAINT_DROP, "hello", {"world", "and", "universe"});
   OPERATION_TX(TYPE_CONSTRAINT_CREATE, "hello", {"world"})
   OPERATION_TX(TYPE_CONSTRAINT_DROP, "hello", {"world"});
+  OPERATION_TX(VECTOR_INDEX_CREATE, "hello", {"world"});
+  OPERATION_TX(VECTOR_INDEX_DROP, "hello", {"world"});
+  OPERATION_TX(LABEL_PROPERTY_COMPOSITE_INDEX_CREATE, "hello", {"world", "and", "universe"});
+  OPERATION_TX(LABEL_PROPERTY_COMPOSITE_INDEX_DROP, "hello", {"world", "and", "universe"});
 });
 
 // NOLINTNEXTLINE(hicpp-special-member-functions)
@@ -14,6 +14,10 @@
 // Created by Florijan Stamenkovic on 07.03.17.
 //
 
+#include <optional>
+#include <string>
+#include <vector>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
@@ -415,4 +419,36 @@ TEST(QueryStripper, CreateTriggerQuery) {
   }
 }
 
+TEST(QueryStripper, LexersAgree) {
+  const std::vector<std::string> queries{
+      "MATCH (n:Label {prop: 42}) WHERE n.name = 'Andres' AND n.x > 0.5e-3 RETURN n, n.p AS p",
+      "CREATE (:L1:L2 {p1: true, p2: 0x1f, p3: 017, p4: \"Here is some text that is not extremely short\"})",
+      "RETURN 'esc\\'aped \\u0041\\U0001F600 \\n\\t' AS s",
+      "MATCH (a)-[r:T*1..2]->(b) // a line comment\nRETURN /* a block\ncomment */ count(*)",
+      "  \t\n\x1c\x1f   RETURN    $param1, $`escaped param`, $0, `escaped ``name```",
+      "RETURN \u0161ifra, \u00e9t\u00e9, name\u00ad, 1\u20102, x\u2212y, \u00a0 \u3000 1",
+      "MATCH (averyveryveryveryverylongidentifiername_with_underscores_0123456789) RETURN averyveryveryveryverylo",
+      "RETURN 1.5, .5, 5., 5e3, 5e-3, 5E, 0.0, 00, 0x, 0xg, 123456789012345678",
+      "CREATE TRIGGER execute AFTER COMMIT EXECUTE CREATE (n:Node)",
+      "RETURN 'open string with a backslash at the end\\",
+  };
+  for (const auto &query : queries) {
+    SCOPED_TRACE(query);
+    std::optional<StrippedQuery> table;
+    std::optional<StrippedQuery> simd;
+    try {
+      table.emplace(query, StrippedQuery::Lexer::TABLE);
+    } catch (const LexingException &) {
+      EXPECT_THROW(StrippedQuery(query, StrippedQuery::Lexer::SIMD), LexingException);
+      continue;
+    }
+    simd.emplace(query, StrippedQuery::Lexer::SIMD);
+    EXPECT_EQ(table->query(), simd->query());
+    EXPECT_EQ(table->hash(), simd->hash());
+    EXPECT_EQ(table->literals().size(), simd->literals().size());
+    EXPECT_EQ(table->parameters(), simd->parameters());
+    EXPECT_EQ(table->named_expressions(), simd->named_expressions());
+  }
+}
+
 }  // namespace
@@ -122,3 +122,24 @@ TYPED_TEST(TransactionQueueSimpleTest, TwoInterpretersInterleaving) {
     running_thread.request_stop();
   }
 }
+
+TYPED_TEST(TransactionQueueSimpleTest, ShowsResourceUsage) {
+  this->running_interpreter.Interpret("BEGIN");
+  this->running_interpreter.Interpret("UNWIND range(1, 10) AS i CREATE (:Person {prop: i})");
+  this->running_interpreter.Interpret("MATCH (n) RETURN n");
+
+  auto show_stream = this->main_interpreter.Interpret("SHOW TRANSACTIONS");
+  ASSERT_EQ(show_stream.GetHeader().size(), 5U);
+  EXPECT_EQ(show_stream.GetHeader()[4], "resource_usage");
+  ASSERT_EQ(show_stream.GetResults().size(), 2U);
+  const auto &rows = show_stream.GetResults();
+  // The row of the running transaction is the one which isn't running SHOW TRANSACTIONS
+  const auto &row = rows[0][2].ValueList().at(0).ValueString() == "SHOW TRANSACTIONS" ? rows[1] : rows[0];
+  ASSERT_TRUE(row[4].IsMap());
+  const auto &usage = row[4].ValueMap();
+  EXPECT_GT(usage.at("deltas").ValueInt(), 0);
+  EXPECT_EQ(usage.at("scanned_vertices").ValueInt(), 10);
+  EXPECT_EQ(usage.at("wal_bytes").ValueInt(), 0);
+
+  this->running_interpreter.Interpret("ROLLBACK");
+}
@@ -268,6 +268,26 @@ TEST_F(UtilsFileTest, OutputFileMove) {
   original.Close();
 }
 
+TEST_F(UtilsFileTest, OutputFilePreallocate) {
+  const auto path = storage / "existing_dir_777" / "preallocated";
+  memgraph::utils::OutputFile handle;
+  handle.Open(path, memgraph::utils::OutputFile::Mode::OVERWRITE_EXISTING);
+  // Not every file system supports it, the size is kept either way.
+  handle.Preallocate(1024 * 1024);
+  handle.Write("hello world!\n");
+  handle.Sync();
+  handle.DropPageCache();
+  ASSERT_EQ(handle.GetSize(), 13);
+  handle.Close();
+  ASSERT_EQ(std::filesystem::file_size(path), 13);
+
+  const auto link = storage / "existing_dir_777" / "linked";
+  ASSERT_TRUE(memgraph::utils::LinkFile(path, link));
+  ASSERT_FALSE(memgraph::utils::LinkFile(path, link));
+  ASSERT_TRUE(memgraph::utils::DeleteFile(path));
+  ASSERT_EQ(std::filesystem::file_size(link), 13);
+}
+
 TEST_F(UtilsFileTest, OutputFileDescriptorLeackage) {
   for (int i = 0; i < 100000; ++i) {
     memgraph::utils::OutputFile handle;
@@ -9,9 +9,11 @@
 // by the Apache License, Version 2.0, included in the file
 // licenses/APL.txt.
 
+#include "utils/lock_contention.hpp"
 #include "utils/resource_lock.hpp"
 
 #include <gtest/gtest.h>
+#include <atomic>
 #include <shared_mutex>
 #include <thread>
 
@@ -159,3 +161,60 @@ TEST_F(ResourceLockTest, TryLock) {
   ASSERT_TRUE(lock.try_lock());
   lock.unlock();
 }
+
+TEST_F(ResourceLockTest, UnlockSharedOnOtherThread) {
+  // The shared holders are counted on the shard of the locking thread
+  for (int i = 0; i < 10; ++i) {
+    lock.lock_shared();
+    std::jthread{[&] { lock.unlock_shared(); }}.join();
+  }
+  ASSERT_TRUE(lock.try_lock());
+  lock.unlock();
+}
+
+TEST_F(ResourceLockTest, UpgradeWaitsForOtherReaders) {
+  std::atomic<bool> upgraded{false};
+  lock.lock_shared();
+  auto upgrader = std::jthread{[&] {
+    lock.lock_shared();
+    lock.upgrade_to_unique();
+    upgraded = true;
+    lock.unlock();
+  }};
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  // Readers aren't blocked by a waiting upgrade
+  ASSERT_TRUE(lock.try_lock_shared());
+  lock.unlock_shared();
+  EXPECT_FALSE(upgraded);
+  lock.unlock_shared();
+  upgrader.join();
+  EXPECT_TRUE(upgraded);
+}
+
+TEST(ResourceLockContention, TracksWaits) {
+  if constexpr (!kLockContentionTracking) {
+    GTEST_SKIP() << "Memgraph is built without MG_LOCK_CONTENTION_TRACKING";
+  }
+  ResourceLock lock{LockSite::MAIN};
+  auto const before = GetLockContentionStats()[static_cast<size_t>(LockSite::MAIN)];
+
+  // Uncontended acquisitions aren't recorded
+  lock.lock();
+  lock.unlock();
+  lock.lock_shared();
+  lock.unlock_shared();
+  EXPECT_EQ(GetLockContentionStats()[static_cast<size_t>(LockSite::MAIN)].contended, before.contended);
+
+  lock.lock();
+  auto reader = std::jthread{[&] {
+    lock.lock_shared();
+    lock.unlock_shared();
+  }};
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  lock.unlock();
+  reader.join();
+
+  auto const after = GetLockContentionStats()[static_cast<size_t>(LockSite::MAIN)];
+  EXPECT_EQ(after.contended, before.contended + 1);
+  EXPECT_GT(after.wait_ns, before.wait_ns);
+}
@@ -12,8 +12,10 @@
 #include "gtest/gtest.h"
 
 #include "utils/rw_lock.hpp"
+#include "utils/sharded_rw_lock.hpp"
 #include "utils/timer.hpp"
 
+#include <atomic>
 #include <latch>
 #include <shared_mutex>
 #include <thread>
@@ -175,3 +177,55 @@ TEST(RWLock, TryLock) {
   });
   t5.join();
 }
+
+TEST(ShardedRWLock, MultipleReaders) {
+  memgraph::utils::ShardedRWLock rwlock;
+
+  std::vector<std::thread> threads;
+  memgraph::utils::Timer timer;
+  for (int i = 0; i < 3; ++i) {
+    threads.push_back(std::thread([&rwlock] {
+      auto lock = std::shared_lock{rwlock};
+      std::this_thread::sleep_for(100ms);
+    }));
+  }
+
+  for (int i = 0; i < 3; ++i) {
+    threads[i].join();
+  }
+
+  EXPECT_LE(timer.Elapsed(), 150ms);
+  EXPECT_GE(timer.Elapsed(), 90ms);
+}
+
+TEST(ShardedRWLock, WritersExcludeReaders) {
+  memgraph::utils::ShardedRWLock rwlock;
+  // Written as two halves, a reader sees them differ if it overlaps a writer.
+  int64_t first = 0;
+  int64_t second = 0;
+  std::atomic<bool> torn{false};
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&] {
+      for (int j = 0; j < 10000; ++j) {
+        auto lock = std::shared_lock{rwlock};
+        if (first != second) torn = true;
+      }
+    });
+    threads.emplace_back([&] {
+      for (int j = 0; j < 1000; ++j) {
+        auto lock = std::unique_lock{rwlock};
+        ++first;
+        ++second;
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_FALSE(torn);
+  EXPECT_EQ(first, 4000);
+  EXPECT_EQ(second, 4000);
+}
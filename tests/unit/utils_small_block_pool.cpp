@@ -0,0 +1,84 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#include "gtest/gtest.h"
+
+#include "utils/allocator/small_block_pool.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <thread>
+#include <vector>
+
+using memgraph::utils::SmallBlockPool;
+
+TEST(SmallBlockPool, BlocksDontOverlap) {
+  constexpr auto kSize = 24;
+  std::vector<void *> blocks;
+  for (auto i = 0; i < 10'000; ++i) {
+    auto *block = SmallBlockPool::Allocate(kSize);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(block) % SmallBlockPool::kGranularity, 0);
+    memset(block, i % 256, kSize);
+    blocks.push_back(block);
+  }
+  for (auto i = 0; i < 10'000; ++i) {
+    auto const *bytes = static_cast<uint8_t const *>(blocks[i]);
+    for (auto j = 0; j < kSize; ++j) ASSERT_EQ(bytes[j], i % 256);
+  }
+  for (auto *block : blocks) SmallBlockPool::Deallocate(block, kSize);
+}
+
+TEST(SmallBlockPool, FreedBlocksAreReused) {
+  constexpr auto kSize = 40;
+  std::set<void *> freed;
+  for (auto i = 0; i < 100; ++i) freed.insert(SmallBlockPool::Allocate(kSize));
+  for (auto *block : freed) SmallBlockPool::Deallocate(block, kSize);
+  for (auto i = 0; i < 100; ++i) {
+    auto *block = SmallBlockPool::Allocate(kSize);
+    ASSERT_TRUE(freed.contains(block));
+  }
+  for (auto *block : freed) SmallBlockPool::Deallocate(block, kSize);
+}
+
+TEST(SmallBlockPool, LargeAndOverAlignedRequestsAreNotPooled) {
+  ASSERT_FALSE(SmallBlockPool::IsPooled(0, 8));
+  ASSERT_TRUE(SmallBlockPool::IsPooled(SmallBlockPool::kMaxBlockSize, 8));
+  ASSERT_FALSE(SmallBlockPool::IsPooled(SmallBlockPool::kMaxBlockSize + 1, 8));
+  ASSERT_FALSE(SmallBlockPool::IsPooled(16, 16));
+
+  auto *block = SmallBlockPool::Allocate(4096, 64);
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(block) % 64, 0);
+  SmallBlockPool::Deallocate(block, 4096, 64);
+}
+
+TEST(SmallBlockPool, BlocksFreedByAnotherThread) {
+  constexpr auto kSize = 16;
+  constexpr auto kBlocks = 50'000;
+  std::vector<void *> blocks;
+  std::jthread producer([&] {
+    for (auto i = 0; i < kBlocks; ++i) blocks.push_back(SmallBlockPool::Allocate(kSize));
+  });
+  producer.join();
+
+  std::jthread consumer([&] {
+    for (auto *block : blocks) SmallBlockPool::Deallocate(block, kSize);
+    SmallBlockPool::FlushThreadCache();
+  });
+  consumer.join();
+
+  // The blocks freed by the consumer are in the shared lists, this thread takes them before it carves a new slab
+  std::set<void *> const freed(blocks.begin(), blocks.end());
+  auto *block = SmallBlockPool::Allocate(kSize);
+  ASSERT_TRUE(freed.contains(block));
+  SmallBlockPool::Deallocate(block, kSize);
+}
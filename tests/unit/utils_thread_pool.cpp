@@ -13,7 +13,11 @@
 
 #include <atomic>
 #include <chrono>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
 #include <thread>
+#include <vector>
 
 #include <utils/thread_pool.hpp>
 
@@ -38,3 +42,41 @@ TEST(ThreadPool, Basic) {
     ASSERT_EQ(count.load(), adder_count);
   }
 }
+
+TEST(ThreadPool, SingleThreadRunsTasksInOrder) {
+  memgraph::utils::ThreadPool pool{1};
+  std::vector<int> order;
+  for (auto i = 0; i < 100; ++i) {
+    // Move-only tasks don't need a copyable wrapper.
+    pool.AddTask([&order, value = std::make_unique<int>(i)] { order.push_back(*value); });
+  }
+  while (pool.UnfinishedTasksNum() != 0) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  std::vector<int> expected(100);
+  std::iota(expected.begin(), expected.end(), 0);
+  ASSERT_EQ(order, expected);
+}
+
+TEST(ThreadPool, RunParallel) {
+  memgraph::utils::ThreadPool pool{4};
+
+  std::atomic<size_t> sum{0};
+  pool.RunParallel(1000, [&](size_t index) { sum.fetch_add(index); });
+  ASSERT_EQ(sum.load(), 999 * 1000 / 2);
+
+  // The calls made from the tasks of the pool don't wait for its workers.
+  std::atomic<int> nested{0};
+  pool.RunParallel(8, [&](size_t /*index*/) { pool.RunParallel(8, [&](size_t /*index*/) { nested.fetch_add(1); }); });
+  ASSERT_EQ(nested.load(), 64);
+
+  std::atomic<int> calls{0};
+  ASSERT_THROW(pool.RunParallel(10,
+                                [&](size_t index) {
+                                  calls.fetch_add(1);
+                                  if (index == 3) throw std::runtime_error("failed");
+                                }),
+               std::runtime_error);
+  ASSERT_EQ(calls.load(), 10);
+}
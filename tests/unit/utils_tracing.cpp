@@ -0,0 +1,111 @@
+// Copyright 2024 Memgraph Ltd.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.txt; by using this file, you agree to be bound by the terms of the Business Source
+// License, and you may not use this file except in compliance with the Business Source License.
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0, included in the file
+// licenses/APL.txt.
+
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "utils/tracing.hpp"
+
+using namespace memgraph::utils::tracing;
+
+namespace {
+void ClearSpans() { (void)TakeSpans(SpanBuffer::kCapacity); }
+}  // namespace
+
+TEST(Tracing, NoSpansOutsideOfTrace) {
+  ClearSpans();
+  SetSampleRate(0);
+  {
+    Trace const trace("root");
+    ScopedSpan const span("child");
+  }
+  { ScopedSpan const span("span"); }
+  EXPECT_TRUE(TakeSpans(SpanBuffer::kCapacity).empty());
+}
+
+TEST(Tracing, NestedSpans) {
+  ClearSpans();
+  SetSampleRate(1);
+  {
+    Trace const trace("root");
+    {
+      ScopedSpan const first("first");
+      ScopedSpan const nested("nested");
+    }
+    // A trace inside of a trace is a span of it.
+    Trace const second("second");
+  }
+  { ScopedSpan const span("after"); }
+  SetSampleRate(0);
+
+  const auto spans = TakeSpans(SpanBuffer::kCapacity);
+  ASSERT_EQ(spans.size(), 4);
+  // The spans are in the order they finished.
+  const auto &nested = spans[0];
+  const auto &first = spans[1];
+  const auto &second = spans[2];
+  const auto &root = spans[3];
+  EXPECT_STREQ(nested.name, "nested");
+  EXPECT_STREQ(first.name, "first");
+  EXPECT_STREQ(second.name, "second");
+  EXPECT_STREQ(root.name, "root");
+  EXPECT_EQ(root.parent_span_id, 0);
+  EXPECT_EQ(first.parent_span_id, root.span_id);
+  EXPECT_EQ(nested.parent_span_id, first.span_id);
+  EXPECT_EQ(second.parent_span_id, root.span_id);
+  for (const auto &span : spans) {
+    EXPECT_EQ(span.trace_id_high, root.trace_id_high);
+    EXPECT_EQ(span.trace_id_low, root.trace_id_low);
+    EXPECT_NE(span.span_id, 0);
+    EXPECT_LE(span.start_ns, span.end_ns);
+    EXPECT_LE(root.start_ns, span.start_ns);
+    EXPECT_GE(root.end_ns, span.end_ns);
+  }
+}
+
+TEST(Tracing, SampleRate) {
+  ClearSpans();
+  SetSampleRate(3);
+  // The requests are counted on each thread, a new one starts from zero.
+  std::thread([] {
+    for (int i = 0; i < 9; ++i) {
+      Trace const trace("root");
+    }
+  }).join();
+  SetSampleRate(0);
+  EXPECT_EQ(TakeSpans(SpanBuffer::kCapacity).size(), 3);
+}
+
+TEST(Tracing, DropsSpansWhenFull) {
+  ClearSpans();
+  SetSampleRate(1);
+  const auto dropped = DroppedSpans();
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([] {
+      for (size_t j = 0; j < SpanBuffer::kCapacity / 2; ++j) {
+        Trace const trace("root");
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  SetSampleRate(0);
+  EXPECT_EQ(TakeSpans(2 * SpanBuffer::kCapacity).size(), SpanBuffer::kCapacity);
+  EXPECT_EQ(DroppedSpans() - dropped, SpanBuffer::kCapacity);
+  // The buffer takes spans again once it is drained.
+  SetSampleRate(1);
+  { Trace const trace("root"); }
+  SetSampleRate(0);
+  EXPECT_EQ(TakeSpans(SpanBuffer::kCapacity).size(), 1);
+}